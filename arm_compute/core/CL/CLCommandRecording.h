@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLCOMMANDRECORDING_H__
+#define __ARM_COMPUTE_CLCOMMANDRECORDING_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace arm_compute
+{
+/** Sequence of OpenCL kernel enqueues recorded with their arguments, to enqueue them again without running the host code of the kernels.
+ *
+ * While a recording is active, the arguments the kernels set through @ref ICLKernel::add_argument() and the add_*D_tensor_argument() methods
+ * and the NDRanges they enqueue through @ref enqueue() are recorded, the kernels being enqueued as usual. Only the arguments which differ from
+ * the ones the kernel holds at that point of a replay are set again before each enqueue: a kernel enqueued once per run is replayed without
+ * setting any argument.
+ *
+ * @note The recorded arguments refer to the OpenCL buffers of the tensors: the tensors must not be reallocated while the recording is replayed.
+ * @note Commands which aren't enqueued through @ref enqueue() (e.g. buffer reads and writes, NDRanges enqueued directly in the queue) are not recorded.
+ */
+class CLCommandRecording
+{
+public:
+    /** Default constructor */
+    CLCommandRecording();
+    /** Prevent instances of this class from being copied (As this class keeps a pointer to the active recording) */
+    CLCommandRecording(const CLCommandRecording &) = delete;
+    /** Prevent instances of this class from being copied (As this class keeps a pointer to the active recording) */
+    CLCommandRecording &operator=(const CLCommandRecording &) = delete;
+    /** Stop recording if the recording is active */
+    ~CLCommandRecording();
+    /** Start recording, discarding any previous content
+     *
+     * @note Only one recording can be active at a time.
+     */
+    void begin();
+    /** Stop recording and compute the arguments to set before each enqueue of a replay */
+    void end();
+    /** Returns whether no enqueue was recorded
+     *
+     * @return True if there is nothing to replay.
+     */
+    bool empty() const;
+    /** Returns the number of recorded enqueues
+     *
+     * @return The number of NDRanges enqueued by @ref replay().
+     */
+    size_t size() const;
+    /** Enqueue the recorded kernels with their recorded arguments and NDRanges
+     *
+     * @note The queue is *not* flushed by this method.
+     *
+     * @param[in,out] queue Command queue on which to enqueue the kernels.
+     */
+    void replay(cl::CommandQueue &queue);
+    /** Returns the active recording
+     *
+     * @return The recording between its @ref begin() and @ref end(), nullptr if none is active.
+     */
+    static CLCommandRecording *active();
+    /** Record an argument set on a kernel
+     *
+     * @param[in] kernel Kernel the argument is set on.
+     * @param[in] index  Index of the argument.
+     * @param[in] size   Size of the argument in bytes.
+     * @param[in] value  Pointer to the value of the argument, nullptr for a local memory argument.
+     */
+    void record_argument(const cl::Kernel &kernel, unsigned int index, size_t size, const void *value);
+    /** Record an enqueue of a kernel
+     *
+     * @param[in] kernel Kernel enqueued.
+     * @param[in] gws    Global workgroup size.
+     * @param[in] lws    Local workgroup size.
+     */
+    void record_enqueue(const cl::Kernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws);
+
+private:
+    /** Value of a kernel argument */
+    struct Argument
+    {
+        /** Default constructor */
+        Argument()
+            : size(0), is_local(false), value()
+        {
+        }
+
+        size_t                     size;     /**< Size of the argument in bytes */
+        bool                       is_local; /**< True for a local memory argument, which has no value */
+        std::vector<unsigned char> value;    /**< Bytes of the value of the argument */
+    };
+    /** Arguments of a kernel indexed by their position */
+    using Arguments = std::map<unsigned int, Argument>;
+    /** Enqueue of a kernel */
+    struct Command
+    {
+        cl::Kernel  kernel;    /**< Kernel to enqueue */
+        Arguments   arguments; /**< Arguments the kernel holds when it is enqueued, then the ones to set before enqueuing it in a replay */
+        cl::NDRange gws;       /**< Global workgroup size */
+        cl::NDRange lws;       /**< Local workgroup size */
+    };
+
+    std::vector<Command>           _commands;
+    std::map<cl_kernel, Arguments> _arguments;
+};
+}
+#endif /* __ARM_COMPUTE_CLCOMMANDRECORDING_H__ */
@@ -26,10 +26,14 @@
 
 #include "arm_compute/core/CL/OpenCL.h"
 
+#include <future>
+#include <iosfwd>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -70,6 +74,11 @@ public:
     {
         return _name;
     }
+    /** Hash of the source the program is created from, or of its binary
+     *
+     * @return The FNV-1a hash of the source, or of the binary if the program is created from a binary.
+     */
+    uint64_t content_hash() const;
     /** User-defined conversion to the underlying CL program.
      *
      * @return The CL program object.
@@ -204,6 +213,28 @@ public:
     {
         _device = std::move(device);
     };
+    /** Gets the CL context used to create programs.
+     *
+     * @return The CL context, in which the buffers used internally by the kernels must be created.
+     */
+    const cl::Context &context() const
+    {
+        return _context;
+    }
+    /** Sets the directory in which the programs built from source are cached.
+     *
+     * Every program built from source is then saved in this directory, and the next processes create their kernels from the saved binary
+     * instead of compiling the program again. A binary is keyed by the program name, the build options, the device name and version and the driver version:
+     * a driver update invalidates the cached binaries.
+     *
+     * @note The directory must exist and be writable by the application (e.g. an app-private directory on Android). The cache is disabled by default.
+     *
+     * @param[in] cache_path Path of the cache directory. An empty path disables the cache.
+     */
+    void set_binary_cache_path(const std::string &cache_path)
+    {
+        _binary_cache_path = cache_path;
+    };
     /** Creates a kernel from the kernel library.
      *
      * @param[in] kernel_name       Kernel name.
@@ -212,6 +243,44 @@ public:
      * @return The created kernel.
      */
     Kernel create_kernel(const std::string &kernel_name, const StringSet &build_options_set = {}) const;
+    /** Build the programs of some kernels in the background on a pool of threads.
+     *
+     * @ref create_kernel() doesn't compile the programs built in the background: it only waits for the end of their compilation if it is still running.
+     * Typically called at startup with the kernels of a network (See @ref record_kernels()) before loading the weights, so that the compilation overlaps with the I/O.
+     *
+     * @note Each program is built once per set of build options, whatever the number of kernels it contains.
+     *
+     * @param[in] kernels     Names and build options of the kernels to create later.
+     * @param[in] num_threads (Optional) Number of threads building the programs. Defaults to the number of hardware threads.
+     */
+    void precompile(const std::vector<std::pair<std::string, StringSet>> &kernels, unsigned int num_threads = 0);
+    /** Wait for the end of all the compilations started by @ref precompile() */
+    void wait_precompiled();
+    /** Start or stop recording the kernels created by @ref create_kernel().
+     *
+     * Recording the kernels while the functions of a network are configured gives the list to pass to @ref precompile() on the next launches.
+     *
+     * @param[in] enable True to start recording, false to stop. Starting a recording clears the previous one.
+     */
+    void record_kernels(bool enable);
+    /** Names and build options of the kernels created while recording.
+     *
+     * @return The recorded kernels, each one listed once.
+     */
+    std::vector<std::pair<std::string, StringSet>> recorded_kernels() const;
+    /** Write a list of kernels to a text stream: one kernel per line, the name followed by the build options separated by tabs.
+     *
+     * @param[out] stream  Output stream.
+     * @param[in]  kernels Names and build options of the kernels.
+     */
+    static void write_kernel_list(std::ostream &stream, const std::vector<std::pair<std::string, StringSet>> &kernels);
+    /** Read a list of kernels written by @ref write_kernel_list().
+     *
+     * @param[in] stream Input stream.
+     *
+     * @return The names and build options of the kernels.
+     */
+    static std::vector<std::pair<std::string, StringSet>> read_kernel_list(std::istream &stream);
     /** Serializes and saves programs to a binary.
      *
      */
@@ -227,6 +296,22 @@ private:
      * @param[in] program_name Name of the program to load.
      */
     const Program &load_program(const std::string &program_name) const;
+    /** Return a built program: retrieved from the programs already built, waiting for its compilation in the background or building it.
+     *
+     * @param[in] program_name  Name of the program.
+     * @param[in] build_options Options used to build the program.
+     *
+     * @return The built program.
+     */
+    cl::Program get_built_program(const std::string &program_name, const std::string &build_options) const;
+    /** Build a program, from the binary cache if it is enabled and has the program or from its source.
+     *
+     * @param[in] program_name  Name of the program.
+     * @param[in] build_options Options used to build the program.
+     *
+     * @return The built program.
+     */
+    cl::Program build_program(const std::string &program_name, const std::string &build_options) const;
     /** Concatenates contents of a set into a single string.
      *
      * @param[in] s Input set to concatenate.
@@ -234,12 +319,53 @@ private:
      * @return Concatenated string.
      */
     std::string stringify_set(const StringSet &s) const;
+    /** Key identifying a built program in the binary cache.
+     *
+     * @param[in] program_name  Name of the program.
+     * @param[in] build_options Options used to build the program.
+     *
+     * @return The program name, a hash of its source, the version of the library, the build options and the versions of the device and its driver.
+     */
+    std::string binary_cache_key(const std::string &program_name, const std::string &build_options) const;
+    /** Path of the cached binary of a program.
+     *
+     * @param[in] program_name Name of the program.
+     * @param[in] key          Key of the built program returned by @ref binary_cache_key.
+     *
+     * @return The path of the file in the cache directory.
+     */
+    std::string binary_cache_file(const std::string &program_name, const std::string &key) const;
+    /** Create and build a program from its binary in the cache.
+     *
+     * @param[in]  file          Path of the cached binary.
+     * @param[in]  key           Key of the built program, which must match the key stored in the file.
+     * @param[in]  build_options Options used to build the program.
+     * @param[out] program       The built program.
+     *
+     * @return False if the file doesn't exist, doesn't match the key or if the device rejects the binary.
+     */
+    bool load_cached_binary(const std::string &file, const std::string &key, const std::string &build_options, cl::Program &program) const;
+    /** Save the binary of a built program in the cache.
+     *
+     * @note The binary is written to a temporary file which is then renamed, so that concurrent processes never read a partial binary.
+     *
+     * @param[in] file    Path of the cached binary.
+     * @param[in] key     Key of the built program, stored in the file.
+     * @param[in] program The built program.
+     */
+    void save_cached_binary(const std::string &file, const std::string &key, const cl::Program &program) const;
 
-    cl::Context _context;                                                /**< Underlying CL context. */
-    cl::Device  _device;                                                 /**< Underlying CL device. */
-    std::string _kernel_path;                                            /**< Path to the kernels folder. */
-    mutable std::map<std::string, const Program>    _programs_map;       /**< Map with all already loaded program data. */
-    mutable std::map<std::string, cl::Program>      _built_programs_map; /**< Map with all already built program data. */
+    cl::Context                                                    _context;              /**< Underlying CL context. */
+    cl::Device                                                     _device;               /**< Underlying CL device. */
+    std::string                                                    _kernel_path;          /**< Path to the kernels folder. */
+    std::string                                                    _binary_cache_path;    /**< Path to the binary cache folder, empty if the cache is disabled. */
+    mutable std::map<std::string, const Program>                   _programs_map;         /**< Map with all already loaded program data. */
+    mutable std::map<std::string, cl::Program>                     _built_programs_map;   /**< Map with all already built program data. */
+    mutable std::map<std::string, std::shared_future<cl::Program>> _pending_programs_map; /**< Programs being built in the background, by built program name. */
+    bool                                                           _is_recording;         /**< True if the created kernels are recorded. */
+    mutable std::set<std::pair<std::string, StringSet>>            _recorded_kernels;     /**< Kernels created while recording. */
+    mutable std::mutex                                             _mtx;                  /**< Protects the maps, which are also accessed by the background compilations. */
+    std::vector<std::future<void>>                                 _precompile_workers;   /**< Threads building the programs in the background. Declared last so that they are joined first. */
     static const std::map<std::string, std::string> _kernel_program_map; /**< Map that associates kernel names with programs. */
     static const std::map<std::string, std::string> _program_source_map; /**< Contains sources for all programs.
                                                                               Used for compile-time kernel inclusion. >*/
@@ -108,6 +108,7 @@ using ICLKeyPointArray        = ICLArray<KeyPoint>;
 using ICLCoordinates2DArray   = ICLArray<Coordinates2D>;
 using ICLDetectionWindowArray = ICLArray<DetectionWindow>;
 using ICLSize2DArray          = ICLArray<Size2D>;
+using ICLROIArray             = ICLArray<ROI>;
 using ICLUInt8Array           = ICLArray<cl_uchar>;
 using ICLUInt16Array          = ICLArray<cl_ushort>;
 using ICLUInt32Array          = ICLArray<cl_uint>;
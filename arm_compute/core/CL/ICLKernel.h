@@ -43,6 +43,26 @@ public:
      * @return A reference to the OpenCL kernel of this object.
      */
     cl::Kernel &kernel();
+    /** Set the local workgroup size hint used when enqueuing the kernel.
+     *
+     * @note Kernels which require a specific local workgroup size ignore the hint.
+     *
+     * @param[in] lws_hint Local workgroup size hint. cl::NullRange lets the OpenCL driver pick the local workgroup size.
+     */
+    void set_lws_hint(const cl::NDRange &lws_hint);
+    /** Return the local workgroup size hint used when enqueuing the kernel.
+     *
+     * @return The local workgroup size hint.
+     */
+    const cl::NDRange &lws_hint() const;
+    /** Indicates whether running the kernel several times on the same window gives the same result as running it once.
+     *
+     * Kernels which accumulate into their outputs, update their inputs in place or count with atomics are not idempotent
+     * and must only be enqueued once per run (e.g. they cannot be timed by a @ref CLTuner).
+     *
+     * @return True if the kernel is idempotent
+     */
+    virtual bool is_idempotent() const;
     /** Add the passed 1D tensor's parameters to the object's kernel's arguments starting from the index idx.
      *
      * @param[in,out] idx    Index at which to start adding the tensor's arguments. Will be incremented by the number of kernel arguments set.
@@ -88,6 +108,8 @@ public:
      */
     virtual void run(const Window &window, cl::CommandQueue &queue) = 0;
     /** Add the passed parameters to the object's kernel's arguments starting from the index idx.
+     *
+     * @note The argument is recorded if a @ref CLCommandRecording is active.
      *
      * @param[in,out] idx   Index at which to start adding the arguments. Will be incremented by the number of kernel arguments set.
      * @param[in]     value Value to set as an argument of the object's kernel.
@@ -95,10 +117,18 @@ public:
     template <typename T>
     void add_argument(unsigned int &idx, T value)
     {
-        _kernel.setArg(idx++, value);
+        _kernel.setArg(idx, value);
+        record_argument(idx++, cl::detail::KernelArgumentHandler<T>::size(value), cl::detail::KernelArgumentHandler<T>::ptr(value));
     }
 
 private:
+    /** Record an argument set on the object's kernel if a @ref CLCommandRecording is active.
+     *
+     * @param[in] idx   Index of the argument.
+     * @param[in] size  Size of the argument in bytes.
+     * @param[in] value Pointer to the value of the argument, nullptr for a local memory argument.
+     */
+    void record_argument(unsigned int idx, size_t size, const void *value);
     /** Add the passed tensor's parameters to the object's kernel's arguments starting from the index idx.
      *
      * @param[in,out] idx    Index at which to start adding the tensor's arguments. Will be incremented by the number of kernel arguments set.
@@ -128,10 +158,21 @@ protected:
  * @param[in,out] queue    OpenCL command queue.
  * @param[in]     kernel   Kernel to enqueue
  * @param[in]     window   Window the kernel has to process.
- * @param[in]     lws_hint Local workgroup size requested, by default (128,1)
+ * @param[in]     lws_hint Local workgroup size requested
  *
  * @note If any dimension of the lws is greater than the global workgroup size then no lws will be passed.
  */
-void enqueue(cl::CommandQueue &queue, ICLKernel &kernel, const Window &window, const cl::NDRange &lws_hint = cl::Range_128_1);
+void enqueue(cl::CommandQueue &queue, ICLKernel &kernel, const Window &window, const cl::NDRange &lws_hint);
+/** Add the kernel to the command queue with the given window using the local workgroup size hint of the kernel.
+ *
+ * @note Depending on the size of the window, this might translate into several jobs being enqueued.
+ *
+ * @note If kernel->kernel() is empty then the function will return without adding anything to the queue.
+ *
+ * @param[in,out] queue  OpenCL command queue.
+ * @param[in]     kernel Kernel to enqueue
+ * @param[in]     window Window the kernel has to process.
+ */
+void enqueue(cl::CommandQueue &queue, ICLKernel &kernel, const Window &window);
 }
 #endif /*__ARM_COMPUTE_ICLKERNEL_H__ */
@@ -46,6 +46,9 @@ public:
      * @param[out] accum Destination tensor. Data types supported: S16.
      */
     void configure(const ICLTensor *input, ICLTensor *accum);
+
+    // Inherited methods overridden:
+    bool is_idempotent() const override;
 };
 
 /** Interface for the accumulate weighted kernel.
@@ -67,6 +70,9 @@ public:
      * @param[in,out] accum Accumulated tensor. Data types supported: U8.
      */
     void configure(const ICLTensor *input, float alpha, ICLTensor *accum);
+
+    // Inherited methods overridden:
+    bool is_idempotent() const override;
 };
 
 /** Interface for the accumulate squared kernel.
@@ -86,6 +92,9 @@ public:
      * @param[in,out] accum Accumulated tensor. Data types supported: S16.
      */
     void configure(const ICLTensor *input, uint32_t shift, ICLTensor *accum);
+
+    // Inherited methods overridden:
+    bool is_idempotent() const override;
 };
 }
 #endif /*__ARM_COMPUTE_CLACCUMULATEKERNEL_H__ */
@@ -41,6 +41,9 @@ public:
      * @param[in]  act_info Activation layer information.
      */
     void configure(const ICLTensor *input, ICLTensor *output, ActivationLayerInfo act_info);
+
+    // Inherited methods overridden:
+    bool is_idempotent() const override;
 };
 }
 #endif /*__ARM_COMPUTE_CLACTIVATIONLAYERKERNEL_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLCOL2IMKERNEL_H__
 
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -70,8 +71,9 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  act_info       (Optional) Activation function applied to the values before they are stored. Disabled by default.
      */
-    void configure(const ICLTensor *input, ICLTensor *output, std::pair<unsigned int, unsigned int> convolved_dims);
+    void configure(const ICLTensor *input, ICLTensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLCONVOLUTIONLAYERIMPLICITGEMMKERNEL_H__
+#define __ARM_COMPUTE_CLCONVOLUTIONLAYERIMPLICITGEMMKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** OpenCL kernel to compute a convolution as a matrix multiplication without storing the im2col transform of the input
+ *
+ * The kernel multiplies the im2col matrix of the input, whose elements are read from the input as they are needed, by the weights reshaped
+ * by @ref CLConvolutionLayerWeightsReshapeKernel, and writes the result straight into the output: the im2col, interleave and col2im steps of
+ * @ref CLConvolutionLayer and their intermediate tensors are skipped. The blocks of both matrices shared by a work-group are staged in local memory.
+ */
+class CLConvolutionLayerImplicitGEMMKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLConvolutionLayerImplicitGEMMKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLConvolutionLayerImplicitGEMMKernel(const CLConvolutionLayerImplicitGEMMKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLConvolutionLayerImplicitGEMMKernel &operator=(const CLConvolutionLayerImplicitGEMMKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLConvolutionLayerImplicitGEMMKernel(CLConvolutionLayerImplicitGEMMKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLConvolutionLayerImplicitGEMMKernel &operator=(CLConvolutionLayerImplicitGEMMKernel &&) = default;
+    /** Default destructor */
+    ~CLConvolutionLayerImplicitGEMMKernel() = default;
+
+    /** Set the input, weights and output of the kernel.
+     *
+     * @param[in]  input         Source tensor [width, height, IFM, batches]. Data types supported: F16, F32.
+     * @param[in]  weights       Weights reshaped by @ref CLConvolutionLayerWeightsReshapeKernel [OFM, kernel_width * kernel_height * IFM (+ 1 if @p has_bias)]. Data types supported: Same as @p input.
+     * @param[out] output        Destination tensor [convolved_width, convolved_height, OFM, batches]. Data types supported: Same as @p input.
+     * @param[in]  kernel_width  Width of the convolution kernel.
+     * @param[in]  kernel_height Height of the convolution kernel.
+     * @param[in]  conv_info     Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  has_bias      True if the last row of @p weights holds the biases.
+     * @param[in]  act_info      (Optional) Activation function applied to the output before it is stored. Disabled by default.
+     */
+    void configure(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output, unsigned int kernel_width, unsigned int kernel_height, const PadStrideInfo &conv_info, bool has_bias,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    const ICLTensor *_weights;
+    ICLTensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_CLCONVOLUTIONLAYERIMPLICITGEMMKERNEL_H__ */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLCOPYTOIMAGEKERNEL_H__
+#define __ARM_COMPUTE_CLCOPYTOIMAGEKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+class TensorInfo;
+
+/** OpenCL kernel to copy a U8 tensor and its border to a CL_R / CL_UNORM_INT8 image owned by the kernel
+ *
+ * Kernels which interpolate at irregular coordinates read the image with a CLK_FILTER_LINEAR sampler, so that
+ * the bilinear interpolation is done by the texture units and the reads go through the texture cache.
+ *
+ * @note The pixel (x, y) of the tensor is stored in the texel (x + border.left, y + border.top) of the image.
+ */
+class CLCopyToImageKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLCopyToImageKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopyToImageKernel(const CLCopyToImageKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopyToImageKernel &operator=(const CLCopyToImageKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLCopyToImageKernel(CLCopyToImageKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLCopyToImageKernel &operator=(CLCopyToImageKernel &&) = default;
+    /** Default destructor */
+    ~CLCopyToImageKernel() = default;
+    /** Check if the device of @ref CLKernelLibrary supports the image needed to hold a tensor
+     *
+     * @param[in] info   Info of the tensor to copy.
+     * @param[in] border Size of the border of the tensor to copy along with it.
+     *
+     * @return True if the tensor is a single U8 plane and the device supports CL_R / CL_UNORM_INT8 images of its size
+     */
+    static bool is_supported(const TensorInfo &info, const BorderSize &border);
+    /** Initialise the kernel's input and create the image.
+     *
+     * @param[in] input  Source tensor. Data types supported: U8. Must be 2D and @ref is_supported must return true for it.
+     * @param[in] border Size of the border of @p input copied along with it. @p input must be padded by at least this size.
+     */
+    void configure(const ICLTensor *input, const BorderSize &border);
+    /** Image the input is copied to
+     *
+     * @return The image, valid once the kernel is configured
+     */
+    const cl::Image2D &image() const;
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    cl::Image2D      _image;
+};
+}
+#endif /*__ARM_COMPUTE_CLCOPYTOIMAGEKERNEL_H__ */
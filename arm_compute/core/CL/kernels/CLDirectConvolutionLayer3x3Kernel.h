@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLDIRECTCONVOLUTIONLAYER3X3KERNEL_H__
+#define __ARM_COMPUTE_CLDIRECTCONVOLUTIONLAYER3X3KERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Interface for the direct 3x3 convolution layer kernel: each work item computes 4 outputs of a row of one output feature map,
+ * keeping the 9 weights of each input feature map in registers.
+ *
+ * @note The padding values are zero and are not read from the input: no border has to be filled.
+ */
+class CLDirectConvolutionLayer3x3Kernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLDirectConvolutionLayer3x3Kernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLDirectConvolutionLayer3x3Kernel(const CLDirectConvolutionLayer3x3Kernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLDirectConvolutionLayer3x3Kernel &operator=(const CLDirectConvolutionLayer3x3Kernel &) = delete;
+    /** Default Move Constructor. */
+    CLDirectConvolutionLayer3x3Kernel(CLDirectConvolutionLayer3x3Kernel &&) = default;
+    /** Default move assignment operator. */
+    CLDirectConvolutionLayer3x3Kernel &operator=(CLDirectConvolutionLayer3x3Kernel &&) = default;
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while the optional 4th dimension represents a batch of inputs. Data types supported: F16, F32.
+     * @param[in]  weights   Weights tensor with dimensions [3, 3, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the 4th dimension represents the batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. Supported strides: 1 and 2, equal along X and Y.
+     * @param[in]  act_info  (Optional) Activation function applied to the output before it is stored. Disabled by default.
+     */
+    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    const ICLTensor *_weights;
+    const ICLTensor *_biases;
+    ICLTensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_CLDIRECTCONVOLUTIONLAYER3X3KERNEL_H__ */
@@ -110,5 +110,49 @@ private:
     ICLKeyPointArray *_corners;    /**< destination array */
     cl::Buffer       *_num_buffer; /**< CL memory to record number of key points in the array */
 };
+/** CL kernel to copy keypoints information to ICLKeyPointArray and count the number of key points without atomics
+ *
+ * The kernel runs three passes on the device: the keypoints of each row are counted, an exclusive prefix sum of the counts
+ * gives the index of the first keypoint of each row, then each row writes its keypoints from that index.
+ * The keypoints are therefore stored in raster order and the number of key points is always the total number of keypoints of the image.
+ *
+ * @note The number of key points is written on the device, so it can be consumed by the next stage (e.g. @ref CLOpticalFlow) without being read back.
+ */
+class CLCompactToArrayKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLCompactToArrayKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCompactToArrayKernel(const CLCompactToArrayKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCompactToArrayKernel &operator=(const CLCompactToArrayKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLCompactToArrayKernel(CLCompactToArrayKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLCompactToArrayKernel &operator=(CLCompactToArrayKernel &&) = default;
+    /** Default destructor */
+    ~CLCompactToArrayKernel() = default;
+
+    /** Initialise the kernel.
+     *
+     * @param[in]  input       Source image. Data types supported: U8.
+     * @param[out] corners     Array of keypoints to store the results.
+     * @param[out] num_buffers Number of keypoints to store the results.
+     */
+    void configure(const ICLImage *input, ICLKeyPointArray *corners, cl::Buffer *num_buffers);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLImage   *_input;          /**< source image */
+    ICLKeyPointArray *_corners;        /**< destination array */
+    cl::Buffer       *_num_buffer;     /**< CL memory to record number of key points in the array */
+    cl::Buffer        _row_offsets;    /**< Number of keypoints of each row, then index of the first keypoint of each row */
+    cl::Kernel        _scan_kernel;    /**< Prefix sum of the number of keypoints of the rows */
+    cl::Kernel        _compact_kernel; /**< Copy of the keypoints of each row */
+    unsigned int      _num_rows;       /**< Number of rows of the valid region of the source image */
+};
 }
 #endif /* __ARM_COMPUTE_CLFASTCORNERSKERNEL_H__ */
@@ -68,6 +68,16 @@ public:
      * @param[out] output Output tensor. Data type supported: same as @p input
      */
     void configure(const ICLTensor *input, ICLTensor *output);
+    /** Initialise the kernel to interleave the feature maps of a 1x1 convolution's input straight into the layout of @ref configure, without any im2col step.
+     *
+     * Each pixel of the input is a row of the interleaved matrix and each feature map a column.
+     *
+     * @param[in]  input    Input tensor of the convolution. 3 lower dimensions represent a single input [width, height, IFM],
+     *                      while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F16/F32
+     * @param[out] output   Output tensor. Data type supported: same as @p input. Shape: [(IFM + has_bias) * 4, ceil(width * height / 4), 1, batches]
+     * @param[in]  has_bias If true, a column of 1 is appended after the last feature map.
+     */
+    void configure_convolution_1x1(const ICLTensor *input, ICLTensor *output, bool has_bias);
 
     // Inherited methods overridden
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -75,6 +85,7 @@ public:
 private:
     const ICLTensor *_input;
     ICLTensor       *_output;
+    bool             _read_feature_maps;
 };
 }
 #endif /* __ARM_COMPUTE_CLGEMMINTERLEAVE4X4KERNEL_H__ */
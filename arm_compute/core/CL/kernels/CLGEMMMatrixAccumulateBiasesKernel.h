@@ -53,6 +53,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 
 private:
     ICLTensor       *_accum;
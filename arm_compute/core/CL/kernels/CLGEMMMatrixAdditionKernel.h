@@ -60,6 +60,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 
 private:
     const ICLTensor *_input;
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLGEMMMATRIXMULTIPLYKERNEL_H__
 
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -53,21 +54,26 @@ public:
     CLGEMMMatrixMultiplyKernel &operator=(CLGEMMMatrixMultiplyKernel &&) = default;
     /** Initialise the kernel's input, output and alpha
      *
-     * @param[in]  input0 Input tensor containing the interleaved Matrix A or the vector A. Data types supported: F16/F32
-     * @param[in]  input1 Input tensor containing the transposed Matrix B if the first input tensor A is not a vector.
-     *                    If the output tensor is a vector, input1 must contain the matrix B not reshaped. Data type supported: same as @p input0
-     * @param[out] output Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0
-     * @param[in]  alpha  Weight of the matrix product
+     * @param[in]  input0   Input tensor containing the interleaved Matrix A or the vector A. Data types supported: F16/F32
+     * @param[in]  input1   Input tensor containing the transposed Matrix B if the first input tensor A is not a vector.
+     *                      If the output tensor is a vector, input1 must contain the matrix B not reshaped. Data type supported: same as @p input0
+     * @param[out] output   Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0
+     * @param[in]  alpha    Weight of the matrix product
+     * @param[in]  act_info (Optional) Activation function applied to the result before it is stored. Disabled by default.
+     * @param[in]  image    (Optional) CL_RGBA / CL_FLOAT image holding a copy of the transposed matrix B (input1->info()->dimension(0) / 4 texels wide),
+     *                      read through the texture cache instead of @p input1. Only supported when the output tensor is not a vector and the data type is F32.
+     *                      The kernel only keeps a pointer to the image: it must be filled before the kernel is run.
      */
-    void configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha);
+    void configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, const ActivationLayerInfo &act_info = ActivationLayerInfo(), const cl::Image2D *image = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
 
 private:
-    const ICLTensor *_input0;
-    const ICLTensor *_input1;
-    ICLTensor       *_output;
+    const ICLTensor   *_input0;
+    const ICLTensor   *_input1;
+    ICLTensor         *_output;
+    const cl::Image2D *_input1_image;
 };
 }
 #endif /* __ARM_COMPUTE_CLGEMMMATRIXMULTIPLYKERNEL_H__ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLGEMMMATRIXVECTORMULTIPLYKERNEL_H__
+#define __ARM_COMPUTE_CLGEMMMATRIXVECTORMULTIPLYKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** OpenCL kernel to compute the dot products of a vector "A" with the rows of a matrix "B"
+ *
+ * Each work-group computes one element of the output: its @ref num_work_items work-items share the dot product of vector A with a row of matrix B
+ * and sum their partial results in local memory, so that a long vector (e.g. the input of a fully connected layer) keeps all the ALUs busy.
+ * The optional biases are added before the output is stored.
+ *
+ * Matrix B can be stored in a narrower data type than vector A to halve or quarter the memory traffic of the weights, which bounds the kernel:
+ * F16 rows are converted as they are loaded, U8 rows are dequantized on the fly with the zero point of matrix B and one scale per row.
+ *
+ * @note Unlike @ref CLGEMMMatrixMultiplyKernel, matrix B must not be transposed: each row of matrix B holds the weights of one element of the output.
+ */
+class CLGEMMMatrixVectorMultiplyKernel : public ICLKernel
+{
+public:
+    static constexpr unsigned int num_work_items = 64; /**< Number of work-items per work-group */
+
+    /** Default constructor */
+    CLGEMMMatrixVectorMultiplyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLGEMMMatrixVectorMultiplyKernel(const CLGEMMMatrixVectorMultiplyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLGEMMMatrixVectorMultiplyKernel &operator=(const CLGEMMMatrixVectorMultiplyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLGEMMMatrixVectorMultiplyKernel(CLGEMMMatrixVectorMultiplyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLGEMMMatrixVectorMultiplyKernel &operator=(CLGEMMMatrixVectorMultiplyKernel &&) = default;
+    /** Initialise the kernel's input, output and biases.
+     *
+     * @param[in]  input0 Input tensor containing the vector A of K elements. Data types supported: F16, F32.
+     * @param[in]  input1 Input tensor containing the matrix B of N rows of K elements: [K, N]. Data type supported: same as @p input0, F16 if @p input0 is F32, U8.
+     *                    U8 elements are dequantized as scale * (value - offset), where offset is the offset of the quantization settings of @p input1 (see @ref TensorInfo::quantization_info()).
+     * @param[in]  biases Biases tensor. Biases are 1D tensor with dimensions [N]. Can be nullptr. Data type supported: same as @p input0
+     * @param[out] output Output tensor to store the vector of N elements. Data type supported: same as @p input0.
+     * @param[in]  scales (Optional) Scales of the rows of @p input1: 1D tensor with dimensions [N]. Required if @p input1 is U8, must be nullptr otherwise. Data type supported: same as @p input0
+     */
+    void configure(const ICLTensor *input0, const ICLTensor *input1, const ICLTensor *biases, ICLTensor *output, const ICLTensor *scales = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input0;
+    const ICLTensor *_input1;
+    const ICLTensor *_biases;
+    ICLTensor       *_output;
+    const ICLTensor *_scales;
+};
+}
+#endif /*__ARM_COMPUTE_CLGEMMMATRIXVECTORMULTIPLYKERNEL_H__ */
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLHOGNONMAXIMASUPPRESSIONKERNEL_H__
+#define __ARM_COMPUTE_CLHOGNONMAXIMASUPPRESSIONKERNEL_H__
+
+#include "arm_compute/core/CL/ICLArray.h"
+#include "arm_compute/core/CL/ICLKernel.h"
+
+namespace cl
+{
+class Buffer;
+}
+
+namespace arm_compute
+{
+/** OpenCL kernel to perform in parallel the non-maxima suppression of the detection windows found by @ref CLHOGDetectorKernel
+ *
+ * Each candidate is handled by a work-item which compares it with all the other candidates: it is suppressed if a candidate with a higher score
+ * (or the same score and a lower index) has its centre closer than the minimum distance. The remaining candidates are compacted into the output array.
+ *
+ * @note Unlike the sequential @ref NEHOGNonMaximaSuppressionKernel, a suppressed candidate can still suppress the lower ones and
+ *       the output windows are not sorted by score.
+ */
+class CLHOGNonMaximaSuppressionKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLHOGNonMaximaSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLHOGNonMaximaSuppressionKernel(const CLHOGNonMaximaSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLHOGNonMaximaSuppressionKernel &operator=(const CLHOGNonMaximaSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLHOGNonMaximaSuppressionKernel(CLHOGNonMaximaSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLHOGNonMaximaSuppressionKernel &operator=(CLHOGNonMaximaSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~CLHOGNonMaximaSuppressionKernel() = default;
+
+    /** Initialise the kernel's input, output and the euclidean minimum distance
+     *
+     * @note The counter of the output is incremented for each window kept, even when the array is full: it must be reset to 0 before the kernel runs.
+     *
+     * @param[in]  candidates            Array of @ref DetectionWindow found by the detectors
+     * @param[in]  num_candidates        Number of candidates written by the detectors (It might be greater than the size of @p candidates)
+     * @param[out] detection_windows     Array of @ref DetectionWindow which are not suppressed
+     * @param[out] num_detection_windows Number of windows which are not suppressed
+     * @param[in]  min_distance          Radial Euclidean distance for non-maxima suppression
+     */
+    void configure(const ICLDetectionWindowArray *candidates, const cl::Buffer *num_candidates, ICLDetectionWindowArray *detection_windows, cl::Buffer *num_detection_windows, float min_distance);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+};
+}
+
+#endif /* __ARM_COMPUTE_CLHOGNONMAXIMASUPPRESSIONKERNEL_H__ */
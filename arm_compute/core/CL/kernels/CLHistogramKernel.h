@@ -88,6 +88,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 
 private:
     const ICLImage    *_input;
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLIMAGETOTENSORKERNEL_H__
+#define __ARM_COMPUTE_CLIMAGETOTENSORKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+
+#include <array>
+
+namespace arm_compute
+{
+class ICLMultiImage;
+class ICLTensor;
+
+/** Interface for the kernel converting a YUV image to the planar F32 input tensor of a network
+ *
+ * For each pixel of the output, the four closest pixels of the input are converted to RGB (BT709, clamped to [0, 255]),
+ * bilinearly interpolated, then each channel c is written to the plane c of the output as (value - mean[c]) * scale.
+ * The source coordinates are computed as in @ref CLScaleKernel and the input is replicated outside of its borders.
+ */
+class CLImageToTensorKernel : public ICLKernel
+{
+public:
+    /** Default constructor. */
+    CLImageToTensorKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLImageToTensorKernel(const CLImageToTensorKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLImageToTensorKernel &operator=(const CLImageToTensorKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLImageToTensorKernel(CLImageToTensorKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLImageToTensorKernel &operator=(CLImageToTensorKernel &&) = default;
+    /** Default destructor. */
+    ~CLImageToTensorKernel() = default;
+
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Multi-planar source image. Formats supported: NV12/NV21/IYUV/YUV444
+     * @param[out] output Destination tensor of shape [width, height, 3]. Data type supported: F32
+     * @param[in]  mean   Value subtracted from the R, G and B channels.
+     * @param[in]  scale  Scale applied to the channels once the mean is subtracted.
+     */
+    void configure(const ICLMultiImage *input, ICLTensor *output, const std::array<float, 3> &mean, float scale);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLMultiImage *_input;  /**< Source image */
+    ICLTensor           *_output; /**< Destination tensor */
+};
+}
+#endif /* __ARM_COMPUTE_CLIMAGETOTENSORKERNEL_H__ */
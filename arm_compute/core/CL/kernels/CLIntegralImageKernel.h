@@ -65,6 +65,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 
 private:
     ICLTensor *_in_out;
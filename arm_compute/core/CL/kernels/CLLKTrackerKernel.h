@@ -80,13 +80,16 @@ public:
      * @param[in]  level                The pyramid level
      * @param[in]  num_levels           The number of pyramid levels
      * @param[in]  pyramid_scale        Scale factor used for generating the pyramid
+     * @param[in]  num_points           (Optional) Device buffer holding the number of key points to process (e.g. @ref CLFastCorners::num_corners_buffer()).
+     *                                  If set, the kernel runs on the maximum number of values of @p old_points and the key points past that number are left untouched.
      */
     void configure(const ICLKeyPointArray *old_points, const ICLKeyPointArray *new_points_estimates,
                    ICLLKInternalKeypointArray *old_points_internal, ICLLKInternalKeypointArray *new_points_internal,
-                   bool use_initial_estimate, size_t level, size_t num_levels, float pyramid_scale);
+                   bool use_initial_estimate, size_t level, size_t num_levels, float pyramid_scale, const cl::Buffer *num_points = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 };
 
 /** Interface to run the finalize step of LKTracker, where it truncates the coordinates stored in new_points array */
@@ -97,8 +100,9 @@ public:
      *
      * @param[in]  new_points_internal Pointer to the array of internal @ref CLLKInternalKeypoint new points
      * @param[out] new_points          Pointer to the @ref ICLKeyPointArray storing new key points
+     * @param[in]  num_points          (Optional) Device buffer holding the number of key points to process. The key points past that number are left untouched.
      */
-    void configure(ICLLKInternalKeypointArray *new_points_internal, ICLKeyPointArray *new_points);
+    void configure(ICLLKInternalKeypointArray *new_points_internal, ICLKeyPointArray *new_points, const cl::Buffer *num_points = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -129,11 +133,12 @@ public:
      * @param[out]     old_ival            Pointer to the array holding internal values
      * @param[in]      window_dimension    The size of the window on which to perform the algorithm
      * @param[in]      level               The pyramid level
+     * @param[in]      num_points          (Optional) Device buffer holding the number of key points to process. The key points past that number are left untouched.
      */
     void configure(const ICLTensor *old_input, const ICLTensor *old_scharr_gx, const ICLTensor *old_scharr_gy,
                    ICLLKInternalKeypointArray *old_points_internal, ICLLKInternalKeypointArray *new_points_internal,
                    ICLCoefficientTableArray *coeff_table, ICLOldValArray *old_ival,
-                   size_t window_dimension, size_t level);
+                   size_t window_dimension, size_t level, const cl::Buffer *num_points = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
@@ -169,12 +174,14 @@ public:
      * @param[in]      num_iterations      The maximum number of iterations before terminating the algorithm
      * @param[in]      window_dimension    The size of the window on which to perform the algorithm
      * @param[in]      level               The pyramid level
+     * @param[in]      num_points          (Optional) Device buffer holding the number of key points to process. The key points past that number are left untouched.
      */
     void configure(const ICLTensor *new_input, ICLLKInternalKeypointArray *new_points_internal, ICLCoefficientTableArray *coeff_table, ICLOldValArray *old_ival,
-                   Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, size_t level);
+                   Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, size_t level, const cl::Buffer *num_points = nullptr);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
+    bool is_idempotent() const override;
 
 private:
     const ICLTensor *_new_input;
@@ -31,6 +31,9 @@ namespace arm_compute
 class ICLTensor;
 
 /** Interface for the normalization layer kernel.
+ *
+ * Without a squared input, the kernel squares the input itself: the cross map normalization slides its window across the feature maps
+ * and the in map normalization squares each tile of a row and its halo once in local memory.
  */
 class CLNormalizationLayerKernel : public ICLKernel
 {
@@ -51,7 +54,7 @@ public:
      * @param[in]  input         Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
      *                           and an optional 4th dimension for batch of inputs. Data types supported: F16, F32.
      * @param[in]  squared_input Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
-     *                           Data types should match the input type.
+     *                           Data types should match the input type. Can be nullptr, in which case the kernel squares the input itself and no border needs to be filled.
      * @param[out] output        Destination tensor. Output will have the same number of dimensions as input. Data types should match the input type.
      * @param[in]  norm_info     Normalization layer information like the normalization type, normalization size and other parameters.
      */
@@ -62,10 +65,17 @@ public:
     BorderSize border_size() const override;
 
 private:
+    /** Configure the kernel squaring the input itself.
+     *
+     * @param[in] norm_info Normalization layer information like the normalization type, normalization size and other parameters.
+     */
+    void configure_fused(const NormalizationLayerInfo &norm_info);
+
     const ICLTensor *_input;
     const ICLTensor *_squared_input;
     ICLTensor       *_output;
     BorderSize       _border_size;
+    bool             _is_in_map_local;
 };
 }
 #endif /*__ARM_COMPUTE_CLNORMALIZATIONLAYERKERNEL_H__ */
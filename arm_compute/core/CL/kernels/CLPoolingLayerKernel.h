@@ -30,7 +30,11 @@ namespace arm_compute
 {
 class ICLTensor;
 
-/** Interface for the pooling layer kernel */
+/** Interface for the pooling layer kernel
+ *
+ * @note When the pooling windows overlap (stride smaller than the pool size) each work-group loads its input tile and halo
+ *       in local memory once, and the window of the kernel is rounded up to whole tiles of 8x8 outputs.
+ */
 class CLPoolingLayerKernel : public ICLKernel
 {
 public:
@@ -64,6 +68,7 @@ private:
     ICLTensor       *_output;
     PoolingLayerInfo _pool_info;
     BorderSize       _border_size;
+    bool             _is_tiled;
 };
 }
 #endif /*__ARM_COMPUTE_CLPOOLINGLAYERKERNEL_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLREMAPKERNEL_H__
 
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
 #include "arm_compute/core/Types.h"
 
 namespace arm_compute
@@ -53,18 +54,22 @@ public:
      * @param[out] output           Destination tensor. Data types supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. remapping is only performed within the XY-plane.
      * @param[in]  policy           The interpolation type.
      * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     * @param[in]  use_image        (Optional) True to copy the input to an image and let the texture sampler interpolate. Only for @ref InterpolationPolicy::BILINEAR,
+     *                              and if @ref CLCopyToImageKernel::is_supported returns true for @p input.
      */
-    void configure(const ICLTensor *input, const ICLTensor *map_x, const ICLTensor *map_y, ICLTensor *output, InterpolationPolicy policy, bool border_undefined);
+    void configure(const ICLTensor *input, const ICLTensor *map_x, const ICLTensor *map_y, ICLTensor *output, InterpolationPolicy policy, bool border_undefined, bool use_image = false);
 
     // Inherited methods overridden:
     void run(const Window &window, cl::CommandQueue &queue) override;
     BorderSize border_size() const override;
 
 private:
-    const ICLTensor *_input;
-    ICLTensor       *_output;
-    const ICLTensor *_map_x;
-    const ICLTensor *_map_y;
+    const ICLTensor    *_input;
+    ICLTensor          *_output;
+    const ICLTensor    *_map_x;
+    const ICLTensor    *_map_y;
+    CLCopyToImageKernel _copy_to_image; /**< Kernel copying the input to the image read by the sampler */
+    bool                _use_image;     /**< True if the input is read from an image */
 };
 }
 #endif /*__ARM_COMPUTE_CLREMAPKERNEL_H__ */
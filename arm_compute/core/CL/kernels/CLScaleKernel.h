@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLSCALEKERNEL_H__
 
 #include "arm_compute/core/CL/ICLSimple2DKernel.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
 #include "arm_compute/core/Types.h"
 
 namespace arm_compute
@@ -35,20 +36,30 @@ class ICLTensor;
 class CLScaleKernel : public ICLSimple2DKernel
 {
 public:
+    /** Default constructor */
+    CLScaleKernel();
     /** Initialise the kernel's inputs, output and interpolation policy
      *
      * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
      *
-     * @param[in]  input            Source tensor. Data types supported: U8, S16.
-     * @param[out] output           Destination tensor. Data types supported: U8, S16 (Must be the same as the input tensor).
+     * @param[in]  input            Source tensor. Data types supported: U8, S16. Formats supported: RGB888, RGBA8888 for multi-channel tensors,
+     *                              whose channels are all interpolated at once.
+     * @param[out] output           Destination tensor. Data types supported: U8, S16 (Must be the same as the input tensor). Formats supported: same as @p input.
      *                              All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]  policy           Interpolation type to use
      * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     * @param[in]  use_image        (Optional) True to copy the input to an image and let the texture sampler interpolate. Only for @ref InterpolationPolicy::BILINEAR,
+     *                              and if @ref CLCopyToImageKernel::is_supported returns true for @p input.
      */
-    void configure(const ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, bool border_undefined);
+    void configure(const ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, bool border_undefined, bool use_image = false);
 
     // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
     BorderSize border_size() const override;
+
+private:
+    CLCopyToImageKernel _copy_to_image; /**< Kernel copying the input to the image read by the sampler */
+    bool                _use_image;     /**< True if the input is read from an image */
 };
 }
 
@@ -105,5 +105,39 @@ private:
     const ICLTensor *_sum;
     ICLTensor       *_output;
 };
+
+/** Interface for computing the whole Softmax Layer of 1D logits in a single kernel.
+ *
+ * Each row is processed by one work-group: the maximum and the sum of the exponentials of the row are computed
+ * with reductions in local memory, so no intermediate tensor is needed.
+ */
+class CLLogits1DFusedKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLLogits1DFusedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLLogits1DFusedKernel(const CLLogits1DFusedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLLogits1DFusedKernel &operator=(const CLLogits1DFusedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLLogits1DFusedKernel(CLLogits1DFusedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLLogits1DFusedKernel &operator=(CLLogits1DFusedKernel &&) = default;
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F16, F32. Number of channels must be 1.
+     * @param[out] output Destination tensor. Matching input type and channel number.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    ICLTensor       *_output;
+    unsigned int     _lws;
+};
 }
 #endif /*__ARM_COMPUTE_CLSOFTMAXLAYERKERNEL_H__ */
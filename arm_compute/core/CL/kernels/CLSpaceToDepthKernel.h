@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLSPACETODEPTHKERNEL_H__
+#define __ARM_COMPUTE_CLSPACETODEPTHKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** OpenCL kernel to move blocks of pixels of a tensor to its channels
+ *
+ * Each block of @p block_size x @p block_size pixels of each channel of the (padded) input becomes a single pixel of @p block_size * @p block_size channels:
+ *
+ * @f[ output(x, y, (c \cdot s + dy) \cdot s + dx) = input(x \cdot s + dx - pad_x, y \cdot s + dy - pad_y, c) @f]
+ *
+ * The output elements which read outside of the input hold 0. Applied to both the input and the weights of a convolution with a stride of s,
+ * it rewrites the convolution as a convolution with a stride of 1 over s * s times more channels (See @ref CLConvolutionLayer).
+ */
+class CLSpaceToDepthKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLSpaceToDepthKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLSpaceToDepthKernel(const CLSpaceToDepthKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLSpaceToDepthKernel &operator=(const CLSpaceToDepthKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLSpaceToDepthKernel(CLSpaceToDepthKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLSpaceToDepthKernel &operator=(CLSpaceToDepthKernel &&) = default;
+    /** Default destructor */
+    ~CLSpaceToDepthKernel() = default;
+
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input      Source tensor [width, height, channels, ...]. Data types supported: F16/F32.
+     * @param[out] output     Destination tensor [out_width, out_height, channels * block_size * block_size, ...]. Its width and height can be chosen freely:
+     *                        the pixels past the input are padded. The dimensions above 2 must match the ones of @p input. Data types supported: Same as @p input.
+     * @param[in]  block_size Size of the blocks of pixels moved to the channels.
+     * @param[in]  pad_x      Number of padding columns on the left of the input.
+     * @param[in]  pad_y      Number of padding rows on the top of the input.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, unsigned int block_size, unsigned int pad_x, unsigned int pad_y);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    ICLTensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_CLSPACETODEPTHKERNEL_H__ */
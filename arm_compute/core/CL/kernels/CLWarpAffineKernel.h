@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_CLWARPAFFINEKERNEL_H__
 
 #include "arm_compute/core/CL/ICLSimple2DKernel.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
 #include "arm_compute/core/Types.h"
 
 namespace arm_compute
@@ -35,17 +36,26 @@ class ICLTensor;
 class CLWarpAffineKernel : public ICLSimple2DKernel
 {
 public:
+    /** Default constructor */
+    CLWarpAffineKernel();
     /** Initialize the function's source, destination, interpolation policy and border_mode.
      *
-     * @param[in]  input  Source tensor. Data types supported: U8.
-     * @param[out] output Destination tensor, Data types supported: U8.
-     * @param[in]  matrix The perspective matrix. Must be 2x3 of type float.
-     * @param[in]  policy The interpolation type.
+     * @param[in]  input     Source tensor. Data types supported: U8.
+     * @param[out] output    Destination tensor, Data types supported: U8.
+     * @param[in]  matrix    The perspective matrix. Must be 2x3 of type float.
+     * @param[in]  policy    The interpolation type.
+     * @param[in]  use_image (Optional) True to copy the input to an image and let the texture sampler interpolate. Only for @ref InterpolationPolicy::BILINEAR,
+     *                       and if @ref CLCopyToImageKernel::is_supported returns true for @p input.
      */
-    void configure(const ICLTensor *input, ICLTensor *output, const float *matrix, InterpolationPolicy policy);
+    void configure(const ICLTensor *input, ICLTensor *output, const float *matrix, InterpolationPolicy policy, bool use_image = false);
 
     // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
     BorderSize border_size() const override;
+
+private:
+    CLCopyToImageKernel _copy_to_image; /**< Kernel copying the input and its border to the image read by the sampler */
+    bool                _use_image;     /**< True if the input is read from an image */
 };
 }
 #endif /*__ARM_COMPUTE_CLWARPAFFINEKERNEL_H__ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLWINOGRADFILTERTRANSFORMKERNEL_H__
+#define __ARM_COMPUTE_CLWINOGRADFILTERTRANSFORMKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** OpenCL kernel to transform the 3x3 kernels of a convolution layer into the Winograd F(2x2, 3x3) domain.
+ *
+ * Each 3x3 kernel g is transformed into the 4x4 tile U = G * g * G', where:
+ *
+ * @f[
+ * G = \left( \begin{array}{ccc}
+ *        1 &    0 &   0 \\
+ *      1/2 &  1/2 & 1/2 \\
+ *      1/2 & -1/2 & 1/2 \\
+ *        0 &    0 &   1 \\
+ *      \end{array} \right)
+ * @f]
+ *
+ * The 16 values of the tile are stored as 16 matrices of [OFM, IFM] elements, one for each element of the tile:
+ * element k of tile U(ofm, ifm) is stored in matrix k, column ofm, row ifm.
+ * Each matrix is the right hand side of the element-wise products computed by @ref CLGEMMMatrixMultiplyKernel.
+ */
+class CLWinogradFilterTransformKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradFilterTransformKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLWinogradFilterTransformKernel(const CLWinogradFilterTransformKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLWinogradFilterTransformKernel &operator=(const CLWinogradFilterTransformKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLWinogradFilterTransformKernel(CLWinogradFilterTransformKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLWinogradFilterTransformKernel &operator=(CLWinogradFilterTransformKernel &&) = default;
+    /** Default destructor */
+    ~CLWinogradFilterTransformKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [3, 3, IFM, OFM]. Data types supported: F32.
+     * @param[out] output  Destination tensor with dimensions [OFM, IFM, 16]. Data types supported: Same as @p weights.
+     */
+    void configure(const ICLTensor *weights, ICLTensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_weights;
+    ICLTensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_CLWINOGRADFILTERTRANSFORMKERNEL_H__ */
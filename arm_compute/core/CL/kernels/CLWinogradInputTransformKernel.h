@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLWINOGRADINPUTTRANSFORMKERNEL_H__
+#define __ARM_COMPUTE_CLWINOGRADINPUTTRANSFORMKERNEL_H__
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** OpenCL kernel to transform the input of a 3x3 convolution layer with a stride of 1 into the Winograd F(2x2, 3x3) domain.
+ *
+ * The input is split into 4x4 tiles overlapping by 2 elements, each of which produces a 2x2 tile of the output.
+ * Each tile d is transformed into V = B' * d * B, where:
+ *
+ * @f[
+ * B' = \left( \begin{array}{cccc}
+ *      1 &  0 & -1 &  0 \\
+ *      0 &  1 &  1 &  0 \\
+ *      0 & -1 &  1 &  0 \\
+ *      0 &  1 &  0 & -1 \\
+ *      \end{array} \right)
+ * @f]
+ *
+ * The values outside the input (padding) are implicitly zero: no border needs to be filled.
+ * The 16 values of the tile are stored as 16 matrices of [IFM, number of tiles] elements, one for each element of the tile:
+ * element k of tile V(tile, ifm) is stored in matrix k, column ifm, row tile, where the tiles are numbered in row-major order across all the batches.
+ * Each matrix is the left hand side of the element-wise products computed by @ref CLGEMMMatrixMultiplyKernel.
+ */
+class CLWinogradInputTransformKernel : public ICLKernel
+{
+public:
+    /** Default constructor */
+    CLWinogradInputTransformKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLWinogradInputTransformKernel(const CLWinogradInputTransformKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLWinogradInputTransformKernel &operator=(const CLWinogradInputTransformKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CLWinogradInputTransformKernel(CLWinogradInputTransformKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CLWinogradInputTransformKernel &operator=(CLWinogradInputTransformKernel &&) = default;
+    /** Default destructor */
+    ~CLWinogradInputTransformKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32.
+     * @param[out] output    Destination tensor with dimensions [IFM, number of tiles, 16]. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. The stride must be 1.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, const PadStrideInfo &conv_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window, cl::CommandQueue &queue) override;
+
+private:
+    const ICLTensor *_input;
+    ICLTensor       *_output;
+    unsigned int     _num_tiles_per_batch;
+};
+}
+#endif /*__ARM_COMPUTE_CLWINOGRADINPUTTRANSFORMKERNEL_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_ICPPKERNEL_H__
 #define __ARM_COMPUTE_ICPPKERNEL_H__
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/IKernel.h"
 
 namespace arm_compute
@@ -48,6 +49,106 @@ public:
      * @param[in] window Region on which to execute the kernel. (Must be a region of the window returned by window())
      */
     virtual void run(const Window &window) = 0;
+
+    /** Indicates how the scheduler should distribute the window of the kernel among threads
+     *
+     * @note Kernels which rely on Window::thread_id() to index per-thread resources still get the index of the thread running
+     *       the sub-window, whatever the policy, but a thread might run several sub-windows with @ref SchedulingPolicy::DYNAMIC.
+     *
+     * @return The scheduling policy of the kernel (@ref SchedulingPolicy::STATIC by default)
+     */
+    virtual SchedulingPolicy scheduling_policy() const
+    {
+        return SchedulingPolicy::STATIC;
+    }
+    /** Indicates in how many parts along X the scheduler should split the window of the kernel, on top of the split dimension
+     *
+     * By default the window is only split along the split dimension passed to the scheduler. If this returns more than 1,
+     * the window is split in a 2D grid of that many parts along X by @p num_parts divided by that many parts along the split dimension,
+     * so that each sub-window only reads a block of the inputs.
+     *
+     * @note Window::thread_id() and Window::num_threads() still index the threads running the sub-windows, not the parts of the grid.
+     *
+     * @param[in] num_parts Number of sub-windows the scheduler would like to split the window in.
+     *
+     * @return Number of parts along X, a divisor of @p num_parts (1 by default)
+     */
+    virtual unsigned int split_parts_x(unsigned int num_parts) const
+    {
+        ARM_COMPUTE_UNUSED(num_parts);
+        return 1;
+    }
+    /** Indicates whether the scheduler can collapse the split dimension with an outer dimension when the former has too few iterations
+     *
+     * Once collapsed, the iteration space is split in ranges of the outer dimension as well, e.g. several rows of the same columns
+     * run by different threads. Kernels whose iterations along the outer dimensions depend on each other (e.g. which accumulate
+     * along Y while being split along X) must return false.
+     *
+     * @return True if the split dimension can be collapsed (True by default)
+     */
+    virtual bool is_split_dimension_collapsible() const
+    {
+        return true;
+    }
+    /** Indicates whether the performance of the kernel is bound by computations rather than by memory accesses
+     *
+     * If the threads of the scheduler are pinned to cores of different capacities, compute bound kernels only run on the most powerful ones.
+     *
+     * @return True if the kernel is compute bound (False by default)
+     */
+    virtual bool is_compute_bound() const
+    {
+        return false;
+    }
+    /** Called by the scheduler before the kernel runs on any sub-window
+     *
+     * Reduction kernels reset one partial result per thread here (See @ref ThreadLocalSlots), every sub-window then
+     * accumulates into the partial result of Window::thread_id() without any lock.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel (1 if the kernel runs on its whole window).
+     */
+    virtual void begin_reduction(unsigned int num_threads)
+    {
+        ARM_COMPUTE_UNUSED(num_threads);
+    }
+    /** Called by the scheduler once all the threads are done with the kernel
+     *
+     * Reduction kernels combine their per-thread partial results into the final output here.
+     */
+    virtual void end_reduction()
+    {
+    }
+    /** Estimate of the work of the kernel on a window, from which the scheduler picks how many threads run it
+     *
+     * Waking up the threads costs more than the work of the smallest kernels, e.g. a softmax over a few hundred classes:
+     * they run on fewer threads, or on the calling thread only (See @ref CPPScheduler::set_cost_model()).
+     *
+     * @param[in] window Region on which the kernel would be executed.
+     *
+     * @return The bytes read and written and the arithmetic operations, all zeros if unknown (Default), in which case all the threads are used
+     */
+    virtual KernelCost cost(const Window &window) const
+    {
+        ARM_COMPUTE_UNUSED(window);
+        return KernelCost{ 0, 0 };
+    }
+
+protected:
+    /** Number of elements a window iterates on: all the elements along X, one per step along the other dimensions
+     *
+     * @param[in] window Window to count the elements of.
+     *
+     * @return The number of elements
+     */
+    static size_t num_window_elements(const Window &window)
+    {
+        size_t num_elements = window.x().end() - window.x().start();
+        for(size_t d = 1; d < Coordinates::num_max_dimensions; ++d)
+        {
+            num_elements *= window.num_iterations(d);
+        }
+        return num_elements;
+    }
 };
 }
 #endif /*__ARM_COMPUTE_ICPPKERNEL_H__ */
@@ -47,6 +47,9 @@ public:
     /** Default destructor */
     ~ICPPSimpleKernel() = default;
 
+    // Inherited methods overridden:
+    KernelCost cost(const Window &window) const override;
+
 protected:
     /** Configure the kernel
      *
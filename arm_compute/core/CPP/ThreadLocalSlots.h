@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_THREADLOCALSLOTS_H__
+#define __ARM_COMPUTE_THREADLOCALSLOTS_H__
+
+#include "arm_compute/core/Error.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+/** Per-thread partial results of a reduction kernel
+ *
+ * Each thread only ever updates the slot indexed by Window::thread_id(), so no lock is needed while the kernel runs.
+ * The slots are combined by reduce() once all the threads are done, usually from ICPPKernel::end_reduction().
+ *
+ * @note A thread can run several sub-windows with @ref SchedulingPolicy::DYNAMIC, therefore the kernels must accumulate into their slot rather than overwrite it.
+ */
+template <typename T>
+class ThreadLocalSlots
+{
+public:
+    /** Default constructor */
+    ThreadLocalSlots()
+        : _slots()
+    {
+    }
+    /** Resize to one slot per thread and set all the slots to the given value
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     * @param[in] init        Initial value of every slot (Identity element of the reduction).
+     */
+    void reset(unsigned int num_threads, const T &init)
+    {
+        ARM_COMPUTE_ERROR_ON(num_threads == 0);
+
+        _slots.resize(num_threads);
+        for(auto &slot : _slots)
+        {
+            slot.value = init;
+        }
+    }
+    /** Resize to one slot per thread, keeping the values of the existing slots
+     *
+     * Unlike @ref reset(), no value is copied: the kernels whose slots own memory, e.g. a std::vector, reinitialise them in place
+     * so that the memory is kept from one run to the next.
+     *
+     * @param[in] num_threads Number of threads which will run the kernel.
+     */
+    void resize(unsigned int num_threads)
+    {
+        ARM_COMPUTE_ERROR_ON(num_threads == 0);
+
+        _slots.resize(num_threads);
+    }
+    /** Number of slots */
+    size_t size() const
+    {
+        return _slots.size();
+    }
+    /** Access the slot of a thread
+     *
+     * @param[in] thread_id Index of the thread as returned by Window::thread_id().
+     *
+     * @return The partial result of the thread
+     */
+    T &operator[](unsigned int thread_id)
+    {
+        ARM_COMPUTE_ERROR_ON(thread_id >= _slots.size());
+        return _slots[thread_id].value;
+    }
+    /** Combine all the slots pairwise into the first one
+     *
+     * The slots are merged along a binary tree (0 <- 1, 2 <- 3, ... then 0 <- 2, ...) so that the rounding error of
+     * floating point reductions grows with log2(num_threads) rather than num_threads.
+     *
+     * @param[in] op Function merging its second argument into its first one: void op(T &dst, const T &src).
+     *
+     * @return The combined result, stored in the first slot
+     */
+    template <typename Op>
+    T &reduce(Op &&op)
+    {
+        ARM_COMPUTE_ERROR_ON(_slots.empty());
+
+        for(size_t stride = 1; stride < _slots.size(); stride *= 2)
+        {
+            for(size_t i = 0; i + stride < _slots.size(); i += 2 * stride)
+            {
+                op(_slots[i].value, static_cast<const T &>(_slots[i + stride].value));
+            }
+        }
+
+        return _slots[0].value;
+    }
+
+private:
+    /** Size of the padding which keeps the slots of two threads on different cache lines */
+    static constexpr size_t cache_line_size = 64;
+
+    struct Slot
+    {
+        Slot()
+            : value(), padding()
+        {
+        }
+        T       value;
+        uint8_t padding[cache_line_size];
+    };
+
+    std::vector<Slot> _slots;
+};
+}
+#endif /* __ARM_COMPUTE_THREADLOCALSLOTS_H__ */
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_THREADSCRATCH_H__
+#define __ARM_COMPUTE_THREADSCRATCH_H__
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Number of scratch buffers of each thread (See @ref thread_scratch()) */
+constexpr unsigned int num_thread_scratch_slots = 8;
+
+/** Scratch buffer of the calling thread, for the temporary data a kernel needs while it runs a window
+ *
+ * Each thread owns @ref num_thread_scratch_slots buffers which grow to the largest size requested and are kept for the lifetime of the thread:
+ * once they reached the size the kernels need, running them doesn't allocate any memory (See @ref AllocationTracer).
+ * A kernel needing several buffers at once uses one slot for each of them.
+ *
+ * @note The content of the buffer is undefined, and only valid until the next request of the same slot by the calling thread:
+ *       kernels must not call each other while they use a slot.
+ *
+ * @param[in] size Size of the buffer in bytes.
+ * @param[in] slot (Optional) Index of the buffer, less than @ref num_thread_scratch_slots. Defaults to 0.
+ *
+ * @return A buffer of at least @p size bytes, aligned for any fundamental type
+ */
+void *thread_scratch(size_t size, unsigned int slot = 0);
+
+/** Typed scratch buffer of the calling thread (See @ref thread_scratch(size_t, unsigned int))
+ *
+ * @param[in] num_elements Number of elements of the buffer.
+ * @param[in] slot         (Optional) Index of the buffer, less than @ref num_thread_scratch_slots. Defaults to 0.
+ *
+ * @return A buffer of at least @p num_elements uninitialised elements
+ */
+template <typename T>
+inline T *thread_scratch(size_t num_elements, unsigned int slot = 0)
+{
+    return static_cast<T *>(thread_scratch(num_elements * sizeof(T), slot));
+}
+}
+#endif /* __ARM_COMPUTE_THREADSCRATCH_H__ */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPPCORNERGRIDSUPPRESSIONKERNEL_H__
+#define __ARM_COMPUTE_CPPCORNERGRIDSUPPRESSIONKERNEL_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+/** CPP kernel to keep the strongest corner candidates which are further than a minimum distance from each other
+ *
+ * It keeps the same corners as @ref CPPSortEuclideanDistanceKernel, but in parallel: the candidates are bucketed into a grid of
+ * min_distance wide cells and a candidate is kept if no stronger candidate of the 3x3 neighbouring cells closer than min_distance is kept.
+ * When this depends on a stronger candidate which isn't decided yet, the latter is decided first, so the cells can be processed in any order.
+ *
+ * @note Candidates of equal strength are ordered by y then x, whereas the order of @ref CPPSortEuclideanDistanceKernel is unspecified.
+ *
+ * @note The kernel must be run through the scheduler, which buckets the candidates before the run and writes the corners kept after it (See ICPPKernel::begin_reduction()).
+ */
+class CPPCornerGridSuppressionKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    CPPCornerGridSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPCornerGridSuppressionKernel(const CPPCornerGridSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPCornerGridSuppressionKernel &operator=(const CPPCornerGridSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    CPPCornerGridSuppressionKernel(CPPCornerGridSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    CPPCornerGridSuppressionKernel &operator=(CPPCornerGridSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~CPPCornerGridSuppressionKernel() = default;
+    /** Initialise the kernel's source and destination.
+     *
+     * @param[in]  input        Corner candidates. Their coordinates must be within the image.
+     * @param[out] output       Output keypoints, sorted by decreasing strength. The corners kept are appended to it.
+     * @param[in]  min_distance Radial Euclidean distance to use
+     * @param[in]  width        Width of the image the candidates were extracted from.
+     * @param[in]  height       Height of the image the candidates were extracted from.
+     */
+    void configure(const std::vector<InternalKeypoint> *input, IKeyPointArray *output, float min_distance, size_t width, size_t height);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
+
+private:
+    /** Index of the grid cell containing a candidate */
+    size_t cell_index(const InternalKeypoint &candidate) const;
+    /** Decide whether a candidate is kept, deciding first the stronger neighbours it depends on
+     *
+     * @param[in]     index Index of the candidate in the bucketed candidates.
+     * @param[in,out] stack Scratch buffer of the candidates waiting for a decision.
+     */
+    void resolve(size_t index, std::vector<size_t> &stack);
+
+    const std::vector<InternalKeypoint>     *_input;
+    IKeyPointArray                          *_output;
+    float                                    _min_distance; /**< Squared radial Euclidean distance */
+    int32_t                                  _cell_size;    /**< Width and height of a grid cell in pixels */
+    size_t                                   _grid_width;   /**< Number of grid cells along X */
+    size_t                                   _grid_height;  /**< Number of grid cells along Y */
+    std::vector<InternalKeypoint>            _candidates;   /**< Candidates grouped by grid cell */
+    std::vector<size_t>                      _offsets;      /**< Offset of the first candidate of each cell, plus the total number of candidates */
+    std::unique_ptr<std::atomic<uint8_t>[]>  _states;       /**< Decision taken for each bucketed candidate */
+    size_t                                   _num_states;   /**< Number of allocated decisions */
+};
+} // namespace arm_compute
+#endif /* __ARM_COMPUTE_CPPCORNERGRIDSUPPRESSIONKERNEL_H__ */
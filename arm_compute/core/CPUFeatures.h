@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPUFEATURES_H__
+#define __ARM_COMPUTE_CPUFEATURES_H__
+
+namespace arm_compute
+{
+/** Optional instructions supported by the CPU the library runs on */
+struct CPUFeatures
+{
+    bool fp16;        /**< Half precision arithmetic instructions (ARMv8.2-A FP16 extension) */
+    bool dot_product; /**< 8-bit integer dot product instructions (ARMv8.2-A dot product extension) */
+};
+
+/** Get the optional instructions supported by the CPU
+ *
+ * On AArch64 Linux and Android the features are read once from the hardware capabilities of the process (getauxval(AT_HWCAP)),
+ * which are the same for all the cores. Elsewhere only the features the library was compiled for are reported.
+ *
+ * @note The kernels compiled with multi_isa=1 for a more recent architecture than the rest of the library check these features at configure time.
+ *
+ * @return The features of the CPU
+ */
+const CPUFeatures &cpu_features();
+}
+#endif /* __ARM_COMPUTE_CPUFEATURES_H__ */
@@ -100,6 +100,27 @@
 #define ARM_COMPUTE_ERROR_ON(cond) \
     ARM_COMPUTE_ERROR_ON_MSG(cond, #cond)
 
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
+/** If the condition is true, the given message is printed and an exception is thrown
+ *
+ * Unlike @ref ARM_COMPUTE_ERROR_ON_MSG, which validates the configuration of functions and kernels, this check is executed every time a kernel is run:
+ * it is only enabled if ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
+ *
+ * @param[in] cond Condition to evaluate.
+ * @param[in] ...  Message to print if cond is false.
+ */
+#define ARM_COMPUTE_RUN_ERROR_ON_MSG(cond, ...) ARM_COMPUTE_ERROR_ON_MSG(cond, __VA_ARGS__)
+#else /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+#define ARM_COMPUTE_RUN_ERROR_ON_MSG(cond, ...)
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+
+/** If the condition is true then an error message is printed and an exception thrown, every time a kernel is run (See @ref ARM_COMPUTE_RUN_ERROR_ON_MSG)
+ *
+ * @param[in] cond Condition to evaluate
+ */
+#define ARM_COMPUTE_RUN_ERROR_ON(cond) \
+    ARM_COMPUTE_RUN_ERROR_ON_MSG(cond, #cond)
+
 /** If the condition is true then an error message is printed and an exception thrown
  *
  * @param[in] cond Condition to evaluate
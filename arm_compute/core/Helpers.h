@@ -38,6 +38,7 @@
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace arm_compute
 {
@@ -286,7 +287,7 @@ private:
  * @param[in]     w               Window to iterate through.
  * @param[in]     lambda_function The function of type void(function)( const Coordinates & id ) to call at each iteration.
  *                                Where id represents the absolute coordinates of the item to process.
- * @param[in,out] iterators       Tensor iterators which will be updated by this function before calling lambda_function.
+ * @param[in,out] iterators       (Optional) Tensor iterators which will be updated by this function before calling lambda_function.
  */
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... iterators);
@@ -325,6 +326,78 @@ bool update_window_and_padding(Window &win, Ts &&... patterns)
     return window_changed;
 }
 
+/** Merge the dimensions of a window into its first one where the tensors accessed with it are contiguous
+ *
+ * A dimension is merged into the ones below it if they cover their whole extent and none of the tensors has any padding
+ * between them: execute_window_loop() then runs a single long loop rather than updating every iterator at the end of each row.
+ *
+ * @note The coordinates passed to the lambda of execute_window_loop() are meaningless on a collapsed window: only use it in kernels which ignore them.
+ *
+ * @param[in] window Window to collapse, usually the sub-window passed to run().
+ * @param[in] info   Info of the first tensor accessed with the window.
+ * @param[in] infos  Info of the other tensors accessed with the window. They must have the same shape as @p info.
+ *
+ * @return The collapsed window, or @p window if no dimension can be merged.
+ */
+template <typename... Ts>
+Window collapse_window(const Window &window, const TensorInfo &info, Ts &&... infos);
+
+/** Merge the dimensions of a window into its first one where the tensors accessed with it are contiguous
+ *
+ * Same as the variadic version, for kernels which number of tensors is only known at configure time.
+ *
+ * @note Nothing is allocated: kernels should build the array of infos once in configure() and call this from run().
+ *
+ * @param[in] window    Window to collapse, usually the sub-window passed to run().
+ * @param[in] infos     Info of the tensors accessed with the window. They must have the same shape.
+ * @param[in] num_infos Number of elements of @p infos, at least one is required.
+ *
+ * @return The collapsed window, or @p window if no dimension can be merged.
+ */
+Window collapse_window(const Window &window, const TensorInfo *const *infos, size_t num_infos);
+
+/** Merge the dimensions of a window into its first one where the tensors accessed with it are contiguous
+ *
+ * Same as the pointer and count version.
+ *
+ * @param[in] window Window to collapse, usually the sub-window passed to run().
+ * @param[in] infos  Info of the tensors accessed with the window. They must have the same shape, at least one is required.
+ *
+ * @return The collapsed window, or @p window if no dimension can be merged.
+ */
+inline Window collapse_window(const Window &window, const std::vector<const TensorInfo *> &infos);
+
+/** Run a vectorised elementwise operation over a window which rows don't have to be a multiple of the vector size
+ *
+ * The operation is called on blocks of @p num_elems elements of each row. The elements at the end of a row which don't
+ * fill a whole block are copied to zero-initialised scratch buffers, processed by the same operation and only the valid
+ * results are copied back: the tensors don't need any padding and the results are the same as in the vector path.
+ *
+ * @note The step of the window in X must be 1, collapse it with @ref collapse_window first to get long rows.
+ *
+ * @param[in] w      Window to loop over.
+ * @param[in] op     Operation called as op(const uint8_t *in_ptr, uint8_t *out_ptr) on @p num_elems elements of each tensor.
+ * @param[in] input  Input tensor.
+ * @param[in] output Output tensor (Can be the same as @p input).
+ */
+template <int num_elems, typename L>
+void execute_elementwise_loop(const Window &w, L &&op, const ITensor *input, ITensor *output);
+
+/** Run a vectorised elementwise operation of two inputs over a window which rows don't have to be a multiple of the vector size
+ *
+ * See the single input version for the handling of the end of the rows.
+ *
+ * @note The step of the window in X must be 1, collapse it with @ref collapse_window first to get long rows.
+ *
+ * @param[in] w      Window to loop over.
+ * @param[in] op     Operation called as op(const uint8_t *in1_ptr, const uint8_t *in2_ptr, uint8_t *out_ptr) on @p num_elems elements of each tensor.
+ * @param[in] input1 First input tensor.
+ * @param[in] input2 Second input tensor.
+ * @param[in] output Output tensor.
+ */
+template <int num_elems, typename L>
+void execute_elementwise_loop(const Window &w, L &&op, const ITensor *input1, const ITensor *input2, ITensor *output);
+
 /** Calculate the maximum window for a given tensor shape and border setting
  *
  * @param[in] info        Tensor info object defining the shape of the object for which the window is created.
@@ -412,6 +485,26 @@ inline Strides compute_strides(const TensorInfo &info)
 {
     return compute_strides(info, info.element_size());
 }
+
+/** Check whether a tensor stores its elements without any gap, i.e. whether its buffer can be copied with a single memcpy().
+ *
+ * @param[in] info Tensor info object of the tensor.
+ *
+ * @return True if the first element starts the buffer and the strides are the ones computed by @ref compute_strides() (No padding)
+ */
+inline bool has_contiguous_layout(const TensorInfo &info)
+{
+    const Strides contiguous_strides = compute_strides(info);
+
+    for(size_t d = 0; d < info.num_dimensions(); ++d)
+    {
+        if(info.strides_in_bytes()[d] != contiguous_strides[d])
+        {
+            return false;
+        }
+    }
+    return info.offset_first_element_in_bytes() == 0;
+}
 }
 
 #include "arm_compute/core/Helpers.inl"
@@ -24,14 +24,16 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <numeric>
 
 namespace
 {
 inline uint8_t delta_bilinear_c1u8(const uint8_t *pixel_ptr, size_t stride, float dx, float dy)
 {
-    ARM_COMPUTE_ERROR_ON(pixel_ptr == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(pixel_ptr == nullptr);
 
     const float dx1 = 1.0f - dx;
     const float dy1 = 1.0f - dy;
@@ -51,7 +53,7 @@ inline uint8_t delta_bilinear_c1u8(const uint8_t *pixel_ptr, size_t stride, floa
 
 inline uint8_t pixel_bilinear_c1u8(const uint8_t *first_pixel_ptr, size_t stride, float x, float y)
 {
-    ARM_COMPUTE_ERROR_ON(first_pixel_ptr == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(first_pixel_ptr == nullptr);
 
     const int32_t xi = x;
     const int32_t yi = y;
@@ -64,7 +66,7 @@ inline uint8_t pixel_bilinear_c1u8(const uint8_t *first_pixel_ptr, size_t stride
 
 inline uint8_t pixel_bilinear_c1u8_clamp(const uint8_t *first_pixel_ptr, size_t stride, size_t width, size_t height, float x, float y)
 {
-    ARM_COMPUTE_ERROR_ON(first_pixel_ptr == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(first_pixel_ptr == nullptr);
 
     x = std::max(-1.f, std::min(x, static_cast<float>(width)));
     y = std::max(-1.f, std::min(y, static_cast<float>(height)));
@@ -80,7 +82,7 @@ inline uint8_t pixel_bilinear_c1u8_clamp(const uint8_t *first_pixel_ptr, size_t
 
 inline uint8_t pixel_area_c1u8_clamp(const uint8_t *first_pixel_ptr, size_t stride, size_t width, size_t height, float wr, float hr, int x, int y)
 {
-    ARM_COMPUTE_ERROR_ON(first_pixel_ptr == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(first_pixel_ptr == nullptr);
 
     // Calculate sampling position
     float in_x = (x + 0.5f) * wr - 0.5f;
@@ -109,7 +111,7 @@ inline uint8_t pixel_area_c1u8_clamp(const uint8_t *first_pixel_ptr, size_t stri
     // Bounding box elements in each dimension
     const int x_elements = (x_to - x_from + 1);
     const int y_elements = (y_to - y_from + 1);
-    ARM_COMPUTE_ERROR_ON(x_elements == 0 || y_elements == 0);
+    ARM_COMPUTE_RUN_ERROR_ON(x_elements == 0 || y_elements == 0);
 
     // Sum pixels in area
     int sum = 0;
@@ -143,6 +145,11 @@ struct IncrementIterators
         it.increment(dimension);
         // End of recursion
     }
+
+    static void unroll()
+    {
+        // End of recursion for loops which only use the coordinates
+    }
 };
 
 template <size_t dim>
@@ -174,7 +181,7 @@ struct ForEachDimension<0>
 template <typename L, typename... Ts>
 inline void execute_window_loop(const Window &w, L &&lambda_function, Ts &&... iterators)
 {
-    w.validate();
+    w.validate_on_run();
 
     Coordinates id;
     ForEachDimension<Coordinates::num_max_dimensions>::unroll(w, id, std::forward<L>(lambda_function), std::forward<Ts>(iterators)...);
@@ -188,9 +195,9 @@ inline constexpr Iterator::Iterator()
 inline Iterator::Iterator(const ITensor *tensor, const Window &win)
     : Iterator()
 {
-    ARM_COMPUTE_ERROR_ON(tensor == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(tensor == nullptr);
     const TensorInfo *info = tensor->info();
-    ARM_COMPUTE_ERROR_ON(info == nullptr);
+    ARM_COMPUTE_RUN_ERROR_ON(info == nullptr);
     const Strides &strides = info->strides_in_bytes();
 
     _ptr = tensor->buffer() + info->offset_first_element_in_bytes();
@@ -213,7 +220,7 @@ inline Iterator::Iterator(const ITensor *tensor, const Window &win)
 
 inline void Iterator::increment(const size_t dimension)
 {
-    ARM_COMPUTE_ERROR_ON(dimension >= Coordinates::num_max_dimensions);
+    ARM_COMPUTE_RUN_ERROR_ON(dimension >= Coordinates::num_max_dimensions);
 
     _dims[dimension]._dim_start += _dims[dimension]._stride;
 
@@ -235,7 +242,7 @@ inline constexpr uint8_t *Iterator::ptr() const
 
 inline void Iterator::reset(const size_t dimension)
 {
-    ARM_COMPUTE_ERROR_ON(dimension >= Coordinates::num_max_dimensions - 1);
+    ARM_COMPUTE_RUN_ERROR_ON(dimension >= Coordinates::num_max_dimensions - 1);
 
     _dims[dimension]._dim_start = _dims[dimension + 1]._dim_start;
 
@@ -244,5 +251,110 @@ inline void Iterator::reset(const size_t dimension)
         _dims[n]._dim_start = _dims[dimension]._dim_start;
     }
 }
+
+template <typename... Ts>
+inline Window collapse_window(const Window &window, const TensorInfo &info, Ts &&... infos)
+{
+    // The infos are gathered on the stack: the function is called from run() for every sub-window
+    const std::array<const TensorInfo *, 1 + sizeof...(Ts)> all_infos{ { &info, &infos... } };
+    return collapse_window(window, all_infos.data(), all_infos.size());
+}
+
+inline Window collapse_window(const Window &window, const std::vector<const TensorInfo *> &infos)
+{
+    return collapse_window(window, infos.data(), infos.size());
+}
+
+template <int num_elems, typename L>
+inline void execute_elementwise_loop(const Window &w, L &&op, const ITensor *input, ITensor *output)
+{
+    // Largest block processed at once: 16 F32 values
+    constexpr size_t max_block_size = 64;
+
+    const int    start_x  = w.x().start();
+    const int    end_x    = w.x().end();
+    const size_t in_size  = input->info()->element_size();
+    const size_t out_size = output->info()->element_size();
+
+    ARM_COMPUTE_RUN_ERROR_ON(w.x().step() != 1);
+    ARM_COMPUTE_RUN_ERROR_ON(num_elems * std::max(in_size, out_size) > max_block_size);
+
+    Window win(w);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in(input, win);
+    Iterator out(output, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        int x = start_x;
+
+        for(; x <= end_x - num_elems; x += num_elems)
+        {
+            op(in.ptr() + x * in_size, out.ptr() + x * out_size);
+        }
+
+        if(x < end_x)
+        {
+            const size_t tail = end_x - x;
+
+            alignas(16) uint8_t in_block[max_block_size] = { 0 };
+            alignas(16) uint8_t out_block[max_block_size];
+
+            std::memcpy(in_block, in.ptr() + x * in_size, tail * in_size);
+            op(in_block, out_block);
+            std::memcpy(out.ptr() + x * out_size, out_block, tail * out_size);
+        }
+    },
+    in, out);
+}
+
+template <int num_elems, typename L>
+inline void execute_elementwise_loop(const Window &w, L &&op, const ITensor *input1, const ITensor *input2, ITensor *output)
+{
+    // Largest block processed at once: 16 F32 values
+    constexpr size_t max_block_size = 64;
+
+    const int    start_x  = w.x().start();
+    const int    end_x    = w.x().end();
+    const size_t in1_size = input1->info()->element_size();
+    const size_t in2_size = input2->info()->element_size();
+    const size_t out_size = output->info()->element_size();
+
+    ARM_COMPUTE_RUN_ERROR_ON(w.x().step() != 1);
+    ARM_COMPUTE_RUN_ERROR_ON(num_elems * std::max({ in1_size, in2_size, out_size }) > max_block_size);
+
+    Window win(w);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator in1(input1, win);
+    Iterator in2(input2, win);
+    Iterator out(output, win);
+
+    execute_window_loop(win, [&](const Coordinates &)
+    {
+        int x = start_x;
+
+        for(; x <= end_x - num_elems; x += num_elems)
+        {
+            op(in1.ptr() + x * in1_size, in2.ptr() + x * in2_size, out.ptr() + x * out_size);
+        }
+
+        if(x < end_x)
+        {
+            const size_t tail = end_x - x;
+
+            alignas(16) uint8_t in1_block[max_block_size] = { 0 };
+            alignas(16) uint8_t in2_block[max_block_size] = { 0 };
+            alignas(16) uint8_t out_block[max_block_size];
+
+            std::memcpy(in1_block, in1.ptr() + x * in1_size, tail * in1_size);
+            std::memcpy(in2_block, in2.ptr() + x * in2_size, tail * in2_size);
+            op(in1_block, in2_block, out_block);
+            std::memcpy(out.ptr() + x * out_size, out_block, tail * out_size);
+        }
+    },
+    in1, in2, out);
+}
 }
 #endif /* DOXYGEN_SKIP_THIS */
@@ -34,6 +34,8 @@ class KeyPoint;
 class Coordinates2D;
 class DetectionWindow;
 class Size2D;
+struct Rectangle;
+struct ROI;
 
 /** Array of type T */
 template <class T>
@@ -139,6 +141,8 @@ using IKeyPointArray        = IArray<KeyPoint>;
 using ICoordinates2DArray   = IArray<Coordinates2D>;
 using IDetectionWindowArray = IArray<DetectionWindow>;
 using ISize2DArray          = IArray<Size2D>;
+using IRectangleArray       = IArray<Rectangle>;
+using IROIArray             = IArray<ROI>;
 using IUInt8Array           = IArray<uint8_t>;
 using IUInt16Array          = IArray<uint16_t>;
 using IUInt32Array          = IArray<uint32_t>;
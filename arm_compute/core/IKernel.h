@@ -27,6 +27,8 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Window.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 /** Common information for all the kernels */
@@ -57,6 +59,15 @@ public:
      * @return The maximum window the kernel can be executed on.
      */
     const Window &window() const;
+    /** Identifier of the current configuration of the kernel
+     *
+     * Every call to configure() gives the kernel a new identifier, unique in the process: state derived from the configuration
+     * of a kernel (e.g. the split of its window recorded by a scheduler) is stale once the identifier changed, even if another
+     * kernel was since allocated at the same address.
+     *
+     * @return The identifier of the configuration
+     */
+    uint64_t configuration_id() const;
 
 protected:
     /** Configure the kernel's window
@@ -66,7 +77,8 @@ protected:
     void configure(const Window &window);
 
 private:
-    Window _window;
+    Window   _window;
+    uint64_t _configuration_id;
 };
 }
 #endif /*__ARM_COMPUTE_IKERNEL_H__ */
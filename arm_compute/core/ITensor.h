@@ -83,6 +83,20 @@ public:
      * @param io_fmt Format information
      */
     void print(std::ostream &s, IOFormatInfo io_fmt = IOFormatInfo()) const;
+
+    /** Flags if the tensor is used or not by the functions it was given to
+     *
+     * @return True if the tensor is still read by a function
+     */
+    bool is_used() const;
+    /** Marks a tensor as unused: the functions it was given to have made their own copy of its content.
+     *
+     * For example, the weights of a layer are no longer read once they have been reshaped: their memory can be released by the caller.
+     */
+    void mark_as_unused() const;
+
+private:
+    mutable bool _is_used = { true }; /**< Flag that marks if the tensor is used or not */
 };
 
 using IImage = ITensor;
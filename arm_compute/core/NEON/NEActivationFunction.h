@@ -0,0 +1,182 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEACTIVATIONFUNCTION_H__
+#define __ARM_COMPUTE_NEACTIVATIONFUNCTION_H__
+
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/Types.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+namespace arm_compute
+{
+/** Apply an activation function to 4 values.
+ *
+ * @note Used by the kernels which fuse an activation function into the store of their results.
+ *
+ * @note With @ref MathPrecision::FAST the transcendental functions use @ref vexpq_fast_f32, @ref vtanhq_fast_f32 and @ref vinvq_fast_f32.
+ *
+ * @param[in] x Input values.
+ * @param[in] a Alpha parameter of the activation function, broadcast to all the lanes.
+ * @param[in] b Beta parameter of the activation function, broadcast to all the lanes.
+ *
+ * @return The activated values.
+ */
+template <ActivationLayerInfo::ActivationFunction F, MathPrecision P = MathPrecision::ACCURATE>
+inline float32x4_t vactivateq_f32(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    const float32x4_t CONST_1 = vdupq_n_f32(1.f);
+    const float32x4_t CONST_0 = vdupq_n_f32(0.f);
+
+    switch(F)
+    {
+        case ActivationFunction::ABS:
+            return vabsq_f32(x);
+        case ActivationFunction::BOUNDED_RELU:
+            return vminq_f32(a, vmaxq_f32(CONST_0, x));
+        case ActivationFunction::LINEAR:
+            return vmlaq_f32(b, a, x);
+        case ActivationFunction::LOGISTIC:
+            if(P == MathPrecision::FAST)
+            {
+                return vinvq_fast_f32(vaddq_f32(CONST_1, vexpq_fast_f32(vnegq_f32(x))));
+            }
+            return vinvq_f32(vaddq_f32(CONST_1, vexpq_f32(vnegq_f32(x))));
+        case ActivationFunction::RELU:
+            return vmaxq_f32(CONST_0, x);
+        case ActivationFunction::SOFT_RELU:
+            if(P == MathPrecision::FAST)
+            {
+                return vlogq_f32(vaddq_f32(CONST_1, vexpq_fast_f32(x)));
+            }
+            return vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(x)));
+        case ActivationFunction::SQRT:
+            if(P == MathPrecision::FAST)
+            {
+                return vinvq_fast_f32(vinvsqrtq_f32(x));
+            }
+            return vinvq_f32(vinvsqrtq_f32(x));
+        case ActivationFunction::SQUARE:
+            return vmulq_f32(x, x);
+        case ActivationFunction::TANH:
+            if(P == MathPrecision::FAST)
+            {
+                return vmulq_f32(a, vtanhq_fast_f32(vmulq_f32(b, x)));
+            }
+            return vmulq_f32(a, vtanhq_f32(vmulq_f32(b, x)));
+        default:
+            return x;
+    }
+}
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+/** Apply an activation function to 8 half precision values.
+ *
+ * @note The transcendental functions are evaluated in single precision, with the accuracy selected by @p P.
+ *
+ * @param[in] x Input values.
+ * @param[in] a Alpha parameter of the activation function, broadcast to all the lanes.
+ * @param[in] b Beta parameter of the activation function, broadcast to all the lanes.
+ *
+ * @return The activated values.
+ */
+template <ActivationLayerInfo::ActivationFunction F, MathPrecision P = MathPrecision::ACCURATE>
+inline float16x8_t vactivateq_f16(const float16x8_t &x, const float16x8_t &a, const float16x8_t &b)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    const float16x8_t CONST_0 = vdupq_n_f16(0.f);
+
+    switch(F)
+    {
+        case ActivationFunction::ABS:
+            return vabsq_f16(x);
+        case ActivationFunction::BOUNDED_RELU:
+            return vminq_f16(a, vmaxq_f16(CONST_0, x));
+        case ActivationFunction::LINEAR:
+            return vaddq_f16(b, vmulq_f16(a, x));
+        case ActivationFunction::RELU:
+            return vmaxq_f16(CONST_0, x);
+        case ActivationFunction::SQUARE:
+            return vmulq_f16(x, x);
+        case ActivationFunction::LOGISTIC:
+        case ActivationFunction::SOFT_RELU:
+        case ActivationFunction::SQRT:
+        case ActivationFunction::TANH:
+        {
+            const float32x4_t a_f32 = vcvt_f32_f16(vget_low_f16(a));
+            const float32x4_t b_f32 = vcvt_f32_f16(vget_low_f16(b));
+            const float32x4_t low   = vactivateq_f32<F, P>(vcvt_f32_f16(vget_low_f16(x)), a_f32, b_f32);
+            const float32x4_t high  = vactivateq_f32<F, P>(vcvt_f32_f16(vget_high_f16(x)), a_f32, b_f32);
+            return vcombine_f16(vcvt_f16_f32(low), vcvt_f16_f32(high));
+        }
+        default:
+            return x;
+    }
+}
+#endif
+
+/** Apply an activation function to a single value.
+ *
+ * @param[in] x Input value.
+ * @param[in] a Alpha parameter of the activation function.
+ * @param[in] b Beta parameter of the activation function.
+ *
+ * @return The activated value.
+ */
+template <ActivationLayerInfo::ActivationFunction F>
+inline float activate(float x, float a, float b)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    switch(F)
+    {
+        case ActivationFunction::ABS:
+            return std::abs(x);
+        case ActivationFunction::BOUNDED_RELU:
+            return std::min(a, std::max(0.f, x));
+        case ActivationFunction::LINEAR:
+            return a * x + b;
+        case ActivationFunction::LOGISTIC:
+            return 1.f / (1.f + std::exp(-x));
+        case ActivationFunction::RELU:
+            return std::max(0.f, x);
+        case ActivationFunction::SOFT_RELU:
+            return std::log(1.f + std::exp(x));
+        case ActivationFunction::SQRT:
+            return std::sqrt(x);
+        case ActivationFunction::SQUARE:
+            return x * x;
+        case ActivationFunction::TANH:
+            return a * std::tanh(b * x);
+        default:
+            return x;
+    }
+}
+}
+#endif /* __ARM_COMPUTE_NEACTIVATIONFUNCTION_H__ */
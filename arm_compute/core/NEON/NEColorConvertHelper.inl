@@ -390,7 +390,7 @@ void colorconvert_nv12_to_rgb(const void *__restrict input, void *__restrict out
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IImage *__restrict>(output);
@@ -403,7 +403,7 @@ void colorconvert_nv12_to_rgb(const void *__restrict input, void *__restrict out
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_uv(input_ptr->plane(1), win_uv);
@@ -446,7 +446,7 @@ void colorconvert_iyuv_to_rgb(const void *__restrict input, void *__restrict out
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IImage *__restrict>(output);
@@ -458,7 +458,7 @@ void colorconvert_iyuv_to_rgb(const void *__restrict input, void *__restrict out
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_u(input_ptr->plane(1), win_uv);
@@ -503,7 +503,7 @@ void colorconvert_yuyv_to_nv12(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -514,7 +514,7 @@ void colorconvert_yuyv_to_nv12(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in(input_ptr, win);
     Iterator out_y(output_ptr->plane(0), win);
@@ -551,7 +551,7 @@ void colorconvert_iyuv_to_nv12(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -560,7 +560,7 @@ void colorconvert_iyuv_to_nv12(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_u(input_ptr->plane(1), win_uv);
@@ -592,7 +592,7 @@ void colorconvert_nv12_to_iyuv(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -603,7 +603,7 @@ void colorconvert_nv12_to_iyuv(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_uv(input_ptr->plane(1), win_uv);
@@ -634,7 +634,7 @@ void colorconvert_yuyv_to_iyuv(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -645,7 +645,7 @@ void colorconvert_yuyv_to_iyuv(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in(input_ptr, win);
     Iterator out_y(output_ptr->plane(0), win);
@@ -687,7 +687,7 @@ void colorconvert_nv12_to_yuv4(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -698,7 +698,7 @@ void colorconvert_nv12_to_yuv4(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_uv(input_ptr->plane(1), win_uv);
@@ -738,7 +738,7 @@ void colorconvert_iyuv_to_yuv4(const void *__restrict input, void *__restrict ou
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IMultiImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -747,7 +747,7 @@ void colorconvert_iyuv_to_yuv4(const void *__restrict input, void *__restrict ou
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in_y(input_ptr->plane(0), win);
     Iterator in_u(input_ptr->plane(1), win_uv);
@@ -790,7 +790,7 @@ void colorconvert_rgb_to_nv12(const void *__restrict input, void *__restrict out
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -799,7 +799,7 @@ void colorconvert_rgb_to_nv12(const void *__restrict input, void *__restrict out
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in(input_ptr, win);
     Iterator out_y(output_ptr->plane(0), win);
@@ -826,7 +826,7 @@ void colorconvert_rgb_to_iyuv(const void *__restrict input, void *__restrict out
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
@@ -835,7 +835,7 @@ void colorconvert_rgb_to_iyuv(const void *__restrict input, void *__restrict out
     Window win_uv(win);
     win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
     win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
-    win_uv.validate();
+    win_uv.validate_on_run();
 
     Iterator in(input_ptr, win);
     Iterator out_y(output_ptr->plane(0), win);
@@ -863,7 +863,7 @@ void colorconvert_rgb_to_yuv4(const void *__restrict input, void *__restrict out
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    win.validate();
+    win.validate_on_run();
 
     const auto input_ptr  = static_cast<const IImage *__restrict>(input);
     const auto output_ptr = static_cast<IMultiImage *__restrict>(output);
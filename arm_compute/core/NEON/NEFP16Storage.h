@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFP16STORAGE_H__
+#define __ARM_COMPUTE_NEFP16STORAGE_H__
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+/** Check whether the half precision tensors are only stored in F16 and computed in single precision
+ *
+ * The kernels compiled with ARM_COMPUTE_ENABLE_FP16 compute in half precision with the arithmetic instructions of ARMv8.2-A.
+ * On the ARMv8.0-A builds (ARM_COMPUTE_ENABLE_FP16_STORAGE), the F16 activations and weights are converted to F32 in registers
+ * and the results converted back when they are stored: the tensors keep the footprint and memory bandwidth of half precision
+ * but only the conversion instructions of ARMv8.0-A are needed.
+ *
+ * @note With multi_isa=1 the half precision arithmetic is used if @ref cpu_features reports it.
+ *
+ * @return True if the F16 tensors are computed in single precision
+ */
+bool is_fp16_storage_only();
+
+/** Load 4 single precision values
+ *
+ * @param[in] ptr Pointer to the values
+ *
+ * @return The values
+ */
+inline float32x4_t vload_f32(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+/** Store 4 single precision values
+ *
+ * @param[out] ptr   Pointer to the destination
+ * @param[in]  value Values to store
+ */
+inline void vstore_f32(float *ptr, const float32x4_t &value)
+{
+    vst1q_f32(ptr, value);
+}
+
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+/** Load 4 half precision values and convert them to single precision
+ *
+ * @param[in] ptr Pointer to the values
+ *
+ * @return The values converted to single precision
+ */
+inline float32x4_t vload_f32(const float16_t *ptr)
+{
+    return vcvt_f32_f16(vld1_f16(ptr));
+}
+
+/** Convert 4 single precision values to half precision and store them
+ *
+ * @param[out] ptr   Pointer to the destination
+ * @param[in]  value Values to store
+ */
+inline void vstore_f32(float16_t *ptr, const float32x4_t &value)
+{
+    vst1_f16(ptr, vcvt_f16_f32(value));
+}
+#endif /* defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE) */
+}
+#endif /* __ARM_COMPUTE_NEFP16STORAGE_H__ */
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace
+{
+/** Number of sub-histograms the consecutive pixels of a row are counted in */
+constexpr unsigned int num_histogram_banks = 4;
+
+/** Add a partial histogram to another one.
+ *
+ *  @param[in,out] global_hist Pointer to the histogram to update.
+ *  @param[in]     local_hist  Pointer to the partial histogram.
+ *  @param[in]     bins        Number of bins.
+ */
+inline void merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins)
+{
+    const unsigned int v_end = (bins / 4) * 4;
+
+    for(unsigned int b = 0; b < v_end; b += 4)
+    {
+        const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
+        const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
+        vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
+    }
+
+    for(unsigned int b = v_end; b < bins; ++b)
+    {
+        global_hist[b] += local_hist[b];
+    }
+}
+
+/** Add the banks filled by @ref histogram_banked_row_u8 to a histogram.
+ *
+ *  @param[in,out] global_hist Pointer to the histogram to update.
+ *  @param[in]     banks       Pointer to the first bank.
+ *  @param[in]     bank_stride Distance in bins between two banks.
+ *  @param[in]     bins        Number of bins to add from each bank. Must not be larger than @p bank_stride.
+ */
+inline void merge_histogram_banks(uint32_t *global_hist, const uint32_t *banks, size_t bank_stride, size_t bins)
+{
+    for(unsigned int b = 0; b < num_histogram_banks; ++b)
+    {
+        merge_histogram(global_hist, banks + b * bank_stride, bins);
+    }
+}
+
+/** Count the pixels of a row in @ref num_histogram_banks sub-histograms.
+ *
+ * The pixel x is counted in the bank x % @ref num_histogram_banks, so that when consecutive pixels fall in the same bin
+ * (e.g. on flat regions of the image) an increment doesn't have to wait for the previous one to be stored.
+ *
+ *  @param[in]  in_ptr      Pointer to the first pixel of the row.
+ *  @param[in]  width       Number of pixels in the row.
+ *  @param[out] banks       Pointer to the first bank.
+ *  @param[in]  bank_stride Distance in bins between two banks.
+ *  @param[in]  bin         Function returning the bin of a pixel value, which must be less than @p bank_stride.
+ */
+template <typename F>
+inline void histogram_banked_row_u8(const uint8_t *in_ptr, int width, uint32_t *banks, size_t bank_stride, const F &bin)
+{
+    uint32_t *const bank0 = banks;
+    uint32_t *const bank1 = banks + bank_stride;
+    uint32_t *const bank2 = banks + 2 * bank_stride;
+    uint32_t *const bank3 = banks + 3 * bank_stride;
+
+    int x = 0;
+
+    for(; x <= width - 16; x += 16)
+    {
+        const uint8x16_t pixels = vld1q_u8(in_ptr + x);
+
+        ++bank0[bin(vgetq_lane_u8(pixels, 0))];
+        ++bank1[bin(vgetq_lane_u8(pixels, 1))];
+        ++bank2[bin(vgetq_lane_u8(pixels, 2))];
+        ++bank3[bin(vgetq_lane_u8(pixels, 3))];
+        ++bank0[bin(vgetq_lane_u8(pixels, 4))];
+        ++bank1[bin(vgetq_lane_u8(pixels, 5))];
+        ++bank2[bin(vgetq_lane_u8(pixels, 6))];
+        ++bank3[bin(vgetq_lane_u8(pixels, 7))];
+        ++bank0[bin(vgetq_lane_u8(pixels, 8))];
+        ++bank1[bin(vgetq_lane_u8(pixels, 9))];
+        ++bank2[bin(vgetq_lane_u8(pixels, 10))];
+        ++bank3[bin(vgetq_lane_u8(pixels, 11))];
+        ++bank0[bin(vgetq_lane_u8(pixels, 12))];
+        ++bank1[bin(vgetq_lane_u8(pixels, 13))];
+        ++bank2[bin(vgetq_lane_u8(pixels, 14))];
+        ++bank3[bin(vgetq_lane_u8(pixels, 15))];
+    }
+
+    // Process leftover pixels
+    for(; x < width; ++x)
+    {
+        ++banks[(x % num_histogram_banks) * bank_stride + bin(in_ptr[x])];
+    }
+}
+} // namespace
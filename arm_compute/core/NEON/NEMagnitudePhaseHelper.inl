@@ -0,0 +1,350 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include <arm_neon.h>
+
+namespace
+{
+// Defines for computing atan2
+constexpr float SCALE_FACTOR = 0.7111111111111111f;
+constexpr float PI           = 3.141592653589793f;
+constexpr float SCALE_180    = 180.0f / PI;
+constexpr float SCALE_360    = SCALE_180 * SCALE_FACTOR;
+constexpr float PI_4         = 0.7853981633974483f;
+constexpr float COEFF1       = 0.0663f;
+constexpr float COEFF2       = 0.2447f;
+constexpr float COEFF_FAST   = 0.273f;
+
+inline float32x4_t inv(float32x4_t x)
+{
+    float32x4_t result = vrecpeq_f32(x);
+    result             = vmulq_f32(vrecpsq_f32(x, result), result);
+    return result;
+}
+
+inline float32x4_t atan2_0_360(float32x4_t gx, float32x4_t gy)
+{
+    const float32x4_t zero       = vdupq_n_f32(0.0f);
+    const float32x4_t epsilon    = vdupq_n_f32(1e-9f);
+    const float32x4_t piover4    = vdupq_n_f32(PI_4);
+    const float32x4_t coeff1     = vdupq_n_f32(COEFF1);
+    const float32x4_t coeff2     = vdupq_n_f32(COEFF2);
+    const float32x4_t ninety     = vdupq_n_f32(90.0f * SCALE_FACTOR);
+    const float32x4_t oneeighty  = vdupq_n_f32(180.0f * SCALE_FACTOR);
+    const float32x4_t threesixty = vdupq_n_f32(360.0f * SCALE_FACTOR);
+    const float32x4_t scale      = vdupq_n_f32(SCALE_360);
+
+    float32x4_t abs_gx = vabsq_f32(gx);
+    float32x4_t abs_gy = vabsq_f32(gy);
+    float32x4_t tmin   = vminq_f32(abs_gx, abs_gy);
+    float32x4_t tmax   = vmaxq_f32(abs_gx, abs_gy);
+    float32x4_t z      = vmulq_f32(tmin, inv(vaddq_f32(tmax, epsilon)));
+    float32x4_t absz   = vabsq_f32(z);
+    float32x4_t term   = vmulq_f32(z, vsubq_f32(vdupq_n_f32(1.0f), absz));
+
+    /* Compute y = pi/4 * x - x*(abs(x)-1)*(0.2447+0.0663 * abs(x) */
+    float32x4_t result = vaddq_f32(coeff2, vmulq_f32(absz, coeff1));
+    result             = vmulq_f32(result, term);
+    result             = vmlaq_f32(result, piover4, z);
+
+    /* Radians to degrees conversion with applied a scale factor in order to have the result [0, 255]  */
+    result = vmulq_f32(result, scale);
+
+    /* If z > 1, result = 90 - result */
+    result = vbslq_f32(vcgeq_f32(abs_gx, abs_gy), result, vsubq_f32(ninety, result));
+
+    /* Choose correct quadrant */
+    result = vbslq_f32(vcltq_f32(gx, zero), vsubq_f32(oneeighty, result), result);
+    result = vbslq_f32(vcltq_f32(gy, zero), vsubq_f32(threesixty, result), result);
+
+    return result;
+}
+
+inline float32x4_t atan2_0_180(float32x4_t gx, float32x4_t gy)
+{
+    const float32x4_t zero       = vdupq_n_f32(0.0f);
+    const float32x4_t epsilon    = vdupq_n_f32(1e-9f); // epsilon used to avoiding division by 0
+    const float32x4_t piover4    = vdupq_n_f32(PI_4);
+    const float32x4_t coeff1     = vdupq_n_f32(COEFF1);
+    const float32x4_t coeff2     = vdupq_n_f32(COEFF2);
+    const float32x4_t ninety     = vdupq_n_f32(90.0f);
+    const float32x4_t oneeighty  = vdupq_n_f32(180.0f);
+    const float32x4_t threesixty = vdupq_n_f32(360.0f);
+    const float32x4_t scale      = vdupq_n_f32(SCALE_180);
+
+    float32x4_t abs_gx = vabsq_f32(gx);
+    float32x4_t abs_gy = vabsq_f32(gy);
+    float32x4_t tmin   = vminq_f32(abs_gx, abs_gy);
+    float32x4_t tmax   = vmaxq_f32(abs_gx, abs_gy);
+    float32x4_t z      = vmulq_f32(tmin, inv(vaddq_f32(tmax, epsilon)));
+    float32x4_t absz   = vabsq_f32(z);
+
+    /* Compute y = pi/4 * z - z*(abs(z)-1)*(0.2447+0.0663 * abs(z) */
+    float32x4_t term   = vmulq_f32(z, vsubq_f32(vdupq_n_f32(1.0f), absz));
+    float32x4_t result = vaddq_f32(coeff2, vmulq_f32(absz, coeff1));
+    result             = vmulq_f32(result, term);
+    result             = vmlaq_f32(result, piover4, z);
+
+    /* Radians to degrees conversion */
+    result = vmulq_f32(result, scale);
+
+    /* If z > 1, result = 90 - result */
+    result = vbslq_f32(vcgeq_f32(abs_gx, abs_gy), result, vsubq_f32(ninety, result));
+
+    /* Choose correct quadrant */
+    result = vbslq_f32(vcltq_f32(gx, zero), vsubq_f32(oneeighty, result), result);
+    result = vbslq_f32(vcltq_f32(gy, zero), vsubq_f32(threesixty, result), result);
+    result = vbslq_f32(vcgtq_f32(result, oneeighty), vsubq_f32(result, oneeighty), result);
+
+    return result;
+}
+
+/** Lower precision atan2: atan(z) ~= z * (pi/4 + 0.273 * (1 - z)) on the octant reduced ratio z
+ *
+ * @param[in] gx   Gradient along X
+ * @param[in] gy   Gradient along Y
+ * @param[in] unit Scale of the degrees in the result: the result is in [0, 360 * unit]
+ *
+ * @return The angle of the gradient
+ */
+inline float32x4_t atan2_0_360_fast(float32x4_t gx, float32x4_t gy, float unit)
+{
+    const float32x4_t zero    = vdupq_n_f32(0.0f);
+    const float32x4_t epsilon = vdupq_n_f32(1e-9f);
+
+    const float32x4_t abs_gx = vabsq_f32(gx);
+    const float32x4_t abs_gy = vabsq_f32(gy);
+    const float32x4_t tmin   = vminq_f32(abs_gx, abs_gy);
+    const float32x4_t tmax   = vmaxq_f32(abs_gx, abs_gy);
+    const float32x4_t z      = vmulq_f32(tmin, inv(vaddq_f32(tmax, epsilon)));
+
+    /* Compute y = z * (pi/4 + 0.273 - 0.273 * z) in degrees */
+    float32x4_t result = vmlsq_f32(vdupq_n_f32(PI_4 + COEFF_FAST), z, vdupq_n_f32(COEFF_FAST));
+    result             = vmulq_f32(vmulq_f32(result, z), vdupq_n_f32(SCALE_180 * unit));
+
+    /* If z > 1, result = 90 - result */
+    result = vbslq_f32(vcgeq_f32(abs_gx, abs_gy), result, vsubq_f32(vdupq_n_f32(90.0f * unit), result));
+
+    /* Choose correct quadrant */
+    result = vbslq_f32(vcltq_f32(gx, zero), vsubq_f32(vdupq_n_f32(180.0f * unit), result), result);
+    result = vbslq_f32(vcltq_f32(gy, zero), vsubq_f32(vdupq_n_f32(360.0f * unit), result), result);
+
+    return result;
+}
+
+inline float32x4_t invsqrtv(float32x4_t x)
+{
+    float32x4_t sqrt_reciprocal = vrsqrteq_f32(x);
+
+    sqrt_reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, sqrt_reciprocal), sqrt_reciprocal),
+                                sqrt_reciprocal);
+    sqrt_reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, sqrt_reciprocal), sqrt_reciprocal),
+                                sqrt_reciprocal);
+
+    return sqrt_reciprocal;
+}
+
+inline float32x4_t sqrtv(float32x4_t x)
+{
+    float32x4_t res = vdupq_n_f32(0.5f);
+    return vmlaq_f32(res, x, invsqrtv(x));
+}
+
+/** Square root rounded to the nearest integer, from the reciprocal square root estimate refined with a single Newton-Raphson step */
+inline float32x4_t sqrtv_fast(float32x4_t x)
+{
+    float32x4_t sqrt_reciprocal = vrsqrteq_f32(x);
+    sqrt_reciprocal             = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, sqrt_reciprocal), sqrt_reciprocal), sqrt_reciprocal);
+
+    return vmlaq_f32(vdupq_n_f32(0.5f), x, sqrt_reciprocal);
+}
+
+/** L2 magnitude of 8 gradients
+ *
+ * @param[in] input1 Gradients along X
+ * @param[in] input2 Gradients along Y
+ * @param[in] fast   (Optional) Refine the square root with a single Newton-Raphson step instead of two
+ *
+ * @return The magnitudes, saturated to S16
+ */
+inline int16x8_t magnitude_l2(int16x8_t input1, int16x8_t input2, bool fast = false)
+{
+    const int32x4x2_t square_x =
+    {
+        {
+            vmull_s16(vget_low_s16(input1), vget_low_s16(input1)),
+            vmull_s16(vget_high_s16(input1), vget_high_s16(input1))
+        }
+    };
+
+    const int32x4x2_t square_y =
+    {
+        {
+            vmull_s16(vget_low_s16(input2), vget_low_s16(input2)),
+            vmull_s16(vget_high_s16(input2), vget_high_s16(input2))
+        }
+    };
+
+    const uint32x4x2_t sum =
+    {
+        {
+            vaddq_u32(vreinterpretq_u32_s32(square_x.val[0]), vreinterpretq_u32_s32(square_y.val[0])),
+            vaddq_u32(vreinterpretq_u32_s32(square_x.val[1]), vreinterpretq_u32_s32(square_y.val[1]))
+        }
+    };
+
+    const float32x4x2_t res =
+    {
+        {
+            fast ? sqrtv_fast(vcvtq_f32_u32(sum.val[0])) : sqrtv(vcvtq_f32_u32(sum.val[0])),
+            fast ? sqrtv_fast(vcvtq_f32_u32(sum.val[1])) : sqrtv(vcvtq_f32_u32(sum.val[1]))
+        }
+    };
+
+    return vcombine_s16(vqmovn_s32(vcvtq_s32_f32(res.val[0])),
+                        vqmovn_s32(vcvtq_s32_f32(res.val[1])));
+}
+
+inline int16x8_t magnitude_l1(int16x8_t input1, int16x8_t input2)
+{
+    int16x8_t gx_abs = vabsq_s16(input1);
+    int16x8_t gy_abs = vabsq_s16(input2);
+
+    /* Saturating add */
+    return vqaddq_s16(gx_abs, gy_abs);
+}
+
+inline uint8x8_t phase_signed(int16x8_t input1, int16x8_t input2)
+{
+    const float32x4_t zeropointfive = vdupq_n_f32(0.5f);
+
+    float32x4_t inputx_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input1)));
+    float32x4_t inputx_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input1)));
+    float32x4_t inputy_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input2)));
+    float32x4_t inputy_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input2)));
+
+    /* Compute fast atan2 */
+    float32x4_t angle_high = atan2_0_360(inputx_f32_high, inputy_f32_high);
+    float32x4_t angle_low  = atan2_0_360(inputx_f32_low, inputy_f32_low);
+
+    angle_high = vaddq_f32(angle_high, zeropointfive);
+    angle_low  = vaddq_f32(angle_low, zeropointfive);
+
+    return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
+                                  vqmovun_s32(vcvtq_s32_f32(angle_high))));
+}
+
+inline uint8x8_t phase_unsigned(int16x8_t input1, int16x8_t input2)
+{
+    const float32x4_t zeropointfive = vdupq_n_f32(0.5f);
+
+    float32x4_t inputx_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input1)));
+    float32x4_t inputx_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input1)));
+    float32x4_t inputy_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input2)));
+    float32x4_t inputy_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input2)));
+
+    /* Compute fast atan2 */
+    float32x4_t angle_high = atan2_0_180(inputx_f32_high, inputy_f32_high);
+    float32x4_t angle_low  = atan2_0_180(inputx_f32_low, inputy_f32_low);
+
+    angle_high = vaddq_f32(angle_high, zeropointfive);
+    angle_low  = vaddq_f32(angle_low, zeropointfive);
+
+    return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
+                                  vqmovun_s32(vcvtq_s32_f32(angle_high))));
+}
+/** Phase of 8 gradients with @ref atan2_0_360_fast
+ *
+ * @param[in] input1      Gradients along X
+ * @param[in] input2      Gradients along Y
+ * @param[in] is_unsigned True to fold the angles in [0, 180], otherwise they are scaled to [0, 255]
+ *
+ * @return The rounded phases
+ */
+inline uint8x8_t phase_fast(int16x8_t input1, int16x8_t input2, bool is_unsigned)
+{
+    const float32x4_t zeropointfive = vdupq_n_f32(0.5f);
+    const float32x4_t oneeighty     = vdupq_n_f32(180.0f);
+    const float       unit          = is_unsigned ? 1.0f : SCALE_FACTOR;
+
+    float32x4_t angle_high = atan2_0_360_fast(vcvtq_f32_s32(vmovl_s16(vget_high_s16(input1))), vcvtq_f32_s32(vmovl_s16(vget_high_s16(input2))), unit);
+    float32x4_t angle_low  = atan2_0_360_fast(vcvtq_f32_s32(vmovl_s16(vget_low_s16(input1))), vcvtq_f32_s32(vmovl_s16(vget_low_s16(input2))), unit);
+
+    if(is_unsigned)
+    {
+        angle_high = vbslq_f32(vcgtq_f32(angle_high, oneeighty), vsubq_f32(angle_high, oneeighty), angle_high);
+        angle_low  = vbslq_f32(vcgtq_f32(angle_low, oneeighty), vsubq_f32(angle_low, oneeighty), angle_low);
+    }
+
+    angle_high = vaddq_f32(angle_high, zeropointfive);
+    angle_low  = vaddq_f32(angle_low, zeropointfive);
+
+    return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
+                                  vqmovun_s32(vcvtq_s32_f32(angle_high))));
+}
+
+/** Orientation bin of 8 gradients, without computing their angle
+ *
+ * The gradients pointing downwards are first rotated by 180 degrees. A gradient is then past a bin boundary of angle t in [0, 180)
+ * if gy * cos(t) - gx * sin(t) > 0, so its bin is the number of boundaries it is past, plus @p fold_offset if it was rotated.
+ *
+ * @param[in] input1         Gradients along X
+ * @param[in] input2         Gradients along Y
+ * @param[in] boundary_cos   Cosines of the boundaries in (0, 180) degrees, in increasing order of angle
+ * @param[in] boundary_sin   Sines of the boundaries in (0, 180) degrees, in increasing order of angle
+ * @param[in] num_boundaries Number of boundaries
+ * @param[in] fold_offset    Bin offset of the rotated gradients: 0 for unsigned phases, half the number of bins for signed ones
+ *
+ * @return The bins of the gradients
+ */
+inline uint8x8_t phase_bins(int16x8_t input1, int16x8_t input2, const float *boundary_cos, const float *boundary_sin, size_t num_boundaries, uint8_t fold_offset)
+{
+    const int16x8_t zero = vdupq_n_s16(0);
+
+    // Rotate the gradients with gy < 0 (or gy == 0 and gx < 0) so that their angle is in [0, 180)
+    const uint16x8_t is_folded = vorrq_u16(vcltq_s16(input2, zero), vandq_u16(vceqq_s16(input2, zero), vcltq_s16(input1, zero)));
+    const int16x8_t  gx        = vbslq_s16(is_folded, vqnegq_s16(input1), input1);
+    const int16x8_t  gy        = vbslq_s16(is_folded, vqnegq_s16(input2), input2);
+
+    const float32x4_t gx_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(gx)));
+    const float32x4_t gx_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(gx)));
+    const float32x4_t gy_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(gy)));
+    const float32x4_t gy_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(gy)));
+
+    // The comparison masks are all ones: subtracting them counts the boundaries
+    uint32x4_t bin_low  = vdupq_n_u32(0);
+    uint32x4_t bin_high = vdupq_n_u32(0);
+    for(size_t k = 0; k < num_boundaries; ++k)
+    {
+        const float32x4_t cross_low  = vmlsq_n_f32(vmulq_n_f32(gy_low, boundary_cos[k]), gx_low, boundary_sin[k]);
+        const float32x4_t cross_high = vmlsq_n_f32(vmulq_n_f32(gy_high, boundary_cos[k]), gx_high, boundary_sin[k]);
+
+        bin_low  = vsubq_u32(bin_low, vcgtq_f32(cross_low, vdupq_n_f32(0.0f)));
+        bin_high = vsubq_u32(bin_high, vcgtq_f32(cross_high, vdupq_n_f32(0.0f)));
+    }
+
+    const uint16x8_t bin = vcombine_u16(vmovn_u32(bin_low), vmovn_u32(bin_high));
+
+    return vmovn_u16(vaddq_u16(bin, vandq_u16(is_folded, vdupq_n_u16(fold_offset))));
+}
+} // namespace
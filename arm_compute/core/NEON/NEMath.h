@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEMATH_H__
 
 #include <arm_neon.h>
+#include <array>
 
 namespace arm_compute
 {
@@ -43,6 +44,19 @@ const std::array<float32x4_t, 8> exp_tab =
     }
 };
 
+/* Exponent polynomial coefficients of the fast approximation: degree 5 minimax polynomial on [-ln(2),ln(2)] */
+const std::array<float32x4_t, 6> exp_fast_tab =
+{
+    {
+        vdupq_n_f32(1.00000488f),
+        vdupq_n_f32(1.00000419f),
+        vdupq_n_f32(0.499817263f),
+        vdupq_n_f32(0.166611574f),
+        vdupq_n_f32(0.0426776351f),
+        vdupq_n_f32(0.00852583237f),
+    }
+};
+
 /* Logarithm polynomial coefficients */
 const std::array<float32x4_t, 8> log_tab =
 {
@@ -87,6 +101,20 @@ inline float32x4_t vinvq_f32(const float32x4_t &x)
     return recip;
 }
 
+/** Calculate reciprocal with a single Newton-Raphson step.
+ *
+ * @note About 16 bits of precision.
+ *
+ * @param x Input value.
+ *
+ * @return The calculated reciprocal.
+ */
+inline float32x4_t vinvq_fast_f32(const float32x4_t &x)
+{
+    const float32x4_t recip = vrecpeq_f32(x);
+    return vmulq_f32(vrecpsq_f32(x, recip), recip);
+}
+
 /** Perform a 7th degree polynomial approximation using Estrin's method.
  *
  * @param x       Input vector value in F32 format.
@@ -130,6 +158,36 @@ inline float32x4_t vexpq_f32(const float32x4_t &x)
     return poly;
 }
 
+/** Calculate exponential with a lower degree polynomial.
+ *
+ * @note Same range reduction as @ref vexpq_f32, followed by a 5th degree polynomial evaluated with Estrin's method.
+ *
+ * @param x Input vector value in F32 format.
+ *
+ * @return The calculated exponent.
+ */
+inline float32x4_t vexpq_fast_f32(const float32x4_t &x)
+{
+    static const float32x4_t CONST_LN2     = vdupq_n_f32(0.6931471805f); // ln(2)
+    static const float32x4_t CONST_INV_LN2 = vdupq_n_f32(1.4426950408f); // 1/ln(2)
+
+    // Perform range reduction [-log(2),log(2)]
+    int32x4_t   m   = vcvtq_s32_f32(vmulq_f32(x, CONST_INV_LN2));
+    float32x4_t val = vmlsq_f32(x, vcvtq_f32_s32(m), CONST_LN2);
+
+    // Polynomial Approximation
+    const float32x4_t x2   = vmulq_f32(val, val);
+    const float32x4_t A    = vmlaq_f32(exp_fast_tab[0], exp_fast_tab[1], val);
+    const float32x4_t B    = vmlaq_f32(exp_fast_tab[2], exp_fast_tab[3], val);
+    const float32x4_t C    = vmlaq_f32(exp_fast_tab[4], exp_fast_tab[5], val);
+    float32x4_t       poly = vmlaq_f32(A, vmlaq_f32(B, C, x2), x2);
+
+    // Reconstruct
+    poly = vreinterpretq_f32_s32(vaddq_s32(vreinterpretq_s32_f32(poly), vshlq_n_s32(m, 23)));
+
+    return poly;
+}
+
 /** Calculate logarithm
  *
  * @param x Input vector value in F32 format.
@@ -179,6 +237,29 @@ inline float32x4_t vtanhq_f32(const float32x4_t &val)
     return tanh;
 }
 
+/** Calculate hyperbolic tangent with @ref vexpq_fast_f32 and @ref vinvq_fast_f32.
+ *
+ * @note We clamp x to [-5,5] to avoid overflowing issues.
+ *
+ * @param val Input vector value in F32 format.
+ *
+ * @return The calculated Hyperbolic Tangent.
+ */
+inline float32x4_t vtanhq_fast_f32(const float32x4_t &val)
+{
+    static const float32x4_t CONST_1        = vdupq_n_f32(1.f);  // 1.f
+    static const float32x4_t CONST_2        = vdupq_n_f32(2.f);  // 2.f
+    static const float32x4_t CONST_MIN_TANH = vdupq_n_f32(-5.f); // -5.f
+    static const float32x4_t CONST_MAX_TANH = vdupq_n_f32(5.f);  // 5.f
+
+    float32x4_t x     = vminq_f32(vmaxq_f32(val, CONST_MIN_TANH), CONST_MAX_TANH);
+    float32x4_t exp2x = vexpq_fast_f32(vmulq_f32(CONST_2, x));
+    float32x4_t num   = vsubq_f32(exp2x, CONST_1);
+    float32x4_t den   = vaddq_f32(exp2x, CONST_1);
+    float32x4_t tanh  = vmulq_f32(num, vinvq_fast_f32(den));
+    return tanh;
+}
+
 /** Calculate n power of a number.
  *
  * pow(x,n) = e^(n*log(x))
@@ -192,6 +273,53 @@ inline float32x4_t vpowq_f32(const float32x4_t &val, const float32x4_t &n)
 {
     return vexpq_f32(vmulq_f32(n, vlogq_f32(val)));
 }
+
+#ifdef __aarch64__
+/** Load a 256 entries U8 lookup table into NEON registers
+ *
+ * @param lut Pointer to the 256 entries of the table.
+ *
+ * @return The table, split in four blocks of 64 entries.
+ */
+inline std::array<uint8x16x4_t, 4> vld_lut256_u8(const uint8_t *lut)
+{
+    const std::array<uint8x16x4_t, 4> tables =
+    {
+        {
+            { { vld1q_u8(lut), vld1q_u8(lut + 16), vld1q_u8(lut + 32), vld1q_u8(lut + 48) } },
+            { { vld1q_u8(lut + 64), vld1q_u8(lut + 80), vld1q_u8(lut + 96), vld1q_u8(lut + 112) } },
+            { { vld1q_u8(lut + 128), vld1q_u8(lut + 144), vld1q_u8(lut + 160), vld1q_u8(lut + 176) } },
+            { { vld1q_u8(lut + 192), vld1q_u8(lut + 208), vld1q_u8(lut + 224), vld1q_u8(lut + 240) } }
+        }
+    };
+
+    return tables;
+}
+
+/** Look up 16 U8 values in a 256 entries table held in registers
+ *
+ * Each block of 64 entries is looked up with TBL/TBX: indices outside of a block leave the result unchanged.
+ *
+ * @param tables Table returned by @ref vld_lut256_u8.
+ * @param index  Indices to look up.
+ *
+ * @return The 16 entries of the table.
+ */
+inline uint8x16_t vlut256q_u8(const std::array<uint8x16x4_t, 4> &tables, const uint8x16_t &index)
+{
+    const uint8x16_t block_size = vdupq_n_u8(64);
+    uint8x16_t       idx        = index;
+    uint8x16_t       result     = vqtbl4q_u8(tables[0], idx);
+
+    for(size_t i = 1; i < tables.size(); ++i)
+    {
+        idx    = vsubq_u8(idx, block_size);
+        result = vqtbx4q_u8(result, tables[i], idx);
+    }
+
+    return result;
+}
+#endif /* __aarch64__ */
 }
 
 #endif /* __ARM_COMPUTE_NEMATH_H__ */
@@ -24,9 +24,11 @@
 #ifndef __ARM_COMPUTE_NEACCUMULATEKERNEL_H__
 #define __ARM_COMPUTE_NEACCUMULATEKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -118,5 +120,54 @@ public:
 private:
     uint32_t _shift;
 };
+
+/** Interface for the combined accumulate kernel
+ *
+ * Runs @ref NEAccumulateKernel, @ref NEAccumulateWeightedKernel and @ref NEAccumulateSquaredKernel on a batch of frames in a single pass:
+ * each block of pixels of the accumulators is loaded once, updated in registers with the frames in order, and stored once.
+ * The results are the same as running the three kernels frame after frame.
+ *
+ * @note The weighted accumulation is computed in F32.
+ */
+class NEAccumulateCombinedKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEAccumulateCombinedKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAccumulateCombinedKernel(const NEAccumulateCombinedKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEAccumulateCombinedKernel &operator=(const NEAccumulateCombinedKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEAccumulateCombinedKernel(NEAccumulateCombinedKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEAccumulateCombinedKernel &operator=(NEAccumulateCombinedKernel &&) = default;
+    /** Default destructor */
+    ~NEAccumulateCombinedKernel() = default;
+
+    /** Set the input frames, the accumulation tensors and their parameters
+     *
+     * @note At least one of the accumulation tensors must not be nullptr.
+     *
+     * @param[in]     inputs         Source frames, accumulated in order. Data type supported: U8.
+     * @param[in,out] accum          Accumulated tensor. Can be nullptr. Data type supported: S16.
+     * @param[in]     alpha          Scalar value in the range [0.0f, 1.0f] for the weighted accumulation
+     * @param[in,out] accum_weighted Weighted accumulated tensor. Can be nullptr. Data type supported: U8.
+     * @param[in]     shift          Shift value in the range of [0, 15] for the accumulation of squares
+     * @param[in,out] accum_squared  Accumulated squares tensor. Can be nullptr. Data type supported: S16.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *accum, float alpha, ITensor *accum_weighted, uint32_t shift, ITensor *accum_squared);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    std::vector<const ITensor *> _inputs;
+    ITensor                     *_accum;
+    ITensor                     *_accum_weighted;
+    ITensor                     *_accum_squared;
+    float                        _alpha;
+    uint32_t                     _shift;
+};
 }
 #endif /*__ARM_COMPUTE_NEACCUMULATEKERNEL_H__ */
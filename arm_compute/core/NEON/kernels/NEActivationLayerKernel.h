@@ -24,14 +24,14 @@
 #ifndef __ARM_COMPUTE_NEACTIVATIONLAYERKERNEL_H__
 #define __ARM_COMPUTE_NEACTIVATIONLAYERKERNEL_H__
 
-#include "arm_compute/core/NEON/INESimpleKernel.h"
+#include "arm_compute/core/NEON/INEKernel.h"
 
 namespace arm_compute
 {
 class ITensor;
 
 /** Interface for the activation layer kernel. */
-class NEActivationLayerKernel : public INESimpleKernel
+class NEActivationLayerKernel : public INEKernel
 {
 public:
     /** Constructor */
@@ -46,14 +46,22 @@ public:
     NEActivationLayerKernel &operator=(NEActivationLayerKernel &&) = default;
     /** Set the input and output tensor.
      *
-     * @param[in]  input           Source tensor. Data types supported: F32.
-     * @param[out] output          Destination tensor. Data type supported: same as @p input
-     * @param[in]  activation_info Activation layer information.
+     * @note If the output tensor is a nullptr, the activation function will be performed in-place
+     * @note The activation function is applied element-wise, so the tensors can be in any @ref DataLayout as long as @p input and @p output share it.
+     *
+     * @param[in, out] input           Source tensor. In case of @p output tensor = nullptr, this tensor will store the result
+     *                                 of the activation function. Data types supported: U8/F16/F32.
+     *                                 U8 tensors are asymmetric quantized tensors: @p input and @p output must have the same quantization settings,
+     *                                 and only RELU and BOUNDED_RELU are supported.
+     * @param[out]     output          Destination tensor. Data type supported: same as @p input
+     * @param[in]      activation_info Activation layer information.
      */
-    void configure(const ITensor *input, ITensor *output, ActivationLayerInfo activation_info);
+    void configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    KernelCost cost(const Window &window) const override;
 
 private:
     using ActivationFunction = ActivationLayerInfo::ActivationFunction;
@@ -66,12 +74,29 @@ private:
      *
      *  @param[in] window Region on which to execute the kernel
      */
-    template <ActivationLayerInfo::ActivationFunction F>
+    template <ActivationLayerInfo::ActivationFunction F, MathPrecision P>
     void activation(const Window &window);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    /** Function to apply an activation function on a half precision tensor.
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    template <ActivationLayerInfo::ActivationFunction F, MathPrecision P>
+    void activation_f16(const Window &window);
+#endif
+    /** Function to apply a clamp of the quantized values on a quantized tensor.
+     *
+     *  @param[in] window Region on which to execute the kernel
+     */
+    void activation_quantized(const Window &window);
 
 private:
+    ITensor                      *_input;
+    ITensor                      *_output;
     ActivationFunctionExecutorPtr _func;
     ActivationLayerInfo           _act_info;
+    uint8_t                       _min_bound;
+    uint8_t                       _max_bound;
 };
 }
 #endif /*__ARM_COMPUTE_NEACTIVATIONLAYERKERNEL_H__ */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBATCHNORMALIZATIONFOLDKERNEL_H__
+#define __ARM_COMPUTE_NEBATCHNORMALIZATIONFOLDKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to fold a batch normalization into the weights and biases of the convolution which precedes it
+ *
+ * With scale = gamma / sqrt(var + epsilon), one per output feature map:
+ * - folded_weights = weights * scale
+ * - folded_biases  = (biases - mean) * scale + beta
+ */
+class NEBatchNormalizationFoldKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEBatchNormalizationFoldKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchNormalizationFoldKernel(const NEBatchNormalizationFoldKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchNormalizationFoldKernel &operator=(const NEBatchNormalizationFoldKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBatchNormalizationFoldKernel(NEBatchNormalizationFoldKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBatchNormalizationFoldKernel &operator=(NEBatchNormalizationFoldKernel &&) = default;
+    /** Default destructor */
+    ~NEBatchNormalizationFoldKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  weights        Weights of the convolution with dimensions [kernel_x, kernel_y, IFM, OFM]. Can be nullptr to only fold the biases. Data types supported: F32.
+     * @param[in]  biases         Biases of the convolution with dimensions [OFM]. Can be nullptr if the convolution has no biases. Data types supported: Same as @p weights.
+     * @param[in]  mean           Mean values tensor with dimensions [OFM]. Data types supported: F32.
+     * @param[in]  var            Variance values tensor with dimensions [OFM]. Data types supported: Same as @p mean.
+     * @param[in]  beta           Beta values tensor with dimensions [OFM]. Data types supported: Same as @p mean.
+     * @param[in]  gamma          Gamma values tensor with dimensions [OFM]. Data types supported: Same as @p mean.
+     * @param[in]  epsilon        Small value to avoid division with zero.
+     * @param[out] folded_weights Folded weights. Same shape and data type as @p weights, nullptr if @p weights is nullptr.
+     * @param[out] folded_biases  Folded biases with dimensions [OFM]. Data types supported: Same as @p mean.
+     */
+    void configure(const ITensor *weights, const ITensor *biases, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon,
+                   ITensor *folded_weights, ITensor *folded_biases);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor *_weights;
+    const ITensor *_biases;
+    const ITensor *_mean;
+    const ITensor *_var;
+    const ITensor *_beta;
+    const ITensor *_gamma;
+    float          _epsilon;
+    ITensor       *_folded_weights;
+    ITensor       *_folded_biases;
+};
+}
+#endif /*__ARM_COMPUTE_NEBATCHNORMALIZATIONFOLDKERNEL_H__ */
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBLOCKEDLAYOUTKERNEL_H__
+#define __ARM_COMPUTE_NEBLOCKEDLAYOUTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/TensorShape.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to convert a single precision tensor between the planar (@ref DataLayout::NCHW) and the channel-blocked (@ref DataLayout::NCHW4) layouts
+ *
+ * Each row of a block of 4 channels is (de)interleaved with NEON loads and stores and the end of the rows is peeled, so neither tensor needs any padding.
+ * The missing channels of the last block are written as zeros, so that the layers consuming the blocked tensor can process all the blocks alike.
+ *
+ * The kernel also blocks the weights of a convolution for @ref NEDirectConvolutionNCHW4Kernel.
+ */
+class NEBlockedLayoutKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEBlockedLayoutKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBlockedLayoutKernel(const NEBlockedLayoutKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBlockedLayoutKernel &operator=(const NEBlockedLayoutKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEBlockedLayoutKernel(NEBlockedLayoutKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEBlockedLayoutKernel &operator=(NEBlockedLayoutKernel &&) = default;
+    /** Default destructor */
+    ~NEBlockedLayoutKernel() = default;
+    /** Shape of the @ref DataLayout::NCHW4 tensor holding an NCHW tensor
+     *
+     * @param[in] shape Shape of the NCHW tensor [width, height, channels, ...].
+     *
+     * @return The shape [4 * width, height, ceil(channels / 4), ...]
+     */
+    static TensorShape blocked_shape(const TensorShape &shape);
+    /** Shape of the weights blocked by @ref configure_weights()
+     *
+     * @param[in] shape Shape of the weights [kernel_x, kernel_y, IFM, OFM].
+     *
+     * @return The shape [16 * kernel_x, kernel_y, ceil(IFM / 4), ceil(OFM / 4)]
+     */
+    static TensorShape blocked_weights_shape(const TensorShape &shape);
+
+    /** Set the input and output of the kernel.
+     *
+     * The direction of the conversion is given by the data layouts of the tensors: one must be @ref DataLayout::NCHW and the other @ref DataLayout::NCHW4.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[out] output Destination tensor with the shape given by @ref blocked_shape() if it is blocked. Data types supported: Same as @p input.
+     */
+    void configure(const ITensor *input, ITensor *output);
+    /** Set the weights of a convolution to block and the blocked weights.
+     *
+     * The 16 weights at X = 16 * kx of the blocked weights connect a block of 4 input feature maps to a block of 4 output feature maps:
+     * the weight at 16 * kx + 4 * i + o connects the input feature map i to the output feature map o. The missing feature maps have zero weights.
+     *
+     * @param[in]  weights Weights tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data types supported: F32.
+     * @param[out] output  Blocked weights with the shape given by @ref blocked_weights_shape(). Data types supported: Same as @p weights.
+     */
+    void configure_weights(const ITensor *weights, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Interleave the rows of 4 planar channels into a row of the blocked tensor
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void block(const Window &window);
+    /** Deinterleave a row of the blocked tensor into the rows of 4 planar channels
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void unblock(const Window &window);
+    /** Block the rows of the weights
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void block_weights(const Window &window);
+    /** Common signature for all the conversion functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using ConvertFunction = void (NEBlockedLayoutKernel::*)(const Window &window);
+
+    ConvertFunction _func;
+    const ITensor  *_input;
+    ITensor        *_output;
+};
+}
+#endif /*__ARM_COMPUTE_NEBLOCKEDLAYOUTKERNEL_H__ */
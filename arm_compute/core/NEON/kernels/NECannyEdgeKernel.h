@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NECANNYEDGEKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 #include <cstdint>
 
@@ -135,15 +136,16 @@ public:
 private:
     /** Common signature for all the specialised non-maxima suppression functions
      *
+     * @param[in]  top_ptr       Pointer to the previous row of the first input tensor.
      * @param[in]  magnitude_ptr Pointer to the first input tensor.
+     * @param[in]  bottom_ptr    Pointer to the next row of the first input tensor.
      * @param[in]  phase_ptr     Pointer to the second input tensor.
      * @param[out] output_ptr    Pointer to the output tensor
-     * @param[in]  stride_mag    Stride of the magnitude tensor
-     * @param[in]  upper_thr     Upper threshold used for the hysteresis
      * @param[in]  lower_thr     Lower threshold used for the hysteresis
+     * @param[in]  upper_thr     Upper threshold used for the hysteresis
      */
-    using EdgeNonMaxSupprFunction = void(const void *__restrict magnitude_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr, const uint32_t stride_mag, const int32_t upper_thr,
-                                         const int32_t lower_thr);
+    using EdgeNonMaxSupprFunction = void(const void *__restrict top_ptr, const void *__restrict magnitude_ptr, const void *__restrict bottom_ptr, const void *__restrict phase_ptr,
+                                         void *__restrict output_ptr, const int32_t lower_thr, const int32_t upper_thr);
 
     EdgeNonMaxSupprFunction *_func;      /**< Non-Maxima suppression function to use for the particular tensor types passed to configure() */
     const ITensor           *_magnitude; /**< Source tensor - Magnitude */
@@ -153,7 +155,153 @@ private:
     int32_t                  _upper_thr; /**< Upper threshold used for the hysteresis */
 };
 
-/** NEON kernel to perform Edge tracing */
+/** NEON kernel to compute the Sobel gradients, the magnitude, the quantized phase and the non-maxima suppression for Canny Edge in a single pass.
+ *
+ * The rows of the image are streamed: each sub-window keeps the horizontally filtered rows of the separable Sobel filter and the three rows
+ * of magnitude needed by the non-maxima suppression in small buffers, instead of going through full-frame gradient, magnitude and phase tensors.
+ *
+ * @note The output is the same as @ref NESobel3x3, @ref NESobel5x5 or @ref NESobel7x7 followed by @ref NEGradientKernel (or @ref NEGradientFP16Kernel)
+ *       and @ref NEEdgeNonMaxSuppressionKernel, with the border of the magnitude filled using the same border mode.
+ */
+class NEEdgeGradientNonMaxSuppressionKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEEdgeGradientNonMaxSuppressionKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeGradientNonMaxSuppressionKernel(const NEEdgeGradientNonMaxSuppressionKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeGradientNonMaxSuppressionKernel &operator=(const NEEdgeGradientNonMaxSuppressionKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEEdgeGradientNonMaxSuppressionKernel(NEEdgeGradientNonMaxSuppressionKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEEdgeGradientNonMaxSuppressionKernel &operator=(NEEdgeGradientNonMaxSuppressionKernel &&) = default;
+    /** Default destructor */
+    ~NEEdgeGradientNonMaxSuppressionKernel() = default;
+
+    /** Initialise the kernel's source, destination, thresholds, gradient size, normalization type and border mode.
+     *
+     * @param[in]  input                 Source tensor. Data type supported: U8. Its border must be filled if @p border_mode is not UNDEFINED.
+     * @param[out] output                Output tensor. Data type supported: U8. It will be filled with 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[in]  upper_thr             Upper threshold used for the hysteresis
+     * @param[in]  lower_thr             Lower threshold used for the hysteresis
+     * @param[in]  gradient_size         Gradient size (3, 5 or 7)
+     * @param[in]  norm_type             Normalization type. If 1, L1-Norm otherwise L2-Norm
+     * @param[in]  border_mode           Border mode of the input and of the magnitude.
+     * @param[in]  constant_border_value Constant value of the magnitude outside of the image if @p border_mode is CONSTANT.
+     * @param[in]  use_fp16              If true the magnitude and phase are computed as in @ref NEGradientFP16Kernel.
+     */
+    void configure(const ITensor *input, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t gradient_size, int32_t norm_type, BorderMode border_mode, uint8_t constant_border_value,
+                   bool use_fp16);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Run the kernel for the gradient type T (int16_t for a gradient size of 3 or 5, int32_t for 7)
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void run_gradient_non_max(const Window &window);
+
+    /** Same signature as NEGradientKernel::GradientFunction */
+    using GradientFunction = void(const void *__restrict gx_ptr, const void *__restrict gy_ptr, void *__restrict magnitude_ptr, void *__restrict phase_ptr);
+    /** Same signature as NEEdgeNonMaxSuppressionKernel::EdgeNonMaxSupprFunction */
+    using EdgeNonMaxSupprFunction = void(const void *__restrict top_ptr, const void *__restrict magnitude_ptr, const void *__restrict bottom_ptr, const void *__restrict phase_ptr,
+                                         void *__restrict output_ptr, const int32_t lower_thr, const int32_t upper_thr);
+
+    GradientFunction        *_gradient_func;         /**< Magnitude and phase function to use for the gradient size and normalization type */
+    EdgeNonMaxSupprFunction *_non_max_func;          /**< Non-Maxima suppression function to use for the gradient size */
+    const ITensor           *_input;                 /**< Source tensor */
+    ITensor                 *_output;                /**< Destination tensor */
+    int32_t                  _gradient_size;         /**< Gradient size */
+    BorderMode               _border_mode;           /**< Border mode of the input and of the magnitude */
+    uint8_t                  _constant_border_value; /**< Constant value of the magnitude outside of the image */
+    int32_t                  _lower_thr;             /**< Lower threshold used for the hysteresis */
+    int32_t                  _upper_thr;             /**< Upper threshold used for the hysteresis */
+};
+
+/** NEON kernel to initialise the labels of the edge tracing
+ *
+ * The hysteresis is computed by grouping the 8-connected "edge" and "maybe" pixels in disjoint sets (union-find):
+ * the pixel at (x, y) is element 1 + y * width + x of the labels tensor and element 0 is the set of the pixels connected to an "edge" pixel.
+ * This kernel makes each "maybe" pixel a set of its own and adds each "edge" pixel to the set of element 0.
+ *
+ * @note The sets are merged by @ref NEEdgeTraceMergeKernel, then @ref NEEdgeTraceKernel writes the edges.
+ */
+class NEEdgeTraceLabelKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEEdgeTraceLabelKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeTraceLabelKernel(const NEEdgeTraceLabelKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeTraceLabelKernel &operator=(const NEEdgeTraceLabelKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEEdgeTraceLabelKernel(NEEdgeTraceLabelKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEEdgeTraceLabelKernel &operator=(NEEdgeTraceLabelKernel &&) = default;
+    /** Default destructor */
+    ~NEEdgeTraceLabelKernel() = default;
+
+    /** Initialise the kernel's source and labels.
+     *
+     * @param[in]  input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[out] labels 1D tensor of width * height + 1 labels. Data type supported: U32.
+     */
+    void configure(const ITensor *input, ITensor *labels);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor *_input;  /**< Source tensor */
+    ITensor       *_labels; /**< Labels of the pixels */
+};
+
+/** NEON kernel to merge the sets of the 8-connected "edge" and "maybe" pixels
+ *
+ * @note The sets are merged with atomic operations so the rows of the image can be processed in parallel.
+ */
+class NEEdgeTraceMergeKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEEdgeTraceMergeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeTraceMergeKernel(const NEEdgeTraceMergeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEdgeTraceMergeKernel &operator=(const NEEdgeTraceMergeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEEdgeTraceMergeKernel(NEEdgeTraceMergeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEEdgeTraceMergeKernel &operator=(NEEdgeTraceMergeKernel &&) = default;
+    /** Default destructor */
+    ~NEEdgeTraceMergeKernel() = default;
+
+    /** Initialise the kernel's source and labels.
+     *
+     * @param[in]     input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge". Its border must be filled with 0.
+     * @param[in,out] labels 1D tensor of width * height + 1 labels initialised by @ref NEEdgeTraceLabelKernel. Data type supported: U32.
+     */
+    void configure(const ITensor *input, ITensor *labels);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;  /**< Source tensor */
+    ITensor       *_labels; /**< Labels of the pixels */
+};
+
+/** NEON kernel to perform Edge tracing
+ *
+ * A "maybe" pixel is an edge if its set, merged by @ref NEEdgeTraceMergeKernel, contains an "edge" pixel.
+ */
 class NEEdgeTraceKernel : public INEKernel
 {
 public:
@@ -170,21 +318,21 @@ public:
     /** Default constructor */
     ~NEEdgeTraceKernel() = default;
 
-    /** Initialise the kernel's source, destination and border mode.
+    /** Initialise the kernel's source, labels and destination.
      *
-     * @param[in,out] input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge"
-     * @param[in,out] output Destination tensor. Data type supported: U8. Must be initialized to 0 (No edge).
+     * @param[in]     input  Source tensor. Data type supported: U8. Must contain 0 for "no edge", 127 for "maybe", 255 for "edge"
+     * @param[in,out] labels 1D tensor of width * height + 1 labels merged by @ref NEEdgeTraceMergeKernel. Data type supported: U32.
+     * @param[out]    output Destination tensor. Data type supported: U8.
      */
-    void configure(ITensor *input, ITensor *output);
+    void configure(const ITensor *input, ITensor *labels, ITensor *output);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
-    BorderSize border_size() const override;
-    bool       is_parallelisable() const override;
 
 private:
-    ITensor *_input;  /**< Source tensor */
-    ITensor *_output; /**< Destination tensor */
+    const ITensor *_input;  /**< Source tensor */
+    ITensor       *_labels; /**< Labels of the pixels */
+    ITensor       *_output; /**< Destination tensor */
 };
 }
 #endif /* __ARM_COMPUTE_NECANNYEDGEKERNEL_H */
@@ -72,7 +72,6 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
-    bool is_parallelisable() const override;
 
 private:
     /** Combine 3 planes to form a three channel single plane tensor.
@@ -119,7 +118,6 @@ private:
     std::array<uint32_t, 3> _x_subsampling;
     std::array<uint32_t, 3> _y_subsampling;
     unsigned int _num_elems_processed_per_iteration;
-    bool         _is_parallelizable;
 };
 }
 #endif /* __ARM_COMPUTE_NECHANNELCOMBINEKERNEL_H__ */
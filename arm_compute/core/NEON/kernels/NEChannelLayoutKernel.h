@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECHANNELLAYOUTKERNEL_H__
+#define __ARM_COMPUTE_NECHANNELLAYOUTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to convert a tensor between the interleaved (HWC) and planar (CHW) channel layouts
+ *
+ * An interleaved tensor has the shape [C, W, H, ...]: the channels of each pixel are next to each other, as in a camera frame.
+ * A planar tensor has the shape [W, H, C, ...]: each channel is a separate plane, as expected by the convolution layers.
+ *
+ * Each row is converted with NEON (de)interleaving loads and stores for 3 and 4 channels and scalar code otherwise,
+ * the end of the rows is peeled so neither tensor needs any padding.
+ */
+class NEChannelLayoutKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEChannelLayoutKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEChannelLayoutKernel(const NEChannelLayoutKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEChannelLayoutKernel &operator=(const NEChannelLayoutKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEChannelLayoutKernel(NEChannelLayoutKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEChannelLayoutKernel &operator=(NEChannelLayoutKernel &&) = default;
+    /** Default destructor */
+    ~NEChannelLayoutKernel() = default;
+
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input     Source tensor. Data types supported: U8/F32.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  to_planar True to convert an interleaved [C, W, H, ...] input to a planar [W, H, C, ...] output,
+     *                       false to convert a planar input to an interleaved output.
+     */
+    void configure(const ITensor *input, ITensor *output, bool to_planar);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Convert the rows of the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void convert(const Window &window);
+
+    const ITensor *_input;
+    ITensor       *_output;
+    bool           _to_planar;
+};
+}
+#endif /*__ARM_COMPUTE_NECHANNELLAYOUTKERNEL_H__ */
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NECOL2IMKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -47,6 +48,8 @@ class ITensor;
  * a6 & a7 & a8 \\
  * \end{array} \right)
  * @f]
+ *
+ * An activation function can optionally be applied to the values while they are stored, which avoids running a separate @ref NEActivationLayerKernel.
  */
 class NECol2ImKernel : public INEKernel
 {
@@ -70,16 +73,32 @@ public:
      * @param[out] output         The output tensor. 3 lower dimensions represent a single output [width, height, OFM],
      *                            while the rest represent batch of outputs. Data types supported: Same as @p input
      * @param[in]  convolved_dims Output convolved dimensions.
+     * @param[in]  act_info       (Optional) Activation function to apply to the output values. Disabled by default.
      */
-    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims);
+    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
 
 private:
-    const ITensor *_input;
-    ITensor       *_output;
+    /** Common signature for all the specialised col2im functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using Col2ImFunctionPtr = void (NECol2ImKernel::*)(const Window &window);
+    /** Rearrange the columns of the input and optionally apply an activation function.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+    void run_col2im(const Window &window);
+
+    Col2ImFunctionPtr   _func;
+    const ITensor      *_input;
+    ITensor            *_output;
     std::pair<unsigned int, unsigned int> _convolved_dims;
+    ActivationLayerInfo _act_info;
 };
 }
 
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECOLORCONVERTSCALEKERNEL_H__
+#define __ARM_COMPUTE_NECOLORCONVERTSCALEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+using IImage = ITensor;
+
+/** NEON kernel to downscale a RGB image and convert it to NV12 in a single pass
+ *
+ * Each pixel of the output is bilinearly interpolated from the input (The centres of the pixels of both images are aligned),
+ * then converted to YUV with the same equations as @ref NEColorConvertKernel, and the chroma of each 2x2 block is averaged into the UV plane.
+ * The resampled RGB image is never written to memory.
+ *
+ * The kernel neither reads nor writes outside of the valid regions of the images, so the output can be a frame imported without any padding,
+ * for instance a buffer of a video encoder initialised with @ref MultiImage::import_frame.
+ *
+ * @note For scale factors larger than 2 some input pixels don't contribute to the output: low pass filter the input first if aliasing matters.
+ */
+class NEColorConvertScaleKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEColorConvertScaleKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEColorConvertScaleKernel(const NEColorConvertScaleKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEColorConvertScaleKernel &operator=(const NEColorConvertScaleKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEColorConvertScaleKernel(NEColorConvertScaleKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEColorConvertScaleKernel &operator=(NEColorConvertScaleKernel &&) = default;
+    /** Default destructor */
+    ~NEColorConvertScaleKernel() = default;
+
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Source image. Formats supported: RGB888/RGBA8888 (The alpha channel is ignored)
+     * @param[out] output Destination multi-planar image. Formats supported: NV12. Its width and height must be even.
+     */
+    void configure(const IImage *input, IMultiImage *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const IImage         *_input;
+    IMultiImage          *_output;
+    std::vector<uint32_t> _offsets_x0; /**< Byte offsets of the left input neighbours of each output column, padded to a multiple of 16 columns */
+    std::vector<uint32_t> _offsets_x1; /**< Byte offsets of the right input neighbours of each output column, padded to a multiple of 16 columns */
+    std::vector<uint8_t>  _weights_x;  /**< Weights of the right input neighbours of each output column out of 128, padded to a multiple of 16 columns */
+    std::vector<size_t>   _offsets_y0; /**< Byte offsets of the top input neighbours of each output row */
+    std::vector<size_t>   _offsets_y1; /**< Byte offsets of the bottom input neighbours of each output row */
+    std::vector<uint8_t>  _weights_y;  /**< Weights of the bottom input neighbours of each output row out of 128 */
+};
+}
+#endif /*__ARM_COMPUTE_NECOLORCONVERTSCALEKERNEL_H__ */
@@ -66,6 +66,19 @@ public:
      * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
      */
     void configure(const ITensor *input, ITensor *output, const int16_t *conv, uint32_t scale, bool border_undefined);
+    /** Initialise the kernel's input, output and border mode, handling the borders in the kernel itself.
+     *
+     * With @p border_mode REPLICATE or CONSTANT the pixels close to the edges are computed from clamped coordinates or
+     * from @p constant_border_value, so the kernel reports an empty border and neither the input nor the output need any padding.
+     *
+     * @param[in]  input                 Source tensor. Data type supported: U8.
+     * @param[out] output                Destination tensor. Data types supported: U8, S16.
+     * @param[in]  conv                  Convolution matrix to apply to the input tensor.
+     * @param[in]  scale                 Scale of the convolution matrix. If 0 is passed, it will be set to the sum of the coefficients of the convolution or 1 if they add up to 0.
+     * @param[in]  border_mode           Strategy to use for borders.
+     * @param[in]  constant_border_value Constant value to use for borders if border_mode is set to CONSTANT.
+     */
+    void configure(const ITensor *input, ITensor *output, const int16_t *conv, uint32_t scale, BorderMode border_mode, uint8_t constant_border_value);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
@@ -74,10 +87,15 @@ public:
 private:
     template <typename OutputType>
     void convolution(const Window &win);
+    /** Convolve the borders with scalar code and the rest of @p win with @ref convolution */
+    template <typename OutputType>
+    void convolution_with_border(const Window &win);
 
 protected:
     uint32_t _scale;                                             /**< scale of the convolution */
     std::array<int16_t, matrix_size *matrix_size> _convolution;  /**< convolution matrix */
+    BorderMode _border_mode;                                     /**< Border mode handled by the kernel (UNDEFINED if the border is filled outside of the kernel) */
+    uint8_t    _constant_border_value;                           /**< Constant value used for CONSTANT borders */
 };
 
 /** Interface for the kernel which applied a 3x3 convolution to a tensor.*/
@@ -189,6 +207,49 @@ using NESeparableConvolution7x7VertKernel = NESeparableConvolutionVertKernel<7>;
 /** Interface for the kernel which applied a 1x9 vertical convolution to a tensor.*/
 using NESeparableConvolution9x9VertKernel = NESeparableConvolutionVertKernel<9>;
 
+/** Kernel running both passes of a Separable Convolution
+ *
+ * Each sub-window is processed one band of rows at a time: the horizontal pass of a row is stored in a ring of matrix_size
+ * intermediate rows which the vertical pass reads from, so the intermediate results never go back to memory as a full image.
+ */
+template <unsigned int matrix_size>
+class NESeparableConvolutionKernel : public INESimpleKernel
+{
+public:
+    /** Default constructor */
+    NESeparableConvolutionKernel();
+
+    /** Initialise the kernel's input, output and border mode.
+     *
+     * @note The intermediate data type (U16, S16 or S32) is picked by @ref data_type_for_convolution.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor, Data types supported: U8, S16.
+     * @param[in]  conv_row         Horizontal convolution coefficients.
+     * @param[in]  conv_col         Vertical convolution coefficients.
+     * @param[in]  scale            Scale of the convolution matrix
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, const int16_t *conv_row, const int16_t *conv_col, uint32_t scale, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    std::array<int16_t, matrix_size> _conv_row;          /**< Horizontal convolution coefficients */
+    std::array<int16_t, matrix_size> _conv_col;          /**< Vertical convolution coefficients */
+    uint32_t                         _scale;             /**< Convolution's scale */
+    DataType                         _intermediate_type; /**< Data type of the rows produced by the horizontal pass */
+};
+
+/** Interface for the kernel which applied a separable 5x5 convolution to a tensor.*/
+using NESeparableConvolution5x5Kernel = NESeparableConvolutionKernel<5>;
+/** Interface for the kernel which applied a separable 7x7 convolution to a tensor.*/
+using NESeparableConvolution7x7Kernel = NESeparableConvolutionKernel<7>;
+/** Interface for the kernel which applied a separable 9x9 convolution to a tensor.*/
+using NESeparableConvolution9x9Kernel = NESeparableConvolutionKernel<9>;
+
 /****************************************************************************************\
  *                                 Rectangle Convolution                                *
 \****************************************************************************************/
@@ -247,5 +308,48 @@ protected:
         4
     }; /**< Number of supported permutations */
 };
+
+/** Kernel running both passes of a separable convolution on a rectangle matrix
+ *
+ * The same as @ref NESeparableConvolutionKernel, except that the horizontal and the vertical vectors can have different sizes.
+ *
+ * @note Supports combinations of 3,5,7 and 9.
+ */
+class NESeparableConvolutionRectangleKernel : public INESimpleKernel
+{
+public:
+    /** Default constructor */
+    NESeparableConvolutionRectangleKernel();
+
+    /** Initialise the kernel's input, output and border mode.
+     *
+     * @note The intermediate data type (U16, S16 or S32) is picked by @ref data_type_for_convolution.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor, Data types supported: U8, S16.
+     * @param[in]  conv_row         Horizontal convolution coefficients.
+     * @param[in]  width            Number of horizontal coefficients (Number of columns of the matrix)
+     * @param[in]  conv_col         Vertical convolution coefficients.
+     * @param[in]  height           Number of vertical coefficients (Number of rows of the matrix)
+     * @param[in]  scale            Scale of the convolution matrix
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, const int16_t *conv_row, uint32_t width, const int16_t *conv_col, uint32_t height, uint32_t scale, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    static constexpr unsigned int max_matrix_size = 9;
+
+    std::array<int16_t, max_matrix_size> _conv_row;          /**< Horizontal convolution coefficients, padded with zeros */
+    std::array<int16_t, max_matrix_size> _conv_col;          /**< Vertical convolution coefficients, padded with zeros */
+    uint32_t                             _width;             /**< Number of horizontal coefficients */
+    uint32_t                             _height;            /**< Number of vertical coefficients */
+    uint32_t                             _scale;             /**< Convolution's scale */
+    DataType                             _intermediate_type; /**< Data type of the rows produced by the horizontal pass */
+    BorderSize                           _border_size;       /**< Border size */
+};
 }
 #endif /*__ARM_COMPUTE_NECONVOLUTIONKERNEL_H__ */
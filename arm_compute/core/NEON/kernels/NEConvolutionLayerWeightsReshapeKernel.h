@@ -52,6 +52,9 @@ class ITensor;
  * a000 & a001 & a002 & a010 & a011 & a012 & a020 & a021 & a022 & a100 & a101 & a102 & a110 & a111 & a112 & a120 & a121 & a122 \\
  * \end{array} \right)
  * @f]
+ *
+ * If a transpose width W is passed to @ref configure, the linearized kernels are written directly in the layout produced by @ref NEGEMMTranspose1xWKernel:
+ * each row of the output holds the linearized kernels of W consecutive output feature maps, interleaved element by element.
  */
 class NEConvolutionLayerWeightsReshapeKernel : public INEKernel
 {
@@ -71,11 +74,15 @@ public:
 
     /** Set the input and output of the kernel.
      *
-     * @param[in]  input  The input tensor to convert. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data types supported: F32
-     * @param[in]  bias   The shared bias tensor to append. Biases are 1D tensor with dimensions [OFM]. Data types supported: Same as @p input
-     * @param[out] output The output tensor. Should be a 2D Tensor. Data types supported: Same as @p input
+     * @param[in]  input           The input tensor to convert. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM], or [IFM, kernel_x, kernel_y, OFM] if they are NHWC. Data types supported: U8/F16/F32
+     * @param[in]  bias            The shared bias tensor to append. Biases are 1D tensor with dimensions [OFM]. Must be nullptr for U8 weights. Data types supported: Same as @p input
+     * @param[out] output          The output tensor. Should be a 2D Tensor, or a 3D Tensor [OFM / groups, kernel_x * kernel_y * IFM, groups] for a grouped convolution.
+     *                             If @p transpose_width is not 0: [kernel_x * kernel_y * IFM * transpose_width, ceil(OFM / groups / transpose_width), groups].
+     *                             Data types supported: Same as @p input
+     * @param[in]  transpose_width (Optional) Number of output feature maps per row of the 1xW transposed layout written to @p output,
+     *                             as required by the matrix multiplication kernel consuming the weights. The transposition is skipped if 0 (default).
      */
-    void configure(const ITensor *input, const ITensor *bias, ITensor *output);
+    void configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int transpose_width = 0);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
@@ -85,6 +92,7 @@ private:
     const ITensor *_bias;
     ITensor       *_output;
     bool           _has_bias;
+    unsigned int   _transpose_width;
 };
 }
 
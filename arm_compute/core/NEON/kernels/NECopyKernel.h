@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECOPYKERNEL_H__
+#define __ARM_COMPUTE_NECOPYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to copy a tensor to a tensor of the same shape and data type, row by row
+ *
+ * The paddings and the strides of the two tensors can differ. The kernel iterates on whole rows, so it doesn't require any padding
+ * from either tensor: it can copy into and out of the tensors imported from or exported to user buffers.
+ */
+class NECopyKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NECopyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECopyKernel(const NECopyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECopyKernel &operator=(const NECopyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NECopyKernel(NECopyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NECopyKernel &operator=(NECopyKernel &&) = default;
+    /** Default destructor */
+    ~NECopyKernel() = default;
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Source tensor. Data types supported: All
+     * @param[out] output Destination tensor, of the same shape, data type and number of channels as @p input.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    KernelCost cost(const Window &window) const override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_NECOPYKERNEL_H__ */
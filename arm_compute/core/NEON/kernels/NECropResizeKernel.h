@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECROPRESIZEKERNEL_H__
+#define __ARM_COMPUTE_NECROPRESIZEKERNEL_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+using IImage = ITensor;
+
+/** Interface for the kernel to crop detection windows out of an image and resize them into a batch
+ *
+ * Each window is resized with bilinear interpolation to the width and height of the output, and its pixels are normalized
+ * to (pixel - mean) * scale. The interpolation coefficients are computed once per window and column.
+ */
+class NECropResizeKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NECropResizeKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel(const NECropResizeKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECropResizeKernel &operator=(const NECropResizeKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel(NECropResizeKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NECropResizeKernel &operator=(NECropResizeKernel &&) = default;
+    /** Default destructor */
+    ~NECropResizeKernel() = default;
+
+    /** Set the input image, the windows and the output batch.
+     *
+     * @note Only the first windows->num_values() windows are resized at each run, the other outputs are left untouched.
+     *
+     * @param[in]  input   Source image. Formats supported: U8, RGB888.
+     * @param[in]  windows Windows to crop, e.g. the detections of @ref NEHOGMultiDetection. The windows are clamped to the image.
+     * @param[out] output  Destination tensor [width, height, channels, windows->max_num_values()] with 1 channel for U8 images and 3 planar channels for RGB888 images.
+     *                     Data types supported: F32.
+     * @param[in]  mean    Value subtracted from each pixel.
+     * @param[in]  scale   Factor applied to each pixel once the mean is subtracted.
+     */
+    void configure(const IImage *input, const IDetectionWindowArray *windows, ITensor *output, float mean, float scale);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const IImage                *_input;
+    const IDetectionWindowArray *_windows;
+    ITensor                     *_output;
+    float                        _mean;
+    float                        _scale;
+};
+}
+#endif /*__ARM_COMPUTE_NECROPRESIZEKERNEL_H__ */
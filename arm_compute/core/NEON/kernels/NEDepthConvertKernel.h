@@ -56,6 +56,22 @@ public:
      * @param[in]  shift  Value for down/up conversions. Must be 0 <= shift < 8.
      */
     void configure(const ITensor *input, ITensor *output, ConvertPolicy policy, uint32_t shift);
+    /** Set the input and output of the kernel for a conversion from or to a floating point data type
+     *
+     * The output is computed as: output = input * scale + offset, in single precision.
+     *
+     * Valid conversions Input -> Output :
+     *
+     *   - U8 -> F32
+     *   - F16 -> F32
+     *   - F32 -> U8 (rounded to the nearest integer and saturated), F16
+     *
+     * @param[in]  input  The input tensor to convert. Data types supported: U8, F16 or F32.
+     * @param[out] output The output tensor. Data types supported: U8, F16 or F32.
+     * @param[in]  scale  (Optional) Scale applied to the input values. Defaults to 1.
+     * @param[in]  offset (Optional) Offset added to the scaled input values. Defaults to 0.
+     */
+    void configure(const ITensor *input, ITensor *output, float scale = 1.f, float offset = 0.f);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
@@ -63,6 +79,8 @@ public:
 private:
     ConvertPolicy _policy;
     uint32_t      _shift;
+    float         _scale;
+    float         _offset;
 };
 }
 #endif /*__ARM_COMPUTE_NEDEPTHCONVERTKERNEL_H__ */
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to perform a convolution directly on the input tensor, without reshaping it with @ref NEIm2ColKernel.
+ *
+ * Each output row of each output feature map is computed by accumulating the rows of the input feature maps multiplied by the rows of the kernel.
+ * The values outside the input (padding) are implicitly zero: no border needs to be filled.
+ * The biases and an optional activation function are applied while the output is computed.
+ *
+ * @note Supported kernel sizes: 1x1, 3x3 and 5x5. Supported strides: 1 and 2.
+ */
+class NEDirectConvolutionLayerKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEDirectConvolutionLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayerKernel(const NEDirectConvolutionLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionLayerKernel &operator=(const NEDirectConvolutionLayerKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayerKernel(NEDirectConvolutionLayerKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionLayerKernel &operator=(NEDirectConvolutionLayerKernel &&) = default;
+    /** Default destructor */
+    ~NEDirectConvolutionLayerKernel() = default;
+    /** Returns true if the kernel supports the given convolution
+     *
+     * @param[in] kernel_size Size of the (square) convolution kernel.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     *
+     * @return True if the convolution can be run by this kernel.
+     */
+    static bool is_supported(unsigned int kernel_size, const PadStrideInfo &conv_info);
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32.
+     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  (Optional) Activation function applied to the output values. Disabled by default.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    bool is_compute_bound() const override;
+
+private:
+    /** Common signature for all the specialised convolution functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using ConvolutionFunctionPtr = void (NEDirectConvolutionLayerKernel::*)(const Window &window);
+    /** Common signature for the functions applying the activation function to an output row
+     *
+     * @param[in,out] row   Output row.
+     * @param[in]     width Number of elements in the row.
+     * @param[in]     a     Alpha parameter of the activation function.
+     * @param[in]     b     Beta parameter of the activation function.
+     */
+    using ActivationFunctionPtr = void (*)(float *row, int width, float a, float b);
+    /** Compute the output rows of the window.
+     *
+     * @param[in] window Region on which to execute the kernel. The X dimension spans whole rows.
+     */
+    template <unsigned int kernel_size, unsigned int stride>
+    void convolve(const Window &window);
+
+    ConvolutionFunctionPtr _func;
+    ActivationFunctionPtr  _act_func;
+    const ITensor         *_input;
+    const ITensor         *_weights;
+    const ITensor         *_biases;
+    ITensor               *_output;
+    PadStrideInfo          _conv_info;
+    ActivationLayerInfo    _act_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEDIRECTCONVOLUTIONLAYERKERNEL_H__ */
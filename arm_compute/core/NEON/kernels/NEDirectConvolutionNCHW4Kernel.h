@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEDIRECTCONVOLUTIONNCHW4KERNEL_H__
+#define __ARM_COMPUTE_NEDIRECTCONVOLUTIONNCHW4KERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to perform a single precision convolution directly on a channel-blocked (@ref DataLayout::NCHW4) tensor
+ *
+ * A vector of the input holds 4 input feature maps of an element and a vector of the output 4 output feature maps:
+ * each input value is broadcast from its lane and multiplied with the vector of its weights for the 4 output feature maps.
+ * Four output elements are computed at a time away from the borders, so that each vector of weights is loaded once for 4 elements.
+ * The values outside the input (padding) are skipped: no border needs to be filled.
+ * The biases and an optional activation function are applied while the output is computed.
+ *
+ * @note Any square kernel size and any stride are supported.
+ */
+class NEDirectConvolutionNCHW4Kernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEDirectConvolutionNCHW4Kernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionNCHW4Kernel(const NEDirectConvolutionNCHW4Kernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEDirectConvolutionNCHW4Kernel &operator=(const NEDirectConvolutionNCHW4Kernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionNCHW4Kernel(NEDirectConvolutionNCHW4Kernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEDirectConvolutionNCHW4Kernel &operator=(NEDirectConvolutionNCHW4Kernel &&) = default;
+    /** Default destructor */
+    ~NEDirectConvolutionNCHW4Kernel() = default;
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @param[in]  input     Source tensor. NCHW4 tensor with dimensions [4 * width, height, ceil(IFM / 4), batches]. Data types supported: F32.
+     * @param[in]  weights   Weights blocked by @ref NEBlockedLayoutKernel::configure_weights() with dimensions [16 * kernel_x, kernel_y, ceil(IFM / 4), ceil(OFM / 4)].
+     *                       Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. NCHW4 tensor with dimensions [4 * width, height, ceil(OFM / 4), batches]. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  (Optional) Activation function applied to the output values. Disabled by default.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    bool is_compute_bound() const override;
+
+private:
+    /** Common signature for the functions applying the activation function to an output row
+     *
+     * @param[in,out] row   Output row.
+     * @param[in]     width Number of values in the row.
+     * @param[in]     a     Alpha parameter of the activation function.
+     * @param[in]     b     Beta parameter of the activation function.
+     */
+    using ActivationFunctionPtr = void (*)(float *row, int width, float a, float b);
+
+    ActivationFunctionPtr _act_func;
+    const ITensor        *_input;
+    const ITensor        *_weights;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    PadStrideInfo         _conv_info;
+    ActivationLayerInfo   _act_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEDIRECTCONVOLUTIONNCHW4KERNEL_H__ */
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEEQUALIZEHISTOGRAMKERNEL_H__
+#define __ARM_COMPUTE_NEEQUALIZEHISTOGRAMKERNEL_H__
+
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <array>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+
+namespace arm_compute
+{
+class ITensor;
+using IImage = ITensor;
+
+/** Interface for the kernel to equalize the histogram of an image in a single pass of the scheduler
+ *
+ * Each thread computes the histogram of its sub-window, waits for the other threads, then sums up all the
+ * histograms and computes the cumulative distribution and the lookup table on its own (256 bins are cheaper
+ * to recompute than to share) before it maps its sub-window. The histogram of each thread is split in banks
+ * counting interleaved pixels, so that runs of equal pixels don't serialise on the same bin.
+ *
+ * @note The threads wait for each other in run(), therefore the kernel must be run with @ref SchedulingPolicy::STATIC,
+ *       every thread announced to begin_reduction() running exactly one sub-window.
+ */
+class NEEqualizeHistogramKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEEqualizeHistogramKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEqualizeHistogramKernel(const NEEqualizeHistogramKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEEqualizeHistogramKernel &operator=(const NEEqualizeHistogramKernel &) = delete;
+    /** Default destructor */
+    ~NEEqualizeHistogramKernel() = default;
+
+    /** Set the input and output images.
+     *
+     * @param[in]  input  Source image. Data type supported: U8.
+     * @param[out] output Destination image. Data type supported: U8.
+     */
+    void configure(const IImage *input, IImage *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+
+private:
+    /** Block until every thread has computed the histogram of its sub-window */
+    void wait_for_histograms();
+
+    static constexpr unsigned int num_bins{ 256 }; /**< Histogram bins, one per pixel value */
+    static constexpr unsigned int num_banks{ 4 };  /**< Banks of each local histogram */
+
+    const IImage *_input;
+    IImage       *_output;
+    ThreadLocalSlots<std::array<uint32_t, num_banks * num_bins>> _local_hist; /**< Banked histogram of the pixels processed by each thread */
+    unsigned int            _num_threads;                           /**< Number of threads running the kernel */
+    unsigned int            _num_arrived;                           /**< Number of threads done with their histogram */
+    std::mutex              _mutex;                                 /**< Protects @ref _num_arrived */
+    std::condition_variable _all_arrived;                           /**< Signalled once every histogram is ready */
+};
+}
+#endif /*__ARM_COMPUTE_NEEQUALIZEHISTOGRAMKERNEL_H__ */
@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEEXPANDWEIGHTSKERNEL_H__
+#define __ARM_COMPUTE_NEEXPANDWEIGHTSKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to expand weights stored in a smaller data type into single precision
+ *
+ * Result is computed by:
+ * @f[ output(x,y,z,w) = input(x,y,z,w) \times scale + offset @f]
+ *
+ * Each row is processed in one go with a scalar tail, so neither tensor needs any padding: the compact content of a tensor stored
+ * in a @ref ModelFile can be expanded straight into the padded layout of the tensor it was saved from.
+ */
+class NEExpandWeightsKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEExpandWeightsKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEExpandWeightsKernel(const NEExpandWeightsKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEExpandWeightsKernel &operator=(const NEExpandWeightsKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEExpandWeightsKernel(NEExpandWeightsKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEExpandWeightsKernel &operator=(NEExpandWeightsKernel &&) = default;
+    /** Initialise the kernel's input, output and quantization parameters
+     *
+     * @param[in]  input  Stored weights. Data types supported: U8, F16.
+     * @param[out] output Expanded weights. Data type supported: F32. Its shape must be the one of @p input.
+     * @param[in]  scale  (Optional) Scale applied to the input values. Defaults to 1.
+     * @param[in]  offset (Optional) Offset added to the scaled input values. Defaults to 0.
+     */
+    void configure(const ITensor *input, ITensor *output, float scale = 1.f, float offset = 0.f);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor *_input;  /**< Stored weights */
+    ITensor       *_output; /**< Expanded weights */
+    float          _scale;  /**< Scale applied to the stored values */
+    float          _offset; /**< Offset added to the scaled values */
+};
+}
+#endif /* __ARM_COMPUTE_NEEXPANDWEIGHTSKERNEL_H__ */
@@ -24,10 +24,13 @@
 #ifndef __ARM_COMPUTE_NEFASTCORNERSKERNEL_H__
 #define __ARM_COMPUTE_NEFASTCORNERSKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
+#include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -57,16 +60,34 @@ public:
      * @param[in]  border_undefined    True if the border mode is undefined. False if it's replicate or constant.
      */
     void configure(const IImage *input, IImage *output, uint8_t threshold, bool non_max_suppression, bool border_undefined);
+    /** Initialise the kernel to detect the corners, suppress the non-maxima and output the key points in a single pass.
+     *
+     * Each thread scores its rows into a ring of three rows, suppresses the non-maxima of the middle row and appends the
+     * corners to its own list of key points: no score image is needed. The lists are appended to @p corners in raster
+     * order once all the threads are done.
+     *
+     * @note The border mode is undefined: corners are detected 3 pixels away from the edges, 4 with non-maxima suppression.
+     *
+     * @param[in]  input               Source image. Data type supported: U8.
+     * @param[in]  threshold           Threshold on difference between intensity of the central pixel and pixels on Bresenham's circle of radius 3.
+     * @param[in]  non_max_suppression True if non-maxima suppresion is applied, false otherwise.
+     * @param[out] corners             Array of keypoints to store the results.
+     */
+    void configure(const IImage *input, uint8_t threshold, bool non_max_suppression, IKeyPointArray *corners);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
     BorderSize border_size() const override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
-    const IImage *_input;               /**< source image */
-    IImage       *_output;              /**< inermediate results */
-    uint8_t       _threshold;           /**< threshold on difference between intensity */
-    bool          _non_max_suppression; /** true if non-maxima suppression is applied in the next stage */
+    const IImage                           *_input;               /**< source image */
+    IImage                                 *_output;              /**< inermediate results */
+    uint8_t                                 _threshold;           /**< threshold on difference between intensity */
+    bool                                    _non_max_suppression; /** true if non-maxima suppression is applied in the next stage */
+    IKeyPointArray                         *_corners;             /**< Output key points, nullptr if the kernel outputs a score image */
+    ThreadLocalSlots<std::vector<KeyPoint>> _local_corners;       /**< Key points found by each thread */
 };
 }
 #endif
@@ -53,7 +53,7 @@ public:
      *
      * @note This kernel fills the borders within the XY-planes.
      *
-     * @param[in,out] tensor                Tensor to process. Data types supported: U8, S16, S32, F32.
+     * @param[in,out] tensor                Tensor to process. Data types supported: U8, S16, S32, F16, F32. Formats supported: RGB888, RGBA8888 for multi-channel tensors.
      * @param[in]     border_size           Size of the border to fill in elements.
      * @param[in]     border_mode           Border mode to use for the convolution.
      * @param[in]     constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
@@ -61,14 +61,37 @@ public:
      */
     void configure(ITensor *tensor, BorderSize border_size, BorderMode border_mode, const PixelValue &constant_border_value = PixelValue());
 
+    /** Fill the left and right borders of a band of rows of the valid region only, and the top (bottom) border if the band starts (ends) the valid region.
+     *
+     * @note Used to fill the borders of a tensor of which only a few rows are in memory at a time (See @ref NEVisionGraph).
+     *
+     * @param[in] first_row First row of the band, clamped to the valid region.
+     * @param[in] last_row  Row following the last row of the band, clamped to the valid region.
+     */
+    void run_rows(unsigned int first_row, unsigned int last_row);
+
     // Inherited methods overridden:
     void run(const Window &window) override;
 
 private:
+    /** Fill the borders of a band of rows of the valid region
+     *
+     * @param[in] window    Region on which to execute the kernel.
+     * @param[in] first_row First row of the band, relative to the valid region.
+     * @param[in] last_row  Row following the last row of the band. Must not be past the valid region.
+     */
+    void fill_rows(const Window &window, unsigned int first_row, unsigned int last_row);
+    /** Fill the borders of a band of rows of the valid region of a tensor with interleaved U8 channels, a whole pixel at a time
+     *
+     * @param[in] window    Region on which to execute the kernel.
+     * @param[in] first_row First row of the band, relative to the valid region.
+     * @param[in] last_row  Row following the last row of the band. Must not be past the valid region.
+     */
+    void fill_rows_interleaved(const Window &window, unsigned int first_row, unsigned int last_row);
     template <typename T>
-    void fill_replicate_single_channel(const Window &window);
+    void fill_replicate_single_channel(const Window &window, unsigned int first_row, unsigned int last_row);
     template <typename T>
-    void fill_constant_value_single_channel(const Window &window);
+    void fill_constant_value_single_channel(const Window &window, unsigned int first_row, unsigned int last_row);
 
     ITensor   *_tensor;
     BorderSize _border_size;
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__
+#define __ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class TensorInfo;
+
+/** Operations available in the steps of a fused elementwise expression */
+enum class ElementwiseOperation
+{
+    ADD,       /**< Add an operand tensor to the result of the previous steps */
+    MUL,       /**< Multiply the result of the previous steps by an operand tensor */
+    ACTIVATION /**< Apply an activation function to the result of the previous steps */
+};
+
+/** Step of an elementwise expression run by @ref NEFusedElementwiseKernel */
+struct FusedElementwiseStep
+{
+    /** Constructor of an @ref ElementwiseOperation::ADD or @ref ElementwiseOperation::MUL step
+     *
+     * @param[in] operation Operation of the step.
+     * @param[in] tensor    Second operand of the operation.
+     */
+    FusedElementwiseStep(ElementwiseOperation operation, const ITensor *tensor)
+        : op(operation), operand(tensor), act_info()
+    {
+    }
+    /** Constructor of an @ref ElementwiseOperation::ACTIVATION step
+     *
+     * @param[in] activation_info Activation function to apply.
+     */
+    FusedElementwiseStep(ActivationLayerInfo activation_info)
+        : op(ElementwiseOperation::ACTIVATION), operand(nullptr), act_info(activation_info)
+    {
+    }
+
+    ElementwiseOperation op;       /**< Operation of the step */
+    const ITensor       *operand;  /**< Second operand of an ADD or MUL step */
+    ActivationLayerInfo  act_info; /**< Activation function of an ACTIVATION step */
+};
+
+/** Interface for the kernel to run a chain of elementwise additions, multiplications and activation functions in a single pass
+ *
+ * output = step_n(... step_1(input))
+ *
+ * The common chains (Residual connection followed by a rectifier, scale and shift with or without a rectifier) are
+ * specialised at compile time, the other ones are interpreted step by step on each vector.
+ */
+class NEFusedElementwiseKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEFusedElementwiseKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwiseKernel(const NEFusedElementwiseKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFusedElementwiseKernel &operator=(const NEFusedElementwiseKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEFusedElementwiseKernel(NEFusedElementwiseKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEFusedElementwiseKernel &operator=(NEFusedElementwiseKernel &&) = default;
+    /** Default destructor */
+    ~NEFusedElementwiseKernel() = default;
+
+    /** Initialise the kernel's input, steps and output.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[in]  steps  Steps of the expression, applied in order. The operands must have the same shape and data type as @p input.
+     * @param[out] output Destination tensor. Data types supported: same as @p input. Can be @p input or one of the operands.
+     */
+    void configure(const ITensor *input, const std::vector<FusedElementwiseStep> &steps, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Common signature for all the specialised expressions
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[in]  steps  Steps of the expression.
+     * @param[out] output Destination tensor. Data types supported: same as @p input.
+     * @param[in]  window Region on which to execute the kernel.
+     */
+    using FusedFunction = void(const ITensor *input, const std::vector<FusedElementwiseStep> &steps, ITensor *output, const Window &window);
+
+    FusedFunction                    *_func;
+    const ITensor                    *_input;
+    ITensor                          *_output;
+    std::vector<FusedElementwiseStep> _steps;
+    std::vector<const TensorInfo *>   _infos; /**< Info of all the tensors accessed by the kernel, to collapse its window */
+};
+}
+#endif /*__ARM_COMPUTE_NEFUSEDELEMENTWISEKERNEL_H__ */
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMBLOCKEDMATRIXMULTIPLYKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMBLOCKEDMATRIXMULTIPLYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to multiply two input matrices "A" and "B" with a cache-blocked algorithm. All elements of the output matrix will be multiplied by alpha after the matrix multiplication
+ *
+ * The output matrix is computed in blocks of @ref block_m rows by @ref block_n columns: each block is an iteration of the kernel window.
+ * For each block, the K dimension is split in slices of @ref block_k elements. The slices of matrix A and matrix B are packed in
+ * panels of respectively @ref tile_m rows and @ref tile_n columns, zero-padded at the edges of the matrices, so that the micro-kernel
+ * reads them from consecutive memory positions: the panel of matrix B stays in the L1 cache while it is multiplied by the whole block of matrix A, which stays in the L2 cache.
+ * The micro-kernel keeps a tile of @ref tile_m x @ref tile_n elements of the output in registers while it runs through a slice.
+ *
+ * @note Unlike @ref NEGEMMMatrixMultiplyKernel, the input matrices must not be reshaped.
+ * @note When configured with @ref configure_convolution, the kernel computes a 1x1 convolution directly on the input feature maps.
+ */
+class NEGEMMBlockedMatrixMultiplyKernel : public INEKernel
+{
+public:
+#ifdef __aarch64__
+    static constexpr unsigned int tile_m = 8;  /**< Number of rows of the tile of the output computed by the micro-kernel */
+    static constexpr unsigned int tile_n = 12; /**< Number of columns of the tile of the output computed by the micro-kernel */
+#else  /* __aarch64__ */
+    static constexpr unsigned int tile_m = 4; /**< Number of rows of the tile of the output computed by the micro-kernel */
+    static constexpr unsigned int tile_n = 8; /**< Number of columns of the tile of the output computed by the micro-kernel */
+#endif /* __aarch64__ */
+    static constexpr unsigned int block_m = 128; /**< Number of rows of the block of the output computed by one iteration of the kernel window */
+    static constexpr unsigned int block_n = 240; /**< Number of columns of the block of the output computed by one iteration of the kernel window */
+    static constexpr unsigned int block_k = 256; /**< Number of elements of the K dimension packed at once */
+
+    /** Constructor */
+    NEGEMMBlockedMatrixMultiplyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBlockedMatrixMultiplyKernel(const NEGEMMBlockedMatrixMultiplyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMBlockedMatrixMultiplyKernel &operator=(const NEGEMMBlockedMatrixMultiplyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMBlockedMatrixMultiplyKernel(NEGEMMBlockedMatrixMultiplyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMBlockedMatrixMultiplyKernel &operator=(NEGEMMBlockedMatrixMultiplyKernel &&) = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input0 Input tensor containing the Matrix A. Data types supported: F32.
+     * @param[in]  input1 Input tensor containing the Matrix B. Data type supported: same as @p input0
+     * @param[out] output Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[in]  alpha  Weight of the matrix product
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha);
+    /** Initialise the kernel to compute a 1x1 convolution with a stride of 1 and no padding.
+     *
+     * The weights are read as the matrix A [IFM, OFM] and the input feature maps of each batch as the matrix B [width * height, IFM]:
+     * their product is the output feature maps, so the input doesn't need to be reshaped with @ref NEIm2ColKernel.
+     * The rows of the feature maps can be padded.
+     *
+     * @param[in]  weights  Weights tensor with dimensions [1, 1, IFM, OFM]. Data types supported: F32.
+     * @param[in]  input    Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                      while the optional 4th dimension represents a batch of inputs. Data type supported: same as @p weights.
+     * @param[in]  biases   Biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p weights.
+     * @param[out] output   Destination tensor with dimensions [width, height, OFM, batches]. Data type supported: same as @p weights.
+     * @param[in]  act_info (Optional) Activation function applied to the output values while they are stored. Disabled by default.
+     */
+    void configure_convolution(const ITensor *weights, const ITensor *input, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    bool is_compute_bound() const override;
+
+private:
+    /** Common signature for the functions applying the activation function to 4 output values
+     *
+     * @param[in] x Output values.
+     * @param[in] a Alpha parameter of the activation function.
+     * @param[in] b Beta parameter of the activation function.
+     *
+     * @return The activated values.
+     */
+    using ActivationFunctionPtr = float32x4_t (*)(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b);
+    /** Return the function applying an activation function to 4 output values
+     *
+     * @param[in] act Activation function.
+     *
+     * @return Pointer to the function
+     */
+    static ActivationFunctionPtr activation_function(ActivationLayerInfo::ActivationFunction act);
+
+    const ITensor        *_input0;
+    const ITensor        *_input1;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    float                 _alpha;
+    bool                  _is_convolution_output;
+    ActivationFunctionPtr _act_func;
+    ActivationLayerInfo   _act_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMBLOCKEDMATRIXMULTIPLYKERNEL_H__*/
@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
@@ -38,9 +39,17 @@ class ITensor;
  *  -# Convert a values from uint8 to int32 and add a_offset to each of them.
  *  -# Convert b values from uint8 to int32 and add b_offset to each of them.
  *  -# Compute the int32 matrix product of the resulting a * b.
- *  -# Add output_offset to each entry of the result.
- *  -# Multiply each entry of the result and round to the nearest integer
+ *  -# Add the optional int32 biases and output_offset to each entry of the result.
+ *  -# Multiply each entry of the result by output_mult_int, shift it right by shift bits and round it to the nearest integer.
+ *     The product is computed in 64 bits so that output_mult_int can hold a 31 bits fixed point multiplier (see @ref quantize_multiplier).
+ *  -# Add result_offset to each entry, usually the offset of the output quantization.
  *  -# Clamp the resulting int32 values to the [0..255] range and cast to uint8.
+ *  -# Clamp the uint8 values to the range of the optional fused activation function (see @ref quantized_activation_bounds).
+ *
+ * @note When configured with @ref configure_convolution, the product is stored directly in the 3D output of a quantized convolution layer
+ *
+ * @note When the library is built with dotprod=1 and the CPU supports the dot product instructions of ARMv8.2-A,
+ *       the kernel runs the paths of @ref dotprod instead, which read the same reshaped matrices.
  *
  */
 class NEGEMMLowpMatrixMultiplyKernel : public INEKernel
@@ -69,20 +78,74 @@ public:
      * @param[in]  output_offset   Offset to be added to each element of the output matrix
      * @param[in]  output_mult_int Value to be multipied to each entry of the result.
      * @param[in]  shift           Number of bits to shift right the result.
+     * @param[in]  biases          (Optional) Biases tensor. Biases are 1D tensor with one entry per column of the output. Can be nullptr. Data type supported: S32
+     * @param[in]  act_info        (Optional) Activation function applied to the output values, in the quantization settings of @p output. Disabled by default.
+     * @param[in]  result_offset   (Optional) Offset to be added to each element of the result after the multiplication and the shift. 0 by default.
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift,
+                   const ITensor *biases = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo(), int32_t result_offset = 0);
+    /** Initialise the kernel to compute a quantized convolution layer, storing the product directly in the output of the layer.
+     *
+     * The matrix A holds the weights: one row per output feature map. The matrix B holds the im2col reshaped input: one column per output element.
+     * For a grouped convolution the 3rd dimension of both matrices is the number of groups: the product of each pair of planes computes
+     * its own share of the output feature maps.
+     *
+     * @param[in]  input0          Input tensor containing the weights reshaped by @ref NEConvolutionLayerWeightsReshapeKernel in the 1xW transposed layout (See @ref convolution_weights_transpose_width):
+     *                             this is the layout of the interleaved Matrix A. Data types supported: U8.
+     * @param[in]  input1          Input tensor containing the output of @ref NEIm2ColKernel written in the interleaved layout:
+     *                             this is the layout of the transposed Matrix B. Data type supported: same as @p input0
+     * @param[in]  biases          Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: S32
+     * @param[out] output          Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                             Data type supported: same as @p input0.
+     * @param[in]  a_offset        Offset to be added to each element of the matrix A.
+     * @param[in]  b_offset        Offset to be added to each element of the matrix B.
+     * @param[in]  output_offset   Offset to be added to each element of the output matrix
+     * @param[in]  output_mult_int Value to be multipied to each entry of the result.
+     * @param[in]  shift           Number of bits to shift right the result.
+     * @param[in]  act_info        (Optional) Activation function applied to the output values, in the quantization settings of @p output. Disabled by default.
+     * @param[in]  result_offset   (Optional) Offset to be added to each element of the result after the multiplication and the shift. 0 by default.
      */
-    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift);
+    void configure_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, int32_t a_offset, int32_t b_offset, int32_t output_offset,
+                               int32_t output_mult_int, int32_t shift, const ActivationLayerInfo &act_info = ActivationLayerInfo(), int32_t result_offset = 0);
+    /** Number of output feature maps per row of the 1xW transposed weights read by @ref configure_convolution
+     *
+     * @return The transpose width to pass to @ref NEConvolutionLayerWeightsReshapeKernel::configure
+     */
+    static unsigned int convolution_weights_transpose_width();
     // Inherited methods overridden:
     void run(const Window &window) override;
 
 private:
+    /** Compute the 4x4 blocks of a matrix product stored in a 2D output matrix
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void run_matrix(const Window &window);
+    /** Compute the 4x16 blocks of a convolution stored in the output feature maps
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void run_convolution(const Window &window);
+    /** Compute the product with the dot product instructions, either stored in a 2D output matrix or in the output feature maps
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    void run_dot_product(const Window &window);
+
     const ITensor *_input0;
     const ITensor *_input1;
+    const ITensor *_biases;
     ITensor       *_output;
     int32_t        _a_offset;
     int32_t        _b_offset;
     int32_t        _output_offset;
     int32_t        _output_mult_int;
     int32_t        _shift;
+    int32_t        _result_offset;
+    uint8_t        _min_bound;
+    uint8_t        _max_bound;
+    bool           _is_convolution_output;
+    bool           _use_dot_product;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMMLOWPMATRIXMULTIPLYKERNEL_H__*/
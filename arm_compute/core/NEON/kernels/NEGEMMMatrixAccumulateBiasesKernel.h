@@ -25,11 +25,12 @@
 #define __ARM_COMPUTE_NEGEMMMATRIXACCUMULATEBIASESKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
 
 namespace arm_compute
 {
 class ITensor;
-/** NEON kernel to add a bias to each row of the input tensor */
+/** NEON kernel to add a bias to each row of the input tensor and optionally apply an activation function to the result */
 class NEGEMMMatrixAccumulateBiasesKernel : public INEKernel
 {
 public:
@@ -47,17 +48,41 @@ public:
     ~NEGEMMMatrixAccumulateBiasesKernel() = default;
     /** Set the accumulate buffer and the biases of the kernel.
      *
-     * @param[in, out] accum  The accumulate tensor to convert. Data type supported: F32
-     * @param[in]      biases The shared biases tensor to append. It must be 1D Tensor. Data type supported: Same as @p input
+     * @param[in, out] accum    The accumulate tensor to convert. Data type supported: F16/F32
+     * @param[in]      biases   The shared biases tensor to append. It must be 1D Tensor. Data type supported: Same as @p input
+     * @param[in]      act_info (Optional) Activation function to apply after the biases have been added. Disabled by default.
      */
-    void configure(ITensor *accum, const ITensor *biases);
+    void configure(ITensor *accum, const ITensor *biases, const ActivationLayerInfo &act_info = ActivationLayerInfo());
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    KernelCost cost(const Window &window) const override;
 
 private:
-    ITensor       *_accum;
-    const ITensor *_biases;
+    /** Common signature for all the specialised accumulate functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using AccumulateBiasesFunctionPtr = void (NEGEMMMatrixAccumulateBiasesKernel::*)(const Window &window);
+    /** Add the biases and optionally apply an activation function.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+    void accumulate_biases(const Window &window);
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    /** Add the biases and optionally apply an activation function to a half precision tensor.
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+    void accumulate_biases_f16(const Window &window);
+#endif
+
+    AccumulateBiasesFunctionPtr _func;
+    ITensor                    *_accum;
+    const ITensor              *_biases;
+    ActivationLayerInfo         _act_info;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMMMATRIXACCUMULATEBIASESKERNEL_H__ */
@@ -25,6 +25,9 @@
 #define __ARM_COMPUTE_NEGEMMMATRIXMULTIPLYKERNEL_H__
 
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <arm_neon.h>
 
 namespace arm_compute
 {
@@ -34,6 +37,8 @@ class ITensor;
  *
  * @note If the output tensor is a matrix, the implementation assumes that the input tensors @p input0 and @p input1 are both matrices and reshaped respectively with @ref NEGEMMInterleave4x4Kernel" and @ref NEGEMMTranspose1xWKernel
  * @note If the output tensor is a vector and the data type is F32, the implementation assumes that the first input tensor @p input0 is a vector and the second input tensor @p input1 a matrix. The implementation also assumes that both tensors have not been reshaped
+ * @note When configured with @ref configure_convolution, the product is stored directly in the 3D output of a convolution layer
+ * @note If @ref is_fp16_storage_only, the F16 matrices are multiplied by the single precision implementation: the values are converted to F32 in registers
  *
  */
 class NEGEMMMatrixMultiplyKernel : public INEKernel
@@ -54,22 +59,80 @@ public:
      * @note If the output tensor is a matrix, the input matrices @p input0 and @p input1 should be the output of the kernels: @ref NEGEMMInterleave4x4Kernel and @ref NEGEMMTranspose1xWKernel
      *       These two kernels change the layout of the original matrices to be more cache-friendly.
      *
-     * @param[in]  input0 Input tensor containing the interleaved Matrix A or the vector A. Data types supported: F32, F16.
-     * @param[in]  input1 Input tensor containing the transposed Matrix B if the first input tensor A is not a vector.
-     *                    If the output tensor is a vector, input1 must contain the matrix B not reshaped. Data type supported: same as @p input0
-     * @param[out] output Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
-     * @param[in]  alpha  Weight of the matrix product
+     * @param[in]  input0   Input tensor containing the interleaved Matrix A or the vector A. Data types supported: F32, F16.
+     * @param[in]  input1   Input tensor containing the transposed Matrix B if the first input tensor A is not a vector.
+     *                      If the output tensor is a vector, input1 must contain the matrix B not reshaped. Data type supported: same as @p input0
+     * @param[out] output   Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[in]  alpha    Weight of the matrix product
+     * @param[in]  biases   (Optional) Biases tensor, weighted by @p beta and added to the output after the product has been weighted by @p alpha.
+     *                      Biases are either a row vector with one element per column of the output, added to each row of the output, or a matrix with the same shape as the output.
+     *                      Data type supported: same as @p input0. Not supported by the vector-matrix multiplication.
+     * @param[in]  act_info (Optional) Activation function applied to the output values: the biases and the activation function are applied in single precision
+     *                      while the output is still in registers. Disabled by default. Not supported by the vector-matrix multiplication.
+     * @param[in]  beta     (Optional) Weight of the biases. Ignored if @p biases is nullptr.
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha, const ITensor *biases = nullptr, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   float beta = 1.f);
+    /** Initialise the kernel to compute a convolution layer, storing the product directly in the output of the layer.
+     *
+     * The matrix A holds the weights: one row per output feature map. The matrix B holds the im2col reshaped input: one column per output element.
+     * Each 4x4 block (8x4 for F16, unless @ref is_fp16_storage_only) of the product is stored in a row of the output feature map, after the biases and the activation function are applied.
+     * The biases and the activation function are applied in single precision.
+     * For a grouped convolution the 3rd dimension of both matrices is the number of groups: the product of each pair of planes computes
+     * its own share of the output feature maps.
+     *
+     * @param[in]  input0   Input tensor containing the weights reshaped by @ref NEConvolutionLayerWeightsReshapeKernel in the 1xW transposed layout (See @ref convolution_weights_transpose_width):
+     *                      this is the layout of the interleaved Matrix A, with 4 rows per block for F32 and 8 rows per block for F16 (4 if @ref is_fp16_storage_only). Data types supported: F16/F32.
+     * @param[in]  input1   Input tensor containing the output of @ref NEIm2ColKernel written in the interleaved layout:
+     *                      this is the layout of the transposed Matrix B. Data type supported: same as @p input0
+     * @param[in]  biases   Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: same as @p input0
+     * @param[out] output   Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                      The output can also be an NHWC tensor [OFM, width, height, batches] (See @ref DataLayout) in single precision.
+     *                      Data type supported: same as @p input0.
+     * @param[in]  act_info (Optional) Activation function applied to the output values. Disabled by default.
+     */
+    void configure_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Number of output feature maps per row of the 1xW transposed weights read by @ref configure_convolution
+     *
+     * @param[in] data_type Data type of the weights. Data types supported: F16/F32.
+     *
+     * @return The transpose width to pass to @ref NEConvolutionLayerWeightsReshapeKernel::configure
      */
-    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha);
+    static unsigned int convolution_weights_transpose_width(DataType data_type);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    unsigned int split_parts_x(unsigned int num_parts) const override;
+    bool is_compute_bound() const override;
 
 private:
-    const ITensor *_input0;
-    const ITensor *_input1;
-    ITensor       *_output;
-    float          _alpha;
+    /** Common signature for the functions applying the activation function to 4 output values
+     *
+     * @param[in] x Output values.
+     * @param[in] a Alpha parameter of the activation function.
+     * @param[in] b Beta parameter of the activation function.
+     *
+     * @return The activated values.
+     */
+    using ActivationFunctionPtr = float32x4_t (*)(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b);
+    /** Return the function applying an activation function to 4 output values
+     *
+     * @param[in] act Activation function.
+     *
+     * @return Pointer to the function
+     */
+    static ActivationFunctionPtr activation_function(ActivationLayerInfo::ActivationFunction act);
+
+    const ITensor        *_input0;
+    const ITensor        *_input1;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    float                 _alpha;
+    float                 _beta;
+    bool                  _is_convolution_output;
+    ActivationFunctionPtr _act_func;
+    ActivationLayerInfo   _act_info;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMMMATRIXMULTIPLYKERNEL_H__*/
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMMATRIXVECTORMULTIPLYKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMMATRIXVECTORMULTIPLYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to multiply a vector "A" by a matrix "B" which has been reshaped by @ref NEGEMMTranspose1xWKernel
+ *
+ * The reshaped matrix B stores the columns of matrix B in blocks of 4: each block is a row of the reshaped matrix, so that the kernel reads
+ * the weights of 4 columns from consecutive memory positions. Each iteration of the kernel window computes @ref num_elems_processed_per_iteration
+ * elements of the output: the window is split in contiguous ranges of columns among the threads, so every thread streams its own part of matrix B exactly once.
+ *
+ * The optional biases are added and the activation function is applied before the output is stored.
+ *
+ * Matrix B can be quantized in U8 with one scale per column to read 4 times less memory: the weights are converted to single precision in registers
+ * and the results are dequantized with the zero point of matrix B and the scales of their columns before the biases are added.
+ *
+ * @note The kernel is bound by the memory bandwidth: the weights are prefetched and the products are accumulated in independent registers to hide the latency of the loads.
+ */
+class NEGEMMMatrixVectorMultiplyKernel : public INEKernel
+{
+public:
+    static constexpr unsigned int num_elems_processed_per_iteration = 16; /**< Number of elements of the output computed by one iteration of the kernel window */
+
+    /** Constructor */
+    NEGEMMMatrixVectorMultiplyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMMatrixVectorMultiplyKernel(const NEGEMMMatrixVectorMultiplyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMMatrixVectorMultiplyKernel &operator=(const NEGEMMMatrixVectorMultiplyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMMatrixVectorMultiplyKernel(NEGEMMMatrixVectorMultiplyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMMatrixVectorMultiplyKernel &operator=(NEGEMMMatrixVectorMultiplyKernel &&) = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input0   Input tensor containing the vector A of K elements. Data types supported: F32.
+     * @param[in]  input1   Input tensor containing the matrix B of K rows and N columns, reshaped by @ref NEGEMMTranspose1xWKernel: [K * 4, ceil(N / 4)].
+     *                      Data type supported: same as @p input0, U8. U8 elements are dequantized as scale * (value - offset), where offset is the offset
+     *                      of the quantization settings of @p input1 (see @ref TensorInfo::quantization_info()).
+     * @param[in]  biases   Biases tensor. Biases are 1D tensor with dimensions [N]. Can be nullptr. Data type supported: same as @p input0
+     * @param[out] output   Output tensor to store the vector of N elements. Data type supported: same as @p input0.
+     * @param[in]  act_info (Optional) Activation function applied to the output values. Disabled by default.
+     * @param[in]  scales   (Optional) Scales of the columns of matrix B: 1D tensor with dimensions [N]. Required if @p input1 is U8, must be nullptr otherwise.
+     *                      Data type supported: same as @p input0
+     */
+    void configure(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   const ITensor *scales = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Common signature for the functions applying the activation function to 4 output values
+     *
+     * @param[in] x Output values.
+     * @param[in] a Alpha parameter of the activation function.
+     * @param[in] b Beta parameter of the activation function.
+     *
+     * @return The activated values.
+     */
+    using ActivationFunctionPtr = float32x4_t (*)(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b);
+
+    const ITensor        *_input0;
+    const ITensor        *_input1;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    const ITensor        *_scales;
+    ActivationFunctionPtr _act_func;
+    ActivationLayerInfo   _act_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMMATRIXVECTORMULTIPLYKERNEL_H__*/
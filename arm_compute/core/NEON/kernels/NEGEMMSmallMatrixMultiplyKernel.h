@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMSMALLMATRIXMULTIPLYKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMSMALLMATRIXMULTIPLYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to multiply two small input matrices "A" and "B" without reshaping them. All elements of the output matrix will be multiplied by alpha after the matrix multiplication
+ *
+ * Each iteration of the kernel window computes a block of @ref block_m rows by @ref block_n columns of the output over the whole K dimension:
+ * the elements of matrix A are broadcast from their rows and the rows of matrix B are read 16 columns at a time.
+ * The blocks at the edges of the output are computed from the rows and the columns of the matrices which exist, so the tensors don't need any padding.
+ *
+ * The optional matrix C, weighted by beta, is added while the block of the output is still in registers.
+ *
+ * @note Unlike @ref NEGEMMMatrixMultiplyKernel, the input matrices must not be reshaped: the kernel is faster than the reshaping kernels
+ *       followed by @ref NEGEMMMatrixMultiplyKernel when one of the dimensions of the multiplication is small (See @ref GEMMSmallThresholds).
+ */
+class NEGEMMSmallMatrixMultiplyKernel : public INEKernel
+{
+public:
+    static constexpr unsigned int block_m = 4;  /**< Number of rows of the block of the output computed by one iteration of the kernel window */
+    static constexpr unsigned int block_n = 16; /**< Number of columns of the block of the output computed by one iteration of the kernel window */
+
+    /** Constructor */
+    NEGEMMSmallMatrixMultiplyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSmallMatrixMultiplyKernel(const NEGEMMSmallMatrixMultiplyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSmallMatrixMultiplyKernel &operator=(const NEGEMMSmallMatrixMultiplyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMSmallMatrixMultiplyKernel(NEGEMMSmallMatrixMultiplyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMSmallMatrixMultiplyKernel &operator=(NEGEMMSmallMatrixMultiplyKernel &&) = default;
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input0 Input tensor containing the Matrix A. Data types supported: F32.
+     * @param[in]  input1 Input tensor containing the Matrix B. Data type supported: same as @p input0
+     * @param[out] output Output tensor to store the result of matrix multiplication. Data type supported: same as @p input0.
+     * @param[in]  alpha  Weight of the matrix product
+     * @param[in]  input2 (Optional) Matrix C, weighted by @p beta and added to the output after the product has been weighted by @p alpha.
+     *                    Either a row vector with one element per column of the output, added to each row of the output, or a matrix with the same shape as the output.
+     *                    Data type supported: same as @p input0
+     * @param[in]  beta   (Optional) Weight of matrix C. Ignored if @p input2 is nullptr.
+     */
+    void configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha, const ITensor *input2 = nullptr, float beta = 1.f);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    bool is_compute_bound() const override;
+
+private:
+    const ITensor *_input0;
+    const ITensor *_input1;
+    const ITensor *_input2;
+    ITensor       *_output;
+    float          _alpha;
+    float          _beta;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMSMALLMATRIXMULTIPLYKERNEL_H__*/
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMSPARSEMATRIXVECTORMULTIPLYKERNEL_H__
+#define __ARM_COMPUTE_NEGEMMSPARSEMATRIXVECTORMULTIPLYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to multiply a vector "A" by a block sparse matrix "B"
+ *
+ * Matrix B is stored in the block compressed sparse row format of @ref BlockSparseMatrix: each row of the format holds the stored 1x4 blocks of
+ * 4 consecutive columns of matrix B, and each block contributes to the 4 output values of its row with a single vector multiply-accumulate.
+ * Each iteration of the kernel window computes the 4 output values of one row.
+ *
+ * The optional biases are added and the activation function is applied before the output is stored.
+ *
+ * @note The rows hold different numbers of blocks: the window is distributed dynamically among the threads (See @ref SchedulingPolicy::DYNAMIC).
+ */
+class NEGEMMSparseMatrixVectorMultiplyKernel : public INEKernel
+{
+public:
+    static constexpr unsigned int num_elems_processed_per_iteration = 4; /**< Number of elements of the output computed by one iteration of the kernel window */
+
+    /** Constructor */
+    NEGEMMSparseMatrixVectorMultiplyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSparseMatrixVectorMultiplyKernel(const NEGEMMSparseMatrixVectorMultiplyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMMSparseMatrixVectorMultiplyKernel &operator=(const NEGEMMSparseMatrixVectorMultiplyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGEMMSparseMatrixVectorMultiplyKernel(NEGEMMSparseMatrixVectorMultiplyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGEMMSparseMatrixVectorMultiplyKernel &operator=(NEGEMMSparseMatrixVectorMultiplyKernel &&) = default;
+    /** Initialise the kernel's inputs and output.
+     *
+     * @param[in]  input0   Input tensor containing the vector A of K elements. Data types supported: F32.
+     * @param[in]  values   Weights of the stored blocks of matrix B: [4, num_blocks]. Data type supported: same as @p input0
+     * @param[in]  indices  Index in vector A of each stored block: [num_blocks]. Data type supported: S32.
+     * @param[in]  offsets  Index of the first stored block of each row of 4 columns, followed by num_blocks: [ceil(N / 4) + 1]. Data type supported: S32.
+     * @param[in]  biases   Biases tensor. Biases are 1D tensor with dimensions [N]. Can be nullptr. Data type supported: same as @p input0
+     * @param[out] output   Output tensor to store the vector of N elements. Data type supported: same as @p input0.
+     * @param[in]  act_info (Optional) Activation function applied to the output values. Disabled by default.
+     */
+    void configure(const ITensor *input0, const ITensor *values, const ITensor *indices, const ITensor *offsets, const ITensor *biases, ITensor *output,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+
+private:
+    /** Common signature for the functions applying the activation function to 4 output values
+     *
+     * @param[in] x Output values.
+     * @param[in] a Alpha parameter of the activation function.
+     * @param[in] b Beta parameter of the activation function.
+     *
+     * @return The activated values.
+     */
+    using ActivationFunctionPtr = float32x4_t (*)(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b);
+
+    const ITensor        *_input0;
+    const ITensor        *_values;
+    const ITensor        *_indices;
+    const ITensor        *_offsets;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    ActivationFunctionPtr _act_func;
+    ActivationLayerInfo   _act_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEGEMMSPARSEMATRIXVECTORMULTIPLYKERNEL_H__*/
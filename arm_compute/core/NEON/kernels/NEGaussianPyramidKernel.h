@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 #define __ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
 namespace arm_compute
@@ -96,5 +97,46 @@ public:
 private:
     int _t2_load_offset;
 };
+
+/** NEON kernel to perform a GaussianPyramid (horizontal and vertical passes fused)
+ *
+ * Computes the same result as @ref NEGaussianPyramidHorKernel followed by @ref NEGaussianPyramidVertKernel without the S16 intermediate tensor:
+ * the horizontally reduced rows are kept in a ring buffer of 5 lines, each output row consumes 2 new input rows while the other 3 are still in cache.
+ */
+class NEGaussianPyramidHalfKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEGaussianPyramidHalfKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidHalfKernel(const NEGaussianPyramidHalfKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGaussianPyramidHalfKernel &operator=(const NEGaussianPyramidHalfKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidHalfKernel(NEGaussianPyramidHalfKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEGaussianPyramidHalfKernel &operator=(NEGaussianPyramidHalfKernel &&) = default;
+    /** Default destructor */
+    ~NEGaussianPyramidHalfKernel() = default;
+
+    /** Initialise the kernel's source, destination and border mode.
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8.
+     * @param[out] output           Destination tensor, half the width and height of the source. Data type supported: U8.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    BorderSize     _border_size;
+    int            _l2_load_offset;
+    int            _t2_load_offset;
+};
 }
 #endif /*__ARM_COMPUTE_NEGAUSSIANPYRAMIDKERNEL_H__ */
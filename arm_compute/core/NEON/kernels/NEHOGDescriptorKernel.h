@@ -87,6 +87,67 @@ private:
     float          _phase_scale;
 };
 
+/** NEON kernel to compute the gradient of the input image and perform HOG Orientation Binning in a single pass
+ *
+ * It produces the same HOG space as @ref NEHOGGradient followed by @ref NEHOGOrientationBinningKernel, but the magnitude and phase
+ * of the gradient are only computed for one cell at a time in a local buffer, so the full size magnitude and phase tensors are never written.
+ *
+ * @note The border of the input image must be filled before running the kernel if the border mode is not UNDEFINED. (See @ref border_size())
+ */
+class NEHOGGradientOrientationBinningKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEHOGGradientOrientationBinningKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHOGGradientOrientationBinningKernel(const NEHOGGradientOrientationBinningKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHOGGradientOrientationBinningKernel &operator=(const NEHOGGradientOrientationBinningKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEHOGGradientOrientationBinningKernel(NEHOGGradientOrientationBinningKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEHOGGradientOrientationBinningKernel &operator=(NEHOGGradientOrientationBinningKernel &&) = default;
+    /** Default destructor */
+    ~NEHOGGradientOrientationBinningKernel() = default;
+
+    /** Initialise the kernel's input, output and HOG's metadata
+     *
+     * @param[in]  input    Input tensor. Data type supported: U8
+     * @param[out] output   Output tensor which stores the local HOG for each cell. DataType supported: F32. Number of channels supported: equal to the number of histogram bins per cell
+     * @param[in]  hog_info HOG's metadata
+     */
+    void configure(const ITensor *input, ITensor *output, const HOGInfo *hog_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Common signature for all the specialised cell gradient functions
+     *
+     * @param[in]  input_row_ptr Pointer to the first row of the cell in the input tensor
+     * @param[out] mag_ptr       Pointer to the buffer which stores the magnitude of the gradient of the cell
+     * @param[out] phase_ptr     Pointer to the buffer which stores the phase of the gradient of the cell
+     * @param[in]  input_stride  Stride of the input tensor
+     * @param[in]  cell_stride   Stride of the magnitude and phase buffers. Must be a multiple of 8
+     * @param[in]  cell_height   Height of the cell
+     */
+    using CellGradientFunc = void(const uint8_t *__restrict input_row_ptr, int16_t *__restrict mag_ptr, uint8_t *__restrict phase_ptr, size_t input_stride, size_t cell_stride, size_t cell_height);
+    /** Orientation binning function signature, the same as @ref NEHOGOrientationBinningKernel's */
+    using OrientBinFunc = void(const int16_t *__restrict mag_row_ptr, const uint8_t *__restrict phase_row_ptr, float *__restrict output_ptr, size_t mag_stride, size_t phase_stride, size_t cell_width,
+                               size_t cell_height, size_t num_bins, float phase_scale);
+    /** Cell gradient function to use for the phase type passed to configure() */
+    CellGradientFunc *_gradient_func;
+    /** Orientation binning function to use for the particular cell width passed to configure() */
+    OrientBinFunc *_orient_bin_func;
+    const ITensor *_input;
+    ITensor       *_output;
+    size_t         _cell_width;
+    size_t         _cell_height;
+    size_t         _num_bins;
+    float          _phase_scale;
+};
+
 /** NEON kernel to perform HOG block normalization */
 class NEHOGBlockNormalizationKernel : public INEKernel
 {
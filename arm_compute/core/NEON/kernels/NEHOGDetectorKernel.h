@@ -24,11 +24,14 @@
 #ifndef __ARM_COMPUTE_NEHOGDETECTORKERNEL_H__
 #define __ARM_COMPUTE_NEHOGDETECTORKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/IHOG.h"
+#include "arm_compute/core/IMultiHOG.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
-#include <mutex>
+#include <array>
+#include <vector>
 
 namespace arm_compute
 {
@@ -62,24 +65,50 @@ public:
      * @param[in]  idx_class               (Optional) Index of the class used for evaluating which class the detection window belongs to
      */
     void configure(const ITensor *input, const IHOG *hog, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold = 0.0f, uint16_t idx_class = 0);
+    /** Initialise the kernel to evaluate several HOG models in a single pass over the input
+     *
+     * Every block of the input is loaded once and multiplied with the descriptors of all the models.
+     *
+     * @note The models must share the input tensor, hence the same cell size, number of bins, block size and block stride, as well as the same detection window size.
+     *
+     * @param[in]  input                   Input tensor which stores the HOG descriptor obtained with @ref NEHOGOrientationBinningKernel. Data type supported: F32. Number of channels supported: equal to the number of histogram bins per block
+     * @param[in]  multi_hog               Container of the HOG data objects used by @ref NEHOGOrientationBinningKernel and  @ref NEHOGBlockNormalizationKernel
+     * @param[in]  first_model             Index of the first model to evaluate. It is also the index of the class of its detection windows
+     * @param[in]  num_models              Number of consecutive models to evaluate, at most @ref max_models
+     * @param[out] detection_windows       Array of @ref DetectionWindow. This array stores all the detected objects
+     * @param[in]  detection_window_stride Distance in pixels between 2 consecutive detection windows in x and y directions.
+     *                                     It must be multiple of the block stride of the models
+     * @param[in]  threshold               (Optional) Threshold for the distance between features and SVM classifying plane
+     */
+    void configure(const ITensor *input, const IMultiHOG *multi_hog, size_t first_model, size_t num_models, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride,
+                   float threshold = 0.0f);
+
+    /** Maximum number of models evaluated in a single pass, their scores are kept in registers */
+    static constexpr size_t max_models = 4;
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
-    const ITensor         *_input;
-    IDetectionWindowArray *_detection_windows;
-    const float           *_hog_descriptor;
-    float                  _bias;
-    float                  _threshold;
-    uint16_t               _idx_class;
-    size_t                 _num_bins_per_descriptor_x;
-    size_t                 _num_blocks_per_descriptor_y;
-    size_t                 _block_stride_width;
-    size_t                 _block_stride_height;
-    size_t                 _detection_window_width;
-    size_t                 _detection_window_height;
-    std::mutex             _mutex;
+    /** Common part of the configure() methods once the models are set */
+    void configure_window(const HOGInfo &hog_info, const Size2D &detection_window_stride);
+
+    const ITensor                                  *_input;
+    IDetectionWindowArray                          *_detection_windows;
+    std::array<const float *, max_models>           _hog_descriptors;
+    std::array<float, max_models>                   _biases;
+    std::array<uint16_t, max_models>                _idx_classes;
+    size_t                                          _num_models;
+    float                                           _threshold;
+    size_t                                          _num_bins_per_descriptor_x;
+    size_t                                          _num_blocks_per_descriptor_y;
+    size_t                                          _block_stride_width;
+    size_t                                          _block_stride_height;
+    size_t                                          _detection_window_width;
+    size_t                                          _detection_window_height;
+    ThreadLocalSlots<std::vector<DetectionWindow>>  _local_detections;
 };
 }
 
@@ -29,12 +29,19 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 /** NEON kernel to perform in-place computation of euclidean distance based non-maxima suppression for HOG
  *
  * @note This kernel is meant to be used alongside HOG and performs a non-maxima suppression on a
  *       HOG detection window.
+ *
+ * @note The centres of the windows already kept are hashed into a grid of min_distance wide cells, so each candidate is only
+ *       compared with the windows of the 3x3 neighbouring cells instead of all the other candidates.
+ *
+ * @note The kernel must be run through the scheduler, which groups the candidates by partition before the run (See ICPPKernel::begin_reduction()).
  */
 class NEHOGNonMaximaSuppressionKernel : public INEKernel
 {
@@ -53,16 +60,32 @@ public:
      *
      * @param[in, out] input_output Input/Output array of @ref DetectionWindow
      * @param[in]      min_distance Radial Euclidean distance for non-maxima suppression
+     * @param[in]      num_classes  (Optional) If not 0, a window is only suppressed by the windows of its own class and the classes,
+     *                              which must be lower than num_classes, are sorted and suppressed in parallel.
+     *                              If 0 (Default), the windows of all the classes suppress each other.
      */
-    void configure(IDetectionWindowArray *input_output, float min_distance);
+    void configure(IDetectionWindowArray *input_output, float min_distance, size_t num_classes = 0);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
     bool is_parallelisable() const override;
+    SchedulingPolicy scheduling_policy() const override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
-    IDetectionWindowArray *_input_output;
-    float                  _min_distance;
+    /** Sort the candidates of a partition and keep the ones which are not suppressed at the beginning of the partition
+     *
+     * @param[in] partition Index of the partition to process.
+     */
+    void suppress(size_t partition);
+
+    IDetectionWindowArray       *_input_output;
+    float                        _min_distance;
+    size_t                       _num_partitions; /**< Number of classes processed independently, 1 if all the classes suppress each other */
+    std::vector<DetectionWindow> _candidates;     /**< Candidates grouped by partition */
+    std::vector<size_t>          _offsets;        /**< Offset of the first candidate of each partition, plus the total number of candidates */
+    std::vector<size_t>          _num_kept;       /**< Number of windows kept in each partition */
 };
 }
 
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEHOGSPACESCALEKERNEL_H__
+#define __ARM_COMPUTE_NEHOGSPACESCALEKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to approximate the HOG space of a downscaled image from the HOG space of the full resolution image
+ *
+ * The cells of the downscaled image cover @p scale x @p scale cells of the full resolution image: the histogram of each cell is the
+ * area weighted average of the histograms of the cells it covers, corrected with the power law followed by the gradient histograms
+ * of natural images across scales. This is cheaper than resizing the image and computing its gradient and orientation binning again.
+ */
+class NEHOGSpaceScaleKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEHOGSpaceScaleKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHOGSpaceScaleKernel(const NEHOGSpaceScaleKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHOGSpaceScaleKernel &operator=(const NEHOGSpaceScaleKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEHOGSpaceScaleKernel(NEHOGSpaceScaleKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEHOGSpaceScaleKernel &operator=(NEHOGSpaceScaleKernel &&) = default;
+    /** Default destructor */
+    ~NEHOGSpaceScaleKernel() = default;
+
+    /** Initialise the kernel's input, output and scale
+     *
+     * @param[in]  input  Input tensor which stores the local HOG for each cell of the full resolution image. Data type supported: F32.
+     *                    Number of channels supported: equal to the number of histogram bins per cell
+     * @param[out] output Output tensor which stores the local HOG for each cell of the downscaled image. Data type supported: same as @p input.
+     *                    Number of channels supported: same as @p input. Its width and height must not exceed the ones of @p input divided by @p scale
+     * @param[in]  scale  Downscaling factor of the image. Must be greater than or equal to 1
+     */
+    void configure(const ITensor *input, ITensor *output, float scale);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Cell of the input covered by a cell of the output along one dimension */
+    struct Tap
+    {
+        int   idx;    /**< Coordinate of the input cell */
+        float weight; /**< Fraction of the output cell covered by the input cell */
+    };
+
+    const ITensor      *_input;
+    ITensor            *_output;
+    std::vector<Tap>    _taps_x;      /**< Taps of all the output columns */
+    std::vector<size_t> _first_tap_x; /**< Index of the first tap of each output column, plus the total number of taps */
+    std::vector<Tap>    _taps_y;      /**< Taps of all the output rows */
+    std::vector<size_t> _first_tap_y; /**< Index of the first tap of each output row, plus the total number of taps */
+    float               _correction;
+};
+}
+#endif /* __ARM_COMPUTE_NEHOGSPACESCALEKERNEL_H__ */
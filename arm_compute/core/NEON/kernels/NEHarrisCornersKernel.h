@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEHARRISCORNERSKERNEL_H__
 #define __ARM_COMPUTE_NEHARRISCORNERSKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
 #include "arm_compute/core/CPP/kernels/CPPCornerCandidatesKernel.h"
 #include "arm_compute/core/CPP/kernels/CPPSortEuclideanDistanceKernel.h"
 #include "arm_compute/core/IArray.h"
@@ -31,6 +32,7 @@
 
 #include <cstdint>
 #include <mutex>
+#include <vector>
 
 namespace arm_compute
 {
@@ -122,5 +124,71 @@ private:
 template <int32_t block_size>
 using NEHarrisScoreFP16Kernel = NEHarrisScoreKernel<block_size>;
 #endif
+
+/** NEON kernel to compute the Harris score, suppress its non-maxima and extract the corner candidates tile by tile
+ *
+ * The score of a tile and of a one pixel margin around it is computed in a local buffer, on which the 3x3 non-maxima suppression of
+ * @ref NENonMaximaSuppression3x3 is applied, so the score of the whole image is never stored.
+ * The implementation supports 3, 5, and 7 for the block_size
+ *
+ * @note The kernel must be run through the scheduler, which gathers the candidates found by all the threads after the run (See ICPPKernel::end_reduction()).
+ */
+class NEHarrisCornerCandidatesKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEHarrisCornerCandidatesKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHarrisCornerCandidatesKernel(const NEHarrisCornerCandidatesKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEHarrisCornerCandidatesKernel &operator=(const NEHarrisCornerCandidatesKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEHarrisCornerCandidatesKernel(NEHarrisCornerCandidatesKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEHarrisCornerCandidatesKernel &operator=(NEHarrisCornerCandidatesKernel &&) = default;
+    /** Default destructor */
+    ~NEHarrisCornerCandidatesKernel() = default;
+    /** Setup the kernel parameters
+     *
+     * @param[in]  input1           Source image (gradient X). Data types supported: S16, S32
+     * @param[in]  input2           Source image (gradient Y). Data types supported: same as @ input1
+     * @param[out] output           Destination vector of corner candidates (x, y, strength). Overwritten at each run.
+     * @param[in]  block_size       The block window size used to compute the Harris Corner score. The implementation supports 3, 5, and 7.
+     * @param[in]  norm_factor      Normalization factor to use accordingly with the gradient size (Must be different from 0)
+     * @param[in]  strength_thresh  Minimum threshold with which to eliminate Harris Corner scores (computed using the normalized Sobel kernel).
+     * @param[in]  sensitivity      Sensitivity threshold k from the Harris-Stephens equation
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant, in which case the score outside of the image is 0.
+     * @param[in]  use_fp16         (Optional) If true the FP16 score functions will be used. If false F32 ones are used.
+     */
+    void configure(const IImage *input1, const IImage *input2, std::vector<InternalKeypoint> *output, int32_t block_size,
+                   float norm_factor, float strength_thresh, float sensitivity, bool border_undefined, bool use_fp16 = false);
+
+    // Inherited methods overridden:
+    BorderSize border_size() const override;
+    void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
+
+private:
+    /** Common signature for all the specialised harris score functions */
+    using HarrisScoreFunction = void(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, int32_t input_stride,
+                                     float norm_factor, float sensitivity, float strength_thresh);
+
+    HarrisScoreFunction                            *_func;              /**< Harris Score function to use for the particular image types passed to configure() */
+    const IImage                                   *_input1;            /**< Source image - Gx component */
+    const IImage                                   *_input2;            /**< Source image - Gy component */
+    std::vector<InternalKeypoint>                  *_output;            /**< Corner candidates */
+    ThreadLocalSlots<std::vector<InternalKeypoint>> _thread_candidates; /**< Corner candidates found by each thread */
+    float                                           _sensitivity;       /**< Sensitivity value */
+    float                                           _strength_thresh;   /**< Threshold value */
+    float                                           _norm_factor;       /**< Normalization factor */
+    BorderSize                                      _border_size;       /**< Border size */
+    int                                             _num_elems_step;    /**< Number of scores computed by one call of the harris score function */
+    bool                                            _border_undefined;  /**< True if the border mode is undefined */
+    int                                             _width;             /**< Width of the gradient images */
+    int                                             _height;            /**< Height of the gradient images */
+    int                                             _end_x;             /**< End along X of the region where the candidates are extracted */
+    int                                             _end_y;             /**< End along Y of the region where the candidates are extracted */
+};
 }
 #endif /* __ARM_COMPUTE_NEHARRISCORNERSKERNEL_H__ */
@@ -24,11 +24,12 @@
 #ifndef __ARM_COMPUTE_NEHISTOGRAMKERNEL_H__
 #define __ARM_COMPUTE_NEHISTOGRAMKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
 #include <cstddef>
 #include <cstdint>
-#include <mutex>
+#include <vector>
 
 namespace arm_compute
 {
@@ -55,18 +56,18 @@ public:
 
     /** Set the input image and the distribution output.
      *
-     * @param[in]     input      Source image. Data type supported: U8.
-     * @param[out]    output     Destination distribution.
-     * @param[in,out] local_hist Array that the threads use to save their local histograms.
-     *                           It's size should be equal to (number_of_threads * num_bins),
-     *                           and the Window::thread_id() is used to determine the part of the array
-     *                           used by each thread.
-     * @param[out]    window_lut LUT with pre-calculated possible window values.
-     *                           The size of the LUT should be equal to max_range_size and it will be filled
-     *                           during the configure stage, while it re-used in every run, therefore can be
-     *                           safely shared among threads.
+     * @note The threads accumulate into local histograms owned by the kernel, which are merged into @p output once all of them are done.
+     *       Each local histogram is split in banks counting interleaved pixels, so that runs of equal pixels don't serialise on the same bin.
+     *
+     * @param[in]  input      Source image. Data type supported: U8.
+     * @param[out] output     Destination distribution.
+     * @param[out] window_lut LUT with pre-calculated possible window values.
+     *                        The size of the LUT should be equal to max_range_size and it will be filled
+     *                        during the configure stage, while it re-used in every run, therefore can be
+     *                        safely shared among threads. The pixels out of the range of @p output are mapped to
+     *                        the bin equal to the number of bins of @p output, which is discarded.
      */
-    void configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut);
+    void configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut);
     /** Set the input image and the distribution output.
      *
      * @note Used for histogram of fixed size equal to 256
@@ -78,15 +79,10 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
-    /** Function to merge multiple partial histograms.
-     *
-     *  @param[out] global_hist Pointer to the final histogram.
-     *  @param[in]  local_hist  Pointer to the partial histograms.
-     *  @param[in]  bins        Number of bins.
-     */
-    void merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins);
     /** Function to merge multiple minimum values of partial histograms.
      *
      *  @param[out] global_min Pointer to the global min value.
@@ -117,13 +113,13 @@ private:
      */
     using HistogramFunctionPtr = void (NEHistogramKernel::*)(Window window);
 
-    HistogramFunctionPtr          _func; ///< Histogram function to use for the particular image types passed to configure()
-    const IImage                 *_input;
-    IDistribution1D              *_output;
-    uint32_t                     *_local_hist;
-    uint32_t                     *_window_lut;
-    std::mutex                    _hist_mtx;
-    static constexpr unsigned int _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
+    HistogramFunctionPtr                    _func; ///< Histogram function to use for the particular image types passed to configure()
+    const IImage                           *_input;
+    IDistribution1D                        *_output;
+    uint32_t                               *_window_lut;
+    ThreadLocalSlots<std::vector<uint32_t>> _local_hist; ///< Banked histogram of the pixels processed by each thread
+    size_t                                  _bank_stride; ///< Number of bins of each bank of the local histograms
+    static constexpr unsigned int           _max_range_size{ 256 }; ///< 256 possible pixel values as we handle only U8 images
 };
 }
 #endif /*__ARM_COMPUTE_NEHISTOGRAMKERNEL_H__ */
@@ -52,6 +52,9 @@ class ITensor;
  * a11 & a12 & a13 & a21 & a22 & a23 & a31 & a32 & a33 \\
  * \end{array} \right)
  * @f]
+ *
+ * The columns can also be written directly in the layout produced by @ref NEGEMMInterleave4x4Kernel,
+ * which saves the matrix multiplication of a convolution layer a pass over the whole im2col matrix.
  */
 class NEIm2ColKernel : public INEKernel
 {
@@ -72,16 +75,25 @@ public:
     /** Set the input and output of the kernel.
      *
      * @param[in]  input          The input tensor to convert. 3 lower dimensions represent a single input [width, height, IFM],
-     *                            while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32
+     *                            while every optional dimension from 4 and above represent a batch of inputs. Data types supported: U8/F16/F32.
+     *                            The padding of a quantized U8 input is filled with its quantization offset, which represents the real value 0.
      * @param[out] output         The output tensor. Data types supported: Same as @p input
      * @param[in]  convolved_dims The convolved output dimensions.
      * @param[in]  conv_info      Contains padding and stride information described in @ref PadStrideInfo.
-     * @param[in]  has_bias       In case biases are provided expands the matrix with 1.
+     * @param[in]  has_bias       In case biases are provided expands the matrix with 1. Must be false for U8 inputs.
+     * @param[in]  interleave     (Optional) Write the output in the 4x4 interleaved layout of @ref NEGEMMInterleave4x4Kernel:
+     *                            in that case the output has 4 times more columns and 4 times less rows than the im2col matrix. Defaults to false.
+     *                            For a grouped convolution the 3rd dimension of the interleaved output is the number of groups:
+     *                            each plane holds the im2col matrix of its own share of the input feature maps.
+     *                            An NHWC input [IFM, width, height, batches] (See @ref DataLayout) requires the interleaved layout: the patches are then linearized
+     *                            in the (kernel_y, kernel_x, IFM) order of the weights [IFM, kernel_x, kernel_y, OFM] of an NHWC convolution.
      */
-    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const PadStrideInfo &conv_info, bool has_bias);
+    void configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const PadStrideInfo &conv_info, bool has_bias,
+                   bool interleave = false);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
 
 private:
     /** Run the im2col used for the convolution layer case
@@ -90,15 +102,47 @@ private:
      */
     void run_reduced(const Window &window);
     /** Run the im2col optimised for the fully connected layer case
+     *
+     * @tparam kernel_size Size of the convolution kernel, or 0 to read it from the configuration.
+     * @tparam stride      Stride of the convolution along X and Y, or 0 to read it from the configuration.
      *
      * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
      */
+    template <typename T, int kernel_size, int stride>
     void run_generic(const Window &window);
+    /** Run the im2col for the convolution layer case, writing the output in the 4x4 interleaved layout
+     *
+     * @tparam kernel_size Size of the convolution kernel, or 0 to read it from the configuration.
+     * @tparam stride      Stride of the convolution along X and Y, or 0 to read it from the configuration.
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T, int kernel_size, int stride>
+    void run_interleaved(const Window &window);
+    /** Run the im2col for the convolution layer case on an NHWC input, writing the output in the 4x4 interleaved layout
+     *
+     * Each element of a patch is a run of contiguous channels in the input: the runs of the 4 patches of an output row are interleaved 4 channels at a time.
+     *
+     * @param[in] window Region on which to execute the kernel. (Must be a valid region of the window returned by window()).
+     */
+    template <typename T>
+    void run_interleaved_nhwc(const Window &window);
     /** Common signature for all the specialised im2col functions
      *
      * @param[in] window Region on which to execute the kernel.
      */
     using Im2ColFunctionPtr = void (NEIm2ColKernel::*)(const Window &window);
+    /** Select the im2col function for a data type, specialised for the shape of the convolution if one was instantiated (See fixed_shape_kernels build option)
+     *
+     * @param[in] interleave  True to select the function writing the 4x4 interleaved layout.
+     * @param[in] kernel_size Size of the convolution kernel.
+     * @param[in] stride_x    Stride of the convolution along X.
+     * @param[in] stride_y    Stride of the convolution along Y.
+     *
+     * @return The im2col function
+     */
+    template <typename T>
+    static Im2ColFunctionPtr select_function(bool interleave, unsigned int kernel_size, unsigned int stride_x, unsigned int stride_y);
 
     Im2ColFunctionPtr _func;
     const ITensor    *_input;
@@ -24,17 +24,21 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__
 
+#include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/INESimpleKernel.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Kernel to perform an image integral on an image */
-class NEIntegralImageKernel : public INESimpleKernel
+/** Kernel to compute the sum of each row of an image up to each pixel (horizontal pass of the image integral)
+ *
+ * @note The rows are independent so the kernel can be split along Y.
+ */
+class NEIntegralImageHorKernel : public INESimpleKernel
 {
 public:
-    /** Set the source, destination and border mode of the kernel
+    /** Set the source and destination of the kernel
      *
      * @param[in]  input  Source tensor. Data type supported: U8
      * @param[out] output Destination tensor. Data type supported: U32
@@ -44,7 +48,41 @@ public:
     // Inherited methods overridden:
     void run(const Window &window) override;
     BorderSize border_size() const override;
-    bool       is_parallelisable() const override;
+};
+
+/** Kernel to accumulate the row sums computed by @ref NEIntegralImageHorKernel along the columns (vertical pass of the image integral)
+ *
+ * @note The columns are independent so the kernel must be split along X: each sub-window has to go through all the rows in order.
+ */
+class NEIntegralImageVertKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEIntegralImageVertKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel(const NEIntegralImageVertKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEIntegralImageVertKernel &operator=(const NEIntegralImageVertKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel(NEIntegralImageVertKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEIntegralImageVertKernel &operator=(NEIntegralImageVertKernel &&) = default;
+    /** Default destructor */
+    ~NEIntegralImageVertKernel() = default;
+
+    /** Set the tensor of the kernel
+     *
+     * @param[in, out] output Tensor containing the row sums, overwritten with the image integral. Data type supported: U32
+     */
+    void configure(ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    bool is_split_dimension_collapsible() const override;
+    BorderSize border_size() const override;
+
+private:
+    ITensor *_output;
 };
 }
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGEKERNEL_H__ */
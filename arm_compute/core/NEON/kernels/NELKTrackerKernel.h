@@ -89,12 +89,52 @@ public:
                    INELKInternalKeypointArray *old_points_internal, INELKInternalKeypointArray *new_points_internal,
                    Termination termination, bool use_initial_estimate, float epsilon, unsigned int num_iterations, size_t window_dimension,
                    size_t level, size_t num_levels, float pyramid_scale);
+    /** Initialise the kernel input and output to compute the scharr gradients on the fly
+     *
+     * The scharr gradients of @p input_old are only computed in the neighbourhood of each keypoint, instead of over the whole image.
+     *
+     * @note The border of @p input_old must have been filled for @p border_undefined = false, as the scharr kernel would do.
+     *
+     * @param[in]      input_old            Pointer to the input old tensor. Data type supported: U8
+     * @param[in]      input_new            Pointer to the input new tensor. Data type supported. U8
+     * @param[in]      old_points           Pointer to the IKeyPointArray storing old key points
+     * @param[in]      new_points_estimates Pointer to the IKeyPointArray storing new estimates key points
+     * @param[out]     new_points           Pointer to the IKeyPointArray storing new key points
+     * @param[in, out] old_points_internal  Pointer to the array of NELKInternalKeypoint for old points
+     * @param[out]     new_points_internal  Pointer to the array of NELKInternalKeypoint for new points
+     * @param[in]      termination          The criteria to terminate the search of each keypoint.
+     * @param[in]      use_initial_estimate The flag to indicate whether the initial estimated position should be used
+     * @param[in]      epsilon              The error for terminating the algorithm
+     * @param[in]      num_iterations       The maximum number of iterations before terminate the algorithm
+     * @param[in]      window_dimension     The size of the window on which to perform the algorithm
+     * @param[in]      level                The pyramid level
+     * @param[in]      num_levels           The number of pyramid levels
+     * @param[in]      pyramid_scale        Scale factor used for generating the pyramid
+     * @param[in]      border_undefined     True if the border mode of the scharr gradients is undefined.
+     */
+    void configure(const ITensor *input_old, const ITensor *input_new,
+                   const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates, IKeyPointArray *new_points,
+                   INELKInternalKeypointArray *old_points_internal, INELKInternalKeypointArray *new_points_internal,
+                   Termination termination, bool use_initial_estimate, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                   size_t level, size_t num_levels, float pyramid_scale, bool border_undefined);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
     BorderSize border_size() const override;
 
 private:
+    /** Common part of both configure() methods
+     *
+     * @param[in] old_read_border Number of elements read from the input old tensor outside of the valid region on each side
+     */
+    void configure_window(const BorderSize &old_read_border);
+    /** Compute the scharr gradients of the input old tensor in the window around a keypoint
+     *
+     * @param[in]  keypoint Keypoint around which gradients are computed
+     * @param[out] patch_gx (_window_dimension + 1) rows of _patch_stride X gradients, starting at the top left corner of the window
+     * @param[out] patch_gy (_window_dimension + 1) rows of _patch_stride Y gradients, starting at the top left corner of the window
+     */
+    void compute_scharr_patch(const NELKInternalKeypoint &keypoint, int16_t *patch_gx, int16_t *patch_gy);
     /** Initialise the array of keypoints in the provide range
      *
      * @param[in] start Index of first element in the keypoints array to be initialised
@@ -104,12 +144,15 @@ private:
     /** Compute the structure tensor A^T * A based on the scharr gradients I_x and I_y
      *
      * @param[in]  keypoint    Keypoint for which gradients are computed
+     * @param[in]  gx          Scharr X gradient at the top left corner of the window around the keypoint
+     * @param[in]  gy          Scharr Y gradient at the top left corner of the window around the keypoint
+     * @param[in]  row_stride  Number of elements between two rows of @p gx and @p gy
      * @param[out] bilinear_ix Intermediate interpolated data for X gradient
      * @param[out] bilinear_iy Intermediate interpolated data for Y gradient
      *
      * @return Values A11, A12, A22
      */
-    std::tuple<int, int, int> compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int *bilinear_ix, int *bilinear_iy);
+    std::tuple<int, int, int> compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, const int16_t *gx, const int16_t *gy, size_t row_stride, int *bilinear_ix, int *bilinear_iy);
     /** Compute the vector A^T * b, i.e. -sum(I_d * I_t) for d in {x,y}
      *
      * @param[in] old_keypoint Old keypoint for which gradient is computed
@@ -138,7 +181,44 @@ private:
     int                         _window_dimension;
     unsigned int                _level;
     unsigned int                _num_levels;
+    int                         _patch_stride;
     ValidRegion                 _valid_region;
 };
+
+/** Interface for the kernel which tracks keypoints through all the levels of a pyramid
+ *
+ * Each sub-window tracks its range of keypoints from the coarsest to the finest level, therefore the threads don't wait
+ * for each other between two levels and the neighbourhood of a keypoint is still in cache when its next level is processed.
+ */
+class NELKTrackerPyramidKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NELKTrackerPyramidKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELKTrackerPyramidKernel(const NELKTrackerPyramidKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELKTrackerPyramidKernel &operator=(const NELKTrackerPyramidKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELKTrackerPyramidKernel(NELKTrackerPyramidKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELKTrackerPyramidKernel &operator=(NELKTrackerPyramidKernel &&) = default;
+    /** Default destructor */
+    ~NELKTrackerPyramidKernel() = default;
+    /** Initialise the kernel
+     *
+     * @param[in] trackers   Array of @p num_levels tracker kernels. The ith kernel must be configured for the level i of the pyramid and all of them on the same keypoint arrays.
+     * @param[in] num_levels Number of pyramid levels
+     */
+    void configure(NELKTrackerKernel *trackers, size_t num_levels);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+
+private:
+    NELKTrackerKernel *_trackers;
+    size_t             _num_levels;
+};
 }
 #endif /*__ARM_COMPUTE_NELKTRACKERKERNEL_H__ */
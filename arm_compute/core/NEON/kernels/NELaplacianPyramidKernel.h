@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__
+#define __ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to compute a level of a Laplacian pyramid: L(i) = I(i) - Gaussian5x5(I(i))
+ *
+ * Computes the same result as @ref NEGaussian5x5 followed by @ref NEArithmeticSubtraction in a single pass: the horizontally filtered rows
+ * are kept in a ring buffer of 5 lines and the blurred rows are subtracted from the input as soon as they are computed,
+ * so neither the S16 intermediate of the Gaussian filter nor the blurred image are written.
+ */
+class NELaplacianPyramidKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NELaplacianPyramidKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianPyramidKernel(const NELaplacianPyramidKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianPyramidKernel &operator=(const NELaplacianPyramidKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELaplacianPyramidKernel(NELaplacianPyramidKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELaplacianPyramidKernel &operator=(NELaplacianPyramidKernel &&) = default;
+    /** Default destructor */
+    ~NELaplacianPyramidKernel() = default;
+
+    /** Initialise the kernel's source, destinations and border mode.
+     *
+     * @param[in]  input            Source tensor, level I(i) of the Gaussian pyramid. Data type supported: U8.
+     * @param[out] output           Destination tensor, level L(i) of the Laplacian pyramid. Data type supported: S16.
+     * @param[out] blurred          (Optional) Destination tensor which stores Gaussian5x5(I(i)). Can be nullptr. Data type supported: S16.
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, ITensor *blurred, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    ITensor       *_blurred;
+};
+}
+#endif /*__ARM_COMPUTE_NELAPLACIANPYRAMIDKERNEL_H__ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NELAPLACIANRECONSTRUCTKERNEL_H__
+#define __ARM_COMPUTE_NELAPLACIANRECONSTRUCTKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to reconstruct a level of an image from a Laplacian pyramid: I(i) = upsample(I(i+1)) + L(i)
+ *
+ * Computes the same result as @ref NEScale with nearest neighbour interpolation followed by @ref NEArithmeticAddition (and
+ * @ref NEDepthConvert if the output is U8) in a single pass, so the upsampled image is never written.
+ *
+ * @note The conversions are always saturated.
+ */
+class NELaplacianReconstructKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NELaplacianReconstructKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianReconstructKernel(const NELaplacianReconstructKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NELaplacianReconstructKernel &operator=(const NELaplacianReconstructKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NELaplacianReconstructKernel(NELaplacianReconstructKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NELaplacianReconstructKernel &operator=(NELaplacianReconstructKernel &&) = default;
+    /** Default destructor */
+    ~NELaplacianReconstructKernel() = default;
+
+    /** Initialise the kernel's sources and destination.
+     *
+     * @param[in]  low_res   Source tensor, the reconstructed image I(i+1) of the lower (or same) resolution level. Data type supported: S16.
+     * @param[in]  laplacian Source tensor, level L(i) of the Laplacian pyramid. Data type supported: S16.
+     * @param[out] output    Destination tensor, the reconstructed image I(i). Must have the same size as @p laplacian. Data types supported: U8/S16.
+     */
+    void configure(const ITensor *low_res, const ITensor *laplacian, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Common signature for all the specialised upsample and add functions
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    using UpsampleAddFunction = void (NELaplacianReconstructKernel::*)(const Window &window);
+    /** Add the Laplacian level to a low resolution image of the same width
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void upsample_add_x1(const Window &window);
+    /** Upsample by exactly 2 along X and add the Laplacian level
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void upsample_add_x2(const Window &window);
+    /** Upsample by any ratio along X and add the Laplacian level
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void upsample_add(const Window &window);
+
+    UpsampleAddFunction _func;
+    const ITensor      *_low_res;
+    const ITensor      *_laplacian;
+    ITensor            *_output;
+    float               _wr;
+    float               _hr;
+};
+}
+#endif /*__ARM_COMPUTE_NELAPLACIANRECONSTRUCTKERNEL_H__ */
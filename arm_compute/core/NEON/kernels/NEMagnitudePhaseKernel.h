@@ -27,6 +27,9 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <arm_neon.h>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
@@ -53,12 +56,18 @@ public:
      *
      * @note At least one of out1 or out2 must be set
      *
-     * @param[in]  gx        Gradient X tensor. Data type supported: S16.
-     * @param[in]  gy        Gradient Y tensor. Data type supported: S16.
-     * @param[out] magnitude (Optional) The output tensor - Magnitude. Data type supported: S16.
-     * @param[out] phase     (Optional) The output tensor - Phase. Data type supported: U8.
+     * @note With @ref MagnitudePhaseApproximation::BINS, the phase holds the orientation bin of each gradient in [0, @p num_bins): bin i covers
+     *       the angles [i * range / num_bins, (i + 1) * range / num_bins) with a range of 180 degrees for unsigned phases and 360 degrees for signed ones.
+     *
+     * @param[in]  gx            Gradient X tensor. Data type supported: S16.
+     * @param[in]  gy            Gradient Y tensor. Data type supported: S16.
+     * @param[out] magnitude     (Optional) The output tensor - Magnitude. Data type supported: S16.
+     * @param[out] phase         (Optional) The output tensor - Phase. Data type supported: U8.
+     * @param[in]  approximation (Optional) Precision of the magnitude and the phase. Defaults to @ref MagnitudePhaseApproximation::ACCURATE.
+     * @param[in]  num_bins      (Optional) Number of orientation bins, only used with @ref MagnitudePhaseApproximation::BINS. Must be even for signed phases.
      */
-    void configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase);
+    void configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase, MagnitudePhaseApproximation approximation = MagnitudePhaseApproximation::ACCURATE,
+                   size_t num_bins = 0);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
@@ -68,17 +77,38 @@ private:
      *
      *  @param[in] window Region on which to execute the kernel
      */
+    template <MagnitudePhaseApproximation approximation>
     void magnitude(const Window &window);
     /** Function to perform phase on the given window
      *
      *  @param[in] window Region on which to execute the kernel
      */
+    template <MagnitudePhaseApproximation approximation>
     void phase(const Window &window);
     /** Function to perform magnitude and phase on the given window
      *
      *  @param[in] window Region on which to execute the kernel
      */
+    template <MagnitudePhaseApproximation approximation>
     void magnitude_phase(const Window &window);
+    /** Compute the magnitude of 16 gradients
+     *
+     * @param[in] gx Gradients along X
+     * @param[in] gy Gradients along Y
+     *
+     * @return The magnitudes
+     */
+    template <MagnitudePhaseApproximation approximation>
+    int16x8x2_t compute_magnitude(const int16x8x2_t &gx, const int16x8x2_t &gy) const;
+    /** Compute the phase of 16 gradients
+     *
+     * @param[in] gx Gradients along X
+     * @param[in] gy Gradients along Y
+     *
+     * @return The phases, or the orientation bins with @ref MagnitudePhaseApproximation::BINS
+     */
+    template <MagnitudePhaseApproximation approximation>
+    uint8x16_t compute_phase(const int16x8x2_t &gx, const int16x8x2_t &gy) const;
 
 private:
     /** Common signature for all the specialised MagnitudePhase functions
@@ -88,10 +118,13 @@ private:
     using MagnitudePhaseFunctionPtr = void (NEMagnitudePhaseKernel::*)(const Window &window);
     /** MagnitudePhase function to use for the particular formats passed to configure() */
     MagnitudePhaseFunctionPtr _func;
-    const ITensor            *_gx;        /**< Input gradient X */
-    const ITensor            *_gy;        /**< Input gradient Y */
-    ITensor                  *_magnitude; /**< Output - Magnitude */
-    ITensor                  *_phase;     /**< Output - Phase */
+    const ITensor            *_gx;           /**< Input gradient X */
+    const ITensor            *_gy;           /**< Input gradient Y */
+    ITensor                  *_magnitude;    /**< Output - Magnitude */
+    ITensor                  *_phase;        /**< Output - Phase */
+    std::vector<float>        _boundary_cos; /**< Cosines of the bin boundaries in (0, 180) degrees (BINS only) */
+    std::vector<float>        _boundary_sin; /**< Sines of the bin boundaries in (0, 180) degrees (BINS only) */
+    uint8_t                   _fold_offset;  /**< Bin offset of the gradients pointing downwards (BINS only) */
 };
 
 #ifdef ARM_COMPUTE_ENABLE_FP16
@@ -24,10 +24,12 @@
 #ifndef __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__
 #define __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
+#include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
 #include <cstdint>
-#include <mutex>
+#include <utility>
 
 namespace arm_compute
 {
@@ -63,14 +65,60 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
-    const IImage *_input;
-    float        *_mean;
-    float        *_stddev;
-    uint64_t     *_global_sum;
-    uint64_t     *_global_sum_squared;
-    std::mutex    _mtx;
+    const IImage                                    *_input;
+    float                                           *_mean;
+    float                                           *_stddev;
+    uint64_t                                        *_global_sum;
+    uint64_t                                        *_global_sum_squared;
+    ThreadLocalSlots<std::pair<uint64_t, uint64_t>>  _partial_sums;
+};
+
+/** Interface for the kernel to calculate mean and standard deviation of the pixels of several regions of interest of an image.
+ *
+ * Each sub-window of the kernel handles a range of regions of interest, so all of them are computed in one parallel pass without any lock.
+ * The statistics of each row are accumulated exactly in integers and merged into the statistics of the region with
+ * the parallel variant of Welford's algorithm, which does not suffer from the cancellation of the sum of squares formula.
+ */
+class NEMeanStdDevROIKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEMeanStdDevROIKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMeanStdDevROIKernel(const NEMeanStdDevROIKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMeanStdDevROIKernel &operator=(const NEMeanStdDevROIKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEMeanStdDevROIKernel(NEMeanStdDevROIKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEMeanStdDevROIKernel &operator=(NEMeanStdDevROIKernel &&) = default;
+    /** Default destructor */
+    ~NEMeanStdDevROIKernel() = default;
+
+    /** Initialise the kernel's input and outputs.
+     *
+     * @note The window of the kernel covers the max number of values of @p rois, the regions past the number of values of @p rois are skipped.
+     *
+     * @param[in]  input  Input image. Data type supported: U8.
+     * @param[in]  rois   Regions of interest of the input image. Each region must be inside the image and not empty.
+     * @param[out] mean   Average pixel value of each region. Must be able to store as many values as @p rois.
+     * @param[out] stddev (Optional) Standard deviation of the pixel values of each region. Must be able to store as many values as @p rois.
+     */
+    void configure(const IImage *input, const IRectangleArray *rois, IFloatArray *mean, IFloatArray *stddev = nullptr);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+
+private:
+    const IImage          *_input;
+    const IRectangleArray *_rois;
+    IFloatArray           *_mean;
+    IFloatArray           *_stddev;
 };
 }
 #endif /* __ARM_COMPUTE_NEMEANSTDDEVKERNEL_H__ */
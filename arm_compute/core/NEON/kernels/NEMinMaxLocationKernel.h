@@ -24,11 +24,12 @@
 #ifndef __ARM_COMPUTE_NEMINMAXLOCATIONKERNEL_H__
 #define __ARM_COMPUTE_NEMINMAXLOCATIONKERNEL_H__
 
+#include "arm_compute/core/CPP/ThreadLocalSlots.h"
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/INEKernel.h"
 
 #include <cstdint>
-#include <mutex>
+#include <vector>
 
 namespace arm_compute
 {
@@ -54,16 +55,23 @@ public:
 
     /** Initialise the kernel's input and outputs.
      *
-     * @param[in]  input Input Image. Data types supported: U8/S16.
-     * @param[out] min   Minimum value of image.
-     * @param[out] max   Maximum value of image.
+     * @note When a count is requested the pixels equal to the running minimum/maximum are counted in the same pass,
+     *       which avoids running @ref NEMinMaxLocationKernel when no location is needed.
+     *
+     * @param[in]  input     Input Image. Data types supported: U8/S16.
+     * @param[out] min       Minimum value of image.
+     * @param[out] max       Maximum value of image.
+     * @param[out] min_count (Optional) Number of minimum value encounters.
+     * @param[out] max_count (Optional) Number of maximum value encounters.
      */
-    void configure(const IImage *input, int32_t *min, int32_t *max);
+    void configure(const IImage *input, int32_t *min, int32_t *max, uint32_t *min_count = nullptr, uint32_t *max_count = nullptr);
     /** Resets global minimum and maximum. */
     void reset();
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
     /** Performs the min/max algorithm on U8 images on a given window.
@@ -76,6 +84,14 @@ private:
      * @param win The window to run the algorithm on.
      */
     void minmax_S16(const Window &win);
+    /** Performs the min/max algorithm and counts the min/max values on T type images on a given window.
+     *
+     * Each row is reduced with NEON then counted while it is still in the cache, only if its extrema matter to the thread.
+     *
+     * @param win The window to run the algorithm on.
+     */
+    template <typename T>
+    void minmax_count(const Window &win);
     /** Common signature for all the specialised MinMax functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -83,16 +99,27 @@ private:
     using MinMaxFunction = void (NEMinMaxKernel::*)(const Window &window);
     /** MinMax function to use for the particular image types passed to configure() */
     MinMaxFunction _func;
-    /** Helper to update min/max values **/
+    /** Helper to update the min/max values of a thread **/
     template <typename T>
-    void update_min_max(T min, T max);
+    void update_min_max(T min, T max, unsigned int thread_id);
+
+    /** Minimum and maximum values found by a thread and how many times it met them */
+    struct MinMaxCount
+    {
+        int32_t  min;       /**< Minimum value. */
+        int32_t  max;       /**< Maximum value. */
+        uint32_t min_count; /**< Count of minimum value encounters. */
+        uint32_t max_count; /**< Count of maximum value encounters. */
+    };
 
-    const IImage *_input;    /**< Input image. */
-    int32_t      *_min;      /**< Minimum value. */
-    int32_t      *_max;      /**< Maximum value. */
-    int32_t       _min_init; /**< Value to initialise global minimum value. */
-    int32_t       _max_init; /**< Value to initialise global maximum value. */
-    std::mutex    _mtx;      /**< Mutex used for result reduction. */
+    const IImage                 *_input;     /**< Input image. */
+    int32_t                      *_min;       /**< Minimum value. */
+    int32_t                      *_max;       /**< Maximum value. */
+    uint32_t                     *_min_count; /**< Count of minimum value encounters. */
+    uint32_t                     *_max_count; /**< Count of maximum value encounters. */
+    int32_t                       _min_init;  /**< Value to initialise global minimum value. */
+    int32_t                       _max_init;  /**< Value to initialise global maximum value. */
+    ThreadLocalSlots<MinMaxCount> _partial;   /**< Per-thread minimum and maximum values. */
 };
 
 /** Interface for the kernel to find min max locations of an image. */
@@ -113,6 +140,8 @@ public:
     ~NEMinMaxLocationKernel() = default;
 
     /** Initialise the kernel's input and outputs.
+     *
+     * @note The threads gather the locations of their sub-windows, which are concatenated in row order once all of them are done.
      *
      * @param[in]  input     Input Image. Data types supported: U8 or S16.
      * @param[out] min       Minimum value of image.
@@ -128,7 +157,8 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
-    bool is_parallelisable() const override;
+    void begin_reduction(unsigned int num_threads) override;
+    void end_reduction() override;
 
 private:
     /** Performs the min/max location algorithm on T type images on a given window.
@@ -148,14 +178,28 @@ private:
     template <class T, typename>
     struct create_func_table;
 
-    const IImage        *_input;                             /**< Input image. */
-    int32_t             *_min;                               /**< Minimum value. */
-    int32_t             *_max;                               /**< Maximum value. */
-    uint32_t            *_min_count;                         /**< Count of minimum value encounters. */
-    uint32_t            *_max_count;                         /**< Count of maximum value encounters. */
-    ICoordinates2DArray *_min_loc;                           /**< Locations of minimum values. */
-    ICoordinates2DArray *_max_loc;                           /**< Locations of maximum values. */
-    unsigned int         _num_elems_processed_per_iteration; /**< Elements processed per iteration. */
+    /** Locations and counts of the minimum and maximum values found by a thread */
+    struct LocalLocations
+    {
+        LocalLocations()
+            : min_loc(), max_loc(), min_count(0), max_count(0)
+        {
+        }
+        std::vector<Coordinates2D> min_loc;   /**< Locations of minimum values. */
+        std::vector<Coordinates2D> max_loc;   /**< Locations of maximum values. */
+        uint32_t                   min_count; /**< Count of minimum value encounters. */
+        uint32_t                   max_count; /**< Count of maximum value encounters. */
+    };
+
+    const IImage                    *_input;                             /**< Input image. */
+    int32_t                         *_min;                               /**< Minimum value. */
+    int32_t                         *_max;                               /**< Maximum value. */
+    uint32_t                        *_min_count;                         /**< Count of minimum value encounters. */
+    uint32_t                        *_max_count;                         /**< Count of maximum value encounters. */
+    ICoordinates2DArray             *_min_loc;                           /**< Locations of minimum values. */
+    ICoordinates2DArray             *_max_loc;                           /**< Locations of maximum values. */
+    unsigned int                     _num_elems_processed_per_iteration; /**< Elements processed per iteration. */
+    ThreadLocalSlots<LocalLocations> _local;                             /**< Per-thread locations and counts. */
 };
 }
 #endif /*__ARM_COMPUTE_NEMINMAXLOCATIONKERNEL_H__ */
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEMORPHOLOGYKERNEL_H__
+#define __ARM_COMPUTE_NEMORPHOLOGYKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Size2D.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to perform morphological operations with a rectangular structuring element of any size
+ *
+ * The minimum / maximum over the structuring element is computed separably, a horizontal pass followed by a vertical pass, each
+ * one using the van Herk / Gil-Werman algorithm: about three comparisons per pixel whatever the size of the structuring element.
+ * The vertical pass processes 16 columns at a time.
+ *
+ * Each sub-window is processed as a band of rows: the rows the band needs are filtered horizontally in a local buffer,
+ * then vertically into the output, so no intermediate image is written. Open and close chain their two operations within
+ * the band the same way, in a single pass over the image.
+ *
+ * @note For open and close, the second operation reads the result of the first one in the border of the image instead of
+ *       a border filled after the first operation.
+ */
+class NEMorphologyKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEMorphologyKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMorphologyKernel(const NEMorphologyKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMorphologyKernel &operator=(const NEMorphologyKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEMorphologyKernel(NEMorphologyKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEMorphologyKernel &operator=(NEMorphologyKernel &&) = default;
+    /** Default destructor */
+    ~NEMorphologyKernel() = default;
+    /** Set the source, destination, operation and border mode of the kernel
+     *
+     * @param[in]  input               Source tensor. Data type supported: U8
+     * @param[out] output              Destination tensor. Data type supported: U8
+     * @param[in]  operation           Morphological operation to perform
+     * @param[in]  structuring_element Size of the rectangular structuring element. Width and height must be odd.
+     * @param[in]  border_undefined    True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, MorphologyOperation operation, const Size2D &structuring_element, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor      *_input;
+    ITensor            *_output;
+    MorphologyOperation _operation;
+    Size2D              _structuring_element;
+    BorderSize          _border_size;
+};
+}
+#endif /*__ARM_COMPUTE_NEMORPHOLOGYKERNEL_H__ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NENONLINEARFILTERHISTOGRAMKERNEL_H__
+#define __ARM_COMPUTE_NENONLINEARFILTERHISTOGRAMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstdint>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel to apply a non-linear filter with a large box mask using histograms
+ *
+ * The kernel keeps one histogram per column of the mask and slides a histogram of the whole mask along each row,
+ * so the cost per pixel does not depend on the mask size: each pixel updates constant-size histograms and
+ * the median / min / max is found by scanning a 16 bins coarse histogram and then 16 bins of the fine one.
+ *
+ * @note Each sub-window is processed as a band of rows which builds its own column histograms, so the window can be split along Y.
+ */
+class NENonLinearFilterHistogramKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NENonLinearFilterHistogramKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonLinearFilterHistogramKernel(const NENonLinearFilterHistogramKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENonLinearFilterHistogramKernel &operator=(const NENonLinearFilterHistogramKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NENonLinearFilterHistogramKernel(NENonLinearFilterHistogramKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NENonLinearFilterHistogramKernel &operator=(NENonLinearFilterHistogramKernel &&) = default;
+    /** Default destructor */
+    ~NENonLinearFilterHistogramKernel() = default;
+    /** Set the source, destination and border mode of the kernel
+     *
+     * @param[in]  input            Source tensor. Data type supported: U8
+     * @param[out] output           Destination tensor. Data type supported: U8
+     * @param[in]  function         Non linear function to perform
+     * @param[in]  mask_size        Size of the box mask. Supported sizes: odd sizes from 3 to 31
+     * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
+     */
+    void configure(const ITensor *input, ITensor *output, NonLinearFilterFunction function, unsigned int mask_size, bool border_undefined);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_output;
+    unsigned int   _mask_size;
+    unsigned int   _rank;
+    BorderSize     _border_size;
+};
+}
+#endif /*__ARM_COMPUTE_NENONLINEARFILTERHISTOGRAMKERNEL_H__ */
@@ -34,7 +34,7 @@ class ITensor;
 
 /** Interface to perform Non-Maxima suppression over a 3x3 window using NEON
  *
- * @note Used by @ref NEFastCorners and @ref NEHarrisCorners
+ * @note Used by @ref NEFastCorners
  */
 class NENonMaximaSuppression3x3Kernel : public INEKernel
 {
@@ -51,9 +51,10 @@ public:
     /** Set the input and output tensors.
      *
      * @param[in]  input         Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
-     *                           and an optional 4th dimension for batch of inputs. Data types supported: F32.
+     *                           and an optional 4th dimension for batch of inputs. Data types supported: F16/F32.
      * @param[in]  input_squared Source with each element has been squared. 3 lower dims represent a single input with dimensions [width, height, IFM],
-     *                           Data type supported: same as @p input
+     *                           Data type supported: same as @p input. Can be nullptr for @ref NormType::CROSS_MAP: the kernel then squares the input
+     *                           while it slides the normalization window across the feature maps, in a single iteration for all of them.
      * @param[out] output        Destination tensor. Output will have the same number of dimensions as input. Data type supported: same as @p input
      * @param[in]  norm_info     Normalization layer information like the normalization type, normalization size and other parameters.
      */
@@ -61,6 +62,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
     BorderSize border_size() const override;
 
 private:
@@ -72,6 +74,30 @@ private:
      */
     template <unsigned int dim>
     void normalize(const Window &window);
+    /** Function to perform the cross map normalization without the squared input.
+     *
+     * The sum of the squares is updated as the window slides across the feature maps: the cost doesn't depend on the normalization size.
+     *
+     * @param window Region on which to execute the kernel.
+     */
+    void normalize_cross_map_sliding(const Window &window);
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+    /** Function to perform normalization of a half precision tensor depending on the given templates dimension.
+     *
+     * @note The sum of the squares and the normalization are computed in single precision.
+     *
+     * @param window Region on which to execute the kernel.
+     */
+    template <unsigned int dim>
+    void normalize_f16(const Window &window);
+    /** Function to perform the cross map normalization of a half precision tensor without the squared input.
+     *
+     * @note The sum of the squares and the normalization are computed in single precision.
+     *
+     * @param window Region on which to execute the kernel.
+     */
+    void normalize_cross_map_sliding_f16(const Window &window);
+#endif
     /** Common signature for all the specialised normalization functions
      *
      * @param window  Region on which to execute the kernel.
@@ -49,7 +49,11 @@ public:
 
     /** Set the input and output tensors.
      *
-     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[in]  input     Source tensor. Data types supported: U8/F16/F32.
+     *                       U8 tensors are asymmetric quantized tensors: only MAX pooling is supported and @p output must have the same quantization settings as @p input.
+     *                       U8 and F16 only support 2x2 and 3x3 pooling, F32 supports any pooling size as well as global pooling.
+     *                       F32 tensors can also be NHWC [IFM, width, height, batches] or NCHW4 [4 * width, height, ceil(IFM / 4), batches] (See @ref DataLayout):
+     *                       @p output must then have the same layout.
      * @param[out] output    Destination tensor. Data types supported: Same as @p input.
      * @param[in]  pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
      */
@@ -57,6 +61,7 @@ public:
 
     // Inherited methods overridden:
     void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
     BorderSize border_size() const override;
 
 private:
@@ -74,6 +79,62 @@ private:
      */
     template <PoolingType pooling_type>
     void pooling3(const Window &window_input, const Window &window);
+    /** Function to perform pooling of any size.
+     *
+     * The columns of the pooling region are reduced first, 4 elements at a time, then the results of the columns are reduced.
+     * The values are pooled in single precision: the half precision tensors (T = float16_t) are converted in registers.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type, typename T>
+    void poolingN(const Window &window_input, const Window &window);
+    /** Function to perform global pooling: each feature map is reduced to a single value.
+     *
+     * @param[in] window_input Unused: the whole feature map is read for each output element.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_global(const Window &window_input, const Window &window);
+    /** Function to perform pooling of any size, or global pooling, on a single precision NHWC tensor.
+     *
+     * Each iteration computes all the feature maps of one output element, 4 feature maps at a time: padded elements are skipped rather than read from a border.
+     *
+     * @param[in] window_input Unused: the pooling region is computed from the coordinates of the output element.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_nhwc(const Window &window_input, const Window &window);
+    /** Function to perform pooling of any size, or global pooling, on a single precision NCHW4 tensor.
+     *
+     * Each iteration computes a block of 4 feature maps of one output element with vector operations.
+     *
+     * @param[in] window_input Unused: the pooling region is computed from the coordinates of the output element.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling_nchw4(const Window &window_input, const Window &window);
+    /** Function to perform 2x2 pooling on a half precision tensor.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling2_f16(const Window &window_input, const Window &window);
+    /** Function to perform 3x3 pooling on a half precision tensor.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <PoolingType pooling_type>
+    void pooling3_f16(const Window &window_input, const Window &window);
+    /** Function to perform max pooling on a quantized tensor.
+     *
+     * @param[in] window_input Input region on which to execute the kernel.
+     * @param[in] window       Output region on which to execute the kernel.
+     */
+    template <int pool_size>
+    void pooling_max_u8(const Window &window_input, const Window &window);
     /** Common signature for all the specialised Pooling functions
      *
      * @param[in] window_input Input region on which to execute the kernel.
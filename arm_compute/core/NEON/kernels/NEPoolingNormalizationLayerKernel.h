@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel computing a max pooling layer followed by a cross map normalization layer in a single pass.
+ *
+ * Each iteration of the kernel window computes 4 consecutive elements of a row of the output for all the feature maps:
+ * the feature maps are pooled one after the other and the sum of the squares of the @p norm_size pooled feature maps
+ * around the current one is updated in registers as the normalization window slides across the feature maps.
+ * Neither the pooled tensor nor its squares are written to memory.
+ */
+class NEPoolingNormalizationLayerKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEPoolingNormalizationLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPoolingNormalizationLayerKernel(const NEPoolingNormalizationLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEPoolingNormalizationLayerKernel &operator=(const NEPoolingNormalizationLayerKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEPoolingNormalizationLayerKernel(NEPoolingNormalizationLayerKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEPoolingNormalizationLayerKernel &operator=(NEPoolingNormalizationLayerKernel &&) = default;
+    /** Default destructor */
+    ~NEPoolingNormalizationLayerKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
+     *                       and an optional 4th dimension for batch of inputs. Data types supported: F32.
+     * @param[out] output    Destination tensor, normalized output of the pooling layer. Data types supported: Same as @p input.
+     * @param[in]  pool_info Pooling layer information. Only MAX pooling of size 2 or 3 with a horizontal stride of 1 or 2 is supported.
+     * @param[in]  norm_info Normalization layer information. Only @ref NormType::CROSS_MAP is supported.
+     */
+    void configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const NormalizationLayerInfo &norm_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    SchedulingPolicy scheduling_policy() const override;
+    BorderSize border_size() const override;
+
+private:
+    /** Function to pool and normalize 4 output elements of all the feature maps.
+     *
+     * @param[in] window Output region on which to execute the kernel.
+     */
+    template <int pool_size, int pool_stride_x>
+    void pool_normalize(const Window &window);
+    /** Common signature for all the specialised fused pooling and normalization functions
+     *
+     * @param[in] window Output region on which to execute the kernel.
+     */
+    using PoolNormalizeFunction = void (NEPoolingNormalizationLayerKernel::*)(const Window &window);
+
+private:
+    PoolNormalizeFunction  _func;
+    const ITensor         *_input;
+    ITensor               *_output;
+    PoolingLayerInfo       _pool_info;
+    NormalizationLayerInfo _norm_info;
+    BorderSize             _border_size;
+};
+}
+#endif /*__ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYERKERNEL_H__ */
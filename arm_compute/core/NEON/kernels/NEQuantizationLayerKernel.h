@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEQUANTIZATIONLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEQUANTIZATIONLAYERKERNEL_H__
+
+#include "arm_compute/core/NEON/INESimpleKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel converting tensors between floating point and quantized values.
+ *
+ * Valid conversions Input -> Output :
+ *
+ *   - F32 -> U8  : quantized = clamp(round(input / scale) + offset, 0, 255), using the quantization info of the output
+ *   - F32 -> S32 : quantized = round(input / scale), using the scale of the output (Used for the biases of the quantized layers)
+ *   - U8  -> F32 : output = scale * (input - offset), using the quantization info of the input
+ */
+class NEQuantizationLayerKernel : public INESimpleKernel
+{
+public:
+    /** Default constructor */
+    NEQuantizationLayerKernel();
+    /** Set the input and output of the kernel
+     *
+     * @param[in]  input  Source tensor. Data types supported: U8/F32.
+     * @param[out] output Destination tensor with the same shape as the input. Data types supported: U8/S32 if the input is F32, F32 if the input is U8.
+     *                    The quantization info of the quantized tensor (Input if U8, output otherwise) must be set.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Quantize a F32 tensor to U8 */
+    void quantize_u8(const Window &window);
+    /** Quantize a F32 tensor to S32 */
+    void quantize_s32(const Window &window);
+    /** Dequantize a U8 tensor to F32 */
+    void dequantize_u8(const Window &window);
+
+    /** Common signature for all the conversion functions */
+    using QuantizationFunction = void (NEQuantizationLayerKernel::*)(const Window &window);
+
+    QuantizationFunction _func;
+    float                _scale;
+    int                  _offset;
+};
+}
+#endif /*__ARM_COMPUTE_NEQUANTIZATIONLAYERKERNEL_H__ */
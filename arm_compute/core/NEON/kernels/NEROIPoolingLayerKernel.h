@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEROIPOOLINGLAYERKERNEL_H__
+#define __ARM_COMPUTE_NEROIPOOLINGLAYERKERNEL_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the ROI max pooling layer kernel
+ *
+ * Each region of interest is max pooled to a grid of @ref ROIPoolingLayerInfo::pooled_width() x @ref ROIPoolingLayerInfo::pooled_height() bins
+ * of the feature maps of its batch, the way Fast / Faster R-CNN do. All the regions are pooled by the same kernel: the threads share the feature maps.
+ */
+class NEROIPoolingLayerKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEROIPoolingLayerKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEROIPoolingLayerKernel(const NEROIPoolingLayerKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEROIPoolingLayerKernel &operator=(const NEROIPoolingLayerKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEROIPoolingLayerKernel(NEROIPoolingLayerKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEROIPoolingLayerKernel &operator=(NEROIPoolingLayerKernel &&) = default;
+    /** Default destructor */
+    ~NEROIPoolingLayerKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @note Only the first rois->num_values() regions are pooled at each run, the other outputs are left untouched.
+     *
+     * @param[in]  input     Source tensor: feature maps [width, height, channels, batches]. Data types supported: F32.
+     * @param[in]  rois      Regions of interest, in the coordinates of the image the feature maps are computed from.
+     * @param[out] output    Destination tensor [pooled width, pooled height, channels, rois->max_num_values()], ready to be the batched input of a fully connected layer.
+     *                       Data types supported: Same as @p input.
+     * @param[in]  pool_info Contains the size of the output of each region and the scale of the regions described in @ref ROIPoolingLayerInfo.
+     */
+    void configure(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor      *_input;
+    const IROIArray    *_rois;
+    ITensor            *_output;
+    ROIPoolingLayerInfo _pool_info;
+};
+}
+#endif /*__ARM_COMPUTE_NEROIPOOLINGLAYERKERNEL_H__ */
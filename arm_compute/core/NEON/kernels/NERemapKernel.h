@@ -27,6 +27,8 @@
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/Types.h"
 
+#include <cstdint>
+
 namespace arm_compute
 {
 class ITensor;
@@ -57,6 +59,19 @@ public:
      * @param[in]  policy The interpolation type.
      */
     void configure(const ITensor *input, const ITensor *map_x, const ITensor *map_y, ITensor *output, InterpolationPolicy policy);
+    /** Initialize the kernel's input, output and remap table.
+     *
+     * The table holds integer offsets and fixed point weights baked once (e.g. by @ref INEWarpKernel::build_remap_table),
+     * so no coordinate is computed or clamped while running.
+     *
+     * @param[in]  input                 Source tensor. Data type supported: U8.
+     * @param[in]  offsets               Offset in bytes from the first input pixel to the (top-left) source pixel of each output pixel, -1 for border pixels. Data type supported: S32.
+     * @param[in]  fractions             Bilinear weights of each output pixel: (dx | dy << 8) in 1/256 of pixel. Data type supported: U16.
+     *                                   Nearest neighbour interpolation is used if nullptr.
+     * @param[out] output                Destination tensor. Data types supported: U8. Must be the same size as @p offsets.
+     * @param[in]  constant_border_value Value written to the border pixels.
+     */
+    void configure(const ITensor *input, const ITensor *offsets, const ITensor *fractions, ITensor *output, uint8_t constant_border_value);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
@@ -66,13 +81,20 @@ private:
     void remap_nearest(const Window &window);
     /** function to perform bilinear interpolation on the given window */
     void remap_bilinear(const Window &window);
+    /** function to perform nearest interpolation from the remap table on the given window */
+    void remap_table_nearest(const Window &window);
+    /** function to perform bilinear interpolation from the remap table on the given window */
+    void remap_table_bilinear(const Window &window);
     /** Remap function to use for the particular interpolation type passed to configure() */
     void (NERemapKernel::*_func)(const Window &window);
 
-    const ITensor *_input;  /**< Input image */
-    ITensor       *_output; /**< Output image */
-    const ITensor *_map_x;  /**< Input remap x coordinates */
-    const ITensor *_map_y;  /**< Input remap y coordinates */
+    const ITensor *_input;                 /**< Input image */
+    ITensor       *_output;                /**< Output image */
+    const ITensor *_map_x;                 /**< Input remap x coordinates */
+    const ITensor *_map_y;                 /**< Input remap y coordinates */
+    const ITensor *_offsets;               /**< Remap table offsets */
+    const ITensor *_fractions;             /**< Remap table bilinear weights */
+    uint8_t        _constant_border_value; /**< Value of the border pixels of the remap table */
 };
 }
 #endif /*__ARM_COMPUTE_NEREMAPKERNEL_H__ */
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NESCALEAREAKERNEL_H__
+#define __ARM_COMPUTE_NESCALEAREAKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to downscale a tensor by averaging the input pixels covered by each output pixel
+ *
+ * Every output pixel is the mean of the input pixels under its footprint, weighted by how much of each pixel is covered:
+ * downscaling and anti-aliasing happen in the same pass.
+ *
+ * Each output row accumulates the input rows under it column by column, then each output pixel sums the columns under it:
+ * - If the scale ratios are integers (and the whole footprint sums up in 16 bits), the pixels are summed in integers and the result is rounded.
+ * - Otherwise every axis uses fixed point coverage weights in 1/256 of input pixel.
+ */
+class NEScaleAreaKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEScaleAreaKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEScaleAreaKernel(const NEScaleAreaKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEScaleAreaKernel &operator=(const NEScaleAreaKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEScaleAreaKernel(NEScaleAreaKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEScaleAreaKernel &operator=(NEScaleAreaKernel &&) = default;
+    /** Default destructor */
+    ~NEScaleAreaKernel() = default;
+
+    /** Initialise the kernel's input and output.
+     *
+     * @param[in]  input  Source tensor. Data type supported: U8.
+     * @param[out] output Destination tensor. Data type supported: U8. Must not be larger than @p input.
+     *                    All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     */
+    void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Scale the given window when both scale ratios are integers */
+    void scale_integer(const Window &window);
+    /** Scale the given window with fractional coverage weights */
+    void scale_fractional(const Window &window);
+    /** Compute the first input pixel and the coverage weights of each output pixel along one axis
+     *
+     * @param[in]  in_size  Size of the input along the axis.
+     * @param[in]  out_size Size of the output along the axis.
+     * @param[in]  num      Number of entries to compute (Can be larger than @p out_size, the extra entries copy the last one).
+     * @param[out] start    First input pixel covered by each output pixel.
+     * @param[out] weights  @p span weights per output pixel, summing up to 256.
+     * @param[out] span     Number of input pixels read per output pixel.
+     */
+    static void compute_weights(size_t in_size, size_t out_size, size_t num, std::vector<int> &start, std::vector<uint16_t> &weights, unsigned int &span);
+    /** Scale function to use for the particular scale ratios passed to configure() */
+    void (NEScaleAreaKernel::*_func)(const Window &window);
+
+    const ITensor        *_input;     /**< Input image */
+    ITensor              *_output;    /**< Output image */
+    std::vector<int>      _x_start;   /**< First input column of each output column */
+    std::vector<int>      _y_start;   /**< First input row of each output row */
+    std::vector<uint16_t> _x_weights; /**< Coverage weights of the input columns of each output column */
+    std::vector<uint16_t> _y_weights; /**< Coverage weights of the input rows of each output row */
+    unsigned int          _x_span;    /**< Number of input columns read per output column */
+    unsigned int          _y_span;    /**< Number of input rows read per output row */
+};
+}
+#endif /*__ARM_COMPUTE_NESCALEAREAKERNEL_H__ */
@@ -31,7 +31,11 @@ namespace arm_compute
 {
 class ITensor;
 
-/** NEON kernel to perform scaling on a tensor */
+/** NEON kernel to perform scaling on a tensor
+ *
+ * Images with interleaved channels (RGB888, RGBA8888) are scaled without splitting their channels:
+ * all the channels of a pixel are interpolated together.
+ */
 class NEScaleKernel : public INEKernel
 {
 public:
@@ -52,11 +56,11 @@ public:
      *
      * @note dx, dy and offsets have the same dimensions (width and height) of the output tensor
      *
-     * @param[in]  input            Source tensor. Data types supported: U8 or S16.
+     * @param[in]  input            Source tensor. Data types supported: U8 or S16. Formats supported: RGB888, RGBA8888 for multi-channel tensors with NEAREST_NEIGHBOR and BILINEAR interpolation.
      * @param[in]  dx               Pixel's distance between the X real coordinate and the smallest X following integer. Data type supported: F32
      * @param[in]  dy               Pixel's distance between the Y real coordinate and the smallest Y following integer. Data type supported: F32
      * @param[in]  offsets          Offset to access the pixel with NEAREST interpolation or the top-left pixel with BILINEAR interpolation in the input tensor. Data type supported: S32.
-     * @param[out] output           Destination tensor. Data types supported: U8 or S16. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[out] output           Destination tensor. Data types supported: same as @p input. Formats supported: same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]  policy           Interpolation type to use
      * @param[in]  border_undefined True if the border mode is undefined. False if it's replicate or constant.
      */
@@ -69,8 +73,14 @@ public:
 private:
     /** function to perform scale using nearest interpolation on the given window */
     void scale_nearest(const Window &window);
+    /** function to perform scale using nearest interpolation on the given window, for images with N interleaved U8 channels */
+    template <size_t N>
+    void scale_nearest_interleaved(const Window &window);
     /** function to perform scale using bilinear interpolation on the given window */
     void scale_bilinear(const Window &window);
+    /** function to perform scale using bilinear interpolation on the given window, for images with N interleaved U8 channels */
+    template <size_t N>
+    void scale_bilinear_interleaved(const Window &window);
     /** function to perform scale using area interpolation on the given window
      *
      *  @note Used only in case down-sampling.
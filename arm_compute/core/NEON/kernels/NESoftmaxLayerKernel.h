@@ -71,23 +71,32 @@ public:
 
     /** Set the input and output tensors.
      *
-     * @param[in]  input  Source tensor. Data types supported: F32.
-     * @param[in]  max    Max values tensor. Data types supported: same as @p input.
-     * @param[out] output Destination tensor. Data types supported: same as @p input.
-     * @param[out] sum    Sum of 1D logits tensor. Data types supported: same as @p input.
+     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[in]  max       Max values tensor. Data types supported: same as @p input.
+     * @param[out] output    Destination tensor. Data types supported: same as @p input.
+     * @param[out] sum       Sum of 1D logits tensor. Data types supported: same as @p input.
+     * @param[in]  precision (Optional) Accuracy of the approximation of the exponential.
      */
-    void configure(const ITensor *input, const ITensor *max, ITensor *output, ITensor *sum);
+    void configure(const ITensor *input, const ITensor *max, ITensor *output, ITensor *sum, MathPrecision precision = MathPrecision::ACCURATE);
 
     // Inherited methods overridden:
     void run(const Window &window) override;
     BorderSize border_size() const override;
 
 private:
+    /** Shift and exponentiate the rows of a window and compute their sums
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <MathPrecision P>
+    void shift_exp_sum(const Window &window);
+
     const ITensor *_input;
     const ITensor *_max;
     ITensor       *_output;
     ITensor       *_sum;
     BorderSize     _border_size;
+    MathPrecision  _precision;
 };
 
 /** Interface for calculating the final step of the Softmax Layer where each logit value is multiplied by the inverse of the sum of the logits. */
@@ -123,5 +132,37 @@ private:
     const ITensor *_sum;
     ITensor       *_output;
 };
+
+/** Interface for computing the whole Softmax Layer in a single pass over each row of 1D logits.
+ *
+ * The max, the sum of the shifted exponentials and the normalization of a row are computed one after the other while the row is in the cache.
+ * Each iteration processes a whole row: the rows are split between the threads.
+ */
+class NELogits1DSoftmaxKernel : public INESimpleKernel
+{
+public:
+    /** Default constructor */
+    NELogits1DSoftmaxKernel();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[out] output    Destination tensor. Data types supported: same as @p input.
+     * @param[in]  precision (Optional) Accuracy of the approximation of the exponential.
+     */
+    void configure(const ITensor *input, ITensor *output, MathPrecision precision = MathPrecision::ACCURATE);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Compute the softmax of the rows of a window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <MathPrecision P>
+    void softmax(const Window &window);
+
+    MathPrecision _precision;
+};
 }
 #endif /*__ARM_COMPUTE_NESOFTMAXLAYERKERNEL_H__ */
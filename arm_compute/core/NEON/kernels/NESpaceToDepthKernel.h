@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NESPACETODEPTHKERNEL_H__
+#define __ARM_COMPUTE_NESPACETODEPTHKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to move blocks of pixels of a tensor to its channels
+ *
+ * Each block of @p block_size x @p block_size pixels of each channel of the (padded) input becomes a single pixel of @p block_size * @p block_size channels:
+ *
+ * @f[ output(x, y, (c \cdot s + dy) \cdot s + dx) = input(x \cdot s + dx - pad_x, y \cdot s + dy - pad_y, c) @f]
+ *
+ * The output elements which read outside of the input hold 0 (the offset of a quantized input). Applied to both the input and the weights of a convolution
+ * with a stride of s, it rewrites the convolution as a convolution with a stride of 1 over s * s times more channels (See @ref NEConvolutionLayer).
+ */
+class NESpaceToDepthKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NESpaceToDepthKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESpaceToDepthKernel(const NESpaceToDepthKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NESpaceToDepthKernel &operator=(const NESpaceToDepthKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NESpaceToDepthKernel(NESpaceToDepthKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NESpaceToDepthKernel &operator=(NESpaceToDepthKernel &&) = default;
+    /** Default destructor */
+    ~NESpaceToDepthKernel() = default;
+
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input      Source tensor [width, height, channels, ...]. Data types supported: U8/F16/F32.
+     * @param[out] output     Destination tensor [out_width, out_height, channels * block_size * block_size, ...]. Its width and height can be chosen freely:
+     *                        the pixels past the input are padded. The dimensions above 2 must match the ones of @p input. Data types supported: Same as @p input.
+     * @param[in]  block_size Size of the blocks of pixels moved to the channels.
+     * @param[in]  pad_x      Number of padding columns on the left of the input.
+     * @param[in]  pad_y      Number of padding rows on the top of the input.
+     */
+    void configure(const ITensor *input, ITensor *output, unsigned int block_size, unsigned int pad_x, unsigned int pad_y);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Rearrange the rows of the given window
+     *
+     * @param[in] window Region on which to execute the kernel.
+     */
+    template <typename T>
+    void rearrange(const Window &window);
+
+    const ITensor *_input;
+    ITensor       *_output;
+    int            _block_size;
+    int            _pad_x;
+    int            _pad_y;
+};
+}
+#endif /*__ARM_COMPUTE_NESPACETODEPTHKERNEL_H__ */
@@ -63,6 +63,12 @@ private:
      */
     template <class T>
     void tableLookup(const Window &window);
+    /** Perform table lookup on a given window, skipping the elements whose index falls outside of the table.
+     *
+     * @param window window Region on which to execute the kernel.
+     */
+    template <class T>
+    void tableLookup_checked(const Window &window);
     /** Common signature for all the specialised lut functions
      *
      * @param[in] window Region on which to execute the kernel.
@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETILEDREMAPKERNEL_H__
+#define __ARM_COMPUTE_NETILEDREMAPKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to perform a remap from a map compiled to 16 bit fixed point coordinates, tile by tile
+ *
+ * The output is processed in tiles of @ref tile_width x @ref tile_height pixels. The map stores, for each output pixel, the source coordinates
+ * relative to the top-left corner of the source footprint of its tile in 11.5 fixed point, and the corners of the footprints are stored once
+ * per tile (See @ref compile_map()). The source pixels read by a tile are therefore close to each other and stay in the L1 cache while the tile is
+ * computed, whereas a raster walk through a lens undistortion map keeps fetching the same source rows again. The bilinear weights are computed from
+ * the 1/32 of pixel fractions in integer arithmetic.
+ *
+ * @note The map must be compiled for the width and height of the input and the interpolation policy passed to @ref configure().
+ *       It doesn't depend on the padding of the input: it can be compiled once and reused by all the remaps with the same map.
+ */
+class NETiledRemapKernel : public INEKernel
+{
+public:
+    /** Width in pixels of the output tiles */
+    static constexpr unsigned int tile_width = 32;
+    /** Height in pixels of the output tiles */
+    static constexpr unsigned int tile_height = 32;
+
+    /** Default constructor */
+    NETiledRemapKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETiledRemapKernel(const NETiledRemapKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETiledRemapKernel &operator=(const NETiledRemapKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NETiledRemapKernel(NETiledRemapKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NETiledRemapKernel &operator=(NETiledRemapKernel &&) = default;
+    /** Default destructor */
+    ~NETiledRemapKernel() = default;
+
+    /** Shape of the compiled map of an output
+     *
+     * @param[in] output_shape Shape of the output of the remap.
+     *
+     * @return The shape of the map: two coordinates for each pixel of the output, rounded up to a whole number of tiles along X. Data type: U16.
+     */
+    static TensorShape map_shape(const TensorShape &output_shape);
+    /** Shape of the table of the tile origins of an output
+     *
+     * @param[in] output_shape Shape of the output of the remap.
+     *
+     * @return The shape of the table: the X and Y coordinates of the source footprint of each tile. Data type: S32.
+     */
+    static TensorShape tile_origins_shape(const TensorShape &output_shape);
+    /** Compile float maps to the fixed point form read by the kernel.
+     *
+     * The source coordinates are clamped to [-1, width] x [-1, height] like @ref NERemapKernel does, then truncated for nearest neighbour
+     * interpolation or rounded down to 1/32 of pixel for bilinear interpolation.
+     *
+     * @note The source footprint of each tile must be less than 2048 pixels wide and high.
+     *
+     * @param[in]  map_x        Map for X coordinates. Data type supported: F32.
+     * @param[in]  map_y        Map for Y coordinates. Data type supported: F32. Same shape as @p map_x, which is the shape of the output.
+     * @param[in]  input_width  Width of the input of the remap.
+     * @param[in]  input_height Height of the input of the remap.
+     * @param[in]  policy       The interpolation type. Only NEAREST_NEIGHBOR and BILINEAR are supported.
+     * @param[out] map          Compiled map. Data type supported: U16. Shape: @ref map_shape().
+     * @param[out] tile_origins Origins of the source footprints of the tiles. Data type supported: S32. Shape: @ref tile_origins_shape().
+     */
+    static void compile_map(const ITensor *map_x, const ITensor *map_y, size_t input_width, size_t input_height, InterpolationPolicy policy, ITensor *map, ITensor *tile_origins);
+
+    /** Initialize the kernel's input, compiled map and output.
+     *
+     * @param[in]  input        Source tensor. Data type supported: U8.
+     * @param[in]  map          Map compiled by @ref compile_map(). Data type supported: U16.
+     * @param[in]  tile_origins Origins of the source footprints of the tiles compiled by @ref compile_map(). Data type supported: S32.
+     * @param[out] output       Destination tensor. Data types supported: U8.
+     * @param[in]  policy       The interpolation type the map was compiled for.
+     */
+    void configure(const ITensor *input, const ITensor *map, const ITensor *tile_origins, ITensor *output, InterpolationPolicy policy);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+    BorderSize border_size() const override;
+
+private:
+    /** Remap the rows of a tile with nearest neighbour interpolation
+     *
+     * @param[in] src_ptr Pointer to the origin of the source footprint of the tile.
+     * @param[in] x       X coordinate of the first pixel of the tile.
+     * @param[in] y_start Y coordinate of the first row of the tile.
+     * @param[in] y_end   Y coordinate following the last row of the tile.
+     */
+    void remap_tile_nearest(const uint8_t *src_ptr, int x, int y_start, int y_end);
+    /** Remap the rows of a tile with bilinear interpolation
+     *
+     * @param[in] src_ptr Pointer to the origin of the source footprint of the tile.
+     * @param[in] x       X coordinate of the first pixel of the tile.
+     * @param[in] y_start Y coordinate of the first row of the tile.
+     * @param[in] y_end   Y coordinate following the last row of the tile.
+     */
+    void remap_tile_bilinear(const uint8_t *src_ptr, int x, int y_start, int y_end);
+    /** Remap function to use for the particular interpolation type passed to configure() */
+    void (NETiledRemapKernel::*_func)(const uint8_t *src_ptr, int x, int y_start, int y_end);
+
+    const ITensor *_input;        /**< Input image */
+    const ITensor *_map;          /**< Compiled map */
+    const ITensor *_tile_origins; /**< Origins of the source footprints of the tiles */
+    ITensor       *_output;       /**< Output image */
+};
+}
+#endif /*__ARM_COMPUTE_NETILEDREMAPKERNEL_H__ */
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NETOPKVKERNEL_H__
+#define __ARM_COMPUTE_NETOPKVKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Interface for the kernel which finds the k highest values of each row of 1D scores and their indices.
+ *
+ * The values are returned in descending order: ties are ordered by increasing index.
+ * Each iteration processes a whole row: the rows are split between the threads.
+ */
+class NETopKVKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NETopKVKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKVKernel(const NETopKVKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NETopKVKernel &operator=(const NETopKVKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NETopKVKernel(NETopKVKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NETopKVKernel &operator=(NETopKVKernel &&) = default;
+    /** Default destructor */
+    ~NETopKVKernel() = default;
+
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input   Source tensor. The top k is computed along the 1st dimension,
+     *                     while every higher dimension represents a batch of inputs. Data types supported: F32.
+     * @param[out] indices Indices of the top k values of each row. The 1st dimension must be @p k, the other ones must match @p input. Data types supported: U32.
+     * @param[out] scores  Top k values of each row. Same shape as @p indices. Data types supported: same as @p input.
+     * @param[in]  k       Number of values to find in each row. Must not be greater than the 1st dimension of @p input.
+     */
+    void configure(const ITensor *input, ITensor *indices, ITensor *scores, unsigned int k);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor *_input;
+    ITensor       *_indices;
+    ITensor       *_scores;
+    unsigned int   _k;
+};
+}
+#endif /*__ARM_COMPUTE_NETOPKVKERNEL_H__ */
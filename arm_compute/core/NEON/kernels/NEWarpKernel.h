@@ -56,11 +56,31 @@ public:
      * @param[in]  constant_border_value Constant value used for filling the border.
      */
     virtual void configure(const ITensor *input, ITensor *output, const float *matrix, BorderMode border_mode, uint8_t constant_border_value);
+    /** Bake the source coordinates of every output pixel into a remap table for @ref NERemapKernel
+     *
+     * @note The matrix is read once here: the table doesn't follow later changes of its values.
+     * @note The kernel must have been configured and the tables allocated with the shape of the output.
+     *
+     * @param[out] offsets     Offset in bytes from the first input pixel to the (top-left) source pixel of each output pixel,
+     *                         -1 if the source pixel is outside of the input. Data type supported: S32.
+     * @param[out] fractions   Fixed point bilinear weights of each output pixel: (dx | dy << 8) in 1/256 of pixel. Data type supported: U16.
+     *                         Must be nullptr for nearest neighbour interpolation.
+     * @param[in]  border_mode Strategy to use for borders. With REPLICATE, the source pixels outside of the input are replaced by the closest edge pixel.
+     */
+    void build_remap_table(ITensor *offsets, ITensor *fractions, BorderMode border_mode) const;
 
     // Inherited methods overridden:
     void run(const Window &window) override;
 
 protected:
+    /** Compute the input coordinates an output pixel is sampled from
+     *
+     * @param[in]  x  X coordinate of the output pixel.
+     * @param[in]  y  Y coordinate of the output pixel.
+     * @param[out] x0 X coordinate of the source pixel.
+     * @param[out] y0 Y coordinate of the source pixel.
+     */
+    virtual void map_coordinates(int x, int y, float &x0, float &y0) const = 0;
     /** function to perform warp affine or warp perspective on the given window when border mode == UNDEFINED
      *
      *  @param[in] window Region on which to execute the kernel
@@ -99,6 +119,7 @@ private:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    void map_coordinates(int x, int y, float &x0, float &y0) const override;
 };
 
 /** Template interface for the kernel to compute warp perspective
@@ -107,11 +128,39 @@ private:
 template <InterpolationPolicy interpolation>
 class NEWarpPerspectiveKernel : public INEWarpKernel
 {
+public:
+    /** Default constructor */
+    NEWarpPerspectiveKernel();
+    /** Approximate the perspective mapping by an affine mapping on segments of the output rows, within a bound on the error.
+     *
+     * The source coordinates are only computed exactly, with a division, at the ends of the segments and linearly interpolated in between.
+     * The length of the segments of each row is derived from the curvature of the mapping along the row so that the interpolated
+     * coordinates are at most @p max_error pixels away from the exact ones: it increases as the homography gets closer to an affine transform.
+     *
+     * @param[in] max_error Maximum distance in pixels between the approximated and the exact source coordinates, e.g. 1/16.
+     *                      0 (default) computes the exact coordinates of every output pixel.
+     */
+    void set_max_error(float max_error);
+
+    // Inherited methods overridden:
+    void configure(const ITensor *input, ITensor *output, const float *matrix, BorderMode border_mode, uint8_t constant_border_value) override;
+    void run(const Window &window) override;
+
 private:
+    /** Warp perspective on the given window with the approximated coordinates, for any border mode
+     *
+     * @param[in] window Region on which to execute the kernel
+     */
+    void warp_approximate(const Window &window);
+
     // Inherited methods overridden:
     void warp_undefined(const Window &window) override;
     void warp_constant(const Window &window) override;
     void warp_replicate(const Window &window) override;
+    void map_coordinates(int x, int y, float &x0, float &y0) const override;
+
+    float      _max_error;   /**< Maximum error of the approximated source coordinates, 0 to compute them exactly */
+    BorderMode _border_mode; /**< Border mode passed to configure() */
 };
 }
 #endif /*__ARM_COMPUTE_NEWARPKERNEL_H__ */
@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEWINOGRADFILTERTRANSFORMKERNEL_H__
+#define __ARM_COMPUTE_NEWINOGRADFILTERTRANSFORMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to transform the 3x3 kernels of a convolution layer into the Winograd F(2x2, 3x3) domain.
+ *
+ * Each 3x3 kernel g is transformed into the 4x4 tile U = G * g * G', where:
+ *
+ * @f[
+ * G = \left( \begin{array}{ccc}
+ *        1 &    0 &   0 \\
+ *      1/2 &  1/2 & 1/2 \\
+ *      1/2 & -1/2 & 1/2 \\
+ *        0 &    0 &   1 \\
+ *      \end{array} \right)
+ * @f]
+ *
+ * The 16 values of the tile are stored as 16 matrices of [OFM, IFM] elements, one for each element of the tile:
+ * element k of tile U(ofm, ifm) is stored in matrix k, column ofm, row ifm.
+ * Each matrix is the right hand side of the element-wise products computed by @ref NEGEMMMatrixMultiplyKernel.
+ */
+class NEWinogradFilterTransformKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEWinogradFilterTransformKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradFilterTransformKernel(const NEWinogradFilterTransformKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradFilterTransformKernel &operator=(const NEWinogradFilterTransformKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradFilterTransformKernel(NEWinogradFilterTransformKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradFilterTransformKernel &operator=(NEWinogradFilterTransformKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradFilterTransformKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  weights Weights tensor. Weights are 4D tensor with dimensions [3, 3, IFM, OFM]. Data types supported: F32.
+     * @param[out] output  Destination tensor with dimensions [OFM, IFM, 16]. Data types supported: Same as @p weights.
+     */
+    void configure(const ITensor *weights, ITensor *output);
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    const ITensor *_weights;
+    ITensor       *_output;
+};
+}
+#endif /*__ARM_COMPUTE_NEWINOGRADFILTERTRANSFORMKERNEL_H__ */
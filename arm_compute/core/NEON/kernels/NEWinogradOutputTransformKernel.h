@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEWINOGRADOUTPUTTRANSFORMKERNEL_H__
+#define __ARM_COMPUTE_NEWINOGRADOUTPUTTRANSFORMKERNEL_H__
+
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** NEON kernel to transform the element-wise products of a Winograd F(2x2, 3x3) convolution back into the output of the convolution layer.
+ *
+ * Each 4x4 tile M of products is transformed into the 2x2 output tile Y = A' * M * A, where:
+ *
+ * @f[
+ * A' = \left( \begin{array}{cccc}
+ *      1 &  1 &  1 &  0 \\
+ *      0 &  1 & -1 & -1 \\
+ *      \end{array} \right)
+ * @f]
+ *
+ * The biases and an optional activation function are applied while the output is stored.
+ * The tiles crossing the right or bottom edge of the output are clipped.
+ */
+class NEWinogradOutputTransformKernel : public INEKernel
+{
+public:
+    /** Default constructor */
+    NEWinogradOutputTransformKernel();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradOutputTransformKernel(const NEWinogradOutputTransformKernel &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEWinogradOutputTransformKernel &operator=(const NEWinogradOutputTransformKernel &) = delete;
+    /** Allow instances of this class to be moved */
+    NEWinogradOutputTransformKernel(NEWinogradOutputTransformKernel &&) = default;
+    /** Allow instances of this class to be moved */
+    NEWinogradOutputTransformKernel &operator=(NEWinogradOutputTransformKernel &&) = default;
+    /** Default destructor */
+    ~NEWinogradOutputTransformKernel() = default;
+    /** Set the input and output of the kernel.
+     *
+     * @param[in]  input    Element-wise products with dimensions [OFM, number of tiles, 16], laid out as the output of @ref NEWinogradInputTransformKernel. Data types supported: F32.
+     * @param[in]  biases   Biases tensor. Biases are 1D tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output   Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                      Data types supported: Same as @p input.
+     * @param[in]  act_info (Optional) Activation function applied to the output values. Disabled by default.
+     */
+    void configure(const ITensor *input, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+
+    // Inherited methods overridden:
+    void run(const Window &window) override;
+
+private:
+    /** Common signature for the functions applying the activation function to an output value
+     *
+     * @param[in] x Output value.
+     * @param[in] a Alpha parameter of the activation function.
+     * @param[in] b Beta parameter of the activation function.
+     *
+     * @return The activated value.
+     */
+    using ActivationFunctionPtr = float (*)(float x, float a, float b);
+
+    ActivationFunctionPtr _act_func;
+    const ITensor        *_input;
+    const ITensor        *_biases;
+    ITensor              *_output;
+    ActivationLayerInfo   _act_info;
+    int                   _num_tiles_x;
+    int                   _num_tiles_y;
+};
+}
+#endif /*__ARM_COMPUTE_NEWINOGRADOUTPUTTRANSFORMKERNEL_H__ */
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMLOWPDOTPRODUCT_H__
+#define __ARM_COMPUTE_NEGEMMLOWPDOTPRODUCT_H__
+
+#include <cstdint>
+
+namespace arm_compute
+{
+class ITensor;
+class Window;
+
+/** 8-bit dot product paths of the GEMMLowp kernels
+ *
+ * They use the UDOT instructions of the ARMv8.2-A dot product extension, which accumulate 4 products of 8-bit values in each 32-bit lane.
+ * They are compiled in their own translation unit (dotprod=1) so that the rest of the library still runs on any ARMv8-A CPU.
+ * They must only be called if @ref cpu_features reports dot_product.
+ *
+ * The matrices keep the layouts of @ref NEGEMMInterleave4x4Kernel and @ref NEGEMMTranspose1xWKernel: each 4x4 block of bytes,
+ * holding 4 consecutive elements of the dot product for 4 rows (or columns), is transposed in registers with a single table lookup
+ * so that the 4 elements of each row are contiguous. The offsets are applied to the 32-bit results from the sums of the rows of A and of the columns of B.
+ */
+namespace dotprod
+{
+/** Quantization parameters of a GEMMLowp product (See @ref NEGEMMLowpMatrixMultiplyKernel::configure) */
+struct QuantizationParameters
+{
+    int32_t a_offset;        /**< Offset added to each element of the matrix A */
+    int32_t b_offset;        /**< Offset added to each element of the matrix B */
+    int32_t output_offset;   /**< Offset added to each element of the product */
+    int32_t output_mult_int; /**< Multiplier of the product */
+    int32_t shift;           /**< Right shift of the product */
+    int32_t result_offset;   /**< Offset added to each element of the requantized product */
+    uint8_t min_bound;       /**< Lower bound of the fused activation function */
+    uint8_t max_bound;       /**< Upper bound of the fused activation function */
+};
+
+/** Multiply the interleaved matrix A by the transposed matrix B (See @ref NEGEMMLowpMatrixMultiplyKernel::configure)
+ *
+ * @param[in]  input0 Interleaved matrix A. Data type supported: U8
+ * @param[in]  input1 Transposed matrix B. Data type supported: same as @p input0
+ * @param[in]  biases Biases added to each row of the product. Can be nullptr. Data type supported: S32
+ * @param[out] output Output matrix. Data type supported: same as @p input0
+ * @param[in]  window Region on which to execute the kernel: each iteration computes a 4x4 block of the output
+ * @param[in]  params Quantization parameters of the product
+ */
+void matrix_multiply(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, const QuantizationParameters &params);
+/** Multiply the weights of a quantized convolution layer by its im2col reshaped input (See @ref NEGEMMLowpMatrixMultiplyKernel::configure_convolution)
+ *
+ * @param[in]  input0 Weights transposed in blocks of 4 output feature maps. Data type supported: U8
+ * @param[in]  input1 Im2col reshaped input of the layer, transposed in blocks of 4. Data type supported: same as @p input0
+ * @param[in]  biases Biases of the output feature maps. Can be nullptr. Data type supported: S32
+ * @param[out] output Output of the convolution layer. Data type supported: same as @p input0
+ * @param[in]  window Region on which to execute the kernel: each iteration computes 4 output feature maps of 16 output elements
+ * @param[in]  params Quantization parameters of the product
+ */
+void matrix_multiply_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, const QuantizationParameters &params);
+} // namespace dotprod
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMLOWPDOTPRODUCT_H__ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEGEMMFP16_H__
+#define __ARM_COMPUTE_NEGEMMFP16_H__
+
+#include "arm_compute/core/Types.h"
+
+#include <arm_neon.h>
+
+namespace arm_compute
+{
+class ITensor;
+class Window;
+
+/** Half precision paths of the GEMM kernels
+ *
+ * They are compiled in their own translation unit so that, with multi_isa=1, only they are compiled for ARMv8.2-A
+ * while the rest of the library still runs on any ARMv8-A CPU. They must only be called if @ref cpu_features reports fp16.
+ */
+namespace fp16
+{
+/** Activation function applied to 4 single precision values, with the parameters a and b of the activation (See @ref vactivateq_f32) */
+using ActivationFunctionPtr = float32x4_t (*)(const float32x4_t &x, const float32x4_t &a, const float32x4_t &b);
+
+/** Multiply the interleaved matrix A by the transposed matrix B (See @ref NEGEMMMatrixMultiplyKernel::configure)
+ *
+ * @param[in]  input0   Interleaved matrix A. Data type supported: F16
+ * @param[in]  input1   Transposed matrix B. Data type supported: same as @p input0
+ * @param[in]  biases   Biases weighted by @p beta and added to the product, a row vector or a matrix of the output's size. Can be nullptr. Data type supported: same as @p input0
+ * @param[out] output   Output matrix. Data type supported: same as @p input0
+ * @param[in]  window   Region on which to execute the kernel
+ * @param[in]  alpha    Weight of the product
+ * @param[in]  beta     Weight of the biases
+ * @param[in]  act_func Activation function applied to the output. Can be nullptr
+ * @param[in]  act_info Parameters of the activation function
+ */
+void matrix_matrix_multiply(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, float alpha, float beta,
+                            ActivationFunctionPtr act_func, const ActivationLayerInfo &act_info);
+/** Multiply the weights of a convolution layer by its im2col reshaped input (See @ref NEGEMMMatrixMultiplyKernel::configure_convolution)
+ *
+ * @param[in]  input0   Weights transposed in blocks of 8 output feature maps. Data type supported: F16
+ * @param[in]  input1   Im2col reshaped input of the layer, transposed in blocks of 4. Data type supported: same as @p input0
+ * @param[in]  biases   Biases of the output feature maps. Can be nullptr. Data type supported: same as @p input0
+ * @param[out] output   Output of the convolution layer. Data type supported: same as @p input0
+ * @param[in]  window   Region on which to execute the kernel
+ * @param[in]  act_func Activation function applied to the output. Can be nullptr
+ * @param[in]  act_info Parameters of the activation function
+ */
+void matrix_matrix_multiply_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window,
+                                        ActivationFunctionPtr act_func, const ActivationLayerInfo &act_info);
+/** Accumulate the matrix @p input weighted by @p beta into @p output (See @ref NEGEMMMatrixAdditionKernel)
+ *
+ * @param[in]      input  Input matrix. Data type supported: F16
+ * @param[in, out] output Output matrix. Data type supported: same as @p input
+ * @param[in]      window Region on which to execute the kernel
+ * @param[in]      beta   Weight of @p input
+ */
+void matrix_addition(const ITensor *input, ITensor *output, const Window &window, float beta);
+} // namespace fp16
+} // namespace arm_compute
+#endif /*__ARM_COMPUTE_NEGEMMFP16_H__ */
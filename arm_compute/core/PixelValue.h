@@ -26,6 +26,10 @@
 
 #include <cstdint>
 
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+#include <arm_neon.h>
+#endif
+
 namespace arm_compute
 {
 /** Class describing the value of a pixel for any image format. */
@@ -154,6 +158,16 @@ public:
     {
         v = value.f32;
     }
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+    /** Interpret the pixel value as a F16: the F32 value is converted to half precision
+     *
+     * @param[out] v Returned value
+     */
+    void get(float16_t &v) const
+    {
+        v = static_cast<float16_t>(value.f32);
+    }
+#endif
 };
 }
 #endif /* __ARM_COMPUTE_PIXELVALUE_H__ */
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_STARTUPPROFILER_H__
+#define __ARM_COMPUTE_STARTUPPROFILER_H__
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+/** Kind of one-time work recorded by the @ref StartupProfiler */
+enum class StartupStage
+{
+    CONFIGURE,     /**< configure() of a function, including the program builds it triggers */
+    ALLOCATE,      /**< allocate() of a tensor or of a memory planner */
+    PROGRAM_BUILD, /**< Build of an OpenCL program */
+    WEIGHTS_LOAD,  /**< Loading of the constant inputs, e.g. the mapping of a model file */
+    FIRST_RUN      /**< One-time work of the first run, e.g. the reshape of the weights (See IFunction::prepare()) */
+};
+
+/** Where a built OpenCL program comes from */
+enum class ProgramSource
+{
+    NONE,         /**< Not a program build */
+    COMPILED,     /**< Compiled from its source: not in the binary cache, or the cache is disabled */
+    BINARY_CACHE, /**< Loaded from the binary cache */
+    BACKGROUND    /**< Waited for a build started in the background (See CLKernelLibrary::precompile()) */
+};
+
+/** Record of one piece of startup work */
+struct StartupEntry
+{
+    StartupStage  stage;    /**< Kind of work */
+    std::string   function; /**< Function the work belongs to (See @ref StartupFunctionScope), empty if none */
+    std::string   detail;   /**< Name of the program, path of the model file... */
+    double        start;    /**< Start time in microseconds relative to the start of the session */
+    double        duration; /**< Duration in microseconds */
+    size_t        bytes;    /**< Size of the allocation or of the loaded data, 0 if not applicable */
+    ProgramSource source;   /**< Where the program comes from (@ref StartupStage::PROGRAM_BUILD only) */
+};
+
+/** Records where the time goes before the first inference: configure(), allocate(), program builds, weights loading and first runs.
+ *
+ * Recording is disabled by default: the instrumented code only checks @ref is_enabled(). A session is typically started before the
+ * functions are created and stopped after their first run, then @ref print_report() breaks the time down per function.
+ *
+ * The work is attributed to the function named by the innermost @ref StartupFunctionScope of the calling thread.
+ *
+ * @note The stages nest: a configure() includes the program builds and the allocations it triggers, which are reported on their own too.
+ */
+class StartupProfiler
+{
+private:
+    /** Constructor */
+    StartupProfiler();
+
+public:
+    /** Access the startup profiler singleton
+     *
+     * @return The startup profiler
+     */
+    static StartupProfiler &get();
+    /** Clear the previous records and start recording */
+    void start();
+    /** Stop recording */
+    void stop();
+    /** Returns true if a session is running
+     *
+     * @return True if the startup work is being recorded.
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Time elapsed since the start of the session
+     *
+     * @return The time in microseconds.
+     */
+    double now() const;
+    /** Name of the function the work of the calling thread belongs to
+     *
+     * @return The name set by the innermost @ref StartupFunctionScope of the thread, empty if none.
+     */
+    static const std::string &current_function();
+    /** Record a piece of startup work of the calling thread
+     *
+     * @param[in] stage  Kind of work.
+     * @param[in] detail Name of the program, path of the model file...
+     * @param[in] start  Start time in microseconds (See @ref now()).
+     * @param[in] end    End time in microseconds.
+     * @param[in] bytes  (Optional) Size of the allocation or of the loaded data.
+     * @param[in] source (Optional) Where the program comes from (@ref StartupStage::PROGRAM_BUILD only).
+     */
+    void add(StartupStage stage, std::string detail, double start, double end, size_t bytes = 0, ProgramSource source = ProgramSource::NONE);
+    /** Records of the current (or last) session
+     *
+     * @return The records in the order the work completed.
+     */
+    const std::vector<StartupEntry> &entries() const
+    {
+        return _entries;
+    }
+    /** Print the time spent in each stage and the program cache hits and misses per function, the duration of the session and the slowest program builds
+     *
+     * @param[out] os Stream to print the report to.
+     */
+    void print_report(std::ostream &os) const;
+
+private:
+    std::atomic<bool>                     _enabled;  /**< Whether a session is running */
+    std::chrono::steady_clock::time_point _origin;   /**< Start time of the session */
+    double                                _duration; /**< Duration in microseconds of the last session, once stopped */
+    std::vector<StartupEntry>             _entries;  /**< Records of the session */
+    mutable std::mutex                    _mtx;      /**< Mutex protecting the records */
+};
+
+/** Name the function the startup work of the calling thread belongs to, until the end of the scope */
+class StartupFunctionScope
+{
+public:
+    /** Set the function of the calling thread
+     *
+     * @param[in] function Name of the function, e.g. its layer in a network.
+     */
+    explicit StartupFunctionScope(std::string function);
+    /** Prevent instances of this class from being copied */
+    StartupFunctionScope(const StartupFunctionScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    StartupFunctionScope &operator=(const StartupFunctionScope &) = delete;
+    /** Restore the previous function of the calling thread */
+    ~StartupFunctionScope();
+
+private:
+    std::string _previous; /**< Function of the enclosing scope */
+};
+
+/** Record the time spent in a scope as startup work, if a session is running when the scope starts */
+class StartupScope
+{
+public:
+    /** Start timing the scope
+     *
+     * @param[in] stage  Kind of work.
+     * @param[in] detail (Optional) Name of the program, path of the model file...
+     * @param[in] bytes  (Optional) Size of the allocation or of the loaded data.
+     */
+    explicit StartupScope(StartupStage stage, std::string detail = "", size_t bytes = 0);
+    /** Prevent instances of this class from being copied */
+    StartupScope(const StartupScope &) = delete;
+    /** Prevent instances of this class from being copied */
+    StartupScope &operator=(const StartupScope &) = delete;
+    /** Record the scope */
+    ~StartupScope();
+    /** Set where the program built in the scope comes from
+     *
+     * @param[in] source Source of the program.
+     */
+    void set_source(ProgramSource source)
+    {
+        _source = source;
+    }
+    /** Set the size of the data the scope allocated or loaded
+     *
+     * @param[in] bytes Size in bytes.
+     */
+    void set_bytes(size_t bytes)
+    {
+        _bytes = bytes;
+    }
+
+private:
+    bool          _enabled; /**< Whether the scope is recorded */
+    StartupStage  _stage;   /**< Kind of work */
+    std::string   _detail;  /**< Name of the program, path of the model file... */
+    size_t        _bytes;   /**< Size of the allocation or of the loaded data */
+    ProgramSource _source;  /**< Where the program comes from */
+    double        _start;   /**< Start time in microseconds */
+};
+}
+#endif /* __ARM_COMPUTE_STARTUPPROFILER_H__ */
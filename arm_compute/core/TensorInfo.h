@@ -174,6 +174,14 @@ public:
      * @return True if the strides, offset and total size have changed.
      */
     bool extend_padding(const PaddingSize &padding);
+    /** Set the padding of a tensor whose memory layout is already fixed, e.g. a sub-tensor sharing the memory of its parent.
+     *
+     * @note The strides, offset to the first element and total size are left unchanged and the tensor becomes non resizable:
+     *       kernels can use the padding but not extend it.
+     *
+     * @param[in] padding Padding around the XY plane in number of elements, which must be part of the memory of the tensor.
+     */
+    void set_fixed_padding(const PaddingSize &padding);
     /** Set the format of an already initialized tensor.
      *
      * @note The passed format must be compatible with the existing number of channels and data type of the tensor.
@@ -322,6 +330,40 @@ public:
     {
         _valid_region = std::move(valid_region);
     }
+    /** Quantization settings of the tensor (asymmetric 8-bit tensors only).
+     *
+     * @return The quantization settings, empty if the tensor is not quantized.
+     */
+    QuantizationInfo quantization_info() const
+    {
+        return _quantization_info;
+    }
+    /** Set the quantization settings of the tensor.
+     *
+     * @param[in] quantization_info Scale and offset of the quantized values.
+     */
+    void set_quantization_info(QuantizationInfo quantization_info)
+    {
+        _quantization_info = quantization_info;
+    }
+    /** Order of the elements of the tensor if it holds feature maps.
+     *
+     * @note The layout only tells the functions which dimension of the shape holds the channels (See @ref get_data_layout_dimension_index()).
+     *
+     * @return The data layout of the tensor (@ref DataLayout::NCHW by default).
+     */
+    DataLayout data_layout() const
+    {
+        return _data_layout;
+    }
+    /** Set the order of the elements of the tensor.
+     *
+     * @param[in] data_layout Data layout of the tensor. The shape of the tensor must already be in this order.
+     */
+    void set_data_layout(DataLayout data_layout)
+    {
+        _data_layout = data_layout;
+    }
 
 private:
     /** Calculates strides, offset and total size resulting from the specified padding around the XY plane.
@@ -330,17 +372,19 @@ private:
      */
     std::tuple<Strides, size_t, size_t> calculate_padding_requirements(const PaddingSize &padding);
 
-    size_t      _total_size;
-    size_t      _fixed_point_pos;
-    size_t      _offset_first_element_in_bytes;
-    Strides     _strides_in_bytes;
-    size_t      _num_channels;
-    TensorShape _tensor_shape;
-    DataType    _data_type;
-    Format      _format;
-    bool        _is_resizable;
-    ValidRegion _valid_region;
-    PaddingSize _padding;
+    size_t           _total_size;
+    size_t           _fixed_point_pos;
+    size_t           _offset_first_element_in_bytes;
+    Strides          _strides_in_bytes;
+    size_t           _num_channels;
+    TensorShape      _tensor_shape;
+    DataType         _data_type;
+    Format           _format;
+    bool             _is_resizable;
+    ValidRegion      _valid_region;
+    PaddingSize      _padding;
+    QuantizationInfo _quantization_info;
+    DataLayout       _data_layout;
 };
 }
 #endif /*__ARM_COMPUTE_TENSORINFO_H__ */
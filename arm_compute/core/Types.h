@@ -27,6 +27,8 @@
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/TensorShape.h"
 
+#include <algorithm>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <string>
@@ -74,6 +76,24 @@ enum class DataType
     SIZET
 };
 
+/** Order of the elements of a tensor holding feature maps */
+enum class DataLayout
+{
+    NCHW,  /**< The elements of a feature map are contiguous: the shape of the tensor is [width, height, channels, batches] */
+    NHWC,  /**< The channels of an element are contiguous: the shape of the tensor is [channels, width, height, batches] */
+    NCHW4  /**< The channels are split in blocks of 4 interleaved along X, so that a 128-bit register holds 4 single precision channels of an element:
+                the shape of the tensor is [4 * width, height, ceil(channels / 4), batches]. The missing channels of the last block are zeros. */
+};
+
+/** Dimensions of a tensor holding feature maps, whatever its @ref DataLayout */
+enum class DataLayoutDimension
+{
+    WIDTH,   /**< Width of the feature maps */
+    HEIGHT,  /**< Height of the feature maps */
+    CHANNEL, /**< Feature maps */
+    BATCHES  /**< Batches of feature maps */
+};
+
 /** Constant value of the border pixels when using BorderMode::CONSTANT */
 constexpr uint8_t CONSTANT_BORDER_VALUE = 199;
 
@@ -83,6 +103,61 @@ constexpr float SCALE_PYRAMID_HALF = 0.5f;
 /* Constant value used to indicate a ORB scaled pyramid */
 constexpr float SCALE_PYRAMID_ORB = 8.408964152537146130583778358414e-01;
 
+/** Quantization settings of an asymmetric 8-bit tensor (@ref DataType::U8)
+ *
+ * A quantized value q represents the real value scale * (q - offset): the real value 0 is represented exactly by the offset.
+ */
+struct QuantizationInfo
+{
+    /** Default constructor: the tensor is not quantized */
+    QuantizationInfo()
+        : scale{ 0.f }, offset{ 0 }
+    {
+    }
+
+    /** Quantization with the given scale and offset
+     *
+     * @param[in] scale_value  Real value of one quantization step.
+     * @param[in] offset_value Quantized value representing the real value 0.
+     */
+    QuantizationInfo(float scale_value, int offset_value)
+        : scale{ scale_value }, offset{ offset_value }
+    {
+    }
+
+    /** Check if the quantization settings are unset */
+    bool empty() const
+    {
+        return scale == 0.f;
+    }
+
+    /** Quantize a real value, rounding it to the nearest quantization step and saturating it to [0, 255]
+     *
+     * @param[in] value Real value to quantize.
+     *
+     * @return The quantized value
+     */
+    uint8_t quantize(float value) const
+    {
+        const int quantized = static_cast<int>(std::lround(value / scale)) + offset;
+        return static_cast<uint8_t>(std::max(0, std::min(255, quantized)));
+    }
+
+    /** Dequantize a quantized value
+     *
+     * @param[in] value Quantized value.
+     *
+     * @return The real value represented by @p value
+     */
+    float dequantize(uint8_t value) const
+    {
+        return scale * (static_cast<int>(value) - offset);
+    }
+
+    float scale;  /**< Real value of one quantization step */
+    int   offset; /**< Quantized value representing the real value 0 */
+};
+
 struct ValidRegion
 {
     ValidRegion()
@@ -226,6 +301,13 @@ enum class RoundingPolicy
     TO_NEAREST_EVEN /**< Rounds to nearest even output value */
 };
 
+/** Accuracy of the approximations of the transcendental functions (exponential, hyperbolic tangent, reciprocal) */
+enum class MathPrecision
+{
+    ACCURATE, /**< Higher degree polynomials and two Newton-Raphson steps for the reciprocal */
+    FAST      /**< Lower degree polynomials and a single Newton-Raphson step for the reciprocal: up to about 1e-5 relative error */
+};
+
 /** Termination criteria */
 enum class Termination
 {
@@ -251,6 +333,24 @@ enum class PhaseType
     UNSIGNED /**< Angle range: [0, 180] */
 };
 
+/** Filter computing the horizontal and vertical gradients of an image */
+enum class GradientType
+{
+    DERIVATIVE, /**< Central difference [-1 0 1], as used by HOG. Gradients of type S16 */
+    SOBEL_3x3,  /**< 3x3 Sobel filter. Gradients of type S16 */
+    SOBEL_5x5,  /**< 5x5 Sobel filter. Gradients of type S16 */
+    SOBEL_7x7,  /**< 7x7 Sobel filter. Gradients of type S32 */
+    SCHARR_3x3  /**< 3x3 Scharr filter. Gradients of type S16 */
+};
+
+/** Precision of the magnitude and the phase computed from a gradient */
+enum class MagnitudePhaseApproximation
+{
+    ACCURATE, /**< Third degree atan2 polynomial on the octant reduced ratio (max error of 0.1 degree) and square root refined with two Newton-Raphson steps */
+    FAST,     /**< Second degree atan2 polynomial on the octant reduced ratio (max error of 0.25 degree) and square root refined with a single Newton-Raphson step */
+    BINS      /**< Like FAST for the magnitude, but the phase is the index of the orientation bin of the gradient, found by comparing its slope with the ones of the bin boundaries */
+};
+
 /** Keypoint type */
 struct KeyPoint
 {
@@ -323,6 +423,15 @@ enum class NonLinearFilterFunction : unsigned
     MAX    = 2, /**< Non linear dilate. */
 };
 
+/** Available morphological operations */
+enum class MorphologyOperation
+{
+    ERODE,  /**< Minimum over the structuring element. */
+    DILATE, /**< Maximum over the structuring element. */
+    OPEN,   /**< Erode followed by dilate. */
+    CLOSE   /**< Dilate followed by erode. */
+};
+
 /** The normalization type used for the normalization layer */
 enum class NormType
 {
@@ -355,6 +464,16 @@ struct DetectionWindow
     float    score{ 0.f };   /**< Confidence value for the detection window */
 };
 
+/** Region of interest of a batch of feature maps, e.g. a proposal of a two-stage detector */
+struct ROI
+{
+    uint16_t x{ 0 };         /**< Top-left x coordinate, in the coordinates of the image the feature maps are computed from */
+    uint16_t y{ 0 };         /**< Top-left y coordinate, in the coordinates of the image the feature maps are computed from */
+    uint16_t width{ 0 };     /**< Width of the region */
+    uint16_t height{ 0 };    /**< Height of the region */
+    uint32_t batch_idx{ 0 }; /**< Index of the feature maps of the region in the batch */
+};
+
 /** Dimension rounding type when down-scaling on CNNs
  * @note Used in pooling and convolution layer
  */
@@ -371,6 +490,65 @@ enum class PoolingType
     AVG  /**< Average Pooling */
 };
 
+/** Methods available to distribute the execution window of a kernel among threads */
+enum class SchedulingPolicy
+{
+    STATIC, /**< The window is split in as many equal parts as there are threads */
+    DYNAMIC /**< The window is split in many more parts than there are threads: each thread pulls the next part from a shared queue as soon as it's done with the previous one */
+};
+
+/** Estimate of the work of a kernel on a window, used by the scheduler to pick the number of threads (See @ref ICPPKernel::cost()) */
+struct KernelCost
+{
+    size_t bytes; /**< Number of bytes read and written */
+    size_t ops;   /**< Number of arithmetic operations */
+};
+
+/** Available implementations of the matrix multiplication */
+enum class GEMMBackend
+{
+    INTERLEAVED, /**< Interleave matrix A and transpose matrix B, then compute blocks of 4x16 elements over the whole K dimension */
+    BLOCKED,     /**< Pack cache-sized blocks of matrix A and matrix B, then compute each block of the output with a register-tiled micro-kernel */
+    SMALL,       /**< Compute blocks of 4x16 elements directly from matrix A and matrix B: for small matrices, reshaping them costs more than the multiplication */
+    AUTO         /**< Use @ref GEMMBackend::SMALL if the multiplication is under the sizes of @ref GEMMSmallThresholds, @ref GEMMBackend::INTERLEAVED otherwise */
+};
+
+/** Sizes under which a matrix multiplication is small enough to be computed without reshaping the matrices
+ *
+ * The multiplication of a matrix A of M rows and K columns by a matrix B of K rows and N columns is small if any of M, N or K is not greater than its threshold.
+ * The best thresholds depend on the CPU: the default ones can be replaced by values tuned for the target.
+ */
+struct GEMMSmallThresholds
+{
+    /** Constructor
+     *
+     * @param[in] m (Optional) Maximum number of rows of matrix A.
+     * @param[in] n (Optional) Maximum number of columns of matrix B.
+     * @param[in] k (Optional) Maximum number of columns of matrix A.
+     */
+    GEMMSmallThresholds(unsigned int m = 8, unsigned int n = 16, unsigned int k = 16)
+        : max_m{ m }, max_n{ n }, max_k{ k }
+    {
+    }
+
+    /** Check if a matrix multiplication is under the thresholds
+     *
+     * @param[in] m Number of rows of matrix A.
+     * @param[in] n Number of columns of matrix B.
+     * @param[in] k Number of columns of matrix A.
+     *
+     * @return True if the multiplication is small
+     */
+    bool is_small(unsigned int m, unsigned int n, unsigned int k) const
+    {
+        return (m <= max_m) || (n <= max_n) || (k <= max_k);
+    }
+
+    unsigned int max_m; /**< Maximum number of rows of matrix A */
+    unsigned int max_n; /**< Maximum number of columns of matrix B */
+    unsigned int max_k; /**< Maximum number of columns of matrix A */
+};
+
 /** Padding and stride information class */
 class PadStrideInfo
 {
@@ -414,14 +592,27 @@ private:
 class PoolingLayerInfo
 {
 public:
-    /** Default Constructor
+    /** Default Constructor: 2x2 max pooling */
+    PoolingLayerInfo()
+        : _pool_type(PoolingType::MAX), _pool_size(2), _pad_stride_info(PadStrideInfo()), _is_global_pooling(false)
+    {
+    }
+    /** Constructor
      *
-     * @param[in] pool_type       Pooling type @ref PoolingType. Defaults to @ref PoolingType::MAX
-     * @param[in] pool_size       (Optional) Pooling size, in elements, across  x and y. Defaults to 2.
+     * @param[in] pool_type       Pooling type @ref PoolingType.
+     * @param[in] pool_size       Pooling size, in elements, across  x and y.
      * @param[in] pad_stride_info (Optional) Padding and stride information @ref PadStrideInfo
      */
-    PoolingLayerInfo(PoolingType pool_type = PoolingType::MAX, unsigned int pool_size = 2, PadStrideInfo pad_stride_info = PadStrideInfo())
-        : _pool_type(pool_type), _pool_size(pool_size), _pad_stride_info(pad_stride_info)
+    explicit PoolingLayerInfo(PoolingType pool_type, unsigned int pool_size, PadStrideInfo pad_stride_info = PadStrideInfo())
+        : _pool_type(pool_type), _pool_size(pool_size), _pad_stride_info(pad_stride_info), _is_global_pooling(false)
+    {
+    }
+    /** Constructor for global pooling: the pooling region is the whole width and height of the input, which gets reduced to a single value per feature map.
+     *
+     * @param[in] pool_type Pooling type @ref PoolingType.
+     */
+    explicit PoolingLayerInfo(PoolingType pool_type)
+        : _pool_type(pool_type), _pool_size(0), _pad_stride_info(PadStrideInfo(1, 1, 0, 0)), _is_global_pooling(true)
     {
     }
     PoolingType pool_type() const
@@ -436,11 +627,49 @@ public:
     {
         return _pad_stride_info;
     }
+    bool is_global_pooling() const
+    {
+        return _is_global_pooling;
+    }
 
 private:
     PoolingType   _pool_type;
     unsigned int  _pool_size;
     PadStrideInfo _pad_stride_info;
+    bool          _is_global_pooling;
+};
+
+/** ROI Pooling Layer Information class */
+class ROIPoolingLayerInfo
+{
+public:
+    /** Constructor
+     *
+     * @param[in] pooled_width  Width of the output of each region of interest.
+     * @param[in] pooled_height Height of the output of each region of interest.
+     * @param[in] spatial_scale Ratio between the size of the feature maps and the size of the image the regions of interest are given in, e.g. 1/16 for features with a stride of 16.
+     */
+    ROIPoolingLayerInfo(unsigned int pooled_width, unsigned int pooled_height, float spatial_scale)
+        : _pooled_width(pooled_width), _pooled_height(pooled_height), _spatial_scale(spatial_scale)
+    {
+    }
+    unsigned int pooled_width() const
+    {
+        return _pooled_width;
+    }
+    unsigned int pooled_height() const
+    {
+        return _pooled_height;
+    }
+    float spatial_scale() const
+    {
+        return _spatial_scale;
+    }
+
+private:
+    unsigned int _pooled_width;
+    unsigned int _pooled_height;
+    float        _spatial_scale;
 };
 
 /** Activation Layer Information class */
@@ -461,15 +690,22 @@ public:
         LINEAR        /**< Linear */
     };
 
-    /** Default Constructor
+    /** Default Constructor: no activation function is applied */
+    ActivationLayerInfo()
+        : _act(ActivationFunction::LINEAR), _a(1.0f), _b(0.0f), _precision(MathPrecision::ACCURATE), _enabled(false)
+    {
+    }
+    /** Constructor
      *
-     * @param[in] f The activation function to use.
-     * @param[in] a (Optional) The alpha parameter used by some activation functions
-     *              (@ref ActivationFunction::BOUNDED_RELU, @ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
-     * @param[in] b (Optional) The beta parameter used by some activation functions (@ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
+     * @param[in] f         The activation function to use.
+     * @param[in] a         (Optional) The alpha parameter used by some activation functions
+     *                      (@ref ActivationFunction::BOUNDED_RELU, @ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
+     * @param[in] b         (Optional) The beta parameter used by some activation functions (@ref ActivationFunction::LINEAR, @ref ActivationFunction::TANH).
+     * @param[in] precision (Optional) Accuracy of the approximations used by @ref ActivationFunction::LOGISTIC, @ref ActivationFunction::SOFT_RELU,
+     *                      @ref ActivationFunction::SQRT and @ref ActivationFunction::TANH. Only used by the NEON kernels.
      */
-    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f)
-        : _act(f), _a(a), _b(b)
+    ActivationLayerInfo(ActivationFunction f, float a = 0.0f, float b = 0.0f, MathPrecision precision = MathPrecision::ACCURATE)
+        : _act(f), _a(a), _b(b), _precision(precision), _enabled(true)
     {
     }
     ActivationFunction activation() const
@@ -484,11 +720,29 @@ public:
     {
         return _b;
     }
+    /** Accuracy of the approximations of the transcendental functions
+     *
+     * @return The precision the info was created with (@ref MathPrecision::ACCURATE by default).
+     */
+    MathPrecision precision() const
+    {
+        return _precision;
+    }
+    /** Check if an activation function has been specified
+     *
+     * @return True if the info was created with an activation function.
+     */
+    bool enabled() const
+    {
+        return _enabled;
+    }
 
 private:
     ActivationFunction _act;
     float              _a;
     float              _b;
+    MathPrecision      _precision;
+    bool               _enabled;
 };
 
 /** Normalization Layer Information class */
@@ -60,6 +60,24 @@ constexpr auto DIV_CEIL(S val, T m) -> decltype((val + m - 1) / m)
     return (val + m - 1) / m;
 }
 
+/** Convert a single precision value to the bits of the nearest half precision value (rounded to nearest even)
+ *
+ * @note Portable conversion of the values stored in half precision by the code which doesn't run on the NEON or OpenCL units.
+ *
+ * @param[in] value Value to convert. The values out of the range of half precision become infinities.
+ *
+ * @return The bits of the half precision value
+ */
+uint16_t float_to_half(float value);
+
+/** Convert the bits of a half precision value to single precision
+ *
+ * @param[in] bits Bits of the half precision value.
+ *
+ * @return The value in single precision
+ */
+float half_to_float(uint16_t bits);
+
 /** Returns the arm_compute library build information
  *
  * Contains the version number and the build options used to build the library
@@ -186,6 +204,33 @@ inline size_t element_size_from_data_type(DataType dt)
     }
 }
 
+/** Index of a dimension in the shape of a tensor holding feature maps
+ *
+ * @note The dimensions of a @ref DataLayout::NCHW4 tensor are the ones of an NCHW tensor, but they count 4 values per element along X and the blocks of channels.
+ *
+ * @param[in] data_layout Order of the elements of the tensor.
+ * @param[in] dimension   Dimension to look up.
+ *
+ * @return The index of @p dimension in the shape of the tensor
+ */
+inline size_t get_data_layout_dimension_index(DataLayout data_layout, DataLayoutDimension dimension)
+{
+    switch(dimension)
+    {
+        case DataLayoutDimension::WIDTH:
+            return (data_layout == DataLayout::NHWC) ? 1 : 0;
+        case DataLayoutDimension::HEIGHT:
+            return (data_layout == DataLayout::NHWC) ? 2 : 1;
+        case DataLayoutDimension::CHANNEL:
+            return (data_layout == DataLayout::NHWC) ? 0 : 2;
+        case DataLayoutDimension::BATCHES:
+            return 3;
+        default:
+            ARM_COMPUTE_ERROR("Unknown data layout dimension");
+            return 0;
+    }
+}
+
 /** Return the data type used by a given single-planar pixel format
  *
  * @param[in] format Input format
@@ -348,63 +393,96 @@ inline size_t num_channels_from_format(Format format)
 }
 
 /** Separate a 2D convolution into two 1D convolutions
-*
-* @param[in]  conv     2D convolution
-* @param[out] conv_col 1D vertical convolution
-* @param[out] conv_row 1D horizontal convolution
-* @param[in]  size     Size of the 2D convolution
-*
-* @return true if the separation was successful
-*/
-inline bool separate_matrix(const int16_t *conv, int16_t *conv_col, int16_t *conv_row, uint8_t size)
+ *
+ * The matrix is separable if it has rank 1, i.e. if all its non-zero rows are multiples of a single row.
+ * The horizontal vector is the first non-zero row divided by the greatest common divisor of its coefficients, with its first non-zero coefficient positive,
+ * so that the coefficients of the vertical vector are integers too and the product of the two vectors is exactly @p conv.
+ *
+ * @param[in]  conv     2D convolution structured as a row-major 2D array of @p rows x @p cols coefficients
+ * @param[out] conv_col 1D vertical convolution (@p rows coefficients)
+ * @param[out] conv_row 1D horizontal convolution (@p cols coefficients)
+ * @param[in]  rows     Number of rows of the 2D convolution
+ * @param[in]  cols     Number of columns of the 2D convolution
+ *
+ * @return true if the separation was successful
+ */
+inline bool separate_matrix(const int16_t *conv, int16_t *conv_col, int16_t *conv_row, unsigned int rows, unsigned int cols)
 {
-    int32_t min_col     = -1;
-    int16_t min_col_val = -1;
+    const int16_t *const end       = conv + rows * cols;
+    const int16_t *const first_val = std::find_if(conv, end, [](int16_t v)
+    {
+        return v != 0;
+    });
 
-    for(int32_t i = 0; i < size; ++i)
+    if(first_val == end)
     {
-        if(conv[i] != 0 && (min_col < 0 || abs(min_col_val) > abs(conv[i])))
+        return false;
+    }
+
+    const unsigned int   first_col = (first_val - conv) % cols;
+    const int16_t *const ref_row   = conv + ((first_val - conv) / cols) * cols;
+
+    int divisor = 0;
+    for(unsigned int i = 0; i < cols; ++i)
+    {
+        // Euclid's algorithm
+        int a = std::abs(ref_row[i]);
+        while(a != 0)
         {
-            min_col     = i;
-            min_col_val = conv[i];
+            const int r = divisor % a;
+            divisor     = a;
+            a           = r;
         }
     }
 
-    if(min_col < 0)
+    if(ref_row[first_col] < 0)
     {
-        return false;
+        divisor = -divisor;
     }
 
-    for(uint32_t j = 0; j < size; ++j)
+    for(unsigned int i = 0; i < cols; ++i)
     {
-        conv_col[j] = conv[min_col + j * size];
+        conv_row[i] = ref_row[i] / divisor;
     }
 
-    for(uint32_t i = 0; i < size; i++)
+    for(unsigned int j = 0; j < rows; ++j)
     {
-        if(static_cast<int>(i) == min_col)
+        const int16_t *const row = conv + j * cols;
+
+        // The horizontal vector is primitive: a row proportional to it is an integer multiple of it
+        if(row[first_col] % conv_row[first_col] != 0)
         {
-            conv_row[i] = 1;
+            return false;
         }
-        else
-        {
-            int16_t coeff = conv[i] / conv[min_col];
 
-            for(uint32_t j = 1; j < size; ++j)
+        conv_col[j] = row[first_col] / conv_row[first_col];
+
+        for(unsigned int i = 0; i < cols; ++i)
+        {
+            if(row[i] != conv_col[j] * conv_row[i])
             {
-                if(conv[i + j * size] != (conv_col[j] * coeff))
-                {
-                    return false;
-                }
+                return false;
             }
-
-            conv_row[i] = coeff;
         }
     }
 
     return true;
 }
 
+/** Separate a square 2D convolution into two 1D convolutions
+*
+* @param[in]  conv     2D convolution
+* @param[out] conv_col 1D vertical convolution
+* @param[out] conv_row 1D horizontal convolution
+* @param[in]  size     Size of the 2D convolution
+*
+* @return true if the separation was successful
+*/
+inline bool separate_matrix(const int16_t *conv, int16_t *conv_col, int16_t *conv_row, uint8_t size)
+{
+    return separate_matrix(conv, conv_col, conv_row, size, size);
+}
+
 /** Calculate the scale of the given square matrix
  *
  * The scale is the absolute value of the sum of all the coefficients in the matrix.
@@ -552,6 +630,30 @@ const std::pair<unsigned int, unsigned int> scaled_dimensions(unsigned int width
                                                               unsigned int pad_x, unsigned int pad_y,
                                                               DimensionRoundingType round_type);
 
+/** Decompose a positive real multiplier into the integer multiplier and the right shift used by the requantization of @ref NEGEMMLowpMatrixMultiplyKernel
+ *
+ * The returned pair (multiplier_int, shift) satisfies multiplier ~= multiplier_int / 2^shift, with multiplier_int in [2^30, 2^31)
+ * so that the multiplier keeps 31 bits of precision. Multipliers greater than or equal to 1 (i.e. the product of the input scales is larger than the output scale)
+ * get a smaller shift, which is negative, i.e. a left shift, for multipliers of 2^31 or more.
+ *
+ * @param[in] multiplier Real multiplier, usually the product of the input scales divided by the output scale. Must be positive.
+ *
+ * @return A pair with the integer multiplier in the first position and the right shift in the second.
+ */
+const std::pair<int32_t, int32_t> quantize_multiplier(float multiplier);
+
+/** Compute the range of the quantized values produced by an activation function
+ *
+ * In the quantized domain the supported activation functions are a clamp of the quantized values.
+ *
+ * @param[in] act_info          Activation function. Only @ref ActivationLayerInfo::ActivationFunction::RELU and
+ *                              @ref ActivationLayerInfo::ActivationFunction::BOUNDED_RELU are supported. Can be disabled.
+ * @param[in] quantization_info Quantization settings of the activated values.
+ *
+ * @return A pair with the lowest quantized value in the first position and the highest in the second.
+ */
+const std::pair<uint8_t, uint8_t> quantized_activation_bounds(const ActivationLayerInfo &act_info, const QuantizationInfo &quantization_info);
+
 /** Convert a tensor format into a string.
  *
  * @param[in] format @ref Format to be translated to string.
@@ -44,6 +44,8 @@ namespace arm_compute
  * - Its dimensions don't match the full window's ones
  * - The step for each of its dimension is not identical to the corresponding one of the full window.
  *
+ * @note This check is executed every time a kernel is run: the macro is only enabled if ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
+ *
  *  @param[in] function Function in which the error occurred.
  *  @param[in] file     Name of the file where the error occurred.
  *  @param[in] line     Line on which the error occurred.
@@ -52,7 +54,11 @@ namespace arm_compute
  */
 void error_on_mismatching_windows(const char *function, const char *file, const int line,
                                   const Window &full, const Window &win);
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
 #define ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(f, w) ::arm_compute::error_on_mismatching_windows(__func__, __FILE__, __LINE__, f, w)
+#else /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+#define ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(f, w)
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
 
 /** Throw an error if the passed subwindow is invalid.
  *
@@ -61,6 +67,8 @@ void error_on_mismatching_windows(const char *function, const char *file, const
  * - It is not fully contained inside the full window
  * - The step for each of its dimension is not identical to the corresponding one of the full window.
  *
+ * @note This check is executed every time a kernel is run: the macro is only enabled if ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
+ *
  *  @param[in] function Function in which the error occurred.
  *  @param[in] file     Name of the file where the error occurred.
  *  @param[in] line     Line on which the error occurred.
@@ -69,7 +77,11 @@ void error_on_mismatching_windows(const char *function, const char *file, const
  */
 void error_on_invalid_subwindow(const char *function, const char *file, const int line,
                                 const Window &full, const Window &sub);
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
 #define ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(f, s) ::arm_compute::error_on_invalid_subwindow(__func__, __FILE__, __LINE__, f, s)
+#else /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+#define ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(f, s)
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
 
 /** Throw an error if the passed coordinates have too many dimensions.
  *
@@ -89,6 +101,8 @@ void error_on_coordinates_dimensions_gte(const char *function, const char *file,
  *
  * The window has too many dimensions if any of the dimension greater or equal to max_dim is different from 0.
  *
+ * @note This check is executed every time a kernel is run: the macro is only enabled if ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
+ *
  *  @param[in] function Function in which the error occurred.
  *  @param[in] file     Name of the file where the error occurred.
  *  @param[in] line     Line on which the error occurred.
@@ -97,7 +111,11 @@ void error_on_coordinates_dimensions_gte(const char *function, const char *file,
  */
 void error_on_window_dimensions_gte(const char *function, const char *file, const int line,
                                     const Window &win, unsigned int max_dim);
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
 #define ARM_COMPUTE_ERROR_ON_WINDOW_DIMENSIONS_GTE(w, md) ::arm_compute::error_on_window_dimensions_gte(__func__, __FILE__, __LINE__, w, md)
+#else /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+#define ARM_COMPUTE_ERROR_ON_WINDOW_DIMENSIONS_GTE(w, md)
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
 
 /* Check whether two tensors have different shapes.
  *
@@ -334,6 +352,8 @@ void error_on_invalid_multi_hog(const char *function, const char *file, const in
 #define ARM_COMPUTE_ERROR_ON_INVALID_MULTI_HOG(m) ::arm_compute::error_on_invalid_multi_hog(__func__, __FILE__, __LINE__, m)
 
 /** Throw an error if the kernel is not configured.
+ *
+ * @note This check is executed every time a kernel is run: the macro is only enabled if ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
  *
  *  @param[in] function Function in which the error occurred.
  *  @param[in] file     Name of the file where the error occurred.
@@ -342,6 +362,10 @@ void error_on_invalid_multi_hog(const char *function, const char *file, const in
  */
 void error_on_unconfigured_kernel(const char *function, const char *file, const int line,
                                   const IKernel *kernel);
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
 #define ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(k) ::arm_compute::error_on_unconfigured_kernel(__func__, __FILE__, __LINE__, k)
+#else /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+#define ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(k)
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
 }
 #endif /* __ARM_COMPUTE_VALIDATE_H__*/
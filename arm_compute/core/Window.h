@@ -190,6 +190,11 @@ public:
      * No-op when asserts are disabled
      */
     void validate() const;
+    /** Will validate all the window's dimensions' values when the asserts executed every time a kernel is run are enabled
+     *
+     * To be used instead of @ref validate on the execution path of the kernels. No-op unless ARM_COMPUTE_RUN_ASSERTS_ENABLED is defined (run_asserts=1).
+     */
+    void validate_on_run() const;
 
     /** Return the number of iterations needed to iterate through a given dimension
      *
@@ -206,6 +211,8 @@ public:
      * Window sub1 = window.split_window( 1, 1, 3);<br/>
      * Window sub2 = window.split_window( 1, 2, 3);<br/>
      *
+     * The number of iterations of the sub-windows differ by at most one: the first ones get one more iteration if the division has a remainder.
+     *
      * @param[in] dimension Dimension along which the split will be performed
      * @param[in] id        Id of the sub-window to return. Must be in the range (0, total-1)
      * @param[in] total     Total number of sub-windows the window will be split into.
@@ -75,6 +75,13 @@ inline void Window::validate() const
     }
 }
 
+inline void Window::validate_on_run() const
+{
+#ifdef ARM_COMPUTE_RUN_ASSERTS_ENABLED
+    validate();
+#endif /* ARM_COMPUTE_RUN_ASSERTS_ENABLED */
+}
+
 inline constexpr size_t Window::num_iterations(size_t dimension) const
 {
     // Precondition: dimension < Coordinates::num_max_dimensions
@@ -93,16 +100,15 @@ inline Window Window::split_window(const size_t dimension, const size_t id, cons
     {
         if(d == dimension)
         {
-            int start          = _dims[d].start();
-            int end            = _dims[d].end();
-            int per_sub_window = (num_iterations(d) / total) * _dims[d].step();
-
-            start += id * per_sub_window;
-
-            if(id != total - 1)
-            {
-                end = start + per_sub_window;
-            }
+            // The remainder of the division is spread one step at a time over the first sub-windows
+            const size_t num_it         = num_iterations(d);
+            const size_t per_sub_window = num_it / total;
+            const size_t remainder      = num_it % total;
+            const size_t first_it       = id * per_sub_window + std::min(id, remainder);
+            const size_t sub_num_it     = per_sub_window + ((id < remainder) ? 1 : 0);
+
+            const int start = _dims[d].start() + static_cast<int>(first_it) * _dims[d].step();
+            const int end   = (id == total - 1) ? _dims[d].end() : start + static_cast<int>(sub_num_it) * _dims[d].step();
 
             out.set(d, Dimension(start, end, _dims[d].step()));
         }
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_ALLOCATIONTRACER_H__
+#define __ARM_COMPUTE_ALLOCATIONTRACER_H__
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Counts the heap allocations made while a scope is active, to check that the steady state runs of the functions don't allocate.
+ *
+ * Allocating in run() costs a lock in the allocator, page faults for the large blocks and jitter on the latency of the inferences:
+ * once configured and run once, the functions are expected to run from memory they already own. The counting is done by replacing
+ * the global operator new and operator delete, hence only the allocations made through them are seen (Not the ones made by malloc() directly).
+ *
+ * @note The operators are only replaced if the library is built with trace_allocations=1, otherwise @ref is_enabled() returns false and nothing is counted.
+ *       The replacement applies to the whole program as long as the library is linked before the C++ runtime.
+ * @note The scopes are per thread: only the allocations made by the thread which began a scope are counted, so that the other threads of the
+ *       application don't show up in the report. @ref CPPScheduler begins the scope of the calling thread on its worker threads while they run
+ *       the kernels it schedules, so that the allocations made on behalf of the function are still counted.
+ *
+ * Example:
+ * @code
+ * function.run(); // The first run may allocate, e.g. to reshape the weights
+ * {
+ *     AllocationScope scope("steady state run");
+ *     function.run();
+ * }
+ * ARM_COMPUTE_ERROR_ON(AllocationTracer::report().num_allocations != 0);
+ * @endcode
+ */
+class AllocationTracer
+{
+public:
+    /** Allocations counted since the last @ref reset() */
+    struct Report
+    {
+        size_t      num_allocations; /**< Number of allocations made while a scope was active */
+        size_t      num_bytes;       /**< Total size in bytes of these allocations */
+        const char *first_scope;     /**< Name of the scope active when the first of them was made, nullptr if none was made */
+    };
+    /** Signature of the function called on each allocation made while a scope is active
+     *
+     * @param[in] size  Size in bytes of the allocation.
+     * @param[in] scope Name of the innermost active scope.
+     */
+    using Callback = void(size_t size, const char *scope);
+
+    /** Returns true if the library was built with trace_allocations=1
+     *
+     * @return True if the allocations are counted
+     */
+    static bool is_enabled();
+    /** Set the function called on each allocation made while a scope is active, e.g. to print a backtrace or to break in a debugger
+     *
+     * @note The allocations made by the callback itself are neither counted nor reported.
+     *
+     * @param[in] callback Function to call, nullptr (default) to only count the allocations.
+     */
+    static void set_callback(Callback *callback);
+    /** Returns the allocations counted since the last @ref reset()
+     *
+     * @return Number and total size of the allocations made while a scope was active
+     */
+    static Report report();
+    /** Reset the counters */
+    static void reset();
+    /** Begin counting the allocations made by the calling thread
+     *
+     * @param[in] name Name of the scope, reported with the allocations. Must outlive the scope.
+     */
+    static void begin_scope(const char *name);
+    /** End the scope begun by the last call to @ref begin_scope() on the calling thread */
+    static void end_scope();
+    /** Returns the name of the innermost scope active on the calling thread
+     *
+     * @return The name of the scope, nullptr if no scope is active on the calling thread
+     */
+    static const char *current_scope();
+    /** Count an allocation if a scope is active on the calling thread. Called by the replaced operator new.
+     *
+     * @param[in] size Size in bytes of the allocation.
+     */
+    static void record_allocation(size_t size);
+};
+
+/** Scope of @ref AllocationTracer lasting for the lifetime of the object */
+class AllocationScope
+{
+public:
+    /** Begin a scope
+     *
+     * @param[in] name      Name of the scope. Must outlive the object.
+     * @param[in] is_active (Optional) False to not begin any scope, e.g. for the first run of a function which allocates by design.
+     */
+    explicit AllocationScope(const char *name, bool is_active = true)
+        : _is_active(is_active)
+    {
+        if(_is_active)
+        {
+            AllocationTracer::begin_scope(name);
+        }
+    }
+    /** Prevent instances of this class from being copied (As this class ends a scope) */
+    AllocationScope(const AllocationScope &) = delete;
+    /** Prevent instances of this class from being copied (As this class ends a scope) */
+    AllocationScope &operator=(const AllocationScope &) = delete;
+    /** End the scope */
+    ~AllocationScope()
+    {
+        if(_is_active)
+        {
+            AllocationTracer::end_scope();
+        }
+    }
+
+private:
+    bool _is_active; /**< Whether a scope was begun */
+};
+}
+#endif /* __ARM_COMPUTE_ALLOCATIONTRACER_H__ */
@@ -65,6 +65,8 @@ using KeyPointArray        = Array<KeyPoint>;
 using Coordinates2DArray   = Array<Coordinates2D>;
 using DetectionWindowArray = Array<DetectionWindow>;
 using Size2DArray          = Array<Size2D>;
+using RectangleArray       = Array<Rectangle>;
+using ROIArray             = Array<ROI>;
 using UInt8Array           = Array<uint8_t>;
 using UInt16Array          = Array<uint16_t>;
 using UInt32Array          = Array<uint32_t>;
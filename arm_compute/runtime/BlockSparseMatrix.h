@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_BLOCKSPARSEMATRIX_H__
+#define __ARM_COMPUTE_BLOCKSPARSEMATRIX_H__
+
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Weights of a fully connected layer stored in a block compressed sparse row format
+ *
+ * The outputs are grouped in rows of @ref block_width consecutive outputs. For each row, only the 1x @ref block_width blocks holding at least one
+ * non-zero weight are stored: a block holds the weights of one input for the outputs of the row, so that a single vector multiply-accumulate
+ * computes its contribution. The format is made of 3 tensors:
+ *  - values: [block_width, num_blocks] F32 weights of the stored blocks, row after row.
+ *  - indices: [num_blocks] S32 index of the input of each stored block.
+ *  - offsets: [ceil(num_outputs / block_width) + 1] S32 index of the first block of each row in values and indices; the last element is num_blocks.
+ *
+ * With pruned weights (e.g. 10% to 20% of non-zero weights) the matrix-vector multiplication streams a fraction of the bytes of the dense weights.
+ */
+class BlockSparseMatrix
+{
+public:
+    static constexpr unsigned int block_width = 4; /**< Number of consecutive outputs of a block */
+
+    /** Default constructor */
+    BlockSparseMatrix();
+    /** Compress the weights of a fully connected layer, allocating the tensors of the sparse format
+     *
+     * @param[in] weights           Weights tensor, 2 dimensional. Its memory must be allocated and filled. Data type supported: F32.
+     * @param[in] transpose_weights (Optional) True if the weights are stored as @ref NEFullyConnectedLayer expects them when it transposes them: [num_inputs, num_outputs].
+     *                              If false, the weights are already transposed: [num_outputs, num_inputs]. Defaults to true.
+     * @param[in] threshold         (Optional) Weights whose absolute value is not greater than the threshold are considered null. Defaults to 0.
+     */
+    void compress(const ITensor &weights, bool transpose_weights = true, float threshold = 0.f);
+    /** Number of inputs of the layer */
+    size_t num_inputs() const;
+    /** Number of outputs of the layer */
+    size_t num_outputs() const;
+    /** Ratio of stored weights over the weights of the dense matrix */
+    float density() const;
+    /** Weights of the stored blocks */
+    const ITensor *values() const;
+    /** Input index of the stored blocks */
+    const ITensor *indices() const;
+    /** Index of the first stored block of each row, followed by the number of stored blocks */
+    const ITensor *offsets() const;
+
+private:
+    size_t _num_inputs;
+    size_t _num_outputs;
+    size_t _num_blocks;
+    Tensor _values;
+    Tensor _indices;
+    Tensor _offsets;
+};
+}
+#endif /* __ARM_COMPUTE_BLOCKSPARSEMATRIX_H__ */
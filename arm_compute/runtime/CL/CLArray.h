@@ -98,6 +98,7 @@ using CLKeyPointArray        = CLArray<KeyPoint>;
 using CLCoordinates2DArray   = CLArray<Coordinates2D>;
 using CLDetectionWindowArray = CLArray<DetectionWindow>;
 using CLSize2DArray          = CLArray<Size2D>;
+using CLROIArray             = CLArray<ROI>;
 using CLUInt8Array           = CLArray<cl_uchar>;
 using CLUInt16Array          = CLArray<cl_ushort>;
 using CLUInt32Array          = CLArray<cl_uint>;
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLFRAMEPIPELINE_H__
+#define __ARM_COMPUTE_CLFRAMEPIPELINE_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+class IFunction;
+
+/** Run an OpenCL network on a stream of frames, overlapping the upload and the readback of the frames with the computation.
+ *
+ * The frames go through host staging tensors with the same layout as the input and output of the network. The uploads and
+ * the readbacks are non-blocking writes and reads of the OpenCL buffers synchronised with OpenCL events: while the
+ * device computes frame n, the host fills frame n + 1 and reads the result of frame n - 1 (with two buffers).
+ */
+class CLFramePipeline
+{
+public:
+    /** Constructor */
+    CLFramePipeline();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLFramePipeline(const CLFramePipeline &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLFramePipeline &operator=(const CLFramePipeline &) = delete;
+    /** Set the network and allocate the staging tensors.
+     *
+     * @param[in] network     Configured network. Its run() must only enqueue the OpenCL work: it must not synchronise the queue. Must outlive the pipeline.
+     * @param[in] input       Allocated input of the network.
+     * @param[in] output      Allocated output of the network.
+     * @param[in] num_buffers (Optional) Number of staging tensors for the inputs and for the outputs: 2 for double buffering, 3 for triple buffering.
+     */
+    void configure(IFunction *network, ICLTensor *input, ICLTensor *output, unsigned int num_buffers = 2);
+    /** Process a stream of frames.
+     *
+     * @param[in] num_frames  Number of frames to process.
+     * @param[in] fill_input  Called with the index of a frame to write it into the given staging tensor, which has the layout of the input of the network.
+     * @param[in] read_output Called with the index of a frame once its result is in the given staging tensor, which has the layout of the output of the network.
+     *                        The frames are read in order, while the device is computing the following frames.
+     */
+    void run(unsigned int num_frames, const std::function<void(unsigned int, ITensor &)> &fill_input, const std::function<void(unsigned int, ITensor &)> &read_output);
+
+private:
+    IFunction                           *_network;
+    ICLTensor                           *_input;
+    ICLTensor                           *_output;
+    std::vector<std::unique_ptr<Tensor>> _staging_inputs;
+    std::vector<std::unique_ptr<Tensor>> _staging_outputs;
+    std::vector<cl::Event>               _upload_events;
+    std::vector<cl::Event>               _readback_events;
+};
+}
+#endif /* __ARM_COMPUTE_CLFRAMEPIPELINE_H__ */
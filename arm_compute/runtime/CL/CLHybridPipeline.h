@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLHYBRIDPIPELINE_H__
+#define __ARM_COMPUTE_CLHYBRIDPIPELINE_H__
+
+#include "arm_compute/runtime/IFunction.h"
+
+#include <functional>
+#include <vector>
+
+namespace arm_compute
+{
+class ICLTensor;
+class ITensor;
+
+/** Basic function to run a sequence of functions split between the OpenCL device and the CPU.
+ *
+ * Each stage is a configured function running either on the OpenCL device (a CL function, enqueued by @ref CLScheduler) or
+ * on the CPU (e.g. a NEON function, run by @ref NEScheduler). The input of a stage is the output of the previous one, except
+ * where the backend changes: the two tensors are then distinct (an @ref ICLTensor on the OpenCL side, a CPU tensor on the other)
+ * and the output of the previous stage is copied into the input of the next one through a map/unmap of the OpenCL tensor.
+ *
+ * @ref run() processes a single frame. @ref run_pipelined() processes a sequence of frames and overlaps the OpenCL and CPU work:
+ * while the CPU stages process frame n the OpenCL stages of frame n + 1 are running on the device.
+ */
+class CLHybridPipeline : public IFunction
+{
+public:
+    /** Constructor */
+    CLHybridPipeline();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLHybridPipeline(const CLHybridPipeline &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLHybridPipeline &operator=(const CLHybridPipeline &) = delete;
+    /** Append a stage running on the OpenCL device.
+     *
+     * @param[in] function Configured CL function. Must outlive the pipeline.
+     * @param[in] input    Input of the function. If the previous stage runs on the OpenCL device it must be its output.
+     * @param[in] output   Output of the function.
+     */
+    void add_cl_stage(IFunction *function, ICLTensor *input, ICLTensor *output);
+    /** Append a stage running on the CPU.
+     *
+     * @param[in] function Configured CPU function. Must outlive the pipeline.
+     * @param[in] input    Input of the function. If the previous stage runs on the CPU it must be its output.
+     * @param[in] output   Output of the function.
+     */
+    void add_cpu_stage(IFunction *function, ITensor *input, ITensor *output);
+    /** Process a sequence of frames, overlapping the OpenCL stages of a frame with the CPU stages of the previous one.
+     *
+     * @note Each group of consecutive stages running on the same backend only holds one frame at a time: at most one frame per group is in flight.
+     *
+     * @param[in] num_frames  Number of frames to process.
+     * @param[in] fill_input  Called with the index of a frame to write it into the input of the first stage. OpenCL tensors are mapped during the call.
+     * @param[in] read_output Called with the index of a frame once its result is in the output of the last stage. OpenCL tensors are mapped during the call.
+     */
+    void run_pipelined(unsigned int num_frames, const std::function<void(unsigned int)> &fill_input, const std::function<void(unsigned int)> &read_output);
+
+    // Inherited methods overridden:
+    /** Process a single frame: the input of the first stage must have been filled, the output of the last stage is ready when the function returns. */
+    void run() override;
+
+private:
+    /** Consecutive stages running on the same backend */
+    struct Segment
+    {
+        std::vector<IFunction *> functions; /**< Functions of the stages in execution order */
+        ITensor                 *input;     /**< Input of the first stage */
+        ITensor                 *output;    /**< Output of the last stage */
+        ICLTensor               *cl_input;  /**< Input of the first stage if the segment runs on the OpenCL device, nullptr otherwise */
+        ICLTensor               *cl_output; /**< Output of the last stage if the segment runs on the OpenCL device, nullptr otherwise */
+    };
+
+    /** Append a stage, starting a new segment if the backend changes
+     *
+     * @param[in] function  Configured function of the stage.
+     * @param[in] input     Input of the function.
+     * @param[in] output    Output of the function.
+     * @param[in] cl_input  @p input if the stage runs on the OpenCL device, nullptr otherwise.
+     * @param[in] cl_output @p output if the stage runs on the OpenCL device, nullptr otherwise.
+     */
+    void add_stage(IFunction *function, ITensor *input, ITensor *output, ICLTensor *cl_input, ICLTensor *cl_output);
+    /** Copy the output of a segment into the input of the following one
+     *
+     * @param[in] src Segment producing the data.
+     * @param[in] dst Segment consuming the data.
+     */
+    static void transfer(const Segment &src, const Segment &dst);
+    /** Call a function with the given tensor mapped if it is an OpenCL tensor
+     *
+     * @param[in] cl_tensor OpenCL tensor to map, nullptr for a CPU tensor.
+     * @param[in] func      Function to call.
+     */
+    static void with_mapped(ICLTensor *cl_tensor, const std::function<void()> &func);
+
+    std::vector<Segment> _segments;
+};
+}
+#endif /* __ARM_COMPUTE_CLHYBRIDPIPELINE_H__ */
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLMEMORYPLANNER_H__
+#define __ARM_COMPUTE_CLMEMORYPLANNER_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <cstddef>
+#include <vector>
+
+namespace arm_compute
+{
+class CLTensor;
+class CLTensorAllocator;
+
+/** Lifetime-aware planner which packs OpenCL tensors into sub-buffers of a single shared buffer.
+ *
+ * This is the OpenCL counterpart of @ref MemoryPlanner: the lifetime of a tensor starts when it is passed to @ref manage() and ends
+ * when its allocator's allocate() method is called. Tensors whose lifetimes don't overlap are assigned to overlapping regions of
+ * the buffer, so the size of the buffer is the peak amount of memory alive at any moment and the whole working set costs a single
+ * allocation in the driver.
+ *
+ * @note The buffer is only allocated and the sub-buffers bound to the managed tensors when @ref allocate() is called.
+ *
+ * @warning The content of a managed tensor is only valid for the duration of its lifetime: managed tensors must only be used for transient data.
+ */
+class CLMemoryPlanner
+{
+public:
+    /** Default constructor */
+    CLMemoryPlanner();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLMemoryPlanner(const CLMemoryPlanner &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLMemoryPlanner &operator=(const CLMemoryPlanner &) = delete;
+    /** Start the lifetime of a tensor.
+     *
+     * @note The tensor must not be allocated.
+     *
+     * @param[in] tensor Tensor whose backing memory will be a sub-buffer of the shared buffer.
+     */
+    void manage(CLTensor *tensor);
+    /** End the lifetime of a managed tensor.
+     *
+     * @note Called by @ref CLTensorAllocator::allocate() for managed tensors. The size of the tensor is frozen at this point.
+     *
+     * @param[in] allocator Allocator of the managed tensor.
+     */
+    void finalize(CLTensorAllocator *allocator);
+    /** Assign a region of the shared buffer to every managed tensor, allocate the buffer and bind the sub-buffers to the tensors.
+     *
+     * @note The lifetime of all the managed tensors must have ended.
+     */
+    void allocate();
+    /** Size in bytes of the shared buffer
+     *
+     * @note Only valid once @ref allocate() has been called.
+     *
+     * @return The size of the shared buffer in bytes
+     */
+    size_t arena_size() const;
+
+private:
+    /** Lifetime of a managed tensor */
+    struct Lifetime
+    {
+        CLTensorAllocator *allocator; /**< Allocator of the managed tensor */
+        size_t             size;      /**< Size in bytes of the tensor */
+        size_t             start;     /**< Time at which the lifetime starts */
+        size_t             end;       /**< Time at which the lifetime ends */
+        size_t             offset;    /**< Offset of the tensor in the shared buffer */
+    };
+
+    std::vector<Lifetime> _lifetimes;
+    size_t                _clock;
+    size_t                _arena_size;
+    cl::Buffer            _arena;
+};
+}
+#endif /* __ARM_COMPUTE_CLMEMORYPLANNER_H__ */
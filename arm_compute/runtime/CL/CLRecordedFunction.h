@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLRECORDEDFUNCTION_H__
+#define __ARM_COMPUTE_CLRECORDEDFUNCTION_H__
+
+#include "arm_compute/core/CL/CLCommandRecording.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+/** Run an OpenCL function once to record the kernels it enqueues, then replay them on the next runs (See @ref CLCommandRecording).
+ *
+ * A replay skips the host code of the function and of its kernels: the windows are not sliced again and only the kernel arguments
+ * which change between two enqueues of the same kernel are set, so the host overhead per inference is little more than the enqueues.
+ *
+ * @note The function must only enqueue kernels through @ref CLScheduler::enqueue(): functions which read results back on the host or
+ *       enqueue other commands (e.g. @ref CLFastCorners, @ref CLHOGMultiDetection, @ref CLMeanStdDev) can't be replayed.
+ * @note While a @ref Profiler session is running, the function runs normally so that its kernels are profiled.
+ */
+class CLRecordedFunction : public IFunction
+{
+public:
+    /** Constructor */
+    CLRecordedFunction();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLRecordedFunction(const CLRecordedFunction &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLRecordedFunction &operator=(const CLRecordedFunction &) = delete;
+    /** Set the function to record.
+     *
+     * @param[in] function Configured function whose tensors are allocated. Must outlive the object.
+     */
+    void configure(IFunction *function);
+    /** Record the function again on its next run, e.g. after its tensors have been reallocated. */
+    void reset();
+
+    // Inherited methods overridden:
+    void prepare() override;
+    void run() override;
+
+private:
+    IFunction         *_function;
+    CLCommandRecording _recording;
+    bool               _is_recorded;
+};
+}
+#endif /* __ARM_COMPUTE_CLRECORDEDFUNCTION_H__ */
@@ -27,11 +27,22 @@
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 #include "arm_compute/core/CL/OpenCL.h"
 
+#include <vector>
+
 namespace arm_compute
 {
+class CLCommandRecording;
+class CLTuner;
 class ICLKernel;
+class IFunction;
 
-/** Provides global access to a CL context and command queue. */
+/** Provides global access to a CL context and command queues.
+ *
+ * The kernels are enqueued in the active command queue, the queue passed to @ref init() by default. Independent branches of work
+ * (e.g. the groups of a grouped convolution or a preprocessing chain running next to the inference) can be enqueued in other in-order
+ * queues (see @ref add_queue() and @ref CLScopedQueue) so that the device can overlap them: the dependencies between queues are
+ * expressed with the events returned by @ref enqueue_sync_event() and passed to @ref enqueue_wait().
+ */
 class CLScheduler
 {
 private:
@@ -39,6 +50,10 @@ private:
     CLScheduler();
 
 public:
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLScheduler(const CLScheduler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLScheduler &operator=(const CLScheduler &) = delete;
     /** Access the scheduler singleton.
      *
      * @return The scheduler
@@ -53,11 +68,23 @@ public:
         init(cl::Context::getDefault(), cl::CommandQueue::getDefault());
     }
     /** Schedule the execution of the passed kernel if possible.
+     *
+     * @note While a @ref Profiler session is running, the function blocks until the kernel has been executed.
+     *
+     * @note Inside a batch (see @ref begin_batch) @p flush is ignored: the queue is flushed according to the flush interval of the batch.
      *
      * @param[in] kernel Kernel to execute.
      * @param[in] flush  (Optional) Specifies if the command queue will be flushed after running the kernel.
      */
     void enqueue(ICLKernel &kernel, bool flush = true);
+    /** Replay a recording of kernel enqueues in the active command queue (See @ref CLCommandRecording::replay()).
+     *
+     * @note Inside a batch (see @ref begin_batch) @p flush is ignored: the recorded kernels count towards the flush interval of the batch.
+     *
+     * @param[in,out] recording Ended recording to replay.
+     * @param[in]     flush     (Optional) Specifies if the command queue will be flushed after enqueuing the recorded kernels.
+     */
+    void enqueue_recording(CLCommandRecording &recording, bool flush = true);
 
     /** Initialises the context and command queue to be used by the scheduler.
      *
@@ -66,8 +93,9 @@ public:
      */
     void init(cl::Context context = cl::Context::getDefault(), cl::CommandQueue queue = cl::CommandQueue::getDefault())
     {
-        _context = std::move(context);
-        _queue   = std::move(queue);
+        _context      = std::move(context);
+        _queues       = { std::move(queue) };
+        _active_queue = 0;
     }
 
     /** Accessor for the associated CL context.
@@ -88,45 +116,177 @@ public:
         _context = std::move(context);
     }
 
-    /** Accessor for the associated CL command queue.
+    /** Accessor for the active CL command queue.
      *
      * @return A CL command queue.
      */
     cl::CommandQueue &queue()
     {
-        return _queue;
+        return _queues[_active_queue];
     }
 
-    /** Accessor to set the CL command queue to be used by the scheduler.
+    /** Accessor to set the active CL command queue to be used by the scheduler.
      *
      * @param[in] queue A CL command queue.
      */
     void set_queue(cl::CommandQueue queue)
     {
-        _queue = std::move(queue);
+        _queues[_active_queue] = std::move(queue);
     }
 
-    /** Blocks until all commands in the associated command queue have finished. */
-    void sync()
+    /** Add a command queue to the scheduler
+     *
+     * @note The kernels of the functions assume that they are executed in order: the queue must not be an out-of-order queue.
+     *
+     * @param[in] queue (Optional) A CL command queue of the context of the scheduler. By default a queue is created on the device
+     *                  and with the properties of the queue passed to @ref init().
+     *
+     * @return The index of the queue, to pass to @ref set_active_queue()
+     */
+    unsigned int add_queue(cl::CommandQueue queue = cl::CommandQueue());
+    /** Select the command queue in which the next kernels are enqueued
+     *
+     * @note Inside a batch the kernels pending in the previously active queue are flushed first.
+     *
+     * @param[in] index Index of the queue: 0 for the queue passed to @ref init(), or a value returned by @ref add_queue().
+     */
+    void set_active_queue(unsigned int index);
+    /** Index of the command queue in which the kernels are enqueued
+     *
+     * @return The index of the active queue
+     */
+    unsigned int active_queue() const
+    {
+        return _active_queue;
+    }
+    /** Number of command queues of the scheduler
+     *
+     * @return The number of queues, including the queue passed to @ref init()
+     */
+    unsigned int num_queues() const
+    {
+        return _queues.size();
+    }
+    /** Make the commands enqueued next in the active queue wait until some events are complete
+     *
+     * Typically used with an event returned by @ref enqueue_sync_event() while another queue was active, to wait for the results of that queue
+     * without blocking the host.
+     *
+     * @param[in] events Events to wait for. Nothing is enqueued if the list is empty.
+     */
+    void enqueue_wait(const std::vector<cl::Event> &events);
+
+    /** Set the tuner used to select the local workgroup size of the kernels before enqueuing them.
+     *
+     * @param[in] tuner (Optional) Tuner to use, nullptr to use the default local workgroup size of the kernels. The tuner must outlive its use by the scheduler.
+     */
+    void set_tuner(CLTuner *tuner = nullptr)
     {
-        _queue.finish();
+        _cl_tuner = tuner;
     }
 
-    /** Enqueues a marker into the associated command queue and return the event.
+    /** Start batching the enqueued kernels: instead of flushing the queue after each kernel, the queue is flushed every @p flush_interval kernels and when the batch ends.
+     *
+     * @note Batches can be nested: the outermost batch sets the flush interval and the queue is flushed when it ends.
+     *
+     * @note The results of the batched kernels are not synchronised: the caller must call @ref sync (or map a tensor) before reading them on the host.
+     *
+     * @param[in] flush_interval (Optional) Number of kernels between two flushes, 0 to only flush when the batch ends.
+     */
+    void begin_batch(unsigned int flush_interval = 0);
+    /** End the current batch, flushing the queue if it was the outermost one. */
+    void end_batch();
+
+    /** Blocks until all commands in all the command queues have finished. */
+    void sync();
+
+    /** Enqueues a marker into the active command queue and return the event.
      *
-     * @return An event that can be waited on to block the executing thread.
+     * @return An event that can be waited on to block the executing thread, or passed to @ref enqueue_wait() to synchronise another queue.
      */
     cl::Event enqueue_sync_event()
     {
         cl::Event event;
-        _queue.enqueueMarker(&event);
+        queue().enqueueMarker(&event);
 
         return event;
     }
+    /** Run a function without blocking the host: its kernels are enqueued in a single batch, then the active queue is flushed once.
+     *
+     * @note The vision functions which read results back on the host (e.g. @ref CLFastCorners, @ref CLHarrisCorners) only avoid blocking
+     *       in their non-blocking mode, see their set_blocking() method.
+     *
+     * @param[in] function       Function to run.
+     * @param[in] flush_interval (Optional) Number of kernels between two flushes inside the batch, 0 to only flush at the end.
+     *
+     * @return An event which completes when all the commands enqueued by the function are complete.
+     */
+    cl::Event enqueue_function(IFunction &function, unsigned int flush_interval = 0);
 
 private:
-    cl::Context      _context;
-    cl::CommandQueue _queue;
+    /** Enqueue the kernel between two markers, wait for its completion and record its execution in the @ref Profiler.
+     *
+     * @param[in] kernel Kernel to execute.
+     */
+    void enqueue_profiled(ICLKernel &kernel);
+
+    cl::Context                   _context;
+    std::vector<cl::CommandQueue> _queues;
+    unsigned int                  _active_queue;
+    CLTuner                      *_cl_tuner;
+    unsigned int                  _batch_depth;
+    unsigned int                  _flush_interval;
+    unsigned int                  _num_pending_kernels;
+};
+
+/** Enqueue the kernels in a given command queue of @ref CLScheduler during the lifetime of the object, see @ref CLScheduler::set_active_queue. */
+class CLScopedQueue
+{
+public:
+    /** Select the queue
+     *
+     * @param[in] index Index of the queue in which the kernels are enqueued until the object is destroyed.
+     */
+    explicit CLScopedQueue(unsigned int index)
+        : _previous_queue(CLScheduler::get().active_queue())
+    {
+        CLScheduler::get().set_active_queue(index);
+    }
+    /** Prevent instances of this class from being copied */
+    CLScopedQueue(const CLScopedQueue &) = delete;
+    /** Prevent instances of this class from being copied */
+    CLScopedQueue &operator=(const CLScopedQueue &) = delete;
+    /** Select the queue which was active when the object was created */
+    ~CLScopedQueue()
+    {
+        CLScheduler::get().set_active_queue(_previous_queue);
+    }
+
+private:
+    unsigned int _previous_queue;
+};
+
+/** Batch the kernels enqueued by @ref CLScheduler during the lifetime of the object, see @ref CLScheduler::begin_batch. */
+class CLScopedBatch
+{
+public:
+    /** Start a batch
+     *
+     * @param[in] flush_interval (Optional) Number of kernels between two flushes, 0 to only flush when the batch ends.
+     */
+    explicit CLScopedBatch(unsigned int flush_interval = 0)
+    {
+        CLScheduler::get().begin_batch(flush_interval);
+    }
+    /** Prevent instances of this class from being copied */
+    CLScopedBatch(const CLScopedBatch &) = delete;
+    /** Prevent instances of this class from being copied */
+    CLScopedBatch &operator=(const CLScopedBatch &) = delete;
+    /** End the batch */
+    ~CLScopedBatch()
+    {
+        CLScheduler::get().end_batch();
+    }
 };
 }
 #endif /* __ARM_COMPUTE_CLSCHEDULER_H__ */
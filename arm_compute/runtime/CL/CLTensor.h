@@ -29,6 +29,7 @@
 #include "arm_compute/runtime/CL/CLTensorAllocator.h"
 
 #include <cstdint>
+#include <functional>
 
 namespace arm_compute
 {
@@ -45,7 +46,7 @@ public:
      *
      * @return A pointer to the tensor's allocator
      */
-    ITensorAllocator *allocator();
+    CLTensorAllocator *allocator();
     /** Enqueue a map operation of the allocated buffer.
      *
      * @param[in] blocking If true, then the mapping will be ready to use by the time
@@ -54,6 +55,19 @@ public:
      */
     void map(bool blocking = true);
     using ICLTensor::map;
+    /** Enqueue a non-blocking map operation of the allocated buffer and flush the queue.
+     *
+     * The calling thread doesn't wait for the commands enqueued before the map to execute: it can prepare the next inputs meanwhile
+     * and wait for the returned event, or be notified by @p callback, before reading @ref buffer().
+     *
+     * @note The callback is called by a thread of the OpenCL runtime: it must not call blocking OpenCL functions (e.g. @ref CLScheduler::sync())
+     *       and should only read the tensor or hand the result over to another thread.
+     *
+     * @param[in] callback (Optional) Function called with the mapped tensor once the mapping is ready.
+     *
+     * @return An event complete once the mapping is ready to use.
+     */
+    cl::Event map_async(std::function<void(CLTensor &)> callback = nullptr);
     /** Enqueue an unmap operation of the allocated and mapped buffer.
      *
      * @note This method simply enqueues the unmap operation, it is the caller's responsibility to flush the queue and make sure the unmap is finished before
@@ -31,6 +31,9 @@
 
 namespace arm_compute
 {
+class CLMemoryPlanner;
+class Coordinates;
+
 /** Basic implementation of a CL memory tensor allocator. */
 class CLTensorAllocator : public ITensorAllocator
 {
@@ -48,6 +51,28 @@ public:
     /** Default destructor */
     ~CLTensorAllocator() = default;
 
+    /** Make ITensorAllocator's init methods available */
+    using ITensorAllocator::init;
+
+    /** Shares the same OpenCL buffer with another tensor allocator, while the tensor info might be different.
+     *  In other words this can be used to create a sub-tensor from another tensor while sharing the same memory.
+     *
+     * @note The kernels access the sub-tensor through the buffer of the parent and the offset of its first element.
+     * @note The sub-tensor is not resizable: its padding is the padding of the parent on the sides it shares with the parent, none on the other sides.
+     * @note The parent doesn't need to be allocated yet, but its layout (i.e. its padding) must not change anymore and the parent allocator
+     *       must neither be moved nor destroyed while the sub-tensor is in use. @ref allocate() and @ref free() are no-ops on a sub-tensor.
+     *
+     * @param[in] allocator The allocator that owns the OpenCL buffer to be shared.
+     * @param[in] coords    The starting coordinates of the new tensor inside the parent tensor.
+     * @param[in] sub_info  The new tensor information (e.g. shape etc)
+     */
+    void init(const CLTensorAllocator &allocator, const Coordinates &coords, TensorInfo sub_info);
+    /** Check whether the tensor is a sub-tensor of another one, i.e. whether its memory belongs to a parent tensor.
+     *
+     * @return True if the allocator was initialised with a parent allocator.
+     */
+    bool is_sub_tensor() const;
+
     /** Interface to be implemented by the child class to return the pointer to the mapped data. */
     uint8_t *data();
     /** Interface to be implemented by the child class to return the pointer to the CL data. */
@@ -76,13 +101,53 @@ public:
      *
      * @note: The tensor must not already be allocated when calling this function.
      *
+     * @note If the tensor is managed by a @ref CLMemoryPlanner, this only ends its lifetime: its memory is bound when the planner is allocated.
+     *
      */
     void allocate() override;
 
+    /** Use an existing OpenCL buffer as backing memory of the tensor instead of allocating it: no copy is made.
+     *
+     * @note The tensor must not already be allocated nor be managed by a @ref CLMemoryPlanner.
+     *
+     * @note The buffer must hold at least info().total_size() bytes laid out with the strides and the padding of the tensor.
+     *
+     * @param[in] buffer Buffer to use. The buffer is retained by the tensor until it is freed.
+     */
+    void import_memory(cl::Buffer buffer);
+    /** Wrap an existing host allocation (CL_MEM_USE_HOST_PTR) as backing memory of the tensor: no copy is made.
+     *
+     * @note The tensor must not already be allocated nor be managed by a @ref CLMemoryPlanner.
+     *
+     * @note On unified memory devices the allocation is only used in place if it is aligned to the cache line size of the device,
+     *       otherwise the driver is free to make a copy of it.
+     *
+     * @param[in] ptr  Pointer to the host allocation. It must stay valid until the tensor is freed.
+     * @param[in] size Size in bytes of the allocation. Must be at least info().total_size().
+     */
+    void import_host_ptr(void *ptr, size_t size);
+    /** Import a dma_buf file descriptor (ION allocation, AHardwareBuffer native handle, camera buffer...) as backing memory of the tensor: no copy is made.
+     *
+     * @note Requires the cl_arm_import_memory extension.
+     *
+     * @note The tensor must not already be allocated nor be managed by a @ref CLMemoryPlanner.
+     *
+     * @param[in] fd   File descriptor of the dma_buf. It must stay open until the tensor is freed.
+     * @param[in] size Size in bytes of the allocation. Must be at least info().total_size().
+     */
+    void import_dma_buf(int fd, size_t size);
+    /** Check whether the device supports importing dma_buf file descriptors through @ref import_dma_buf.
+     *
+     * @return True if the cl_arm_import_memory extension is available.
+     */
+    static bool dma_buf_import_supported();
+
     /** Free allocated OpenCL memory.
      *
      * @note The tensor must have been allocated when calling this function.
      *
+     * @note Imported memory is not released: only the reference held by the tensor is dropped.
+     *
      */
     void free() override;
 
@@ -96,8 +161,12 @@ protected:
     void unlock() override;
 
 private:
-    cl::Buffer _buffer;  /**< OpenCL buffer containing the tensor data. */
-    uint8_t   *_mapping; /**< Pointer to the CPU mapping of the OpenCL buffer. */
+    friend class CLMemoryPlanner;
+
+    cl::Buffer               _buffer;                    /**< OpenCL buffer containing the tensor data. */
+    const CLTensorAllocator *_parent;                    /**< Allocator owning the OpenCL buffer of the sub-tensor, if any. */
+    uint8_t                 *_mapping;                   /**< Pointer to the CPU mapping of the OpenCL buffer. */
+    CLMemoryPlanner         *_associated_memory_planner; /**< Memory planner the tensor is managed by, if any. */
 };
 }
 #endif /* __ARM_COMPUTE_CLTENSORALLOCATOR_H__ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLTUNER_H__
+#define __ARM_COMPUTE_CLTUNER_H__
+
+#include "arm_compute/core/CL/OpenCL.h"
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace arm_compute
+{
+class ICLKernel;
+
+/** Local workgroup size tuner for the OpenCL kernels.
+ *
+ * The best local workgroup size of a kernel depends on the GPU, the driver and the global workgroup size.
+ * The first time a (kernel, build options, global workgroup size) configuration is enqueued, the tuner runs it
+ * with a range of local workgroup sizes, measures them with profiling events and keeps the fastest one.
+ * The table of the tuned configurations can be saved and reloaded at startup so that production runs only
+ * apply the stored values.
+ *
+ * @note While new configurations are being tuned, the kernels are run several times on their actual tensors, so only
+ *       the kernels for which @ref ICLKernel::is_idempotent() returns true get tuned. The others only get the local
+ *       workgroup size already stored in the table for their configuration, if any.
+ */
+class CLTuner
+{
+public:
+    /** Default constructor: new configurations are tuned. */
+    CLTuner();
+    /** Enable or disable the tuning of the configurations which are not in the table yet.
+     *
+     * @param[in] tune_new_kernels If false, only the configurations already in the table are applied.
+     */
+    void set_tune_new_kernels(bool tune_new_kernels);
+    /** Whether the configurations which are not in the table yet get tuned.
+     *
+     * @return True if new configurations are tuned.
+     */
+    bool tune_new_kernels() const;
+    /** Set the local workgroup size hint of a kernel from the table, tuning it first if needed and enabled.
+     *
+     * @note The work already enqueued on @p queue is finished before a new configuration is tuned.
+     * @note A new configuration is never tuned if the kernel is not idempotent.
+     *
+     * @param[in,out] kernel Kernel about to be enqueued.
+     * @param[in,out] queue  Command queue the kernel is going to be enqueued on.
+     */
+    void tune_kernel(ICLKernel &kernel, cl::CommandQueue &queue);
+    /** Table of the tuned configurations.
+     *
+     * @return Map of the configuration identifiers to their local workgroup size.
+     */
+    const std::map<std::string, cl::NDRange> &lws_table() const;
+    /** Write the table to a text stream: one configuration per line, the identifier followed by the local workgroup size.
+     *
+     * @param[out] stream Output stream.
+     */
+    void save(std::ostream &stream) const;
+    /** Add the configurations written by @ref save() to the table.
+     *
+     * @param[in] stream Input stream.
+     */
+    void load(std::istream &stream);
+
+private:
+    /** Run the kernel with each candidate local workgroup size and return the fastest one.
+     *
+     * @param[in,out] kernel Kernel to tune.
+     * @param[in]     queue  Command queue providing the context and the device to tune on.
+     *
+     * @return The fastest local workgroup size.
+     */
+    cl::NDRange find_optimal_lws(ICLKernel &kernel, cl::CommandQueue &queue);
+
+    std::map<std::string, cl::NDRange> _lws_table;
+    bool                               _tune_new_kernels;
+};
+}
+#endif /*__ARM_COMPUTE_CLTUNER_H__ */
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLUNIFIEDTENSOR_H__
+#define __ARM_COMPUTE_CLUNIFIEDTENSOR_H__
+
+#include "arm_compute/runtime/CL/CLTensor.h"
+
+namespace arm_compute
+{
+/** Side currently allowed to access a @ref CLUnifiedTensor */
+enum class TensorOwner
+{
+    DEVICE, /**< The tensor can be used by OpenCL functions */
+    CPU     /**< The tensor can be used by NEON and CPP functions through @ref ITensor::buffer() */
+};
+
+/** OpenCL tensor explicitly handed over between the OpenCL device and the CPU, so that both the OpenCL and the NEON functions of a pipeline can use it without copies
+ *
+ * The memory is a single CL_MEM_ALLOC_HOST_PTR buffer. It stays mapped as long as the CPU owns the tensor: @ref acquire_for_cpu() and
+ * @ref release_to_device() are the only synchronisation points. On devices sharing the memory with the CPU (e.g. Mali) mapping and unmapping such a buffer
+ * doesn't copy it, therefore switching backends only costs the cache maintenance done by the driver.
+ *
+ * Both kinds of functions can be configured with the tensor whoever owns it, but they must only run when their side owns it:
+ * the data of a tensor owned by the device must not be accessed through @ref ITensor::buffer(), and a tensor owned by the CPU must not be used by
+ * OpenCL kernels.
+ *
+ * @note The tensor is owned by the device after construction. It must be released to the device before being freed.
+ */
+class CLUnifiedTensor : public CLTensor
+{
+public:
+    /** Constructor */
+    CLUnifiedTensor();
+    /** Hand the tensor over to the CPU by mapping it
+     *
+     * The map is enqueued after all the OpenCL commands already enqueued, therefore once it is complete the results of the OpenCL functions are visible to the CPU.
+     * Nothing happens if the CPU already owns the tensor.
+     *
+     * @param[in] blocking (Optional) If true, then the tensor is ready to use by the time this method returns, else it is the caller's responsibility to wait
+     *                     for the queue (e.g. @ref CLScheduler::sync()) before reading @ref buffer().
+     */
+    void acquire_for_cpu(bool blocking = true);
+    /** Hand the tensor over to the OpenCL device by unmapping it
+     *
+     * The writes of the CPU are visible to the OpenCL commands enqueued afterwards. Nothing happens if the device already owns the tensor.
+     */
+    void release_to_device();
+    /** Side currently owning the tensor
+     *
+     * @return @ref TensorOwner::CPU between @ref acquire_for_cpu() and @ref release_to_device(), @ref TensorOwner::DEVICE otherwise.
+     */
+    TensorOwner owner() const;
+
+private:
+    TensorOwner _owner;
+};
+}
+#endif /*__ARM_COMPUTE_CLUNIFIEDTENSOR_H__ */
@@ -27,16 +27,26 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/CL/kernels/CLCol2ImKernel.h"
+#include "arm_compute/core/CL/kernels/CLConvolutionLayerImplicitGEMMKernel.h"
 #include "arm_compute/core/CL/kernels/CLConvolutionLayerWeightsReshapeKernel.h"
+#include "arm_compute/core/CL/kernels/CLDirectConvolutionLayer3x3Kernel.h"
 #include "arm_compute/core/CL/kernels/CLFillBorderKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/CL/kernels/CLIm2ColKernel.h"
+#include "arm_compute/core/CL/kernels/CLSpaceToDepthKernel.h"
+#include "arm_compute/core/CL/kernels/CLWinogradFilterTransformKernel.h"
+#include "arm_compute/core/CL/kernels/CLWinogradInputTransformKernel.h"
+#include "arm_compute/core/CL/kernels/CLWinogradOutputTransformKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CL/CLMemoryGroup.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/ConvolutionMethodTuner.h"
+
+#include <memory>
 
 namespace arm_compute
 {
@@ -46,47 +56,147 @@ class ICLTensor;
  *
  * -# @ref CLConvolutionLayerWeightsReshapeKernel (executed only once for each configuration)
  * -# @ref CLGEMMTranspose1xWKernel               (executed only once for each configuration)
- * -# @ref CLIm2ColKernel
- * -# @ref CLGEMMInterleave4x4Kernel
+ * -# Copy of the transposed weights to a CL image   (executed only once for each configuration, if the weights are stored in an image)
+ * -# @ref CLIm2ColKernel                         (skipped for 1x1 convolutions with stride 1 and no padding)
+ * -# @ref CLGEMMInterleave4x4Kernel              (reads the feature maps of the input straight away for 1x1 convolutions)
  * -# @ref CLGEMMMatrixMultiplyKernel
  * -# @ref CLCol2ImKernel
+ *
+ * If requested, a convolution with a stride greater than 1 is first rewritten as a convolution with a stride of 1 by @ref CLSpaceToDepthKernel,
+ * applied to the input at every run and to the weights the first time the function is run.
+ *
+ * The 3x3 convolutions run with one of the following paths instead:
+ *
+ * -# Winograd F(2x2, 3x3) for the F32 convolutions with a stride of 1: @ref CLWinogradFilterTransformKernel (executed only once for each configuration)
+ *    and @ref CLGEMMTranspose1xWKernel on the weights, @ref CLWinogradInputTransformKernel and @ref CLGEMMInterleave4x4Kernel on the input,
+ *    @ref CLGEMMMatrixMultiplyKernel computing the 16 element-wise products of the tiles and @ref CLWinogradOutputTransformKernel.
+ * -# @ref CLDirectConvolutionLayer3x3Kernel for the other convolutions with a stride of 1 or 2, reading the weights and the input as they are.
+ *
+ * With @ref ConvolutionMethod::IMPLICIT_GEMM, @ref CLConvolutionLayerImplicitGEMMKernel multiplies the reshaped weights by the im2col matrix of the input
+ * without storing it: the transpose of the weights, im2col, interleave and col2im steps and their intermediate tensors are skipped.
+ *
+ * The paths above are selected by heuristics unless a @ref ConvolutionMethodTuner is passed to the constructor: the function then runs the algorithm
+ * stored in the tuner for the layer, after benchmarking the algorithms supporting it on the device the first time the layer is configured.
  */
 class CLConvolutionLayer : public IFunction
 {
 public:
-    /** Default constructor */
-    CLConvolutionLayer();
+    /** Constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner providing the memory of the intermediate tensors. They are allocated individually if nullptr.
+     *                           If set, the planner must be allocated before the function is run.
+     * @param[in] tuner          (Optional) Tuner selecting the algorithm of the convolution, nullptr to select it with the heuristics and the space_to_depth argument of configure().
+     *                           It must outlive the calls to configure().
+     */
+    CLConvolutionLayer(std::shared_ptr<CLMemoryPlanner> memory_planner = nullptr, ConvolutionMethodTuner *tuner = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLConvolutionLayer(const CLConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLConvolutionLayer &operator=(const CLConvolutionLayer &) = delete;
     /** Set the input and output tensors.
      *
-     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
-     *                       while every optional dimension from 4 and above represent a batch of inputs.
-     *                       Data types supported: F16, F32.
-     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
-     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported:Same as @p input.
-     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                       Data types supported: Same as @p input.
-     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  input          Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                            while every optional dimension from 4 and above represent a batch of inputs.
+     *                            Data types supported: F16, F32.
+     * @param[in]  weights        Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported:Same as @p input.
+     * @param[in]  biases         Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported:Same as @p input.
+     * @param[out] output         Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
+     *                            Data types supported: Same as @p input.
+     * @param[in]  conv_info      Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info       (Optional) Activation function applied to the output before it is stored. Disabled by default.
+     * @param[in]  image          (Optional) Store the transposed weights in a CL image so that the matrix multiplication reads them through the texture cache.
+     *                            Ignored if the device or the shape of the weights doesn't support it. Only F32 is supported.
+     * @param[in]  space_to_depth (Optional) Rewrite a convolution with the same stride s > 1 along X and Y and a square kernel larger than s as a convolution
+     *                            with a stride of 1 and a kernel of ceil(kernel / s) over s * s times more input feature maps (See @ref CLSpaceToDepthKernel).
+     *                            The im2col step of the large-stride first layers of a network then reads consecutive pixels. Defaults to false.
      */
-    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info);
+    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info = ActivationLayerInfo(),
+                   bool image = false, bool space_to_depth = false);
 
     // Inherited methods overridden:
     void run() override;
+    /** Enqueue the reshape of the weights */
+    void prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
+    /** Configure the convolution with the given algorithm.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F16, F32.
+     * @param[in]  weights   Weights tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  Activation function applied to the output before it is stored.
+     * @param[in]  image     Store the transposed weights in a CL image.
+     * @param[in]  method    Algorithm to use. The heuristics select the algorithm if it is @ref ConvolutionMethod::DEFAULT, the matrix multiplication
+     *                       runs on the original tensors if the algorithm doesn't support the layer.
+     */
+    void configure_method(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                          bool image, ConvolutionMethod method);
+    /** Configure the Winograd F(2x2, 3x3) path.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[in]  weights   Weights tensor with dimensions [3, 3, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. The stride must be 1.
+     * @param[in]  act_info  Activation function applied to the output before it is stored.
+     * @param[in]  num_tiles Number of 2x2 output tiles across all the batches.
+     */
+    void configure_winograd(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                            unsigned int num_tiles);
+    /** Algorithm selected when the function was configured.
+     *
+     * @return The algorithm the function runs, never @ref ConvolutionMethod::DEFAULT.
+     */
+    ConvolutionMethod selected_method() const;
+    /** Benchmark the algorithms supporting a layer on tensors of the same shapes and return the fastest one.
+     *
+     * @param[in] input     Source tensor.
+     * @param[in] weights   Weights tensor.
+     * @param[in] biases    Biases tensor. Can be nullptr.
+     * @param[in] output    Destination tensor.
+     * @param[in] conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] act_info  Activation function applied to the output before it is stored.
+     * @param[in] image     Store the transposed weights in a CL image.
+     *
+     * @return The fastest algorithm.
+     */
+    static ConvolutionMethod find_fastest_method(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, const ICLTensor *output, const PadStrideInfo &conv_info,
+                                                 const ActivationLayerInfo &act_info, bool image);
+
+    CLMemoryGroup                          _memory_group;
     CLIm2ColKernel                         _input_im2col_kernel;
     CLConvolutionLayerWeightsReshapeKernel _weights_reshape_kernel;
     CLGEMMInterleave4x4Kernel              _input_interleave_kernel;
     CLGEMMTranspose1xWKernel               _weights_transposed_kernel;
     CLGEMMMatrixMultiplyKernel             _mm_kernel;
     CLCol2ImKernel                         _output_col2im_kernel;
+    CLSpaceToDepthKernel                   _input_space_to_depth_kernel;
+    CLSpaceToDepthKernel                   _weights_space_to_depth_kernel;
+    CLConvolutionLayerImplicitGEMMKernel   _implicit_gemm_kernel;
+    CLDirectConvolutionLayer3x3Kernel      _direct_kernel;
+    CLWinogradFilterTransformKernel        _winograd_filter_transform_kernel;
+    CLWinogradInputTransformKernel         _winograd_input_transform_kernel;
+    CLWinogradOutputTransformKernel        _winograd_output_transform_kernel;
     CLTensor                               _input_im2col_reshaped;
     CLTensor                               _input_interleaved_reshaped;
     CLTensor                               _weights_reshaped;
     CLTensor                               _weights_transposed;
     CLTensor                               _gemm_output;
+    CLTensor                               _input_space_to_depth;
+    CLTensor                               _weights_space_to_depth;
+    cl::Image2D                            _weights_image;
+    ConvolutionMethodTuner                *_tuner;
     bool                                   _is_first_run;
     bool                                   _has_bias;
     bool                                   _is_fc;
+    bool                                   _is_1x1;
+    bool                                   _use_space_to_depth;
+    bool                                   _use_implicit_gemm;
+    bool                                   _use_direct;
+    bool                                   _use_winograd;
 };
 }
 #endif /* __ARM_COMPUTE_CLCONVOLUTIONLAYER_H__ */
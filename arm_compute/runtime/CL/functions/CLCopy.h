@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLCOPY_H__
+#define __ARM_COMPUTE_CLCOPY_H__
+
+#include "arm_compute/core/CL/kernels/CLDepthConvertKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+class ITensor;
+
+/** Basic function to copy a tensor to a tensor of the same shape, whatever their paddings and strides, between OpenCL tensors or between a tensor of the host and an OpenCL tensor.
+ *
+ * Between two OpenCL tensors, the function enqueues:
+ *
+ * -# A single copy of the whole buffer if the two tensors have the same data type and a contiguous layout (See @ref has_contiguous_layout()).
+ * -# Copies of rectangular regions of the buffers (clEnqueueCopyBufferRect) if they have the same data type.
+ * -# @ref CLDepthConvertKernel if they have different data types.
+ *
+ * Between a tensor of the host (e.g. a @ref Tensor of the NEON functions) and an OpenCL tensor, the rows are written or read by the OpenCL runtime
+ * directly from or to the buffer of the host tensor (clEnqueueWriteBufferRect / clEnqueueReadBufferRect), without mapping the OpenCL tensor.
+ * Both tensors must then have the same data type.
+ *
+ * @note The copies from or to the host block until the host tensor can be reused or read, the copies between OpenCL tensors don't.
+ */
+class CLCopy : public IFunction
+{
+public:
+    /** Default constructor */
+    CLCopy();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopy(const CLCopy &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLCopy &operator=(const CLCopy &) = delete;
+    /** Initialise the function to copy an OpenCL tensor to another one
+     *
+     * Valid conversions Input -> Output are the ones of @ref CLDepthConvertKernel, between integer data types (with @p policy) or from or to a floating point data type.
+     *
+     * @param[in]  input  Source tensor. Data types supported: All if no conversion is needed.
+     * @param[out] output Destination tensor, of the same shape and number of channels as @p input.
+     * @param[in]  policy (Optional) Conversion policy between integer data types. Defaults to @ref ConvertPolicy::SATURATE.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, ConvertPolicy policy = ConvertPolicy::SATURATE);
+    /** Initialise the function to upload a tensor of the host to an OpenCL tensor
+     *
+     * @param[in]  input  Source tensor of the host. Data types supported: All
+     * @param[out] output Destination tensor, of the same shape and data type as @p input.
+     */
+    void configure(const ITensor *input, ICLTensor *output);
+    /** Initialise the function to download an OpenCL tensor to a tensor of the host
+     *
+     * @param[in]  input  Source tensor. Data types supported: All
+     * @param[out] output Destination tensor of the host, of the same shape and data type as @p input.
+     */
+    void configure(const ICLTensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    /** Location of the source and the destination of the copy */
+    enum class Direction
+    {
+        DEVICE_TO_DEVICE, /**< Between two OpenCL tensors */
+        HOST_TO_DEVICE,   /**< From a tensor of the host to an OpenCL tensor */
+        DEVICE_TO_HOST    /**< From an OpenCL tensor to a tensor of the host */
+    };
+
+    const ITensor       *_input;
+    ITensor             *_output;
+    const ICLTensor     *_cl_input;
+    ICLTensor           *_cl_output;
+    Direction            _direction;
+    CLDepthConvertKernel _convert_kernel;
+    bool                 _is_conversion;
+};
+}
+#endif /*__ARM_COMPUTE_CLCOPY_H__ */
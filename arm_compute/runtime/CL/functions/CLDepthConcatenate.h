@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLDEPTHCONCATENATE_H__
+#define __ARM_COMPUTE_CLDEPTHCONCATENATE_H__
+
+#include "arm_compute/core/CL/kernels/CLDepthConcatenateKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class CLTensor;
+class ICLTensor;
+
+/** Basic function to concatenate tensors along the depth (Z) dimension.
+ *
+ * Whenever possible the inputs become sub-tensors of their slice of the output (See @ref CLTensorAllocator::init): the functions producing them
+ * write straight into the output and nothing is left to do when the function runs. The other inputs are copied by a @ref CLDepthConcatenateKernel:
+ *
+ * -# the inputs already allocated or which are already sub-tensors of another tensor,
+ * -# if the output is already allocated, the inputs which need more padding than the output provides.
+ *
+ * @note The functions writing the inputs must be configured before this function (So that the padding they need is known)
+ *       and the functions reading the output must be configured before it too: the layout of the output cannot change anymore once the inputs share its memory.
+ */
+class CLDepthConcatenate : public IFunction
+{
+public:
+    /** Default constructor */
+    CLDepthConcatenate();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLDepthConcatenate(const CLDepthConcatenate &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLDepthConcatenate &operator=(const CLDepthConcatenate &) = delete;
+    /** Allow instances of this class to be moved */
+    CLDepthConcatenate(CLDepthConcatenate &&) = default;
+    /** Allow instances of this class to be moved */
+    CLDepthConcatenate &operator=(CLDepthConcatenate &&) = default;
+    /** Initialise the function's inputs and output.
+     *
+     * @param[in,out] inputs Tensors to concatenate, in the order of their planes in @p output. Data types supported: All.
+     *                       Their width, height and batches must be the ones of @p output. The inputs which are not allocated yet might become sub-tensors of @p output.
+     * @param[out]    output Output tensor. Data type supported: same as @p inputs. Its depth must be the sum of the depths of @p inputs.
+     */
+    void configure(const std::vector<CLTensor *> &inputs, CLTensor *output);
+    /** Number of inputs which are copied into the output when the function runs.
+     *
+     * @return 0 if all the inputs are written straight into the output.
+     */
+    unsigned int num_copies() const;
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    std::unique_ptr<CLDepthConcatenateKernel[]> _copy_kernels;
+    unsigned int                                _num_copies;
+    std::vector<const ICLTensor *>              _sub_tensors;
+    const ICLTensor                            *_output;
+};
+}
+#endif /* __ARM_COMPUTE_CLDEPTHCONCATENATE_H__ */
@@ -55,6 +55,22 @@ public:
      * @param[in]  shift  Value for down/up conversions. Must be 0 <= shift < 8.
      */
     void configure(const ICLTensor *input, ICLTensor *output, ConvertPolicy policy, uint32_t shift);
+    /** Set the input and output of the kernel for a conversion from or to a floating point data type
+     *
+     * The output is computed as: output = input * scale + offset, in single precision.
+     *
+     * Valid conversions Input -> Output :
+     *
+     *   - U8 -> F32
+     *   - F16 -> F32
+     *   - F32 -> U8 (rounded to the nearest integer and saturated), F16
+     *
+     * @param[in]  input  The input tensor to convert. Data types supported: U8, F16 or F32.
+     * @param[out] output The output tensor. Data types supported: U8, F16 or F32.
+     * @param[in]  scale  (Optional) Scale applied to the input values. Defaults to 1.
+     * @param[in]  offset (Optional) Offset added to the scaled input values. Defaults to 0.
+     */
+    void configure(const ICLTensor *input, ICLTensor *output, float scale = 1.f, float offset = 0.f);
 };
 }
 #endif /*__ARM_COMPUTE_CLDEPTHCONVERT_H__*/
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLDEPTHWISECONVOLUTIONLAYER_H__
+#define __ARM_COMPUTE_CLDEPTHWISECONVOLUTIONLAYER_H__
+
+#include "arm_compute/runtime/CL/ICLSimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to execute a depthwise 3x3 convolution. This function calls the following OpenCL kernels:
+ *
+ * -# @ref CLFillBorderKernel (executed if padding size is different from zero)
+ * -# @ref CLDepthwiseConvolution3x3Kernel
+ */
+class CLDepthwiseConvolutionLayer : public ICLSimpleFunction
+{
+public:
+    /** Set the input, weights, biases and output tensors.
+     *
+     * @param[in,out] input     Source tensor. 3 lower dimensions represent a single input [width, height, FM],
+     *                          while the optional 4th dimension represents a batch of inputs. Data types supported: F16, F32. (Written to only for border filling).
+     * @param[in]     weights   Weights tensor with dimensions [3, 3, FM]. Data type supported: Same as @p input.
+     * @param[in]     biases    Biases tensor with dimensions [FM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out]    output    Destination tensor. 3 lower dimensions represent a single output [width, height, FM], while the 4th dimension represents the batch of outputs.
+     *                          Data types supported: Same as @p input.
+     * @param[in]     conv_info Contains padding and stride information described in @ref PadStrideInfo. Supported strides: 1 and 2.
+     */
+    void configure(ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info);
+};
+}
+#endif /* __ARM_COMPUTE_CLDEPTHWISECONVOLUTIONLAYER_H__ */
@@ -34,6 +34,7 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -44,7 +45,7 @@ using ICLImage = ICLTensor;
  *
  * -# @ref CLFastCornersKernel
  * -# @ref CLNonMaximaSuppression3x3Kernel (executed if nonmax_suppression == true)
- * -# @ref CLCopyToArrayKernel
+ * -# @ref CLCompactToArrayKernel
  *
  */
 class CLFastCorners : public IFunction
@@ -68,13 +69,38 @@ public:
      */
     void configure(const ICLImage *input, float threshold, bool nonmax_suppression, CLKeyPointArray *corners, unsigned int *num_corners,
                    BorderMode border_mode, uint8_t constant_border_value = 0);
+    /** Select whether run() waits for the number of corners
+     *
+     * In non-blocking mode run() only enqueues commands: the corners stay on the device, where they can be consumed by the next stage (e.g. @ref CLOpticalFlow)
+     * without any mapping, and @ref sync_corners() must be called before using the number of corners on the host.
+     *
+     * @note In non-blocking mode the corners array keeps its number of values: the values past the number of corners found by the last run must be ignored.
+     *
+     * @param[in] blocking True (default) to read back the number of corners at the end of run(), false to defer it to @ref sync_corners().
+     */
+    void set_blocking(bool blocking);
+    /** Wait for the number of corners of the last non-blocking run, then update the size of the corners array and the number of corners passed to configure() */
+    void sync_corners();
+    /** Device buffer holding the number of corners found by the last run
+     *
+     * The buffer is written on the device, so it can be passed to the next stage (e.g. @ref CLOpticalFlow) to only process the corners found,
+     * without waiting for them on the host.
+     *
+     * @note The number of corners can be greater than the maximum number of values of the corners array.
+     *
+     * @return The buffer holding the number of corners as a single unsigned int.
+     */
+    const cl::Buffer &num_corners_buffer() const;
     // Inherited methods overridden:
     void run() override;
 
 private:
+    /** Update the size of the corners array and the number of corners passed to configure() from the number of corners read back from the device */
+    void update_num_corners();
+
     CLFastCornersKernel       _fast_corners_kernel;
     CLNonMaximaSuppression3x3 _suppr_func;
-    CLCopyToArrayKernel       _copy_array_kernel;
+    CLCompactToArrayKernel    _copy_array_kernel;
     CLImage                   _output;
     CLImage                   _suppr;
     Window                    _win;
@@ -83,6 +109,10 @@ private:
     cl::Buffer                _num_buffer;
     CLKeyPointArray          *_corners;
     uint8_t                   _constant_border_value;
+    bool                      _blocking;
+    unsigned int              _num_corners_read;  /**< Number of corners read back from the device */
+    cl::Event                 _num_corners_event; /**< Completion of the non-blocking read of the number of corners */
+    std::vector<uint8_t>      _zeros;             /**< Zeros uploaded to reset the output of the non-maxima suppression without mapping it */
 };
 }
 #endif /*__ARM_COMPUTE_CLFASTCORNERS_H__ */
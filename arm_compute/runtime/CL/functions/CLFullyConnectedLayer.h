@@ -29,9 +29,9 @@
 #include "arm_compute/core/CL/kernels/CLGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixAccumulateBiasesKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMMatrixMultiplyKernel.h"
+#include "arm_compute/core/CL/kernels/CLGEMMMatrixVectorMultiplyKernel.h"
 #include "arm_compute/core/CL/kernels/CLGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/CL/kernels/CLIm2ColKernel.h"
-#include "arm_compute/core/CL/kernels/CLTransposeKernel.h"
 #include "arm_compute/runtime/CL/CLTensor.h"
 
 namespace arm_compute
@@ -39,53 +39,72 @@ namespace arm_compute
 /** Basic function to compute a Fully Connected layer on OpenCL. This function calls the following OpenCL kernels:
  *
  *  -# @ref CLIm2ColKernel (called when the input comes from a convolutional layer)
- *  -# @ref CLTransposeKernel (if @p transpose_weights is set to true) (called once)
- *  -# @ref NEGEMMTranspose1xWKernel (called once if we have a multi-batch input)
- *  -# @ref NEGEMMInterleave4x4Kernel (called if we have a multi-batch input)
- *  -# @ref NEGEMMMatrixMultiplyKernel
- *  -# @ref CLGEMMMatrixAccumulateBiasesKernel (if @p biases is not equal to nullptr)
+ *  -# @ref CLGEMMInterleave4x4Kernel (called once on the weights if @p transpose_weights is set to true and we have a multi-batch input)
+ *  -# @ref CLGEMMTranspose1xWKernel (called once on the weights if @p transpose_weights is set to false and we have a multi-batch input)
+ *  -# @ref CLGEMMInterleave4x4Kernel (called if we have a multi-batch input)
+ *  -# @ref CLGEMMMatrixMultiplyKernel (if we have a multi-batch input or @p transpose_weights is set to false)
+ *  -# @ref CLGEMMMatrixVectorMultiplyKernel (if we have a single-batch input and @p transpose_weights is set to true: the weights are read without being transposed)
+ *  -# @ref CLGEMMMatrixAccumulateBiasesKernel (if @p biases is not equal to nullptr and @ref CLGEMMMatrixVectorMultiplyKernel is not used)
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
+ * @note  With a multi-batch input the weights are reshaped directly, without an intermediate transposed copy, the first time the function is run:
+ *        they are then marked as unused (See @ref ITensor::is_used()) so that their memory can be released.
+ * @note  With a single-batch input and @p transpose_weights set to true, the weights can be stored in F16 for an F32 input, or quantized in U8 with one scale per output:
+ *        they are dequantized on the fly by @ref CLGEMMMatrixVectorMultiplyKernel, which reads 2 or 4 times less memory than with weights of the input data type.
  */
 class CLFullyConnectedLayer : public IFunction
 {
 public:
     /** Constructor */
     CLFullyConnectedLayer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLFullyConnectedLayer(const CLFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CLFullyConnectedLayer &operator=(const CLFullyConnectedLayer &) = delete;
     /** Set the input and output tensors.
      *
      * @param[in]  input             Source tensor. Data type supported: F16, F32.
-     * @param[in]  weights           Weights tensor. The weights must be 2 dimensional. Data type supported: Same as @p input
+     * @param[in]  weights           Weights tensor. The weights must be 2 dimensional. Data type supported: Same as @p input.
+     *                               F16 for an F32 input and U8 are also supported with a single-batch input if @p transpose_weights is true:
+     *                               U8 weights are dequantized as scale * (value - offset), with the offset of their quantization settings (see @ref TensorInfo::quantization_info()).
      * @param[in]  biases            Bias tensor. It can be nullptr. Data type supported:Same as @p input.
      * @param[out] output            Destination tensor. Data type supported: Same as @p input.
      * @param[in]  transpose_weights (Optional) Transpose weights if true. Defaults to true.
+     * @param[in]  weights_scales    (Optional) Scales of the U8 weights, one per output: 1D tensor with dimensions [num_outputs]. Required for U8 weights. Data type supported: Same as @p input.
      */
-    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, bool transpose_weights = true);
+    void configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, bool transpose_weights = true, const ICLTensor *weights_scales = nullptr);
 
     //Inherited methods override
     void run() override;
+    /** Enqueue the reshape of the weights */
+    void prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     void configure_fc_fc_wb(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output);
     void configure_fc_fc_nb(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output);
     void configure_conv_fc_wb(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output);
+    void configure_reshape_weights(const ICLTensor *weights);
     void configure_conv_fc_nb(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output);
+    void configure_mv(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const ICLTensor *weights_scales);
 
     CLIm2ColKernel                     _im2col_kernel;
-    CLTransposeKernel                  _transpose_kernel;
     CLGEMMTranspose1xWKernel           _transpose1xW_kernel;
+    CLGEMMInterleave4x4Kernel          _interleave_weights_kernel;
     CLGEMMInterleave4x4Kernel          _interleave4x4_kernel;
     CLGEMMMatrixMultiplyKernel         _mm_kernel;
+    CLGEMMMatrixVectorMultiplyKernel   _mv_kernel;
     CLGEMMMatrixAccumulateBiasesKernel _accumulate_biases_kernel;
     CLTensor                           _im2col_output;
     CLTensor                           _interleave4x4_output;
-    CLTensor                           _transpose_output;
     CLTensor                           _transpose1xW_output;
+    const ICLTensor                   *_original_weights;
     bool                               _is_first_run;
     bool                               _transpose_weights;
     bool                               _fc_after_conv;
     bool                               _batched_fc_layer;
     bool                               _accumulate_biases;
+    bool                               _run_matrix_vector;
 };
 }
 #endif /* __ARM_COMPUTE_CLFULLYCONNECTEDLAYER_H__ */
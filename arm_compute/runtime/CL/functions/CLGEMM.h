@@ -68,6 +68,7 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
     CLGEMMInterleave4x4Kernel  _interleave_kernel;
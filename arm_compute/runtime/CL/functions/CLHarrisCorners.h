@@ -80,6 +80,17 @@ public:
     void configure(ICLImage *input, float threshold, float min_dist, float sensitivity,
                    int32_t gradient_size, int32_t block_size, ICLKeyPointArray *corners,
                    BorderMode border_mode, uint8_t constant_border_value = 0);
+    /** Select whether run() also runs the host stages
+     *
+     * The corner candidates and the euclidean distance stages run on the host, on the mapped non-maxima suppressed image.
+     * In non-blocking mode run() only enqueues the device stages, and the host stages are deferred to @ref sync_corners(),
+     * so that the caller can enqueue more work before waiting for the device.
+     *
+     * @param[in] blocking True (default) to run all the stages in run(), false to defer the host stages to @ref sync_corners().
+     */
+    void set_blocking(bool blocking);
+    /** Run the host stages of the last non-blocking run, which fill the corners array */
+    void sync_corners();
 
     // Inherited methods overridden:
     void run() override;
@@ -99,6 +110,8 @@ private:
     std::unique_ptr<InternalKeypoint[]> _corners_list;          /**< Array of InternalKeypoint. It stores the potential corner candidates */
     int32_t                             _num_corner_candidates; /**< Number of potential corner candidates */
     ICLKeyPointArray                   *_corners;               /**< Output corners array */
+    bool                                _blocking;              /**< True if run() runs the host stages */
+    bool                                _pending_host_stages;   /**< True if the host stages of the last run still have to be run */
 };
 }
 #endif /*__ARM_COMPUTE_CLHARRISCORNERS_H__ */
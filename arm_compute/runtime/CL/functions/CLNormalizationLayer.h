@@ -26,10 +26,7 @@
 
 #include "arm_compute/runtime/IFunction.h"
 
-#include "arm_compute/core/CL/kernels/CLFillBorderKernel.h"
 #include "arm_compute/core/CL/kernels/CLNormalizationLayerKernel.h"
-#include "arm_compute/core/CL/kernels/CLPixelWiseMultiplicationKernel.h"
-#include "arm_compute/runtime/CL/CLTensor.h"
 
 #include "arm_compute/core/Types.h"
 
@@ -39,10 +36,9 @@ class ICLTensor;
 
 /** Basic function to simulate a normalization layer. This function calls the following CL kernels:
  *
- * -# @ref CLPixelWiseMultiplicationKernel
- * -# @ref CLFillBorderKernel
  * -# @ref CLNormalizationLayerKernel
  *
+ * @note The squares of the input are computed by the normalization kernel itself, so no intermediate tensor is needed.
  */
 class CLNormalizationLayer : public IFunction
 {
@@ -62,10 +58,7 @@ public:
     void run() override;
 
 private:
-    CLTensor                        _squared_input;   /**< The intermediate buffer which stores results of squaring input*/
-    CLNormalizationLayerKernel      _norm_kernel;     /**< Normalization layer kernel to run */
-    CLPixelWiseMultiplicationKernel _multiply_kernel; /**< Pixel multiplication kernel to run */
-    CLFillBorderKernel              _border_handler;  /**< Kernel to handle  borders */
+    CLNormalizationLayerKernel _norm_kernel; /**< Normalization layer kernel to run */
 };
 }
 #endif /* __ARM_COMPUTE_CLNORMALIZATIONLAYER_H__ */
@@ -52,6 +52,9 @@ using CLOldValueArray           = CLArray<CLOldValue>;
  * -# @ref CLLKTrackerStage0Kernel
  * -# @ref CLLKTrackerStage1Kernel
  * -# @ref CLLKTrackerFinalizeKernel
+ *
+ * The function never blocks the host: the keypoints are read and written on the device, so the output of @ref CLFastCorners in non-blocking mode
+ * can be tracked without mapping it, and the whole pipeline can be run with @ref CLScheduler::enqueue_function().
  */
 class CLOpticalFlow : public IFunction
 {
@@ -80,12 +83,15 @@ public:
      * @param[in]  use_initial_estimate  The flag to indicate whether the initial estimated position should be used
      * @param[in]  border_mode           The border mode applied at scharr kernel stage
      * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT
+     * @param[in]  num_points            (Optional) Device buffer holding the number of old key points to track (e.g. @ref CLFastCorners::num_corners_buffer()).
+     *                                   If set, the number of values of the arrays is ignored: the tracker is configured for the maximum number of values of @p old_points,
+     *                                   only the key points below the number read on the device are tracked and @p new_points is resized to its maximum number of values.
      *
      */
     void configure(const CLPyramid *old_pyramid, const CLPyramid *new_pyramid,
                    const ICLKeyPointArray *old_points, const ICLKeyPointArray *new_points_estimates, ICLKeyPointArray *new_points,
                    Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, bool use_initial_estimate,
-                   BorderMode border_mode, uint8_t constant_border_value = 0);
+                   BorderMode border_mode, uint8_t constant_border_value = 0, const cl::Buffer *num_points = nullptr);
 
     // Inherited methods overridden:
     void run() override;
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLROIPOOLINGLAYER_H__
+#define __ARM_COMPUTE_CLROIPOOLINGLAYER_H__
+
+#include "arm_compute/runtime/CL/ICLSimpleFunction.h"
+
+#include "arm_compute/core/CL/ICLArray.h"
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to pool regions of interest of feature maps in a single pass. This function calls the following OpenCL kernels:
+ *
+ * -# @ref CLROIPoolingLayerKernel
+ *
+ * The pooled features of all the regions are laid out as a batch, e.g. for the fully connected layers of the head of a two-stage detector.
+ */
+class CLROIPoolingLayer : public ICLSimpleFunction
+{
+public:
+    /** Set the input and output tensors.
+     *
+     * @note Only the first rois->num_values() regions are pooled at each run.
+     *
+     * @param[in]  input     Source tensor: feature maps [width, height, channels, batches]. Data types supported: F16, F32.
+     * @param[in]  rois      Regions of interest, in the coordinates of the image the feature maps are computed from.
+     * @param[out] output    Destination tensor [pooled width, pooled height, channels, rois->max_num_values()]. Data types supported: Same as @p input.
+     * @param[in]  pool_info Contains the size of the output of each region and the scale of the regions described in @ref ROIPoolingLayerInfo.
+     */
+    void configure(const ICLTensor *input, const ICLROIArray *rois, ICLTensor *output, const ROIPoolingLayerInfo &pool_info);
+};
+}
+#endif /* __ARM_COMPUTE_CLROIPOOLINGLAYER_H__ */
@@ -37,6 +37,9 @@ class ICLTensor;
  *
  * -# @ref CLFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref CLRemapKernel
+ *
+ * @note With @ref InterpolationPolicy::BILINEAR and U8 2D tensors, the input is copied to an image by @ref CLCopyToImageKernel
+ *       and interpolated by the texture sampler when the device supports CL_R / CL_UNORM_INT8 images.
  */
 class CLRemap : public ICLSimpleFunction
 {
@@ -33,18 +33,23 @@ namespace arm_compute
 {
 class ICLTensor;
 
-/** Basic function to run @ref CLScaleKernel */
+/** Basic function to run @ref CLScaleKernel, or @ref CLScaleAreaKernel to downscale U8 images with @ref InterpolationPolicy::AREA
+ *
+ * @note With @ref InterpolationPolicy::BILINEAR and U8 2D tensors, the input is copied to an image by @ref CLCopyToImageKernel
+ *       and interpolated by the texture sampler when the device supports CL_R / CL_UNORM_INT8 images.
+ */
 class CLScale : public ICLSimpleFunction
 {
 public:
     /** Initialize the function's source, destination, interpolation type and border_mode.
      *
-     * @param[in,out] input                 Source tensor. Data types supported: U8, S16. (Written to only for @p border_mode != UNDEFINED)
-     * @param[out]    output                Destination tensor. Data types supported: U8, S16 (Must be the same as the input tensor).
+     * @param[in,out] input                 Source tensor. Data types supported: U8, S16. Formats supported: RGB888, RGBA8888 with NEAREST_NEIGHBOR and BILINEAR interpolation.
+     *                                      (Written to only for @p border_mode != UNDEFINED)
+     * @param[out]    output                Destination tensor. Data types supported: U8, S16 (Must be the same as the input tensor). Formats supported: same as @p input.
      *                                      All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]     policy                The interpolation type.
      * @param[in]     border_mode           Strategy to use for borders.
-     * @param[in]     constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]     constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT. Used for all the channels of multi-channel images.
      */
     void configure(ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0);
 };
@@ -25,7 +25,6 @@
 #define __ARM_COMPUTE_CLSOFTMAXLAYER_H__
 
 #include "arm_compute/core/CL/kernels/CLSoftmaxLayerKernel.h"
-#include "arm_compute/runtime/CL/CLTensor.h"
 #include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
@@ -37,10 +36,10 @@ class ICLTensor;
  * Softmax is calculated by :
  * @f[ out = exp(x - max(x)) / sum(exp(x - max(x))) @f]
  *
- * This function runs the following kernels:
- * -# @ref CLLogits1DMaxKernel
- * -# @ref CLLogits1DShiftExpSumKernel
- * -# @ref CLLogits1DNormKernel
+ * This function runs the following kernel:
+ * -# @ref CLLogits1DFusedKernel
+ *
+ * @note Each row (one sample of a batch) is reduced by a single work-group, so a single kernel is enqueued and no intermediate tensor is allocated.
  */
 class CLSoftmaxLayer : public IFunction
 {
@@ -58,12 +57,7 @@ public:
     void run() override;
 
 private:
-    CLLogits1DMaxKernel         _max_kernel;
-    CLLogits1DShiftExpSumKernel _shift_exp_sum_kernel;
-    CLLogits1DNormKernel        _norm_kernel;
-    CLTensor                    _max;
-    CLTensor                    _sum;
-    CLTensor                    _tmp;
+    CLLogits1DFusedKernel _softmax_kernel;
 };
 }
 #endif /* __ARM_COMPUTE_CLSOFTMAXLAYER_H__ */
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CLTOPKV_H__
+#define __ARM_COMPUTE_CLTOPKV_H__
+
+#include "arm_compute/core/CL/kernels/CLTopKVKernel.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+class ICLTensor;
+
+/** Basic function to find the k highest scores of each row of a classification output, and their indices.
+ *
+ * @note Only @p indices and @p scores need to be mapped to read the result back.
+ *
+ * This function runs the following kernel:
+ * -# @ref CLTopKVKernel
+ */
+class CLTopKV : public IFunction
+{
+public:
+    /** Default constructor */
+    CLTopKV();
+    /** Set the input and output tensors.
+     *
+     * @param[in]  input   Source tensor. The top k is computed along the 1st dimension,
+     *                     while every higher dimension represents a batch of inputs. Data types supported: F32.
+     * @param[out] indices Indices of the top k values of each row, in descending order of the values.
+     *                     The 1st dimension must be @p k, the other ones must match @p input. Data types supported: U32.
+     * @param[out] scores  Top k values of each row, in descending order. Same shape as @p indices. Data types supported: same as @p input.
+     * @param[in]  k       Number of values to find in each row. Must not be greater than the 1st dimension of @p input.
+     */
+    void configure(const ICLTensor *input, ICLTensor *indices, ICLTensor *scores, unsigned int k);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    CLTopKVKernel _top_k_kernel;
+};
+}
+#endif /* __ARM_COMPUTE_CLTOPKV_H__ */
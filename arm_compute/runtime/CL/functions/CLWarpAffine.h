@@ -33,7 +33,11 @@ namespace arm_compute
 {
 class ICLTensor;
 
-/** Basic function to run @ref CLWarpAffineKernel for AFFINE transformation */
+/** Basic function to run @ref CLWarpAffineKernel for AFFINE transformation
+ *
+ * @note With @ref InterpolationPolicy::BILINEAR and U8 2D tensors, the input is copied to an image by @ref CLCopyToImageKernel
+ *       and interpolated by the texture sampler when the device supports CL_R / CL_UNORM_INT8 images.
+ */
 class CLWarpAffine : public ICLSimpleFunction
 {
 public:
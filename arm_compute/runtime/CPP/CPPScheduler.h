@@ -24,35 +24,193 @@
 #ifndef __ARM_COMPUTE_CPPSCHEDULER_H__
 #define __ARM_COMPUTE_CPPSCHEDULER_H__
 
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <chrono>
 #include <cstddef>
+#include <functional>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <string>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
 
 namespace arm_compute
 {
+class AsyncQueue;
 class ICPPKernel;
 class Thread;
+struct JobSync;
+struct SplitRecords;
 
-/** Pool of threads to automatically split a kernel's execution among several threads. */
-class CPPScheduler
+/** Pool of threads to automatically split a kernel's execution among several threads.
+ *
+ * Besides the singleton returned by @ref get(), schedulers can be instantiated: each instance owns its pool of threads, so that several networks
+ * run concurrently from different application threads, each on its own subset of the cores (See @ref set_affinity() and @ref Scheduler::set_thread_scheduler()).
+ *
+ * A target latency per inference switches the scheduler to an adaptive mode (See @ref set_target_latency()) for sustained workloads like
+ * continuous video inference: it then only uses as many threads of its pool as needed to meet the target, which leaves the device
+ * cooler and avoids the thermal throttling that running all the cores flat out triggers.
+ *
+ * The functions can also be run without blocking the application thread (See @ref run_async()): a thread of the scheduler then runs them
+ * and takes the share of each kernel which the calling thread runs otherwise.
+ *
+ * As the same kernels run on the same windows inference after inference, the split of each window among the threads can be recorded
+ * on the first run and replayed on the next ones (See @ref set_record_splits()).
+ *
+ * The small kernels run on fewer threads than the pool has: the number of threads of each kernel is picked from an estimate of its work
+ * (See @ref ICPPKernel::cost()) and the cost of starting a thread on the device (See @ref set_cost_model()).
+ *
+ * @note Concurrent calls to @ref multithread() on the same instance are serialised.
+ */
+class CPPScheduler : public IScheduler
 {
-private:
-    /** Constructor: create a pool of threads. */
-    CPPScheduler();
-
 public:
+    /** Constructor: create a pool of std::thread::hardware_concurrency() threads which are not pinned. */
+    CPPScheduler();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPScheduler(const CPPScheduler &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CPPScheduler &operator=(const CPPScheduler &) = delete;
     /** Force the re-creation of the pool of threads to use the specified number of threads.
+     *
+     * @note The threads of the new pool are not pinned to any core, and the calling thread is unpinned if @ref set_affinity() pinned it.
      *
      * @param[in] num_threads If set to 0, then std::thread::hardware_concurrency() threads will be used, otherwise the number of threads specified.
      */
-    void force_number_of_threads(int num_threads);
+    void force_number_of_threads(int num_threads) override;
+    /** Re-create the pool of threads with one thread pinned to each of the specified cores.
+     *
+     * The cores are sorted by decreasing capacity (See @ref CPUTopology) and the calling thread, which runs part of every kernel,
+     * is pinned to the most powerful one. Kernels flagged as compute bound (@ref ICPPKernel::is_compute_bound) only run on the
+     * threads pinned to the cores of the highest capacity, e.g. the big cluster of a big.LITTLE system.
+     *
+     * @note This must be called from the thread which calls @ref multithread().
+     *
+     * @param[in] cores Ids of the cores to use. If empty, the pool is re-created with std::thread::hardware_concurrency() threads which are not pinned.
+     */
+    void set_affinity(const std::vector<unsigned int> &cores);
     /** Returns the number of threads that the CPPScheduler has in his pool.
      *
      * @return Number of threads available in CPPScheduler.
      */
-    int num_threads() const
+    int num_threads() const override
     {
         return _num_threads;
     }
+    /** Set the number of times the threads poll for work (or for its completion) before falling back to sleeping on a semaphore.
+     *
+     * Spinning avoids the latency of waking up sleeping threads, which matters when many small kernels are run back to back,
+     * at the cost of keeping the cores busy while there is no work.
+     *
+     * @param[in] spin_count Number of polling iterations. 0 (default) disables spinning: threads sleep as soon as they are idle.
+     */
+    void set_spin_count(unsigned int spin_count);
+    /** Returns the number of polling iterations before the threads fall back to sleeping.
+     *
+     * @return Number of polling iterations.
+     */
+    unsigned int spin_count() const
+    {
+        return _spin_count;
+    }
+    /** Record the split of the window of each kernel among the threads on its first run and replay it on the next runs.
+     *
+     * The window of each thread, and the sub-windows it runs when the split dimension is collapsed or the window is split in a 2D grid,
+     * are then computed and validated once per kernel instead of on every run, and the threads are passed them without copying them.
+     * A kernel is split again if it was configured again (See @ref IKernel::configuration_id()), or if its window, its scheduling policy,
+     * the number of parts along X it asks for, the split dimension or the number of threads it can run on changed since it was recorded.
+     *
+     * @note The records are keyed by the address of the kernels: a kernel allocated at the address of a destroyed one has a different
+     *       configuration and is split again. The records are cleared when they reach 1024 kernels, so that the records of destroyed kernels don't accumulate.
+     *
+     * @param[in] record_splits True to record the splits, false (default) to split the windows on every run and clear the records.
+     */
+    void set_record_splits(bool record_splits);
+    /** Returns whether the splits of the windows are recorded.
+     *
+     * @return True if the splits are recorded and replayed.
+     */
+    bool record_splits() const
+    {
+        return _record_splits;
+    }
+    /** Costs from which the number of threads of each kernel is picked */
+    struct CostModel
+    {
+        float ns_per_byte;   /**< Time to read or write a byte on one thread, in nanoseconds */
+        float ns_per_op;     /**< Time of an arithmetic operation on one thread, in nanoseconds */
+        float ns_per_thread; /**< Time added by each additional thread to start it on a kernel and join it, in nanoseconds */
+    };
+    /** Set the costs from which the number of threads of each kernel is picked.
+     *
+     * A kernel whose work on one thread is estimated to @p W nanoseconds (See @ref ICPPKernel::cost()) runs on the number of threads @p t which
+     * minimises W / t + (t - 1) * ns_per_thread, i.e. about sqrt(W / ns_per_thread) threads, at most the number of threads otherwise used.
+     * The kernels which don't estimate their cost run on all the threads.
+     *
+     * @param[in] cost_model Costs of the device, e.g. measured once by @ref calibrate_cost_model() and saved. A ns_per_thread of 0 runs all the kernels on all the threads.
+     */
+    void set_cost_model(const CostModel &cost_model);
+    /** Returns the costs from which the number of threads of each kernel is picked.
+     *
+     * @return The cost model
+     */
+    CostModel cost_model() const
+    {
+        return _cost_model;
+    }
+    /** Measure the costs of the device and use them from now on (See @ref set_cost_model()).
+     *
+     * Copies a buffer larger than the caches and runs a multiply-accumulate loop on one thread, then runs an empty kernel on all the threads of the pool.
+     * It takes a few tens of milliseconds: do it once per device and save the result.
+     *
+     * @note This must be called from the thread which calls @ref multithread(), while no kernel runs.
+     *
+     * @return The measured costs
+     */
+    CostModel calibrate_cost_model();
+    /** Set the maximum number of threads of a kernel, instead of the number picked from its cost.
+     *
+     * @param[in] kernel_name Name of the kernel class, as reported by the profiler (See @ref Profiler::kernel_name()), e.g. "NELogits1DMaxKernel".
+     * @param[in] max_threads Maximum number of threads the kernel runs on. 0 removes the override.
+     */
+    void set_kernel_max_threads(const std::string &kernel_name, int max_threads);
+    /** Switch to the adaptive mode: the number of threads running the kernels follows the latency of the inferences.
+     *
+     * The latency of each inference is measured from the first kernel run after the previous call to @ref end_inference() to the next call.
+     * Every few inferences, the mean latency is compared to the target: a thread is added if it is above and one is removed if the
+     * latency would still meet the target with one thread fewer. The threads which are removed are the last ones of the pool, i.e. the ones
+     * pinned to the least powerful cores if @ref set_affinity() was called.
+     *
+     * If a maximum temperature is set, the thermal zones of the device (/sys/class/thermal) are read as well: while the hottest one is above
+     * the limit, no thread is added and threads are removed as long as the target is met, so that the device heats up less before it throttles.
+     *
+     * @note The number of threads of the pool (@ref num_threads()) doesn't change, only the number of threads used (@ref num_active_threads()).
+     *
+     * @param[in] target_latency  Latency to sustain per inference in milliseconds. 0 (default) disables the adaptive mode: all the threads of the pool are used.
+     * @param[in] max_temperature (Optional) Temperature of the hottest thermal zone in degrees Celsius above which threads are shed. 0 to not read the thermal zones.
+     */
+    void set_target_latency(float target_latency, float max_temperature = 0.f);
+    /** Returns the target latency per inference of the adaptive mode.
+     *
+     * @return The target latency in milliseconds, 0 if the adaptive mode is disabled.
+     */
+    float target_latency() const
+    {
+        return _target_latency;
+    }
+    /** Returns the number of threads of the pool currently used to run the kernels.
+     *
+     * @return Number of threads used, equal to @ref num_threads() unless the adaptive mode removed some.
+     */
+    int num_active_threads() const
+    {
+        return _num_active_threads;
+    }
+    /** Mark the end of an inference. In adaptive mode, its latency is measured and the number of threads used is updated. */
+    void end_inference() override;
     /** Access the scheduler singleton
      *
      * @return The scheduler
@@ -64,14 +222,72 @@ public:
      * - ICPPKernel::is_parallelisable() returns false
      * - The scheduler has been initialized with only one thread.
      *
+     * If the split dimension doesn't have enough iterations to keep all the threads busy, it is collapsed with the outer dimension
+     * which has the most iterations and the resulting iteration space is evenly distributed among the threads,
+     * unless ICPPKernel::is_split_dimension_collapsible() returns false.
+     *
      * @param[in] kernel          Kernel to execute.
      * @param[in] split_dimension Dimension along which to split the kernel's execution window (By default 1/Y)
      */
-    void multithread(ICPPKernel *kernel, size_t split_dimension = 1);
+    void multithread(ICPPKernel *kernel, size_t split_dimension = 1) override;
+    /** Multithread the execution of the passed kernel on a region of its window only.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region on which to execute the kernel. (Must be a region of the window returned by ICPPKernel::window(), aligned to its steps)
+     * @param[in] split_dimension Dimension along which to split @p window (By default 1/Y)
+     */
+    void multithread(ICPPKernel *kernel, const Window &window, size_t split_dimension = 1) override;
+    /** Queue some work, e.g. the run() of a function, and return without waiting for it.
+     *
+     * The works are run one after the other, in submission order, by a thread of the scheduler started on the first call. It schedules the kernels
+     * on this instance and runs the share of each kernel which the calling thread runs otherwise. If @ref set_affinity() was called, it is pinned
+     * to the most powerful of the cores.
+     *
+     * @note A work must not wait for the completion of another work submitted to the same instance.
+     *
+     * @param[in] work Work to run.
+     *
+     * @return Handle on the completion of the work, holding the exception it raised if any.
+     */
+    RunHandle run_async(std::function<void()> work) override;
+    /** Execute kernels which don't depend on each other with a single join of the threads.
+     *
+     * Each thread runs its part of every kernel back to back, the window of a kernel being split in as many parts as it has iterations along
+     * its split dimension, up to the number of threads. The kernels which are not parallelisable or not split run whole, each on one thread.
+     * The kernels run one after the other like with @ref multithread() when the profiler is enabled, to time each of them.
+     *
+     * @param[in] kernels Kernels to execute. None of them may read or write the tensors another one writes.
+     */
+    void multithread_independent(const std::vector<IndependentKernel> &kernels) override;
 
 private:
-    int _num_threads;
+    /** Create the pool of threads
+     *
+     * @param[in] num_threads If set to 0, then std::thread::hardware_concurrency() threads will be used, otherwise the number of threads specified.
+     */
+    void create_threads(int num_threads);
+
+    int                                   _num_threads;
+    unsigned int                          _spin_count;
+    int                                   _num_big_threads;
+    std::vector<unsigned int>             _affinity;
+    float                                 _target_latency;
+    float                                 _max_temperature;
+    int                                   _num_active_threads;
+    bool                                  _is_inference_running;
+    std::chrono::steady_clock::time_point _inference_start;
+    double                                _latency_sum;
+    int                                   _num_inferences;
     std::unique_ptr<Thread[], void (*)(Thread *)> _threads;
+    std::unique_ptr<JobSync, void (*)(JobSync *)> _sync;
+    bool                                  _record_splits;
+    std::unique_ptr<SplitRecords, void (*)(SplitRecords *)> _split_records;
+    CostModel                             _cost_model;
+    std::map<std::string, int>            _kernel_max_threads;
+    std::unordered_map<std::type_index, int> _kernel_max_threads_by_type;
+    std::mutex                            _mutex;
+    std::once_flag                        _async_queue_created;
+    std::unique_ptr<AsyncQueue, void (*)(AsyncQueue *)> _async_queue;
 };
 }
 #endif /* __ARM_COMPUTE_CPPSCHEDULER_H__ */
@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CPUTOPOLOGY_H__
+#define __ARM_COMPUTE_CPUTOPOLOGY_H__
+
+#include <vector>
+
+namespace arm_compute
+{
+/** Information about a CPU core of the system */
+struct CPUCoreInfo
+{
+    unsigned int id;       /**< Index of the core as numbered by the operating system */
+    unsigned int capacity; /**< Relative compute capacity of the core: the higher, the faster */
+};
+
+/** Topology of the CPU cores of the system.
+ *
+ * The capacity of each core is read from sysfs: /sys/devices/system/cpu/cpuN/cpu_capacity if available, otherwise the maximum frequency
+ * of the core. On heterogeneous systems (e.g. big.LITTLE) the cores of the big cluster therefore have a higher capacity.
+ *
+ * @note If sysfs can't be read, std::thread::hardware_concurrency() identical cores are reported.
+ */
+class CPUTopology
+{
+public:
+    /** Constructor: discover the topology of the system */
+    CPUTopology();
+    /** Cores of the system
+     *
+     * @return The cores present in the system, sorted by id.
+     */
+    const std::vector<CPUCoreInfo> &cores() const;
+    /** Ids of the cores sorted by decreasing capacity
+     *
+     * @return The ids of all the cores, the most powerful ones first.
+     */
+    std::vector<unsigned int> cores_by_capacity() const;
+    /** Ids of the cores of the most powerful cluster
+     *
+     * @return The ids of the cores with the highest capacity.
+     */
+    std::vector<unsigned int> big_cores() const;
+    /** Check if the cores don't all have the same capacity
+     *
+     * @return True if the system has cores of different capacities.
+     */
+    bool is_heterogeneous() const;
+    /** Capacity of a core
+     *
+     * @param[in] id Id of the core.
+     *
+     * @return The capacity of the core, 0 if the core is not present.
+     */
+    unsigned int capacity(unsigned int id) const;
+
+private:
+    std::vector<CPUCoreInfo> _cores;
+};
+}
+#endif /* __ARM_COMPUTE_CPUTOPOLOGY_H__ */
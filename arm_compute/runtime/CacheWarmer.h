@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CACHEWARMER_H__
+#define __ARM_COMPUTE_CACHEWARMER_H__
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+#ifndef NO_MULTI_THREADING
+#include <thread>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+/** Background thread reading memory ahead of its use, so that it is in the cache shared by the cores when a function reads it
+ *
+ * This is meant for constant data too large to stay in the cache between two runs, e.g. the weights of the next layer of a network:
+ * they are read while the current layer computes, and the first iterations of the next layer don't wait for the main memory.
+ * The memory is read one cache line at a time: only the caches shared with the cores running the functions benefit from it.
+ *
+ * @note The thread is best left a core the scheduler doesn't use (See @ref IScheduler::force_number_of_threads()): otherwise it competes with the workers.
+ *       Without multi-threading support (NO_MULTI_THREADING), nothing is read ahead.
+ */
+class CacheWarmer
+{
+public:
+    /** Memory range: its first byte and its size in bytes */
+    using Range = std::pair<const uint8_t *, size_t>;
+
+    /** Constructor: the thread is only started by the first call to @ref reserve() or @ref warm() */
+    CacheWarmer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CacheWarmer(const CacheWarmer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    CacheWarmer &operator=(const CacheWarmer &) = delete;
+    /** Destructor: abandon the current request and join the thread */
+    ~CacheWarmer();
+    /** Read memory ranges in the background, in order, and return without waiting
+     *
+     * The ranges of the previous request which have not been read yet are abandoned.
+     *
+     * @note The memory must stay valid until the next call to @ref warm() or @ref cancel().
+     *
+     * @param[in] ranges Memory ranges to read.
+     */
+    void warm(const std::vector<Range> &ranges);
+    /** Start the thread and allocate the memory of the requests up front, so that @ref warm() doesn't allocate any
+     *
+     * @param[in] num_ranges Maximum number of ranges of a request.
+     */
+    void reserve(size_t num_ranges);
+    /** Abandon the current request and wait until the memory it refers to is no longer read */
+    void cancel();
+
+private:
+    /** Read the requested ranges until the warmer is destroyed (Run by the thread) */
+    void warm_ranges();
+
+    std::vector<Range>      _ranges;
+    std::vector<Range>      _thread_ranges;
+    unsigned int            _request;
+    bool                    _is_busy;
+    bool                    _is_stopping;
+    std::mutex              _mutex;
+    std::condition_variable _request_changed;
+#ifndef NO_MULTI_THREADING
+    std::thread _thread;
+#endif /* NO_MULTI_THREADING */
+};
+}
+#endif /* __ARM_COMPUTE_CACHEWARMER_H__ */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_CONVOLUTIONMETHODTUNER_H__
+#define __ARM_COMPUTE_CONVOLUTIONMETHODTUNER_H__
+
+#include <istream>
+#include <map>
+#include <ostream>
+#include <string>
+
+namespace arm_compute
+{
+/** Algorithms a convolution layer can run with */
+enum class ConvolutionMethod
+{
+    DEFAULT,        /**< Selected by the heuristics of the function */
+    GEMM,           /**< im2col followed by a matrix multiplication */
+    DIRECT,         /**< Direct convolution */
+    POINTWISE,      /**< Matrix multiplication reading the input feature maps straight away (1x1 convolutions with a stride of 1 and no padding) */
+    WINOGRAD,       /**< Winograd transforms around an element-wise matrix multiplication (3x3 convolutions with a stride of 1) */
+    SPACE_TO_DEPTH, /**< Rewrite of a strided convolution as a convolution with a stride of 1, which then runs with the heuristics of the function */
+    IMPLICIT_GEMM   /**< Matrix multiplication reading the elements of the im2col matrix straight from the input */
+};
+
+/** Convolution algorithm tuner.
+ *
+ * The fastest algorithm of a convolution layer depends on the device and the shape of the layer. The first time a layer signature
+ * (device, shapes, padding and stride, data type) is configured, the function benchmarks each algorithm supporting the layer on tensors
+ * of the real shapes and records the fastest one in the table of the tuner. The table can be saved and reloaded at startup
+ * so that production runs only apply the stored decisions.
+ *
+ * @note The benchmarks run while the function is configured: they allocate tensors of their own, so the configuration of a new layer
+ *       temporarily needs about twice the memory of the layer.
+ */
+class ConvolutionMethodTuner
+{
+public:
+    /** Default constructor: new layers are tuned. */
+    ConvolutionMethodTuner();
+    /** Enable or disable the tuning of the layers which are not in the table yet.
+     *
+     * @param[in] tune_new_layers If false, the layers which are not in the table use the heuristics of the functions.
+     */
+    void set_tune_new_layers(bool tune_new_layers);
+    /** Whether the layers which are not in the table yet get tuned.
+     *
+     * @return True if new layers are tuned.
+     */
+    bool tune_new_layers() const;
+    /** Look up the algorithm of a layer.
+     *
+     * @param[in] id Signature of the layer, built by the function.
+     *
+     * @return The algorithm stored for the layer, @ref ConvolutionMethod::DEFAULT if the layer is not in the table.
+     */
+    ConvolutionMethod find(const std::string &id) const;
+    /** Record the algorithm of a layer, replacing the one already stored if any.
+     *
+     * @param[in] id     Signature of the layer, built by the function. Must not contain any new line.
+     * @param[in] method Algorithm to use for the layer. Must not be @ref ConvolutionMethod::DEFAULT.
+     */
+    void add(const std::string &id, ConvolutionMethod method);
+    /** Table of the tuned layers.
+     *
+     * @return Map of the layer signatures to their algorithm.
+     */
+    const std::map<std::string, ConvolutionMethod> &method_table() const;
+    /** Write the table to a text stream: one layer per line, the signature followed by the name of the algorithm.
+     *
+     * @param[out] stream Output stream.
+     */
+    void save(std::ostream &stream) const;
+    /** Add the layers written by @ref save() to the table.
+     *
+     * The lines whose algorithm is unknown are ignored.
+     *
+     * @param[in] stream Input stream.
+     */
+    void load(std::istream &stream);
+
+private:
+    std::map<std::string, ConvolutionMethod> _method_table;
+    bool                                     _tune_new_layers;
+};
+}
+#endif /* __ARM_COMPUTE_CONVOLUTIONMETHODTUNER_H__ */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_HUGEPAGEALLOCATOR_H__
+#define __ARM_COMPUTE_HUGEPAGEALLOCATOR_H__
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <cstddef>
+#include <mutex>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Allocator mapping the large blocks on huge pages and pre-faulting them.
+ *
+ * Blocks of at least the threshold size are mapped from the system with a size rounded up to a multiple of the huge page size (2MB with 4KB pages).
+ * They are taken from the reserved huge pages (MAP_HUGETLB) if requested and available, otherwise the kernel is advised to back them with
+ * transparent huge pages (MADV_HUGEPAGE), which reduces the TLB misses of the kernels streaming through large tensors.
+ * If pre-faulting is enabled, every page of a new block is written once on the threads of the @ref Scheduler, so that the page faults are taken in
+ * allocate() (i.e. while configuring) rather than during the first run. Smaller blocks are forwarded to the fallback allocator.
+ *
+ * Install it with @ref TensorAllocator::set_default_allocator() before configuring the functions to back all their tensors with it.
+ *
+ * @note The methods of this class are thread-safe, but a block must not be allocated with pre-faulting from a thread of the scheduler.
+ */
+class HugePageAllocator : public IAllocator
+{
+public:
+    /** Constructor
+     *
+     * @param[in] threshold   (Optional) Size in bytes from which the blocks are mapped on huge pages.
+     * @param[in] prefault    (Optional) Touch all the pages of the mapped blocks when they are allocated.
+     * @param[in] use_hugetlb (Optional) Try the reserved huge pages first. Transparent huge pages are used if none are available.
+     * @param[in] fallback    (Optional) Allocator of the blocks smaller than @p threshold. Defaults to the @ref PoolAllocator singleton.
+     */
+    HugePageAllocator(size_t threshold = 2 * 1024 * 1024, bool prefault = true, bool use_hugetlb = false, IAllocator *fallback = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    HugePageAllocator(const HugePageAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    HugePageAllocator &operator=(const HugePageAllocator &) = delete;
+    /** Default destructor
+     *
+     * @note The blocks still in use are not unmapped.
+     */
+    ~HugePageAllocator() = default;
+    /** Total size in bytes of the blocks currently mapped by the allocator
+     *
+     * @return The size in bytes of the mapped blocks, including the rounding to the huge page size.
+     */
+    size_t mapped_size() const;
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+
+private:
+    /** Block of memory mapped from the system */
+    struct Mapping
+    {
+        void  *base; /**< Start of the mapping */
+        size_t size; /**< Size in bytes of the mapping */
+    };
+
+    IAllocator                         *_fallback;    /**< Allocator of the small blocks */
+    size_t                              _threshold;   /**< Size in bytes from which the blocks are mapped */
+    bool                                _prefault;    /**< Pre-fault the pages of the mapped blocks */
+    bool                                _use_hugetlb; /**< Try the reserved huge pages first */
+    mutable std::mutex                  _mtx;         /**< Mutex protecting the mappings */
+    std::unordered_map<void *, Mapping> _mappings;    /**< Mapped blocks in use indexed by their aligned pointer */
+    size_t                              _mapped_size; /**< Total size in bytes of the mapped blocks */
+};
+}
+#endif /* __ARM_COMPUTE_HUGEPAGEALLOCATOR_H__ */
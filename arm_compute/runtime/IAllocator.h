@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_IALLOCATOR_H__
+#define __ARM_COMPUTE_IALLOCATOR_H__
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Interface of the allocators providing the backing memory of the CPU tensors */
+class IAllocator
+{
+public:
+    /** Default virtual destructor. */
+    virtual ~IAllocator() = default;
+    /** Interface to be implemented by the child class to allocate a block of memory.
+     *
+     * @note The content of the returned block is not initialised.
+     *
+     * @param[in] size      Size in bytes of the block to allocate.
+     * @param[in] alignment Alignment in bytes of the start of the block. Must be a power of 2.
+     *
+     * @return A pointer to the allocated block.
+     */
+    virtual void *allocate(size_t size, size_t alignment) = 0;
+    /** Interface to be implemented by the child class to release a block of memory previously returned by @ref allocate().
+     *
+     * @param[in] ptr Pointer to the block to release.
+     */
+    virtual void free(void *ptr) = 0;
+};
+}
+#endif /* __ARM_COMPUTE_IALLOCATOR_H__ */
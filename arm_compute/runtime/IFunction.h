@@ -24,6 +24,10 @@
 #ifndef __ARM_COMPUTE_IFUNCTION_H__
 #define __ARM_COMPUTE_IFUNCTION_H__
 
+#include "arm_compute/runtime/MemoryFootprint.h"
+#include "arm_compute/runtime/RunHandle.h"
+#include "arm_compute/runtime/Scheduler.h"
+
 namespace arm_compute
 {
 /** Base class for all functions */
@@ -36,7 +40,8 @@ public:
      * - Multi-threading is used for the kernels which are parallelisable.
      * - By default std::thread::hardware_concurrency() threads are used.
      *
-     * @note @ref CPPScheduler::force_number_of_threads() can be used to manually set the number of threads
+     * @note @ref Scheduler::set() can be used to select the scheduler (C++11 threads, OpenMP or single thread)
+     * @note @ref IScheduler::force_number_of_threads() can be used to manually set the number of threads
      *
      * For OpenCL kernels:
      * - All the kernels are enqueued on the queue associated with CLScheduler.
@@ -45,6 +50,44 @@ public:
      * @note The function will not block until the kernels are executed. It is the user's responsibility to wait.
      */
     virtual void run() = 0;
+    /** Submit run() to the scheduler of the calling thread (See @ref Scheduler::get()) and return without waiting for its completion.
+     *
+     * With @ref CPPScheduler, run() is executed by a thread of the scheduler which takes the share of each kernel the calling thread runs otherwise:
+     * the calling thread never runs kernels, unless it calls run() itself. The other schedulers execute run() in the calling thread before returning.
+     *
+     * @note The function and its tensors must not be used nor destroyed until the handle is ready.
+     *       The runs submitted to a scheduler are executed one after the other, in submission order.
+     *
+     * @return Handle on the completion of the run, holding the exception raised by run() if any.
+     */
+    RunHandle run_async()
+    {
+        return Scheduler::get().run_async([this]()
+        {
+            run();
+        });
+    }
+    /** Run the one-time transformations of the function, e.g. the reshape of its constant weights, and release the buffers only they need.
+     *
+     * run() calls it if it has not been called yet, so that the first run absorbs the transformations. Calling it early,
+     * e.g. from another thread while the input is being acquired, leaves only the steady-state work to run().
+     *
+     * @note The constant inputs of the function (e.g. the weights) must have been filled. It must not run at the same time as another function
+     *       using the same scheduler, nor as run().
+     */
+    virtual void prepare()
+    {
+    }
+    /** Memory of the tensors the function allocated itself when it was configured
+     *
+     * The tensors passed to configure() are not included: they belong to the caller.
+     *
+     * @return The internal memory of the function, all zeros if it has no internal tensor
+     */
+    virtual MemoryFootprint memory_footprint() const
+    {
+        return MemoryFootprint{ 0, 0, 0, 0 };
+    }
     /** Destructor
      *
      */
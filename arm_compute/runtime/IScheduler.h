@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_ISCHEDULER_H__
+#define __ARM_COMPUTE_ISCHEDULER_H__
+
+#include "arm_compute/runtime/RunHandle.h"
+
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <limits>
+#include <vector>
+
+namespace arm_compute
+{
+class ICPPKernel;
+class Window;
+
+/** Scheduler interface to run kernels */
+class IScheduler
+{
+public:
+    /** Value of @ref IndependentKernel::split_dimension for a kernel which runs on its whole window on a single thread */
+    static constexpr size_t no_split = std::numeric_limits<size_t>::max();
+
+    /** Kernel scheduled with other kernels which neither read nor write what it writes (See @ref multithread_independent()) */
+    struct IndependentKernel
+    {
+        ICPPKernel *kernel;          /**< Kernel to execute */
+        size_t      split_dimension; /**< Dimension along which to split the kernel's execution window, @ref no_split to run the kernel on a single thread */
+    };
+
+    /** Default virtual destructor. */
+    virtual ~IScheduler() = default;
+    /** Force the scheduler to use the specified number of threads.
+     *
+     * @param[in] num_threads If set to 0, then the default number of threads of the scheduler will be used, otherwise the number of threads specified.
+     */
+    virtual void force_number_of_threads(int num_threads) = 0;
+    /** Returns the number of threads that the scheduler uses to run the kernels.
+     *
+     * @return Number of threads available in the scheduler.
+     */
+    virtual int num_threads() const = 0;
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's execution window (By default 1/Y)
+     */
+    virtual void multithread(ICPPKernel *kernel, size_t split_dimension = 1) = 0;
+    /** Multithread the execution of the passed kernel on a region of its window only, e.g. a band of rows of its output.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region on which to execute the kernel. (Must be a region of the window returned by ICPPKernel::window(), aligned to its steps)
+     * @param[in] split_dimension Dimension along which to split @p window (By default 1/Y)
+     */
+    virtual void multithread(ICPPKernel *kernel, const Window &window, size_t split_dimension = 1) = 0;
+    /** Execute kernels which don't depend on each other, e.g. the border fills of two different tensors.
+     *
+     * The scheduler can run them concurrently, or back to back on each thread, so that the threads only join once for all of them.
+     * By default they run one after the other, each like with @ref multithread().
+     *
+     * @param[in] kernels Kernels to execute. None of them may read or write the tensors another one writes.
+     */
+    virtual void multithread_independent(const std::vector<IndependentKernel> &kernels);
+    /** Mark the end of an inference, i.e. of the kernels run since the previous call (Called by @ref NENetwork::run())
+     *
+     * Schedulers which adapt their number of threads to the latency of the inferences update it here. Does nothing by default.
+     */
+    virtual void end_inference()
+    {
+    }
+    /** Run some work, e.g. the run() of a function, without making the calling thread wait for its completion if the scheduler supports it.
+     *
+     * The kernels scheduled by the work run on this scheduler. The works submitted to a scheduler run one after the other, in submission order.
+     * By default the work runs in the calling thread before this returns, and the returned handle is ready.
+     *
+     * @param[in] work Work to run.
+     *
+     * @return Handle on the completion of the work, holding the exception it raised if any.
+     */
+    virtual RunHandle run_async(std::function<void()> work)
+    {
+        std::promise<void> promise;
+        try
+        {
+            work();
+            promise.set_value();
+        }
+        catch(...)
+        {
+            promise.set_exception(std::current_exception());
+        }
+        return RunHandle(promise.get_future().share());
+    }
+};
+}
+#endif /* __ARM_COMPUTE_ISCHEDULER_H__ */
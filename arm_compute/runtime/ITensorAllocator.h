@@ -31,6 +31,8 @@
 
 namespace arm_compute
 {
+class Coordinates;
+
 /** Interface to allocate tensors */
 class ITensorAllocator
 {
@@ -78,6 +80,17 @@ public:
     virtual void free() = 0;
 
 protected:
+    /** Initialise the tensor as a sub-tensor of another one: it uses the strides and the layout of the parent.
+     *
+     * The padding of the parent on the sides the sub-tensor shares with it becomes the padding of the sub-tensor, which is fixed: kernels configured
+     * on the sub-tensor can read it (and fill it for the border modes other than UNDEFINED) but cannot change the layout, which belongs to the parent.
+     * The sides inside the parent have no padding, so that no kernel overwrites the elements of the parent around the sub-tensor.
+     *
+     * @param[in] parent_info Metadata of the parent tensor.
+     * @param[in] coords      The starting coordinates of the sub-tensor inside the parent tensor.
+     * @param[in] sub_info    Metadata of the sub-tensor (Only its shape and data type are used).
+     */
+    void init_sub_tensor(const TensorInfo &parent_info, const Coordinates &coords, TensorInfo sub_info);
     /** Interface to be implemented by the child class to lock the memory allocation for the CPU to access.
      *
      * @return Pointer to a CPU mapping of the memory
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_ITILEDFUNCTION_H__
+#define __ARM_COMPUTE_ITILEDFUNCTION_H__
+
+#include <cstddef>
+#include <utility>
+
+namespace arm_compute
+{
+/** Interface of the functions which can compute their output one band of rows at a time
+ *
+ * Running several consecutive layers band by band (See @ref NENetwork::set_tile_working_set()) keeps the rows a layer produces in the cache until the next layer reads them.
+ * A band covers all the columns, feature maps and batches of the rows.
+ */
+class ITiledFunction
+{
+public:
+    /** Default virtual destructor */
+    virtual ~ITiledFunction() = default;
+    /** Indicates whether the function, as configured, can compute its output in bands of rows
+     *
+     * @return True if @ref run_tile() can be used instead of run()
+     */
+    virtual bool is_tileable() const = 0;
+    /** Rows of the input read to compute a band of rows of the output
+     *
+     * @param[in] first_row First row of the band of the output.
+     * @param[in] last_row  Row following the last row of the band of the output.
+     *
+     * @return The first row of the input read and the row following the last one, clamped to the rows of the input
+     */
+    virtual std::pair<unsigned int, unsigned int> input_rows(unsigned int first_row, unsigned int last_row) const = 0;
+    /** Memory touched to compute a band of rows, besides the input and output rows of the band
+     *
+     * @param[in] num_rows Number of rows of the output in the band.
+     *
+     * @return The size in bytes of the weights and of the internal tensors read or written for the band
+     */
+    virtual size_t tile_working_set(unsigned int num_rows) const = 0;
+    /** Run the parts of the function which don't depend on the rows, e.g. reshape the weights. Must be called before the first band of each run. */
+    virtual void prepare_tiles() = 0;
+    /** Compute a band of rows of the output
+     *
+     * @note The rows of the input returned by @ref input_rows() for the band must have been computed.
+     *
+     * @param[in] first_row First row of the band.
+     * @param[in] last_row  Row following the last row of the band. Some rows following the band might be computed as well.
+     */
+    virtual void run_tile(unsigned int first_row, unsigned int last_row) = 0;
+};
+}
+#endif /*__ARM_COMPUTE_ITILEDFUNCTION_H__ */
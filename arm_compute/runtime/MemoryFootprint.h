@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYFOOTPRINT_H__
+#define __ARM_COMPUTE_MEMORYFOOTPRINT_H__
+
+#include <cstddef>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Kind of memory held by a function */
+enum class MemoryCategory
+{
+    WEIGHTS,     /**< Weights and biases, or the reshaped, transposed or folded copies of them which the function keeps between runs */
+    ACTIVATIONS, /**< Intermediate results passed from one kernel of the function to the next one, e.g. the im2col matrix of a convolution */
+    SCRATCH      /**< Temporary buffers of a single kernel, e.g. the maximum and sum of a softmax */
+};
+
+/** Memory allocated by a configured function, in bytes
+ *
+ * The sizes are the ones returned by TensorInfo::total_size(), so they include the padding of the tensors, which is also reported on its own.
+ * Only the tensors which currently have memory are counted: the weights a function released after reshaping them are not.
+ *
+ * @note The transient tensors of a memory planner share an arena: they are counted at their full size, so the sum can be larger than the arena.
+ */
+struct MemoryFootprint
+{
+    size_t weights;     /**< Bytes of @ref MemoryCategory::WEIGHTS */
+    size_t activations; /**< Bytes of @ref MemoryCategory::ACTIVATIONS */
+    size_t scratch;     /**< Bytes of @ref MemoryCategory::SCRATCH */
+    size_t padding;     /**< Bytes of the above taken by the padding of the tensors */
+
+    /** Total number of bytes
+     *
+     * @return The sum of the weights, activations and scratch memory
+     */
+    size_t total() const
+    {
+        return weights + activations + scratch;
+    }
+    /** Accumulate the memory of another function
+     *
+     * @param[in] other Footprint to add.
+     *
+     * @return A reference to this footprint
+     */
+    MemoryFootprint &operator+=(const MemoryFootprint &other)
+    {
+        weights += other.weights;
+        activations += other.activations;
+        scratch += other.scratch;
+        padding += other.padding;
+        return *this;
+    }
+    /** Count the memory of a tensor, if it has been allocated
+     *
+     * @param[in] category Kind of memory held by the tensor.
+     * @param[in] tensor   Tensor to count.
+     */
+    void add(MemoryCategory category, const ITensor &tensor);
+};
+}
+#endif /* __ARM_COMPUTE_MEMORYFOOTPRINT_H__ */
@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYGROUP_H__
+#define __ARM_COMPUTE_MEMORYGROUP_H__
+
+#include "arm_compute/runtime/MemoryPlanner.h"
+
+#include <memory>
+
+namespace arm_compute
+{
+class Tensor;
+
+/** Transient tensors of a function whose memory is handed out by a @ref MemoryPlanner.
+ *
+ * If the group has no memory planner, the managed tensors are allocated as usual by their own allocator.
+ */
+class MemoryGroup
+{
+public:
+    /** Constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner used to assign the tensors of the group to a shared arena.
+     */
+    MemoryGroup(std::shared_ptr<MemoryPlanner> memory_planner = nullptr);
+    /** Start the lifetime of a transient tensor. Its lifetime ends when its allocator's allocate() method is called.
+     *
+     * @note No-op if the group has no memory planner.
+     *
+     * @param[in] tensor Tensor to manage.
+     */
+    void manage(Tensor *tensor);
+
+private:
+    std::shared_ptr<MemoryPlanner> _memory_planner;
+};
+}
+#endif /* __ARM_COMPUTE_MEMORYGROUP_H__ */
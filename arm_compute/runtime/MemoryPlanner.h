@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MEMORYPLANNER_H__
+#define __ARM_COMPUTE_MEMORYPLANNER_H__
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class IAllocator;
+class Tensor;
+class TensorAllocator;
+
+/** Lifetime-aware planner which packs tensors into a single shared arena.
+ *
+ * The lifetime of a tensor starts when it is passed to @ref manage() and ends when its allocator's allocate() method is called.
+ * Both events are recorded in configuration order, which for a sequence of functions matches the order in which the tensors are used at run time.
+ * Tensors whose lifetimes don't overlap are assigned to overlapping offsets of the arena, so the size of the arena is the peak
+ * amount of memory alive at any moment rather than the sum of the sizes of all the tensors.
+ *
+ * @note The arena is only allocated and bound to the managed tensors when @ref allocate() is called.
+ *
+ * @warning The content of a managed tensor is only valid for the duration of its lifetime: managed tensors must only be used for transient data.
+ */
+class MemoryPlanner
+{
+public:
+    /** Constructor
+     *
+     * @param[in] allocator (Optional) Allocator providing the arena. Defaults to @ref TensorAllocator::default_allocator().
+     */
+    MemoryPlanner(IAllocator *allocator = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MemoryPlanner(const MemoryPlanner &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    MemoryPlanner &operator=(const MemoryPlanner &) = delete;
+    /** Start the lifetime of a tensor.
+     *
+     * @note The tensor must not be allocated.
+     *
+     * @param[in] tensor Tensor whose backing memory will be assigned from the arena.
+     */
+    void manage(Tensor *tensor);
+    /** End the lifetime of a managed tensor.
+     *
+     * @note Called by @ref TensorAllocator::allocate() for managed tensors. The size of the tensor is frozen at this point.
+     *
+     * @param[in] allocator Allocator of the managed tensor.
+     */
+    void finalize(TensorAllocator *allocator);
+    /** Assign an offset in the arena to every managed tensor, allocate the arena and bind the tensors to it.
+     *
+     * @note The lifetime of all the managed tensors must have ended.
+     */
+    void allocate();
+    /** Size in bytes of the arena
+     *
+     * @note Only valid once @ref allocate() has been called.
+     *
+     * @return The size of the arena in bytes
+     */
+    size_t arena_size() const;
+
+private:
+    /** Lifetime of a managed tensor */
+    struct Lifetime
+    {
+        TensorAllocator *allocator; /**< Allocator of the managed tensor */
+        size_t           size;      /**< Size in bytes of the tensor */
+        size_t           start;     /**< Time at which the lifetime starts */
+        size_t           end;       /**< Time at which the lifetime ends */
+        size_t           offset;    /**< Offset of the tensor in the arena */
+    };
+
+    IAllocator              *_allocator;
+    std::vector<Lifetime>    _lifetimes;
+    size_t                   _clock;
+    size_t                   _arena_size;
+    std::shared_ptr<uint8_t> _arena;
+};
+}
+#endif /* __ARM_COMPUTE_MEMORYPLANNER_H__ */
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_MODELFILE_H__
+#define __ARM_COMPUTE_MODELFILE_H__
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/TensorShape.h"
+#include "arm_compute/core/Types.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+class Tensor;
+
+/** Binary container of the weights of a model, loaded by mapping the file in memory.
+ *
+ * The file starts with an index of the named tensors, followed by the content of each tensor without padding and aligned to a cache line.
+ *
+ * A tensor without padding is imported without any copy: its backing memory is the mapped file, whose pages are only read when they are
+ * first accessed and are shared with the page cache. The mapping is private: writing to an imported tensor doesn't modify the file.
+ * A tensor with padding is allocated and its content is copied from the mapped file.
+ *
+ * To read less from the storage, the F32 weights can be saved in F16, or in U8 with a scale and an offset per tensor (See @ref save()).
+ * They are expanded to F32 when they are imported, straight into the layout of the destination tensor: by @ref import_tensor() in portable C++,
+ * or by @ref NEExpandWeightsKernel on all the threads of the scheduler for the tensors of the NEON functions (See @ref import_tensor_neon()).
+ */
+class ModelFile
+{
+public:
+    /** Default constructor */
+    ModelFile();
+    /** Map a model file in memory and read its index.
+     *
+     * @note The mapping is released when the model file and all the tensors imported from it are destroyed.
+     *
+     * @param[in] path Path of a file written by @ref save().
+     */
+    void map(const std::string &path);
+    /** Check if the model contains a tensor
+     *
+     * @param[in] name Name of the tensor.
+     *
+     * @return True if the model contains a tensor with the given name
+     */
+    bool has_tensor(const std::string &name) const;
+    /** Description of a tensor stored in the model
+     *
+     * @param[in] name Name of the tensor.
+     *
+     * @return The info of the tensor without padding, an empty info if the model doesn't contain a tensor with this name
+     */
+    TensorInfo tensor_info(const std::string &name) const;
+    /** Provide the backing memory of a tensor from the model.
+     *
+     * @note The tensor must be initialised but not allocated, and must not be managed by a memory planner.
+     *
+     * @param[in]     name   Name of the tensor in the model.
+     * @param[in,out] tensor Tensor to import. Its data type and shape must match the ones of the tensor stored in the model.
+     *
+     * @return True if the tensor was imported, false if the model doesn't contain a tensor with this name, data type and shape.
+     */
+    bool import_tensor(const std::string &name, Tensor &tensor) const;
+    /** Provide the backing memory of a tensor with the content of a tensor stored in the model, as it is stored: without any expansion.
+     *
+     * @param[in]  name   Name of the tensor in the model.
+     * @param[out] stored Tensor to import, not initialised yet. It is initialised with the shape of the stored tensor, the data type it is stored in and no padding.
+     * @param[out] scale  Scale to apply to the stored values to get the values of the tensor (1 if the tensor is stored in its own data type).
+     * @param[out] offset Offset to add to the scaled values (0 if the tensor is stored in its own data type).
+     *
+     * @return True if the tensor was imported, false if the model doesn't contain a tensor with this name.
+     */
+    bool import_stored_tensor(const std::string &name, Tensor &stored, float &scale, float &offset) const;
+    /** Write a model file.
+     *
+     * With @p storage_type F16 or U8, the F32 tensors with more than one dimension (i.e. the weights, not the biases) are stored in this data type:
+     * in U8 the values are mapped linearly from the range of each tensor to [0, 255]. Their content is half or a quarter of the size of the F32 content,
+     * at the cost of the precision of the weights.
+     *
+     * @param[in] path         Path of the file to write.
+     * @param[in] tensors      Names and tensors to store. The memory of the tensors must be allocated.
+     * @param[in] storage_type (Optional) Data type the F32 weights are stored in: F32 (default), F16 or U8.
+     */
+    static void save(const std::string &path, const std::vector<std::pair<std::string, const ITensor *>> &tensors, DataType storage_type = DataType::F32);
+
+private:
+    /** Description of a tensor stored in the model */
+    struct Entry
+    {
+        DataType    data_type;    /**< Data type of the tensor */
+        size_t      num_channels; /**< Number of channels of the tensor */
+        TensorShape shape;        /**< Shape of the tensor */
+        size_t      offset;       /**< Offset in bytes of the content of the tensor from the beginning of the file */
+        DataType    storage_type; /**< Data type the content is stored in */
+        float       scale;        /**< Scale applied to the stored values */
+        float       value_offset; /**< Offset added to the scaled stored values */
+    };
+
+    std::shared_ptr<uint8_t> _mapping;
+    size_t                   _size;
+    std::map<std::string, Entry> _entries;
+};
+}
+#endif /* __ARM_COMPUTE_MODELFILE_H__ */
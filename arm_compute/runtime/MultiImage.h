@@ -30,6 +30,9 @@
 #include "arm_compute/runtime/Tensor.h"
 
 #include <array>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
 
 namespace arm_compute
 {
@@ -63,8 +66,25 @@ public:
      *
      * @note The multi image must not already be allocated when calling this function.
      *
+     * @note All the planes are backed by a single allocation, each plane starting on a cache line.
+     *
      **/
     void allocate();
+    /** Initialise a NV12 or NV21 multi image using an externally allocated frame as its memory: no copy is made.
+     *
+     * The luma plane starts at the beginning of @p buffer, the interleaved chroma plane at @p uv_offset, and the rows of both planes are @p stride bytes apart.
+     * The end of the rows is the padding of the planes: kernels can use it but not extend it.
+     *
+     * @note The multi image must not be allocated when calling this function.
+     *
+     * @param[in] width     Width of the frame. Must be even.
+     * @param[in] height    Height of the frame. Must be even.
+     * @param[in] format    Format of the frame: NV12 or NV21.
+     * @param[in] buffer    Memory of the frame. Ownership becomes shared afterwards: the memory is released when the last plane using it is freed.
+     * @param[in] stride    Stride in bytes of the rows of both planes. Must be at least @p width.
+     * @param[in] uv_offset Offset in bytes of the chroma plane from the beginning of @p buffer. Must be at least @p stride * @p height.
+     */
+    void import_frame(unsigned int width, unsigned int height, Format format, std::shared_ptr<uint8_t> buffer, size_t stride, size_t uv_offset);
     /** Create a subimage from an existing MultiImage.
      *
      *  @param[in] image  Image to use backing memory from
@@ -26,6 +26,8 @@
 
 #include "arm_compute/core/NEON/INEKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/IFunction.h"
 
 #include <memory>
@@ -39,10 +41,36 @@ public:
     /** Constructor */
     INESimpleFunction();
 
+    /** Rows of the output computed by run(): the rows of the window of the kernel
+     *
+     * @return The rows of the window of the kernel and the number of rows computed by each of its iterations
+     */
+    Window::Dimension band_rows() const;
+    /** Rows of the inputs read around the rows of the output (See @ref run_band())
+     *
+     * @return The border of the kernel: the number of rows read above and below each row of the output
+     */
+    BorderSize band_border() const;
+    /** Compute a band of rows of the output, after filling the borders of the rows of the input it reads
+     *
+     * Used to run the function a few rows at a time, e.g. by @ref NEVisionGraph.
+     *
+     * @param[in] first_row First row of the band. Must be the first row of an iteration of the window of the kernel (See @ref band_rows()).
+     * @param[in] last_row  Row following the last row of the band. Must be the first row of an iteration or the end of the window of the kernel.
+     */
+    void run_band(unsigned int first_row, unsigned int last_row);
+
     // Inherited methods overridden:
     void run() override final;
 
 protected:
+    /** Run the kernel on a band of rows of its window only, without handling the borders
+     *
+     * @param[in] first_row First row of the band.
+     * @param[in] last_row  Row following the last row of the band, clamped to the window of the kernel.
+     */
+    void run_rows(unsigned int first_row, unsigned int last_row);
+
     std::unique_ptr<INEKernel> _kernel;         /**< Kernel to run */
     NEFillBorderKernel         _border_handler; /**< Kernel to handle image borders */
 };
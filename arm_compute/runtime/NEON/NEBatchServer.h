@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEBATCHSERVER_H__
+#define __ARM_COMPUTE_NEBATCHSERVER_H__
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <vector>
+
+#ifndef NO_MULTI_THREADING
+#include <thread>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+class IFunction;
+class ITensor;
+
+/** Serve single inputs submitted by several callers, running them through a network in dynamically formed batches.
+ *
+ * The server owns a thread which queues the submitted inputs. As soon as the queue holds as many inputs as the largest batch,
+ * or the oldest input has waited for the maximum delay, it forms a batch: the batch size adapts to the depth of the queue, picking
+ * the network configured for the smallest batch which holds all the pending inputs (or the largest batch if they don't fit in any).
+ * The inputs are copied into the input of that network, the network is run once and the outputs are scattered back to the callers.
+ *
+ * The networks are typically the same model configured for different batch sizes and sharing their weights (e.g. @ref NENetwork with a
+ * 4D input): the batch is the dimension of the input or the output just above the dimensions of a single input or output.
+ * The unused slots of a partially filled batch are computed but their results are ignored.
+ *
+ * @note Without multi-threading support (NO_MULTI_THREADING), each input is run as soon as it is submitted.
+ */
+class NEBatchServer
+{
+public:
+    /** Constructor */
+    NEBatchServer();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchServer(const NEBatchServer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEBatchServer &operator=(const NEBatchServer &) = delete;
+    /** Stop the server: the inputs still in the queue are processed first */
+    ~NEBatchServer();
+    /** Add a network which processes batches of a given size
+     *
+     * @note Networks can't be added once the server has been started.
+     *
+     * @param[in] network    Configured network. Must outlive the server.
+     * @param[in] input      Allocated input of the network.
+     * @param[in] output     Allocated output of the network.
+     * @param[in] batch_size Number of inputs processed by one run of the network.
+     */
+    void add_network(IFunction *network, ITensor *input, ITensor *output, size_t batch_size);
+    /** Start serving the submitted inputs
+     *
+     * @param[in] max_delay Maximum time the oldest input waits for a batch to fill up before the incomplete batch is run.
+     */
+    void start(std::chrono::microseconds max_delay);
+    /** Process the inputs still in the queue and stop the serving thread */
+    void stop();
+    /** Submit an input, from any thread
+     *
+     * @param[in]  input  A single input of the network, e.g. [width, height, IFM]. It must not be modified until the result is ready.
+     * @param[out] output Tensor to receive the output of the network for @p input, e.g. [num_classes].
+     *
+     * @return A future which becomes ready once @p output has been written.
+     */
+    std::future<void> submit(const ITensor *input, ITensor *output);
+
+private:
+    /** A network configured for one batch size */
+    struct Network
+    {
+        IFunction *function;   /**< The configured network */
+        ITensor   *input;      /**< Input of the network */
+        ITensor   *output;     /**< Output of the network */
+        size_t     batch_size; /**< Number of inputs processed by one run */
+    };
+    /** An input waiting to be processed */
+    struct Request
+    {
+        const ITensor                        *input;   /**< Input of the caller */
+        ITensor                              *output;  /**< Output of the caller */
+        std::promise<void>                    done;    /**< Set once the output has been written */
+        std::chrono::steady_clock::time_point arrival; /**< Time at which the input was submitted */
+    };
+
+    /** Run a batch of requests through the network with the smallest batch size holding them all, or the largest one
+     *
+     * @param[in,out] requests Requests to run, at most the largest batch size. Their promises are set.
+     */
+    void run_batch(std::vector<Request> &requests);
+    /** Loop of the serving thread: form batches from the queue until the server is stopped */
+    void serve();
+
+    std::vector<Network>      _networks;
+    std::deque<Request>       _queue;
+    std::mutex                _mutex;
+    std::condition_variable   _condition;
+    std::chrono::microseconds _max_delay;
+    bool                      _is_running;
+    bool                      _stop;
+#ifndef NO_MULTI_THREADING
+    std::thread _thread;
+#endif /* NO_MULTI_THREADING */
+};
+}
+#endif /* __ARM_COMPUTE_NEBATCHSERVER_H__ */
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFRAMEPIPELINE_H__
+#define __ARM_COMPUTE_NEFRAMEPIPELINE_H__
+
+#include "arm_compute/runtime/Tensor.h"
+
+#include <functional>
+
+namespace arm_compute
+{
+class IFunction;
+
+/** Run a NEON network on a stream of frames, overlapping the preprocessing and the postprocessing of the frames with the computation.
+ *
+ * The frames go through staging tensors with the same layout as the input and output of the network: while the network computes
+ * frame n, a separate thread fills frame n + 1 and reads the result of frame n - 1.
+ *
+ * @note The separate thread competes with the threads of @ref NEScheduler: use NEScheduler::get().force_number_of_threads() to leave a core to it.
+ *       Without multi-threading support (NO_MULTI_THREADING), the frames are processed one after the other.
+ */
+class NEFramePipeline
+{
+public:
+    /** Constructor */
+    NEFramePipeline();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFramePipeline(const NEFramePipeline &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFramePipeline &operator=(const NEFramePipeline &) = delete;
+    /** Set the network and allocate the staging tensors.
+     *
+     * @param[in] network Configured network. Must outlive the pipeline.
+     * @param[in] input   Allocated input of the network.
+     * @param[in] output  Allocated output of the network.
+     */
+    void configure(IFunction *network, ITensor *input, ITensor *output);
+    /** Process a stream of frames.
+     *
+     * @param[in] num_frames  Number of frames to process.
+     * @param[in] fill_input  Called with the index of a frame to write it into the given staging tensor, which has the layout of the input of the network.
+     * @param[in] read_output Called with the index of a frame once its result is in the given staging tensor, which has the layout of the output of the network.
+     *                        The frames are read in order.
+     */
+    void run(unsigned int num_frames, const std::function<void(unsigned int, ITensor &)> &fill_input, const std::function<void(unsigned int, ITensor &)> &read_output);
+
+private:
+    IFunction *_network;
+    ITensor   *_input;
+    ITensor   *_output;
+    Tensor     _staging_input;
+    Tensor     _staging_output;
+};
+}
+#endif /* __ARM_COMPUTE_NEFRAMEPIPELINE_H__ */
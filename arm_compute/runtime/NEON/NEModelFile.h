@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEMODELFILE_H__
+#define __ARM_COMPUTE_NEMODELFILE_H__
+
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <string>
+
+namespace arm_compute
+{
+/** Provide the backing memory of a tensor read by NEON functions from a model, like @ref ModelFile::import_tensor().
+ *
+ * The tensors stored in F16 or U8 (See @ref ModelFile::save()) are expanded to F32 by @ref NEExpandWeightsKernel on the threads of
+ * @ref NEScheduler, straight into the layout of @p tensor: the pages of the mapping are read by all the threads at once.
+ * The other tensors are imported by @ref ModelFile::import_tensor(), without copy if they don't need padding.
+ *
+ * @note The tensor must be initialised but not allocated, and must not be managed by a memory planner.
+ *
+ * @param[in]     model  Mapped model file.
+ * @param[in]     name   Name of the tensor in the model.
+ * @param[in,out] tensor Tensor to import. Its data type and shape must match the ones of the tensor stored in the model.
+ *
+ * @return True if the tensor was imported, false if the model doesn't contain a tensor with this name, data type and shape.
+ */
+bool import_tensor_neon(const ModelFile &model, const std::string &name, Tensor &tensor);
+}
+#endif /* __ARM_COMPUTE_NEMODELFILE_H__ */
@@ -0,0 +1,511 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NENETWORK_H__
+#define __ARM_COMPUTE_NENETWORK_H__
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/CacheWarmer.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/MemoryPlanner.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <istream>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+#ifndef NO_MULTI_THREADING
+#include <thread>
+#endif /* NO_MULTI_THREADING */
+
+namespace arm_compute
+{
+class ITiledFunction;
+
+/** Available layer types in a @ref NENetwork */
+enum class LayerType
+{
+    CONVOLUTION,     /**< Convolution layer (@ref NEConvolutionLayer) */
+    ACTIVATION,      /**< Activation layer (@ref NEActivationLayer) */
+    POOLING,         /**< Pooling layer (@ref NEPoolingLayer) */
+    NORMALIZATION,   /**< Normalization layer (@ref NENormalizationLayer) */
+    FULLY_CONNECTED, /**< Fully connected layer (@ref NEFullyConnectedLayer) */
+    SOFTMAX          /**< Softmax layer (@ref NESoftmaxLayer) */
+};
+
+/** Descriptor of a single layer of a @ref NENetwork
+ *
+ * Only the hyper-parameters of the layer are described: the shapes of the weights, biases and output tensors are inferred by the network.
+ * Use the static helpers to create a descriptor.
+ */
+struct LayerDescriptor
+{
+    /** Create a convolution layer descriptor
+     *
+     * @param[in] kernel_size Size of the (square) convolution kernel.
+     * @param[in] num_outputs Number of output feature maps.
+     * @param[in] conv_info   Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] has_bias    (Optional) True if the layer has biases. Defaults to true.
+     * @param[in] num_groups  (Optional) Number of groups of a grouped convolution. Defaults to 1.
+     *
+     * @return The convolution layer descriptor
+     */
+    static LayerDescriptor convolution(unsigned int kernel_size, unsigned int num_outputs, const PadStrideInfo &conv_info, bool has_bias = true, unsigned int num_groups = 1);
+    /** Create an activation layer descriptor
+     *
+     * @param[in] act_info Activation layer parameters.
+     *
+     * @return The activation layer descriptor
+     */
+    static LayerDescriptor activation(const ActivationLayerInfo &act_info);
+    /** Create a pooling layer descriptor
+     *
+     * @param[in] pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
+     *
+     * @return The pooling layer descriptor
+     */
+    static LayerDescriptor pooling(const PoolingLayerInfo &pool_info);
+    /** Create a normalization layer descriptor
+     *
+     * @param[in] norm_info Normalization layer information.
+     *
+     * @return The normalization layer descriptor
+     */
+    static LayerDescriptor normalization(const NormalizationLayerInfo &norm_info);
+    /** Create a fully connected layer descriptor
+     *
+     * @param[in] num_outputs Number of outputs of the layer.
+     * @param[in] has_bias    (Optional) True if the layer has biases. Defaults to true.
+     *
+     * @return The fully connected layer descriptor
+     */
+    static LayerDescriptor fully_connected(unsigned int num_outputs, bool has_bias = true);
+    /** Create a softmax layer descriptor
+     *
+     * @return The softmax layer descriptor
+     */
+    static LayerDescriptor softmax();
+
+    LayerType              type;        /**< Type of the layer */
+    unsigned int           kernel_size; /**< Kernel size (@ref LayerType::CONVOLUTION only) */
+    unsigned int           num_outputs; /**< Number of output feature maps / neurons (@ref LayerType::CONVOLUTION and @ref LayerType::FULLY_CONNECTED only) */
+    unsigned int           num_groups;  /**< Number of groups of the convolution (@ref LayerType::CONVOLUTION only) */
+    bool                   has_bias;    /**< True if the layer has biases (@ref LayerType::CONVOLUTION and @ref LayerType::FULLY_CONNECTED only) */
+    PadStrideInfo          conv_info;   /**< Padding and stride information (@ref LayerType::CONVOLUTION only) */
+    ActivationLayerInfo    act_info;    /**< Activation information (@ref LayerType::ACTIVATION only) */
+    PoolingLayerInfo       pool_info;   /**< Pooling information (@ref LayerType::POOLING only) */
+    NormalizationLayerInfo norm_info;   /**< Normalization information (@ref LayerType::NORMALIZATION only) */
+
+private:
+    /** Create a descriptor of the given type with default hyper-parameters */
+    explicit LayerDescriptor(LayerType layer_type);
+};
+
+/** Basic function to run a sequential network of NEON layers.
+ *
+ * The network is built from a list of @ref LayerDescriptor. When configured, it infers the shape of every tensor,
+ * creates and owns the weights, biases and intermediate tensors, and configures the following functions:
+ *
+ * -# @ref NEConvolutionLayer
+ * -# @ref NEActivationLayer
+ * -# @ref NEPoolingLayer
+ * -# @ref NENormalizationLayer
+ * -# @ref NEFullyConnectedLayer
+ * -# @ref NESoftmaxLayer
+ *
+ * The layers are run in the order they were added. An activation layer which directly follows a convolution or a fully connected
+ * layer is fused into it: the activation function is applied while the results of the previous layer are stored.
+ * A cross map normalization layer which directly follows a max pooling layer supported by @ref NEPoolingNormalizationLayerKernel
+ * is fused into it: both layers are computed by @ref NEPoolingNormalizationLayer without storing the pooled tensor.
+ *
+ * @note The weights and biases which are not imported from a @ref ModelFile must be filled by the user after @ref configure() has been called
+ *       and before the first call to @ref run().
+ */
+class NENetwork : public IFunction
+{
+public:
+    /** Constructor */
+    NENetwork();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENetwork(const NENetwork &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NENetwork &operator=(const NENetwork &) = delete;
+    /** Destructor: wait for the weights being streamed, if any */
+    ~NENetwork();
+    /** Initialise the metadata of the network's input.
+     *
+     * @param[in] input_info Input tensor information. 3 lower dimensions represent a single input [width, height, IFM],
+     *                       while every optional dimension from 4 and above represent a batch of inputs. Data types supported: F32.
+     */
+    void init(const TensorInfo &input_info);
+    /** Append a layer at the end of the network.
+     *
+     * @param[in] layer Descriptor of the layer to append.
+     *
+     * @return The index of the layer in the network
+     */
+    unsigned int add_layer(const LayerDescriptor &layer);
+    /** Run the consecutive convolution and pooling layers band by band, so that the rows produced by a layer are still in the cache when the next layer reads them.
+     *
+     * Each band covers as many rows of the output of the last layer of the sequence as fit in @p working_set_size with the rows of the other layers
+     * it depends on (See @ref ITiledFunction). The rows shared by two bands are computed once: the tensors between the layers keep their full size.
+     *
+     * @note Must be called before @ref configure(). The outputs of the layers which may run in bands don't share the memory of the other intermediate tensors.
+     *
+     * @param[in] working_set_size Size in bytes of the memory touched by each band, e.g. the size of the L2 cache. 0 (default) runs the layers one after the other.
+     */
+    void set_tile_working_set(size_t working_set_size);
+    /** Read the weights of the next layer into the cache shared by the cores while the current layer runs (See @ref CacheWarmer).
+     *
+     * Large weights, e.g. those of a fully connected layer following a convolution, are otherwise read from the main memory by the first iterations
+     * of their layer. Only the steady-state runs read ahead: the first run reshapes and releases the weights. The weights are read in the order
+     * the layer reads them, i.e. the reshaped weights of the layers which reshape them, and the layers without weights are skipped.
+     *
+     * @note The thread reading ahead is best left a core the scheduler doesn't use.
+     *
+     * @param[in] prefetch_size Number of bytes of the weights of the next layer to read ahead, at most the size of the shared cache. 0 (default) disables it.
+     */
+    void set_weights_prefetch(size_t prefetch_size);
+    /** Only recompute the rows of the outputs of the layers which depend on the rows of the input which changed since the previous run, e.g. for a static camera.
+     *
+     * Each run compares the input with the input of the previous run row by row (a row covers all the columns, channels and batches). The convolution
+     * and pooling layers which can run in bands of rows (See @ref ITiledFunction) then only recompute the rows of their output which read a changed row
+     * of their input, and keep the other rows from the previous run. From the first layer which can't run in bands, e.g. the first fully connected layer,
+     * the layers run in full if any row changed. Nothing runs if the input didn't change.
+     * The first run, and the first one after the weights or biases were accessed through @ref weights() or @ref biases(), imported or shared, runs all the layers in full.
+     *
+     * @note Must be called before @ref configure() or @ref load_plan(). The outputs of all the layers keep their memory between the runs: they don't share
+     *       the memory of the other intermediate tensors. The layers run one after the other, the tiled sequences are only used by the first run.
+     *
+     * @param[in] incremental True to only recompute the rows which changed, false (default) to run all the layers in full.
+     */
+    void set_incremental(bool incremental);
+    /** Infer the shapes of all the tensors, configure the functions and allocate the tensors.
+     *
+     * The weights and biases found in @p model are imported from it instead of being allocated: the weights of layer i are named "i.weights"
+     * and its biases "i.biases", see @ref save_weights(). The weights stored in F16 or U8 are expanded with NEON (See @ref import_tensor_neon()).
+     * The other weights and biases must be filled by the user.
+     *
+     * With @p stream_weights, configure() only creates the tensors and configures the functions: the weights and biases are imported, and the
+     * weights of the layers reshaped (See @ref prepare()), layer by layer on a background thread started by configure(). The first run waits
+     * for the weights of each layer just before running it, so that it overlaps with the loading of the following layers instead of waiting
+     * for the whole model.
+     *
+     * @note No layer can be added once the network has been configured.
+     * @note While the weights are being streamed, which ends with the first @ref run() or @ref prepare(), the weights and biases of the layers
+     *       must not be accessed. Without multi-threading support (NO_MULTI_THREADING), each layer is loaded just before its first run.
+     *
+     * @param[in] model           (Optional) Mapped model file providing the weights and biases of the layers. The model must outlive the network.
+     * @param[in] release_weights (Optional) Release the memory of the weights of a layer on the first run, once the layer has reshaped them
+     *                            and no longer reads them (see @ref ITensor::is_used()). Defaults to false.
+     * @param[in] stream_weights  (Optional) Load the weights of the layers during the first run instead of in configure(). Requires @p model
+     *                            to provide all the weights and biases. Defaults to false.
+     */
+    void configure(const ModelFile *model = nullptr, bool release_weights = false, bool stream_weights = false);
+    /** Number of layers in the network
+     *
+     * @return The number of layers added to the network
+     */
+    unsigned int num_layers() const;
+    /** Return the input tensor of the network
+     *
+     * @return The input tensor
+     */
+    Tensor *input();
+    /** Return the output tensor of the network, i.e. the output of the last layer
+     *
+     * @note The network must be configured.
+     *
+     * @return The output tensor
+     */
+    Tensor *output();
+    /** Return the weights of a layer
+     *
+     * @note The network must be configured. If the network releases the weights, the weights of the layers which reshape them have no memory after the first run.
+     *
+     * @param[in] layer Index of the layer.
+     *
+     * @return The weights tensor of the layer, nullptr if the layer has no weights
+     */
+    Tensor *weights(unsigned int layer);
+    /** Return the biases of a layer
+     *
+     * @note The network must be configured.
+     *
+     * @param[in] layer Index of the layer.
+     *
+     * @return The biases tensor of the layer, nullptr if the layer has no biases
+     */
+    Tensor *biases(unsigned int layer);
+
+    /** Write the reshaped weights of all the convolution and fully connected layers to a binary stream.
+     *
+     * The stream can be loaded by @ref import_reshaped_weights on the next launch to skip the reshape of the weights on the first run.
+     *
+     * @note The network must be configured and its weights filled.
+     *
+     * @param[out] stream Binary output stream.
+     */
+    void export_reshaped_weights(std::ostream &stream);
+    /** Load the reshaped weights of all the convolution and fully connected layers from a binary stream written by @ref export_reshaped_weights.
+     *
+     * @note The network must be configured. The weights and biases must still be filled: some layers read them as they are.
+     *
+     * @param[in] stream Binary input stream.
+     *
+     * @return True if the reshaped weights of all the layers were loaded, false if the stream doesn't match the network.
+     */
+    bool import_reshaped_weights(std::istream &stream);
+    /** Read the reshaped weights of the convolution and fully connected layers of another network with the same layers, without reshaping or copying them.
+     *
+     * To switch between input resolutions without reconfiguring, or to run several streams at once, configure one network per resolution or stream
+     * from the same @ref ModelFile (the weights and biases are imported without copies) and share the reshaped weights of the first one with the others:
+     * only the activations and the shape dependent tensors and functions are duplicated, and running each network needs no setup (See @ref SharedWeights).
+     * The fully connected layers reshape their own weights if their shape depends on the resolution, i.e. unless they follow a global pooling.
+     *
+     * @note Both networks must be configured, and their weights filled. @p source can be destroyed first.
+     *
+     * @param[in, out] source Network configured with the same layers and weights, for another input resolution or stream.
+     *
+     * @return True if the reshaped weights of all the convolution and fully connected layers are shared, false if some layers reshape their own weights on the first run.
+     */
+    bool share_reshaped_weights(NENetwork &source);
+
+    /** Write the weights and biases of all the layers to a model file which can be given to @ref configure().
+     *
+     * @note The network must be configured, its weights filled and not released.
+     *
+     * @param[in] path         Path of the model file to write.
+     * @param[in] storage_type (Optional) Data type the weights are stored in: F32 (default), F16 or U8 (See @ref ModelFile::save()).
+     *                         They are expanded back to F32 with NEON when the network is configured.
+     */
+    void save_weights(const std::string &path, DataType storage_type = DataType::F32) const;
+    /** Write the execution plan of the network to a model file which can be given to @ref load_plan() on the next launch.
+     *
+     * The plan contains the description of the input and of the layers, the tiling working set, the weights and biases of all the layers, and
+     * the reshaped weights of the convolution and fully connected layers named after the algorithm which reshaped them.
+     *
+     * @note The network must be configured, its weights filled and not released. The weights which have not been reshaped yet are reshaped first.
+     *
+     * @param[in] path         Path of the model file to write.
+     * @param[in] storage_type (Optional) Data type the weights and reshaped weights are stored in: F32 (default), F16 or U8 (See @ref ModelFile::save()).
+     *                         They are expanded back to F32 with NEON when the plan is loaded, straight into the layout the functions read.
+     */
+    void save_plan(const std::string &path, DataType storage_type = DataType::F32);
+    /** Create and configure the network described by a plan written by @ref save_plan(), and import all its weights from the plan.
+     *
+     * The layers need neither their weights to be filled nor any setup on the first run: the reshaped weights are mapped from the plan
+     * and the pages of the original weights of the layers which read reshaped weights are never read.
+     *
+     * @note The network must be empty: neither initialised nor configured. No layer can be added afterwards.
+     *
+     * @param[in] plan            Mapped model file written by @ref save_plan(). It must outlive the network.
+     * @param[in] release_weights (Optional) Release the memory of the weights of a layer on the first run, once it no longer reads them (See @ref configure()).
+     *
+     * @return True if the reshaped weights of all the layers were imported, false if some layers reshape their weights on the first run
+     *         because the plan was written on a device on which they picked another algorithm.
+     */
+    bool load_plan(const ModelFile &plan, bool release_weights = false);
+
+    /** Memory of one layer: its weights, biases and output, and the internal tensors of its functions (See @ref IFunction::memory_footprint())
+     *
+     * @note The network must be configured. The weights imported from a @ref ModelFile are counted although they are mapped from the file.
+     *
+     * @param[in] layer Index of the layer.
+     *
+     * @return The memory of the layer
+     */
+    MemoryFootprint memory_footprint(unsigned int layer) const;
+    /** Size of the arena shared by the transient tensors of the network
+     *
+     * The outputs and intermediate tensors counted by @ref memory_footprint() as activations live in this arena when their lifetimes don't overlap:
+     * the difference between both is the memory saved by the planner.
+     *
+     * @note The network must be configured.
+     *
+     * @return The size of the arena in bytes
+     */
+    size_t transient_memory_size() const;
+
+    /** Function called with the index of a layer and its output once the layer has been run (See @ref set_layer_observer()) */
+    using LayerObserver = std::function<void(unsigned int layer, const ITensor &output)>;
+    /** Call a function with the output of each layer during every run, e.g. to compare the activations of two configurations of the same network.
+     *
+     * The observer is called right after each layer has been run (after the whole sequence for the layers run band by band), while its output
+     * still holds the results: the memory of the transient outputs is reused by the following layers. The layers fused into the previous one
+     * are not observed: the output of the previous layer holds their results.
+     *
+     * @param[in] observer Function to call, nullptr to stop observing the layers.
+     */
+    void set_layer_observer(LayerObserver observer);
+
+    // Inherited methods overridden:
+    void run() override;
+    /** Transform the weights of all the layers, releasing the original weights once they are no longer read if requested by configure()
+     *
+     * @note The network must be configured and its weights filled. The weights being streamed are waited for.
+     */
+    void prepare() override;
+    /** Memory of all the layers and of the input of the network
+     *
+     * @note The network must be configured.
+     */
+    MemoryFootprint memory_footprint() const override;
+
+private:
+    /** A layer of the network with the tensors and the function it owns */
+    struct Layer
+    {
+        LayerDescriptor            descriptor;      /**< Hyper-parameters of the layer */
+        std::unique_ptr<IFunction> function;        /**< Function running the layer */
+        std::unique_ptr<Tensor>    weights;         /**< Weights of the layer */
+        std::unique_ptr<Tensor>    biases;          /**< Biases of the layer */
+        std::unique_ptr<Tensor>    output;          /**< Output of the layer, nullptr if the layer is fused into the previous one */
+        bool                       is_flat;         /**< True if the output is a batch of 1D vectors */
+        ActivationLayerInfo        fused_act_info;  /**< Activation function of the following layer fused into this one */
+        bool                       is_fused;        /**< True if the layer is run by the previous layer */
+        bool                       has_fused_norm;  /**< True if the following normalization layer is fused into this pooling layer */
+        NormalizationLayerInfo     fused_norm_info; /**< Normalization of the following layer fused into this pooling layer */
+        bool                       may_be_tiled;    /**< True if the layer might run in bands of rows with its neighbours: its tensors are not transient */
+    };
+
+    /** Sequence of consecutive layers run band by band */
+    struct TiledSequence
+    {
+        std::vector<size_t>           layers;    /**< Indices of the layers of the sequence */
+        std::vector<ITiledFunction *> functions; /**< Functions of the layers of the sequence */
+        Tensor                       *input;     /**< Input of the first layer */
+        unsigned int                  num_rows;  /**< Number of rows of the output of the last layer computed by each band */
+    };
+
+    /** Create the tensors of a layer and configure its function
+     *
+     * @param[in]     input               Input tensor of the layer.
+     * @param[in]     input_is_flat       True if the input is a batch of 1D vectors.
+     * @param[in]     output_is_transient True if the memory of the output can be shared with the other intermediate tensors of the network.
+     * @param[in,out] layer               Layer to configure.
+     */
+    void configure_layer(Tensor *input, bool input_is_flat, bool output_is_transient, Layer &layer);
+    /** Find the sequences of configured layers which can run band by band, size their bands to the working set and allocate the state of their runs */
+    void plan_tiled_sequences();
+    /** Memory touched by a band of a sequence of layers
+     *
+     * @param[in] sequence Sequence of layers.
+     * @param[in] num_rows Number of rows of the output of the last layer in the band.
+     *
+     * @return The size in bytes of the rows of all the tensors of the sequence and of the internal memory of its functions read or written by the band
+     */
+    size_t tiled_sequence_working_set(const TiledSequence &sequence, unsigned int num_rows) const;
+    /** Run a sequence of layers band by band
+     *
+     * @param[in] sequence Sequence of layers.
+     */
+    void run_tiled_sequence(const TiledSequence &sequence);
+    /** Release the memory of the weights of a layer if it doesn't read them anymore and the network was configured with release_weights
+     *
+     * @param[in,out] layer Layer which has just been run.
+     */
+    void release_unused_weights(Layer &layer);
+    /** Start reading ahead the weights of the first layer after @p index which reads weights, unless they are already being read
+     *
+     * @param[in] index Index of the layer about to run.
+     */
+    void prefetch_next_weights(size_t index);
+    /** List the memory ranges of the weights read ahead of each layer, once the layers released their unused weights */
+    void plan_weights_prefetch();
+    /** Find the rows of the input which changed since the previous run and copy them to the previous input
+     *
+     * @return The first row of the input which changed and the row following the last one, equal if the input didn't change
+     */
+    std::pair<unsigned int, unsigned int> update_previous_input();
+    /** Run the layers incrementally: only recompute the rows of their outputs which depend on the changed rows of the input (See @ref set_incremental())
+     *
+     * @param[in] first_row First row of the input which changed.
+     * @param[in] last_row  Row following the last row of the input which changed.
+     */
+    void run_changed_rows(unsigned int first_row, unsigned int last_row);
+    /** Import the weights and biases of a layer from a model file, or allocate the ones which are not in the model
+     *
+     * @param[in] index Index of the layer.
+     * @param[in] model Model file providing the weights and biases, nullptr to allocate them.
+     */
+    void import_parameters(size_t index, const ModelFile *model);
+    /** Import the weights and biases of a layer from the streamed model and prepare its function
+     *
+     * @param[in] index Index of the layer.
+     */
+    void stream_layer(size_t index);
+    /** Stream the layers one after the other, recording the exception raised if any (Run by the loading thread) */
+    void stream_parameters();
+    /** Wait until the weights of a layer have been streamed
+     *
+     * @note Rethrows the exception raised by the loading thread, if any.
+     *
+     * @param[in] index Index of the layer.
+     */
+    void wait_for_layer(size_t index);
+    /** Wait until the weights of all the layers have been streamed and join the loading thread */
+    void finish_streaming();
+    /** Weights and biases of all the layers, named as in a model file given to @ref configure()
+     *
+     * @return The names and tensors of the weights and biases
+     */
+    std::vector<std::pair<std::string, const ITensor *>> parameters() const;
+
+    std::shared_ptr<MemoryPlanner>               _memory_planner;
+    Tensor                                       _input;
+    std::vector<Layer>                           _layers;
+    bool                                         _is_configured;
+    bool                                         _is_prepared;
+    bool                                         _has_run;
+    bool                                         _release_weights;
+    size_t                                       _tile_working_set;
+    std::vector<TiledSequence>                   _tiled_sequences;
+    std::vector<unsigned int>                    _tile_rows_done;   /**< Rows of the output of each layer of the running sequence computed so far */
+    std::vector<unsigned int>                    _tile_rows_needed; /**< Rows of the output of each layer of the running sequence needed by the current band */
+    LayerObserver                                _layer_observer;
+    size_t                                       _weights_prefetch_size;
+    std::vector<std::vector<CacheWarmer::Range>> _prefetched_weights;
+    size_t                                       _prefetched_layer;
+    CacheWarmer                                  _cache_warmer;
+    bool                                         _is_incremental;
+    Tensor                                       _previous_input;
+    const ModelFile                             *_streamed_model;
+    size_t                                       _num_streamed_layers;
+    std::exception_ptr                           _streaming_error;
+    std::mutex                                   _streaming_mutex;
+    std::condition_variable                      _layer_streamed;
+#ifndef NO_MULTI_THREADING
+    std::thread _loader;
+#endif /* NO_MULTI_THREADING */
+};
+}
+#endif /* __ARM_COMPUTE_NENETWORK_H__ */
@@ -0,0 +1,193 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEVISIONGRAPH_H__
+#define __ARM_COMPUTE_NEVISIONGRAPH_H__
+
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <vector>
+
+namespace arm_compute
+{
+class INESimpleFunction;
+
+/** Run a chain of NEON vision functions band of rows by band of rows, like an OpenVX graph
+ *
+ * The intermediate images of the chain can be virtual (See @ref create_virtual_image()): they are never allocated at full size, only the rows
+ * of the current band and the rows the following functions read around them (their border) are kept in a line buffer. Each band is computed
+ * function after function, so the rows a function produces are still in the cache when the next one reads them, and the rows shared by two
+ * consecutive bands are computed once.
+ *
+ * Usage:
+ * -# Create the virtual images with @ref create_virtual_image() and configure the functions with them as inputs and outputs.
+ * -# Add the functions with @ref add_node(), each one after the functions producing its virtual inputs.
+ * -# Call @ref finalize() once to plan the bands and allocate the line buffers, then @ref run() for each frame.
+ *
+ * @note All the images of the graph must have the same height, and each virtual image must be written by exactly one function.
+ *       The functions must read row y of their inputs only to compute the rows of their output around y given by their border (See @ref INESimpleFunction::band_border()),
+ *       which holds for the point operations, filters and morphological operations computing each pixel from a neighbourhood of their input.
+ */
+class NEVisionGraph : public IFunction
+{
+public:
+    /** Constructor */
+    NEVisionGraph();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEVisionGraph(const NEVisionGraph &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEVisionGraph &operator=(const NEVisionGraph &) = delete;
+    /** Create an image of which only a few rows are ever in memory
+     *
+     * @note The image can only be used by the functions of the graph, and its content is undefined outside of them.
+     *
+     * @param[in] width  Width of the image.
+     * @param[in] height Height of the image.
+     * @param[in] format Format of the image. Multi-planar formats are not supported.
+     *
+     * @return The image, owned by the graph, to configure the functions with
+     */
+    IImage *create_virtual_image(unsigned int width, unsigned int height, Format format);
+    /** Add a configured function to the graph
+     *
+     * @param[in] function Configured function. Must outlive the graph.
+     * @param[in] inputs   Images read by the function. The virtual ones must be written by a function already in the graph.
+     * @param[in] outputs  Images written by the function. The virtual ones must not be written by another function of the graph.
+     */
+    void add_node(INESimpleFunction *function, std::initializer_list<const ITensor *> inputs, std::initializer_list<const ITensor *> outputs);
+    /** Plan the bands and allocate the line buffers of the virtual images
+     *
+     * @note Must be called once all the functions are added and before the first call to @ref run().
+     *
+     * @param[in] band_height (Optional) Number of rows of the last outputs computed by each band. Defaults to 16: the rows of all the images touched by a band should fit in the L2 cache.
+     */
+    void finalize(unsigned int band_height = 16);
+
+    // Inherited methods overridden:
+    void run() override;
+    MemoryFootprint memory_footprint() const override;
+
+private:
+    /** Image of which only a band of consecutive rows is in memory
+     *
+     * The buffer is shifted so that the rows in memory are found at their coordinates in the image: the functions access them as usual.
+     */
+    class VirtualImage : public ITensor
+    {
+    public:
+        /** Constructor
+         *
+         * @param[in] width  Width of the image.
+         * @param[in] height Height of the image.
+         * @param[in] format Format of the image.
+         */
+        VirtualImage(unsigned int width, unsigned int height, Format format);
+        /** Allocate the line buffer once the padding of the image is known
+         *
+         * @param[in] num_rows Number of rows of the image, not counting the padding, in memory at a time.
+         */
+        void allocate(unsigned int num_rows);
+        /** Make room for the rows about to be written by dropping the rows which are not read anymore
+         *
+         * @param[in] keep_row    First row still to be read.
+         * @param[in] written_row Row following the last row written so far.
+         * @param[in] last_row    Row following the last row about to be written.
+         */
+        void slide(unsigned int keep_row, unsigned int written_row, unsigned int last_row);
+        /** Start again from the first row of the image */
+        void rewind();
+        /** Size of the line buffer
+         *
+         * @return The size in bytes of the line buffer
+         */
+        size_t buffer_size() const;
+
+        // Inherited methods overridden:
+        TensorInfo *info() const override;
+        TensorInfo *info() override;
+        uint8_t *buffer() const override;
+
+    private:
+        mutable TensorInfo         _info;
+        std::unique_ptr<uint8_t[]> _storage;   /**< Line buffer, including the top and bottom padding rows */
+        unsigned int               _num_rows;  /**< Number of rows of the image which fit in the line buffer */
+        unsigned int               _first_row; /**< Row of the image stored first in the line buffer */
+    };
+
+    /** Virtual image and the functions using it */
+    struct VirtualImageNode
+    {
+        std::unique_ptr<VirtualImage> image;     /**< Virtual image */
+        size_t                        producer;  /**< Index of the node writing the image */
+        std::vector<size_t>           consumers; /**< Indices of the nodes reading the image */
+        unsigned int                  num_rows;  /**< Number of rows of the image in memory at a time */
+    };
+
+    /** Function of the graph */
+    struct Node
+    {
+        INESimpleFunction  *function;  /**< Configured function */
+        std::vector<size_t> inputs;    /**< Indices of the virtual images read by the function */
+        std::vector<size_t> outputs;   /**< Indices of the virtual images written by the function */
+        Window::Dimension   rows;      /**< Rows computed by the function (See @ref INESimpleFunction::band_rows()) */
+        BorderSize          border;    /**< Rows of the inputs read around the rows computed (See @ref INESimpleFunction::band_border()) */
+        unsigned int        lookahead; /**< Rows computed past the last row of the band, as the functions reading the outputs need them */
+        unsigned int        next_row;  /**< First row not computed yet in the current run */
+    };
+
+    /** Index of a virtual image of the graph
+     *
+     * @param[in] tensor Image to look for.
+     *
+     * @return The index of the virtual image, or the number of virtual images if @p tensor is not virtual
+     */
+    size_t find_virtual_image(const ITensor *tensor) const;
+    /** First row of a virtual image which is still to be read by the functions of the graph
+     *
+     * @param[in] image Index of the virtual image.
+     *
+     * @return The first row which must be kept in memory
+     */
+    unsigned int first_row_to_keep(size_t image) const;
+    /** Run the graph band by band
+     *
+     * @param[in] dry_run True to only measure the number of rows of each virtual image in memory at a time, without running the functions.
+     */
+    void run_bands(bool dry_run);
+
+    std::vector<VirtualImageNode> _images;
+    std::vector<Node>             _nodes;
+    unsigned int                  _band_height;
+    unsigned int                  _num_rows;
+    bool                          _is_finalized;
+};
+}
+#endif /* __ARM_COMPUTE_NEVISIONGRAPH_H__ */
@@ -24,9 +24,12 @@
 #ifndef __ARM_COMPUTE_NEACCUMULATE_H__
 #define __ARM_COMPUTE_NEACCUMULATE_H__
 
+#include "arm_compute/core/NEON/kernels/NEAccumulateKernel.h"
+#include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
 #include <cstdint>
+#include <vector>
 
 namespace arm_compute
 {
@@ -70,5 +73,36 @@ public:
      */
     void configure(const ITensor *input, uint32_t shift, ITensor *output);
 };
+
+/** Basic function to run @ref NEAccumulateCombinedKernel
+ *
+ * Updates the accumulation, the weighted accumulation and the accumulation of squares of a batch of frames in a single pass,
+ * instead of reading each frame once per accumulation and each accumulator once per frame.
+ * For background modelling, buffering K frames and passing them in a single call keeps the accumulators in the cache for the K frames.
+ */
+class NEAccumulateCombined : public IFunction
+{
+public:
+    /** Default constructor */
+    NEAccumulateCombined();
+    /** Set the input frames, the accumulation tensors and their parameters
+     *
+     * @note At least one of the accumulation tensors must not be nullptr. The accumulations behave as @ref NEAccumulate, @ref NEAccumulateWeighted and @ref NEAccumulateSquared run frame after frame.
+     *
+     * @param[in]     inputs         Source frames, accumulated in order. Data type supported: U8.
+     * @param[in,out] accum          Accumulated tensor. Can be nullptr. Data type supported: S16.
+     * @param[in]     alpha          The input scalar value with a value input the range of [0, 1.0] for the weighted accumulation
+     * @param[in,out] accum_weighted Weighted accumulated tensor. Can be nullptr. Data type supported: U8.
+     * @param[in]     shift          The input with a value input the range of [0, 15] for the accumulation of squares
+     * @param[in,out] accum_squared  Accumulated squares tensor. Can be nullptr. Data type supported: S16.
+     */
+    void configure(const std::vector<const ITensor *> &inputs, ITensor *accum, float alpha, ITensor *accum_weighted, uint32_t shift, ITensor *accum_squared);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEAccumulateCombinedKernel _kernel;
+};
 }
 #endif /*__ARM_COMPUTE_NEACCUMULATE_H__ */
@@ -40,21 +40,17 @@ class ITensor;
 /** Basic function to execute canny edge on NEON. This function calls the following NEON kernels and functions:
  *
  *  -# @ref NEFillBorderKernel (if border_mode == REPLICATE or border_mode == CONSTANT)
- *  -# @ref NESobel3x3 (if gradient_size == 3) or
- *     @ref NESobel5x5 (if gradient_size == 5) or
- *     @ref NESobel7x7 (if gradient_size == 7)
- *  -# @ref NEGradientKernel
- *  -# @ref NEEdgeNonMaxSuppressionKernel
+ *  -# @ref NEEdgeGradientNonMaxSuppressionKernel<br/>
+ *     or, if the function is configured with the gradients of the image, @ref NEGradientKernel, @ref NEFillBorderKernel and @ref NEEdgeNonMaxSuppressionKernel
+ *  -# @ref NEEdgeTraceLabelKernel
+ *  -# @ref NEEdgeTraceMergeKernel
  *  -# @ref NEEdgeTraceKernel
  *
  */
 class NECannyEdge : public IFunction
 {
 public:
-    /** Constructor
-     *
-     * Initialize Sobel kernel to nullptr.
-     */
+    /** Constructor */
     NECannyEdge();
     /** Prevent instances of this class from being copied (As this class contains pointers) */
     NECannyEdge(const NECannyEdge &) = delete;
@@ -75,23 +71,46 @@ public:
      */
     void configure(ITensor *input, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t gradient_size, int32_t norm_type, BorderMode border_mode, uint8_t constant_border_value = 0,
                    bool use_fp16 = false);
+    /** Initialise the function's gradients, destination, thresholds, normalization type and border mode.
+     *
+     * The Sobel filter is not run: @p gx and @p gy are the gradients of the image shared with other functions (See @ref NEFrameGradients).
+     *
+     * @param[in]  gx          Horizontal gradient computed with a 3x3, 5x5 or 7x7 Sobel filter. Data type supported: S16, or S32 for the 7x7 filter.
+     * @param[in]  gy          Vertical gradient computed with the same filter as @p gx. Data type supported: same as @p gx.
+     * @param[out] output      Destination tensor. Data type supported: U8.
+     * @param[in]  upper_thr   Upper threhold used for the hysteresis
+     * @param[in]  lower_thr   Lower threshold used for the hysteresis.
+     * @param[in]  norm_type   Normalization type. If 1, L1-Norm otherwise L2-Norm
+     * @param[in]  border_mode Border mode the gradients were computed with.
+     * @param[in]  use_fp16    (Optional) If true the FP16 kernels will be used. If false F32 kernels are used.
+     */
+    void configure(const ITensor *gx, const ITensor *gy, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t norm_type, BorderMode border_mode, bool use_fp16 = false);
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    std::unique_ptr<IFunction>    _sobel;               /**< Pointer to Sobel kernel */
-    std::unique_ptr<INEKernel>    _gradient;            /**< Gradient kernel */
-    NEEdgeNonMaxSuppressionKernel _non_max_suppr;       /**< Non-Maxima suppression kernel */
-    NEEdgeTraceKernel             _edge_trace;          /**< Edge tracing kernel */
-    NEFillBorderKernel            _border_mag_gradient; /**< Fill border on magnitude tensor kernel */
-    NEFillBorderKernel            _border_edge_trace;   /**< Fill border before edge trace */
-    Tensor                        _gx;                  /**< Source tensor - Gx component */
-    Tensor                        _gy;                  /**< Source tensor - Gy component */
-    Tensor                        _magnitude;           /**< Source tensor - Magnitude */
-    Tensor                        _phase;               /**< Source tensor - Phase */
-    Tensor                        _nonmax;              /**< Source tensor - Non-Maxima suppressed */
-    ITensor                      *_output;              /**< Output tensor provided by the user. */
+    /** Configure the edge tracing on the non-maxima suppressed image
+     *
+     * @param[out] output Destination tensor.
+     */
+    void configure_edge_trace(ITensor *output);
+
+    NEEdgeGradientNonMaxSuppressionKernel _gradient_non_max;    /**< Sobel, gradient and non-maxima suppression kernel */
+    std::unique_ptr<NEGradientKernel>     _gradient;            /**< Gradient kernel, if configured with the gradients */
+    NEEdgeNonMaxSuppressionKernel         _non_max;             /**< Non-maxima suppression kernel, if configured with the gradients */
+    NEFillBorderKernel                    _border_mag_gradient; /**< Fill border on magnitude tensor kernel, if configured with the gradients */
+    Tensor                                _magnitude;           /**< Magnitude of the gradients, if configured with the gradients */
+    Tensor                                _phase;               /**< Quantized phase of the gradients, if configured with the gradients */
+    NEEdgeTraceLabelKernel                _edge_label;          /**< Edge tracing labels initialisation kernel */
+    NEEdgeTraceMergeKernel                _edge_merge;          /**< Edge tracing sets merging kernel */
+    NEEdgeTraceKernel                     _edge_trace;          /**< Edge tracing kernel */
+    NEFillBorderKernel                    _border_input;        /**< Fill border on input tensor kernel */
+    NEFillBorderKernel                    _border_edge_trace;   /**< Fill border before edge trace */
+    Tensor                                _nonmax;              /**< Source tensor - Non-Maxima suppressed */
+    Tensor                                _edge_labels;         /**< Labels of the edge tracing sets */
+    ITensor                              *_output;              /**< Output tensor provided by the user. */
+    bool                                  _uses_gradients;      /**< True if configured with the gradients of the image */
 };
 }
 #endif /* __ARM_COMPUTE_NECANNYEDGE_H */
@@ -29,7 +29,6 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 
@@ -48,7 +47,7 @@ class NEConvolution3x3 : public INESimpleFunction
 public:
     /** Initialize the function's source, destination, conv and border_mode.
      *
-     * @param[in,out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
+     * @param[in,out] input                 Source tensor. Data type supported: U8. (Never written to: the kernel handles the borders itself and needs no padding)
      * @param[out]    output                Destination tensor, Data types supported: U8 or S16.
      * @param[in]     conv                  Matrix_size x matrix_size S16 coefficients structured as a row-major 2D array in a linear buffer.
      * @param[in]     scale                 Scale of the convolution matrix. If 0 is passed, it will be set to the sum of the coefficients of the convolution or 1 if they add up to 0.
@@ -62,7 +61,7 @@ public:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref NEConvolutionKernel or<br/>
- *    @ref NESeparableConvolutionHorKernel and @ref NESeparableConvolutionVertKernel (if convolution matrix is separable)
+ *    @ref NESeparableConvolutionKernel (if convolution matrix is separable)
  *
  */
 template <unsigned int matrix_size>
@@ -86,12 +85,10 @@ public:
     void run() override;
 
 private:
-    Tensor                                        _tmp;            /**< temporary buffer for output of horizontal pass */
-    bool                                          _is_separable;   /**< true if the convolution can be separated */
-    NESeparableConvolutionHorKernel<matrix_size>  _kernel_hor;     /**< kernel for horizontal pass of separated convolution */
-    NESeparableConvolutionVertKernel<matrix_size> _kernel_vert;    /**< kernel for vertical pass of separated convolution */
-    NEConvolutionKernel<matrix_size>              _kernel;         /**< kernel for non-separated convolution **/
-    NEFillBorderKernel                            _border_handler; /**< kernel for border handling */
+    bool                                      _is_separable;     /**< true if the convolution can be separated */
+    NESeparableConvolutionKernel<matrix_size> _kernel_separable; /**< kernel for both passes of separated convolution */
+    NEConvolutionKernel<matrix_size>          _kernel;           /**< kernel for non-separated convolution **/
+    NEFillBorderKernel                        _border_handler;   /**< kernel for border handling */
 };
 
 /** Basic function to run 5x5 convolution. */
@@ -105,6 +102,7 @@ using NEConvolution9x9 = NEConvolutionSquare<9>;
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
  * -# @ref NEConvolutionRectangleKernel or<br/>
+ *    @ref NESeparableConvolutionRectangleKernel (if convolution matrix is separable)
  *
  * @note Convolution rectangle should have dimensions of 3, 5, 7, 9
  */
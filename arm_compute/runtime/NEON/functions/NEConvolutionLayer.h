@@ -26,63 +26,354 @@
 
 #include "arm_compute/runtime/IFunction.h"
 
-#include "arm_compute/core/NEON/kernels/NECol2ImKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBatchNormalizationFoldKernel.h"
+#include "arm_compute/core/NEON/kernels/NEBlockedLayoutKernel.h"
 #include "arm_compute/core/NEON/kernels/NEConvolutionLayerWeightsReshapeKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionNCHW4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMBlockedMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
+#include "arm_compute/core/NEON/kernels/NESpaceToDepthKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWinogradFilterTransformKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWinogradInputTransformKernel.h"
+#include "arm_compute/core/NEON/kernels/NEWinogradOutputTransformKernel.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ConvolutionMethodTuner.h"
+#include "arm_compute/runtime/ITiledFunction.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/SharedWeights.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to simulate a convolution layer. This function calls the following OpenCL kernels:
- * -# @ref NEConvolutionLayerWeightsReshapeKernel (executed only once for each configuration)
- * -# @ref NEGEMMTranspose1xWKernel               (executed only once for each configuration)
- * -# @ref NEIm2ColKernel
+/** Basic function to simulate a convolution layer. This function calls the following NEON kernels:
+ * -# @ref NEConvolutionLayerWeightsReshapeKernel (executed only once for each configuration, which writes the weights directly in the 1xW transposed layout required by the matrix multiplication)
+ * -# @ref NEIm2ColKernel (which writes its output directly in the layout of @ref NEGEMMInterleave4x4Kernel)
+ * -# @ref NEGEMMMatrixMultiplyKernel (which stores its output directly in the output feature maps, adding the biases and applying the optional fused activation function)
+ *
+ * Ungrouped 3x3 convolutions with a stride of 1 run in the Winograd F(2x2, 3x3) domain, which needs 2.25 times less multiplications:
+ * -# @ref NEWinogradFilterTransformKernel (executed only once for each configuration)
+ * -# @ref NEGEMMTranspose1xWKernel        (executed only once for each configuration)
+ * -# @ref NEWinogradInputTransformKernel
  * -# @ref NEGEMMInterleave4x4Kernel
- * -# @ref NEGEMMMatrixMultiplyKernel
- * -# @ref NECol2ImKernel
+ * -# @ref NEGEMMMatrixMultiplyKernel      (computes the 16 batched element-wise products)
+ * -# @ref NEWinogradOutputTransformKernel (which also adds the biases and applies the optional fused activation function)
+ *
+ * Ungrouped 1x1 convolutions with a stride of 1 and no padding only call @ref NEGEMMBlockedMatrixMultiplyKernel, which multiplies the weights
+ * directly with the input feature maps: the input of a 1x1 convolution is already the matrix that @ref NEIm2ColKernel would produce.
+ *
+ * Other ungrouped 1x1, 3x3 and 5x5 convolutions with a stride of 1 or 2 and a small output plane only call @ref NEDirectConvolutionLayerKernel:
+ * for these shapes the expansion of the input by @ref NEIm2ColKernel costs more in memory traffic than the matrix multiplication saves.
+ *
+ * Quantized U8 convolutions always run as a matrix multiplication, computed by @ref NEGEMMLowpMatrixMultiplyKernel instead of @ref NEGEMMMatrixMultiplyKernel.
+ *
+ * If requested, a convolution with a stride greater than 1 is first rewritten as a convolution with a stride of 1 by @ref NESpaceToDepthKernel,
+ * applied to the input at every run and to the weights once, which then runs on one of the paths above.
+ *
+ * The paths above are selected by heuristics unless a @ref ConvolutionMethodTuner is passed to the constructor: the function then runs the algorithm
+ * stored in the tuner for the layer, benchmarking the algorithms supporting the layer on the running CPU the first time the layer is configured.
+ *
+ * Single precision NHWC convolutions (See @ref DataLayout) always run as a matrix multiplication: @ref NEIm2ColKernel copies whole rows of channels
+ * into the interleaved matrix, and @ref NEGEMMMatrixMultiplyKernel stores the output feature maps of each output element contiguously.
+ * The im2col of a 1x1 NHWC convolution therefore only interleaves the input, which is already a matrix with one row per pixel.
+ *
+ * Single precision NCHW4 convolutions (See @ref DataLayout) run directly on the blocked tensors with @ref NEDirectConvolutionNCHW4Kernel,
+ * on weights blocked once by @ref NEBlockedLayoutKernel: their output is blocked too, so consecutive layers don't reorder their tensors.
  */
-class NEConvolutionLayer : public IFunction
+class NEConvolutionLayer : public IFunction, public ITiledFunction
 {
 public:
-    /** Constructor */
-    NEConvolutionLayer();
+    /** Constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner used to share the memory of the intermediate buffers with other functions.
+     * @param[in] tuner          (Optional) Tuner selecting the algorithm of the convolution, nullptr to use the heuristics. It must outlive the calls to configure().
+     */
+    NEConvolutionLayer(std::shared_ptr<MemoryPlanner> memory_planner = nullptr, ConvolutionMethodTuner *tuner = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionLayer(const NEConvolutionLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEConvolutionLayer &operator=(const NEConvolutionLayer &) = delete;
     /** Set the input and output tensors.
      *
-     * @param[in]  input     Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
-     *                       while every optional dimension from 4 and above represent a batch of inputs.
-     *                       Data types supported: F32.
-     * @param[in]  weights   Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM, OFM]. Data type supported: Same as @p input.
-     * @param[in]  biases    Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input.
-     * @param[out] output    Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the rest represent batch of outputs.
-     *                       Data types supported: Same as @p input.
-     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  input          Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                            while the optional 4th dimension represents a batch of inputs, which are all processed by a single run().
+     *                            Data types supported: U8/F16/F32. U8 tensors are asymmetric quantized tensors: the quantization settings of @p input,
+     *                            @p weights and @p output must be set (see @ref TensorInfo::quantization_info()).
+     *                            F32 inputs can also be NHWC tensors [IFM, width, height, batches]: @p weights and @p output must then be NHWC too.
+     *                            They can also be NCHW4 tensors [4 * width, height, ceil(IFM / 4), batches]: @p output must then be NCHW4 and @p weights NCHW.
+     * @param[in]  weights        Weights tensor. Weights are 4D tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     *                            NHWC weights have dimensions [IFM, kernel_x, kernel_y, OFM].
+     *                            Unless the convolution is direct, the weights are marked as unused once they have been reshaped (see @ref ITensor::is_used()).
+     * @param[in]  biases         Biases tensor. Shared biases supported. Biases are 1D tensor with dimensions [OFM]. Data type supported: Same as @p input,
+     *                            S32 for U8 inputs: the quantized biases have an offset of 0 and the product of the input and weights scales as scale.
+     * @param[out] output         Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the 4th dimension represents the batch of outputs.
+     *                            NHWC outputs have dimensions [OFM, width, height, batches]. Data types supported: Same as @p input.
+     * @param[in]  conv_info      Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info       (Optional) Activation function applied to the output while it is stored. Disabled by default.
+     *                            Only RELU and BOUNDED_RELU are supported for U8 inputs.
+     * @param[in]  num_groups     (Optional) Number of groups of a grouped convolution: the input and output feature maps are split in @p num_groups
+     *                            consecutive groups, and each group of output feature maps only depends on its group of input feature maps. Defaults to 1.
+     *                            NHWC and NCHW4 convolutions can't be grouped.
+     * @param[in]  space_to_depth (Optional) Rewrite an ungrouped convolution with the same stride s > 1 along X and Y and a square kernel larger than s
+     *                            as a convolution with a stride of 1 and a kernel of ceil(kernel / s) over s * s times more input feature maps (See @ref NESpaceToDepthKernel).
+     *                            It gives the large-stride first layers of a network (e.g. 11x11 with a stride of 4 over 3 channels) denser operands. Defaults to false.
+     *                            Ignored for NHWC and NCHW4 convolutions.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1, bool space_to_depth = false);
+    /** Set the input and output tensors of a convolution followed by a batch normalization of its output.
+     *
+     * The batch normalization is folded into the weights and biases the first time the function is run (See @ref NEBatchNormalizationFoldKernel),
+     * and then costs nothing: the folded weights go through the same reshaping as the original ones.
+     *
+     * @param[in]  input          Source tensor. 3 lower dimensions represent a single input [width, height, IFM],
+     *                            while the optional 4th dimension represents a batch of inputs. Data types supported: F32.
+     * @param[in]  weights        Weights tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     *                            The weights are marked as unused once they have been folded (see @ref ITensor::is_used()).
+     * @param[in]  biases         Biases tensor with dimensions [OFM]. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output         Destination tensor. 3 lower dimensions represent a single output [width, height, OFM], while the 4th dimension represents the batch of outputs.
+     *                            Data types supported: Same as @p input.
+     * @param[in]  conv_info      Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  bn_mean        Mean values of the batch normalization with dimensions [OFM]. Data types supported: Same as @p input.
+     * @param[in]  bn_var         Variance values of the batch normalization with dimensions [OFM]. Data types supported: Same as @p input.
+     * @param[in]  bn_beta        Beta values of the batch normalization with dimensions [OFM]. Data types supported: Same as @p input.
+     * @param[in]  bn_gamma       Gamma values of the batch normalization with dimensions [OFM]. Data types supported: Same as @p input.
+     * @param[in]  bn_epsilon     Small value of the batch normalization to avoid division with zero.
+     * @param[in]  act_info       (Optional) Activation function applied to the output of the batch normalization while it is stored. Disabled by default.
+     * @param[in]  num_groups     (Optional) Number of groups of a grouped convolution. Defaults to 1.
+     * @param[in]  space_to_depth (Optional) Rewrite a strided convolution as a convolution with a stride of 1, applied to the folded weights. Defaults to false.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                   const ITensor *bn_mean, const ITensor *bn_var, const ITensor *bn_beta, const ITensor *bn_gamma, float bn_epsilon,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), unsigned int num_groups = 1, bool space_to_depth = false);
+    /** Write the weights reshaped for the matrix multiplication to a binary stream, reshaping them first if the function has not been run yet.
+     *
+     * @note The weights must have been filled. Nothing is written if the convolution doesn't reshape its weights (direct convolution).
+     *
+     * @param[out] stream Binary output stream.
+     */
+    void export_reshaped_weights(std::ostream &stream);
+    /** Load the weights reshaped for the matrix multiplication from a binary stream written by @ref export_reshaped_weights.
+     *
+     * If the reshaped weights are loaded, the first call to @ref run() doesn't reshape the weights.
+     *
+     * @param[in] stream Binary input stream.
+     *
+     * @return True if the reshaped weights were loaded (or if there is nothing to load), false if the stream doesn't match the shape and data type of the reshaped weights.
+     */
+    bool import_reshaped_weights(std::istream &stream);
+    /** Add the weights reshaped for the matrix multiplication to the tensors of a model file, reshaping them first if the function has not been run yet.
+     *
+     * The reshaped weights are named @p name followed by the name of their layout: they are only imported by a layer reshaping its weights the same way.
+     *
+     * @note The weights must have been filled. Nothing is added if the convolution doesn't reshape its weights (direct convolution).
+     *
+     * @param[in]     name    Name of the reshaped weights in the model file.
+     * @param[in,out] tensors Names and tensors to write to the model file (See @ref ModelFile::save()).
+     */
+    void export_reshaped_weights(const std::string &name, std::vector<std::pair<std::string, const ITensor *>> &tensors);
+    /** Import the weights reshaped for the matrix multiplication from a model file, without copying them if they don't need padding (See @ref ModelFile).
+     *
+     * If the reshaped weights are imported, the first call to @ref run() doesn't reshape the weights and doesn't read the original weights.
+     *
+     * @note Must be called before the first run, instead of @ref use_shared_weights. The biases must still be filled: they are read as they are.
+     *
+     * @param[in] model Model file written with the tensors added by @ref export_reshaped_weights. It must outlive the function.
+     * @param[in] name  Name of the reshaped weights passed to @ref export_reshaped_weights.
+     *
+     * @return True if the reshaped weights were imported (or if the convolution doesn't reshape its weights), false if the model doesn't contain
+     *         reshaped weights in the layout, shape and data type of this layer, in which case this layer reshapes its own weights on the first run.
+     */
+    bool import_reshaped_weights(const ModelFile &model, const std::string &name);
+    /** Get a handle on the weights reshaped for the matrix multiplication, reshaping them first if the function has not been run yet.
+     *
+     * Other convolution layers configured with the same weights, e.g. for other input resolutions or other streams, can read them through
+     * @ref use_shared_weights: only their activations and intermediate buffers are then duplicated. The reshaped weights don't depend on the shape of the input.
+     *
+     * @note The weights must have been filled.
+     *
+     * @return A handle on the reshaped weights, empty if the convolution doesn't reshape its weights (direct convolution).
+     */
+    SharedWeights shared_weights();
+    /** Read weights reshaped by another convolution layer configured with the same weights (See @ref shared_weights), without reshaping or copying them.
+     *
+     * @note The biases must still be filled: they are read as they are.
+     *
+     * @param[in] weights Handle on the reshaped weights of a convolution layer configured with the same weights, biases and batch normalization.
+     *
+     * @return True if the reshaped weights are shared (or if the convolution doesn't reshape its weights), false if @p weights are not
+     *         in the layout of this layer, in which case this layer reshapes its own weights on the first run.
+     */
+    bool use_shared_weights(const SharedWeights &weights);
+    /** Read the reshaped weights of another convolution layer configured with the same weights, without reshaping or copying them.
+     *
+     * Same as use_shared_weights(source.shared_weights()): @p source can be destroyed first.
+     *
+     * @param[in, out] source Convolution layer configured with the same weights, biases and batch normalization.
+     *
+     * @return True if the reshaped weights are shared (or if the convolution doesn't reshape its weights), false if @p source doesn't
+     *         reshape its weights in the same layout, in which case this layer reshapes its own weights on the first run.
      */
-    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info);
+    bool share_reshaped_weights(NEConvolutionLayer &source);
 
     // Inherited methods overridden:
     void run() override;
+    /** Fold, rearrange and reshape the weights, unless the reshaped weights have been imported or shared */
+    void prepare() override;
+    MemoryFootprint memory_footprint() const override;
+    /** Only the NCHW convolutions running as a matrix multiplication of the im2col output can compute their output in bands of rows */
+    bool is_tileable() const override;
+    std::pair<unsigned int, unsigned int> input_rows(unsigned int first_row, unsigned int last_row) const override;
+    size_t tile_working_set(unsigned int num_rows) const override;
+    void prepare_tiles() override;
+    void run_tile(unsigned int first_row, unsigned int last_row) override;
 
 private:
+    /** Reshape the weights for the matrix multiplication */
+    void reshape_weights();
+    /** Release the intermediate reshaped or folded weights and mark the original weights as unused once the transposed weights are available */
+    void release_weights();
+    /** Name of the layout of the transposed weights, which depends on the algorithm and on the rewrites of the weights
+     *
+     * @return The layout of the weights shared by @ref shared_weights
+     */
+    std::string weights_layout() const;
+    /** Configure the convolution with the given algorithm.
+     *
+     * The parameters are the ones of configure(), tuning aside.
+     *
+     * @param[in]  input      Source tensor. Data types supported: U8/F16/F32.
+     * @param[in]  weights    Weights tensor with dimensions [kernel_x, kernel_y, IFM / num_groups, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases     Biases tensor. Can be nullptr. Data type supported: Same as @p input, S32 for U8 inputs.
+     * @param[out] output     Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info   Activation function applied to the output while it is stored.
+     * @param[in]  num_groups Number of groups of a grouped convolution.
+     * @param[in]  method     Algorithm to use. The heuristics select the algorithm if it is @ref ConvolutionMethod::DEFAULT or if it doesn't support the layer.
+     */
+    void configure_method(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                          unsigned int num_groups, ConvolutionMethod method);
+    /** Algorithm selected by the last call to configure_method()
+     *
+     * @return The algorithm the function runs, never @ref ConvolutionMethod::DEFAULT.
+     */
+    ConvolutionMethod selected_method() const;
+    /** Benchmark the algorithms supporting a layer on tensors of the same shapes and return the fastest one.
+     *
+     * @param[in] input      Source tensor.
+     * @param[in] weights    Weights tensor.
+     * @param[in] biases     Biases tensor. Can be nullptr.
+     * @param[in] output     Destination tensor.
+     * @param[in] conv_info  Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in] act_info   Activation function applied to the output while it is stored.
+     * @param[in] num_groups Number of groups of a grouped convolution.
+     *
+     * @return The fastest algorithm.
+     */
+    static ConvolutionMethod find_fastest_method(const ITensor *input, const ITensor *weights, const ITensor *biases, const ITensor *output, const PadStrideInfo &conv_info,
+                                                 const ActivationLayerInfo &act_info, unsigned int num_groups);
+    /** Configure the quantized matrix multiplication, which requantizes the products to the quantization settings of the output.
+     *
+     * @param[in]  input    Source tensor. Data types supported: U8.
+     * @param[in]  weights  Weights tensor. Data type supported: Same as @p input.
+     * @param[in]  biases   Biases tensor. Can be nullptr. Data type supported: S32.
+     * @param[out] output   Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  act_info Activation function applied to the output while it is stored.
+     */
+    void configure_quantized_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info);
+    /** Configure the kernels of a 3x3 convolution with a stride of 1 in the Winograd domain.
+     *
+     * @param[in]  input     Source tensor. Data types supported: F32.
+     * @param[in]  weights   Weights tensor with dimensions [3, 3, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  Activation function applied to the output while it is stored.
+     * @param[in]  num_tiles Number of 2x2 output tiles across all the batches.
+     */
+    void configure_winograd(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                            const ActivationLayerInfo &act_info, unsigned int num_tiles);
+    /** Configure the rearrangement of the input and weights of a strided convolution, and the convolution with a stride of 1 which runs on them.
+     *
+     * @param[in]  input     Source tensor. Data types supported: U8/F16/F32.
+     * @param[in]  weights   Weights tensor with dimensions [kernel, kernel, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: Same as @p input, S32 for U8 inputs.
+     * @param[out] output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo. The stride along X and Y must be the same.
+     * @param[in]  act_info  Activation function applied to the output while it is stored.
+     */
+    void configure_space_to_depth(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                  const ActivationLayerInfo &act_info);
+    /** Configure the blocking of the weights and the direct convolution of a channel-blocked input.
+     *
+     * @param[in]  input     Source tensor. NCHW4 tensor. Data types supported: F32.
+     * @param[in]  weights   Weights tensor with dimensions [kernel, kernel, IFM, OFM]. Data type supported: Same as @p input.
+     * @param[in]  biases    Biases tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output    Destination tensor. NCHW4 tensor. Data types supported: Same as @p input.
+     * @param[in]  conv_info Contains padding and stride information described in @ref PadStrideInfo.
+     * @param[in]  act_info  Activation function applied to the output while it is stored.
+     */
+    void configure_blocked(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                           const ActivationLayerInfo &act_info);
+
+    MemoryGroup                            _memory_group;
+    NEBatchNormalizationFoldKernel         _bn_fold_kernel;
+    NEBatchNormalizationFoldKernel         _bn_fold_biases_kernel;
+    NEDirectConvolutionLayerKernel         _direct_conv_kernel;
+    NEDirectConvolutionNCHW4Kernel         _blocked_conv_kernel;
+    NEBlockedLayoutKernel                  _weights_blocking_kernel;
+    NEGEMMBlockedMatrixMultiplyKernel      _pointwise_kernel;
     NEIm2ColKernel                         _input_im2col_kernel;
     NEGEMMInterleave4x4Kernel              _input_interleave_kernel;
     NEConvolutionLayerWeightsReshapeKernel _weights_reshape_kernel;
     NEGEMMTranspose1xWKernel               _weights_transposed_kernel;
     NEGEMMMatrixMultiplyKernel             _mm_kernel;
-    NECol2ImKernel                         _output_col2im_kernel;
+    NEGEMMLowpMatrixMultiplyKernel         _mm_lowp_kernel;
+    NEWinogradFilterTransformKernel        _winograd_filter_transform_kernel;
+    NEWinogradInputTransformKernel         _winograd_input_transform_kernel;
+    NEWinogradOutputTransformKernel        _winograd_output_transform_kernel;
+    NESpaceToDepthKernel                   _input_space_to_depth_kernel;
+    NESpaceToDepthKernel                   _weights_space_to_depth_kernel;
     Tensor                                 _input_im2col_reshaped;
     Tensor                                 _input_interleaved_reshaped;
     Tensor                                 _weights_reshaped;
     Tensor                                 _weights_transposed;
     Tensor                                 _gemm_output;
+    Tensor                                 _folded_weights;
+    Tensor                                 _folded_biases;
+    Tensor                                 _input_space_to_depth;
+    Tensor                                 _weights_space_to_depth;
+    Tensor                                 _weights_blocked;
+    const ITensor                         *_original_weights;
+    ConvolutionMethodTuner                *_tuner;
+    PadStrideInfo                          _conv_info;
+    unsigned int                           _kernel_height;
+    unsigned int                           _input_height;
+    unsigned int                           _output_width;
     bool                                   _is_first_run;
-    bool                                   _has_bias;
+    bool                                   _use_direct_convolution;
+    bool                                   _use_pointwise_convolution;
+    bool                                   _use_winograd;
+    bool                                   _is_quantized;
+    bool                                   _fold_batch_norm;
+    bool                                   _use_space_to_depth;
+    bool                                   _is_nhwc;
+    bool                                   _is_blocked;
 };
 }
 #endif /* __ARM_COMPUTE_NECONVOLUTIONLAYER_H__ */
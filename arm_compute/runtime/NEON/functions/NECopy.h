@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECOPY_H__
+#define __ARM_COMPUTE_NECOPY_H__
+
+#include "arm_compute/core/NEON/kernels/NECopyKernel.h"
+#include "arm_compute/core/NEON/kernels/NEDepthConvertKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to copy a tensor to a tensor of the same shape, whatever their paddings and strides, converting the data type if they differ.
+ *
+ * Depending on the tensors, the function runs:
+ *
+ * -# A single memcpy() of the whole tensor if the two tensors have the same data type and neither has padding or gaps between its dimensions.
+ * -# @ref NECopyKernel if they have the same data type: the rows are copied by all the threads of the scheduler.
+ * -# @ref NEDepthConvertKernel if they have different data types.
+ *
+ * The padding of the tensors is checked by each run, so the single memcpy() is used as soon as both tensors are unpadded,
+ * e.g. to copy the input of a network into the tensor of the network and its output out.
+ */
+class NECopy : public IFunction
+{
+public:
+    /** Default constructor */
+    NECopy();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECopy(const NECopy &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NECopy &operator=(const NECopy &) = delete;
+    /** Initialise the function's source and destination
+     *
+     * Valid conversions Input -> Output are the ones of @ref NEDepthConvertKernel, between integer data types (with @p policy) or from or to a floating point data type.
+     *
+     * @note A conversion processes 16 elements per iteration and may extend the padding of the tensors: configure the function before allocating them.
+     *       Without conversion, no padding is required.
+     *
+     * @param[in]  input  Source tensor. Data types supported: All if no conversion is needed.
+     * @param[out] output Destination tensor, of the same shape and number of channels as @p input.
+     * @param[in]  policy (Optional) Conversion policy between integer data types. Defaults to @ref ConvertPolicy::SATURATE.
+     */
+    void configure(const ITensor *input, ITensor *output, ConvertPolicy policy = ConvertPolicy::SATURATE);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    const ITensor       *_input;
+    ITensor             *_output;
+    NECopyKernel         _copy_kernel;
+    NEDepthConvertKernel _convert_kernel;
+    bool                 _is_conversion;
+};
+}
+#endif /*__ARM_COMPUTE_NECOPY_H__ */
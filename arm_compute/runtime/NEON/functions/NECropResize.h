@@ -0,0 +1,59 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NECROPRESIZE_H__
+#define __ARM_COMPUTE_NECROPRESIZE_H__
+
+#include "arm_compute/core/IArray.h"
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+namespace arm_compute
+{
+class ITensor;
+using IImage = ITensor;
+
+/** Basic function to crop detection windows out of an image and resize them into a batch in a single pass. This function calls the following NEON kernels:
+ *
+ * -# @ref NECropResizeKernel
+ *
+ * It replaces one @ref NEScale per window: the windows can change at every run without configuring anything again, e.g. to classify
+ * the detections of @ref NEHOGMultiDetection with a batched network.
+ */
+class NECropResize : public INESimpleFunction
+{
+public:
+    /** Set the input image, the windows and the output batch.
+     *
+     * @note Only the first windows->num_values() windows are resized at each run.
+     *
+     * @param[in]  input   Source image. Formats supported: U8, RGB888.
+     * @param[in]  windows Windows to crop. The windows are clamped to the image.
+     * @param[out] output  Destination tensor [width, height, channels, windows->max_num_values()] with 1 channel for U8 images and 3 planar channels for RGB888 images.
+     *                     Data types supported: F32.
+     * @param[in]  mean    (Optional) Value subtracted from each pixel. Defaults to 0.
+     * @param[in]  scale   (Optional) Factor applied to each pixel once the mean is subtracted. Defaults to 1.
+     */
+    void configure(const IImage *input, const IDetectionWindowArray *windows, ITensor *output, float mean = 0.f, float scale = 1.f);
+};
+}
+#endif /* __ARM_COMPUTE_NECROPRESIZE_H__ */
@@ -24,25 +24,17 @@
 #ifndef __ARM_COMPUTE_NEEQUALIZEHISTOGRAM_H__
 #define __ARM_COMPUTE_NEEQUALIZEHISTOGRAM_H__
 
-#include "arm_compute/core/NEON/kernels/NECumulativeDistributionKernel.h"
-#include "arm_compute/core/NEON/kernels/NEHistogramKernel.h"
-#include "arm_compute/core/NEON/kernels/NETableLookupKernel.h"
-#include "arm_compute/runtime/Distribution1D.h"
+#include "arm_compute/core/NEON/kernels/NEEqualizeHistogramKernel.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/Lut.h"
-
-#include <cstdint>
 
 namespace arm_compute
 {
 class ITensor;
 using IImage = ITensor;
 
-/** Basic function to execute histogram equalization. This function calls the following NEON kernels:
+/** Basic function to execute histogram equalization. This function calls the following NEON kernel:
  *
- * -# @ref NEHistogramKernel
- * -# @ref NECumulativeDistributionKernel
- * -# @ref NETableLookupKernel
+ * -# @ref NEEqualizeHistogramKernel (histogram, cumulative distribution and mapping in a single pass of the scheduler)
  *
  */
 class NEEqualizeHistogram : public IFunction
@@ -51,8 +43,6 @@ public:
     /** Default Constructor. */
     NEEqualizeHistogram();
     /** Initialise the kernel's inputs.
-     *
-     * @note Currently the width of the input image must be a multiple of 16.
      *
      * @param[in]  input  Input image. Data type supported: U8.
      * @param[out] output Output image. Data type supported: same as @p input
@@ -63,15 +53,7 @@ public:
     void run() override;
 
 private:
-    NEHistogramKernel              _histogram_kernel;        /**< Kernel that calculates the histogram of input. */
-    NECumulativeDistributionKernel _cd_histogram_kernel;     /**< Kernel that calculates the cumulative distribution
-                                                                  and creates the relevant LookupTable. */
-    NETableLookupKernel            _map_histogram_kernel;    /**< Kernel that maps the input to output using the lut. */
-    Distribution1D                 _hist;                    /**< Distribution that holds the histogram of the input image. */
-    Distribution1D                 _cum_dist;                /**< Distribution that holds the cummulative distribution of the input histogram. */
-    Lut                            _cd_lut;                  /**< Holds the equalization lookuptable. */
-    static constexpr uint32_t      nr_bins{ 256 };           /**< Histogram bins of the internal histograms. */
-    static constexpr uint32_t      max_range{ nr_bins - 1 }; /**< Histogram range of the internal histograms. */
+    NEEqualizeHistogramKernel _equalize_kernel; /**< Kernel that computes the histogram of the input and maps the input to the output with its cumulative distribution. */
 };
 }
 #endif /*__ARM_COMPUTE_NEEQUALIZEHISTOGRAM_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEERODE_H__
 #define __ARM_COMPUTE_NEERODE_H__
 
+#include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
@@ -36,7 +37,7 @@ class ITensor;
 /** Basic function to execute erode. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEErodeKernel
+ * -# @ref NEErodeKernel (3x3 structuring element) or @ref NEMorphologyKernel (Any other rectangular structuring element)
  *
  */
 class NEErode : public INESimpleFunction
@@ -50,6 +51,15 @@ public:
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
      */
     void configure(ITensor *input, ITensor *output, BorderMode border_mode, uint8_t constant_border_value);
+    /** Initialise the kernel's inputs, output, rectangular structuring element and border mode
+     *
+     * @param[in, out] input                 First tensor input. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
+     * @param[out]     output                Output tensor. Data type supported: U8.
+     * @param[in]      structuring_element   Size of the rectangular structuring element. Width and height must be odd.
+     * @param[in]      border_mode           Border mode to use for the convolution.
+     * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     */
+    void configure(ITensor *input, ITensor *output, const Size2D &structuring_element, BorderMode border_mode, uint8_t constant_border_value = 0);
 };
 }
 #endif /*__ARM_COMPUTE_NEERODE_H__ */
@@ -25,13 +25,9 @@
 #define __ARM_COMPUTE_NEFASTCORNERS_H__
 
 #include "arm_compute/core/NEON/kernels/NEFastCornersKernel.h"
-#include "arm_compute/core/NEON/kernels/NEFillArrayKernel.h"
-#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
-#include "arm_compute/core/NEON/kernels/NENonMaximaSuppression3x3Kernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 
@@ -40,11 +36,9 @@ namespace arm_compute
 class ITensor;
 using IImage = ITensor;
 
-/** Basic function to execute fast corners. This function call the following NEON kernels:
+/** Basic function to execute fast corners. This function calls the following NEON kernel:
  *
- * -# @ref NEFastCornersKernel
- * -# @ref NENonMaximaSuppression3x3Kernel (executed if nonmax_suppression == true)
- * -# @ref NEFillArrayKernel
+ * -# @ref NEFastCornersKernel (scores, non-maxima suppression if nonmax_suppression == true and output of the key points in a single pass)
  *
  */
 class NEFastCorners : public IFunction
@@ -68,13 +62,7 @@ public:
     void run() override;
 
 private:
-    NEFastCornersKernel             _fast_corners_kernel;
-    NEFillBorderKernel              _border_handler;
-    NENonMaximaSuppression3x3Kernel _nonmax_kernel;
-    NEFillArrayKernel               _fill_kernel;
-    Image                           _output;
-    Image                           _suppressed;
-    bool                            _non_max;
+    NEFastCornersKernel _fast_corners_kernel;
 };
 }
 #endif /*__ARM_COMPUTE_NEFASTCORNERS_H__ */
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFRAMEGRADIENTS_H__
+#define __ARM_COMPUTE_NEFRAMEGRADIENTS_H__
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <cstdint>
+#include <memory>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to compute the gradients of a frame once for all the functions which read them. This function calls one of the following NEON functions:
+ *
+ * -# @ref NEDerivative (if type == GradientType::DERIVATIVE)
+ * -# @ref NESobel3x3, @ref NESobel5x5 or @ref NESobel7x7 (if type == GradientType::SOBEL_3x3, SOBEL_5x5 or SOBEL_7x7)
+ * -# @ref NEScharr3x3 (if type == GradientType::SCHARR_3x3)
+ *
+ * The functions which can take pre-computed gradients instead of their input image (@ref NEHOGGradient, @ref NECannyEdge and @ref NEHarrisCorners)
+ * are configured with @ref gx() and @ref gy(), and the pass over the frame which each of them would do is done once by @ref run():
+ *
+ * @code
+ * NEFrameGradients gradients;
+ * gradients.configure(&frame, GradientType::SOBEL_3x3, BorderMode::REPLICATE);
+ * canny.configure(gradients.gx(), gradients.gy(), &edges, upper_thr, lower_thr, 3, 1, BorderMode::REPLICATE);
+ * harris.configure(gradients.gx(), gradients.gy(), threshold, min_dist, sensitivity, 3, 3, &corners, BorderMode::REPLICATE);
+ * gradients.allocate();
+ *
+ * // For each frame
+ * gradients.run();
+ * canny.run();
+ * harris.run();
+ * @endcode
+ *
+ * @note The functions reading the gradients must be configured with the same filter as the one passed to @ref configure() to get the same results as from the image.
+ */
+class NEFrameGradients : public IFunction
+{
+public:
+    /** Default constructor */
+    NEFrameGradients();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFrameGradients(const NEFrameGradients &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFrameGradients &operator=(const NEFrameGradients &) = delete;
+    /** Initialise the function's source, gradient type and border mode
+     *
+     * @param[in, out] input                 Source image. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
+     * @param[in]      type                  Filter computing the gradients.
+     * @param[in]      border_mode           Border mode to use for the filter.
+     * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     */
+    void configure(ITensor *input, GradientType type, BorderMode border_mode, uint8_t constant_border_value = 0);
+    /** Allocate the gradients
+     *
+     * @note Call it once all the functions reading the gradients are configured: they may extend the padding of the gradients.
+     */
+    void allocate();
+    /** Horizontal gradient of the last frame run
+     *
+     * @return The tensor of the gradient. Data type: S16, or S32 for @ref GradientType::SOBEL_7x7.
+     */
+    Tensor *gx();
+    /** Vertical gradient of the last frame run
+     *
+     * @return The tensor of the gradient. Data type: same as @ref gx().
+     */
+    Tensor *gy();
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    std::unique_ptr<IFunction> _filter;
+    Tensor                     _gx;
+    Tensor                     _gy;
+};
+}
+#endif /*__ARM_COMPUTE_NEFRAMEGRADIENTS_H__ */
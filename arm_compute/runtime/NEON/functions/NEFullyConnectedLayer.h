@@ -27,64 +27,184 @@
 #include "arm_compute/runtime/IFunction.h"
 
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
-#include "arm_compute/core/NEON/kernels/NEGEMMMatrixAccumulateBiasesKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMLowpMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMMatrixVectorMultiplyKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMSparseMatrixVectorMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 #include "arm_compute/core/NEON/kernels/NETransposeKernel.h"
+#include "arm_compute/runtime/BlockSparseMatrix.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/SharedWeights.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
 namespace arm_compute
 {
 /** Basic function to compute a Fully Connected layer on NEON. This function calls the following NEON kernels:
  *  -# @ref NEIm2ColKernel (called when the input comes from a convolutional layer)
  *  -# @ref NETransposeKernel (if @p transpose_weights flag is set to true) (called once)
- *  -# @ref NEGEMMTranspose1xWKernel (called once if we have a multi-batch input)
+ *  -# @ref NEGEMMTranspose1xWKernel (called once)
  *  -# @ref NEGEMMInterleave4x4Kernel (called if we have a multi-batch input)
- *  -# @ref NEGEMMMatrixMultiplyKernel
- *  -# @ref NEGEMMMatrixAccumulateBiasesKernel (if @p biases is not equal to nullptr)
+ *  -# @ref NEGEMMMatrixMultiplyKernel (if we have a multi-batch input) or @ref NEGEMMMatrixVectorMultiplyKernel
+ *
+ * The matrix multiplication adds the biases and applies the optional activation function while it stores the output.
+ * Quantized U8 layers always interleave their input and call @ref NEGEMMLowpMatrixMultiplyKernel instead of @ref NEGEMMMatrixMultiplyKernel.
+ * F32 layers without batches can also store their weights quantized in U8 with one scale per output: @ref NEGEMMMatrixVectorMultiplyKernel dequantizes
+ * them on the fly and reads 4 times less memory than with F32 weights.
+ * F32 layers without batches can also read pruned weights compressed in a @ref BlockSparseMatrix: @ref NEGEMMSparseMatrixVectorMultiplyKernel is then called
+ * instead of the matrix-vector multiplication and only the stored blocks of weights are read.
  *
  * @note  The fully connected layer accepts "weights" tensors only with 2 dimensions.
  */
 class NEFullyConnectedLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NEFullyConnectedLayer();
+    /** Constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner used to share the memory of the intermediate buffers with other functions.
+     */
+    NEFullyConnectedLayer(std::shared_ptr<MemoryPlanner> memory_planner = nullptr);
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFullyConnectedLayer(const NEFullyConnectedLayer &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEFullyConnectedLayer &operator=(const NEFullyConnectedLayer &) = delete;
     /** Set the input and output tensors.
      *
-     * @param[in]  input             Source tensor. Data type supported: F32.
-     * @param[in]  weights           Weights tensor. The weights must be 2 dimensional. Data type supported: Same as @p input.
-     * @param[in]  biases            Bias tensor. Can be nullptr. Data type supported:Same as @p input.
+     * @param[in]  input             Source tensor. Data type supported: U8/F16/F32. U8 tensors are asymmetric quantized tensors: the quantization settings
+     *                               of @p input, @p weights and @p output must be set (see @ref TensorInfo::quantization_info()).
+     * @param[in]  weights           Weights tensor. The weights must be 2 dimensional. Data type supported: Same as @p input, U8 for an F32 input without batches:
+     *                               U8 weights of an F32 input are dequantized as scale * (value - offset), with the offset of their quantization settings.
+     *                               If they are transposed or reshaped, they are marked as unused once they have been reshaped (see @ref ITensor::is_used()).
+     * @param[in]  biases            Bias tensor. Can be nullptr. Data type supported:Same as @p input, S32 for U8 inputs:
+     *                               the quantized biases have an offset of 0 and the product of the input and weights scales as scale.
      * @param[out] output            Destination tensor. Data type supported: Same as @p input.
      * @param[in]  transpose_weights (Optional) Transpose weights if true. Defaults to true.
+     * @param[in]  act_info          (Optional) Activation function applied to the output. Disabled by default.
+     *                               Only RELU and BOUNDED_RELU are supported for U8 inputs.
+     * @param[in]  weights_scales    (Optional) Scales of the U8 weights of an F32 input, one per output: 1D tensor with dimensions [num_outputs].
+     *                               Required for U8 weights of an F32 input, must be nullptr otherwise. Data type supported: F32.
+     */
+    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights = true,
+                   const ActivationLayerInfo &act_info = ActivationLayerInfo(), const ITensor *weights_scales = nullptr);
+    /** Set the input and output tensors of a layer whose pruned weights are compressed in a block sparse format.
+     *
+     * @note The sparse weights are read as they are: they must not be destroyed or compressed again while the function is used.
+     *
+     * @param[in]  input    Source tensor without batches. Data type supported: F32.
+     * @param[in]  weights  Compressed weights of the layer (See @ref BlockSparseMatrix::compress()).
+     * @param[in]  biases   Bias tensor. Can be nullptr. Data type supported: Same as @p input.
+     * @param[out] output   Destination tensor. Data type supported: Same as @p input.
+     * @param[in]  act_info (Optional) Activation function applied to the output. Disabled by default.
+     */
+    void configure(const ITensor *input, const BlockSparseMatrix *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info = ActivationLayerInfo());
+    /** Write the weights reshaped for the matrix multiplication to a binary stream, reshaping them first if the function has not been run yet.
+     *
+     * @note The weights must have been filled.
+     *
+     * @param[out] stream Binary output stream.
+     */
+    void export_reshaped_weights(std::ostream &stream);
+    /** Load the weights reshaped for the matrix multiplication from a binary stream written by @ref export_reshaped_weights.
+     *
+     * If the reshaped weights are loaded, the first call to @ref run() doesn't reshape the weights.
+     *
+     * @param[in] stream Binary input stream.
+     *
+     * @return True if the reshaped weights were loaded, false if the stream doesn't match the shape and data type of the reshaped weights.
+     */
+    bool import_reshaped_weights(std::istream &stream);
+    /** Add the weights reshaped for the matrix multiplication to the tensors of a model file, reshaping them first if the function has not been run yet.
+     *
+     * The reshaped weights are named @p name followed by the name of their layout: they are only imported by a layer reshaping its weights the same way.
+     *
+     * @note The weights must have been filled.
+     *
+     * @param[in]     name    Name of the reshaped weights in the model file.
+     * @param[in,out] tensors Names and tensors to write to the model file (See @ref ModelFile::save()).
+     */
+    void export_reshaped_weights(const std::string &name, std::vector<std::pair<std::string, const ITensor *>> &tensors);
+    /** Import the weights reshaped for the matrix multiplication from a model file, without copying them if they don't need padding (See @ref ModelFile).
+     *
+     * If the reshaped weights are imported, the first call to @ref run() doesn't reshape the weights and doesn't read the original weights.
+     *
+     * @note Must be called before the first run, instead of @ref use_shared_weights.
+     *
+     * @param[in] model Model file written with the tensors added by @ref export_reshaped_weights. It must outlive the function.
+     * @param[in] name  Name of the reshaped weights passed to @ref export_reshaped_weights.
+     *
+     * @return True if the reshaped weights were imported, false if the model doesn't contain reshaped weights in the shape and data type of this layer,
+     *         in which case this layer reshapes its own weights on the first run.
+     */
+    bool import_reshaped_weights(const ModelFile &model, const std::string &name);
+    /** Get a handle on the weights reshaped for the matrix multiplication, reshaping them first if the function has not been run yet.
+     *
+     * Other fully connected layers configured with the same weights, e.g. for other streams, can read them through @ref use_shared_weights:
+     * only their activations and intermediate buffers are then duplicated. The reshaped weights are the same with and without batches.
+     *
+     * @note The weights must have been filled.
+     *
+     * @return A handle on the reshaped weights
+     */
+    SharedWeights shared_weights();
+    /** Read weights reshaped by another fully connected layer configured with the same weights (See @ref shared_weights), without reshaping or copying them.
+     *
+     * @param[in] weights Handle on the reshaped weights of a fully connected layer configured with the same weights.
+     *
+     * @return True if the reshaped weights are shared, false if @p weights don't have the shape and data type of the reshaped weights of this layer,
+     *         in which case this layer reshapes its own weights on the first run.
      */
-    void configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights = true);
+    bool use_shared_weights(const SharedWeights &weights);
 
     //Inherited methods override
     void run() override;
+    /** Transpose and reshape the weights, unless the reshaped weights have been imported or shared */
+    void prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
-    void configure_fc_fc_wb(const ITensor *input, const ITensor *weights, ITensor *output);
-    void configure_fc_fc_nb(const ITensor *input, const ITensor *weights, ITensor *output);
-    void configure_conv_fc_wb(const ITensor *input, const ITensor *weights, ITensor *output);
-    void configure_conv_fc_nb(const ITensor *input, const ITensor *weights, ITensor *output);
+    /** Reshape the weights for the matrix multiplication */
+    void reshape_weights();
+    /** Release the intermediate reshaped weights and mark the original weights as unused once the reshaped weights are available */
+    void release_weights();
+    void configure_fc_fc_wb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info);
+    void configure_fc_fc_nb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                            const ITensor *weights_scales);
+    void configure_conv_fc_wb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info);
+    void configure_conv_fc_nb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                              const ITensor *weights_scales);
+    void configure_matrix_vector(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                                 const ITensor *weights_scales);
+    void configure_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info);
 
-    NEIm2ColKernel                     _im2col_kernel;
-    NETransposeKernel                  _transpose_kernel;
-    NEGEMMTranspose1xWKernel           _transpose1xW_kernel;
-    NEGEMMInterleave4x4Kernel          _interleave4x4_kernel;
-    NEGEMMMatrixMultiplyKernel         _mm_kernel;
-    NEGEMMMatrixAccumulateBiasesKernel _accumulate_biases_kernel;
-    Tensor                             _im2col_output;
-    Tensor                             _interleave4x4_output;
-    Tensor                             _transpose_output;
-    Tensor                             _transpose1xW_output;
-    bool                               _is_first_run;
-    bool                               _transpose_weights;
-    bool                               _fc_after_conv;
-    bool                               _batched_fc_layer;
-    bool                               _accumulate_biases;
+    MemoryGroup                            _memory_group;
+    NEIm2ColKernel                         _im2col_kernel;
+    NETransposeKernel                      _transpose_kernel;
+    NEGEMMTranspose1xWKernel               _transpose1xW_kernel;
+    NEGEMMInterleave4x4Kernel              _interleave4x4_kernel;
+    NEGEMMMatrixMultiplyKernel             _mm_kernel;
+    NEGEMMMatrixVectorMultiplyKernel       _mv_kernel;
+    NEGEMMSparseMatrixVectorMultiplyKernel _sparse_mv_kernel;
+    NEGEMMLowpMatrixMultiplyKernel         _mm_lowp_kernel;
+    Tensor                                 _im2col_output;
+    Tensor                                 _interleave4x4_output;
+    Tensor                                 _transpose_output;
+    Tensor                                 _transpose1xW_output;
+    const ITensor                         *_original_weights;
+    bool                                   _is_first_run;
+    bool                                   _transpose_weights;
+    bool                                   _fc_after_conv;
+    bool                                   _batched_fc_layer;
+    bool                                   _is_quantized;
+    bool                                   _is_sparse;
 };
 }
 #endif /* __ARM_COMPUTE_NEFULLYCONNECTEDLAYER_H__ */
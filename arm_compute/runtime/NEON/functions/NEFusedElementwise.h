@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEFUSEDELEMENTWISE_H__
+#define __ARM_COMPUTE_NEFUSEDELEMENTWISE_H__
+
+#include "arm_compute/core/NEON/kernels/NEFusedElementwiseKernel.h"
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include <vector>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to run @ref NEFusedElementwiseKernel
+ *
+ * @note Replaces a chain of @ref NEArithmeticAddition, @ref NEPixelWiseMultiplication (With a scale of 1) and @ref NEActivationLayer
+ *       on F32 tensors by a single pass over memory, e.g. a residual connection followed by a rectifier:
+ *
+ * @code{.cpp}
+ * fused.configure(&input, { FusedElementwiseStep(ElementwiseOperation::ADD, &shortcut), FusedElementwiseStep(ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU)) }, &output);
+ * @endcode
+ */
+class NEFusedElementwise : public INESimpleFunction
+{
+public:
+    /** Initialise the kernel's input, steps and output.
+     *
+     * @param[in]  input  Source tensor. Data types supported: F32.
+     * @param[in]  steps  Steps of the expression, applied in order. The operands must have the same shape and data type as @p input.
+     * @param[out] output Destination tensor. Data types supported: same as @p input. Can be @p input or one of the operands.
+     */
+    void configure(const ITensor *input, const std::vector<FusedElementwiseStep> &steps, ITensor *output);
+};
+}
+#endif /* __ARM_COMPUTE_NEFUSEDELEMENTWISE_H__ */
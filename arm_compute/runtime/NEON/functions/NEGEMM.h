@@ -25,10 +25,13 @@
 #define __ARM_COMPUTE_NEGEMM_H__
 
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMBlockedMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixAdditionKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMSmallMatrixMultiplyKernel.h"
 #include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/Tensor.h"
 
@@ -37,42 +40,68 @@ namespace arm_compute
 /** Basic function to execute GEMM on NEON. This function calls the following NEON kernels:
  *
  *  -# @ref NEGEMMInterleave4x4Kernel (if the output tensor is a matrix)
- *  -# @ref NEGEMMTranspose1xWKernel (if the output tensor is a matrix)
+ *  -# @ref NEGEMMTranspose1xWKernel (if the output tensor is a matrix, only the first time the function is run if B is constant)
  *  -# @ref NEGEMMMatrixMultiplyKernel
- *  -# @ref NEGEMMMatrixAdditionKernel (if c != nullptr and beta != 0.0)
+ *  -# @ref NEGEMMMatrixAdditionKernel (if c != nullptr and beta != 0.0, and the output tensor is a vector or the @ref GEMMBackend::BLOCKED backend is used)
  *
+ * When the matrices are reshaped, beta * C is added by @ref NEGEMMMatrixMultiplyKernel while the output block is still in registers.
+ *
+ * With the @ref GEMMBackend::BLOCKED backend, the reshaping and the matrix multiplication of two matrices are replaced by @ref NEGEMMBlockedMatrixMultiplyKernel.
+ * With the @ref GEMMBackend::SMALL backend, or the @ref GEMMBackend::AUTO backend if the multiplication is small, they are replaced by @ref NEGEMMSmallMatrixMultiplyKernel.
  */
 class NEGEMM : public IFunction
 {
 public:
     /** Constructor */
     NEGEMM();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMM(const NEGEMM &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEGEMM &operator=(const NEGEMM &) = delete;
     /** Initialise the kernel's inputs, output
      *
      * @note GEMM: General Matrix Multiply - [alpha * A * B + beta * C].
      * @note GEMM: The tensors a, b, c, d must have the same data type. All are either F32 or F16. You should not mix data types when calling this function.
      *
-     * @param[in]  a     First input tensor  (Matrix A or Vector A). Data type supported: F32, F16.
-     * @param[in]  b     Second input tensor (Matrix B). Data type supported: same as @p a
-     * @param[in]  c     Third input tensor  (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
-     * @param[out] d     Output tensor. Data type supported: same as @p a
-     * @param[in]  alpha Weight of the matrix product
-     * @param[in]  beta  Weight of matrix C
+     * @param[in]  a       First input tensor  (Matrix A or Vector A). Data type supported: F32, F16.
+     * @param[in]  b       Second input tensor (Matrix B). Data type supported: same as @p a
+     * @param[in]  c       Third input tensor  (Matrix C). It can be a nullptr if just the multiplication between @p a and @p b is needed. Data type supported: same as @p a
+     *                     Except with @ref GEMMBackend::BLOCKED or if @p d is a vector, C can also be a row vector (e.g. biases) which is added to each row of the output.
+     * @param[out] d       Output tensor. Data type supported: same as @p a
+     * @param[in]  alpha   Weight of the matrix product
+     * @param[in]  beta    Weight of matrix C
+     * @param[in]  backend    (Optional) Implementation of the matrix multiplication. @ref GEMMBackend::BLOCKED and @ref GEMMBackend::SMALL only support F32 matrices without batches:
+     *                        the other products fall back to @ref GEMMBackend::INTERLEAVED. Defaults to @ref GEMMBackend::AUTO.
+     * @param[in]  constant_b (Optional) Set to true if the content of @p b doesn't change between the calls to @ref run() (e.g. weights):
+     *                        @ref NEGEMMTranspose1xWKernel then only runs the first time the function is run and @p b is marked as unused afterwards (see @ref ITensor::is_used()).
+     *                        Ignored by @ref GEMMBackend::BLOCKED and @ref GEMMBackend::SMALL, which read @p b directly. Defaults to false.
+     * @param[in]  thresholds (Optional) Sizes under which @ref GEMMBackend::AUTO multiplies the matrices without reshaping them. Can be tuned for the target CPU.
      */
-    void configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta);
+    void configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta, GEMMBackend backend = GEMMBackend::AUTO, bool constant_b = false,
+                   const GEMMSmallThresholds &thresholds = GEMMSmallThresholds());
 
     // Inherited methods overridden:
     void run() override;
+    /** Transpose a constant matrix B (See @p constant_b in configure()) */
+    void prepare() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
-    NEGEMMInterleave4x4Kernel  _interleave_kernel;
-    NEGEMMTranspose1xWKernel   _transpose_kernel;
-    NEGEMMMatrixMultiplyKernel _mm_kernel;
-    NEGEMMMatrixAdditionKernel _ma_kernel;
-    Tensor                     _tmp_a;
-    Tensor                     _tmp_b;
-    bool                       _run_vector_matrix_multiplication;
-    bool                       _run_addition;
+    NEGEMMInterleave4x4Kernel         _interleave_kernel;
+    NEGEMMTranspose1xWKernel          _transpose_kernel;
+    NEGEMMMatrixMultiplyKernel        _mm_kernel;
+    NEGEMMBlockedMatrixMultiplyKernel _blocked_mm_kernel;
+    NEGEMMSmallMatrixMultiplyKernel   _small_mm_kernel;
+    NEGEMMMatrixAdditionKernel        _ma_kernel;
+    Tensor                            _tmp_a;
+    Tensor                            _tmp_b;
+    const ITensor                    *_original_b;
+    bool                              _is_b_constant;
+    bool                              _is_first_run;
+    bool                              _run_vector_matrix_multiplication;
+    bool                              _run_blocked_multiplication;
+    bool                              _run_small_multiplication;
+    bool                              _run_addition;
 };
 }
 #endif /*__ARM_COMPUTE_NEGEMM_H__ */
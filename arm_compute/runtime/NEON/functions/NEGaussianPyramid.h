@@ -76,8 +76,7 @@ protected:
 /** Basic function to execute gaussian pyramid with HALF scale factor. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NEGaussianPyramidHorKernel
- * -# @ref NEGaussianPyramidVertKernel
+ * -# @ref NEGaussianPyramidHalfKernel
  *
  */
 class NEGaussianPyramidHalf : public NEGaussianPyramid
@@ -92,8 +91,7 @@ public:
 
 private:
     std::unique_ptr<NEFillBorderKernel[]>          _border_handler;
-    std::unique_ptr<NEGaussianPyramidHorKernel[]>  _horizontal_reduction;
-    std::unique_ptr<NEGaussianPyramidVertKernel[]> _vertical_reduction;
+    std::unique_ptr<NEGaussianPyramidHalfKernel[]> _reduction;
 };
 
 /** Basic function to execute gaussian pyramid with ORB scale factor. This function calls the following NEON kernels and functions:
@@ -24,9 +24,9 @@
 #ifndef __ARM_COMPUTE_NEHOGDESCRIPTOR_H__
 #define __ARM_COMPUTE_NEHOGDESCRIPTOR_H__
 
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEHOGDescriptorKernel.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEHOGGradient.h"
 #include "arm_compute/runtime/Tensor.h"
 
 namespace arm_compute
@@ -34,10 +34,11 @@ namespace arm_compute
 class IHOG;
 /** Basic function to calculate HOG descriptor. This function calls the following NEON kernels:
  *
- * -# @ref NEHOGGradient
- * -# @ref NEHOGOrientationBinningKernel
+ * -# @ref NEFillBorderKernel
+ * -# @ref NEHOGGradientOrientationBinningKernel
  * -# @ref NEHOGBlockNormalizationKernel
  *
+ * @note The gradient is computed and voted into the histograms of the cells in a single pass, so no full size magnitude or phase tensor is allocated.
  */
 class NEHOGDescriptor : public IFunction
 {
@@ -59,12 +60,10 @@ public:
     void run() override;
 
 private:
-    NEHOGGradient                 _gradient;
-    NEHOGOrientationBinningKernel _orient_bin;
-    NEHOGBlockNormalizationKernel _block_norm;
-    Tensor                        _mag;
-    Tensor                        _phase;
-    Tensor                        _hog_space;
+    NEFillBorderKernel                    _border_handler;
+    NEHOGGradientOrientationBinningKernel _orient_bin;
+    NEHOGBlockNormalizationKernel         _block_norm;
+    Tensor                                _hog_space;
 };
 }
 
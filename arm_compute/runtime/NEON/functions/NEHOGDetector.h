@@ -25,6 +25,7 @@
 #define __ARM_COMPUTE_NEHOGDETECTOR_H__
 
 #include "arm_compute/core/IHOG.h"
+#include "arm_compute/core/IMultiHOG.h"
 #include "arm_compute/core/NEON/kernels/NEHOGDetectorKernel.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
@@ -49,6 +50,19 @@ public:
      * @param[in]  idx_class               (Optional) Index of the class used for evaluating which class the detection window belongs to
      */
     void configure(const ITensor *input, const IHOG *hog, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride, float threshold = 0.0f, size_t idx_class = 0);
+    /** Initialise the kernel to evaluate several HOG models sharing the same descriptor layout in a single pass
+     *
+     * @param[in]  input                   Input tensor. It is the output of @ref NEHOGDescriptor. Data type supported: F32
+     * @param[in]  multi_hog               Container of the HOG data-objects that describe the HOG descriptors
+     * @param[in]  first_model             Index of the first model to evaluate. It is also the index of the class of its detection windows
+     * @param[in]  num_models              Number of consecutive models to evaluate, at most @ref NEHOGDetectorKernel::max_models
+     * @param[out] detection_windows       Array of @ref DetectionWindow used to store the detected objects
+     * @param[in]  detection_window_stride Distance in pixels between 2 consecutive detection windows in x and y directions.
+     *                                     It must be multiple of the block stride of the models
+     * @param[in]  threshold               (Optional) Threshold for the distance between features and SVM classifying plane
+     */
+    void configure(const ITensor *input, const IMultiHOG *multi_hog, size_t first_model, size_t num_models, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride,
+                   float threshold = 0.0f);
 };
 }
 
@@ -56,8 +56,24 @@ public:
      * @param[in]      phase_type            Type of @ref PhaseType
      * @param[in]      border_mode           Border mode to use
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      approximation         (Optional) Precision of the magnitude and the phase: ACCURATE or FAST.
+     *                                       The orientation binning interpolates between the bins, so it needs the angles rather than the bins.
      */
-    void configure(ITensor *input, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type, BorderMode border_mode, uint8_t constant_border_value = 0);
+    void configure(ITensor *input, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type, BorderMode border_mode, uint8_t constant_border_value = 0,
+                   MagnitudePhaseApproximation approximation = MagnitudePhaseApproximation::ACCURATE);
+    /** Initialise the function's gradients, destinations and phase type
+     *
+     * The derivative is not computed: @p gx and @p gy are the gradients of the image shared with other functions (See @ref NEFrameGradients).
+     *
+     * @param[in]  gx               Horizontal gradient computed with @ref GradientType::DERIVATIVE. Data type supported: S16.
+     * @param[in]  gy               Vertical gradient computed with @ref GradientType::DERIVATIVE. Data type supported: S16.
+     * @param[out] output_magnitude Output tensor (magnitude). Data type supported: S16.
+     * @param[out] output_phase     Output tensor.(phase). Format supported: U8
+     * @param[in]  phase_type       Type of @ref PhaseType
+     * @param[in]  approximation    (Optional) Precision of the magnitude and the phase: ACCURATE or FAST.
+     */
+    void configure(const ITensor *gx, const ITensor *gy, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type,
+                   MagnitudePhaseApproximation approximation = MagnitudePhaseApproximation::ACCURATE);
 
     // Inherited method overridden:
     void run() override;
@@ -67,6 +83,7 @@ private:
     std::unique_ptr<INEKernel> _mag_phase;
     Tensor                     _gx;
     Tensor                     _gy;
+    bool                       _computes_derivatives;
 };
 }
 #endif /*__ARM_COMPUTE_NEHOGGRADIENT_H__ */
@@ -26,21 +26,25 @@
 
 #include "arm_compute/core/IArray.h"
 #include "arm_compute/core/IMultiHOG.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEHOGDescriptorKernel.h"
 #include "arm_compute/core/NEON/kernels/NEHOGNonMaximaSuppressionKernel.h"
+#include "arm_compute/core/NEON/kernels/NEHOGSpaceScaleKernel.h"
 #include "arm_compute/runtime/IFunction.h"
 #include "arm_compute/runtime/NEON/functions/NEHOGDetector.h"
-#include "arm_compute/runtime/NEON/functions/NEHOGGradient.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <vector>
+
 namespace arm_compute
 {
 /** Basic function to detect multiple objects (or the same object at different scales) on the same input image using HOG. This function calls the following NEON kernels:
  *
- * -# @ref NEHOGGradient
- * -# @ref NEHOGOrientationBinningKernel
+ * -# @ref NEFillBorderKernel
+ * -# @ref NEHOGGradientOrientationBinningKernel (One per distinct cell size and number of bins, each one computes the gradient of the cells it bins)
+ * -# @ref NEHOGSpaceScaleKernel (One per HOG space and coarser scale, executed if num_scales > 1)
  * -# @ref NEHOGBlockNormalizationKernel
- * -# @ref NEHOGDetector
+ * -# @ref NEHOGDetector (One per group of consecutive models sharing the normalized HOG space, detection window size and stride)
  * -# @ref NEHOGNonMaximaSuppressionKernel (executed if non_maxima_suppression == true)
  *
  * @note This implementation works if all the HOG data-objects within the IMultiHOG container have the same:
@@ -48,6 +52,10 @@ namespace arm_compute
          -# Normalization type
          -# L2 hysteresis threshold if the normalization type is L2HYS_NORM
  *
+ * @note With num_scales > 1 the models are also evaluated on the input image downscaled by scale_factor, scale_factor^2, ...
+ *       The image itself is never resized: the HOG spaces of the coarser scales are approximated from the ones of the full resolution image
+ *       (See @ref NEHOGSpaceScaleKernel), so the gradient and orientation binning cost does not grow with the number of scales.
+ *       The detection windows found at the coarser scales are scaled back to the coordinates of the input image.
  */
 class NEHOGMultiDetection : public IFunction
 {
@@ -75,30 +83,33 @@ public:
      * @param[in]      non_maxima_suppression   (Optional) Flag to specify whether the non-maxima suppression is required or not.
      *                                          True if the non-maxima suppression stage has to be computed
      * @param[in]      min_distance             (Optional) Radial Euclidean distance to use for the non-maxima suppression stage
+     * @param[in]      num_scales               (Optional) Number of scales to scan, including the full resolution one. The coarser scales at which
+     *                                          the image would be smaller than a detection window are skipped
+     * @param[in]      scale_factor             (Optional) Downscaling factor between two consecutive scales. Must be greater than 1 if @p num_scales > 1
      *
      */
     void configure(ITensor *input, const IMultiHOG *multi_hog, IDetectionWindowArray *detection_windows, const ISize2DArray *detection_window_strides, BorderMode border_mode,
                    uint8_t constant_border_value = 0,
-                   float threshold = 0.0f, bool non_maxima_suppression = false, float min_distance = 1.0f);
+                   float threshold = 0.0f, bool non_maxima_suppression = false, float min_distance = 1.0f, size_t num_scales = 1, float scale_factor = 1.2f);
 
     // Inherited method overridden:
     void run() override;
 
 private:
-    NEHOGGradient                                    _gradient_kernel;
-    std::unique_ptr<NEHOGOrientationBinningKernel[]> _orient_bin_kernel;
-    std::unique_ptr<NEHOGBlockNormalizationKernel[]> _block_norm_kernel;
-    std::unique_ptr<NEHOGDetector[]>                 _hog_detect_kernel;
-    std::unique_ptr<NEHOGNonMaximaSuppressionKernel> _non_maxima_kernel;
-    std::unique_ptr<Tensor[]>                        _hog_space;
-    std::unique_ptr<Tensor[]>                        _hog_norm_space;
-    IDetectionWindowArray                           *_detection_windows;
-    Tensor                                           _mag;
-    Tensor                                           _phase;
-    bool                                             _non_maxima_suppression;
-    size_t                                           _num_orient_bin_kernel;
-    size_t                                           _num_block_norm_kernel;
-    size_t                                           _num_hog_detect_kernel;
+    NEFillBorderKernel                                       _border_handler;
+    std::unique_ptr<NEHOGGradientOrientationBinningKernel[]> _orient_bin_kernel;
+    std::unique_ptr<NEHOGSpaceScaleKernel[]>                 _hog_space_scale_kernel;
+    std::unique_ptr<NEHOGBlockNormalizationKernel[]>         _block_norm_kernel;
+    std::unique_ptr<NEHOGDetector[]>                         _hog_detect_kernel;
+    std::unique_ptr<NEHOGNonMaximaSuppressionKernel>         _non_maxima_kernel;
+    std::unique_ptr<Tensor[]>                                _hog_space;      /**< HOG spaces of all the scales, _num_orient_bin_kernel per scale */
+    std::unique_ptr<Tensor[]>                                _hog_norm_space; /**< Normalized HOG spaces of all the scales, _num_block_norm_kernel per scale */
+    std::vector<float>                                       _scales;         /**< Downscaling factor of each scale, 1 for the full resolution one */
+    IDetectionWindowArray                                   *_detection_windows;
+    bool                                                     _non_maxima_suppression;
+    size_t                                                   _num_orient_bin_kernel;
+    size_t                                                   _num_block_norm_kernel;
+    size_t                                                   _num_hog_detect_kernel;
 };
 }
 
@@ -24,18 +24,17 @@
 #ifndef __ARM_COMPUTE_NEHARRISCORNERS_H__
 #define __ARM_COMPUTE_NEHARRISCORNERS_H__
 
-#include "arm_compute/core/CPP/kernels/CPPCornerCandidatesKernel.h"
-#include "arm_compute/core/CPP/kernels/CPPSortEuclideanDistanceKernel.h"
+#include "arm_compute/core/CPP/kernels/CPPCornerGridSuppressionKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NEHarrisCornersKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NENonMaximaSuppression3x3.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace arm_compute
 {
@@ -46,14 +45,11 @@ using IImage = ITensor;
  *
  * -# @ref NESobel3x3 (if gradient_size == 3) or<br/>
  *    @ref NESobel5x5 (if gradient_size == 5) or<br/>
- *    @ref NESobel7x7 (if gradient_size == 7)
+ *    @ref NESobel7x7 (if gradient_size == 7)<br/>
+ *    (not run if the function is configured with the gradients of the image)
  * -# @ref NEFillBorderKernel
- * -# NEHarrisScoreKernel<3> (if block_size == 3) or<br/>
- *    NEHarrisScoreKernel<5> (if block_size == 5) or<br/>
- *    NEHarrisScoreKernel<7> (if block_size == 7)
- * -# @ref NENonMaximaSuppression3x3
- * -# @ref CPPCornerCandidatesKernel
- * -# @ref CPPSortEuclideanDistanceKernel
+ * -# @ref NEHarrisCornerCandidatesKernel (Harris score, non-maxima suppression and corner candidates, tile by tile)
+ * -# @ref CPPCornerGridSuppressionKernel
  *
  */
 class NEHarrisCorners : public IFunction
@@ -61,7 +57,7 @@ class NEHarrisCorners : public IFunction
 public:
     /** Constructor
      *
-     * Initialize _sobel, _harris_score and _corner_list to nullptr.
+     * Initialize _sobel to nullptr.
      */
     NEHarrisCorners();
     /** Initialize the function's source, destination, conv and border_mode.
@@ -80,24 +76,59 @@ public:
     void configure(IImage *input, float threshold, float min_dist, float sensitivity,
                    int32_t gradient_size, int32_t block_size, KeyPointArray *corners,
                    BorderMode border_mode, uint8_t constant_border_value = 0, bool use_fp16 = false);
+    /** Initialize the function's gradients, destination, conv and border_mode.
+     *
+     * The Sobel filter is not run: @p gx and @p gy are the gradients of the image shared with other functions (See @ref NEFrameGradients).
+     *
+     * @note The gradients are allocated by their owner after this call, as their padding may be extended by it.
+     *
+     * @param[in, out] gx                    Horizontal gradient computed with the Sobel filter of size @p gradient_size. Data type supported: S16, or S32 if gradient_size == 7. (Its border is written to)
+     * @param[in, out] gy                    Vertical gradient computed with the Sobel filter of size @p gradient_size. Data type supported: same as @p gx. (Its border is written to)
+     * @param[in]      threshold             Minimum threshold with which to eliminate Harris Corner scores (computed using the normalized Sobel kernel).
+     * @param[in]      min_dist              Radial Euclidean distance for the euclidean diatance stage
+     * @param[in]      sensitivity           Sensitivity threshold k from the Harris-Stephens equation
+     * @param[in]      gradient_size         The gradient window size which @p gx and @p gy were computed with. The implementation supports 3, 5, and 7
+     * @param[in]      block_size            The block window size used to compute the Harris Corner score. The implementation supports 3, 5, and 7.
+     * @param[out]     corners               Array of keypoints to store the results.
+     * @param[in]      border_mode           Border mode to use
+     * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      use_fp16              (Optional) If true the FP16 kernels will be used. If false F32 kernels are used.
+     */
+    void configure(IImage *gx, IImage *gy, float threshold, float min_dist, float sensitivity,
+                   int32_t gradient_size, int32_t block_size, KeyPointArray *corners,
+                   BorderMode border_mode, uint8_t constant_border_value = 0, bool use_fp16 = false);
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    std::unique_ptr<IFunction>            _sobel;                 /**< Sobel function */
-    std::unique_ptr<INEHarrisScoreKernel> _harris_score;          /**< Harris score kernel */
-    NENonMaximaSuppression3x3             _non_max_suppr;         /**< Non-maxima suppression function */
-    CPPCornerCandidatesKernel             _candidates;            /**< Sort kernel */
-    CPPSortEuclideanDistanceKernel        _sort_euclidean;        /**< Euclidean distance kernel */
-    NEFillBorderKernel                    _border_gx;             /**< Border handler before running harris score */
-    NEFillBorderKernel                    _border_gy;             /**< Border handler before running harris score */
-    Image                                 _gx;                    /**< Source image - Gx component */
-    Image                                 _gy;                    /**< Source image - Gy component */
-    Image                                 _score;                 /**< Source image - Harris score */
-    Image                                 _nonmax;                /**< Source image - Non-Maxima suppressed image */
-    std::unique_ptr<InternalKeypoint[]>   _corners_list;          /**< Array of InternalKeypoint. It stores the potential corner candidates */
-    int32_t                               _num_corner_candidates; /**< Number of potential corner candidates */
+    /** Configure the Harris score, the non-maxima suppression and the grid suppression on the gradients
+     *
+     * @param[in, out] gx                    Horizontal gradient. (Its border is written to)
+     * @param[in, out] gy                    Vertical gradient. (Its border is written to)
+     * @param[in]      threshold             Minimum threshold with which to eliminate Harris Corner scores.
+     * @param[in]      min_dist              Radial Euclidean distance for the euclidean diatance stage
+     * @param[in]      sensitivity           Sensitivity threshold k from the Harris-Stephens equation
+     * @param[in]      gradient_size         The gradient window size which @p gx and @p gy were computed with.
+     * @param[in]      block_size            The block window size used to compute the Harris Corner score.
+     * @param[out]     corners               Array of keypoints to store the results.
+     * @param[in]      border_mode           Border mode to use
+     * @param[in]      constant_border_value Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      use_fp16              If true the FP16 kernels will be used. If false F32 kernels are used.
+     */
+    void configure_score(IImage *gx, IImage *gy, float threshold, float min_dist, float sensitivity,
+                         int32_t gradient_size, int32_t block_size, KeyPointArray *corners,
+                         BorderMode border_mode, uint8_t constant_border_value, bool use_fp16);
+
+    std::unique_ptr<IFunction>     _sobel;            /**< Sobel function (nullptr if configured with the gradients) */
+    NEHarrisCornerCandidatesKernel _candidates;       /**< Harris score, non-maxima suppression and corner candidates kernel */
+    CPPCornerGridSuppressionKernel _grid_suppression; /**< Euclidean distance kernel */
+    NEFillBorderKernel             _border_gx;        /**< Border handler before running harris score */
+    NEFillBorderKernel             _border_gy;        /**< Border handler before running harris score */
+    Image                          _gx;               /**< Source image - Gx component */
+    Image                          _gy;               /**< Source image - Gy component */
+    std::vector<InternalKeypoint>  _corners_list;     /**< Potential corner candidates */
+    bool                           _is_configured;    /**< True once the Harris score has been configured */
 };
 }
 #endif /*__ARM_COMPUTE_NEHARRISCORNERS_H__ */
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEIMAGETOTENSOR_H__
+#define __ARM_COMPUTE_NEIMAGETOTENSOR_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include <array>
+
+namespace arm_compute
+{
+class IMultiImage;
+class ITensor;
+
+/** Basic function to run @ref NEImageToTensorKernel to convert, resize and normalise a camera frame into the input tensor of a network in a single pass */
+class NEImageToTensor : public INESimpleFunction
+{
+public:
+    /** Initialize the function's source, destination, mean and scale
+     *
+     * @param[in]  input  The multi-planar input image. Formats supported: NV12/NV21/IYUV/YUV444
+     * @param[out] output The planar destination tensor of shape [width, height, 3]. Data type supported: F32
+     * @param[in]  mean   Value subtracted from the R, G and B channels.
+     * @param[in]  scale  (Optional) Scale applied to the channels once the mean is subtracted.
+     */
+    void configure(const IMultiImage *input, ITensor *output, const std::array<float, 3> &mean, float scale = 1.f);
+};
+}
+#endif /*__ARM_COMPUTE_NEIMAGETOTENSOR_H__ */
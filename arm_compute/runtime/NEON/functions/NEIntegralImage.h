@@ -24,22 +24,40 @@
 #ifndef __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 #define __ARM_COMPUTE_NEINTEGRALIMAGE_H__
 
-#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
+#include "arm_compute/runtime/IFunction.h"
 
 namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run a @ref NEIntegralImageKernel */
-class NEIntegralImage : public INESimpleFunction
+/** Basic function to compute the integral image. This function calls the following NEON kernels:
+ *
+ * -# @ref NEFillBorderKernel
+ * -# @ref NEIntegralImageHorKernel  (split along Y)
+ * -# @ref NEIntegralImageVertKernel (split along X)
+ *
+ */
+class NEIntegralImage : public IFunction
 {
 public:
+    /** Default constructor */
+    NEIntegralImage();
     /** Initialise the function's source, destinations and border mode.
         *
         * @param[in]  input  Source tensor. Data type supported: U8.
         * @param[out] output Destination tensor. Data type supported: U32.
         */
     void configure(const ITensor *input, ITensor *output);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEIntegralImageHorKernel  _kernel_hor;     /**< Kernel for the horizontal pass */
+    NEIntegralImageVertKernel _kernel_vert;    /**< Kernel for the vertical pass */
+    NEFillBorderKernel        _border_handler; /**< Kernel to set the top and left borders of the output to 0 */
 };
 }
 #endif /*__ARM_COMPUTE_NEINTEGRALIMAGE_H__ */
@@ -24,11 +24,10 @@
 #ifndef __ARM_COMPUTE_NELAPLACIANPYRAMID_H__
 #define __ARM_COMPUTE_NELAPLACIANPYRAMID_H__
 
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/NEON/kernels/NELaplacianPyramidKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvert.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
 #include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
 #include "arm_compute/runtime/Pyramid.h"
 
@@ -43,13 +42,15 @@ class ITensor;
 /** Basic function to execute laplacian pyramid. This function calls the following NEON kernels and functions:
  *
  * -# @ref NEGaussianPyramidHalf
- * -# @ref NEGaussian5x5
- * -# @ref NEArithmeticSubtraction
+ * -# @ref NEFillBorderKernel
+ * -# @ref NELaplacianPyramidKernel
  *
  *  First a Gaussian pyramid is created. Then, for each level i, the corresponding tensor I(i) is blurred with the Gaussian 5x5 filter, and then
  *  difference between the two tensors is the corresponding level L(i) of the Laplacian pyramid.
  *  L(i) = I(i) - Gaussian5x5(I(i))
  *  Level 0 has always the same first two dimensions as the input tensor.
+ *
+ *  The blur and the difference of each level are computed in a single pass by @ref NELaplacianPyramidKernel, which also writes the blurred last level to the output.
 */
 class NELaplacianPyramid : public IFunction
 {
@@ -73,13 +74,11 @@ public:
     void run() override;
 
 private:
-    size_t                                     _num_levels;
-    NEGaussianPyramidHalf                      _gaussian_pyr_function;
-    std::unique_ptr<NEGaussian5x5[]>           _convf;
-    std::unique_ptr<NEArithmeticSubtraction[]> _subf;
-    Pyramid                                    _gauss_pyr;
-    Pyramid                                    _conv_pyr;
-    NEDepthConvert                             _depth_function;
+    size_t                                      _num_levels;
+    NEGaussianPyramidHalf                       _gaussian_pyr_function;
+    std::unique_ptr<NEFillBorderKernel[]>       _border_handler;
+    std::unique_ptr<NELaplacianPyramidKernel[]> _laplacian_kernel;
+    Pyramid                                     _gauss_pyr;
 };
 }
 #endif /*__ARM_COMPUTE_NELAPLACIANPYRAMID_H__ */
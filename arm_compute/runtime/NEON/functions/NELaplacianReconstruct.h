@@ -24,11 +24,9 @@
 #ifndef __ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__
 #define __ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__
 
+#include "arm_compute/core/NEON/kernels/NELaplacianReconstructKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticAddition.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvert.h"
-#include "arm_compute/runtime/NEON/functions/NEScale.h"
 #include "arm_compute/runtime/Pyramid.h"
 
 #include <cstdint>
@@ -41,9 +39,7 @@ using IImage = ITensor;
 
 /** Basic function to execute laplacian reconstruction. This function calls the following NEON kernels and functions:
  *
- * -# @ref NEArithmeticAddition
- * -# @ref NEScale
- * -# @ref NEDepthConvert
+ * -# @ref NELaplacianReconstructKernel
  *
  * This function reconstructs the original image from a Laplacian Image Pyramid.
  *
@@ -56,6 +52,8 @@ using IImage = ITensor;
  *  I(i-1) = upsample(I(i) + L(i))
  *
  *  output = I(0) + L(0)
+ *
+ *  The upsampling and the addition of each level are computed in a single pass by @ref NELaplacianReconstructKernel, which writes level 0 straight to the U8 output.
 */
 class NELaplacianReconstruct : public IFunction
 {
@@ -72,7 +70,7 @@ public:
      * @param[in]  pyramid               Laplacian pyramid tensors, Data type supported at each level: S16.
      * @param[in]  input                 Source tensor. Data type supported: S16.
      * @param[out] output                Output tensor. Data type supported: U8.
-     * @param[in]  border_mode           Border mode to use for the convolution.
+     * @param[in]  border_mode           Border mode to use for the convolution. Unused: the nearest neighbour upsampling never reads outside of the images.
      * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
      *
      */
@@ -82,10 +80,8 @@ public:
     void run() override;
 
 private:
-    Pyramid                                 _tmp_pyr;
-    std::unique_ptr<NEArithmeticAddition[]> _addf;
-    std::unique_ptr<NEScale[]>              _scalef;
-    NEDepthConvert                          _depthf;
+    Pyramid                                         _tmp_pyr;
+    std::unique_ptr<NELaplacianReconstructKernel[]> _reconstruct_kernel;
 };
 }
 #endif /*__ARM_COMPUTE_NELAPLACIANRECONSTRUCT_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEMAGNITUDE_H__
 #define __ARM_COMPUTE_NEMAGNITUDE_H__
 
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
 namespace arm_compute
@@ -36,12 +37,13 @@ class NEMagnitude : public INESimpleFunction
 public:
     /** Initialise the kernel's inputs.
      *
-     * @param[in]  input1   First tensor input. Data type supported: S16.
-     * @param[in]  input2   Second tensor input. Data type supported: S16.
-     * @param[out] output   Output tensor. Data type supported: S16.
-     * @param[in]  use_fp16 (Optional) If true the FP16 kernels will be used. If false F32 kernels are used.
+     * @param[in]  input1        First tensor input. Data type supported: S16.
+     * @param[in]  input2        Second tensor input. Data type supported: S16.
+     * @param[out] output        Output tensor. Data type supported: S16.
+     * @param[in]  use_fp16      (Optional) If true the FP16 kernels will be used. If false F32 kernels are used.
+     * @param[in]  approximation (Optional) Precision of the square root of the F32 kernels: ACCURATE or FAST. Ignored if @p use_fp16 is true.
      */
-    void configure(const ITensor *input1, const ITensor *input2, ITensor *output, bool use_fp16 = false);
+    void configure(const ITensor *input1, const ITensor *input2, ITensor *output, bool use_fp16 = false, MagnitudePhaseApproximation approximation = MagnitudePhaseApproximation::ACCURATE);
 };
 }
 #endif /*__ARM_COMPUTE_NEMAGNITUDE_H__ */
@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEMEANSTDDEV_H__
 #define __ARM_COMPUTE_NEMEANSTDDEV_H__
 
+#include "arm_compute/core/IArray.h"
 #include "arm_compute/core/NEON/kernels/NEMeanStdDevKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/IFunction.h"
@@ -58,5 +59,45 @@ private:
     uint64_t           _global_sum;         /**< Variable that holds the global sum among calls in order to ease reduction */
     uint64_t           _global_sum_squared; /**< Variable that holds the global sum of squared values among calls in order to ease reduction */
 };
+
+/** Basic function to execute mean and std deviation on a batch of regions of interest. This function calls the following NEON kernels:
+ *
+ * @ref NEMeanStdDevROIKernel
+ *
+ * All the regions are computed in one parallel pass, instead of running @ref NEMeanStdDev on a sub-tensor per region.
+ */
+class NEMeanStdDevROI : public IFunction
+{
+public:
+    /** Default Constructor. */
+    NEMeanStdDevROI();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMeanStdDevROI(const NEMeanStdDevROI &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    NEMeanStdDevROI &operator=(const NEMeanStdDevROI &) = delete;
+    /** Allow instances of this class to be moved */
+    NEMeanStdDevROI(NEMeanStdDevROI &&) = default;
+    /** Allow instances of this class to be moved */
+    NEMeanStdDevROI &operator=(NEMeanStdDevROI &&) = default;
+    /** Initialise the kernel's inputs and outputs.
+     *
+     * @note The regions of interest can change between two runs, as long as there are at most as many as the max number of values of @p rois.
+     *
+     * @param[in]  input  Input image. Data type supported: U8.
+     * @param[in]  rois   Regions of interest of the input image. Each region must be inside the image and not empty.
+     * @param[out] mean   Output average pixel value of each region. Must be able to store as many values as @p rois.
+     * @param[out] stddev (Optional) Output standard deviation of the pixel values of each region. Must be able to store as many values as @p rois.
+     */
+    void configure(const IImage *input, const IRectangleArray *rois, IFloatArray *mean, IFloatArray *stddev = nullptr);
+
+    // Inherited methods overridden:
+    void run() override;
+
+private:
+    NEMeanStdDevROIKernel  _mean_stddev_kernel; /**< Kernel that computes the mean and standard deviation of each region. */
+    const IRectangleArray *_rois;               /**< Regions of interest */
+    IFloatArray           *_mean;               /**< Average of each region */
+    IFloatArray           *_stddev;             /**< Standard deviation of each region */
+};
 }
 #endif /*__ARM_COMPUTE_NEMEANSTDDEV_H__ */
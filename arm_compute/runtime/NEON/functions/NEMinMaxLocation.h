@@ -39,7 +39,7 @@ using IImage = ITensor;
 /** Basic function to execute min and max location. This function calls the following NEON kernels:
  *
  * -# NEMinMaxKernel
- * -# NEMinMaxLocationKernel
+ * -# NEMinMaxLocationKernel (Only if a location is requested, the counts are otherwise computed by NEMinMaxKernel)
  */
 class NEMinMaxLocation : public IFunction
 {
@@ -66,6 +66,7 @@ public:
 private:
     NEMinMaxKernel         _min_max;     /**< Kernel that performs min/max */
     NEMinMaxLocationKernel _min_max_loc; /**< Kernel that extracts min/max locations */
+    bool                   _run_loc;     /**< True if the locations are requested */
 };
 }
 #endif /*__ARM_COMPUTE_NEMINMAXLOCATION_H__ */
@@ -36,9 +36,10 @@ class ITensor;
 /** Basic function to execute non linear filter. This function calls the following NEON kernels:
  *
  * -# @ref NEFillBorderKernel (executed if border_mode == CONSTANT or border_mode == REPLICATE)
- * -# @ref NENonLinearFilterKernel
+ * -# @ref NENonLinearFilterKernel (executed if mask_size <= 5)
+ * -# @ref NENonLinearFilterHistogramKernel (executed if mask_size > 5)
  *
- * @note Supported mask dimensions squares of sizes 3, 5
+ * @note Supported mask dimensions squares of sizes 3, 5 for any pattern and odd sizes from 7 to 31 for MatrixPattern::BOX
  */
 class NENonLinearFilter : public INESimpleFunction
 {
@@ -48,7 +49,7 @@ public:
      * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
      * @param[out]     output                Destination tensor. Data type supported: U8
      * @param[in]      function              Non linear function to perform
-     * @param[in]      mask_size             Mask size. Supported sizes: 3, 5
+     * @param[in]      mask_size             Mask size. Supported sizes: 3, 5 and, for MatrixPattern::BOX only, odd sizes from 7 to 31
      * @param[in]      pattern               Mask pattern
      * @param[in]      mask                  The given mask. Will be used only if pattern is specified to PATTERN_OTHER
      * @param[in]      border_mode           Strategy to use for borders.
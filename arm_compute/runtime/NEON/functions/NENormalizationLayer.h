@@ -29,30 +29,38 @@
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NENormalizationLayerKernel.h"
 #include "arm_compute/core/NEON/kernels/NEPixelWiseMultiplicationKernel.h"
+#include "arm_compute/runtime/MemoryGroup.h"
 #include "arm_compute/runtime/Tensor.h"
 
 #include "arm_compute/core/Types.h"
 
+#include <memory>
+
 namespace arm_compute
 {
 class ITensor;
 
 /** Basic function to simulate a normalization layer. This function calls the following NEON kernels:
  *
- * -# @ref NEPixelWiseMultiplicationKernel
- * -# @ref NEFillBorderKernel
+ * -# @ref NEPixelWiseMultiplicationKernel (In map normalization only)
+ * -# @ref NEFillBorderKernel (In map normalization only)
  * -# @ref NENormalizationLayerKernel
  *
+ * @note The cross map normalization doesn't square the input into an intermediate buffer: @ref NENormalizationLayerKernel
+ *       updates the sum of the squares as it slides across the feature maps.
  */
 class NENormalizationLayer : public IFunction
 {
 public:
-    /** Default constructor */
-    NENormalizationLayer();
+    /** Default constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner used to share the memory of the intermediate buffers with other functions.
+     */
+    NENormalizationLayer(std::shared_ptr<MemoryPlanner> memory_planner = nullptr);
     /** Set the input and output tensors.
      *
      * @param[in]  input     Source tensor. 3 lower dims represent a single input with dimensions [width, height, IFM],
-     *                       and an optional 4th dimension for batch of inputs. Data type supported: F32. Number of channels must be 1.
+     *                       and an optional 4th dimension for batch of inputs. Data type supported: F16/F32. Number of channels must be 1.
      * @param[out] output    Destination with the same dimensions, data type and number of channels of  @p input
      * @param[in]  norm_info Normalization layer information like the normalization type, normalization size and other parameters.
      */
@@ -60,12 +68,15 @@ public:
 
     // Inherited methods overridden:
     void run() override;
+    MemoryFootprint memory_footprint() const override;
 
 private:
+    MemoryGroup                     _memory_group;    /**< Group of the intermediate buffers */
     NENormalizationLayerKernel      _norm_kernel;     /**< Normalization layer kernel */
     NEPixelWiseMultiplicationKernel _multiply_kernel; /**< Pixel multiplication kernel */
     NEFillBorderKernel              _border_handler;  /**< Kernel to handle  borders */
     Tensor                          _input_squared;   /**< The intermediate buffer which stores results of squaring input */
+    bool                            _is_cross_map;    /**< True if the normalization is performed across the feature maps */
 };
 }
 #endif /* __ARM_COMPUTE_NENORMALIZATIONLAYER_H__ */
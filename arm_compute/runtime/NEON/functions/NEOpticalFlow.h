@@ -25,12 +25,13 @@
 #define __ARM_COMPUTE_NEOPTICALFLOW_H__
 
 #include "arm_compute/core/IArray.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
-#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
+#include "arm_compute/runtime/Pyramid.h"
 
 #include <cstddef>
 #include <cstdint>
@@ -38,13 +39,16 @@
 
 namespace arm_compute
 {
-class Pyramid;
-
 using LKInternalKeypointArray = Array<NELKInternalKeypoint>;
 /** Basic function to execute optical flow. This function calls the following NEON kernels and functions:
  *
- * -# @ref NEScharr3x3
- * -# @ref NELKTrackerKernel
+ * -# @ref NEFillBorderKernel
+ * -# @ref NELKTrackerPyramidKernel (which runs one @ref NELKTrackerKernel per pyramid level)
+ *
+ * The scharr gradients of the old pyramid are computed by the tracker, only in the neighbourhood of the keypoints.
+ *
+ * When configured with a frame instead of two pyramids, the function also runs @ref NEGaussianPyramidHalf and owns a ring of two pyramids:
+ * each run builds the pyramid of the new frame only, and the pyramid of the previous frame is reused as the old pyramid.
  *
  */
 class NEOpticalFlow : public IFunction
@@ -75,21 +79,66 @@ public:
     void configure(const Pyramid *old_pyramid, const Pyramid *new_pyramid, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
                    IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
                    bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0);
+    /**  Initialise the function to track the keypoints from one frame to the next, building the pyramid of each frame only once
+     *
+     * Each run builds the pyramid of the current content of @p input and tracks the keypoints from the frame of the previous run.
+     * On the first run there is no previous frame: @p new_points is set to @p old_points (or @p new_points_estimates if @p use_initial_estimate is true).
+     *
+     * @param[in]  input                 The current frame. Data type supported U8
+     * @param[in]  num_levels            Number of levels of the half scale pyramids
+     * @param[in]  old_points            Pointer to the IKeyPointArray storing old key points
+     * @param[in]  new_points_estimates  Pointer to the IKeyPointArray storing new estimates key points
+     * @param[out] new_points            Pointer to the IKeyPointArray storing new key points
+     * @param[in]  termination           The criteria to terminate the search of each keypoint.
+     * @param[in]  epsilon               The error for terminating the algorithm
+     * @param[in]  num_iterations        The maximum number of iterations before terminate the alogrithm
+     * @param[in]  window_dimension      The size of the window on which to perform the algorithm
+     * @param[in]  use_initial_estimate  The flag to indicate whether the initial estimated position should be used
+     * @param[in]  border_mode           The border mode applied at the gaussian pyramid and scharr kernel stages
+     * @param[in]  constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT
+     *
+     */
+    void configure(const IImage *input, size_t num_levels, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                   IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                   bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value = 0);
+    /** Forget the previous frame: the next run only builds the pyramid of the frame (Only for the function configured with a frame) */
+    void reset();
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    std::unique_ptr<NEScharr3x3[]>       _func_scharr;
-    std::unique_ptr<NELKTrackerKernel[]> _kernel_tracker;
-    std::unique_ptr<Tensor[]>            _scharr_gx;
-    std::unique_ptr<Tensor[]>            _scharr_gy;
-    IKeyPointArray                      *_new_points;
-    const IKeyPointArray                *_new_points_estimates;
-    const IKeyPointArray                *_old_points;
-    LKInternalKeypointArray              _new_points_internal;
-    LKInternalKeypointArray              _old_points_internal;
-    unsigned int                         _num_levels;
+    /** Configure the border handlers and the trackers of all the levels to track from @p old_pyramid to @p new_pyramid
+     *
+     * @param[in] old_pyramid Pyramid of the old frame
+     * @param[in] new_pyramid Pyramid of the new frame
+     * @param[in] index       Index of the set of border handlers and trackers to configure
+     *
+     * The other parameters are the same as configure()'s.
+     */
+    void configure_levels(const Pyramid *old_pyramid, const Pyramid *new_pyramid, unsigned int index, Termination termination, float epsilon, unsigned int num_iterations,
+                          size_t window_dimension, bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value);
+    /** Run the set of border handlers and trackers of index @p index
+     *
+     * @param[in] index Index of the set of border handlers and trackers to run
+     */
+    void run_levels(unsigned int index);
+
+    std::unique_ptr<NEFillBorderKernel[]> _border_handler;            /**< Border handlers of the old pyramid, num_levels per set */
+    std::unique_ptr<NELKTrackerKernel[]>  _kernel_tracker;            /**< Trackers, num_levels per set */
+    NELKTrackerPyramidKernel              _kernel_pyramid_tracker[2]; /**< One set per old pyramid of the ring, only the first one is used when the pyramids are inputs */
+    NEGaussianPyramidHalf                 _pyramid_function[2];
+    Pyramid                               _pyramid[2]; /**< Ring of pyramids owned by the function configured with a frame */
+    IKeyPointArray                       *_new_points;
+    const IKeyPointArray                 *_new_points_estimates;
+    const IKeyPointArray                 *_old_points;
+    LKInternalKeypointArray               _new_points_internal;
+    LKInternalKeypointArray               _old_points_internal;
+    unsigned int                          _num_levels;
+    bool                                  _use_initial_estimate;
+    bool                                  _owns_pyramids;
+    unsigned int                          _new_index; /**< Index of the pyramid of the ring which stores the frame at the next run */
+    bool                                  _has_old_frame;
 };
 }
 #endif /*__ARM_COMPUTE_NEOPTICALFLOW_H__ */
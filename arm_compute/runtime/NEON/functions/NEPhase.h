@@ -24,6 +24,7 @@
 #ifndef __ARM_COMPUTE_NEPHASE_H__
 #define __ARM_COMPUTE_NEPHASE_H__
 
+#include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
 namespace arm_compute
@@ -36,11 +37,12 @@ class NEPhase : public INESimpleFunction
 public:
     /** Initialise the kernel's inputs, output.
      *
-     * @param[in]  input1 First tensor input. Data type supported: S16.
-     * @param[in]  input2 Second tensor input. Data type supported: S16.
-     * @param[out] output Output tensor. Data type supported: U8.
+     * @param[in]  input1        First tensor input. Data type supported: S16.
+     * @param[in]  input2        Second tensor input. Data type supported: S16.
+     * @param[out] output        Output tensor. Data type supported: U8.
+     * @param[in]  approximation (Optional) Precision of the atan2: ACCURATE or FAST.
      */
-    void configure(const ITensor *input1, const ITensor *input2, ITensor *output);
+    void configure(const ITensor *input1, const ITensor *input2, ITensor *output, MagnitudePhaseApproximation approximation = MagnitudePhaseApproximation::ACCURATE);
 };
 }
 #endif /*__ARM_COMPUTE_NEPHASE_H__ */
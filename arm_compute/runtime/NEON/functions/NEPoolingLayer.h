@@ -27,6 +27,7 @@
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
 #include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ITiledFunction.h"
 
 namespace arm_compute
 {
@@ -37,16 +38,34 @@ class ITensor;
  * -# @ref NEFillBorderKernel (executed if padding size is different from zero)
  * -# @ref NEPoolingLayerKernel
  */
-class NEPoolingLayer : public INESimpleFunction
+class NEPoolingLayer : public INESimpleFunction, public ITiledFunction
 {
 public:
+    /** Constructor */
+    NEPoolingLayer();
     /** Set the input and output tensors.
      *
-     * @param[in, out] input     Source tensor. (Written to only when padding != 0) Data types supported: F32.
+     * @param[in, out] input     Source tensor. (Written to only when padding != 0) 3 lower dimensions represent a single input [width, height, IFM],
+     *                           while the optional 4th dimension represents a batch of inputs. Data types supported: U8/F16/F32.
+     *                           U8 and F16 only support 2x2 and 3x3 pooling, F32 supports any pooling size as well as global pooling.
+     *                           F32 inputs can also be NHWC tensors [IFM, width, height, batches] or NCHW4 tensors (See @ref DataLayout),
+     *                           the pooling is then vectorized across the feature maps.
      * @param[out]     output    Destination tensor. Data types supported: Same as @p input.
      * @param[in]      pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
      */
     void configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info);
+
+    // Inherited methods overridden:
+    bool is_tileable() const override;
+    std::pair<unsigned int, unsigned int> input_rows(unsigned int first_row, unsigned int last_row) const override;
+    size_t tile_working_set(unsigned int num_rows) const override;
+    void prepare_tiles() override;
+    void run_tile(unsigned int first_row, unsigned int last_row) override;
+
+private:
+    PoolingLayerInfo _pool_info;
+    unsigned int     _input_height;
+    bool             _is_tileable;
 };
 }
 #endif /* __ARM_COMPUTE_NEPOOLINGLAYER_H__ */
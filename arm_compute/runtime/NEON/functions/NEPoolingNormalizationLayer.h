@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYER_H__
+#define __ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYER_H__
+
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ITiledFunction.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Basic function to simulate a max pooling layer followed by a cross map normalization layer, without storing the pooled tensor.
+ * This function calls the following NEON kernels:
+ *
+ * -# @ref NEFillBorderKernel (executed if padding size is different from zero)
+ * -# @ref NEPoolingNormalizationLayerKernel
+ */
+class NEPoolingNormalizationLayer : public INESimpleFunction, public ITiledFunction
+{
+public:
+    /** Constructor */
+    NEPoolingNormalizationLayer();
+    /** Set the input and output tensors.
+     *
+     * @param[in, out] input     Source tensor. (Written to only when padding != 0) 3 lower dimensions represent a single input [width, height, IFM],
+     *                           while the optional 4th dimension represents a batch of inputs. Data types supported: F32.
+     * @param[out]     output    Destination tensor. Data types supported: Same as @p input.
+     * @param[in]      pool_info Contains pooling operation information described in @ref PoolingLayerInfo.
+     *                           Only MAX pooling of size 2 or 3 with a horizontal stride of 1 or 2 is supported.
+     * @param[in]      norm_info Normalization layer information. Only @ref NormType::CROSS_MAP is supported.
+     */
+    void configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const NormalizationLayerInfo &norm_info);
+
+    // Inherited methods overridden:
+    bool is_tileable() const override;
+    std::pair<unsigned int, unsigned int> input_rows(unsigned int first_row, unsigned int last_row) const override;
+    size_t tile_working_set(unsigned int num_rows) const override;
+    void prepare_tiles() override;
+    void run_tile(unsigned int first_row, unsigned int last_row) override;
+
+private:
+    PoolingLayerInfo _pool_info;
+    unsigned int     _input_height;
+    bool             _is_tileable;
+};
+}
+#endif /* __ARM_COMPUTE_NEPOOLINGNORMALIZATIONLAYER_H__ */
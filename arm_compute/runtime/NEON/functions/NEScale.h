@@ -34,7 +34,7 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run @ref NEScaleKernel */
+/** Basic function to run @ref NEScaleKernel, or @ref NEScaleAreaKernel to downscale with @ref InterpolationPolicy::AREA */
 class NEScale : public INESimpleFunction
 {
 public:
@@ -45,11 +45,12 @@ public:
     NEScale();
     /** Initialize the function's source, destination, interpolation type and border_mode.
      *
-     * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
-     * @param[out]     output                Destination tensor. Data type supported: U8. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
+     * @param[in, out] input                 Source tensor. Data type supported: U8. Formats supported: RGB888, RGBA8888 with NEAREST_NEIGHBOR and BILINEAR interpolation.
+     *                                       (Written to only for @p border_mode != UNDEFINED)
+     * @param[out]     output                Destination tensor. Data type supported: U8. Formats supported: same as @p input. All but the lowest two dimensions must be the same size as in the input tensor, i.e. scaling is only performed within the XY-plane.
      * @param[in]      policy                The interpolation type.
      * @param[in]      border_mode           Strategy to use for borders.
-     * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT. Used for all the channels of multi-channel images.
      */
     void configure(ITensor *input, ITensor *output, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0);
 
@@ -24,10 +24,11 @@
 #ifndef __ARM_COMPUTE_NESOFTMAXLAYER_H__
 #define __ARM_COMPUTE_NESOFTMAXLAYER_H__
 
-#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NESoftmaxLayerKernel.h"
 #include "arm_compute/runtime/IFunction.h"
-#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+
+#include <memory>
 
 namespace arm_compute
 {
@@ -38,35 +39,36 @@ class ITensor;
  * Softmax is calculated by :
  * @f[ out = \frac{e^{x - max(x)}}{\sum{e^{x - max(x)}}} @f]
  *
- * This function runs the following kernels:
- * -# @ref NELogits1DMaxKernel
- * -# @ref NELogits1DShiftExpSumKernel
- * -# @ref NELogits1DNormKernel
+ * This function runs the following kernel:
+ * -# @ref NELogits1DSoftmaxKernel
+ *
+ * @note The max, the sum and the shifted exponentials of a row are computed in a single pass without any intermediate tensor or border fill.
  */
 class NESoftmaxLayer : public IFunction
 {
 public:
-    /** Constructor */
-    NESoftmaxLayer();
+    /** Constructor
+     *
+     * @param[in] memory_planner (Optional) Memory planner used to share the memory of the intermediate buffers with other functions.
+     *                           Unused: the softmax doesn't need any intermediate buffer.
+     */
+    NESoftmaxLayer(std::shared_ptr<MemoryPlanner> memory_planner = nullptr);
     /** Set the input and output tensors.
      *
-     * @param[in]  input  Source tensor. Data types supported: F32.
-     * @param[out] output Destination tensor. Data types supported: same as @p input.
+     * @param[in]  input     Source tensor. The softmax is computed along the 1st dimension,
+     *                       while every higher dimension represents a batch of inputs. Data types supported: F32.
+     * @param[out] output    Destination tensor. Data types supported: same as @p input.
+     * @param[in]  precision (Optional) Accuracy of the approximation of the exponential.
+     *                       @ref MathPrecision::FAST is enough for classification networks which only use the order of the outputs.
      */
-    void configure(ITensor *input, ITensor *output);
+    void configure(ITensor *input, ITensor *output, MathPrecision precision = MathPrecision::ACCURATE);
 
     // Inherited methods overridden:
     void run() override;
 
 private:
-    NELogits1DMaxKernel         _max_kernel;
-    NELogits1DShiftExpSumKernel _shift_exp_sum_kernel;
-    NELogits1DNormKernel        _norm_kernel;
-    NEFillBorderKernel          _fill_border_kernel;
-    NEFillBorderKernel          _fill_border_kernel_sum;
-    Tensor                      _max;
-    Tensor                      _sum;
-    Tensor                      _tmp;
+    MemoryGroup             _memory_group;
+    NELogits1DSoftmaxKernel _softmax_kernel;
 };
 }
 #endif /* __ARM_COMPUTE_NESOFTMAXLAYER_H__ */
@@ -26,6 +26,7 @@
 
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
+#include "arm_compute/runtime/Tensor.h"
 
 #include <cstdint>
 
@@ -33,10 +34,12 @@ namespace arm_compute
 {
 class ITensor;
 
-/** Basic function to run @ref NEWarpPerspectiveKernel */
+/** Basic function to run @ref NEWarpPerspectiveKernel or, if the coordinates are precomputed, @ref NERemapKernel */
 class NEWarpPerspective : public INESimpleFunction
 {
 public:
+    /** Constructor */
+    NEWarpPerspective();
     /** Initialize the function's source, destination, interpolation policy and border_mode.
      *
      * @param[in, out] input                 Source tensor. Data type supported: U8. (Written to only for @p border_mode != UNDEFINED)
@@ -45,8 +48,22 @@ public:
      * @param[in]      policy                The interpolation type.
      * @param[in]      border_mode           Strategy to use for borders.
      * @param[in]      constant_border_value (Optional) Constant value to use for borders if border_mode is set to CONSTANT.
+     * @param[in]      use_remap_table       (Optional) Map the output pixels to the input once here, into a fixed point remap table read at every run.
+     *                                       Worth it when the same warp is applied to many frames and the table (4 bytes per pixel, 6 with bilinear)
+     *                                       costs less memory traffic than recomputing the coordinates: typically for perspective warps.
+     *                                       The values of @p matrix are then only read during this call, and with @p border_mode UNDEFINED
+     *                                       the output pixels mapped outside of the input are written with @p constant_border_value.
+     * @param[in]      max_error             (Optional) Maximum distance in pixels between the source coordinates and the exact mapping: a positive value
+     *                                       approximates the mapping by an affine one on segments of the rows, which avoids the per pixel division
+     *                                       (See @ref NEWarpPerspectiveKernel::set_max_error()). 0 (default) computes the exact coordinates.
+     *                                       Ignored if @p use_remap_table is true.
      */
-    void configure(ITensor *input, ITensor *output, const float *matrix, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0);
+    void configure(ITensor *input, ITensor *output, const float *matrix, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value = 0, bool use_remap_table = false,
+                   float max_error = 0.f);
+
+private:
+    Tensor _offsets;   /**< Offset of the (top-left) source pixel of each output pixel in the input tensor */
+    Tensor _fractions; /**< Fixed point bilinear weights of each output pixel */
 };
 }
 #endif /*__ARM_COMPUTE_NEWARPPERSPECTIVE_H__ */
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_OMPSCHEDULER_H__
+#define __ARM_COMPUTE_OMPSCHEDULER_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+#include <cstddef>
+
+namespace arm_compute
+{
+/** Scheduler splitting a kernel's execution among the threads of the OpenMP runtime.
+ *
+ * @note The placement of the threads is controlled by the OpenMP runtime, e.g. through the OMP_PROC_BIND and OMP_PLACES environment variables.
+ */
+class OMPScheduler : public IScheduler
+{
+private:
+    /** Constructor. */
+    OMPScheduler();
+
+public:
+    /** Access the scheduler singleton
+     *
+     * @return The scheduler
+     */
+    static OMPScheduler &get();
+    /** Force the scheduler to use the specified number of threads.
+     *
+     * @param[in] num_threads If set to 0, then omp_get_max_threads() threads will be used, otherwise the number of threads specified.
+     */
+    void force_number_of_threads(int num_threads) override;
+    /** Returns the number of threads that the OMPScheduler uses to run the kernels.
+     *
+     * @return Number of threads available in OMPScheduler.
+     */
+    int num_threads() const override;
+    /** Multithread the execution of the passed kernel if possible.
+     *
+     * The kernel will run on a single thread if any of these conditions is true:
+     * - ICPPKernel::is_parallelisable() returns false
+     * - The scheduler has been initialized with only one thread.
+     *
+     * The window of a @ref SchedulingPolicy::DYNAMIC kernel is split in several sub-windows per thread which are distributed with schedule(dynamic).
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] split_dimension Dimension along which to split the kernel's execution window (By default 1/Y)
+     */
+    void multithread(ICPPKernel *kernel, size_t split_dimension = 1) override;
+    /** Multithread the execution of the passed kernel on a region of its window only.
+     *
+     * @param[in] kernel          Kernel to execute.
+     * @param[in] window          Region on which to execute the kernel. (Must be a region of the window returned by ICPPKernel::window(), aligned to its steps)
+     * @param[in] split_dimension Dimension along which to split @p window (By default 1/Y)
+     */
+    void multithread(ICPPKernel *kernel, const Window &window, size_t split_dimension = 1) override;
+
+private:
+    int _num_threads;
+};
+}
+#endif /* __ARM_COMPUTE_OMPSCHEDULER_H__ */
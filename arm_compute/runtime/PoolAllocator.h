@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_POOLALLOCATOR_H__
+#define __ARM_COMPUTE_POOLALLOCATOR_H__
+
+#include "arm_compute/runtime/IAllocator.h"
+
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+
+namespace arm_compute
+{
+/** Allocator which keeps the released blocks in a pool to reuse them for the following allocations.
+ *
+ * Blocks are requested from the system allocator with a size rounded up to a size class: 8 classes per power of 2, so that
+ * less than 12.5% of a block is wasted, and a tensor which is freed and allocated again with a similar size (e.g. when a network
+ * is re-configured) is served from the pool without any system call. The blocks are neither zeroed on allocation nor on release.
+ *
+ * The pool keeps the released blocks until @ref trim() or @ref clear() is called, or until it holds more than the limit set by
+ * @ref set_max_pooled_size().
+ *
+ * @note The methods of this class are thread-safe.
+ */
+class PoolAllocator : public IAllocator
+{
+public:
+    /** Default constructor */
+    PoolAllocator();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PoolAllocator(const PoolAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    PoolAllocator &operator=(const PoolAllocator &) = delete;
+    /** Destructor: return the pooled blocks to the system */
+    ~PoolAllocator();
+    /** Access the allocator singleton used by default by the tensors
+     *
+     * @return The allocator
+     */
+    static PoolAllocator &get();
+    /** Release all the blocks currently held in the pool to the system.
+     *
+     * @note The blocks in use are not affected.
+     */
+    void clear();
+    /** Release the largest blocks held in the pool to the system until the pool holds at most @p max_pooled_size bytes.
+     *
+     * @note The blocks in use are not affected.
+     *
+     * @param[in] max_pooled_size Size in bytes of the unused blocks to keep in the pool.
+     */
+    void trim(size_t max_pooled_size);
+    /** Set the largest size in bytes of the unused blocks the pool keeps: when a block is released, the pool is trimmed down to this size.
+     *
+     * @param[in] max_pooled_size Size in bytes of the unused blocks to keep in the pool. Unlimited by default.
+     */
+    void set_max_pooled_size(size_t max_pooled_size);
+    /** Total size in bytes of the blocks currently held in the pool
+     *
+     * @return The size in bytes of the unused blocks.
+     */
+    size_t pooled_size() const;
+
+    // Inherited methods overridden:
+    void *allocate(size_t size, size_t alignment) override;
+    void free(void *ptr) override;
+
+private:
+    /** Release the largest pooled blocks until the pool holds at most @p max_pooled_size bytes
+     *
+     * @note The mutex must be held by the caller.
+     *
+     * @param[in] max_pooled_size Size in bytes of the unused blocks to keep in the pool.
+     */
+    void trim_locked(size_t max_pooled_size);
+
+    /** Block of memory obtained from the system */
+    struct Block
+    {
+        void  *base;      /**< Pointer returned by the system allocator */
+        size_t size;      /**< Usable size in bytes of the block */
+        size_t alignment; /**< Alignment in bytes of the start of the block */
+    };
+
+    mutable std::mutex                _mtx;             /**< Mutex protecting the pools */
+    std::multimap<size_t, Block>      _free_blocks;     /**< Unused blocks sorted by size */
+    std::unordered_map<void *, Block> _used_blocks;     /**< Blocks in use indexed by their aligned pointer */
+    size_t                            _pooled_size;     /**< Total size in bytes of the unused blocks */
+    size_t                            _max_pooled_size; /**< Largest size in bytes of the unused blocks kept in the pool */
+};
+}
+#endif /* __ARM_COMPUTE_POOLALLOCATOR_H__ */
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_PROFILER_H__
+#define __ARM_COMPUTE_PROFILER_H__
+
+#include "arm_compute/core/Window.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace arm_compute
+{
+class IKernel;
+
+/** Interval of time in microseconds relative to the start of the profiling session */
+struct ProfilerInterval
+{
+    double start; /**< Start time */
+    double end;   /**< End time */
+};
+
+/** Hardware performance counters of one thread (See @ref Profiler::start). A counter the CPU or the kernel doesn't provide stays at 0. */
+struct ProfilerCounters
+{
+    uint64_t cycles;                  /**< CPU cycles */
+    uint64_t instructions;            /**< Retired instructions */
+    uint64_t l1d_misses;              /**< L1 data cache read misses */
+    uint64_t l2_misses;               /**< Last level cache read misses: the L2 cache on most Cortex-A clusters */
+    uint64_t stalled_cycles_frontend; /**< Cycles stalled waiting for instructions */
+    uint64_t stalled_cycles_backend;  /**< Cycles stalled waiting for data or execution resources */
+};
+
+/** Counters accumulated between two reads
+ *
+ * @param[in] end   Counters read at the end of the interval.
+ * @param[in] start Counters read at the start of the interval.
+ *
+ * @return The difference of @p end and @p start
+ */
+inline ProfilerCounters operator-(const ProfilerCounters &end, const ProfilerCounters &start)
+{
+    return ProfilerCounters{ end.cycles - start.cycles, end.instructions - start.instructions, end.l1d_misses - start.l1d_misses, end.l2_misses - start.l2_misses,
+                             end.stalled_cycles_frontend - start.stalled_cycles_frontend, end.stalled_cycles_backend - start.stalled_cycles_backend };
+}
+
+/** Execution record of one kernel */
+struct ProfilerEntry
+{
+    std::string                   kernel;      /**< Name of the kernel */
+    std::string                   layer;       /**< Layer active when the kernel was run (See @ref Profiler::set_layer) */
+    Window                        window;      /**< Execution window of the kernel */
+    ProfilerInterval              wall_time;   /**< Wall-clock time of the whole kernel as seen by the scheduler */
+    std::vector<ProfilerInterval> threads;     /**< Wall-clock time of each thread which ran a part of the kernel (CPU kernels only) */
+    double                        device_time; /**< Execution time in microseconds measured on the device with OpenCL events, negative if not available */
+    std::vector<ProfilerCounters> counters;    /**< Hardware counters of each thread, in the order of @ref threads. Empty if the counters are not read */
+};
+
+/** Records the execution of the kernels run by the schedulers.
+ *
+ * Profiling is disabled by default: the schedulers only check @ref is_enabled() before running each kernel.
+ * Once a session is started, every kernel run through @ref CPPScheduler, @ref OMPScheduler, @ref SingleThreadScheduler or
+ * @ref CLScheduler is recorded and the results can be dumped either as a per-layer report or as a Chrome trace
+ * (To be loaded in chrome://tracing).
+ *
+ * @note OpenCL device times require a command queue created with CL_QUEUE_PROFILING_ENABLE. While profiling, the
+ *       CLScheduler waits for each kernel to complete.
+ *
+ * On Linux the session can also read the hardware performance counters of each CPU thread with perf_event_open() (See @ref ProfilerCounters),
+ * which tells whether a kernel is bound by computations or by memory accesses. The counters only cover the user space of the threads
+ * and need /proc/sys/kernel/perf_event_paranoid to be 2 or lower.
+ */
+class Profiler
+{
+private:
+    /** Constructor */
+    Profiler();
+
+public:
+    /** Access the profiler singleton
+     *
+     * @return The profiler
+     */
+    static Profiler &get();
+    /** Clear the previous records and start recording the kernels' executions
+     *
+     * @param[in] read_counters (Optional) Also record the hardware performance counters of the threads running the CPU kernels. Defaults to false.
+     *                          Ignored if the counters are not available (See @ref counters_available()).
+     */
+    void start(bool read_counters = false);
+    /** Stop recording the kernels' executions */
+    void stop();
+    /** Returns true if a profiling session is running
+     *
+     * @return True if the kernels' executions are being recorded.
+     */
+    bool is_enabled() const
+    {
+        return _enabled.load(std::memory_order_relaxed);
+    }
+    /** Returns true if the hardware performance counters are recorded by the current session
+     *
+     * @return True if the schedulers must read the counters of their threads with @ref thread_counters().
+     */
+    bool reads_counters() const
+    {
+        return _read_counters.load(std::memory_order_relaxed);
+    }
+    /** Indicates whether the hardware performance counters can be read on this system
+     *
+     * @return True if perf_event_open() can count the cycles of the calling thread.
+     */
+    static bool counters_available();
+    /** Read the hardware performance counters of the calling thread
+     *
+     * The counters of each thread are opened the first time it reads them and count until the thread exits.
+     *
+     * @return The values of the counters since they were opened, to be subtracted from a later read
+     */
+    static ProfilerCounters thread_counters();
+    /** Name of the dynamic type of a kernel without its namespace
+     *
+     * @param[in] kernel Kernel to name.
+     *
+     * @return The name of the class of the kernel, e.g. "NEGEMMMatrixMultiplyKernel"
+     */
+    static std::string kernel_name(const IKernel &kernel);
+    /** Set the name of the layer the next kernels belong to
+     *
+     * @param[in] name Name of the layer. An empty name means the kernels don't belong to any layer.
+     */
+    void set_layer(std::string name);
+    /** Time elapsed since the start of the profiling session
+     *
+     * @return The time in microseconds.
+     */
+    double now() const;
+    /** Record the execution of a kernel
+     *
+     * @param[in] kernel      The kernel which has been run.
+     * @param[in] wall_time   Wall-clock time of the whole kernel as seen by the scheduler.
+     * @param[in] threads     (Optional) Wall-clock time of each thread which ran a part of the kernel.
+     * @param[in] device_time (Optional) Execution time in microseconds measured on the device, negative if not available.
+     * @param[in] counters    (Optional) Hardware counters of each thread, in the order of @p threads.
+     */
+    void add(const IKernel &kernel, const ProfilerInterval &wall_time, std::vector<ProfilerInterval> threads = {}, double device_time = -1.0, std::vector<ProfilerCounters> counters = {});
+    /** Records of the current (or last) profiling session
+     *
+     * @return The kernels' executions in the order they were run.
+     */
+    const std::vector<ProfilerEntry> &entries() const
+    {
+        return _entries;
+    }
+    /** Print the total, average and relative times of each kernel grouped by layer
+     *
+     * If the hardware counters were recorded, the instructions per cycle, the cache misses per thousand instructions and the share of stalled cycles
+     * of each kernel are printed as well.
+     *
+     * @param[out] os Stream to print the report to.
+     */
+    void print_report(std::ostream &os) const;
+    /** Print the records in the Chrome trace event format (JSON)
+     *
+     * Each thread which ran a part of a kernel is reported as a separate track, the OpenCL device times on their own track.
+     *
+     * @param[out] os Stream to print the trace to.
+     */
+    void print_chrome_trace(std::ostream &os) const;
+
+private:
+    std::atomic<bool>                     _enabled;       /**< Whether a profiling session is running */
+    std::atomic<bool>                     _read_counters; /**< Whether the session records the hardware counters */
+    std::chrono::steady_clock::time_point _origin;        /**< Start time of the profiling session */
+    std::string                           _layer;         /**< Name of the current layer */
+    std::vector<ProfilerEntry>            _entries;       /**< Records of the profiling session */
+    mutable std::mutex                    _mtx;           /**< Mutex protecting the records */
+};
+}
+#endif /* __ARM_COMPUTE_PROFILER_H__ */
@@ -54,7 +54,10 @@ public:
      */
     void init_auto_padding(const PyramidInfo &info);
 
-    /** Allocate the planes in the pyramid */
+    /** Allocate the planes in the pyramid
+     *
+     * @note All the levels are backed by a single allocation, each level starting on a cache line.
+     */
     void allocate();
 
     // Inherited method overridden
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_QUANTIZATIONCALIBRATOR_H__
+#define __ARM_COMPUTE_QUANTIZATIONCALIBRATOR_H__
+
+#include "arm_compute/core/Types.h"
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Derive the quantization info of a tensor from the range of the values it holds during floating point runs.
+ *
+ * Run the F32 network on a set of representative inputs, observe the tensor after each run and use the resulting
+ * quantization info for the corresponding U8 tensor of the quantized network.
+ *
+ * @note The range always includes 0 so that it is exactly representable (Required by the padding of the quantized layers).
+ */
+class QuantizationCalibrator
+{
+public:
+    /** Default constructor */
+    QuantizationCalibrator();
+    /** Update the range with the values held in the valid region of a tensor
+     *
+     * @param[in] tensor Tensor to observe. Data types supported: F32.
+     */
+    void observe(const ITensor &tensor);
+    /** Compute the quantization info mapping the observed range to [0, 255]
+     *
+     * @return The quantization info, empty if no value has been observed.
+     */
+    QuantizationInfo quantization_info() const;
+    /** Forget the values observed so far */
+    void reset();
+
+private:
+    float _min;
+    float _max;
+    bool  _has_values;
+};
+}
+#endif /* __ARM_COMPUTE_QUANTIZATIONCALIBRATOR_H__ */
@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_RUNHANDLE_H__
+#define __ARM_COMPUTE_RUNHANDLE_H__
+
+#include <future>
+
+namespace arm_compute
+{
+/** Handle on the completion of a run submitted with @ref IFunction::run_async() or @ref IScheduler::run_async()
+ *
+ * Copies of the handle refer to the same run.
+ */
+class RunHandle
+{
+public:
+    /** Default constructor: handle on a run which has already completed */
+    RunHandle();
+    /** Wrap the completion of a run
+     *
+     * @param[in] future Future which becomes ready once the run has completed, holding the exception raised by the run if any.
+     */
+    explicit RunHandle(std::shared_future<void> future);
+    /** Check whether the run has completed, without blocking
+     *
+     * @return True if the run has completed
+     */
+    bool is_ready() const;
+    /** Block until the run has completed
+     *
+     * @note The exception raised by the run, if any, is rethrown.
+     */
+    void wait() const;
+
+private:
+    std::shared_future<void> _future;
+};
+}
+#endif /* __ARM_COMPUTE_RUNHANDLE_H__ */
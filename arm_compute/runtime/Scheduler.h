@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SCHEDULER_H__
+#define __ARM_COMPUTE_SCHEDULER_H__
+
+#include "arm_compute/runtime/IScheduler.h"
+
+namespace arm_compute
+{
+/** Configurable scheduler which supports multiple multithreading APIs and choosing between different schedulers at runtime. */
+class Scheduler
+{
+public:
+    /** Available schedulers */
+    enum class Type
+    {
+        ST,  /**< Single thread. */
+        CPP, /**< C++11 threads. */
+        OMP  /**< OpenMP. */
+    };
+    /** Sets the user defined scheduler and makes it the active scheduler.
+     *
+     * @note The scheduler must have been built in the library (See the cppthreads and openmp build options).
+     *
+     * @param[in] t The type of the scheduler to be set.
+     */
+    static void set(Type t);
+    /** Access the scheduler singleton.
+     *
+     * @return The scheduler set for the calling thread by @ref set_thread_scheduler(), otherwise the scheduler which is currently active.
+     */
+    static IScheduler &get();
+    /** Sets the scheduler used by the functions run from the calling thread, instead of the active scheduler.
+     *
+     * Several application threads running different networks at the same time can each use their own scheduler instance
+     * (e.g. a @ref CPPScheduler pinned to a subset of the cores) so that they neither share nor wait for the same pool of threads.
+     *
+     * @param[in] scheduler Scheduler to use from the calling thread, nullptr to use the active scheduler again. It must outlive its use by the thread.
+     */
+    static void set_thread_scheduler(IScheduler *scheduler);
+    /** Returns the type of the active scheduler.
+     *
+     * @return The current scheduler's type.
+     */
+    static Type get_type();
+    /** Returns true if the given scheduler type is supported, false otherwise.
+     *
+     * @param[in] t The type of the scheduler to check.
+     *
+     * @return True if the given scheduler type is supported, false otherwise.
+     */
+    static bool is_available(Type t);
+
+private:
+    static Type _scheduler_type;
+    Scheduler();
+};
+
+/** Use a given scheduler from the calling thread during the lifetime of the object, see @ref Scheduler::set_thread_scheduler. */
+class ScopedThreadScheduler
+{
+public:
+    /** Set the scheduler of the calling thread
+     *
+     * @param[in] scheduler Scheduler used by the functions run from the calling thread until the object is destroyed.
+     */
+    explicit ScopedThreadScheduler(IScheduler &scheduler)
+    {
+        Scheduler::set_thread_scheduler(&scheduler);
+    }
+    /** Prevent instances of this class from being copied */
+    ScopedThreadScheduler(const ScopedThreadScheduler &) = delete;
+    /** Prevent instances of this class from being copied */
+    ScopedThreadScheduler &operator=(const ScopedThreadScheduler &) = delete;
+    /** Use the active scheduler again from the calling thread */
+    ~ScopedThreadScheduler()
+    {
+        Scheduler::set_thread_scheduler(nullptr);
+    }
+};
+}
+#endif /* __ARM_COMPUTE_SCHEDULER_H__ */
@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_SHAREDWEIGHTS_H__
+#define __ARM_COMPUTE_SHAREDWEIGHTS_H__
+
+#include <memory>
+#include <string>
+
+namespace arm_compute
+{
+class Tensor;
+
+/** Read-only handle on weights reshaped once by a function, which other functions configured with the same weights can read without reshaping or copying them.
+ *
+ * The handle and the functions reading the weights share the ownership of their memory: it is only released when the last of them is destroyed,
+ * so the function which reshaped the weights doesn't need to outlive the others. The functions never write to the weights once they are shared.
+ *
+ * Copying the handle doesn't copy the weights.
+ */
+class SharedWeights
+{
+public:
+    /** Default constructor: the handle doesn't hold any weights */
+    SharedWeights();
+    /** Share the memory of reshaped weights.
+     *
+     * @param[in] tensor Reshaped weights. Its memory must be allocated and must not be written afterwards.
+     * @param[in] layout Name of the layout of the reshaped weights, defined by the function which reshaped them.
+     */
+    SharedWeights(Tensor &tensor, std::string layout);
+    /** Check whether the handle holds weights
+     *
+     * @return True if the handle doesn't hold any weights
+     */
+    bool empty() const;
+    /** Name of the layout of the weights
+     *
+     * @return The layout passed to the constructor, empty if the handle doesn't hold any weights
+     */
+    const std::string &layout() const;
+    /** Make a tensor read the shared weights instead of its own memory.
+     *
+     * @param[in, out] tensor Tensor configured for the reshaped weights. Its memory is freed first if it was allocated.
+     * @param[in]      layout Name of the layout the reader of @p tensor expects the weights in.
+     *
+     * @return True if @p tensor reads the shared weights, false if the handle is empty or if its weights don't have the layout, data type, shape and strides of @p tensor,
+     *         in which case @p tensor is left unchanged.
+     */
+    bool import_to(Tensor &tensor, const std::string &layout) const;
+
+private:
+    std::shared_ptr<Tensor> _tensor;
+    std::string             _layout;
+};
+}
+#endif /* __ARM_COMPUTE_SHAREDWEIGHTS_H__ */
@@ -33,14 +33,27 @@
 namespace arm_compute
 {
 class Coordinates;
+class IAllocator;
+class MemoryPlanner;
 class TensorInfo;
 
-/** Basic implementation of a CPU memory tensor allocator. */
+/** Basic implementation of a CPU memory tensor allocator.
+ *
+ * The backing memory is requested from an @ref IAllocator, by default the @ref PoolAllocator singleton.
+ */
 class TensorAllocator : public ITensorAllocator
 {
 public:
     /** Default constructor. */
     TensorAllocator();
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    TensorAllocator(const TensorAllocator &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains pointers) */
+    TensorAllocator &operator=(const TensorAllocator &) = delete;
+    /** Allow instances of this class to be moved */
+    TensorAllocator(TensorAllocator &&) = default;
+    /** Allow instances of this class to be moved */
+    TensorAllocator &operator=(TensorAllocator &&) = default;
 
     /** Make ITensorAllocator's init methods available */
     using ITensorAllocator::init;
@@ -49,6 +62,12 @@ public:
      *  In other words this can be used to create a sub-tensor from another tensor while sharing the same memory.
      *
      * @note TensorAllocator have to be of the same specialized type.
+     * @note The sub-tensor is not resizable: its padding is the padding of the parent on the sides it shares with the parent, and none on the sides
+     *       inside the parent, whose elements kernels must not overwrite. Kernels needing a larger border compute a smaller valid region, as with any
+     *       allocated tensor. This is how a plane of an image (e.g. the luma plane of a NV12 @ref MultiImage) can be given to a function without any copy.
+     * @note The parent doesn't need to be allocated yet, but its layout (i.e. its padding) must not change anymore. The memory is looked up through
+     *       the parent each time it is accessed, so the sub-tensor follows the parent being freed or allocated again, and the parent allocator must
+     *       neither be moved nor destroyed while the sub-tensor is in use. @ref allocate() and @ref free() are no-ops on a sub-tensor.
      *
      * @param[in] allocator The allocator that owns the backing memory to be shared. Ownership becomes shared afterwards.
      * @param[in] coords    The starting coordinates of the new tensor inside the parent tensor.
@@ -58,14 +77,65 @@ public:
 
     /** Returns the pointer to the allocated data. */
     uint8_t *data() const;
+    /** Check whether the tensor is a sub-tensor of another one, i.e. whether its memory belongs to a parent tensor.
+     *
+     * @return True if the allocator was initialised with a parent allocator.
+     */
+    bool is_sub_tensor() const;
+
+    /** Set the allocator providing the backing memory of the tensor.
+     *
+     * @note The allocator must outlive the backing memory of the tensor.
+     *
+     * @param[in] allocator Allocator to use for the following calls to @ref allocate().
+     */
+    void set_allocator(IAllocator *allocator);
+    /** Set the allocator used by the tensor allocators and the memory planners created afterwards (e.g. a @ref HugePageAllocator).
+     *
+     * @note Not thread-safe: call it before creating the tensors. The allocator must outlive the backing memory of these tensors.
+     *
+     * @param[in] allocator Allocator to use by default, nullptr to restore the @ref PoolAllocator singleton.
+     */
+    static void set_default_allocator(IAllocator *allocator);
+    /** Allocator used by default by the new tensor allocators and memory planners
+     *
+     * @return The allocator set by @ref set_default_allocator(), the @ref PoolAllocator singleton by default.
+     */
+    static IAllocator *default_allocator();
 
     /** Allocate size specified by TensorInfo of CPU memory.
      *
      * @note The tensor must not already be allocated when calling this function.
      *
+     * @note The memory is aligned to a cache line and its content is not initialised.
+     *
+     * @note If the tensor is managed by a @ref MemoryPlanner, no memory is allocated: the end of the tensor's lifetime is recorded instead
+     *       and the memory is bound when @ref MemoryPlanner::allocate() is called.
+     *
      */
     void allocate() override;
 
+    /** Use an existing CPU memory as backing memory of the tensor instead of allocating it: no copy is made.
+     *
+     * @note The tensor must not already be allocated nor be managed by a @ref MemoryPlanner.
+     *
+     * @note The memory must hold info().total_size() bytes laid out with the strides and the padding of the tensor.
+     *
+     * @param[in] buffer Memory to use. Ownership becomes shared afterwards: the memory is released when the last tensor using it is freed.
+     */
+    void import_memory(std::shared_ptr<uint8_t> buffer);
+
+    /** Allocate a single block of CPU memory backing several tensors, e.g. the levels of a pyramid or the planes of a multi-planar image.
+     *
+     * Each tensor keeps its own strides and padding and gets a part of the block aligned to a cache line.
+     * The block is taken from the allocator of the first tensor and released when the last tensor using it is freed.
+     *
+     * @note The tensors must not already be allocated nor be managed by a @ref MemoryPlanner.
+     *
+     * @param[in] allocators Allocators of the tensors to allocate. Must not be empty.
+     */
+    static void allocate_contiguous(const std::vector<TensorAllocator *> &allocators);
+
     /** Free allocated CPU memory.
      *
      * @note The tensor must have been allocated when calling this function.
@@ -84,7 +154,13 @@ protected:
     void unlock() override;
 
 private:
-    std::shared_ptr<std::vector<uint8_t>> _buffer; /**< CPU memory allocation. */
+    friend class MemoryPlanner;
+    friend class SharedWeights;
+
+    std::shared_ptr<uint8_t> _buffer;                    /**< CPU memory allocation. */
+    const TensorAllocator   *_parent;                    /**< Allocator owning the memory of the sub-tensor, if any. */
+    IAllocator              *_allocator;                 /**< Allocator providing the CPU memory. */
+    MemoryPlanner           *_associated_memory_planner; /**< Memory planner the tensor is managed by, if any. */
 };
 }
 #endif /* __ARM_COMPUTE_TENSORALLOCATOR_H__ */
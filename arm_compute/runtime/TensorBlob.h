@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TENSORBLOB_H__
+#define __ARM_COMPUTE_TENSORBLOB_H__
+
+#include <istream>
+#include <ostream>
+
+namespace arm_compute
+{
+class ITensor;
+
+/** Write the data type, the shape and the content of a tensor to a binary stream.
+ *
+ * The padding of the tensor is not written: the blob can be loaded in a tensor with a different padding.
+ *
+ * @param[in]  tensor Tensor to write. Its memory must be allocated.
+ * @param[out] stream Binary output stream.
+ */
+void save_tensor_blob(const ITensor &tensor, std::ostream &stream);
+/** Load the content of a tensor from a binary stream written by @ref save_tensor_blob.
+ *
+ * The blob is keyed by the data type and the shape of the tensor: nothing is loaded if they don't match the ones of @p tensor.
+ *
+ * @param[out] tensor Tensor to fill. Its memory must be allocated.
+ * @param[in]  stream Binary input stream.
+ *
+ * @return True if the content of the tensor was loaded, false if the blob is invalid or doesn't match the tensor.
+ */
+bool load_tensor_blob(ITensor &tensor, std::istream &stream);
+}
+#endif /* __ARM_COMPUTE_TENSORBLOB_H__ */
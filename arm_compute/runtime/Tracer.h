@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __ARM_COMPUTE_TRACER_H__
+#define __ARM_COMPUTE_TRACER_H__
+
+#include <string>
+
+namespace arm_compute
+{
+class IKernel;
+
+/** Emits begin / end section markers to the tracer of the platform, so that the kernels and the layers show up by name in systrace and Perfetto traces.
+ *
+ * On Android the markers go through ATrace_beginSection() / ATrace_endSection() (resolved at runtime from libandroid.so, API level 23 or above),
+ * otherwise they are written to the ftrace trace_marker file in the format atrace uses, which systrace, Perfetto and trace-cmd all understand.
+ *
+ * @note The markers are only compiled in if the library is built with tracing=1. Use @ref ARM_COMPUTE_TRACE_KERNEL and @ref ARM_COMPUTE_TRACE_SCOPE
+ *       rather than this class directly: they compile to nothing otherwise.
+ */
+class Tracer
+{
+public:
+    /** Returns true if the sections are recorded
+     *
+     * @return True if a trace is being captured on Android, or if the trace_marker file could be opened on Linux.
+     */
+    static bool is_enabled();
+    /** Begin a section on the calling thread
+     *
+     * @param[in] name Name of the section.
+     */
+    static void begin_section(const char *name);
+    /** End the last section begun on the calling thread */
+    static void end_section();
+};
+
+/** Section of the trace lasting for the lifetime of the object */
+class TraceSection
+{
+public:
+    /** Begin a section named after a kernel if the tracer is enabled
+     *
+     * @param[in] kernel Kernel to name the section after (See @ref Profiler::kernel_name).
+     */
+    explicit TraceSection(const IKernel &kernel);
+    /** Begin a section if the tracer is enabled
+     *
+     * @param[in] name Name of the section. No section is begun if the name is empty.
+     */
+    explicit TraceSection(const std::string &name);
+    /** Prevent instances of this class from being copied (As this class ends a section) */
+    TraceSection(const TraceSection &) = delete;
+    /** Prevent instances of this class from being copied (As this class ends a section) */
+    TraceSection &operator=(const TraceSection &) = delete;
+    /** End the section */
+    ~TraceSection();
+
+private:
+    bool _is_active; /**< Whether a section was begun */
+};
+}
+
+#ifdef ARM_COMPUTE_TRACING
+/** Trace the rest of the scope as a section named after a kernel */
+#define ARM_COMPUTE_TRACE_KERNEL(kernel) arm_compute::TraceSection trace_section((kernel))
+/** Trace the rest of the scope as a section. The name is only evaluated if the tracer is enabled */
+#define ARM_COMPUTE_TRACE_SCOPE(name) arm_compute::TraceSection trace_section(arm_compute::Tracer::is_enabled() ? std::string(name) : std::string())
+#else /* ARM_COMPUTE_TRACING */
+#define ARM_COMPUTE_TRACE_KERNEL(kernel)
+#define ARM_COMPUTE_TRACE_SCOPE(name)
+#endif /* ARM_COMPUTE_TRACING */
+
+#endif /* __ARM_COMPUTE_TRACER_H__ */
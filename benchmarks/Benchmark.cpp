@@ -0,0 +1,366 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Benchmark.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <numeric>
+#include <sstream>
+#include <utility>
+
+using namespace arm_compute;
+using namespace benchmark;
+
+namespace
+{
+/** Print the usage of a benchmark
+ *
+ * @param[in] name Name of the binary.
+ */
+void print_usage(const char *name)
+{
+    std::cerr << "Usage: " << name << " [--threads=N[,N...]] [--warmup=N] [--iterations=N] [--format=csv|json] [--filter=NAME] [--output=FILE] [--power=SOURCE]\n\n"
+              << "  --threads     Comma separated numbers of CPU threads to measure (NEON only). Defaults to 0, the number of cores.\n"
+              << "  --warmup      Number of runs before the measurements. Defaults to 3.\n"
+              << "  --iterations  Number of measured runs. Defaults to 20.\n"
+              << "  --format      Format of the results. Defaults to csv.\n"
+              << "  --filter      Only measure the functions whose name contains NAME.\n"
+              << "  --output      Write the results to FILE instead of the standard output.\n"
+              << "  --power       Report the energy of a run and the mean power, sampled from SOURCE during the measured runs:\n"
+              << "                sysfs (first battery in /sys/class/power_supply), sysfs:NAME (supply NAME) or file:PATH (power in microwatts).\n";
+}
+
+/** Parse a comma separated list of non negative integers
+ *
+ * @param[in]  value  String to parse.
+ * @param[out] values Parsed integers.
+ *
+ * @return False if the list is empty or holds a value which is not a non negative integer.
+ */
+bool parse_list(const std::string &value, std::vector<int> &values)
+{
+    values.clear();
+
+    std::istringstream is(value);
+    std::string        item;
+    while(std::getline(is, item, ','))
+    {
+        if(item.empty() || item.find_first_not_of("0123456789") != std::string::npos)
+        {
+            return false;
+        }
+        values.push_back(std::atoi(item.c_str()));
+    }
+
+    return !values.empty();
+}
+
+/** Name of the unit of a metric
+ *
+ * @param[in] metric Metric.
+ *
+ * @return The unit the throughput is reported in
+ */
+const char *metric_unit(Metric metric)
+{
+    switch(metric)
+    {
+        case Metric::BANDWIDTH:
+            return "GB/s";
+        case Metric::FLOPS:
+            return "GFLOP/s";
+        case Metric::PIXELS:
+            return "Mpixels/s";
+        default:
+            ARM_COMPUTE_ERROR("Metric not supported");
+            return "";
+    }
+}
+} // namespace
+
+bool benchmark::parse_options(int argc, const char **argv, Options &options)
+{
+    bool is_valid = true;
+    for(int i = 1; i < argc && is_valid; ++i)
+    {
+        const std::string arg(argv[i]);
+        const size_t      eq    = arg.find('=');
+        const std::string name  = arg.substr(0, eq);
+        const std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if(name == "--threads")
+        {
+            is_valid = parse_list(value, options.threads);
+        }
+        else if(name == "--warmup" && !value.empty())
+        {
+            options.warmup = std::atoi(value.c_str());
+        }
+        else if(name == "--iterations" && !value.empty())
+        {
+            options.iterations = std::atoi(value.c_str());
+        }
+        else if(name == "--format" && (value == "csv" || value == "json"))
+        {
+            options.format = value;
+        }
+        else if(name == "--filter" && !value.empty())
+        {
+            options.filter = value;
+        }
+        else if(name == "--output" && !value.empty())
+        {
+            options.output = value;
+        }
+        else if(name == "--power" && !value.empty())
+        {
+            options.power = value;
+        }
+        else
+        {
+            is_valid = false;
+        }
+    }
+
+    is_valid = is_valid && options.warmup >= 0 && options.iterations > 0;
+    if(!is_valid)
+    {
+        print_usage(argv[0]);
+    }
+
+    return is_valid;
+}
+
+void benchmark::fill_pattern(ITensor *tensor)
+{
+    Window window;
+    window.use_tensor_dimensions(tensor->info());
+
+    Iterator it(tensor, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Stripes and a diagonal ramp: the vision functions find edges, and the arithmetic doesn't overflow
+        const int value = ((id.x() / 8 + id.y() / 8) % 2) * 128 + (id.x() + id.y()) % 64;
+
+        switch(tensor->info()->data_type())
+        {
+            case DataType::U8:
+                *it.ptr() = static_cast<uint8_t>(value);
+                break;
+            case DataType::S16:
+                *reinterpret_cast<int16_t *>(it.ptr()) = static_cast<int16_t>(value);
+                break;
+            case DataType::F32:
+                *reinterpret_cast<float *>(it.ptr()) = value / 256.f;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+        }
+    },
+    it);
+}
+
+Benchmark::Benchmark(const Options &options, std::string backend, std::function<void(int)> set_threads, std::function<void()> sync)
+    : _options(options), _backend(std::move(backend)), _set_threads(std::move(set_threads)), _sync(std::move(sync)), _power_monitor(), _results()
+{
+    if(!_options.power.empty())
+    {
+        _power_monitor = arm_compute::cpp14::make_unique<PowerMonitor>(_options.power);
+    }
+
+    // A backend without threads is measured once
+    if(_set_threads == nullptr)
+    {
+        _options.threads = { 0 };
+    }
+}
+
+bool Benchmark::is_selected(const std::string &function) const
+{
+    return _options.filter.empty() || function.find(_options.filter) != std::string::npos;
+}
+
+void Benchmark::measure(const std::string &function, const std::string &shape, Metric metric, double work, const std::function<void()> &run)
+{
+    for(int threads : _options.threads)
+    {
+        if(_set_threads != nullptr)
+        {
+            _set_threads(threads);
+        }
+
+        // The warmup runs allocate the lazily created resources and warm up the caches
+        for(int i = 0; i < _options.warmup; ++i)
+        {
+            run();
+        }
+        if(_sync != nullptr)
+        {
+            _sync();
+        }
+
+        std::vector<double> times;
+        times.reserve(_options.iterations);
+
+        if(_power_monitor != nullptr)
+        {
+            _power_monitor->start();
+        }
+        const auto measure_start = std::chrono::steady_clock::now();
+
+        for(int i = 0; i < _options.iterations; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            run();
+            if(_sync != nullptr)
+            {
+                _sync();
+            }
+            const auto end = std::chrono::steady_clock::now();
+            times.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+        }
+
+        double energy_mj = 0.;
+        double power_mw  = 0.;
+        if(_power_monitor != nullptr)
+        {
+            const double total_mj = _power_monitor->stop();
+            const double total_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - measure_start).count();
+
+            energy_mj = total_mj / _options.iterations;
+            power_mw  = (total_ms > 0.) ? total_mj * 1e3 / total_ms : 0.;
+        }
+
+        std::sort(times.begin(), times.end());
+
+        const double median_ms = times[times.size() / 2];
+        const double mean_ms   = std::accumulate(times.begin(), times.end(), 0.) / times.size();
+        const Result result{ function, shape, threads, times.front(), median_ms, mean_ms, (median_ms > 0.) ? work / (median_ms * 1e6) : 0., metric, energy_mj, power_mw };
+        _results.push_back(result);
+
+        std::cerr << _backend << " " << function << " " << shape << " threads=" << threads << ": " << result.median_ms << " ms, "
+                  << result.throughput << " " << metric_unit(metric);
+        if(_power_monitor != nullptr)
+        {
+            std::cerr << ", " << result.energy_mj << " mJ/run, " << result.power_mw << " mW";
+        }
+        std::cerr << "\n";
+    }
+
+    if(_set_threads != nullptr)
+    {
+        _set_threads(0);
+    }
+}
+
+bool Benchmark::report() const
+{
+    if(_options.output.empty())
+    {
+        write(std::cout);
+        return true;
+    }
+
+    std::ofstream os(_options.output);
+    if(!os.is_open())
+    {
+        std::cerr << "Can't open " << _options.output << "\n";
+        return false;
+    }
+    write(os);
+    return os.good();
+}
+
+void Benchmark::write(std::ostream &os) const
+{
+    os << std::fixed << std::setprecision(4);
+
+    if(_options.format == "json")
+    {
+        os << "[\n";
+        for(size_t i = 0; i < _results.size(); ++i)
+        {
+            const Result &r = _results[i];
+            os << "  {\"backend\": \"" << _backend << "\", \"function\": \"" << r.function << "\", \"shape\": \"" << r.shape << "\", \"threads\": " << r.threads
+               << ", \"iterations\": " << _options.iterations << ", \"min_ms\": " << r.min_ms << ", \"median_ms\": " << r.median_ms << ", \"mean_ms\": " << r.mean_ms
+               << ", \"throughput\": " << r.throughput << ", \"unit\": \"" << metric_unit(r.metric) << "\"";
+            if(_power_monitor != nullptr)
+            {
+                os << ", \"energy_mj\": " << r.energy_mj << ", \"power_mw\": " << r.power_mw;
+            }
+            os << "}" << ((i + 1 < _results.size()) ? "," : "") << "\n";
+        }
+        os << "]\n";
+    }
+    else
+    {
+        // The energy columns are only written when they are measured, so that the results of runs without a power source still diff
+        os << "backend,function,shape,threads,iterations,min_ms,median_ms,mean_ms,throughput,unit" << ((_power_monitor != nullptr) ? ",energy_mj,power_mw" : "") << "\n";
+        for(const Result &r : _results)
+        {
+            os << _backend << "," << r.function << "," << r.shape << "," << r.threads << "," << _options.iterations << "," << r.min_ms << "," << r.median_ms << "," << r.mean_ms << ","
+               << r.throughput << "," << metric_unit(r.metric);
+            if(_power_monitor != nullptr)
+            {
+                os << "," << r.energy_mj << "," << r.power_mw;
+            }
+            os << "\n";
+        }
+    }
+}
+
+int benchmark::run_benchmark(int argc, const char **argv, const std::string &backend, std::function<void(int)> set_threads, std::function<void()> sync,
+                             const std::function<void(Benchmark &)> &func)
+{
+    Options options{ { 0 }, 3, 20, "csv", "", "", "" };
+    if(!parse_options(argc, argv, options))
+    {
+        return 1;
+    }
+
+    try
+    {
+        Benchmark benchmark(options, backend, std::move(set_threads), std::move(sync));
+        func(benchmark);
+        return benchmark.report() ? 0 : 1;
+    }
+    catch(std::exception &err)
+    {
+        // The OpenCL errors derive from std::exception as well
+        std::cerr << "ERROR " << err.what() << "\n";
+    }
+
+    return 1;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __BENCHMARK_BENCHMARK_H__
+#define __BENCHMARK_BENCHMARK_H__
+
+#include "PowerMonitor.h"
+
+#include "arm_compute/core/ITensor.h"
+
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+/** Command line options shared by the benchmarks */
+struct Options
+{
+    std::vector<int> threads;    /**< Numbers of CPU threads to measure (NEON only), 0 for the default number of threads of the scheduler */
+    int              warmup;     /**< Number of runs before the measurements */
+    int              iterations; /**< Number of measured runs */
+    std::string      format;     /**< Output format: "csv" or "json" */
+    std::string      filter;     /**< Only measure the functions whose name contains this string, empty to measure all of them */
+    std::string      output;     /**< File the results are written to, empty to write them to the standard output */
+    std::string      power;      /**< Source of the power samples (See @ref PowerMonitor), empty to not measure the energy */
+};
+
+/** Parse the command line of a benchmark
+ *
+ * @param[in]      argc    Number of arguments.
+ * @param[in]      argv    Arguments.
+ * @param[in, out] options Default options, overridden by the arguments.
+ *
+ * @return False if an argument is not valid, in which case the usage has been printed.
+ */
+bool parse_options(int argc, const char **argv, Options &options);
+
+/** Unit of the throughput of a function */
+enum class Metric
+{
+    BANDWIDTH, /**< Bytes read and written, reported in GB/s */
+    FLOPS,     /**< Floating point operations, reported in GFLOP/s */
+    PIXELS     /**< Output pixels, reported in Mpixels/s */
+};
+
+/** Fill a tensor with a deterministic pattern which has edges and gradients (for the vision functions)
+ *
+ * @param[in, out] tensor Tensor to fill. Must be mapped if it is an OpenCL tensor. Data types supported: U8/S16/F32.
+ */
+void fill_pattern(arm_compute::ITensor *tensor);
+
+/** Measure functions over a grid of shapes and thread counts and report the results in CSV or JSON
+ *
+ * The results of a release can be diffed against the ones of another release: the rows are ordered and named the same way.
+ */
+class Benchmark
+{
+public:
+    /** Constructor
+     *
+     * @param[in] options     Options of the benchmark.
+     * @param[in] backend     Name of the backend written in the results ("neon" or "cl").
+     * @param[in] set_threads Function setting the number of threads of the backend, nullptr if the backend has no threads.
+     * @param[in] sync        Function waiting for the completion of the submitted work, nullptr if the functions are synchronous.
+     */
+    Benchmark(const Options &options, std::string backend, std::function<void(int)> set_threads, std::function<void()> sync);
+    /** Indicates whether a function has to be measured
+     *
+     * @param[in] function Name of the function.
+     *
+     * @return True if the name of the function matches the filter of the options.
+     */
+    bool is_selected(const std::string &function) const;
+    /** Run a configured function for each number of threads: warmup runs, then the measured runs
+     *
+     * If a power source is set in the options, the power is sampled during the measured runs and the energy of a run is reported as well.
+     *
+     * @param[in] function Name of the function.
+     * @param[in] shape    Description of the shape the function is configured for.
+     * @param[in] metric   Unit of @p work.
+     * @param[in] work     Work done by one run: bytes, floating point operations or pixels depending on @p metric.
+     * @param[in] run      Run the function once.
+     */
+    void measure(const std::string &function, const std::string &shape, Metric metric, double work, const std::function<void()> &run);
+    /** Write the results in the format of the options
+     *
+     * @return True if the results were written.
+     */
+    bool report() const;
+
+private:
+    /** Result of a function for one shape and one number of threads */
+    struct Result
+    {
+        std::string function;   /**< Name of the function */
+        std::string shape;      /**< Description of the shape */
+        int         threads;    /**< Number of threads, 0 for the default */
+        double      min_ms;     /**< Fastest run in milliseconds */
+        double      median_ms;  /**< Median run in milliseconds */
+        double      mean_ms;    /**< Mean run in milliseconds */
+        double      throughput; /**< Work per second of the median run, in the unit of @ref metric */
+        Metric      metric;     /**< Unit of the throughput */
+        double      energy_mj;  /**< Mean energy of a run in millijoules, 0 if the energy is not measured */
+        double      power_mw;   /**< Mean power during the measured runs in milliwatts, 0 if the energy is not measured */
+    };
+
+    /** Write the results
+     *
+     * @param[out] os Output stream.
+     */
+    void write(std::ostream &os) const;
+
+    Options                       _options;
+    std::string                   _backend;
+    std::function<void(int)>      _set_threads;
+    std::function<void()>         _sync;
+    std::unique_ptr<PowerMonitor> _power_monitor;
+    std::vector<Result>           _results;
+};
+
+/** Parse the command line, run a benchmark and report its results
+ *
+ * @param[in] argc        Number of arguments.
+ * @param[in] argv        Arguments.
+ * @param[in] backend     Name of the backend written in the results ("neon" or "cl").
+ * @param[in] set_threads Function setting the number of threads of the backend, nullptr if the backend has no threads.
+ * @param[in] sync        Function waiting for the completion of the submitted work, nullptr if the functions are synchronous.
+ * @param[in] func        Benchmark to run: configures its functions and measures them with @ref Benchmark::measure.
+ *
+ * @return Exit code of the program
+ */
+int run_benchmark(int argc, const char **argv, const std::string &backend, std::function<void(int)> set_threads, std::function<void()> sync,
+                  const std::function<void(Benchmark &)> &func);
+} // namespace benchmark
+#endif /* __BENCHMARK_BENCHMARK_H__ */
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "PowerMonitor.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <chrono>
+#include <cmath>
+#include <dirent.h>
+#include <exception>
+#include <fstream>
+
+using namespace benchmark;
+
+namespace
+{
+const std::string power_supply_dir = "/sys/class/power_supply/";
+
+/** Interval between two samples of the power */
+constexpr std::chrono::milliseconds sampling_period(2);
+
+/** Check if a file can be read
+ *
+ * @param[in] path Path of the file.
+ *
+ * @return True if the file can be opened for reading.
+ */
+bool is_readable(const std::string &path)
+{
+    std::ifstream fs(path);
+    return fs.is_open();
+}
+
+/** Read the first value of a file
+ *
+ * @param[in] path Path of the file.
+ *
+ * @return The value in the file
+ */
+double read_value(const std::string &path)
+{
+    std::ifstream fs(path);
+    double        value = 0.;
+
+    if(!(fs >> value))
+    {
+        ARM_COMPUTE_ERROR("Can't read a value from %s", path.c_str());
+    }
+
+    return value;
+}
+
+/** Find the first battery in the power supply class
+ *
+ * @return Name of the battery, empty if there is none
+ */
+std::string find_battery()
+{
+    std::string battery;
+
+    DIR *dir = opendir(power_supply_dir.c_str());
+    if(dir == nullptr)
+    {
+        return battery;
+    }
+
+    for(dirent *entry = readdir(dir); entry != nullptr && battery.empty(); entry = readdir(dir))
+    {
+        std::ifstream fs(power_supply_dir + entry->d_name + "/type");
+        std::string   type;
+
+        if(fs >> type && type == "Battery")
+        {
+            battery = entry->d_name;
+        }
+    }
+    closedir(dir);
+
+    return battery;
+}
+} // namespace
+
+PowerMonitor::PowerMonitor(const std::string &source)
+    : _current_file(), _voltage_file(), _power_file(), _running(false), _energy_mj(0.), _thread()
+{
+    if(source.compare(0, 5, "file:") == 0)
+    {
+        _power_file = source.substr(5);
+    }
+    else if(source == "sysfs" || source.compare(0, 6, "sysfs:") == 0)
+    {
+        const std::string name = (source == "sysfs") ? find_battery() : source.substr(6);
+
+        if(name.empty())
+        {
+            ARM_COMPUTE_ERROR("No battery found in %s", power_supply_dir.c_str());
+        }
+
+        const std::string dir = power_supply_dir + name + "/";
+
+        // Some supplies report the power directly
+        if(is_readable(dir + "power_now"))
+        {
+            _power_file = dir + "power_now";
+        }
+        else
+        {
+            _current_file = dir + "current_now";
+            _voltage_file = dir + "voltage_now";
+        }
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR("Unknown power source %s", source.c_str());
+    }
+
+    // Fail early rather than in the sampling thread
+    read_power();
+}
+
+PowerMonitor::~PowerMonitor()
+{
+    if(_thread.joinable())
+    {
+        stop();
+    }
+}
+
+void PowerMonitor::start()
+{
+    ARM_COMPUTE_ERROR_ON(_thread.joinable());
+
+    _energy_mj = 0.;
+    _running   = true;
+    _thread    = std::thread(&PowerMonitor::sample, this);
+}
+
+double PowerMonitor::stop()
+{
+    ARM_COMPUTE_ERROR_ON(!_thread.joinable());
+
+    _running = false;
+    _thread.join();
+
+    return _energy_mj;
+}
+
+double PowerMonitor::read_power() const
+{
+    if(!_power_file.empty())
+    {
+        return read_value(_power_file) * 1e-6;
+    }
+
+    // The sign of the current depends on the driver: the battery is discharging while the benchmark runs
+    return std::abs(read_value(_current_file)) * 1e-6 * read_value(_voltage_file) * 1e-6;
+}
+
+void PowerMonitor::sample()
+{
+    using clock = std::chrono::steady_clock;
+
+    try
+    {
+        auto   last_time  = clock::now();
+        double last_power = read_power();
+
+        while(_running)
+        {
+            std::this_thread::sleep_for(sampling_period);
+
+            const auto   time  = clock::now();
+            const double power = read_power();
+
+            // Trapezoidal integration of the samples: W * ms = mJ
+            _energy_mj += 0.5 * (power + last_power) * std::chrono::duration<double, std::milli>(time - last_time).count();
+
+            last_time  = time;
+            last_power = power;
+        }
+    }
+    catch(const std::exception &)
+    {
+        // The source disappeared (e.g. the device was unplugged): the energy of this measurement is unknown
+        _energy_mj = std::nan("");
+    }
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __BENCHMARK_POWERMONITOR_H__
+#define __BENCHMARK_POWERMONITOR_H__
+
+#include <atomic>
+#include <string>
+#include <thread>
+
+namespace benchmark
+{
+/** Sample the power drawn by the device in a background thread and integrate it into energy
+ *
+ * The supported sources are:
+ *  - "sysfs" or "sysfs:NAME": current_now and voltage_now (or power_now) of the supply NAME in /sys/class/power_supply, the first battery if NAME is omitted.
+ *  - "file:PATH": a file holding the instantaneous power in microwatts, e.g. the power1_input attribute of a hwmon power monitor, or a file updated by an external monitor.
+ *
+ * @note Batteries usually refresh their readings every few hundred milliseconds: the measured runs must last long enough for the energy to be meaningful.
+ */
+class PowerMonitor
+{
+public:
+    /** Constructor
+     *
+     * @param[in] source Source of the samples (See the description of the class).
+     */
+    explicit PowerMonitor(const std::string &source);
+    /** Prevent instances of this class from being copied (As this class contains a thread) */
+    PowerMonitor(const PowerMonitor &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a thread) */
+    PowerMonitor &operator=(const PowerMonitor &) = delete;
+    /** Stop sampling if needed */
+    ~PowerMonitor();
+
+    /** Start sampling the power */
+    void start();
+    /** Stop sampling the power
+     *
+     * @return Energy in millijoules drawn since @ref start() was called, NaN if the source couldn't be read.
+     */
+    double stop();
+
+private:
+    /** Read the instantaneous power
+     *
+     * @return Power in watts
+     */
+    double read_power() const;
+    /** Body of the sampling thread */
+    void sample();
+
+    std::string       _current_file; /**< File holding the current in microamps, empty if the power is read directly */
+    std::string       _voltage_file; /**< File holding the voltage in microvolts, empty if the power is read directly */
+    std::string       _power_file;   /**< File holding the power in microwatts, empty if the power is the product of the current and the voltage */
+    std::atomic<bool> _running;
+    double            _energy_mj; /**< Energy integrated by the sampling thread, only read once it is joined */
+    std::thread       _thread;
+};
+} // namespace benchmark
+#endif /* __BENCHMARK_POWERMONITOR_H__ */
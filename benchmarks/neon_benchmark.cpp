@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "Benchmark.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEFunctions.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace arm_compute;
+using namespace benchmark;
+
+namespace
+{
+/** Sizes of the images for the elementwise and vision functions */
+const std::vector<std::pair<unsigned int, unsigned int>> image_sizes{ { 640, 480 }, { 1280, 720 }, { 1920, 1080 } };
+
+/** Sizes of the square matrices for the matrix multiplication */
+const std::vector<unsigned int> gemm_sizes{ 128, 256, 512, 1024 };
+
+/** Width, height, input and output feature maps of the 3x3 convolutions */
+const std::vector<std::vector<unsigned int>> conv_shapes{ { 56, 56, 64, 64 }, { 28, 28, 128, 128 }, { 14, 14, 256, 256 } };
+
+/** Describe an image size
+ *
+ * @param[in] size Width and height.
+ *
+ * @return "WxH"
+ */
+std::string shape_name(const std::pair<unsigned int, unsigned int> &size)
+{
+    return std::to_string(size.first) + "x" + std::to_string(size.second);
+}
+
+/** Allocate the tensors of a configured function, fill its inputs and measure it
+ *
+ * @param[in, out] bench    Benchmark collecting the results.
+ * @param[in]      name     Name of the function.
+ * @param[in]      shape    Description of the shape the function is configured for.
+ * @param[in]      metric   Unit of @p work.
+ * @param[in]      work     Work done by one run.
+ * @param[in, out] function Configured function.
+ * @param[in]      inputs   Input tensors of the function, filled with a pattern.
+ * @param[in]      outputs  Output tensors of the function.
+ */
+void run(Benchmark &bench, const std::string &name, const std::string &shape, Metric metric, double work, IFunction &function, std::initializer_list<Tensor *> inputs,
+         std::initializer_list<Tensor *> outputs)
+{
+    for(Tensor *tensor : inputs)
+    {
+        tensor->allocator()->allocate();
+        fill_pattern(tensor);
+    }
+    for(Tensor *tensor : outputs)
+    {
+        tensor->allocator()->allocate();
+    }
+
+    bench.measure(name, shape, metric, work, [&]()
+    {
+        function.run();
+    });
+}
+
+/** Measure the NEON functions over their shape grids
+ *
+ * @param[in, out] bench Benchmark collecting the results.
+ */
+void neon_benchmark(Benchmark &bench)
+{
+    for(const auto &size : image_sizes)
+    {
+        const TensorShape shape(size.first, size.second);
+        const double      pixels = static_cast<double>(size.first) * size.second;
+
+        if(bench.is_selected("NEArithmeticAddition"))
+        {
+            Tensor a, b, dst;
+            a.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+            b.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+            dst.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+            NEArithmeticAddition f;
+            f.configure(&a, &b, &dst, ConvertPolicy::SATURATE);
+            run(bench, "NEArithmeticAddition", shape_name(size), Metric::BANDWIDTH, 3 * pixels * sizeof(float), f, { &a, &b }, { &dst });
+        }
+
+        if(bench.is_selected("NEActivationLayer"))
+        {
+            Tensor src, dst;
+            src.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+            dst.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+            NEActivationLayer f;
+            f.configure(&src, &dst, ActivationLayerInfo(ActivationLayerInfo::ActivationFunction::RELU));
+            run(bench, "NEActivationLayer", shape_name(size), Metric::BANDWIDTH, 2 * pixels * sizeof(float), f, { &src }, { &dst });
+        }
+
+        if(bench.is_selected("NEGaussian5x5"))
+        {
+            Tensor src, dst;
+            src.allocator()->init(TensorInfo(shape, Format::U8));
+            dst.allocator()->init(TensorInfo(shape, Format::U8));
+
+            NEGaussian5x5 f;
+            f.configure(&src, &dst, BorderMode::REPLICATE);
+            run(bench, "NEGaussian5x5", shape_name(size), Metric::PIXELS, pixels, f, { &src }, { &dst });
+        }
+
+        if(bench.is_selected("NEScale"))
+        {
+            // Bilinear downscale by 2, the throughput counts the output pixels
+            Tensor src, dst;
+            src.allocator()->init(TensorInfo(shape, Format::U8));
+            dst.allocator()->init(TensorInfo(TensorShape(size.first / 2, size.second / 2), Format::U8));
+
+            NEScale f;
+            f.configure(&src, &dst, InterpolationPolicy::BILINEAR, BorderMode::REPLICATE);
+            run(bench, "NEScale", shape_name(size), Metric::PIXELS, pixels / 4, f, { &src }, { &dst });
+        }
+
+        if(bench.is_selected("NECannyEdge"))
+        {
+            Tensor src, dst;
+            src.allocator()->init(TensorInfo(shape, Format::U8));
+            dst.allocator()->init(TensorInfo(shape, Format::U8));
+
+            NECannyEdge f;
+            f.configure(&src, &dst, 100, 50, 3, 1, BorderMode::REPLICATE);
+            run(bench, "NECannyEdge", shape_name(size), Metric::PIXELS, pixels, f, { &src }, { &dst });
+        }
+    }
+
+    if(bench.is_selected("NEGEMM"))
+    {
+        for(unsigned int n : gemm_sizes)
+        {
+            Tensor a, b, dst;
+            a.allocator()->init(TensorInfo(TensorShape(n, n), 1, DataType::F32));
+            b.allocator()->init(TensorInfo(TensorShape(n, n), 1, DataType::F32));
+            dst.allocator()->init(TensorInfo(TensorShape(n, n), 1, DataType::F32));
+
+            NEGEMM f;
+            f.configure(&a, &b, nullptr, &dst, 1.f, 0.f);
+            run(bench, "NEGEMM", std::to_string(n) + "x" + std::to_string(n) + "x" + std::to_string(n), Metric::FLOPS, 2. * n * n * n, f, { &a, &b }, { &dst });
+        }
+    }
+
+    if(bench.is_selected("NEConvolutionLayer"))
+    {
+        for(const auto &conv : conv_shapes)
+        {
+            const unsigned int width  = conv[0];
+            const unsigned int height = conv[1];
+            const unsigned int ifm    = conv[2];
+            const unsigned int ofm    = conv[3];
+
+            Tensor src, weights, biases, dst;
+            src.allocator()->init(TensorInfo(TensorShape(width, height, ifm), 1, DataType::F32));
+            weights.allocator()->init(TensorInfo(TensorShape(3U, 3U, ifm, ofm), 1, DataType::F32));
+            biases.allocator()->init(TensorInfo(TensorShape(ofm), 1, DataType::F32));
+            dst.allocator()->init(TensorInfo(TensorShape(width, height, ofm), 1, DataType::F32));
+
+            NEConvolutionLayer f;
+            f.configure(&src, &weights, &biases, &dst, PadStrideInfo(1, 1, 1, 1));
+
+            const std::string shape = std::to_string(width) + "x" + std::to_string(height) + "x" + std::to_string(ifm) + "->" + std::to_string(ofm) + "_3x3";
+            run(bench, "NEConvolutionLayer", shape, Metric::FLOPS, 2. * width * height * ofm * ifm * 9, f, { &src, &weights, &biases }, { &dst });
+        }
+    }
+}
+} // namespace
+
+/** Micro-benchmark of the NEON functions
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [--threads=N[,N...]] [--warmup=N] [--iterations=N] [--format=csv|json] [--filter=NAME] [--output=FILE] )
+ */
+int main(int argc, const char **argv)
+{
+    return run_benchmark(argc, argv, "neon", [](int threads)
+    {
+        NEScheduler::get().force_number_of_threads(threads);
+    },
+    nullptr, neon_benchmark);
+}
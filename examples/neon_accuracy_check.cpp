@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/NEON/NENetwork.h"
+#include "test_helpers/DatasetLoader.h"
+#include "test_helpers/Utils.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+namespace
+{
+/** Accumulated difference between the outputs of a layer in both networks */
+struct LayerError
+{
+    bool   observed;     /**< True if the layer has an output of its own (i.e. it's not fused into the previous one) */
+    double max_abs;      /**< Largest absolute difference over all the images */
+    double sum_sq_diff;  /**< Sum of the squared differences */
+    double sum_sq_ref;   /**< Sum of the squared reference values */
+    std::string shape;   /**< Shape of the output */
+};
+
+/** Call a function on each row of a F32 tensor, skipping its padding */
+void for_each_row(const ITensor &tensor, const std::function<void(const float *, size_t)> &func)
+{
+    Window window;
+    window.use_tensor_dimensions(tensor.info());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        func(reinterpret_cast<const float *>(it.ptr()), tensor.info()->dimension(0));
+    },
+    it);
+}
+
+/** Indices of the k largest scores of the output of a network, in decreasing order */
+std::vector<unsigned int> top_k_classes(const ITensor &output, size_t k)
+{
+    const auto scores = reinterpret_cast<const float *>(output.buffer() + output.info()->offset_first_element_in_bytes());
+
+    std::vector<unsigned int> classes(output.info()->dimension(0));
+    std::iota(classes.begin(), classes.end(), 0);
+
+    k = std::min(k, classes.size());
+    std::partial_sort(classes.begin(), classes.begin() + k, classes.end(), [&](unsigned int a, unsigned int b)
+    {
+        return scores[a] > scores[b];
+    });
+    classes.resize(k);
+
+    return classes;
+}
+
+std::string shape_to_string(const TensorShape &shape)
+{
+    std::string str;
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        str += (d == 0 ? "" : "x") + std::to_string(shape[d]);
+    }
+    return str;
+}
+} // namespace
+
+void main_neon_accuracy_check(int argc, const char **argv)
+{
+    if(argc < 4)
+    {
+        // Print help
+        std::cout << "Usage: ./build/neon_accuracy_check reference_plan fast_plan|f16|u8 dataset_list.txt [top_k] [mean] [scale]\n\n";
+        std::cout << "Runs the network of reference_plan (written by NENetwork::save_plan() in F32) and the same network in a fast mode side by side,\n";
+        std::cout << "and reports the difference between the outputs of every layer and the agreement of their top-k classes.\n";
+        std::cout << "The fast mode is either another plan of the same layers, e.g. with approximated activations or other convolution algorithms,\n";
+        std::cout << "or f16 / u8 to store the weights of the reference plan in that type (the fast plan is then written next to the reference one).\n\n";
+        std::cout << "Each line of dataset_list.txt holds the path of a PPM file and its label, e.g. \"images/0001.ppm 42\"\n";
+        return;
+    }
+
+    const std::string  fast_mode = argv[2];
+    const unsigned int top_k     = argc > 4 ? std::stoi(argv[4]) : 5;
+    const float        mean      = argc > 5 ? std::stof(argv[5]) : 0.f;
+    const float        scale     = argc > 6 ? std::stof(argv[6]) : 1.f;
+
+    ModelFile reference_plan;
+    reference_plan.map(argv[1]);
+
+    NENetwork reference;
+    reference.load_plan(reference_plan);
+
+    ModelFile fast_plan;
+    if(fast_mode == "f16" || fast_mode == "u8")
+    {
+        const std::string fast_path = std::string(argv[1]) + "." + fast_mode;
+        reference.save_plan(fast_path, fast_mode == "f16" ? DataType::F16 : DataType::U8);
+        fast_plan.map(fast_path);
+    }
+    else
+    {
+        fast_plan.map(fast_mode);
+    }
+
+    NENetwork fast;
+    fast.load_plan(fast_plan);
+
+    if(fast.num_layers() != reference.num_layers() || fast.input()->info()->tensor_shape().total_size() != reference.input()->info()->tensor_shape().total_size())
+    {
+        std::cout << "The two plans don't describe the same network\n";
+        return;
+    }
+
+    const unsigned int num_layers = reference.num_layers();
+
+    // The outputs of the reference layers are kept until the fast network has produced the same ones: their memory is reused by the following layers
+    std::vector<std::vector<float>> reference_outputs(num_layers);
+    std::vector<LayerError>         errors(num_layers, LayerError{ false, 0.0, 0.0, 0.0, "" });
+
+    reference.set_layer_observer([&](unsigned int layer, const ITensor & output)
+    {
+        std::vector<float> &values = reference_outputs[layer];
+        values.clear();
+        for_each_row(output, [&](const float *row, size_t width)
+        {
+            values.insert(values.end(), row, row + width);
+        });
+        errors[layer].observed = true;
+        errors[layer].shape    = shape_to_string(output.info()->tensor_shape());
+    });
+
+    fast.set_layer_observer([&](unsigned int layer, const ITensor & output)
+    {
+        const std::vector<float> &values = reference_outputs[layer];
+        LayerError               &error  = errors[layer];
+        size_t                    offset = 0;
+
+        for_each_row(output, [&](const float *row, size_t width)
+        {
+            for(size_t x = 0; x < width && offset < values.size(); ++x, ++offset)
+            {
+                const double diff = static_cast<double>(row[x]) - values[offset];
+                error.max_abs     = std::max(error.max_abs, std::abs(diff));
+                error.sum_sq_diff += diff * diff;
+                error.sum_sq_ref += static_cast<double>(values[offset]) * values[offset];
+            }
+        });
+    });
+
+    PrefetchingLoader loader(load_dataset_list(argv[3]), *reference.input()->info(), 4, 2, mean, scale);
+
+    size_t num_images         = 0;
+    size_t num_top1_agree     = 0;
+    size_t num_top_k_agree    = 0;
+    size_t num_reference_top1 = 0;
+    size_t num_fast_top1      = 0;
+
+    unsigned int  label = 0;
+    const Tensor *image = nullptr;
+
+    while((image = loader.acquire(label)) != nullptr)
+    {
+        // The slots have the same info as the input of the reference network
+        std::memcpy(reference.input()->buffer(), image->buffer(), reference.input()->info()->total_size());
+        loader.release();
+
+        fast.input()->copy_from(*reference.input());
+
+        reference.run();
+        fast.run();
+
+        std::vector<unsigned int> reference_classes = top_k_classes(*reference.output(), top_k);
+        std::vector<unsigned int> fast_classes      = top_k_classes(*fast.output(), top_k);
+
+        num_top1_agree += reference_classes[0] == fast_classes[0];
+        num_reference_top1 += reference_classes[0] == label;
+        num_fast_top1 += fast_classes[0] == label;
+
+        std::sort(reference_classes.begin(), reference_classes.end());
+        std::sort(fast_classes.begin(), fast_classes.end());
+        num_top_k_agree += reference_classes == fast_classes;
+
+        ++num_images;
+    }
+
+    std::cout << "Layer  Output shape          Max abs error  Relative error\n";
+    for(unsigned int i = 0; i < num_layers; ++i)
+    {
+        const LayerError &error = errors[i];
+        if(!error.observed)
+        {
+            continue;
+        }
+
+        const double relative = error.sum_sq_ref > 0.0 ? std::sqrt(error.sum_sq_diff / error.sum_sq_ref) : std::sqrt(error.sum_sq_diff);
+
+        std::cout << std::setw(5) << i << "  " << std::left << std::setw(20) << error.shape << std::right << "  " << std::setw(13) << error.max_abs << "  " << std::setw(14) << relative << "\n";
+    }
+
+    std::cout << "\nImages: " << num_images << "\n";
+    if(num_images != 0)
+    {
+        std::cout << "Top-1 agreement: " << 100.0 * num_top1_agree / num_images << " %\n";
+        std::cout << "Top-" << top_k << " agreement (same set of classes): " << 100.0 * num_top_k_agree / num_images << " %\n";
+        std::cout << "Top-1 accuracy: reference " << 100.0 * num_reference_top1 / num_images << " %, fast " << 100.0 * num_fast_top1 / num_images << " %\n";
+    }
+}
+
+/** Main program comparing a network in a fast mode with its F32 reference
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( Reference plan, fast plan or weights storage type, dataset list, [optional] top k, [optional] mean, [optional] scale )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neon_accuracy_check);
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NENetwork.h"
+
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "test_helpers/DatasetLoader.h"
+#include "test_helpers/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+void main_neon_alexnet_evaluation(int argc, const char **argv)
+{
+    if(argc < 3)
+    {
+        // Print help
+        std::cout << "Usage: ./build/neon_alexnet_evaluation dataset_list.txt model_file [num_slots] [num_workers] [mean] [scale]\n\n";
+        std::cout << "Each line of dataset_list.txt holds the path of a PPM file and its label, e.g. \"images/0001.ppm 42\"\n";
+        std::cout << "JPEG files are supported too if the examples are built with jpeg=1\n\n";
+        return;
+    }
+
+    const unsigned int num_slots   = argc > 3 ? std::stoi(argv[3]) : 4;
+    const unsigned int num_workers = argc > 4 ? std::stoi(argv[4]) : 2;
+    const float        mean        = argc > 5 ? std::stof(argv[5]) : 0.f;
+    const float        scale       = argc > 6 ? std::stof(argv[6]) : 1.f;
+
+    constexpr unsigned int input_width  = 227;
+    constexpr unsigned int input_height = 227;
+    constexpr unsigned int input_fm     = 3;
+    constexpr unsigned int num_labels   = 100;
+
+    const ActivationLayerInfo    relu(ActivationLayerInfo::ActivationFunction::RELU);
+    const PoolingLayerInfo       max_pool(PoolingType::MAX, 3, PadStrideInfo(2, 2));
+    const NormalizationLayerInfo lrn(NormType::IN_MAP);
+
+    // Same network as alexnet_without_fc6_and_fc7_arm_compute_library
+    NENetwork alexnet;
+    alexnet.init(TensorInfo(TensorShape(input_width, input_height, input_fm), 1, DataType::F32));
+
+    alexnet.add_layer(LayerDescriptor::convolution(11, 96, PadStrideInfo(4, 4, 0, 0)));
+    alexnet.add_layer(LayerDescriptor::activation(relu));
+    alexnet.add_layer(LayerDescriptor::pooling(max_pool));
+    alexnet.add_layer(LayerDescriptor::normalization(lrn));
+    alexnet.add_layer(LayerDescriptor::convolution(5, 256, PadStrideInfo(1, 1, 2, 2), true, 2));
+    alexnet.add_layer(LayerDescriptor::activation(relu));
+    alexnet.add_layer(LayerDescriptor::pooling(max_pool));
+    alexnet.add_layer(LayerDescriptor::normalization(lrn));
+    alexnet.add_layer(LayerDescriptor::convolution(3, 384, PadStrideInfo(1, 1, 1, 1)));
+    alexnet.add_layer(LayerDescriptor::activation(relu));
+    alexnet.add_layer(LayerDescriptor::convolution(3, 384, PadStrideInfo(1, 1, 1, 1), true, 2));
+    alexnet.add_layer(LayerDescriptor::activation(relu));
+    alexnet.add_layer(LayerDescriptor::convolution(3, 256, PadStrideInfo(1, 1, 1, 1), true, 2));
+    alexnet.add_layer(LayerDescriptor::activation(relu));
+    alexnet.add_layer(LayerDescriptor::pooling(max_pool));
+    alexnet.add_layer(LayerDescriptor::fully_connected(num_labels));
+    alexnet.add_layer(LayerDescriptor::softmax());
+
+    ModelFile model;
+    model.map(argv[2]);
+    alexnet.configure(&model, true);
+
+    Tensor *const input  = alexnet.input();
+    Tensor *const output = alexnet.output();
+
+    // The slots have the same info as the input of the network, padding included: an image is copied with a single memcpy
+    PrefetchingLoader loader(load_dataset_list(argv[1]), *input->info(), num_slots, num_workers, mean, scale);
+
+    size_t num_images = 0;
+    size_t num_top1   = 0;
+    size_t num_top5   = 0;
+
+    std::vector<unsigned int> classes(output->info()->dimension(0));
+
+    const auto start = std::chrono::steady_clock::now();
+
+    unsigned int  label = 0;
+    const Tensor *image = nullptr;
+
+    while((image = loader.acquire(label)) != nullptr)
+    {
+        std::memcpy(input->buffer(), image->buffer(), input->info()->total_size());
+
+        // The workers can load the next images in this slot while the network runs
+        loader.release();
+
+        alexnet.run();
+
+        // Sort the classes by decreasing score: only the first 5 are needed
+        const auto scores = reinterpret_cast<const float *>(output->buffer() + output->info()->offset_first_element_in_bytes());
+        const auto top_k  = std::min<size_t>(5, classes.size());
+
+        std::iota(classes.begin(), classes.end(), 0);
+        std::partial_sort(classes.begin(), classes.begin() + top_k, classes.end(), [&](unsigned int a, unsigned int b)
+        {
+            return scores[a] > scores[b];
+        });
+
+        num_top1 += classes[0] == label;
+        num_top5 += std::find(classes.begin(), classes.begin() + top_k, label) != classes.begin() + top_k;
+        ++num_images;
+    }
+
+    const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+    std::cout << "Images: " << num_images << "\n";
+    if(num_images != 0)
+    {
+        std::cout << "Top-1 accuracy: " << 100.0 * num_top1 / num_images << " %\n";
+        std::cout << "Top-5 accuracy: " << 100.0 * num_top5 / num_images << " %\n";
+        std::cout << "Throughput: " << num_images / elapsed.count() << " images/s\n";
+    }
+}
+
+/** Main program for the AlexNet evaluation
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( Dataset list, model file, [optional] number of images loaded in advance, [optional] number of loading threads, [optional] mean, [optional] scale )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neon_alexnet_evaluation);
+}
@@ -29,6 +29,7 @@
 
 #include <cstring>
 #include <iostream>
+#include <memory>
 
 using namespace arm_compute;
 
@@ -136,6 +137,18 @@ void main_neon_copy_objects(int argc, const char **argv)
     },
     output_it);
 
+    // Simplest and most efficient way: wrap the destination buffer in a tensor without padding and copy the output tensor to it:
+    // NECopy copies the rows with all the threads, or the whole buffer with a single memcpy if the output has no padding either
+    Tensor dst_tensor;
+    dst_tensor.allocator()->init(TensorInfo(shape, 1, DataType::F32));
+    dst_tensor.allocator()->import_memory(std::shared_ptr<uint8_t>(reinterpret_cast<uint8_t *>(dst_data), [](uint8_t *)
+    {
+    }));
+
+    NECopy copy;
+    copy.configure(&output, &dst_tensor);
+    copy.run();
+
     delete[] src_data;
     delete[] dst_data;
     /** [Copy objects example] */
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMInterleave4x4Kernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
+#include "arm_compute/core/NEON/kernels/NEGEMMTranspose1xWKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "test_helpers/Utils.h"
+
+#include <cstring>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+namespace
+{
+/** Fill a F32 matrix with values in [-1, 1) from a linear congruential generator */
+void fill_matrix(Tensor &tensor, unsigned int seed)
+{
+    for(unsigned int y = 0; y < tensor.info()->dimension(1); ++y)
+    {
+        auto row = reinterpret_cast<float *>(tensor.buffer() + tensor.info()->offset_element_in_bytes(Coordinates(0, static_cast<int>(y))));
+        for(unsigned int x = 0; x < tensor.info()->dimension(0); ++x)
+        {
+            seed   = seed * 1664525u + 1013904223u;
+            row[x] = static_cast<float>(seed >> 8) / static_cast<float>(1u << 23) - 1.f;
+        }
+    }
+}
+
+/** Copy the elements of a F32 matrix, without its padding */
+std::vector<float> copy_matrix(const Tensor &tensor)
+{
+    const size_t       width = tensor.info()->dimension(0);
+    std::vector<float> values(width * tensor.info()->dimension(1));
+
+    for(unsigned int y = 0; y < tensor.info()->dimension(1); ++y)
+    {
+        std::memcpy(values.data() + y * width, tensor.buffer() + tensor.info()->offset_element_in_bytes(Coordinates(0, static_cast<int>(y))), width * sizeof(float));
+    }
+    return values;
+}
+} // namespace
+
+void main_neon_gemm_split_check(int argc, const char **argv)
+{
+    ARM_COMPUTE_UNUSED(argc);
+    ARM_COMPUTE_UNUSED(argv);
+
+    // Few rows and many columns, so that the scheduler splits the window in a grid along X as well
+    constexpr unsigned int M = 8;
+    constexpr unsigned int K = 33;
+    constexpr unsigned int N = 200;
+
+    Tensor a, b, tmp_a, tmp_b, dst;
+    a.allocator()->init(TensorInfo(TensorShape(K, M), 1, DataType::F32));
+    b.allocator()->init(TensorInfo(TensorShape(N, K), 1, DataType::F32));
+    tmp_a.allocator()->init(TensorInfo(TensorShape(K * 4, (M + 3) / 4), 1, DataType::F32));
+    tmp_b.allocator()->init(TensorInfo(TensorShape(K * 4, (N + 3) / 4), 1, DataType::F32));
+    dst.allocator()->init(TensorInfo(TensorShape(N, M), 1, DataType::F32));
+
+    NEGEMMInterleave4x4Kernel  interleave;
+    NEGEMMTranspose1xWKernel   transpose;
+    NEGEMMMatrixMultiplyKernel mm;
+    interleave.configure(&a, &tmp_a);
+    transpose.configure(&b, &tmp_b);
+    mm.configure(&tmp_a, &tmp_b, &dst, 1.f);
+
+    a.allocator()->allocate();
+    b.allocator()->allocate();
+    tmp_a.allocator()->allocate();
+    tmp_b.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    fill_matrix(a, 1);
+    fill_matrix(b, 2);
+    interleave.run(interleave.window());
+    transpose.run(transpose.window());
+
+    // Reference: the whole window on the calling thread
+    mm.run(mm.window());
+    const std::vector<float> reference = copy_matrix(dst);
+
+    // Every sub-window computes its elements in the same order as the whole window: the results must be the same bit for bit
+    const auto check = [&](const char *what)
+    {
+        const std::vector<float> values = copy_matrix(dst);
+        if(std::memcmp(values.data(), reference.data(), values.size() * sizeof(float)) != 0)
+        {
+            ARM_COMPUTE_ERROR("%s doesn't match the single thread result", what);
+        }
+        std::cout << what << ": OK\n";
+    };
+
+    const Window &max_window = mm.window();
+    for(unsigned int num_parts = 2; num_parts <= max_window.num_iterations(Window::DimX); num_parts *= 2)
+    {
+        std::memset(dst.buffer(), 0, dst.info()->total_size());
+        for(unsigned int part = 0; part < num_parts; ++part)
+        {
+            mm.run(max_window.split_window(Window::DimX, part, num_parts));
+        }
+        check(("Split in " + std::to_string(num_parts) + " parts along X").c_str());
+    }
+
+    // The scheduler splits the window in the grid returned by NEGEMMMatrixMultiplyKernel::split_parts_x()
+    NEScheduler::get().force_number_of_threads(4);
+    std::memset(dst.buffer(), 0, dst.info()->total_size());
+    NEScheduler::get().multithread(&mm);
+    check("Run by the scheduler on 4 threads");
+}
+
+/** Main program checking that the matrix multiplication gives the same result whatever the split of its window along X
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( None )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neon_gemm_split_check);
+}
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/NEON/functions/NEIntegralImage.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "test_helpers/Utils.h"
+
+#include <string>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+void main_neon_integral_image_check(int argc, const char **argv)
+{
+    ARM_COMPUTE_UNUSED(argc);
+    ARM_COMPUTE_UNUSED(argv);
+
+    // Narrow image: the vertical pass has fewer iterations along X than threads, but must still not be split along Y
+    constexpr unsigned int width  = 40;
+    constexpr unsigned int height = 64;
+
+    Tensor src, dst;
+    src.allocator()->init(TensorInfo(TensorShape(width, height), Format::U8));
+    dst.allocator()->init(TensorInfo(TensorShape(width, height), Format::U32));
+
+    NEIntegralImage integral;
+    integral.configure(&src, &dst);
+
+    src.allocator()->allocate();
+    dst.allocator()->allocate();
+
+    // Reference: the sum of the pixels above and on the left of each pixel, included
+    unsigned int          seed = 1;
+    std::vector<uint32_t> reference(width * height);
+    for(unsigned int y = 0; y < height; ++y)
+    {
+        uint32_t row_sum = 0;
+        for(unsigned int x = 0; x < width; ++x)
+        {
+            seed = seed * 1664525u + 1013904223u;
+
+            const uint8_t value = static_cast<uint8_t>(seed >> 24);
+            *(src.buffer() + src.info()->offset_element_in_bytes(Coordinates(static_cast<int>(x), static_cast<int>(y)))) = value;
+
+            row_sum += value;
+            reference[y * width + x] = row_sum + (y > 0 ? reference[(y - 1) * width + x] : 0);
+        }
+    }
+
+    for(unsigned int num_threads = 1; num_threads <= 8; num_threads *= 2)
+    {
+        NEScheduler::get().force_number_of_threads(num_threads);
+
+        // Run several times to give a race between the threads a chance to show
+        for(unsigned int run = 0; run < 16; ++run)
+        {
+            integral.run();
+
+            for(unsigned int y = 0; y < height; ++y)
+            {
+                for(unsigned int x = 0; x < width; ++x)
+                {
+                    const uint32_t value = *reinterpret_cast<uint32_t *>(dst.buffer() + dst.info()->offset_element_in_bytes(Coordinates(static_cast<int>(x), static_cast<int>(y))));
+                    if(value != reference[y * width + x])
+                    {
+                        ARM_COMPUTE_ERROR("Wrong integral at (%u, %u) on %u threads: %u instead of %u", x, y, num_threads, value, reference[y * width + x]);
+                    }
+                }
+            }
+        }
+        std::cout << "Integral image on " << num_threads << " threads: OK\n";
+    }
+}
+
+/** Main program checking the integral image of a narrow image computed by several threads
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( None )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neon_integral_image_check);
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "test_helpers/Utils.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+namespace
+{
+/** Fill a tensor with values from a linear congruential generator: in [-1, 1) for F32, any value for U8 and in [-256, 256) for S32 */
+void fill_tensor(Tensor &tensor, unsigned int seed)
+{
+    Window window;
+    window.use_tensor_dimensions(tensor.info());
+
+    Iterator it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        seed = seed * 1664525u + 1013904223u;
+        switch(tensor.info()->data_type())
+        {
+            case DataType::F32:
+                *reinterpret_cast<float *>(it.ptr()) = static_cast<float>(seed >> 8) / static_cast<float>(1u << 23) - 1.f;
+                break;
+            case DataType::U8:
+                *it.ptr() = static_cast<uint8_t>(seed >> 24);
+                break;
+            case DataType::S32:
+                *reinterpret_cast<int32_t *>(it.ptr()) = static_cast<int32_t>(seed >> 23) - 256;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+        }
+    },
+    it);
+}
+
+/** Copy the elements of a tensor, without its padding */
+std::vector<uint8_t> copy_tensor(const Tensor &tensor)
+{
+    const size_t row_size = tensor.info()->dimension(0) * tensor.info()->element_size();
+
+    Window window;
+    window.use_tensor_dimensions(tensor.info());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    std::vector<uint8_t> values;
+    Iterator             it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        values.insert(values.end(), it.ptr(), it.ptr() + row_size);
+    },
+    it);
+
+    return values;
+}
+
+/** Compare the output of a convolution computed in bands of rows with the output of run()
+ *
+ * @param[in] data_type Data type of the input, F32 or U8.
+ * @param[in] band_rows Number of rows of each band.
+ */
+void check_tiled_convolution(DataType data_type, unsigned int band_rows)
+{
+    const bool is_quantized = data_type == DataType::U8;
+
+    // 27 columns: the bands don't start on a multiple of the 16 output elements computed by each iteration of the matrix multiplication.
+    // The direct convolution doesn't support 7x7 kernels, so the heuristics pick im2col and a matrix multiplication
+    TensorInfo input_info(TensorShape(27U, 27U, 8U), 1, data_type);
+    TensorInfo weights_info(TensorShape(7U, 7U, 8U, 16U), 1, data_type);
+    TensorInfo biases_info(TensorShape(16U), 1, is_quantized ? DataType::S32 : data_type);
+    TensorInfo output_info(TensorShape(27U, 27U, 16U), 1, data_type);
+
+    if(is_quantized)
+    {
+        input_info.set_quantization_info(QuantizationInfo(0.02f, 128));
+        weights_info.set_quantization_info(QuantizationInfo(0.01f, 120));
+        output_info.set_quantization_info(QuantizationInfo(0.5f, 100));
+    }
+
+    Tensor input, weights, biases, output;
+    input.allocator()->init(input_info);
+    weights.allocator()->init(weights_info);
+    biases.allocator()->init(biases_info);
+    output.allocator()->init(output_info);
+
+    NEConvolutionLayer conv;
+    conv.configure(&input, &weights, &biases, &output, PadStrideInfo(1, 1, 3, 3));
+    ARM_COMPUTE_ERROR_ON_MSG(!conv.is_tileable(), "The convolution doesn't run as a matrix multiplication of the im2col output");
+
+    input.allocator()->allocate();
+    weights.allocator()->allocate();
+    biases.allocator()->allocate();
+    output.allocator()->allocate();
+
+    fill_tensor(input, 1);
+    fill_tensor(weights, 2);
+    fill_tensor(biases, 3);
+
+    conv.run();
+    const std::vector<uint8_t> reference = copy_tensor(output);
+
+    std::memset(output.buffer(), 0, output.info()->total_size());
+    conv.prepare_tiles();
+    for(unsigned int row = 0; row < output_info.dimension(1); row += band_rows)
+    {
+        conv.run_tile(row, std::min<unsigned int>(row + band_rows, output_info.dimension(1)));
+    }
+
+    // The elements of a band are computed in the same order as by run(): the results must be the same bit for bit
+    const std::string what = std::string(is_quantized ? "U8" : "F32") + " convolution in bands of " + std::to_string(band_rows) + " rows";
+    if(copy_tensor(output) != reference)
+    {
+        ARM_COMPUTE_ERROR("%s doesn't match the untiled result", what.c_str());
+    }
+    std::cout << what << ": OK\n";
+}
+} // namespace
+
+void main_neon_tiled_convolution_check(int argc, const char **argv)
+{
+    ARM_COMPUTE_UNUSED(argc);
+    ARM_COMPUTE_UNUSED(argv);
+
+    for(unsigned int band_rows : { 1u, 3u, 5u, 27u })
+    {
+        check_tiled_convolution(DataType::F32, band_rows);
+        check_tiled_convolution(DataType::U8, band_rows);
+    }
+}
+
+/** Main program checking that a convolution computed in bands of rows gives the same output as the whole convolution
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( None )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neon_tiled_convolution_check);
+}
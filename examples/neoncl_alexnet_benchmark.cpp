@@ -0,0 +1,807 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#define ARM_COMPUTE_CL /* So that OpenCL exceptions get caught too */
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/StartupProfiler.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CL/CLFramePipeline.h"
+#include "arm_compute/runtime/CL/CLFunctions.h"
+#include "arm_compute/runtime/CL/CLHybridPipeline.h"
+#include "arm_compute/runtime/CL/CLMemoryPlanner.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTuner.h"
+#include "arm_compute/runtime/HugePageAllocator.h"
+#include "arm_compute/runtime/ModelFile.h"
+#include "arm_compute/runtime/NEON/NEFramePipeline.h"
+#include "arm_compute/runtime/NEON/NENetwork.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/Profiler.h"
+#include "arm_compute/runtime/Tensor.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+#include "test_helpers/Utils.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+using namespace arm_compute;
+using namespace test_helpers;
+
+namespace
+{
+/** Command line options of the benchmark */
+struct Options
+{
+    std::string backend;    /**< "neon", "cl" or "hybrid" */
+    int         threads;    /**< Number of CPU threads, 0 to use the default number of threads of the scheduler */
+    int         warmup;     /**< Number of runs before the measurements */
+    int         iterations; /**< Number of measured runs */
+    bool        profile;    /**< Print the per-layer breakdown */
+    std::string tuner_file; /**< Local workgroup size tuning table (cl and hybrid only), empty to not use the tuner */
+    int         split;      /**< Number of layers running on OpenCL before the switch to NEON (hybrid only) */
+    int         stream;     /**< Number of staging buffers of the frame pipeline, 0 to not measure the throughput of a stream of frames (neon and cl only) */
+    bool        image;      /**< Store the weights of the OpenCL convolutions in images (cl and hybrid only) */
+    bool        counters;   /**< Add the hardware counters of the CPU threads to the per-layer breakdown */
+    bool        startup;    /**< Print the breakdown of the time spent from the creation of the network to the end of its first run */
+    std::string plan_file;  /**< Execution plan of the network (neon only): loaded if it exists, written at the end otherwise. Empty to configure the network */
+    bool        huge_pages; /**< Map the large tensors on huge pages and pre-fault them on allocation (neon only) */
+};
+
+/** Print the usage of the benchmark
+ *
+ * @param[in] name Name of the binary.
+ */
+void print_usage(const char *name)
+{
+    std::cout << "Usage: " << name << " [--backend=neon|cl|hybrid] [--threads=N] [--warmup=N] [--iterations=N] [--no-profile] [--tuner=FILE] [--split=N] [--stream=N] [--image-weights] [--counters] [--startup] [--plan=FILE] [--huge-pages]\n\n"
+              << "  --backend     Backend running the network. Defaults to neon. hybrid runs the first layers on OpenCL and the others on NEON.\n"
+              << "  --threads     Number of CPU threads (neon and hybrid only). Defaults to the number of cores.\n"
+              << "  --warmup      Number of runs before the measurements. Defaults to 5.\n"
+              << "  --iterations  Number of measured runs. Defaults to 50.\n"
+              << "  --no-profile  Don't run the extra profiled iterations which give the per-layer breakdown.\n"
+              << "  --tuner       Local workgroup size tuning table (cl and hybrid only): loaded if it exists, the new configurations are tuned\n"
+              << "                during the first warmup run and the table is saved back at the end.\n"
+              << "  --split       Number of layers running on OpenCL (hybrid only). Defaults to 8, i.e. conv_1 and conv_2.\n"
+              << "  --stream      Also measure the throughput of a stream of frames whose upload and readback overlap the computation,\n"
+              << "                with N staging buffers (neon and cl only, neon always uses 2).\n"
+              << "  --image-weights Read the weights of the OpenCL convolutions through the texture cache (cl and hybrid only).\n"
+              << "  --counters    Add the IPC, cache misses and stalled cycles of the CPU kernels to the per-layer breakdown (Linux only).\n"
+              << "  --startup     Print where the time goes from the creation of the network to the end of its first run: configure, allocate,\n"
+              << "                program builds (with the binary cache hits), weights and one-time work of the first run.\n"
+              << "  --plan        Execution plan of the network (neon only): if the file exists the network is loaded from it, with its reshaped\n"
+              << "                weights, otherwise the network is configured as usual and its plan is written to the file at the end.\n"
+              << "  --huge-pages  Map the tensors of at least 2MB on huge pages and take their page faults while allocating (neon only).\n";
+}
+
+/** Parse the command line
+ *
+ * @param[in]      argc    Number of arguments.
+ * @param[in]      argv    Arguments.
+ * @param[in, out] options Default options, overridden by the arguments.
+ *
+ * @return False if an argument is not valid.
+ */
+bool parse_options(int argc, const char **argv, Options &options)
+{
+    for(int i = 1; i < argc; ++i)
+    {
+        const std::string arg(argv[i]);
+        const size_t      eq    = arg.find('=');
+        const std::string name  = arg.substr(0, eq);
+        const std::string value = (eq == std::string::npos) ? "" : arg.substr(eq + 1);
+
+        if(name == "--backend" && (value == "neon" || value == "cl" || value == "hybrid"))
+        {
+            options.backend = value;
+        }
+        else if(name == "--threads" && !value.empty())
+        {
+            options.threads = std::atoi(value.c_str());
+        }
+        else if(name == "--warmup" && !value.empty())
+        {
+            options.warmup = std::atoi(value.c_str());
+        }
+        else if(name == "--iterations" && !value.empty())
+        {
+            options.iterations = std::atoi(value.c_str());
+        }
+        else if(name == "--no-profile")
+        {
+            options.profile = false;
+        }
+        else if(name == "--tuner" && !value.empty())
+        {
+            options.tuner_file = value;
+        }
+        else if(name == "--split" && !value.empty())
+        {
+            options.split = std::atoi(value.c_str());
+        }
+        else if(name == "--stream" && !value.empty())
+        {
+            options.stream = std::atoi(value.c_str());
+        }
+        else if(name == "--image-weights")
+        {
+            options.image = true;
+        }
+        else if(name == "--counters")
+        {
+            options.counters = true;
+        }
+        else if(name == "--startup")
+        {
+            options.startup = true;
+        }
+        else if(name == "--plan" && !value.empty())
+        {
+            options.plan_file = value;
+        }
+        else if(name == "--huge-pages")
+        {
+            options.huge_pages = true;
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    return options.threads >= 0 && options.warmup >= 0 && options.iterations > 0 && options.split > 0 && options.stream >= 0;
+}
+
+/** Describe AlexNet without the fc_6 and fc_7 layers, like alexnet_without_fc6_and_fc7_arm_compute_library.cpp
+ *
+ * @return The layers of the network in execution order.
+ */
+std::vector<LayerDescriptor> alexnet_layers()
+{
+    const ActivationLayerInfo    relu(ActivationLayerInfo::ActivationFunction::RELU);
+    const PoolingLayerInfo       max_pool(PoolingType::MAX, 3, PadStrideInfo(2, 2));
+    const NormalizationLayerInfo lrn(NormType::CROSS_MAP, 5, 0.0001f, 0.75f);
+
+    return std::vector<LayerDescriptor>
+    {
+        // conv_1: 227 * 227 * 3 -> 55 * 55 * 96 -> 27 * 27 * 96
+        LayerDescriptor::convolution(11, 96, PadStrideInfo(4, 4, 0, 0)),
+        LayerDescriptor::activation(relu),
+        LayerDescriptor::pooling(max_pool),
+        LayerDescriptor::normalization(lrn),
+        // conv_2: 27 * 27 * 96 -> 27 * 27 * 256 (2 groups) -> 13 * 13 * 256
+        LayerDescriptor::convolution(5, 256, PadStrideInfo(1, 1, 2, 2), true, 2),
+        LayerDescriptor::activation(relu),
+        LayerDescriptor::pooling(max_pool),
+        LayerDescriptor::normalization(lrn),
+        // conv_3: 13 * 13 * 256 -> 13 * 13 * 384
+        LayerDescriptor::convolution(3, 384, PadStrideInfo(1, 1, 1, 1)),
+        LayerDescriptor::activation(relu),
+        // conv_4: 13 * 13 * 384 -> 13 * 13 * 384 (2 groups)
+        LayerDescriptor::convolution(3, 384, PadStrideInfo(1, 1, 1, 1), true, 2),
+        LayerDescriptor::activation(relu),
+        // conv_5: 13 * 13 * 384 -> 13 * 13 * 256 (2 groups) -> 6 * 6 * 256
+        LayerDescriptor::convolution(3, 256, PadStrideInfo(1, 1, 1, 1), true, 2),
+        LayerDescriptor::activation(relu),
+        LayerDescriptor::pooling(max_pool),
+        // fc_8: 6 * 6 * 256 -> 100
+        LayerDescriptor::fully_connected(100),
+        LayerDescriptor::softmax(),
+    };
+}
+
+/** Fill a tensor with a constant value
+ *
+ * @param[in, out] tensor Tensor to fill. Must be mapped if it is an OpenCL tensor.
+ * @param[in]      value  Value to write in every element.
+ */
+void fill(ITensor *tensor, float value)
+{
+    Window window;
+    window.use_tensor_dimensions(tensor->info());
+
+    Iterator it(tensor, window);
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        *reinterpret_cast<float *>(it.ptr()) = value;
+    },
+    it);
+}
+
+/** Configure a NEON network and fill its weights, biases and input
+ *
+ * @param[out] network     Network to configure.
+ * @param[in]  input_shape Shape of the input of the network.
+ * @param[in]  layers      Layers of the network in execution order.
+ */
+void configure_neon_network(NENetwork &network, const TensorShape &input_shape, const std::vector<LayerDescriptor> &layers)
+{
+    network.init(TensorInfo(input_shape, 1, DataType::F32));
+    for(const auto &layer : layers)
+    {
+        network.add_layer(layer);
+    }
+    network.configure();
+
+    const StartupFunctionScope function_scope("neon network");
+    const StartupScope         weights_scope(StartupStage::WEIGHTS_LOAD, "fill");
+
+    for(unsigned int i = 0; i < network.num_layers(); ++i)
+    {
+        if(network.weights(i) != nullptr)
+        {
+            fill(network.weights(i), 0.01f);
+        }
+        if(network.biases(i) != nullptr)
+        {
+            fill(network.biases(i), 0.f);
+        }
+    }
+    fill(network.input(), 1.f);
+}
+
+/** AlexNet made of OpenCL functions: the OpenCL backend has no network object */
+class CLAlexNet : public IFunction
+{
+public:
+    /** Create the tensors and configure the functions of the layers
+     *
+     * @note The OpenCL convolution layer doesn't support groups: the grouped convolutions run as dense convolutions.
+     * @note An activation layer following a convolution layer is fused into it, so there can be fewer functions than @p layers.
+     *
+     * @param[in] input_shape Shape of the input of the network.
+     * @param[in] layers      Layers of the network in execution order.
+     * @param[in] image       Store the weights of the convolutions in images.
+     */
+    void configure(const TensorShape &input_shape, const std::vector<LayerDescriptor> &layers, bool image)
+    {
+        _tensors.emplace_back(arm_compute::cpp14::make_unique<CLTensor>());
+        _tensors.back()->allocator()->init(TensorInfo(input_shape, 1, DataType::F32));
+
+        std::vector<CLTensor *> parameters;
+        for(size_t i = 0; i < layers.size(); ++i)
+        {
+            const StartupFunctionScope function_scope("cl:" + std::to_string(i));
+            const StartupScope         configure_scope(StartupStage::CONFIGURE);
+
+            const LayerDescriptor &desc   = layers[i];
+            CLTensor              *input  = _tensors.back().get();
+            TensorShape            shape  = input->info()->tensor_shape();
+            CLTensor              *output = new_tensor();
+
+            switch(desc.type)
+            {
+                case LayerType::CONVOLUTION:
+                {
+                    unsigned int stride_x, stride_y, pad_x, pad_y = 0;
+                    std::tie(stride_x, stride_y) = desc.conv_info.stride();
+                    std::tie(pad_x, pad_y)       = desc.conv_info.pad();
+
+                    unsigned int conv_w, conv_h = 0;
+                    std::tie(conv_w, conv_h) = scaled_dimensions(shape.x(), shape.y(), desc.kernel_size, stride_x, stride_y, pad_x, pad_y, desc.conv_info.round());
+
+                    CLTensor *weights = parameter(TensorShape(desc.kernel_size, desc.kernel_size, shape.z(), desc.num_outputs), parameters);
+                    CLTensor *biases  = parameter(TensorShape(desc.num_outputs), parameters);
+
+                    shape.set(0, conv_w);
+                    shape.set(1, conv_h);
+                    shape.set(2, desc.num_outputs);
+                    output->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+                    // An activation following the convolution is applied by the convolution's kernels before they store their output
+                    const bool fuse_activation = (i + 1 < layers.size()) && (layers[i + 1].type == LayerType::ACTIVATION);
+
+                    auto f = arm_compute::cpp14::make_unique<CLConvolutionLayer>(_memory_planner);
+                    f->configure(input, weights, biases, output, desc.conv_info, fuse_activation ? layers[i + 1].act_info : ActivationLayerInfo(), image);
+                    add_layer(i, fuse_activation ? "convolution+activation" : "convolution", std::move(f));
+                    if(fuse_activation)
+                    {
+                        ++i;
+                    }
+                    break;
+                }
+                case LayerType::ACTIVATION:
+                {
+                    output->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+                    auto f = arm_compute::cpp14::make_unique<CLActivationLayer>();
+                    f->configure(input, output, desc.act_info);
+                    add_layer(i, "activation", std::move(f));
+                    break;
+                }
+                case LayerType::POOLING:
+                {
+                    unsigned int stride_x, stride_y, pad_x, pad_y = 0;
+                    std::tie(stride_x, stride_y) = desc.pool_info.pad_stride_info().stride();
+                    std::tie(pad_x, pad_y)       = desc.pool_info.pad_stride_info().pad();
+
+                    unsigned int pooled_w, pooled_h = 0;
+                    std::tie(pooled_w, pooled_h) = scaled_dimensions(shape.x(), shape.y(), desc.pool_info.pool_size(), stride_x, stride_y, pad_x, pad_y,
+                                                                     desc.pool_info.pad_stride_info().round());
+
+                    shape.set(0, pooled_w);
+                    shape.set(1, pooled_h);
+                    output->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+                    auto f = arm_compute::cpp14::make_unique<CLPoolingLayer>();
+                    f->configure(input, output, desc.pool_info);
+                    add_layer(i, "pooling", std::move(f));
+                    break;
+                }
+                case LayerType::NORMALIZATION:
+                {
+                    output->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+                    auto f = arm_compute::cpp14::make_unique<CLNormalizationLayer>();
+                    f->configure(input, output, desc.norm_info);
+                    add_layer(i, "normalization", std::move(f));
+                    break;
+                }
+                case LayerType::FULLY_CONNECTED:
+                {
+                    CLTensor *weights = parameter(TensorShape(shape.total_size(), desc.num_outputs), parameters);
+                    CLTensor *biases  = parameter(TensorShape(desc.num_outputs), parameters);
+
+                    output->allocator()->init(TensorInfo(TensorShape(desc.num_outputs), 1, DataType::F32));
+
+                    auto f = arm_compute::cpp14::make_unique<CLFullyConnectedLayer>();
+                    f->configure(input, weights, biases, output);
+                    add_layer(i, "fully_connected", std::move(f));
+                    break;
+                }
+                case LayerType::SOFTMAX:
+                {
+                    output->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+
+                    auto f = arm_compute::cpp14::make_unique<CLSoftmaxLayer>();
+                    f->configure(input, output);
+                    add_layer(i, "softmax", std::move(f));
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("Layer type not supported");
+            }
+        }
+
+        const StartupFunctionScope function_scope("cl network");
+
+        for(auto &tensor : _tensors)
+        {
+            tensor->allocator()->allocate();
+        }
+
+        // The intermediate tensors of the convolutions share a single buffer
+        _memory_planner->allocate();
+
+        // Fill the weights with a constant value and the biases with zeros, like the NEON network without model file
+        for(CLTensor *tensor : parameters)
+        {
+            const StartupScope weights_scope(StartupStage::WEIGHTS_LOAD, "fill", tensor->info()->total_size());
+            tensor->map();
+            fill(tensor, tensor->info()->num_dimensions() == 1 ? 0.f : 0.01f);
+            tensor->unmap();
+        }
+    }
+    /** Return the input tensor of the network
+     *
+     * @return The input tensor
+     */
+    CLTensor *input()
+    {
+        return _tensors.front().get();
+    }
+    /** Return the output tensor of the network
+     *
+     * @return The output tensor
+     */
+    CLTensor *output()
+    {
+        return _tensors.back().get();
+    }
+    /** Append the layers to a hybrid pipeline
+     *
+     * @param[in, out] pipeline Pipeline to append the layers to.
+     */
+    void add_stages(CLHybridPipeline &pipeline)
+    {
+        for(size_t i = 0; i < _layers.size(); ++i)
+        {
+            pipeline.add_cl_stage(_layers[i].second.get(), _tensors[i].get(), _tensors[i + 1].get());
+        }
+    }
+    /** Enqueue the layers: the caller must synchronise the queue before reading the output */
+    void run() override
+    {
+        const bool is_profiling = Profiler::get().is_enabled();
+
+        {
+            // Flush the queue once for the whole network instead of once per kernel
+            CLScopedBatch batch;
+
+            for(auto &layer : _layers)
+            {
+                if(is_profiling)
+                {
+                    Profiler::get().set_layer(layer.first);
+                }
+                layer.second->run();
+            }
+        }
+
+        if(is_profiling)
+        {
+            Profiler::get().set_layer("");
+        }
+    }
+
+private:
+    /** Create the output tensor of a layer
+     *
+     * @return The tensor, to be initialised by the layer
+     */
+    CLTensor *new_tensor()
+    {
+        _tensors.emplace_back(arm_compute::cpp14::make_unique<CLTensor>());
+        return _tensors.back().get();
+    }
+    /** Create a weights or biases tensor
+     *
+     * @param[in]      shape      Shape of the tensor.
+     * @param[in, out] parameters List of the tensors to fill, the new tensor is appended to it.
+     *
+     * @return The tensor
+     */
+    CLTensor *parameter(const TensorShape &shape, std::vector<CLTensor *> &parameters)
+    {
+        _parameters.emplace_back(arm_compute::cpp14::make_unique<CLTensor>());
+        _parameters.back()->allocator()->init(TensorInfo(shape, 1, DataType::F32));
+        parameters.push_back(_parameters.back().get());
+        return _parameters.back().get();
+    }
+    /** Append a configured function to the list of layers to run
+     *
+     * @param[in] index    Index of the layer in the network.
+     * @param[in] type     Type of the layer, used to name it in the profiling report.
+     * @param[in] function Function running the layer.
+     */
+    void add_layer(size_t index, const std::string &type, std::unique_ptr<IFunction> function)
+    {
+        _layers.emplace_back(std::to_string(index) + ":" + type, std::move(function));
+    }
+
+    std::shared_ptr<CLMemoryPlanner>       _memory_planner{ std::make_shared<CLMemoryPlanner>() }; /**< Memory of the intermediate tensors of the layers */
+    std::vector<std::unique_ptr<CLTensor>> _tensors{};                                          /**< Input and outputs of the layers, in execution order */
+    std::vector<std::unique_ptr<CLTensor>> _parameters{}; /**< Weights and biases of the layers */
+    std::vector<std::pair<std::string, std::unique_ptr<IFunction>>> _layers{};   /**< Name and function of each layer, in execution order */
+};
+
+/** Print the statistics of the measured run times
+ *
+ * @param[in] times Run time of each measured iteration, in microseconds.
+ */
+void print_statistics(std::vector<double> times)
+{
+    std::sort(times.begin(), times.end());
+
+    // Nearest-rank percentile
+    const auto percentile = [&](double p)
+    {
+        const size_t rank = static_cast<size_t>(std::ceil(p * times.size()));
+        return times[std::max<size_t>(rank, 1) - 1];
+    };
+
+    const std::ios_base::fmtflags flags = std::cout.flags();
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "Iterations: " << times.size() << "\n"
+              << "min:    " << std::setw(12) << times.front() << " us\n"
+              << "median: " << std::setw(12) << percentile(0.5) << " us\n"
+              << "p90:    " << std::setw(12) << percentile(0.9) << " us\n"
+              << "p99:    " << std::setw(12) << percentile(0.99) << " us\n"
+              << "max:    " << std::setw(12) << times.back() << " us\n";
+    std::cout.flags(flags);
+}
+
+/** Print the throughput of a stream of frames
+ *
+ * @param[in] label      Name of the measurement.
+ * @param[in] num_frames Number of frames processed.
+ * @param[in] run        Function processing the frames and returning once they have all completed.
+ */
+void measure_throughput(const std::string &label, int num_frames, const std::function<void()> &run)
+{
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const auto end = std::chrono::steady_clock::now();
+
+    const double                  total_us = std::chrono::duration<double, std::micro>(end - start).count();
+    const std::ios_base::fmtflags flags    = std::cout.flags();
+    std::cout << std::fixed << std::setprecision(1);
+    std::cout << "\n" << label << ": " << num_frames << " frames in " << total_us << " us, " << (num_frames * 1e6 / total_us) << " frames/s\n";
+    std::cout.flags(flags);
+}
+
+/** Run the warmup iterations, the measured iterations and optionally the profiled iterations of a network
+ *
+ * @param[in] options Command line options.
+ * @param[in] run     Function running one inference and returning once it has completed.
+ */
+void benchmark(const Options &options, const std::function<void()> &run)
+{
+    // The first run absorbs the one-time work of the functions: it ends the startup session
+    if(StartupProfiler::get().is_enabled())
+    {
+        {
+            const StartupFunctionScope function_scope("first run");
+            const StartupScope         first_run_scope(StartupStage::FIRST_RUN);
+            run();
+        }
+        StartupProfiler::get().stop();
+
+        std::cout << "Startup breakdown:\n";
+        StartupProfiler::get().print_report(std::cout);
+        std::cout << "\n";
+    }
+
+    for(int i = 0; i < options.warmup; ++i)
+    {
+        run();
+    }
+
+    std::vector<double> times;
+    times.reserve(options.iterations);
+    for(int i = 0; i < options.iterations; ++i)
+    {
+        const auto start = std::chrono::steady_clock::now();
+        run();
+        const auto end = std::chrono::steady_clock::now();
+        times.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+    }
+    print_statistics(times);
+
+    // Profiling serializes the OpenCL kernels and adds a small overhead to every kernel: the breakdown is measured on separate iterations
+    if(options.profile)
+    {
+        if(options.counters && !Profiler::counters_available())
+        {
+            std::cout << "\nThe hardware counters are not available (see /proc/sys/kernel/perf_event_paranoid)\n";
+        }
+
+        Profiler::get().start(options.counters);
+        for(int i = 0; i < options.iterations; ++i)
+        {
+            run();
+        }
+        Profiler::get().stop();
+
+        std::cout << "\nPer-layer breakdown over " << options.iterations << " iterations:\n";
+        Profiler::get().print_report(std::cout);
+    }
+}
+} // namespace
+
+/** Benchmark of AlexNet without fc_6 and fc_7 on NEON, OpenCL or split between both
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] --backend=neon|cl|hybrid, --threads=N, --warmup=N, --iterations=N, --no-profile, --tuner=FILE, --split=N, --stream=N, --image-weights, --counters, --startup, --plan=FILE, --huge-pages )
+ */
+void main_neoncl_alexnet_benchmark(int argc, const char **argv)
+{
+    Options options{ "neon", 0, 5, 50, true, "", 8, 0, false, false, false, "", false };
+    if(!parse_options(argc, argv, options))
+    {
+        print_usage(argv[0]);
+        return;
+    }
+
+    const TensorShape                  input_shape(227U, 227U, 3U);
+    const std::vector<LayerDescriptor> layers = alexnet_layers();
+
+    // Outlives all the tensors of the benchmark
+    HugePageAllocator huge_page_allocator;
+
+    std::cout << "Backend: " << options.backend << ", warmup: " << options.warmup << ", iterations: " << options.iterations;
+
+    // Covers the creation of the OpenCL context and the configuration of the network: stopped after the first run (See benchmark())
+    if(options.startup)
+    {
+        StartupProfiler::get().start();
+    }
+
+    if(options.backend == "neon")
+    {
+        NEScheduler::get().force_number_of_threads(options.threads);
+        std::cout << ", threads: " << NEScheduler::get().num_threads() << "\n\n";
+
+        // Installed before the network is created so that its tensors and its memory planner use it
+        if(options.huge_pages)
+        {
+            TensorAllocator::set_default_allocator(&huge_page_allocator);
+        }
+
+        // The plan must outlive the network: the weights are mapped from it
+        ModelFile  plan;
+        NENetwork  alexnet;
+        const bool has_plan = !options.plan_file.empty() && std::ifstream(options.plan_file).good();
+        if(has_plan)
+        {
+            plan.map(options.plan_file);
+            if(!alexnet.load_plan(plan))
+            {
+                std::cout << "Some layers picked other algorithms than in the plan: they reshape their weights on the first run\n";
+            }
+            fill(alexnet.input(), 1.f);
+        }
+        else
+        {
+            configure_neon_network(alexnet, input_shape, layers);
+        }
+
+        benchmark(options, [&]()
+        {
+            alexnet.run();
+        });
+
+        if(!options.plan_file.empty() && !has_plan)
+        {
+            alexnet.save_plan(options.plan_file);
+        }
+
+        if(options.stream > 0)
+        {
+            NEFramePipeline stream;
+            stream.configure(&alexnet, alexnet.input(), alexnet.output());
+
+            measure_throughput("Stream", options.iterations, [&]()
+            {
+                stream.run(options.iterations, [](unsigned int, ITensor & input)
+                {
+                    fill(&input, 1.f);
+                },
+                [](unsigned int, ITensor &)
+                {
+                });
+            });
+        }
+    }
+    else
+    {
+        CLScheduler::get().default_init();
+
+        CLTuner tuner;
+        if(!options.tuner_file.empty())
+        {
+            std::ifstream table(options.tuner_file);
+            tuner.load(table);
+            CLScheduler::get().set_tuner(&tuner);
+            std::cout << "Tuner: " << tuner.lws_table().size() << " configurations loaded from " << options.tuner_file << "\n";
+        }
+
+        std::cout << "\nNote: the OpenCL convolution layer doesn't support groups, the grouped convolutions on OpenCL run as dense convolutions\n";
+
+        if(options.backend == "cl")
+        {
+            std::cout << "\n";
+
+            CLAlexNet alexnet;
+            alexnet.configure(input_shape, layers, options.image);
+
+            alexnet.input()->map();
+            fill(alexnet.input(), 1.f);
+            alexnet.input()->unmap();
+
+            benchmark(options, [&]()
+            {
+                alexnet.run();
+                CLScheduler::get().sync();
+            });
+
+            if(options.stream > 0)
+            {
+                CLFramePipeline stream;
+                stream.configure(&alexnet, alexnet.input(), alexnet.output(), options.stream);
+
+                measure_throughput("Stream", options.iterations, [&]()
+                {
+                    stream.run(options.iterations, [](unsigned int, ITensor & input)
+                    {
+                        fill(&input, 1.f);
+                    },
+                    [](unsigned int, ITensor &)
+                    {
+                    });
+                });
+            }
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(static_cast<size_t>(options.split) >= layers.size(), "At least one layer must run on NEON");
+
+            NEScheduler::get().force_number_of_threads(options.threads);
+            std::cout << "Split: layers [0, " << options.split << ") on OpenCL, [" << options.split << ", " << layers.size() << ") on NEON with "
+                      << NEScheduler::get().num_threads() << " threads\n\n";
+
+            CLAlexNet cl_part;
+            cl_part.configure(input_shape, std::vector<LayerDescriptor>(layers.begin(), layers.begin() + options.split), options.image);
+
+            NENetwork neon_part;
+            configure_neon_network(neon_part, cl_part.output()->info()->tensor_shape(), std::vector<LayerDescriptor>(layers.begin() + options.split, layers.end()));
+
+            CLHybridPipeline pipeline;
+            cl_part.add_stages(pipeline);
+            pipeline.add_cpu_stage(&neon_part, neon_part.input(), neon_part.output());
+
+            const auto fill_input = [&](unsigned int)
+            {
+                fill(cl_part.input(), 1.f);
+            };
+            const auto read_output = [](unsigned int)
+            {
+            };
+
+            cl_part.input()->map();
+            fill(cl_part.input(), 1.f);
+            cl_part.input()->unmap();
+
+            // Latency of a single frame: the OpenCL and NEON parts run one after the other
+            benchmark(options, [&]()
+            {
+                pipeline.run();
+            });
+
+            // Throughput of a stream of frames: the NEON part of a frame overlaps the OpenCL part of the next one
+            measure_throughput("Pipelined", options.iterations, [&]()
+            {
+                pipeline.run_pipelined(options.iterations, fill_input, read_output);
+            });
+        }
+
+        if(!options.tuner_file.empty())
+        {
+            CLScheduler::get().set_tuner();
+            std::ofstream table(options.tuner_file);
+            tuner.save(table);
+        }
+    }
+}
+
+/** Main program for the AlexNet benchmark
+ *
+ * @param[in] argc Number of arguments
+ * @param[in] argv Arguments ( [optional] --backend=neon|cl|hybrid, --threads=N, --warmup=N, --iterations=N, --no-profile, --tuner=FILE, --split=N, --stream=N, --image-weights, --counters, --startup, --plan=FILE, --huge-pages )
+ */
+int main(int argc, const char **argv)
+{
+    return test_helpers::run_example(argc, argv, main_neoncl_alexnet_benchmark);
+}
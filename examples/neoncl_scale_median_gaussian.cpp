@@ -25,6 +25,7 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/runtime/CL/CLFunctions.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLUnifiedTensor.h"
 #include "arm_compute/runtime/NEON/NEFunctions.h"
 #include "test_helpers/Utils.h"
 
@@ -39,8 +40,9 @@ using namespace test_helpers;
 void main_neoncl_scale_median_gaussian(int argc, const char **argv)
 {
     /** [NEON / OpenCL Interop] */
-    PPMLoader ppm;
-    CLImage   src, scale_median, median_gauss, dst;
+    PPMLoader       ppm;
+    CLImage         src, dst;
+    CLUnifiedTensor scale_median, median_gauss;
 
     CLScheduler::get().default_init();
 
@@ -89,16 +91,16 @@ void main_neoncl_scale_median_gaussian(int argc, const char **argv)
     // Enqueue and flush the OpenCL kernel:
     scale.run();
 
-    // Do a blocking map of the input and output buffers of the NEON function:
-    scale_median.map();
-    median_gauss.map();
+    // Hand the input and output of the NEON function over to the CPU: the blocking map waits for the OpenCL kernel, no copy is made
+    scale_median.acquire_for_cpu();
+    median_gauss.acquire_for_cpu();
 
     // Run the NEON function:
     median.run();
 
-    // Unmap the output buffer before it's used again by OpenCL:
-    scale_median.unmap();
-    median_gauss.unmap();
+    // Hand the tensors back to the device before they're used again by OpenCL:
+    scale_median.release_to_device();
+    median_gauss.release_to_device();
 
     // Run the final OpenCL function:
     gauss.run();
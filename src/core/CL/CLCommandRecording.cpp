@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/CLCommandRecording.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+CLCommandRecording *active_recording = nullptr;
+} // namespace
+
+CLCommandRecording::CLCommandRecording()
+    : _commands(), _arguments()
+{
+}
+
+CLCommandRecording::~CLCommandRecording()
+{
+    if(active_recording == this)
+    {
+        active_recording = nullptr;
+    }
+}
+
+void CLCommandRecording::begin()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(active_recording != nullptr, "Another recording is already active");
+
+    _commands.clear();
+    _arguments.clear();
+    active_recording = this;
+}
+
+void CLCommandRecording::end()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(active_recording != this, "The recording is not active");
+
+    active_recording = nullptr;
+
+    const auto is_same = [](const Argument & a, const Argument & b)
+    {
+        return a.size == b.size && a.is_local == b.is_local && a.value == b.value;
+    };
+
+    // When a replay starts, each kernel holds the last arguments set on it by the recorded run or the previous replay
+    std::map<cl_kernel, Arguments> current = std::move(_arguments);
+    _arguments.clear();
+
+    for(auto &command : _commands)
+    {
+        Arguments &held = current[command.kernel()];
+        Arguments  to_set;
+
+        for(auto &argument : command.arguments)
+        {
+            auto it = held.find(argument.first);
+            if(it == held.end() || !is_same(it->second, argument.second))
+            {
+                held[argument.first] = argument.second;
+                to_set.emplace(argument.first, std::move(argument.second));
+            }
+        }
+
+        command.arguments = std::move(to_set);
+    }
+}
+
+bool CLCommandRecording::empty() const
+{
+    return _commands.empty();
+}
+
+size_t CLCommandRecording::size() const
+{
+    return _commands.size();
+}
+
+void CLCommandRecording::replay(cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(active_recording == this, "The recording must be ended before it is replayed");
+
+    for(auto &command : _commands)
+    {
+        for(const auto &argument : command.arguments)
+        {
+            command.kernel.setArg(argument.first, argument.second.size, argument.second.is_local ? nullptr : argument.second.value.data());
+        }
+
+        queue.enqueueNDRangeKernel(command.kernel, cl::NullRange, command.gws, command.lws);
+    }
+}
+
+CLCommandRecording *CLCommandRecording::active()
+{
+    return active_recording;
+}
+
+void CLCommandRecording::record_argument(const cl::Kernel &kernel, unsigned int index, size_t size, const void *value)
+{
+    const auto *bytes = static_cast<const unsigned char *>(value);
+
+    Argument &argument = _arguments[kernel()][index];
+    argument.size      = size;
+    argument.is_local  = (value == nullptr);
+    argument.value.assign(bytes, (value == nullptr) ? bytes : bytes + size);
+}
+
+void CLCommandRecording::record_enqueue(const cl::Kernel &kernel, const cl::NDRange &gws, const cl::NDRange &lws)
+{
+    _commands.push_back(Command{ kernel, _arguments[kernel()], gws, lws });
+}
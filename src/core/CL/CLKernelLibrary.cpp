@@ -24,15 +24,55 @@
 #include "arm_compute/core/CL/CLKernelLibrary.h"
 
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/StartupProfiler.h"
 #include "arm_compute/core/Utils.h"
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
+#include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <unistd.h>
 #include <utility>
 #include <vector>
 
 using namespace arm_compute;
 
+namespace
+{
+/** 64-bit FNV-1a hash of a string: unlike std::hash, it is the same for every process and every standard library
+ *
+ * @param[in] s String to hash.
+ *
+ * @return The hash of @p s.
+ */
+uint64_t fnv1a_hash(const std::string &s)
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for(const char c : s)
+    {
+        hash ^= static_cast<unsigned char>(c);
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
+/** Program to build in the background */
+struct PrecompileJob
+{
+    std::string                program_name;  /**< Name of the program */
+    std::string                build_options; /**< Options to build the program with */
+    std::promise<cl::Program> promise;       /**< Receives the built program */
+};
+} // namespace
+
 Program::Program()
     : _context(), _device(), _is_binary(false), _name(), _source(), _binary()
 {
@@ -43,6 +83,11 @@ Program::Program(cl::Context context, std::string name, std::string source)
 {
 }
 
+uint64_t Program::content_hash() const
+{
+    return _is_binary ? fnv1a_hash(std::string(_binary.begin(), _binary.end())) : fnv1a_hash(_source);
+}
+
 Program::Program(cl::Context context, cl::Device device, std::string name, std::vector<unsigned char> binary)
     : _context(std::move(context)), _device(std::move(device)), _is_binary(true), _name(std::move(name)), _source(), _binary(std::move(binary))
 {
@@ -107,6 +152,7 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "activation_layer", "activation_layer.cl" },
     { "arithmetic_add", "arithmetic_op.cl" },
     { "arithmetic_sub", "arithmetic_op.cl" },
+    { "batchnormalization_layer", "batchnormalization_layer.cl" },
     { "bitwise_or", "bitwise_op.cl" },
     { "bitwise_and", "bitwise_op.cl" },
     { "bitwise_xor", "bitwise_op.cl" },
@@ -124,6 +170,8 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "channel_extract_YUYV422", "channel_extract.cl" },
     { "combine_gradients_L1", "canny.cl" },
     { "combine_gradients_L2", "canny.cl" },
+    { "compact_to_keypoint", "fast_corners.cl" },
+    { "concatenate_depth", "concatenate.cl" },
     { "convolution_rectangle", "convolution_rectangle.cl" },
     { "col2im", "convolution_layer.cl" },
     { "convolution3x3_static", "convolution3x3.cl" },
@@ -136,13 +184,19 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "convolution_separable7x1_static", "convolution7x7.cl" },
     { "convolution_separable1x9_static", "convolution9x9.cl" },
     { "convolution_separable9x1_static", "convolution9x9.cl" },
+    { "convolution_implicit_gemm", "convolution_layer.cl" },
     { "convert_depth_down", "depth_convert.cl" },
+    { "convert_depth_float", "depth_convert.cl" },
     { "convert_depth_up", "depth_convert.cl" },
     { "copy_plane", "channel_extract.cl" },
     { "copy_planes_3p", "channel_combine.cl" },
+    { "copy_to_image2d", "copy_to_image.cl" },
     { "copy_to_keypoint", "fast_corners.cl" },
+    { "count_keypoints_rows", "fast_corners.cl" },
+    { "depthwise_convolution_3x3", "depthwise_convolution.cl" },
     { "derivative", "derivative.cl" },
     { "dilate", "dilate.cl" },
+    { "direct_convolution3x3", "direct_convolution3x3.cl" },
     { "erode", "erode.cl" },
     { "fast_corners", "fast_corners.cl" },
     { "fill_image_borders_constant", "fill_border.cl" },
@@ -155,11 +209,14 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "gemm_interleave4x4_8bit", "gemm.cl" },
     { "gemm_interleave4x4_16bit", "gemm.cl" },
     { "gemm_interleave4x4_32bit", "gemm.cl" },
+    { "gemm_interleave4x4_feature_maps", "gemm.cl" },
     { "gemm_ma_f16", "gemm.cl" },
     { "gemm_ma_f32", "gemm.cl" },
     { "gemm_mm_u8", "gemm.cl" },
     { "gemm_mm_f16", "gemm.cl" },
     { "gemm_mm_f32", "gemm.cl" },
+    { "gemm_mm_f32_image", "gemm.cl" },
+    { "gemm_mv", "gemm.cl" },
     { "gemm_vm_f16", "gemm.cl" },
     { "gemm_vm_f32", "gemm.cl" },
     { "gemm_transpose1x16_u8", "gemm.cl" },
@@ -172,6 +229,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "hist_border_kernel_fixed", "histogram.cl" },
     { "hist_local_kernel", "histogram.cl" },
     { "hist_local_kernel_fixed", "histogram.cl" },
+    { "hog_block_normalization", "hog.cl" },
+    { "hog_detector", "hog.cl" },
+    { "hog_non_maxima_suppression", "hog.cl" },
+    { "hog_orientation_binning", "hog.cl" },
     { "hysteresis", "canny.cl" },
     { "im2col_generic", "convolution_layer.cl" },
     { "im2col_reduced", "convolution_layer.cl" },
@@ -199,7 +260,9 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "non_linear_filter_disk5x5", "non_linear_filter5x5.cl" },
     { "non_max_suppression", "nonmax.cl" },
     { "normalization_layer_cross_map", "normalization_layer.cl" },
+    { "normalization_layer_cross_map_sliding", "normalization_layer.cl" },
     { "normalization_layer_in_map", "normalization_layer.cl" },
+    { "normalization_layer_in_map_local", "normalization_layer.cl" },
     { "NV12_to_IYUV_bt709", "color_convert.cl" },
     { "NV12_to_RGB888_bt709", "color_convert.cl" },
     { "NV12_to_RGBA8888_bt709", "color_convert.cl" },
@@ -212,8 +275,11 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "pixelwise_mul_int", "pixelwise_mul_int.cl" },
     { "pooling_layer_2", "pooling_layer.cl" },
     { "pooling_layer_3", "pooling_layer.cl" },
+    { "pooling_layer_tiled", "pooling_layer.cl" },
     { "remap_nearest_neighbour", "remap.cl" },
     { "remap_bilinear", "remap.cl" },
+    { "remap_bilinear_image", "remap.cl" },
+    { "roi_pooling_layer", "roi_pooling_layer.cl" },
     { "reshape_to_columns", "convolution_layer.cl" },
     { "RGB888_to_IYUV_bt709", "color_convert.cl" },
     { "RGB888_to_NV12_bt709", "color_convert.cl" },
@@ -225,20 +291,26 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "RGBA8888_to_YUV444_bt709", "color_convert.cl" },
     { "scale_nearest_neighbour", "scale.cl" },
     { "scale_bilinear", "scale.cl" },
+    { "scale_bilinear_image", "scale.cl" },
+    { "scale_area", "scale.cl" },
+    { "scan_keypoints_rows", "fast_corners.cl" },
     { "scharr3x3", "scharr_filter.cl" },
     { "sobel3x3", "sobel_filter.cl" },
     { "sobel_separable5x1", "sobel_filter.cl" },
     { "sobel_separable1x5", "sobel_filter.cl" },
     { "sobel_separable7x1", "sobel_filter.cl" },
     { "sobel_separable1x7", "sobel_filter.cl" },
+    { "softmax_layer_fused", "softmax_layer.cl" },
     { "softmax_layer_max", "softmax_layer.cl" },
     { "softmax_layer_shift_exp_sum", "softmax_layer.cl" },
     { "softmax_layer_norm", "softmax_layer.cl" },
+    { "space_to_depth", "convolution_layer.cl" },
     { "suppress_non_maximum", "canny.cl" },
     { "tablelookup_U8", "tablelookup.cl" },
     { "tablelookup_S16", "tablelookup.cl" },
     { "threshold_binary", "threshold.cl" },
     { "threshold_range", "threshold.cl" },
+    { "topkv", "topkv.cl" },
     { "transpose", "transpose.cl" },
     { "UYVY422_to_IYUV_bt709", "color_convert.cl" },
     { "UYVY422_to_NV12_bt709", "color_convert.cl" },
@@ -246,8 +318,13 @@ const std::map<std::string, std::string> CLKernelLibrary::_kernel_program_map =
     { "UYVY422_to_RGBA8888_bt709", "color_convert.cl" },
     { "warp_affine_nearest_neighbour", "warp_affine.cl" },
     { "warp_affine_bilinear", "warp_affine.cl" },
+    { "warp_affine_bilinear_image", "warp_affine.cl" },
     { "warp_perspective_nearest_neighbour", "warp_perspective.cl" },
     { "warp_perspective_bilinear", "warp_perspective.cl" },
+    { "winograd_filter_transform_2x2_3x3", "winograd.cl" },
+    { "winograd_input_transform_2x2_3x3", "winograd.cl" },
+    { "winograd_output_transform_2x2_3x3", "winograd.cl" },
+    { "YUV_to_tensor_bilinear_bt709", "color_convert.cl" },
     { "YUYV422_to_IYUV_bt709", "color_convert.cl" },
     { "YUYV422_to_NV12_bt709", "color_convert.cl" },
     { "YUYV422_to_RGB888_bt709", "color_convert.cl" },
@@ -264,6 +341,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "accumulate.cl",
 #include "./cl_kernels/accumulate.clembed"
+    },
+    {
+        "activation_helpers.h",
+#include "./cl_kernels/activation_helpers.hembed"
     },
     {
         "activation_layer.cl",
@@ -272,6 +353,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "arithmetic_op.cl",
 #include "./cl_kernels/arithmetic_op.clembed"
+    },
+    {
+        "batchnormalization_layer.cl",
+#include "./cl_kernels/batchnormalization_layer.clembed"
     },
     {
         "bitwise_op.cl",
@@ -292,6 +377,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "color_convert.cl",
 #include "./cl_kernels/color_convert.clembed"
+    },
+    {
+        "concatenate.cl",
+#include "./cl_kernels/concatenate.clembed"
     },
     {
         "convolution3x3.cl",
@@ -316,10 +405,18 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "convolution_rectangle.cl",
 #include "./cl_kernels/convolution_rectangle.clembed"
+    },
+    {
+        "copy_to_image.cl",
+#include "./cl_kernels/copy_to_image.clembed"
     },
     {
         "depth_convert.cl",
 #include "./cl_kernels/depth_convert.clembed"
+    },
+    {
+        "depthwise_convolution.cl",
+#include "./cl_kernels/depthwise_convolution.clembed"
     },
     {
         "derivative.cl",
@@ -328,6 +425,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "dilate.cl",
 #include "./cl_kernels/dilate.clembed"
+    },
+    {
+        "direct_convolution3x3.cl",
+#include "./cl_kernels/direct_convolution3x3.clembed"
     },
     {
         "erode.cl",
@@ -360,6 +461,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "histogram.cl",
 #include "./cl_kernels/histogram.clembed"
+    },
+    {
+        "hog.cl",
+#include "./cl_kernels/hog.clembed"
     },
     {
         "integral_image.cl",
@@ -416,6 +521,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "remap.cl",
 #include "./cl_kernels/remap.clembed"
+    },
+    {
+        "roi_pooling_layer.cl",
+#include "./cl_kernels/roi_pooling_layer.clembed"
     },
     {
         "scale.cl",
@@ -440,6 +549,10 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "threshold.cl",
 #include "./cl_kernels/threshold.clembed"
+    },
+    {
+        "topkv.cl",
+#include "./cl_kernels/topkv.clembed"
     },
     {
         "transpose.cl",
@@ -460,12 +573,17 @@ const std::map<std::string, std::string> CLKernelLibrary::_program_source_map =
     {
         "warp_perspective.cl",
 #include "./cl_kernels/warp_perspective.clembed"
+    },
+    {
+        "winograd.cl",
+#include "./cl_kernels/winograd.clembed"
     }
 #endif
 };
 
 CLKernelLibrary::CLKernelLibrary()
-    : _context(), _device(), _kernel_path("."), _programs_map(), _built_programs_map()
+    : _context(), _device(), _kernel_path("."), _binary_cache_path(), _programs_map(), _built_programs_map(), _pending_programs_map(), _is_recording(false), _recorded_kernels(), _mtx(),
+      _precompile_workers()
 {
 }
 
@@ -485,37 +603,226 @@ Kernel CLKernelLibrary::create_kernel(const std::string &kernel_name, const Stri
         ARM_COMPUTE_ERROR("Kernel %s not found in the CLKernelLibrary", kernel_name.c_str());
     }
 
-    // Check if the program has been built before with same build options.
-    const std::string program_name       = kernel_program_it->second;
-    const std::string build_options      = stringify_set(build_options_set);
-    const std::string built_program_name = program_name + "_" + build_options;
-    auto              built_program_it   = _built_programs_map.find(built_program_name);
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+        if(_is_recording)
+        {
+            _recorded_kernels.emplace(kernel_name, build_options_set);
+        }
+    }
 
-    cl::Program cl_program;
+    // Get the program built with the same build options
+    const cl::Program cl_program = get_built_program(kernel_program_it->second, stringify_set(build_options_set));
 
-    if(_built_programs_map.end() != built_program_it)
+    // Create and return kernel
+    return Kernel(kernel_name, cl_program);
+}
+
+cl::Program CLKernelLibrary::get_built_program(const std::string &program_name, const std::string &build_options) const
+{
+    const std::string built_program_name = program_name + "_" + build_options;
+
+    std::shared_future<cl::Program> pending_program;
     {
+        std::lock_guard<std::mutex> lock(_mtx);
+
         // If program has been built, retrieve to create kernel from it
-        cl_program = built_program_it->second;
+        const auto built_program_it = _built_programs_map.find(built_program_name);
+        if(_built_programs_map.end() != built_program_it)
+        {
+            return built_program_it->second;
+        }
+
+        const auto pending_program_it = _pending_programs_map.find(built_program_name);
+        if(_pending_programs_map.end() != pending_program_it)
+        {
+            pending_program = pending_program_it->second;
+        }
+    }
+
+    // Wait for the background compilation of the program, or build it
+    cl::Program cl_program;
+    if(pending_program.valid())
+    {
+        StartupScope startup_scope(StartupStage::PROGRAM_BUILD, program_name);
+        startup_scope.set_source(ProgramSource::BACKGROUND);
+        cl_program = pending_program.get();
     }
     else
     {
+        cl_program = build_program(program_name, build_options);
+    }
+
+    // Add built program to internal map
+    std::lock_guard<std::mutex> lock(_mtx);
+    _pending_programs_map.erase(built_program_name);
+    return _built_programs_map.emplace(built_program_name, cl_program).first->second;
+}
+
+cl::Program CLKernelLibrary::build_program(const std::string &program_name, const std::string &build_options) const
+{
+    const bool        use_cache = !_binary_cache_path.empty();
+    const std::string key       = use_cache ? binary_cache_key(program_name, build_options) : "";
+    const std::string file      = use_cache ? binary_cache_file(program_name, key) : "";
+
+    StartupScope startup_scope(StartupStage::PROGRAM_BUILD, program_name);
+    startup_scope.set_source(ProgramSource::BINARY_CACHE);
+
+    // A program found in the binary cache doesn't need to be compiled
+    cl::Program cl_program;
+    if(!use_cache || !load_cached_binary(file, key, build_options, cl_program))
+    {
+        startup_scope.set_source(ProgramSource::COMPILED);
+
         // Get program
-        Program program = load_program(program_name);
+        const Program &program = load_program(program_name);
 
         // Build program
         cl_program = program.build(build_options);
 
-        // Add built program to internal map
-        _built_programs_map.emplace(built_program_name, cl_program);
+        if(use_cache)
+        {
+            save_cached_binary(file, key, cl_program);
+        }
     }
 
-    // Create and return kernel
-    return Kernel(kernel_name, cl_program);
+    return cl_program;
+}
+
+void CLKernelLibrary::precompile(const std::vector<std::pair<std::string, StringSet>> &kernels, unsigned int num_threads)
+{
+    auto jobs = std::make_shared<std::vector<PrecompileJob>>();
+
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+
+        for(const auto &kernel : kernels)
+        {
+            const auto kernel_program_it = _kernel_program_map.find(kernel.first);
+            if(_kernel_program_map.end() == kernel_program_it)
+            {
+                ARM_COMPUTE_ERROR("Kernel %s not found in the CLKernelLibrary", kernel.first.c_str());
+            }
+
+            // Skip the programs already built or being built
+            const std::string build_options      = stringify_set(kernel.second);
+            const std::string built_program_name = kernel_program_it->second + "_" + build_options;
+            if(_built_programs_map.count(built_program_name) != 0 || _pending_programs_map.count(built_program_name) != 0)
+            {
+                continue;
+            }
+
+            jobs->push_back(PrecompileJob{ kernel_program_it->second, build_options, std::promise<cl::Program>() });
+            _pending_programs_map.emplace(built_program_name, jobs->back().promise.get_future().share());
+        }
+    }
+
+    if(jobs->empty())
+    {
+        return;
+    }
+
+    if(num_threads == 0)
+    {
+        num_threads = std::max(std::thread::hardware_concurrency(), 1u);
+    }
+    num_threads = std::min<unsigned int>(num_threads, jobs->size());
+
+    // Each thread builds the next program not taken by another thread
+    auto next_job = std::make_shared<std::atomic<size_t>>(0);
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        _precompile_workers.push_back(std::async(std::launch::async, [this, jobs, next_job]()
+        {
+            for(size_t i = (*next_job)++; i < jobs->size(); i = (*next_job)++)
+            {
+                PrecompileJob &job = (*jobs)[i];
+                try
+                {
+                    job.promise.set_value(build_program(job.program_name, job.build_options));
+                }
+                catch(...)
+                {
+                    // The error is reported to the function which creates the kernel
+                    job.promise.set_exception(std::current_exception());
+                }
+            }
+        }));
+    }
+}
+
+void CLKernelLibrary::wait_precompiled()
+{
+    for(auto &worker : _precompile_workers)
+    {
+        worker.wait();
+    }
+    _precompile_workers.clear();
+}
+
+void CLKernelLibrary::record_kernels(bool enable)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    if(enable)
+    {
+        _recorded_kernels.clear();
+    }
+    _is_recording = enable;
+}
+
+std::vector<std::pair<std::string, CLKernelLibrary::StringSet>> CLKernelLibrary::recorded_kernels() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return std::vector<std::pair<std::string, StringSet>>(_recorded_kernels.begin(), _recorded_kernels.end());
+}
+
+void CLKernelLibrary::write_kernel_list(std::ostream &stream, const std::vector<std::pair<std::string, StringSet>> &kernels)
+{
+    for(const auto &kernel : kernels)
+    {
+        stream << kernel.first;
+        for(const auto &option : kernel.second)
+        {
+            stream << '\t' << option;
+        }
+        stream << '\n';
+    }
+}
+
+std::vector<std::pair<std::string, CLKernelLibrary::StringSet>> CLKernelLibrary::read_kernel_list(std::istream &stream)
+{
+    std::vector<std::pair<std::string, StringSet>> kernels;
+
+    std::string line;
+    while(std::getline(stream, line))
+    {
+        if(line.empty())
+        {
+            continue;
+        }
+
+        std::stringstream fields(line);
+        std::string       name;
+        std::getline(fields, name, '\t');
+
+        StringSet   options;
+        std::string option;
+        while(std::getline(fields, option, '\t'))
+        {
+            options.insert(option);
+        }
+        kernels.emplace_back(name, options);
+    }
+
+    return kernels;
 }
 
 const Program &CLKernelLibrary::load_program(const std::string &program_name) const
 {
+    // The programs are also loaded by the background compilations
+    std::lock_guard<std::mutex> lock(_mtx);
+
     const auto program_it = _programs_map.find(program_name);
 
     if(program_it != _programs_map.end())
@@ -576,3 +883,98 @@ std::string CLKernelLibrary::stringify_set(const StringSet &s) const
 
     return concat_set;
 }
+
+std::string CLKernelLibrary::binary_cache_key(const std::string &program_name, const std::string &build_options) const
+{
+    // The hash of the source and the version of the library (which includes its git hash) invalidate the cached binaries
+    // when the kernels, or the headers they include, are updated with the library or the application
+    std::stringstream source_hash;
+    source_hash << std::hex << std::setw(16) << std::setfill('0') << load_program(program_name).content_hash();
+
+    return program_name + "\n" + source_hash.str() + "\n" + build_information() + "\n" + build_options + "\n" + _device.getInfo<CL_DEVICE_NAME>() + "\n" + _device.getInfo<CL_DEVICE_VERSION>()
+           + "\n" + _device.getInfo<CL_DRIVER_VERSION>();
+}
+
+std::string CLKernelLibrary::binary_cache_file(const std::string &program_name, const std::string &key) const
+{
+    std::stringstream file;
+    file << _binary_cache_path << "/" << program_name << "_" << std::hex << std::setw(16) << std::setfill('0') << fnv1a_hash(key) << ".bin";
+    return file.str();
+}
+
+bool CLKernelLibrary::load_cached_binary(const std::string &file, const std::string &key, const std::string &build_options, cl::Program &program) const
+{
+    std::ifstream fs(file, std::ios::in | std::ios::binary);
+    if(!fs.is_open())
+    {
+        return false;
+    }
+
+    // The file starts with the key of the program followed by a null character: it protects against hash collisions
+    std::string stored_key;
+    if(!std::getline(fs, stored_key, '\0') || stored_key != key)
+    {
+        return false;
+    }
+
+    const std::vector<unsigned char> binary((std::istreambuf_iterator<char>(fs)), std::istreambuf_iterator<char>());
+    if(binary.empty())
+    {
+        return false;
+    }
+
+    try
+    {
+        program = cl::Program(_context, { _device }, { binary });
+    }
+    catch(const cl::Error &)
+    {
+        // The binary isn't valid for the device: the program gets built from source and the cache entry overwritten
+        return false;
+    }
+
+    return Program::build(program, build_options);
+}
+
+void CLKernelLibrary::save_cached_binary(const std::string &file, const std::string &key, const cl::Program &program) const
+{
+    // The program is built for all the devices of the context: only the binary of the library's device is cached
+    const std::vector<cl::Device>                 devices  = program.getInfo<CL_PROGRAM_DEVICES>();
+    const std::vector<std::vector<unsigned char>> binaries = program.getInfo<CL_PROGRAM_BINARIES>();
+
+    size_t device_idx = 0;
+    while(device_idx < devices.size() && devices[device_idx]() != _device())
+    {
+        ++device_idx;
+    }
+    if(device_idx >= binaries.size() || binaries[device_idx].empty())
+    {
+        return;
+    }
+    const std::vector<unsigned char> &binary = binaries[device_idx];
+
+    // Failing to write the cache isn't an error: the program is compiled again by the next process.
+    // The temporary file is unique to the process and to the call, so that concurrent writers never rename a file mixing their writes
+    static std::atomic<unsigned int> tmp_file_count(0);
+    const std::string                tmp_file = file + "." + std::to_string(getpid()) + "." + std::to_string(tmp_file_count.fetch_add(1)) + ".tmp";
+    {
+        std::ofstream fs(tmp_file, std::ios::out | std::ios::binary | std::ios::trunc);
+        if(!fs.is_open())
+        {
+            return;
+        }
+        fs.write(key.c_str(), key.size() + 1);
+        fs.write(reinterpret_cast<const char *>(binary.data()), binary.size());
+        if(!fs)
+        {
+            fs.close();
+            std::remove(tmp_file.c_str());
+            return;
+        }
+    }
+
+    if(std::rename(tmp_file.c_str(), file.c_str()) != 0)
+    {
+        std::remove(tmp_file.c_str());
+    }
+}
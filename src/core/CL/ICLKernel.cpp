@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/CL/ICLKernel.h"
 
+#include "arm_compute/core/CL/CLCommandRecording.h"
 #include "arm_compute/core/CL/ICLTensor.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -56,6 +57,17 @@ void arm_compute::enqueue(cl::CommandQueue &queue, ICLKernel &kernel, const Wind
     }
 
     queue.enqueueNDRangeKernel(kernel.kernel(), cl::NullRange, gws, lws);
+
+    CLCommandRecording *recording = CLCommandRecording::active();
+    if(recording != nullptr)
+    {
+        recording->record_enqueue(kernel.kernel(), gws, lws);
+    }
+}
+
+void arm_compute::enqueue(cl::CommandQueue &queue, ICLKernel &kernel, const Window &window)
+{
+    enqueue(queue, kernel, window, kernel.lws_hint());
 }
 
 ICLKernel::ICLKernel()
@@ -68,6 +80,21 @@ cl::Kernel &ICLKernel::kernel()
     return _kernel;
 }
 
+void ICLKernel::set_lws_hint(const cl::NDRange &lws_hint)
+{
+    _lws_hint = lws_hint;
+}
+
+const cl::NDRange &ICLKernel::lws_hint() const
+{
+    return _lws_hint;
+}
+
+bool ICLKernel::is_idempotent() const
+{
+    return true;
+}
+
 template <unsigned int dimension_size>
 unsigned int           ICLKernel::num_arguments_per_tensor() const
 {
@@ -92,15 +119,16 @@ void ICLKernel::add_tensor_argument(unsigned &idx, const ICLTensor *tensor, cons
     }
 
     unsigned int idx_start = idx;
-    _kernel.setArg(idx++, tensor->cl_buffer());
+    _kernel.setArg(idx, tensor->cl_buffer());
+    record_argument(idx++, sizeof(cl_mem), &tensor->cl_buffer()());
 
     for(unsigned int dimension = 0; dimension < dimension_size; dimension++)
     {
-        _kernel.setArg<cl_uint>(idx++, strides[dimension]);
-        _kernel.setArg<cl_uint>(idx++, strides[dimension] * window[dimension].step());
+        add_argument<cl_uint>(idx, strides[dimension]);
+        add_argument<cl_uint>(idx, strides[dimension] * window[dimension].step());
     }
 
-    _kernel.setArg<cl_uint>(idx++, offset_first_element);
+    add_argument<cl_uint>(idx, offset_first_element);
 
     ARM_COMPUTE_ERROR_ON_MSG(idx_start + num_arguments_per_tensor<dimension_size>() != idx,
                              "add_%dD_tensor_argument() is supposed to add exactly %d arguments to the kernel", dimension_size, num_arguments_per_tensor<dimension_size>());
@@ -122,6 +150,15 @@ void ICLKernel::add_3D_tensor_argument(unsigned int &idx, const ICLTensor *tenso
     add_tensor_argument<3>(idx, tensor, window);
 }
 
+void ICLKernel::record_argument(unsigned int idx, size_t size, const void *value)
+{
+    CLCommandRecording *recording = CLCommandRecording::active();
+    if(recording != nullptr)
+    {
+        recording->record_argument(_kernel, idx, size, value);
+    }
+}
+
 unsigned int ICLKernel::num_arguments_per_1D_tensor() const
 {
     return num_arguments_per_tensor<1>();
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef ARM_COMPUTE_ACTIVATION_HELPERS_H
+#define ARM_COMPUTE_ACTIVATION_HELPERS_H
+
+/** Activation functions which can be fused into the store of another kernel.
+ *
+ * A kernel applies the activation selected at compile time with -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU, names as used by activation_layer.cl)
+ * by calling ACTIVATION_OP(FUSED_ACTIVATION, type, x) where type is the scalar type of x, which can be a scalar or a vector.
+ * The A and B parameters of the activation function are set using -DACT_A= and -DACT_B= respectively.
+ */
+#define LOGISTIC_OP(type, x) ((type)1 / ((type)1 + exp(-(x))))
+#define TANH_OP(type, x) ((type)ACT_A * tanh((type)ACT_B * (x)))
+#define RELU_OP(type, x) max((x), (type)0)
+#define BRELU_OP(type, x) min(max((x), (type)0), (type)ACT_A)
+#define SRELU_OP(type, x) log((type)1 + exp(x))
+#define ABS_OP(type, x) fabs(x)
+#define SQUARE_OP(type, x) ((x) * (x))
+#define SQRT_OP(type, x) sqrt(x)
+#define LINEAR_OP(type, x) ((type)ACT_A * (x) + (type)ACT_B)
+
+#define ACTIVATION_OP_STR(op, type, x) op##_OP(type, x)
+#define ACTIVATION_OP(op, type, x) ACTIVATION_OP_STR(op, type, x)
+
+#endif /* ARM_COMPUTE_ACTIVATION_HELPERS_H */
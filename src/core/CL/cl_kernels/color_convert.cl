@@ -1821,3 +1821,124 @@ __kernel void UYVY422_to_NV12_bt709(
     const uchar8  cbcr   = convert_uchar8((cbcr_t + cbcr_b) / (ushort8)(2));
     vstore8(cbcr, 0, out_uv.ptr);
 }
+
+/** Sample the input at the given coordinates and convert the sample to RGB clamped to [0, 255]
+ *
+ * @param[in] luma Luma plane
+ * @param[in] u    U plane, or interleaved UV plane for NV12 and NV21
+ * @param[in] v    V plane, the same as @p u for NV12 and NV21
+ * @param[in] x    X coordinate of the sample in the luma plane
+ * @param[in] y    Y coordinate of the sample in the luma plane
+ *
+ * @return The R, G and B values of the sample
+ */
+inline float3 sample_yuv_to_rgb(const Image *luma, const Image *u, const Image *v, int x, int y)
+{
+    const float f_y = convert_float(*offset(luma, x, y));
+
+#if defined(NV12)
+    const float f_u = convert_float(*offset(u, (x / 2) * 2, y / 2));
+    const float f_v = convert_float(*offset(v, (x / 2) * 2 + 1, y / 2));
+#elif defined(NV21)
+    const float f_u = convert_float(*offset(u, (x / 2) * 2 + 1, y / 2));
+    const float f_v = convert_float(*offset(v, (x / 2) * 2, y / 2));
+#elif defined(IYUV)
+    const float f_u = convert_float(*offset(u, x / 2, y / 2));
+    const float f_v = convert_float(*offset(v, x / 2, y / 2));
+#else  /* YUV444 */
+    const float f_u = convert_float(*offset(u, x, y));
+    const float f_v = convert_float(*offset(v, x, y));
+#endif /* NV12 */
+
+    const float cb = f_u - 128.0f;
+    const float cr = f_v - 128.0f;
+
+    const float3 rgb = (float3)(f_y + 1.5748f * cr, f_y - 0.1873f * cb - 0.4681f * cr, f_y + 1.8556f * cb);
+
+    return clamp(rgb, (float3)(0.0f), (float3)(255.0f));
+}
+
+/** Convert a YUV image to the planar F32 input tensor of a network: the output is a bilinear resampling of the RGB conversion of the input,
+ * from which the mean of each channel is subtracted before scaling.
+ *
+ * @attention The format of the input must be passed at compile time using -DNV12, -DNV21, -DIYUV or -DYUV444
+ *
+ * Global Workgroup Size [ width, height ]
+ * No offset.
+ *
+ * @param[in]  luma_input_ptr                           Pointer to the source luma channel. Supported Format: U8
+ * @param[in]  luma_input_stride_x                      Stride of the luma image in X dimension (in bytes)
+ * @param[in]  luma_input_step_x                        luma_input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  luma_input_stride_y                      Stride of the source luma channel in Y dimension (in bytes)
+ * @param[in]  luma_input_step_y                        luma_input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  luma_input_offset_first_element_in_bytes The offset of the first element in the source image
+ * @param[in]  u_input_ptr                              Pointer to the source U channel, or UV channel for NV12 and NV21. Supported Format: U8
+ * @param[in]  u_input_stride_x                         Stride of the source image U channel in X dimension (in bytes)
+ * @param[in]  u_input_step_x                           u_input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  u_input_stride_y                         Stride of the source image U channel in Y dimension (in bytes)
+ * @param[in]  u_input_step_y                           u_input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  u_input_offset_first_element_in_bytes    The offset of the first element in the source U channel
+ * @param[in]  v_input_ptr                              (IYUV and YUV444 only) Pointer to the source V channel. Supported Format: U8
+ * @param[in]  v_input_stride_x                         (IYUV and YUV444 only) Stride of the source image V channel in X dimension (in bytes)
+ * @param[in]  v_input_step_x                           (IYUV and YUV444 only) v_input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  v_input_stride_y                         (IYUV and YUV444 only) Stride of the source image V channel in Y dimension (in bytes)
+ * @param[in]  v_input_step_y                           (IYUV and YUV444 only) v_input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  v_input_offset_first_element_in_bytes    (IYUV and YUV444 only) The offset of the first element in the source V channel
+ * @param[out] output_ptr                               Pointer to the destination tensor. Supported data types: F32
+ * @param[in]  output_stride_x                          Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  output_step_x                            output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  output_stride_y                          Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  output_step_y                            output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  output_stride_z                          Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  output_step_z                            output_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  output_offset_first_element_in_bytes     The offset of the first element in the destination tensor
+ * @param[in]  input_width                              Width of the input image
+ * @param[in]  input_height                             Height of the input image
+ * @param[in]  ratio_x                                  Ratio between the width of the input and the width of the output
+ * @param[in]  ratio_y                                  Ratio between the height of the input and the height of the output
+ * @param[in]  mean_r                                   Value subtracted from the R channel
+ * @param[in]  mean_g                                   Value subtracted from the G channel
+ * @param[in]  mean_b                                   Value subtracted from the B channel
+ * @param[in]  scale                                    Scale applied to the channels once the mean is subtracted
+ */
+__kernel void YUV_to_tensor_bilinear_bt709(
+    IMAGE_DECLARATION(luma_input),
+    IMAGE_DECLARATION(u_input),
+#if defined(IYUV) || defined(YUV444)
+    IMAGE_DECLARATION(v_input),
+#endif /* defined(IYUV) || defined(YUV444) */
+    TENSOR3D_DECLARATION(output),
+    const int   input_width,
+    const int   input_height,
+    const float ratio_x,
+    const float ratio_y,
+    const float mean_r,
+    const float mean_g,
+    const float mean_b,
+    const float scale)
+{
+    Image    in_luma = CONVERT_TO_IMAGE_STRUCT_NO_STEP(luma_input);
+    Image    in_u    = CONVERT_TO_IMAGE_STRUCT_NO_STEP(u_input);
+#if defined(IYUV) || defined(YUV444)
+    Image    in_v = CONVERT_TO_IMAGE_STRUCT_NO_STEP(v_input);
+#else  /* defined(IYUV) || defined(YUV444) */
+    Image    in_v = in_u;
+#endif /* defined(IYUV) || defined(YUV444) */
+    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(output);
+
+    // Same source coordinates as scale_bilinear, the input is replicated outside of its borders
+    const float2 coords       = ((float2)((float)get_global_id(0), (float)get_global_id(1)) + (float2)(0.5f)) * (float2)(ratio_x, ratio_y) - (float2)(0.5f);
+    const float2 coords_floor = floor(coords);
+    const float2 weight       = coords - coords_floor;
+    const int2   max_coords   = (int2)(input_width - 1, input_height - 1);
+    const int2   c0           = clamp(convert_int2(coords_floor), (int2)(0), max_coords);
+    const int2   c1           = clamp(convert_int2(coords_floor) + (int2)(1), (int2)(0), max_coords);
+
+    const float3 top    = mix(sample_yuv_to_rgb(&in_luma, &in_u, &in_v, c0.x, c0.y), sample_yuv_to_rgb(&in_luma, &in_u, &in_v, c1.x, c0.y), (float3)(weight.x));
+    const float3 bottom = mix(sample_yuv_to_rgb(&in_luma, &in_u, &in_v, c0.x, c1.y), sample_yuv_to_rgb(&in_luma, &in_u, &in_v, c1.x, c1.y), (float3)(weight.x));
+    const float3 rgb    = (mix(top, bottom, (float3)(weight.y)) - (float3)(mean_r, mean_g, mean_b)) * (float3)(scale);
+
+    *((__global float *)(out.ptr))                       = rgb.s0;
+    *((__global float *)(out.ptr + output_stride_z))     = rgb.s1;
+    *((__global float *)(out.ptr + 2 * output_stride_z)) = rgb.s2;
+}
@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "activation_helpers.h"
 #include "helpers.h"
 
 /** This kernel reshapes the tensor's low three dimensions to single column
@@ -150,6 +151,7 @@ __kernel void im2col_generic(
 /** This kernel performs a reshaping of the output of the convolution layer.
  *
  * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note An activation function can be applied to the reshaped values by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
  *
  * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F16, F32
  * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
@@ -177,7 +179,13 @@ __kernel void col2im(
 
     int      idx                         = get_global_id(0) * dst.stride_z + (get_global_id(1) / width) * dst.stride_y + (get_global_id(1) % width) * dst.stride_x;
     __global uchar *tmp_out_ptr          = dst.ptr + idx;
-    *((__global DATA_TYPE *)tmp_out_ptr) = *((__global DATA_TYPE *)(src.ptr));
+    DATA_TYPE value                      = *((__global DATA_TYPE *)(src.ptr));
+
+#if defined FUSED_ACTIVATION
+    value = ACTIVATION_OP(FUSED_ACTIVATION, DATA_TYPE, value);
+#endif /* defined FUSED_ACTIVATION */
+
+    *((__global DATA_TYPE *)tmp_out_ptr) = value;
 }
 
 /** This kernel reshapes the tensor's low three dimensions to single row for GEMM operation
@@ -222,3 +230,218 @@ __kernel void im2col_reduced(
     }
 #endif
 }
+
+/** This kernel moves the blocks of BLOCK_SIZE x BLOCK_SIZE pixels of each channel of the padded source tensor to the channels of the destination tensor:
+ *  dst(x, y, (c * BLOCK_SIZE + dy) * BLOCK_SIZE + dx) = src(x * BLOCK_SIZE + dx - pad_x, y * BLOCK_SIZE + dy - pad_y, c)
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note The size of the blocks must be passed at compile time using -DBLOCK_SIZE: e.g. -DBLOCK_SIZE=4
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: Same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  src_width                         The width of the source tensor
+ * @param[in]  src_height                        The height of the source tensor
+ * @param[in]  pad_x                             Number of padding columns on the left of the source tensor
+ * @param[in]  pad_y                             Number of padding rows on the top of the source tensor
+ */
+__kernel void space_to_depth(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    int src_width,
+    int src_height,
+    int pad_x,
+    int pad_y)
+{
+    Tensor3D dst = CONVERT_TO_TENSOR3D_STRUCT(dst);
+
+    const int zo = get_global_id(2);
+    const int c  = zo / (BLOCK_SIZE * BLOCK_SIZE);
+    const int dy = (zo / BLOCK_SIZE) % BLOCK_SIZE;
+    const int dx = zo % BLOCK_SIZE;
+    const int x  = get_global_id(0) * BLOCK_SIZE + dx - pad_x;
+    const int y  = get_global_id(1) * BLOCK_SIZE + dy - pad_y;
+
+    DATA_TYPE value = 0;
+
+    if(x >= 0 && x < src_width && y >= 0 && y < src_height)
+    {
+        value = *((__global DATA_TYPE *)(src_ptr + src_offset_first_element_in_bytes + x * src_stride_x + y * src_stride_y + c * src_stride_z));
+    }
+
+    *((__global DATA_TYPE *)dst.ptr) = value;
+}
+
+#if defined(KERNEL_WIDTH) && defined(KERNEL_HEIGHT)
+/** Side of the tiles of the implicit GEMM: a work-group computes 8 output pixels by 8 * 4 output feature maps and accumulates 8 rows of the im2col matrix at a time */
+#define IGEMM_TILE 8
+
+/** This kernel computes a convolution as the matrix multiplication of the im2col transform of the source tensor by the reshaped weights,
+ *  without storing the im2col matrix: the work-items compute the addresses of its elements in the source tensor on the fly.
+ *
+ * A work-group computes a tile of 8 output pixels by 32 output feature maps. For each block of 8 rows of the matrix multiplication, every work-item
+ * stages one element of the im2col matrix and 4 elements of the reshaped weights in local memory, then accumulates 4 output feature maps of one pixel.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note The size of the convolution kernel must be passed at compile time using -DKERNEL_WIDTH and -DKERNEL_HEIGHT: e.g. -DKERNEL_WIDTH=3 -DKERNEL_HEIGHT=3
+ * @note In case the reshaped weights hold the biases in their last row, -DHAS_BIAS has to be passed so that the im2col matrix is appended with 1 in each row.
+ * @note An activation function can be applied to the output values by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
+ * @note The local workgroup size must be 8x8x1
+ *
+ * @param[in]  src_ptr                               Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  src_stride_x                          Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                            src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                          Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                            src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                          Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                            src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes     The offset of the first element in the source tensor
+ * @param[in]  weights_ptr                           Pointer to the reshaped weights: one column per output feature map. Supported data types: Same as @p src_ptr
+ * @param[in]  weights_stride_x                      Stride of the reshaped weights in X dimension (in bytes)
+ * @param[in]  weights_step_x                        weights_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  weights_stride_y                      Stride of the reshaped weights in Y dimension (in bytes)
+ * @param[in]  weights_step_y                        weights_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  weights_offset_first_element_in_bytes The offset of the first element in the reshaped weights
+ * @param[out] dst_ptr                               Pointer to the destination tensor. Supported data types: Same as @p src_ptr
+ * @param[in]  dst_stride_x                          Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                            dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                          Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                            dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                          Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                            dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes     The offset of the first element in the destination tensor
+ * @param[in]  input_dims                            The width and height of the source tensor
+ * @param[in]  strides                               The strides of the convolution
+ * @param[in]  paddings                              The paddings of the convolution
+ * @param[in]  kernel_depth                          The depth of the convolution kernel
+ * @param[in]  convolved_width                       The width of the destination tensor
+ * @param[in]  num_pixels                            The number of pixels of each feature map of the destination tensor
+ * @param[in]  num_rows                              The number of rows of the reshaped weights
+ * @param[in]  num_ofm                               The number of output feature maps
+ */
+__kernel void convolution_implicit_gemm(
+    TENSOR3D_DECLARATION(src),
+    IMAGE_DECLARATION(weights),
+    TENSOR3D_DECLARATION(dst),
+    int2 input_dims,
+    int2 strides,
+    int2 paddings,
+    int  kernel_depth,
+    int  convolved_width,
+    int  num_pixels,
+    int  num_rows,
+    int  num_ofm)
+{
+    // Blocks of the im2col matrix [row][pixel] and of the reshaped weights [row][ofm] shared by the work-group
+    __local DATA_TYPE lhs[IGEMM_TILE][IGEMM_TILE];
+    __local DATA_TYPE rhs[IGEMM_TILE][IGEMM_TILE * 4];
+
+    const int lx        = get_local_id(0);
+    const int ly        = get_local_id(1);
+    const int pixel     = get_global_id(0);
+    const int first_ofm = get_group_id(1) * IGEMM_TILE * 4;
+
+    // Top left corner in the source tensor of the pixel processed by the work-item
+    const int out_x      = pixel % convolved_width;
+    const int out_y      = pixel / convolved_width;
+    const int top_left_x = out_x * strides.x - paddings.x;
+    const int top_left_y = out_y * strides.y - paddings.y;
+
+    const int num_elements = KERNEL_WIDTH * KERNEL_HEIGHT * kernel_depth;
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    acc = 0;
+
+    for(int row = 0; row < num_rows; row += IGEMM_TILE)
+    {
+        const int k = row + ly;
+
+        // Element (pixel, k) of the im2col matrix
+        DATA_TYPE a = 0;
+        if(pixel < num_pixels && k < num_elements)
+        {
+            const int d = k / (KERNEL_WIDTH * KERNEL_HEIGHT);
+            const int r = k % (KERNEL_WIDTH * KERNEL_HEIGHT);
+            const int x = top_left_x + r % KERNEL_WIDTH;
+            const int y = top_left_y + r / KERNEL_WIDTH;
+
+            if(x >= 0 && x < input_dims.x && y >= 0 && y < input_dims.y)
+            {
+                a = *((__global DATA_TYPE *)(src_ptr + src_offset_first_element_in_bytes + x * src_stride_x + y * src_stride_y + d * src_stride_z));
+            }
+        }
+#if defined HAS_BIAS
+        else if(pixel < num_pixels && k == num_elements)
+        {
+            a = 1;
+        }
+#endif /* defined HAS_BIAS */
+        lhs[ly][lx] = a;
+
+        // Elements (k, ofm .. ofm + 3) of the reshaped weights
+        const int ofm = first_ofm + lx * 4;
+        VEC_DATA_TYPE(DATA_TYPE, 4)
+        b = 0;
+        if(k < num_rows)
+        {
+            __global const DATA_TYPE *weights_row = (__global const DATA_TYPE *)(weights_ptr + weights_offset_first_element_in_bytes + k * weights_stride_y);
+
+            b.s0 = (ofm + 0 < num_ofm) ? weights_row[ofm + 0] : (DATA_TYPE)0;
+            b.s1 = (ofm + 1 < num_ofm) ? weights_row[ofm + 1] : (DATA_TYPE)0;
+            b.s2 = (ofm + 2 < num_ofm) ? weights_row[ofm + 2] : (DATA_TYPE)0;
+            b.s3 = (ofm + 3 < num_ofm) ? weights_row[ofm + 3] : (DATA_TYPE)0;
+        }
+        vstore4(b, lx, rhs[ly]);
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+
+        for(int kk = 0; kk < IGEMM_TILE; ++kk)
+        {
+            acc += (VEC_DATA_TYPE(DATA_TYPE, 4))lhs[kk][lx] * vload4(ly, rhs[kk]);
+        }
+
+        // The blocks are overwritten by the next iteration
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    const int out_ofm = first_ofm + ly * 4;
+    if(pixel >= num_pixels || out_ofm >= num_ofm)
+    {
+        return;
+    }
+
+#if defined FUSED_ACTIVATION
+    acc = ACTIVATION_OP(FUSED_ACTIVATION, DATA_TYPE, acc);
+#endif /* defined FUSED_ACTIVATION */
+
+    // Store the output feature maps of the pixel which exist
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + out_x * dst_stride_x + out_y * dst_stride_y + out_ofm * dst_stride_z;
+
+    *((__global DATA_TYPE *)dst_addr) = acc.s0;
+    if(out_ofm + 1 < num_ofm)
+    {
+        *((__global DATA_TYPE *)(dst_addr + dst_stride_z)) = acc.s1;
+    }
+    if(out_ofm + 2 < num_ofm)
+    {
+        *((__global DATA_TYPE *)(dst_addr + 2 * dst_stride_z)) = acc.s2;
+    }
+    if(out_ofm + 3 < num_ofm)
+    {
+        *((__global DATA_TYPE *)(dst_addr + 3 * dst_stride_z)) = acc.s3;
+    }
+}
+#endif /* defined(KERNEL_WIDTH) && defined(KERNEL_HEIGHT) */
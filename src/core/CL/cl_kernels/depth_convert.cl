@@ -96,3 +96,45 @@ __kernel void convert_depth_up(
     in_data = CONVERT(vload16(0, (__global DATA_TYPE_IN *)in.ptr), VEC_DATA_TYPE(DATA_TYPE_OUT, 16));
     vstore16(in_data << shift, 0, (__global DATA_TYPE_OUT *)out.ptr);
 }
+
+#ifdef INTEGER_OUT
+#define CONVERT_OUT(x, type) CONVERT_SAT_ROUND(x, type, rte)
+#else
+#define CONVERT_OUT(x, type) CONVERT(x, type)
+#endif
+
+/** This function performs a depth conversion from or to a floating point data type: out = in * scale + offset, computed in single precision.
+ *
+ * @attention The input and output data_types need to be passed at compile time using -DDATA_TYPE_IN and -DDATA_TYPE_OUT:
+ * e.g. -DDATA_TYPE_IN=uchar -DDATA_TYPE_OUT=float
+ * @attention -DINTEGER_OUT must be passed at compile time if the output data type is an integer: the output is then rounded to the nearest integer and saturated.
+ *
+ * @param[in]  in_ptr                            Pointer to the source image. Supported data types: U8, F16 or F32
+ * @param[in]  in_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  in_step_x                         in_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  in_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  in_step_y                         in_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  in_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] out_ptr                           Pointer to the destination image. Supported data types: U8, F16 or F32
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        out_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        out_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  out_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  scale                             Scale applied to the input values
+ * @param[in]  offset                            Offset added to the scaled input values
+ */
+__kernel void convert_depth_float(
+    IMAGE_DECLARATION(in),
+    IMAGE_DECLARATION(out),
+    const float scale,
+    const float offset)
+{
+    // Get pixels pointer
+    Image in  = CONVERT_TO_IMAGE_STRUCT(in);
+    Image out = CONVERT_TO_IMAGE_STRUCT(out);
+
+    // Load data
+    float16 in_data = CONVERT(vload16(0, (__global DATA_TYPE_IN *)in.ptr), float16);
+    vstore16(CONVERT_OUT(mad(in_data, (float16)scale, (float16)offset), VEC_DATA_TYPE(DATA_TYPE_OUT, 16)), 0, (__global DATA_TYPE_OUT *)out.ptr);
+}
@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+
+#if CONV_STRIDE_X == 1
+#define CONVOLUTION1x3(left_pixel, left_coeff, middle_coeff, right_coeff) convolution1x3_stride_1(left_pixel, left_coeff, middle_coeff, right_coeff)
+#elif CONV_STRIDE_X == 2
+#define CONVOLUTION1x3(left_pixel, left_coeff, middle_coeff, right_coeff) convolution1x3_stride_2(left_pixel, left_coeff, middle_coeff, right_coeff)
+#else
+#error "Stride not supported"
+#endif
+
+/** Compute 4 outputs of a row convolution of size 3 with a stride of 1.
+ *
+ * @param[in] left_pixel   Pointer to the left pixel of the first output.
+ * @param[in] left_coeff   Weight of the left pixel.
+ * @param[in] middle_coeff Weight of the middle pixel.
+ * @param[in] right_coeff  Weight of the right pixel.
+ *
+ * @return The 4 convolved values.
+ */
+inline VEC_DATA_TYPE(DATA_TYPE, 4) convolution1x3_stride_1(__global const uchar *left_pixel,
+                                                           const DATA_TYPE left_coeff,
+                                                           const DATA_TYPE middle_coeff,
+                                                           const DATA_TYPE right_coeff)
+{
+    VEC_DATA_TYPE(DATA_TYPE, 8)
+    temp = vload8(0, (__global DATA_TYPE *)left_pixel);
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    left = temp.s0123;
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    middle = temp.s1234;
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    right = temp.s2345;
+
+    return left * (VEC_DATA_TYPE(DATA_TYPE, 4))left_coeff + middle * (VEC_DATA_TYPE(DATA_TYPE, 4))middle_coeff + right * (VEC_DATA_TYPE(DATA_TYPE, 4))right_coeff;
+}
+
+/** Compute 4 outputs of a row convolution of size 3 with a stride of 2.
+ *
+ * @param[in] left_pixel   Pointer to the left pixel of the first output.
+ * @param[in] left_coeff   Weight of the left pixel.
+ * @param[in] middle_coeff Weight of the middle pixel.
+ * @param[in] right_coeff  Weight of the right pixel.
+ *
+ * @return The 4 convolved values.
+ */
+inline VEC_DATA_TYPE(DATA_TYPE, 4) convolution1x3_stride_2(__global const uchar *left_pixel,
+                                                           const DATA_TYPE left_coeff,
+                                                           const DATA_TYPE middle_coeff,
+                                                           const DATA_TYPE right_coeff)
+{
+    VEC_DATA_TYPE(DATA_TYPE, 8)
+    temp = vload8(0, (__global DATA_TYPE *)left_pixel);
+    DATA_TYPE last = *((__global DATA_TYPE *)left_pixel + 8);
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    left = temp.s0246;
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    middle = temp.s1357;
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    right = (VEC_DATA_TYPE(DATA_TYPE, 4))(temp.s246, last);
+
+    return left * (VEC_DATA_TYPE(DATA_TYPE, 4))left_coeff + middle * (VEC_DATA_TYPE(DATA_TYPE, 4))middle_coeff + right * (VEC_DATA_TYPE(DATA_TYPE, 4))right_coeff;
+}
+
+/** Compute 4 outputs of a depthwise 3x3 convolution: each output feature map is the convolution of the input feature map with the same index by its own kernel.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ * @note The stride along X should be given as a preprocessor argument using -DCONV_STRIDE_X=stride. e.g. -DCONV_STRIDE_X=1. Supported strides: 1 and 2.
+ * @note If biases are used, -DHAS_BIAS must be passed at compile time.
+ * @note The padding is read from the border of the input, which must be filled with zeros.
+ *
+ * @param[in]  src_ptr                               Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  src_stride_x                          Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                            src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                          Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                            src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                          Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                            src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes     The offset of the first element in the source tensor
+ * @param[out] dst_ptr                               Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                          Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                            dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                          Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                            dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                          Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                            dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes     The offset of the first element in the destination tensor
+ * @param[in]  weights_ptr                           Pointer to the weights tensor. Supported data types: same as @p src_ptr
+ * @param[in]  weights_stride_x                      Stride of the weights tensor in X dimension (in bytes)
+ * @param[in]  weights_step_x                        weights_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  weights_stride_y                      Stride of the weights tensor in Y dimension (in bytes)
+ * @param[in]  weights_step_y                        weights_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  weights_stride_z                      Stride of the weights tensor in Z dimension (in bytes)
+ * @param[in]  weights_step_z                        weights_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  weights_offset_first_element_in_bytes The offset of the first element in the weights tensor
+ * @param[in]  biases_ptr                            (Optional) Pointer to the biases vector. Supported data types: same as @p src_ptr
+ * @param[in]  biases_stride_x                       (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  biases_step_x                         (Optional) biases_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  biases_offset_first_element_in_bytes  (Optional) The offset of the first element in the biases vector
+ */
+__kernel void depthwise_convolution_3x3(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    TENSOR3D_DECLARATION(weights)
+#if defined(HAS_BIAS)
+    ,
+    VECTOR_DECLARATION(biases)
+#endif /* defined(HAS_BIAS) */
+)
+{
+    Tensor3D in  = CONVERT_TO_TENSOR3D_STRUCT(src);
+    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(dst);
+    Tensor3D w   = CONVERT_TO_TENSOR3D_STRUCT(weights);
+
+    // The weights of the kernel, one row of 3 values per row of the kernel
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    weights_row0 = vload3(0, (__global DATA_TYPE *)(w.ptr + 0 * weights_stride_y));
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    weights_row1 = vload3(0, (__global DATA_TYPE *)(w.ptr + 1 * weights_stride_y));
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    weights_row2 = vload3(0, (__global DATA_TYPE *)(w.ptr + 2 * weights_stride_y));
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    pixels = CONVOLUTION1x3(in.ptr + 0 * src_stride_y, weights_row0.s0, weights_row0.s1, weights_row0.s2);
+    pixels += CONVOLUTION1x3(in.ptr + 1 * src_stride_y, weights_row1.s0, weights_row1.s1, weights_row1.s2);
+    pixels += CONVOLUTION1x3(in.ptr + 2 * src_stride_y, weights_row2.s0, weights_row2.s1, weights_row2.s2);
+
+#if defined(HAS_BIAS)
+    Vector biases = CONVERT_TO_VECTOR_STRUCT_NO_STEP(biases);
+
+    const DATA_TYPE bias = *((__global DATA_TYPE *)(biases.ptr + get_global_id(2) * biases_stride_x));
+
+    pixels += (VEC_DATA_TYPE(DATA_TYPE, 4))bias;
+#endif /* defined(HAS_BIAS) */
+
+    vstore4(pixels, 0, (__global DATA_TYPE *)out.ptr);
+}
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "activation_helpers.h"
+#include "helpers.h"
+
+#if CONV_STRIDE == 1
+#define NUM_ELEMS_READ 6
+#define NUM_ELEMS_LOADED 8
+#define CONVOLUTION1x3(row, last, left_coeff, middle_coeff, right_coeff) convolution1x3_stride_1(row, left_coeff, middle_coeff, right_coeff)
+#elif CONV_STRIDE == 2
+#define NUM_ELEMS_READ 9
+#define NUM_ELEMS_LOADED 9
+#define CONVOLUTION1x3(row, last, left_coeff, middle_coeff, right_coeff) convolution1x3_stride_2(row, last, left_coeff, middle_coeff, right_coeff)
+#else
+#error "Stride not supported"
+#endif
+
+/** Load the input values of a row read by 4 consecutive outputs, hence 6 values with a stride of 1 and 9 values with a stride of 2.
+ *
+ * The values outside the input (padding) are zero.
+ *
+ * @param[in] row_ptr      Pointer to the first element of the row in the source tensor.
+ * @param[in] x            Coordinate of the first value to load, can be negative.
+ * @param[in] stride_x     Stride of the source tensor in X dimension (in bytes).
+ * @param[in] input_width  Width of the source tensor.
+ * @param[in] last         The 9th value, only set with a stride of 2.
+ *
+ * @return The first 8 values of the row.
+ */
+inline VEC_DATA_TYPE(DATA_TYPE, 8) load_row(__global const uchar *row_ptr, const int x, const int stride_x, const int input_width, DATA_TYPE *last)
+{
+    VEC_DATA_TYPE(DATA_TYPE, 8)
+    values = 0;
+    *last  = 0;
+
+    // The vector loads can only be used if all the values they load are in the row
+    if(x >= 0 && x + NUM_ELEMS_LOADED <= input_width)
+    {
+        values = vload8(0, (__global const DATA_TYPE *)(row_ptr + x * stride_x));
+#if CONV_STRIDE == 2
+        *last = *((__global const DATA_TYPE *)(row_ptr + (x + 8) * stride_x));
+#endif /* CONV_STRIDE == 2 */
+    }
+    else
+    {
+        // Close to the edges of the input: load the values one by one
+        DATA_TYPE row[9];
+        for(int i = 0; i < NUM_ELEMS_READ; ++i)
+        {
+            const int xi = x + i;
+            row[i]       = (xi >= 0 && xi < input_width) ? *((__global const DATA_TYPE *)(row_ptr + xi * stride_x)) : (DATA_TYPE)0;
+        }
+        for(int i = NUM_ELEMS_READ; i < 9; ++i)
+        {
+            row[i] = 0;
+        }
+        values = (VEC_DATA_TYPE(DATA_TYPE, 8))(row[0], row[1], row[2], row[3], row[4], row[5], row[6], row[7]);
+        *last  = row[8];
+    }
+
+    return values;
+}
+
+/** Compute 4 outputs of a row convolution of size 3 with a stride of 1.
+ *
+ * @param[in] row          Input values read by the 4 outputs, the first 6 ones are used.
+ * @param[in] left_coeff   Weight of the left pixel.
+ * @param[in] middle_coeff Weight of the middle pixel.
+ * @param[in] right_coeff  Weight of the right pixel.
+ *
+ * @return The 4 convolved values.
+ */
+inline VEC_DATA_TYPE(DATA_TYPE, 4) convolution1x3_stride_1(const VEC_DATA_TYPE(DATA_TYPE, 8) row,
+                                                           const DATA_TYPE left_coeff,
+                                                           const DATA_TYPE middle_coeff,
+                                                           const DATA_TYPE right_coeff)
+{
+    return row.s0123 * (VEC_DATA_TYPE(DATA_TYPE, 4))left_coeff + row.s1234 * (VEC_DATA_TYPE(DATA_TYPE, 4))middle_coeff + row.s2345 * (VEC_DATA_TYPE(DATA_TYPE, 4))right_coeff;
+}
+
+/** Compute 4 outputs of a row convolution of size 3 with a stride of 2.
+ *
+ * @param[in] row          Input values read by the 4 outputs, the first 8 ones.
+ * @param[in] last         The 9th input value read by the 4 outputs.
+ * @param[in] left_coeff   Weight of the left pixel.
+ * @param[in] middle_coeff Weight of the middle pixel.
+ * @param[in] right_coeff  Weight of the right pixel.
+ *
+ * @return The 4 convolved values.
+ */
+inline VEC_DATA_TYPE(DATA_TYPE, 4) convolution1x3_stride_2(const VEC_DATA_TYPE(DATA_TYPE, 8) row,
+                                                           const DATA_TYPE last,
+                                                           const DATA_TYPE left_coeff,
+                                                           const DATA_TYPE middle_coeff,
+                                                           const DATA_TYPE right_coeff)
+{
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    right = (VEC_DATA_TYPE(DATA_TYPE, 4))(row.s246, last);
+
+    return row.s0246 * (VEC_DATA_TYPE(DATA_TYPE, 4))left_coeff + row.s1357 * (VEC_DATA_TYPE(DATA_TYPE, 4))middle_coeff + right * (VEC_DATA_TYPE(DATA_TYPE, 4))right_coeff;
+}
+
+/** This kernel computes 4 consecutive outputs of a row of one output feature map of a 3x3 convolution layer.
+ *
+ * For each input feature map, the 9 weights of the kernel are loaded in registers and applied to the 3 input rows read by the 4 outputs.
+ * The padding values are zero: no border has to be filled around the source tensor.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ * @note The stride of the convolution should be given as a preprocessor argument using -DCONV_STRIDE=stride. e.g. -DCONV_STRIDE=1. Supported strides: 1 and 2.
+ * @note If biases are used, -DHAS_BIAS must be passed at compile time.
+ * @note An activation function can be applied to the output values by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
+ *
+ * @param[in]  src_ptr                               Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  src_stride_x                          Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                            src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                          Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                            src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                          Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                            src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes     The offset of the first element in the source tensor
+ * @param[out] dst_ptr                               Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                          Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                            dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                          Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                            dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                          Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                            dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes     The offset of the first element in the destination tensor
+ * @param[in]  weights_ptr                           Pointer to the weights tensor. Supported data types: same as @p src_ptr
+ * @param[in]  weights_stride_x                      Stride of the weights tensor in X dimension (in bytes)
+ * @param[in]  weights_step_x                        weights_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  weights_stride_y                      Stride of the weights tensor in Y dimension (in bytes)
+ * @param[in]  weights_step_y                        weights_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  weights_stride_z                      Stride of the weights tensor in Z dimension (in bytes)
+ * @param[in]  weights_step_z                        weights_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  weights_offset_first_element_in_bytes The offset of the first element in the weights tensor
+ * @param[in]  biases_ptr                            (Optional) Pointer to the biases vector. Supported data types: same as @p src_ptr
+ * @param[in]  biases_stride_x                       (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  biases_step_x                         (Optional) biases_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  biases_offset_first_element_in_bytes  (Optional) The offset of the first element in the biases vector
+ * @param[in]  weights_stride_w                      Stride of the weights tensor in the 4th dimension (in bytes)
+ * @param[in]  input_dims                            The width and height of the source tensor
+ * @param[in]  paddings                              The paddings of the convolution
+ * @param[in]  num_ifm                               The number of input feature maps
+ */
+__kernel void direct_convolution3x3(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    TENSOR3D_DECLARATION(weights),
+#if defined(HAS_BIAS)
+    VECTOR_DECLARATION(biases),
+#endif /* defined(HAS_BIAS) */
+    uint weights_stride_w,
+    int2 input_dims,
+    int2 paddings,
+    int  num_ifm)
+{
+    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(dst);
+
+    const int ofm = get_global_id(2);
+    const int x0  = get_global_id(0) * 4 * CONV_STRIDE - paddings.x;
+    const int y0  = get_global_id(1) * CONV_STRIDE - paddings.y;
+
+    __global const uchar *src_addr     = src_ptr + src_offset_first_element_in_bytes;
+    __global const uchar *weights_addr = weights_ptr + weights_offset_first_element_in_bytes + ofm * weights_stride_w;
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    pixels = 0;
+
+    for(int ifm = 0; ifm < num_ifm; ++ifm)
+    {
+        // The 9 weights of the kernel, one row of 3 values per row of the kernel
+        VEC_DATA_TYPE(DATA_TYPE, 3)
+        weights_row0 = vload3(0, (__global const DATA_TYPE *)(weights_addr + 0 * weights_stride_y));
+        VEC_DATA_TYPE(DATA_TYPE, 3)
+        weights_row1 = vload3(0, (__global const DATA_TYPE *)(weights_addr + 1 * weights_stride_y));
+        VEC_DATA_TYPE(DATA_TYPE, 3)
+        weights_row2 = vload3(0, (__global const DATA_TYPE *)(weights_addr + 2 * weights_stride_y));
+
+        DATA_TYPE last = 0;
+        VEC_DATA_TYPE(DATA_TYPE, 8)
+        row = 0;
+
+        // The rows outside the input only read padding values
+        if(y0 >= 0 && y0 < input_dims.y)
+        {
+            row = load_row(src_addr + y0 * src_stride_y, x0, src_stride_x, input_dims.x, &last);
+            pixels += CONVOLUTION1x3(row, last, weights_row0.s0, weights_row0.s1, weights_row0.s2);
+        }
+        if(y0 + 1 >= 0 && y0 + 1 < input_dims.y)
+        {
+            row = load_row(src_addr + (y0 + 1) * src_stride_y, x0, src_stride_x, input_dims.x, &last);
+            pixels += CONVOLUTION1x3(row, last, weights_row1.s0, weights_row1.s1, weights_row1.s2);
+        }
+        if(y0 + 2 >= 0 && y0 + 2 < input_dims.y)
+        {
+            row = load_row(src_addr + (y0 + 2) * src_stride_y, x0, src_stride_x, input_dims.x, &last);
+            pixels += CONVOLUTION1x3(row, last, weights_row2.s0, weights_row2.s1, weights_row2.s2);
+        }
+
+        src_addr += src_stride_z;
+        weights_addr += weights_stride_z;
+    }
+
+#if defined(HAS_BIAS)
+    Vector biases = CONVERT_TO_VECTOR_STRUCT_NO_STEP(biases);
+
+    const DATA_TYPE bias = *((__global DATA_TYPE *)(biases.ptr + ofm * biases_stride_x));
+
+    pixels += (VEC_DATA_TYPE(DATA_TYPE, 4))bias;
+#endif /* defined(HAS_BIAS) */
+
+#if defined(FUSED_ACTIVATION)
+    pixels = ACTIVATION_OP(FUSED_ACTIVATION, DATA_TYPE, pixels);
+#endif /* defined(FUSED_ACTIVATION) */
+
+    vstore4(pixels, 0, (__global DATA_TYPE *)out.ptr);
+}
@@ -258,3 +258,146 @@ __kernel void copy_to_keypoint(
         }
     }
 }
+
+/** Count the keypoints (non-zero pixels) of each row of the valid region of an image
+ *
+ * @param[in]  input_ptr      Pointer to the input image. Supported data types: U8
+ * @param[in]  input_stride_y Stride of the input image in Y dimension (in bytes)
+ * @param[in]  input_offset   Offset of the first pixel of the valid region of the input image (in bytes)
+ * @param[in]  width          Width of the valid region of the input image
+ * @param[out] row_counts     Number of keypoints of each row of the valid region
+ */
+__kernel void count_keypoints_rows(
+    __global const uchar *input_ptr,
+    uint                  input_stride_y,
+    uint                  input_offset,
+    uint                  width,
+    __global uint *row_counts)
+{
+    const uint y = get_global_id(0);
+
+    __global const uchar *row = input_ptr + input_offset + y * input_stride_y;
+
+    uint count = 0;
+    uint x     = 0;
+
+    for(; x + 16 <= width; x += 16)
+    {
+        // The comparison sets all the bits of the lanes of the non-zero pixels
+        const uchar16 nz = as_uchar16(vload16(0, row + x) != (uchar16)0) & (uchar16)1;
+
+        const uchar8 sum8 = nz.lo + nz.hi;
+        const uchar4 sum4 = sum8.lo + sum8.hi;
+        const uchar2 sum2 = sum4.lo + sum4.hi;
+        count += sum2.s0 + sum2.s1;
+    }
+
+    for(; x < width; ++x)
+    {
+        count += (row[x] != 0) ? 1 : 0;
+    }
+
+    row_counts[y] = count;
+}
+
+/** Number of work-items of the single work-group running scan_keypoints_rows */
+#define SCAN_SIZE 128
+
+/** Replace the number of keypoints of each row by the number of keypoints of all the previous rows (exclusive prefix sum)
+ *
+ * @note The kernel must be run by a single work-group of SCAN_SIZE work-items
+ *
+ * @param[in,out] row_counts    Number of keypoints of each row on input, index of the first keypoint of each row on output
+ * @param[in]     num_rows      Number of rows of the valid region of the image
+ * @param[out]    num_of_points Total number of keypoints of the image
+ */
+__kernel void scan_keypoints_rows(
+    __global uint *row_counts,
+    uint           num_rows,
+    __global uint *num_of_points)
+{
+    __local uint partial[SCAN_SIZE];
+
+    const uint lid   = get_local_id(0);
+    const uint chunk = (num_rows + SCAN_SIZE - 1) / SCAN_SIZE;
+    const uint start = min(lid * chunk, num_rows);
+    const uint end   = min(start + chunk, num_rows);
+
+    // Sum the rows of the chunk of the work-item
+    uint sum = 0;
+    for(uint y = start; y < end; ++y)
+    {
+        sum += row_counts[y];
+    }
+    partial[lid] = sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Inclusive scan of the sums of the chunks
+    for(uint offset = 1; offset < SCAN_SIZE; offset <<= 1)
+    {
+        const uint value = (lid >= offset) ? partial[lid - offset] : 0;
+        barrier(CLK_LOCAL_MEM_FENCE);
+        partial[lid] += value;
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    // Exclusive scan of the rows of the chunk
+    uint running = partial[lid] - sum;
+    for(uint y = start; y < end; ++y)
+    {
+        const uint count = row_counts[y];
+        row_counts[y]    = running;
+        running += count;
+    }
+
+    if(lid == (SCAN_SIZE - 1))
+    {
+        *num_of_points = partial[lid];
+    }
+}
+
+/** Copy the keypoints of each row of the valid region of an image to the array at the index computed by scan_keypoints_rows
+ *
+ * The keypoints are stored in raster order, so the content of the array is the same from one run to the other.
+ *
+ * @param[in]  input_ptr      Pointer to the input image. Supported data types: U8
+ * @param[in]  input_stride_y Stride of the input image in Y dimension (in bytes)
+ * @param[in]  input_offset   Offset of the first pixel of the valid region of the input image (in bytes)
+ * @param[in]  width          Width of the valid region of the input image
+ * @param[in]  offset_x       X coordinate of the first pixel of the valid region
+ * @param[in]  offset_y       Y coordinate of the first pixel of the valid region
+ * @param[in]  max_num_points Maximum number of keypoints of the array
+ * @param[in]  row_offsets    Index of the first keypoint of each row
+ * @param[out] out            Array of keypoints
+ */
+__kernel void compact_to_keypoint(
+    __global const uchar *input_ptr,
+    uint                  input_stride_y,
+    uint                  input_offset,
+    uint                  width,
+    uint                  offset_x,
+    uint                  offset_y,
+    uint                  max_num_points,
+    __global const uint *row_offsets,
+    __global Keypoint *out)
+{
+    const uint y = get_global_id(0);
+
+    __global const uchar *row = input_ptr + input_offset + y * input_stride_y;
+
+    uint id = row_offsets[y];
+
+    for(uint x = 0; (x < width) && (id < max_num_points); ++x)
+    {
+        const uchar value = row[x];
+
+        if(value > 0)
+        {
+            out[id].strength        = value;
+            out[id].x               = x + offset_x;
+            out[id].y               = y + offset_y;
+            out[id].tracking_status = 1;
+            ++id;
+        }
+    }
+}
@@ -23,6 +23,17 @@
  */
 #include "helpers.h"
 
+#if defined(NUM_CHANNELS)
+/** Pixel of an image with NUM_CHANNELS interleaved U8 channels, e.g. RGB888, filled as a whole
+ *
+ * @note Used as DATA_TYPE: -DNUM_CHANNELS=3 -DDATA_TYPE=pixel_t
+ */
+typedef struct
+{
+    uchar channels[NUM_CHANNELS];
+} pixel_t;
+#endif /* defined(NUM_CHANNELS) */
+
 /** Fill N pixel of the padding edge of a single channel image by replicating the closest valid pixel.
  *
  * @attention  The DATA_TYPE needs to be passed at the compile time.
@@ -31,7 +42,7 @@
  * @attention  The border size for top, bottom, left, right needs to be passed at the compile time.
  * e.g. --DBORDER_SIZE_TOP=0 -DBORDER_SIZE_BOTTOM=2 -DBORDER_SIZE_LEFT=0 -DBORDER_SIZE_RIGHT=2
  *
- * @param[in,out] buf_ptr                           Pointer to the source image. Supported data types: U8, U16, S16, U32, S32, F32
+ * @param[in,out] buf_ptr                           Pointer to the source image. Supported data types: U8, U16, S16, U32, S32, F32. Supported formats: RGB888, RGBA8888 (with -DNUM_CHANNELS)
  * @param[in]     buf_stride_x                      Stride of the source image in X dimension (in bytes)
  * @param[in]     buf_step_x                        buf_stride_x * number of elements along X processed per workitem(in bytes)
  * @param[in]     buf_stride_y                      Stride of the source image in Y dimension (in bytes)
@@ -104,7 +115,7 @@ __kernel void fill_image_borders_replicate(
  * @attention  The border size for top, bottom, left, right needs to be passed at the compile time.
  * e.g. --DBORDER_SIZE_TOP=0 -DBORDER_SIZE_BOTTOM=2 -DBORDER_SIZE_LEFT=0 -DBORDER_SIZE_RIGHT=2
  *
- * @param[out] buf_ptr                           Pointer to the source image. Supported data types: U8, U16, S16, U32, S32, F32
+ * @param[out] buf_ptr                           Pointer to the source image. Supported data types: U8, U16, S16, U32, S32, F32. Supported formats: RGB888, RGBA8888 (with -DNUM_CHANNELS)
  * @param[in]  buf_stride_x                      Stride of the source image in X dimension (in bytes)
  * @param[in]  buf_step_x                        buf_stride_x * number of elements along X processed per workitem(in bytes)
  * @param[in]  buf_stride_y                      Stride of the source image in Y dimension (in bytes)
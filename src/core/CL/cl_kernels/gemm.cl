@@ -21,6 +21,7 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
+#include "activation_helpers.h"
 #include "helpers.h"
 
 /** This OpenCL kernel computes the "vector" 1x4 transposition of input matrix
@@ -246,6 +247,67 @@ __kernel void gemm_interleave4x4_8bit(IMAGE_DECLARATION(src),
     vstore16(val0, 0, ((__global uchar *)dst.ptr) + 48);
 }
 
+#if defined(DATA_TYPE)
+/** This OpenCL kernel reads the feature maps of a 1x1 convolution's input and writes them in the layout produced by the im2col and interleave 4x4 kernels
+ *
+ * The pixels of the input are the rows of the matrix to interleave and its feature maps the columns, so that the im2col step can be skipped.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F16/F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination matrix Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination matrix in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_gx_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination matrix in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_gx_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination matrix
+ * @param[in]  src_width                         Width of the source tensor
+ * @param[in]  num_elems                         Number of pixels of a feature map of the source tensor
+ * @param[in]  num_fm                            Number of feature maps of the source tensor. The columns after the last feature map are filled with 1 (bias)
+ */
+__kernel void gemm_interleave4x4_feature_maps(TENSOR3D_DECLARATION(src),
+                                              IMAGE_DECLARATION(dst),
+                                              uint src_width,
+                                              uint num_elems,
+                                              uint num_fm)
+{
+    Image dst = CONVERT_TO_IMAGE_STRUCT(dst);
+
+    const uint fm    = get_global_id(0);
+    const uint pixel = get_global_id(1) * 4;
+
+    DATA_TYPE val[4] = { 0, 0, 0, 0 };
+
+    if(fm < num_fm)
+    {
+        __global const uchar *src_fm_ptr = src_ptr + src_offset_first_element_in_bytes + fm * src_stride_z;
+
+        /* Load the 4 pixels of the block, the ones past the end of the feature map are left to 0 */
+        for(uint i = 0; i < 4 && (pixel + i) < num_elems; ++i)
+        {
+            const uint p = pixel + i;
+            val[i]       = *((__global const DATA_TYPE *)(src_fm_ptr + (p % src_width) * src_stride_x + (p / src_width) * src_stride_y));
+        }
+    }
+    else
+    {
+        val[0] = 1;
+        val[1] = 1;
+        val[2] = 1;
+        val[3] = 1;
+    }
+
+    vstore4((VEC_DATA_TYPE(DATA_TYPE, 4))(val[0], val[1], val[2], val[3]), 0, (__global DATA_TYPE *)dst.ptr);
+}
+#endif // defined(DATA_TYPE)
+
 /** This kernel accumulates each row with the biases vector
  *
  * @param[in, out] accum_ptr                            Pointer to the accumulate tensor. Supported data type: F32
@@ -412,6 +474,7 @@ __kernel void gemm_mm_u8(IMAGE_DECLARATION(src0),
  *  Matrix A and matrix B must be reshaped respectively with @ref gemm_interleave4x4_f32 and @ref gemm_transpose1x4_f32 before running the matrix multiplication
  *
  * @attention The width of matrix B and the alpha's value need to be passed at compile time using -DWIDTH_MATRIX_B and -DALPHA
+ * @note An activation function can be applied to the result before the store by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
  *
  * @param[in]  src0_ptr                           Pointer to the source matrix. Supported data types: F32
  * @param[in]  src0_stride_x                      Stride of the source matrix in X dimension (in bytes)
@@ -501,6 +564,86 @@ __kernel void gemm_mm_f32(IMAGE_DECLARATION(src0),
     c20 = c20 * (float4)ALPHA;
     c30 = c30 * (float4)ALPHA;
 
+#if defined FUSED_ACTIVATION
+    c00 = ACTIVATION_OP(FUSED_ACTIVATION, float, c00);
+    c10 = ACTIVATION_OP(FUSED_ACTIVATION, float, c10);
+    c20 = ACTIVATION_OP(FUSED_ACTIVATION, float, c20);
+    c30 = ACTIVATION_OP(FUSED_ACTIVATION, float, c30);
+#endif /* defined FUSED_ACTIVATION */
+
+    /* Store 4x4 block */
+    vstore4(c00, 0, (__global float *)(offset(&dst, 0, 0)));
+    vstore4(c10, 0, (__global float *)(offset(&dst, 0, 1)));
+    vstore4(c20, 0, (__global float *)(offset(&dst, 0, 2)));
+    vstore4(c30, 0, (__global float *)(offset(&dst, 0, 3)));
+}
+
+/** This OpenCL kernel computes the matrix multiplication between matrix A (src0) and matrix B (src1) reading matrix B through the texture cache
+ *  Matrix A and matrix B must be reshaped respectively with @ref gemm_interleave4x4_f32 and @ref gemm_transpose1x4_f32 before running the matrix multiplication,
+ *  then matrix B must be copied to a CL_RGBA / CL_FLOAT image: each texel holds 4 consecutive values of a row of the transposed matrix B
+ *
+ * @attention The width of matrix B and the alpha's value need to be passed at compile time using -DWIDTH_MATRIX_B and -DALPHA
+ * @note An activation function can be applied to the result before the store by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
+ *
+ * @param[in]  src0_ptr                           Pointer to the source matrix. Supported data types: F32
+ * @param[in]  src0_stride_x                      Stride of the source matrix in X dimension (in bytes)
+ * @param[in]  src0_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src0_stride_y                      Stride of the source matrix in Y dimension (in bytes)
+ * @param[in]  src0_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src0_offset_first_element_in_bytes The offset of the first element in the source matrix
+ * @param[in]  src1                               Image containing the transposed matrix B, WIDTH_MATRIX_B / 4 texels wide
+ * @param[out] dst_ptr                            Pointer to the destination matrix Supported data types: F32
+ * @param[in]  dst_stride_x                       Stride of the destination matrix in X dimension (in bytes)
+ * @param[in]  dst_step_x                         dst_gx_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                       Stride of the destination matrix in Y dimension (in bytes)
+ * @param[in]  dst_step_y                         dst_gx_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes  The offset of the first element in the destination matrix
+ */
+__kernel void gemm_mm_f32_image(IMAGE_DECLARATION(src0),
+                                __read_only image2d_t src1,
+                                IMAGE_DECLARATION(dst))
+{
+    /* The rows of matrix B past the end of the image are only read for the padding of the destination: clamping them to zero is safe */
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP | CLK_FILTER_NEAREST;
+
+    /* Compute address for matrix A in unit of float and coordinates of the first texel of matrix B */
+    int  src_addr_a = (get_global_id(1) * src0_stride_y + src0_offset_first_element_in_bytes) >> 2;
+    int2 coord_b    = (int2)(0, get_global_id(0));
+
+    /* Reset accumulators */
+    float4 c00 = 0.0f;
+    float4 c10 = 0.0f;
+    float4 c20 = 0.0f;
+    float4 c30 = 0.0f;
+
+    for(; coord_b.x < (WIDTH_MATRIX_B / 4); ++coord_b.x, src_addr_a += 4)
+    {
+        /* Load values from matrix A (interleaved) and matrix B (transposed) */
+        float4 a0 = vload4(0, ((__global float *)src0_ptr) + src_addr_a);
+        float4 b0 = read_imagef(src1, sampler, coord_b);
+
+        c00 += (float4)a0.s0 * b0;
+        c10 += (float4)a0.s1 * b0;
+        c20 += (float4)a0.s2 * b0;
+        c30 += (float4)a0.s3 * b0;
+    }
+
+    /* Compute destination address */
+    Image dst = CONVERT_TO_IMAGE_STRUCT(dst);
+
+    /* Multiply by the weight of matrix product */
+    c00 = c00 * (float4)ALPHA;
+    c10 = c10 * (float4)ALPHA;
+    c20 = c20 * (float4)ALPHA;
+    c30 = c30 * (float4)ALPHA;
+
+#if defined FUSED_ACTIVATION
+    c00 = ACTIVATION_OP(FUSED_ACTIVATION, float, c00);
+    c10 = ACTIVATION_OP(FUSED_ACTIVATION, float, c10);
+    c20 = ACTIVATION_OP(FUSED_ACTIVATION, float, c20);
+    c30 = ACTIVATION_OP(FUSED_ACTIVATION, float, c30);
+#endif /* defined FUSED_ACTIVATION */
+
     /* Store 4x4 block */
     vstore4(c00, 0, (__global float *)(offset(&dst, 0, 0)));
     vstore4(c10, 0, (__global float *)(offset(&dst, 0, 1)));
@@ -512,6 +655,7 @@ __kernel void gemm_mm_f32(IMAGE_DECLARATION(src0),
  *  Matrix A and matrix B must be reshaped respectively with @ref gemm_interleave4x4_f16 and @ref gemm_transpose1x8_f16 before running the matrix multiplication
  *
  * @attention The width of matrix B and the alpha's value need to be passed at compile time using -DWIDTH_MATRIX_B and -DALPHA
+ * @note An activation function can be applied to the result before the store by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
  *
  * @param[in]  src0_ptr                           Pointer to the source matrix. Supported data types: F16
  * @param[in]  src0_stride_x                      Stride of the source matrix in X dimension (in bytes)
@@ -600,6 +744,13 @@ __kernel void gemm_mm_f16(IMAGE_DECLARATION(src0),
     c20 = c20 * (half8)ALPHA;
     c30 = c30 * (half8)ALPHA;
 
+#if defined FUSED_ACTIVATION
+    c00 = ACTIVATION_OP(FUSED_ACTIVATION, half, c00);
+    c10 = ACTIVATION_OP(FUSED_ACTIVATION, half, c10);
+    c20 = ACTIVATION_OP(FUSED_ACTIVATION, half, c20);
+    c30 = ACTIVATION_OP(FUSED_ACTIVATION, half, c30);
+#endif /* defined FUSED_ACTIVATION */
+
     /* Store 4x8 block */
     vstore8(c00, 0, (__global half *)(offset(&dst, 0, 0)));
     vstore8(c10, 0, (__global half *)(offset(&dst, 0, 1)));
@@ -671,6 +822,10 @@ __kernel void gemm_vm_f32(IMAGE_DECLARATION(src0),
     /* Multiply by the weight of vector-matrix product */
     acc = acc * (float4)ALPHA;
 
+#if defined FUSED_ACTIVATION
+    acc = ACTIVATION_OP(FUSED_ACTIVATION, float, acc);
+#endif /* defined FUSED_ACTIVATION */
+
     vstore4(acc, 0, (__global float *)(offset(&dst, 0, 0)));
 }
 
@@ -741,11 +896,123 @@ __kernel void gemm_vm_f16(IMAGE_DECLARATION(src0),
     /* Multiply by the weight of vector-matrix product */
     acc = acc * (half8)ALPHA;
 
+#if defined FUSED_ACTIVATION
+    acc = ACTIVATION_OP(FUSED_ACTIVATION, half, acc);
+#endif /* defined FUSED_ACTIVATION */
+
     vstore8(acc, 0, (__global half *)(offset(&dst, 0, 0)));
 }
 #endif /* (defined WIDTH_VECTOR_A) */
 #endif /* (defined WIDTH_MATRIX_B && defined ALPHA) */
 
+#if defined(DATA_TYPE) && defined(WIDTH_VECTOR_A) && defined(LWS)
+#if !defined(WEIGHTS_TYPE)
+#define WEIGHTS_TYPE DATA_TYPE
+#endif /* !defined(WEIGHTS_TYPE) */
+#if !defined(WEIGHTS_OFFSET)
+#define WEIGHTS_OFFSET 0
+#endif /* !defined(WEIGHTS_OFFSET) */
+
+/** This OpenCL kernel computes the dot products of the vector A (src0) with the rows of the matrix B (src1): each work-group computes one element of the output
+ *
+ * The LWS work-items of a work-group run through the row of matrix B 4 elements at a time, each accumulating its own partial dot product,
+ * which are then summed in local memory. The optional biases are added to the result.
+ *
+ * @attention The data type, the width of vector A and the number of work-items per work-group need to be passed at compile time using -DDATA_TYPE, -DWIDTH_VECTOR_A and -DLWS
+ *            e.g. -DDATA_TYPE=half -DWIDTH_VECTOR_A=9216 -DLWS=64. LWS must be a power of 2.
+ * @attention If biases are added, -DHAS_BIAS must be passed at compile time
+ * @attention If matrix B is stored in another data type than vector A, it has to be passed at compile time using -DWEIGHTS_TYPE e.g. -DWEIGHTS_TYPE=uchar.
+ *            The elements of matrix B are then converted to DATA_TYPE as they are loaded.
+ * @attention Quantized elements of matrix B are dequantized on the fly if -DHAS_SCALES is passed at compile time: the zero point has to be passed using -DWEIGHTS_OFFSET
+ *            (0 if not defined) and each dot product is multiplied by the scale of its row of matrix B before the biases are added.
+ *
+ * @note The input vector A and matrix B must not be reshaped: each row of matrix B contains WIDTH_VECTOR_A elements.
+ *
+ * @param[in]  src0_ptr                             Pointer to the source vector. Supported data types: F16, F32
+ * @param[in]  src0_stride_x                        Stride of the source vector in X dimension (in bytes)
+ * @param[in]  src0_step_x                          src0_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src0_offset_first_element_in_bytes   The offset of the first element in the source vector
+ * @param[in]  src1_ptr                             Pointer to the source matrix. Supported data types: same as @p src0_ptr, U8 or F16 if WEIGHTS_TYPE is defined
+ * @param[in]  src1_stride_x                        Stride of the source matrix in X dimension (in bytes)
+ * @param[in]  src1_step_x                          src1_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src1_stride_y                        Stride of the source matrix in Y dimension (in bytes)
+ * @param[in]  src1_step_y                          src1_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src1_offset_first_element_in_bytes   The offset of the first element in the source matrix
+ * @param[in]  scales_ptr                           (Optional) Pointer to the scales of the rows of the source matrix. Supported data types: same as @p src0_ptr
+ * @param[in]  scales_stride_x                      (Optional) Stride of the scales vector in X dimension (in bytes)
+ * @param[in]  scales_step_x                        (Optional) scales_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  scales_offset_first_element_in_bytes (Optional) The offset of the first element in the scales vector
+ * @param[in]  biases_ptr                           (Optional) Pointer to the biases vector. Supported data types: same as @p src0_ptr
+ * @param[in]  biases_stride_x                      (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  biases_step_x                        (Optional) biases_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  biases_offset_first_element_in_bytes (Optional) The offset of the first element in the biases vector
+ * @param[out] dst_ptr                              Pointer to the destination vector. Supported data types: same as @p src0_ptr
+ * @param[in]  dst_stride_x                         Stride of the destination vector in X dimension (in bytes)
+ * @param[in]  dst_step_x                           dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes    The offset of the first element in the destination vector
+ */
+__kernel void gemm_mv(VECTOR_DECLARATION(src0),
+                      IMAGE_DECLARATION(src1),
+#if defined(HAS_SCALES)
+                      VECTOR_DECLARATION(scales),
+#endif /* defined(HAS_SCALES) */
+#if defined(HAS_BIAS)
+                      VECTOR_DECLARATION(biases),
+#endif /* defined(HAS_BIAS) */
+                      VECTOR_DECLARATION(dst))
+{
+    __local DATA_TYPE partial_sums[LWS];
+
+    const int lid = get_local_id(0);
+    const int row = get_global_id(1);
+
+    __global const DATA_TYPE *vec_a = (__global const DATA_TYPE *)(src0_ptr + src0_offset_first_element_in_bytes);
+    __global const WEIGHTS_TYPE *mtx_b = (__global const WEIGHTS_TYPE *)(src1_ptr + src1_offset_first_element_in_bytes + row * src1_stride_y);
+
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    acc = 0;
+
+    // The weights are converted and the zero point is removed in registers: only the narrow weights are read from memory
+    int i = lid * 4;
+    for(; i <= (WIDTH_VECTOR_A - 4); i += LWS * 4)
+    {
+        acc += vload4(0, vec_a + i) * (CONVERT(vload4(0, mtx_b + i), VEC_DATA_TYPE(DATA_TYPE, 4)) - (DATA_TYPE)WEIGHTS_OFFSET);
+    }
+
+    // The last elements of the row are shared one by one among the work-items
+    DATA_TYPE sum = acc.s0 + acc.s1 + acc.s2 + acc.s3;
+    for(i = (WIDTH_VECTOR_A & ~3) + lid; i < WIDTH_VECTOR_A; i += LWS)
+    {
+        sum += vec_a[i] * ((DATA_TYPE)mtx_b[i] - (DATA_TYPE)WEIGHTS_OFFSET);
+    }
+
+    partial_sums[lid] = sum;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Sum the partial dot products of the work-items in local memory
+    for(int active = LWS / 2; active > 0; active /= 2)
+    {
+        if(lid < active)
+        {
+            partial_sums[lid] += partial_sums[lid + active];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if(lid == 0)
+    {
+        DATA_TYPE res = partial_sums[0];
+#if defined(HAS_SCALES)
+        res *= *((__global DATA_TYPE *)(scales_ptr + scales_offset_first_element_in_bytes + row * scales_stride_x));
+#endif /* defined(HAS_SCALES) */
+#if defined(HAS_BIAS)
+        res += *((__global DATA_TYPE *)(biases_ptr + biases_offset_first_element_in_bytes + row * biases_stride_x));
+#endif /* defined(HAS_BIAS) */
+        *((__global DATA_TYPE *)(dst_ptr + dst_offset_first_element_in_bytes + row * dst_stride_x)) = res;
+    }
+}
+#endif /* defined(DATA_TYPE) && defined(WIDTH_VECTOR_A) && defined(LWS) */
+
 /** This OpenCL kernel performs the in-place matrix addition between 2 matrices taking into account that the second matrix might be weighted by a scalar value beta:
  *
  * @attention The beta's value need to be passed at compile time using -DBETA
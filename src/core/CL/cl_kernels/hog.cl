@@ -0,0 +1,331 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+#include "types.h"
+
+#if defined(CELL_WIDTH) && defined(CELL_HEIGHT) && defined(NUM_BINS)
+/** This OpenCL kernel computes the HOG orientation binning
+ *
+ * @attention The following variables must be passed at compile time:
+ *
+ * -# -DCELL_WIDTH = Width of the cell
+ * -# -DCELL_HEIGHT = Height of the cell
+ * -# -DNUM_BINS = Number of bins for each cell
+ *
+ * @param[in]  mag_ptr                             Pointer to the source image which stores the magnitude of the gradient for each pixel. Supported data types: S16
+ * @param[in]  mag_stride_x                        Stride of the magnitude image in X dimension (in bytes)
+ * @param[in]  mag_step_x                          mag_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  mag_stride_y                        Stride of the magnitude image in Y dimension (in bytes)
+ * @param[in]  mag_step_y                          mag_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  mag_offset_first_element_in_bytes   The offset of the first element in the magnitude image
+ * @param[in]  phase_ptr                           Pointer to the source image which stores the phase of the gradient for each pixel. Supported data types: U8
+ * @param[in]  phase_stride_x                      Stride of the phase image in X dimension (in bytes)
+ * @param[in]  phase_step_x                        phase_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  phase_stride_y                      Stride of the the phase image in Y dimension (in bytes)
+ * @param[in]  phase_step_y                        phase_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  phase_offset_first_element_in_bytes The offset of the first element in the the phase image
+ * @param[out] dst_ptr                             Pointer to the destination image which stores the local HOG for each cell Supported data types: F32. Number of channels supported: equal to the number of histogram bins per cell
+ * @param[in]  dst_stride_x                        Stride of the destination image in X dimension (in bytes)
+ * @param[in]  dst_step_x                          dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                        Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  dst_step_y                          dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes   The offset of the first element in the destination image
+ * @param[in]  phase_scale                         Scale factor to apply to the phase in order to calculate the histogram index
+ */
+__kernel void hog_orientation_binning(IMAGE_DECLARATION(mag),
+                                      IMAGE_DECLARATION(phase),
+                                      IMAGE_DECLARATION(dst),
+                                      float phase_scale)
+{
+    float bins[NUM_BINS] = { 0 };
+
+    // Compute address for the magnitude and phase images
+    Image mag   = CONVERT_TO_IMAGE_STRUCT(mag);
+    Image phase = CONVERT_TO_IMAGE_STRUCT(phase);
+
+    for(int yc = 0; yc < CELL_HEIGHT; ++yc)
+    {
+        for(int xc = 0; xc < CELL_WIDTH; ++xc)
+        {
+            const float mag_value   = *((__global short *)offset(&mag, xc, yc));
+            const float phase_value = *(offset(&phase, xc, yc)) * phase_scale + 0.5f;
+            const float w1          = phase_value - floor(phase_value);
+
+            // The quantised phase is the histogram index [0, NUM_BINS - 1]
+            // Check limit of histogram index. If hidx == NUM_BINS, hidx = 0
+            const uint hidx = (uint)phase_value % NUM_BINS;
+
+            // Weighted vote between 2 bins
+            bins[hidx] += mag_value * (1.0f - w1);
+            bins[(hidx + 1) % NUM_BINS] += mag_value * w1;
+        }
+    }
+
+    // Compute address for the destination image
+    Image dst = CONVERT_TO_IMAGE_STRUCT(dst);
+
+    __global float *dst_ptr = (__global float *)dst.ptr;
+
+    for(int i = 0; i < NUM_BINS; ++i)
+    {
+        dst_ptr[i] = bins[i];
+    }
+}
+#endif /* CELL_WIDTH and CELL_HEIGHT and NUM_BINS */
+
+#if defined(NUM_CELLS_PER_BLOCK_HEIGHT) && defined(NUM_BINS_PER_BLOCK_X) && defined(NUM_BINS_PER_BLOCK)
+/** This OpenCL kernel computes the HOG block normalization
+ *
+ * @attention The following variables must be passed at compile time:
+ *
+ * -# -DNUM_CELLS_PER_BLOCK_HEIGHT = Number of cells for each block along the Y direction
+ * -# -DNUM_BINS_PER_BLOCK_X = Number of bins per block along the X direction
+ * -# -DNUM_BINS_PER_BLOCK = Number of bins per block
+ * -# -DL2_NORM, -DL2HYS_NORM or -DL1_NORM = Normalization type
+ *
+ * @param[in]  src_ptr                           Pointer to the source image which stores the local HOG for each cell. Supported data types: F32. Number of channels supported: equal to the number of histogram bins per cell
+ * @param[in]  src_stride_x                      Stride of the source image in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source image in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source image
+ * @param[out] dst_ptr                           Pointer to the destination image which stores the normalised blocks. Supported data types: F32. Number of channels supported: equal to the number of histogram bins per block
+ * @param[in]  dst_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  l2_hyst_threshold                 Threshold used for the L2HYS_NORM normalization
+ */
+__kernel void hog_block_normalization(IMAGE_DECLARATION(src),
+                                      IMAGE_DECLARATION(dst),
+                                      float l2_hyst_threshold)
+{
+    Image src = CONVERT_TO_IMAGE_STRUCT(src);
+    Image dst = CONVERT_TO_IMAGE_STRUCT(dst);
+
+    __global float *dst_ptr = (__global float *)dst.ptr;
+
+    float sum = 0.0f;
+
+    // Copy the cells of the block to the destination and accumulate the norm
+    for(int yc = 0; yc < NUM_CELLS_PER_BLOCK_HEIGHT; ++yc)
+    {
+        __global const float *hist_ptr = (__global const float *)offset(&src, 0, yc);
+
+        for(int xc = 0; xc < NUM_BINS_PER_BLOCK_X; ++xc)
+        {
+            const float value = hist_ptr[xc];
+
+#if defined(L1_NORM)
+            sum += fabs(value);
+#else  /* L1_NORM */
+            sum += value * value;
+#endif /* L1_NORM */
+
+            dst_ptr[xc + yc * NUM_BINS_PER_BLOCK_X] = value;
+        }
+    }
+
+    float scale = 1.0f / (sqrt(sum) + NUM_BINS_PER_BLOCK * 0.1f);
+
+#if defined(L2HYS_NORM)
+    // Clip the scaled values and compute the norm again
+    sum = 0.0f;
+
+    for(int i = 0; i < NUM_BINS_PER_BLOCK; ++i)
+    {
+        const float value = fmin(dst_ptr[i] * scale, l2_hyst_threshold);
+
+        sum += value * value;
+
+        dst_ptr[i] = value;
+    }
+
+    // We use the same constants of OpenCV
+    scale = 1.0f / (sqrt(sum) + 1e-3f);
+#endif /* L2HYS_NORM */
+
+    for(int i = 0; i < NUM_BINS_PER_BLOCK; ++i)
+    {
+        dst_ptr[i] *= scale;
+    }
+}
+#endif /* NUM_CELLS_PER_BLOCK_HEIGHT and NUM_BINS_PER_BLOCK_X and NUM_BINS_PER_BLOCK */
+
+#if defined(NUM_ITEMS_PER_WINDOW) && defined(NUM_BINS_PER_DESCRIPTOR_X) && defined(NUM_BLOCKS_PER_DESCRIPTOR_Y) && defined(BIAS_INDEX)
+/** This OpenCL kernel computes the linear SVM score of the detection windows and appends the windows above the threshold to the output array
+ *
+ * Each detection window is processed by a work-group of NUM_ITEMS_PER_WINDOW work-items along X: every work-item multiplies a strided part of the descriptor,
+ * then the partial scores are summed with a reduction in local memory.
+ *
+ * @attention The following variables must be passed at compile time:
+ *
+ * -# -DNUM_ITEMS_PER_WINDOW = Number of work-items per detection window. It must be a power of 2 and the size of the work-group along X
+ * -# -DNUM_BINS_PER_DESCRIPTOR_X = Number of bins per descriptor along the X direction
+ * -# -DNUM_BLOCKS_PER_DESCRIPTOR_Y = Number of blocks per descriptor along the Y direction
+ * -# -DBIAS_INDEX = Index of the bias in the HOG descriptor
+ * -# -DWINDOW_STEP_X = Distance in blocks between 2 consecutive detection windows along the X direction
+ * -# -DDETECTION_WINDOW_STRIDE_WIDTH, -DDETECTION_WINDOW_STRIDE_HEIGHT = Distance in pixels between 2 consecutive detection windows
+ * -# -DDETECTION_WINDOW_WIDTH, -DDETECTION_WINDOW_HEIGHT = Size of the detection window
+ * -# -DIDX_CLASS = Index of the class of the detection windows
+ *
+ * @param[in]  src_ptr                           Pointer to the source image which stores the normalised blocks. Supported data types: F32. Number of channels supported: equal to the number of histogram bins per block
+ * @param[in]  src_stride_x                      Stride of the source image in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source image in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source image
+ * @param[in]  hog_descriptor                    Pointer to the HOG descriptor. Supported data types: F32
+ * @param[out] dst                               Pointer to the detection windows found
+ * @param[out] num_detection_windows             Number of detection windows found
+ * @param[in]  max_num_detection_windows         Maximum number of detection windows the destination array can hold
+ * @param[in]  threshold                         Threshold for the distance between features and SVM classifying plane
+ */
+__kernel void hog_detector(IMAGE_DECLARATION(src),
+                           __global const float *hog_descriptor,
+                           __global DetectionWindow *dst,
+                           __global uint *num_detection_windows,
+                           uint  max_num_detection_windows,
+                           float threshold)
+{
+    __local float partial_scores[NUM_ITEMS_PER_WINDOW];
+
+    const uint lid = get_local_id(0);
+
+    // Top-left block of the detection window
+    __global const uchar *window_ptr = src_ptr + src_offset_first_element_in_bytes + get_group_id(0) * WINDOW_STEP_X * src_stride_x + get_global_id(1) * src_step_y;
+
+    // Compute the partial score of the work-item: consecutive work-items read consecutive values of the descriptor
+    float score = 0.0f;
+
+    for(uint i = lid; i < NUM_BINS_PER_DESCRIPTOR_X * NUM_BLOCKS_PER_DESCRIPTOR_Y; i += NUM_ITEMS_PER_WINDOW)
+    {
+        const uint yb = i / NUM_BINS_PER_DESCRIPTOR_X;
+        const uint xb = i - yb * NUM_BINS_PER_DESCRIPTOR_X;
+
+        score += ((__global const float *)(window_ptr + yb * src_stride_y))[xb] * hog_descriptor[i];
+    }
+
+    partial_scores[lid] = score;
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Sum the partial scores of the work-group
+    for(uint i = NUM_ITEMS_PER_WINDOW / 2; i > 0; i >>= 1)
+    {
+        if(lid < i)
+        {
+            partial_scores[lid] += partial_scores[lid + i];
+        }
+
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+
+    if(lid == 0)
+    {
+        score = partial_scores[0] + hog_descriptor[BIAS_INDEX];
+
+        if(score > threshold)
+        {
+            const uint id = atomic_inc(num_detection_windows);
+
+            if(id < max_num_detection_windows)
+            {
+                dst[id].x         = get_group_id(0) * DETECTION_WINDOW_STRIDE_WIDTH;
+                dst[id].y         = get_global_id(1) * DETECTION_WINDOW_STRIDE_HEIGHT;
+                dst[id].width     = DETECTION_WINDOW_WIDTH;
+                dst[id].height    = DETECTION_WINDOW_HEIGHT;
+                dst[id].idx_class = IDX_CLASS;
+                dst[id].score     = score;
+            }
+        }
+    }
+}
+#endif /* NUM_ITEMS_PER_WINDOW and NUM_BINS_PER_DESCRIPTOR_X and NUM_BLOCKS_PER_DESCRIPTOR_Y and BIAS_INDEX */
+
+/** This OpenCL kernel performs the non-maxima suppression of the detection windows and compacts the remaining ones into the output array
+ *
+ * Each work-item processes a candidate: it is suppressed if a candidate with a higher score, or the same score and a lower index,
+ * has its centre closer than min_distance.
+ *
+ * @param[in]  candidates            Pointer to the detection windows found by the detectors
+ * @param[in]  num_candidates        Number of detection windows found by the detectors
+ * @param[out] dst                   Pointer to the detection windows which are not suppressed
+ * @param[out] num_detection_windows Number of detection windows which are not suppressed
+ * @param[in]  max_num_candidates    Maximum number of detection windows the candidates array can hold
+ * @param[in]  max_num_dst           Maximum number of detection windows the destination array can hold
+ * @param[in]  min_distance          Radial Euclidean distance for the non-maxima suppression
+ */
+__kernel void hog_non_maxima_suppression(__global const DetectionWindow *candidates,
+                                         __global const uint *num_candidates,
+                                         __global DetectionWindow *dst,
+                                         __global uint *num_detection_windows,
+                                         uint  max_num_candidates,
+                                         uint  max_num_dst,
+                                         float min_distance)
+{
+    const uint idx       = get_global_id(0);
+    const uint num_valid = min(*num_candidates, max_num_candidates);
+
+    if(idx >= num_valid)
+    {
+        return;
+    }
+
+    const DetectionWindow cur = candidates[idx];
+
+    if(0.0f == cur.score)
+    {
+        return;
+    }
+
+    const float xc                = cur.x + cur.width * 0.5f;
+    const float yc                = cur.y + cur.height * 0.5f;
+    const float min_distance_pow2 = min_distance * min_distance;
+
+    for(uint i = 0; i < num_valid; ++i)
+    {
+        const DetectionWindow other = candidates[i];
+
+        // Only a better window can suppress the current one
+        if((other.score > cur.score) || ((other.score == cur.score) && (i < idx)))
+        {
+            const float dx = xc - (other.x + other.width * 0.5f);
+            const float dy = yc - (other.y + other.height * 0.5f);
+
+            if((0.0f != other.score) && ((dx * dx + dy * dy) < min_distance_pow2))
+            {
+                return;
+            }
+        }
+    }
+
+    const uint id = atomic_inc(num_detection_windows);
+
+    if(id < max_num_dst)
+    {
+        dst[id] = cur;
+    }
+}
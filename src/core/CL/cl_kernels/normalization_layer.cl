@@ -152,3 +152,149 @@ __kernel void normalization_layer_in_map(TENSOR3D_DECLARATION(input),
 
     vstore4(CONVERT(normalized_pixel, VEC_DATA_TYPE(DATA_TYPE, 4)), 0, (__global DATA_TYPE *)out.ptr);
 }
+
+/** Apply cross map normalization without a squared input.
+ *
+ * Each work item walks all the feature maps of 4 consecutive elements of a row: the sum of the squares of the feature maps within
+ * the normalization window is updated as the window slides, so each element is squared once and read twice.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ *
+ * @param[in]  input_ptr                            Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  input_stride_x                       Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  input_step_x                         input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  input_stride_y                       Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  input_step_y                         input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  input_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  input_step_z                         input_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  input_offset_first_element_in_bytes  The offset of the first element in the source tensor
+ * @param[out] output_ptr                           Pointer to the destination tensor. Supported data types: same as @p input_ptr
+ * @param[in]  output_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  output_step_x                        output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  output_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  output_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  output_step_z                        output_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  output_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  coeff                                Alpha parameter / norm_size
+ * @param[in]  beta                                 Beta parameter in the normalization equation
+ * @param[in]  kappa                                Kappa parameter in the normalization equation
+ * @param[in]  radius                               Number of elements on the right or left side to normalize across
+ * @param[in]  num_slices                           Number of feature maps
+ */
+__kernel void normalization_layer_cross_map_sliding(TENSOR3D_DECLARATION(input),
+                                                    TENSOR3D_DECLARATION(output),
+                                                    float coeff,
+                                                    float beta,
+                                                    float kappa,
+                                                    uint  radius,
+                                                    uint  num_slices)
+{
+    Tensor3D in  = CONVERT_TO_TENSOR3D_STRUCT(input);
+    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(output);
+
+    float4 acc_vec = 0;
+
+    // The feature maps on the right side of the first window
+    for(int i = 0; i < min((int)radius, (int)num_slices); ++i)
+    {
+        const float4 value = CONVERT(vload4(0, (__global DATA_TYPE *)(in.ptr + i * input_stride_z)), float4);
+        acc_vec += value * value;
+    }
+
+    for(int z = 0; z < (int)num_slices; ++z)
+    {
+        // Slide the window by one feature map
+        const int right_slice = z + (int)radius;
+        const int left_slice  = z - (int)radius - 1;
+        if(right_slice < (int)num_slices)
+        {
+            const float4 value = CONVERT(vload4(0, (__global DATA_TYPE *)(in.ptr + right_slice * input_stride_z)), float4);
+            acc_vec += value * value;
+        }
+        if(left_slice >= 0)
+        {
+            const float4 value = CONVERT(vload4(0, (__global DATA_TYPE *)(in.ptr + left_slice * input_stride_z)), float4);
+            acc_vec -= value * value;
+        }
+
+        // The subtractions might leave a small negative rounding error
+        const float4 normalized = pow((float4)kappa + coeff * fmax(acc_vec, (float4)0.f), beta);
+
+        const float4 normalized_pixel = CONVERT(vload4(0, (__global DATA_TYPE *)(in.ptr + z * input_stride_z)), float4) / normalized;
+
+        vstore4(CONVERT(normalized_pixel, VEC_DATA_TYPE(DATA_TYPE, 4)), 0, (__global DATA_TYPE *)(out.ptr + z * output_stride_z));
+    }
+}
+
+#if defined(RADIUS) && defined(LWS_X)
+/** Apply in map normalization without a squared input.
+ *
+ * The work items of a work-group square the elements of a tile of LWS_X * 4 elements of a row and of its halo of RADIUS elements on each side once,
+ * in local memory, then each work item normalizes 4 consecutive elements. The values outside the row are zero: no border has to be filled.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ * @note The radius of the normalization should be given as a preprocessor argument using -DRADIUS=radius. e.g. -DRADIUS=2
+ * @note The local workgroup size along X should be given as a preprocessor argument using -DLWS_X=size. e.g. -DLWS_X=16
+ *
+ * @param[in]  input_ptr                            Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  input_stride_x                       Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  input_step_x                         input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  input_stride_y                       Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  input_step_y                         input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  input_stride_z                       Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  input_step_z                         input_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  input_offset_first_element_in_bytes  The offset of the first element in the source tensor
+ * @param[out] output_ptr                           Pointer to the destination tensor. Supported data types: same as @p input_ptr
+ * @param[in]  output_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  output_step_x                        output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  output_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  output_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  output_step_z                        output_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  output_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  coeff                                Alpha parameter / norm_size
+ * @param[in]  beta                                 Beta parameter in the normalization equation
+ * @param[in]  kappa                                Kappa parameter in the normalization equation
+ * @param[in]  width                                Width of the source tensor
+ */
+__kernel void normalization_layer_in_map_local(TENSOR3D_DECLARATION(input),
+                                               TENSOR3D_DECLARATION(output),
+                                               float coeff,
+                                               float beta,
+                                               float kappa,
+                                               int   width)
+{
+    __local float squares[LWS_X * 4 + 2 * RADIUS];
+
+    Tensor3D in  = CONVERT_TO_TENSOR3D_STRUCT(input);
+    Tensor3D out = CONVERT_TO_TENSOR3D_STRUCT(output);
+
+    const int lid         = get_local_id(0);
+    const int current_pos = get_global_id(0) << 2;
+    const int tile_start  = current_pos - (lid << 2) - RADIUS;
+
+    // Square the tile and its halo, the work items load strided elements so that the accesses of a work-group are consecutive
+    __global const uchar *row = in.ptr - current_pos * input_stride_x;
+    for(int i = lid; i < LWS_X * 4 + 2 * RADIUS; i += LWS_X)
+    {
+        const int   x     = tile_start + i;
+        const float value = (x >= 0 && x < width) ? (float)(*((__global DATA_TYPE *)(row + x * input_stride_x))) : 0.f;
+        squares[i]        = value * value;
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    float4 acc_vec = 0;
+    for(int i = 0; i <= 2 * RADIUS; ++i)
+    {
+        acc_vec += vload4(0, squares + (lid << 2) + i);
+    }
+
+    const float4 normalized = pow((float4)kappa + coeff * acc_vec, beta);
+
+    const float4 normalized_pixel = CONVERT(vload4(0, (__global DATA_TYPE *)in.ptr), float4) / normalized;
+
+    vstore4(CONVERT(normalized_pixel, VEC_DATA_TYPE(DATA_TYPE, 4)), 0, (__global DATA_TYPE *)out.ptr);
+}
+#endif /* defined(RADIUS) && defined(LWS_X) */
@@ -59,19 +59,36 @@ typedef struct InternalKeypoint
 #define D0 ((float)(1 << W_BITS))
 #define D1 (1.0f / (float)(1 << (W_BITS - 5)))
 
+#if defined(NUM_POINTS_FROM_BUFFER)
+/** The number of keypoints is read from a device buffer (e.g. written by compact_to_keypoint): the kernels are enqueued for the maximum number of keypoints and the work-items past the number of keypoints return */
+#define NUM_POINTS_DECLARATION , __global const uint *num_points
+#define RETURN_IF_PAST_NUM_POINTS(idx) \
+    if((uint)(idx) >= *num_points)     \
+    {                                  \
+        return;                        \
+    }
+#else /* defined(NUM_POINTS_FROM_BUFFER) */
+#define NUM_POINTS_DECLARATION
+#define RETURN_IF_PAST_NUM_POINTS(idx)
+#endif /* defined(NUM_POINTS_FROM_BUFFER) */
+
 /** Initializes the internal new points array when the level of pyramid is NOT equal to max.
  *
  * @param[in,out] old_points_internal An array of internal key points that are defined at the old_images high resolution pyramid.
  * @param[in,out] new_points_internal An array of internal key points that are defined at the new_images high resolution pyramid.
  * @param[in]     scale               Scale factor to apply for the new_point coordinates.
+ * @param[in]     num_points          (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 __kernel void init_level(
     __global float4 *old_points_internal,
     __global float4 *new_points_internal,
-    const float      scale)
+    const float      scale
+    NUM_POINTS_DECLARATION)
 {
     int idx = get_global_id(0);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     // Get old and new keypoints
     float4 old_point = old_points_internal[idx];
     float4 new_point = new_points_internal[idx];
@@ -90,15 +107,19 @@ __kernel void init_level(
  * @param[in,out] old_points_internal An array of internal key points that are defined at the old_images high resolution pyramid.
  * @param[out]    new_points_internal An array of internal key points that are defined at the new_images high resolution pyramid.
  * @param[in]     scale               Scale factor to apply for the new_point coordinates.
+ * @param[in]     num_points          (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 __kernel void init_level_max(
     __global Keypoint *old_points,
     __global InternalKeypoint *old_points_internal,
     __global InternalKeypoint *new_points_internal,
-    const float                scale)
+    const float                scale
+    NUM_POINTS_DECLARATION)
 {
     int idx = get_global_id(0);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     Keypoint old_point = old_points[idx];
 
     // Get old keypoint to track
@@ -119,16 +140,20 @@ __kernel void init_level_max(
  * @param[in,out] old_points_internal  An array of internal key points that are defined at the old_images high resolution pyramid.
  * @param[out]    new_points_internal  An array of internal key points that are defined at the new_images high resolution pyramid.
  * @param[in]     scale                Scale factor to apply for the new_point coordinates.
+ * @param[in]     num_points           (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 __kernel void init_level_max_initial_estimate(
     __global Keypoint *old_points,
     __global Keypoint *new_points_estimates,
     __global InternalKeypoint *old_points_internal,
     __global InternalKeypoint *new_points_internal,
-    const float                scale)
+    const float                scale
+    NUM_POINTS_DECLARATION)
 {
     int idx = get_global_id(0);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     Keypoint         old_point          = old_points[idx];
     Keypoint         new_point_estimate = new_points_estimates[idx];
     InternalKeypoint old_point_internal;
@@ -153,13 +178,17 @@ __kernel void init_level_max_initial_estimate(
  *
  * @param[in]  new_points_internal An array of estimate key points that are defined at the new_images high resolution pyramid.
  * @param[out] new_points          An array of internal key points that are defined at the new_images high resolution pyramid.
+ * @param[in]  num_points          (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 __kernel void finalize(
     __global InternalKeypoint *new_points_internal,
-    __global Keypoint *new_points)
+    __global Keypoint *new_points
+    NUM_POINTS_DECLARATION)
 {
     int idx = get_global_id(0);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     // Load internal keypoint
     InternalKeypoint new_point_internal = new_points_internal[idx];
 
@@ -203,6 +232,7 @@ __kernel void finalize(
  * @param[in]      border_limits                               It stores the right border limit (width - window_dimension - 1, height - window_dimension - 1,)
  * @param[in]      eig_const                                   1.0f / (float)(2.0f * window_dimension * window_dimension)
  * @param[in]      level0                                      It is set to 1 if level 0 of the pyramid
+ * @param[in]      num_points                                  (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 void __kernel lktracker_stage0(
     IMAGE_DECLARATION(old_image),
@@ -217,10 +247,13 @@ void __kernel lktracker_stage0(
     const int        half_window,
     const float3     border_limits,
     const float      eig_const,
-    const int        level0)
+    const int        level0
+    NUM_POINTS_DECLARATION)
 {
     int idx = get_global_id(0);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     Image old_image     = CONVERT_TO_IMAGE_STRUCT_NO_STEP(old_image);
     Image old_scharr_gx = CONVERT_TO_IMAGE_STRUCT_NO_STEP(old_scharr_gx);
     Image old_scharr_gy = CONVERT_TO_IMAGE_STRUCT_NO_STEP(old_scharr_gy);
@@ -354,6 +387,7 @@ void __kernel lktracker_stage0(
  * @param[in]      level0                                  It is set to 1 if level of pyramid = 0
  * @param[in]      term_iteration                          It is set to 1 if termination = VX_TERM_CRITERIA_ITERATIONS
  * @param[in]      term_epsilon                            It is set to 1 if termination = VX_TERM_CRITERIA_EPSILON
+ * @param[in]      num_points                              (Only if NUM_POINTS_FROM_BUFFER is defined) Number of key points to process, the work-items past it return.
  */
 void __kernel lktracker_stage1(
     IMAGE_DECLARATION(new_image),
@@ -369,11 +403,14 @@ void __kernel lktracker_stage1(
     const float      eig_const,
     const int        level0,
     const int        term_iteration,
-    const int        term_epsilon)
+    const int        term_epsilon
+    NUM_POINTS_DECLARATION)
 {
     int   idx       = get_global_id(0);
     Image new_image = CONVERT_TO_IMAGE_STRUCT_NO_STEP(new_image);
 
+    RETURN_IF_PAST_NUM_POINTS(idx);
+
     // G.s0 = A11, G.s1 = A12, G.s2 = A22, G.s3 = min_eig
     float4 G = coeff[idx];
 
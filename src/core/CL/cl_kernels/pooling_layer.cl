@@ -149,3 +149,86 @@ __kernel void pooling_layer_3(
     // Store result
     *(__global DATA_TYPE *)output.ptr = res;
 }
+
+#if defined(POOL_SIZE) && defined(POOL_STRIDE_X) && defined(POOL_STRIDE_Y)
+/** Number of outputs computed by a work-group along each dimension */
+#define TILE_OUT 8
+/** Size of the input tile, halo included, read by a work-group */
+#define TILE_W ((TILE_OUT - 1) * POOL_STRIDE_X + POOL_SIZE)
+#define TILE_H ((TILE_OUT - 1) * POOL_STRIDE_Y + POOL_SIZE)
+
+/** Performs a pooling function on overlapping pooling windows by staging the input tile of the work-group in local memory.
+ *
+ * Each input element is read once from global memory by the work-group instead of once for each pooling window which contains it.
+ *
+ * @note The kernel must be enqueued with a local workgroup size of 8x8, one output per work item.
+ * @note Pool size and strides must be passed using -DPOOL_SIZE, -DPOOL_STRIDE_X and -DPOOL_STRIDE_Y e.g. -DPOOL_SIZE=3 -DPOOL_STRIDE_X=2 -DPOOL_STRIDE_Y=2
+ * @note Datatype must be passed using -DDATA_TYPE e.g. -DDATA_TYPE=float. Supported data types are F16, F32;
+ * @note In case of average pooling -DPOOL_AVG must be provided otherwise max pooling will be performed.
+ *
+ * @param[in]  input_ptr                            Pointer to the source image. Supported data types: F16, F32
+ * @param[in]  input_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  input_step_x                         input_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  input_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  input_step_y                         input_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  input_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] output_ptr                           Pointer to the destination image. Supported data types: F16, F32
+ * @param[in]  output_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  output_step_x                        output_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  output_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  output_step_y                        output_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  output_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  max_dims                             The maximum index that can be accessed in x and y dimension (width + pad)
+ * @param[in]  strides                              The pooling operation strides in each dimension
+ * @param[in]  paddings                             The pooling operation paddings in each dimension
+ */
+__kernel void pooling_layer_tiled(
+    IMAGE_DECLARATION(input),
+    IMAGE_DECLARATION(output)
+#ifdef POOL_AVG
+    ,
+    int2 max_dims, int2 strides, int2 paddings
+#endif
+)
+{
+    __local DATA_TYPE tile[TILE_H][TILE_W];
+
+    Image output = CONVERT_TO_IMAGE_STRUCT(output);
+
+    const int lx = get_local_id(0);
+    const int ly = get_local_id(1);
+
+    // Top left corner of the input tile of the work-group: input_step_x/y already include the pooling strides
+    __global uchar *tile_ptr = input_ptr + input_offset_first_element_in_bytes + get_group_id(0) * TILE_OUT * input_step_x + get_group_id(1) * TILE_OUT * input_step_y;
+
+    // Cooperatively load the tile and its halo
+    for(int y = ly; y < TILE_H; y += TILE_OUT)
+    {
+        for(int x = lx; x < TILE_W; x += TILE_OUT)
+        {
+            tile[y][x] = *((__global DATA_TYPE *)(tile_ptr + x * input_stride_x + y * input_stride_y));
+        }
+    }
+
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Pool the window of the work item from local memory
+    const int x0  = lx * POOL_STRIDE_X;
+    const int y0  = ly * POOL_STRIDE_Y;
+    DATA_TYPE res = tile[y0][x0];
+    for(int y = 0; y < POOL_SIZE; ++y)
+    {
+        for(int x = (y == 0) ? 1 : 0; x < POOL_SIZE; ++x)
+        {
+            res = POOL_OP(res, tile[y0 + y][x0 + x]);
+        }
+    }
+
+#ifdef POOL_AVG
+    res *= calculate_avg_scale(POOL_SIZE, max_dims.x, max_dims.y, paddings.x, paddings.y, strides.x, strides.y);
+#endif
+
+    // Store result
+    *(__global DATA_TYPE *)output.ptr = res;
+}
+#endif /* defined(POOL_SIZE) && defined(POOL_STRIDE_X) && defined(POOL_STRIDE_Y) */
@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+#include "types.h"
+
+#if defined(DATA_TYPE) && defined(POOLED_WIDTH) && defined(POOLED_HEIGHT) && defined(SPATIAL_SCALE) && defined(WIDTH) && defined(HEIGHT) && defined(NUM_CHANNELS)
+
+/** Max pools the regions of interest of a batch of feature maps: each work-item computes one bin of one region for one channel.
+ *
+ * @note The data type must be passed at compile time using -DDATA_TYPE: e.g. -DDATA_TYPE=float
+ * @note The size of the output of each region must be passed at compile time using -DPOOLED_WIDTH and -DPOOLED_HEIGHT: e.g. -DPOOLED_WIDTH=6 -DPOOLED_HEIGHT=6
+ * @note The scale of the regions must be passed at compile time using -DSPATIAL_SCALE: e.g. -DSPATIAL_SCALE=0.0625f
+ * @note The width, height and number of channels of the feature maps must be passed at compile time using -DWIDTH, -DHEIGHT and -DNUM_CHANNELS: e.g. -DWIDTH=13 -DHEIGHT=13 -DNUM_CHANNELS=256
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F16, F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  rois                              Array of regions of interest
+ * @param[in]  src_stride_w                      Stride of the source tensor in W dimension (in bytes)
+ * @param[in]  dst_stride_w                      Stride of the destination tensor in W dimension (in bytes)
+ * @param[in]  num_rois                          Number of regions of interest to pool
+ */
+__kernel void roi_pooling_layer(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    __global const ROI *rois,
+    uint                src_stride_w,
+    uint                dst_stride_w,
+    uint                num_rois)
+{
+    const int px      = get_global_id(0);
+    const int py      = get_global_id(1);
+    const int channel = get_global_id(2) % NUM_CHANNELS;
+    const int roi_idx = get_global_id(2) / NUM_CHANNELS;
+
+    if(roi_idx >= num_rois)
+    {
+        return;
+    }
+
+    const ROI roi = rois[roi_idx];
+
+    // Region in the feature maps, at least one element wide and high
+    const int   roi_x      = (int)round(roi.x * SPATIAL_SCALE);
+    const int   roi_y      = (int)round(roi.y * SPATIAL_SCALE);
+    const int   roi_width  = max((int)round((roi.x + roi.width) * SPATIAL_SCALE) - roi_x, 1);
+    const int   roi_height = max((int)round((roi.y + roi.height) * SPATIAL_SCALE) - roi_y, 1);
+    const float bin_width  = (float)roi_width / POOLED_WIDTH;
+    const float bin_height = (float)roi_height / POOLED_HEIGHT;
+
+    const int x_start = clamp(roi_x + (int)floor(px * bin_width), 0, WIDTH);
+    const int x_end   = clamp(roi_x + (int)ceil((px + 1) * bin_width), 0, WIDTH);
+    const int y_start = clamp(roi_y + (int)floor(py * bin_height), 0, HEIGHT);
+    const int y_end   = clamp(roi_y + (int)ceil((py + 1) * bin_height), 0, HEIGHT);
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + roi.batch_idx * src_stride_w + channel * src_stride_z;
+
+    // The bins out of the feature maps are 0
+    DATA_TYPE res = (x_end > x_start && y_end > y_start) ? -MAXFLOAT : 0;
+
+    for(int y = y_start; y < y_end; ++y)
+    {
+        __global const DATA_TYPE *row = (__global const DATA_TYPE *)(src_addr + y * src_stride_y);
+
+        for(int x = x_start; x < x_end; ++x)
+        {
+            res = fmax(res, row[x]);
+        }
+    }
+
+    *(__global DATA_TYPE *)(dst_ptr + dst_offset_first_element_in_bytes + px * dst_stride_x + py * dst_stride_y + channel * dst_stride_z + roi_idx * dst_stride_w) = res;
+}
+#endif // defined(DATA_TYPE) && defined(POOLED_WIDTH) && defined(POOLED_HEIGHT) && defined(SPATIAL_SCALE) && defined(WIDTH) && defined(HEIGHT) && defined(NUM_CHANNELS)
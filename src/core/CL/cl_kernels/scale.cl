@@ -121,3 +121,231 @@ __kernel void scale_bilinear(
     const float8 tc  = clamp_to_border(transform_bilinear(get_current_coords(), r), input_width, input_height);
     vstore4(bilinear_interpolate(&in, tc, input_width, input_height), 0, (__global DATA_TYPE *)out.ptr);
 }
+
+#if defined(NUM_CHANNELS)
+/** Pixel of an image with NUM_CHANNELS interleaved U8 channels, e.g. uchar3 for RGB888 */
+#define PIXEL_TYPE VEC_DATA_TYPE(uchar, NUM_CHANNELS)
+/** Pixel of an image with NUM_CHANNELS interleaved channels, converted to floats */
+#define PIXEL_TYPE_FLOAT VEC_DATA_TYPE(float, NUM_CHANNELS)
+
+#define LOAD_PIXEL_STR(n, ptr) vload##n(0, (__global const uchar *)(ptr))
+#define LOAD_PIXEL(n, ptr) LOAD_PIXEL_STR(n, ptr)
+#define STORE_PIXEL_STR(n, value, ptr) vstore##n(value, 0, (__global uchar *)(ptr))
+#define STORE_PIXEL(n, value, ptr) STORE_PIXEL_STR(n, value, ptr)
+
+/** Computes the bilinear interpolation of all the channels of the pixel at the given coordinates
+ *
+ * @param[in] in     Pointer to the source image.
+ * @param[in] coord  2D coordinates of the pixel.
+ * @param[in] width  Width of the image
+ * @param[in] height Height of the image
+ */
+inline PIXEL_TYPE bilinear_interpolate_interleaved(const Image *in, const float2 coord, const float width, const float height)
+{
+    // If any of the 4 texels is out of the image's boundaries we use the border value (REPLICATE or CONSTANT) for any texel out of the image.
+    const float2 fc = floor(coord);
+    const float8 c  = clamp_to_border(get_neighbour_coords(fc), width, height);
+
+    const PIXEL_TYPE_FLOAT tl = CONVERT(LOAD_PIXEL(NUM_CHANNELS, offset(in, c.s0, c.s1)), PIXEL_TYPE_FLOAT);
+    const PIXEL_TYPE_FLOAT tr = CONVERT(LOAD_PIXEL(NUM_CHANNELS, offset(in, c.s2, c.s3)), PIXEL_TYPE_FLOAT);
+    const PIXEL_TYPE_FLOAT bl = CONVERT(LOAD_PIXEL(NUM_CHANNELS, offset(in, c.s4, c.s5)), PIXEL_TYPE_FLOAT);
+    const PIXEL_TYPE_FLOAT br = CONVERT(LOAD_PIXEL(NUM_CHANNELS, offset(in, c.s6, c.s7)), PIXEL_TYPE_FLOAT);
+
+    const float2 a = coord - fc;
+    const float2 b = ((float2)(1.f)) - a;
+
+    return CONVERT((tl * b.s0 * b.s1) + (tr * a.s0 * b.s1) + (bl * b.s0 * a.s1) + (br * a.s0 * a.s1), PIXEL_TYPE);
+}
+
+/** Performs an affine transformation on an image with interleaved U8 channels interpolating with the NEAREAST NEIGHBOUR method. All the channels of a pixel are copied at once.
+ *
+ * @note The number of channels must be passed at compile time using -DNUM_CHANNELS e.g. -DNUM_CHANNELS=3 for RGB888
+ *
+ * @param[in]  in_ptr                            Pointer to the source image. Supported formats: RGB888, RGBA8888.
+ * @param[in]  in_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  in_step_x                         src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  in_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  in_step_y                         src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  in_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] out_ptr                           Pointer to the destination image. Supported formats: same as @p in_ptr
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  out_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  input_width                       Input image width
+ * @param[in]  input_height                      Input image height
+ * @param[in]  output_width                      Output image width
+ * @param[in]  output_height                     Output image height
+ */
+__kernel void scale_nearest_neighbour_interleaved(
+    IMAGE_DECLARATION(in),
+    IMAGE_DECLARATION(out),
+    const float input_width,
+    const float input_height,
+    const float output_width,
+    const float output_height)
+{
+    Image        in  = CONVERT_TO_IMAGE_STRUCT_NO_STEP(in);
+    Image        out = CONVERT_TO_IMAGE_STRUCT(out);
+    const float2 r   = (float2)(input_width / output_width, input_height / output_height);
+    const int8   tc  = convert_int8(clamp_to_border(transform_nearest(get_current_coords(), r), input_width, input_height));
+
+    STORE_PIXEL(NUM_CHANNELS, LOAD_PIXEL(NUM_CHANNELS, offset(&in, tc.s0, tc.s1)), out.ptr);
+    STORE_PIXEL(NUM_CHANNELS, LOAD_PIXEL(NUM_CHANNELS, offset(&in, tc.s2, tc.s3)), out.ptr + NUM_CHANNELS);
+    STORE_PIXEL(NUM_CHANNELS, LOAD_PIXEL(NUM_CHANNELS, offset(&in, tc.s4, tc.s5)), out.ptr + 2 * NUM_CHANNELS);
+    STORE_PIXEL(NUM_CHANNELS, LOAD_PIXEL(NUM_CHANNELS, offset(&in, tc.s6, tc.s7)), out.ptr + 3 * NUM_CHANNELS);
+}
+
+/** Performs an affine transformation on an image with interleaved U8 channels interpolating with the BILINEAR method. All the channels of a pixel are interpolated at once.
+ *
+ * @note The number of channels must be passed at compile time using -DNUM_CHANNELS e.g. -DNUM_CHANNELS=3 for RGB888
+ *
+ * @param[in]  in_ptr                            Pointer to the source image. Supported formats: RGB888, RGBA8888.
+ * @param[in]  in_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  in_step_x                         src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  in_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  in_step_y                         src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  in_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] out_ptr                           Pointer to the destination image. Supported formats: same as @p in_ptr
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  out_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  input_width                       Input image width
+ * @param[in]  input_height                      Input image height
+ * @param[in]  output_width                      Output image width
+ * @param[in]  output_height                     Output image height
+ */
+__kernel void scale_bilinear_interleaved(
+    IMAGE_DECLARATION(in),
+    IMAGE_DECLARATION(out),
+    const float input_width,
+    const float input_height,
+    const float output_width,
+    const float output_height)
+{
+    Image        in  = CONVERT_TO_IMAGE_STRUCT_NO_STEP(in);
+    Image        out = CONVERT_TO_IMAGE_STRUCT(out);
+    const float2 r   = (float2)(input_width / output_width, input_height / output_height);
+    const float8 tc  = clamp_to_border(transform_bilinear(get_current_coords(), r), input_width, input_height);
+
+    STORE_PIXEL(NUM_CHANNELS, bilinear_interpolate_interleaved(&in, tc.s01, input_width, input_height), out.ptr);
+    STORE_PIXEL(NUM_CHANNELS, bilinear_interpolate_interleaved(&in, tc.s23, input_width, input_height), out.ptr + NUM_CHANNELS);
+    STORE_PIXEL(NUM_CHANNELS, bilinear_interpolate_interleaved(&in, tc.s45, input_width, input_height), out.ptr + 2 * NUM_CHANNELS);
+    STORE_PIXEL(NUM_CHANNELS, bilinear_interpolate_interleaved(&in, tc.s67, input_width, input_height), out.ptr + 3 * NUM_CHANNELS);
+}
+#endif /* defined(NUM_CHANNELS) */
+
+#if defined(IMAGE_BORDER)
+/** Performs an affine transformation on an image interpolating with the BILINEAR method, the interpolation being done by the texture sampler. Input and output are single channel U8.
+ *
+ * @note The border width of the image must be passed at compile time using -DIMAGE_BORDER e.g. -DIMAGE_BORDER=1
+ *
+ * @param[in]  in                                Image holding the source image and its border. Supported image formats: CL_R / CL_UNORM_INT8.
+ * @param[out] out_ptr                           Pointer to the destination image. Supported data types: U8.
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  out_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  input_width                       Input image width
+ * @param[in]  input_height                      Input image height
+ * @param[in]  output_width                      Output image width
+ * @param[in]  output_height                     Output image height
+ */
+__kernel void scale_bilinear_image(
+    __read_only image2d_t in,
+    IMAGE_DECLARATION(out),
+    const float input_width,
+    const float input_height,
+    const float output_width,
+    const float output_height)
+{
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_LINEAR;
+
+    Image        out = CONVERT_TO_IMAGE_STRUCT(out);
+    const float2 r   = (float2)(input_width / output_width, input_height / output_height);
+    const float8 tc  = clamp_to_border(transform_bilinear(get_current_coords(), r), input_width, input_height);
+    vstore4(bilinear_interpolate_image(in, sampler, tc), 0, out.ptr);
+}
+#endif /* defined(IMAGE_BORDER) */
+
+/** Downscales an image averaging the input pixels covered by each output pixel. Input and output are single channel U8.
+ *
+ * @note If the scale ratios are integers, they can be passed at compile time with -DRATIO_X and -DRATIO_Y (e.g. -DRATIO_X=2 -DRATIO_Y=2)
+ *       so that the pixels are summed in integers. Otherwise every input pixel is weighted by how much of it is covered.
+ *
+ * @param[in]  in_ptr                            Pointer to the source image. Supported data types: U8.
+ * @param[in]  in_stride_x                       Stride of the source image in X dimension (in bytes)
+ * @param[in]  in_step_x                         src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  in_stride_y                       Stride of the source image in Y dimension (in bytes)
+ * @param[in]  in_step_y                         src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  in_offset_first_element_in_bytes  The offset of the first element in the source image
+ * @param[out] out_ptr                           Pointer to the destination image. Supported data types: U8.
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  out_offset_first_element_in_bytes The offset of the first element in the destination image
+ * @param[in]  input_width                       Input image width
+ * @param[in]  input_height                      Input image height
+ * @param[in]  output_width                      Output image width
+ * @param[in]  output_height                     Output image height
+ */
+__kernel void scale_area(
+    IMAGE_DECLARATION(in),
+    IMAGE_DECLARATION(out),
+    const float input_width,
+    const float input_height,
+    const float output_width,
+    const float output_height)
+{
+    Image     in  = CONVERT_TO_IMAGE_STRUCT_NO_STEP(in);
+    Image     out = CONVERT_TO_IMAGE_STRUCT(out);
+    const int x   = get_global_id(0);
+    const int y   = get_global_id(1);
+
+#if defined(RATIO_X) && defined(RATIO_Y)
+    uint sum = 0;
+
+    for(int j = 0; j < RATIO_Y; ++j)
+    {
+        __global const uchar *row = offset(&in, x * RATIO_X, y * RATIO_Y + j);
+
+        for(int i = 0; i < RATIO_X; ++i)
+        {
+            sum += row[i];
+        }
+    }
+
+    *out.ptr = (uchar)((sum + (RATIO_X * RATIO_Y) / 2) / (RATIO_X * RATIO_Y));
+#else  /* defined(RATIO_X) && defined(RATIO_Y) */
+    const float2 r = (float2)(input_width / output_width, input_height / output_height);
+
+    // Footprint of the output pixel in the input
+    const float x0 = x * r.s0;
+    const float x1 = min((x + 1) * r.s0, input_width);
+    const float y0 = y * r.s1;
+    const float y1 = min((y + 1) * r.s1, input_height);
+
+    float sum = 0.f;
+
+    for(int j = (int)floor(y0); j < (int)ceil(y1); ++j)
+    {
+        __global const uchar *row = offset(&in, 0, j);
+
+        float row_sum = 0.f;
+
+        for(int i = (int)floor(x0); i < (int)ceil(x1); ++i)
+        {
+            row_sum += (min(i + 1.f, x1) - max((float)i, x0)) * row[i];
+        }
+
+        sum += (min(j + 1.f, y1) - max((float)j, y0)) * row_sum;
+    }
+
+    *out.ptr = convert_uchar_sat_rte(sum / ((x1 - x0) * (y1 - y0)));
+#endif /* defined(RATIO_X) && defined(RATIO_Y) */
+}
@@ -219,3 +219,89 @@ __kernel void softmax_layer_norm(
     data = vload16(0, (__global DATA_TYPE *)offset(&src, 0, 0));
     vstore16(data / sum_val, 0, (__global DATA_TYPE *)offset(&dst, 0, 0));
 }
+
+#if defined(LWS)
+/** Computes the softmax of each row of the input tensor in a single kernel: one work-group per row.
+ *
+ * The work items of the work-group stride through the row, then the maximum and the sum of the exponentials
+ * of the row are computed with tree reductions in local memory. No intermediate tensor is written.
+ *
+ * @note In case F16 is used -DUSE_F16 must be passed otherwise the kernel will default to used F32.
+ * @note The local workgroup size must be passed using -DLWS e.g. -DLWS=128. It must be a power of two and match the local workgroup size along X of the enqueue.
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor slice. Supported data types: F16, F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor slice. Supported data types: F16, F32
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  width                             Input image width
+ */
+__kernel void softmax_layer_fused(
+    IMAGE_DECLARATION(src),
+    IMAGE_DECLARATION(dst),
+    uint width)
+{
+    __local float partial[LWS];
+
+    const uint lid = get_local_id(0);
+
+    // The work-group addresses its row itself
+    __global uchar *src_row = src_ptr + src_offset_first_element_in_bytes + get_global_id(1) * src_step_y;
+    __global uchar *dst_row = dst_ptr + dst_offset_first_element_in_bytes + get_global_id(1) * dst_step_y;
+
+    // Maximum of the row
+    float max_val = -FLT_MAX;
+    for(uint i = lid; i < width; i += LWS)
+    {
+        max_val = fmax(max_val, (float)(*((__global DATA_TYPE *)(src_row + i * src_stride_x))));
+    }
+    partial[lid] = max_val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for(uint s = LWS >> 1; s > 0; s >>= 1)
+    {
+        if(lid < s)
+        {
+            partial[lid] = fmax(partial[lid], partial[lid + s]);
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    max_val = partial[0];
+
+    // All the work items must have read the maximum before the buffer is reused
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    // Sum of the exponentials of the shifted row
+    float sum_val = 0.f;
+    for(uint i = lid; i < width; i += LWS)
+    {
+        sum_val += exp((float)(*((__global DATA_TYPE *)(src_row + i * src_stride_x))) - max_val);
+    }
+    partial[lid] = sum_val;
+    barrier(CLK_LOCAL_MEM_FENCE);
+
+    for(uint s = LWS >> 1; s > 0; s >>= 1)
+    {
+        if(lid < s)
+        {
+            partial[lid] += partial[lid + s];
+        }
+        barrier(CLK_LOCAL_MEM_FENCE);
+    }
+    const float inv_sum = 1.f / partial[0];
+
+    // Normalize: the exponentials are recomputed rather than stored in an intermediate tensor
+    for(uint i = lid; i < width; i += LWS)
+    {
+        const float value                                     = exp((float)(*((__global DATA_TYPE *)(src_row + i * src_stride_x))) - max_val);
+        *((__global DATA_TYPE *)(dst_row + i * dst_stride_x)) = (DATA_TYPE)(value * inv_sum);
+    }
+}
+#endif /* defined(LWS) */
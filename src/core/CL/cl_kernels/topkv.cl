@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "helpers.h"
+
+/** Finds the K highest values of each row of 1D scores and their indices.
+ *
+ * The values are returned in descending order: ties are ordered by increasing index.
+ * Each work item processes a whole row.
+ *
+ * @note The number of values to find must be given as a preprocessor argument using -DK=number. e.g. -DK=5
+ *
+ * @param[in]  src_ptr                               Pointer to the source tensor slice. Supported data types: F32
+ * @param[in]  src_stride_x                          Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                            src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                          Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                            src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes     The offset of the first element in the source tensor
+ * @param[out] indices_ptr                           Pointer to the indices tensor slice. Supported data types: U32
+ * @param[in]  indices_stride_x                      Stride of the indices tensor in X dimension (in bytes)
+ * @param[in]  indices_step_x                        indices_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  indices_stride_y                      Stride of the indices tensor in Y dimension (in bytes)
+ * @param[in]  indices_step_y                        indices_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  indices_offset_first_element_in_bytes The offset of the first element in the indices tensor
+ * @param[out] scores_ptr                            Pointer to the scores tensor slice. Supported data types: F32
+ * @param[in]  scores_stride_x                       Stride of the scores tensor in X dimension (in bytes)
+ * @param[in]  scores_step_x                         scores_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  scores_stride_y                       Stride of the scores tensor in Y dimension (in bytes)
+ * @param[in]  scores_step_y                         scores_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  scores_offset_first_element_in_bytes  The offset of the first element in the scores tensor
+ * @param[in]  width                                 Input image width
+ */
+__kernel void topkv(
+    IMAGE_DECLARATION(src),
+    IMAGE_DECLARATION(indices),
+    IMAGE_DECLARATION(scores),
+    uint width)
+{
+    Image src     = CONVERT_TO_IMAGE_STRUCT(src);
+    Image indices = CONVERT_TO_IMAGE_STRUCT(indices);
+    Image scores  = CONVERT_TO_IMAGE_STRUCT(scores);
+
+    __global const float *src_ptr = (__global const float *)src.ptr;
+
+    // Highest values found so far, in descending order
+    float best_scores[K];
+    uint  best_indices[K];
+    uint  num_found = 0;
+
+    for(uint x = 0; x < width; ++x)
+    {
+        const float value = src_ptr[x];
+
+        // Most of the values are lower than the last value once the list is full
+        if(num_found == K && value <= best_scores[K - 1])
+        {
+            continue;
+        }
+
+        // The last value falls out of the list if it is full, values from earlier indices stay first in case of a tie
+        uint pos = (num_found < K) ? num_found++ : K - 1;
+        for(; pos > 0 && best_scores[pos - 1] < value; --pos)
+        {
+            best_scores[pos]  = best_scores[pos - 1];
+            best_indices[pos] = best_indices[pos - 1];
+        }
+        best_scores[pos]  = value;
+        best_indices[pos] = x;
+    }
+
+    // Store result
+    for(uint i = 0; i < K; ++i)
+    {
+        ((__global uint *)indices.ptr)[i] = best_indices[i];
+        ((__global float *)scores.ptr)[i] = best_scores[i];
+    }
+}
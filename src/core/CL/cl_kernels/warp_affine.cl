@@ -118,3 +118,35 @@ __kernel void warp_affine_bilinear(
     Image out = CONVERT_TO_IMAGE_STRUCT(out);
     vstore4(bilinear_interpolate(&in, clamp_to_border(apply_affine_transform(get_current_coords(), build_affine_mtx()), width, height), width, height), 0, out.ptr);
 }
+
+#if defined(IMAGE_BORDER)
+/** Performs an affine transform on an image interpolating with the BILINEAR method, the interpolation being done by the texture sampler. Input and output are single channel U8.
+ *
+ * @attention The matrix coefficients need to be passed at compile time:\n
+ * const char build_options [] = "-DMAT0=1 -DMAT1=2 -DMAT2=1 -DMAT3=2 -DMAT4=4 -DMAT5=2 "\n
+ * clBuildProgram( program, 0, NULL, build_options, NULL, NULL);
+ *
+ * @note The border width of the image must be passed at compile time using -DIMAGE_BORDER e.g. -DIMAGE_BORDER=1
+ *
+ * @param[in]  in                                Image holding the source image and its border. Supported image formats: CL_R / CL_UNORM_INT8.
+ * @param[out] out_ptr                           Pointer to the destination image. Supported data types: U8.
+ * @param[in]  out_stride_x                      Stride of the destination image in X dimension (in bytes)
+ * @param[in]  out_step_x                        out_stride_x * number of elements along X processed per work item (in bytes)
+ * @param[in]  out_stride_y                      Stride of the destination image in Y dimension (in bytes)
+ * @param[in]  out_step_y                        out_stride_y * number of elements along Y processed per work item (in bytes)
+ * @param[in]  out_offset_first_element_in_bytes Offset of the first element in the destination image
+ * @param[in]  width                             Width of the destination image
+ * @param[in]  height                            Height of the destination image
+ */
+__kernel void warp_affine_bilinear_image(
+    __read_only image2d_t in,
+    IMAGE_DECLARATION(out),
+    const int width,
+    const int height)
+{
+    const sampler_t sampler = CLK_NORMALIZED_COORDS_FALSE | CLK_ADDRESS_CLAMP_TO_EDGE | CLK_FILTER_LINEAR;
+
+    Image out = CONVERT_TO_IMAGE_STRUCT(out);
+    vstore4(bilinear_interpolate_image(in, sampler, clamp_to_border(apply_affine_transform(get_current_coords(), build_affine_mtx()), width, height)), 0, out.ptr);
+}
+#endif /* defined(IMAGE_BORDER) */
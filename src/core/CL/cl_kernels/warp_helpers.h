@@ -109,3 +109,23 @@ inline const VEC_DATA_TYPE(DATA_TYPE, 4) bilinear_interpolate(const Image *in, c
                           ((t.sc * b.s6 * b.s7) + (t.sd * a.s6 * b.s7) + (t.se * b.s6 * a.s7) + (t.sf * a.s6 * a.s7)));
     return CONVERT(fr, VEC_DATA_TYPE(DATA_TYPE, 4));
 }
+
+#if defined(IMAGE_BORDER)
+/** Computes the bilinear interpolation for each set of coordinates in the vector coords with the texture sampler of the device
+ *
+ * @note The image must hold the U8 source image and its border of IMAGE_BORDER pixels on each side as CL_R / CL_UNORM_INT8 texels.
+ *       The border width must be passed at compile time using -DIMAGE_BORDER e.g. -DIMAGE_BORDER=1
+ *
+ * @param[in] in      Image holding the source image.
+ * @param[in] sampler Sampler on unnormalized coordinates with CLK_FILTER_LINEAR.
+ * @param[in] coords  Vector of four 2D coordinates. Even pos is x and odd y.
+*/
+inline const uchar4 bilinear_interpolate_image(__read_only image2d_t in, const sampler_t sampler, const float8 coords)
+{
+    // The centre of the texel of the pixel (x, y) is at (x + IMAGE_BORDER + 0.5, y + IMAGE_BORDER + 0.5)
+    const float8 tc = coords + (float8)(IMAGE_BORDER + 0.5f);
+    const float4 fr = (float4)(read_imagef(in, sampler, tc.s01).x, read_imagef(in, sampler, tc.s23).x,
+                               read_imagef(in, sampler, tc.s45).x, read_imagef(in, sampler, tc.s67).x);
+    return convert_uchar4_sat_rte(fr * 255.f);
+}
+#endif /* defined(IMAGE_BORDER) */
@@ -0,0 +1,304 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "activation_helpers.h"
+#include "helpers.h"
+
+/** This kernel transforms the 3x3 kernels of a convolution layer into the Winograd F(2x2, 3x3) domain.
+ *
+ * Each 3x3 kernel g is transformed into the 4x4 tile U = G * g * G'. Element k of tile U(ofm, ifm) is stored in matrix k, column ofm, row ifm of the destination tensor.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ *
+ * @param[in]  src_ptr                           Pointer to the weights tensor [3, 3, IFM, OFM]. Supported data types: F32
+ * @param[in]  src_stride_x                      Stride of the weights tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the weights tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the weights tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the weights tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor [OFM, IFM, 16]. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  src_stride_w                      Stride of the weights tensor in the 4th dimension (in bytes)
+ */
+__kernel void winograd_filter_transform_2x2_3x3(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    uint src_stride_w)
+{
+    const int ofm = get_global_id(0);
+    const int ifm = get_global_id(1);
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + ifm * src_stride_z + ofm * src_stride_w;
+    __global uchar       *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + ofm * dst_stride_x + ifm * dst_stride_y;
+
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    g0 = vload3(0, (__global const DATA_TYPE *)(src_addr + 0 * src_stride_y));
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    g1 = vload3(0, (__global const DATA_TYPE *)(src_addr + 1 * src_stride_y));
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    g2 = vload3(0, (__global const DATA_TYPE *)(src_addr + 2 * src_stride_y));
+
+    // T = G * g
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    t0 = g0;
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    t1 = (g0 + g1 + g2) * (DATA_TYPE)0.5f;
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    t2 = (g0 - g1 + g2) * (DATA_TYPE)0.5f;
+    VEC_DATA_TYPE(DATA_TYPE, 3)
+    t3 = g2;
+
+    // U = T * G'
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    u0 = (VEC_DATA_TYPE(DATA_TYPE, 4))(t0.s0, (t0.s0 + t0.s1 + t0.s2) * (DATA_TYPE)0.5f, (t0.s0 - t0.s1 + t0.s2) * (DATA_TYPE)0.5f, t0.s2);
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    u1 = (VEC_DATA_TYPE(DATA_TYPE, 4))(t1.s0, (t1.s0 + t1.s1 + t1.s2) * (DATA_TYPE)0.5f, (t1.s0 - t1.s1 + t1.s2) * (DATA_TYPE)0.5f, t1.s2);
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    u2 = (VEC_DATA_TYPE(DATA_TYPE, 4))(t2.s0, (t2.s0 + t2.s1 + t2.s2) * (DATA_TYPE)0.5f, (t2.s0 - t2.s1 + t2.s2) * (DATA_TYPE)0.5f, t2.s2);
+    VEC_DATA_TYPE(DATA_TYPE, 4)
+    u3 = (VEC_DATA_TYPE(DATA_TYPE, 4))(t3.s0, (t3.s0 + t3.s1 + t3.s2) * (DATA_TYPE)0.5f, (t3.s0 - t3.s1 + t3.s2) * (DATA_TYPE)0.5f, t3.s2);
+
+    *((__global DATA_TYPE *)(dst_addr + 0 * dst_stride_z))  = u0.s0;
+    *((__global DATA_TYPE *)(dst_addr + 1 * dst_stride_z))  = u0.s1;
+    *((__global DATA_TYPE *)(dst_addr + 2 * dst_stride_z))  = u0.s2;
+    *((__global DATA_TYPE *)(dst_addr + 3 * dst_stride_z))  = u0.s3;
+    *((__global DATA_TYPE *)(dst_addr + 4 * dst_stride_z))  = u1.s0;
+    *((__global DATA_TYPE *)(dst_addr + 5 * dst_stride_z))  = u1.s1;
+    *((__global DATA_TYPE *)(dst_addr + 6 * dst_stride_z))  = u1.s2;
+    *((__global DATA_TYPE *)(dst_addr + 7 * dst_stride_z))  = u1.s3;
+    *((__global DATA_TYPE *)(dst_addr + 8 * dst_stride_z))  = u2.s0;
+    *((__global DATA_TYPE *)(dst_addr + 9 * dst_stride_z))  = u2.s1;
+    *((__global DATA_TYPE *)(dst_addr + 10 * dst_stride_z)) = u2.s2;
+    *((__global DATA_TYPE *)(dst_addr + 11 * dst_stride_z)) = u2.s3;
+    *((__global DATA_TYPE *)(dst_addr + 12 * dst_stride_z)) = u3.s0;
+    *((__global DATA_TYPE *)(dst_addr + 13 * dst_stride_z)) = u3.s1;
+    *((__global DATA_TYPE *)(dst_addr + 14 * dst_stride_z)) = u3.s2;
+    *((__global DATA_TYPE *)(dst_addr + 15 * dst_stride_z)) = u3.s3;
+}
+
+/** This kernel transforms the input of a 3x3 convolution layer with a stride of 1 into the Winograd F(2x2, 3x3) domain.
+ *
+ * The input is split into 4x4 tiles overlapping by 2 elements, each of which produces a 2x2 tile of the output. Each tile d is transformed into V = B' * d * B.
+ * Element k of tile V(tile, ifm) is stored in matrix k, column ifm, row tile of the destination tensor, where the tiles are numbered in row-major order across all the batches.
+ * The values outside the input (padding) are zero: no border has to be filled.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ *
+ * @param[in]  src_ptr                           Pointer to the source tensor. Supported data types: F32
+ * @param[in]  src_stride_x                      Stride of the source tensor in X dimension (in bytes)
+ * @param[in]  src_step_x                        src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                      Stride of the source tensor in Y dimension (in bytes)
+ * @param[in]  src_step_y                        src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                      Stride of the source tensor in Z dimension (in bytes)
+ * @param[in]  src_step_z                        src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes The offset of the first element in the source tensor
+ * @param[out] dst_ptr                           Pointer to the destination tensor [IFM, number of tiles, 16]. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                      Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                        dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                      Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                        dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                      Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                        dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes The offset of the first element in the destination tensor
+ * @param[in]  input_dims                        The width and height of the source tensor
+ * @param[in]  paddings                          The paddings of the convolution
+ * @param[in]  num_tiles_x                       The number of tiles along X
+ * @param[in]  first_tile                        The index of the first tile of the batch processed by the kernel
+ */
+__kernel void winograd_input_transform_2x2_3x3(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+    int2 input_dims,
+    int2 paddings,
+    int  num_tiles_x,
+    int  first_tile)
+{
+    const int tile_x = get_global_id(0);
+    const int tile_y = get_global_id(1);
+    const int ifm    = get_global_id(2);
+    const int x0     = tile_x * 2 - paddings.x;
+    const int y0     = tile_y * 2 - paddings.y;
+
+    __global const uchar *plane = src_ptr + src_offset_first_element_in_bytes + ifm * src_stride_z;
+
+    // Load the tile, the values outside the input are zero
+    DATA_TYPE d[4][4];
+    if(x0 >= 0 && y0 >= 0 && x0 + 4 <= input_dims.x && y0 + 4 <= input_dims.y)
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            VEC_DATA_TYPE(DATA_TYPE, 4)
+            row = vload4(0, (__global const DATA_TYPE *)(plane + (y0 + i) * src_stride_y + x0 * src_stride_x));
+            d[i][0] = row.s0;
+            d[i][1] = row.s1;
+            d[i][2] = row.s2;
+            d[i][3] = row.s3;
+        }
+    }
+    else
+    {
+        for(int i = 0; i < 4; ++i)
+        {
+            const int  y       = y0 + i;
+            const bool is_y_in = y >= 0 && y < input_dims.y;
+            for(int j = 0; j < 4; ++j)
+            {
+                const int x = x0 + j;
+                d[i][j]     = (is_y_in && x >= 0 && x < input_dims.x) ? *((__global const DATA_TYPE *)(plane + y * src_stride_y + x * src_stride_x)) : (DATA_TYPE)0;
+            }
+        }
+    }
+
+    // T = B' * d
+    DATA_TYPE t[4][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        t[0][j] = d[0][j] - d[2][j];
+        t[1][j] = d[1][j] + d[2][j];
+        t[2][j] = d[2][j] - d[1][j];
+        t[3][j] = d[1][j] - d[3][j];
+    }
+
+    // V = T * B
+    const int tile = first_tile + tile_y * num_tiles_x + tile_x;
+
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + ifm * dst_stride_x + tile * dst_stride_y;
+    for(int i = 0; i < 4; ++i)
+    {
+        *((__global DATA_TYPE *)(dst_addr + (i * 4 + 0) * dst_stride_z)) = t[i][0] - t[i][2];
+        *((__global DATA_TYPE *)(dst_addr + (i * 4 + 1) * dst_stride_z)) = t[i][1] + t[i][2];
+        *((__global DATA_TYPE *)(dst_addr + (i * 4 + 2) * dst_stride_z)) = t[i][2] - t[i][1];
+        *((__global DATA_TYPE *)(dst_addr + (i * 4 + 3) * dst_stride_z)) = t[i][1] - t[i][3];
+    }
+}
+
+/** This kernel transforms the element-wise products of a Winograd F(2x2, 3x3) convolution back into the output of the convolution layer.
+ *
+ * Each 4x4 tile M of products is transformed into the 2x2 output tile Y = A' * M * A. The tiles crossing the right or bottom edge of the output are clipped.
+ *
+ * @note Datatype should be given as a preprocessor argument using -DDATA_TYPE=type. e.g. -DDATA_TYPE=float
+ * @note If biases are used, -DHAS_BIAS must be passed at compile time.
+ * @note An activation function can be applied to the output values by passing -DFUSED_ACTIVATION=name (e.g. -DFUSED_ACTIVATION=RELU) and its parameters with -DACT_A and -DACT_B
+ *
+ * @param[in]  src_ptr                              Pointer to the products [OFM, number of tiles, 16]. Supported data types: F32
+ * @param[in]  src_stride_x                         Stride of the products in X dimension (in bytes)
+ * @param[in]  src_step_x                           src_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  src_stride_y                         Stride of the products in Y dimension (in bytes)
+ * @param[in]  src_step_y                           src_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  src_stride_z                         Stride of the products in Z dimension (in bytes)
+ * @param[in]  src_step_z                           src_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  src_offset_first_element_in_bytes    The offset of the first element in the products
+ * @param[out] dst_ptr                              Pointer to the destination tensor. Supported data types: same as @p src_ptr
+ * @param[in]  dst_stride_x                         Stride of the destination tensor in X dimension (in bytes)
+ * @param[in]  dst_step_x                           dst_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  dst_stride_y                         Stride of the destination tensor in Y dimension (in bytes)
+ * @param[in]  dst_step_y                           dst_stride_y * number of elements along Y processed per workitem(in bytes)
+ * @param[in]  dst_stride_z                         Stride of the destination tensor in Z dimension (in bytes)
+ * @param[in]  dst_step_z                           dst_stride_z * number of elements along Z processed per workitem(in bytes)
+ * @param[in]  dst_offset_first_element_in_bytes    The offset of the first element in the destination tensor
+ * @param[in]  biases_ptr                           (Optional) Pointer to the biases vector. Supported data types: same as @p src_ptr
+ * @param[in]  biases_stride_x                      (Optional) Stride of the biases vector in X dimension (in bytes)
+ * @param[in]  biases_step_x                        (Optional) biases_stride_x * number of elements along X processed per workitem(in bytes)
+ * @param[in]  biases_offset_first_element_in_bytes (Optional) The offset of the first element in the biases vector
+ * @param[in]  output_dims                          The width and height of the destination tensor
+ * @param[in]  num_tiles_x                          The number of tiles along X
+ * @param[in]  first_tile                           The index of the first tile of the batch processed by the kernel
+ */
+__kernel void winograd_output_transform_2x2_3x3(
+    TENSOR3D_DECLARATION(src),
+    TENSOR3D_DECLARATION(dst),
+#if defined(HAS_BIAS)
+    VECTOR_DECLARATION(biases),
+#endif /* defined(HAS_BIAS) */
+    int2 output_dims,
+    int  num_tiles_x,
+    int  first_tile)
+{
+    const int tile_x = get_global_id(0);
+    const int tile_y = get_global_id(1);
+    const int ofm    = get_global_id(2);
+    const int tile   = first_tile + tile_y * num_tiles_x + tile_x;
+
+    __global const uchar *src_addr = src_ptr + src_offset_first_element_in_bytes + ofm * src_stride_x + tile * src_stride_y;
+
+    // T = A' * M
+    DATA_TYPE t[2][4];
+    for(int j = 0; j < 4; ++j)
+    {
+        const DATA_TYPE m0 = *((__global const DATA_TYPE *)(src_addr + (0 * 4 + j) * src_stride_z));
+        const DATA_TYPE m1 = *((__global const DATA_TYPE *)(src_addr + (1 * 4 + j) * src_stride_z));
+        const DATA_TYPE m2 = *((__global const DATA_TYPE *)(src_addr + (2 * 4 + j) * src_stride_z));
+        const DATA_TYPE m3 = *((__global const DATA_TYPE *)(src_addr + (3 * 4 + j) * src_stride_z));
+
+        t[0][j] = m0 + m1 + m2;
+        t[1][j] = m1 - m2 - m3;
+    }
+
+    // Y = T * A
+    VEC_DATA_TYPE(DATA_TYPE, 2)
+    y0 = (VEC_DATA_TYPE(DATA_TYPE, 2))(t[0][0] + t[0][1] + t[0][2], t[0][1] - t[0][2] - t[0][3]);
+    VEC_DATA_TYPE(DATA_TYPE, 2)
+    y1 = (VEC_DATA_TYPE(DATA_TYPE, 2))(t[1][0] + t[1][1] + t[1][2], t[1][1] - t[1][2] - t[1][3]);
+
+#if defined(HAS_BIAS)
+    Vector biases = CONVERT_TO_VECTOR_STRUCT_NO_STEP(biases);
+
+    const DATA_TYPE bias = *((__global DATA_TYPE *)(biases.ptr + ofm * biases_stride_x));
+
+    y0 += (VEC_DATA_TYPE(DATA_TYPE, 2))bias;
+    y1 += (VEC_DATA_TYPE(DATA_TYPE, 2))bias;
+#endif /* defined(HAS_BIAS) */
+
+#if defined(FUSED_ACTIVATION)
+    y0 = ACTIVATION_OP(FUSED_ACTIVATION, DATA_TYPE, y0);
+    y1 = ACTIVATION_OP(FUSED_ACTIVATION, DATA_TYPE, y1);
+#endif /* defined(FUSED_ACTIVATION) */
+
+    // Store the outputs of the tile which are in the destination tensor
+    const int x = tile_x * 2;
+    const int y = tile_y * 2;
+
+    __global uchar *dst_addr = dst_ptr + dst_offset_first_element_in_bytes + x * dst_stride_x + y * dst_stride_y + ofm * dst_stride_z;
+
+    *((__global DATA_TYPE *)dst_addr) = y0.s0;
+    if(x + 1 < output_dims.x)
+    {
+        *((__global DATA_TYPE *)(dst_addr + dst_stride_x)) = y0.s1;
+    }
+    if(y + 1 < output_dims.y)
+    {
+        *((__global DATA_TYPE *)(dst_addr + dst_stride_y)) = y1.s0;
+        if(x + 1 < output_dims.x)
+        {
+            *((__global DATA_TYPE *)(dst_addr + dst_stride_x + dst_stride_y)) = y1.s1;
+        }
+    }
+}
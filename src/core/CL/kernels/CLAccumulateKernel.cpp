@@ -46,6 +46,11 @@ void CLAccumulateKernel::configure(const ICLTensor *input, ICLTensor *accum)
     ICLSimple2DKernel::configure(input, accum, num_elems_processed_per_iteration);
 }
 
+bool CLAccumulateKernel::is_idempotent() const
+{
+    return false;
+}
+
 void CLAccumulateWeightedKernel::configure(const ICLTensor *input, float alpha, ICLTensor *accum)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
@@ -64,6 +69,11 @@ void CLAccumulateWeightedKernel::configure(const ICLTensor *input, float alpha,
     ICLSimple2DKernel::configure(input, accum, num_elems_processed_per_iteration);
 }
 
+bool CLAccumulateWeightedKernel::is_idempotent() const
+{
+    return false;
+}
+
 void CLAccumulateSquaredKernel::configure(const ICLTensor *input, uint32_t shift, ICLTensor *accum)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
@@ -81,3 +91,8 @@ void CLAccumulateSquaredKernel::configure(const ICLTensor *input, uint32_t shift
     constexpr unsigned int num_elems_processed_per_iteration = 16;
     ICLSimple2DKernel::configure(input, accum, num_elems_processed_per_iteration);
 }
+
+bool CLAccumulateSquaredKernel::is_idempotent() const
+{
+    return false;
+}
@@ -56,3 +56,8 @@ void CLActivationLayerKernel::configure(const ICLTensor *input, ICLTensor *outpu
     constexpr unsigned int num_elems_processed_per_iteration = 16;
     ICLSimple2DKernel::configure(input, output, num_elems_processed_per_iteration);
 }
+
+bool CLActivationLayerKernel::is_idempotent() const
+{
+    return _input != _output;
+}
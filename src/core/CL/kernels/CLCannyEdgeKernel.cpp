@@ -253,3 +253,8 @@ void CLEdgeTraceKernel::run(const Window &window, cl::CommandQueue &queue)
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+bool CLEdgeTraceKernel::is_idempotent() const
+{
+    return false;
+}
@@ -235,7 +235,7 @@ void CLChannelCombineKernel::run(const Window &window, cl::CommandQueue &queue)
                 add_2D_tensor_argument(idx, _output_multi->cl_plane(2), win_sub_plane2);
             }
 
-            _kernel.setArg(idx++, slice.y().end());
+            add_argument(idx, slice.y().end());
         }
 
         enqueue(queue, *this, slice);
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLConvolutionLayerImplicitGEMMKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <set>
+#include <string>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Side of the tiles of the kernel, equal to the local workgroup size along X and Y (IGEMM_TILE in convolution_layer.cl) */
+constexpr unsigned int tile_size = 8;
+/** Number of output feature maps computed by each work-item */
+constexpr unsigned int num_ofm_per_item = 4;
+} // namespace
+
+CLConvolutionLayerImplicitGEMMKernel::CLConvolutionLayerImplicitGEMMKernel()
+    : _input(nullptr), _weights(nullptr), _output(nullptr)
+{
+}
+
+void CLConvolutionLayerImplicitGEMMKernel::configure(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output, unsigned int kernel_width, unsigned int kernel_height,
+                                                     const PadStrideInfo &conv_info, bool has_bias, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(1) != kernel_width * kernel_height * input->info()->dimension(2) + (has_bias ? 1 : 0));
+
+    _input   = input;
+    _weights = weights;
+    _output  = output;
+
+    int pad_x    = 0;
+    int pad_y    = 0;
+    int stride_x = 0;
+    int stride_y = 0;
+    std::tie(pad_x, pad_y)       = conv_info.pad();
+    std::tie(stride_x, stride_y) = conv_info.stride();
+
+    // Create kernel
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type()));
+    build_opts.emplace("-DKERNEL_WIDTH=" + val_to_string(kernel_width));
+    build_opts.emplace("-DKERNEL_HEIGHT=" + val_to_string(kernel_height));
+    build_opts.emplace((has_bias ? "-DHAS_BIAS" : ""));
+    if(act_info.enabled())
+    {
+        build_opts.emplace("-DFUSED_ACTIVATION=" + string_from_activation_func(act_info.activation()));
+        build_opts.emplace("-DACT_A=" + val_to_string(act_info.a()));
+        build_opts.emplace("-DACT_B=" + val_to_string(act_info.b()));
+    }
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("convolution_implicit_gemm", build_opts));
+
+    const cl_int2 input_dims =
+    {
+        {
+            static_cast<cl_int>(input->info()->dimension(0)),
+            static_cast<cl_int>(input->info()->dimension(1)),
+        }
+    };
+    const cl_int2 strides =
+    {
+        {
+            stride_x,
+            stride_y,
+        }
+    };
+    const cl_int2 paddings =
+    {
+        {
+            pad_x,
+            pad_y,
+        }
+    };
+
+    // Set static kernel arguments
+    unsigned int idx = 2 * num_arguments_per_3D_tensor() + num_arguments_per_2D_tensor();
+    _kernel.setArg<cl_int2>(idx++, input_dims);
+    _kernel.setArg<cl_int2>(idx++, strides);
+    _kernel.setArg<cl_int2>(idx++, paddings);
+    _kernel.setArg<cl_int>(idx++, input->info()->dimension(2) /* depth */);
+    _kernel.setArg<cl_int>(idx++, output->info()->dimension(0) /* output width */);
+    _kernel.setArg<cl_int>(idx++, output->info()->dimension(0) * output->info()->dimension(1));
+    _kernel.setArg<cl_int>(idx++, weights->info()->dimension(1));
+    _kernel.setArg<cl_int>(idx++, weights->info()->dimension(0));
+
+    // Configure window: the batches are sliced, the work-items are laid out by run()
+    Window win = calculate_max_window(*output->info(), Steps());
+
+    // The CLConvolutionLayerImplicitGEMMKernel doesn't need padding so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+    ICLKernel::configure(win);
+}
+
+void CLConvolutionLayerImplicitGEMMKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(ICLKernel::window(), window);
+
+    const unsigned int num_pixels = _output->info()->dimension(0) * _output->info()->dimension(1);
+    const unsigned int num_ofm    = _output->info()->dimension(2);
+
+    // Get initial windows
+    Window slice        = window.first_slice_window_3D();
+    Window slice_tensor = window.first_slice_window_3D();
+
+    // One work-item per output pixel along X and per group of output feature maps along Y, rounded up to whole work-groups
+    slice.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(num_pixels, tile_size), 1));
+    slice.set(Window::DimY, Window::Dimension(0, ceil_to_multiple((num_ofm + num_ofm_per_item - 1) / num_ofm_per_item, tile_size), 1));
+    slice.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+    // The elements of the first three dimensions of the tensors are addressed by the kernel
+    slice_tensor.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_tensor.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_tensor.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    Window slice_weights;
+    slice_weights.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_weights.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    do
+    {
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input, slice_tensor);
+        add_2D_tensor_argument(idx, _weights, slice_weights);
+        add_3D_tensor_argument(idx, _output, slice_tensor);
+
+        // The work-groups share their blocks in local memory: the local workgroup size is fixed
+        enqueue(queue, *this, slice, cl::NDRange(tile_size, tile_size, 1));
+    }
+    while(window.slide_window_slice_3D(slice) && window.slide_window_slice_3D(slice_tensor));
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <vector>
+
+using namespace arm_compute;
+
+bool CLCopyToImageKernel::is_supported(const TensorInfo &info, const BorderSize &border)
+{
+    if(info.data_type() != DataType::U8 || info.num_channels() != 1 || info.tensor_shape().num_dimensions() > 2)
+    {
+        return false;
+    }
+
+    const cl::Context &context = CLKernelLibrary::get().context();
+    const cl::Device   device  = context.getInfo<CL_CONTEXT_DEVICES>()[0];
+
+    if(device.getInfo<CL_DEVICE_IMAGE_SUPPORT>() != CL_TRUE || (info.dimension(0) + border.left + border.right) > device.getInfo<CL_DEVICE_IMAGE2D_MAX_WIDTH>()
+       || (info.dimension(1) + border.top + border.bottom) > device.getInfo<CL_DEVICE_IMAGE2D_MAX_HEIGHT>())
+    {
+        return false;
+    }
+
+    std::vector<cl::ImageFormat> formats;
+    context.getSupportedImageFormats(CL_MEM_READ_WRITE, CL_MEM_OBJECT_IMAGE2D, &formats);
+
+    return std::any_of(formats.begin(), formats.end(), [](const cl::ImageFormat & format)
+    {
+        return format.image_channel_order == CL_R && format.image_channel_data_type == CL_UNORM_INT8;
+    });
+}
+
+CLCopyToImageKernel::CLCopyToImageKernel()
+    : _input(nullptr), _image()
+{
+}
+
+void CLCopyToImageKernel::configure(const ICLTensor *input, const BorderSize &border)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(!is_supported(*input->info(), border));
+
+    _input = input;
+
+    const int width  = input->info()->dimension(0) + border.left + border.right;
+    const int height = input->info()->dimension(1) + border.top + border.bottom;
+
+    _image = cl::Image2D(CLKernelLibrary::get().context(), CL_MEM_READ_WRITE, cl::ImageFormat(CL_R, CL_UNORM_INT8), width, height);
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("copy_to_image2d"));
+
+    // Set static kernel arguments
+    unsigned int idx = num_arguments_per_2D_tensor(); //Skip the input parameters
+    _kernel.setArg(idx++, _image);
+
+    // Configure kernel window: one work item per texel, starting from the top left corner of the border
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(-static_cast<int>(border.left), input->info()->dimension(0) + border.right, 1));
+    win.set(Window::DimY, Window::Dimension(-static_cast<int>(border.top), input->info()->dimension(1) + border.bottom, 1));
+
+    AccessWindowStatic input_access(input->info(), -border.left, -border.top, input->info()->dimension(0) + border.right, input->info()->dimension(1) + border.bottom);
+
+    update_window_and_padding(win, input_access);
+
+    ICLKernel::configure(win);
+}
+
+const cl::Image2D &CLCopyToImageKernel::image() const
+{
+    return _image;
+}
+
+void CLCopyToImageKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    unsigned int idx = 0;
+    add_2D_tensor_argument(idx, _input, window);
+    enqueue(queue, *this, window);
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLDepthwiseConvolution3x3Kernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <set>
+#include <string>
+#include <tuple>
+
+using namespace arm_compute;
+
+CLDepthwiseConvolution3x3Kernel::CLDepthwiseConvolution3x3Kernel()
+    : _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _border_size(0), _conv_info()
+{
+}
+
+BorderSize CLDepthwiseConvolution3x3Kernel::border_size() const
+{
+    return _border_size;
+}
+
+void CLDepthwiseConvolution3x3Kernel::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(0) != 3) || (weights->info()->dimension(1) != 3));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 3);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(2));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    int conv_pad_x    = 0;
+    int conv_pad_y    = 0;
+    int conv_stride_x = 0;
+    int conv_stride_y = 0;
+    std::tie(conv_pad_x, conv_pad_y)       = conv_info.pad();
+    std::tie(conv_stride_x, conv_stride_y) = conv_info.stride();
+    ARM_COMPUTE_ERROR_ON((conv_stride_x != conv_stride_y) || (conv_stride_x != 1 && conv_stride_x != 2));
+    ARM_COMPUTE_ERROR_ON(conv_pad_x >= 3 || conv_pad_y >= 3);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), 3,
+                                                 conv_stride_x, conv_stride_y, conv_pad_x, conv_pad_y, conv_info.round());
+    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+    // The border covers the padding and, with a rounding up of the output size, the taps of the last outputs which fall past it
+    const int input_width   = input->info()->dimension(0);
+    const int input_height  = input->info()->dimension(1);
+    const int upper_bound_w = ((conv_w - 1) * conv_stride_x - conv_pad_x + 3) - input_width;
+    const int upper_bound_h = ((conv_h - 1) * conv_stride_y - conv_pad_y + 3) - input_height;
+
+    _input              = input;
+    _weights            = weights;
+    _biases             = biases;
+    _output             = output;
+    _conv_info          = conv_info;
+    _border_size        = BorderSize(conv_pad_y, conv_pad_x);
+    _border_size.right  = std::max(upper_bound_w, conv_pad_x);
+    _border_size.bottom = std::max(upper_bound_h, conv_pad_y);
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
+    build_opts.emplace(("-DCONV_STRIDE_X=" + val_to_string(conv_stride_x)));
+    if(biases != nullptr)
+    {
+        build_opts.emplace("-DHAS_BIAS");
+    }
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("depthwise_convolution_3x3", build_opts));
+
+    // Configure kernel window: each work item computes 4 outputs of a row, and reads 3 rows of 8 (stride 1) or 9 (stride 2) input values
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+    const unsigned int     num_elems_read_per_iteration      = (conv_stride_x == 1) ? 8 : 9;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowRectangle  input_access(input->info(), -conv_pad_x, -conv_pad_y, num_elems_read_per_iteration, 3, conv_stride_x, conv_stride_y);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLDepthwiseConvolution3x3Kernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    int conv_pad_x    = 0;
+    int conv_pad_y    = 0;
+    int conv_stride_x = 0;
+    int conv_stride_y = 0;
+    std::tie(conv_pad_x, conv_pad_y)       = _conv_info.pad();
+    std::tie(conv_stride_x, conv_stride_y) = _conv_info.stride();
+
+    Window slice = window.first_slice_window_3D();
+
+    // Each work item reads the whole kernel of its feature map
+    Window slice_weights = slice;
+    slice_weights.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_weights.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    if(_biases != nullptr)
+    {
+        unsigned int idx = 3 * num_arguments_per_3D_tensor();
+
+        Window slice_biases;
+        slice_biases.set(Window::DimX, Window::Dimension(0, 0, 0));
+        add_1D_tensor_argument(idx, _biases, slice_biases);
+    }
+
+    do
+    {
+        // Upsample the input by the stride of the convolution
+        Window slice_in(slice);
+        slice_in.set(Window::DimX, Window::Dimension(slice.x().start() * conv_stride_x - conv_pad_x, slice.x().end() * conv_stride_x - conv_pad_x, slice.x().step() * conv_stride_x));
+        slice_in.set(Window::DimY, Window::Dimension(slice.y().start() * conv_stride_y - conv_pad_y, slice.y().end() * conv_stride_y - conv_pad_y, slice.y().step() * conv_stride_y));
+
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input, slice_in);
+        add_3D_tensor_argument(idx, _output, slice);
+        add_3D_tensor_argument(idx, _weights, slice_weights);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice));
+}
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLDirectConvolutionLayer3x3Kernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+#include <tuple>
+
+using namespace arm_compute;
+
+CLDirectConvolutionLayer3x3Kernel::CLDirectConvolutionLayer3x3Kernel()
+    : _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr)
+{
+}
+
+void CLDirectConvolutionLayer3x3Kernel::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info,
+                                                  const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(0) != 3) || (weights->info()->dimension(1) != 3));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(3));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    int conv_pad_x    = 0;
+    int conv_pad_y    = 0;
+    int conv_stride_x = 0;
+    int conv_stride_y = 0;
+    std::tie(conv_pad_x, conv_pad_y)       = conv_info.pad();
+    std::tie(conv_stride_x, conv_stride_y) = conv_info.stride();
+    ARM_COMPUTE_ERROR_ON((conv_stride_x != conv_stride_y) || (conv_stride_x != 1 && conv_stride_x != 2));
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), 3,
+                                                 conv_stride_x, conv_stride_y, conv_pad_x, conv_pad_y, conv_info.round());
+    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+    _input   = input;
+    _weights = weights;
+    _biases  = biases;
+    _output  = output;
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
+    build_opts.emplace(("-DCONV_STRIDE=" + val_to_string(conv_stride_x)));
+    if(biases != nullptr)
+    {
+        build_opts.emplace("-DHAS_BIAS");
+    }
+    if(act_info.enabled())
+    {
+        build_opts.emplace("-DFUSED_ACTIVATION=" + string_from_activation_func(act_info.activation()));
+        build_opts.emplace("-DACT_A=" + val_to_string(act_info.a()));
+        build_opts.emplace("-DACT_B=" + val_to_string(act_info.b()));
+    }
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("direct_convolution3x3", build_opts));
+
+    // Set static kernel arguments
+    const cl_int2 input_dims =
+    {
+        {
+            static_cast<cl_int>(input->info()->dimension(0)),
+            static_cast<cl_int>(input->info()->dimension(1)),
+        }
+    };
+    const cl_int2 paddings =
+    {
+        {
+            conv_pad_x,
+            conv_pad_y,
+        }
+    };
+
+    unsigned int idx = 3 * num_arguments_per_3D_tensor() + ((biases != nullptr) ? num_arguments_per_1D_tensor() : 0);
+    _kernel.setArg<cl_uint>(idx++, weights->info()->strides_in_bytes()[3]);
+    _kernel.setArg<cl_int2>(idx++, input_dims);
+    _kernel.setArg<cl_int2>(idx++, paddings);
+    _kernel.setArg<cl_int>(idx++, input->info()->dimension(2));
+
+    // Configure kernel window: each work item computes 4 outputs of a row, the input is only read within its valid region
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLDirectConvolutionLayer3x3Kernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    Window slice = window.first_slice_window_3D();
+
+    // Each work item computes its input coordinates and walks all the input feature maps and their kernels
+    Window slice_in = slice;
+    slice_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    Window slice_weights;
+    slice_weights.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_weights.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_weights.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    if(_biases != nullptr)
+    {
+        unsigned int idx = 3 * num_arguments_per_3D_tensor();
+
+        Window slice_biases;
+        slice_biases.set(Window::DimX, Window::Dimension(0, 0, 0));
+        add_1D_tensor_argument(idx, _biases, slice_biases);
+    }
+
+    do
+    {
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input, slice_in);
+        add_3D_tensor_argument(idx, _output, slice);
+        add_3D_tensor_argument(idx, _weights, slice_weights);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice) && window.slide_window_slice_3D(slice_in));
+}
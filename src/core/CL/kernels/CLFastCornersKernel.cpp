@@ -32,6 +32,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <set>
 #include <string>
 
@@ -170,3 +171,88 @@ void CLCopyToArrayKernel::run(const Window &window, cl::CommandQueue &queue)
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+CLCompactToArrayKernel::CLCompactToArrayKernel()
+    : ICLKernel(), _input(nullptr), _corners(nullptr), _num_buffer(nullptr), _row_offsets(), _scan_kernel(), _compact_kernel(), _num_rows(0)
+{
+}
+
+void CLCompactToArrayKernel::configure(const ICLImage *input, ICLKeyPointArray *corners, cl::Buffer *num_buffers)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(corners == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_buffers == nullptr);
+
+    _input      = input;
+    _corners    = corners;
+    _num_buffer = num_buffers;
+
+    // Only the valid region of the image is scanned, one row per work-item
+    const ValidRegion  valid_region = input->info()->valid_region();
+    const unsigned int offset_x     = valid_region.anchor.x();
+    const unsigned int offset_y     = valid_region.anchor.y();
+    const unsigned int width        = valid_region.shape.x();
+    const size_t       stride_y     = input->info()->strides_in_bytes()[1];
+    const unsigned int offset       = input->info()->offset_first_element_in_bytes() + offset_y * stride_y + offset_x;
+
+    _num_rows    = valid_region.shape.y();
+    _row_offsets = cl::Buffer(CLKernelLibrary::get().context(), CL_MEM_READ_WRITE, std::max(_num_rows, 1u) * sizeof(cl_uint));
+
+    // Create kernels
+    _kernel         = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("count_keypoints_rows"));
+    _scan_kernel    = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("scan_keypoints_rows"));
+    _compact_kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("compact_to_keypoint"));
+
+    // Set static kernel arguments (The source image is set in run() as it might not be allocated yet)
+    unsigned int idx = 1;
+    _kernel.setArg<cl_uint>(idx++, stride_y);
+    _kernel.setArg<cl_uint>(idx++, offset);
+    _kernel.setArg<cl_uint>(idx++, width);
+    _kernel.setArg(idx++, _row_offsets);
+
+    idx = 0;
+    _scan_kernel.setArg(idx++, _row_offsets);
+    _scan_kernel.setArg<cl_uint>(idx++, _num_rows);
+    _scan_kernel.setArg(idx++, *_num_buffer);
+
+    idx = 1;
+    _compact_kernel.setArg<cl_uint>(idx++, stride_y);
+    _compact_kernel.setArg<cl_uint>(idx++, offset);
+    _compact_kernel.setArg<cl_uint>(idx++, width);
+    _compact_kernel.setArg<cl_uint>(idx++, offset_x);
+    _compact_kernel.setArg<cl_uint>(idx++, offset_y);
+    _compact_kernel.setArg<cl_uint>(idx++, corners->max_num_values());
+    _compact_kernel.setArg(idx++, _row_offsets);
+    _compact_kernel.setArg(idx++, _corners->cl_buffer());
+
+    // Configure kernel window: one work-item per row of the valid region
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _num_rows, 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+    ICLKernel::configure(win);
+}
+
+void CLCompactToArrayKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(ICLKernel::window(), window);
+
+    // Size of the single work-group of scan_keypoints_rows (SCAN_SIZE in fast_corners.cl)
+    constexpr unsigned int scan_size = 128;
+
+    if(_num_rows == 0)
+    {
+        static const unsigned int zero_init = 0;
+        queue.enqueueWriteBuffer(*_num_buffer, CL_FALSE, 0, sizeof(unsigned int), &zero_init);
+        return;
+    }
+
+    _kernel.setArg(0, _input->cl_buffer());
+    _compact_kernel.setArg(0, _input->cl_buffer());
+
+    // The rows don't have to fill whole work-groups, so let the runtime pick the local work size of the row passes
+    queue.enqueueNDRangeKernel(_kernel, cl::NullRange, cl::NDRange(_num_rows), cl::NullRange);
+    queue.enqueueNDRangeKernel(_scan_kernel, cl::NullRange, cl::NDRange(scan_size), cl::NDRange(scan_size));
+    queue.enqueueNDRangeKernel(_compact_kernel, cl::NullRange, cl::NDRange(_num_rows), cl::NullRange);
+}
@@ -61,7 +61,13 @@ void CLFillBorderKernel::set_constant_border(unsigned int idx, const PixelValue
 void CLFillBorderKernel::configure(ICLTensor *tensor, BorderSize border_size, BorderMode border_mode, const PixelValue &constant_border_value)
 {
     ARM_COMPUTE_ERROR_ON(tensor == nullptr);
-    ARM_COMPUTE_ERROR_ON(tensor->info()->num_channels() != 1);
+
+    const size_t num_channels = tensor->info()->num_channels();
+
+    if(num_channels != 1)
+    {
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(tensor, Format::RGB888, Format::RGBA8888);
+    }
 
     // If there is no border: early exit
     if(border_size.empty() || border_mode == BorderMode::UNDEFINED)
@@ -80,9 +86,17 @@ void CLFillBorderKernel::configure(ICLTensor *tensor, BorderSize border_size, Bo
         select_type = (DataType::F32 == dt) ? "int" : "short";
     }
 
-    // Define build options
+    // Define build options: the pixels of multi-channel images are filled as a whole
     std::set<std::string> build_opts;
-    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(dt)));
+    if(num_channels != 1)
+    {
+        build_opts.emplace(("-DNUM_CHANNELS=" + val_to_string(num_channels)));
+        build_opts.emplace("-DDATA_TYPE=pixel_t");
+    }
+    else
+    {
+        build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(dt)));
+    }
     build_opts.emplace(("-DSELECT_TYPE=" + select_type));
     build_opts.emplace(("-DBORDER_SIZE_TOP=" + val_to_string(border_size.top)));
     build_opts.emplace(("-DBORDER_SIZE_BOTTOM=" + val_to_string(border_size.bottom)));
@@ -110,7 +124,12 @@ void CLFillBorderKernel::configure(ICLTensor *tensor, BorderSize border_size, Bo
     ICLKernel::add_argument<cl_uint>(idx, valid_width);
     ICLKernel::add_argument<cl_uint>(idx, valid_height);
     ICLKernel::add_argument<cl_int2>(idx, valid_region_coords);
-    if(BorderMode::CONSTANT == border_mode)
+    if(BorderMode::CONSTANT == border_mode && num_channels != 1)
+    {
+        // The constant pixel is passed by value as a struct of num_channels bytes
+        _kernel.setArg(idx++, num_channels * sizeof(uint8_t), constant_border_value.value.rgbx);
+    }
+    else if(BorderMode::CONSTANT == border_mode)
     {
         switch(dt)
         {
@@ -34,10 +34,14 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <cmath>
+#include <set>
+#include <string>
+
 using namespace arm_compute;
 
 CLGEMMInterleave4x4Kernel::CLGEMMInterleave4x4Kernel()
-    : _input(nullptr), _output(nullptr)
+    : _input(nullptr), _output(nullptr), _read_feature_maps(false)
 {
 }
 
@@ -49,8 +53,9 @@ void CLGEMMInterleave4x4Kernel::configure(const ICLTensor *input, ICLTensor *out
     ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != input->info()->dimension(0) * 4);
     ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != std::ceil(static_cast<float>(input->info()->dimension(1)) / 4.0f));
 
-    _input  = input;
-    _output = output;
+    _input             = input;
+    _output            = output;
+    _read_feature_maps = false;
 
     // Create kernel
     std::string data_type_name;
@@ -74,6 +79,48 @@ void CLGEMMInterleave4x4Kernel::configure(const ICLTensor *input, ICLTensor *out
     ICLKernel::configure(win);
 }
 
+void CLGEMMInterleave4x4Kernel::configure_convolution_1x1(const ICLTensor *input, ICLTensor *output, bool has_bias)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+
+    const unsigned int num_elems = input->info()->dimension(0) * input->info()->dimension(1);
+    const unsigned int num_fm    = input->info()->dimension(2);
+
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != (num_fm + (has_bias ? 1 : 0)) * 4);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != std::ceil(static_cast<float>(num_elems) / 4.0f));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 1);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(3) != input->info()->dimension(3));
+
+    _input             = input;
+    _output            = output;
+    _read_feature_maps = true;
+
+    // Create kernel
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type()));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("gemm_interleave4x4_feature_maps", build_opts));
+
+    // Set static kernel arguments
+    unsigned int idx = num_arguments_per_3D_tensor() + num_arguments_per_2D_tensor();
+    _kernel.setArg<cl_uint>(idx++, input->info()->dimension(0));
+    _kernel.setArg<cl_uint>(idx++, num_elems);
+    _kernel.setArg<cl_uint>(idx++, num_fm);
+
+    // Configure kernel window: each work item writes the 4 interleaved values of one column of a block of 4 pixels, the input is read with scalar accesses which never go out of bounds
+    constexpr unsigned int num_elems_written_per_iteration = 4;
+
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_written_per_iteration));
+
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
 void CLGEMMInterleave4x4Kernel::run(const Window &window, cl::CommandQueue &queue)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -88,6 +135,28 @@ void CLGEMMInterleave4x4Kernel::run(const Window &window, cl::CommandQueue &queu
      *
      * After this operation, the output matrix will have the following shape: [ height * 4, width / 4 ]
      */
+    if(_read_feature_maps)
+    {
+        // The kernel walks the input itself, only the offset of the batch it reads from depends on the window
+        Window slice = window.first_slice_window_2D();
+
+        do
+        {
+            Window slice_in(slice);
+            slice_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+            slice_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+            slice_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+            unsigned int idx = 0;
+            add_3D_tensor_argument(idx, _input, slice_in);
+            add_2D_tensor_argument(idx, _output, slice);
+            enqueue(queue, *this, slice);
+        }
+        while(window.slide_window_slice_2D(slice));
+
+        return;
+    }
+
     Window in_slice  = window.first_slice_window_2D();
     Window out_slice = window.first_slice_window_2D();
 
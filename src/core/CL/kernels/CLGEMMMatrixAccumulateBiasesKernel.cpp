@@ -90,3 +90,8 @@ void CLGEMMMatrixAccumulateBiasesKernel::run(const Window &window, cl::CommandQu
     }
     while(window.slide_window_slice_2D(accum_slice));
 }
+
+bool CLGEMMMatrixAccumulateBiasesKernel::is_idempotent() const
+{
+    return false;
+}
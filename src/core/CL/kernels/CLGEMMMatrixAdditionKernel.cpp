@@ -90,3 +90,8 @@ void CLGEMMMatrixAdditionKernel::run(const Window &window, cl::CommandQueue &que
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+bool CLGEMMMatrixAdditionKernel::is_idempotent() const
+{
+    return false;
+}
@@ -42,11 +42,11 @@
 using namespace arm_compute;
 
 CLGEMMMatrixMultiplyKernel::CLGEMMMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr)
+    : _input0(nullptr), _input1(nullptr), _output(nullptr), _input1_image(nullptr)
 {
 }
 
-void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha)
+void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTensor *input1, ICLTensor *output, float alpha, const ActivationLayerInfo &act_info, const cl::Image2D *image)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F16, DataType::F32);
@@ -57,9 +57,10 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
         ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
     }
 
-    _input0 = input0;
-    _input1 = input1;
-    _output = output;
+    _input0       = input0;
+    _input1       = input1;
+    _output       = output;
+    _input1_image = image;
 
     if(output->info()->dimension(1) == 196)
     {
@@ -75,9 +76,18 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
     mm_arguments << "-DALPHA=" << alpha << " ";
     std::set<std::string> build_opts;
 
+    if(act_info.enabled())
+    {
+        build_opts.emplace("-DFUSED_ACTIVATION=" + string_from_activation_func(act_info.activation()));
+        build_opts.emplace("-DACT_A=" + val_to_string(act_info.a()));
+        build_opts.emplace("-DACT_B=" + val_to_string(act_info.b()));
+    }
+
     // Check if the output tensor is a vector. If so,the kernel runs the vector-matrix multiplication
     if(output->info()->dimension(1) == 1)
     {
+        ARM_COMPUTE_ERROR_ON_MSG(image != nullptr, "Matrix B can't be read from an image by the vector-matrix multiplication");
+
         mm_arguments << "-DWIDTH_VECTOR_A=" << input0->info()->dimension(0) << " ";
         build_opts.emplace(mm_arguments.str());
 
@@ -102,11 +112,13 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
     }
     else
     {
+        ARM_COMPUTE_ERROR_ON_MSG(image != nullptr && input0->info()->data_type() != DataType::F32, "Matrix B can only be read from an image in F32");
         build_opts.emplace(mm_arguments.str());
 
         // Create kernel
         std::string data_type_name = lower_string(string_from_data_type(input0->info()->data_type()));
-        _kernel                    = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(("gemm_mm_" + data_type_name), build_opts));
+        std::string kernel_name    = "gemm_mm_" + data_type_name + ((image != nullptr) ? "_image" : "");
+        _kernel                    = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
 
         // Configure window kernel
         const unsigned int     num_elems_processed_per_iteration_x = max_cl_vector_width / data_size_from_type(input0->info()->data_type());
@@ -118,7 +130,15 @@ void CLGEMMMatrixMultiplyKernel::configure(const ICLTensor *input0, const ICLTen
         AccessWindowRectangle input1_access(input1->info(), 0, 0, num_elems_processed_per_iteration_x, 1);
         AccessWindowRectangle output_access(output->info(), 0, 0, num_elems_processed_per_iteration_x, num_elems_processed_per_iteration_y);
 
-        update_window_and_padding(win, input0_access, input1_access, output_access);
+        // The image reads are clamped by the sampler: input1 doesn't need padding when it is only used to fill the image
+        if(image != nullptr)
+        {
+            update_window_and_padding(win, input0_access, output_access);
+        }
+        else
+        {
+            update_window_and_padding(win, input0_access, input1_access, output_access);
+        }
 
         output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
 
@@ -149,7 +169,14 @@ void CLGEMMMatrixMultiplyKernel::run(const Window &window, cl::CommandQueue &que
 
         unsigned int idx = 0;
         add_2D_tensor_argument(idx, _input0, slice);
-        add_2D_tensor_argument(idx, _input1, slice_b);
+        if(_input1_image != nullptr)
+        {
+            add_argument(idx, *_input1_image);
+        }
+        else
+        {
+            add_2D_tensor_argument(idx, _input1, slice_b);
+        }
         add_2D_tensor_argument(idx, _output, slice);
         enqueue(queue, *this, slice, _lws_hint);
     }
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLGEMMMatrixVectorMultiplyKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+constexpr unsigned int CLGEMMMatrixVectorMultiplyKernel::num_work_items;
+
+CLGEMMMatrixVectorMultiplyKernel::CLGEMMMatrixVectorMultiplyKernel()
+    : _input0(nullptr), _input1(nullptr), _biases(nullptr), _output(nullptr), _scales(nullptr)
+{
+}
+
+void CLGEMMMatrixVectorMultiplyKernel::configure(const ICLTensor *input0, const ICLTensor *input1, const ICLTensor *biases, ICLTensor *output, const ICLTensor *scales)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, output);
+    ARM_COMPUTE_ERROR_ON(input1->info()->data_type() == DataType::F32 && input0->info()->data_type() != DataType::F32);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 1);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    const bool is_quantized = (input1->info()->data_type() == DataType::U8);
+    ARM_COMPUTE_ERROR_ON(is_quantized != (scales != nullptr));
+
+    if(scales != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, scales);
+        ARM_COMPUTE_ERROR_ON(scales->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(scales->info()->num_dimensions() > 1);
+    }
+
+    _input0 = input0;
+    _input1 = input1;
+    _biases = biases;
+    _output = output;
+    _scales = scales;
+
+    // Create kernel
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DDATA_TYPE=" + get_cl_type_from_data_type(input0->info()->data_type()));
+    build_opts.emplace("-DWIDTH_VECTOR_A=" + val_to_string(input0->info()->dimension(0)));
+    build_opts.emplace("-DLWS=" + val_to_string(num_work_items));
+    if(biases != nullptr)
+    {
+        build_opts.emplace("-DHAS_BIAS");
+    }
+    if(input1->info()->data_type() != input0->info()->data_type())
+    {
+        build_opts.emplace("-DWEIGHTS_TYPE=" + get_cl_type_from_data_type(input1->info()->data_type()));
+    }
+    if(is_quantized)
+    {
+        build_opts.emplace("-DHAS_SCALES");
+        build_opts.emplace("-DWEIGHTS_OFFSET=" + val_to_string(input1->info()->quantization_info().offset));
+    }
+
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("gemm_mv", build_opts));
+
+    // Configure kernel window: a work-group of num_work_items work-items along X for each element of the output along Y
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_work_items, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(0), 1));
+
+    // The kernel doesn't read or write outside the tensors so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    _lws_hint = cl::NDRange(num_work_items, 1);
+
+    ICLKernel::configure(win);
+}
+
+void CLGEMMMatrixVectorMultiplyKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(ICLKernel::window(), window);
+
+    // The kernel computes the addresses of the elements from the first element of each tensor
+    Window slice;
+    slice.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    unsigned int idx = 0;
+    add_1D_tensor_argument(idx, _input0, slice);
+    add_2D_tensor_argument(idx, _input1, slice);
+    if(_scales != nullptr)
+    {
+        add_1D_tensor_argument(idx, _scales, slice);
+    }
+    if(_biases != nullptr)
+    {
+        add_1D_tensor_argument(idx, _biases, slice);
+    }
+    add_1D_tensor_argument(idx, _output, slice);
+
+    enqueue(queue, *this, window, _lws_hint);
+}
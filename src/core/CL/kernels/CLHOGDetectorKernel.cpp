@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLHOGDetectorKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of work-items computing the score of a detection window. Must be a power of 2 for the reduction */
+constexpr unsigned int num_items_per_window = 64;
+} // namespace
+
+CLHOGDetectorKernel::CLHOGDetectorKernel()
+    : _input(nullptr), _lws(cl::NullRange)
+{
+}
+
+void CLHOGDetectorKernel::configure(const ICLTensor *input, const ICLHOG *hog, ICLDetectionWindowArray *detection_windows, cl::Buffer *num_detection_windows, const Size2D &detection_window_stride,
+                                    float threshold, uint16_t idx_class)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(hog == nullptr);
+    ARM_COMPUTE_ERROR_ON(detection_windows == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_detection_windows == nullptr);
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.width % hog->info()->block_stride().width) != 0);
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.height % hog->info()->block_stride().height) != 0);
+
+    _input = input;
+
+    const Size2D &detection_window_size = hog->info()->detection_window_size();
+    const Size2D &block_size            = hog->info()->block_size();
+    const Size2D &block_stride          = hog->info()->block_stride();
+
+    const size_t num_bins_per_descriptor_x   = ((detection_window_size.width - block_size.width) / block_stride.width + 1) * input->info()->num_channels();
+    const size_t num_blocks_per_descriptor_y = (detection_window_size.height - block_size.height) / block_stride.height + 1;
+
+    ARM_COMPUTE_ERROR_ON((num_bins_per_descriptor_x * num_blocks_per_descriptor_y + 1) != hog->info()->descriptor_size());
+
+    // Get the number of blocks along the x and y directions of the input tensor
+    const ValidRegion &valid_region = input->info()->valid_region();
+    const size_t       num_blocks_x = valid_region.shape[0];
+    const size_t       num_blocks_y = valid_region.shape[1];
+
+    // Get the number of blocks along the x and y directions of the detection window
+    const size_t num_blocks_per_detection_window_x = detection_window_size.width / block_stride.width;
+    const size_t num_blocks_per_detection_window_y = detection_window_size.height / block_stride.height;
+
+    const size_t window_step_x = detection_window_stride.width / block_stride.width;
+    const size_t window_step_y = detection_window_stride.height / block_stride.height;
+
+    // Same detection windows as NEHOGDetectorKernel
+    const size_t num_windows_x = floor_to_multiple(num_blocks_x - num_blocks_per_detection_window_x, window_step_x) / window_step_x;
+    const size_t num_windows_y = floor_to_multiple(num_blocks_y - num_blocks_per_detection_window_y, window_step_y) / window_step_y;
+
+    ARM_COMPUTE_ERROR_ON_MSG(num_windows_x == 0 || num_windows_y == 0, "The input is too small for the detection window");
+
+    std::set<std::string> build_opts;
+    build_opts.insert("-DNUM_ITEMS_PER_WINDOW=" + val_to_string(num_items_per_window));
+    build_opts.insert("-DNUM_BINS_PER_DESCRIPTOR_X=" + val_to_string(num_bins_per_descriptor_x));
+    build_opts.insert("-DNUM_BLOCKS_PER_DESCRIPTOR_Y=" + val_to_string(num_blocks_per_descriptor_y));
+    build_opts.insert("-DBIAS_INDEX=" + val_to_string(hog->info()->descriptor_size() - 1));
+    build_opts.insert("-DWINDOW_STEP_X=" + val_to_string(window_step_x));
+    build_opts.insert("-DDETECTION_WINDOW_STRIDE_WIDTH=" + val_to_string(detection_window_stride.width));
+    build_opts.insert("-DDETECTION_WINDOW_STRIDE_HEIGHT=" + val_to_string(detection_window_stride.height));
+    build_opts.insert("-DDETECTION_WINDOW_WIDTH=" + val_to_string(detection_window_size.width));
+    build_opts.insert("-DDETECTION_WINDOW_HEIGHT=" + val_to_string(detection_window_size.height));
+    build_opts.insert("-DIDX_CLASS=" + val_to_string(idx_class));
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("hog_detector", build_opts));
+
+    // Set static kernel arguments
+    unsigned int idx = num_arguments_per_2D_tensor(); // Skip the input parameters
+    _kernel.setArg(idx++, hog->cl_buffer());
+    _kernel.setArg(idx++, detection_windows->cl_buffer());
+    _kernel.setArg(idx++, *num_detection_windows);
+    _kernel.setArg<cl_uint>(idx++, detection_windows->max_num_values());
+    _kernel.setArg<cl_float>(idx++, threshold);
+
+    // Configure kernel window: a work-group of num_items_per_window work-items along X per detection window,
+    // and one row of work-items per row of detection windows
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_windows_x * num_items_per_window, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_windows_y * window_step_y, window_step_y));
+
+    _lws = cl::NDRange(num_items_per_window, 1, 1);
+
+    ICLKernel::configure(win);
+}
+
+void CLHOGDetectorKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    Window slice = window.first_slice_window_2D();
+
+    unsigned int idx = 0;
+    add_2D_tensor_argument(idx, _input, slice);
+
+    // The reduction needs all the work-items of a detection window in the same work-group, whatever the local workgroup size hint
+    enqueue(queue, *this, slice, _lws);
+}
+
+bool CLHOGDetectorKernel::is_idempotent() const
+{
+    return false;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLHOGNonMaximaSuppressionKernel.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Window.h"
+
+using namespace arm_compute;
+
+CLHOGNonMaximaSuppressionKernel::CLHOGNonMaximaSuppressionKernel()
+{
+}
+
+void CLHOGNonMaximaSuppressionKernel::configure(const ICLDetectionWindowArray *candidates, const cl::Buffer *num_candidates, ICLDetectionWindowArray *detection_windows,
+                                                cl::Buffer *num_detection_windows, float min_distance)
+{
+    ARM_COMPUTE_ERROR_ON(candidates == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_candidates == nullptr);
+    ARM_COMPUTE_ERROR_ON(detection_windows == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_detection_windows == nullptr);
+    ARM_COMPUTE_ERROR_ON(candidates->max_num_values() == 0);
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("hog_non_maxima_suppression"));
+
+    // Set static kernel arguments
+    unsigned int idx = 0;
+    _kernel.setArg(idx++, candidates->cl_buffer());
+    _kernel.setArg(idx++, *num_candidates);
+    _kernel.setArg(idx++, detection_windows->cl_buffer());
+    _kernel.setArg(idx++, *num_detection_windows);
+    _kernel.setArg<cl_uint>(idx++, candidates->max_num_values());
+    _kernel.setArg<cl_uint>(idx++, detection_windows->max_num_values());
+    _kernel.setArg<cl_float>(idx++, min_distance);
+
+    // Configure kernel window: one work-item per candidate the array can hold, as their number is only known on the device
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, candidates->max_num_values(), 1));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    ICLKernel::configure(win);
+}
+
+void CLHOGNonMaximaSuppressionKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    enqueue(queue, *this, window);
+}
@@ -222,3 +222,8 @@ void CLHistogramBorderKernel::run(const Window &window, cl::CommandQueue &queue)
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+bool CLHistogramBorderKernel::is_idempotent() const
+{
+    return false;
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLImageToTensorKernel.h"
+
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLMultiImage.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+CLImageToTensorKernel::CLImageToTensorKernel()
+    : _input(nullptr), _output(nullptr)
+{
+}
+
+void CLImageToTensorKernel::configure(const ICLMultiImage *input, ICLTensor *output, const std::array<float, 3> &mean, float scale)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() != 3);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 3);
+
+    _input  = input;
+    _output = output;
+
+    const Format format = input->info()->format();
+
+    ARM_COMPUTE_ERROR_ON_MSG(format != Format::NV12 && format != Format::NV21 && format != Format::IYUV && format != Format::YUV444, "Not supported");
+
+    // Create kernel
+    std::set<std::string> build_opts = { "-D" + string_from_format(format) };
+    _kernel                          = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("YUV_to_tensor_bilinear_bt709", build_opts));
+
+    // Configure kernel window: each work item writes the three planes
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+
+    // Set static kernel arguments
+    const unsigned int num_input_planes = (format == Format::NV12 || format == Format::NV21) ? 2 : 3;
+    unsigned int       idx              = num_input_planes * num_arguments_per_2D_tensor() + num_arguments_per_3D_tensor(); //Skip the input and output parameters
+    _kernel.setArg<cl_int>(idx++, input->info()->width());
+    _kernel.setArg<cl_int>(idx++, input->info()->height());
+    _kernel.setArg<cl_float>(idx++, static_cast<float>(input->info()->width()) / static_cast<float>(output->info()->dimension(0)));
+    _kernel.setArg<cl_float>(idx++, static_cast<float>(input->info()->height()) / static_cast<float>(output->info()->dimension(1)));
+    _kernel.setArg<cl_float>(idx++, mean[0]);
+    _kernel.setArg<cl_float>(idx++, mean[1]);
+    _kernel.setArg<cl_float>(idx++, mean[2]);
+    _kernel.setArg<cl_float>(idx++, scale);
+}
+
+void CLImageToTensorKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    const Format format = _input->info()->format();
+
+    Window slice = window.first_slice_window_3D();
+
+    // The input planes are sampled at arbitrary coordinates: only their first element and strides are used
+    const Window win_in;
+
+    do
+    {
+        unsigned int idx = 0;
+        add_2D_tensor_argument(idx, _input->cl_plane(0), win_in);
+        add_2D_tensor_argument(idx, _input->cl_plane(1), win_in);
+
+        if(format == Format::IYUV || format == Format::YUV444)
+        {
+            add_2D_tensor_argument(idx, _input->cl_plane(2), win_in);
+        }
+
+        add_3D_tensor_argument(idx, _output, slice);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice));
+}
@@ -95,3 +95,8 @@ void CLIntegralImageVertKernel::run(const Window &window, cl::CommandQueue &queu
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+bool CLIntegralImageVertKernel::is_idempotent() const
+{
+    return false;
+}
@@ -35,12 +35,14 @@
 #include "arm_compute/core/Window.h"
 
 #include <cmath>
+#include <set>
+#include <string>
 
 using namespace arm_compute;
 
 void CLLKTrackerInitKernel::configure(const ICLKeyPointArray *old_points, const ICLKeyPointArray *new_points_estimates,
                                       ICLLKInternalKeypointArray *old_points_internal, ICLLKInternalKeypointArray *new_points_internal,
-                                      bool use_initial_estimate, size_t level, size_t num_levels, float pyramid_scale)
+                                      bool use_initial_estimate, size_t level, size_t num_levels, float pyramid_scale, const cl::Buffer *num_points)
 
 {
     ARM_COMPUTE_ERROR_ON(old_points == nullptr);
@@ -49,13 +51,20 @@ void CLLKTrackerInitKernel::configure(const ICLKeyPointArray *old_points, const
 
     const float scale = std::pow(pyramid_scale, level);
 
+    // The number of points is read on the device, the work-items past it return
+    std::set<std::string> build_opts;
+    if(num_points != nullptr)
+    {
+        build_opts.emplace("-DNUM_POINTS_FROM_BUFFER");
+    }
+
     // Create kernel
     std::string kernel_name = "init_level";
     if(level == (num_levels - 1))
     {
         kernel_name += (use_initial_estimate) ? std::string("_max_initial_estimate") : std::string("_max");
     }
-    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
 
     // Set static kernel arguments
     unsigned int idx = 0;
@@ -71,9 +80,16 @@ void CLLKTrackerInitKernel::configure(const ICLKeyPointArray *old_points, const
     _kernel.setArg(idx++, new_points_internal->cl_buffer());
     _kernel.setArg<cl_float>(idx++, scale);
 
+    if(num_points != nullptr)
+    {
+        _kernel.setArg(idx++, *num_points);
+    }
+
     // Configure kernel window
+    const size_t num_values = (num_points != nullptr) ? old_points->max_num_values() : old_points->num_values();
+
     Window window;
-    window.set(Window::DimX, Window::Dimension(0, old_points->num_values(), 1));
+    window.set(Window::DimX, Window::Dimension(0, num_values, 1));
     window.set(Window::DimY, Window::Dimension(0, 1, 1));
     ICLKernel::configure(window);
 }
@@ -86,20 +102,37 @@ void CLLKTrackerInitKernel::run(const Window &window, cl::CommandQueue &queue)
     enqueue(queue, *this, window);
 }
 
-void CLLKTrackerFinalizeKernel::configure(ICLLKInternalKeypointArray *new_points_internal, ICLKeyPointArray *new_points)
+bool CLLKTrackerInitKernel::is_idempotent() const
+{
+    return false;
+}
+
+void CLLKTrackerFinalizeKernel::configure(ICLLKInternalKeypointArray *new_points_internal, ICLKeyPointArray *new_points, const cl::Buffer *num_points)
 
 {
     ARM_COMPUTE_ERROR_ON(new_points_internal == nullptr);
     ARM_COMPUTE_ERROR_ON(new_points == nullptr);
 
+    // The number of points is read on the device, the work-items past it return
+    std::set<std::string> build_opts;
+    if(num_points != nullptr)
+    {
+        build_opts.emplace("-DNUM_POINTS_FROM_BUFFER");
+    }
+
     // Create kernel
-    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("finalize"));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("finalize", build_opts));
 
     // Set static kernel arguments
     unsigned int idx = 0;
     _kernel.setArg(idx++, new_points_internal->cl_buffer());
     _kernel.setArg(idx++, new_points->cl_buffer());
 
+    if(num_points != nullptr)
+    {
+        _kernel.setArg(idx++, *num_points);
+    }
+
     // Configure kernel window
     Window window;
     window.set(Window::DimX, Window::Dimension(0, new_points_internal->num_values(), 1));
@@ -123,7 +156,7 @@ CLLKTrackerStage0Kernel::CLLKTrackerStage0Kernel()
 void CLLKTrackerStage0Kernel::configure(const ICLTensor *old_input, const ICLTensor *old_scharr_gx, const ICLTensor *old_scharr_gy,
                                         ICLLKInternalKeypointArray *old_points_internal, ICLLKInternalKeypointArray *new_points_internal,
                                         ICLCoefficientTableArray *coeff_table, ICLOldValArray *old_ival,
-                                        size_t window_dimension, size_t level)
+                                        size_t window_dimension, size_t level, const cl::Buffer *num_points)
 
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(old_input, 1, DataType::U8);
@@ -174,8 +207,15 @@ void CLLKTrackerStage0Kernel::configure(const ICLTensor *old_input, const ICLTen
         }
     };
 
+    // The number of points is read on the device, the work-items past it return
+    std::set<std::string> build_opts;
+    if(num_points != nullptr)
+    {
+        build_opts.emplace("-DNUM_POINTS_FROM_BUFFER");
+    }
+
     // Create kernel
-    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("lktracker_stage0"));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("lktracker_stage0", build_opts));
 
     // Set arguments
     unsigned int idx = 3 * num_arguments_per_2D_tensor();
@@ -189,6 +229,11 @@ void CLLKTrackerStage0Kernel::configure(const ICLTensor *old_input, const ICLTen
     _kernel.setArg<cl_float3>(idx++, border_limits);
     _kernel.setArg<cl_float>(idx++, eig_const);
     _kernel.setArg<cl_int>(idx++, level0);
+
+    if(num_points != nullptr)
+    {
+        _kernel.setArg(idx++, *num_points);
+    }
 }
 
 void CLLKTrackerStage0Kernel::run(const Window &window, cl::CommandQueue &queue)
@@ -211,7 +256,7 @@ CLLKTrackerStage1Kernel::CLLKTrackerStage1Kernel()
 }
 
 void CLLKTrackerStage1Kernel::configure(const ICLTensor *new_input, ICLLKInternalKeypointArray *new_points_internal, ICLCoefficientTableArray *coeff_table, ICLOldValArray *old_ival,
-                                        Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, size_t level)
+                                        Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, size_t level, const cl::Buffer *num_points)
 
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(new_input, 1, DataType::U8);
@@ -252,8 +297,15 @@ void CLLKTrackerStage1Kernel::configure(const ICLTensor *new_input, ICLLKInterna
     const int term_iteration = (termination == Termination::TERM_CRITERIA_ITERATIONS || termination == Termination::TERM_CRITERIA_BOTH) ? 1 : 0;
     const int term_epsilon   = (termination == Termination::TERM_CRITERIA_EPSILON || termination == Termination::TERM_CRITERIA_BOTH) ? 1 : 0;
 
+    // The number of points is read on the device, the work-items past it return
+    std::set<std::string> build_opts;
+    if(num_points != nullptr)
+    {
+        build_opts.emplace("-DNUM_POINTS_FROM_BUFFER");
+    }
+
     // Create kernel
-    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("lktracker_stage1"));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("lktracker_stage1", build_opts));
 
     // Set static kernel arguments
     unsigned int idx = num_arguments_per_2D_tensor();
@@ -270,6 +322,11 @@ void CLLKTrackerStage1Kernel::configure(const ICLTensor *new_input, ICLLKInterna
     _kernel.setArg<cl_int>(idx++, level0);
     _kernel.setArg<cl_int>(idx++, term_iteration);
     _kernel.setArg<cl_int>(idx++, term_epsilon);
+
+    if(num_points != nullptr)
+    {
+        _kernel.setArg(idx++, *num_points);
+    }
 }
 
 void CLLKTrackerStage1Kernel::run(const Window &window, cl::CommandQueue &queue)
@@ -283,3 +340,8 @@ void CLLKTrackerStage1Kernel::run(const Window &window, cl::CommandQueue &queue)
 
     enqueue(queue, *this, window);
 }
+
+bool CLLKTrackerStage1Kernel::is_idempotent() const
+{
+    return false;
+}
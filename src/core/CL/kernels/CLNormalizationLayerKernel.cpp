@@ -32,10 +32,19 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <set>
+#include <string>
+
 using namespace arm_compute;
 
+namespace
+{
+/** Local workgroup size along X of the in map normalization without a squared input */
+constexpr unsigned int in_map_lws_x = 16;
+} // namespace
+
 CLNormalizationLayerKernel::CLNormalizationLayerKernel()
-    : _input(nullptr), _squared_input(nullptr), _output(nullptr), _border_size(0)
+    : _input(nullptr), _squared_input(nullptr), _output(nullptr), _border_size(0), _is_in_map_local(false)
 {
 }
 
@@ -60,7 +69,14 @@ void CLNormalizationLayerKernel::configure(const ICLTensor *input, const ICLTens
     _output        = output;
 
     const bool is_in_map = (norm_info.type() == NormType::IN_MAP);
-    _border_size         = (is_in_map) ? BorderSize(0, 3) : BorderSize(0);
+    _border_size         = (is_in_map && (squared_input != nullptr)) ? BorderSize(0, 3) : BorderSize(0);
+    _is_in_map_local     = is_in_map && (squared_input == nullptr);
+
+    if(squared_input == nullptr)
+    {
+        configure_fused(norm_info);
+        return;
+    }
 
     // Create kernel
     std::string kernel_name = (norm_info.type() == NormType::IN_MAP) ? "normalization_layer_in_map" : "normalization_layer_cross_map";
@@ -90,6 +106,62 @@ void CLNormalizationLayerKernel::configure(const ICLTensor *input, const ICLTens
     ICLKernel::configure(win);
 }
 
+void CLNormalizationLayerKernel::configure_fused(const NormalizationLayerInfo &norm_info)
+{
+    const bool is_in_map = (norm_info.type() == NormType::IN_MAP);
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(_input->info()->data_type())));
+    if(is_in_map)
+    {
+        build_opts.emplace(("-DRADIUS=" + val_to_string(norm_info.norm_size() / 2)));
+        build_opts.emplace(("-DLWS_X=" + val_to_string(in_map_lws_x)));
+    }
+
+    // Create kernel
+    std::string kernel_name = is_in_map ? "normalization_layer_in_map_local" : "normalization_layer_cross_map_sliding";
+    _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
+
+    // Set kernel static arguments
+    unsigned int idx = 2 * num_arguments_per_3D_tensor(); // Skip the input and output parameters
+    _kernel.setArg<cl_float>(idx++, norm_info.scale_coeff());
+    _kernel.setArg<cl_float>(idx++, norm_info.beta());
+    _kernel.setArg<cl_float>(idx++, norm_info.kappa());
+    if(is_in_map)
+    {
+        _kernel.setArg<cl_int>(idx++, _input->info()->dimension(0));
+    }
+    else
+    {
+        _kernel.setArg<cl_uint>(idx++, norm_info.norm_size() / 2);
+        _kernel.setArg<cl_uint>(idx++, _input->info()->dimension(2));
+    }
+
+    // Configure kernel window: each work item processes 4 elements of a row.
+    // The cross map normalization walks all the feature maps, the rows of the in map normalization are split in whole work-groups.
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+    Window win = calculate_max_window(*_input->info(), Steps(num_elems_processed_per_iteration));
+    if(is_in_map)
+    {
+        win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(_input->info()->dimension(0), num_elems_processed_per_iteration * in_map_lws_x), num_elems_processed_per_iteration));
+    }
+    else
+    {
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+    }
+
+    AccessWindowHorizontal input_access(_input->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(_output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, _input->info()->valid_region());
+
+    ICLKernel::configure(win);
+}
+
 void CLNormalizationLayerKernel::run(const Window &window, cl::CommandQueue &queue)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -101,9 +173,21 @@ void CLNormalizationLayerKernel::run(const Window &window, cl::CommandQueue &que
     {
         unsigned int idx = 0;
         add_3D_tensor_argument(idx, _input, slice);
-        add_3D_tensor_argument(idx, _squared_input, slice);
+        if(_squared_input != nullptr)
+        {
+            add_3D_tensor_argument(idx, _squared_input, slice);
+        }
         add_3D_tensor_argument(idx, _output, slice);
-        enqueue(queue, *this, slice);
+
+        // The work items of a work-group share the tile of the row in local memory: the local workgroup size is fixed
+        if(_is_in_map_local)
+        {
+            enqueue(queue, *this, slice, cl::NDRange(in_map_lws_x, 1, 1));
+        }
+        else
+        {
+            enqueue(queue, *this, slice);
+        }
     }
     while(window.slide_window_slice_3D(slice));
 }
@@ -40,8 +40,14 @@
 
 using namespace arm_compute;
 
+namespace
+{
+/** Number of outputs computed by a work-group of the tiled kernel along X and Y (Must match TILE_OUT in pooling_layer.cl) */
+constexpr unsigned int tile_out = 8;
+} // namespace
+
 CLPoolingLayerKernel::CLPoolingLayerKernel()
-    : _input(nullptr), _output(nullptr), _pool_info(), _border_size(0)
+    : _input(nullptr), _output(nullptr), _pool_info(), _border_size(0), _is_tiled(false)
 {
 }
 
@@ -95,13 +101,23 @@ void CLPoolingLayerKernel::configure(const ICLTensor *input, ICLTensor *output,
     _border_size.right  = std::max(upper_bound_w, pool_pad_x);
     _border_size.bottom = std::max(upper_bound_h, pool_pad_y);
 
+    // Overlapping pooling windows share their input elements: stage the input tile of each work-group in local memory
+    _is_tiled = (pool_stride_x < pool_size) || (pool_stride_y < pool_size);
+
     // Set build options
     std::set<std::string> build_opts;
     build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
     build_opts.emplace(("-DPOOL_" + ((PoolingType::MAX == pool_type) ? std::string("MAX") : std::string("AVG"))));
 
+    if(_is_tiled)
+    {
+        build_opts.emplace(("-DPOOL_SIZE=" + val_to_string(pool_size)));
+        build_opts.emplace(("-DPOOL_STRIDE_X=" + val_to_string(pool_stride_x)));
+        build_opts.emplace(("-DPOOL_STRIDE_Y=" + val_to_string(pool_stride_y)));
+    }
+
     // Create kernel
-    std::string kernel_name = "pooling_layer_" + val_to_string(pool_size);
+    std::string kernel_name = _is_tiled ? "pooling_layer_tiled" : "pooling_layer_" + val_to_string(pool_size);
     _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
 
     // Set static kernel arguments
@@ -142,6 +158,28 @@ void CLPoolingLayerKernel::configure(const ICLTensor *input, ICLTensor *output,
 
     Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
 
+    if(_is_tiled)
+    {
+        // Each work-group computes a whole tile of outputs: round the window up to whole tiles and pad the tensors accordingly
+        const int win_w = ceil_to_multiple(pooled_w, tile_out);
+        const int win_h = ceil_to_multiple(pooled_h, tile_out);
+        win.set(Window::DimX, Window::Dimension(0, win_w, 1));
+        win.set(Window::DimY, Window::Dimension(0, win_h, 1));
+
+        const int end_x = std::max<int>(input_width + _border_size.right, (win_w - 1) * pool_stride_x - pool_pad_x + pool_size);
+        const int end_y = std::max<int>(input_height + _border_size.bottom, (win_h - 1) * pool_stride_y - pool_pad_y + pool_size);
+
+        AccessWindowStatic input_access(input->info(), -pool_pad_x, -pool_pad_y, end_x, end_y);
+        AccessWindowStatic output_access(output->info(), 0, 0, win_w, win_h);
+
+        update_window_and_padding(win, input_access, output_access);
+
+        output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+        ICLKernel::configure(win);
+        return;
+    }
+
     AccessWindowStatic     input_access(input->info(), -pool_pad_x, -pool_pad_y, input_width + _border_size.right, input_height + _border_size.bottom);
     AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
 
@@ -174,7 +212,16 @@ void CLPoolingLayerKernel::run(const Window &window, cl::CommandQueue &queue)
         unsigned int idx = 0;
         add_2D_tensor_argument(idx, _input, in_slice);
         add_2D_tensor_argument(idx, _output, slice);
-        enqueue(queue, *this, slice);
+
+        // The work items of a work-group share the input tile in local memory: the local workgroup size is fixed
+        if(_is_tiled)
+        {
+            enqueue(queue, *this, slice, cl::NDRange(tile_out, tile_out));
+        }
+        else
+        {
+            enqueue(queue, *this, slice);
+        }
     }
     while(window.slide_window_slice_2D(slice));
 }
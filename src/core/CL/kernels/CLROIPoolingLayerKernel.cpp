@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLROIPoolingLayerKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+CLROIPoolingLayerKernel::CLROIPoolingLayerKernel()
+    : _input(nullptr), _rois(nullptr), _output(nullptr)
+{
+}
+
+void CLROIPoolingLayerKernel::configure(const ICLTensor *input, const ICLROIArray *rois, ICLTensor *output, const ROIPoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(rois == nullptr || rois->max_num_values() == 0);
+    ARM_COMPUTE_ERROR_ON(input->info()->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_ERROR_ON(pool_info.pooled_width() == 0 || pool_info.pooled_height() == 0 || pool_info.spatial_scale() <= 0.f);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != pool_info.pooled_width() || output->info()->dimension(1) != pool_info.pooled_height());
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2) || output->info()->dimension(3) != rois->max_num_values());
+
+    _input  = input;
+    _rois   = rois;
+    _output = output;
+
+    const unsigned int num_channels = input->info()->dimension(2);
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
+    build_opts.emplace(("-DPOOLED_WIDTH=" + val_to_string(pool_info.pooled_width())));
+    build_opts.emplace(("-DPOOLED_HEIGHT=" + val_to_string(pool_info.pooled_height())));
+    build_opts.emplace(("-DSPATIAL_SCALE=" + val_to_string(pool_info.spatial_scale()) + "f"));
+    build_opts.emplace(("-DWIDTH=" + val_to_string(input->info()->dimension(0))));
+    build_opts.emplace(("-DHEIGHT=" + val_to_string(input->info()->dimension(1))));
+    build_opts.emplace(("-DNUM_CHANNELS=" + val_to_string(num_channels)));
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("roi_pooling_layer", build_opts));
+
+    // Set kernel static arguments
+    unsigned int idx = 2 * num_arguments_per_3D_tensor(); // Skip the input and output parameters
+    _kernel.setArg(idx++, rois->cl_buffer());
+    _kernel.setArg<cl_uint>(idx++, input->info()->strides_in_bytes()[3]);
+    _kernel.setArg<cl_uint>(idx++, output->info()->strides_in_bytes()[3]);
+
+    // Configure kernel window: one work-item per bin of each channel of each region
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, pool_info.pooled_width(), 1));
+    win.set(Window::DimY, Window::Dimension(0, pool_info.pooled_height(), 1));
+    win.set(Window::DimZ, Window::Dimension(0, num_channels * rois->max_num_values(), 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLROIPoolingLayerKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    // The regions read the feature maps of their own batch: the kernel addresses the whole input
+    Window input_slice;
+    input_slice.use_tensor_dimensions(_input->info());
+    input_slice = input_slice.first_slice_window_3D();
+
+    unsigned int idx = 0;
+    add_3D_tensor_argument(idx, _input, input_slice);
+    add_3D_tensor_argument(idx, _output, window);
+
+    // Skip the static arguments
+    idx += 3;
+    add_argument<cl_uint>(idx, _rois->num_values());
+
+    enqueue(queue, *this, window);
+}
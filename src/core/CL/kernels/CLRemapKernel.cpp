@@ -38,7 +38,7 @@
 using namespace arm_compute;
 
 CLRemapKernel::CLRemapKernel()
-    : _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr)
+    : _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr), _copy_to_image(), _use_image(false)
 {
 }
 
@@ -47,29 +47,38 @@ BorderSize CLRemapKernel::border_size() const
     return BorderSize(1);
 }
 
-void CLRemapKernel::configure(const ICLTensor *input, const ICLTensor *map_x, const ICLTensor *map_y, ICLTensor *output, InterpolationPolicy policy, bool border_undefined)
+void CLRemapKernel::configure(const ICLTensor *input, const ICLTensor *map_x, const ICLTensor *map_y, ICLTensor *output, InterpolationPolicy policy, bool border_undefined, bool use_image)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_x, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_y, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MSG(policy == InterpolationPolicy::AREA, "Area interpolation is not supported!");
+    ARM_COMPUTE_ERROR_ON(use_image && policy != InterpolationPolicy::BILINEAR);
 
-    _input  = input;
-    _output = output;
-    _map_x  = map_x;
-    _map_y  = map_y;
+    _input     = input;
+    _output    = output;
+    _map_x     = map_x;
+    _map_y     = map_y;
+    _use_image = use_image;
+
+    // Configure window
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+    const int              border_offset                     = (border_undefined) ? 0 : border_size().left;
 
     // Create kernel
     std::set<std::string> build_opts         = { ("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())) };
     std::string           interpolation_name = string_from_interpolation_policy(policy);
     std::transform(interpolation_name.begin(), interpolation_name.end(), interpolation_name.begin(), ::tolower);
     std::string kernel_name = "remap_" + interpolation_name;
-    _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
-
-    // Configure window
-    constexpr unsigned int num_elems_processed_per_iteration = 4;
-    const int              border_offset                     = (border_undefined) ? 0 : border_size().left;
+    if(use_image)
+    {
+        // The sampler clamps the reads to the edge of the image, which holds the border of the input only if it is defined
+        _copy_to_image.configure(input, BorderSize(border_offset));
+        build_opts.emplace(("-DIMAGE_BORDER=" + val_to_string(border_offset)));
+        kernel_name += "_image";
+    }
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
 
     Window             win = calculate_max_window(*_output->info(), Steps(num_elems_processed_per_iteration));
     AccessWindowStatic input_access(output->info(), -border_offset, -border_offset,
@@ -82,8 +91,13 @@ void CLRemapKernel::configure(const ICLTensor *input, const ICLTensor *map_x, co
 
     ICLKernel::configure(win);
 
-    // Set static arguments
-    unsigned int idx = 4 * num_arguments_per_2D_tensor(); //Skip the input and output parameters
+    // Set static arguments: the image replaces the input parameters
+    unsigned int idx = use_image ? 0 : num_arguments_per_2D_tensor();
+    if(use_image)
+    {
+        _kernel.setArg(idx++, _copy_to_image.image());
+    }
+    idx += 3 * num_arguments_per_2D_tensor(); //Skip the output and maps parameters
     _kernel.setArg<cl_float>(idx++, input->info()->dimension(0));
     _kernel.setArg<cl_float>(idx++, input->info()->dimension(1));
 }
@@ -93,12 +107,25 @@ void CLRemapKernel::run(const Window &window, cl::CommandQueue &queue)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
 
+    // Refresh the image: any output pixel can read any input pixel
+    if(_use_image)
+    {
+        _copy_to_image.run(_copy_to_image.window(), queue);
+    }
+
     Window slice = window.first_slice_window_2D();
 
     do
     {
         unsigned int idx = 0;
-        add_2D_tensor_argument(idx, _input, slice);
+        if(_use_image)
+        {
+            ++idx; // Skip the image
+        }
+        else
+        {
+            add_2D_tensor_argument(idx, _input, slice);
+        }
         add_2D_tensor_argument(idx, _output, slice);
         add_2D_tensor_argument(idx, _map_x, slice);
         add_2D_tensor_argument(idx, _map_y, slice);
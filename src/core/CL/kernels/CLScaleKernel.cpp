@@ -33,21 +33,38 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
 
 #include <set>
 #include <string>
 
 using namespace arm_compute;
 
+CLScaleKernel::CLScaleKernel()
+    : _copy_to_image(), _use_image(false)
+{
+}
+
 BorderSize CLScaleKernel::border_size() const
 {
     return BorderSize(1);
 }
 
-void CLScaleKernel::configure(const ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, bool border_undefined)
+void CLScaleKernel::configure(const ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, bool border_undefined, bool use_image)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    const size_t num_channels = input->info()->num_channels();
+
+    if(num_channels != 1)
+    {
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::RGB888, Format::RGBA8888);
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(output, input->info()->format());
+        ARM_COMPUTE_ERROR_ON(use_image);
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    }
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
     _input  = input;
@@ -66,34 +83,87 @@ void CLScaleKernel::configure(const ICLTensor *input, ICLTensor *output, Interpo
     {
         ARM_COMPUTE_ERROR_ON(policy == InterpolationPolicy::AREA);
     }
+    ARM_COMPUTE_ERROR_ON(use_image && policy != InterpolationPolicy::BILINEAR);
+
+    _use_image = use_image;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 4;
+    const int              border_offset                     = (border_undefined) ? 0 : border_size().left;
 
     // Create kernel
     std::set<std::string> build_opts         = { ("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())) };
     std::string           interpolation_name = string_from_interpolation_policy(policy);
     std::transform(interpolation_name.begin(), interpolation_name.end(), interpolation_name.begin(), ::tolower);
     std::string kernel_name = "scale_" + interpolation_name;
-    _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
-
-    // Configure kernel window
-    constexpr unsigned int num_elems_processed_per_iteration = 4;
-    const int              border_offset                     = (border_undefined) ? 0 : border_size().left;
+    if(num_channels != 1)
+    {
+        // All the channels of a pixel are interpolated at once
+        build_opts.emplace(("-DNUM_CHANNELS=" + val_to_string(num_channels)));
+        kernel_name += "_interleaved";
+    }
+    if(use_image)
+    {
+        // The sampler clamps the reads to the edge of the image, which holds the border of the input only if it is defined
+        _copy_to_image.configure(input, BorderSize(border_offset));
+        build_opts.emplace(("-DIMAGE_BORDER=" + val_to_string(border_offset)));
+        kernel_name += "_image";
+    }
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, build_opts));
 
     Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
 
-    AccessWindowStatic input_access(input->info(), -border_offset, -border_offset,
-                                    input->info()->dimension(0) + border_offset, input->info()->dimension(1) + border_offset);
     AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
 
-    update_window_and_padding(win, input_access, output_access);
+    if(use_image)
+    {
+        update_window_and_padding(win, output_access);
+    }
+    else
+    {
+        AccessWindowStatic input_access(input->info(), -border_offset, -border_offset,
+                                        input->info()->dimension(0) + border_offset, input->info()->dimension(1) + border_offset);
+        update_window_and_padding(win, input_access, output_access);
+    }
 
     output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
 
     ICLKernel::configure(win);
 
-    // Set static kernel arguments
-    unsigned int idx = 2 * num_arguments_per_2D_tensor(); //Skip the input and output parameters
+    // Set static kernel arguments: the image replaces the input parameters
+    unsigned int idx = use_image ? 0 : num_arguments_per_2D_tensor();
+    if(use_image)
+    {
+        _kernel.setArg(idx++, _copy_to_image.image());
+    }
+    idx += num_arguments_per_2D_tensor(); //Skip the output parameters
     _kernel.setArg<float>(idx++, input->info()->dimension(0));
     _kernel.setArg<float>(idx++, input->info()->dimension(1));
     _kernel.setArg<float>(idx++, output->info()->dimension(0));
     _kernel.setArg<float>(idx++, output->info()->dimension(1));
 }
+
+void CLScaleKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    if(!_use_image)
+    {
+        ICLSimple2DKernel::run(window, queue);
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    // Refresh the image: any output pixel can read any input pixel
+    _copy_to_image.run(_copy_to_image.window(), queue);
+
+    Window slice = window.first_slice_window_2D();
+
+    do
+    {
+        unsigned int idx = 1; // Skip the image
+        add_2D_tensor_argument(idx, _output, slice);
+        enqueue(queue, *this, slice, _lws_hint);
+    }
+    while(window.slide_window_slice_2D(slice));
+}
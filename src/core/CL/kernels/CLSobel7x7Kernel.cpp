@@ -230,7 +230,7 @@ void CLSobel7x7VertKernel::run(const Window &window, cl::CommandQueue &queue)
             add_2D_tensor_argument(idx, _output_y, slice);
         }
 
-        _kernel.setArg(idx++, 0 /*dummy*/);
+        add_argument(idx, 0 /*dummy*/);
 
         enqueue(queue, *this, slice);
     }
@@ -39,6 +39,12 @@
 
 using namespace arm_compute;
 
+namespace
+{
+/** Maximum number of work items of the work-group reducing a row in the fused kernel */
+constexpr unsigned int max_fused_lws = 128;
+} // namespace
+
 void CLLogits1DMaxKernel::configure(const ICLTensor *input, ICLTensor *output)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
@@ -199,3 +205,73 @@ void CLLogits1DNormKernel::run(const Window &window, cl::CommandQueue &queue)
     }
     while(window.slide_window_slice_2D(slice));
 }
+
+CLLogits1DFusedKernel::CLLogits1DFusedKernel()
+    : _input(nullptr), _output(nullptr), _lws(1)
+{
+}
+
+void CLLogits1DFusedKernel::configure(const ICLTensor *input, ICLTensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input  = input;
+    _output = output;
+
+    // The tree reductions need a power of two work-group: do not use more work items than elements in a row
+    const unsigned int width = input->info()->dimension(0);
+    _lws                     = 1;
+    while(_lws < max_fused_lws && _lws < width)
+    {
+        _lws <<= 1;
+    }
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DUSE_" + string_from_data_type(input->info()->data_type())));
+    build_opts.emplace(("-DLWS=" + val_to_string(_lws)));
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("softmax_layer_fused", build_opts));
+
+    // Set fixed arguments
+    unsigned int idx = 2 * num_arguments_per_2D_tensor(); //Skip the input and output parameters
+    _kernel.setArg<cl_uint>(idx++, width);
+
+    // Configure kernel window: the work items of a work-group walk a whole row
+    Window win = calculate_max_window(*input->info(), Steps(width));
+
+    AccessWindowHorizontal input_access(input->info(), 0, width);
+    AccessWindowHorizontal output_access(output->info(), 0, width);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region());
+
+    ICLKernel::configure(win);
+}
+
+void CLLogits1DFusedKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    Window slice = window.first_slice_window_2D();
+
+    do
+    {
+        // One work-group of _lws work items per row
+        Window slice_rows(slice);
+        slice_rows.set(Window::DimX, Window::Dimension(0, _lws, 1));
+
+        unsigned int idx = 0;
+        // Set inputs
+        add_2D_tensor_argument(idx, _input, slice_rows);
+        add_2D_tensor_argument(idx, _output, slice_rows);
+        enqueue(queue, *this, slice_rows, cl::NDRange(_lws, 1));
+    }
+    while(window.slide_window_slice_2D(slice));
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLTopKVKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+CLTopKVKernel::CLTopKVKernel()
+    : _input(nullptr), _indices(nullptr), _scores(nullptr)
+{
+}
+
+void CLTopKVKernel::configure(const ICLTensor *input, ICLTensor *indices, ICLTensor *scores, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, scores);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(indices, scores);
+    ARM_COMPUTE_ERROR_ON(k == 0 || k > input->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(indices->info()->dimension(0) != k);
+    for(size_t d = 1; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_ERROR_ON(indices->info()->dimension(d) != input->info()->dimension(d));
+    }
+
+    _input   = input;
+    _indices = indices;
+    _scores  = scores;
+
+    // Set build options
+    std::set<std::string> build_opts;
+    build_opts.emplace("-DK=" + val_to_string(k));
+
+    // Create kernel
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("topkv", build_opts));
+
+    // Set fixed arguments
+    unsigned int idx = 3 * num_arguments_per_2D_tensor(); //Skip the input and output parameters
+    _kernel.setArg<cl_uint>(idx++, input->info()->valid_region().shape.x());
+
+    // Configure kernel window: each work item processes a whole row and reads it element by element so no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    indices->info()->set_valid_region(ValidRegion(Coordinates(), indices->info()->tensor_shape()));
+    scores->info()->set_valid_region(ValidRegion(Coordinates(), scores->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLTopKVKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    Window slice = window.first_slice_window_2D();
+
+    do
+    {
+        unsigned int idx = 0;
+        add_2D_tensor_argument(idx, _input, slice);
+        add_2D_tensor_argument(idx, _indices, slice);
+        add_2D_tensor_argument(idx, _scores, slice);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_2D(slice));
+}
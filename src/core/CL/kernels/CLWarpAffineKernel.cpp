@@ -32,6 +32,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
 
 #include <cstddef>
 #include <set>
@@ -53,19 +54,26 @@ void options_add_matrix(std::set<std::string> &options, const float *matrix, siz
 }
 } // namespace
 
+CLWarpAffineKernel::CLWarpAffineKernel()
+    : _copy_to_image(), _use_image(false)
+{
+}
+
 BorderSize CLWarpAffineKernel::border_size() const
 {
     return BorderSize(1);
 }
 
-void CLWarpAffineKernel::configure(const ICLTensor *input, ICLTensor *output, const float *matrix, InterpolationPolicy policy)
+void CLWarpAffineKernel::configure(const ICLTensor *input, ICLTensor *output, const float *matrix, InterpolationPolicy policy, bool use_image)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(InterpolationPolicy::AREA == policy);
+    ARM_COMPUTE_ERROR_ON(use_image && policy != InterpolationPolicy::BILINEAR);
 
-    _input  = input;
-    _output = output;
+    _input     = input;
+    _output    = output;
+    _use_image = use_image;
 
     // Create build options
     std::set<std::string> options;
@@ -76,10 +84,21 @@ void CLWarpAffineKernel::configure(const ICLTensor *input, ICLTensor *output, co
     std::string interpolation_name = string_from_interpolation_policy(policy);
     std::transform(interpolation_name.begin(), interpolation_name.end(), interpolation_name.begin(), ::tolower);
     std::string kernel_name = "warp_affine_" + interpolation_name;
-    _kernel                 = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, options));
+    if(use_image)
+    {
+        _copy_to_image.configure(input, border_size());
+        options.emplace(("-DIMAGE_BORDER=" + val_to_string(border_size().left)));
+        kernel_name += "_image";
+    }
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel(kernel_name, options));
 
-    // Set static kernel arguments
-    unsigned int idx = 2 * num_arguments_per_2D_tensor(); //Skip the input and output parameters
+    // Set static kernel arguments: the image replaces the input parameters
+    unsigned int idx = use_image ? 0 : num_arguments_per_2D_tensor();
+    if(use_image)
+    {
+        _kernel.setArg(idx++, _copy_to_image.image());
+    }
+    idx += num_arguments_per_2D_tensor(); //Skip the output parameters
     _kernel.setArg<cl_int>(idx++, input->info()->dimension(0));
     _kernel.setArg<cl_int>(idx++, input->info()->dimension(1));
 
@@ -88,12 +107,44 @@ void CLWarpAffineKernel::configure(const ICLTensor *input, ICLTensor *output, co
 
     Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
 
-    AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
-    AccessWindowStatic     output_access(output->info(), 0, 0, output->info()->dimension(0), output->info()->dimension(1));
+    AccessWindowStatic output_access(output->info(), 0, 0, output->info()->dimension(0), output->info()->dimension(1));
 
-    update_window_and_padding(win, input_access, output_access);
+    if(use_image)
+    {
+        update_window_and_padding(win, output_access);
+    }
+    else
+    {
+        AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+        update_window_and_padding(win, input_access, output_access);
+    }
 
     output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
 
     ICLKernel::configure(win);
 }
+
+void CLWarpAffineKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    if(!_use_image)
+    {
+        ICLSimple2DKernel::run(window, queue);
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(ICLKernel::window(), window);
+
+    // Refresh the image: any output pixel can read any input pixel
+    _copy_to_image.run(_copy_to_image.window(), queue);
+
+    Window slice = window.first_slice_window_2D();
+
+    do
+    {
+        unsigned int idx = 1; // Skip the image
+        add_2D_tensor_argument(idx, _output, slice);
+        enqueue(queue, *this, slice, _lws_hint);
+    }
+    while(window.slide_window_slice_2D(slice));
+}
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLWinogradInputTransformKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+#include <tuple>
+
+using namespace arm_compute;
+
+CLWinogradInputTransformKernel::CLWinogradInputTransformKernel()
+    : _input(nullptr), _output(nullptr), _num_tiles_per_batch(0)
+{
+}
+
+void CLWinogradInputTransformKernel::configure(const ICLTensor *input, ICLTensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(conv_info.stride().first != 1 || conv_info.stride().second != 1);
+    ARM_COMPUTE_ERROR_ON(conv_info.pad().first > 2 || conv_info.pad().second > 2);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), 3,
+                                                 1, 1, conv_info.pad().first, conv_info.pad().second, conv_info.round());
+
+    const unsigned int num_tiles_x = (conv_w + 1) / 2;
+    const unsigned int num_tiles_y = (conv_h + 1) / 2;
+    const unsigned int num_batches = input->info()->dimension(3);
+
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != num_tiles_x * num_tiles_y * num_batches);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _input               = input;
+    _output              = output;
+    _num_tiles_per_batch = num_tiles_x * num_tiles_y;
+
+    // Create kernel
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_input_transform_2x2_3x3", build_opts));
+
+    // Set static kernel arguments
+    const cl_int2 input_dims =
+    {
+        {
+            static_cast<cl_int>(input->info()->dimension(0)),
+            static_cast<cl_int>(input->info()->dimension(1)),
+        }
+    };
+    const cl_int2 paddings =
+    {
+        {
+            static_cast<cl_int>(conv_info.pad().first),
+            static_cast<cl_int>(conv_info.pad().second),
+        }
+    };
+
+    unsigned int idx = 2 * num_arguments_per_3D_tensor();
+    _kernel.setArg<cl_int2>(idx++, input_dims);
+    _kernel.setArg<cl_int2>(idx++, paddings);
+    _kernel.setArg<cl_int>(idx++, num_tiles_x);
+
+    // Configure kernel window: each work item transforms one tile of one input feature map
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, input->info()->dimension(2), 1));
+    win.set(3, Window::Dimension(0, num_batches, 1));
+
+    // The kernel only reads the valid region of the input so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradInputTransformKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(ICLKernel::window(), window);
+
+    Window slice = window.first_slice_window_3D();
+
+    // The kernel computes the addresses of the tile it reads in the batch and of the 16 values it writes
+    Window slice_in = slice;
+    slice_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    Window slice_out;
+    slice_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    do
+    {
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input, slice_in);
+        add_3D_tensor_argument(idx, _output, slice_out);
+
+        // The tiles are numbered across all the batches
+        idx += 3;
+        add_argument<cl_int>(idx, slice[3].start() * _num_tiles_per_batch);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice) && window.slide_window_slice_3D(slice_in));
+}
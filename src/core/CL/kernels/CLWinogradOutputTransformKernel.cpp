@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CL/kernels/CLWinogradOutputTransformKernel.h"
+
+#include "arm_compute/core/CL/CLHelpers.h"
+#include "arm_compute/core/CL/CLKernelLibrary.h"
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/OpenCL.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <set>
+#include <string>
+
+using namespace arm_compute;
+
+CLWinogradOutputTransformKernel::CLWinogradOutputTransformKernel()
+    : _input(nullptr), _biases(nullptr), _output(nullptr), _num_tiles_per_batch(0)
+{
+}
+
+void CLWinogradOutputTransformKernel::configure(const ICLTensor *input, const ICLTensor *biases, ICLTensor *output, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(2));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    const unsigned int num_tiles_x = (output->info()->dimension(0) + 1) / 2;
+    const unsigned int num_tiles_y = (output->info()->dimension(1) + 1) / 2;
+    const unsigned int num_batches = output->info()->dimension(3);
+
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != num_tiles_x * num_tiles_y * num_batches);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(2) != 16);
+
+    _input               = input;
+    _biases              = biases;
+    _output              = output;
+    _num_tiles_per_batch = num_tiles_x * num_tiles_y;
+
+    // Create kernel
+    std::set<std::string> build_opts;
+    build_opts.emplace(("-DDATA_TYPE=" + get_cl_type_from_data_type(input->info()->data_type())));
+    if(biases != nullptr)
+    {
+        build_opts.emplace("-DHAS_BIAS");
+    }
+    if(act_info.enabled())
+    {
+        build_opts.emplace("-DFUSED_ACTIVATION=" + string_from_activation_func(act_info.activation()));
+        build_opts.emplace("-DACT_A=" + val_to_string(act_info.a()));
+        build_opts.emplace("-DACT_B=" + val_to_string(act_info.b()));
+    }
+    _kernel = static_cast<cl::Kernel>(CLKernelLibrary::get().create_kernel("winograd_output_transform_2x2_3x3", build_opts));
+
+    // Set static kernel arguments
+    const cl_int2 output_dims =
+    {
+        {
+            static_cast<cl_int>(output->info()->dimension(0)),
+            static_cast<cl_int>(output->info()->dimension(1)),
+        }
+    };
+
+    unsigned int idx = 2 * num_arguments_per_3D_tensor() + ((biases != nullptr) ? num_arguments_per_1D_tensor() : 0);
+    _kernel.setArg<cl_int2>(idx++, output_dims);
+    _kernel.setArg<cl_int>(idx++, num_tiles_x);
+
+    // Configure kernel window: each work item computes one tile of one output feature map
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), 1));
+    win.set(3, Window::Dimension(0, num_batches, 1));
+
+    // The kernel only writes the valid region of the output so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    ICLKernel::configure(win);
+}
+
+void CLWinogradOutputTransformKernel::run(const Window &window, cl::CommandQueue &queue)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(ICLKernel::window(), window);
+
+    Window slice = window.first_slice_window_3D();
+
+    // The kernel computes the addresses of the 16 values it reads and of the tile it writes in the batch
+    Window slice_in;
+    slice_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    Window slice_out = slice;
+    slice_out.set(Window::DimX, Window::Dimension(0, 0, 0));
+    slice_out.set(Window::DimY, Window::Dimension(0, 0, 0));
+    slice_out.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    if(_biases != nullptr)
+    {
+        unsigned int idx = 2 * num_arguments_per_3D_tensor();
+
+        Window slice_biases;
+        slice_biases.set(Window::DimX, Window::Dimension(0, 0, 0));
+        add_1D_tensor_argument(idx, _biases, slice_biases);
+    }
+
+    do
+    {
+        unsigned int idx = 0;
+        add_3D_tensor_argument(idx, _input, slice_in);
+        add_3D_tensor_argument(idx, _output, slice_out);
+
+        // The tiles are numbered across all the batches
+        idx += ((_biases != nullptr) ? num_arguments_per_1D_tensor() : 0) + 2;
+        add_argument<cl_int>(idx, slice[3].start() * _num_tiles_per_batch);
+        enqueue(queue, *this, slice);
+    }
+    while(window.slide_window_slice_3D(slice) && window.slide_window_slice_3D(slice_out));
+}
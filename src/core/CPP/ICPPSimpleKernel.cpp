@@ -51,3 +51,12 @@ void ICPPSimpleKernel::configure(const ITensor *input, ITensor *output, unsigned
 
     ICPPKernel::configure(win);
 }
+
+KernelCost ICPPSimpleKernel::cost(const Window &window) const
+{
+    // Each element of the input is read and one element of the output written per element of the window, at least one operation between both
+    const size_t num_elements  = num_window_elements(window);
+    const size_t element_sizes = ((_input != nullptr) ? _input->info()->element_size() : 0) + ((_output != nullptr) ? _output->info()->element_size() : 0);
+
+    return KernelCost{ num_elements * element_sizes, num_elements };
+}
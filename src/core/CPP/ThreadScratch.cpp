@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/ThreadScratch.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Scratch buffer owned by a thread */
+struct ScratchBuffer
+{
+    /** Default constructor: the buffer is empty */
+    ScratchBuffer()
+        : memory(), size(0)
+    {
+    }
+
+    std::unique_ptr<uint8_t[]> memory; /**< Memory of the buffer, allocated with new[] which aligns it for any fundamental type */
+    size_t                     size;   /**< Size of the buffer in bytes */
+};
+} // namespace
+
+void *arm_compute::thread_scratch(size_t size, unsigned int slot)
+{
+    ARM_COMPUTE_ERROR_ON(slot >= num_thread_scratch_slots);
+
+    static thread_local ScratchBuffer buffers[num_thread_scratch_slots];
+
+    ScratchBuffer &buffer = buffers[slot];
+    if(buffer.size < size)
+    {
+        // Grow geometrically so that slowly growing requests don't reallocate every time
+        const size_t new_size = std::max(size, 2 * buffer.size);
+
+        buffer.memory.reset(new uint8_t[new_size]);
+        buffer.size = new_size;
+    }
+
+    return buffer.memory.get();
+}
@@ -0,0 +1,275 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPP/kernels/CPPCornerGridSuppressionKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <cmath>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Decisions taken for a candidate */
+constexpr uint8_t undecided  = 0;
+constexpr uint8_t kept       = 1;
+constexpr uint8_t suppressed = 2;
+
+/** Total order of the candidates: decreasing strength, then increasing y and x */
+inline bool precedes(const InternalKeypoint &lhs, const InternalKeypoint &rhs)
+{
+    if(std::get<2>(lhs) != std::get<2>(rhs))
+    {
+        return std::get<2>(lhs) > std::get<2>(rhs);
+    }
+
+    if(std::get<1>(lhs) != std::get<1>(rhs))
+    {
+        return std::get<1>(lhs) < std::get<1>(rhs);
+    }
+
+    return std::get<0>(lhs) < std::get<0>(rhs);
+}
+} // namespace
+
+CPPCornerGridSuppressionKernel::CPPCornerGridSuppressionKernel()
+    : _input(nullptr), _output(nullptr), _min_distance(0.0f), _cell_size(1), _grid_width(0), _grid_height(0), _candidates(), _offsets(), _states(), _num_states(0)
+{
+}
+
+void CPPCornerGridSuppressionKernel::configure(const std::vector<InternalKeypoint> *input, IKeyPointArray *output, float min_distance, size_t width, size_t height)
+{
+    ARM_COMPUTE_ERROR_ON(nullptr == input);
+    ARM_COMPUTE_ERROR_ON(nullptr == output);
+    ARM_COMPUTE_ERROR_ON(!((min_distance > 0) && (min_distance <= 30)));
+    ARM_COMPUTE_ERROR_ON(width == 0 || height == 0);
+
+    _input        = input;
+    _output       = output;
+    _min_distance = min_distance * min_distance; // We compare squares of distances
+
+    // Two candidates closer than min_distance are at most one cell apart
+    _cell_size   = static_cast<int32_t>(std::ceil(min_distance));
+    _grid_width  = ceil_to_multiple(width, _cell_size) / _cell_size;
+    _grid_height = ceil_to_multiple(height, _cell_size) / _cell_size;
+
+    _offsets.resize(_grid_width * _grid_height + 1);
+
+    // One iteration per row of cells
+    Window win;
+    win.set(Window::DimY, Window::Dimension(0, _grid_height, 1));
+
+    INEKernel::configure(win);
+}
+
+SchedulingPolicy CPPCornerGridSuppressionKernel::scheduling_policy() const
+{
+    // The candidates are usually unevenly spread over the image
+    return SchedulingPolicy::DYNAMIC;
+}
+
+size_t CPPCornerGridSuppressionKernel::cell_index(const InternalKeypoint &candidate) const
+{
+    const size_t cell_x = static_cast<size_t>(std::get<0>(candidate)) / _cell_size;
+    const size_t cell_y = static_cast<size_t>(std::get<1>(candidate)) / _cell_size;
+
+    ARM_COMPUTE_ERROR_ON(cell_x >= _grid_width || cell_y >= _grid_height);
+
+    return cell_y * _grid_width + cell_x;
+}
+
+void CPPCornerGridSuppressionKernel::begin_reduction(unsigned int num_threads)
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+
+    const size_t num_candidates = _input->size();
+
+    // Group the candidates by grid cell with a counting sort
+    std::fill(_offsets.begin(), _offsets.end(), 0);
+
+    for(const auto &candidate : *_input)
+    {
+        ++_offsets[cell_index(candidate) + 1];
+    }
+
+    for(size_t c = 1; c < _offsets.size(); ++c)
+    {
+        _offsets[c] += _offsets[c - 1];
+    }
+
+    std::vector<size_t> next(_offsets.begin(), _offsets.end() - 1);
+
+    _candidates.resize(num_candidates);
+
+    for(const auto &candidate : *_input)
+    {
+        _candidates[next[cell_index(candidate)]++] = candidate;
+    }
+
+    if(_num_states < num_candidates)
+    {
+        _states     = arm_compute::cpp14::make_unique<std::atomic<uint8_t>[]>(num_candidates);
+        _num_states = num_candidates;
+    }
+
+    for(size_t i = 0; i < num_candidates; ++i)
+    {
+        _states[i].store(undecided);
+    }
+}
+
+void CPPCornerGridSuppressionKernel::end_reduction()
+{
+    std::vector<InternalKeypoint> corners;
+
+    for(size_t i = 0; i < _candidates.size(); ++i)
+    {
+        if(_states[i].load() == kept)
+        {
+            corners.push_back(_candidates[i]);
+        }
+    }
+
+    std::sort(corners.begin(), corners.end(), precedes);
+
+    for(const auto &corner : corners)
+    {
+        KeyPoint keypt;
+
+        keypt.x               = std::get<0>(corner);
+        keypt.y               = std::get<1>(corner);
+        keypt.strength        = std::get<2>(corner);
+        keypt.tracking_status = 1;
+
+        /* Store corner */
+        _output->push_back(keypt);
+    }
+}
+
+void CPPCornerGridSuppressionKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    std::vector<size_t> stack;
+
+    for(int cell_y = window.y().start(); cell_y < window.y().end(); cell_y += window.y().step())
+    {
+        for(size_t i = _offsets[cell_y * _grid_width]; i < _offsets[(cell_y + 1) * _grid_width]; ++i)
+        {
+            resolve(i, stack);
+        }
+    }
+}
+
+void CPPCornerGridSuppressionKernel::resolve(size_t index, std::vector<size_t> &stack)
+{
+    // The decision of a candidate is a deterministic function of the stronger candidates, so threads deciding the same candidate
+    // concurrently store the same value. Each candidate pushed on the stack precedes the one below it, hence the stack is bounded.
+    stack.clear();
+    stack.push_back(index);
+
+    while(!stack.empty())
+    {
+        const size_t current = stack.back();
+
+        if(_states[current].load() != undecided)
+        {
+            stack.pop_back();
+            continue;
+        }
+
+        const InternalKeypoint &candidate = _candidates[current];
+        const float             xc        = std::get<0>(candidate);
+        const float             yc        = std::get<1>(candidate);
+        const int32_t           cell_x    = static_cast<int32_t>(xc) / _cell_size;
+        const int32_t           cell_y    = static_cast<int32_t>(yc) / _cell_size;
+
+        bool   is_suppressed = false;
+        bool   is_pending    = false;
+        size_t pending       = 0;
+
+        // The stronger candidates closer than min_distance can only be in the neighbouring cells
+        for(int32_t ny = std::max(cell_y - 1, 0); ny <= std::min<int32_t>(cell_y + 1, _grid_height - 1) && !is_suppressed; ++ny)
+        {
+            for(int32_t nx = std::max(cell_x - 1, 0); nx <= std::min<int32_t>(cell_x + 1, _grid_width - 1) && !is_suppressed; ++nx)
+            {
+                const size_t cell = ny * _grid_width + nx;
+
+                for(size_t k = _offsets[cell]; k < _offsets[cell + 1]; ++k)
+                {
+                    const InternalKeypoint &neighbour = _candidates[k];
+
+                    if(!precedes(neighbour, candidate))
+                    {
+                        continue;
+                    }
+
+                    const float dx = std::fabs(std::get<0>(neighbour) - xc);
+                    const float dy = std::fabs(std::get<1>(neighbour) - yc);
+
+                    if((dx * dx + dy * dy) >= _min_distance)
+                    {
+                        continue;
+                    }
+
+                    const uint8_t state = _states[k].load();
+
+                    if(state == kept)
+                    {
+                        is_suppressed = true;
+                        break;
+                    }
+
+                    if(state == undecided)
+                    {
+                        is_pending = true;
+                        pending    = k;
+                    }
+                }
+            }
+        }
+
+        if(is_suppressed)
+        {
+            _states[current].store(suppressed);
+            stack.pop_back();
+        }
+        else if(is_pending)
+        {
+            // Decide the stronger neighbour first
+            stack.push_back(pending);
+        }
+        else
+        {
+            _states[current].store(kept);
+            stack.pop_back();
+        }
+    }
+}
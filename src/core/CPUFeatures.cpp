@@ -0,0 +1,65 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/CPUFeatures.h"
+
+#if defined(__aarch64__) && defined(__linux__)
+#include <sys/auxv.h>
+#endif
+
+using namespace arm_compute;
+
+namespace
+{
+#if defined(__aarch64__) && defined(__linux__)
+// Bits of AT_HWCAP, not defined by the headers of older toolchains
+constexpr unsigned long hwcap_fphp    = 1UL << 9;
+constexpr unsigned long hwcap_asimdhp = 1UL << 10;
+constexpr unsigned long hwcap_asimddp = 1UL << 20;
+#endif
+
+CPUFeatures detect_cpu_features()
+{
+    CPUFeatures features{ false, false };
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    // The whole library uses the instructions: the CPU must support them
+    features.fp16 = true;
+#endif
+
+#if defined(__aarch64__) && defined(__linux__)
+    const unsigned long hwcap = getauxval(AT_HWCAP);
+
+    features.fp16        = features.fp16 || (((hwcap & hwcap_fphp) != 0) && ((hwcap & hwcap_asimdhp) != 0));
+    features.dot_product = (hwcap & hwcap_asimddp) != 0;
+#endif
+
+    return features;
+}
+} // namespace
+
+const CPUFeatures &arm_compute::cpu_features()
+{
+    static const CPUFeatures features = detect_cpu_features();
+    return features;
+}
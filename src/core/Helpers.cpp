@@ -124,3 +124,49 @@ Window arm_compute::calculate_max_window_horizontal(const TensorInfo &info, cons
 
     return window;
 }
+
+Window arm_compute::collapse_window(const Window &window, const TensorInfo *const *infos, size_t num_infos)
+{
+    ARM_COMPUTE_ERROR_ON(infos == nullptr || num_infos == 0);
+
+    const TensorShape &shape = infos[0]->tensor_shape();
+    const int          step  = window.x().step();
+
+    if(window.x().start() != 0 || window.x().end() != static_cast<int>(shape[0]) || shape[0] % step != 0)
+    {
+        return window;
+    }
+
+    Window collapsed(window);
+    int    extent = shape[0];
+
+    for(size_t d = 1; d < shape.num_dimensions(); ++d)
+    {
+        const Window::Dimension &dim = window[d];
+
+        bool is_contiguous = dim.step() == 1;
+
+        for(size_t i = 0; i < num_infos; ++i)
+        {
+            is_contiguous &= infos[i]->tensor_shape()[d - 1] == shape[d - 1] && infos[i]->strides_in_bytes()[d] == infos[i]->strides_in_bytes()[d - 1] * shape[d - 1];
+        }
+
+        if(!is_contiguous)
+        {
+            break;
+        }
+
+        collapsed.set(Window::DimX, Window::Dimension(dim.start() * extent, dim.end() * extent, step));
+        collapsed.set(d, Window::Dimension(0, 1, 1));
+
+        // The next dimension can only be merged if this one is complete
+        if(dim.start() != 0 || dim.end() != static_cast<int>(shape[d]))
+        {
+            break;
+        }
+
+        extent *= shape[d];
+    }
+
+    return collapsed;
+}
@@ -23,15 +23,27 @@
  */
 #include "arm_compute/core/IKernel.h"
 
+#include <atomic>
+
 using namespace arm_compute;
 
+namespace
+{
+/** Returns a new configuration identifier, unique in the process */
+uint64_t next_configuration_id()
+{
+    static std::atomic<uint64_t> num_configurations{ 0 };
+    return num_configurations.fetch_add(1, std::memory_order_relaxed) + 1;
+}
+} // namespace
+
 const Window &IKernel::window() const
 {
     return _window;
 }
 
 IKernel::IKernel()
-    : _window()
+    : _window(), _configuration_id(next_configuration_id())
 {
     // Create an empty window to make sure the children classes set the window values themselves
     _window.set(Window::DimX, Window::Dimension(0, 0, 1));
@@ -50,5 +62,11 @@ BorderSize IKernel::border_size() const
 
 void IKernel::configure(const Window &window)
 {
-    _window = window;
+    _window           = window;
+    _configuration_id = next_configuration_id();
+}
+
+uint64_t IKernel::configuration_id() const
+{
+    return _configuration_id;
 }
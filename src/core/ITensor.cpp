@@ -147,4 +147,14 @@ void ITensor::print(std::ostream &s, IOFormatInfo io_fmt) const
             s << io_fmt.row_delim;
         }
     }
-}
\ No newline at end of file
+}
+
+bool ITensor::is_used() const
+{
+    return _is_used;
+}
+
+void ITensor::mark_as_unused() const
+{
+    _is_used = false;
+}
@@ -23,21 +23,22 @@
  */
 #include "arm_compute/core/NEON/kernels/NEAccumulateKernel.h"
 
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
 
 #include <arm_neon.h>
+#include <cstddef>
 
 using namespace arm_compute;
 
-namespace arm_compute
-{
-class Coordinates;
-} // namespace arm_compute
-
 /* Max S16 value used for saturation purposes. */
 const static uint16x8_t max_int_u16 = vdupq_n_u16(static_cast<uint16_t>(INT16_MAX));
 
@@ -244,6 +245,22 @@ void acc_sq_v16_u8(const void *__restrict input, uint32_t shift, void *__restric
     vst1q_s16(accum_buffer, vreinterpretq_s16_u16(vminq_u16(max_int_u16, ta2)));
     vst1q_s16(accum_buffer + 8, vreinterpretq_s16_u16(vminq_u16(max_int_u16, ta3)));
 }
+
+/** Round the weighted accumulation in the same way as storing it to and loading it from the U8 accumulator */
+inline float32x4x4_t round_accumulate_weighted(const float32x4x4_t &vector_output)
+{
+    const float32x4x4_t res =
+    {
+        {
+            vcvtq_f32_u32(vcvtq_u32_f32(vector_output.val[0])),
+            vcvtq_f32_u32(vcvtq_u32_f32(vector_output.val[1])),
+            vcvtq_f32_u32(vcvtq_u32_f32(vector_output.val[2])),
+            vcvtq_f32_u32(vcvtq_u32_f32(vector_output.val[3]))
+        }
+    };
+
+    return res;
+}
 } // namespace
 
 void NEAccumulateKernel::configure(const ITensor *input, ITensor *accum)
@@ -334,3 +351,176 @@ void NEAccumulateSquaredKernel::run(const Window &window)
     },
     input, accum);
 }
+
+NEAccumulateCombinedKernel::NEAccumulateCombinedKernel()
+    : _inputs(), _accum(nullptr), _accum_weighted(nullptr), _accum_squared(nullptr), _alpha(0.0f), _shift(0)
+{
+}
+
+void NEAccumulateCombinedKernel::configure(const std::vector<const ITensor *> &inputs, ITensor *accum, float alpha, ITensor *accum_weighted, uint32_t shift, ITensor *accum_squared)
+{
+    ARM_COMPUTE_ERROR_ON(inputs.empty());
+    ARM_COMPUTE_ERROR_ON(accum == nullptr && accum_weighted == nullptr && accum_squared == nullptr);
+    ARM_COMPUTE_ERROR_ON(alpha < 0.0 || alpha > 1.0);
+    ARM_COMPUTE_ERROR_ON(shift > 15);
+
+    // All the tensors must have the shape of the first accumulator
+    const ITensor *ref = (accum != nullptr) ? accum : ((accum_weighted != nullptr) ? accum_weighted : accum_squared);
+
+    for(const ITensor *input : inputs)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, ref);
+    }
+
+    if(accum != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(accum, 1, DataType::S16);
+    }
+
+    if(accum_weighted != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(accum_weighted, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(accum_weighted, ref);
+    }
+
+    if(accum_squared != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(accum_squared, 1, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(accum_squared, ref);
+    }
+
+    _inputs         = inputs;
+    _accum          = accum;
+    _accum_weighted = accum_weighted;
+    _accum_squared  = accum_squared;
+    _alpha          = alpha;
+    _shift          = shift;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    Window win = calculate_max_window(*ref->info(), Steps(num_elems_processed_per_iteration));
+
+    for(const ITensor *input : inputs)
+    {
+        AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+        update_window_and_padding(win, input_access);
+    }
+
+    AccessWindowHorizontal accum_access(accum == nullptr ? nullptr : accum->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal accum_weighted_access(accum_weighted == nullptr ? nullptr : accum_weighted->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal accum_squared_access(accum_squared == nullptr ? nullptr : accum_squared->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, accum_access, accum_weighted_access, accum_squared_access);
+
+    const ValidRegion valid_region = inputs[0]->info()->valid_region();
+
+    accum_access.set_valid_region(win, valid_region);
+    accum_weighted_access.set_valid_region(win, valid_region);
+    accum_squared_access.set_valid_region(win, valid_region);
+
+    INEKernel::configure(win);
+}
+
+void NEAccumulateCombinedKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t num_frames = _inputs.size();
+
+    const float32x4_t scale_val    = vdupq_n_f32(1.f - _alpha);
+    const float32x4_t scale_val2   = vdupq_n_f32(_alpha);
+    const int16x8_t   vector_shift = vdupq_n_s16(-static_cast<int16_t>(_shift));
+
+    // Pointers to the current row of each frame
+    const uint8_t **const input_rows = thread_scratch<const uint8_t *>(num_frames);
+
+    // The rows are walked manually so that the accumulators of a block of pixels stay in registers for all the frames
+    Window win_rows(window);
+    win_rows.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(win_rows, [&](const Coordinates & id)
+    {
+        Coordinates row_start(id);
+        row_start.set(Window::DimX, window.x().start());
+
+        for(size_t k = 0; k < num_frames; ++k)
+        {
+            input_rows[k] = _inputs[k]->ptr_to_element(row_start);
+        }
+
+        auto accum_row          = (_accum != nullptr) ? reinterpret_cast<int16_t *>(_accum->ptr_to_element(row_start)) : nullptr;
+        auto accum_weighted_row = (_accum_weighted != nullptr) ? _accum_weighted->ptr_to_element(row_start) : nullptr;
+        auto accum_squared_row  = (_accum_squared != nullptr) ? reinterpret_cast<int16_t *>(_accum_squared->ptr_to_element(row_start)) : nullptr;
+
+        for(int x = 0; x < window.x().end() - window.x().start(); x += window.x().step())
+        {
+            int16x8x2_t   sum      = { { vdupq_n_s16(0), vdupq_n_s16(0) } };
+            float32x4x4_t weighted = { { vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f), vdupq_n_f32(0.f) } };
+            uint16x8x2_t  squared  = { { vdupq_n_u16(0), vdupq_n_u16(0) } };
+
+            if(accum_row != nullptr)
+            {
+                sum.val[0] = vld1q_s16(accum_row + x);
+                sum.val[1] = vld1q_s16(accum_row + x + 8);
+            }
+
+            if(accum_weighted_row != nullptr)
+            {
+                weighted = convert_u8x16_to_f32x4x4(vld1q_u8(accum_weighted_row + x));
+            }
+
+            if(accum_squared_row != nullptr)
+            {
+                squared.val[0] = vreinterpretq_u16_s16(vld1q_s16(accum_squared_row + x));
+                squared.val[1] = vreinterpretq_u16_s16(vld1q_s16(accum_squared_row + x + 8));
+            }
+
+            for(size_t k = 0; k < num_frames; ++k)
+            {
+                const uint8x16_t input  = vld1q_u8(input_rows[k] + x);
+                uint16x8_t       linput = vmovl_u8(vget_low_u8(input));
+                uint16x8_t       hinput = vmovl_u8(vget_high_u8(input));
+
+                if(accum_row != nullptr)
+                {
+                    sum.val[0] = vqaddq_s16(sum.val[0], vreinterpretq_s16_u16(linput));
+                    sum.val[1] = vqaddq_s16(sum.val[1], vreinterpretq_s16_u16(hinput));
+                }
+
+                if(accum_weighted_row != nullptr)
+                {
+                    weighted = round_accumulate_weighted(vector_accumulate_weighted(convert_u8x16_to_f32x4x4(input), weighted, scale_val, scale_val2));
+                }
+
+                if(accum_squared_row != nullptr)
+                {
+                    linput = vqshlq_u16(vmulq_u16(linput, linput), vector_shift);
+                    hinput = vqshlq_u16(vmulq_u16(hinput, hinput), vector_shift);
+
+                    squared.val[0] = vminq_u16(max_int_u16, vqaddq_u16(squared.val[0], linput));
+                    squared.val[1] = vminq_u16(max_int_u16, vqaddq_u16(squared.val[1], hinput));
+                }
+            }
+
+            if(accum_row != nullptr)
+            {
+                vst1q_s16(accum_row + x, sum.val[0]);
+                vst1q_s16(accum_row + x + 8, sum.val[1]);
+            }
+
+            if(accum_weighted_row != nullptr)
+            {
+                vst1q_u8(accum_weighted_row + x, convert_f32x4x4_to_u8x16(weighted));
+            }
+
+            if(accum_squared_row != nullptr)
+            {
+                vst1q_s16(accum_squared_row + x, vreinterpretq_s16_u16(squared.val[0]));
+                vst1q_s16(accum_squared_row + x + 8, vreinterpretq_s16_u16(squared.val[1]));
+            }
+        }
+    });
+}
@@ -25,7 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
-#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -34,176 +34,225 @@
 #include <arm_neon.h>
 #include <array>
 #include <map>
+#include <tuple>
 
 using namespace arm_compute;
 
 NEActivationLayerKernel::NEActivationLayerKernel()
-    : _func(nullptr), _act_info(ActivationFunction::LOGISTIC)
+    : _input(nullptr), _output(nullptr), _func(nullptr), _act_info(ActivationFunction::LOGISTIC), _min_bound(0), _max_bound(255)
 {
 }
 
-void NEActivationLayerKernel::configure(const ITensor *input, ITensor *output, ActivationLayerInfo activation_info)
+void NEActivationLayerKernel::configure(ITensor *input, ITensor *output, ActivationLayerInfo activation_info)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+
+    _input  = input;
+    _output = input;
+
+    if(output != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+        ARM_COMPUTE_ERROR_ON(input->info()->quantization_info().scale != output->info()->quantization_info().scale);
+        ARM_COMPUTE_ERROR_ON(input->info()->quantization_info().offset != output->info()->quantization_info().offset);
+        ARM_COMPUTE_ERROR_ON(input->info()->data_layout() != output->info()->data_layout());
+
+        _output = output;
+    }
 
     static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map =
     {
-        { ActivationFunction::ABS, &NEActivationLayerKernel::activation<ActivationFunction::ABS> },
-        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation<ActivationFunction::LINEAR> },
-        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC> },
-        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU> },
-        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU> },
-        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU> },
-        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation<ActivationFunction::SQRT> },
-        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE> },
-        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH> },
+        { ActivationFunction::ABS, &NEActivationLayerKernel::activation<ActivationFunction::ABS, MathPrecision::ACCURATE> },
+        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, MathPrecision::ACCURATE> },
+        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, MathPrecision::ACCURATE> },
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation<ActivationFunction::SQRT, MathPrecision::ACCURATE> },
+        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, MathPrecision::ACCURATE> },
+        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, MathPrecision::ACCURATE> },
     };
-    _input    = input;
-    _output   = output;
-    _func     = act_map[activation_info.activation()];
+    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_fast =
+    {
+        { ActivationFunction::ABS, &NEActivationLayerKernel::activation<ActivationFunction::ABS, MathPrecision::FAST> },
+        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation<ActivationFunction::LINEAR, MathPrecision::FAST> },
+        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation<ActivationFunction::LOGISTIC, MathPrecision::FAST> },
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation<ActivationFunction::RELU, MathPrecision::FAST> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation<ActivationFunction::BOUNDED_RELU, MathPrecision::FAST> },
+        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation<ActivationFunction::SOFT_RELU, MathPrecision::FAST> },
+        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation<ActivationFunction::SQRT, MathPrecision::FAST> },
+        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation<ActivationFunction::SQUARE, MathPrecision::FAST> },
+        { ActivationFunction::TANH, &NEActivationLayerKernel::activation<ActivationFunction::TANH, MathPrecision::FAST> },
+    };
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_f16 =
+    {
+        { ActivationFunction::ABS, &NEActivationLayerKernel::activation_f16<ActivationFunction::ABS, MathPrecision::ACCURATE> },
+        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation_f16<ActivationFunction::LINEAR, MathPrecision::ACCURATE> },
+        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation_f16<ActivationFunction::LOGISTIC, MathPrecision::ACCURATE> },
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::BOUNDED_RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::SOFT_RELU, MathPrecision::ACCURATE> },
+        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation_f16<ActivationFunction::SQRT, MathPrecision::ACCURATE> },
+        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation_f16<ActivationFunction::SQUARE, MathPrecision::ACCURATE> },
+        { ActivationFunction::TANH, &NEActivationLayerKernel::activation_f16<ActivationFunction::TANH, MathPrecision::ACCURATE> },
+    };
+    static std::map<ActivationFunction, ActivationFunctionExecutorPtr> act_map_f16_fast =
+    {
+        { ActivationFunction::ABS, &NEActivationLayerKernel::activation_f16<ActivationFunction::ABS, MathPrecision::FAST> },
+        { ActivationFunction::LINEAR, &NEActivationLayerKernel::activation_f16<ActivationFunction::LINEAR, MathPrecision::FAST> },
+        { ActivationFunction::LOGISTIC, &NEActivationLayerKernel::activation_f16<ActivationFunction::LOGISTIC, MathPrecision::FAST> },
+        { ActivationFunction::RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::RELU, MathPrecision::FAST> },
+        { ActivationFunction::BOUNDED_RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::BOUNDED_RELU, MathPrecision::FAST> },
+        { ActivationFunction::SOFT_RELU, &NEActivationLayerKernel::activation_f16<ActivationFunction::SOFT_RELU, MathPrecision::FAST> },
+        { ActivationFunction::SQRT, &NEActivationLayerKernel::activation_f16<ActivationFunction::SQRT, MathPrecision::FAST> },
+        { ActivationFunction::SQUARE, &NEActivationLayerKernel::activation_f16<ActivationFunction::SQUARE, MathPrecision::FAST> },
+        { ActivationFunction::TANH, &NEActivationLayerKernel::activation_f16<ActivationFunction::TANH, MathPrecision::FAST> },
+    };
+#endif
     _act_info = activation_info;
 
-    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    switch(input->info()->data_type())
+    {
+        case DataType::U8:
+        {
+            // The input and output share their quantization settings: the activation function is a clamp of the quantized values
+            ARM_COMPUTE_ERROR_ON(input->info()->quantization_info().empty());
+            std::tie(_min_bound, _max_bound) = quantized_activation_bounds(activation_info, input->info()->quantization_info());
+            _func                            = &NEActivationLayerKernel::activation_quantized;
+            break;
+        }
+        case DataType::F32:
+        {
+            _func = activation_info.precision() == MathPrecision::FAST ? act_map_fast[activation_info.activation()] : act_map[activation_info.activation()];
+            break;
+        }
+        case DataType::F16:
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {
+            _func = activation_info.precision() == MathPrecision::FAST ? act_map_f16_fast[activation_info.activation()] : act_map_f16[activation_info.activation()];
+            break;
+        }
+#endif
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
+
+    // Configure kernel window: the end of the rows is handled by execute_elementwise_loop() so no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    if(output != nullptr)
+    {
+        AccessWindowHorizontal output_access(output->info(), 0, 1);
+
+        update_window_and_padding(win,
+                                  AccessWindowHorizontal(input->info(), 0, 1),
+                                  output_access);
+
+        output_access.set_valid_region(win, input->info()->valid_region());
+    }
+    else
+    {
+        // In-place computation
+        update_window_and_padding(win,
+                                  AccessWindowHorizontal(input->info(), 0, 1));
+    }
 
-    INESimpleKernel::configure(_input, _output, num_elems_processed_per_iteration);
+    INEKernel::configure(win);
 }
 
-template <ActivationLayerInfo::ActivationFunction F>
+template <ActivationLayerInfo::ActivationFunction F, MathPrecision P>
 void NEActivationLayerKernel::activation(const Window &window)
 {
-    Iterator input(_input, window);
-    Iterator output(_output, window);
-
-    static const float32x4_t CONST_1 = vdupq_n_f32(1.f); // 1.f
-    static const float32x4_t CONST_0 = vdupq_n_f32(0.f);
-    const float32x4_t        a       = vdupq_n_f32(_act_info.a());
-    const float32x4_t        b       = vdupq_n_f32(_act_info.b());
+    const float32x4_t a = vdupq_n_f32(_act_info.a());
+    const float32x4_t b = vdupq_n_f32(_act_info.b());
 
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [&](const uint8_t *in_ptr, uint8_t *out_ptr)
     {
-        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
-        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+        const auto input_ptr  = reinterpret_cast<const float *>(in_ptr);
+        const auto output_ptr = reinterpret_cast<float *>(out_ptr);
 
         const float32x4x4_t in  = vld4q_f32(input_ptr);
-        float32x4x4_t       tmp = { {} };
-
-        switch(F)
+        const float32x4x4_t tmp =
         {
-            case ActivationFunction::ABS:
-                tmp =
-                {
-                    {
-                        vabsq_f32(in.val[0]),
-                        vabsq_f32(in.val[1]),
-                        vabsq_f32(in.val[2]),
-                        vabsq_f32(in.val[3]),
-                    }
-                };
-                break;
-            case ActivationFunction::BOUNDED_RELU:
-                tmp =
-                {
-                    {
-                        vminq_f32(a, vmaxq_f32(CONST_0, in.val[0])),
-                        vminq_f32(a, vmaxq_f32(CONST_0, in.val[1])),
-                        vminq_f32(a, vmaxq_f32(CONST_0, in.val[2])),
-                        vminq_f32(a, vmaxq_f32(CONST_0, in.val[3])),
-                    }
-                };
-                break;
-            case ActivationFunction::LINEAR:
-                tmp =
-                {
-                    {
-                        vmlaq_f32(b, a, in.val[0]),
-                        vmlaq_f32(b, a, in.val[1]),
-                        vmlaq_f32(b, a, in.val[2]),
-                        vmlaq_f32(b, a, in.val[3]),
-                    }
-                };
-                break;
-            case ActivationFunction::LOGISTIC:
-                tmp =
-                {
-                    {
-                        vinvq_f32(vaddq_f32(CONST_1, vexpq_f32(vnegq_f32(in.val[0])))),
-                        vinvq_f32(vaddq_f32(CONST_1, vexpq_f32(vnegq_f32(in.val[1])))),
-                        vinvq_f32(vaddq_f32(CONST_1, vexpq_f32(vnegq_f32(in.val[2])))),
-                        vinvq_f32(vaddq_f32(CONST_1, vexpq_f32(vnegq_f32(in.val[3])))),
-                    }
-                };
-                break;
-            case ActivationFunction::RELU:
-                tmp =
-                {
-                    {
-                        vmaxq_f32(CONST_0, in.val[0]),
-                        vmaxq_f32(CONST_0, in.val[1]),
-                        vmaxq_f32(CONST_0, in.val[2]),
-                        vmaxq_f32(CONST_0, in.val[3]),
-                    }
-                };
-                break;
-            case ActivationFunction::SOFT_RELU:
-                tmp =
-                {
-                    {
-                        vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(in.val[0]))),
-                        vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(in.val[1]))),
-                        vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(in.val[2]))),
-                        vlogq_f32(vaddq_f32(CONST_1, vexpq_f32(in.val[3]))),
-                    }
-                };
-                break;
-            case ActivationFunction::SQRT:
-                tmp =
-                {
-                    {
-                        vinvq_f32(vinvsqrtq_f32(in.val[0])),
-                        vinvq_f32(vinvsqrtq_f32(in.val[1])),
-                        vinvq_f32(vinvsqrtq_f32(in.val[2])),
-                        vinvq_f32(vinvsqrtq_f32(in.val[3])),
-                    }
-                };
-                break;
-            case ActivationFunction::SQUARE:
-                tmp =
-                {
-                    {
-                        vmulq_f32(in.val[0], in.val[0]),
-                        vmulq_f32(in.val[1], in.val[1]),
-                        vmulq_f32(in.val[2], in.val[2]),
-                        vmulq_f32(in.val[3], in.val[3]),
-                    }
-                };
-                break;
-            case ActivationFunction::TANH:
-                tmp =
-                {
-                    {
-                        vmulq_f32(a, vtanhq_f32(vmulq_f32(b, in.val[0]))),
-                        vmulq_f32(a, vtanhq_f32(vmulq_f32(b, in.val[1]))),
-                        vmulq_f32(a, vtanhq_f32(vmulq_f32(b, in.val[2]))),
-                        vmulq_f32(a, vtanhq_f32(vmulq_f32(b, in.val[3]))),
-                    }
-                };
-                break;
-            default:
-                break;
-        }
+            {
+                vactivateq_f32<F, P>(in.val[0], a, b),
+                vactivateq_f32<F, P>(in.val[1], a, b),
+                vactivateq_f32<F, P>(in.val[2], a, b),
+                vactivateq_f32<F, P>(in.val[3], a, b),
+            }
+        };
 
         vst4q_f32(output_ptr, tmp);
     },
-    input, output);
+    _input, _output);
+}
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+template <ActivationLayerInfo::ActivationFunction F, MathPrecision P>
+void NEActivationLayerKernel::activation_f16(const Window &window)
+{
+    const float16x8_t a = vdupq_n_f16(_act_info.a());
+    const float16x8_t b = vdupq_n_f16(_act_info.b());
+
+    execute_elementwise_loop<16>(window, [&](const uint8_t *in_ptr, uint8_t *out_ptr)
+    {
+        const auto input_ptr  = reinterpret_cast<const float16_t *>(in_ptr);
+        const auto output_ptr = reinterpret_cast<float16_t *>(out_ptr);
+
+        const float16x8x2_t in  = vld2q_f16(input_ptr);
+        const float16x8x2_t tmp =
+        {
+            {
+                vactivateq_f16<F, P>(in.val[0], a, b),
+                vactivateq_f16<F, P>(in.val[1], a, b),
+            }
+        };
+
+        vst2q_f16(output_ptr, tmp);
+    },
+    _input, _output);
+}
+#endif
+
+void NEActivationLayerKernel::activation_quantized(const Window &window)
+{
+    const uint8x16_t min_bound = vdupq_n_u8(_min_bound);
+    const uint8x16_t max_bound = vdupq_n_u8(_max_bound);
+
+    execute_elementwise_loop<16>(window, [&](const uint8_t *in_ptr, uint8_t *out_ptr)
+    {
+        const uint8x16_t in = vld1q_u8(in_ptr);
+        vst1q_u8(out_ptr, vminq_u8(vmaxq_u8(in, min_bound), max_bound));
+    },
+    _input, _output);
 }
 
 void NEActivationLayerKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (this->*_func)(window);
+    // Elementwise: run a single loop over the rows of the window if the tensors have no padding between them
+    (this->*_func)(collapse_window(window, *_input->info(), *_output->info()));
+}
+
+SchedulingPolicy NEActivationLayerKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
+
+KernelCost NEActivationLayerKernel::cost(const Window &window) const
+{
+    const size_t num_elements = num_window_elements(window);
+    const size_t element_size = _input->info()->element_size();
+
+    // The exponentials and the square roots take a few tens of operations per element
+    const ActivationFunction act     = _act_info.activation();
+    const size_t             num_ops = (act == ActivationFunction::LOGISTIC || act == ActivationFunction::TANH || act == ActivationFunction::SOFT_RELU || act == ActivationFunction::SQRT) ? 20 : 1;
+
+    return KernelCost{ 2 * num_elements * element_size, num_ops * num_elements };
 }
@@ -37,37 +37,24 @@
 
 using namespace arm_compute;
 
-namespace arm_compute
-{
-class Coordinates;
-} // namespace arm_compute
-
 namespace
 {
 void add_wrap_U8_U8_U8(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        vst1q_u8(output.ptr(), vaddq_u8(vld1q_u8(input1.ptr()), vld1q_u8(input2.ptr())));
+        vst1q_u8(output_ptr, vaddq_u8(vld1q_u8(input1_ptr), vld1q_u8(input2_ptr)));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_saturate_U8_U8_U8(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        vst1q_u8(output.ptr(), vqaddq_u8(vld1q_u8(input1.ptr()), vld1q_u8(input2.ptr())));
+        vst1q_u8(output_ptr, vqaddq_u8(vld1q_u8(input1_ptr), vld1q_u8(input2_ptr)));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 inline int16x8x2_t vadd2q_s16(const int16x8x2_t &a, const int16x8x2_t &b)
@@ -113,96 +100,76 @@ inline int16x8x2_t vqadd2q_s16(const int16x8x2_t &a, const int16x8x2_t &b)
 
 void add_F32_F32_F32(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const float32x4x4_t a = vld4q_f32(reinterpret_cast<const float *>(input1.ptr()));
-        const float32x4x4_t b = vld4q_f32(reinterpret_cast<const float *>(input2.ptr()));
+        const float32x4x4_t a = vld4q_f32(reinterpret_cast<const float *>(input1_ptr));
+        const float32x4x4_t b = vld4q_f32(reinterpret_cast<const float *>(input2_ptr));
 
-        vst4q_f32(reinterpret_cast<float *>(output.ptr()), vadd4q_f32(a, b));
+        vst4q_f32(reinterpret_cast<float *>(output_ptr), vadd4q_f32(a, b));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_wrap_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const int16x8x2_t a = vld2q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        const int16x8x2_t b = vld2q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
+        const int16x8x2_t a = vld2q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        const int16x8x2_t b = vld2q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
 
-        vst2q_s16(reinterpret_cast<int16_t *>(output.ptr()), vadd2q_s16(a, b));
+        vst2q_s16(reinterpret_cast<int16_t *>(output_ptr), vadd2q_s16(a, b));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_saturate_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const int16x8x2_t a = vld2q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        const int16x8x2_t b = vld2q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
+        const int16x8x2_t a = vld2q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        const int16x8x2_t b = vld2q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
 
-        vst2q_s16(reinterpret_cast<int16_t *>(output.ptr()), vqadd2q_s16(a, b));
+        vst2q_s16(reinterpret_cast<int16_t *>(output_ptr), vqadd2q_s16(a, b));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_wrap_S16_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
         const int16x8x2_t a =
         {
             {
-                vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr())),
-                vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()) + 8)
+                vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr)),
+                vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr) + 8)
             }
         };
-        const uint8x16_t b = vld1q_u8(input2.ptr());
+        const uint8x16_t b = vld1q_u8(input2_ptr);
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), vaddq_s16(a.val[0], vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b)))));
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, vaddq_s16(a.val[1], vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b)))));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), vaddq_s16(a.val[0], vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b)))));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, vaddq_s16(a.val[1], vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b)))));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_saturate_S16_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
         const int16x8x2_t a =
         {
             {
-                vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr())),
-                vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()) + 8)
+                vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr)),
+                vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr) + 8)
             }
         };
-        const uint8x16_t b = vld1q_u8(input2.ptr());
+        const uint8x16_t b = vld1q_u8(input2_ptr);
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), vqaddq_s16(a.val[0], vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b)))));
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, vqaddq_s16(a.val[1], vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b)))));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), vqaddq_s16(a.val[0], vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(b)))));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, vqaddq_s16(a.val[1], vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(b)))));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 inline void add_wrap_U8_S16_S16(const ITensor *input1, const ITensor *input2, ITensor *output, const Window &window)
@@ -219,14 +186,10 @@ inline void add_saturate_U8_S16_S16(const ITensor *input1, const ITensor *input2
 
 void add_wrap_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t a = vld1q_u8(input1.ptr());
-        const uint8x16_t b = vld1q_u8(input2.ptr());
+        const uint8x16_t a = vld1q_u8(input1_ptr);
+        const uint8x16_t b = vld1q_u8(input2_ptr);
 
         const int16x8x2_t a_s16 =
         {
@@ -244,22 +207,18 @@ void add_wrap_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, co
             }
         };
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), vaddq_s16(a_s16.val[0], b_s16.val[0]));
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, vaddq_s16(a_s16.val[1], b_s16.val[1]));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), vaddq_s16(a_s16.val[0], b_s16.val[0]));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, vaddq_s16(a_s16.val[1], b_s16.val[1]));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void add_saturate_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t a = vld1q_u8(input1.ptr());
-        const uint8x16_t b = vld1q_u8(input2.ptr());
+        const uint8x16_t a = vld1q_u8(input1_ptr);
+        const uint8x16_t b = vld1q_u8(input2_ptr);
 
         const int16x8x2_t a_s16 =
         {
@@ -277,10 +236,10 @@ void add_saturate_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out
             }
         };
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), vqaddq_s16(a_s16.val[0], b_s16.val[0]));
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, vqaddq_s16(a_s16.val[1], b_s16.val[1]));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), vqaddq_s16(a_s16.val[0], b_s16.val[0]));
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, vqaddq_s16(a_s16.val[1], b_s16.val[1]));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 } // namespace
 
@@ -334,15 +293,13 @@ void NEArithmeticAdditionKernel::configure(const ITensor *input1, const ITensor
         ARM_COMPUTE_ERROR("You called arithmetic addition with the wrong tensor data type");
     }
 
-    constexpr unsigned int num_elems_processed_per_iteration = 16;
-
-    // Configure kernel window
-    Window                 win = calculate_max_window(*input1->info(), Steps(num_elems_processed_per_iteration));
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    // Configure kernel window: the end of the rows is handled by execute_elementwise_loop() so no padding is needed
+    Window                 win = calculate_max_window(*input1->info(), Steps());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
 
     update_window_and_padding(win,
-                              AccessWindowHorizontal(input1->info(), 0, num_elems_processed_per_iteration),
-                              AccessWindowHorizontal(input2->info(), 0, num_elems_processed_per_iteration),
+                              AccessWindowHorizontal(input1->info(), 0, 1),
+                              AccessWindowHorizontal(input2->info(), 0, 1),
                               output_access);
 
     ValidRegion valid_region = intersect_valid_regions(input1->info()->valid_region(),
@@ -359,5 +316,6 @@ void NEArithmeticAdditionKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (*_func)(_input1, _input2, _output, window);
+    // Elementwise: run a single loop over the rows of the window if the tensors have no padding between them
+    (*_func)(_input1, _input2, _output, collapse_window(window, *_input1->info(), *_input2->info(), *_output->info()));
 }
@@ -36,55 +36,38 @@
 
 using namespace arm_compute;
 
-namespace arm_compute
-{
-class Coordinates;
-} // namespace arm_compute
-
 namespace
 {
 void sub_wrap_U8_U8_U8(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t ta1 = vld1q_u8(input1.ptr());
-        const uint8x16_t ta2 = vld1q_u8(input2.ptr());
+        const uint8x16_t ta1 = vld1q_u8(input1_ptr);
+        const uint8x16_t ta2 = vld1q_u8(input2_ptr);
 
-        vst1q_u8(output.ptr(), vsubq_u8(ta1, ta2));
+        vst1q_u8(output_ptr, vsubq_u8(ta1, ta2));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_saturate_U8_U8_U8(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t ta1 = vld1q_u8(input1.ptr());
-        const uint8x16_t ta2 = vld1q_u8(input2.ptr());
+        const uint8x16_t ta1 = vld1q_u8(input1_ptr);
+        const uint8x16_t ta2 = vld1q_u8(input2_ptr);
 
-        vst1q_u8(output.ptr(), vqsubq_u8(ta1, ta2));
+        vst1q_u8(output_ptr, vqsubq_u8(ta1, ta2));
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_wrap_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const int16x8x2_t ta1 = vld2q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        const int16x8x2_t ta2 = vld2q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
+        const int16x8x2_t ta1 = vld2q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        const int16x8x2_t ta2 = vld2q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
 
         const int16x8x2_t ta3 =
         {
@@ -94,21 +77,17 @@ void sub_wrap_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out,
             }
         };
 
-        vst2q_s16(reinterpret_cast<int16_t *>(output.ptr()), ta3);
+        vst2q_s16(reinterpret_cast<int16_t *>(output_ptr), ta3);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_saturate_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const int16x8x2_t ta1 = vld2q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        const int16x8x2_t ta2 = vld2q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
+        const int16x8x2_t ta1 = vld2q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        const int16x8x2_t ta2 = vld2q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
 
         const int16x8x2_t ta3 =
         {
@@ -118,21 +97,17 @@ void sub_saturate_S16_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *o
             }
         };
 
-        vst2q_s16(reinterpret_cast<int16_t *>(output.ptr()), ta3);
+        vst2q_s16(reinterpret_cast<int16_t *>(output_ptr), ta3);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_F32_F32_F32(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const float32x4x4_t ta1 = vld4q_f32(reinterpret_cast<const float *>(input1.ptr()));
-        const float32x4x4_t ta2 = vld4q_f32(reinterpret_cast<const float *>(input2.ptr()));
+        const float32x4x4_t ta1 = vld4q_f32(reinterpret_cast<const float *>(input1_ptr));
+        const float32x4x4_t ta2 = vld4q_f32(reinterpret_cast<const float *>(input2_ptr));
 
         const float32x4x4_t ta3 =
         {
@@ -144,136 +119,112 @@ void sub_F32_F32_F32(const ITensor *in1, const ITensor *in2, ITensor *out, const
             }
         };
 
-        vst4q_f32(reinterpret_cast<float *>(output.ptr()), ta3);
+        vst4q_f32(reinterpret_cast<float *>(output_ptr), ta3);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 void sub_wrap_S16_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t bv_0 = vld1q_u8(input2.ptr());
-        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()) + 8);
+        const uint8x16_t bv_0 = vld1q_u8(input2_ptr);
+        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr) + 8);
 
         a1_0 = vsubq_s16(a1_0, vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))));
         a2_0 = vsubq_s16(a2_0, vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))));
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_saturate_S16_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t bv_0 = vld1q_u8(input2.ptr());
-        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()));
-        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1.ptr()) + 8);
+        const uint8x16_t bv_0 = vld1q_u8(input2_ptr);
+        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr));
+        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input1_ptr) + 8);
 
         a1_0 = vqsubq_s16(a1_0, vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))));
         a2_0 = vqsubq_s16(a2_0, vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))));
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_wrap_U8_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t bv_0 = vld1q_u8(input1.ptr());
-        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
-        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2.ptr()) + 8);
+        const uint8x16_t bv_0 = vld1q_u8(input1_ptr);
+        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
+        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2_ptr) + 8);
 
         a1_0 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))), a1_0);
         a2_0 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))), a2_0);
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_saturate_U8_S16_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t bv_0 = vld1q_u8(input1.ptr());
-        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2.ptr()));
-        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2.ptr()) + 8);
+        const uint8x16_t bv_0 = vld1q_u8(input1_ptr);
+        int16x8_t        a1_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2_ptr));
+        int16x8_t        a2_0 = vld1q_s16(reinterpret_cast<const int16_t *>(input2_ptr) + 8);
 
         a1_0 = vqsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))), a1_0);
         a2_0 = vqsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))), a2_0);
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_wrap_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t av_0 = vld1q_u8(input1.ptr());
-        const uint8x16_t bv_0 = vld1q_u8(input2.ptr());
+        const uint8x16_t av_0 = vld1q_u8(input1_ptr);
+        const uint8x16_t bv_0 = vld1q_u8(input2_ptr);
 
         const int16x8_t a1_0 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(av_0))),
                                          vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))));
         const int16x8_t a2_0 = vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(av_0))),
                                          vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))));
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 
 void sub_saturate_U8_U8_S16(const ITensor *in1, const ITensor *in2, ITensor *out, const Window &window)
 {
-    Iterator input1(in1, window);
-    Iterator input2(in2, window);
-    Iterator output(out, window);
-
-    execute_window_loop(window, [&](const Coordinates & id)
+    execute_elementwise_loop<16>(window, [](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
     {
-        const uint8x16_t av_0 = vld1q_u8(input1.ptr());
-        const uint8x16_t bv_0 = vld1q_u8(input2.ptr());
+        const uint8x16_t av_0 = vld1q_u8(input1_ptr);
+        const uint8x16_t bv_0 = vld1q_u8(input2_ptr);
 
         const int16x8_t a1_0 = vqsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(av_0))),
                                           vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bv_0))));
         const int16x8_t a2_0 = vqsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(av_0))),
                                           vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bv_0))));
 
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()), a1_0);
-        vst1q_s16(reinterpret_cast<int16_t *>(output.ptr()) + 8, a2_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr), a1_0);
+        vst1q_s16(reinterpret_cast<int16_t *>(output_ptr) + 8, a2_0);
     },
-    input1, input2, output);
+    in1, in2, out);
 }
 } // namespace
 
@@ -329,15 +280,13 @@ void NEArithmeticSubtractionKernel::configure(const ITensor *input1, const ITens
         ARM_COMPUTE_ERROR("You called subtract with the wrong image formats");
     }
 
-    constexpr unsigned int num_elems_processed_per_iteration = 16;
-
-    // Configure kernel window
-    Window                 win = calculate_max_window(*input1->info(), Steps(num_elems_processed_per_iteration));
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    // Configure kernel window: the end of the rows is handled by execute_elementwise_loop() so no padding is needed
+    Window                 win = calculate_max_window(*input1->info(), Steps());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
 
     update_window_and_padding(win,
-                              AccessWindowHorizontal(input1->info(), 0, num_elems_processed_per_iteration),
-                              AccessWindowHorizontal(input2->info(), 0, num_elems_processed_per_iteration),
+                              AccessWindowHorizontal(input1->info(), 0, 1),
+                              AccessWindowHorizontal(input2->info(), 0, 1),
                               output_access);
 
     ValidRegion valid_region = intersect_valid_regions(input1->info()->valid_region(),
@@ -354,5 +303,6 @@ void NEArithmeticSubtractionKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_func == nullptr);
 
-    (*_func)(_input1, _input2, _output, window);
+    // Elementwise: run a single loop over the rows of the window if the tensors have no padding between them
+    (*_func)(_input1, _input2, _output, collapse_window(window, *_input1->info(), *_input2->info(), *_output->info()));
 }
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBatchNormalizationFoldKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <cmath>
+
+using namespace arm_compute;
+
+NEBatchNormalizationFoldKernel::NEBatchNormalizationFoldKernel()
+    : _weights(nullptr), _biases(nullptr), _mean(nullptr), _var(nullptr), _beta(nullptr), _gamma(nullptr), _epsilon(), _folded_weights(nullptr), _folded_biases(nullptr)
+{
+}
+
+void NEBatchNormalizationFoldKernel::configure(const ITensor *weights, const ITensor *biases, const ITensor *mean, const ITensor *var, const ITensor *beta, const ITensor *gamma, float epsilon,
+                                               ITensor *folded_weights, ITensor *folded_biases)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(mean, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(mean, var, beta, gamma, folded_biases);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(mean, var, beta, gamma, folded_biases);
+    ARM_COMPUTE_ERROR_ON(mean->info()->num_dimensions() > 1);
+    ARM_COMPUTE_ERROR_ON((weights == nullptr) != (folded_weights == nullptr));
+
+    if(weights != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(mean, weights, folded_weights);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(weights, folded_weights);
+        ARM_COMPUTE_ERROR_ON(weights->info()->dimension(3) != mean->info()->dimension(0));
+    }
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(mean, biases);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(mean, biases);
+    }
+
+    _weights        = weights;
+    _biases         = biases;
+    _mean           = mean;
+    _var            = var;
+    _beta           = beta;
+    _gamma          = gamma;
+    _epsilon        = epsilon;
+    _folded_weights = folded_weights;
+    _folded_biases  = folded_biases;
+
+    // Configure kernel window: one iteration per output feature map
+    Window win = calculate_max_window(*folded_biases->info(), Steps());
+
+    folded_biases->info()->set_valid_region(ValidRegion(Coordinates(), folded_biases->info()->tensor_shape()));
+
+    if(folded_weights != nullptr)
+    {
+        folded_weights->info()->set_valid_region(weights->info()->valid_region());
+    }
+
+    INEKernel::configure(win);
+}
+
+void NEBatchNormalizationFoldKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const auto value = [](const ITensor * tensor, int ofm)
+    {
+        return *reinterpret_cast<const float *>(tensor->ptr_to_element(Coordinates(ofm)));
+    };
+
+    for(int ofm = window.x().start(); ofm < window.x().end(); ++ofm)
+    {
+        const float scale = value(_gamma, ofm) / std::sqrt(value(_var, ofm) + _epsilon);
+        const float bias  = (_biases != nullptr) ? value(_biases, ofm) : 0.f;
+
+        *reinterpret_cast<float *>(_folded_biases->ptr_to_element(Coordinates(ofm))) = (bias - value(_mean, ofm)) * scale + value(_beta, ofm);
+
+        if(_weights == nullptr)
+        {
+            continue;
+        }
+
+        // Scale the [kernel_x, kernel_y, IFM] block of the output feature map
+        Window win_weights;
+        win_weights.use_tensor_dimensions(_weights->info());
+        win_weights.set(3, Window::Dimension(ofm, ofm + 1, 1));
+
+        Iterator weights(_weights, win_weights);
+        Iterator folded_weights(_folded_weights, win_weights);
+
+        execute_window_loop(win_weights, [&](const Coordinates &)
+        {
+            *reinterpret_cast<float *>(folded_weights.ptr()) = *reinterpret_cast<const float *>(weights.ptr()) * scale;
+        },
+        weights, folded_weights);
+    }
+}
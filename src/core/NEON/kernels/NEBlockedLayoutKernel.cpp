@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBlockedLayoutKernel.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <array>
+#include <cstddef>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of channels of a block */
+constexpr int block_size = 4;
+
+/** Check that the shape of a tensor is the one expected */
+inline void check_shape(const TensorShape &shape, const TensorShape &expected)
+{
+    for(size_t d = 0; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_ERROR_ON(shape[d] != expected[d]);
+    }
+    ARM_COMPUTE_UNUSED(shape);
+    ARM_COMPUTE_UNUSED(expected);
+}
+
+/** Window iterating over the rows of each block of channels of a planar tensor */
+inline Window block_rows_window(const TensorShape &planar_shape)
+{
+    Window win;
+    win.set(Window::DimY, Window::Dimension(0, planar_shape[1], 1));
+    win.set(Window::DimZ, Window::Dimension(0, (planar_shape[2] + block_size - 1) / block_size, 1));
+
+    for(size_t d = 3; d < Coordinates::num_max_dimensions; ++d)
+    {
+        win.set(d, Window::Dimension(0, planar_shape[d], 1));
+    }
+
+    return win;
+}
+} // namespace
+
+NEBlockedLayoutKernel::NEBlockedLayoutKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr)
+{
+}
+
+TensorShape NEBlockedLayoutKernel::blocked_shape(const TensorShape &shape)
+{
+    TensorShape blocked(shape);
+    blocked.set(0, shape[0] * block_size);
+    blocked.set(2, (shape[2] + block_size - 1) / block_size);
+    return blocked;
+}
+
+TensorShape NEBlockedLayoutKernel::blocked_weights_shape(const TensorShape &shape)
+{
+    TensorShape blocked(shape);
+    blocked.set(0, shape[0] * block_size * block_size);
+    blocked.set(2, (shape[2] + block_size - 1) / block_size);
+    blocked.set(3, (shape[3] + block_size - 1) / block_size);
+    return blocked;
+}
+
+void NEBlockedLayoutKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+
+    const bool to_blocked = (output->info()->data_layout() == DataLayout::NCHW4);
+    const auto planar     = to_blocked ? input->info() : output->info();
+    const auto blocked    = to_blocked ? output->info() : input->info();
+
+    ARM_COMPUTE_ERROR_ON(planar->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_ERROR_ON(blocked->data_layout() != DataLayout::NCHW4);
+    check_shape(blocked->tensor_shape(), blocked_shape(planar->tensor_shape()));
+
+    _input  = input;
+    _output = output;
+    _func   = to_blocked ? &NEBlockedLayoutKernel::block : &NEBlockedLayoutKernel::unblock;
+
+    // Each iteration converts a full row of a block of channels: the X dimension is handled by the kernel
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(block_rows_window(planar->tensor_shape()));
+}
+
+void NEBlockedLayoutKernel::configure_weights(const ITensor *weights, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    check_shape(output->info()->tensor_shape(), blocked_weights_shape(weights->info()->tensor_shape()));
+
+    _input  = weights;
+    _output = output;
+    _func   = &NEBlockedLayoutKernel::block_weights;
+
+    // Each iteration blocks a full row of the kernels connecting two blocks of feature maps
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEBlockedLayoutKernel::block(const Window &window)
+{
+    const int width        = _input->info()->dimension(0);
+    const int num_channels = _input->info()->dimension(2);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        Coordinates out_id(id);
+        out_id.set(0, 0);
+        const auto out = reinterpret_cast<float *>(_output->ptr_to_element(out_id));
+
+        // The missing channels of the last block are read from a zero vector
+        const int                             first_channel = id.z() * block_size;
+        const int                             block_depth   = std::min(block_size, num_channels - first_channel);
+        std::array<const float *, block_size> planes{ {} };
+        for(int c = 0; c < block_depth; ++c)
+        {
+            Coordinates in_id(id);
+            in_id.set(0, 0);
+            in_id.set(2, first_channel + c);
+            planes[c] = reinterpret_cast<const float *>(_input->ptr_to_element(in_id));
+        }
+
+        int x = 0;
+        for(; x <= width - 4; x += 4)
+        {
+            float32x4x4_t pixels;
+            for(int c = 0; c < block_size; ++c)
+            {
+                pixels.val[c] = (c < block_depth) ? vld1q_f32(planes[c] + x) : vdupq_n_f32(0.f);
+            }
+            vst4q_f32(out + block_size * x, pixels);
+        }
+        for(; x < width; ++x)
+        {
+            for(int c = 0; c < block_size; ++c)
+            {
+                out[block_size * x + c] = (c < block_depth) ? planes[c][x] : 0.f;
+            }
+        }
+    });
+}
+
+void NEBlockedLayoutKernel::unblock(const Window &window)
+{
+    const int width        = _output->info()->dimension(0);
+    const int num_channels = _output->info()->dimension(2);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        Coordinates in_id(id);
+        in_id.set(0, 0);
+        const auto in = reinterpret_cast<const float *>(_input->ptr_to_element(in_id));
+
+        // The missing channels of the last block are dropped
+        const int                       first_channel = id.z() * block_size;
+        const int                       block_depth   = std::min(block_size, num_channels - first_channel);
+        std::array<float *, block_size> planes{ {} };
+        for(int c = 0; c < block_depth; ++c)
+        {
+            Coordinates out_id(id);
+            out_id.set(0, 0);
+            out_id.set(2, first_channel + c);
+            planes[c] = reinterpret_cast<float *>(_output->ptr_to_element(out_id));
+        }
+
+        int x = 0;
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4x4_t pixels = vld4q_f32(in + block_size * x);
+            for(int c = 0; c < block_depth; ++c)
+            {
+                vst1q_f32(planes[c] + x, pixels.val[c]);
+            }
+        }
+        for(; x < width; ++x)
+        {
+            for(int c = 0; c < block_depth; ++c)
+            {
+                planes[c][x] = in[block_size * x + c];
+            }
+        }
+    });
+}
+
+void NEBlockedLayoutKernel::block_weights(const Window &window)
+{
+    const int kernel_x = _input->info()->dimension(0);
+    const int num_ifm  = _input->info()->dimension(2);
+    const int num_ofm  = _input->info()->dimension(3);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int ky = id.y();
+        const int ib = id.z();
+        const int ob = id[3];
+
+        auto out = reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(0, ky, ib, ob)));
+
+        for(int kx = 0; kx < kernel_x; ++kx)
+        {
+            for(int i = 0; i < block_size; ++i)
+            {
+                for(int o = 0; o < block_size; ++o)
+                {
+                    const int ifm = ib * block_size + i;
+                    const int ofm = ob * block_size + o;
+                    *out++        = (ifm < num_ifm && ofm < num_ofm) ? *reinterpret_cast<const float *>(_input->ptr_to_element(Coordinates(kx, ky, ifm, ofm))) : 0.f;
+                }
+            }
+        }
+    });
+}
+
+void NEBlockedLayoutKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEBoxNxMKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+/** Add a row of the input to the column sums and optionally subtract another one
+ *
+ * @param[in, out] sums        Column sums. Must hold @p num_columns elements.
+ * @param[in]      add         Row to add.
+ * @param[in]      sub         Row to subtract, or nullptr.
+ * @param[in]      num_columns Number of columns to update. Must be a multiple of 16.
+ */
+inline void update_column_sums(uint16_t *sums, const uint8_t *add, const uint8_t *sub, int num_columns)
+{
+    for(int i = 0; i < num_columns; i += 16)
+    {
+        const uint8x16_t add_vec = vld1q_u8(add + i);
+
+        uint16x8_t sums_low  = vaddw_u8(vld1q_u16(sums + i), vget_low_u8(add_vec));
+        uint16x8_t sums_high = vaddw_u8(vld1q_u16(sums + i + 8), vget_high_u8(add_vec));
+
+        if(sub != nullptr)
+        {
+            const uint8x16_t sub_vec = vld1q_u8(sub + i);
+
+            sums_low  = vsubw_u8(sums_low, vget_low_u8(sub_vec));
+            sums_high = vsubw_u8(sums_high, vget_high_u8(sub_vec));
+        }
+
+        vst1q_u16(sums + i, sums_low);
+        vst1q_u16(sums + i + 8, sums_high);
+    }
+}
+} // namespace
+
+NEBoxNxMKernel::NEBoxNxMKernel()
+    : _border_size(0), _width(0), _height(0), _scale(0)
+{
+}
+
+BorderSize NEBoxNxMKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEBoxNxMKernel::configure(const ITensor *input, ITensor *output, unsigned int width, unsigned int height, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON((width % 2) == 0 || (height % 2) == 0);
+    // The column sums are accumulated in 16 bit
+    ARM_COMPUTE_ERROR_ON(height > 257);
+
+    _input       = input;
+    _output      = output;
+    _width       = width;
+    _height      = height;
+    _scale       = static_cast<uint32_t>(std::lround(static_cast<double>(1 << 24) / (width * height)));
+    _border_size = BorderSize(height / 2, width / 2);
+
+    // The column sums of a sub-window start at its first column minus the horizontal border
+    const unsigned int num_elems_read_per_iteration = ceil_to_multiple(num_elems_processed_per_iteration + 2 * _border_size.left, num_elems_processed_per_iteration);
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -_border_size.left, -_border_size.top, num_elems_read_per_iteration, height),
+                              output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NEBoxNxMKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+
+    const int    border_x    = _border_size.left;
+    const int    border_y    = _border_size.top;
+    const int    x_start     = window.x().start();
+    const int    num_outputs = window.x().end() - x_start;
+    const int    num_columns = num_outputs - num_elems_processed_per_iteration + ceil_to_multiple(num_elems_processed_per_iteration + 2 * border_x, num_elems_processed_per_iteration);
+    const size_t stride_y    = _input->info()->strides_in_bytes().y();
+
+    uint16_t *const column_sums = thread_scratch<uint16_t>(num_columns);
+    std::fill_n(column_sums, num_columns, 0);
+
+    const uint8_t *in_ptr = _input->ptr_to_element(Coordinates(x_start - border_x, window.y().start()));
+
+    for(int r = -border_y; r <= border_y; ++r)
+    {
+        update_column_sums(column_sums, in_ptr + r * static_cast<int>(stride_y), nullptr, num_columns);
+    }
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        if(y != window.y().start())
+        {
+            // Slide the box down to the rows of y
+            update_column_sums(column_sums, in_ptr + border_y * static_cast<int>(stride_y), in_ptr - (border_y + 1) * static_cast<int>(stride_y), num_columns);
+        }
+
+        uint8_t *out_ptr = _output->ptr_to_element(Coordinates(x_start, y));
+
+        uint32_t sum = 0;
+        for(unsigned int i = 0; i < _width; ++i)
+        {
+            sum += column_sums[i];
+        }
+
+        for(int x = 0; x < num_outputs; ++x)
+        {
+            out_ptr[x] = static_cast<uint8_t>(std::min<uint64_t>((static_cast<uint64_t>(sum) * _scale + (1 << 23)) >> 24, 255));
+
+            if(x + 1 < num_outputs)
+            {
+                sum += column_sums[x + _width] - column_sums[x];
+            }
+        }
+
+        in_ptr += stride_y;
+    }
+}
@@ -24,6 +24,7 @@
 #include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
 
 #include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
@@ -32,10 +33,15 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <array>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <tuple>
+#include <type_traits>
+#include <utility>
 
 using namespace arm_compute;
 
@@ -614,113 +620,6 @@ inline uint16x4_t non_max_U32_helper(const uint32_t *in, const uint16x4_t pc, co
 
     return vmovn_u32(mc);
 }
-
-/** Computes edge tracing when is called by edge_trace_U8_U8 recursively
- *
- * @param[in]  in         Pointer to source image. Data type supported U8
- * @param[out] out        Pointer to destination image. Data type supported U8
- * @param[in]  in_stride  Stride of the input image
- * @param[in]  out_stride Stride of the output image
- */
-void edge_trace_recursive_U8_U8(uint8_t *__restrict in, uint8_t *__restrict out, const int32_t in_stride, const int32_t out_stride)
-{
-    // Look for MAYBE pixels in 8 directions
-    *out = EDGE;
-
-    // (-1, 0)
-    uint8_t pixel = *(in - 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in - 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in - 1, out - 1, in_stride, out_stride);
-    }
-
-    // (+1, 0)
-    pixel = *(in + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in + 1, out + 1, in_stride, out_stride);
-    }
-
-    in -= in_stride;
-    out -= out_stride;
-
-    // (-1, -1)
-    pixel = *(in - 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in - 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in - 1, out - 1, in_stride, out_stride);
-    }
-
-    // (0, -1)
-    pixel = *in;
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *in = EDGE;
-
-        edge_trace_recursive_U8_U8(in, out, in_stride, out_stride);
-    }
-
-    // (+1, -1)
-    pixel = *(in + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in + 1, out + 1, in_stride, out_stride);
-    }
-
-    in += in_stride * 2;
-    out += out_stride * 2;
-
-    // (-1, +1)
-    pixel = *(in - 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in - 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in - 1, out - 1, in_stride, out_stride);
-    }
-
-    // (0, +1)
-    pixel = *in;
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *in = EDGE;
-
-        edge_trace_recursive_U8_U8(in, out, in_stride, out_stride);
-    }
-
-    // (+1, +1)
-    pixel = *(in + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(in + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(in + 1, out + 1, in_stride, out_stride);
-    }
-}
 } // namespace fp16
 
 void NEGradientFP16Kernel::configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase, int32_t norm_type)
@@ -1304,17 +1203,20 @@ void mag_phase_l2norm_S32_S32_U32_U8(const void *__restrict gx_ptr, const void *
 
 /* Computes non-maxima suppression and hysteresis when the gradient size = 3 or 5
  *
+ * @param[in]  top_ptr       Pointer to the previous row of the magnitude. Data type supported U16
  * @param[in]  magnitude_ptr Pointer to source image. Magnitude. Data type supported U16
+ * @param[in]  bottom_ptr    Pointer to the next row of the magnitude. Data type supported U16
  * @param[in]  phase_ptr     Pointer to source image. Quantized phase. Data type supported U8
  * @param[out] output_ptr    Pointer to output image. Data type supported U8
- * @param[in]  stride_mag    Stride of magnitude image
  * @param[in]  lower_thr     Lower threshold used for the hysteresis
  * @param[in]  upper_thr     Upper threshold used for the hysteresis
  */
-void non_max_suppression_U16_U8_U8(const void *__restrict magnitude_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr, const uint32_t stride_mag, const int32_t lower_thr,
-                                   const int32_t upper_thr)
+void non_max_suppression_U16_U8_U8(const void *__restrict top_ptr, const void *__restrict magnitude_ptr, const void *__restrict bottom_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr,
+                                   const int32_t lower_thr, const int32_t upper_thr)
 {
+    const auto top       = static_cast<const uint16_t *__restrict>(top_ptr);
     const auto magnitude = static_cast<const uint16_t *__restrict>(magnitude_ptr);
+    const auto bottom    = static_cast<const uint16_t *__restrict>(bottom_ptr);
     const auto phase     = static_cast<const uint8_t *__restrict>(phase_ptr);
     const auto output    = static_cast<uint8_t *__restrict>(output_ptr);
 
@@ -1332,22 +1234,22 @@ void non_max_suppression_U16_U8_U8(const void *__restrict magnitude_ptr, const v
     mask0                  = vandq_u16(mask0, vcgeq_u16(mc, mk0_1));
 
     // 45 degree
-    const uint16x8_t mk45_0 = vld1q_u16(magnitude - stride_mag - 1);
-    const uint16x8_t mk45_1 = vld1q_u16(magnitude + stride_mag + 1);
+    const uint16x8_t mk45_0 = vld1q_u16(top - 1);
+    const uint16x8_t mk45_1 = vld1q_u16(bottom + 1);
     uint16x8_t       mask1  = vceqq_u16(pc16, vdupq_n_u16(1));
     mask1                   = vandq_u16(mask1, vcgeq_u16(mc, mk45_0));
     mask1                   = vandq_u16(mask1, vcgeq_u16(mc, mk45_1));
 
     // 90 degree
-    const uint16x8_t mk90_0 = vld1q_u16(magnitude - stride_mag);
-    const uint16x8_t mk90_1 = vld1q_u16(magnitude + stride_mag);
+    const uint16x8_t mk90_0 = vld1q_u16(top);
+    const uint16x8_t mk90_1 = vld1q_u16(bottom);
     uint16x8_t       mask2  = vceqq_u16(pc16, vdupq_n_u16(2));
     mask2                   = vandq_u16(mask2, vcgeq_u16(mc, mk90_0));
     mask2                   = vandq_u16(mask2, vcgeq_u16(mc, mk90_1));
 
     // 135 degree
-    const uint16x8_t mk135_0 = vld1q_u16(magnitude - stride_mag + 1);
-    const uint16x8_t mk135_1 = vld1q_u16(magnitude + stride_mag - 1);
+    const uint16x8_t mk135_0 = vld1q_u16(top + 1);
+    const uint16x8_t mk135_1 = vld1q_u16(bottom - 1);
     uint16x8_t       mask3   = vceqq_u16(pc16, vdupq_n_u16(3));
     mask3                    = vandq_u16(mask3, vcgeq_u16(mc, mk135_0));
     mask3                    = vandq_u16(mask3, vcgeq_u16(mc, mk135_1));
@@ -1376,7 +1278,7 @@ void non_max_suppression_U16_U8_U8(const void *__restrict magnitude_ptr, const v
     vst1_u8(output, vmovn_u16(mc));
 }
 
-inline uint16x4_t non_max_U32_helper(const uint32_t *input, const uint16x4_t pc, const uint32_t stride_mag, const int32_t lower_thr, const int32_t upper_thr)
+inline uint16x4_t non_max_U32_helper(const uint32_t *top, const uint32_t *input, const uint32_t *bottom, const uint16x4_t pc, const int32_t lower_thr, const int32_t upper_thr)
 {
     // Phase for 4 pixel
     const uint32x4_t pc32 = vmovl_u16(pc);
@@ -1393,22 +1295,22 @@ inline uint16x4_t non_max_U32_helper(const uint32_t *input, const uint16x4_t pc,
     mask0                  = vandq_u32(mask0, vcgeq_u32(mc, mk0_1));
 
     // 45 degree
-    const uint32x4_t mk45_0 = vld1q_u32(input - stride_mag - 1);
-    const uint32x4_t mk45_1 = vld1q_u32(input + stride_mag + 1);
+    const uint32x4_t mk45_0 = vld1q_u32(top - 1);
+    const uint32x4_t mk45_1 = vld1q_u32(bottom + 1);
     uint32x4_t       mask1  = vceqq_u32(pc32, vdupq_n_u32(1));
     mask1                   = vandq_u32(mask1, vcgeq_u32(mc, mk45_0));
     mask1                   = vandq_u32(mask1, vcgeq_u32(mc, mk45_1));
 
     // 90 degree
-    const uint32x4_t mk90_0 = vld1q_u32(input - stride_mag);
-    const uint32x4_t mk90_1 = vld1q_u32(input + stride_mag);
+    const uint32x4_t mk90_0 = vld1q_u32(top);
+    const uint32x4_t mk90_1 = vld1q_u32(bottom);
     uint32x4_t       mask2  = vceqq_u32(pc32, vdupq_n_u32(2));
     mask2                   = vandq_u32(mask2, vcgeq_u32(mc, mk90_0));
     mask2                   = vandq_u32(mask2, vcgeq_u32(mc, mk90_1));
 
     // 135 degree
-    const uint32x4_t mk135_0 = vld1q_u32(input - stride_mag + 1);
-    const uint32x4_t mk135_1 = vld1q_u32(input + stride_mag - 1);
+    const uint32x4_t mk135_0 = vld1q_u32(top + 1);
+    const uint32x4_t mk135_1 = vld1q_u32(bottom - 1);
     uint32x4_t       mask3   = vceqq_u32(pc32, vdupq_n_u32(3));
     mask3                    = vandq_u32(mask3, vcgeq_u32(mc, mk135_0));
     mask3                    = vandq_u32(mask3, vcgeq_u32(mc, mk135_1));
@@ -1439,17 +1341,20 @@ inline uint16x4_t non_max_U32_helper(const uint32_t *input, const uint16x4_t pc,
 
 /* Computes non-maxima suppression and hysteresis when the gradient_size = 7
  *
+ * @param[in]  top_ptr       Pointer to the previous row of the magnitude. Data type supported U32
  * @param[in]  magnitude_ptr Pointer to source image. Magnitude. Data type supported U32
+ * @param[in]  bottom_ptr    Pointer to the next row of the magnitude. Data type supported U32
  * @param[in]  phase_ptr     Pointer to source image. Quantized phase. Data type supported U8
  * @param[out] output_ptr    Pointer to destination image. Data type supported U8
- * @param[in]  stride_mag    Stride of magnitude image
  * @param[in]  lower_thr     Lower threshold used for the hysteresis
  * @param[in]  upper_thr     Upper threshold used for the hysteresis
  */
-void non_max_suppression_U32_U8_U8(const void *__restrict magnitude_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr, const uint32_t stride_mag, const int32_t lower_thr,
-                                   const int32_t upper_thr)
+void non_max_suppression_U32_U8_U8(const void *__restrict top_ptr, const void *__restrict magnitude_ptr, const void *__restrict bottom_ptr, const void *__restrict phase_ptr, void *__restrict output_ptr,
+                                   const int32_t lower_thr, const int32_t upper_thr)
 {
+    const auto top       = static_cast<const uint32_t *__restrict>(top_ptr);
     const auto magnitude = static_cast<const uint32_t *__restrict>(magnitude_ptr);
+    const auto bottom    = static_cast<const uint32_t *__restrict>(bottom_ptr);
     const auto phase     = static_cast<const uint8_t *__restrict>(phase_ptr);
     const auto output    = static_cast<uint8_t *__restrict>(output_ptr);
 
@@ -1460,8 +1365,8 @@ void non_max_suppression_U32_U8_U8(const void *__restrict magnitude_ptr, const v
     const uint16x4x2_t res =
     {
         {
-            non_max_U32_helper(magnitude, vget_low_u16(pc16), stride_mag, lower_thr, upper_thr),
-            non_max_U32_helper(magnitude + 4, vget_high_u16(pc16), stride_mag, lower_thr, upper_thr)
+            non_max_U32_helper(top, magnitude, bottom, vget_low_u16(pc16), lower_thr, upper_thr),
+            non_max_U32_helper(top + 4, magnitude + 4, bottom + 4, vget_high_u16(pc16), lower_thr, upper_thr)
         }
     };
 
@@ -1469,130 +1374,66 @@ void non_max_suppression_U32_U8_U8(const void *__restrict magnitude_ptr, const v
     vst1_u8(output, vmovn_u16(vcombine_u16(res.val[0], res.val[1])));
 }
 
-/* Computes edge tracing when is called by edge_trace_U8_U8 recursively
+/** Find the root of the set of a pixel, halving the path on the way
+ *
+ * @note Safe to call while other threads merge sets: the label of a pixel is always a pixel of the same set with a lower index, or the pixel itself for the root.
+ *
+ * @param[in, out] labels Label of each pixel, shifted by one: labels[0] is the root of every pixel connected to an edge.
+ * @param[in]      index  Index of the pixel in @p labels.
  *
- * @param[in]  input         Pointer to source image. Data type supported U8
- * @param[out] output        Pointer to destination image. Data type supported U8
- * @param[in]  input_stride  Stride of the input image
- * @param[in]  output_stride Stride of the output image
+ * @return The index of the root
  */
-void edge_trace_recursive_U8_U8(uint8_t *__restrict input, uint8_t *__restrict output, const int32_t input_stride, const int32_t output_stride)
+inline uint32_t find_root(uint32_t *labels, uint32_t index)
 {
-    // Look for MAYBE pixels in 8 directions
-    *output = EDGE;
-
-    // (-1, 0)
-    uint8_t pixel = *(input - 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input - 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(input - 1, output - 1, input_stride, output_stride);
-    }
-
-    // (+1, 0)
-    pixel = *(input + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(input + 1, output + 1, input_stride, output_stride);
-    }
-
-    input -= input_stride;
-    output -= output_stride;
-
-    // (-1, -1)
-    pixel = *(input - 1);
+    uint32_t parent = __atomic_load_n(labels + index, __ATOMIC_RELAXED);
 
-    if(pixel == MAYBE)
+    while(parent != index)
     {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input - 1) = EDGE;
+        const uint32_t grandparent = __atomic_load_n(labels + parent, __ATOMIC_RELAXED);
 
-        edge_trace_recursive_U8_U8(input - 1, output - 1, input_stride, output_stride);
-    }
-
-    // (0, -1)
-    pixel = *input;
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *input = EDGE;
-
-        edge_trace_recursive_U8_U8(input, output, input_stride, output_stride);
-    }
-
-    // (+1, -1)
-    pixel = *(input + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(input + 1, output + 1, input_stride, output_stride);
-    }
-
-    input += input_stride * 2;
-    output += output_stride * 2;
-
-    // (-1, +1)
-    pixel = *(input - 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input - 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(input - 1, output - 1, input_stride, output_stride);
-    }
-
-    // (0, +1)
-    pixel = *input;
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *input = EDGE;
+        // Point to the grandparent: fails harmlessly if another thread already shortened the path
+        if(grandparent != parent)
+        {
+            uint32_t expected = parent;
+            __atomic_compare_exchange_n(labels + index, &expected, grandparent, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+        }
 
-        edge_trace_recursive_U8_U8(input, output, input_stride, output_stride);
+        index  = parent;
+        parent = grandparent;
     }
 
-    // (+1, +1)
-    pixel = *(input + 1);
-
-    if(pixel == MAYBE)
-    {
-        // Touched a MAYBE point. MAYBE becomes EDGE
-        *(input + 1) = EDGE;
-
-        edge_trace_recursive_U8_U8(input + 1, output + 1, input_stride, output_stride);
-    }
+    return index;
 }
 
-/* Computes edge tracing
+/** Merge the sets of two pixels by linking the root with the higher index to the other one
  *
- * @param[in]  input         Pointer to source image. Data type supported U8
- * @param[out] output        Pointer to destination image. Data type supported U8
- * @param[in]  input_stride  Stride of the input image
- * @param[in]  output_stride Stride of the output image
+ * @param[in, out] labels Label of each pixel, shifted by one: labels[0] is the root of every pixel connected to an edge.
+ * @param[in]      a      Index of the first pixel in @p labels.
+ * @param[in]      b      Index of the second pixel in @p labels.
  */
-void edge_trace_U8_U8(uint8_t *__restrict input, uint8_t *__restrict output, const int32_t input_stride, const int32_t output_stride)
+inline void merge_sets(uint32_t *labels, uint32_t a, uint32_t b)
 {
-    if(*input == NO_EDGE)
+    while(true)
     {
-        *output = NO_EDGE;
-    }
-    // Check if EDGE and not yet touched
-    else if((*input == EDGE) && (*output == NO_EDGE))
-    {
-        edge_trace_recursive_U8_U8(input, output, input_stride, output_stride);
+        a = find_root(labels, a);
+        b = find_root(labels, b);
+
+        if(a == b)
+        {
+            return;
+        }
+
+        if(a < b)
+        {
+            std::swap(a, b);
+        }
+
+        // Fails if another thread linked root a in the meantime: retry from the new roots
+        uint32_t expected = a;
+        if(__atomic_compare_exchange_n(labels + a, &expected, b, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED))
+        {
+            return;
+        }
     }
 }
 } // namespace
@@ -1738,46 +1579,440 @@ void NEEdgeNonMaxSuppressionKernel::run(const Window &window)
     Iterator phase(_phase, window);
     Iterator output(_output, window);
 
-    const size_t input1_stride        = _magnitude->info()->strides_in_bytes()[1];
-    const size_t input1_stride_ushort = input1_stride / data_size_from_type(_magnitude->info()->data_type());
+    const size_t input1_stride = _magnitude->info()->strides_in_bytes()[1];
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        (*_func)(magnitude.ptr(), phase.ptr(), output.ptr(), input1_stride_ushort, _lower_thr, _upper_thr);
+        (*_func)(magnitude.ptr() - input1_stride, magnitude.ptr(), magnitude.ptr() + input1_stride, phase.ptr(), output.ptr(), _lower_thr, _upper_thr);
     },
     magnitude, phase, output);
 }
 
-NEEdgeTraceKernel::NEEdgeTraceKernel()
-    : _input(nullptr), _output(nullptr)
+namespace
+{
+/** Coefficients of the separable Sobel filters of radius 1, 2 and 3, from the centre to the edge: the filters are antisymmetric for the derivative and symmetric for the smoothing */
+const int16_t sobel_derivative[3][4] =
+{
+    { 0, 1, 0, 0 },
+    { 0, 2, 1, 0 },
+    { 0, 5, 4, 1 }
+};
+const int16_t sobel_smoothing[3][4] =
 {
+    { 2, 1, 0, 0 },
+    { 6, 4, 1, 0 },
+    { 20, 15, 6, 1 }
+};
+
+/** Horizontal pass of the separable Sobel filter on a row
+ *
+ * @param[in]  input      Pointer to the first pixel of the row. Data type supported U8
+ * @param[out] derivative Horizontal derivative of the pixels. Data type supported S16
+ * @param[out] smoothing  Horizontal smoothing of the pixels. Data type supported S16
+ * @param[in]  width      Number of pixels to filter. Must be a multiple of 8
+ * @param[in]  radius     Radius of the filter (1, 2 or 3)
+ */
+void sobel_horizontal(const uint8_t *__restrict input, int16_t *__restrict derivative, int16_t *__restrict smoothing, int width, int radius)
+{
+    const int16_t *derivative_coeffs = sobel_derivative[radius - 1];
+    const int16_t *smoothing_coeffs  = sobel_smoothing[radius - 1];
+
+    for(int x = 0; x < width; x += 8)
+    {
+        int16x8_t out_d = vdupq_n_s16(0);
+        int16x8_t out_s = vmulq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x))), smoothing_coeffs[0]);
+
+        for(int k = 1; k <= radius; ++k)
+        {
+            const int16x8_t left  = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x - k)));
+            const int16x8_t right = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x + k)));
+
+            out_d = vmlaq_n_s16(out_d, vsubq_s16(right, left), derivative_coeffs[k]);
+            out_s = vmlaq_n_s16(out_s, vaddq_s16(right, left), smoothing_coeffs[k]);
+        }
+
+        vst1q_s16(derivative + x, out_d);
+        vst1q_s16(smoothing + x, out_s);
+    }
 }
 
-BorderSize NEEdgeTraceKernel::border_size() const
+/** Vertical pass of the separable Sobel filter when the gradient size = 3 or 5
+ *
+ * @param[in]  derivative Horizontal derivative of the 2 * radius + 1 rows centred on the row to compute. Data type supported S16
+ * @param[in]  smoothing  Horizontal smoothing of the 2 * radius + 1 rows centred on the row to compute. Data type supported S16
+ * @param[out] gx         Gx of the row. Data type supported S16
+ * @param[out] gy         Gy of the row. Data type supported S16
+ * @param[in]  width      Number of pixels to filter. Must be a multiple of 8
+ * @param[in]  radius     Radius of the filter (1 or 2)
+ */
+void sobel_vertical(const int16_t *const *derivative, const int16_t *const *smoothing, int16_t *__restrict gx, int16_t *__restrict gy, int width, int radius)
+{
+    const int16_t *derivative_coeffs = sobel_derivative[radius - 1];
+    const int16_t *smoothing_coeffs  = sobel_smoothing[radius - 1];
+
+    for(int x = 0; x < width; x += 8)
+    {
+        int16x8_t out_x = vmulq_n_s16(vld1q_s16(derivative[radius] + x), smoothing_coeffs[0]);
+        int16x8_t out_y = vdupq_n_s16(0);
+
+        for(int k = 1; k <= radius; ++k)
+        {
+            const int16x8_t top_d    = vld1q_s16(derivative[radius - k] + x);
+            const int16x8_t bottom_d = vld1q_s16(derivative[radius + k] + x);
+            const int16x8_t top_s    = vld1q_s16(smoothing[radius - k] + x);
+            const int16x8_t bottom_s = vld1q_s16(smoothing[radius + k] + x);
+
+            out_x = vmlaq_n_s16(out_x, vaddq_s16(top_d, bottom_d), smoothing_coeffs[k]);
+            out_y = vmlaq_n_s16(out_y, vsubq_s16(bottom_s, top_s), derivative_coeffs[k]);
+        }
+
+        vst1q_s16(gx + x, out_x);
+        vst1q_s16(gy + x, out_y);
+    }
+}
+
+/** Vertical pass of the separable Sobel filter when the gradient size = 7
+ *
+ * @param[in]  derivative Horizontal derivative of the 2 * radius + 1 rows centred on the row to compute. Data type supported S16
+ * @param[in]  smoothing  Horizontal smoothing of the 2 * radius + 1 rows centred on the row to compute. Data type supported S16
+ * @param[out] gx         Gx of the row. Data type supported S32
+ * @param[out] gy         Gy of the row. Data type supported S32
+ * @param[in]  width      Number of pixels to filter. Must be a multiple of 8
+ * @param[in]  radius     Radius of the filter (3)
+ */
+void sobel_vertical(const int16_t *const *derivative, const int16_t *const *smoothing, int32_t *__restrict gx, int32_t *__restrict gy, int width, int radius)
+{
+    const int16_t *derivative_coeffs = sobel_derivative[radius - 1];
+    const int16_t *smoothing_coeffs  = sobel_smoothing[radius - 1];
+
+    for(int x = 0; x < width; x += 8)
+    {
+        const int16x8_t centre_d = vld1q_s16(derivative[radius] + x);
+
+        int32x4_t out_x_low  = vmull_n_s16(vget_low_s16(centre_d), smoothing_coeffs[0]);
+        int32x4_t out_x_high = vmull_n_s16(vget_high_s16(centre_d), smoothing_coeffs[0]);
+        int32x4_t out_y_low  = vdupq_n_s32(0);
+        int32x4_t out_y_high = vdupq_n_s32(0);
+
+        for(int k = 1; k <= radius; ++k)
+        {
+            // The sums and differences of two rows still fit in 16 bits, the vertical pass does not
+            const int16x8_t sum_d  = vaddq_s16(vld1q_s16(derivative[radius - k] + x), vld1q_s16(derivative[radius + k] + x));
+            const int16x8_t diff_s = vsubq_s16(vld1q_s16(smoothing[radius + k] + x), vld1q_s16(smoothing[radius - k] + x));
+
+            out_x_low  = vmlal_n_s16(out_x_low, vget_low_s16(sum_d), smoothing_coeffs[k]);
+            out_x_high = vmlal_n_s16(out_x_high, vget_high_s16(sum_d), smoothing_coeffs[k]);
+            out_y_low  = vmlal_n_s16(out_y_low, vget_low_s16(diff_s), derivative_coeffs[k]);
+            out_y_high = vmlal_n_s16(out_y_high, vget_high_s16(diff_s), derivative_coeffs[k]);
+        }
+
+        vst1q_s32(gx + x, out_x_low);
+        vst1q_s32(gx + x + 4, out_x_high);
+        vst1q_s32(gy + x, out_y_low);
+        vst1q_s32(gy + x + 4, out_y_high);
+    }
+}
+} // namespace
+
+NEEdgeGradientNonMaxSuppressionKernel::NEEdgeGradientNonMaxSuppressionKernel()
+    : _gradient_func(nullptr), _non_max_func(nullptr), _input(nullptr), _output(nullptr), _gradient_size(0), _border_mode(BorderMode::UNDEFINED), _constant_border_value(0), _lower_thr(0), _upper_thr(0)
 {
-    return BorderSize(1);
 }
 
-bool NEEdgeTraceKernel::is_parallelisable() const
+BorderSize NEEdgeGradientNonMaxSuppressionKernel::border_size() const
 {
-    return false;
+    // Radius of the Sobel filter plus the neighbours of the non-maxima suppression
+    return BorderSize(_gradient_size / 2 + 1);
 }
 
-void NEEdgeTraceKernel::configure(ITensor *input, ITensor *output)
+void NEEdgeGradientNonMaxSuppressionKernel::configure(const ITensor *input, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t gradient_size, int32_t norm_type,
+                                                      BorderMode border_mode, uint8_t constant_border_value, bool use_fp16)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON((3 != gradient_size) && (5 != gradient_size) && (7 != gradient_size));
+    ARM_COMPUTE_ERROR_ON(lower_thr > upper_thr);
+
+    _input                 = input;
+    _output                = output;
+    _gradient_size         = gradient_size;
+    _border_mode           = border_mode;
+    _constant_border_value = constant_border_value;
+    _lower_thr             = lower_thr;
+    _upper_thr             = upper_thr;
+
+    if(gradient_size < 7)
+    {
+        if(norm_type == 1)
+        {
+            _gradient_func = &mag_phase_l1norm_S16_S16_U16_U8;
+        }
+        else
+        {
+            _gradient_func = &mag_phase_l2norm_S16_S16_U16_U8;
+        }
+
+        _non_max_func = &non_max_suppression_U16_U8_U8;
+    }
+    else
+    {
+        if(norm_type == 1)
+        {
+            _gradient_func = &mag_phase_l1norm_S32_S32_U32_U8;
+        }
+        else
+        {
+            _gradient_func = &mag_phase_l2norm_S32_S32_U32_U8;
+        }
+
+        _non_max_func = &non_max_suppression_U32_U8_U8;
+    }
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    if(use_fp16)
+    {
+        if(gradient_size < 7)
+        {
+            _gradient_func = (norm_type == 1) ? &fp16::mag_phase_l1norm_S16_S16_U16_U8 : &fp16::mag_phase_l2norm_S16_S16_U16_U8;
+        }
+        else
+        {
+            _gradient_func = (norm_type == 1) ? &fp16::mag_phase_l1norm_S32_S32_U32_U8 : &fp16::mag_phase_l2norm_S32_S32_U32_U8;
+        }
+    }
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+
+    constexpr unsigned int num_elems_processed_per_iteration = 32;
+
+    const bool border_undefined = border_mode == BorderMode::UNDEFINED;
+    const int  radius           = gradient_size / 2;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+
+    // The magnitude is computed on 16 more columns on each side of the window, from radius more columns and rows of the input
+    AccessWindowRectangle  input_access(input->info(), -16 - radius, -1 - radius, num_elems_processed_per_iteration + 32 + 2 * radius, 3 + 2 * radius);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+template <typename T>
+void NEEdgeGradientNonMaxSuppressionKernel::run_gradient_non_max(const Window &window)
+{
+    using MagnitudeType = typename std::make_unsigned<T>::type;
+
+    constexpr int max_radius = 3;
+
+    const int  radius     = _gradient_size / 2;
+    const int  num_lines  = 2 * radius + 1;
+    const int  x_start    = window.x().start();
+    const int  x_end      = window.x().end();
+    const int  y_start    = window.y().start();
+    const int  y_end      = window.y().end();
+    const int  width      = _input->info()->dimension(0);
+    const int  height     = _input->info()->dimension(1);
+    const bool replicate  = _border_mode == BorderMode::REPLICATE;
+    const int  first_col  = x_start - 16;
+    const int  line_width = x_end - x_start + 32;
+
+    // Horizontally filtered input rows: the row r is stored in line r % num_lines
+    int16_t *const hor_derivative = thread_scratch<int16_t>(num_lines * line_width, 0);
+    int16_t *const hor_smoothing  = thread_scratch<int16_t>(num_lines * line_width, 1);
+    int *const     hor_rows       = thread_scratch<int>(num_lines, 2);
+    std::fill_n(hor_rows, num_lines, std::numeric_limits<int>::min());
+
+    std::array<const int16_t *, 2 * max_radius + 1> derivative_rows{ {} };
+    std::array<const int16_t *, 2 * max_radius + 1> smoothing_rows{ {} };
+
+    T *const gx = thread_scratch<T>(line_width, 3);
+    T *const gy = thread_scratch<T>(line_width, 4);
+
+    // Magnitude and phase of the rows y - 1, y and y + 1 of the output row y: the row r is stored in line (r - y_start + 1) % 3
+    MagnitudeType *const magnitude = thread_scratch<MagnitudeType>(3 * line_width, 5);
+    uint8_t *const       phase     = thread_scratch<uint8_t>(3 * line_width, 6);
+
+    auto compute_row = [&](int row, int line)
+    {
+        MagnitudeType *mag = magnitude + line * line_width;
+        uint8_t       *pha = phase + line * line_width;
+
+        // Rows outside of the image are only reached if the border mode is not undefined
+        if(row < 0 || row >= height)
+        {
+            if(!replicate)
+            {
+                std::fill_n(mag, line_width, static_cast<MagnitudeType>(_constant_border_value));
+                return;
+            }
+
+            row = std::min(std::max(row, 0), height - 1);
+        }
+
+        for(int k = -radius; k <= radius; ++k)
+        {
+            const int input_row = row + k;
+            const int hor_line  = ((input_row % num_lines) + num_lines) % num_lines;
+
+            int16_t *derivative = hor_derivative + hor_line * line_width;
+            int16_t *smoothing  = hor_smoothing + hor_line * line_width;
+
+            if(hor_rows[hor_line] != input_row)
+            {
+                sobel_horizontal(_input->buffer() + _input->info()->offset_element_in_bytes(Coordinates(first_col, input_row)), derivative, smoothing, line_width, radius);
+                hor_rows[hor_line] = input_row;
+            }
+
+            derivative_rows[k + radius] = derivative;
+            smoothing_rows[k + radius]  = smoothing;
+        }
+
+        sobel_vertical(derivative_rows.data(), smoothing_rows.data(), gx, gy, line_width, radius);
+
+        for(int x = 0; x < line_width; x += 32)
+        {
+            (*_gradient_func)(gx + x, gy + x, mag + x, pha + x);
+        }
+
+        // Columns -1 and width as if the border of the magnitude was filled
+        if(_border_mode != BorderMode::UNDEFINED)
+        {
+            const int left  = -1 - first_col;
+            const int right = width - first_col;
+
+            if(left >= 0)
+            {
+                mag[left] = replicate ? mag[left + 1] : static_cast<MagnitudeType>(_constant_border_value);
+            }
+
+            if(right < line_width)
+            {
+                mag[right] = replicate ? mag[right - 1] : static_cast<MagnitudeType>(_constant_border_value);
+            }
+        }
+    };
+
+    compute_row(y_start - 1, 0);
+    compute_row(y_start, 1);
+
+    for(int y = y_start; y < y_end; ++y)
+    {
+        const int top    = (y - y_start) % 3;
+        const int middle = (top + 1) % 3;
+        const int bottom = (top + 2) % 3;
+
+        compute_row(y + 1, bottom);
+
+        const MagnitudeType *top_mag    = magnitude + top * line_width + 16;
+        const MagnitudeType *middle_mag = magnitude + middle * line_width + 16;
+        const MagnitudeType *bottom_mag = magnitude + bottom * line_width + 16;
+        const uint8_t       *middle_pha = phase + middle * line_width + 16;
+        uint8_t             *output_ptr = _output->buffer() + _output->info()->offset_element_in_bytes(Coordinates(x_start, y));
+
+        for(int x = 0; x < x_end - x_start; x += 8)
+        {
+            (*_non_max_func)(top_mag + x, middle_mag + x, bottom_mag + x, middle_pha + x, output_ptr + x, _lower_thr, _upper_thr);
+        }
+    }
+}
+
+void NEEdgeGradientNonMaxSuppressionKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_gradient_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(_non_max_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(window.x().step() != 32);
+
+    if(_gradient_size < 7)
+    {
+        run_gradient_non_max<int16_t>(window);
+    }
+    else
+    {
+        run_gradient_non_max<int32_t>(window);
+    }
+}
+
+NEEdgeTraceLabelKernel::NEEdgeTraceLabelKernel()
+    : _input(nullptr), _labels(nullptr)
+{
+}
+
+void NEEdgeTraceLabelKernel::configure(const ITensor *input, ITensor *labels)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(labels, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON(labels->info()->dimension(0) != input->info()->dimension(0) * input->info()->dimension(1) + 1);
 
     _input  = input;
-    _output = output;
+    _labels = labels;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*_input->info(), Steps());
 
-    constexpr unsigned int num_elems_processed_per_iteration = 1;
+    INEKernel::configure(win);
+}
+
+void NEEdgeTraceLabelKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    Iterator input(_input, window);
+
+    auto *const    labels = reinterpret_cast<uint32_t *>(_labels->buffer());
+    const uint32_t width  = _input->info()->dimension(0);
+
+    // Every thread writes the same value
+    __atomic_store_n(labels, 0, __ATOMIC_RELAXED);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint32_t index = 1 + id.y() * width + id.x();
+
+        // Only the labels of the possible edges are read: a MAYBE pixel starts as its own set, an EDGE pixel joins the set of the edges
+        switch(*input.ptr())
+        {
+            case EDGE:
+                labels[index] = 0;
+                break;
+            case MAYBE:
+                labels[index] = index;
+                break;
+            default:
+                break;
+        }
+    },
+    input);
+}
+
+NEEdgeTraceMergeKernel::NEEdgeTraceMergeKernel()
+    : _input(nullptr), _labels(nullptr)
+{
+}
+
+BorderSize NEEdgeTraceMergeKernel::border_size() const
+{
+    return BorderSize(1);
+}
+
+void NEEdgeTraceMergeKernel::configure(const ITensor *input, ITensor *labels)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(labels, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON(labels->info()->dimension(0) != input->info()->dimension(0) * input->info()->dimension(1) + 1);
+
+    _input  = input;
+    _labels = labels;
 
     // Configure kernel window
-    Window win = calculate_max_window(*_input->info(), Steps(num_elems_processed_per_iteration));
+    Window win = calculate_max_window(*_input->info(), Steps());
 
-    const ValidRegion &input_valid_region  = input->info()->valid_region();
-    const ValidRegion &output_valid_region = output->info()->valid_region();
+    const ValidRegion &input_valid_region = input->info()->valid_region();
 
     // Reads can occur within the valid region of the input + border
     AccessWindowStatic input_access(input->info(),
@@ -1786,14 +2021,76 @@ void NEEdgeTraceKernel::configure(ITensor *input, ITensor *output)
                                     input_valid_region.anchor[0] + input_valid_region.shape[0] + border_size().right,
                                     input_valid_region.anchor[1] + input_valid_region.shape[1] + border_size().bottom);
 
-    // Writes can occur within the valid region of the output + border
-    AccessWindowStatic output_access(output->info(),
-                                     output_valid_region.anchor[0] - border_size().left,
-                                     output_valid_region.anchor[1] - border_size().top,
-                                     output_valid_region.anchor[0] + output_valid_region.shape[0] + border_size().right,
-                                     output_valid_region.anchor[1] + output_valid_region.shape[1] + border_size().bottom);
+    update_window_and_padding(win, input_access);
 
-    update_window_and_padding(win, input_access, output_access);
+    INEKernel::configure(win);
+}
+
+void NEEdgeTraceMergeKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    Iterator input(_input, window);
+
+    auto *const    labels       = reinterpret_cast<uint32_t *>(_labels->buffer());
+    const uint32_t width        = _input->info()->dimension(0);
+    const size_t   input_stride = _input->info()->strides_in_bytes()[1];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *in = input.ptr();
+
+        if(*in == NO_EDGE)
+        {
+            return;
+        }
+
+        const uint32_t index = 1 + id.y() * width + id.x();
+
+        // Merging with the neighbours already visited in raster order is enough to connect all the 8-connected pixels.
+        // The border of the input is NO_EDGE, so the neighbours which are merged are always inside the window.
+        if(*(in - 1) != NO_EDGE)
+        {
+            merge_sets(labels, index, index - 1);
+        }
+        if(*(in - input_stride - 1) != NO_EDGE)
+        {
+            merge_sets(labels, index, index - width - 1);
+        }
+        if(*(in - input_stride) != NO_EDGE)
+        {
+            merge_sets(labels, index, index - width);
+        }
+        if(*(in - input_stride + 1) != NO_EDGE)
+        {
+            merge_sets(labels, index, index - width + 1);
+        }
+    },
+    input);
+}
+
+NEEdgeTraceKernel::NEEdgeTraceKernel()
+    : _input(nullptr), _labels(nullptr), _output(nullptr)
+{
+}
+
+void NEEdgeTraceKernel::configure(const ITensor *input, ITensor *labels, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(labels, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(labels->info()->dimension(0) != input->info()->dimension(0) * input->info()->dimension(1) + 1);
+
+    _input  = input;
+    _labels = labels;
+    _output = output;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*_input->info(), Steps());
+
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
+
+    update_window_and_padding(win, output_access);
 
     output_access.set_valid_region(win, _input->info()->valid_region());
 
@@ -1807,12 +2104,15 @@ void NEEdgeTraceKernel::run(const Window &window)
     Iterator input(_input, window);
     Iterator output(_output, window);
 
-    const size_t input_stride  = _input->info()->strides_in_bytes()[1];
-    const size_t output_stride = _output->info()->strides_in_bytes()[1];
+    auto *const    labels = reinterpret_cast<uint32_t *>(_labels->buffer());
+    const uint32_t width  = _input->info()->dimension(0);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        edge_trace_U8_U8(input.ptr(), output.ptr(), input_stride, output_stride);
+        const uint32_t index = 1 + id.y() * width + id.x();
+
+        // A possible edge is an edge if its set contains an EDGE pixel, i.e. if its root is labels[0]
+        *output.ptr() = ((*input.ptr() != NO_EDGE) && (find_root(labels, index) == 0)) ? EDGE : NO_EDGE;
     },
     input, output);
 }
@@ -44,8 +44,7 @@ class Coordinates;
 } // namespace arm_compute
 
 NEChannelCombineKernel::NEChannelCombineKernel()
-    : _func(nullptr), _planes{ { nullptr } }, _output(nullptr), _output_multi(nullptr), _x_subsampling{ { 1, 1, 1 } }, _y_subsampling{ { 1, 1, 1 } }, _num_elems_processed_per_iteration(8),
-_is_parallelizable(true)
+    : _func(nullptr), _planes{ { nullptr } }, _output(nullptr), _output_multi(nullptr), _x_subsampling{ { 1, 1, 1 } }, _y_subsampling{ { 1, 1, 1 } }, _num_elems_processed_per_iteration(8)
 {
 }
 
@@ -75,7 +74,6 @@ void NEChannelCombineKernel::configure(const ITensor *plane0, const ITensor *pla
     _output_multi = nullptr;
 
     _num_elems_processed_per_iteration = 8;
-    _is_parallelizable                 = true;
 
     switch(output_format)
     {
@@ -153,7 +151,6 @@ void NEChannelCombineKernel::configure(const IImage *plane0, const IImage *plane
     unsigned int num_elems_written_plane1 = 8;
 
     _num_elems_processed_per_iteration = 8;
-    _is_parallelizable                 = true;
 
     const Format &output_format = output->info()->format();
 
@@ -168,16 +165,14 @@ void NEChannelCombineKernel::configure(const IImage *plane0, const IImage *plane
             num_elems_written_plane1 = 16;
             break;
         case Format::IYUV:
-            _is_parallelizable = false;
-            _x_subsampling     = { { 1, 2, 2 } };
-            _y_subsampling     = { { 1, 2, 2 } };
-            _func              = &NEChannelCombineKernel::combine_YUV_3p;
+            _x_subsampling = { { 1, 2, 2 } };
+            _y_subsampling = { { 1, 2, 2 } };
+            _func          = &NEChannelCombineKernel::combine_YUV_3p;
             break;
         case Format::YUV444:
-            _is_parallelizable = false;
-            _x_subsampling     = { { 1, 1, 1 } };
-            _y_subsampling     = { { 1, 1, 1 } };
-            _func              = &NEChannelCombineKernel::combine_YUV_3p;
+            _x_subsampling = { { 1, 1, 1 } };
+            _y_subsampling = { { 1, 1, 1 } };
+            _func          = &NEChannelCombineKernel::combine_YUV_3p;
             break;
         default:
             ARM_COMPUTE_ERROR("Not supported format.");
@@ -210,11 +205,6 @@ void NEChannelCombineKernel::configure(const IImage *plane0, const IImage *plane
     INEKernel::configure(win);
 }
 
-bool NEChannelCombineKernel::is_parallelisable() const
-{
-    return _is_parallelizable;
-}
-
 void NEChannelCombineKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -0,0 +1,307 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEChannelLayoutKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Offset in bytes of the first element of the batch pointed to by the dimensions above 2 of @p id */
+inline size_t batch_offset(const ITensor *tensor, const Coordinates &id)
+{
+    size_t offset = tensor->info()->offset_first_element_in_bytes();
+
+    for(size_t d = 3; d < Coordinates::num_max_dimensions; ++d)
+    {
+        offset += id[d] * tensor->info()->strides_in_bytes()[d];
+    }
+
+    return offset;
+}
+
+/** Deinterleave the beginning of a row of 3 or 4 channels with NEON
+ *
+ * @return The number of pixels processed, the rest of the row is left to the caller.
+ */
+inline int deinterleave_neon(const uint8_t *in, uint8_t *const *planes, int width, int channels)
+{
+    int x = 0;
+
+    if(channels == 3)
+    {
+        for(; x <= width - 16; x += 16)
+        {
+            const uint8x16x3_t pixels = vld3q_u8(in + 3 * x);
+            vst1q_u8(planes[0] + x, pixels.val[0]);
+            vst1q_u8(planes[1] + x, pixels.val[1]);
+            vst1q_u8(planes[2] + x, pixels.val[2]);
+        }
+    }
+    else if(channels == 4)
+    {
+        for(; x <= width - 16; x += 16)
+        {
+            const uint8x16x4_t pixels = vld4q_u8(in + 4 * x);
+            vst1q_u8(planes[0] + x, pixels.val[0]);
+            vst1q_u8(planes[1] + x, pixels.val[1]);
+            vst1q_u8(planes[2] + x, pixels.val[2]);
+            vst1q_u8(planes[3] + x, pixels.val[3]);
+        }
+    }
+
+    return x;
+}
+
+inline int deinterleave_neon(const float *in, float *const *planes, int width, int channels)
+{
+    int x = 0;
+
+    if(channels == 3)
+    {
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4x3_t pixels = vld3q_f32(in + 3 * x);
+            vst1q_f32(planes[0] + x, pixels.val[0]);
+            vst1q_f32(planes[1] + x, pixels.val[1]);
+            vst1q_f32(planes[2] + x, pixels.val[2]);
+        }
+    }
+    else if(channels == 4)
+    {
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4x4_t pixels = vld4q_f32(in + 4 * x);
+            vst1q_f32(planes[0] + x, pixels.val[0]);
+            vst1q_f32(planes[1] + x, pixels.val[1]);
+            vst1q_f32(planes[2] + x, pixels.val[2]);
+            vst1q_f32(planes[3] + x, pixels.val[3]);
+        }
+    }
+
+    return x;
+}
+
+/** Interleave the beginning of a row of 3 or 4 planes with NEON
+ *
+ * @return The number of pixels processed, the rest of the row is left to the caller.
+ */
+inline int interleave_neon(uint8_t *const *planes, uint8_t *out, int width, int channels)
+{
+    int x = 0;
+
+    if(channels == 3)
+    {
+        for(; x <= width - 16; x += 16)
+        {
+            const uint8x16x3_t pixels =
+            {
+                {
+                    vld1q_u8(planes[0] + x),
+                    vld1q_u8(planes[1] + x),
+                    vld1q_u8(planes[2] + x)
+                }
+            };
+            vst3q_u8(out + 3 * x, pixels);
+        }
+    }
+    else if(channels == 4)
+    {
+        for(; x <= width - 16; x += 16)
+        {
+            const uint8x16x4_t pixels =
+            {
+                {
+                    vld1q_u8(planes[0] + x),
+                    vld1q_u8(planes[1] + x),
+                    vld1q_u8(planes[2] + x),
+                    vld1q_u8(planes[3] + x)
+                }
+            };
+            vst4q_u8(out + 4 * x, pixels);
+        }
+    }
+
+    return x;
+}
+
+inline int interleave_neon(float *const *planes, float *out, int width, int channels)
+{
+    int x = 0;
+
+    if(channels == 3)
+    {
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4x3_t pixels =
+            {
+                {
+                    vld1q_f32(planes[0] + x),
+                    vld1q_f32(planes[1] + x),
+                    vld1q_f32(planes[2] + x)
+                }
+            };
+            vst3q_f32(out + 3 * x, pixels);
+        }
+    }
+    else if(channels == 4)
+    {
+        for(; x <= width - 4; x += 4)
+        {
+            const float32x4x4_t pixels =
+            {
+                {
+                    vld1q_f32(planes[0] + x),
+                    vld1q_f32(planes[1] + x),
+                    vld1q_f32(planes[2] + x),
+                    vld1q_f32(planes[3] + x)
+                }
+            };
+            vst4q_f32(out + 4 * x, pixels);
+        }
+    }
+
+    return x;
+}
+} // namespace
+
+NEChannelLayoutKernel::NEChannelLayoutKernel()
+    : _input(nullptr), _output(nullptr), _to_planar(true)
+{
+}
+
+void NEChannelLayoutKernel::configure(const ITensor *input, ITensor *output, bool to_planar)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+
+    const TensorInfo  *interleaved       = to_planar ? input->info() : output->info();
+    const TensorShape &interleaved_shape = interleaved->tensor_shape();
+    const TensorShape &planar_shape      = to_planar ? output->info()->tensor_shape() : input->info()->tensor_shape();
+
+    ARM_COMPUTE_ERROR_ON(interleaved_shape[0] != planar_shape[2]);
+    ARM_COMPUTE_ERROR_ON(interleaved_shape[1] != planar_shape[0]);
+    ARM_COMPUTE_ERROR_ON(interleaved_shape[2] != planar_shape[1]);
+    ARM_COMPUTE_ERROR_ON_MSG(interleaved->strides_in_bytes()[1] != interleaved_shape[0] * interleaved->element_size(), "The channels of the interleaved tensor must be contiguous");
+
+    _input     = input;
+    _output    = output;
+    _to_planar = to_planar;
+
+    // Each iteration converts a full row: the X and channel dimensions are handled by the kernel
+    Window win;
+    win.set(Window::DimY, Window::Dimension(0, planar_shape[1], 1));
+
+    for(size_t d = 3; d < Coordinates::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_ERROR_ON(interleaved_shape[d] != planar_shape[d]);
+        win.set(d, Window::Dimension(0, planar_shape[d], 1));
+    }
+
+    ARM_COMPUTE_UNUSED(interleaved_shape);
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+template <typename T>
+void NEChannelLayoutKernel::convert(const Window &window)
+{
+    const ITensor *planar      = _to_planar ? _output : _input;
+    const ITensor *interleaved = _to_planar ? _input : _output;
+
+    const int    width                  = planar->info()->dimension(0);
+    const int    channels               = planar->info()->dimension(2);
+    const size_t planar_row_stride      = planar->info()->strides_in_bytes()[1];
+    const size_t plane_stride           = planar->info()->strides_in_bytes()[2];
+    const size_t interleaved_row_stride = interleaved->info()->strides_in_bytes()[2];
+
+    T **const planes = thread_scratch<T *>(channels);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        uint8_t *const planar_row = planar->buffer() + batch_offset(planar, id) + id.y() * planar_row_stride;
+        const auto     pixels     = reinterpret_cast<T *>(interleaved->buffer() + batch_offset(interleaved, id) + id.y() * interleaved_row_stride);
+
+        for(int c = 0; c < channels; ++c)
+        {
+            planes[c] = reinterpret_cast<T *>(planar_row + c * plane_stride);
+        }
+
+        if(_to_planar)
+        {
+            for(int x = deinterleave_neon(pixels, planes, width, channels); x < width; ++x)
+            {
+                for(int c = 0; c < channels; ++c)
+                {
+                    planes[c][x] = pixels[x * channels + c];
+                }
+            }
+        }
+        else
+        {
+            for(int x = interleave_neon(planes, pixels, width, channels); x < width; ++x)
+            {
+                for(int c = 0; c < channels; ++c)
+                {
+                    pixels[x * channels + c] = planes[c][x];
+                }
+            }
+        }
+    });
+}
+
+void NEChannelLayoutKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    switch(_input->info()->data_type())
+    {
+        case DataType::U8:
+            convert<uint8_t>(window);
+            break;
+        case DataType::F32:
+            convert<float>(window);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            break;
+    }
+}
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -33,23 +34,41 @@
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 
 using namespace arm_compute;
 
 NECol2ImKernel::NECol2ImKernel()
-    : _input(nullptr), _output(nullptr), _convolved_dims()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _convolved_dims(), _act_info()
 {
 }
 
-void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims)
+void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, Col2ImFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &NECol2ImKernel::run_col2im<true, ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &NECol2ImKernel::run_col2im<true, ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &NECol2ImKernel::run_col2im<true, ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &NECol2ImKernel::run_col2im<true, ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &NECol2ImKernel::run_col2im<true, ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &NECol2ImKernel::run_col2im<true, ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &NECol2ImKernel::run_col2im<true, ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &NECol2ImKernel::run_col2im<true, ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &NECol2ImKernel::run_col2im<true, ActivationFunction::TANH> },
+    };
+
     _input          = input;
     _output         = output;
     _convolved_dims = convolved_dims;
+    _act_info       = act_info;
+    _func           = act_info.enabled() ? act_map[act_info.activation()] : &NECol2ImKernel::run_col2im<false, ActivationFunction::LINEAR>;
 
     // Configure kernel window
     Window win = calculate_max_window(*input->info(), Steps());
@@ -60,11 +79,9 @@ void NECol2ImKernel::configure(const ITensor *input, ITensor *output, std::pair<
     INEKernel::configure(win);
 }
 
-void NECol2ImKernel::run(const Window &window)
+template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+void NECol2ImKernel::run_col2im(const Window &window)
 {
-    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
-
     const int output_stride_x = _output->info()->strides_in_bytes().x();
     const int output_stride_y = _output->info()->strides_in_bytes().y();
     const int output_stride_z = _output->info()->strides_in_bytes().z();
@@ -74,6 +91,9 @@ void NECol2ImKernel::run(const Window &window)
     window_out.set(Window::DimY, Window::Dimension(0, 1, 0));
     window_out.set(Window::DimZ, Window::Dimension(0, 1, 0));
 
+    const float a = _act_info.a();
+    const float b = _act_info.b();
+
     // Create iterators
     Iterator in(_input, window);
     Iterator out(_output, window_out);
@@ -83,7 +103,23 @@ void NECol2ImKernel::run(const Window &window)
         const int hidx = id.y();
         const int idx  = id.x() * output_stride_z + (hidx / _convolved_dims.first) * output_stride_y + (hidx % _convolved_dims.first) * output_stride_x;
 
-        *(reinterpret_cast<float *>(out.ptr() + idx)) = *(reinterpret_cast<const float *>(in.ptr()));
+        const float value = *(reinterpret_cast<const float *>(in.ptr()));
+
+        *(reinterpret_cast<float *>(out.ptr() + idx)) = has_activation ? activate<F>(value, a, b) : value;
     },
     in, out);
 }
+
+void NECol2ImKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+SchedulingPolicy NECol2ImKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
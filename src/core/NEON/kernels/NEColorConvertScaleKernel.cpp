@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEColorConvertScaleKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IMultiImage.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/NEON/NEColorConvertHelper.inl"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstring>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+constexpr unsigned int num_rows_processed_per_iteration  = 2;
+
+/** Compute the two input neighbours of each output coordinate along one dimension, and the weight of the second one out of 128
+ *
+ * Output coordinates past @p out_size reuse the neighbours of the last one.
+ */
+template <typename T>
+void compute_taps(unsigned int in_size, unsigned int out_size, size_t num_out, size_t stride, std::vector<T> &offsets0, std::vector<T> &offsets1, std::vector<uint8_t> &weights)
+{
+    const float scale = static_cast<float>(in_size) / static_cast<float>(out_size);
+
+    offsets0.resize(num_out);
+    offsets1.resize(num_out);
+    weights.resize(num_out);
+
+    for(size_t i = 0; i < num_out; ++i)
+    {
+        const float  coord = std::min(std::max((std::min<size_t>(i, out_size - 1) + 0.5f) * scale - 0.5f, 0.f), static_cast<float>(in_size - 1));
+        const size_t i0    = static_cast<size_t>(coord);
+        const size_t i1    = std::min<size_t>(i0 + 1, in_size - 1);
+
+        offsets0[i] = static_cast<T>(i0 * stride);
+        offsets1[i] = static_cast<T>(i1 * stride);
+        weights[i]  = static_cast<uint8_t>(std::lround((coord - i0) * 128.f));
+    }
+}
+
+/** Interpolate between two vectors with weights out of 128 */
+inline uint8x16_t lerp(const uint8x16_t &a, const uint8x16_t &b, const uint8x16_t &wa, const uint8x16_t &wb)
+{
+    const uint16x8_t low  = vmlal_u8(vmull_u8(vget_low_u8(a), vget_low_u8(wa)), vget_low_u8(b), vget_low_u8(wb));
+    const uint16x8_t high = vmlal_u8(vmull_u8(vget_high_u8(a), vget_high_u8(wa)), vget_high_u8(b), vget_high_u8(wb));
+
+    return vcombine_u8(vrshrn_n_u16(low, 7), vrshrn_n_u16(high, 7));
+}
+
+/** Bilinearly interpolate 16 consecutive output pixels of a row from the input
+ *
+ * @param[in] row0       Pointer to the top input row of the output row
+ * @param[in] row1       Pointer to the bottom input row of the output row
+ * @param[in] weight_y   Weight of @p row1 out of 128
+ * @param[in] offsets_x0 Byte offsets of the left input neighbours of the 16 pixels
+ * @param[in] offsets_x1 Byte offsets of the right input neighbours of the 16 pixels
+ * @param[in] weights_x  Weights of the right input neighbours of the 16 pixels out of 128
+ *
+ * @return The R, G and B channels of the 16 pixels
+ */
+inline uint8x16x3_t resample_rgb(const uint8_t *row0, const uint8_t *row1, uint8_t weight_y, const uint32_t *offsets_x0, const uint32_t *offsets_x1, const uint8_t *weights_x)
+{
+    // Gather the four neighbours of each pixel so that they can be deinterleaved and blended 16 at a time
+    uint8_t taps[4][3 * num_elems_processed_per_iteration];
+
+    for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i)
+    {
+        std::memcpy(taps[0] + 3 * i, row0 + offsets_x0[i], 3);
+        std::memcpy(taps[1] + 3 * i, row0 + offsets_x1[i], 3);
+        std::memcpy(taps[2] + 3 * i, row1 + offsets_x0[i], 3);
+        std::memcpy(taps[3] + 3 * i, row1 + offsets_x1[i], 3);
+    }
+
+    const uint8x16x3_t top_left     = vld3q_u8(taps[0]);
+    const uint8x16x3_t top_right    = vld3q_u8(taps[1]);
+    const uint8x16x3_t bottom_left  = vld3q_u8(taps[2]);
+    const uint8x16x3_t bottom_right = vld3q_u8(taps[3]);
+
+    const uint8x16_t wx1 = vld1q_u8(weights_x);
+    const uint8x16_t wx0 = vsubq_u8(vdupq_n_u8(128), wx1);
+    const uint8x16_t wy1 = vdupq_n_u8(weight_y);
+    const uint8x16_t wy0 = vdupq_n_u8(128 - weight_y);
+
+    uint8x16x3_t rgb;
+
+    for(int c = 0; c < 3; ++c)
+    {
+        const uint8x16_t top    = lerp(top_left.val[c], top_right.val[c], wx0, wx1);
+        const uint8x16_t bottom = lerp(bottom_left.val[c], bottom_right.val[c], wx0, wx1);
+        rgb.val[c]              = lerp(top, bottom, wy0, wy1);
+    }
+
+    return rgb;
+}
+} // namespace
+
+NEColorConvertScaleKernel::NEColorConvertScaleKernel()
+    : _input(nullptr), _output(nullptr), _offsets_x0(), _offsets_x1(), _weights_x(), _offsets_y0(), _offsets_y1(), _weights_y()
+{
+}
+
+void NEColorConvertScaleKernel::configure(const IImage *input, IMultiImage *output)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::RGB888, Format::RGBA8888);
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+    ARM_COMPUTE_ERROR_ON(output->info()->format() != Format::NV12);
+    ARM_COMPUTE_ERROR_ON((output->info()->width() % 2) != 0 || (output->info()->height() % 2) != 0);
+
+    _input  = input;
+    _output = output;
+
+    TensorInfo *y_info  = output->plane(0)->info();
+    TensorInfo *uv_info = output->plane(1)->info();
+
+    const unsigned int width  = output->info()->width();
+    const unsigned int height = output->info()->height();
+
+    compute_taps(input->info()->dimension(0), width, ceil_to_multiple(width, num_elems_processed_per_iteration), input->info()->element_size(), _offsets_x0, _offsets_x1, _weights_x);
+    compute_taps(input->info()->dimension(1), height, height, input->info()->strides_in_bytes().y(), _offsets_y0, _offsets_y1, _weights_y);
+
+    // The last columns of the rows are stored through a local buffer, so no padding is needed on either image
+    Window win = calculate_max_window(*y_info, Steps(num_elems_processed_per_iteration, num_rows_processed_per_iteration));
+
+    y_info->set_valid_region(ValidRegion(Coordinates(), y_info->tensor_shape()));
+    uv_info->set_valid_region(ValidRegion(Coordinates(), uv_info->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEColorConvertScaleKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    ITensor *y_plane  = _output->plane(0);
+    ITensor *uv_plane = _output->plane(1);
+
+    const uint8_t *in_base  = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const size_t   y_stride = y_plane->info()->strides_in_bytes().y();
+    const int      width    = y_plane->info()->dimension(0);
+
+    // UV's width and height are subsampled
+    Window win_uv(window);
+    win_uv.set(Window::DimX, Window::Dimension(win_uv.x().start() / 2, win_uv.x().end() / 2, win_uv.x().step() / 2));
+    win_uv.set(Window::DimY, Window::Dimension(win_uv.y().start() / 2, win_uv.y().end() / 2, 1));
+    win_uv.validate_on_run();
+
+    Iterator out_y(y_plane, window);
+    Iterator out_uv(uv_plane, win_uv);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int x = id.x();
+        const int y = id.y();
+
+        const uint8x16x3_t rgb_top = resample_rgb(in_base + _offsets_y0[y], in_base + _offsets_y1[y], _weights_y[y],
+                                                  _offsets_x0.data() + x, _offsets_x1.data() + x, _weights_x.data() + x);
+        const uint8x16x3_t rgb_bottom = resample_rgb(in_base + _offsets_y0[y + 1], in_base + _offsets_y1[y + 1], _weights_y[y + 1],
+                                                     _offsets_x0.data() + x, _offsets_x1.data() + x, _weights_x.data() + x);
+
+        const int num_valid = std::min<int>(num_elems_processed_per_iteration, width - x);
+
+        if(num_valid == static_cast<int>(num_elems_processed_per_iteration))
+        {
+            store_rgb_to_nv12(rgb_top.val[0], rgb_top.val[1], rgb_top.val[2],
+                              rgb_bottom.val[0], rgb_bottom.val[1], rgb_bottom.val[2],
+                              out_y.ptr(), out_y.ptr() + y_stride, out_uv.ptr());
+        }
+        else
+        {
+            // The interleaved UV of a pair of columns takes as many bytes as their luma
+            uint8_t y_top[num_elems_processed_per_iteration];
+            uint8_t y_bottom[num_elems_processed_per_iteration];
+            uint8_t uv[num_elems_processed_per_iteration];
+
+            store_rgb_to_nv12(rgb_top.val[0], rgb_top.val[1], rgb_top.val[2],
+                              rgb_bottom.val[0], rgb_bottom.val[1], rgb_bottom.val[2],
+                              y_top, y_bottom, uv);
+
+            std::memcpy(out_y.ptr(), y_top, num_valid);
+            std::memcpy(out_y.ptr() + y_stride, y_bottom, num_valid);
+            std::memcpy(out_uv.ptr(), uv, num_valid);
+        }
+    },
+    out_y, out_uv);
+}
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NEConvolutionKernel.h"
 
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -38,6 +39,7 @@
 #include <array>
 #include <cstdint>
 #include <cstring>
+#include <limits>
 #include <tuple>
 
 using namespace arm_compute;
@@ -46,6 +48,13 @@ namespace
 {
 const uint16x8_t max_int16 = vdupq_n_u16(INT16_MAX);
 
+/** Saturate a scaled convolution result to the output type, the same way store_results() does */
+template <typename T>
+inline T saturate_result(int32_t value)
+{
+    return static_cast<T>(std::min<int32_t>(std::max<int32_t>(value, std::numeric_limits<T>::lowest()), std::numeric_limits<T>::max()));
+}
+
 inline void store_results(const int32x4_t &out, const int32x4_t &out2, int16_t *output)
 {
     const int16x8_t s16results = vcombine_s16(vqmovn_s32(out),
@@ -310,14 +319,15 @@ inline void convolve_row9x1(int32x4_t &out, int32x4_t &out2, const uint8x16_t &r
 
 template <unsigned int matrix_size>
 NEConvolutionKernel<matrix_size>::NEConvolutionKernel()
-    : INESimpleKernel(), _scale(0), _convolution{ {} }
+    : INESimpleKernel(), _scale(0), _convolution{ {} }, _border_mode(BorderMode::UNDEFINED), _constant_border_value(0)
 {
 }
 
 template <unsigned int matrix_size>
 BorderSize             NEConvolutionKernel<matrix_size>::border_size() const
 {
-    return BorderSize(matrix_size / 2);
+    // The kernel reads clamped coordinates when it handles the border itself
+    return (_border_mode == BorderMode::UNDEFINED) ? BorderSize(matrix_size / 2) : BorderSize(0);
 }
 
 template <unsigned int matrix_size>
@@ -327,8 +337,10 @@ void NEConvolutionKernel<matrix_size>::configure(const ITensor *input, ITensor *
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
     ARM_COMPUTE_ERROR_ON(conv == nullptr);
 
-    _input  = input;
-    _output = output;
+    _input                 = input;
+    _output                = output;
+    _border_mode           = BorderMode::UNDEFINED;
+    _constant_border_value = 0;
 
     std::copy_n(conv, _convolution.size(), _convolution.begin());
 
@@ -358,6 +370,117 @@ void NEConvolutionKernel<matrix_size>::configure(const ITensor *input, ITensor *
     INEKernel::configure(win);
 }
 
+template <unsigned int matrix_size>
+void NEConvolutionKernel<matrix_size>::configure(const ITensor *input, ITensor *output, const int16_t *conv, uint32_t scale, BorderMode border_mode, uint8_t constant_border_value)
+{
+    configure(input, output, conv, scale, border_mode == BorderMode::UNDEFINED);
+
+    if(border_mode == BorderMode::UNDEFINED)
+    {
+        return;
+    }
+
+    _border_mode           = border_mode;
+    _constant_border_value = constant_border_value;
+
+    // Every pixel is computed and nothing is read or written outside of the tensors
+    Window                 win = calculate_max_window(*input->info(), Steps());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
+
+    update_window_and_padding(win, AccessWindowHorizontal(input->info(), 0, 1), output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region());
+
+    INEKernel::configure(win);
+}
+
+template <unsigned int matrix_size>
+template <typename OutputType>
+void NEConvolutionKernel<matrix_size>::convolution_with_border(const Window &win)
+{
+    constexpr int half = matrix_size / 2;
+
+    const int width  = _input->info()->dimension(0);
+    const int height = _input->info()->dimension(1);
+
+    // The vector path reads 16 pixels starting half of the matrix on the left of its first output and writes 8 outputs:
+    // only run it where all of them are inside the image
+    const int last_vector_x      = std::min(width + half - 16, width - half - 8);
+    const int num_vector_elems   = (last_vector_x >= half) ? ((last_vector_x - half) / 8 + 1) * 8 : 0;
+    const int first_vector_row   = std::max(win.y().start(), half);
+    const int end_vector_row     = std::min(win.y().end(), height - half);
+    const int end_vector_columns = half + num_vector_elems;
+
+    if(num_vector_elems > 0 && first_vector_row < end_vector_row)
+    {
+        Window win_vector(win);
+        win_vector.set(Window::DimX, Window::Dimension(half, end_vector_columns, 8));
+        win_vector.set(Window::DimY, Window::Dimension(first_vector_row, end_vector_row, 1));
+
+        convolution<OutputType>(win_vector);
+    }
+
+    // Compute the remaining pixels one by one, with the same arithmetic as the vector path
+    const float  scale  = 1.0f / _scale;
+    const size_t stride = _input->info()->strides_in_bytes()[1];
+
+    Window win_rows(win);
+    win_rows.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_rows);
+    Iterator output(_output, win_rows);
+
+    execute_window_loop(win_rows, [&](const Coordinates & id)
+    {
+        const int  y          = id.y();
+        const bool vector_row = y >= first_vector_row && y < end_vector_row && num_vector_elems > 0;
+        const auto out_ptr    = reinterpret_cast<OutputType *>(output.ptr());
+
+        for(int x = win.x().start(); x < win.x().end(); ++x)
+        {
+            if(vector_row && x == half)
+            {
+                x = end_vector_columns - 1;
+                continue;
+            }
+
+            int32_t sum = 0;
+
+            for(int j = 0; j < static_cast<int>(matrix_size); ++j)
+            {
+                const int yy = y + j - half;
+
+                for(int i = 0; i < static_cast<int>(matrix_size); ++i)
+                {
+                    const int xx = x + i - half;
+                    int32_t   pixel;
+
+                    if(_border_mode == BorderMode::CONSTANT && (xx < 0 || xx >= width || yy < 0 || yy >= height))
+                    {
+                        pixel = _constant_border_value;
+                    }
+                    else
+                    {
+                        const int cx = std::min(std::max(xx, 0), width - 1);
+                        const int cy = std::min(std::max(yy, 0), height - 1);
+                        pixel        = *(input.ptr() + (cy - y) * static_cast<int>(stride) + cx);
+                    }
+
+                    sum += _convolution[j * matrix_size + i] * pixel;
+                }
+            }
+
+            if(_scale != 1)
+            {
+                sum = static_cast<int32_t>(static_cast<float>(sum) * scale);
+            }
+
+            out_ptr[x] = saturate_result<OutputType>(sum);
+        }
+    },
+    input, output);
+}
+
 #ifndef DOXYGEN_SKIP_THIS /* Doxygen gets confused by the templates and can't match the implementation to the declaration */
 template <>
 template <typename OutputType>
@@ -624,6 +747,22 @@ void NEConvolutionKernel<matrix_size>::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    if(_border_mode != BorderMode::UNDEFINED)
+    {
+        switch(_output->info()->format())
+        {
+            case Format::U8:
+                convolution_with_border<uint8_t>(window);
+                break;
+            case Format::S16:
+                convolution_with_border<int16_t>(window);
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Not supported");
+        }
+        return;
+    }
+
     switch(_output->info()->format())
     {
         case Format::U8:
@@ -1401,6 +1540,331 @@ template class arm_compute::NESeparableConvolutionVertKernel<5>;
 template class arm_compute::NESeparableConvolutionVertKernel<7>;
 template class arm_compute::NESeparableConvolutionVertKernel<9>;
 
+namespace
+{
+/* Horizontal pass of one intermediate row: the arithmetic matches NESeparableConvolutionHorKernel */
+inline void convolve_row_hor(const uint8_t *input, uint16_t *output, const int16_t *conv_row, unsigned int size, int width)
+{
+    for(int x = 0; x < width; x += 8)
+    {
+        uint16x8_t out = vmulq_n_u16(vmovl_u8(vld1_u8(input + x)), conv_row[0]);
+
+        for(unsigned int k = 1; k < size; ++k)
+        {
+            out = vmlaq_n_u16(out, vmovl_u8(vld1_u8(input + x + k)), conv_row[k]);
+        }
+
+        vst1q_u16(output + x, out);
+    }
+}
+
+inline void convolve_row_hor(const uint8_t *input, int16_t *output, const int16_t *conv_row, unsigned int size, int width)
+{
+    for(int x = 0; x < width; x += 8)
+    {
+        int16x8_t out = vmulq_n_s16(vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x))), conv_row[0]);
+
+        for(unsigned int k = 1; k < size; ++k)
+        {
+            out = vmlaq_n_s16(out, vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x + k))), conv_row[k]);
+        }
+
+        vst1q_s16(output + x, out);
+    }
+}
+
+inline void convolve_row_hor(const uint8_t *input, int32_t *output, const int16_t *conv_row, unsigned int size, int width)
+{
+    for(int x = 0; x < width; x += 8)
+    {
+        const int16x8_t data = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x)));
+
+        int32x4_t out_low  = vmull_n_s16(vget_low_s16(data), conv_row[0]);
+        int32x4_t out_high = vmull_n_s16(vget_high_s16(data), conv_row[0]);
+
+        for(unsigned int k = 1; k < size; ++k)
+        {
+            const int16x8_t data_k = vreinterpretq_s16_u16(vmovl_u8(vld1_u8(input + x + k)));
+
+            out_low  = vmlal_n_s16(out_low, vget_low_s16(data_k), conv_row[k]);
+            out_high = vmlal_n_s16(out_high, vget_high_s16(data_k), conv_row[k]);
+        }
+
+        vst1q_s32(output + x, out_low);
+        vst1q_s32(output + x + 4, out_high);
+    }
+}
+
+/* Vertical pass of 16 output values: the arithmetic matches NESeparableConvolutionVertKernel */
+template <typename OutputType>
+inline void convolve_col_vert(const uint16_t *const *rows, int x, const int16_t *conv_col, unsigned int size, uint32_t scale, const float32x4_t &oneoverscale, OutputType *output)
+{
+    uint16x8_t out0 = vdupq_n_u16(0);
+    uint16x8_t out1 = vdupq_n_u16(0);
+
+    for(unsigned int r = 0; r < size; ++r)
+    {
+        out0 = vmlaq_n_u16(out0, vld1q_u16(rows[r] + x), conv_col[r]);
+        out1 = vmlaq_n_u16(out1, vld1q_u16(rows[r] + x + 8), conv_col[r]);
+    }
+
+    if(scale != 1)
+    {
+        const float32x4_t out0_f32_low  = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(out0))), oneoverscale);
+        const float32x4_t out0_f32_high = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(out0))), oneoverscale);
+        store_results(vcvtq_u32_f32(out0_f32_low), vcvtq_u32_f32(out0_f32_high), output);
+
+        const float32x4_t out1_f32_low  = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(out1))), oneoverscale);
+        const float32x4_t out1_f32_high = vmulq_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(out1))), oneoverscale);
+        store_results(vcvtq_u32_f32(out1_f32_low), vcvtq_u32_f32(out1_f32_high), output + 8);
+    }
+    else
+    {
+        store_results(out0, out1, output);
+    }
+}
+
+template <typename OutputType>
+inline void convolve_col_vert(const int16_t *const *rows, int x, const int16_t *conv_col, unsigned int size, uint32_t scale, const float32x4_t &oneoverscale, OutputType *output)
+{
+    int16x8_t out0 = vdupq_n_s16(0);
+    int16x8_t out1 = vdupq_n_s16(0);
+
+    for(unsigned int r = 0; r < size; ++r)
+    {
+        out0 = vmlaq_n_s16(out0, vld1q_s16(rows[r] + x), conv_col[r]);
+        out1 = vmlaq_n_s16(out1, vld1q_s16(rows[r] + x + 8), conv_col[r]);
+    }
+
+    if(scale != 1)
+    {
+        const float32x4_t out0_f32_low  = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(out0))), oneoverscale);
+        const float32x4_t out0_f32_high = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(out0))), oneoverscale);
+        store_results(vcvtq_s32_f32(out0_f32_low), vcvtq_s32_f32(out0_f32_high), output);
+
+        const float32x4_t out1_f32_low  = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(out1))), oneoverscale);
+        const float32x4_t out1_f32_high = vmulq_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(out1))), oneoverscale);
+        store_results(vcvtq_s32_f32(out1_f32_low), vcvtq_s32_f32(out1_f32_high), output + 8);
+    }
+    else
+    {
+        store_results(out0, out1, output);
+    }
+}
+
+template <typename OutputType>
+inline void convolve_col_vert(const int32_t *const *rows, int x, const int16_t *conv_col, unsigned int size, uint32_t scale, const float32x4_t &oneoverscale, OutputType *output)
+{
+    int32x4x4_t out =
+    {
+        {
+            vdupq_n_s32(0),
+            vdupq_n_s32(0),
+            vdupq_n_s32(0),
+            vdupq_n_s32(0)
+        }
+    };
+
+    for(unsigned int r = 0; r < size; ++r)
+    {
+        for(unsigned int i = 0; i < 4; ++i)
+        {
+            out.val[i] = vmlaq_n_s32(out.val[i], vld1q_s32(rows[r] + x + 4 * i), conv_col[r]);
+        }
+    }
+
+    if(scale != 1)
+    {
+        for(unsigned int i = 0; i < 4; ++i)
+        {
+            out.val[i] = vcvtq_s32_f32(vmulq_f32(vcvtq_f32_s32(out.val[i]), oneoverscale));
+        }
+    }
+
+    store_results(out.val[0], out.val[1], output);
+    store_results(out.val[2], out.val[3], output + 8);
+}
+
+/** Run both passes of a separable convolution on the given window, one band of rows at a time
+ *
+ * @param[in]  input    Source tensor. Data type supported: U8.
+ * @param[out] output   Destination tensor, Data types supported: U8, S16.
+ * @param[in]  win      Window to apply the convolution on.
+ * @param[in]  conv_row Horizontal convolution coefficients.
+ * @param[in]  cols     Number of horizontal coefficients.
+ * @param[in]  conv_col Vertical convolution coefficients.
+ * @param[in]  rows     Number of vertical coefficients.
+ * @param[in]  scale    Scale of the convolution matrix.
+ */
+template <typename IntermediateType, typename OutputType>
+void separable_convolution(const ITensor *input, ITensor *output, const Window &win, const int16_t *conv_row, unsigned int cols, const int16_t *conv_col, unsigned int rows, uint32_t scale)
+{
+    static_assert(sizeof(OutputType) == sizeof(uint8_t) || sizeof(OutputType) == sizeof(int16_t), "The output buffer can only be u8 or s16");
+
+    const int half_x  = cols / 2;
+    const int half_y  = rows / 2;
+    const int start_x = win.x().start();
+    const int end_x   = win.x().end();
+    const int start_y = win.y().start();
+    const int end_y   = win.y().end();
+    const int width   = end_x - start_x;
+
+    // Ring of the last rows produced by the horizontal pass: row y lives in slot (y - start_y + half_y) % rows
+    IntermediateType *const ring = thread_scratch<IntermediateType>(rows * width, 0);
+
+    const float32x4_t oneoverscale = vdupq_n_f32(1.0f / scale);
+
+    const auto convolve_row = [&](int y)
+    {
+        const unsigned int slot = (y - start_y + half_y) % rows;
+        convolve_row_hor(input->ptr_to_element(Coordinates(start_x - half_x, y)), ring + slot * width, conv_row, cols, width);
+    };
+
+    for(int y = start_y - half_y; y < start_y + half_y; ++y)
+    {
+        convolve_row(y);
+    }
+
+    const IntermediateType **const row_ptrs = thread_scratch<const IntermediateType *>(rows, 1);
+
+    for(int y = start_y; y < end_y; ++y)
+    {
+        convolve_row(y + half_y);
+
+        // Rows y - half_y to y + half_y
+        for(unsigned int r = 0; r < rows; ++r)
+        {
+            row_ptrs[r] = ring + ((y - start_y + r) % rows) * width;
+        }
+
+        auto out_ptr = reinterpret_cast<OutputType *>(output->ptr_to_element(Coordinates(start_x, y)));
+
+        for(int x = 0; x < width; x += 16)
+        {
+            convolve_col_vert(row_ptrs, x, conv_col, rows, scale, oneoverscale, out_ptr + x);
+        }
+    }
+}
+
+/** Run a separable convolution with the given intermediate data type and the data type of the output
+ *
+ * @param[in]  intermediate_type Data type of the rows produced by the horizontal pass: U16, S16 or S32.
+ * @param[in]  input             Source tensor. Data type supported: U8.
+ * @param[out] output            Destination tensor, Data types supported: U8, S16.
+ * @param[in]  win               Window to apply the convolution on.
+ * @param[in]  conv_row          Horizontal convolution coefficients.
+ * @param[in]  cols              Number of horizontal coefficients.
+ * @param[in]  conv_col          Vertical convolution coefficients.
+ * @param[in]  rows              Number of vertical coefficients.
+ * @param[in]  scale             Scale of the convolution matrix.
+ */
+void run_separable_convolution(DataType intermediate_type, const ITensor *input, ITensor *output, const Window &win, const int16_t *conv_row, unsigned int cols, const int16_t *conv_col,
+                               unsigned int rows, uint32_t scale)
+{
+    const bool output_u8 = (output->info()->data_type() == DataType::U8);
+
+    ARM_COMPUTE_ERROR_ON(!output_u8 && output->info()->data_type() != DataType::S16);
+
+    switch(intermediate_type)
+    {
+        case DataType::U16:
+            if(output_u8)
+            {
+                separable_convolution<uint16_t, uint8_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            else
+            {
+                separable_convolution<uint16_t, int16_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            break;
+        case DataType::S16:
+            if(output_u8)
+            {
+                separable_convolution<int16_t, uint8_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            else
+            {
+                separable_convolution<int16_t, int16_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            break;
+        case DataType::S32:
+            if(output_u8)
+            {
+                separable_convolution<int32_t, uint8_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            else
+            {
+                separable_convolution<int32_t, int16_t>(input, output, win, conv_row, cols, conv_col, rows, scale);
+            }
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported intermediate data type!");
+            break;
+    }
+}
+} // namespace
+
+template <unsigned int matrix_size>
+NESeparableConvolutionKernel<matrix_size>::NESeparableConvolutionKernel()
+    : _conv_row{ { 0 } }, _conv_col{ { 0 } }, _scale(0), _intermediate_type(DataType::UNKNOWN)
+{
+}
+
+template <unsigned int matrix_size>
+BorderSize             NESeparableConvolutionKernel<matrix_size>::border_size() const
+{
+    return BorderSize(matrix_size / 2);
+}
+
+template <unsigned int matrix_size>
+void NESeparableConvolutionKernel<matrix_size>::configure(const ITensor *input, ITensor *output, const int16_t *conv_row, const int16_t *conv_col, uint32_t scale, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    ARM_COMPUTE_ERROR_ON(conv_row == nullptr);
+    ARM_COMPUTE_ERROR_ON(conv_col == nullptr);
+    ARM_COMPUTE_ERROR_ON(scale == 0);
+
+    _input  = input;
+    _output = output;
+    std::copy_n(conv_row, _conv_row.size(), _conv_row.begin());
+    std::copy_n(conv_col, _conv_col.size(), _conv_col.begin());
+
+    // The vertical pass accumulates in the intermediate type as well: wrapping partial sums are fine as long as the final sum fits
+    std::tie(std::ignore, _intermediate_type) = data_type_for_convolution(_conv_col.data(), _conv_row.data(), matrix_size);
+
+    _scale = scale;
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    constexpr unsigned int num_elems_read_per_iteration      = num_elems_processed_per_iteration + matrix_size - 1;
+    constexpr unsigned int num_elems_written_per_iteration   = 16;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, matrix_size),
+                              output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+template <unsigned int matrix_size>
+void NESeparableConvolutionKernel<matrix_size>::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    run_separable_convolution(_intermediate_type, _input, _output, window, _conv_row.data(), matrix_size, _conv_col.data(), matrix_size, _scale);
+}
+
+template class arm_compute::NESeparableConvolutionKernel<5>;
+template class arm_compute::NESeparableConvolutionKernel<7>;
+template class arm_compute::NESeparableConvolutionKernel<9>;
+
 /****************************************************************************************\
  *                                 Rectangle Convolution                                *
 \****************************************************************************************/
@@ -1606,3 +2070,64 @@ void NEConvolutionRectangleKernel::convolution(const Window &win)
     },
     input, output);
 }
+
+NESeparableConvolutionRectangleKernel::NESeparableConvolutionRectangleKernel()
+    : _conv_row{ { 0 } }, _conv_col{ { 0 } }, _width(0), _height(0), _scale(0), _intermediate_type(DataType::UNKNOWN), _border_size(0)
+{
+}
+
+BorderSize NESeparableConvolutionRectangleKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NESeparableConvolutionRectangleKernel::configure(const ITensor *input, ITensor *output, const int16_t *conv_row, uint32_t width, const int16_t *conv_col, uint32_t height, uint32_t scale,
+                                                      bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    ARM_COMPUTE_ERROR_ON(conv_row == nullptr);
+    ARM_COMPUTE_ERROR_ON(conv_col == nullptr);
+    ARM_COMPUTE_ERROR_ON(3 != width && 5 != width && 7 != width && 9 != width);
+    ARM_COMPUTE_ERROR_ON(3 != height && 5 != height && 7 != height && 9 != height);
+    ARM_COMPUTE_ERROR_ON(scale == 0);
+
+    _input       = input;
+    _output      = output;
+    _width       = width;
+    _height      = height;
+    _scale       = scale;
+    _border_size = BorderSize(height / 2, width / 2);
+
+    _conv_row.fill(0);
+    _conv_col.fill(0);
+    std::copy_n(conv_row, width, _conv_row.begin());
+    std::copy_n(conv_col, height, _conv_col.begin());
+
+    // The zero padding of the shorter vector doesn't change the range of the intermediate and final sums
+    std::tie(std::ignore, _intermediate_type) = data_type_for_convolution(_conv_col.data(), _conv_row.data(), max_matrix_size);
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    constexpr unsigned int num_elems_written_per_iteration   = 16;
+    const unsigned int     num_elems_read_per_iteration      = num_elems_processed_per_iteration + width - 1;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, _border_size);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -_border_size.left, -_border_size.top, num_elems_read_per_iteration, height),
+                              output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, _border_size);
+
+    INEKernel::configure(win);
+}
+
+void NESeparableConvolutionRectangleKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    run_separable_convolution(_intermediate_type, _input, _output, window, _conv_row.data(), _width, _conv_col.data(), _height, _scale);
+}
@@ -27,31 +27,56 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
+#include <cstring>
+
 using namespace arm_compute;
 
 NEConvolutionLayerWeightsReshapeKernel::NEConvolutionLayerWeightsReshapeKernel()
-    : _input(nullptr), _bias(nullptr), _output(nullptr), _has_bias(false)
+    : _input(nullptr), _bias(nullptr), _output(nullptr), _has_bias(false), _transpose_width(0)
 {
 }
 
-void NEConvolutionLayerWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output)
+void NEConvolutionLayerWeightsReshapeKernel::configure(const ITensor *input, const ITensor *bias, ITensor *output, unsigned int transpose_width)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     if(bias != nullptr)
     {
-        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(bias, 1, DataType::F16, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, bias);
     }
     ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 4);
-    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 2);
-    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != input->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 3);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::WIDTH))
+                         != input->info()->dimension(get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::HEIGHT)));
+
+    const unsigned int num_groups        = output->info()->dimension(2);
+    const unsigned int kernels_per_group = input->info()->dimension(3) / num_groups;
+    const unsigned int mat_rows          = input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2) + ((bias != nullptr) ? 1 : 0);
+
+    if(transpose_width == 0)
+    {
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) * num_groups != input->info()->dimension(3));
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != mat_rows);
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON((input->info()->dimension(3) % num_groups) != 0);
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != mat_rows * transpose_width);
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != ceil_to_multiple(kernels_per_group, transpose_width) / transpose_width);
+    }
+    ARM_COMPUTE_UNUSED(kernels_per_group);
+    ARM_COMPUTE_UNUSED(mat_rows);
 
-    _input    = input;
-    _bias     = bias;
-    _output   = output;
-    _has_bias = (bias != nullptr);
+    _input           = input;
+    _bias            = bias;
+    _output          = output;
+    _has_bias        = (bias != nullptr);
+    _transpose_width = transpose_width;
 
     // Configure kernel
     Window window = calculate_max_window(*input->info(), Steps());
@@ -70,35 +95,47 @@ void NEConvolutionLayerWeightsReshapeKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    const unsigned int kernel_size     = _input->info()->dimension(0);
-    const unsigned int kernel_depth    = _input->info()->dimension(2);
-    const unsigned int input_stride_x  = _input->info()->strides_in_bytes().x();
-    const unsigned int input_stride_y  = _input->info()->strides_in_bytes().y();
-    const unsigned int input_stride_z  = _input->info()->strides_in_bytes().z();
-    const unsigned int output_stride_y = _output->info()->strides_in_bytes().y();
+    // The kernels are linearized in memory order, which is the order of the rows of im2col for both layouts: [kernel_x, kernel_y, IFM] or [IFM, kernel_x, kernel_y]
+    const unsigned int kernel_dim0       = _input->info()->dimension(0);
+    const unsigned int kernel_dim1       = _input->info()->dimension(1);
+    const unsigned int kernel_dim2       = _input->info()->dimension(2);
+    const unsigned int input_stride_x    = _input->info()->strides_in_bytes().x();
+    const unsigned int input_stride_y    = _input->info()->strides_in_bytes().y();
+    const unsigned int input_stride_z    = _input->info()->strides_in_bytes().z();
+    const size_t       element_size      = _input->info()->element_size();
+    const unsigned int num_groups        = _output->info()->dimension(2);
+    const int          kernels_per_group = _input->info()->dimension(3) / num_groups;
+    const unsigned int mat_rows          = kernel_dim0 * kernel_dim1 * kernel_dim2 + (_has_bias ? 1 : 0);
+    const int          transpose_width   = _transpose_width;
+
+    // In the 1xW transposed layout, consecutive elements of a linearized kernel are transpose_width elements apart on the same row
+    const unsigned int output_stride_y = (transpose_width == 0) ? _output->info()->strides_in_bytes().y() : transpose_width * element_size;
 
     // Create iterators
     Iterator in(_input, window);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        // Get column index
+        // Get column index, the kernels of each group of convolution are stored in their own plane
         const int kernel_idx = id[3];
+        const int column     = kernel_idx % kernels_per_group;
+        const int group      = kernel_idx / kernels_per_group;
 
         // Setup pointers
         auto tmp_input_ptr        = in.ptr();
-        auto tmp_output_ptr       = _output->ptr_to_element(Coordinates(kernel_idx, 0));
+        auto tmp_output_ptr       = (transpose_width == 0) ? _output->ptr_to_element(Coordinates(column, 0, group)) :
+                                    _output->ptr_to_element(Coordinates(column % transpose_width, column / transpose_width, group));
         auto curr_input_row_ptr   = tmp_input_ptr;
         auto curr_input_depth_ptr = tmp_input_ptr;
 
         // Linearize volume
-        for(unsigned int d = 0; d < kernel_depth; ++d)
+        for(unsigned int d = 0; d < kernel_dim2; ++d)
         {
-            for(unsigned int j = 0; j < kernel_size; ++j)
+            for(unsigned int j = 0; j < kernel_dim1; ++j)
             {
-                for(unsigned int i = 0; i < kernel_size; ++i)
+                for(unsigned int i = 0; i < kernel_dim0; ++i)
                 {
-                    *(reinterpret_cast<float *>(tmp_output_ptr)) = *(reinterpret_cast<float *>(tmp_input_ptr));
+                    std::memcpy(tmp_output_ptr, tmp_input_ptr, element_size);
                     tmp_input_ptr += input_stride_x;
                     tmp_output_ptr += output_stride_y;
                 }
@@ -113,7 +150,20 @@ void NEConvolutionLayerWeightsReshapeKernel::run(const Window &window)
         // Add bias
         if(_has_bias)
         {
-            *(reinterpret_cast<float *>(tmp_output_ptr)) = *(reinterpret_cast<float *>(_bias->ptr_to_element(Coordinates(kernel_idx, 0))));
+            std::memcpy(tmp_output_ptr, _bias->ptr_to_element(Coordinates(kernel_idx, 0)), element_size);
+        }
+
+        // Clear the columns of the last block of the group which don't hold any kernel, so that the matrix multiplication only reads initialised values
+        if((transpose_width != 0) && (column == kernels_per_group - 1))
+        {
+            for(int c = column + 1; (c % transpose_width) != 0; ++c)
+            {
+                uint8_t *pad_ptr = _output->ptr_to_element(Coordinates(c % transpose_width, c / transpose_width, group));
+                for(unsigned int r = 0; r < mat_rows; ++r, pad_ptr += output_stride_y)
+                {
+                    std::memset(pad_ptr, 0, element_size);
+                }
+            }
         }
     },
     in);
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NECropResizeKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Bilinear sampling of one output coordinate along one dimension */
+struct Sample
+{
+    int   first;  /**< First input coordinate sampled */
+    int   next;   /**< Offset of the second input coordinate sampled: 0 or 1 */
+    float weight; /**< Weight of the second coordinate */
+};
+
+/** Compute the samples of the outputs of a resized window along one dimension
+ *
+ * @param[in]  start       First input coordinate of the window, clamped to the input.
+ * @param[in]  length      Length of the window in the input, clamped to the input.
+ * @param[in]  input_size  Size of the input along the dimension.
+ * @param[out] samples     Samples to compute, one per output coordinate.
+ * @param[in]  num_samples Number of output coordinates.
+ */
+void compute_samples(int start, int length, int input_size, Sample *samples, size_t num_samples)
+{
+    const float scale = static_cast<float>(length) / num_samples;
+
+    for(size_t i = 0; i < num_samples; ++i)
+    {
+        // Align the centres of the input and output pixels
+        const float in   = std::min(std::max(start + (i + 0.5f) * scale - 0.5f, 0.f), static_cast<float>(input_size - 1));
+        const int   in_0 = static_cast<int>(in);
+
+        samples[i].first  = in_0;
+        samples[i].next   = std::min(in_0 + 1, input_size - 1) - in_0;
+        samples[i].weight = in - in_0;
+    }
+}
+} // namespace
+
+NECropResizeKernel::NECropResizeKernel()
+    : _input(nullptr), _windows(nullptr), _output(nullptr), _mean(0.f), _scale(1.f)
+{
+}
+
+void NECropResizeKernel::configure(const IImage *input, const IDetectionWindowArray *windows, ITensor *output, float mean, float scale)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::U8, Format::RGB888);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(windows == nullptr || windows->max_num_values() == 0);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != num_channels_from_format(input->info()->format()));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(3) != windows->max_num_values());
+
+    _input   = input;
+    _windows = windows;
+    _output  = output;
+    _mean    = mean;
+    _scale   = scale;
+
+    // The samples depend on the window: the kernel runs over whole windows and splits the rows of the output among the threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, windows->max_num_values(), 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NECropResizeKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int    width        = _input->info()->dimension(0);
+    const int    height       = _input->info()->dimension(1);
+    const int    num_channels = _output->info()->dimension(2);
+    const size_t in_stride_y  = _input->info()->strides_in_bytes()[1];
+    const float  mean         = _mean;
+    const float  scale        = _scale;
+
+    const uint8_t *const in_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    const size_t  num_x_samples = _output->info()->dimension(0);
+    const size_t  num_y_samples = _output->info()->dimension(1);
+    Sample *const x_samples     = thread_scratch<Sample>(num_x_samples, 0);
+    Sample *const y_samples     = thread_scratch<Sample>(num_y_samples, 1);
+
+    const int window_end = std::min<int>(window.z().end(), _windows->num_values());
+
+    for(int n = window.z().start(); n < window_end; ++n)
+    {
+        const DetectionWindow &dw = _windows->at(n);
+
+        // Clamp the window to the image, keeping at least one pixel
+        const int x_start = std::min<int>(dw.x, width - 1);
+        const int y_start = std::min<int>(dw.y, height - 1);
+        const int x_end   = std::max(std::min<int>(dw.x + dw.width, width), x_start + 1);
+        const int y_end   = std::max(std::min<int>(dw.y + dw.height, height), y_start + 1);
+
+        compute_samples(x_start, x_end - x_start, width, x_samples, num_x_samples);
+        compute_samples(y_start, y_end - y_start, height, y_samples, num_y_samples);
+
+        for(int y = window.y().start(); y < window.y().end(); ++y)
+        {
+            const Sample &sy = y_samples[y];
+
+            const uint8_t *const row_0 = in_base + sy.first * in_stride_y;
+            const uint8_t *const row_1 = row_0 + sy.next * in_stride_y;
+
+            for(int c = 0; c < num_channels; ++c)
+            {
+                auto out_ptr = reinterpret_cast<float *>(_output->ptr_to_element(Coordinates(0, y, c, n)));
+
+                for(size_t x = 0; x < num_x_samples; ++x)
+                {
+                    const Sample &sx = x_samples[x];
+
+                    const int   offset_0 = sx.first * num_channels + c;
+                    const int   offset_1 = offset_0 + sx.next * num_channels;
+                    const float top      = row_0[offset_0] + sx.weight * (row_0[offset_1] - row_0[offset_0]);
+                    const float bottom   = row_1[offset_0] + sx.weight * (row_1[offset_1] - row_1[offset_0]);
+
+                    out_ptr[x] = (top + sy.weight * (bottom - top) - mean) * scale;
+                }
+            }
+        }
+    }
+}
@@ -39,7 +39,7 @@ class Coordinates;
 } // namespace arm_compute
 
 NEDepthConvertKernel::NEDepthConvertKernel()
-    : _policy(), _shift(0)
+    : _policy(), _shift(0), _scale(1.f), _offset(0.f)
 {
 }
 
@@ -74,6 +74,30 @@ void NEDepthConvertKernel::configure(const ITensor *input, ITensor *output, Conv
 
     _policy = policy;
     _shift  = shift;
+    _scale  = 1.f;
+    _offset = 0.f;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    INESimpleKernel::configure(input, output, num_elems_processed_per_iteration);
+}
+
+void NEDepthConvertKernel::configure(const ITensor *input, ITensor *output, float scale, float offset)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(input == output);
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == output->info()->data_type(), "Input and output data_types must be different");
+
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::U8 && output->info()->data_type() != DataType::F32,
+                             "Only data_types supported [in] U8 -> [out] F32");
+
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F16 && output->info()->data_type() != DataType::F32,
+                             "Only data_types supported [in] F16 -> [out] F32");
+
+    _policy = ConvertPolicy::SATURATE;
+    _shift  = 0;
+    _scale  = scale;
+    _offset = offset;
 
     constexpr unsigned int num_elems_processed_per_iteration = 16;
     INESimpleKernel::configure(input, output, num_elems_processed_per_iteration);
@@ -163,6 +187,34 @@ void NEDepthConvertKernel::run(const Window &window)
                     input, output);
                     break;
                 }
+                case DataType::F32:
+                {
+                    const float32x4_t scale  = vdupq_n_f32(_scale);
+                    const float32x4_t offset = vdupq_n_f32(_offset);
+
+                    /* Up-conversion U8 -> F32 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const uint8x16_t texels_u8 = vld1q_u8(input.ptr());
+
+                        const uint16x8x2_t texels =
+                        {
+                            {
+                                vmovl_u8(vget_low_u8(texels_u8)),
+                                vmovl_u8(vget_high_u8(texels_u8))
+                            }
+                        };
+
+                        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+                        vst1q_f32(output_ptr, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(texels.val[0]))), scale));
+                        vst1q_f32(output_ptr + 4, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(texels.val[0]))), scale));
+                        vst1q_f32(output_ptr + 8, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(texels.val[1]))), scale));
+                        vst1q_f32(output_ptr + 12, vmlaq_f32(offset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(texels.val[1]))), scale));
+                    },
+                    input, output);
+                    break;
+                }
                 default:
                     ARM_COMPUTE_ERROR("Output data type not supported");
             }
@@ -311,6 +363,101 @@ void NEDepthConvertKernel::run(const Window &window)
             }
             break;
         }
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        case DataType::F16:
+        {
+            const float32x4_t scale  = vdupq_n_f32(_scale);
+            const float32x4_t offset = vdupq_n_f32(_offset);
+
+            switch(_output->info()->data_type())
+            {
+                case DataType::F32:
+                {
+                    /* Up-conversion F16 -> F32 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const auto input_ptr  = reinterpret_cast<const float16_t *>(input.ptr());
+                        const auto output_ptr = reinterpret_cast<float *>(output.ptr());
+
+                        const float16x8x2_t texels =
+                        {
+                            {
+                                vld1q_f16(input_ptr),
+                                vld1q_f16(input_ptr + 8)
+                            }
+                        };
+
+                        vst1q_f32(output_ptr, vmlaq_f32(offset, vcvt_f32_f16(vget_low_f16(texels.val[0])), scale));
+                        vst1q_f32(output_ptr + 4, vmlaq_f32(offset, vcvt_f32_f16(vget_high_f16(texels.val[0])), scale));
+                        vst1q_f32(output_ptr + 8, vmlaq_f32(offset, vcvt_f32_f16(vget_low_f16(texels.val[1])), scale));
+                        vst1q_f32(output_ptr + 12, vmlaq_f32(offset, vcvt_f32_f16(vget_high_f16(texels.val[1])), scale));
+                    },
+                    input, output);
+                    break;
+                }
+                default:
+                    ARM_COMPUTE_ERROR("Output data type not supported");
+            }
+            break;
+        }
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+        case DataType::F32:
+        {
+            const float32x4_t scale  = vdupq_n_f32(_scale);
+            const float32x4_t offset = vdupq_n_f32(_offset);
+
+            switch(_output->info()->data_type())
+            {
+                case DataType::U8:
+                {
+                    const float32x4_t half = vdupq_n_f32(0.5f);
+
+                    /* Down-conversion F32 -> U8: the conversion to U32 saturates the negative values to 0, the narrowing ones saturate the values above 255 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const auto input_ptr = reinterpret_cast<const float *>(input.ptr());
+
+                        const uint32x4x4_t texels =
+                        {
+                            {
+                                vcvtq_u32_f32(vaddq_f32(vmlaq_f32(offset, vld1q_f32(input_ptr), scale), half)),
+                                vcvtq_u32_f32(vaddq_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 4), scale), half)),
+                                vcvtq_u32_f32(vaddq_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 8), scale), half)),
+                                vcvtq_u32_f32(vaddq_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 12), scale), half))
+                            }
+                        };
+
+                        const uint16x8_t texels_low  = vcombine_u16(vqmovn_u32(texels.val[0]), vqmovn_u32(texels.val[1]));
+                        const uint16x8_t texels_high = vcombine_u16(vqmovn_u32(texels.val[2]), vqmovn_u32(texels.val[3]));
+
+                        vst1q_u8(output.ptr(), vcombine_u8(vqmovn_u16(texels_low), vqmovn_u16(texels_high)));
+                    },
+                    input, output);
+                    break;
+                }
+#ifdef ARM_COMPUTE_ENABLE_FP16
+                case DataType::F16:
+                {
+                    /* Down-conversion F32 -> F16 */
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const auto input_ptr  = reinterpret_cast<const float *>(input.ptr());
+                        const auto output_ptr = reinterpret_cast<float16_t *>(output.ptr());
+
+                        vst1q_f16(output_ptr, vcombine_f16(vcvt_f16_f32(vmlaq_f32(offset, vld1q_f32(input_ptr), scale)),
+                                                           vcvt_f16_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 4), scale))));
+                        vst1q_f16(output_ptr + 8, vcombine_f16(vcvt_f16_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 8), scale)),
+                                                               vcvt_f16_f32(vmlaq_f32(offset, vld1q_f32(input_ptr + 12), scale))));
+                    },
+                    input, output);
+                    break;
+                }
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+                default:
+                    ARM_COMPUTE_ERROR("Output data type not supported");
+            }
+            break;
+        }
         default:
             ARM_COMPUTE_ERROR("Not supported");
     }
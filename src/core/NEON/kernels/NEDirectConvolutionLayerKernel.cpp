@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Load 4 input values spaced by the stride of the convolution
+ *
+ * @note With a stride of 2, 8 values are read.
+ */
+template <unsigned int stride>
+inline float32x4_t load_input(const float *ptr);
+
+template <>
+inline float32x4_t load_input<1>(const float *ptr)
+{
+    return vld1q_f32(ptr);
+}
+
+template <>
+inline float32x4_t load_input<2>(const float *ptr)
+{
+    return vld2q_f32(ptr).val[0];
+}
+
+/** Accumulate the contribution of one row of the input multiplied by one row of the kernel into an output row
+ *
+ * out[x] += sum(weights[k] * in[x * stride - pad_x + k]) for k in [0, kernel_size), where the values of the input outside [0, input_width) are zero.
+ *
+ * @param[in]     in           Input row.
+ * @param[in]     weights      Row of the kernel.
+ * @param[in,out] out          Output row.
+ * @param[in]     pad_x        Padding on the left of the input row.
+ * @param[in]     input_width  Number of elements in the input row.
+ * @param[in]     output_width Number of elements in the output row.
+ */
+template <unsigned int kernel_size, unsigned int stride>
+inline void convolve_row(const float *in, const float *weights, float *out, int pad_x, int input_width, int output_width)
+{
+    // Outputs near the edges, some taps of which fall in the padding
+    const auto convolve_edge = [&](int x)
+    {
+        float acc = 0.f;
+        for(unsigned int k = 0; k < kernel_size; ++k)
+        {
+            const int ix = x * static_cast<int>(stride) - pad_x + static_cast<int>(k);
+            if(ix >= 0 && ix < input_width)
+            {
+                acc += weights[k] * in[ix];
+            }
+        }
+        out[x] += acc;
+    };
+
+    // First output whose taps are all inside the row and first output from which 4 outputs can't be loaded without reading past the end of the row
+    // (load_input<2> reads one element more than needed)
+    const int vec_start = std::min(output_width, (pad_x + static_cast<int>(stride) - 1) / static_cast<int>(stride));
+    const int last_read = input_width + pad_x - static_cast<int>(kernel_size) - static_cast<int>(stride) + 1 - 3 * static_cast<int>(stride);
+    const int vec_end   = last_read < 0 ? vec_start : std::max(vec_start, std::min(output_width, last_read / static_cast<int>(stride) + 4));
+
+    float32x4_t w[kernel_size];
+    for(unsigned int k = 0; k < kernel_size; ++k)
+    {
+        w[k] = vdupq_n_f32(weights[k]);
+    }
+
+    int x = 0;
+    for(; x < vec_start; ++x)
+    {
+        convolve_edge(x);
+    }
+
+    for(; x + 4 <= vec_end; x += 4)
+    {
+        const float *in_ptr = in + x * static_cast<int>(stride) - pad_x;
+        float32x4_t  acc    = vld1q_f32(out + x);
+        for(unsigned int k = 0; k < kernel_size; ++k)
+        {
+            acc = vmlaq_f32(acc, load_input<stride>(in_ptr + k), w[k]);
+        }
+        vst1q_f32(out + x, acc);
+    }
+
+    for(; x < output_width; ++x)
+    {
+        convolve_edge(x);
+    }
+}
+
+/** Apply an activation function to an output row */
+template <ActivationLayerInfo::ActivationFunction F>
+void activate_row(float *row, int width, float a, float b)
+{
+    const float32x4_t va = vdupq_n_f32(a);
+    const float32x4_t vb = vdupq_n_f32(b);
+
+    int x = 0;
+    for(; x <= width - 4; x += 4)
+    {
+        vst1q_f32(row + x, vactivateq_f32<F>(vld1q_f32(row + x), va, vb));
+    }
+    for(; x < width; ++x)
+    {
+        row[x] = activate<F>(row[x], a, b);
+    }
+}
+} // namespace
+
+NEDirectConvolutionLayerKernel::NEDirectConvolutionLayerKernel()
+    : _func(nullptr), _act_func(nullptr), _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _conv_info(), _act_info()
+{
+}
+
+bool NEDirectConvolutionLayerKernel::is_supported(unsigned int kernel_size, const PadStrideInfo &conv_info)
+{
+    unsigned int stride_x = 0;
+    unsigned int stride_y = 0;
+    unsigned int pad_x    = 0;
+    unsigned int pad_y    = 0;
+    std::tie(stride_x, stride_y) = conv_info.stride();
+    std::tie(pad_x, pad_y)       = conv_info.pad();
+
+    const bool is_kernel_supported = (kernel_size == 1) || (kernel_size == 3) || (kernel_size == 5);
+    const bool is_stride_supported = (stride_x == stride_y) && (stride_x == 1 || stride_x == 2);
+
+    return is_kernel_supported && is_stride_supported && (pad_x < kernel_size) && (pad_y < kernel_size);
+}
+
+void NEDirectConvolutionLayerKernel::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                               const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) != weights->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(3) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(!is_supported(weights->info()->dimension(0), conv_info));
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(3));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    const unsigned int kernel_size = weights->info()->dimension(0);
+    unsigned int       stride_x    = 0;
+    unsigned int       stride_y    = 0;
+    std::tie(stride_x, stride_y) = conv_info.stride();
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel_size,
+                                                 stride_x, stride_y, conv_info.pad().first, conv_info.pad().second, conv_info.round());
+    ARM_COMPUTE_UNUSED(conv_w);
+    ARM_COMPUTE_UNUSED(conv_h);
+    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &activate_row<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &activate_row<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &activate_row<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &activate_row<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &activate_row<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &activate_row<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &activate_row<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &activate_row<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &activate_row<ActivationFunction::TANH> },
+    };
+
+    _input     = input;
+    _weights   = weights;
+    _biases    = biases;
+    _output    = output;
+    _conv_info = conv_info;
+    _act_info  = act_info;
+    _act_func  = act_info.enabled() ? act_map[act_info.activation()] : nullptr;
+
+    // Select the specialised convolution function
+    switch(kernel_size)
+    {
+        case 1:
+            _func = (stride_x == 1) ? &NEDirectConvolutionLayerKernel::convolve<1, 1> : &NEDirectConvolutionLayerKernel::convolve<1, 2>;
+            break;
+        case 3:
+            _func = (stride_x == 1) ? &NEDirectConvolutionLayerKernel::convolve<3, 1> : &NEDirectConvolutionLayerKernel::convolve<3, 2>;
+            break;
+        case 5:
+            _func = (stride_x == 1) ? &NEDirectConvolutionLayerKernel::convolve<5, 1> : &NEDirectConvolutionLayerKernel::convolve<5, 2>;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported kernel size");
+            break;
+    }
+
+    // Configure kernel window: each iteration computes a whole output row
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The kernel only reads the valid region of the input and writes whole rows so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+template <unsigned int kernel_size, unsigned int stride>
+void NEDirectConvolutionLayerKernel::convolve(const Window &window)
+{
+    const int input_width  = _input->info()->dimension(0);
+    const int input_height = _input->info()->dimension(1);
+    const int num_ifm      = _input->info()->dimension(2);
+    const int output_width = _output->info()->dimension(0);
+    const int pad_x        = _conv_info.pad().first;
+    const int pad_y        = _conv_info.pad().second;
+
+    const size_t input_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w   = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes()[2];
+    const size_t weights_stride_w = _weights->info()->strides_in_bytes()[3];
+
+    const uint8_t *const input_ptr   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *const weights_ptr = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+
+    const float a = _act_info.a();
+    const float b = _act_info.b();
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int y     = id.y();
+        const int ofm   = id.z();
+        const int batch = id[3];
+
+        const auto out_row = reinterpret_cast<float *>(out.ptr());
+
+        const float bias = (_biases != nullptr) ? *reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(ofm))) : 0.f;
+        std::fill_n(out_row, output_width, bias);
+
+        // Rows of the kernel which fall inside the input
+        const int ky_start = std::max(0, pad_y - y * static_cast<int>(stride));
+        const int ky_end   = std::min(static_cast<int>(kernel_size), input_height + pad_y - y * static_cast<int>(stride));
+
+        const uint8_t *const input_batch_ptr = input_ptr + batch * input_stride_w;
+        const uint8_t *const weights_ofm_ptr = weights_ptr + ofm * weights_stride_w;
+
+        for(int ifm = 0; ifm < num_ifm; ++ifm)
+        {
+            for(int ky = ky_start; ky < ky_end; ++ky)
+            {
+                const int iy = y * static_cast<int>(stride) - pad_y + ky;
+
+                const auto in_row      = reinterpret_cast<const float *>(input_batch_ptr + ifm * input_stride_z + iy * input_stride_y);
+                const auto weights_row = reinterpret_cast<const float *>(weights_ofm_ptr + ifm * weights_stride_z + ky * weights_stride_y);
+
+                convolve_row<kernel_size, stride>(in_row, weights_row, out_row, pad_x, input_width, output_width);
+            }
+        }
+
+        if(_act_func != nullptr)
+        {
+            _act_func(out_row, output_width, a, b);
+        }
+    },
+    out);
+}
+
+void NEDirectConvolutionLayerKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+SchedulingPolicy NEDirectConvolutionLayerKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
+
+bool NEDirectConvolutionLayerKernel::is_compute_bound() const
+{
+    return true;
+}
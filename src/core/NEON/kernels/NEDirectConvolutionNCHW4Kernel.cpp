@@ -0,0 +1,301 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEDirectConvolutionNCHW4Kernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of feature maps of a block */
+constexpr int block_size = 4;
+
+/** Accumulate the products of the 4 input feature maps of an element with their weights for 4 output feature maps
+ *
+ * @param[in] acc Accumulators of the 4 output feature maps.
+ * @param[in] in  Values of the 4 input feature maps.
+ * @param[in] w   Weights of each input feature map for the 4 output feature maps.
+ *
+ * @return The updated accumulators.
+ */
+inline float32x4_t mla_block(float32x4_t acc, const float32x4_t &in, const float32x4x4_t &w)
+{
+    acc = vmlaq_lane_f32(acc, w.val[0], vget_low_f32(in), 0);
+    acc = vmlaq_lane_f32(acc, w.val[1], vget_low_f32(in), 1);
+    acc = vmlaq_lane_f32(acc, w.val[2], vget_high_f32(in), 0);
+    return vmlaq_lane_f32(acc, w.val[3], vget_high_f32(in), 1);
+}
+
+/** Load the 16 weights connecting a block of input feature maps to a block of output feature maps */
+inline float32x4x4_t load_weights(const float *ptr)
+{
+    const float32x4x4_t w =
+    {
+        {
+            vld1q_f32(ptr),
+            vld1q_f32(ptr + 4),
+            vld1q_f32(ptr + 8),
+            vld1q_f32(ptr + 12)
+        }
+    };
+    return w;
+}
+
+/** Apply an activation function to an output row */
+template <ActivationLayerInfo::ActivationFunction F>
+void activate_row(float *row, int width, float a, float b)
+{
+    const float32x4_t va = vdupq_n_f32(a);
+    const float32x4_t vb = vdupq_n_f32(b);
+
+    // The rows of a blocked tensor hold 4 values per element: their width is a multiple of 4
+    for(int x = 0; x < width; x += 4)
+    {
+        vst1q_f32(row + x, vactivateq_f32<F>(vld1q_f32(row + x), va, vb));
+    }
+}
+} // namespace
+
+NEDirectConvolutionNCHW4Kernel::NEDirectConvolutionNCHW4Kernel()
+    : _act_func(nullptr), _input(nullptr), _weights(nullptr), _biases(nullptr), _output(nullptr), _conv_info(), _act_info()
+{
+}
+
+void NEDirectConvolutionNCHW4Kernel::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                               const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    ARM_COMPUTE_ERROR_ON((input->info()->data_layout() != DataLayout::NCHW4) || (output->info()->data_layout() != DataLayout::NCHW4));
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(0) % (block_size * block_size)) != 0);
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(0) / (block_size * block_size) != weights->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(3) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON((biases->info()->dimension(0) + block_size - 1) / block_size != output->info()->dimension(2));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0) / block_size, input->info()->dimension(1), weights->info()->dimension(1),
+                                                 conv_info.stride().first, conv_info.stride().second, conv_info.pad().first, conv_info.pad().second, conv_info.round());
+    ARM_COMPUTE_UNUSED(conv_w);
+    ARM_COMPUTE_UNUSED(conv_h);
+    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w * block_size) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &activate_row<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &activate_row<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &activate_row<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &activate_row<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &activate_row<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &activate_row<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &activate_row<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &activate_row<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &activate_row<ActivationFunction::TANH> },
+    };
+
+    _input     = input;
+    _weights   = weights;
+    _biases    = biases;
+    _output    = output;
+    _conv_info = conv_info;
+    _act_info  = act_info;
+    _act_func  = act_info.enabled() ? act_map[act_info.activation()] : nullptr;
+
+    // Configure kernel window: each iteration computes a whole output row of a block of output feature maps
+    Window win = calculate_max_window(*output->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The kernel only reads the valid region of the input and writes whole rows so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEDirectConvolutionNCHW4Kernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int input_width  = _input->info()->dimension(0) / block_size;
+    const int input_height = _input->info()->dimension(1);
+    const int num_blocks   = _input->info()->dimension(2);
+    const int output_width = _output->info()->dimension(0) / block_size;
+    const int kernel_size  = _weights->info()->dimension(1);
+    const int num_ofm      = (_biases != nullptr) ? _biases->info()->dimension(0) : 0;
+    const int stride_x     = _conv_info.stride().first;
+    const int stride_y     = _conv_info.stride().second;
+    const int pad_x        = _conv_info.pad().first;
+    const int pad_y        = _conv_info.pad().second;
+
+    const size_t input_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w   = _input->info()->strides_in_bytes()[3];
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes()[2];
+    const size_t weights_stride_w = _weights->info()->strides_in_bytes()[3];
+
+    const uint8_t *const input_ptr   = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    const uint8_t *const weights_ptr = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+
+    const float a = _act_info.a();
+    const float b = _act_info.b();
+
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int y     = id.y();
+        const int ob    = id.z();
+        const int batch = id[3];
+
+        const auto out_row = reinterpret_cast<float *>(out.ptr());
+
+        // The missing output feature maps of the last block have a zero bias
+        std::array<float, block_size> bias{ { 0.f } };
+        for(int o = 0; o < block_size && ob * block_size + o < num_ofm; ++o)
+        {
+            bias[o] = *reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(ob * block_size + o)));
+        }
+        const float32x4_t vbias = vld1q_f32(bias.data());
+
+        // Rows of the kernel which fall inside the input
+        const int iy       = y * stride_y - pad_y;
+        const int ky_start = std::max(0, -iy);
+        const int ky_end   = std::min(kernel_size, input_height - iy);
+
+        const uint8_t *const input_batch_ptr = input_ptr + batch * input_stride_w;
+        const uint8_t *const weights_ob_ptr  = weights_ptr + ob * weights_stride_w;
+
+        int x = 0;
+        while(x < output_width)
+        {
+            const int ix = x * stride_x - pad_x;
+
+            if((ix >= 0) && (x + 3 < output_width) && ((x + 3) * stride_x - pad_x + kernel_size <= input_width))
+            {
+                // The kernel columns of 4 consecutive output elements fall inside the input: share the loads of the weights
+                float32x4_t acc0 = vbias;
+                float32x4_t acc1 = vbias;
+                float32x4_t acc2 = vbias;
+                float32x4_t acc3 = vbias;
+
+                for(int ib = 0; ib < num_blocks; ++ib)
+                {
+                    for(int ky = ky_start; ky < ky_end; ++ky)
+                    {
+                        const auto in_row      = reinterpret_cast<const float *>(input_batch_ptr + ib * input_stride_z + (iy + ky) * input_stride_y) + block_size * ix;
+                        const auto weights_row = reinterpret_cast<const float *>(weights_ob_ptr + ib * weights_stride_z + ky * weights_stride_y);
+
+                        for(int kx = 0; kx < kernel_size; ++kx)
+                        {
+                            const float32x4x4_t w  = load_weights(weights_row + block_size * block_size * kx);
+                            const float        *in = in_row + block_size * kx;
+
+                            acc0 = mla_block(acc0, vld1q_f32(in), w);
+                            acc1 = mla_block(acc1, vld1q_f32(in + block_size * stride_x), w);
+                            acc2 = mla_block(acc2, vld1q_f32(in + 2 * block_size * stride_x), w);
+                            acc3 = mla_block(acc3, vld1q_f32(in + 3 * block_size * stride_x), w);
+                        }
+                    }
+                }
+
+                vst1q_f32(out_row + block_size * x, acc0);
+                vst1q_f32(out_row + block_size * (x + 1), acc1);
+                vst1q_f32(out_row + block_size * (x + 2), acc2);
+                vst1q_f32(out_row + block_size * (x + 3), acc3);
+                x += 4;
+            }
+            else
+            {
+                // Columns of the kernel which fall inside the input
+                const int kx_start = std::max(0, -ix);
+                const int kx_end   = std::min(kernel_size, input_width - ix);
+
+                float32x4_t acc = vbias;
+
+                for(int ib = 0; ib < num_blocks; ++ib)
+                {
+                    for(int ky = ky_start; ky < ky_end; ++ky)
+                    {
+                        const auto in_row      = reinterpret_cast<const float *>(input_batch_ptr + ib * input_stride_z + (iy + ky) * input_stride_y);
+                        const auto weights_row = reinterpret_cast<const float *>(weights_ob_ptr + ib * weights_stride_z + ky * weights_stride_y);
+
+                        for(int kx = kx_start; kx < kx_end; ++kx)
+                        {
+                            acc = mla_block(acc, vld1q_f32(in_row + block_size * (ix + kx)), load_weights(weights_row + block_size * block_size * kx));
+                        }
+                    }
+                }
+
+                vst1q_f32(out_row + block_size * x, acc);
+                ++x;
+            }
+        }
+
+        if(_act_func != nullptr)
+        {
+            _act_func(out_row, output_width * block_size, a, b);
+        }
+    },
+    out);
+}
+
+SchedulingPolicy NEDirectConvolutionNCHW4Kernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
+
+bool NEDirectConvolutionNCHW4Kernel::is_compute_bound() const
+{
+    return true;
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEEqualizeHistogramKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEHistogramHelper.inl"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <numeric>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEEqualizeHistogramKernel::num_bins;
+constexpr unsigned int NEEqualizeHistogramKernel::num_banks;
+
+NEEqualizeHistogramKernel::NEEqualizeHistogramKernel()
+    : _input(nullptr), _output(nullptr), _local_hist(), _num_threads(1), _num_arrived(0), _mutex(), _all_arrived()
+{
+}
+
+void NEEqualizeHistogramKernel::configure(const IImage *input, IImage *output)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(output);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input  = input;
+    _output = output;
+
+    // Each iteration handles a full row so that the histogram never counts padding pixels, and no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEEqualizeHistogramKernel::begin_reduction(unsigned int num_threads)
+{
+    _local_hist.reset(num_threads, std::array<uint32_t, num_banks * num_bins> { {} });
+    _num_threads = num_threads;
+    _num_arrived = 0;
+}
+
+void NEEqualizeHistogramKernel::wait_for_histograms()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    if(++_num_arrived == _num_threads)
+    {
+        lock.unlock();
+        _all_arrived.notify_all();
+        return;
+    }
+
+    _all_arrived.wait(lock, [this]()
+    {
+        return _num_arrived == _num_threads;
+    });
+}
+
+void NEEqualizeHistogramKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.thread_id() >= _num_threads);
+    static_assert(num_banks == num_histogram_banks, "The local histograms must have as many banks as histogram_banked_row_u8() fills");
+
+    const int width = _input->info()->dimension(0);
+
+    // Histogram of the sub-window
+    uint32_t *const local_hist = _local_hist[window.thread_id()].data();
+
+    Iterator input(_input, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        histogram_banked_row_u8(input.ptr(), width, local_hist, num_bins, [](uint8_t p)
+        {
+            return p;
+        });
+    },
+    input);
+
+    wait_for_histograms();
+
+    // Merge the histograms of all the threads and compute the lookup table, the same way NECumulativeDistributionKernel does
+    std::array<uint32_t, num_bins> cumulative_sum{ {} };
+
+    for(unsigned int t = 0; t < _num_threads; ++t)
+    {
+        merge_histogram_banks(cumulative_sum.data(), _local_hist[t].data(), num_bins, num_bins);
+    }
+
+    const uint32_t cd_min = *std::find_if(cumulative_sum.begin(), cumulative_sum.end(), [](const uint32_t &v)
+    {
+        return v > 0;
+    });
+
+    std::partial_sum(cumulative_sum.begin(), cumulative_sum.end(), cumulative_sum.begin());
+
+    const uint32_t image_size = cumulative_sum[num_bins - 1];
+
+    std::array<uint8_t, num_bins> lut{ {} };
+
+    if(image_size == cd_min)
+    {
+        std::iota(lut.begin(), lut.end(), 0);
+    }
+    else
+    {
+        const float diff = image_size - cd_min;
+
+        for(unsigned int x = 0; x < num_bins; ++x)
+        {
+            lut[x] = lround((cumulative_sum[x] - cd_min) / diff * 255.0f);
+        }
+    }
+
+    // Map the sub-window
+    Iterator in(_input, window);
+    Iterator out(_output, window);
+
+#ifdef __aarch64__
+    const std::array<uint8x16x4_t, 4> tables = vld_lut256_u8(lut.data());
+#endif /* __aarch64__ */
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const uint8_t *const in_ptr  = in.ptr();
+        uint8_t *const       out_ptr = out.ptr();
+        int                  x       = 0;
+
+#ifdef __aarch64__
+        for(; x <= width - 16; x += 16)
+        {
+            vst1q_u8(out_ptr + x, vlut256q_u8(tables, vld1q_u8(in_ptr + x)));
+        }
+#endif /* __aarch64__ */
+
+        for(; x < width; ++x)
+        {
+            out_ptr[x] = lut[in_ptr[x]];
+        }
+    },
+    in, out);
+}
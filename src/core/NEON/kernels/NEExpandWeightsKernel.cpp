@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEExpandWeightsKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace arm_compute
+{
+class Coordinates;
+} // namespace arm_compute
+
+namespace
+{
+void expand_row_u8(const uint8_t *__restrict in, float *__restrict out, int width, float scale, float offset)
+{
+    const float32x4_t vscale  = vdupq_n_f32(scale);
+    const float32x4_t voffset = vdupq_n_f32(offset);
+
+    int x = 0;
+    for(; x <= width - 16; x += 16)
+    {
+        const uint8x16_t texels = vld1q_u8(in + x);
+        const uint16x8_t low    = vmovl_u8(vget_low_u8(texels));
+        const uint16x8_t high   = vmovl_u8(vget_high_u8(texels));
+
+        vst1q_f32(out + x, vmlaq_f32(voffset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))), vscale));
+        vst1q_f32(out + x + 4, vmlaq_f32(voffset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(low))), vscale));
+        vst1q_f32(out + x + 8, vmlaq_f32(voffset, vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))), vscale));
+        vst1q_f32(out + x + 12, vmlaq_f32(voffset, vcvtq_f32_u32(vmovl_u16(vget_high_u16(high))), vscale));
+    }
+    for(; x < width; ++x)
+    {
+        out[x] = in[x] * scale + offset;
+    }
+}
+
+void expand_row_f16(const uint16_t *__restrict in, float *__restrict out, int width, float scale, float offset)
+{
+    int x = 0;
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+    // Only the conversion instructions are needed, not the half precision arithmetic
+    const float32x4_t vscale  = vdupq_n_f32(scale);
+    const float32x4_t voffset = vdupq_n_f32(offset);
+
+    for(; x <= width - 8; x += 8)
+    {
+        const float16x8_t texels = vld1q_f16(reinterpret_cast<const float16_t *>(in + x));
+
+        vst1q_f32(out + x, vmlaq_f32(voffset, vcvt_f32_f16(vget_low_f16(texels)), vscale));
+        vst1q_f32(out + x + 4, vmlaq_f32(voffset, vcvt_f32_f16(vget_high_f16(texels)), vscale));
+    }
+#endif /* defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE) */
+    for(; x < width; ++x)
+    {
+        out[x] = half_to_float(in[x]) * scale + offset;
+    }
+}
+} // namespace
+
+NEExpandWeightsKernel::NEExpandWeightsKernel()
+    : _input(nullptr), _output(nullptr), _scale(1.f), _offset(0.f)
+{
+}
+
+void NEExpandWeightsKernel::configure(const ITensor *input, ITensor *output, float scale, float offset)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input  = input;
+    _output = output;
+    _scale  = scale;
+    _offset = offset;
+
+    // One row per iteration: the tensors don't need any padding
+    Window win;
+    win.use_tensor_dimensions(output->info());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    INEKernel::configure(win);
+}
+
+void NEExpandWeightsKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int width = _output->info()->dimension(0);
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    if(_input->info()->data_type() == DataType::U8)
+    {
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            expand_row_u8(input.ptr(), reinterpret_cast<float *>(output.ptr()), width, _scale, _offset);
+        },
+        input, output);
+    }
+    else
+    {
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            expand_row_f16(reinterpret_cast<const uint16_t *>(input.ptr()), reinterpret_cast<float *>(output.ptr()), width, _scale, _offset);
+        },
+        input, output);
+    }
+}
@@ -24,19 +24,24 @@
 #include "arm_compute/core/NEON/kernels/NEFastCornersKernel.h"
 
 #include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 
 #include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <limits>
+#include <vector>
 
 using namespace arm_compute;
 
 NEFastCornersKernel::NEFastCornersKernel()
-    : INEKernel(), _input(nullptr), _output(nullptr), _threshold(0), _non_max_suppression(false)
+    : INEKernel(), _input(nullptr), _output(nullptr), _threshold(0), _non_max_suppression(false), _corners(nullptr), _local_corners()
 {
 }
 
@@ -351,6 +356,76 @@ inline uint8_t get_point_score(uint8_t p, uint8_t tolerance, const uint8x8x2_t &
 
     return a;
 }
+
+inline bool is_rejected(uint8_t p, uint8_t q, uint8_t a, uint8_t b)
+{
+    const bool p_is_in_ab = (a <= p) && (p <= b);
+    const bool q_is_in_ab = (a <= q) && (q <= b);
+    return p_is_in_ab && q_is_in_ab;
+}
+
+/** Compute the FAST score of a pixel
+ *
+ * @param[in] in_row              Pointers to the texel (-3, -3 ... 3) of the image origin.
+ * @param[in] in_offset           Offset in bytes of the pixel from the origin.
+ * @param[in] threshold           Threshold on difference between intensity of the central pixel and pixels on Bresenham's circle of radius 3.
+ * @param[in] non_max_suppression True to compute the score of the corners, false to return 1 for every corner.
+ * @param[in] circle_index_r      Indices of the texels of the circle, as returned by create_circle_index_register().
+ * @param[in] perm_indices        Indices of the 16 permutations of the circle.
+ *
+ * @return The score of the pixel, 0 if it is not a corner.
+ */
+inline uint8_t get_corner_score(const uint8_t *const __restrict in_row[7], size_t in_offset, uint8_t threshold, bool non_max_suppression, const uint8x8x4_t &circle_index_r,
+                                uint8x8x2_t perm_indices[PERMUTATIONS])
+{
+    const uint8_t p0 = (in_offset + in_row[3])[3];
+    const uint8_t b  = std::min(p0 + threshold, 255);
+    const uint8_t a  = std::max(p0 - threshold, 0);
+    /*
+        Fast check to discard points which cannot be corners and avoid the expensive computation of the potential 16 permutations
+
+        pixels 1 and 9 are examined, if both I1 and I9 are within [Ip - t, Ip + t], then candidate p is not a corner.
+    */
+    const uint8_t p1 = (in_offset + in_row[0])[3];
+    const uint8_t p9 = (in_offset + in_row[6])[3];
+
+    if(is_rejected(p1, p9, a, b))
+    {
+        return 0;
+    }
+
+    /* pixels 5 and 13 are further examined to check whether three of them are brighter than Ip + t or darker than Ip - t */
+    const uint8_t p5  = (in_offset + in_row[3])[6];
+    const uint8_t p13 = (in_offset + in_row[3])[0];
+
+    if(is_rejected(p5, p13, a, b))
+    {
+        return 0;
+    }
+
+    /* at this stage we use the full test with the 16 permutations to classify the point as corner or not */
+    const uint8x8x2_t tbl_circle_texel = create_circle_tbl(in_row, in_offset, circle_index_r);
+
+    if(!point_is_fast_corner(p0, threshold, tbl_circle_texel, perm_indices))
+    {
+        return 0;
+    }
+
+    return non_max_suppression ? get_point_score(p0, threshold, tbl_circle_texel, perm_indices) : 1;
+}
+
+/** Check whether a score is a maximum of its 3x3 neighbourhood, with the same tie breaking as NENonMaximaSuppression3x3Kernel
+ *
+ * @param[in] top Scores of the row above, centred on the pixel.
+ * @param[in] mid Scores of the row of the pixel, centred on the pixel.
+ * @param[in] low Scores of the row below, centred on the pixel.
+ */
+inline bool is_local_maximum(const uint8_t *top, const uint8_t *mid, const uint8_t *low)
+{
+    const uint8_t c = mid[0];
+
+    return c >= top[-1] && c >= top[0] && c >= top[1] && c >= mid[-1] && c > mid[1] && c > low[-1] && c > low[0] && c > low[1];
+}
 } // namespace
 
 BorderSize NEFastCornersKernel::border_size() const
@@ -388,6 +463,34 @@ void NEFastCornersKernel::configure(const IImage *input, IImage *output, uint8_t
     INEKernel::configure(win);
 }
 
+void NEFastCornersKernel::configure(const IImage *input, uint8_t threshold, bool non_max_suppression, IKeyPointArray *corners)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(nullptr == corners);
+
+    _input               = input;
+    _output              = nullptr;
+    _threshold           = threshold;
+    _non_max_suppression = non_max_suppression;
+    _corners             = corners;
+
+    const int width  = input->info()->dimension(0);
+    const int height = input->info()->dimension(1);
+
+    // The non-maxima suppression needs the scores around each corner
+    const int border = non_max_suppression ? 4 : 3;
+
+    // Each iteration handles a row: the window only spans the rows where corners are detected
+    Window win;
+    win.set(Window::DimY, Window::Dimension(border, std::max(border, height - border), 1));
+
+    // The circle of the last column is read with 8 bytes from 3 pixels on its left
+    update_window_and_padding(win, AccessWindowStatic(input->info(), 0, 0, width + 1, height));
+
+    INEKernel::configure(win);
+}
+
 void NEFastCornersKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -407,9 +510,6 @@ void NEFastCornersKernel::run(const Window &window)
         perm_index[k] = create_permutation_index(k);
     }
 
-    Iterator in(_input, window);
-    Iterator out(_output, window);
-
     const uint8_t *const __restrict in_row[7] =
     {
         _input->ptr_to_element(Coordinates(-3, -3)),
@@ -421,54 +521,117 @@ void NEFastCornersKernel::run(const Window &window)
         _input->ptr_to_element(Coordinates(-3, 3))
     };
 
-    auto is_rejected = [](uint8_t p, uint8_t q, uint8_t a, uint8_t b)
+    if(_corners == nullptr)
     {
-        const bool p_is_in_ab = (a <= p) && (p <= b);
-        const bool q_is_in_ab = (a <= q) && (q <= b);
-        return p_is_in_ab && q_is_in_ab;
-    };
+        Iterator in(_input, window);
+        Iterator out(_output, window);
 
-    execute_window_loop(window, [&](const Coordinates & id)
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            *out.ptr() = get_corner_score(in_row, in.offset(), _threshold, _non_max_suppression, circle_index_r, perm_index.data());
+        },
+        in, out);
+
+        return;
+    }
+
+    const int    width  = _input->info()->dimension(0);
+    const size_t stride = _input->info()->strides_in_bytes()[1];
+
+    std::vector<KeyPoint> &corners = _local_corners[window.thread_id()];
+
+    auto add_corner = [&](int x, int y, uint8_t score)
     {
-        const size_t  in_offset = in.offset();
-        const uint8_t p0        = *in.ptr();
-        const uint8_t b         = std::min(p0 + _threshold, 255);
-        const uint8_t a         = std::max(p0 - _threshold, 0);
-        uint8_t       score     = 0;
-        /*
-            Fast check to discard points which cannot be corners and avoid the expensive computation of the potential 16 permutations
-
-            pixels 1 and 9 are examined, if both I1 and I9 are within [Ip - t, Ip + t], then candidate p is not a corner.
-        */
-        const uint8_t p1 = (in_offset + in_row[0])[3];
-        const uint8_t p9 = (in_offset + in_row[6])[3];
+        KeyPoint p;
+        p.x               = x;
+        p.y               = y;
+        p.strength        = score;
+        p.tracking_status = 1;
+        corners.push_back(p);
+    };
 
-        if(!is_rejected(p1, p9, a, b))
+    if(!_non_max_suppression)
+    {
+        for(int y = window.y().start(); y < window.y().end(); ++y)
         {
-            /* pixels 5 and 13 are further examined to check whether three of them are brighter than Ip + t or darker than Ip - t */
-            const uint8_t p5  = (in_offset + in_row[3])[6];
-            const uint8_t p13 = (in_offset + in_row[3])[0];
-
-            if(!is_rejected(p5, p13, a, b))
+            for(int x = 3; x < width - 3; ++x)
             {
-                /* at this stage we use the full test with the 16 permutations to classify the point as corner or not */
-                const uint8x8x2_t tbl_circle_texel = create_circle_tbl(in_row, in_offset, circle_index_r);
+                const uint8_t score = get_corner_score(in_row, x + y * stride, _threshold, false, circle_index_r, perm_index.data());
 
-                if(point_is_fast_corner(p0, _threshold, tbl_circle_texel, perm_index.data()))
+                if(score != 0)
                 {
-                    if(_non_max_suppression)
-                    {
-                        score = get_point_score(p0, _threshold, tbl_circle_texel, perm_index.data());
-                    }
-                    else
-                    {
-                        score = 1;
-                    }
+                    add_corner(x, y, score);
                 }
             }
         }
 
-        *out.ptr() = score;
-    },
-    in, out);
+        return;
+    }
+
+    // Ring of three rows of scores, the columns closer than 3 pixels from the edges stay at 0
+    uint8_t *const scores = thread_scratch<uint8_t>(3 * width);
+    std::fill_n(scores, 3 * width, 0);
+
+    auto score_row = [&](int y)
+    {
+        uint8_t *const row = scores + (y % 3) * width;
+
+        for(int x = 3; x < width - 3; ++x)
+        {
+            row[x] = get_corner_score(in_row, x + y * stride, _threshold, true, circle_index_r, perm_index.data());
+        }
+    };
+
+    score_row(window.y().start() - 1);
+    score_row(window.y().start());
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        score_row(y + 1);
+
+        const uint8_t *const top = scores + ((y - 1) % 3) * width;
+        const uint8_t *const mid = scores + (y % 3) * width;
+        const uint8_t *const low = scores + ((y + 1) % 3) * width;
+
+        for(int x = 4; x < width - 4; ++x)
+        {
+            if(mid[x] != 0 && is_local_maximum(top + x, mid + x, low + x))
+            {
+                add_corner(x, y, mid[x]);
+            }
+        }
+    }
+}
+
+void NEFastCornersKernel::begin_reduction(unsigned int num_threads)
+{
+    if(_corners != nullptr)
+    {
+        // Clear the key points of the previous run in place, so that their memory is reused
+        _local_corners.resize(num_threads);
+        for(unsigned int t = 0; t < num_threads; ++t)
+        {
+            _local_corners[t].clear();
+        }
+    }
+}
+
+void NEFastCornersKernel::end_reduction()
+{
+    if(_corners == nullptr)
+    {
+        return;
+    }
+
+    // The threads run consecutive bands of rows: appending their key points in order keeps the raster order
+    for(size_t t = 0; t < _local_corners.size(); ++t)
+    {
+        for(const KeyPoint &p : _local_corners[t])
+        {
+            if(!_corners->push_back(p))
+            {
+                return; //Overflowed: stop trying to add more points
+            }
+        }
+    }
 }
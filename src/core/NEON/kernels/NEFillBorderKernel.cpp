@@ -40,6 +40,41 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
+namespace
+{
+/** Pixel of an image with N interleaved U8 channels */
+template <size_t N>
+struct InterleavedPixel
+{
+    uint8_t channels[N];
+};
+
+/** Value of the border for elements of type T */
+template <typename T>
+inline T border_value(const PixelValue &value)
+{
+    T v;
+    value.get(v);
+    return v;
+}
+
+template <>
+inline InterleavedPixel<3> border_value<InterleavedPixel<3>>(const PixelValue &value)
+{
+    InterleavedPixel<3> v;
+    std::copy_n(value.value.rgb, 3, v.channels);
+    return v;
+}
+
+template <>
+inline InterleavedPixel<4> border_value<InterleavedPixel<4>>(const PixelValue &value)
+{
+    InterleavedPixel<4> v;
+    std::copy_n(value.value.rgbx, 4, v.channels);
+    return v;
+}
+} // namespace
+
 NEFillBorderKernel::NEFillBorderKernel()
     : _tensor(nullptr), _border_size(0), _mode(BorderMode::UNDEFINED), _constant_border_value(0)
 {
@@ -47,7 +82,14 @@ NEFillBorderKernel::NEFillBorderKernel()
 
 void NEFillBorderKernel::configure(ITensor *tensor, BorderSize border_size, BorderMode border_mode, const PixelValue &constant_border_value)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tensor, 1, DataType::U8, DataType::U16, DataType::S16, DataType::U32, DataType::S32, DataType::F32);
+    if(tensor->info()->num_channels() != 1)
+    {
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(tensor, Format::RGB888, Format::RGBA8888);
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tensor, 1, DataType::U8, DataType::U16, DataType::S16, DataType::U32, DataType::S32, DataType::F16, DataType::F32);
+    }
 
     _tensor                = tensor;
     _border_size           = border_size;
@@ -72,6 +114,41 @@ void NEFillBorderKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    fill_rows(window, 0, _tensor->info()->valid_region().shape[1]);
+}
+
+void NEFillBorderKernel::run_rows(unsigned int first_row, unsigned int last_row)
+{
+    // If there is no border: early exit
+    if(_border_size.empty())
+    {
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    // Make the band relative to the valid region
+    const ValidRegion &valid_region = _tensor->info()->valid_region();
+    const unsigned int anchor       = std::max(valid_region.anchor[1], 0);
+    const unsigned int height       = valid_region.shape[1];
+
+    first_row = std::max(first_row, anchor) - anchor;
+    last_row  = std::min(std::max(last_row, anchor) - anchor, height);
+
+    if(first_row < last_row)
+    {
+        fill_rows(INEKernel::window(), first_row, last_row);
+    }
+}
+
+void NEFillBorderKernel::fill_rows(const Window &window, unsigned int first_row, unsigned int last_row)
+{
+    if(_tensor->info()->num_channels() != 1)
+    {
+        fill_rows_interleaved(window, first_row, last_row);
+        return;
+    }
+
     switch(_mode)
     {
         case BorderMode::CONSTANT:
@@ -79,24 +156,30 @@ void NEFillBorderKernel::run(const Window &window)
             switch(_tensor->info()->data_type())
             {
                 case DataType::U8:
-                    fill_constant_value_single_channel<uint8_t>(window);
+                    fill_constant_value_single_channel<uint8_t>(window, first_row, last_row);
                     break;
                 case DataType::U16:
-                    fill_constant_value_single_channel<uint16_t>(window);
+                    fill_constant_value_single_channel<uint16_t>(window, first_row, last_row);
                     break;
                 case DataType::S16:
-                    fill_constant_value_single_channel<int16_t>(window);
+                    fill_constant_value_single_channel<int16_t>(window, first_row, last_row);
                     break;
                 case DataType::U32:
-                    fill_constant_value_single_channel<uint32_t>(window);
+                    fill_constant_value_single_channel<uint32_t>(window, first_row, last_row);
                     break;
                 case DataType::S32:
-                    fill_constant_value_single_channel<int32_t>(window);
+                    fill_constant_value_single_channel<int32_t>(window, first_row, last_row);
                     break;
                 case DataType::F32:
                     static_assert(sizeof(float) == 4, "Float must be 32 bit");
-                    fill_constant_value_single_channel<float>(window);
+                    fill_constant_value_single_channel<float>(window, first_row, last_row);
+                    break;
+                case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                    static_assert(sizeof(float16_t) == 2, "Float16_t must be 16 bit");
+                    fill_constant_value_single_channel<float16_t>(window, first_row, last_row);
                     break;
+#endif
                 default:
                     ARM_COMPUTE_ERROR("Not handled");
             }
@@ -107,24 +190,30 @@ void NEFillBorderKernel::run(const Window &window)
             switch(_tensor->info()->data_type())
             {
                 case DataType::U8:
-                    fill_replicate_single_channel<uint8_t>(window);
+                    fill_replicate_single_channel<uint8_t>(window, first_row, last_row);
                     break;
                 case DataType::U16:
-                    fill_replicate_single_channel<uint16_t>(window);
+                    fill_replicate_single_channel<uint16_t>(window, first_row, last_row);
                     break;
                 case DataType::S16:
-                    fill_replicate_single_channel<int16_t>(window);
+                    fill_replicate_single_channel<int16_t>(window, first_row, last_row);
                     break;
                 case DataType::U32:
-                    fill_replicate_single_channel<uint32_t>(window);
+                    fill_replicate_single_channel<uint32_t>(window, first_row, last_row);
                     break;
                 case DataType::S32:
-                    fill_replicate_single_channel<int32_t>(window);
+                    fill_replicate_single_channel<int32_t>(window, first_row, last_row);
                     break;
                 case DataType::F32:
                     static_assert(sizeof(float) == 4, "Float must be 32 bit");
-                    fill_replicate_single_channel<float>(window);
+                    fill_replicate_single_channel<float>(window, first_row, last_row);
                     break;
+                case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                    static_assert(sizeof(float16_t) == 2, "Float16_t must be 16 bit");
+                    fill_replicate_single_channel<float16_t>(window, first_row, last_row);
+                    break;
+#endif
                 default:
                     ARM_COMPUTE_ERROR("Not handled");
             }
@@ -137,16 +226,51 @@ void NEFillBorderKernel::run(const Window &window)
     }
 }
 
+void NEFillBorderKernel::fill_rows_interleaved(const Window &window, unsigned int first_row, unsigned int last_row)
+{
+    const bool rgb = _tensor->info()->num_channels() == 3;
+
+    switch(_mode)
+    {
+        case BorderMode::CONSTANT:
+            if(rgb)
+            {
+                fill_constant_value_single_channel<InterleavedPixel<3>>(window, first_row, last_row);
+            }
+            else
+            {
+                fill_constant_value_single_channel<InterleavedPixel<4>>(window, first_row, last_row);
+            }
+            break;
+        case BorderMode::REPLICATE:
+            if(rgb)
+            {
+                fill_replicate_single_channel<InterleavedPixel<3>>(window, first_row, last_row);
+            }
+            else
+            {
+                fill_replicate_single_channel<InterleavedPixel<4>>(window, first_row, last_row);
+            }
+            break;
+        case BorderMode::UNDEFINED:
+            break; // Nothing to do here
+        default:
+            ARM_COMPUTE_ERROR("Unknown border mode");
+    }
+}
+
 template <typename T>
-void NEFillBorderKernel::fill_replicate_single_channel(const Window &window)
+void NEFillBorderKernel::fill_replicate_single_channel(const Window &window, unsigned int first_row, unsigned int last_row)
 {
     uint8_t *const start_valid_region = _tensor->ptr_to_element(_tensor->info()->valid_region().anchor);
     const size_t &width              = _tensor->info()->valid_region().shape[0];
     const size_t &height             = _tensor->info()->valid_region().shape[1];
+    const bool     fill_top           = (first_row == 0);
+    const bool     fill_bottom        = (last_row == height);
 
     // Left and right border
     Window vertical(window);
-    vertical.set(Window::DimY, Window::Dimension(0, height, 1));
+    vertical.set(Window::DimY, Window::Dimension(first_row, last_row, 1));
 
     Iterator vertical_it(_tensor, vertical);
 
@@ -168,44 +292,45 @@ void NEFillBorderKernel::fill_replicate_single_channel(const Window &window)
     // Iterate over all XY planes
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto first_row = reinterpret_cast<T *>(start_valid_region + plane_it.offset());
+        const auto first_valid_row = reinterpret_cast<T *>(start_valid_region + plane_it.offset());
 
-        // Top border
-        for(int i = -_border_size.top; i < 0; ++i)
+        // Top border, if the band starts at the first row
+        for(int i = fill_top ? -static_cast<int>(_border_size.top) : 0; i < 0; ++i)
         {
             const auto row_start = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + i * _tensor->info()->strides_in_bytes()[1]);
 
             // Copy top rows including left/right borders
-            std::copy_n(first_row - _border_size.left, _border_size.left + width + _border_size.right, row_start - _border_size.left);
+            std::copy_n(first_valid_row - _border_size.left, _border_size.left + width + _border_size.right, row_start - _border_size.left);
         }
 
-        const auto last_row = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + (height - 1) * _tensor->info()->strides_in_bytes()[1]);
+        const auto last_valid_row = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + (height - 1) * _tensor->info()->strides_in_bytes()[1]);
 
-        // Bottom border
-        for(unsigned int i = height; i < height + _border_size.bottom; ++i)
+        // Bottom border, if the band ends at the last row
+        for(unsigned int i = height; fill_bottom && i < height + _border_size.bottom; ++i)
         {
             const auto row_start = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + i * _tensor->info()->strides_in_bytes()[1]);
 
             // Copy bottom rows including left/right borders
-            std::copy_n(last_row - _border_size.left, _border_size.left + width + _border_size.right, row_start - _border_size.left);
+            std::copy_n(last_valid_row - _border_size.left, _border_size.left + width + _border_size.right, row_start - _border_size.left);
         }
     },
     plane_it);
 }
 
 template <typename T>
-void NEFillBorderKernel::fill_constant_value_single_channel(const Window &window)
+void NEFillBorderKernel::fill_constant_value_single_channel(const Window &window, unsigned int first_row, unsigned int last_row)
 {
-    T constant_border_value;
-    _constant_border_value.get(constant_border_value);
+    const T constant_border_value = border_value<T>(_constant_border_value);
 
     uint8_t *const start_valid_region = _tensor->ptr_to_element(_tensor->info()->valid_region().anchor);
     const size_t &width              = _tensor->info()->valid_region().shape[0];
     const size_t &height             = _tensor->info()->valid_region().shape[1];
+    const bool     fill_top           = (first_row == 0);
+    const bool     fill_bottom        = (last_row == height);
 
     // Left and right border
     Window vertical(window);
-    vertical.set(Window::DimY, Window::Dimension(0, height, 1));
+    vertical.set(Window::DimY, Window::Dimension(first_row, last_row, 1));
 
     Iterator vertical_it(_tensor, vertical);
 
@@ -225,8 +350,8 @@ void NEFillBorderKernel::fill_constant_value_single_channel(const Window &window
     // Iterate over all XY planes
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        // Top border
-        for(int i = -_border_size.top; i < 0; ++i)
+        // Top border, if the band starts at the first row
+        for(int i = fill_top ? -static_cast<int>(_border_size.top) : 0; i < 0; ++i)
         {
             const auto row_start = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + i * _tensor->info()->strides_in_bytes()[1]);
 
@@ -234,8 +359,8 @@ void NEFillBorderKernel::fill_constant_value_single_channel(const Window &window
             std::fill_n(row_start - _border_size.left, _border_size.left + width + _border_size.right, constant_border_value);
         }
 
-        // Bottom border
-        for(unsigned int i = height; i < height + _border_size.bottom; ++i)
+        // Bottom border, if the band ends at the last row
+        for(unsigned int i = height; fill_bottom && i < height + _border_size.bottom; ++i)
         {
             const auto row_start = reinterpret_cast<T *>(start_valid_region + plane_it.offset() + i * _tensor->info()->strides_in_bytes()[1]);
 
@@ -0,0 +1,339 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEFusedElementwiseKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstring>
+#include <map>
+#include <string>
+
+using namespace arm_compute;
+
+namespace
+{
+using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+/** Arguments of a step for the current row of the tensors */
+struct StepArgs
+{
+    ElementwiseOperation op;
+    ActivationFunction   act;
+    MathPrecision        precision;
+    const float         *operand;
+    float32x4_t          a;
+    float32x4_t          b;
+};
+
+struct AddStep
+{
+    static inline float32x4_t apply(const float32x4_t &acc, const StepArgs &args, int x)
+    {
+        return vaddq_f32(acc, vld1q_f32(args.operand + x));
+    }
+};
+
+struct MulStep
+{
+    static inline float32x4_t apply(const float32x4_t &acc, const StepArgs &args, int x)
+    {
+        return vmulq_f32(acc, vld1q_f32(args.operand + x));
+    }
+};
+
+template <ActivationFunction F>
+struct ActivationStep
+{
+    static inline float32x4_t apply(const float32x4_t &acc, const StepArgs &args, int x)
+    {
+        ARM_COMPUTE_UNUSED(x);
+        return vactivateq_f32<F>(acc, args.a, args.b);
+    }
+};
+
+/** Expression specialised at compile time: the steps are applied in the order of the template parameters */
+template <typename... Steps>
+struct StaticExpression;
+
+template <>
+struct StaticExpression<>
+{
+    static inline float32x4_t apply(const float32x4_t &acc, const StepArgs *args, size_t num_steps, int x)
+    {
+        ARM_COMPUTE_UNUSED(args);
+        ARM_COMPUTE_UNUSED(num_steps);
+        ARM_COMPUTE_UNUSED(x);
+        return acc;
+    }
+};
+
+template <typename Step, typename... Steps>
+struct StaticExpression<Step, Steps...>
+{
+    static inline float32x4_t apply(const float32x4_t &acc, const StepArgs *args, size_t num_steps, int x)
+    {
+        return StaticExpression<Steps...>::apply(Step::apply(acc, *args, x), args + 1, num_steps - 1, x);
+    }
+};
+
+/** Apply an activation function only known at run time to 4 values */
+template <MathPrecision P>
+inline float32x4_t vactivateq_dynamic_f32(const float32x4_t &x, ActivationFunction act, const float32x4_t &a, const float32x4_t &b)
+{
+    switch(act)
+    {
+        case ActivationFunction::ABS:
+            return vactivateq_f32<ActivationFunction::ABS, P>(x, a, b);
+        case ActivationFunction::BOUNDED_RELU:
+            return vactivateq_f32<ActivationFunction::BOUNDED_RELU, P>(x, a, b);
+        case ActivationFunction::LINEAR:
+            return vactivateq_f32<ActivationFunction::LINEAR, P>(x, a, b);
+        case ActivationFunction::LOGISTIC:
+            return vactivateq_f32<ActivationFunction::LOGISTIC, P>(x, a, b);
+        case ActivationFunction::RELU:
+            return vactivateq_f32<ActivationFunction::RELU, P>(x, a, b);
+        case ActivationFunction::SOFT_RELU:
+            return vactivateq_f32<ActivationFunction::SOFT_RELU, P>(x, a, b);
+        case ActivationFunction::SQRT:
+            return vactivateq_f32<ActivationFunction::SQRT, P>(x, a, b);
+        case ActivationFunction::SQUARE:
+            return vactivateq_f32<ActivationFunction::SQUARE, P>(x, a, b);
+        case ActivationFunction::TANH:
+            return vactivateq_f32<ActivationFunction::TANH, P>(x, a, b);
+        default:
+            ARM_COMPUTE_ERROR("Activation function not supported");
+            return x;
+    }
+}
+
+/** Expression interpreted step by step on each vector */
+struct InterpretedExpression
+{
+    static inline float32x4_t apply(float32x4_t acc, const StepArgs *args, size_t num_steps, int x)
+    {
+        for(size_t i = 0; i < num_steps; ++i)
+        {
+            const StepArgs &step = args[i];
+
+            switch(step.op)
+            {
+                case ElementwiseOperation::ADD:
+                    acc = AddStep::apply(acc, step, x);
+                    break;
+                case ElementwiseOperation::MUL:
+                    acc = MulStep::apply(acc, step, x);
+                    break;
+                case ElementwiseOperation::ACTIVATION:
+                    acc = step.precision == MathPrecision::FAST ? vactivateq_dynamic_f32<MathPrecision::FAST>(acc, step.act, step.a, step.b) :
+                          vactivateq_dynamic_f32<MathPrecision::ACCURATE>(acc, step.act, step.a, step.b);
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Operation not supported");
+            }
+        }
+
+        return acc;
+    }
+};
+
+/** Pointer to the first element of the row of a tensor at the given coordinates (The X coordinate is ignored) */
+inline uint8_t *row_ptr(const ITensor *tensor, const Coordinates &id)
+{
+    const TensorInfo *info   = tensor->info();
+    size_t            offset = info->offset_first_element_in_bytes();
+
+    for(size_t d = 1; d < info->num_dimensions(); ++d)
+    {
+        offset += id[d] * info->strides_in_bytes()[d];
+    }
+
+    return tensor->buffer() + offset;
+}
+
+template <typename Expression>
+void fused_elementwise(const ITensor *input, const std::vector<FusedElementwiseStep> &steps, ITensor *output, const Window &window)
+{
+    constexpr int num_elems_processed_per_iteration = 4;
+
+    const int    start_x   = window.x().start();
+    const int    end_x     = window.x().end();
+    const size_t num_steps = steps.size();
+
+    // The arguments live in the scratch buffers of the thread: running the kernel doesn't allocate
+    StepArgs *const args = thread_scratch<StepArgs>(num_steps, 0);
+
+    for(size_t i = 0; i < num_steps; ++i)
+    {
+        const FusedElementwiseStep &step = steps[i];
+        args[i]                          = StepArgs{ step.op, step.act_info.activation(), step.act_info.precision(), nullptr, vdupq_n_f32(step.act_info.a()), vdupq_n_f32(step.act_info.b()) };
+    }
+
+    // The elements at the end of the rows which don't fill a whole vector go through zero-initialised scratch buffers
+    StepArgs *const tail_args     = thread_scratch<StepArgs>(num_steps, 1);
+    float *const    tail_operands = thread_scratch<float>(num_steps * num_elems_processed_per_iteration, 2);
+    std::fill_n(tail_operands, num_steps * num_elems_processed_per_iteration, 0.f);
+
+    for(size_t i = 0; i < num_steps; ++i)
+    {
+        tail_args[i]         = args[i];
+        tail_args[i].operand = tail_operands + i * num_elems_processed_per_iteration;
+    }
+
+    Window win(window);
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // The number of operands is only known at configure time: compute the pointers to each row rather than using iterators.
+    // The coordinates of the collapsed dimensions are 0, so they still give the start of the merged rows.
+    execute_window_loop(win, [&](const Coordinates & id)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(row_ptr(input, id));
+        const auto out_ptr = reinterpret_cast<float *>(row_ptr(output, id));
+
+        for(size_t i = 0; i < num_steps; ++i)
+        {
+            if(steps[i].operand != nullptr)
+            {
+                args[i].operand = reinterpret_cast<const float *>(row_ptr(steps[i].operand, id));
+            }
+        }
+
+        int x = start_x;
+
+        for(; x <= end_x - num_elems_processed_per_iteration; x += num_elems_processed_per_iteration)
+        {
+            vst1q_f32(out_ptr + x, Expression::apply(vld1q_f32(in_ptr + x), args, num_steps, x));
+        }
+
+        if(x < end_x)
+        {
+            const size_t tail = end_x - x;
+
+            float in_tail[num_elems_processed_per_iteration]  = { 0.f };
+            float out_tail[num_elems_processed_per_iteration] = { 0.f };
+
+            std::memcpy(in_tail, in_ptr + x, tail * sizeof(float));
+
+            for(size_t i = 0; i < num_steps; ++i)
+            {
+                if(args[i].operand != nullptr)
+                {
+                    std::memcpy(tail_operands + i * num_elems_processed_per_iteration, args[i].operand + x, tail * sizeof(float));
+                }
+            }
+
+            vst1q_f32(out_tail, Expression::apply(vld1q_f32(in_tail), tail_args, num_steps, 0));
+            std::memcpy(out_ptr + x, out_tail, tail * sizeof(float));
+        }
+    });
+}
+} // namespace
+
+NEFusedElementwiseKernel::NEFusedElementwiseKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _steps(), _infos()
+{
+}
+
+void NEFusedElementwiseKernel::configure(const ITensor *input, const std::vector<FusedElementwiseStep> &steps, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MSG(steps.empty(), "The expression needs at least one step");
+
+    static std::map<std::string, FusedFunction *> map_function =
+    {
+        { "ADD_RELU", &fused_elementwise<StaticExpression<AddStep, ActivationStep<ActivationFunction::RELU>>> },
+        { "ADD_BRELU", &fused_elementwise<StaticExpression<AddStep, ActivationStep<ActivationFunction::BOUNDED_RELU>>> },
+        { "MUL_ADD", &fused_elementwise<StaticExpression<MulStep, AddStep>> },
+        { "MUL_ADD_RELU", &fused_elementwise<StaticExpression<MulStep, AddStep, ActivationStep<ActivationFunction::RELU>>> },
+        { "MUL_ADD_BRELU", &fused_elementwise<StaticExpression<MulStep, AddStep, ActivationStep<ActivationFunction::BOUNDED_RELU>>> },
+    };
+
+    ValidRegion valid_region = input->info()->valid_region();
+    std::string expression;
+
+    for(const FusedElementwiseStep &step : steps)
+    {
+        expression += expression.empty() ? "" : "_";
+
+        switch(step.op)
+        {
+            case ElementwiseOperation::ADD:
+            case ElementwiseOperation::MUL:
+                ARM_COMPUTE_ERROR_ON(step.operand == nullptr);
+                ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, step.operand);
+                ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, step.operand);
+                expression += step.op == ElementwiseOperation::ADD ? "ADD" : "MUL";
+                valid_region = intersect_valid_regions(valid_region, step.operand->info()->valid_region());
+                break;
+            case ElementwiseOperation::ACTIVATION:
+                expression += string_from_activation_func(step.act_info.activation());
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Operation not supported");
+        }
+    }
+
+    _input  = input;
+    _output = output;
+    _steps  = steps;
+    _infos  = { input->info(), output->info() };
+
+    for(const FusedElementwiseStep &step : steps)
+    {
+        if(step.operand != nullptr)
+        {
+            _infos.push_back(step.operand->info());
+        }
+    }
+
+    auto it = map_function.find(expression);
+    _func   = (it != map_function.end()) ? it->second : &fused_elementwise<InterpretedExpression>;
+
+    // Configure kernel window: the end of the rows is processed through scratch buffers so no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+
+    output->info()->set_valid_region(valid_region);
+
+    INEKernel::configure(win);
+}
+
+void NEFusedElementwiseKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    // Elementwise: run a single loop over the rows of the window if the tensors have no padding between them
+    (*_func)(_input, _steps, _output, collapse_window(window, _infos.data(), _infos.size()));
+}
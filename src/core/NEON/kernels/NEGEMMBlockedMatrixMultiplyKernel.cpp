@@ -0,0 +1,444 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMBlockedMatrixMultiplyKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <map>
+#include <vector>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEGEMMBlockedMatrixMultiplyKernel::tile_m;
+constexpr unsigned int NEGEMMBlockedMatrixMultiplyKernel::tile_n;
+constexpr unsigned int NEGEMMBlockedMatrixMultiplyKernel::block_m;
+constexpr unsigned int NEGEMMBlockedMatrixMultiplyKernel::block_n;
+constexpr unsigned int NEGEMMBlockedMatrixMultiplyKernel::block_k;
+
+namespace
+{
+constexpr int tile_m = NEGEMMBlockedMatrixMultiplyKernel::tile_m;
+constexpr int tile_n = NEGEMMBlockedMatrixMultiplyKernel::tile_n;
+
+/** Number of iterations of the micro-kernel between the loads and the prefetch of the packed panels */
+constexpr int prefetch_distance = 8;
+
+static_assert(NEGEMMBlockedMatrixMultiplyKernel::block_m % tile_m == 0, "The blocks of matrix A must contain whole panels");
+static_assert(NEGEMMBlockedMatrixMultiplyKernel::block_n % tile_n == 0, "The blocks of matrix B must contain whole panels");
+static_assert(tile_n % 4 == 0, "The micro-kernel stores the output in vectors of 4 elements");
+
+/** Position in memory of the columns of a matrix
+ *
+ * The columns of a matrix are usually consecutive elements. When the feature maps of a 1x1 convolution are read as a matrix,
+ * each row of the matrix is a feature map: its columns run through the lines of the feature map, which might be padded.
+ */
+struct ColumnLayout
+{
+    int    line_width;  /**< Number of consecutive columns in memory */
+    size_t line_stride; /**< Distance in elements between two lines of columns */
+
+    /** Offset in elements of a column from the first column of its row */
+    size_t offset(int n) const
+    {
+        return (n / line_width) * line_stride + (n % line_width);
+    }
+    /** Return true if the @p count columns starting at @p n are consecutive in memory */
+    bool is_contiguous(int n, int count) const
+    {
+        return (n % line_width) + count <= line_width;
+    }
+};
+
+/** Pack a block of matrix A in panels of tile_m rows
+ *
+ * Element (m, k) of panel p is stored at p * tile_m * kc + k * tile_m + m. The rows beyond the matrix are zero.
+ *
+ * @param[in]  a        First element of the block.
+ * @param[in]  stride_m Distance in elements between two rows of matrix A.
+ * @param[in]  stride_k Distance in elements between two columns of matrix A.
+ * @param[in]  mc       Number of rows in the block.
+ * @param[in]  kc       Number of columns in the block.
+ * @param[out] packed   Packed block.
+ */
+void pack_a(const float *a, size_t stride_m, size_t stride_k, int mc, int kc, float *packed)
+{
+    for(int m0 = 0; m0 < mc; m0 += tile_m)
+    {
+        const int rows = std::min(tile_m, mc - m0);
+
+        for(int k = 0; k < kc; ++k, packed += tile_m)
+        {
+            for(int m = 0; m < tile_m; ++m)
+            {
+                packed[m] = (m < rows) ? a[(m0 + m) * stride_m + k * stride_k] : 0.f;
+            }
+        }
+    }
+}
+
+/** Pack a block of matrix B in panels of tile_n columns
+ *
+ * Element (k, n) of panel p is stored at p * tile_n * kc + k * tile_n + n. The columns beyond the matrix are zero.
+ *
+ * @param[in]  b      First column of the first row of the block.
+ * @param[in]  stride Distance in elements between two rows of matrix B.
+ * @param[in]  layout Position of the columns of matrix B in memory.
+ * @param[in]  n0     First column of the block.
+ * @param[in]  kc     Number of rows in the block.
+ * @param[in]  nc     Number of columns in the block.
+ * @param[out] packed Packed block.
+ */
+void pack_b(const float *b, size_t stride, const ColumnLayout &layout, int n0, int kc, int nc, float *packed)
+{
+    for(int np = 0; np < nc; np += tile_n)
+    {
+        const int  cols    = std::min(tile_n, nc - np);
+        const bool is_full = (cols == tile_n) && layout.is_contiguous(n0 + np, tile_n);
+        const auto offset  = layout.offset(n0 + np);
+
+        for(int k = 0; k < kc; ++k, packed += tile_n)
+        {
+            const float *row = b + k * stride;
+
+            if(is_full)
+            {
+                for(int n = 0; n < tile_n; n += 4)
+                {
+                    vst1q_f32(packed + n, vld1q_f32(row + offset + n));
+                }
+            }
+            else
+            {
+                for(int n = 0; n < tile_n; ++n)
+                {
+                    packed[n] = (n < cols) ? row[layout.offset(n0 + np + n)] : 0.f;
+                }
+            }
+        }
+    }
+}
+
+/** Multiply a panel of matrix A by a panel of matrix B and store the tile_m x tile_n result in matrix C
+ *
+ * @param[in]     a          Packed panel of matrix A.
+ * @param[in]     b          Packed panel of matrix B.
+ * @param[in]     kc         Number of elements of the K dimension in the panels.
+ * @param[in,out] c          First column of the first row of the tile in matrix C.
+ * @param[in]     stride     Distance in elements between two rows of matrix C.
+ * @param[in]     layout     Position of the columns of matrix C in memory.
+ * @param[in]     n0         First column of the tile.
+ * @param[in]     rows       Number of rows of the tile inside matrix C.
+ * @param[in]     cols       Number of columns of the tile inside matrix C.
+ * @param[in]     alpha      Weight of the matrix product.
+ * @param[in]     accumulate True if the result is added to the content of matrix C, false if it replaces it.
+ * @param[in]     finish     True if @p epilogue must be applied to the result: the last slice of the K dimension has been accumulated.
+ * @param[in]     epilogue   Function applied to 4 values of a row of the tile before they are stored, called with the values and the index of the row in the tile.
+ */
+template <typename E>
+void micro_kernel(const float *a, const float *b, int kc, float *c, size_t stride, const ColumnLayout &layout, int n0, int rows, int cols, float alpha, bool accumulate, bool finish,
+                  const E &epilogue)
+{
+    float32x4_t acc[tile_m][tile_n / 4];
+    for(int m = 0; m < tile_m; ++m)
+    {
+        for(int n = 0; n < tile_n / 4; ++n)
+        {
+            acc[m][n] = vdupq_n_f32(0.f);
+        }
+    }
+
+    for(int k = 0; k < kc; ++k, a += tile_m, b += tile_n)
+    {
+        __builtin_prefetch(a + prefetch_distance * tile_m);
+        __builtin_prefetch(b + prefetch_distance * tile_n);
+
+        float32x4_t vb[tile_n / 4];
+        for(int n = 0; n < tile_n / 4; ++n)
+        {
+            vb[n] = vld1q_f32(b + 4 * n);
+        }
+
+        for(int m = 0; m < tile_m; ++m)
+        {
+            for(int n = 0; n < tile_n / 4; ++n)
+            {
+                acc[m][n] = vmlaq_n_f32(acc[m][n], vb[n], a[m]);
+            }
+        }
+    }
+
+    if((rows == tile_m) && (cols == tile_n) && layout.is_contiguous(n0, tile_n))
+    {
+        for(int m = 0; m < tile_m; ++m)
+        {
+            float *const row = c + m * stride + layout.offset(n0);
+            for(int n = 0; n < tile_n / 4; ++n)
+            {
+                float32x4_t res = vmulq_n_f32(acc[m][n], alpha);
+                if(accumulate)
+                {
+                    res = vaddq_f32(vld1q_f32(row + 4 * n), res);
+                }
+                vst1q_f32(row + 4 * n, finish ? epilogue(res, m) : res);
+            }
+        }
+    }
+    else
+    {
+        // Tile on the edge of matrix C or across two lines of its columns: only store the elements inside the matrix
+        float tile[tile_m][tile_n];
+        for(int m = 0; m < tile_m; ++m)
+        {
+            for(int n = 0; n < tile_n / 4; ++n)
+            {
+                vst1q_f32(&tile[m][4 * n], vmulq_n_f32(acc[m][n], alpha));
+            }
+        }
+
+        for(int m = 0; m < rows; ++m)
+        {
+            float *const row = c + m * stride;
+            if(accumulate)
+            {
+                for(int n = 0; n < cols; ++n)
+                {
+                    tile[m][n] += row[layout.offset(n0 + n)];
+                }
+            }
+            if(finish)
+            {
+                for(int n = 0; n < tile_n / 4; ++n)
+                {
+                    vst1q_f32(&tile[m][4 * n], epilogue(vld1q_f32(&tile[m][4 * n]), m));
+                }
+            }
+            for(int n = 0; n < cols; ++n)
+            {
+                row[layout.offset(n0 + n)] = tile[m][n];
+            }
+        }
+    }
+}
+} // namespace
+
+NEGEMMBlockedMatrixMultiplyKernel::ActivationFunctionPtr NEGEMMBlockedMatrixMultiplyKernel::activation_function(ActivationLayerInfo::ActivationFunction act)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &vactivateq_f32<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &vactivateq_f32<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &vactivateq_f32<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &vactivateq_f32<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &vactivateq_f32<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &vactivateq_f32<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &vactivateq_f32<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &vactivateq_f32<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &vactivateq_f32<ActivationFunction::TANH> },
+    };
+
+    return act_map[act];
+}
+
+NEGEMMBlockedMatrixMultiplyKernel::NEGEMMBlockedMatrixMultiplyKernel()
+    : _input0(nullptr), _input1(nullptr), _biases(nullptr), _output(nullptr), _alpha(1.0f), _is_convolution_output(false), _act_func(nullptr), _act_info()
+{
+}
+
+void NEGEMMBlockedMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != output->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 2);
+
+    _input0                = input0;
+    _input1                = input1;
+    _biases                = nullptr;
+    _output                = output;
+    _alpha                 = alpha;
+    _is_convolution_output = false;
+    _act_func              = nullptr;
+    _act_info              = ActivationLayerInfo();
+
+    // Configure kernel window: each iteration computes a block of the output
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(0), block_n), block_n));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(1), block_m), block_m));
+
+    // The kernel doesn't read or write outside the matrices so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMBlockedMatrixMultiplyKernel::configure_convolution(const ITensor *weights, const ITensor *input, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, input, output);
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(0) != 1) || (weights->info()->dimension(1) != 1));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(3) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON((input->info()->dimension(0) != output->info()->dimension(0)) || (input->info()->dimension(1) != output->info()->dimension(1)));
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(3) != output->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(3));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    _input0                = weights;
+    _input1                = input;
+    _biases                = biases;
+    _output                = output;
+    _alpha                 = 1.0f;
+    _is_convolution_output = true;
+    _act_info              = act_info;
+    _act_func              = act_info.enabled() ? activation_function(act_info.activation()) : nullptr;
+
+    // Configure kernel window: the blocks of columns (output elements) are along Y so that the scheduler splits the window among them,
+    // there usually are many more output elements than output feature maps
+    const unsigned int num_output_elems = output->info()->dimension(0) * output->info()->dimension(1);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(2), block_m), block_m));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(num_output_elems, block_n), block_n));
+    win.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(3), 1));
+
+    // The kernel doesn't read or write outside the feature maps so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMBlockedMatrixMultiplyKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const TensorInfo *const info_a = _input0->info();
+    const TensorInfo *const info_b = _input1->info();
+    const TensorInfo *const info_c = _output->info();
+
+    // In a convolution, the rows of matrix A are the output feature maps of the weights and the rows of matrices B and C are the feature maps,
+    // the columns of which are the elements of the feature maps
+    const int    num_rows       = _is_convolution_output ? info_c->dimension(2) : info_c->dimension(1);
+    const int    num_cols       = _is_convolution_output ? info_c->dimension(0) * info_c->dimension(1) : info_c->dimension(0);
+    const int    num_k          = _is_convolution_output ? info_a->dimension(2) : info_a->dimension(0);
+    const size_t stride_a       = (_is_convolution_output ? info_a->strides_in_bytes()[3] : info_a->strides_in_bytes()[1]) / sizeof(float);
+    const size_t stride_a_k     = (_is_convolution_output ? info_a->strides_in_bytes()[2] : sizeof(float)) / sizeof(float);
+    const size_t stride_b       = (_is_convolution_output ? info_b->strides_in_bytes()[2] : info_b->strides_in_bytes()[1]) / sizeof(float);
+    const size_t stride_c       = (_is_convolution_output ? info_c->strides_in_bytes()[2] : info_c->strides_in_bytes()[1]) / sizeof(float);
+    const size_t stride_b_batch = info_b->strides_in_bytes()[3] / sizeof(float);
+    const size_t stride_c_batch = info_c->strides_in_bytes()[3] / sizeof(float);
+
+    const ColumnLayout layout_b = _is_convolution_output ? ColumnLayout{ static_cast<int>(info_b->dimension(0)), info_b->strides_in_bytes()[1] / sizeof(float) } :
+                                  ColumnLayout{ num_cols, 0 };
+    const ColumnLayout layout_c = _is_convolution_output ? ColumnLayout{ static_cast<int>(info_c->dimension(0)), info_c->strides_in_bytes()[1] / sizeof(float) } :
+                                  ColumnLayout{ num_cols, 0 };
+
+    const auto a_ptr = reinterpret_cast<const float *>(_input0->buffer() + info_a->offset_first_element_in_bytes());
+    const auto b_ptr = reinterpret_cast<const float *>(_input1->buffer() + info_b->offset_first_element_in_bytes());
+    const auto c_ptr = reinterpret_cast<float *>(_output->buffer() + info_c->offset_first_element_in_bytes());
+
+    const auto biases_ptr   = (_biases != nullptr) ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+    const bool has_epilogue = (biases_ptr != nullptr) || (_act_func != nullptr);
+    const auto act_a        = vdupq_n_f32(_act_info.a());
+    const auto act_b        = vdupq_n_f32(_act_info.b());
+
+    // Packed blocks, reused by all the iterations of this window and kept by the thread for the next runs
+    float *const packed_a = thread_scratch<float>(block_m * block_k, 0);
+    float *const packed_b = thread_scratch<float>(block_k * block_n, 1);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int m0 = _is_convolution_output ? id.x() : id.y();
+        const int n0 = _is_convolution_output ? id.y() : id.x();
+        const int mc = std::min<int>(block_m, num_rows - m0);
+        const int nc = std::min<int>(block_n, num_cols - n0);
+
+        const float *const batch_b_ptr = b_ptr + id.z() * stride_b_batch;
+        float *const       batch_c_ptr = c_ptr + id.z() * stride_c_batch;
+
+        for(int k0 = 0; k0 < num_k; k0 += block_k)
+        {
+            const int  kc     = std::min<int>(block_k, num_k - k0);
+            const bool finish = has_epilogue && (k0 + kc == num_k);
+
+            pack_a(a_ptr + m0 * stride_a + k0 * stride_a_k, stride_a, stride_a_k, mc, kc, packed_a);
+            pack_b(batch_b_ptr + k0 * stride_b, stride_b, layout_b, n0, kc, nc, packed_b);
+
+            // Each panel of matrix B is multiplied by the whole block of matrix A while it is in the L1 cache
+            for(int n = 0; n < nc; n += tile_n)
+            {
+                const float *const panel_b = packed_b + n * kc;
+
+                for(int m = 0; m < mc; m += tile_m)
+                {
+                    // The biases and the activation function are applied once the whole K dimension has been accumulated
+                    const float *const tile_biases = (biases_ptr != nullptr) ? biases_ptr + m0 + m : nullptr;
+                    const auto         epilogue    = [&](const float32x4_t & x, int row)
+                    {
+                        const float32x4_t res = (tile_biases != nullptr) ? vaddq_f32(x, vdupq_n_f32(tile_biases[row])) : x;
+                        return (_act_func != nullptr) ? _act_func(res, act_a, act_b) : res;
+                    };
+
+                    micro_kernel(packed_a + m * kc, panel_b, kc, batch_c_ptr + (m0 + m) * stride_c, stride_c, layout_c, n0 + n,
+                                 std::min<int>(tile_m, mc - m), std::min<int>(tile_n, nc - n), _alpha, k0 != 0, finish, epilogue);
+                }
+            }
+        }
+    });
+}
+
+SchedulingPolicy NEGEMMBlockedMatrixMultiplyKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
+
+bool NEGEMMBlockedMatrixMultiplyKernel::is_compute_bound() const
+{
+    return true;
+}
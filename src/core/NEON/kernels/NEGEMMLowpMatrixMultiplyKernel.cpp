@@ -23,9 +23,12 @@
  */
 #include "arm_compute/core/NEON/kernels/NEGEMMLowpMatrixMultiplyKernel.h"
 
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPUFeatures.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/dotprod/NEGEMMLowpDotProduct.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Utils.h"
@@ -45,27 +48,94 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
+namespace
+{
+/** Requantize 4 accumulators: multiply them by the integer multiplier, shift them right, rounding to the nearest integer, then add the result offset.
+ *
+ * The product is computed in 64 bits so that the multiplier can use up to 31 bits without overflowing.
+ */
+inline int32x4_t vrequantizeq_s32(const int32x4_t &x, const int32x2_t &multiplier, const int64x2_t &shift_right, const int32x4_t &result_offset)
+{
+    const int64x2_t low  = vrshlq_s64(vmull_s32(vget_low_s32(x), multiplier), shift_right);
+    const int64x2_t high = vrshlq_s64(vmull_s32(vget_high_s32(x), multiplier), shift_right);
+    return vqaddq_s32(vcombine_s32(vqmovn_s64(low), vqmovn_s64(high)), result_offset);
+}
+
+/** Saturate 8 requantized values to uint8 and clamp them to the range of the fused activation function */
+inline uint8x8_t vclamp_u8(const int32x4_t &low, const int32x4_t &high, const uint8x8_t &min_bound, const uint8x8_t &max_bound)
+{
+    return vmin_u8(vmax_u8(vqmovun_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high))), min_bound), max_bound);
+}
+
+/** Widen 16 uint8 values, holding 4 values for 4 consecutive columns, to int32 and add an offset to them */
+inline void vload_offset_u8(const uint8_t *ptr, const int32x4_t &offset, int32x4_t (&values)[4])
+{
+    const uint8x16_t data = vld1q_u8(ptr);
+    const int16x8_t  low  = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data)));
+    const int16x8_t  high = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data)));
+
+    values[0] = vaddw_s16(offset, vget_low_s16(low));
+    values[1] = vaddw_s16(offset, vget_high_s16(low));
+    values[2] = vaddw_s16(offset, vget_low_s16(high));
+    values[3] = vaddw_s16(offset, vget_high_s16(high));
+}
+
+/** Widen 4 uint8 values to int32 and add an offset to them */
+inline int32x4_t vload4_offset_u8(const uint8_t *ptr, const int32x4_t &offset)
+{
+    const int32_t values[4] = { ptr[0], ptr[1], ptr[2], ptr[3] };
+    return vaddq_s32(vld1q_s32(values), offset);
+}
+
+/** Check whether the dot product paths were built and the CPU supports the dot product instructions
+ *
+ * @return True if the kernel must run the dot product paths
+ */
+bool use_dot_product()
+{
+#ifdef ARM_COMPUTE_ENABLE_DOTPROD
+    return cpu_features().dot_product;
+#else  /* ARM_COMPUTE_ENABLE_DOTPROD */
+    return false;
+#endif /* ARM_COMPUTE_ENABLE_DOTPROD */
+}
+} // namespace
+
 NEGEMMLowpMatrixMultiplyKernel::NEGEMMLowpMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr), _a_offset(0), _b_offset(0), _output_offset(0), _output_mult_int(0), _shift(0)
+    : _input0(nullptr), _input1(nullptr), _biases(nullptr), _output(nullptr), _a_offset(0), _b_offset(0), _output_offset(0), _output_mult_int(0), _shift(0), _result_offset(0), _min_bound(0), _max_bound(255),
+      _is_convolution_output(false), _use_dot_product(false)
 {
 }
 
 void NEGEMMLowpMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output,
-                                               int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift)
+                                               int32_t a_offset, int32_t b_offset, int32_t output_offset, int32_t output_mult_int, int32_t shift,
+                                               const ITensor *biases, const ActivationLayerInfo &act_info, int32_t result_offset)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
 
-    _input0          = input0;
-    _input1          = input1;
-    _output          = output;
-    _a_offset        = a_offset;
-    _b_offset        = b_offset;
-    _output_offset   = output_offset;
-    _output_mult_int = output_mult_int;
-    _shift           = shift;
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    _input0                = input0;
+    _input1                = input1;
+    _biases                = biases;
+    _output                = output;
+    _a_offset              = a_offset;
+    _b_offset              = b_offset;
+    _output_offset         = output_offset;
+    _output_mult_int       = output_mult_int;
+    _shift                 = shift;
+    _result_offset         = result_offset;
+    _is_convolution_output = false;
+    _use_dot_product       = use_dot_product();
+    std::tie(_min_bound, _max_bound) = quantized_activation_bounds(act_info, output->info()->quantization_info());
 
     constexpr unsigned int num_elems_processed_per_iteration_x = 4;
     constexpr unsigned int num_elems_processed_per_iteration_y = 4;
@@ -76,17 +146,125 @@ void NEGEMMLowpMatrixMultiplyKernel::configure(const ITensor *input0, const ITen
     AccessWindowHorizontal in0_access(input0->info(), 0, num_elems_processed_per_iteration_x);
     AccessWindowHorizontal in1_access(input1->info(), 0, num_elems_processed_per_iteration_x);
 
-    update_window_and_padding(win, in0_access, in1_access, output_access);
+    if(biases != nullptr)
+    {
+        // The biases of the 4 columns of a block are loaded together
+        AccessWindowStatic biases_access(biases->info(), 0, 0, ceil_to_multiple(biases->info()->dimension(0), num_elems_processed_per_iteration_x), biases->info()->dimension(1));
+
+        update_window_and_padding(win, in0_access, in1_access, biases_access, output_access);
+    }
+    else
+    {
+        update_window_and_padding(win, in0_access, in1_access, output_access);
+    }
 
     output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
     INEKernel::configure(win);
 }
 
+unsigned int NEGEMMLowpMatrixMultiplyKernel::convolution_weights_transpose_width()
+{
+    // Each 4x4 block of the product holds 4 output feature maps
+    return 4;
+}
+
+void NEGEMMLowpMatrixMultiplyKernel::configure_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, int32_t a_offset, int32_t b_offset,
+                                                           int32_t output_offset, int32_t output_mult_int, int32_t shift, const ActivationLayerInfo &act_info, int32_t result_offset)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(2) != input1->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(2) % input0->info()->dimension(2)) != 0);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != ceil_to_multiple(output->info()->dimension(2) / input0->info()->dimension(2), convolution_weights_transpose_width()) / convolution_weights_transpose_width());
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != ceil_to_multiple(output->info()->dimension(0) * output->info()->dimension(1), 4) / 4);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(2));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    _input0                = input0;
+    _input1                = input1;
+    _biases                = biases;
+    _output                = output;
+    _a_offset              = a_offset;
+    _b_offset              = b_offset;
+    _output_offset         = output_offset;
+    _output_mult_int       = output_mult_int;
+    _shift                 = shift;
+    _result_offset         = result_offset;
+    _is_convolution_output = true;
+    _use_dot_product       = use_dot_product();
+    std::tie(_min_bound, _max_bound) = quantized_activation_bounds(act_info, output->info()->quantization_info());
+
+    // Configure kernel window: the columns of the product are the output elements of a feature map, the rows are the output feature maps.
+    // The groups of a grouped convolution are independent products which are all computed by the same window.
+    const unsigned int num_output_elems = output->info()->dimension(0) * output->info()->dimension(1);
+    const unsigned int num_groups       = input0->info()->dimension(2);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(num_output_elems, 16), 16));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(2) / num_groups, 4), 4));
+    win.set(Window::DimZ, Window::Dimension(0, num_groups, 1));
+    win.set(3, Window::Dimension(0, output->info()->dimension(3), 1));
+
+    // The last iteration of each row reads up to 3 blocks of matrix B past its end
+    AccessWindowStatic input1_access(input1->info(), 0, 0, input1->info()->dimension(0), ceil_to_multiple(num_output_elems, 16) / 4);
+
+    update_window_and_padding(win, input1_access);
+
+    // The output elements beyond the output feature maps are not stored so the output needs no padding
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
 void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    if(_use_dot_product)
+    {
+        run_dot_product(window);
+    }
+    else if(_is_convolution_output)
+    {
+        run_convolution(window);
+    }
+    else
+    {
+        run_matrix(window);
+    }
+}
+
+void NEGEMMLowpMatrixMultiplyKernel::run_dot_product(const Window &window)
+{
+#ifdef ARM_COMPUTE_ENABLE_DOTPROD
+    const dotprod::QuantizationParameters params = { _a_offset, _b_offset, _output_offset, _output_mult_int, _shift, _result_offset, _min_bound, _max_bound };
+
+    if(_is_convolution_output)
+    {
+        dotprod::matrix_multiply_convolution(_input0, _input1, _biases, _output, window, params);
+    }
+    else
+    {
+        dotprod::matrix_multiply(_input0, _input1, _biases, _output, window, params);
+    }
+#else  /* ARM_COMPUTE_ENABLE_DOTPROD */
+    ARM_COMPUTE_UNUSED(window);
+    ARM_COMPUTE_ERROR("The library was built without the dot product kernels (dotprod=0)");
+#endif /* ARM_COMPUTE_ENABLE_DOTPROD */
+}
+
+void NEGEMMLowpMatrixMultiplyKernel::run_matrix(const Window &window)
+{
     const size_t in_b_stride = _input1->info()->strides_in_bytes()[1];
     const size_t out_stride  = _output->info()->strides_in_bytes()[1];
 
@@ -95,28 +273,32 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window)
     win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
     win_a.set(Window::DimY, Window::Dimension(window.y().start() >> 2, window.y().end() >> 2, 1));
 
-    /* Set step_x and step_y for matrix B. Scale by a factor of 4 the X range as the input transposed matrix A has 4 times less the cols of the output matrix */
+    /* Set step_x and step_y for matrix B. The input transposed matrix B has one row for each 4 columns of the output matrix: start on the row of the first column of the window */
     Window win_b(window);
-    win_b.set(Window::DimX, Window::Dimension(window.x().start() >> 2, window.x().end() >> 2, in_b_stride));
-    win_b.set(Window::DimY, Window::Dimension(0, 0, 0));
+    win_b.set(Window::DimX, Window::Dimension(0, 1, in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
 
     /* The step x and step y for the output matrix has been already set using in configure() */
     Iterator ina(_input0, win_a);
     Iterator inb(_input1, win_b);
     Iterator out(_output, window);
 
-    const int32x4_t voffset_a   = vdupq_n_s32(_a_offset);
-    const int32x4_t voffset_b   = vdupq_n_s32(_b_offset);
-    const int32x4_t voffset_out = vdupq_n_s32(_output_offset);
-    const int32x4_t vshiftr     = vdupq_n_s32(-_shift);
+    const int32x4_t voffset_a      = vdupq_n_s32(_a_offset);
+    const int32x4_t voffset_b      = vdupq_n_s32(_b_offset);
+    const int32x4_t voffset_out    = vdupq_n_s32(_output_offset);
+    const int32x2_t vmult          = vdup_n_s32(_output_mult_int);
+    const int64x2_t vshiftr        = vdupq_n_s64(-_shift);
+    const int32x4_t vresult_offset = vdupq_n_s32(_result_offset);
+    const uint8x8_t vmin_bound     = vdup_n_u8(_min_bound);
+    const uint8x8_t vmax_bound     = vdup_n_u8(_max_bound);
 
     const int width_b   = _input1->info()->dimension(0);
     const int max_it_16 = width_b - 16;
 
-    execute_window_loop(window, [&](const Coordinates &)
+    execute_window_loop(window, [&](const Coordinates & id)
     {
-        auto *mtx_a0 = reinterpret_cast<const int8_t *>(ina.ptr());
-        auto *mtx_b0 = reinterpret_cast<const int8_t *>(inb.ptr());
+        auto *mtx_a0 = reinterpret_cast<const uint8_t *>(ina.ptr());
+        auto *mtx_b0 = reinterpret_cast<const uint8_t *>(inb.ptr());
 
         int32x4x4_t c =
         {
@@ -131,24 +313,25 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window)
         // if max_it_16 < 0 we skip the for block and fall back to process just 4 elements
         for(; k <= max_it_16; k += 16, mtx_a0 += 16, mtx_b0 += 16)
         {
-            const int8x16_t   p00 = vld1q_s8(mtx_a0);
-            const int8x16_t   q00 = vld1q_s8(mtx_b0);
+            // The values are unsigned: they must be zero-extended
+            const uint8x16_t  p00 = vld1q_u8(mtx_a0);
+            const uint8x16_t  q00 = vld1q_u8(mtx_b0);
             const int32x4x4_t ia0 =
             {
                 {
-                    vaddw_s16(voffset_a, vget_low_s16(vmovl_s8(vget_low_s8(p00)))),
-                    vaddw_s16(voffset_a, vget_high_s16(vmovl_s8(vget_low_s8(p00)))),
-                    vaddw_s16(voffset_a, vget_low_s16(vmovl_s8(vget_high_s8(p00)))),
-                    vaddw_s16(voffset_a, vget_high_s16(vmovl_s8(vget_high_s8(p00))))
+                    vaddw_s16(voffset_a, vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(p00))))),
+                    vaddw_s16(voffset_a, vget_high_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(p00))))),
+                    vaddw_s16(voffset_a, vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(p00))))),
+                    vaddw_s16(voffset_a, vget_high_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(p00)))))
                 }
             };
             const int32x4x4_t ib0 =
             {
                 {
-                    vaddw_s16(voffset_b, vget_low_s16(vmovl_s8(vget_low_s8(q00)))),
-                    vaddw_s16(voffset_b, vget_high_s16(vmovl_s8(vget_low_s8(q00)))),
-                    vaddw_s16(voffset_b, vget_low_s16(vmovl_s8(vget_high_s8(q00)))),
-                    vaddw_s16(voffset_b, vget_high_s16(vmovl_s8(vget_high_s8(q00))))
+                    vaddw_s16(voffset_b, vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(q00))))),
+                    vaddw_s16(voffset_b, vget_high_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(q00))))),
+                    vaddw_s16(voffset_b, vget_low_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(q00))))),
+                    vaddw_s16(voffset_b, vget_high_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(q00)))))
                 }
             };
             /* Accumulation 0 */
@@ -174,25 +357,26 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window)
         }
         for(; k < width_b; k += 4, mtx_a0 += 4, mtx_b0 += 4)
         {
-            const int8x8_t  p00 = vld1_s8(mtx_a0);
-            const int8x8_t  q00 = vld1_s8(mtx_b0);
-            const int32x4_t ia0 = vaddw_s16(voffset_a, vget_low_s16(vmovl_s8(p00)));
-            const int32x4_t ib0 = vaddw_s16(voffset_b, vget_low_s16(vmovl_s8(q00)));
+            const int32x4_t ia0 = vload4_offset_u8(mtx_a0, voffset_a);
+            const int32x4_t ib0 = vload4_offset_u8(mtx_b0, voffset_b);
 
             c.val[0] = vmlaq_lane_s32(c.val[0], ib0, vget_low_s32(ia0), 0);
             c.val[1] = vmlaq_lane_s32(c.val[1], ib0, vget_low_s32(ia0), 1);
             c.val[2] = vmlaq_lane_s32(c.val[2], ib0, vget_high_s32(ia0), 0);
             c.val[3] = vmlaq_lane_s32(c.val[3], ib0, vget_high_s32(ia0), 1);
         }
-        c.val[0] = vshlq_s32(vmulq_n_s32(vaddq_s32(voffset_out, c.val[0]), _output_mult_int), vshiftr);
-        c.val[1] = vshlq_s32(vmulq_n_s32(vaddq_s32(voffset_out, c.val[1]), _output_mult_int), vshiftr);
-        c.val[2] = vshlq_s32(vmulq_n_s32(vaddq_s32(voffset_out, c.val[2]), _output_mult_int), vshiftr);
-        c.val[3] = vshlq_s32(vmulq_n_s32(vaddq_s32(voffset_out, c.val[3]), _output_mult_int), vshiftr);
+        // The biases are the same for the 4 rows of the block
+        const int32x4_t voffset = (_biases != nullptr) ? vaddq_s32(voffset_out, vld1q_s32(reinterpret_cast<const int32_t *>(_biases->ptr_to_element(Coordinates(id.x()))))) : voffset_out;
+
+        c.val[0] = vrequantizeq_s32(vaddq_s32(voffset, c.val[0]), vmult, vshiftr, vresult_offset);
+        c.val[1] = vrequantizeq_s32(vaddq_s32(voffset, c.val[1]), vmult, vshiftr, vresult_offset);
+        c.val[2] = vrequantizeq_s32(vaddq_s32(voffset, c.val[2]), vmult, vshiftr, vresult_offset);
+        c.val[3] = vrequantizeq_s32(vaddq_s32(voffset, c.val[3]), vmult, vshiftr, vresult_offset);
         const uint8x8x2_t r =
         {
             {
-                vqmovun_s16(vcombine_s16(vqmovn_s32(c.val[0]), vqmovn_s32(c.val[1]))),
-                vqmovun_s16(vcombine_s16(vqmovn_s32(c.val[2]), vqmovn_s32(c.val[3])))
+                vclamp_u8(c.val[0], c.val[1], vmin_bound, vmax_bound),
+                vclamp_u8(c.val[2], c.val[3], vmin_bound, vmax_bound)
             }
         };
         const auto mtx_out = reinterpret_cast<uint8_t *>(out.ptr());
@@ -215,3 +399,115 @@ void NEGEMMLowpMatrixMultiplyKernel::run(const Window &window)
     },
     ina, inb, out);
 }
+
+void NEGEMMLowpMatrixMultiplyKernel::run_convolution(const Window &window)
+{
+    const size_t in_b_stride          = _input1->info()->strides_in_bytes()[1];
+    const int    num_elems_matrix_b_x = _input1->info()->dimension(0);
+    const int    output_width         = _output->info()->dimension(0);
+    const int    num_output_elems     = output_width * _output->info()->dimension(1);
+    const int    num_ofm_per_group    = _output->info()->dimension(2) / _input0->info()->dimension(2);
+    const size_t out_stride_y         = _output->info()->strides_in_bytes()[1];
+    const size_t out_stride_z         = _output->info()->strides_in_bytes()[2];
+    const size_t out_stride_w         = _output->info()->strides_in_bytes()[3];
+
+    uint8_t *const output_ptr = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    // Matrix A holds the weights: it is the same for all the batches, and has one plane per group of convolution like matrix B
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 4, window.y().end() / 4, 1));
+    win_a.set(3, Window::Dimension(0, 0, 0));
+
+    // The step along the x direction is 4 times the in_b_stride because for each iteration we compute 4 blocks of size 4x4,
+    // and the window starts on the row of matrix B holding the first column of the window (One row for each 4 columns)
+    Window win_b(window);
+    win_b.set(Window::DimX, Window::Dimension(0, 1, 4 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
+
+    Iterator ina(_input0, win_a);
+    Iterator inb(_input1, win_b);
+
+    const int32x4_t voffset_a      = vdupq_n_s32(_a_offset);
+    const int32x4_t voffset_b      = vdupq_n_s32(_b_offset);
+    const int32x2_t vmult          = vdup_n_s32(_output_mult_int);
+    const int64x2_t vshiftr        = vdupq_n_s64(-_shift);
+    const int32x4_t vresult_offset = vdupq_n_s32(_result_offset);
+    const uint8x8_t vmin_bound     = vdup_n_u8(_min_bound);
+    const uint8x8_t vmax_bound     = vdup_n_u8(_max_bound);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto mtx_a0 = reinterpret_cast<const uint8_t *>(ina.ptr());
+        const auto mtx_b0 = reinterpret_cast<const uint8_t *>(inb.ptr());
+
+        // acc[i][j] holds the output feature map id.y() + i for the output elements [id.x() + 4 * j, id.x() + 4 * j + 4)
+        int32x4_t acc[4][4];
+        for(int i = 0; i < 4; ++i)
+        {
+            for(int j = 0; j < 4; ++j)
+            {
+                acc[i][j] = vdupq_n_s32(0);
+            }
+        }
+
+        // Each row of the matrices holds 4 values for each element of the dot product: process 4 elements at a time
+        int k = 0;
+        for(; k <= num_elems_matrix_b_x - 16; k += 16)
+        {
+            int32x4_t a[4];
+            vload_offset_u8(mtx_a0 + k, voffset_a, a);
+
+            for(int j = 0; j < 4; ++j)
+            {
+                int32x4_t b[4];
+                vload_offset_u8(mtx_b0 + j * in_b_stride + k, voffset_b, b);
+
+                for(int e = 0; e < 4; ++e)
+                {
+                    acc[0][j] = vmlaq_lane_s32(acc[0][j], b[e], vget_low_s32(a[e]), 0);
+                    acc[1][j] = vmlaq_lane_s32(acc[1][j], b[e], vget_low_s32(a[e]), 1);
+                    acc[2][j] = vmlaq_lane_s32(acc[2][j], b[e], vget_high_s32(a[e]), 0);
+                    acc[3][j] = vmlaq_lane_s32(acc[3][j], b[e], vget_high_s32(a[e]), 1);
+                }
+            }
+        }
+        for(; k < num_elems_matrix_b_x; k += 4)
+        {
+            const int32x4_t a = vload4_offset_u8(mtx_a0 + k, voffset_a);
+
+            for(int j = 0; j < 4; ++j)
+            {
+                const int32x4_t b = vload4_offset_u8(mtx_b0 + j * in_b_stride + k, voffset_b);
+
+                acc[0][j] = vmlaq_lane_s32(acc[0][j], b, vget_low_s32(a), 0);
+                acc[1][j] = vmlaq_lane_s32(acc[1][j], b, vget_low_s32(a), 1);
+                acc[2][j] = vmlaq_lane_s32(acc[2][j], b, vget_high_s32(a), 0);
+                acc[3][j] = vmlaq_lane_s32(acc[3][j], b, vget_high_s32(a), 1);
+            }
+        }
+
+        // Store the blocks, skipping the rows and columns beyond the output
+        for(int i = 0; (i < 4) && (id.y() + i < num_ofm_per_group); ++i)
+        {
+            const int       ofm    = id.z() * num_ofm_per_group + id.y() + i;
+            const int32_t   bias   = (_biases != nullptr) ? *reinterpret_cast<const int32_t *>(_biases->ptr_to_element(Coordinates(ofm))) : 0;
+            const int32x4_t offset = vdupq_n_s32(bias + _output_offset);
+            uint8_t *const  plane  = output_ptr + ofm * out_stride_z + id[3] * out_stride_w;
+
+            for(int j = 0; (j < 4) && (id.x() + 4 * j < num_output_elems); ++j)
+            {
+                const int       elem = id.x() + 4 * j;
+                const int32x4_t res  = vrequantizeq_s32(vaddq_s32(acc[i][j], offset), vmult, vshiftr, vresult_offset);
+
+                uint8_t values[8];
+                vst1_u8(values, vclamp_u8(res, res, vmin_bound, vmax_bound));
+                for(int e = 0; (e < 4) && (elem + e < num_output_elems); ++e)
+                {
+                    *(plane + ((elem + e) / output_width) * out_stride_y + (elem + e) % output_width) = values[e];
+                }
+            }
+        }
+    },
+    ina, inb);
+}
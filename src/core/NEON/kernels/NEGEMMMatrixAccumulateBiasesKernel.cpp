@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
@@ -34,25 +35,76 @@
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <map>
 
 using namespace arm_compute;
 
 NEGEMMMatrixAccumulateBiasesKernel::NEGEMMMatrixAccumulateBiasesKernel()
-    : _accum(nullptr), _biases(nullptr)
+    : _func(nullptr), _accum(nullptr), _biases(nullptr), _act_info()
 {
 }
 
-void NEGEMMMatrixAccumulateBiasesKernel::configure(ITensor *accum, const ITensor *biases)
+void NEGEMMMatrixAccumulateBiasesKernel::configure(ITensor *accum, const ITensor *biases, const ActivationLayerInfo &act_info)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(accum, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(accum, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(biases, accum);
     ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() != 1);
 
-    _biases = biases;
-    _accum  = accum;
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
 
-    constexpr unsigned int num_elems_processed_per_iteration = 4;
+    static std::map<ActivationFunction, AccumulateBiasesFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<true, ActivationFunction::TANH> },
+    };
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    static std::map<ActivationFunction, AccumulateBiasesFunctionPtr> act_map_f16 =
+    {
+        { ActivationFunction::ABS, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<true, ActivationFunction::TANH> },
+    };
+#endif
+
+    _biases   = biases;
+    _accum    = accum;
+    _act_info = act_info;
+
+    unsigned int num_elems_processed_per_iteration = 4;
+
+    switch(accum->info()->data_type())
+    {
+        case DataType::F32:
+        {
+            _func = act_info.enabled() ? act_map[act_info.activation()] : &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases<false, ActivationFunction::LINEAR>;
+            break;
+        }
+        case DataType::F16:
+#ifdef ARM_COMPUTE_ENABLE_FP16
+        {
+            num_elems_processed_per_iteration = 8;
+            _func                             = act_info.enabled() ? act_map_f16[act_info.activation()] : &NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16<false, ActivationFunction::LINEAR>;
+            break;
+        }
+#endif
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
 
     // Configure kernel window
     Window win = calculate_max_window(*accum->info(), Steps(num_elems_processed_per_iteration));
@@ -68,10 +120,11 @@ void NEGEMMMatrixAccumulateBiasesKernel::configure(ITensor *accum, const ITensor
     INEKernel::configure(win);
 }
 
-void NEGEMMMatrixAccumulateBiasesKernel::run(const Window &window)
+template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+void NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases(const Window &window)
 {
-    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    const float32x4_t a = vdupq_n_f32(_act_info.a());
+    const float32x4_t b = vdupq_n_f32(_act_info.b());
 
     Window win_biases;
     win_biases.set(Window::DimX, Window::Dimension(window.x().start(), window.x().end(), window.x().step()));
@@ -85,7 +138,52 @@ void NEGEMMMatrixAccumulateBiasesKernel::run(const Window &window)
         const float32x4_t accum  = vld1q_f32(reinterpret_cast<const float *>(in0_out.ptr()));
         const float32x4_t biases = vld1q_f32(reinterpret_cast<const float *>(in1.ptr()));
 
-        vst1q_f32(reinterpret_cast<float *>(in0_out.ptr()), vaddq_f32(accum, biases));
+        const float32x4_t res    = vaddq_f32(accum, biases);
+
+        vst1q_f32(reinterpret_cast<float *>(in0_out.ptr()), has_activation ? vactivateq_f32<F>(res, a, b) : res);
+    },
+    in0_out, in1);
+}
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+template <bool has_activation, ActivationLayerInfo::ActivationFunction F>
+void NEGEMMMatrixAccumulateBiasesKernel::accumulate_biases_f16(const Window &window)
+{
+    const float16x8_t a = vdupq_n_f16(_act_info.a());
+    const float16x8_t b = vdupq_n_f16(_act_info.b());
+
+    Window win_biases;
+    win_biases.set(Window::DimX, Window::Dimension(window.x().start(), window.x().end(), window.x().step()));
+    win_biases.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in0_out(_accum, window);
+    Iterator in1(_biases, win_biases);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float16x8_t accum  = vld1q_f16(reinterpret_cast<const float16_t *>(in0_out.ptr()));
+        const float16x8_t biases = vld1q_f16(reinterpret_cast<const float16_t *>(in1.ptr()));
+
+        const float16x8_t res = vaddq_f16(accum, biases);
+
+        vst1q_f16(reinterpret_cast<float16_t *>(in0_out.ptr()), has_activation ? vactivateq_f16<F>(res, a, b) : res);
     },
     in0_out, in1);
 }
+#endif
+
+void NEGEMMMatrixAccumulateBiasesKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+KernelCost NEGEMMMatrixAccumulateBiasesKernel::cost(const Window &window) const
+{
+    // The accumulators are read and written back, and one bias read for each of them
+    const size_t num_elements = num_window_elements(window);
+    return KernelCost{ 3 * num_elements * _accum->info()->element_size(), num_elements };
+}
@@ -23,8 +23,10 @@
  */
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixAdditionKernel.h"
 
+#include "arm_compute/core/CPUFeatures.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/fp16/NEGEMMFP16.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 
@@ -46,6 +48,7 @@ void NEGEMMMatrixAdditionKernel::configure(const ITensor *input, ITensor *output
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MSG((input->info()->data_type() == DataType::F16) && !cpu_features().fp16, "The CPU doesn't support half precision arithmetic");
 
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != output->info()->dimension(0));
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != output->info()->dimension(1));
@@ -114,45 +117,11 @@ void NEGEMMMatrixAdditionKernel::run(const Window &window)
                 break;
             }
             case DataType::F16:
-#ifdef ARM_COMPUTE_ENABLE_FP16
-                {
-                    const float16x8_t beta_f16 = vdupq_n_f16(_beta);
-
-                    Iterator in(_input, window);
-                    Iterator out(_output, window);
-
-                    execute_window_loop(window, [&](const Coordinates & id)
-                    {
-                        const auto in_ptr  = reinterpret_cast<const float16_t *>(in.ptr());
-                        const auto out_ptr = reinterpret_cast<float16_t *>(out.ptr());
-
-                        float16x8x2_t alpha_ab =
-                        {
-                            {
-                                vld1q_f16(out_ptr + 0),
-                                vld1q_f16(out_ptr + 8)
-                            }
-                        };
-
-                        float16x8x2_t c =
-                        {
-                            {
-                                vld1q_f16(in_ptr + 0),
-                                vld1q_f16(in_ptr + 8)
-                            }
-                        };
-
-                        /* Multiply matrix C by its weight and accumulate */
-                        alpha_ab.val[0] = vaddq_f16(alpha_ab.val[0], vmulq_f16(c.val[0], beta_f16));
-                        alpha_ab.val[1] = vaddq_f16(alpha_ab.val[1], vmulq_f16(c.val[1], beta_f16));
-
-                        vst1q_f16(out_ptr + 0, alpha_ab.val[0]);
-                        vst1q_f16(out_ptr + 8, alpha_ab.val[1]);
-                    },
-                    in, out);
-
-                    break;
-                }
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA)
+            {
+                fp16::matrix_addition(_input, _output, window, _beta);
+                break;
+            }
 #endif
             default:
             {
@@ -23,20 +23,28 @@
  */
 #include "arm_compute/core/NEON/kernels/NEGEMMMatrixMultiplyKernel.h"
 
+#include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/AccessWindowTranspose.h"
+#include "arm_compute/core/CPUFeatures.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/NEON/NEFP16Storage.h"
+#include "arm_compute/core/NEON/kernels/fp16/NEGEMMFP16.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <map>
 #include <tuple>
 
 using namespace arm_compute;
@@ -180,8 +188,14 @@ void vector_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     inb, out);
 }
 
-template <bool multiply_alpha>
-void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, float alpha)
+/** Multiply the interleaved matrix A by the transposed matrix B
+ *
+ * Each iteration computes a 4x16 block of the output. The optional biases, weighted by @p beta, are added and the activation function
+ * is applied while the block is still in registers. The biases are either a row vector, broadcast to all the rows of the output, or a matrix of the output's size.
+ * The matrices are stored as T: half precision values (T = float16_t) are converted to single precision when they are loaded and back when the block is stored.
+ */
+template <bool multiply_alpha, typename T, typename F>
+void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, float alpha, float beta, F &&activation)
 {
     const size_t in_b_stride          = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
     const size_t out_stride1          = output->info()->strides_in_bytes()[1] / data_size_from_type(output->info()->data_type());
@@ -189,6 +203,10 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     const size_t out_stride3          = out_stride1 * 3;
     const int    num_elems_matrix_b_x = input1->info()->dimension(0);
 
+    // A row vector of biases is read again for each row of the block
+    const bool   is_biases_matrix = (biases != nullptr) && (biases->info()->dimension(1) > 1);
+    const size_t biases_stride    = is_biases_matrix ? biases->info()->strides_in_bytes()[1] / sizeof(T) : 0;
+
     // Set step_x and step_y for matrix A. Scale by a factor of 4 the Y range as the input interleaved matrix A has 4 times less the rows of the output matrix
     Window win_a(window);
     win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
@@ -201,10 +219,10 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     {
         win_b = window;
     }
-    // Set step_x and step_y for matrix B. Scale by a factor of 4 the X range as the input transposed matrix A has 4 times less the cols of the output matrix
+    // Set step_x and step_y for matrix B. The input transposed matrix B has one row for each 4 columns of the output matrix: start on the row of the first column of the window
     // The step along the x direction is 4 times the in_b_stride because for each iteration we compute 4 blocks of size 4x4
-    win_b.set(Window::DimX, Window::Dimension(window.x().start() / 4, window.x().end() / 4, 4 * in_b_stride));
-    win_b.set(Window::DimY, Window::Dimension(0, 1, 0));
+    win_b.set(Window::DimX, Window::Dimension(0, 1, 4 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
 
     Iterator ina(input0, win_a);
     Iterator inb(input1, win_b);
@@ -215,8 +233,8 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
     // All the values needed for computing a single 4x4 block will be read from consecutive memory positions
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        auto mtx_a0 = reinterpret_cast<const float *>(ina.ptr());
-        auto mtx_b0 = reinterpret_cast<const float *>(inb.ptr());
+        auto mtx_a0 = reinterpret_cast<const T *>(ina.ptr());
+        auto mtx_b0 = reinterpret_cast<const T *>(inb.ptr());
         auto mtx_b1 = mtx_b0 + in_b_stride;
         auto mtx_b2 = mtx_b1 + in_b_stride;
         auto mtx_b3 = mtx_b2 + in_b_stride;
@@ -243,13 +261,13 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
 
         for(int k = 0; k < num_elems_matrix_b_x; k += 4)
         {
-            const float32x4_t a    = vld1q_f32(mtx_a0);
+            const float32x4_t a    = vload_f32(mtx_a0);
             const float32x2_t a00l = vget_low_f32(a);
             const float32x2_t a00h = vget_high_f32(a);
-            const float32x4_t b00  = vld1q_f32(mtx_b0);
-            const float32x4_t b10  = vld1q_f32(mtx_b1);
-            const float32x4_t b20  = vld1q_f32(mtx_b2);
-            const float32x4_t b30  = vld1q_f32(mtx_b3);
+            const float32x4_t b00  = vload_f32(mtx_b0);
+            const float32x4_t b10  = vload_f32(mtx_b1);
+            const float32x4_t b20  = vload_f32(mtx_b2);
+            const float32x4_t b30  = vload_f32(mtx_b3);
 
             // 4x4 block 0
             acc00 = vmlaq_lane_f32(acc00, b00, a00l, 0);
@@ -304,183 +322,293 @@ void matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, IT
             acc33                       = vmulq_f32(acc33, alpha_f32);
         }
 
-        const auto mtx_out0 = reinterpret_cast<float *>(out.ptr());
+        // Add the weighted biases of the 16 columns
+        if(biases != nullptr)
+        {
+            const float32x4_t beta_f32  = vdupq_n_f32(beta);
+            const auto        bias_ptr0 = reinterpret_cast<const T *>(biases->ptr_to_element(Coordinates(id.x(), is_biases_matrix ? id.y() : 0)));
+            const auto        bias_ptr1 = bias_ptr0 + biases_stride;
+            const auto        bias_ptr2 = bias_ptr1 + biases_stride;
+            const auto        bias_ptr3 = bias_ptr2 + biases_stride;
+
+            acc00 = vmlaq_f32(acc00, vload_f32(bias_ptr0), beta_f32);
+            acc01 = vmlaq_f32(acc01, vload_f32(bias_ptr0 + 4), beta_f32);
+            acc02 = vmlaq_f32(acc02, vload_f32(bias_ptr0 + 8), beta_f32);
+            acc03 = vmlaq_f32(acc03, vload_f32(bias_ptr0 + 12), beta_f32);
+            acc10 = vmlaq_f32(acc10, vload_f32(bias_ptr1), beta_f32);
+            acc11 = vmlaq_f32(acc11, vload_f32(bias_ptr1 + 4), beta_f32);
+            acc12 = vmlaq_f32(acc12, vload_f32(bias_ptr1 + 8), beta_f32);
+            acc13 = vmlaq_f32(acc13, vload_f32(bias_ptr1 + 12), beta_f32);
+            acc20 = vmlaq_f32(acc20, vload_f32(bias_ptr2), beta_f32);
+            acc21 = vmlaq_f32(acc21, vload_f32(bias_ptr2 + 4), beta_f32);
+            acc22 = vmlaq_f32(acc22, vload_f32(bias_ptr2 + 8), beta_f32);
+            acc23 = vmlaq_f32(acc23, vload_f32(bias_ptr2 + 12), beta_f32);
+            acc30 = vmlaq_f32(acc30, vload_f32(bias_ptr3), beta_f32);
+            acc31 = vmlaq_f32(acc31, vload_f32(bias_ptr3 + 4), beta_f32);
+            acc32 = vmlaq_f32(acc32, vload_f32(bias_ptr3 + 8), beta_f32);
+            acc33 = vmlaq_f32(acc33, vload_f32(bias_ptr3 + 12), beta_f32);
+        }
+
+        const auto mtx_out0 = reinterpret_cast<T *>(out.ptr());
         const auto mtx_out1 = mtx_out0 + 4;
         const auto mtx_out2 = mtx_out1 + 4;
         const auto mtx_out3 = mtx_out2 + 4;
 
         // Store the 4 blocks
-        vst1q_f32(mtx_out0, acc00);
-        vst1q_f32(mtx_out1, acc01);
-        vst1q_f32(mtx_out2, acc02);
-        vst1q_f32(mtx_out3, acc03);
-        vst1q_f32(mtx_out0 + out_stride1, acc10);
-        vst1q_f32(mtx_out1 + out_stride1, acc11);
-        vst1q_f32(mtx_out2 + out_stride1, acc12);
-        vst1q_f32(mtx_out3 + out_stride1, acc13);
-        vst1q_f32(mtx_out0 + out_stride2, acc20);
-        vst1q_f32(mtx_out1 + out_stride2, acc21);
-        vst1q_f32(mtx_out2 + out_stride2, acc22);
-        vst1q_f32(mtx_out3 + out_stride2, acc23);
-        vst1q_f32(mtx_out0 + out_stride3, acc30);
-        vst1q_f32(mtx_out1 + out_stride3, acc31);
-        vst1q_f32(mtx_out2 + out_stride3, acc32);
-        vst1q_f32(mtx_out3 + out_stride3, acc33);
+        vstore_f32(mtx_out0, activation(acc00));
+        vstore_f32(mtx_out1, activation(acc01));
+        vstore_f32(mtx_out2, activation(acc02));
+        vstore_f32(mtx_out3, activation(acc03));
+        vstore_f32(mtx_out0 + out_stride1, activation(acc10));
+        vstore_f32(mtx_out1 + out_stride1, activation(acc11));
+        vstore_f32(mtx_out2 + out_stride1, activation(acc12));
+        vstore_f32(mtx_out3 + out_stride1, activation(acc13));
+        vstore_f32(mtx_out0 + out_stride2, activation(acc20));
+        vstore_f32(mtx_out1 + out_stride2, activation(acc21));
+        vstore_f32(mtx_out2 + out_stride2, activation(acc22));
+        vstore_f32(mtx_out3 + out_stride2, activation(acc23));
+        vstore_f32(mtx_out0 + out_stride3, activation(acc30));
+        vstore_f32(mtx_out1 + out_stride3, activation(acc31));
+        vstore_f32(mtx_out2 + out_stride3, activation(acc32));
+        vstore_f32(mtx_out3 + out_stride3, activation(acc33));
     },
     ina, inb, out);
 }
 
-template <bool multiply_alpha>
-void matrix_matrix_multiply_f16(const ITensor *input0, const ITensor *input1, ITensor *output, const Window &window, float alpha)
+/** Multiply the interleaved matrix A by the transposed matrix B, with the instantiation of matrix_matrix_multiply_f32 which weights the product by @p alpha only if needed */
+template <typename T, typename F>
+void run_matrix_matrix_multiply_f32(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, bool multiply_alpha, float alpha, float beta, F &&activation)
 {
-#ifdef ARM_COMPUTE_ENABLE_FP16
-    const size_t in_b_stride = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
-    const size_t out_stride  = output->info()->strides_in_bytes()[1] / data_size_from_type(output->info()->data_type());
+    if(multiply_alpha)
+    {
+        matrix_matrix_multiply_f32<true, T>(input0, input1, biases, output, window, alpha, beta, activation);
+    }
+    else
+    {
+        matrix_matrix_multiply_f32<false, T>(input0, input1, biases, output, window, alpha, beta, activation);
+    }
+}
 
-    // Set step_x and step_y for matrix A. Scale by a factor of 4 the Y range as the input interleaved matrix A has 4 times less the rows of the output matrix
+/** Multiply the weights of a convolution layer by its im2col reshaped input and store the result in the output of the layer
+ *
+ * Each iteration computes 4 output feature maps (rows of matrix A) for 16 output elements (columns of matrix B).
+ * The output elements are numbered in row-major order: a block of 4 elements is stored with a single vector store
+ * when it does not cross the end of a row of the output feature map.
+ * In an NHWC output the 4 output feature maps of an output element are contiguous: the block is transposed and each output element is stored with a single vector store.
+ * The tensors are stored as T: half precision values (T = float16_t) are converted to single precision when they are loaded and back when they are stored.
+ */
+template <typename T, typename F>
+void matrix_matrix_multiply_f32_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, F &&activation)
+{
+    const bool   is_nhwc              = (output->info()->data_layout() == DataLayout::NHWC);
+    const size_t in_b_stride          = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
+    const int    num_elems_matrix_b_x = input1->info()->dimension(0);
+    const int    output_width         = output->info()->dimension(is_nhwc ? 1 : 0);
+    const int    num_output_elems     = output_width * output->info()->dimension(is_nhwc ? 2 : 1);
+    const int    num_ofm_per_group    = output->info()->dimension(is_nhwc ? 0 : 2) / input0->info()->dimension(2);
+    const size_t out_stride_x         = output->info()->strides_in_bytes()[is_nhwc ? 1 : 0];
+    const size_t out_stride_y         = output->info()->strides_in_bytes()[is_nhwc ? 2 : 1];
+    const size_t out_stride_z         = output->info()->strides_in_bytes()[is_nhwc ? 0 : 2];
+    const size_t out_stride_w         = output->info()->strides_in_bytes()[3];
+
+    uint8_t *const output_ptr = output->buffer() + output->info()->offset_first_element_in_bytes();
+
+    // Matrix A holds the weights: it is the same for all the batches, and has one plane per group of convolution like matrix B
     Window win_a(window);
     win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
-    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 4, std::max(window.y().end() / 4, 1), 1));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 4, window.y().end() / 4, 1));
+    win_a.set(3, Window::Dimension(0, 0, 0));
 
-    Window win_b;
-    // Don't slice matrix B along the z dimension if matrix B has just 2 dimensions and matrix A more than 2
-    // This scenario can happen when the the matrix multiplication is used to perform a convolution operation
-    if(input1->info()->num_dimensions() >= 3)
-    {
-        win_b = window;
-    }
-    // Set step_x and step_y for matrix B. Scale by a factor of 8 the X range as the input transposed matrix A has 8 times less the cols of the output matrix
-    win_b.set(Window::DimX, Window::Dimension(window.x().start() / 8, window.x().end() / 8, in_b_stride));
-    win_b.set(Window::DimY, Window::Dimension(0, 1, 0));
+    // The step along the x direction is 4 times the in_b_stride because for each iteration we compute 4 blocks of size 4x4,
+    // and the window starts on the row of matrix B holding the first column of the window (One row for each 4 columns)
+    Window win_b(window);
+    win_b.set(Window::DimX, Window::Dimension(0, 1, 4 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
 
     Iterator ina(input0, win_a);
     Iterator inb(input1, win_b);
-    Iterator out(output, window);
-
-    // Number of iterations of inner loop. Since 8 is the number of accumulations per loop, num_it = (width_mtx_b / 4) / 8
-    const size_t num_it = ((input1->info()->dimension(0)) >> 2) >> 3;
-
-    const float16x8_t alpha_f16 = vdupq_n_f16(alpha);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const auto   *mtx_a0  = reinterpret_cast<const float16_t *>(ina.ptr());
-        const auto   *mtx_b0  = reinterpret_cast<const float16_t *>(inb.ptr());
-        auto         *mtx_out = reinterpret_cast<float16_t *>(out.ptr());
-        float16x8x4_t c =
+        auto mtx_a0 = reinterpret_cast<const T *>(ina.ptr());
+        auto mtx_b0 = reinterpret_cast<const T *>(inb.ptr());
+
+        // acc[i][j] holds the output feature map id.y() + i for the output elements [id.x() + 4 * j, id.x() + 4 * j + 4)
+        float32x4_t acc[4][4];
+        for(int i = 0; i < 4; ++i)
         {
+            for(int j = 0; j < 4; ++j)
             {
-                vdupq_n_f16(0.f),
-                vdupq_n_f16(0.f),
-                vdupq_n_f16(0.f),
-                vdupq_n_f16(0.f)
+                acc[i][j] = vdupq_n_f32(0.f);
             }
-        };
+        }
 
-        /*
-        This kernel puts the values in a 4x4 block of Matrix A on the same row (Interleaved values)
-             |a00 a01 a02 a03 | a04 a05 a06 a07|
-             |a10 a11 a12 a13 | a14 a15 a16 a17|
-             |a20 a21 a22 a23 | a24 a25 a26 a27| = | a00 a10 a20 a30 || a01 a11 a21 a31 || a02 a12 a22 a32 || a03 a13 a23 a33 | a40 a50 a60 a70 | ...
-             |a30 a31 a32 a33 | a34 a35 a36 a37|   | a04 a14 a24 a34 || a05 a15 a25 a35 || a06 a15 a26 a36 || a07 a17 a27 a37 | a44 a54 a64 a74 | ...
-             |a40 a41 a42 a43 | a44 a45 a46 a47|
-             |a50 a51 a52 a53 | a54 a55 a56 a57|
-             |a60 a61 a62 a63 | a64 a65 a66 a67|
-             |a70 a71 a72 a73 | a74 a75 a76 a77|
+        for(int k = 0; k < num_elems_matrix_b_x; k += 4)
+        {
+            const float32x4_t a    = vload_f32(mtx_a0);
+            const float32x2_t a00l = vget_low_f32(a);
+            const float32x2_t a00h = vget_high_f32(a);
 
-             After this operation, the output matrix will have the following shape: [ height * 4, width / 4 ]
+            for(int j = 0; j < 4; ++j)
+            {
+                const float32x4_t b = vload_f32(mtx_b0 + j * in_b_stride);
 
-        B Matrix has been transposed as shown below
+                acc[0][j] = vmlaq_lane_f32(acc[0][j], b, a00l, 0);
+                acc[1][j] = vmlaq_lane_f32(acc[1][j], b, a00l, 1);
+                acc[2][j] = vmlaq_lane_f32(acc[2][j], b, a00h, 0);
+                acc[3][j] = vmlaq_lane_f32(acc[3][j], b, a00h, 1);
+            }
 
-           |b00 b01 b02 b03 b04 b05 b06 b07|
-           |b10 b11 b12 b13 b14 b15 b16 b17|
-           |b20 b21 b22 b23 b24 b25 b26 b27|
-           |b30 b31 b32 b33 b34 b35 b36 b37|
-          ------------------->
+            mtx_a0 += 4;
+            mtx_b0 += 4;
+        }
 
-           |b00 b01 b02 b03 b04 b05 b06 b07||b10 b11 b12 b13 b14 b15 b16 b17||b20 b21 b22 b23 b24 b25 b26 b27||b30 b31 b32 b33 b34 b35 b36 b37|
+        if(is_nhwc)
+        {
+            // Transpose the blocks so that each vector holds the 4 output feature maps of an output element
+            const int   first_ofm = id.z() * num_ofm_per_group + id.y();
+            const int   num_ofm   = std::min(4, num_ofm_per_group - id.y());
+            float32x4_t bias      = vdupq_n_f32(0.f);
+            if(biases != nullptr)
+            {
+                float values[4] = { 0.f, 0.f, 0.f, 0.f };
+                for(int i = 0; i < num_ofm; ++i)
+                {
+                    values[i] = *reinterpret_cast<const T *>(biases->ptr_to_element(Coordinates(first_ofm + i)));
+                }
+                bias = vld1q_f32(values);
+            }
+            uint8_t *const batch = output_ptr + first_ofm * out_stride_z + id[3] * out_stride_w;
 
-            c.val[0][0] = a00*b00 + a01*b10 + a02*b20 + a03*b30
-            c.val[0][1] = a00*b01 + a01*b11 + a02*b21 + a03*b31
+            for(int j = 0; (j < 4) && (id.x() + 4 * j < num_output_elems); ++j)
+            {
+                const float32x4x2_t t01 = vtrnq_f32(acc[0][j], acc[1][j]);
+                const float32x4x2_t t23 = vtrnq_f32(acc[2][j], acc[3][j]);
+                const float32x4_t   res[4] =
+                {
+                    activation(vaddq_f32(vcombine_f32(vget_low_f32(t01.val[0]), vget_low_f32(t23.val[0])), bias)),
+                    activation(vaddq_f32(vcombine_f32(vget_low_f32(t01.val[1]), vget_low_f32(t23.val[1])), bias)),
+                    activation(vaddq_f32(vcombine_f32(vget_high_f32(t01.val[0]), vget_high_f32(t23.val[0])), bias)),
+                    activation(vaddq_f32(vcombine_f32(vget_high_f32(t01.val[1]), vget_high_f32(t23.val[1])), bias))
+                };
 
-        The size of the output tensor's XY-plane must be the following shape [ width * 8, height / 8 ]. All other dimensions must have the same size.
-        */
-        for(size_t k = num_it; k > 0; mtx_a0 += 16, mtx_b0 += 32, --k)
-        {
-            const float16x8_t p00 = vld1q_f16(mtx_a0);
-            const float16x8_t p02 = vld1q_f16(mtx_a0 + 8);
-            const float16x8_t q00 = vld1q_f16(mtx_b0);
-            const float16x8_t q02 = vld1q_f16(mtx_b0 + 8);
-            const float16x8_t q04 = vld1q_f16(mtx_b0 + 16);
-            const float16x8_t q06 = vld1q_f16(mtx_b0 + 24);
-
-            c.val[0] = vaddq_f16(c.val[0], vmulq_n_f16(q00, vgetq_lane_f16(p00, 0)));
-            c.val[1] = vaddq_f16(c.val[1], vmulq_n_f16(q00, vgetq_lane_f16(p00, 1)));
-            c.val[2] = vaddq_f16(c.val[2], vmulq_n_f16(q00, vgetq_lane_f16(p00, 2)));
-            c.val[3] = vaddq_f16(c.val[3], vmulq_n_f16(q00, vgetq_lane_f16(p00, 3)));
-
-            c.val[0] = vaddq_f16(c.val[0], vmulq_n_f16(q02, vgetq_lane_f16(p00, 4)));
-            c.val[1] = vaddq_f16(c.val[1], vmulq_n_f16(q02, vgetq_lane_f16(p00, 5)));
-            c.val[2] = vaddq_f16(c.val[2], vmulq_n_f16(q02, vgetq_lane_f16(p00, 6)));
-            c.val[3] = vaddq_f16(c.val[3], vmulq_n_f16(q02, vgetq_lane_f16(p00, 7)));
-
-            c.val[0] = vaddq_f16(c.val[0], vmulq_n_f16(q04, vgetq_lane_f16(p02, 0)));
-            c.val[1] = vaddq_f16(c.val[1], vmulq_n_f16(q04, vgetq_lane_f16(p02, 1)));
-            c.val[2] = vaddq_f16(c.val[2], vmulq_n_f16(q04, vgetq_lane_f16(p02, 2)));
-            c.val[3] = vaddq_f16(c.val[3], vmulq_n_f16(q04, vgetq_lane_f16(p02, 3)));
-
-            c.val[0] = vaddq_f16(c.val[0], vmulq_n_f16(q06, vgetq_lane_f16(p02, 4)));
-            c.val[1] = vaddq_f16(c.val[1], vmulq_n_f16(q06, vgetq_lane_f16(p02, 5)));
-            c.val[2] = vaddq_f16(c.val[2], vmulq_n_f16(q06, vgetq_lane_f16(p02, 6)));
-            c.val[3] = vaddq_f16(c.val[3], vmulq_n_f16(q06, vgetq_lane_f16(p02, 7)));
+                for(int e = 0; (e < 4) && (id.x() + 4 * j + e < num_output_elems); ++e)
+                {
+                    const int elem    = id.x() + 4 * j + e;
+                    auto      out_ptr = reinterpret_cast<T *>(batch + (elem / output_width) * out_stride_y + (elem % output_width) * out_stride_x);
+                    if(num_ofm == 4)
+                    {
+                        vstore_f32(out_ptr, res[e]);
+                    }
+                    else
+                    {
+                        float values[4];
+                        vst1q_f32(values, res[e]);
+                        std::copy_n(values, num_ofm, out_ptr);
+                    }
+                }
+            }
+            return;
         }
 
-        if(multiply_alpha)
+        // Store the blocks, skipping the rows and columns beyond the output
+        for(int i = 0; (i < 4) && (id.y() + i < num_ofm_per_group); ++i)
         {
-            c.val[0] = vmulq_f16(c.val[0], alpha_f16);
-            c.val[1] = vmulq_f16(c.val[1], alpha_f16);
-            c.val[2] = vmulq_f16(c.val[2], alpha_f16);
-            c.val[3] = vmulq_f16(c.val[3], alpha_f16);
-        }
+            const int         ofm   = id.z() * num_ofm_per_group + id.y() + i;
+            const float32x4_t bias  = vdupq_n_f32((biases != nullptr) ? static_cast<float>(*reinterpret_cast<const T *>(biases->ptr_to_element(Coordinates(ofm)))) : 0.f);
+            uint8_t *const    plane = output_ptr + ofm * out_stride_z + id[3] * out_stride_w;
+
+            for(int j = 0; (j < 4) && (id.x() + 4 * j < num_output_elems); ++j)
+            {
+                const int         elem = id.x() + 4 * j;
+                const int         x    = elem % output_width;
+                const float32x4_t res  = activation(vaddq_f32(acc[i][j], bias));
 
-        vst1q_f16(mtx_out + 0 * out_stride, c.val[0]);
-        vst1q_f16(mtx_out + 1 * out_stride, c.val[1]);
-        vst1q_f16(mtx_out + 2 * out_stride, c.val[2]);
-        vst1q_f16(mtx_out + 3 * out_stride, c.val[3]);
+                if(x + 4 <= output_width)
+                {
+                    vstore_f32(reinterpret_cast<T *>(plane + (elem / output_width) * out_stride_y) + x, res);
+                }
+                else
+                {
+                    float values[4];
+                    vst1q_f32(values, res);
+                    for(int e = 0; (e < 4) && (elem + e < num_output_elems); ++e)
+                    {
+                        *(reinterpret_cast<T *>(plane + ((elem + e) / output_width) * out_stride_y) + (elem + e) % output_width) = static_cast<T>(values[e]);
+                    }
+                }
+            }
+        }
     },
-    ina, inb, out);
-#else
-    ARM_COMPUTE_ERROR("Not implemented");
-#endif
+    ina, inb);
 }
 } // namespace
 
+NEGEMMMatrixMultiplyKernel::ActivationFunctionPtr NEGEMMMatrixMultiplyKernel::activation_function(ActivationLayerInfo::ActivationFunction act)
+{
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &vactivateq_f32<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &vactivateq_f32<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &vactivateq_f32<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &vactivateq_f32<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &vactivateq_f32<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &vactivateq_f32<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &vactivateq_f32<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &vactivateq_f32<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &vactivateq_f32<ActivationFunction::TANH> },
+    };
+
+    return act_map[act];
+}
+
 NEGEMMMatrixMultiplyKernel::NEGEMMMatrixMultiplyKernel()
-    : _input0(nullptr), _input1(nullptr), _output(nullptr), _alpha(1.0f)
+    : _input0(nullptr), _input1(nullptr), _biases(nullptr), _output(nullptr), _alpha(1.0f), _beta(1.0f), _is_convolution_output(false), _act_func(nullptr), _act_info()
 {
 }
 
-void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha)
+void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha, const ITensor *biases, const ActivationLayerInfo &act_info, float beta)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+#ifndef ARM_COMPUTE_ENABLE_FP16_STORAGE
+    ARM_COMPUTE_ERROR_ON_MSG((input0->info()->data_type() == DataType::F16) && !cpu_features().fp16, "The CPU doesn't support half precision arithmetic");
+#endif /* ARM_COMPUTE_ENABLE_FP16_STORAGE */
     if(output->info()->dimension(1) == 1)
     {
         ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
     }
 
-    _input0 = input0;
-    _input1 = input1;
-    _output = output;
-    _alpha  = alpha;
+    const bool is_vector_matrix = (output->info()->dimension(1) == 1) && (input0->info()->data_type() == DataType::F32);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON((biases->info()->dimension(1) != 1) && (biases->info()->dimension(1) != output->info()->dimension(1)));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 2);
+    }
+    ARM_COMPUTE_ERROR_ON_MSG(is_vector_matrix && ((biases != nullptr) || act_info.enabled()), "The vector-matrix multiplication doesn't support biases or an activation function");
+
+    _input0                = input0;
+    _input1                = input1;
+    _biases                = biases;
+    _output                = output;
+    _alpha                 = alpha;
+    _beta                  = beta;
+    _is_convolution_output = false;
+    _act_info              = act_info;
+    _act_func              = act_info.enabled() ? activation_function(act_info.activation()) : nullptr;
 
     unsigned int       num_elems_processed_per_iteration_x = 0;
     const unsigned int num_elems_processed_per_iteration_y = 4;
 
     // Check if the output tensor is a vector and the data type is F32. If so,the kernel runs the vector-matrix multiplication
-    if((output->info()->dimension(1) == 1) && (input0->info()->data_type() == DataType::F32))
+    if(is_vector_matrix)
     {
         num_elems_processed_per_iteration_x = 16;
 
@@ -504,7 +632,8 @@ void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor
         {
             case DataType::F16:
             {
-                num_elems_processed_per_iteration_x = 8;
+                // Without the half precision arithmetic the product is computed by the single precision function
+                num_elems_processed_per_iteration_x = is_fp16_storage_only() ? 16 : 8;
                 break;
             }
             case DataType::F32:
@@ -529,17 +658,144 @@ void NEGEMMMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor
                                   AccessWindowTranspose(input1->info(), 0, 0, 4, 1, 0.f, 0.25f),
                                   output_access);
 
+        if(biases != nullptr)
+        {
+            // A matrix of biases is read in blocks of the output's size, a row vector one row at a time
+            const unsigned int    num_biases_rows = (biases->info()->dimension(1) > 1) ? num_elems_processed_per_iteration_y : 1;
+            AccessWindowRectangle biases_access(biases->info(), 0, 0, num_elems_processed_per_iteration_x, num_biases_rows);
+            update_window_and_padding(win, biases_access);
+        }
+
         output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
 
         INEKernel::configure(win);
     }
 }
 
+unsigned int NEGEMMMatrixMultiplyKernel::convolution_weights_transpose_width(DataType data_type)
+{
+    // The 1xW transpose of the weights holds 4 output feature maps per row in single precision, 8 in half precision unless it is computed in single precision
+    return ((data_type == DataType::F16) && !is_fp16_storage_only()) ? 8 : 4;
+}
+
+void NEGEMMMatrixMultiplyKernel::configure_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+#ifndef ARM_COMPUTE_ENABLE_FP16_STORAGE
+    ARM_COMPUTE_ERROR_ON_MSG((input0->info()->data_type() == DataType::F16) && !cpu_features().fp16, "The CPU doesn't support half precision arithmetic");
+#endif /* ARM_COMPUTE_ENABLE_FP16_STORAGE */
+
+    const unsigned int num_ofm_per_block = convolution_weights_transpose_width(input0->info()->data_type());
+    const DataLayout   data_layout       = output->info()->data_layout();
+    const unsigned int num_ofm           = output->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL));
+    const unsigned int num_output_elems  = output->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH))
+                                          * output->info()->dimension(get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT));
+
+    ARM_COMPUTE_ERROR_ON_MSG((data_layout == DataLayout::NHWC) && (input0->info()->data_type() != DataType::F32), "NHWC outputs are only supported in single precision");
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) * 4 != input1->info()->dimension(0) * num_ofm_per_block);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(2) != input1->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON((num_ofm % input0->info()->dimension(2)) != 0);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != ceil_to_multiple(num_ofm / input0->info()->dimension(2), num_ofm_per_block) / num_ofm_per_block);
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != ceil_to_multiple(num_output_elems, 4) / 4);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != num_ofm);
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    _input0                = input0;
+    _input1                = input1;
+    _biases                = biases;
+    _output                = output;
+    _alpha                 = 1.0f;
+    _beta                  = 1.0f;
+    _is_convolution_output = true;
+    _act_info              = act_info;
+    _act_func              = act_info.enabled() ? activation_function(act_info.activation()) : nullptr;
+
+    // Configure kernel window: the columns of the product are the output elements of a feature map, the rows are the output feature maps.
+    // The groups of a grouped convolution are independent products which are all computed by the same window.
+    const unsigned int num_groups = input0->info()->dimension(2);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(num_output_elems, 16), 16));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(num_ofm / num_groups, num_ofm_per_block), num_ofm_per_block));
+    win.set(Window::DimZ, Window::Dimension(0, num_groups, 1));
+    win.set(3, Window::Dimension(0, output->info()->dimension(3), 1));
+
+    // The last iteration of each row reads up to 3 blocks of matrix B past its end
+    AccessWindowStatic input1_access(input1->info(), 0, 0, input1->info()->dimension(0), ceil_to_multiple(num_output_elems, 16) / 4);
+
+    update_window_and_padding(win, input1_access);
+
+    // The output elements beyond the output feature maps are not stored so the output needs no padding
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
 void NEGEMMMatrixMultiplyKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    const float32x4_t a = vdupq_n_f32(_act_info.a());
+    const float32x4_t b = vdupq_n_f32(_act_info.b());
+
+    const auto activation = [&](const float32x4_t &x)
+    {
+        return _act_func(x, a, b);
+    };
+    const auto identity = [](const float32x4_t &x)
+    {
+        return x;
+    };
+
+    if(_is_convolution_output)
+    {
+        if((_input0->info()->data_type() == DataType::F16) && is_fp16_storage_only())
+        {
+#ifdef ARM_COMPUTE_ENABLE_FP16_STORAGE
+            if(_act_func != nullptr)
+            {
+                matrix_matrix_multiply_f32_convolution<float16_t>(_input0, _input1, _biases, _output, window, activation);
+            }
+            else
+            {
+                matrix_matrix_multiply_f32_convolution<float16_t>(_input0, _input1, _biases, _output, window, identity);
+            }
+#else
+            ARM_COMPUTE_ERROR("Not implemented");
+#endif
+        }
+        else if(_input0->info()->data_type() == DataType::F16)
+        {
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA)
+            fp16::matrix_matrix_multiply_convolution(_input0, _input1, _biases, _output, window, _act_func, _act_info);
+#else
+            ARM_COMPUTE_ERROR("Not implemented");
+#endif
+        }
+        else
+        {
+            if(_act_func != nullptr)
+            {
+                matrix_matrix_multiply_f32_convolution<float>(_input0, _input1, _biases, _output, window, activation);
+            }
+            else
+            {
+                matrix_matrix_multiply_f32_convolution<float>(_input0, _input1, _biases, _output, window, identity);
+            }
+        }
+        return;
+    }
+
     bool multiply_alpha = std::abs(1.0f - _alpha) > 0.00001f;
 
     // Check if the output tensor is a vector and the data type is F32. If so,the kernel runs the vector-matrix multiplication
@@ -560,25 +816,38 @@ void NEGEMMMatrixMultiplyKernel::run(const Window &window)
         {
             case DataType::F16:
             {
-                if(multiply_alpha)
-                {
-                    matrix_matrix_multiply_f16<true>(_input0, _input1, _output, window, _alpha);
-                }
-                else
+                if(is_fp16_storage_only())
                 {
-                    matrix_matrix_multiply_f16<false>(_input0, _input1, _output, window, _alpha);
+#ifdef ARM_COMPUTE_ENABLE_FP16_STORAGE
+                    if(_act_func != nullptr)
+                    {
+                        run_matrix_matrix_multiply_f32<float16_t>(_input0, _input1, _biases, _output, window, multiply_alpha, _alpha, _beta, activation);
+                    }
+                    else
+                    {
+                        run_matrix_matrix_multiply_f32<float16_t>(_input0, _input1, _biases, _output, window, multiply_alpha, _alpha, _beta, identity);
+                    }
+#else
+                    ARM_COMPUTE_ERROR("Not implemented");
+#endif
+                    break;
                 }
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA)
+                fp16::matrix_matrix_multiply(_input0, _input1, _biases, _output, window, _alpha, _beta, _act_func, _act_info);
+#else
+                ARM_COMPUTE_ERROR("Not implemented");
+#endif
                 break;
             }
             case DataType::F32:
             {
-                if(multiply_alpha)
+                if(_act_func != nullptr)
                 {
-                    matrix_matrix_multiply_f32<true>(_input0, _input1, _output, window, _alpha);
+                    run_matrix_matrix_multiply_f32<float>(_input0, _input1, _biases, _output, window, multiply_alpha, _alpha, _beta, activation);
                 }
                 else
                 {
-                    matrix_matrix_multiply_f32<false>(_input0, _input1, _output, window, _alpha);
+                    run_matrix_matrix_multiply_f32<float>(_input0, _input1, _biases, _output, window, multiply_alpha, _alpha, _beta, identity);
                 }
                 break;
             }
@@ -590,3 +859,65 @@ void NEGEMMMatrixMultiplyKernel::run(const Window &window)
         }
     }
 }
+
+SchedulingPolicy NEGEMMMatrixMultiplyKernel::scheduling_policy() const
+{
+    // The vector-matrix multiplication distributes the columns of the output according to the thread id: each thread must run exactly one sub-window
+    const bool is_vector_matrix = !_is_convolution_output && (_output->info()->dimension(1) == 1) && (_input0->info()->data_type() == DataType::F32);
+
+    return is_vector_matrix ? SchedulingPolicy::STATIC : SchedulingPolicy::DYNAMIC;
+}
+
+unsigned int NEGEMMMatrixMultiplyKernel::split_parts_x(unsigned int num_parts) const
+{
+    // The vector-matrix multiplication splits the columns among the threads itself, and the convolution output is only split along the rows
+    const bool is_vector_matrix = !_is_convolution_output && (_output->info()->dimension(1) == 1) && (_input0->info()->data_type() == DataType::F32);
+    if(is_vector_matrix || _is_convolution_output)
+    {
+        return 1;
+    }
+
+    const Window      &win    = window();
+    const unsigned int num_x  = win.num_iterations(Window::DimX);
+    const unsigned int num_y  = win.num_iterations(Window::DimY);
+    const unsigned int step_x = win.x().step();
+    const unsigned int step_y = win.y().step();
+
+    // Each part reads the panels of the interleaved matrix A of its rows and the panels of the transposed matrix B of its columns:
+    // among the grids which balance the work best, pick the one whose parts read the fewest elements per element of the K dimension
+    unsigned int best_parts_x   = 1;
+    unsigned int best_work      = std::numeric_limits<unsigned int>::max();
+    unsigned int best_footprint = std::numeric_limits<unsigned int>::max();
+
+    for(unsigned int parts_x = 1; parts_x <= std::min(num_parts, num_x); ++parts_x)
+    {
+        if(num_parts % parts_x != 0)
+        {
+            continue;
+        }
+
+        // Window::split_window() spreads the remaining iterations over the first parts, which are therefore the largest ones
+        const unsigned int parts_y   = std::max(1u, std::min(num_y, num_parts / parts_x));
+        const unsigned int cols      = DIV_CEIL(num_x, parts_x);
+        const unsigned int rows      = DIV_CEIL(num_y, parts_y);
+        const unsigned int work      = cols * rows;
+        const unsigned int footprint = cols * step_x + rows * step_y;
+
+        if(work < best_work || (work == best_work && footprint < best_footprint))
+        {
+            best_parts_x   = parts_x;
+            best_work      = work;
+            best_footprint = footprint;
+        }
+    }
+
+    return best_parts_x;
+}
+
+bool NEGEMMMatrixMultiplyKernel::is_compute_bound() const
+{
+    // The vector-matrix multiplication reads each element of the matrix B only once and is therefore bound by the memory bandwidth
+    const bool is_vector_matrix = !_is_convolution_output && (_output->info()->dimension(1) == 1) && (_input0->info()->data_type() == DataType::F32);
+
+    return !is_vector_matrix;
+}
@@ -0,0 +1,360 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMMatrixVectorMultiplyKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <map>
+#include <numeric>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEGEMMMatrixVectorMultiplyKernel::num_elems_processed_per_iteration;
+
+namespace
+{
+/** Number of columns of matrix B stored in a row of the reshaped matrix */
+constexpr int block_width = 4;
+
+/** Maximum number of rows of the reshaped matrix read by one iteration of the kernel window */
+constexpr int max_num_blocks = NEGEMMMatrixVectorMultiplyKernel::num_elems_processed_per_iteration / block_width;
+
+static_assert(max_num_blocks == 4, "The kernel window computes the output of at most 4 rows of the reshaped matrix");
+
+/** Number of elements of the K dimension between the loads and the prefetch of the weights */
+constexpr int prefetch_distance = 64;
+
+/** Load the weights of 4 consecutive elements of the vector A from a row of the reshaped matrix B
+ *
+ * @param[in]  b Weights of the first element.
+ * @param[out] w The 4 weights of each element, in single precision.
+ */
+inline void load_weights(const float *b, float32x4_t *w)
+{
+    w[0] = vld1q_f32(b + 0);
+    w[1] = vld1q_f32(b + 4);
+    w[2] = vld1q_f32(b + 8);
+    w[3] = vld1q_f32(b + 12);
+}
+
+/** Load the quantized weights of 4 consecutive elements of the vector A from a row of the reshaped matrix B
+ *
+ * The 16 quantized weights are read with a single load and converted to single precision in registers.
+ *
+ * @param[in]  b Weights of the first element.
+ * @param[out] w The 4 weights of each element, in single precision.
+ */
+inline void load_weights(const uint8_t *b, float32x4_t *w)
+{
+    const uint8x16_t q   = vld1q_u8(b);
+    const uint16x8_t q_l = vmovl_u8(vget_low_u8(q));
+    const uint16x8_t q_h = vmovl_u8(vget_high_u8(q));
+
+    w[0] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(q_l)));
+    w[1] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(q_l)));
+    w[2] = vcvtq_f32_u32(vmovl_u16(vget_low_u16(q_h)));
+    w[3] = vcvtq_f32_u32(vmovl_u16(vget_high_u16(q_h)));
+}
+
+/** Load the 4 weights of one element of the vector A from a row of the reshaped matrix B, in single precision */
+template <typename T>
+inline float32x4_t load_weights_left_over(const T *b)
+{
+    const float tmp[block_width] = { static_cast<float>(b[0]), static_cast<float>(b[1]), static_cast<float>(b[2]), static_cast<float>(b[3]) };
+    return vld1q_f32(tmp);
+}
+
+/** Load the 4 weights of one element of the vector A from a row of the reshaped matrix B */
+template <>
+inline float32x4_t load_weights_left_over(const float *b)
+{
+    return vld1q_f32(b);
+}
+
+/** Multiply the vector A by num_blocks consecutive rows of the reshaped matrix B
+ *
+ * Every row of the reshaped matrix is a stream of 4 elements per element of the vector. Even and odd elements of the vector are accumulated
+ * in different registers, so that consecutive multiply-accumulates of a stream don't depend on each other.
+ *
+ * Quantized weights are accumulated without their zero point, which is removed from the results by the caller.
+ *
+ * @param[in]  vec_a    Vector A.
+ * @param[in]  matrix_b First row of the reshaped matrix B.
+ * @param[in]  stride_b Distance in elements between two rows of the reshaped matrix B.
+ * @param[in]  num_k    Number of elements of the vector A.
+ * @param[out] out      The 4 results computed for each row of the reshaped matrix.
+ */
+template <int num_blocks, typename T>
+void multiply_blocks(const float *vec_a, const T *matrix_b, size_t stride_b, int num_k, float32x4_t *out)
+{
+    float32x4_t acc0[num_blocks];
+    float32x4_t acc1[num_blocks];
+    for(int r = 0; r < num_blocks; ++r)
+    {
+        acc0[r] = vdupq_n_f32(0.f);
+        acc1[r] = vdupq_n_f32(0.f);
+    }
+
+    int k = 0;
+    for(; k <= (num_k - 4); k += 4)
+    {
+        // Each iteration reads 16 consecutive elements, a cache line, of every row
+        for(int r = 0; r < num_blocks; ++r)
+        {
+            __builtin_prefetch(matrix_b + r * stride_b + (k + prefetch_distance) * block_width);
+        }
+
+        const float32x4_t a   = vld1q_f32(vec_a + k);
+        const float32x2_t a_l = vget_low_f32(a);
+        const float32x2_t a_h = vget_high_f32(a);
+
+        for(int r = 0; r < num_blocks; ++r)
+        {
+            float32x4_t w[4];
+            load_weights(matrix_b + r * stride_b + k * block_width, w);
+
+            acc0[r] = vmlaq_lane_f32(acc0[r], w[0], a_l, 0);
+            acc1[r] = vmlaq_lane_f32(acc1[r], w[1], a_l, 1);
+            acc0[r] = vmlaq_lane_f32(acc0[r], w[2], a_h, 0);
+            acc1[r] = vmlaq_lane_f32(acc1[r], w[3], a_h, 1);
+        }
+    }
+
+    // Left-over elements of the vector
+    for(; k < num_k; ++k)
+    {
+        for(int r = 0; r < num_blocks; ++r)
+        {
+            acc0[r] = vmlaq_n_f32(acc0[r], load_weights_left_over(matrix_b + r * stride_b + k * block_width), vec_a[k]);
+        }
+    }
+
+    for(int r = 0; r < num_blocks; ++r)
+    {
+        out[r] = vaddq_f32(acc0[r], acc1[r]);
+    }
+}
+
+/** Multiply the vector A by the rows of the reshaped matrix B computing the output columns [@p col, @p col + @p blocks * 4)
+ *
+ * @param[in]  vec_a    Vector A.
+ * @param[in]  matrix_b First row of the reshaped matrix B.
+ * @param[in]  stride_b Distance in elements between two rows of the reshaped matrix B.
+ * @param[in]  num_k    Number of elements of the vector A.
+ * @param[in]  col      First column of the output to compute, a multiple of 4.
+ * @param[in]  blocks   Number of rows of the reshaped matrix B to multiply, at most @ref max_num_blocks.
+ * @param[out] out      The 4 results computed for each row of the reshaped matrix.
+ */
+template <typename T>
+void multiply(const float *vec_a, const T *matrix_b, size_t stride_b, int num_k, int col, int blocks, float32x4_t *out)
+{
+    const T *b = matrix_b + (col / block_width) * stride_b;
+
+    switch(blocks)
+    {
+        case 4:
+            multiply_blocks<4>(vec_a, b, stride_b, num_k, out);
+            break;
+        case 3:
+            multiply_blocks<3>(vec_a, b, stride_b, num_k, out);
+            break;
+        case 2:
+            multiply_blocks<2>(vec_a, b, stride_b, num_k, out);
+            break;
+        case 1:
+            multiply_blocks<1>(vec_a, b, stride_b, num_k, out);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Invalid number of blocks");
+    }
+}
+
+/** Load 4 values of a vector of num_cols elements starting at col, padding the last block of the vector with zeros */
+inline float32x4_t load_columns(const float *vec, int col, int num_cols)
+{
+    if(col + block_width <= num_cols)
+    {
+        return vld1q_f32(vec + col);
+    }
+
+    float tmp[block_width] = { 0.f };
+    std::copy(vec + col, vec + num_cols, tmp);
+    return vld1q_f32(tmp);
+}
+} // namespace
+
+NEGEMMMatrixVectorMultiplyKernel::NEGEMMMatrixVectorMultiplyKernel()
+    : _input0(nullptr), _input1(nullptr), _biases(nullptr), _output(nullptr), _scales(nullptr), _act_func(nullptr), _act_info()
+{
+}
+
+void NEGEMMMatrixVectorMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                                                 const ITensor *scales)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, output);
+    ARM_COMPUTE_ERROR_ON((input1->info()->data_type() == DataType::U8) != (scales != nullptr));
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != 1);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != 1);
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != input0->info()->dimension(0) * block_width);
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(1) != ceil_to_multiple(output->info()->dimension(0), block_width) / block_width);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    if(scales != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, scales);
+        ARM_COMPUTE_ERROR_ON(scales->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(scales->info()->num_dimensions() > 1);
+    }
+
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &vactivateq_f32<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &vactivateq_f32<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &vactivateq_f32<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &vactivateq_f32<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &vactivateq_f32<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &vactivateq_f32<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &vactivateq_f32<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &vactivateq_f32<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &vactivateq_f32<ActivationFunction::TANH> },
+    };
+
+    _input0   = input0;
+    _input1   = input1;
+    _biases   = biases;
+    _output   = output;
+    _scales   = scales;
+    _act_info = act_info;
+    _act_func = act_info.enabled() ? act_map[act_info.activation()] : nullptr;
+
+    // Configure kernel window: each iteration computes num_elems_processed_per_iteration elements of the output
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(0), num_elems_processed_per_iteration), num_elems_processed_per_iteration));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    // The kernel doesn't read or write outside the tensors so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMMatrixVectorMultiplyKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int    num_cols   = _output->info()->dimension(0);
+    const int    num_k      = _input0->info()->dimension(0);
+    const int    num_blocks = _input1->info()->dimension(1);
+    const size_t stride_b   = _input1->info()->strides_in_bytes()[1] / _input1->info()->element_size();
+
+    const auto vec_a   = reinterpret_cast<const float *>(_input0->buffer() + _input0->info()->offset_first_element_in_bytes());
+    const auto b_ptr   = _input1->buffer() + _input1->info()->offset_first_element_in_bytes();
+    const auto vec_out = reinterpret_cast<float *>(_output->buffer() + _output->info()->offset_first_element_in_bytes());
+    const auto biases  = (_biases != nullptr) ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+    const auto scales  = (_scales != nullptr) ? reinterpret_cast<const float *>(_scales->buffer() + _scales->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const float32x4_t act_a = vdupq_n_f32(_act_info.a());
+    const float32x4_t act_b = vdupq_n_f32(_act_info.b());
+
+    // The quantized weights are dequantized as scale * (q - offset): the products of the zero point with the vector are the same for all the columns,
+    // so they are removed from the accumulated results once instead of from every weight
+    float offset_sum = 0.f;
+    if(scales != nullptr)
+    {
+        offset_sum = static_cast<float>(_input1->info()->quantization_info().offset) * std::accumulate(vec_a, vec_a + num_k, 0.f);
+    }
+    const float32x4_t offset_products = vdupq_n_f32(offset_sum);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int col    = id.x();
+        const int blocks = std::min(max_num_blocks, num_blocks - col / block_width);
+
+        float32x4_t res[max_num_blocks];
+
+        if(scales != nullptr)
+        {
+            multiply(vec_a, b_ptr, stride_b, num_k, col, blocks, res);
+        }
+        else
+        {
+            multiply(vec_a, reinterpret_cast<const float *>(b_ptr), stride_b, num_k, col, blocks, res);
+        }
+
+        // The weights are dequantized, the biases are added and the activation function is applied while the results are still in registers
+        for(int r = 0; r < blocks; ++r)
+        {
+            const int c = col + r * block_width;
+
+            if(scales != nullptr)
+            {
+                res[r] = vmulq_f32(vsubq_f32(res[r], offset_products), load_columns(scales, c, num_cols));
+            }
+
+            if(biases != nullptr)
+            {
+                res[r] = vaddq_f32(res[r], load_columns(biases, c, num_cols));
+            }
+
+            if(_act_func != nullptr)
+            {
+                res[r] = _act_func(res[r], act_a, act_b);
+            }
+
+            if(c + block_width <= num_cols)
+            {
+                vst1q_f32(vec_out + c, res[r]);
+            }
+            else
+            {
+                // Last block of the output: the columns beyond the vector are not stored
+                float tmp[block_width];
+                vst1q_f32(tmp, res[r]);
+                std::copy(tmp, tmp + (num_cols - c), vec_out + c);
+            }
+        }
+    });
+}
@@ -0,0 +1,254 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMSmallMatrixMultiplyKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstddef>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEGEMMSmallMatrixMultiplyKernel::block_m;
+constexpr unsigned int NEGEMMSmallMatrixMultiplyKernel::block_n;
+
+namespace
+{
+constexpr int block_m     = NEGEMMSmallMatrixMultiplyKernel::block_m;
+constexpr int block_n     = NEGEMMSmallMatrixMultiplyKernel::block_n;
+constexpr int num_vectors = block_n / 4;
+
+/** Load a row of a block, the columns beyond the matrix are zero
+ *
+ * @param[in]  ptr  First element of the row.
+ * @param[in]  cols Number of columns of the row inside the matrix.
+ * @param[out] row  Columns of the row.
+ */
+inline void load_row(const float *ptr, int cols, float32x4_t row[num_vectors])
+{
+    if(cols == block_n)
+    {
+        for(int j = 0; j < num_vectors; ++j)
+        {
+            row[j] = vld1q_f32(ptr + 4 * j);
+        }
+    }
+    else
+    {
+        float tmp[block_n] = { 0.f };
+        std::copy(ptr, ptr + cols, tmp);
+
+        for(int j = 0; j < num_vectors; ++j)
+        {
+            row[j] = vld1q_f32(tmp + 4 * j);
+        }
+    }
+}
+
+/** Store a row of a block, the columns beyond the matrix are dropped
+ *
+ * @param[in]  row  Columns of the row.
+ * @param[in]  cols Number of columns of the row inside the matrix.
+ * @param[out] ptr  First element of the row.
+ */
+inline void store_row(const float32x4_t row[num_vectors], int cols, float *ptr)
+{
+    if(cols == block_n)
+    {
+        for(int j = 0; j < num_vectors; ++j)
+        {
+            vst1q_f32(ptr + 4 * j, row[j]);
+        }
+    }
+    else
+    {
+        float tmp[block_n];
+
+        for(int j = 0; j < num_vectors; ++j)
+        {
+            vst1q_f32(tmp + 4 * j, row[j]);
+        }
+
+        std::copy(tmp, tmp + cols, ptr);
+    }
+}
+} // namespace
+
+NEGEMMSmallMatrixMultiplyKernel::NEGEMMSmallMatrixMultiplyKernel()
+    : _input0(nullptr), _input1(nullptr), _input2(nullptr), _output(nullptr), _alpha(1.0f), _beta(1.0f)
+{
+}
+
+void NEGEMMSmallMatrixMultiplyKernel::configure(const ITensor *input0, const ITensor *input1, ITensor *output, float alpha, const ITensor *input2, float beta)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input1, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(0) != input1->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != output->info()->dimension(1));
+    ARM_COMPUTE_ERROR_ON(input1->info()->dimension(0) != output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 2);
+
+    if(input2 != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, input2);
+        ARM_COMPUTE_ERROR_ON(input2->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON((input2->info()->dimension(1) != 1) && (input2->info()->dimension(1) != output->info()->dimension(1)));
+        ARM_COMPUTE_ERROR_ON(input2->info()->num_dimensions() > 2);
+    }
+
+    _input0 = input0;
+    _input1 = input1;
+    _input2 = input2;
+    _output = output;
+    _alpha  = alpha;
+    _beta   = beta;
+
+    // Configure kernel window: each iteration computes a block of the output
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(0), block_n), block_n));
+    win.set(Window::DimY, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(1), block_m), block_m));
+
+    // The kernel doesn't read or write outside the matrices so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEGEMMSmallMatrixMultiplyKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const TensorInfo *const info_a = _input0->info();
+    const TensorInfo *const info_b = _input1->info();
+    const TensorInfo *const info_d = _output->info();
+
+    const int    num_rows = info_d->dimension(1);
+    const int    num_cols = info_d->dimension(0);
+    const int    num_k    = info_a->dimension(0);
+    const size_t stride_a = info_a->strides_in_bytes()[1] / sizeof(float);
+    const size_t stride_b = info_b->strides_in_bytes()[1] / sizeof(float);
+    const size_t stride_d = info_d->strides_in_bytes()[1] / sizeof(float);
+
+    const auto a_ptr = reinterpret_cast<const float *>(_input0->buffer() + info_a->offset_first_element_in_bytes());
+    const auto b_ptr = reinterpret_cast<const float *>(_input1->buffer() + info_b->offset_first_element_in_bytes());
+    const auto d_ptr = reinterpret_cast<float *>(_output->buffer() + info_d->offset_first_element_in_bytes());
+
+    // A row vector C is added to each row of the output
+    const float *c_ptr    = nullptr;
+    size_t       stride_c = 0;
+    if(_input2 != nullptr)
+    {
+        const TensorInfo *const info_c = _input2->info();
+
+        c_ptr    = reinterpret_cast<const float *>(_input2->buffer() + info_c->offset_first_element_in_bytes());
+        stride_c = (info_c->dimension(1) > 1) ? info_c->strides_in_bytes()[1] / sizeof(float) : 0;
+    }
+
+    const bool        multiply_alpha = std::abs(1.0f - _alpha) > 0.00001f;
+    const float32x4_t alpha_f32      = vdupq_n_f32(_alpha);
+    const float32x4_t beta_f32       = vdupq_n_f32(_beta);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int m0   = id.y();
+        const int n0   = id.x();
+        const int rows = std::min(static_cast<int>(block_m), num_rows - m0);
+        const int cols = std::min(static_cast<int>(block_n), num_cols - n0);
+
+        // The rows of the last block beyond matrix A read its first row again: their results are not stored
+        const float *a_rows[block_m];
+        for(unsigned int r = 0; r < block_m; ++r)
+        {
+            a_rows[r] = a_ptr + (m0 + ((static_cast<int>(r) < rows) ? r : 0)) * stride_a;
+        }
+
+        float32x4_t acc[block_m][num_vectors];
+        for(unsigned int r = 0; r < block_m; ++r)
+        {
+            for(int j = 0; j < num_vectors; ++j)
+            {
+                acc[r][j] = vdupq_n_f32(0.f);
+            }
+        }
+
+        for(int k = 0; k < num_k; ++k)
+        {
+            float32x4_t b[num_vectors];
+            load_row(b_ptr + k * stride_b + n0, cols, b);
+
+            for(unsigned int r = 0; r < block_m; ++r)
+            {
+                const float a = a_rows[r][k];
+
+                for(int j = 0; j < num_vectors; ++j)
+                {
+                    acc[r][j] = vmlaq_n_f32(acc[r][j], b[j], a);
+                }
+            }
+        }
+
+        for(int r = 0; r < rows; ++r)
+        {
+            // Multiply by the weight of matrix product (alpha)
+            if(multiply_alpha)
+            {
+                for(int j = 0; j < num_vectors; ++j)
+                {
+                    acc[r][j] = vmulq_f32(acc[r][j], alpha_f32);
+                }
+            }
+
+            // Add the weighted matrix C (beta)
+            if(c_ptr != nullptr)
+            {
+                float32x4_t c[num_vectors];
+                load_row(c_ptr + (m0 + r) * stride_c + n0, cols, c);
+
+                for(int j = 0; j < num_vectors; ++j)
+                {
+                    acc[r][j] = vmlaq_f32(acc[r][j], c[j], beta_f32);
+                }
+            }
+
+            store_row(acc[r], cols, d_ptr + (m0 + r) * stride_d + n0);
+        }
+    });
+}
+
+bool NEGEMMSmallMatrixMultiplyKernel::is_compute_bound() const
+{
+    return true;
+}
@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEGEMMSparseMatrixVectorMultiplyKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+using namespace arm_compute;
+
+constexpr unsigned int NEGEMMSparseMatrixVectorMultiplyKernel::num_elems_processed_per_iteration;
+
+namespace
+{
+/** Number of columns of matrix B in a stored block */
+constexpr int block_width = NEGEMMSparseMatrixVectorMultiplyKernel::num_elems_processed_per_iteration;
+
+/** Number of blocks between the loads and the prefetch of the weights */
+constexpr int prefetch_distance = 16;
+
+/** Multiply the vector A by the stored blocks of a row of matrix B
+ *
+ * Even and odd blocks are accumulated in different registers, so that consecutive multiply-accumulates don't depend on each other.
+ *
+ * @param[in] vec_a      Vector A.
+ * @param[in] values     Weights of the first block of the row.
+ * @param[in] indices    Index in vector A of the first block of the row.
+ * @param[in] num_blocks Number of stored blocks of the row.
+ *
+ * @return The 4 output values of the row.
+ */
+float32x4_t multiply_row(const float *vec_a, const float *values, const int32_t *indices, int num_blocks)
+{
+    float32x4_t acc0 = vdupq_n_f32(0.f);
+    float32x4_t acc1 = vdupq_n_f32(0.f);
+
+    int b = 0;
+    for(; b <= (num_blocks - 2); b += 2)
+    {
+        __builtin_prefetch(values + (b + prefetch_distance) * block_width);
+
+        acc0 = vmlaq_n_f32(acc0, vld1q_f32(values + b * block_width), vec_a[indices[b]]);
+        acc1 = vmlaq_n_f32(acc1, vld1q_f32(values + (b + 1) * block_width), vec_a[indices[b + 1]]);
+    }
+
+    // Left-over block of the row
+    if(b < num_blocks)
+    {
+        acc0 = vmlaq_n_f32(acc0, vld1q_f32(values + b * block_width), vec_a[indices[b]]);
+    }
+
+    return vaddq_f32(acc0, acc1);
+}
+} // namespace
+
+NEGEMMSparseMatrixVectorMultiplyKernel::NEGEMMSparseMatrixVectorMultiplyKernel()
+    : _input0(nullptr), _values(nullptr), _indices(nullptr), _offsets(nullptr), _biases(nullptr), _output(nullptr), _act_func(nullptr), _act_info()
+{
+}
+
+void NEGEMMSparseMatrixVectorMultiplyKernel::configure(const ITensor *input0, const ITensor *values, const ITensor *indices, const ITensor *offsets, const ITensor *biases, ITensor *output,
+                                                       const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input0, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, values, output);
+    ARM_COMPUTE_ERROR_ON(input0->info()->dimension(1) != 1);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != 1);
+    ARM_COMPUTE_ERROR_ON(values->info()->dimension(0) != static_cast<size_t>(block_width));
+    ARM_COMPUTE_ERROR_ON(values->info()->dimension(1) != indices->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(offsets->info()->dimension(0) != ceil_to_multiple(output->info()->dimension(0), block_width) / block_width + 1);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input0, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &vactivateq_f32<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &vactivateq_f32<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &vactivateq_f32<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &vactivateq_f32<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &vactivateq_f32<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &vactivateq_f32<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &vactivateq_f32<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &vactivateq_f32<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &vactivateq_f32<ActivationFunction::TANH> },
+    };
+
+    _input0   = input0;
+    _values   = values;
+    _indices  = indices;
+    _offsets  = offsets;
+    _biases   = biases;
+    _output   = output;
+    _act_info = act_info;
+    _act_func = act_info.enabled() ? act_map[act_info.activation()] : nullptr;
+
+    // Configure kernel window: each iteration computes the output values of one row of blocks
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, ceil_to_multiple(output->info()->dimension(0), block_width), block_width));
+    win.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    // The kernel doesn't read or write outside the tensors so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+SchedulingPolicy NEGEMMSparseMatrixVectorMultiplyKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
+
+void NEGEMMSparseMatrixVectorMultiplyKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int num_cols = _output->info()->dimension(0);
+
+    const auto vec_a   = reinterpret_cast<const float *>(_input0->buffer() + _input0->info()->offset_first_element_in_bytes());
+    const auto values  = reinterpret_cast<const float *>(_values->buffer() + _values->info()->offset_first_element_in_bytes());
+    const auto indices = reinterpret_cast<const int32_t *>(_indices->buffer() + _indices->info()->offset_first_element_in_bytes());
+    const auto offsets = reinterpret_cast<const int32_t *>(_offsets->buffer() + _offsets->info()->offset_first_element_in_bytes());
+    const auto vec_out = reinterpret_cast<float *>(_output->buffer() + _output->info()->offset_first_element_in_bytes());
+    const auto biases  = (_biases != nullptr) ? reinterpret_cast<const float *>(_biases->buffer() + _biases->info()->offset_first_element_in_bytes()) : nullptr;
+
+    const float32x4_t act_a = vdupq_n_f32(_act_info.a());
+    const float32x4_t act_b = vdupq_n_f32(_act_info.b());
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int  col     = id.x();
+        const int  row     = col / block_width;
+        const int  first   = offsets[row];
+        const bool is_full = (col + block_width <= num_cols);
+        float      tmp[block_width];
+
+        float32x4_t res = multiply_row(vec_a, values + first * block_width, indices + first, offsets[row + 1] - first);
+
+        // The biases are added and the activation function is applied while the results are still in registers
+        if(biases != nullptr)
+        {
+            float32x4_t bias{};
+            if(is_full)
+            {
+                bias = vld1q_f32(biases + col);
+            }
+            else
+            {
+                std::fill(tmp, tmp + block_width, 0.f);
+                std::copy(biases + col, biases + num_cols, tmp);
+                bias = vld1q_f32(tmp);
+            }
+            res = vaddq_f32(res, bias);
+        }
+
+        if(_act_func != nullptr)
+        {
+            res = _act_func(res, act_a, act_b);
+        }
+
+        if(is_full)
+        {
+            vst1q_f32(vec_out + col, res);
+        }
+        else
+        {
+            // Last row of the output: the columns beyond the vector are not stored
+            vst1q_f32(tmp, res);
+            std::copy(tmp, tmp + (num_cols - col), vec_out + col);
+        }
+    });
+}
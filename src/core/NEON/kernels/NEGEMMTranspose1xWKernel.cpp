@@ -29,6 +29,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/INEKernel.h"
+#include "arm_compute/core/NEON/NEFP16Storage.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -45,7 +46,7 @@ void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output)
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
-    ARM_COMPUTE_ERROR_ON((output->info()->dimension(1) != std::ceil(input->info()->dimension(0) / 8.0f)) && (input->info()->data_type() == DataType::F16));
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(1) != std::ceil(input->info()->dimension(0) / (is_fp16_storage_only() ? 4.0f : 8.0f))) && (input->info()->data_type() == DataType::F16));
     ARM_COMPUTE_ERROR_ON((output->info()->dimension(1) != std::ceil(input->info()->dimension(0) / 4.0f)) && (input->info()->data_type() == DataType::F32));
     ARM_COMPUTE_ERROR_ON((output->info()->dimension(1) != std::ceil(input->info()->dimension(0) / 4.0f)) && (input->info()->data_type() == DataType::U8));
 
@@ -60,9 +61,10 @@ void NEGEMMTranspose1xWKernel::configure(const ITensor *input, ITensor *output)
             scale_x                           = 4.f;
             break;
         case DataType::F16:
-#ifdef ARM_COMPUTE_ENABLE_FP16
-            num_elems_processed_per_iteration = 8;
-            scale_x                           = 8.f;
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+            // The blocks are 4 elements wide like in single precision if the matrix multiplication converts the values to F32
+            num_elems_processed_per_iteration = is_fp16_storage_only() ? 4 : 8;
+            scale_x                           = num_elems_processed_per_iteration;
             break;
 #endif
         default:
@@ -100,7 +102,7 @@ void NEGEMMTranspose1xWKernel::run(const Window &window)
      *         |a30 a31 a32 a33|
      *
      * If the input data type is F32, the output matrix will have the following shape: [ height * 4, width / 4 ]
-     * If the input data type is F16, the output matrix will have the following shape: [ height * 8, width / 8 ]
+     * If the input data type is F16, the output matrix will have the following shape: [ height * 8, width / 8 ], or [ height * 4, width / 4 ] if it is computed in single precision
      */
 
     /* Set window for output tensor. Set to 0 the X and Y dimensions in order to allow multi-threading implementation and future batched matrix multiplications. */
@@ -143,10 +145,23 @@ void NEGEMMTranspose1xWKernel::run(const Window &window)
         }
 
         case DataType::F16:
-#ifdef ARM_COMPUTE_ENABLE_FP16
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
             {
                 const size_t out_stride = _output->info()->strides_in_bytes()[1] / sizeof(float16_t);
 
+                if(is_fp16_storage_only())
+                {
+                    execute_window_loop(window, [&](const Coordinates & id)
+                    {
+                        const auto in_ptr = reinterpret_cast<const float16_t *>(in.ptr());
+                        // Output address = base addr + (y * 4) + (x / 4 ) * stride
+                        float16_t *out_ptr = reinterpret_cast<float16_t *>(out.ptr()) + (id.y() << 2) + (id.x() >> 2) * out_stride;
+                        vst1_f16(out_ptr, vld1_f16(in_ptr));
+                    },
+                    in, out);
+                    break;
+                }
+
                 execute_window_loop(window, [&](const Coordinates & id)
                 {
                     const auto in_ptr = reinterpret_cast<const float16_t *>(in.ptr());
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NEGaussianPyramidKernel.h"
 
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -277,3 +278,171 @@ void NEGaussianPyramidVertKernel::run(const Window &window)
     },
     in, out);
 }
+
+NEGaussianPyramidHalfKernel::NEGaussianPyramidHalfKernel()
+    : _input(nullptr), _output(nullptr), _border_size(0), _l2_load_offset(0), _t2_load_offset(0)
+{
+}
+
+BorderSize NEGaussianPyramidHalfKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEGaussianPyramidHalfKernel::configure(const ITensor *input, ITensor *output, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != 2 * output->info()->dimension(0) && input->info()->dimension(0) != 2 * output->info()->dimension(0) - 1);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != 2 * output->info()->dimension(1) && input->info()->dimension(1) != 2 * output->info()->dimension(1) - 1);
+
+    for(size_t i = 2; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(i) != output->info()->dimension(i));
+    }
+
+    _input       = input;
+    _output      = output;
+    _border_size = BorderSize(border_undefined ? 0 : 2, 2);
+
+    // Configure kernel window
+    // Each iteration produces 16 output pixels from 32 input columns and 2 input rows
+    constexpr unsigned int num_elems_processed_per_iteration = 32;
+    constexpr unsigned int num_rows_processed_per_iteration  = 2;
+    constexpr unsigned int num_elems_read_per_iteration      = 48;
+    constexpr unsigned int num_rows_read_per_iteration       = 5;
+    constexpr unsigned int num_elems_written_per_iteration   = 16;
+    constexpr unsigned int num_rows_written_per_iteration    = 1;
+    constexpr float        scale                             = 0.5f;
+
+    Window                win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration, num_rows_processed_per_iteration), border_undefined, BorderSize(2));
+    AccessWindowRectangle output_access(output->info(), 0, 0, num_elems_written_per_iteration, num_rows_written_per_iteration, scale, scale);
+
+    // Same even/odd sub-sampling as the horizontal and vertical kernels
+    const ValidRegion &input_valid_region = input->info()->valid_region();
+
+    _l2_load_offset = -2;
+    _t2_load_offset = -2;
+
+    if((input_valid_region.anchor[0] + input_valid_region.shape[0]) % 2 == 0)
+    {
+        _l2_load_offset += 1;
+    }
+
+    if((input_valid_region.anchor[1] + input_valid_region.shape[1]) % 2 == 0)
+    {
+        _t2_load_offset += 1;
+    }
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), _l2_load_offset, _t2_load_offset, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_access);
+
+    ValidRegion valid_region = input_valid_region;
+    valid_region.anchor.set(0, std::ceil((valid_region.anchor[0] + (border_undefined ? 2 : 0)) / 2.f));
+    valid_region.shape.set(0, (valid_region.shape[0] - (border_undefined ? 2 : 0)) / 2 - valid_region.anchor[0]);
+    valid_region.anchor.set(1, std::ceil((valid_region.anchor[1] + (border_undefined ? 2 : 0)) / 2.f));
+    valid_region.shape.set(1, (valid_region.shape[1] - (border_undefined ? 2 : 0)) / 2 - valid_region.anchor[1]);
+
+    output_access.set_valid_region(win, valid_region);
+
+    INEKernel::configure(win);
+}
+
+void NEGaussianPyramidHalfKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.x().step() != 32);
+    ARM_COMPUTE_ERROR_ON(window.y().step() != 2);
+
+    static const int16x8_t  six_s16  = vdupq_n_s16(6);
+    static const int16x8_t  four_s16 = vdupq_n_s16(4);
+    static const uint16x8_t six_u16  = vdupq_n_u16(6);
+    static const uint16x8_t four_u16 = vdupq_n_u16(4);
+
+    constexpr int num_lines = 5;
+
+    const int    x_start       = window.x().start();
+    const int    x_end         = window.x().end();
+    const int    y_start       = window.y().start();
+    const int    y_end         = window.y().end();
+    const int    line_width    = (x_end - x_start) / 2;
+    const size_t in_stride_y   = _input->info()->strides_in_bytes()[Window::DimY];
+    const size_t out_stride_y  = _output->info()->strides_in_bytes()[Window::DimY];
+    const int    first_in_row  = y_start + _t2_load_offset;
+    const int    first_out_col = x_start / 2;
+
+    // Horizontally reduced rows, the row r is stored in line (r - first_in_row) % num_lines
+    int16_t *const lines = thread_scratch<int16_t>(num_lines * line_width);
+
+    // The rows and columns are handled manually, the iterators only walk the planes
+    Window win_planes(window);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+
+    execute_window_loop(win_planes, [&](const Coordinates &)
+    {
+        int next_in_row = first_in_row;
+
+        for(int y = y_start; y < y_end; y += 2)
+        {
+            const int top2_row = y + _t2_load_offset;
+
+            // Horizontal pass on the rows not reduced yet: 5 rows for the first output row, then 2 per output row
+            for(; next_in_row < top2_row + num_lines; ++next_in_row)
+            {
+                const uint8_t *in_row = in.ptr() + static_cast<ptrdiff_t>(next_in_row) * in_stride_y + _l2_load_offset;
+                int16_t       *line   = lines + ((next_in_row - first_in_row) % num_lines) * line_width;
+
+                for(int x = x_start; x < x_end; x += 16)
+                {
+                    const uint8x16x2_t data_2q   = vld2q_u8(in_row + x);
+                    const uint8x16_t &data_even = data_2q.val[0];
+                    const uint8x16_t &data_odd  = data_2q.val[1];
+
+                    const int16x8_t data_l2 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data_even)));
+                    const int16x8_t data_l1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data_odd)));
+                    const int16x8_t data_m  = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 1))));
+                    const int16x8_t data_r1 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_odd, data_odd, 1))));
+                    const int16x8_t data_r2 = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(vextq_u8(data_even, data_even, 2))));
+
+                    int16x8_t out_val = vaddq_s16(data_l2, data_r2);
+                    out_val           = vmlaq_s16(out_val, data_l1, four_s16);
+                    out_val           = vmlaq_s16(out_val, data_m, six_s16);
+                    out_val           = vmlaq_s16(out_val, data_r1, four_s16);
+
+                    vst1q_s16(line + (x - x_start) / 2, out_val);
+                }
+            }
+
+            // Vertical pass on the 5 lines around the output row
+            const int16_t *line_t2 = lines + ((top2_row - first_in_row) % num_lines) * line_width;
+            const int16_t *line_t1 = lines + ((top2_row + 1 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_m  = lines + ((top2_row + 2 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_b1 = lines + ((top2_row + 3 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_b2 = lines + ((top2_row + 4 - first_in_row) % num_lines) * line_width;
+
+            uint8_t *out_row = out.ptr() + static_cast<ptrdiff_t>(y / 2) * out_stride_y + first_out_col;
+
+            for(int x = 0; x < line_width; x += 16)
+            {
+                uint16x8_t out_low = vaddq_u16(vreinterpretq_u16_s16(vld1q_s16(line_t2 + x)), vreinterpretq_u16_s16(vld1q_s16(line_b2 + x)));
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_t1 + x)), four_u16);
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_m + x)), six_u16);
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_b1 + x)), four_u16);
+
+                uint16x8_t out_high = vaddq_u16(vreinterpretq_u16_s16(vld1q_s16(line_t2 + x + 8)), vreinterpretq_u16_s16(vld1q_s16(line_b2 + x + 8)));
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_t1 + x + 8)), four_u16);
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_m + x + 8)), six_u16);
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_b1 + x + 8)), four_u16);
+
+                vst1q_u8(out_row + x, vcombine_u8(vqshrn_n_u16(out_low, 8), vqshrn_n_u16(out_high, 8)));
+            }
+        }
+    },
+    in, out);
+}
@@ -23,10 +23,13 @@
  */
 #include "arm_compute/core/NEON/kernels/NEHOGDescriptorKernel.h"
 
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/HOGInfo.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/NEON/NEMagnitudePhaseHelper.inl"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
 #include <algorithm>
@@ -290,6 +293,32 @@ void cell_width_ge8(const int16_t *__restrict mag_row_ptr, const uint8_t *__rest
     }
 }
 
+template <PhaseType phase_type>
+void cell_gradient(const uint8_t *__restrict input_row_ptr, int16_t *__restrict mag_ptr, uint8_t *__restrict phase_ptr, size_t input_stride, size_t cell_stride, size_t cell_height)
+{
+    for(size_t yc = 0; yc < cell_height; ++yc)
+    {
+        const uint8_t *const in_ptr = input_row_ptr + yc * input_stride;
+
+        for(size_t xc = 0; xc < cell_stride; xc += 8)
+        {
+            // Load the neighbours of 8 pixels
+            const uint8x8_t l_data = vld1_u8(in_ptr + xc - 1);
+            const uint8x8_t r_data = vld1_u8(in_ptr + xc + 1);
+            const uint8x8_t t_data = vld1_u8(in_ptr + xc - input_stride);
+            const uint8x8_t b_data = vld1_u8(in_ptr + xc + input_stride);
+
+            // Compute the derivatives along x and y, as NEDerivativeKernel does
+            const int16x8_t gx = vreinterpretq_s16_u16(vsubl_u8(r_data, l_data));
+            const int16x8_t gy = vreinterpretq_s16_u16(vsubl_u8(b_data, t_data));
+
+            // Compute magnitude and phase, as NEMagnitudePhaseKernel does
+            vst1q_s16(mag_ptr + xc + yc * cell_stride, magnitude_l2(gx, gy));
+            vst1_u8(phase_ptr + xc + yc * cell_stride, (PhaseType::SIGNED == phase_type) ? phase_signed(gx, gy) : phase_unsigned(gx, gy));
+        }
+    }
+}
+
 void l2_norm(const float *__restrict input_row_ptr, float *__restrict output_ptr, size_t input_stride,
              size_t num_cells_per_block_height, size_t num_bins_block_x, size_t num_bins_block, float l2_hyst_threshold)
 {
@@ -703,6 +732,98 @@ void NEHOGOrientationBinningKernel::run(const Window &window)
     mag, phase, out);
 }
 
+NEHOGGradientOrientationBinningKernel::NEHOGGradientOrientationBinningKernel()
+    : _gradient_func(nullptr), _orient_bin_func(nullptr), _input(nullptr), _output(nullptr), _cell_width(0), _cell_height(0), _num_bins(0), _phase_scale(0)
+{
+}
+
+BorderSize NEHOGGradientOrientationBinningKernel::border_size() const
+{
+    return BorderSize(1);
+}
+
+void NEHOGGradientOrientationBinningKernel::configure(const ITensor *input, ITensor *output, const HOGInfo *hog_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(hog_info == nullptr);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, hog_info->num_bins(), DataType::F32);
+
+    _input       = input;
+    _output      = output;
+    _cell_width  = hog_info->cell_size().width;
+    _cell_height = hog_info->cell_size().height;
+    _num_bins    = hog_info->num_bins();
+    _phase_scale = (PhaseType::SIGNED == hog_info->phase_type() ? _num_bins / 360.0f : _num_bins / 180.0f);
+    _phase_scale *= (PhaseType::SIGNED == hog_info->phase_type() ? 360.0f / 255.0f : 1.0f);
+
+    if(PhaseType::SIGNED == hog_info->phase_type())
+    {
+        _gradient_func = &cell_gradient<PhaseType::SIGNED>;
+    }
+    else
+    {
+        _gradient_func = &cell_gradient<PhaseType::UNSIGNED>;
+    }
+
+    if(_cell_width < 8)
+    {
+        _orient_bin_func = &cell_width_lt8;
+    }
+    else
+    {
+        _orient_bin_func = &cell_width_ge8;
+    }
+
+    // The gradient is computed 8 pixels at a time, so every row of the cell is read up to the next multiple of 8
+    constexpr unsigned int num_elems_processed_per_iteration = 1;
+    const unsigned int     num_elems_read_per_iteration      = ceil_to_multiple(_cell_width, 8) + 2;
+    const unsigned int     num_rows_read_per_iteration       = _cell_height + 2;
+    const unsigned int     num_elems_written_per_iteration   = 1;
+
+    // Configure kernel window
+    Window                 win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_written_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -1, -1, num_elems_read_per_iteration, num_rows_read_per_iteration, _cell_width, _cell_height),
+                              output_access);
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEHOGGradientOrientationBinningKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_gradient_func == nullptr);
+    ARM_COMPUTE_ERROR_ON(_orient_bin_func == nullptr);
+
+    const size_t input_stride = _input->info()->strides_in_bytes()[Window::DimY];
+    const size_t cell_stride  = ceil_to_multiple(_cell_width, 8);
+
+    // Magnitude and phase of the gradient of the cell being processed
+    int16_t *const mag   = thread_scratch<int16_t>(cell_stride * _cell_height, 0);
+    uint8_t *const phase = thread_scratch<uint8_t>(cell_stride * _cell_height, 1);
+
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(window.x().start() * _cell_width, window.x().start() * _cell_width, _cell_width));
+    win_in.set(Window::DimY, Window::Dimension(window.y().start() * _cell_height, window.y().start() * _cell_height, _cell_height));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto out_row_ptr = reinterpret_cast<float *>(out.ptr());
+
+        (*_gradient_func)(in.ptr(), mag, phase, input_stride, cell_stride, _cell_height);
+        (*_orient_bin_func)(mag, phase, out_row_ptr, cell_stride, cell_stride, _cell_width, _cell_height, _num_bins, _phase_scale);
+    },
+    in, out);
+}
+
 NEHOGBlockNormalizationKernel::NEHOGBlockNormalizationKernel()
     : _func(nullptr), _input(nullptr), _output(nullptr), _num_cells_per_block(), _num_cells_per_block_stride(), _num_bins(0), _l2_hyst_threshold(0.0f)
 {
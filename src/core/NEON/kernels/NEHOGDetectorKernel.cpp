@@ -34,8 +34,8 @@
 using namespace arm_compute;
 
 NEHOGDetectorKernel::NEHOGDetectorKernel()
-    : _input(nullptr), _detection_windows(), _hog_descriptor(nullptr), _bias(0.0f), _threshold(0.0f), _idx_class(0), _num_bins_per_descriptor_x(0), _num_blocks_per_descriptor_y(0), _block_stride_width(0),
-      _block_stride_height(0), _detection_window_width(0), _detection_window_height(0), _mutex()
+    : _input(nullptr), _detection_windows(), _hog_descriptors(), _biases(), _idx_classes(), _num_models(0), _threshold(0.0f), _num_bins_per_descriptor_x(0), _num_blocks_per_descriptor_y(0),
+      _block_stride_width(0), _block_stride_height(0), _detection_window_width(0), _detection_window_height(0), _local_detections()
 {
 }
 
@@ -44,20 +44,62 @@ void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDete
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON(hog == nullptr);
     ARM_COMPUTE_ERROR_ON(detection_windows == nullptr);
-    ARM_COMPUTE_ERROR_ON((detection_window_stride.width % hog->info()->block_stride().width) != 0);
-    ARM_COMPUTE_ERROR_ON((detection_window_stride.height % hog->info()->block_stride().height) != 0);
-
-    const Size2D &detection_window_size = hog->info()->detection_window_size();
-    const Size2D &block_size            = hog->info()->block_size();
-    const Size2D &block_stride          = hog->info()->block_stride();
-
-    _input                       = input;
-    _detection_windows           = detection_windows;
-    _threshold                   = threshold;
-    _idx_class                   = idx_class;
-    _hog_descriptor              = hog->descriptor();
-    _bias                        = _hog_descriptor[hog->info()->descriptor_size() - 1];
-    _num_bins_per_descriptor_x   = ((detection_window_size.width - block_size.width) / block_stride.width + 1) * input->info()->num_channels();
+
+    _input              = input;
+    _detection_windows  = detection_windows;
+    _threshold          = threshold;
+    _num_models         = 1;
+    _idx_classes[0]     = idx_class;
+    _hog_descriptors[0] = hog->descriptor();
+    _biases[0]          = _hog_descriptors[0][hog->info()->descriptor_size() - 1];
+
+    configure_window(*hog->info(), detection_window_stride);
+}
+
+void NEHOGDetectorKernel::configure(const ITensor *input, const IMultiHOG *multi_hog, size_t first_model, size_t num_models, IDetectionWindowArray *detection_windows,
+                                    const Size2D &detection_window_stride, float threshold)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(multi_hog == nullptr);
+    ARM_COMPUTE_ERROR_ON(detection_windows == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_models == 0 || num_models > max_models);
+    ARM_COMPUTE_ERROR_ON(first_model + num_models > multi_hog->num_models());
+
+    const HOGInfo *info = multi_hog->model(first_model)->info();
+
+    _input             = input;
+    _detection_windows = detection_windows;
+    _threshold         = threshold;
+    _num_models        = num_models;
+
+    for(size_t m = 0; m < num_models; ++m)
+    {
+        const IHOG *hog = multi_hog->model(first_model + m);
+
+        ARM_COMPUTE_ERROR_ON(hog->info()->descriptor_size() != info->descriptor_size());
+        ARM_COMPUTE_ERROR_ON(hog->info()->block_size().width != info->block_size().width || hog->info()->block_size().height != info->block_size().height);
+        ARM_COMPUTE_ERROR_ON(hog->info()->block_stride().width != info->block_stride().width || hog->info()->block_stride().height != info->block_stride().height);
+        ARM_COMPUTE_ERROR_ON(hog->info()->detection_window_size().width != info->detection_window_size().width
+                             || hog->info()->detection_window_size().height != info->detection_window_size().height);
+
+        _idx_classes[m]     = first_model + m;
+        _hog_descriptors[m] = hog->descriptor();
+        _biases[m]          = _hog_descriptors[m][hog->info()->descriptor_size() - 1];
+    }
+
+    configure_window(*info, detection_window_stride);
+}
+
+void NEHOGDetectorKernel::configure_window(const HOGInfo &hog_info, const Size2D &detection_window_stride)
+{
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.width % hog_info.block_stride().width) != 0);
+    ARM_COMPUTE_ERROR_ON((detection_window_stride.height % hog_info.block_stride().height) != 0);
+
+    const Size2D &detection_window_size = hog_info.detection_window_size();
+    const Size2D &block_size            = hog_info.block_size();
+    const Size2D &block_stride          = hog_info.block_stride();
+
+    _num_bins_per_descriptor_x   = ((detection_window_size.width - block_size.width) / block_stride.width + 1) * _input->info()->num_channels();
     _num_blocks_per_descriptor_y = (detection_window_size.height - block_size.height) / block_stride.height + 1;
     _block_stride_width          = block_stride.width;
     _block_stride_height         = block_stride.height;
@@ -65,7 +107,7 @@ void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDete
     _detection_window_height     = detection_window_size.height;
 
     // Get the number of blocks along the x and y directions of the input tensor
-    const ValidRegion &valid_region = input->info()->valid_region();
+    const ValidRegion &valid_region = _input->info()->valid_region();
     const size_t       num_blocks_x = valid_region.shape[0];
     const size_t       num_blocks_y = valid_region.shape[1];
 
@@ -84,7 +126,7 @@ void NEHOGDetectorKernel::configure(const ITensor *input, const IHOG *hog, IDete
     const unsigned int num_elems_read_per_iteration = _num_bins_per_descriptor_x;
     const unsigned int num_rows_read_per_iteration  = _num_blocks_per_descriptor_y;
 
-    update_window_and_padding(win, AccessWindowRectangle(input->info(), 0, 0, num_elems_read_per_iteration, num_rows_read_per_iteration));
+    update_window_and_padding(win, AccessWindowRectangle(_input->info(), 0, 0, num_elems_read_per_iteration, num_rows_read_per_iteration));
 
     INEKernel::configure(win);
 }
@@ -93,23 +135,29 @@ void NEHOGDetectorKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
-    ARM_COMPUTE_ERROR_ON(_hog_descriptor == nullptr);
+    ARM_COMPUTE_ERROR_ON(_num_models == 0);
 
     const size_t in_step_y = _input->info()->strides_in_bytes()[Window::DimY] / data_size_from_type(_input->info()->data_type());
 
+    std::vector<DetectionWindow> &local_detections = _local_detections[window.thread_id()];
+
     Iterator in(_input, window);
 
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const auto *in_row_ptr = reinterpret_cast<const float *>(in.ptr());
 
-        // Init score_f32 with 0
-        float32x4_t score_f32 = vdupq_n_f32(0.0f);
+        // Init score_f32 with 0 and score with bias
+        std::array<float32x4_t, max_models> score_f32;
+        std::array<float, max_models>       score;
 
-        // Init score with bias
-        float score = _bias;
+        for(size_t m = 0; m < _num_models; ++m)
+        {
+            score_f32[m] = vdupq_n_f32(0.0f);
+            score[m]     = _biases[m];
+        }
 
-        // Compute Linear SVM
+        // Compute Linear SVM: each descriptor value is loaded once for all the models
         for(size_t yb = 0; yb < _num_blocks_per_descriptor_y; ++yb, in_row_ptr += in_step_y)
         {
             int32_t xb = 0;
@@ -129,52 +177,80 @@ void NEHOGDetectorKernel::run(const Window &window)
                     }
                 };
 
-                // Load detector values
-                const float32x4x4_t b_f32 =
+                for(size_t m = 0; m < _num_models; ++m)
                 {
+                    const float *hog_descriptor = _hog_descriptors[m] + offset_y;
+
+                    // Load detector values
+                    const float32x4x4_t b_f32 =
                     {
-                        vld1q_f32(&_hog_descriptor[xb + 0 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 4 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 8 + offset_y]),
-                        vld1q_f32(&_hog_descriptor[xb + 12 + offset_y])
-                    }
-                };
+                        {
+                            vld1q_f32(&hog_descriptor[xb + 0]),
+                            vld1q_f32(&hog_descriptor[xb + 4]),
+                            vld1q_f32(&hog_descriptor[xb + 8]),
+                            vld1q_f32(&hog_descriptor[xb + 12])
+                        }
+                    };
 
-                // Multiply accumulate
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[0], b_f32.val[0]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[1], b_f32.val[1]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[2], b_f32.val[2]);
-                score_f32 = vmlaq_f32(score_f32, a_f32.val[3], b_f32.val[3]);
+                    // Multiply accumulate
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[0], b_f32.val[0]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[1], b_f32.val[1]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[2], b_f32.val[2]);
+                    score_f32[m] = vmlaq_f32(score_f32[m], a_f32.val[3], b_f32.val[3]);
+                }
             }
 
             for(; xb < static_cast<int32_t>(_num_bins_per_descriptor_x); ++xb)
             {
                 const float a = in_row_ptr[xb];
-                const float b = _hog_descriptor[xb + offset_y];
 
-                score += a * b;
+                for(size_t m = 0; m < _num_models; ++m)
+                {
+                    score[m] += a * _hog_descriptors[m][xb + offset_y];
+                }
             }
         }
 
-        score += vgetq_lane_f32(score_f32, 0);
-        score += vgetq_lane_f32(score_f32, 1);
-        score += vgetq_lane_f32(score_f32, 2);
-        score += vgetq_lane_f32(score_f32, 3);
-
-        if(score > _threshold)
+        for(size_t m = 0; m < _num_models; ++m)
         {
-            DetectionWindow win;
-            win.x         = (id.x() * _block_stride_width);
-            win.y         = (id.y() * _block_stride_height);
-            win.width     = _detection_window_width;
-            win.height    = _detection_window_height;
-            win.idx_class = _idx_class;
-            win.score     = score;
-
-            std::unique_lock<std::mutex> lock(_mutex);
-            _detection_windows->push_back(win);
-            lock.unlock();
+            score[m] += vgetq_lane_f32(score_f32[m], 0);
+            score[m] += vgetq_lane_f32(score_f32[m], 1);
+            score[m] += vgetq_lane_f32(score_f32[m], 2);
+            score[m] += vgetq_lane_f32(score_f32[m], 3);
+
+            if(score[m] > _threshold)
+            {
+                DetectionWindow win;
+                win.x         = (id.x() * _block_stride_width);
+                win.y         = (id.y() * _block_stride_height);
+                win.width     = _detection_window_width;
+                win.height    = _detection_window_height;
+                win.idx_class = _idx_classes[m];
+                win.score     = score[m];
+
+                local_detections.push_back(win);
+            }
         }
     },
     in);
 }
+
+void NEHOGDetectorKernel::begin_reduction(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    _local_detections.reset(num_threads, std::vector<DetectionWindow>());
+}
+
+void NEHOGDetectorKernel::end_reduction()
+{
+    const std::vector<DetectionWindow> &detections = _local_detections.reduce([](std::vector<DetectionWindow> &dst, const std::vector<DetectionWindow> &src)
+    {
+        dst.insert(dst.end(), src.begin(), src.end());
+    });
+
+    for(const auto &detection : detections)
+    {
+        _detection_windows->push_back(detection);
+    }
+}
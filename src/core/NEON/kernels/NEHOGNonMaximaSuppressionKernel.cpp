@@ -28,6 +28,9 @@
 
 #include <algorithm>
 #include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
 
 using namespace arm_compute;
 
@@ -37,84 +40,181 @@ bool compare_detection_window(const DetectionWindow &lhs, const DetectionWindow
 {
     return lhs.score > rhs.score;
 }
+
+/** Key of the grid cell containing a point */
+inline int64_t cell_key(int32_t cell_x, int32_t cell_y)
+{
+    return (static_cast<int64_t>(cell_x) << 32) | static_cast<uint32_t>(cell_y);
+}
 } // namespace
 
 NEHOGNonMaximaSuppressionKernel::NEHOGNonMaximaSuppressionKernel()
-    : _input_output(nullptr), _min_distance(0.0f)
+    : _input_output(nullptr), _min_distance(0.0f), _num_partitions(1), _candidates(), _offsets(), _num_kept()
 {
 }
 
 bool NEHOGNonMaximaSuppressionKernel::is_parallelisable() const
 {
-    return false;
+    return _num_partitions > 1;
+}
+
+SchedulingPolicy NEHOGNonMaximaSuppressionKernel::scheduling_policy() const
+{
+    // The number of candidates per class is only known at run time
+    return SchedulingPolicy::DYNAMIC;
 }
 
-void NEHOGNonMaximaSuppressionKernel::configure(IDetectionWindowArray *input_output, float min_distance)
+void NEHOGNonMaximaSuppressionKernel::configure(IDetectionWindowArray *input_output, float min_distance, size_t num_classes)
 {
     ARM_COMPUTE_ERROR_ON(nullptr == input_output);
 
-    _input_output = input_output;
-    _min_distance = min_distance;
+    _input_output   = input_output;
+    _min_distance   = min_distance;
+    _num_partitions = std::max<size_t>(num_classes, 1);
+
+    _offsets.resize(_num_partitions + 1);
+    _num_kept.resize(_num_partitions);
+
+    // One iteration per partition
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, _num_partitions, 1));
 
-    IKernel::configure(Window()); // Default 1 iteration window
+    IKernel::configure(win);
 }
 
-void NEHOGNonMaximaSuppressionKernel::run(const Window &window)
+void NEHOGNonMaximaSuppressionKernel::begin_reduction(unsigned int num_threads)
 {
+    ARM_COMPUTE_UNUSED(num_threads);
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_WINDOWS(IKernel::window(), window);
     ARM_COMPUTE_ERROR_ON(_input_output->buffer() == nullptr);
 
     const size_t num_candidates = _input_output->num_values();
-    size_t       num_detections = 0;
+
+    // Group the candidates by partition with a counting sort
+    std::fill(_offsets.begin(), _offsets.end(), 0);
+
+    for(size_t i = 0; i < num_candidates; ++i)
+    {
+        const size_t partition = _num_partitions > 1 ? _input_output->at(i).idx_class : 0;
+        ARM_COMPUTE_ERROR_ON(partition >= _num_partitions);
+        ++_offsets[partition + 1];
+    }
+
+    for(size_t p = 0; p < _num_partitions; ++p)
+    {
+        _offsets[p + 1] += _offsets[p];
+    }
+
+    std::vector<size_t> next(_offsets.begin(), _offsets.end() - 1);
+
+    _candidates.resize(num_candidates);
+
+    for(size_t i = 0; i < num_candidates; ++i)
+    {
+        const size_t partition = _num_partitions > 1 ? _input_output->at(i).idx_class : 0;
+        _candidates[next[partition]++] = _input_output->at(i);
+    }
+}
+
+void NEHOGNonMaximaSuppressionKernel::end_reduction()
+{
+    size_t num_detections = 0;
+
+    for(size_t p = 0; p < _num_partitions; ++p)
+    {
+        for(size_t k = 0; k < _num_kept[p]; ++k)
+        {
+            _input_output->at(num_detections++) = _candidates[_offsets[p] + k];
+        }
+    }
+
+    _input_output->resize(num_detections);
+}
+
+void NEHOGNonMaximaSuppressionKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(IKernel::window(), window);
+
+    for(int p = window.x().start(); p < window.x().end(); p += window.x().step())
+    {
+        suppress(p);
+    }
+}
+
+void NEHOGNonMaximaSuppressionKernel::suppress(size_t partition)
+{
+    DetectionWindow *const candidates     = _candidates.data() + _offsets[partition];
+    const size_t           num_candidates = _offsets[partition + 1] - _offsets[partition];
+    size_t                 num_detections = 0;
 
     /* Sort list of candidates */
-    std::sort(_input_output->buffer(), _input_output->buffer() + num_candidates, compare_detection_window);
+    std::sort(candidates, candidates + num_candidates, compare_detection_window);
 
     const float min_distance_pow2 = _min_distance * _min_distance;
+    const bool  can_suppress      = _min_distance > 0.0f;
+
+    /* Centres of the windows kept so far, bucketed by grid cell */
+    std::unordered_map<int64_t, std::vector<std::pair<float, float>>> kept;
 
-    /* Euclidean distance */
+    /* Euclidean distance: a candidate is kept if no better window already kept is close to it */
     for(size_t i = 0; i < num_candidates; ++i)
     {
-        if(0.0f != _input_output->at(i).score)
+        const DetectionWindow cur = candidates[i];
+
+        if(0.0f == cur.score)
         {
-            DetectionWindow cur;
-            cur.x         = _input_output->at(i).x;
-            cur.y         = _input_output->at(i).y;
-            cur.width     = _input_output->at(i).width;
-            cur.height    = _input_output->at(i).height;
-            cur.idx_class = _input_output->at(i).idx_class;
-            cur.score     = _input_output->at(i).score;
+            continue;
+        }
 
-            /* Store window */
-            _input_output->at(num_detections) = cur;
+        const float xc = cur.x + cur.width * 0.5f;
+        const float yc = cur.y + cur.height * 0.5f;
 
-            ++num_detections;
+        bool suppressed = false;
 
-            const float xc = cur.x + cur.width * 0.5f;
-            const float yc = cur.y + cur.height * 0.5f;
+        if(can_suppress)
+        {
+            const int32_t cell_x = static_cast<int32_t>(std::floor(xc / _min_distance));
+            const int32_t cell_y = static_cast<int32_t>(std::floor(yc / _min_distance));
 
-            for(size_t k = i + 1; k < num_candidates; ++k)
+            // The windows closer than min_distance can only be in the neighbouring cells
+            for(int32_t ny = cell_y - 1; ny <= cell_y + 1 && !suppressed; ++ny)
             {
-                const float xn = _input_output->at(k).x + _input_output->at(k).width * 0.5f;
-                const float yn = _input_output->at(k).y + _input_output->at(k).height * 0.5f;
-
-                const float dx = std::fabs(xn - xc);
-                const float dy = std::fabs(yn - yc);
-
-                if(dx < _min_distance && dy < _min_distance)
+                for(int32_t nx = cell_x - 1; nx <= cell_x + 1 && !suppressed; ++nx)
                 {
-                    const float d = dx * dx + dy * dy;
+                    const auto cell = kept.find(cell_key(nx, ny));
 
-                    if(d < min_distance_pow2)
+                    if(cell == kept.end())
                     {
-                        /* Invalidate keypoint */
-                        _input_output->at(k).score = 0.0f;
+                        continue;
+                    }
+
+                    for(const auto &centre : cell->second)
+                    {
+                        const float dx = std::fabs(xc - centre.first);
+                        const float dy = std::fabs(yc - centre.second);
+
+                        if(dx < _min_distance && dy < _min_distance && (dx * dx + dy * dy) < min_distance_pow2)
+                        {
+                            suppressed = true;
+                            break;
+                        }
                     }
                 }
             }
+
+            if(!suppressed)
+            {
+                kept[cell_key(cell_x, cell_y)].emplace_back(xc, yc);
+            }
+        }
+
+        if(!suppressed)
+        {
+            /* Store window */
+            candidates[num_detections++] = cur;
         }
     }
 
-    _input_output->resize(num_detections);
+    _num_kept[partition] = num_detections;
 }
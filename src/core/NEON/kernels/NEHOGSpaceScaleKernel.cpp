@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEHOGSpaceScaleKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Exponent of the power law followed by the gradient histograms across scales: downscaling the image by s scales them by s^lambda
+ *
+ * @note The block normalization cancels most of this correction, it only matters for the epsilon of the norms.
+ */
+constexpr float hog_lambda = 0.1f;
+} // namespace
+
+NEHOGSpaceScaleKernel::NEHOGSpaceScaleKernel()
+    : _input(nullptr), _output(nullptr), _taps_x(), _first_tap_x(), _taps_y(), _first_tap_y(), _correction(1.f)
+{
+}
+
+void NEHOGSpaceScaleKernel::configure(const ITensor *input, ITensor *output, float scale)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_NOT_IN(input, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_NOT_IN(output, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_channels() != output->info()->num_channels());
+    ARM_COMPUTE_ERROR_ON(scale < 1.f);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(Window::DimX) * scale > input->info()->dimension(Window::DimX) + 0.5f);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(Window::DimY) * scale > input->info()->dimension(Window::DimY) + 0.5f);
+
+    _input      = input;
+    _output     = output;
+    _correction = std::pow(scale, hog_lambda);
+
+    // The output cell i covers the input cells [i * scale, (i + 1) * scale), the weights of its taps are normalized to average them
+    const auto compute_taps = [scale](size_t num_cells, size_t num_input_cells, std::vector<Tap> &taps, std::vector<size_t> &first_tap)
+    {
+        taps.clear();
+        first_tap.clear();
+
+        for(size_t i = 0; i < num_cells; ++i)
+        {
+            const float start = i * scale;
+            const float end   = std::min((i + 1) * scale, static_cast<float>(num_input_cells));
+
+            first_tap.push_back(taps.size());
+
+            const size_t first = taps.size();
+
+            for(int idx = static_cast<int>(start); idx < end; ++idx)
+            {
+                const float covered = std::min(idx + 1.f, end) - std::max(static_cast<float>(idx), start);
+
+                if(covered > 0.f)
+                {
+                    taps.push_back(Tap{ idx, covered });
+                }
+            }
+
+            // The last cells might be partially covered by the input
+            const float total = end - start;
+
+            for(size_t t = first; t < taps.size(); ++t)
+            {
+                taps[t].weight /= total;
+            }
+        }
+
+        first_tap.push_back(taps.size());
+    };
+
+    compute_taps(output->info()->dimension(Window::DimX), input->info()->dimension(Window::DimX), _taps_x, _first_tap_x);
+    compute_taps(output->info()->dimension(Window::DimY), input->info()->dimension(Window::DimY), _taps_y, _first_tap_y);
+
+    constexpr unsigned int num_elems_processed_per_iteration = 1;
+
+    // Configure kernel window: the input cells are read at arbitrary coordinates within the input, which needs no padding
+    Window                 win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEHOGSpaceScaleKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t   num_bins       = _input->info()->num_channels();
+    const size_t   input_stride_x = _input->info()->strides_in_bytes()[Window::DimX];
+    const size_t   input_stride_y = _input->info()->strides_in_bytes()[Window::DimY];
+    const uint8_t *input_ptr      = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        auto *out = reinterpret_cast<float *>(output.ptr());
+
+        std::fill_n(out, num_bins, 0.f);
+
+        for(size_t ty = _first_tap_y[id.y()]; ty < _first_tap_y[id.y() + 1]; ++ty)
+        {
+            const uint8_t *row_ptr = input_ptr + _taps_y[ty].idx * input_stride_y;
+
+            for(size_t tx = _first_tap_x[id.x()]; tx < _first_tap_x[id.x() + 1]; ++tx)
+            {
+                const auto *in     = reinterpret_cast<const float *>(row_ptr + _taps_x[tx].idx * input_stride_x);
+                const float weight = _taps_y[ty].weight * _taps_x[tx].weight;
+
+                size_t bin = 0;
+
+                for(; (bin + 4) <= num_bins; bin += 4)
+                {
+                    vst1q_f32(out + bin, vmlaq_n_f32(vld1q_f32(out + bin), vld1q_f32(in + bin), weight));
+                }
+
+                // Compute left over bins
+                for(; bin < num_bins; ++bin)
+                {
+                    out[bin] += in[bin] * weight;
+                }
+            }
+        }
+
+        for(size_t bin = 0; bin < num_bins; ++bin)
+        {
+            out[bin] *= _correction;
+        }
+    },
+    output);
+}
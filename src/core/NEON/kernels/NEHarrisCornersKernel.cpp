@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NEHarrisCornersKernel.h"
 
+#include "arm_compute/core/AccessWindowStatic.h"
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -1090,3 +1091,230 @@ void NEHarrisScoreKernel<block_size>::configure(const IImage *input1, const IIma
 
     INEKernel::configure(win);
 }
+
+namespace
+{
+/** Size of the tiles processed by NEHarrisCornerCandidatesKernel */
+constexpr int tile_width  = 64;
+constexpr int tile_height = 16;
+/** Row stride of the score of a tile and of its margin, enough for the widest step of the harris score functions */
+constexpr int tile_score_stride = tile_width + 2 + 8;
+} // namespace
+
+NEHarrisCornerCandidatesKernel::NEHarrisCornerCandidatesKernel()
+    : _func(nullptr), _input1(nullptr), _input2(nullptr), _output(nullptr), _thread_candidates(), _sensitivity(0.0f), _strength_thresh(0.0f), _norm_factor(0.0f), _border_size(), _num_elems_step(0),
+      _border_undefined(false), _width(0), _height(0), _end_x(0), _end_y(0)
+{
+}
+
+BorderSize NEHarrisCornerCandidatesKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEHarrisCornerCandidatesKernel::configure(const IImage *input1, const IImage *input2, std::vector<InternalKeypoint> *output, int32_t block_size,
+                                               float norm_factor, float strength_thresh, float sensitivity, bool border_undefined, bool use_fp16)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input1);
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input2);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::S16, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input2, 1, DataType::S16, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input1, input2);
+    ARM_COMPUTE_ERROR_ON(nullptr == output);
+    ARM_COMPUTE_ERROR_ON(0.0f == norm_factor);
+
+    _input1           = input1;
+    _input2           = input2;
+    _output           = output;
+    _sensitivity      = sensitivity;
+    _strength_thresh  = strength_thresh;
+    _norm_factor      = norm_factor;
+    _border_size      = BorderSize(block_size / 2);
+    _border_undefined = border_undefined;
+    _func             = nullptr;
+
+    const bool is_s16 = input1->info()->data_type() == DataType::S16;
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    if(use_fp16)
+    {
+        switch(block_size)
+        {
+            case 3:
+                _func = is_s16 ? &fp16::harris_score_S16_S16_FLOAT<3> : &fp16::harris_score_S32_S32_FLOAT<3>;
+                break;
+            case 5:
+                _func = is_s16 ? &fp16::harris_score_S16_S16_FLOAT<5> : &fp16::harris_score_S32_S32_FLOAT<5>;
+                break;
+            case 7:
+                _func = is_s16 ? &fp16::harris_score_S16_S16_FLOAT<7> : &fp16::harris_score_S32_S32_FLOAT<7>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid block size");
+                break;
+        }
+
+        _num_elems_step = 8;
+    }
+#else
+    ARM_COMPUTE_UNUSED(use_fp16);
+#endif
+
+    if(nullptr == _func)
+    {
+        switch(block_size)
+        {
+            case 3:
+                _func = is_s16 ? &harris_score3x3_S16_S16_FLOAT : &harris_score3x3_S32_S32_FLOAT;
+                break;
+            case 5:
+                _func = is_s16 ? &harris_score5x5_S16_S16_FLOAT : &harris_score5x5_S32_S32_FLOAT;
+                break;
+            case 7:
+                _func = is_s16 ? &harris_score7x7_S16_S16_FLOAT : &harris_score7x7_S32_S32_FLOAT;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Invalid block size");
+                break;
+        }
+
+        _num_elems_step = block_size != 7 ? 8 : 4;
+    }
+
+    ARM_COMPUTE_ERROR_ON(nullptr == _func);
+
+    // Elements read by one call of the harris score function, starting from the left border
+    const int num_elems_read_per_iteration = _num_elems_step == 8 ? 16 : 12;
+    const int border                       = _border_size.left;
+
+    // The candidates are extracted on the whole image, except where the score or its non-maxima suppression isn't defined
+    const ValidRegion valid_region = intersect_valid_regions(input1->info()->valid_region(),
+                                                             input2->info()->valid_region());
+    const int offset  = border_undefined ? border + 1 : 0;
+    const int start_x = valid_region.anchor[0] + offset;
+    const int start_y = valid_region.anchor[1] + offset;
+
+    _width  = input1->info()->dimension(0);
+    _height = input1->info()->dimension(1);
+    _end_x  = std::max<int>(start_x, valid_region.anchor[0] + valid_region.shape[0] - offset);
+    _end_y  = std::max<int>(start_y, valid_region.anchor[1] + valid_region.shape[1] - offset);
+
+    // Configure kernel window: one iteration per tile
+    Window win;
+    win.set(Window::DimX, Window::Dimension(start_x, start_x + ceil_to_multiple(_end_x - start_x, tile_width), tile_width));
+    win.set(Window::DimY, Window::Dimension(start_y, start_y + ceil_to_multiple(_end_y - start_y, tile_height), tile_height));
+
+    // The score is computed on a one pixel margin around the tiles and the function of the last column of a tile starts at most on its end
+    const int read_start_x = start_x - 1 - border;
+    const int read_start_y = start_y - 1 - border;
+    const int read_end_x   = _end_x - border + num_elems_read_per_iteration;
+    const int read_end_y   = _end_y + 1 + border;
+
+    update_window_and_padding(win,
+                              AccessWindowStatic(input1->info(), read_start_x, read_start_y, read_end_x, read_end_y),
+                              AccessWindowStatic(input2->info(), read_start_x, read_start_y, read_end_x, read_end_y));
+
+    INEKernel::configure(win);
+}
+
+void NEHarrisCornerCandidatesKernel::begin_reduction(unsigned int num_threads)
+{
+    _thread_candidates.reset(num_threads, std::vector<InternalKeypoint>());
+}
+
+void NEHarrisCornerCandidatesKernel::end_reduction()
+{
+    _output->clear();
+
+    for(unsigned int t = 0; t < _thread_candidates.size(); ++t)
+    {
+        const std::vector<InternalKeypoint> &candidates = _thread_candidates[t];
+        _output->insert(_output->end(), candidates.begin(), candidates.end());
+    }
+}
+
+void NEHarrisCornerCandidatesKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    const TensorInfo *info         = _input1->info();
+    const size_t      element_size = element_size_from_data_type(info->data_type());
+    const size_t      stride_y     = info->strides_in_bytes()[1];
+    const int32_t     input_stride = stride_y / element_size;
+    const uint8_t    *gx_first     = _input1->buffer() + info->offset_first_element_in_bytes();
+    const uint8_t    *gy_first     = _input2->buffer() + _input2->info()->offset_first_element_in_bytes();
+
+    std::vector<InternalKeypoint> &candidates = _thread_candidates[window.thread_id()];
+
+    // Score of the tile, the first row and column being the margin
+    float score[tile_height + 2][tile_score_stride];
+
+    for(int y0 = window.y().start(); y0 < window.y().end(); y0 += window.y().step())
+    {
+        const int y1 = std::min(y0 + window.y().step(), _end_y);
+
+        for(int x0 = window.x().start(); x0 < window.x().end(); x0 += window.x().step())
+        {
+            const int x1       = std::min(x0 + window.x().step(), _end_x);
+            const int num_cols = ceil_to_multiple(x1 - x0 + 2, _num_elems_step);
+
+            // Harris score
+            for(int y = y0 - 1; y <= y1; ++y)
+            {
+                float *score_row = score[y - y0 + 1];
+
+                if(!_border_undefined && (y < 0 || y >= _height))
+                {
+                    std::fill_n(score_row, num_cols, 0.0f);
+                    continue;
+                }
+
+                const ptrdiff_t offset = static_cast<ptrdiff_t>(y) * stride_y + static_cast<ptrdiff_t>(x0 - 1) * element_size;
+
+                for(int c = 0; c < num_cols; c += _num_elems_step)
+                {
+                    (*_func)(gx_first + offset + c * element_size, gy_first + offset + c * element_size, score_row + c, input_stride, _norm_factor, _sensitivity, _strength_thresh);
+                }
+
+                if(!_border_undefined)
+                {
+                    // The non-maxima suppression sees a constant border of 0
+                    if(x0 == 0)
+                    {
+                        score_row[0] = 0.0f;
+                    }
+
+                    const int first_outside = _width - x0 + 1;
+
+                    if(first_outside < num_cols)
+                    {
+                        std::fill(score_row + first_outside, score_row + num_cols, 0.0f);
+                    }
+                }
+            }
+
+            // Non-maxima suppression and corner candidates: same comparisons as NENonMaximaSuppression3x3
+            for(int r = 1; r <= y1 - y0; ++r)
+            {
+                const float *top    = score[r - 1];
+                const float *middle = score[r];
+                const float *bottom = score[r + 1];
+
+                for(int c = 1; c <= x1 - x0; ++c)
+                {
+                    const float vc = middle[c];
+
+                    if(vc != 0.0f
+                       && vc >= top[c - 1] && vc >= top[c] && vc >= top[c + 1]
+                       && vc >= middle[c - 1] && vc > middle[c + 1]
+                       && vc > bottom[c - 1] && vc > bottom[c] && vc > bottom[c + 1])
+                    {
+                        candidates.emplace_back(x0 - 1 + c, y0 - 1 + r, vc);
+                    }
+                }
+            }
+        }
+    }
+}
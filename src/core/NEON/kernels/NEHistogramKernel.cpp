@@ -27,13 +27,13 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IDistribution1D.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEHistogramHelper.inl"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Window.h"
 
 #include <algorithm>
 #include <arm_neon.h>
-#include <array>
 
 using namespace arm_compute;
 
@@ -42,27 +42,8 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
-inline void NEHistogramKernel::merge_histogram(uint32_t *global_hist, const uint32_t *local_hist, size_t bins)
-{
-    std::lock_guard<std::mutex> lock(_hist_mtx);
-
-    const unsigned int v_end = (bins / 4) * 4;
-
-    for(unsigned int b = 0; b < v_end; b += 4)
-    {
-        const uint32x4_t tmp_global = vld1q_u32(global_hist + b);
-        const uint32x4_t tmp_local  = vld1q_u32(local_hist + b);
-        vst1q_u32(global_hist + b, vaddq_u32(tmp_global, tmp_local));
-    }
-
-    for(unsigned int b = v_end; b < bins; ++b)
-    {
-        global_hist[b] += local_hist[b];
-    }
-}
-
 NEHistogramKernel::NEHistogramKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _local_hist(nullptr), _window_lut(nullptr), _hist_mtx()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _window_lut(nullptr), _local_hist(), _bank_stride(0)
 {
 }
 
@@ -70,77 +51,39 @@ void NEHistogramKernel::histogram_U8(Window win)
 {
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
-    const size_t          bins       = _output->num_bins();
-    const int32_t         offset     = _output->offset();
-    const uint32_t        offrange   = offset + _output->range();
-    const uint32_t *const w_lut      = _window_lut;
-    uint32_t *const       local_hist = _local_hist + win.thread_id() * bins;
-
-    // Clear local_histogram
-    std::fill_n(local_hist, bins, 0);
-
-    auto update_local_hist = [&](uint8_t p)
-    {
-        if(offset <= p && p < offrange)
-        {
-            ++local_hist[w_lut[p]];
-        }
-    };
+    const uint32_t *const w_lut       = _window_lut;
+    uint32_t *const       local_hist  = _local_hist[win.thread_id()].data();
+    const size_t          bank_stride = _bank_stride;
 
     const unsigned int x_start = win.x().start();
-    const unsigned int x_end   = win.x().end();
+    const int          width   = win.x().end() - x_start;
 
-    // Handle X dimension manually to split into two loops
-    // First one will use vector operations, second one processes the left over
-    // pixels
+    // Handle X dimension manually: each row is counted at once
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(_input, win);
 
-    // Calculate local histogram
+    // Calculate local histogram, the pixels out of the range of the distribution being counted in the discarded bin
     execute_window_loop(win, [&](const Coordinates &)
     {
-        unsigned int x = x_start;
-
-        // Vector loop
-        for(; x <= x_end - 8; x += 8)
-        {
-            const uint8x8_t pixels = vld1_u8(input.ptr() + x);
-
-            update_local_hist(vget_lane_u8(pixels, 0));
-            update_local_hist(vget_lane_u8(pixels, 1));
-            update_local_hist(vget_lane_u8(pixels, 2));
-            update_local_hist(vget_lane_u8(pixels, 3));
-            update_local_hist(vget_lane_u8(pixels, 4));
-            update_local_hist(vget_lane_u8(pixels, 5));
-            update_local_hist(vget_lane_u8(pixels, 6));
-            update_local_hist(vget_lane_u8(pixels, 7));
-        }
-
-        // Process leftover pixels
-        for(; x < x_end; ++x)
+        histogram_banked_row_u8(input.ptr() + x_start, width, local_hist, bank_stride, [w_lut](uint8_t p)
         {
-            update_local_hist(input.ptr()[x]);
-        }
+            return w_lut[p];
+        });
     },
     input);
-
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist, bins);
 }
 
 void NEHistogramKernel::histogram_fixed_U8(Window win)
 {
     ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
 
-    std::array<uint32_t, _max_range_size> local_hist{ { 0 } };
+    uint32_t *const local_hist = _local_hist[win.thread_id()].data();
 
     const unsigned int x_start = win.x().start();
-    const unsigned int x_end   = win.x().end();
+    const int          width   = win.x().end() - x_start;
 
-    // Handle X dimension manually to split into two loops
-    // First one will use vector operations, second one processes the left over
-    // pixels
+    // Handle X dimension manually: each row is counted at once
     win.set(Window::DimX, Window::Dimension(0, 1, 1));
 
     Iterator input(_input, win);
@@ -148,33 +91,12 @@ void NEHistogramKernel::histogram_fixed_U8(Window win)
     // Calculate local histogram
     execute_window_loop(win, [&](const Coordinates &)
     {
-        unsigned int x = x_start;
-
-        // Vector loop
-        for(; x <= x_end - 8; x += 8)
+        histogram_banked_row_u8(input.ptr() + x_start, width, local_hist, _max_range_size, [](uint8_t p)
         {
-            const uint8x8_t pixels = vld1_u8(input.ptr() + x);
-
-            ++local_hist[vget_lane_u8(pixels, 0)];
-            ++local_hist[vget_lane_u8(pixels, 1)];
-            ++local_hist[vget_lane_u8(pixels, 2)];
-            ++local_hist[vget_lane_u8(pixels, 3)];
-            ++local_hist[vget_lane_u8(pixels, 4)];
-            ++local_hist[vget_lane_u8(pixels, 5)];
-            ++local_hist[vget_lane_u8(pixels, 6)];
-            ++local_hist[vget_lane_u8(pixels, 7)];
-        }
-
-        // Process leftover pixels
-        for(; x < x_end; ++x)
-        {
-            ++local_hist[input.ptr()[x]];
-        }
+            return p;
+        });
     },
     input);
-
-    // Merge histograms
-    merge_histogram(_output->buffer(), local_hist.data(), _max_range_size);
 }
 
 void NEHistogramKernel::calculate_window_lut() const
@@ -183,25 +105,24 @@ void NEHistogramKernel::calculate_window_lut() const
     const size_t   bins   = _output->num_bins();
     const uint32_t range  = _output->range();
 
-    std::fill_n(_window_lut, offset, 0);
+    // The pixels out of the range of the distribution go to the discarded bin, right after the last one
+    std::fill_n(_window_lut, offset, bins);
 
     for(unsigned int p = offset; p < _max_range_size; ++p)
     {
-        _window_lut[p] = ((p - offset) * bins) / range;
+        _window_lut[p] = std::min<uint32_t>(((p - offset) * bins) / range, bins);
     }
 }
 
-void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *local_hist, uint32_t *window_lut)
+void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output, uint32_t *window_lut)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
-    ARM_COMPUTE_ERROR_ON(nullptr == local_hist);
     ARM_COMPUTE_ERROR_ON(nullptr == window_lut);
 
     _input      = input;
     _output     = output;
-    _local_hist = local_hist;
     _window_lut = window_lut;
 
     //Check offset
@@ -214,7 +135,8 @@ void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output,
     calculate_window_lut();
 
     // Set appropriate function
-    _func = &NEHistogramKernel::histogram_U8;
+    _func        = &NEHistogramKernel::histogram_U8;
+    _bank_stride = _output->num_bins() + 1;
 
     constexpr unsigned int num_elems_processed_per_iteration = 1;
 
@@ -228,12 +150,14 @@ void NEHistogramKernel::configure(const IImage *input, IDistribution1D *output)
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == output);
+    ARM_COMPUTE_ERROR_ON(output->num_bins() != _max_range_size);
 
     _input  = input;
     _output = output;
 
     // Set appropriate function
-    _func = &NEHistogramKernel::histogram_fixed_U8;
+    _func        = &NEHistogramKernel::histogram_fixed_U8;
+    _bank_stride = _max_range_size;
 
     constexpr unsigned int num_elems_processed_per_iteration = 1;
 
@@ -250,3 +174,26 @@ void NEHistogramKernel::run(const Window &window)
 
     (this->*_func)(window);
 }
+
+void NEHistogramKernel::begin_reduction(unsigned int num_threads)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+
+    // The local histograms keep their storage from one run to the next
+    _local_hist.resize(num_threads);
+    for(unsigned int t = 0; t < num_threads; ++t)
+    {
+        _local_hist[t].assign(num_histogram_banks * _bank_stride, 0);
+    }
+}
+
+void NEHistogramKernel::end_reduction()
+{
+    const std::vector<uint32_t> &hist = _local_hist.reduce([](std::vector<uint32_t> &dst, const std::vector<uint32_t> &src)
+    {
+        merge_histogram(dst.data(), src.data(), dst.size());
+    });
+
+    // Sum up the banks, leaving out the discarded bin
+    merge_histogram_banks(_output->buffer(), hist.data(), _bank_stride, _output->num_bins());
+}
@@ -23,6 +23,7 @@
  */
 #include "arm_compute/core/NEON/kernels/NEIm2ColKernel.h"
 
+#include "arm_compute/core/CPP/ThreadScratch.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
@@ -30,14 +31,112 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstring>
 #include <tuple>
+#include <vector>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Copy a row of a convolution kernel from the input to the output, 16 bytes at a time
+ *
+ * @param[in]  in_ptr  Pointer to the first element of the row in the input.
+ * @param[out] out_ptr Pointer to the first element of the row in the output.
+ * @param[in]  n       Number of elements to copy.
+ */
+template <typename T>
+inline void copy_kernel_row(const T *__restrict in_ptr, T *__restrict out_ptr, int n)
+{
+    constexpr int num_elems_per_copy = 16 / sizeof(T);
+
+    int x = 0;
+    for(; x <= n - num_elems_per_copy; x += num_elems_per_copy)
+    {
+        vst1q_u8(reinterpret_cast<uint8_t *>(out_ptr + x), vld1q_u8(reinterpret_cast<const uint8_t *>(in_ptr + x)));
+    }
+    for(; x < n; ++x)
+    {
+        out_ptr[x] = in_ptr[x];
+    }
+}
+
+/** Fill a part of a row of the output with the padding value
+ *
+ * @param[out] out_ptr Pointer to the first element to fill.
+ * @param[in]  n       Number of elements to fill.
+ * @param[in]  value   Padding value.
+ */
+template <typename T>
+inline void fill_kernel_row(T *out_ptr, int n, T value)
+{
+    for(int x = 0; x < n; ++x)
+    {
+        out_ptr[x] = value;
+    }
+}
+
+/** Interleave 4 rows of the input in the 4x4 interleaved layout: element k of row i is stored at k * 4 + i
+ *
+ * @param[in]  rows    Pointers to the first element of the 4 rows.
+ * @param[out] out_ptr Pointer to the first element of the output.
+ * @param[in]  n       Number of elements of each row.
+ */
+template <typename T>
+inline void interleave_rows(const T *const *rows, T *__restrict out_ptr, int n)
+{
+    for(int x = 0; x < n; ++x, out_ptr += 4)
+    {
+        out_ptr[0] = rows[0][x];
+        out_ptr[1] = rows[1][x];
+        out_ptr[2] = rows[2][x];
+        out_ptr[3] = rows[3][x];
+    }
+}
+
+template <>
+inline void interleave_rows(const float *const *rows, float *__restrict out_ptr, int n)
+{
+    int x = 0;
+    for(; x <= n - 4; x += 4, out_ptr += 16)
+    {
+        const float32x4x4_t values = { { vld1q_f32(rows[0] + x), vld1q_f32(rows[1] + x), vld1q_f32(rows[2] + x), vld1q_f32(rows[3] + x) } };
+        vst4q_f32(out_ptr, values);
+    }
+    for(; x < n; ++x, out_ptr += 4)
+    {
+        out_ptr[0] = rows[0][x];
+        out_ptr[1] = rows[1][x];
+        out_ptr[2] = rows[2][x];
+        out_ptr[3] = rows[3][x];
+    }
+}
+
+template <>
+inline void interleave_rows(const uint8_t *const *rows, uint8_t *__restrict out_ptr, int n)
+{
+    int x = 0;
+    for(; x <= n - 16; x += 16, out_ptr += 64)
+    {
+        const uint8x16x4_t values = { { vld1q_u8(rows[0] + x), vld1q_u8(rows[1] + x), vld1q_u8(rows[2] + x), vld1q_u8(rows[3] + x) } };
+        vst4q_u8(out_ptr, values);
+    }
+    for(; x < n; ++x, out_ptr += 4)
+    {
+        out_ptr[0] = rows[0][x];
+        out_ptr[1] = rows[1][x];
+        out_ptr[2] = rows[2][x];
+        out_ptr[3] = rows[3][x];
+    }
+}
+} // namespace
+
+template <typename T, int kernel_size, int stride>
 void NEIm2ColKernel::run_generic(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -56,6 +155,14 @@ void NEIm2ColKernel::run_generic(const Window &window)
     int stride_y = 0;
     std::tie(pad_x, pad_y)       = _conv_info.pad();
     std::tie(stride_x, stride_y) = _conv_info.stride();
+    stride_x                     = (stride != 0) ? stride : stride_x;
+    stride_y                     = (stride != 0) ? stride : stride_y;
+
+    // The loops over the kernel are fully unrolled when the kernel size is a template parameter
+    const int ksize = (kernel_size != 0) ? kernel_size : static_cast<int>(_kernel_size);
+
+    // The padding holds the value 0: the offset of the quantized tensors represents the real value 0
+    const T pad_value = static_cast<T>(_input->info()->quantization_info().offset);
 
     // Setup input window
     const int start_x = -pad_x;
@@ -84,22 +191,45 @@ void NEIm2ColKernel::run_generic(const Window &window)
 
         // Get pointers
         const uint8_t *const input_ptr  = in.ptr();
-        auto                 output_ptr = reinterpret_cast<float *>(out.ptr());
+        auto                 output_ptr = reinterpret_cast<T *>(out.ptr());
 
-        // Linearize volume
-        for(int d = 0; d < kernel_depth; ++d)
+        // The rows of the kernel are contiguous in the input, so they are copied as a whole.
+        // For a stride of 1 the patches of consecutive iterations overlap and read the same input rows, which are still in the cache.
+        if(top_left_x >= 0 && top_left_y >= 0 && top_left_x + ksize <= input_w && top_left_y + ksize <= input_h)
+        {
+            // Interior patch: no padding
+            for(int d = 0; d < kernel_depth; ++d)
+            {
+                const uint8_t *row_ptr = input_ptr + d * input_stride_z + top_left_y * input_stride_y + top_left_x * input_stride_x;
+
+                for(int y = 0; y < ksize; ++y, row_ptr += input_stride_y, output_ptr += ksize)
+                {
+                    copy_kernel_row(reinterpret_cast<const T *>(row_ptr), output_ptr, ksize);
+                }
+            }
+        }
+        else
         {
-            for(int y = top_left_y, y_e = top_left_y + static_cast<int>(_kernel_size); y < y_e; ++y)
+            // Border patch: only the part of each row which is inside the input is copied
+            const int x_start = std::max(top_left_x, 0);
+            const int x_end   = std::min(top_left_x + ksize, input_w);
+            const int left    = std::min(x_start - top_left_x, ksize);
+            const int middle  = std::max(x_end - x_start, 0);
+            const int right   = ksize - left - middle;
+
+            for(int d = 0; d < kernel_depth; ++d)
             {
-                for(int x = top_left_x, x_e = top_left_x + static_cast<int>(_kernel_size); x < x_e; ++x, ++output_ptr)
+                for(int y = top_left_y, y_e = top_left_y + ksize; y < y_e; ++y, output_ptr += ksize)
                 {
-                    if(x < 0 || x >= input_w || y < 0 || y >= input_h)
+                    if(y < 0 || y >= input_h || middle == 0)
                     {
-                        *output_ptr = 0.f;
+                        fill_kernel_row(output_ptr, ksize, pad_value);
                     }
                     else
                     {
-                        *output_ptr = *(reinterpret_cast<const float *>(input_ptr + (d * input_stride_z + y * input_stride_y + x * input_stride_x)));
+                        fill_kernel_row(output_ptr, left, pad_value);
+                        copy_kernel_row(reinterpret_cast<const T *>(input_ptr + d * input_stride_z + y * input_stride_y + x_start * input_stride_x), output_ptr + left, middle);
+                        fill_kernel_row(output_ptr + left + middle, right, pad_value);
                     }
                 }
             }
@@ -114,6 +244,251 @@ void NEIm2ColKernel::run_generic(const Window &window)
     in, out);
 }
 
+template <typename T, int kernel_size, int stride>
+void NEIm2ColKernel::run_interleaved(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    // Each group of convolution is written in its own plane of the output and only reads its share of the input feature maps
+    const int kernel_depth   = _input->info()->dimension(2) / _output->info()->dimension(2);
+    const int input_w        = _input->info()->dimension(0);
+    const int input_h        = _input->info()->dimension(1);
+    const int input_stride_x = _input->info()->strides_in_bytes().x();
+    const int input_stride_y = _input->info()->strides_in_bytes().y();
+    const int input_stride_z = _input->info()->strides_in_bytes().z();
+    const int num_patches    = _convolved_dims.first * _convolved_dims.second;
+
+    int pad_x    = 0;
+    int pad_y    = 0;
+    int stride_x = 0;
+    int stride_y = 0;
+    std::tie(pad_x, pad_y)       = _conv_info.pad();
+    std::tie(stride_x, stride_y) = _conv_info.stride();
+    stride_x                     = (stride != 0) ? stride : stride_x;
+    stride_y                     = (stride != 0) ? stride : stride_y;
+
+    // The loops over the kernel are fully unrolled when the kernel size is a template parameter
+    const int ksize = (kernel_size != 0) ? kernel_size : static_cast<int>(_kernel_size);
+
+    // The padding holds the value 0: the offset of the quantized tensors represents the real value 0
+    const T pad_value = static_cast<T>(_input->info()->quantization_info().offset);
+
+    Window window_in(window);
+    // The first three dimensions of the input are increased by the inner loops
+    window_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    window_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+    window_in.set(Window::DimZ, Window::Dimension(0, 0, 0));
+
+    // Each iteration writes one row of the output, which interleaves 4 consecutive patches
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    // Create iterators
+    Iterator in(_input, window_in);
+    Iterator out(_output, window_out);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const input_ptr  = in.ptr() + id.z() * kernel_depth * input_stride_z;
+        auto                 output_ptr = reinterpret_cast<T *>(out.ptr());
+
+        // Top left corner of the 4 patches, the missing patches of the last row are entirely out of the input
+        int  top_left_x[4];
+        int  top_left_y[4];
+        bool is_patch_valid[4];
+        for(int i = 0; i < 4; ++i)
+        {
+            const int patch   = id.y() * 4 + i;
+            is_patch_valid[i] = patch < num_patches;
+            top_left_x[i]     = is_patch_valid[i] ? (patch % _convolved_dims.first) * stride_x - pad_x : -ksize;
+            top_left_y[i]     = is_patch_valid[i] ? (patch / _convolved_dims.first) * stride_y - pad_y : -ksize;
+        }
+
+        bool is_interior = true;
+        for(int i = 0; i < 4; ++i)
+        {
+            is_interior = is_interior && top_left_x[i] >= 0 && top_left_y[i] >= 0 && top_left_x[i] + ksize <= input_w && top_left_y[i] + ksize <= input_h;
+        }
+
+        // Linearize the 4 volumes, element k of patch i is stored at k * 4 + i
+        if(is_interior)
+        {
+            // No padding: gather the rows of the 4 patches without any bounds check
+            const uint8_t *patch_ptr[4];
+            for(int i = 0; i < 4; ++i)
+            {
+                patch_ptr[i] = input_ptr + top_left_y[i] * input_stride_y + top_left_x[i] * input_stride_x;
+            }
+
+            for(int d = 0; d < kernel_depth; ++d)
+            {
+                for(int ky = 0; ky < ksize; ++ky)
+                {
+                    const int row_offset = d * input_stride_z + ky * input_stride_y;
+
+                    const T *row0 = reinterpret_cast<const T *>(patch_ptr[0] + row_offset);
+                    const T *row1 = reinterpret_cast<const T *>(patch_ptr[1] + row_offset);
+                    const T *row2 = reinterpret_cast<const T *>(patch_ptr[2] + row_offset);
+                    const T *row3 = reinterpret_cast<const T *>(patch_ptr[3] + row_offset);
+
+                    for(int kx = 0; kx < ksize; ++kx, output_ptr += 4)
+                    {
+                        output_ptr[0] = row0[kx];
+                        output_ptr[1] = row1[kx];
+                        output_ptr[2] = row2[kx];
+                        output_ptr[3] = row3[kx];
+                    }
+                }
+            }
+        }
+        else
+        {
+            for(int d = 0; d < kernel_depth; ++d)
+            {
+                for(int ky = 0; ky < ksize; ++ky)
+                {
+                    for(int kx = 0; kx < ksize; ++kx, output_ptr += 4)
+                    {
+                        for(int i = 0; i < 4; ++i)
+                        {
+                            const int x = top_left_x[i] + kx;
+                            const int y = top_left_y[i] + ky;
+
+                            if(x < 0 || x >= input_w || y < 0 || y >= input_h)
+                            {
+                                output_ptr[i] = pad_value;
+                            }
+                            else
+                            {
+                                output_ptr[i] = *(reinterpret_cast<const T *>(input_ptr + (d * input_stride_z + y * input_stride_y + x * input_stride_x)));
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        // Add bias
+        if(_has_bias)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                output_ptr[i] = is_patch_valid[i] ? 1.f : 0.f;
+            }
+        }
+    },
+    in, out);
+}
+
+template <typename T>
+void NEIm2ColKernel::run_interleaved_nhwc(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    // The channels of an input element are contiguous: each element of the kernel is a run of kernel_depth consecutive values of every patch
+    const int kernel_depth   = _input->info()->dimension(0) / _output->info()->dimension(2);
+    const int input_w        = _input->info()->dimension(1);
+    const int input_h        = _input->info()->dimension(2);
+    const int input_stride_w = _input->info()->strides_in_bytes()[1];
+    const int input_stride_h = _input->info()->strides_in_bytes()[2];
+    const int input_stride_n = _input->info()->strides_in_bytes()[3];
+    const int num_patches    = _convolved_dims.first * _convolved_dims.second;
+    const int ksize          = _kernel_size;
+
+    int pad_x    = 0;
+    int pad_y    = 0;
+    int stride_x = 0;
+    int stride_y = 0;
+    std::tie(pad_x, pad_y)       = _conv_info.pad();
+    std::tie(stride_x, stride_y) = _conv_info.stride();
+
+    // The elements of the kernel in the padding read a run of padding values
+    T *const pad_row = thread_scratch<T>(kernel_depth);
+    std::fill_n(pad_row, kernel_depth, static_cast<T>(_input->info()->quantization_info().offset));
+
+    const uint8_t *const input_base = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+
+    // Each iteration writes one row of the output, which interleaves 4 consecutive patches
+    Window window_out(window);
+    window_out.set(Window::DimX, Window::Dimension(0, 1, 1));
+    Iterator out(_output, window_out);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const input_ptr  = input_base + id.z() * kernel_depth * _input->info()->element_size() + id[3] * input_stride_n;
+        auto                 output_ptr = reinterpret_cast<T *>(out.ptr());
+
+        // Top left corner of the 4 patches, the missing patches of the last row are entirely out of the input
+        int  top_left_x[4];
+        int  top_left_y[4];
+        bool is_patch_valid[4];
+        for(int i = 0; i < 4; ++i)
+        {
+            const int patch   = id.y() * 4 + i;
+            is_patch_valid[i] = patch < num_patches;
+            top_left_x[i]     = is_patch_valid[i] ? (patch % _convolved_dims.first) * stride_x - pad_x : -ksize;
+            top_left_y[i]     = is_patch_valid[i] ? (patch / _convolved_dims.first) * stride_y - pad_y : -ksize;
+        }
+
+        // Element k of patch i is stored at k * 4 + i, in the order (ky, kx, channel) of the weights [IFM, kernel_x, kernel_y, OFM]
+        for(int ky = 0; ky < ksize; ++ky)
+        {
+            for(int kx = 0; kx < ksize; ++kx, output_ptr += 4 * kernel_depth)
+            {
+                const T *rows[4];
+                for(int i = 0; i < 4; ++i)
+                {
+                    const int x = top_left_x[i] + kx;
+                    const int y = top_left_y[i] + ky;
+                    rows[i]     = (x < 0 || x >= input_w || y < 0 || y >= input_h) ? pad_row : reinterpret_cast<const T *>(input_ptr + y * input_stride_h + x * input_stride_w);
+                }
+                interleave_rows(rows, output_ptr, kernel_depth);
+            }
+        }
+
+        // Add bias
+        if(_has_bias)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                output_ptr[i] = is_patch_valid[i] ? 1.f : 0.f;
+            }
+        }
+    },
+    out);
+}
+
+template <typename T>
+NEIm2ColKernel::Im2ColFunctionPtr NEIm2ColKernel::select_function(bool interleave, unsigned int kernel_size, unsigned int stride_x, unsigned int stride_y)
+{
+#ifdef ARM_COMPUTE_FIXED_SHAPE_KERNELS
+    // Convolutions of AlexNet which run on the matrix multiplication
+    if(stride_x == stride_y)
+    {
+        if(kernel_size == 11 && stride_x == 4)
+        {
+            return interleave ? &NEIm2ColKernel::run_interleaved<T, 11, 4> : &NEIm2ColKernel::run_generic<T, 11, 4>;
+        }
+        if(kernel_size == 5 && stride_x == 1)
+        {
+            return interleave ? &NEIm2ColKernel::run_interleaved<T, 5, 1> : &NEIm2ColKernel::run_generic<T, 5, 1>;
+        }
+        if(kernel_size == 3 && stride_x == 1)
+        {
+            return interleave ? &NEIm2ColKernel::run_interleaved<T, 3, 1> : &NEIm2ColKernel::run_generic<T, 3, 1>;
+        }
+    }
+#else  /* ARM_COMPUTE_FIXED_SHAPE_KERNELS */
+    ARM_COMPUTE_UNUSED(kernel_size);
+    ARM_COMPUTE_UNUSED(stride_x);
+    ARM_COMPUTE_UNUSED(stride_y);
+#endif /* ARM_COMPUTE_FIXED_SHAPE_KERNELS */
+
+    return interleave ? &NEIm2ColKernel::run_interleaved<T, 0, 0> : &NEIm2ColKernel::run_generic<T, 0, 0>;
+}
+
 void NEIm2ColKernel::run_reduced(const Window &window)
 {
     const size_t in_width   = _input->info()->dimension(0);
@@ -148,7 +523,17 @@ void NEIm2ColKernel::run_reduced(const Window &window)
         // Add bias
         if(_has_bias)
         {
-            *(reinterpret_cast<float *>(out_ptr) + out_width - 1) = 1.0f;
+            switch(_input->info()->data_type())
+            {
+                case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                    *(reinterpret_cast<float16_t *>(out_ptr) + out_width - 1) = 1.0f;
+                    break;
+#endif
+                default:
+                    *(reinterpret_cast<float *>(out_ptr) + out_width - 1) = 1.0f;
+                    break;
+            }
         }
     }
     while(in_window.slide_window_slice_3D(in_slice) && out_window.slide_window_slice_1D(out_slice));
@@ -159,23 +544,30 @@ NEIm2ColKernel::NEIm2ColKernel()
 {
 }
 
-void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const PadStrideInfo &conv_info, bool has_bias)
+void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, std::pair<unsigned int, unsigned int> convolved_dims, const PadStrideInfo &conv_info, bool has_bias,
+                               bool interleave)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MSG(has_bias && (input->info()->data_type() == DataType::U8), "The biases of a quantized convolution are added by the matrix multiplication");
 
     _input          = input;
     _output         = output;
     _convolved_dims = convolved_dims;
     _conv_info      = conv_info;
-    _kernel_size    = std::sqrt((output->info()->dimension(0) - (has_bias ? 1 : 0)) / input->info()->dimension(2));
     _has_bias       = has_bias;
 
+    const bool   is_nhwc     = (input->info()->data_layout() == DataLayout::NHWC);
+    const size_t num_ifm     = input->info()->dimension(get_data_layout_dimension_index(input->info()->data_layout(), DataLayoutDimension::CHANNEL));
+    _kernel_size             = std::sqrt((output->info()->dimension(0) / (interleave ? 4 : 1) - (has_bias ? 1 : 0)) / (num_ifm / (interleave ? output->info()->dimension(2) : 1)));
+    ARM_COMPUTE_ERROR_ON_MSG(is_nhwc && !interleave, "NHWC inputs are only supported by the interleaved im2col");
+
     unsigned int pad_x, pad_y, stride_x, stride_y = 0;
     std::tie(pad_x, pad_y)       = conv_info.pad();
     std::tie(stride_x, stride_y) = conv_info.stride();
 
-    bool run_img2col_reduced = (output->info()->dimension(0) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2))) && (TensorShape::num_max_dimensions >= 4)
+    bool run_img2col_reduced = !is_nhwc && !interleave && (output->info()->dimension(0) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2))) && (TensorShape::num_max_dimensions >= 4)
                                && (std::equal(input->info()->tensor_shape().cbegin() + 3,
                                               input->info()->tensor_shape().cend(),
                                               output->info()->tensor_shape().cbegin() + 1))
@@ -187,9 +579,77 @@ void NEIm2ColKernel::configure(const ITensor *input, ITensor *output, std::pair<
     {
         _func = &NEIm2ColKernel::run_reduced;
     }
+    else if(is_nhwc)
+    {
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != std::ceil(_convolved_dims.first * _convolved_dims.second / 4.0f));
+        ARM_COMPUTE_ERROR_ON((num_ifm % output->info()->dimension(2)) != 0);
+
+        switch(input->info()->data_type())
+        {
+            case DataType::U8:
+                _func = &NEIm2ColKernel::run_interleaved_nhwc<uint8_t>;
+                break;
+            case DataType::F32:
+                _func = &NEIm2ColKernel::run_interleaved_nhwc<float>;
+                break;
+            case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                _func = &NEIm2ColKernel::run_interleaved_nhwc<float16_t>;
+                break;
+#endif
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+        }
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+        window.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+        window.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), 1));
+    }
+    else if(interleave)
+    {
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != std::ceil(_convolved_dims.first * _convolved_dims.second / 4.0f));
+        ARM_COMPUTE_ERROR_ON((input->info()->dimension(2) % output->info()->dimension(2)) != 0);
+
+        switch(input->info()->data_type())
+        {
+            case DataType::U8:
+                _func = select_function<uint8_t>(true, _kernel_size, stride_x, stride_y);
+                break;
+            case DataType::F32:
+                _func = select_function<float>(true, _kernel_size, stride_x, stride_y);
+                break;
+            case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                _func = select_function<float16_t>(true, _kernel_size, stride_x, stride_y);
+                break;
+#endif
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+        }
+        window.set(Window::DimX, Window::Dimension(0, 1, 1));
+        window.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+        window.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), 1));
+    }
     else
     {
-        _func = &NEIm2ColKernel::run_generic;
+        switch(input->info()->data_type())
+        {
+            case DataType::U8:
+                _func = select_function<uint8_t>(false, _kernel_size, stride_x, stride_y);
+                break;
+            case DataType::F32:
+                _func = select_function<float>(false, _kernel_size, stride_x, stride_y);
+                break;
+            case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+                _func = select_function<float16_t>(false, _kernel_size, stride_x, stride_y);
+                break;
+#endif
+            default:
+                ARM_COMPUTE_ERROR("Data type not supported");
+                break;
+        }
         window.set(Window::DimX, Window::Dimension(0, _convolved_dims.first, 1));
         window.set(Window::DimY, Window::Dimension(0, _convolved_dims.second, 1));
         window.set(Window::DimZ, Window::Dimension(0, 1, 1));
@@ -208,3 +668,8 @@ void NEIm2ColKernel::run(const Window &window)
 
     (this->*_func)(window);
 }
+
+SchedulingPolicy NEIm2ColKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
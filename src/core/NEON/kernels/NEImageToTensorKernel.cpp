@@ -0,0 +1,251 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEImageToTensorKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/IMultiImage.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/MultiImageInfo.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr float red_coef_bt709    = 1.5748F;
+constexpr float green_coef_bt709  = -0.1873f;
+constexpr float green_coef2_bt709 = -0.4681f;
+constexpr float blue_coef_bt709   = 1.8556f;
+
+constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+/** Left and right samples of a source coordinate, replicating the borders, and weight of the right one */
+inline void bilinear_samples(float coord, int size, int32_t &left, int32_t &right, float &weight)
+{
+    const float coord_floor = std::floor(coord);
+    const int   index       = static_cast<int>(coord_floor);
+
+    left   = std::min(std::max(index, 0), size - 1);
+    right  = std::min(std::max(index + 1, 0), size - 1);
+    weight = coord - coord_floor;
+}
+
+/** Load the samples of 4 output pixels */
+inline float32x4_t gather_u8(const uint8_t *row, const int32_t *offsets)
+{
+    const float samples[num_elems_processed_per_iteration] =
+    {
+        static_cast<float>(row[offsets[0]]),
+        static_cast<float>(row[offsets[1]]),
+        static_cast<float>(row[offsets[2]]),
+        static_cast<float>(row[offsets[3]])
+    };
+
+    return vld1q_f32(samples);
+}
+
+/** Convert 4 YUV samples to RGB clamped to [0, 255] */
+inline float32x4x3_t yuv_to_rgb(const float32x4_t &y, float32x4_t u, float32x4_t v)
+{
+    const float32x4_t c128 = vdupq_n_f32(128.f);
+    const float32x4_t zero = vdupq_n_f32(0.f);
+    const float32x4_t max  = vdupq_n_f32(255.f);
+
+    u = vsubq_f32(u, c128);
+    v = vsubq_f32(v, c128);
+
+    const float32x4_t red   = vmlaq_n_f32(y, v, red_coef_bt709);
+    const float32x4_t green = vmlaq_n_f32(vmlaq_n_f32(y, u, green_coef_bt709), v, green_coef2_bt709);
+    const float32x4_t blue  = vmlaq_n_f32(y, u, blue_coef_bt709);
+
+    const float32x4x3_t rgb =
+    {
+        {
+            vminq_f32(vmaxq_f32(red, zero), max),
+            vminq_f32(vmaxq_f32(green, zero), max),
+            vminq_f32(vmaxq_f32(blue, zero), max)
+        }
+    };
+
+    return rgb;
+}
+
+/** Interpolate linearly between a and b */
+inline float32x4_t lerp(const float32x4_t &a, const float32x4_t &b, const float32x4_t &weight)
+{
+    return vmlaq_f32(a, vsubq_f32(b, a), weight);
+}
+} // namespace
+
+NEImageToTensorKernel::NEImageToTensorKernel()
+    : _input(nullptr), _output(nullptr), _mean(), _scale(1.f), _ratio_y(1.f), _subsampled(false), _y_offsets(), _u_offsets(), _v_offsets(), _dx()
+{
+}
+
+void NEImageToTensorKernel::configure(const IMultiImage *input, ITensor *output, const std::array<float, 3> &mean, float scale)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() != 3);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 3);
+
+    const Format format = input->info()->format();
+
+    _input      = input;
+    _output     = output;
+    _mean       = mean;
+    _scale      = scale;
+    _subsampled = format != Format::YUV444;
+
+    ARM_COMPUTE_ERROR_ON_MSG(format != Format::NV12 && format != Format::NV21 && format != Format::IYUV && format != Format::YUV444, "Not supported");
+
+    const int input_width  = input->info()->width();
+    const int input_height = input->info()->height();
+    const int num_cols     = ceil_to_multiple(output->info()->dimension(0), num_elems_processed_per_iteration);
+
+    /* Compute the ratio between source width/height and destination width/height */
+    const auto ratio_x = static_cast<float>(input_width) / static_cast<float>(output->info()->dimension(0));
+    _ratio_y           = static_cast<float>(input_height) / static_cast<float>(output->info()->dimension(1));
+
+    _y_offsets.resize(2 * num_cols);
+    _u_offsets.resize(2 * num_cols);
+    _v_offsets.resize(2 * num_cols);
+    _dx.resize(num_cols);
+
+    // Precompute the samples of each output column: the columns added to process whole vectors sample the last one again
+    for(int x = 0; x < num_cols; ++x)
+    {
+        const int   out_x = std::min<int>(x, output->info()->dimension(0) - 1);
+        const float in_x  = (out_x + 0.5f) * ratio_x - 0.5f;
+
+        int32_t samples[2];
+        bilinear_samples(in_x, input_width, samples[0], samples[1], _dx[x]);
+
+        for(int s = 0; s < 2; ++s)
+        {
+            const int32_t luma_x = samples[s];
+            int32_t       u_x    = luma_x;
+            int32_t       v_x    = luma_x;
+
+            switch(format)
+            {
+                case Format::NV12:
+                    u_x = (luma_x / 2) * 2;
+                    v_x = u_x + 1;
+                    break;
+                case Format::NV21:
+                    v_x = (luma_x / 2) * 2;
+                    u_x = v_x + 1;
+                    break;
+                case Format::IYUV:
+                    u_x = luma_x / 2;
+                    v_x = u_x;
+                    break;
+                default:
+                    break;
+            }
+
+            _y_offsets[s * num_cols + x] = luma_x;
+            _u_offsets[s * num_cols + x] = u_x;
+            _v_offsets[s * num_cols + x] = v_x;
+        }
+    }
+
+    // Configure kernel window: each iteration writes the three planes
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, output_access);
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEImageToTensorKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const IImage *luma     = _input->plane(0);
+    const IImage *u_plane  = _input->plane(1);
+    const IImage *v_plane  = (_input->info()->format() == Format::NV12 || _input->info()->format() == Format::NV21) ? _input->plane(1) : _input->plane(2);
+    const size_t  stride_z = _output->info()->strides_in_bytes()[2];
+    const int     num_cols = _dx.size();
+    const int     height   = _input->info()->height();
+
+    const float32x4_t mean[3] = { vdupq_n_f32(_mean[0]), vdupq_n_f32(_mean[1]), vdupq_n_f32(_mean[2]) };
+
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        int32_t top    = 0;
+        int32_t bottom = 0;
+        float   dy     = 0.f;
+        bilinear_samples((id.y() + 0.5f) * _ratio_y - 0.5f, height, top, bottom, dy);
+
+        const int32_t chroma_top    = _subsampled ? top / 2 : top;
+        const int32_t chroma_bottom = _subsampled ? bottom / 2 : bottom;
+
+        const uint8_t *const y_rows[2] = { luma->ptr_to_element(Coordinates(0, top)), luma->ptr_to_element(Coordinates(0, bottom)) };
+        const uint8_t *const u_rows[2] = { u_plane->ptr_to_element(Coordinates(0, chroma_top)), u_plane->ptr_to_element(Coordinates(0, chroma_bottom)) };
+        const uint8_t *const v_rows[2] = { v_plane->ptr_to_element(Coordinates(0, chroma_top)), v_plane->ptr_to_element(Coordinates(0, chroma_bottom)) };
+
+        // RGB of the top-left, top-right, bottom-left and bottom-right samples
+        float32x4x3_t rgb[2][2];
+
+        for(int r = 0; r < 2; ++r)
+        {
+            for(int s = 0; s < 2; ++s)
+            {
+                const int offset = s * num_cols + id.x();
+                rgb[r][s]        = yuv_to_rgb(gather_u8(y_rows[r], &_y_offsets[offset]), gather_u8(u_rows[r], &_u_offsets[offset]), gather_u8(v_rows[r], &_v_offsets[offset]));
+            }
+        }
+
+        const float32x4_t dx_vec = vld1q_f32(&_dx[id.x()]);
+        const float32x4_t dy_vec = vdupq_n_f32(dy);
+
+        for(int c = 0; c < 3; ++c)
+        {
+            const float32x4_t value = lerp(lerp(rgb[0][0].val[c], rgb[0][1].val[c], dx_vec), lerp(rgb[1][0].val[c], rgb[1][1].val[c], dx_vec), dy_vec);
+
+            vst1q_f32(reinterpret_cast<float *>(output.ptr() + c * stride_z), vmulq_n_f32(vsubq_f32(value, mean[c]), _scale));
+        }
+    },
+    output);
+}
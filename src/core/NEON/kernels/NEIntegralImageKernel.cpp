@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -35,7 +36,28 @@
 
 using namespace arm_compute;
 
-void NEIntegralImageKernel::configure(const ITensor *input, ITensor *output)
+namespace
+{
+/** Compute the inclusive prefix sum of 8 values
+ *
+ * @param[in] values Values to sum, small enough for the sum of all of them to fit in 16 bits.
+ *
+ * @return The prefix sum: lane i contains the sum of the lanes 0 to i of @p values
+ */
+inline uint16x8_t prefix_sum_u16(uint16x8_t values)
+{
+    const uint16x8_t zero = vdupq_n_u16(0);
+
+    // Add the values shifted by 1, 2 and 4 lanes
+    values = vaddq_u16(values, vextq_u16(zero, values, 7));
+    values = vaddq_u16(values, vextq_u16(zero, values, 6));
+    values = vaddq_u16(values, vextq_u16(zero, values, 4));
+
+    return values;
+}
+} // namespace
+
+void NEIntegralImageHorKernel::configure(const ITensor *input, ITensor *output)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
@@ -45,81 +67,95 @@ void NEIntegralImageKernel::configure(const ITensor *input, ITensor *output)
     INESimpleKernel::configure(input, output, num_elems_processed_per_iteration);
 }
 
-BorderSize NEIntegralImageKernel::border_size() const
+BorderSize NEIntegralImageHorKernel::border_size() const
+{
+    return BorderSize(0, 0, 0, 1);
+}
+
+void NEIntegralImageHorKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8x16_t input_pixels = vld1q_u8(input.ptr());
+
+        // Prefix sum of each half, then add the total of the low half to the high half: at most 16 * 255 so it fits in 16 bits
+        const uint16x8_t sum_low  = prefix_sum_u16(vmovl_u8(vget_low_u8(input_pixels)));
+        const uint16x8_t sum_high = vaddq_u16(prefix_sum_u16(vmovl_u8(vget_high_u8(input_pixels))), vdupq_n_u16(vgetq_lane_u16(sum_low, 7)));
+
+        // Add the sum of the row up to the previous pixel: the border on the left is 0
+        const auto       outptr = reinterpret_cast<uint32_t *>(output.ptr());
+        const uint32x4_t carry  = vdupq_n_u32(outptr[-1]);
+
+        vst1q_u32(outptr, vaddw_u16(carry, vget_low_u16(sum_low)));
+        vst1q_u32(outptr + 4, vaddw_u16(carry, vget_high_u16(sum_low)));
+        vst1q_u32(outptr + 8, vaddw_u16(carry, vget_low_u16(sum_high)));
+        vst1q_u32(outptr + 12, vaddw_u16(carry, vget_high_u16(sum_high)));
+    },
+    input, output);
+}
+
+NEIntegralImageVertKernel::NEIntegralImageVertKernel()
+    : _output(nullptr)
+{
+}
+
+void NEIntegralImageVertKernel::configure(ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U32);
+
+    _output = output;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    // Each row is read from the row above, the border on the top is 0
+    AccessWindowRectangle output_access(output->info(), 0, -1, num_elems_processed_per_iteration, 2);
+
+    update_window_and_padding(win, output_access);
+
+    output_access.set_valid_region(win, output->info()->valid_region());
+
+    INEKernel::configure(win);
+}
+
+BorderSize NEIntegralImageVertKernel::border_size() const
 {
-    return BorderSize(1, 0, 0, 1);
+    return BorderSize(1, 0, 0, 0);
 }
 
-bool NEIntegralImageKernel::is_parallelisable() const
+bool NEIntegralImageVertKernel::is_split_dimension_collapsible() const
 {
+    // Each row is added to the row above, so the rows of a column must all be run in order by the same thread
     return false;
 }
 
-void NEIntegralImageKernel::run(const Window &window)
+void NEIntegralImageVertKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
-    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    Iterator input(_input, window);
     Iterator output(_output, window);
 
-    const auto output_top_left = reinterpret_cast<const uint32_t *>(_output->ptr_to_element(Coordinates(-1, -1)));
-    const auto output_top_mid  = reinterpret_cast<const uint32_t *>(_output->ptr_to_element(Coordinates(0, -1)));
+    const size_t stride = _output->info()->strides_in_bytes()[1] / sizeof(uint32_t);
 
+    // The rows are visited in order, so each row is added to the row above once it is complete
     execute_window_loop(window, [&](const Coordinates & id)
     {
-        const uint8x16_t input_pixels = vld1q_u8(input.ptr());
+        const auto            outptr = reinterpret_cast<uint32_t *>(output.ptr());
+        const uint32_t *const top    = outptr - stride;
 
-        const uint16x8x2_t tmp =
-        {
-            {
-                vmovl_u8(vget_low_u8(input_pixels)),
-                vmovl_u8(vget_high_u8(input_pixels))
-            }
-        };
-
-        uint32x4x4_t pixels =
-        {
-            {
-                vmovl_u16(vget_low_u16(tmp.val[0])),
-                vmovl_u16(vget_high_u16(tmp.val[0])),
-                vmovl_u16(vget_low_u16(tmp.val[1])),
-                vmovl_u16(vget_high_u16(tmp.val[1]))
-            }
-        };
-
-        // Divide by four as pointer is now uint32 instead of uint8!
-        const size_t off = output.offset() / 4;
-
-        // Add top mid pixel values
-        const uint32_t *const top_mid_ptr = output_top_mid + off;
-
-        pixels.val[0] = vaddq_u32(vld1q_u32(top_mid_ptr), pixels.val[0]);
-        pixels.val[1] = vaddq_u32(vld1q_u32(top_mid_ptr + 4), pixels.val[1]);
-        pixels.val[2] = vaddq_u32(vld1q_u32(top_mid_ptr + 8), pixels.val[2]);
-        pixels.val[3] = vaddq_u32(vld1q_u32(top_mid_ptr + 12), pixels.val[3]);
-
-        // Subtract top left diagonal values
-        const auto            outptr       = reinterpret_cast<uint32_t *>(output.ptr());
-        const uint32_t *const top_left_ptr = output_top_left + off;
-
-        pixels.val[0] = vsubq_u32(pixels.val[0], vld1q_u32(top_left_ptr));
-        vst1q_u32(outptr, pixels.val[0]);
-
-        pixels.val[1] = vsubq_u32(pixels.val[1], vld1q_u32(top_left_ptr + 4));
-        vst1q_u32(outptr + 4, pixels.val[1]);
-
-        pixels.val[2] = vsubq_u32(pixels.val[2], vld1q_u32(top_left_ptr + 8));
-        vst1q_u32(outptr + 8, pixels.val[2]);
-
-        pixels.val[3] = vsubq_u32(pixels.val[3], vld1q_u32(top_left_ptr + 12));
-        vst1q_u32(outptr + 12, pixels.val[3]);
-
-        // Perform prefix summation
-        for(auto i = 0; i < 16; ++i)
-        {
-            outptr[i] += outptr[i - 1];
-        }
+        vst1q_u32(outptr, vaddq_u32(vld1q_u32(outptr), vld1q_u32(top)));
+        vst1q_u32(outptr + 4, vaddq_u32(vld1q_u32(outptr + 4), vld1q_u32(top + 4)));
+        vst1q_u32(outptr + 8, vaddq_u32(vld1q_u32(outptr + 8), vld1q_u32(top + 8)));
+        vst1q_u32(outptr + 12, vaddq_u32(vld1q_u32(outptr + 12), vld1q_u32(top + 12)));
     },
-    input, output);
+    output);
 }
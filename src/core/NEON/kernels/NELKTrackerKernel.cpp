@@ -32,6 +32,7 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cmath>
 
@@ -86,6 +87,40 @@ inline int32x4_t compute_bilinear_interpolation(int16x8_t top_row, int16x8_t bot
     // Apply the bilinear filter
     return vqrshlq_s32(vmull_s16(px00, w00) + vmull_s16(px01, w01) + vmull_s16(px10, w10) + vmull_s16(px11, w11), shift);
 }
+
+inline int16x8_t scharr_y(const int16x8x2_t &top, const int16x8x2_t &bottom)
+{
+    const int16x8_t three       = vdupq_n_s16(3);
+    const int16x8_t minus_three = vdupq_n_s16(-3);
+    const int16x8_t ten         = vdupq_n_s16(10);
+
+    // Top row
+    int16x8_t out = vmulq_s16(vaddq_s16(top.val[0], vextq_s16(top.val[0], top.val[1], 2)), minus_three);
+    out           = vmlsq_s16(out, vextq_s16(top.val[0], top.val[1], 1), ten);
+
+    // Bottom row
+    out = vmlaq_s16(out, vaddq_s16(bottom.val[0], vextq_s16(bottom.val[0], bottom.val[1], 2)), three);
+    out = vmlaq_s16(out, vextq_s16(bottom.val[0], bottom.val[1], 1), ten);
+
+    return out;
+}
+
+inline int16x8_t scharr_x(const int16x8x2_t &top, const int16x8x2_t &middle, const int16x8x2_t &bottom)
+{
+    const int16x8_t three       = vdupq_n_s16(3);
+    const int16x8_t minus_three = vdupq_n_s16(-3);
+    const int16x8_t ten         = vdupq_n_s16(10);
+
+    // Left column
+    int16x8_t out = vmulq_s16(vaddq_s16(top.val[0], bottom.val[0]), minus_three);
+    out           = vmlsq_s16(out, middle.val[0], ten);
+
+    // Right column
+    out = vmlaq_s16(out, vaddq_s16(vextq_s16(top.val[0], top.val[1], 2), vextq_s16(bottom.val[0], bottom.val[1], 2)), three);
+    out = vmlaq_s16(out, vextq_s16(middle.val[0], middle.val[1], 2), ten);
+
+    return out;
+}
 } // namespace
 
 void NELKTrackerKernel::init_keypoints(int start, int end)
@@ -130,7 +165,51 @@ void NELKTrackerKernel::init_keypoints(int start, int end)
     }
 }
 
-std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, int *bilinear_ix, int *bilinear_iy)
+void NELKTrackerKernel::compute_scharr_patch(const NELKInternalKeypoint &keypoint, int16_t *patch_gx, int16_t *patch_gy)
+{
+    // One extra row and column of gradients is needed by the bilinear interpolation
+    const Coordinates top_left_window_corner(static_cast<int>(keypoint.x) - _window_dimension / 2 - 1, static_cast<int>(keypoint.y) - _window_dimension / 2 - 1);
+    const size_t      row_stride = _input_old->info()->strides_in_bytes()[1];
+    const uint8_t    *input_ptr  = _input_old->buffer() + _input_old->info()->offset_element_in_bytes(top_left_window_corner);
+
+    for(int ky = 0; ky <= _window_dimension; ++ky, input_ptr += row_stride, patch_gx += _patch_stride, patch_gy += _patch_stride)
+    {
+        for(int kx = 0; kx < _patch_stride; kx += 8)
+        {
+            const uint8x16_t top_data = vld1q_u8(input_ptr + kx);
+            const uint8x16_t mid_data = vld1q_u8(input_ptr + kx + row_stride);
+            const uint8x16_t bot_data = vld1q_u8(input_ptr + kx + 2 * row_stride);
+
+            const int16x8x2_t top_s16 =
+            {
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(top_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(top_data)))
+                }
+            };
+            const int16x8x2_t mid_s16 =
+            {
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(mid_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(mid_data)))
+                }
+            };
+            const int16x8x2_t bot_s16 =
+            {
+                {
+                    vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(bot_data))),
+                    vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(bot_data)))
+                }
+            };
+
+            vst1q_s16(patch_gx + kx, scharr_x(top_s16, mid_s16, bot_s16));
+            vst1q_s16(patch_gy + kx, scharr_y(top_s16, bot_s16));
+        }
+    }
+}
+
+std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(const NELKInternalKeypoint &keypoint, const int16_t *gx, const int16_t *gy, size_t row_stride,
+                                                                             int *bilinear_ix, int *bilinear_iy)
 {
     int iA11 = 0;
     int iA12 = 0;
@@ -156,11 +235,8 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
     const int16x4_t nw10 = vdup_n_s16(iw10);
     const int16x4_t nw11 = vdup_n_s16(iw11);
 
-    // Convert stride from uint_t* to int16_t*
-    const size_t           row_stride = _old_scharr_gx->info()->strides_in_bytes()[1] / 2;
-    const Coordinates      top_left_window_corner(static_cast<int>(keypoint_int_x) - _window_dimension / 2, static_cast<int>(keypoint_int_y) - _window_dimension / 2);
-    auto                   idx             = reinterpret_cast<const int16_t *>(_old_scharr_gx->buffer() + _old_scharr_gx->info()->offset_element_in_bytes(top_left_window_corner));
-    auto                   idy             = reinterpret_cast<const int16_t *>(_old_scharr_gy->buffer() + _old_scharr_gy->info()->offset_element_in_bytes(top_left_window_corner));
+    const int16_t         *idx             = gx;
+    const int16_t         *idy             = gy;
     static const int32x4_t nshifter_scharr = vdupq_n_s32(-W_BITS);
 
     for(int ky = 0; ky < _window_dimension; ++ky, idx += row_stride, idy += row_stride)
@@ -197,10 +273,8 @@ std::tuple<int, int, int> NELKTrackerKernel::compute_spatial_gradient_matrix(con
         // Calculate the leftover elements
         for(; kx < _window_dimension; ++kx)
         {
-            const int32_t ixval = get_pixel<int16_t>(_old_scharr_gx, top_left_window_corner.x() + kx, top_left_window_corner.y() + ky,
-                                                     iw00, iw01, iw10, iw11, W_BITS);
-            const int32_t iyval = get_pixel<int16_t>(_old_scharr_gy, top_left_window_corner.x() + kx, top_left_window_corner.y() + ky,
-                                                     iw00, iw01, iw10, iw11, W_BITS);
+            const int32_t ixval = INT_ROUND(idx[kx] * iw00 + idx[kx + 1] * iw01 + idx[kx + row_stride] * iw10 + idx[kx + row_stride + 1] * iw11, W_BITS);
+            const int32_t iyval = INT_ROUND(idy[kx] * iw00 + idy[kx + 1] * iw01 + idy[kx + row_stride] * iw10 + idy[kx + row_stride + 1] * iw11, W_BITS);
 
             iA11 += ixval * ixval;
             iA12 += ixval * iyval;
@@ -322,7 +396,7 @@ std::pair<int, int> NELKTrackerKernel::compute_image_mismatch_vector(const NELKI
 NELKTrackerKernel::NELKTrackerKernel()
     : _input_old(nullptr), _input_new(nullptr), _old_scharr_gx(nullptr), _old_scharr_gy(nullptr), _new_points(nullptr), _new_points_estimates(nullptr), _old_points(nullptr), _old_points_internal(),
       _new_points_internal(), _termination(Termination::TERM_CRITERIA_EPSILON), _use_initial_estimate(false), _pyramid_scale(0.0f), _epsilon(0.0f), _num_iterations(0), _window_dimension(0), _level(0),
-      _num_levels(0), _valid_region()
+      _num_levels(0), _patch_stride(0), _valid_region()
 {
 }
 
@@ -360,11 +434,7 @@ void NELKTrackerKernel::configure(const ITensor *input_old, const ITensor *input
     _level                = level;
     _num_levels           = num_levels;
     _pyramid_scale        = pyramid_scale;
-    _num_levels           = num_levels;
-
-    Window window;
-    window.set(Window::DimX, Window::Dimension(0, old_points->num_values()));
-    window.set(Window::DimY, Window::Dimension(0, 1));
+    _patch_stride         = 0;
 
     _valid_region = intersect_valid_regions(
                         input_old->info()->valid_region(),
@@ -372,14 +442,68 @@ void NELKTrackerKernel::configure(const ITensor *input_old, const ITensor *input
                         old_scharr_gx->info()->valid_region(),
                         old_scharr_gy->info()->valid_region());
 
+    configure_window(BorderSize(0));
+}
+
+void NELKTrackerKernel::configure(const ITensor *input_old, const ITensor *input_new,
+                                  const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates, IKeyPointArray *new_points,
+                                  INELKInternalKeypointArray *old_points_internal, INELKInternalKeypointArray *new_points_internal,
+                                  Termination termination, bool use_initial_estimate, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                                  size_t level, size_t num_levels, float pyramid_scale, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_old, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input_new, 1, DataType::U8);
+
+    _input_old            = input_old;
+    _input_new            = input_new;
+    _old_scharr_gx        = nullptr;
+    _old_scharr_gy        = nullptr;
+    _old_points           = old_points;
+    _new_points_estimates = new_points_estimates;
+    _new_points           = new_points;
+    _old_points_internal  = old_points_internal;
+    _new_points_internal  = new_points_internal;
+    _termination          = termination;
+    _use_initial_estimate = use_initial_estimate;
+    _epsilon              = epsilon;
+    _num_iterations       = num_iterations;
+    _window_dimension     = window_dimension;
+    _level                = level;
+    _num_levels           = num_levels;
+    _pyramid_scale        = pyramid_scale;
+
+    // The bilinear interpolation of the gradients loads 8 elements from each multiple of 4 of the window
+    _patch_stride = ceil_to_multiple(_window_dimension + 4, 8);
+
+    _valid_region = intersect_valid_regions(input_old->info()->valid_region(), input_new->info()->valid_region());
+
+    if(border_undefined)
+    {
+        // Same valid region as the output of the scharr kernel
+        _valid_region.anchor.set(0, _valid_region.start(0) + 1);
+        _valid_region.anchor.set(1, _valid_region.start(1) + 1);
+        _valid_region.shape.set(0, std::max(static_cast<int>(_valid_region.shape[0]) - 2, 0));
+        _valid_region.shape.set(1, std::max(static_cast<int>(_valid_region.shape[1]) - 2, 0));
+    }
+
+    // The last block of gradients of a patch reads 16 elements from the column _patch_stride - 9 of the window
+    configure_window(BorderSize(1, _patch_stride - _window_dimension + 6, 1, 1));
+}
+
+void NELKTrackerKernel::configure_window(const BorderSize &old_read_border)
+{
+    Window window;
+    window.set(Window::DimX, Window::Dimension(0, _old_points->num_values()));
+    window.set(Window::DimY, Window::Dimension(0, 1));
+
     update_window_and_padding(window,
-                              AccessWindowStatic(input_old->info(), _valid_region.start(0), _valid_region.start(1),
+                              AccessWindowStatic(_input_old->info(), _valid_region.start(0) - static_cast<int>(old_read_border.left), _valid_region.start(1) - static_cast<int>(old_read_border.top),
+                                                 _valid_region.end(0) + static_cast<int>(old_read_border.right), _valid_region.end(1) + static_cast<int>(old_read_border.bottom)),
+                              AccessWindowStatic(_input_new->info(), _valid_region.start(0), _valid_region.start(1),
                                                  _valid_region.end(0), _valid_region.end(1)),
-                              AccessWindowStatic(input_new->info(), _valid_region.start(0), _valid_region.start(1),
+                              AccessWindowStatic(_old_scharr_gx != nullptr ? _old_scharr_gx->info() : nullptr, _valid_region.start(0), _valid_region.start(1),
                                                  _valid_region.end(0), _valid_region.end(1)),
-                              AccessWindowStatic(old_scharr_gx->info(), _valid_region.start(0), _valid_region.start(1),
-                                                 _valid_region.end(0), _valid_region.end(1)),
-                              AccessWindowStatic(old_scharr_gy->info(), _valid_region.start(0), _valid_region.start(1),
+                              AccessWindowStatic(_old_scharr_gy != nullptr ? _old_scharr_gy->info() : nullptr, _valid_region.start(0), _valid_region.start(1),
                                                  _valid_region.end(0), _valid_region.end(1)));
 
     INEKernel::configure(window);
@@ -392,8 +516,8 @@ void NELKTrackerKernel::run(const Window &window)
 
     ARM_COMPUTE_ERROR_ON(_input_old->buffer() == nullptr);
     ARM_COMPUTE_ERROR_ON(_input_new->buffer() == nullptr);
-    ARM_COMPUTE_ERROR_ON(_old_scharr_gx->buffer() == nullptr);
-    ARM_COMPUTE_ERROR_ON(_old_scharr_gy->buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(_old_scharr_gx != nullptr && _old_scharr_gx->buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON(_old_scharr_gy != nullptr && _old_scharr_gy->buffer() == nullptr);
 
     const int list_end   = window.x().end();
     const int list_start = window.x().start();
@@ -404,6 +528,12 @@ void NELKTrackerKernel::run(const Window &window)
     int       bilinear_ix[buffer_size];
     int       bilinear_iy[buffer_size];
 
+    // Scharr gradients around the current keypoint, if they are computed on the fly
+    const bool compute_scharr = _old_scharr_gx == nullptr;
+    const int  patch_size     = compute_scharr ? _patch_stride * (_window_dimension + 1) : 1;
+    int16_t    patch_gx[patch_size];
+    int16_t    patch_gy[patch_size];
+
     const int half_window = _window_dimension / 2;
 
     auto is_invalid_keypoint = [&](const NELKInternalKeypoint & keypoint)
@@ -439,7 +569,24 @@ void NELKTrackerKernel::run(const Window &window)
         int iA12 = 0;
         int iA22 = 0;
 
-        std::tie(iA11, iA12, iA22) = compute_spatial_gradient_matrix(old_keypoint, bilinear_ix, bilinear_iy);
+        const int16_t *gx         = patch_gx;
+        const int16_t *gy         = patch_gy;
+        size_t         row_stride = _patch_stride;
+
+        if(compute_scharr)
+        {
+            compute_scharr_patch(old_keypoint, patch_gx, patch_gy);
+        }
+        else
+        {
+            const Coordinates top_left_window_corner(static_cast<int>(old_keypoint.x) - _window_dimension / 2, static_cast<int>(old_keypoint.y) - _window_dimension / 2);
+            gx         = reinterpret_cast<const int16_t *>(_old_scharr_gx->buffer() + _old_scharr_gx->info()->offset_element_in_bytes(top_left_window_corner));
+            gy         = reinterpret_cast<const int16_t *>(_old_scharr_gy->buffer() + _old_scharr_gy->info()->offset_element_in_bytes(top_left_window_corner));
+            // Convert stride from uint_t* to int16_t*
+            row_stride = _old_scharr_gx->info()->strides_in_bytes()[1] / 2;
+        }
+
+        std::tie(iA11, iA12, iA22) = compute_spatial_gradient_matrix(old_keypoint, gx, gy, row_stride, bilinear_ix, bilinear_iy);
 
         const float A11 = iA11 * FLT_SCALE;
         const float A12 = iA12 * FLT_SCALE;
@@ -531,3 +678,38 @@ void NELKTrackerKernel::run(const Window &window)
         }
     }
 }
+
+NELKTrackerPyramidKernel::NELKTrackerPyramidKernel()
+    : _trackers(nullptr), _num_levels(0)
+{
+}
+
+void NELKTrackerPyramidKernel::configure(NELKTrackerKernel *trackers, size_t num_levels)
+{
+    ARM_COMPUTE_ERROR_ON(trackers == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_levels == 0);
+
+    _trackers   = trackers;
+    _num_levels = num_levels;
+
+    // All the trackers share the keypoint arrays, hence the same window
+    INEKernel::configure(trackers[0].window());
+}
+
+void NELKTrackerPyramidKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    // A keypoint only depends on its own position at the previous level
+    for(size_t level = _num_levels; level > 0; --level)
+    {
+        _trackers[level - 1].run(window);
+    }
+}
+
+SchedulingPolicy NELKTrackerPyramidKernel::scheduling_policy() const
+{
+    // The number of iterations varies a lot from one keypoint to another
+    return SchedulingPolicy::DYNAMIC;
+}
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELaplacianPyramidKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+NELaplacianPyramidKernel::NELaplacianPyramidKernel()
+    : _input(nullptr), _output(nullptr), _blurred(nullptr)
+{
+}
+
+BorderSize NELaplacianPyramidKernel::border_size() const
+{
+    return BorderSize(2);
+}
+
+void NELaplacianPyramidKernel::configure(const ITensor *input, ITensor *output, ITensor *blurred, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    if(blurred != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(blurred, 1, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, blurred);
+    }
+
+    _input   = input;
+    _output  = output;
+    _blurred = blurred;
+
+    // Configure kernel window
+    // Each iteration produces 16 pixels from 2 horizontal passes of 8 pixels on 5 rows
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    constexpr unsigned int num_elems_read_per_iteration      = 24;
+    constexpr unsigned int num_rows_read_per_iteration       = 5;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal blurred_access(blurred == nullptr ? nullptr : blurred->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_access,
+                              blurred_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+    blurred_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NELaplacianPyramidKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.y().step() != 1);
+
+    static const int16x8_t  six_s16  = vdupq_n_s16(6);
+    static const int16x8_t  four_s16 = vdupq_n_s16(4);
+    static const uint16x8_t six_u16  = vdupq_n_u16(6);
+    static const uint16x8_t four_u16 = vdupq_n_u16(4);
+
+    constexpr int num_lines = 5;
+
+    const int    x_start         = window.x().start();
+    const int    x_end           = window.x().end();
+    const int    y_start         = window.y().start();
+    const int    y_end           = window.y().end();
+    const int    line_width      = x_end - x_start;
+    const size_t in_stride_y     = _input->info()->strides_in_bytes()[Window::DimY];
+    const size_t out_stride_y    = _output->info()->strides_in_bytes()[Window::DimY];
+    const size_t blurred_stride  = (_blurred != nullptr) ? _blurred->info()->strides_in_bytes()[Window::DimY] : 0;
+    const int    first_in_row    = y_start - 2;
+    const size_t out_elem_offset = x_start * sizeof(int16_t);
+
+    // Horizontally filtered rows, the row r is stored in line (r - first_in_row) % num_lines
+    int16_t *const lines = thread_scratch<int16_t>(num_lines * line_width);
+
+    // The rows and columns are handled manually, the iterators only walk the planes
+    Window win_planes(window);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+    Iterator blurred(_blurred, win_planes);
+
+    execute_window_loop(win_planes, [&](const Coordinates &)
+    {
+        int next_in_row = first_in_row;
+
+        for(int y = y_start; y < y_end; ++y)
+        {
+            // Horizontal pass on the rows not filtered yet: 5 rows for the first output row, then 1 per output row
+            for(; next_in_row <= y + 2; ++next_in_row)
+            {
+                const uint8_t *in_row = in.ptr() + static_cast<ptrdiff_t>(next_in_row) * in_stride_y - 2;
+                int16_t       *line   = lines + ((next_in_row - first_in_row) % num_lines) * line_width;
+
+                for(int x = x_start; x < x_end; x += 8)
+                {
+                    const uint8x16_t data = vld1q_u8(in_row + x);
+
+                    const int16x8x2_t data_s16 =
+                    {
+                        {
+                            vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data))),
+                            vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data)))
+                        }
+                    };
+
+                    int16x8_t out_val = vaddq_s16(data_s16.val[0], vextq_s16(data_s16.val[0], data_s16.val[1], 4));
+                    out_val           = vmlaq_s16(out_val, vextq_s16(data_s16.val[0], data_s16.val[1], 1), four_s16);
+                    out_val           = vmlaq_s16(out_val, vextq_s16(data_s16.val[0], data_s16.val[1], 2), six_s16);
+                    out_val           = vmlaq_s16(out_val, vextq_s16(data_s16.val[0], data_s16.val[1], 3), four_s16);
+
+                    vst1q_s16(line + (x - x_start), out_val);
+                }
+            }
+
+            // Vertical pass on the 5 lines around the output row, then subtraction from the input row
+            const int16_t *line_t2 = lines + ((y - 2 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_t1 = lines + ((y - 1 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_m  = lines + ((y - first_in_row) % num_lines) * line_width;
+            const int16_t *line_b1 = lines + ((y + 1 - first_in_row) % num_lines) * line_width;
+            const int16_t *line_b2 = lines + ((y + 2 - first_in_row) % num_lines) * line_width;
+
+            const uint8_t *in_row      = in.ptr() + static_cast<ptrdiff_t>(y) * in_stride_y + x_start;
+            auto           out_row     = reinterpret_cast<int16_t *>(out.ptr() + static_cast<ptrdiff_t>(y) * out_stride_y + out_elem_offset);
+            auto           blurred_row = reinterpret_cast<int16_t *>(blurred.ptr() + static_cast<ptrdiff_t>(y) * blurred_stride + out_elem_offset);
+
+            for(int x = 0; x < line_width; x += 16)
+            {
+                uint16x8_t out_low = vaddq_u16(vreinterpretq_u16_s16(vld1q_s16(line_t2 + x)), vreinterpretq_u16_s16(vld1q_s16(line_b2 + x)));
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_t1 + x)), four_u16);
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_m + x)), six_u16);
+                out_low            = vmlaq_u16(out_low, vreinterpretq_u16_s16(vld1q_s16(line_b1 + x)), four_u16);
+
+                uint16x8_t out_high = vaddq_u16(vreinterpretq_u16_s16(vld1q_s16(line_t2 + x + 8)), vreinterpretq_u16_s16(vld1q_s16(line_b2 + x + 8)));
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_t1 + x + 8)), four_u16);
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_m + x + 8)), six_u16);
+                out_high            = vmlaq_u16(out_high, vreinterpretq_u16_s16(vld1q_s16(line_b1 + x + 8)), four_u16);
+
+                // Same rounding as NEGaussian5x5VertKernel
+                const uint8x16_t blur = vcombine_u8(vqshrn_n_u16(out_low, 8), vqshrn_n_u16(out_high, 8));
+                const uint8x16_t data = vld1q_u8(in_row + x);
+
+                const int16x8_t blur_low  = vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(blur)));
+                const int16x8_t blur_high = vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(blur)));
+
+                vst1q_s16(out_row + x, vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_low_u8(data))), blur_low));
+                vst1q_s16(out_row + x + 8, vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(vget_high_u8(data))), blur_high));
+
+                if(_blurred != nullptr)
+                {
+                    vst1q_s16(blurred_row + x, blur_low);
+                    vst1q_s16(blurred_row + x + 8, blur_high);
+                }
+            }
+        }
+    },
+    in, out, blurred);
+}
@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NELaplacianReconstructKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+inline void store_sum(int16_t *output_ptr, const int16x8x2_t &sum)
+{
+    vst1q_s16(output_ptr, sum.val[0]);
+    vst1q_s16(output_ptr + 8, sum.val[1]);
+}
+
+inline void store_sum(uint8_t *output_ptr, const int16x8x2_t &sum)
+{
+    vst1q_u8(output_ptr, vcombine_u8(vqmovun_s16(sum.val[0]), vqmovun_s16(sum.val[1])));
+}
+
+/** Nearest neighbour offset, computed in the same way as @ref NEScale */
+inline size_t nearest_offset(int coord, float ratio, size_t max_index)
+{
+    return std::min(static_cast<size_t>((coord + 0.5f) * ratio), max_index);
+}
+} // namespace
+
+NELaplacianReconstructKernel::NELaplacianReconstructKernel()
+    : _func(nullptr), _low_res(nullptr), _laplacian(nullptr), _output(nullptr), _wr(0.f), _hr(0.f)
+{
+}
+
+void NELaplacianReconstructKernel::configure(const ITensor *low_res, const ITensor *laplacian, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(low_res, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(laplacian, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(laplacian, output);
+
+    _low_res   = low_res;
+    _laplacian = laplacian;
+    _output    = output;
+
+    const size_t low_res_width  = low_res->info()->dimension(0);
+    const size_t low_res_height = low_res->info()->dimension(1);
+    const size_t output_width   = output->info()->dimension(0);
+
+    _wr = static_cast<float>(low_res_width) / output_width;
+    _hr = static_cast<float>(low_res_height) / output->info()->dimension(1);
+
+    // Levels of the same width are added directly, exactly halved levels are upsampled by duplicating the low resolution pixels in registers
+    const bool is_u8 = (output->info()->data_type() == DataType::U8);
+
+    if(low_res_width == output_width)
+    {
+        _func = is_u8 ? &NELaplacianReconstructKernel::upsample_add_x1<uint8_t> : &NELaplacianReconstructKernel::upsample_add_x1<int16_t>;
+    }
+    else if(2 * low_res_width == output_width)
+    {
+        _func = is_u8 ? &NELaplacianReconstructKernel::upsample_add_x2<uint8_t> : &NELaplacianReconstructKernel::upsample_add_x2<int16_t>;
+    }
+    else
+    {
+        _func = is_u8 ? &NELaplacianReconstructKernel::upsample_add<uint8_t> : &NELaplacianReconstructKernel::upsample_add<int16_t>;
+    }
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    const size_t low_res_read = (low_res_width == output_width) ? ceil_to_multiple(output_width, num_elems_processed_per_iteration) : ceil_to_multiple(output_width, num_elems_processed_per_iteration) / 2;
+    const int    low_res_end_x = static_cast<int>(std::max(low_res_width, low_res_read));
+
+    AccessWindowStatic     low_res_access(low_res->info(), 0, 0, low_res_end_x, low_res_height);
+    AccessWindowHorizontal laplacian_access(laplacian->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, low_res_access, laplacian_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+template <typename T>
+void NELaplacianReconstructKernel::upsample_add_x1(const Window &window)
+{
+    const size_t max_y = _low_res->info()->dimension(1) - 1;
+
+    Iterator laplacian(_laplacian, window);
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto low_res_ptr = reinterpret_cast<const int16_t *>(_low_res->ptr_to_element(Coordinates(id.x(), static_cast<int>(nearest_offset(id.y(), _hr, max_y)))));
+        const auto lap_ptr     = reinterpret_cast<const int16_t *>(laplacian.ptr());
+
+        const int16x8x2_t sum =
+        {
+            {
+                vqaddq_s16(vld1q_s16(low_res_ptr), vld1q_s16(lap_ptr)),
+                vqaddq_s16(vld1q_s16(low_res_ptr + 8), vld1q_s16(lap_ptr + 8))
+            }
+        };
+
+        store_sum(reinterpret_cast<T *>(output.ptr()), sum);
+    },
+    laplacian, output);
+}
+
+template <typename T>
+void NELaplacianReconstructKernel::upsample_add_x2(const Window &window)
+{
+    const size_t max_y = _low_res->info()->dimension(1) - 1;
+
+    Iterator laplacian(_laplacian, window);
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto low_res_ptr = reinterpret_cast<const int16_t *>(_low_res->ptr_to_element(Coordinates(id.x() / 2, static_cast<int>(nearest_offset(id.y(), _hr, max_y)))));
+        const auto lap_ptr     = reinterpret_cast<const int16_t *>(laplacian.ptr());
+
+        // Each low resolution pixel covers 2 output pixels
+        const int16x8x2_t up = vzipq_s16(vld1q_s16(low_res_ptr), vld1q_s16(low_res_ptr));
+
+        const int16x8x2_t sum =
+        {
+            {
+                vqaddq_s16(up.val[0], vld1q_s16(lap_ptr)),
+                vqaddq_s16(up.val[1], vld1q_s16(lap_ptr + 8))
+            }
+        };
+
+        store_sum(reinterpret_cast<T *>(output.ptr()), sum);
+    },
+    laplacian, output);
+}
+
+template <typename T>
+void NELaplacianReconstructKernel::upsample_add(const Window &window)
+{
+    const size_t max_x = _low_res->info()->dimension(0) - 1;
+    const size_t max_y = _low_res->info()->dimension(1) - 1;
+
+    Iterator laplacian(_laplacian, window);
+    Iterator output(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto low_res_ptr = reinterpret_cast<const int16_t *>(_low_res->ptr_to_element(Coordinates(0, static_cast<int>(nearest_offset(id.y(), _hr, max_y)))));
+        const auto lap_ptr     = reinterpret_cast<const int16_t *>(laplacian.ptr());
+
+        int16_t up[num_elems_processed_per_iteration];
+
+        for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i)
+        {
+            up[i] = low_res_ptr[nearest_offset(id.x() + i, _wr, max_x)];
+        }
+
+        const int16x8x2_t sum =
+        {
+            {
+                vqaddq_s16(vld1q_s16(up), vld1q_s16(lap_ptr)),
+                vqaddq_s16(vld1q_s16(up + 8), vld1q_s16(lap_ptr + 8))
+            }
+        };
+
+        store_sum(reinterpret_cast<T *>(output.ptr()), sum);
+    },
+    laplacian, output);
+}
+
+void NELaplacianReconstructKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
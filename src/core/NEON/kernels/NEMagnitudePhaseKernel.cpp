@@ -27,9 +27,11 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMagnitudePhaseHelper.inl"
 #include "arm_compute/core/Validate.h"
 
 #include <arm_neon.h>
+#include <cmath>
 #include <cstdint>
 
 using namespace arm_compute;
@@ -39,18 +41,6 @@ namespace arm_compute
 class Coordinates;
 } // namespace arm_compute
 
-namespace
-{
-// Defines for computing atan2
-constexpr float SCALE_FACTOR = 0.7111111111111111f;
-constexpr float PI           = 3.141592653589793f;
-constexpr float SCALE_180    = 180.0f / PI;
-constexpr float SCALE_360    = SCALE_180 * SCALE_FACTOR;
-constexpr float PI_4         = 0.7853981633974483f;
-constexpr float COEFF1       = 0.0663f;
-constexpr float COEFF2       = 0.2447f;
-} // namespace
-
 #ifdef ARM_COMPUTE_ENABLE_FP16
 namespace fp16
 {
@@ -430,206 +420,15 @@ template class arm_compute::NEMagnitudePhaseFP16Kernel<MagnitudeType::L1NORM, Ph
 template class arm_compute::NEMagnitudePhaseFP16Kernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>;
 #endif
 
-namespace
-{
-inline float32x4_t inv(float32x4_t x)
-{
-    float32x4_t result = vrecpeq_f32(x);
-    result             = vmulq_f32(vrecpsq_f32(x, result), result);
-    return result;
-}
-
-inline float32x4_t atan2_0_360(float32x4_t gx, float32x4_t gy)
-{
-    const float32x4_t zero       = vdupq_n_f32(0.0f);
-    const float32x4_t epsilon    = vdupq_n_f32(1e-9f);
-    const float32x4_t piover4    = vdupq_n_f32(PI_4);
-    const float32x4_t coeff1     = vdupq_n_f32(COEFF1);
-    const float32x4_t coeff2     = vdupq_n_f32(COEFF2);
-    const float32x4_t ninety     = vdupq_n_f32(90.0f * SCALE_FACTOR);
-    const float32x4_t oneeighty  = vdupq_n_f32(180.0f * SCALE_FACTOR);
-    const float32x4_t threesixty = vdupq_n_f32(360.0f * SCALE_FACTOR);
-    const float32x4_t scale      = vdupq_n_f32(SCALE_360);
-
-    float32x4_t abs_gx = vabsq_f32(gx);
-    float32x4_t abs_gy = vabsq_f32(gy);
-    float32x4_t tmin   = vminq_f32(abs_gx, abs_gy);
-    float32x4_t tmax   = vmaxq_f32(abs_gx, abs_gy);
-    float32x4_t z      = vmulq_f32(tmin, inv(vaddq_f32(tmax, epsilon)));
-    float32x4_t absz   = vabsq_f32(z);
-    float32x4_t term   = vmulq_f32(z, vsubq_f32(vdupq_n_f32(1.0f), absz));
-
-    /* Compute y = pi/4 * x - x*(abs(x)-1)*(0.2447+0.0663 * abs(x) */
-    float32x4_t result = vaddq_f32(coeff2, vmulq_f32(absz, coeff1));
-    result             = vmulq_f32(result, term);
-    result             = vmlaq_f32(result, piover4, z);
-
-    /* Radians to degrees conversion with applied a scale factor in order to have the result [0, 255]  */
-    result = vmulq_f32(result, scale);
-
-    /* If z > 1, result = 90 - result */
-    result = vbslq_f32(vcgeq_f32(abs_gx, abs_gy), result, vsubq_f32(ninety, result));
-
-    /* Choose correct quadrant */
-    result = vbslq_f32(vcltq_f32(gx, zero), vsubq_f32(oneeighty, result), result);
-    result = vbslq_f32(vcltq_f32(gy, zero), vsubq_f32(threesixty, result), result);
-
-    return result;
-}
-
-inline float32x4_t atan2_0_180(float32x4_t gx, float32x4_t gy)
-{
-    const float32x4_t zero       = vdupq_n_f32(0.0f);
-    const float32x4_t epsilon    = vdupq_n_f32(1e-9f); // epsilon used to avoiding division by 0
-    const float32x4_t piover4    = vdupq_n_f32(PI_4);
-    const float32x4_t coeff1     = vdupq_n_f32(COEFF1);
-    const float32x4_t coeff2     = vdupq_n_f32(COEFF2);
-    const float32x4_t ninety     = vdupq_n_f32(90.0f);
-    const float32x4_t oneeighty  = vdupq_n_f32(180.0f);
-    const float32x4_t threesixty = vdupq_n_f32(360.0f);
-    const float32x4_t scale      = vdupq_n_f32(SCALE_180);
-
-    float32x4_t abs_gx = vabsq_f32(gx);
-    float32x4_t abs_gy = vabsq_f32(gy);
-    float32x4_t tmin   = vminq_f32(abs_gx, abs_gy);
-    float32x4_t tmax   = vmaxq_f32(abs_gx, abs_gy);
-    float32x4_t z      = vmulq_f32(tmin, inv(vaddq_f32(tmax, epsilon)));
-    float32x4_t absz   = vabsq_f32(z);
-
-    /* Compute y = pi/4 * z - z*(abs(z)-1)*(0.2447+0.0663 * abs(z) */
-    float32x4_t term   = vmulq_f32(z, vsubq_f32(vdupq_n_f32(1.0f), absz));
-    float32x4_t result = vaddq_f32(coeff2, vmulq_f32(absz, coeff1));
-    result             = vmulq_f32(result, term);
-    result             = vmlaq_f32(result, piover4, z);
-
-    /* Radians to degrees conversion */
-    result = vmulq_f32(result, scale);
-
-    /* If z > 1, result = 90 - result */
-    result = vbslq_f32(vcgeq_f32(abs_gx, abs_gy), result, vsubq_f32(ninety, result));
-
-    /* Choose correct quadrant */
-    result = vbslq_f32(vcltq_f32(gx, zero), vsubq_f32(oneeighty, result), result);
-    result = vbslq_f32(vcltq_f32(gy, zero), vsubq_f32(threesixty, result), result);
-    result = vbslq_f32(vcgtq_f32(result, oneeighty), vsubq_f32(result, oneeighty), result);
-
-    return result;
-}
-
-inline float32x4_t invsqrtv(float32x4_t x)
-{
-    float32x4_t sqrt_reciprocal = vrsqrteq_f32(x);
-
-    sqrt_reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, sqrt_reciprocal), sqrt_reciprocal),
-                                sqrt_reciprocal);
-    sqrt_reciprocal = vmulq_f32(vrsqrtsq_f32(vmulq_f32(x, sqrt_reciprocal), sqrt_reciprocal),
-                                sqrt_reciprocal);
-
-    return sqrt_reciprocal;
-}
-
-inline float32x4_t sqrtv(float32x4_t x)
-{
-    float32x4_t res = vdupq_n_f32(0.5f);
-    return vmlaq_f32(res, x, invsqrtv(x));
-}
-
-inline int16x8_t magnitude_l2(int16x8_t input1, int16x8_t input2)
-{
-    const int32x4x2_t square_x =
-    {
-        {
-            vmull_s16(vget_low_s16(input1), vget_low_s16(input1)),
-            vmull_s16(vget_high_s16(input1), vget_high_s16(input1))
-        }
-    };
-
-    const int32x4x2_t square_y =
-    {
-        {
-            vmull_s16(vget_low_s16(input2), vget_low_s16(input2)),
-            vmull_s16(vget_high_s16(input2), vget_high_s16(input2))
-        }
-    };
-
-    const uint32x4x2_t sum =
-    {
-        {
-            vaddq_u32(vreinterpretq_u32_s32(square_x.val[0]), vreinterpretq_u32_s32(square_y.val[0])),
-            vaddq_u32(vreinterpretq_u32_s32(square_x.val[1]), vreinterpretq_u32_s32(square_y.val[1]))
-        }
-    };
-
-    const float32x4x2_t res =
-    {
-        {
-            sqrtv(vcvtq_f32_u32(sum.val[0])),
-            sqrtv(vcvtq_f32_u32(sum.val[1]))
-        }
-    };
-
-    return vcombine_s16(vqmovn_s32(vcvtq_s32_f32(res.val[0])),
-                        vqmovn_s32(vcvtq_s32_f32(res.val[1])));
-}
-
-inline int16x8_t magnitude_l1(int16x8_t input1, int16x8_t input2)
-{
-    int16x8_t gx_abs = vabsq_s16(input1);
-    int16x8_t gy_abs = vabsq_s16(input2);
-
-    /* Saturating add */
-    return vqaddq_s16(gx_abs, gy_abs);
-}
-
-inline uint8x8_t phase_signed(int16x8_t input1, int16x8_t input2)
-{
-    const float32x4_t zeropointfive = vdupq_n_f32(0.5f);
-
-    float32x4_t inputx_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input1)));
-    float32x4_t inputx_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input1)));
-    float32x4_t inputy_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input2)));
-    float32x4_t inputy_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input2)));
-
-    /* Compute fast atan2 */
-    float32x4_t angle_high = atan2_0_360(inputx_f32_high, inputy_f32_high);
-    float32x4_t angle_low  = atan2_0_360(inputx_f32_low, inputy_f32_low);
-
-    angle_high = vaddq_f32(angle_high, zeropointfive);
-    angle_low  = vaddq_f32(angle_low, zeropointfive);
-
-    return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
-                                  vqmovun_s32(vcvtq_s32_f32(angle_high))));
-}
-
-inline uint8x8_t phase_unsigned(int16x8_t input1, int16x8_t input2)
-{
-    const float32x4_t zeropointfive = vdupq_n_f32(0.5f);
-
-    float32x4_t inputx_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input1)));
-    float32x4_t inputx_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input1)));
-    float32x4_t inputy_f32_high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(input2)));
-    float32x4_t inputy_f32_low  = vcvtq_f32_s32(vmovl_s16(vget_low_s16(input2)));
-
-    /* Compute fast atan2 */
-    float32x4_t angle_high = atan2_0_180(inputx_f32_high, inputy_f32_high);
-    float32x4_t angle_low  = atan2_0_180(inputx_f32_low, inputy_f32_low);
-
-    angle_high = vaddq_f32(angle_high, zeropointfive);
-    angle_low  = vaddq_f32(angle_low, zeropointfive);
-
-    return vmovn_u16(vcombine_u16(vqmovun_s32(vcvtq_s32_f32(angle_low)),
-                                  vqmovun_s32(vcvtq_s32_f32(angle_high))));
-}
-} // namespace
-
 template <MagnitudeType mag_type, PhaseType phase_type>
 NEMagnitudePhaseKernel<mag_type, phase_type>::NEMagnitudePhaseKernel()
-    : _func(nullptr), _gx(nullptr), _gy(nullptr), _magnitude(nullptr), _phase(nullptr)
+    : _func(nullptr), _gx(nullptr), _gy(nullptr), _magnitude(nullptr), _phase(nullptr), _boundary_cos(), _boundary_sin(), _fold_offset(0)
 {
 }
 
 template <MagnitudeType mag_type, PhaseType phase_type>
-void NEMagnitudePhaseKernel<mag_type, phase_type>::configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase)
+void NEMagnitudePhaseKernel<mag_type, phase_type>::configure(const ITensor *gx, const ITensor *gy, ITensor *magnitude, ITensor *phase, MagnitudePhaseApproximation approximation,
+                                                             size_t num_bins)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, DataType::S16);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gy, 1, DataType::S16);
@@ -653,22 +452,68 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::configure(const ITensor *gx,
     _magnitude = magnitude;
     _phase     = phase;
 
+    if(MagnitudePhaseApproximation::BINS == approximation)
+    {
+        ARM_COMPUTE_ERROR_ON(num_bins < 1 || num_bins > 255);
+        ARM_COMPUTE_ERROR_ON_MSG(PhaseType::SIGNED == phase_type && (num_bins % 2) != 0, "The number of bins of signed phases must be even");
+
+        // The gradients pointing downwards are rotated by 180 degrees: the boundaries in [0, 180) are enough to classify them
+        const size_t num_half_bins = (PhaseType::SIGNED == phase_type) ? num_bins / 2 : num_bins;
+        _fold_offset               = (PhaseType::SIGNED == phase_type) ? num_half_bins : 0;
+
+        _boundary_cos.resize(num_half_bins - 1);
+        _boundary_sin.resize(num_half_bins - 1);
+        for(size_t k = 1; k < num_half_bins; ++k)
+        {
+            const float angle    = static_cast<float>(k) * 3.141592653589793f / num_half_bins;
+            _boundary_cos[k - 1] = std::cos(angle);
+            _boundary_sin[k - 1] = std::sin(angle);
+        }
+    }
+
     if(run_mag && run_phase)
     {
         /* Run magnitude and phase */
-        _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase;
+        switch(approximation)
+        {
+            case MagnitudePhaseApproximation::ACCURATE:
+                _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase<MagnitudePhaseApproximation::ACCURATE>;
+                break;
+            case MagnitudePhaseApproximation::FAST:
+                _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase<MagnitudePhaseApproximation::FAST>;
+                break;
+            case MagnitudePhaseApproximation::BINS:
+                _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase<MagnitudePhaseApproximation::BINS>;
+                break;
+            default:
+                ARM_COMPUTE_ERROR("Approximation not supported");
+        }
     }
     else
     {
         if(run_mag)
         {
-            /* Run magnitude */
-            _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude;
+            /* Run magnitude: the bins don't change the magnitude */
+            _func = (MagnitudePhaseApproximation::ACCURATE == approximation) ? &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude<MagnitudePhaseApproximation::ACCURATE> :
+                    &NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude<MagnitudePhaseApproximation::FAST>;
         }
         else if(run_phase)
         {
             /* Run phase */
-            _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::phase;
+            switch(approximation)
+            {
+                case MagnitudePhaseApproximation::ACCURATE:
+                    _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::phase<MagnitudePhaseApproximation::ACCURATE>;
+                    break;
+                case MagnitudePhaseApproximation::FAST:
+                    _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::phase<MagnitudePhaseApproximation::FAST>;
+                    break;
+                case MagnitudePhaseApproximation::BINS:
+                    _func = &NEMagnitudePhaseKernel<mag_type, phase_type>::phase<MagnitudePhaseApproximation::BINS>;
+                    break;
+                default:
+                    ARM_COMPUTE_ERROR("Approximation not supported");
+            }
         }
         else
         {
@@ -699,6 +544,59 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::configure(const ITensor *gx,
 }
 
 template <MagnitudeType mag_type, PhaseType phase_type>
+template <MagnitudePhaseApproximation approximation>
+inline int16x8x2_t NEMagnitudePhaseKernel<mag_type, phase_type>::compute_magnitude(const int16x8x2_t &gx, const int16x8x2_t &gy) const
+{
+    int16x8x2_t mag{ {} };
+
+    if(MagnitudeType::L2NORM == mag_type)
+    {
+        constexpr bool fast = MagnitudePhaseApproximation::ACCURATE != approximation;
+
+        mag.val[0] = magnitude_l2(gx.val[0], gy.val[0], fast);
+        mag.val[1] = magnitude_l2(gx.val[1], gy.val[1], fast);
+    }
+    else
+    {
+        mag.val[0] = magnitude_l1(gx.val[0], gy.val[0]);
+        mag.val[1] = magnitude_l1(gx.val[1], gy.val[1]);
+    }
+
+    return mag;
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+template <MagnitudePhaseApproximation approximation>
+inline uint8x16_t NEMagnitudePhaseKernel<mag_type, phase_type>::compute_phase(const int16x8x2_t &gx, const int16x8x2_t &gy) const
+{
+    uint8x8x2_t vphase{ {} };
+
+    if(MagnitudePhaseApproximation::BINS == approximation)
+    {
+        vphase.val[0] = phase_bins(gx.val[0], gy.val[0], _boundary_cos.data(), _boundary_sin.data(), _boundary_cos.size(), _fold_offset);
+        vphase.val[1] = phase_bins(gx.val[1], gy.val[1], _boundary_cos.data(), _boundary_sin.data(), _boundary_cos.size(), _fold_offset);
+    }
+    else if(MagnitudePhaseApproximation::FAST == approximation)
+    {
+        vphase.val[0] = phase_fast(gx.val[0], gy.val[0], PhaseType::UNSIGNED == phase_type);
+        vphase.val[1] = phase_fast(gx.val[1], gy.val[1], PhaseType::UNSIGNED == phase_type);
+    }
+    else if(PhaseType::SIGNED == phase_type)
+    {
+        vphase.val[0] = phase_signed(gx.val[0], gy.val[0]);
+        vphase.val[1] = phase_signed(gx.val[1], gy.val[1]);
+    }
+    else
+    {
+        vphase.val[0] = phase_unsigned(gx.val[0], gy.val[0]);
+        vphase.val[1] = phase_unsigned(gx.val[1], gy.val[1]);
+    }
+
+    return vcombine_u8(vphase.val[0], vphase.val[1]);
+}
+
+template <MagnitudeType mag_type, PhaseType phase_type>
+template <MagnitudePhaseApproximation approximation>
 void NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude(const Window &window)
 {
     Iterator gx(_gx, window);
@@ -724,18 +622,7 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude(const Window &windo
         };
 
         /* Compute magnitude */
-        int16x8x2_t mag{ {} };
-
-        if(MagnitudeType::L2NORM == mag_type)
-        {
-            mag.val[0] = magnitude_l2(input1.val[0], input2.val[0]);
-            mag.val[1] = magnitude_l2(input1.val[1], input2.val[1]);
-        }
-        else
-        {
-            mag.val[0] = magnitude_l1(input1.val[0], input2.val[0]);
-            mag.val[1] = magnitude_l1(input1.val[1], input2.val[1]);
-        }
+        const int16x8x2_t mag = compute_magnitude<approximation>(input1, input2);
 
         /* Store magnitude */
         vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()), mag.val[0]);
@@ -745,6 +632,7 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude(const Window &windo
 }
 
 template <MagnitudeType mag_type, PhaseType phase_type>
+template <MagnitudePhaseApproximation approximation>
 void NEMagnitudePhaseKernel<mag_type, phase_type>::phase(const Window &window)
 {
     Iterator gx(_gx, window);
@@ -769,27 +657,14 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::phase(const Window &window)
             }
         };
 
-        /* Compute phase */
-        uint8x8x2_t vphase{ {} };
-
-        if(PhaseType::SIGNED == phase_type)
-        {
-            vphase.val[0] = phase_signed(input1.val[0], input2.val[0]);
-            vphase.val[1] = phase_signed(input1.val[1], input2.val[1]);
-        }
-        else
-        {
-            vphase.val[0] = phase_unsigned(input1.val[0], input2.val[0]);
-            vphase.val[1] = phase_unsigned(input1.val[1], input2.val[1]);
-        }
-
-        /* Store phase */
-        vst1q_u8(phase.ptr(), vcombine_u8(vphase.val[0], vphase.val[1]));
+        /* Compute and store phase */
+        vst1q_u8(phase.ptr(), compute_phase<approximation>(input1, input2));
     },
     gx, gy, phase);
 }
 
 template <MagnitudeType mag_type, PhaseType phase_type>
+template <MagnitudePhaseApproximation approximation>
 void NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase(const Window &window)
 {
     Iterator gx(_gx, window);
@@ -816,39 +691,14 @@ void NEMagnitudePhaseKernel<mag_type, phase_type>::magnitude_phase(const Window
         };
 
         /* Compute magnitude */
-        int16x8x2_t mag{ {} };
-
-        if(MagnitudeType::L2NORM == mag_type)
-        {
-            mag.val[0] = magnitude_l2(input1.val[0], input2.val[0]);
-            mag.val[1] = magnitude_l2(input1.val[1], input2.val[1]);
-        }
-        else
-        {
-            mag.val[0] = magnitude_l1(input1.val[0], input2.val[0]);
-            mag.val[1] = magnitude_l1(input1.val[1], input2.val[1]);
-        }
+        const int16x8x2_t mag = compute_magnitude<approximation>(input1, input2);
 
         /* Store magnitude */
         vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()), mag.val[0]);
         vst1q_s16(reinterpret_cast<int16_t *>(magnitude.ptr()) + 8, mag.val[1]);
 
-        /* Compute phase */
-        uint8x8x2_t vphase{ {} };
-
-        if(PhaseType::SIGNED == phase_type)
-        {
-            vphase.val[0] = phase_signed(input1.val[0], input2.val[0]);
-            vphase.val[1] = phase_signed(input1.val[1], input2.val[1]);
-        }
-        else
-        {
-            vphase.val[0] = phase_unsigned(input1.val[0], input2.val[0]);
-            vphase.val[1] = phase_unsigned(input1.val[1], input2.val[1]);
-        }
-
-        /* Store phase */
-        vst1q_u8(phase.ptr(), vcombine_u8(vphase.val[0], vphase.val[1]));
+        /* Compute and store phase */
+        vst1q_u8(phase.ptr(), compute_phase<approximation>(input1, input2));
     },
     gx, gy, magnitude, phase);
 }
@@ -23,25 +23,24 @@
  */
 #include "arm_compute/core/NEON/kernels/NEMeanStdDevKernel.h"
 
+#include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <cmath>
+#include <cstddef>
 #include <tuple>
 #include <utility>
 
 using namespace arm_compute;
 
-namespace arm_compute
-{
-class Coordinates;
-} // namespace arm_compute
-
 namespace
 {
 template <bool calc_sum_squared>
@@ -82,10 +81,93 @@ std::pair<uint64x1_t, uint64x1_t> accumulate(const Window &window, Iterator &ite
 
     return std::make_pair(sum, sum_squared);
 }
+
+/** Number of values, mean and sum of the squared differences to the mean of a set of values */
+struct WelfordStats
+{
+    double count;
+    double mean;
+    double m2;
+};
+
+/** Merge the statistics of two disjoint sets of values (Chan et al. parallel variant of Welford's algorithm) */
+inline void merge_stats(WelfordStats &dst, const WelfordStats &src)
+{
+    const double count = dst.count + src.count;
+    const double delta = src.mean - dst.mean;
+
+    dst.mean += delta * src.count / count;
+    dst.m2 += src.m2 + delta * delta * dst.count * src.count / count;
+    dst.count = count;
+}
+
+/** Exact sum and sum of squares of a row of at most 65535 pixels */
+template <bool calc_sum_squared>
+std::pair<uint32_t, uint32_t> accumulate_row(const uint8_t *row_ptr, int width)
+{
+    uint32x4_t sum         = vdupq_n_u32(0);
+    uint32x4_t sum_squared = vdupq_n_u32(0);
+
+    int x = 0;
+
+    for(; x <= width - 16; x += 16)
+    {
+        const uint8x16_t in_data = vld1q_u8(row_ptr + x);
+
+        sum = vpadalq_u16(sum, vpaddlq_u8(in_data));
+
+        if(calc_sum_squared)
+        {
+            sum_squared = vpadalq_u16(sum_squared, vmull_u8(vget_low_u8(in_data), vget_low_u8(in_data)));
+            sum_squared = vpadalq_u16(sum_squared, vmull_u8(vget_high_u8(in_data), vget_high_u8(in_data)));
+        }
+    }
+
+    const uint32x2_t tmp_sum         = vadd_u32(vget_low_u32(sum), vget_high_u32(sum));
+    const uint32x2_t tmp_sum_squared = vadd_u32(vget_low_u32(sum_squared), vget_high_u32(sum_squared));
+
+    uint32_t row_sum         = vget_lane_u32(vpadd_u32(tmp_sum, tmp_sum), 0);
+    uint32_t row_sum_squared = vget_lane_u32(vpadd_u32(tmp_sum_squared, tmp_sum_squared), 0);
+
+    // Left-over pixels of the row
+    for(; x < width; ++x)
+    {
+        const uint32_t value = row_ptr[x];
+
+        row_sum += value;
+        row_sum_squared += value * value;
+    }
+
+    return std::make_pair(row_sum, row_sum_squared);
+}
+
+template <bool calc_sum_squared>
+WelfordStats roi_stats(const IImage *input, const Rectangle &roi)
+{
+    const size_t stride = input->info()->strides_in_bytes()[Window::DimY];
+    const double width  = roi.width;
+
+    const uint8_t *row_ptr = input->ptr_to_element(Coordinates(roi.x, roi.y));
+
+    WelfordStats stats = { 0.0, 0.0, 0.0 };
+
+    for(unsigned int y = 0; y < roi.height; ++y, row_ptr += stride)
+    {
+        const std::pair<uint32_t, uint32_t> sums = accumulate_row<calc_sum_squared>(row_ptr, roi.width);
+
+        // sum(x^2) - sum(x)^2 / n is computed on a single row only, where both terms are exact
+        const double       row_sum   = sums.first;
+        const WelfordStats row_stats = { width, row_sum / width, sums.second - row_sum * row_sum / width };
+
+        merge_stats(stats, row_stats);
+    }
+
+    return stats;
+}
 } // namespace
 
 NEMeanStdDevKernel::NEMeanStdDevKernel()
-    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _global_sum(nullptr), _global_sum_squared(nullptr), _mtx()
+    : _input(nullptr), _mean(nullptr), _stddev(nullptr), _global_sum(nullptr), _global_sum_squared(nullptr), _partial_sums()
 {
 }
 
@@ -131,22 +213,94 @@ void NEMeanStdDevKernel::run(const Window &window)
         std::tie(local_sum, local_sum_squared) = accumulate<false>(window, input);
     }
 
-    const float num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
+    // Accumulate as a thread can run several sub-windows
+    std::pair<uint64_t, uint64_t> &partial = _partial_sums[window.thread_id()];
+    partial.first += vget_lane_u64(local_sum, 0);
+    partial.second += vget_lane_u64(local_sum_squared, 0);
+}
+
+void NEMeanStdDevKernel::begin_reduction(unsigned int num_threads)
+{
+    _partial_sums.reset(num_threads, std::make_pair<uint64_t, uint64_t>(0, 0));
+}
 
-    // Merge sum and calculate mean and stddev
-    std::unique_lock<std::mutex> lock(_mtx);
+void NEMeanStdDevKernel::end_reduction()
+{
+    const std::pair<uint64_t, uint64_t> &sums = _partial_sums.reduce([](std::pair<uint64_t, uint64_t> &dst, const std::pair<uint64_t, uint64_t> &src)
+    {
+        dst.first += src.first;
+        dst.second += src.second;
+    });
 
-    *_global_sum += vget_lane_u64(local_sum, 0);
+    const float num_pixels = _input->info()->dimension(0) * _input->info()->dimension(1);
+
+    *_global_sum += sums.first;
 
     const float mean = *_global_sum / num_pixels;
     *_mean           = mean;
 
     if(_stddev != nullptr)
     {
-        const uint64_t tmp_sum_squared = vget_lane_u64(local_sum_squared, 0);
-        *_global_sum_squared += tmp_sum_squared;
+        *_global_sum_squared += sums.second;
         *_stddev = std::sqrt((*_global_sum_squared / num_pixels) - (mean * mean));
     }
+}
+
+NEMeanStdDevROIKernel::NEMeanStdDevROIKernel()
+    : _input(nullptr), _rois(nullptr), _mean(nullptr), _stddev(nullptr)
+{
+}
+
+void NEMeanStdDevROIKernel::configure(const IImage *input, const IRectangleArray *rois, IFloatArray *mean, IFloatArray *stddev)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(nullptr == rois);
+    ARM_COMPUTE_ERROR_ON(nullptr == mean);
+    ARM_COMPUTE_ERROR_ON(mean->max_num_values() < rois->max_num_values());
+    ARM_COMPUTE_ERROR_ON(stddev != nullptr && stddev->max_num_values() < rois->max_num_values());
+
+    _input  = input;
+    _rois   = rois;
+    _mean   = mean;
+    _stddev = stddev;
+
+    // Configure kernel window: one iteration per region of interest, the regions are read in place so no padding is required
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, rois->max_num_values()));
+    win.set(Window::DimY, Window::Dimension(0, 1));
 
-    lock.unlock();
+    INEKernel::configure(win);
+}
+
+void NEMeanStdDevROIKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int num_rois = std::min(static_cast<int>(_rois->num_values()), window.x().end());
+
+    for(int i = window.x().start(); i < num_rois; ++i)
+    {
+        const Rectangle &roi = _rois->at(i);
+
+        ARM_COMPUTE_ERROR_ON(roi.width == 0 || roi.height == 0);
+        ARM_COMPUTE_ERROR_ON(static_cast<size_t>(roi.x + roi.width) > _input->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(static_cast<size_t>(roi.y + roi.height) > _input->info()->dimension(1));
+
+        const WelfordStats stats = (_stddev != nullptr) ? roi_stats<true>(_input, roi) : roi_stats<false>(_input, roi);
+
+        _mean->at(i) = stats.mean;
+
+        if(_stddev != nullptr)
+        {
+            _stddev->at(i) = std::sqrt(stats.m2 / stats.count);
+        }
+    }
+}
+
+SchedulingPolicy NEMeanStdDevROIKernel::scheduling_policy() const
+{
+    // The regions of interest can have very different sizes
+    return SchedulingPolicy::DYNAMIC;
 }
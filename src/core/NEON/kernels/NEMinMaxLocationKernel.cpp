@@ -32,39 +32,156 @@
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
 #include <arm_neon.h>
 #include <climits>
 #include <cstddef>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Compute the minimum and maximum values of a row
+ *
+ * @param[in]  ptr   Pointer to the first pixel of the row.
+ * @param[in]  width Number of pixels in the row, multiple of 16.
+ * @param[out] min   Minimum value of the row.
+ * @param[out] max   Maximum value of the row.
+ */
+inline void row_min_max(const uint8_t *ptr, int width, uint8_t &min, uint8_t &max)
+{
+    uint8x16_t carry_min = vdupq_n_u8(UCHAR_MAX);
+    uint8x16_t carry_max = vdupq_n_u8(0);
+
+    for(int x = 0; x < width; x += 16)
+    {
+        const uint8x16_t pixels = vld1q_u8(ptr + x);
+        carry_min               = vminq_u8(carry_min, pixels);
+        carry_max               = vmaxq_u8(carry_max, pixels);
+    }
+
+    uint8x8_t tmp_min = vmin_u8(vget_high_u8(carry_min), vget_low_u8(carry_min));
+    uint8x8_t tmp_max = vmax_u8(vget_high_u8(carry_max), vget_low_u8(carry_max));
+    tmp_min           = vpmin_u8(tmp_min, tmp_min);
+    tmp_max           = vpmax_u8(tmp_max, tmp_max);
+    tmp_min           = vpmin_u8(tmp_min, tmp_min);
+    tmp_max           = vpmax_u8(tmp_max, tmp_max);
+    tmp_min           = vpmin_u8(tmp_min, tmp_min);
+    tmp_max           = vpmax_u8(tmp_max, tmp_max);
+
+    min = vget_lane_u8(tmp_min, 0);
+    max = vget_lane_u8(tmp_max, 0);
+}
+
+inline void row_min_max(const int16_t *ptr, int width, int16_t &min, int16_t &max)
+{
+    int16x8_t carry_min = vdupq_n_s16(SHRT_MAX);
+    int16x8_t carry_max = vdupq_n_s16(SHRT_MIN);
+
+    for(int x = 0; x < width; x += 16)
+    {
+        const int16x8x2_t pixels = vld2q_s16(ptr + x);
+        carry_min                = vminq_s16(carry_min, vminq_s16(pixels.val[0], pixels.val[1]));
+        carry_max                = vmaxq_s16(carry_max, vmaxq_s16(pixels.val[0], pixels.val[1]));
+    }
+
+    int16x4_t tmp_min = vmin_s16(vget_high_s16(carry_min), vget_low_s16(carry_min));
+    int16x4_t tmp_max = vmax_s16(vget_high_s16(carry_max), vget_low_s16(carry_max));
+    tmp_min           = vpmin_s16(tmp_min, tmp_min);
+    tmp_max           = vpmax_s16(tmp_max, tmp_max);
+    tmp_min           = vpmin_s16(tmp_min, tmp_min);
+    tmp_max           = vpmax_s16(tmp_max, tmp_max);
+
+    min = vget_lane_s16(tmp_min, 0);
+    max = vget_lane_s16(tmp_max, 0);
+}
+
+/** Count the pixels of a row equal to a value
+ *
+ * @param[in] ptr   Pointer to the first pixel of the row.
+ * @param[in] width Number of pixels in the row, multiple of 16.
+ * @param[in] value Value to count.
+ *
+ * @return The number of pixels equal to @p value
+ */
+inline uint32_t row_count(const uint8_t *ptr, int width, uint8_t value)
+{
+    // The 16 bit lanes gain at most 2 per iteration so they are widened before they can overflow
+    constexpr int max_iterations = 32767;
+
+    const uint8x16_t value_u8 = vdupq_n_u8(value);
+    uint32x4_t       count    = vdupq_n_u32(0);
+
+    for(int x = 0; x < width;)
+    {
+        const int  end     = std::min(width, x + 16 * max_iterations);
+        uint16x8_t partial = vdupq_n_u16(0);
+
+        for(; x < end; x += 16)
+        {
+            const uint8x16_t ones = vshrq_n_u8(vceqq_u8(vld1q_u8(ptr + x), value_u8), 7);
+            partial               = vpadalq_u8(partial, ones);
+        }
+
+        count = vpadalq_u16(count, partial);
+    }
+
+    uint32x2_t tmp = vadd_u32(vget_high_u32(count), vget_low_u32(count));
+    tmp            = vpadd_u32(tmp, tmp);
+
+    return vget_lane_u32(tmp, 0);
+}
+
+inline uint32_t row_count(const int16_t *ptr, int width, int16_t value)
+{
+    const int16x8_t value_s16 = vdupq_n_s16(value);
+    uint32x4_t      count     = vdupq_n_u32(0);
+
+    for(int x = 0; x < width; x += 16)
+    {
+        const uint16x8_t ones0 = vshrq_n_u16(vceqq_s16(vld1q_s16(ptr + x), value_s16), 15);
+        const uint16x8_t ones1 = vshrq_n_u16(vceqq_s16(vld1q_s16(ptr + x + 8), value_s16), 15);
+        count                  = vpadalq_u16(count, vaddq_u16(ones0, ones1));
+    }
+
+    uint32x2_t tmp = vadd_u32(vget_high_u32(count), vget_low_u32(count));
+    tmp            = vpadd_u32(tmp, tmp);
+
+    return vget_lane_u32(tmp, 0);
+}
+} // namespace
+
 NEMinMaxKernel::NEMinMaxKernel()
-    : _func(), _input(nullptr), _min(), _max(), _min_init(), _max_init(), _mtx()
+    : _func(), _input(nullptr), _min(), _max(), _min_count(nullptr), _max_count(nullptr), _min_init(), _max_init(), _partial()
 {
 }
 
-void NEMinMaxKernel::configure(const IImage *input, int32_t *min, int32_t *max)
+void NEMinMaxKernel::configure(const IImage *input, int32_t *min, int32_t *max, uint32_t *min_count, uint32_t *max_count)
 {
     ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
     ARM_COMPUTE_ERROR_ON(nullptr == min);
     ARM_COMPUTE_ERROR_ON(nullptr == max);
 
-    _input = input;
-    _min   = min;
-    _max   = max;
+    _input     = input;
+    _min       = min;
+    _max       = max;
+    _min_count = min_count;
+    _max_count = max_count;
+
+    const bool count = (nullptr != min_count) || (nullptr != max_count);
 
     switch(input->info()->format())
     {
         case Format::U8:
             _min_init = UCHAR_MAX;
             _max_init = 0;
-            _func     = &NEMinMaxKernel::minmax_U8;
+            _func     = count ? &NEMinMaxKernel::minmax_count<uint8_t> : &NEMinMaxKernel::minmax_U8;
             break;
         case Format::S16:
             _min_init = SHRT_MAX;
             _max_init = SHRT_MIN;
-            _func     = &NEMinMaxKernel::minmax_S16;
+            _func     = count ? &NEMinMaxKernel::minmax_count<int16_t> : &NEMinMaxKernel::minmax_S16;
             break;
         default:
             ARM_COMPUTE_ERROR("You called with the wrong img formats");
@@ -97,22 +214,114 @@ void NEMinMaxKernel::reset()
     *_max = _max_init;
 }
 
+void NEMinMaxKernel::begin_reduction(unsigned int num_threads)
+{
+    _partial.reset(num_threads, MinMaxCount{ _min_init, _max_init, 0, 0 });
+}
+
+void NEMinMaxKernel::end_reduction()
+{
+    const MinMaxCount &min_max = _partial.reduce([](MinMaxCount & dst, const MinMaxCount & src)
+    {
+        if(src.min < dst.min)
+        {
+            dst.min       = src.min;
+            dst.min_count = src.min_count;
+        }
+        else if(src.min == dst.min)
+        {
+            dst.min_count += src.min_count;
+        }
+
+        if(src.max > dst.max)
+        {
+            dst.max       = src.max;
+            dst.max_count = src.max_count;
+        }
+        else if(src.max == dst.max)
+        {
+            dst.max_count += src.max_count;
+        }
+    });
+
+    *_min = std::min(*_min, min_max.min);
+    *_max = std::max(*_max, min_max.max);
+
+    if(_min_count != nullptr)
+    {
+        *_min_count = min_max.min_count;
+    }
+
+    if(_max_count != nullptr)
+    {
+        *_max_count = min_max.max_count;
+    }
+}
+
 template <typename T>
-void NEMinMaxKernel::update_min_max(const T min, const T max)
+void NEMinMaxKernel::update_min_max(const T min, const T max, unsigned int thread_id)
 {
-    std::lock_guard<std::mutex> lock(_mtx);
+    MinMaxCount &partial = _partial[thread_id];
 
-    if(min < *_min)
+    if(min < partial.min)
     {
-        *_min = min;
+        partial.min = min;
     }
 
-    if(max > *_max)
+    if(max > partial.max)
     {
-        *_max = max;
+        partial.max = max;
     }
 }
 
+template <typename T>
+void NEMinMaxKernel::minmax_count(const Window &win)
+{
+    MinMaxCount &partial   = _partial[win.thread_id()];
+    const bool   count_min = _min_count != nullptr;
+    const bool   count_max = _max_count != nullptr;
+
+    const int x_start = win.x().start();
+    const int width   = win.x().end() - x_start;
+
+    // Handle X dimension manually so that each row is reduced then counted
+    Window win_rows(win);
+    win_rows.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(_input, win_rows);
+
+    execute_window_loop(win_rows, [&](const Coordinates &)
+    {
+        const auto in_ptr = reinterpret_cast<const T *>(input.ptr()) + x_start;
+
+        T row_min;
+        T row_max;
+        row_min_max(in_ptr, width, row_min, row_max);
+
+        // Rows whose extrema are beaten by the ones already found don't need to be counted
+        if(row_min < partial.min)
+        {
+            partial.min       = row_min;
+            partial.min_count = count_min ? row_count(in_ptr, width, row_min) : 0;
+        }
+        else if(count_min && row_min == partial.min)
+        {
+            partial.min_count += row_count(in_ptr, width, row_min);
+        }
+
+        if(row_max > partial.max)
+        {
+            partial.max       = row_max;
+            partial.max_count = count_max ? row_count(in_ptr, width, row_max) : 0;
+        }
+        else if(count_max && row_max == partial.max)
+        {
+            partial.max_count += row_count(in_ptr, width, row_max);
+        }
+    },
+    input);
+}
+
 void NEMinMaxKernel::minmax_U8(const Window &win)
 {
     uint8x8_t carry_min = vdup_n_u8(UCHAR_MAX);
@@ -143,7 +352,7 @@ void NEMinMaxKernel::minmax_U8(const Window &win)
     const uint8_t max_i = vget_lane_u8(carry_max, 0);
 
     // Perform reduction of local min/max values
-    update_min_max(min_i, max_i);
+    update_min_max(min_i, max_i, win.thread_id());
 }
 
 void NEMinMaxKernel::minmax_S16(const Window &win)
@@ -177,17 +386,13 @@ void NEMinMaxKernel::minmax_S16(const Window &win)
     const int16_t max_i = vget_lane_s16(carry_max, 0);
 
     // Perform reduction of local min/max values
-    update_min_max(min_i, max_i);
+    update_min_max(min_i, max_i, win.thread_id());
 }
 
 NEMinMaxLocationKernel::NEMinMaxLocationKernel()
-    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr), _num_elems_processed_per_iteration(0)
-{
-}
-
-bool NEMinMaxLocationKernel::is_parallelisable() const
+    : _func(nullptr), _input(nullptr), _min(nullptr), _max(nullptr), _min_count(nullptr), _max_count(nullptr), _min_loc(nullptr), _max_loc(nullptr), _num_elems_processed_per_iteration(0),
+      _local()
 {
-    return false;
 }
 
 #ifndef DOXYGEN_SKIP_THIS /* Doxygen gets confused by the templates and can't match the implementation to the declaration */
@@ -283,28 +488,64 @@ void NEMinMaxLocationKernel::run(const Window &window)
     (this->*_func)(window);
 }
 
-template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
-void NEMinMaxLocationKernel::minmax_loc(const Window &win)
+void NEMinMaxLocationKernel::begin_reduction(unsigned int num_threads)
 {
-    if(count_min || count_max || loc_min || loc_max)
+    _local.reset(num_threads, LocalLocations());
+}
+
+void NEMinMaxLocationKernel::end_reduction()
+{
+    // The sub-windows are contiguous and ordered by thread, so concatenating the slots in order keeps the row order
+    const LocalLocations &locations = _local.reduce([](LocalLocations & dst, const LocalLocations & src)
     {
-        Iterator input(_input, win);
+        dst.min_loc.insert(dst.min_loc.end(), src.min_loc.begin(), src.min_loc.end());
+        dst.max_loc.insert(dst.max_loc.end(), src.max_loc.begin(), src.max_loc.end());
+        dst.min_count += src.min_count;
+        dst.max_count += src.max_count;
+    });
 
-        size_t       min_count = 0;
-        size_t       max_count = 0;
-        unsigned int step      = _num_elems_processed_per_iteration;
+    if(_min_loc != nullptr)
+    {
+        _min_loc->clear();
 
-        // Clear min location array
-        if(loc_min)
+        for(const auto &p : locations.min_loc)
         {
-            _min_loc->clear();
+            _min_loc->push_back(p);
         }
+    }
+
+    if(_max_loc != nullptr)
+    {
+        _max_loc->clear();
 
-        // Clear max location array
-        if(loc_max)
+        for(const auto &p : locations.max_loc)
         {
-            _max_loc->clear();
+            _max_loc->push_back(p);
         }
+    }
+
+    if(_min_count != nullptr)
+    {
+        *_min_count = locations.min_count;
+    }
+
+    if(_max_count != nullptr)
+    {
+        *_max_count = locations.max_count;
+    }
+}
+
+template <class T, bool count_min, bool count_max, bool loc_min, bool loc_max>
+void NEMinMaxLocationKernel::minmax_loc(const Window &win)
+{
+    if(count_min || count_max || loc_min || loc_max)
+    {
+        Iterator input(_input, win);
+
+        LocalLocations &local     = _local[win.thread_id()];
+        size_t          min_count = 0;
+        size_t          max_count = 0;
+        unsigned int    step      = _num_elems_processed_per_iteration;
 
         execute_window_loop(win, [&](const Coordinates & id)
         {
@@ -328,7 +569,7 @@ void NEMinMaxLocationKernel::minmax_loc(const Window &win)
 
                         if(loc_min)
                         {
-                            _min_loc->push_back(p);
+                            local.min_loc.push_back(p);
                         }
                     }
                 }
@@ -344,7 +585,7 @@ void NEMinMaxLocationKernel::minmax_loc(const Window &win)
 
                         if(loc_max)
                         {
-                            _max_loc->push_back(p);
+                            local.max_loc.push_back(p);
                         }
                     }
                 }
@@ -352,14 +593,8 @@ void NEMinMaxLocationKernel::minmax_loc(const Window &win)
         },
         input);
 
-        if(count_min)
-        {
-            *_min_count = min_count;
-        }
-
-        if(count_max)
-        {
-            *_max_count = max_count;
-        }
+        // Accumulate as a thread can run several sub-windows
+        local.min_count += min_count;
+        local.max_count += max_count;
     }
 }
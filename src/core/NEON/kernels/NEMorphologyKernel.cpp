@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEMorphologyKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr int num_elems_per_vector = 16;
+
+template <bool is_max>
+inline uint8_t min_max(uint8_t a, uint8_t b)
+{
+    return is_max ? std::max(a, b) : std::min(a, b);
+}
+
+template <bool is_max>
+inline uint8x16_t vmin_max(uint8x16_t a, uint8x16_t b)
+{
+    return is_max ? vmaxq_u8(a, b) : vminq_u8(a, b);
+}
+
+/** Compute the minimum / maximum of each run of @p size consecutive pixels of a row
+ *
+ * The row is split in blocks of @p size pixels; @p g stores the running minimum / maximum from the start of each block
+ * and @p h the one from the end of each block, so every run straddles 2 blocks and only needs one more comparison.
+ *
+ * @param[in]  src   Pointer to the first pixel of the row. (width + size - 1) pixels are read
+ * @param[out] dst   Pointer to the output row. @p width pixels are written
+ * @param[in]  width Number of output pixels
+ * @param[in]  size  Number of pixels of each run
+ * @param[out] g     Scratch buffer of (width + size - 1) elements
+ * @param[out] h     Scratch buffer of (width + size - 1) elements
+ */
+template <bool is_max>
+void filter_row(const uint8_t *__restrict src, uint8_t *__restrict dst, int width, int size, uint8_t *__restrict g, uint8_t *__restrict h)
+{
+    const int length = width + size - 1;
+
+    for(int b = 0; b < length; b += size)
+    {
+        const int e = std::min(b + size, length);
+
+        g[b] = src[b];
+        for(int i = b + 1; i < e; ++i)
+        {
+            g[i] = min_max<is_max>(g[i - 1], src[i]);
+        }
+
+        h[e - 1] = src[e - 1];
+        for(int i = e - 2; i >= b; --i)
+        {
+            h[i] = min_max<is_max>(h[i + 1], src[i]);
+        }
+    }
+
+    int x = 0;
+    for(; x <= width - num_elems_per_vector; x += num_elems_per_vector)
+    {
+        vst1q_u8(dst + x, vmin_max<is_max>(vld1q_u8(h + x), vld1q_u8(g + x + size - 1)));
+    }
+
+    for(; x < width; ++x)
+    {
+        dst[x] = min_max<is_max>(h[x], g[x + size - 1]);
+    }
+}
+
+/** Compute the minimum / maximum of each run of @p size consecutive rows for 16 columns
+ *
+ * Same as @ref filter_row along Y, each lane of the vectors processing one column.
+ *
+ * @param[in]  src        Pointer to the first pixel of the columns. (height + size - 1) rows are read
+ * @param[in]  src_stride Stride of the source in bytes
+ * @param[out] dst        Pointer to the first output pixel of the columns. @p height rows are written
+ * @param[in]  dst_stride Stride of the destination in bytes
+ * @param[in]  height     Number of output rows
+ * @param[in]  size       Number of rows of each run
+ * @param[out] g          Scratch buffer of (height + size - 1) * 16 elements
+ * @param[out] h          Scratch buffer of (height + size - 1) * 16 elements
+ */
+template <bool is_max>
+void filter_columns(const uint8_t *__restrict src, size_t src_stride, uint8_t *__restrict dst, size_t dst_stride, int height, int size, uint8_t *__restrict g, uint8_t *__restrict h)
+{
+    const int length = height + size - 1;
+
+    for(int b = 0; b < length; b += size)
+    {
+        const int e = std::min(b + size, length);
+
+        uint8x16_t acc = vld1q_u8(src + b * src_stride);
+        vst1q_u8(g + b * num_elems_per_vector, acc);
+        for(int i = b + 1; i < e; ++i)
+        {
+            acc = vmin_max<is_max>(acc, vld1q_u8(src + i * src_stride));
+            vst1q_u8(g + i * num_elems_per_vector, acc);
+        }
+
+        acc = vld1q_u8(src + (e - 1) * src_stride);
+        vst1q_u8(h + (e - 1) * num_elems_per_vector, acc);
+        for(int i = e - 2; i >= b; --i)
+        {
+            acc = vmin_max<is_max>(acc, vld1q_u8(src + i * src_stride));
+            vst1q_u8(h + i * num_elems_per_vector, acc);
+        }
+    }
+
+    for(int y = 0; y < height; ++y)
+    {
+        vst1q_u8(dst + y * dst_stride, vmin_max<is_max>(vld1q_u8(h + y * num_elems_per_vector), vld1q_u8(g + (y + size - 1) * num_elems_per_vector)));
+    }
+}
+
+/** Compute the minimum / maximum over a rectangular structuring element for a block of pixels
+ *
+ * @param[in]  src        Pointer to the top-left pixel read, half the structuring element above and on the left of the first output pixel
+ * @param[in]  src_stride Stride of the source in bytes
+ * @param[out] dst        Pointer to the first output pixel. The width written is rounded up to a multiple of 16
+ * @param[in]  dst_stride Stride of the destination in bytes
+ * @param[in]  width      Number of output columns
+ * @param[in]  height     Number of output rows
+ * @param[in]  element    Size of the structuring element
+ */
+template <bool is_max>
+void filter_2d(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride, int width, int height, const Size2D &element)
+{
+    const int kw         = element.width;
+    const int kh         = element.height;
+    const int tmp_stride = ceil_to_multiple(width, num_elems_per_vector);
+    const int tmp_height = height + kh - 1;
+    const int scratch    = std::max(width + kw - 1, tmp_height * num_elems_per_vector);
+
+    // Rows filtered horizontally, read by the vertical pass
+    uint8_t *const tmp = thread_scratch<uint8_t>(tmp_stride * tmp_height, 0);
+    uint8_t *const g   = thread_scratch<uint8_t>(scratch, 1);
+    uint8_t *const h   = thread_scratch<uint8_t>(scratch, 2);
+    std::fill_n(tmp, tmp_stride * tmp_height, 0);
+
+    for(int y = 0; y < tmp_height; ++y)
+    {
+        filter_row<is_max>(src + y * src_stride, tmp + y * tmp_stride, width, kw, g, h);
+    }
+
+    for(int x = 0; x < tmp_stride; x += num_elems_per_vector)
+    {
+        filter_columns<is_max>(tmp + x, tmp_stride, dst + x, dst_stride, height, kh, g, h);
+    }
+}
+
+/** Chain two opposite operations (Erode then dilate if @p first_is_max is false, dilate then erode otherwise)
+ *
+ * The first operation is computed in a local buffer for all the pixels the second one reads.
+ */
+template <bool first_is_max>
+void filter_2d_chain(const uint8_t *src, size_t src_stride, uint8_t *dst, size_t dst_stride, int width, int height, const Size2D &element)
+{
+    const int stage_width  = width + element.width - 1;
+    const int stage_height = height + element.height - 1;
+    const int stage_stride = ceil_to_multiple(stage_width, num_elems_per_vector);
+
+    // The buffers of filter_2d() use the first scratch slots
+    uint8_t *const stage = thread_scratch<uint8_t>(stage_stride * stage_height, 3);
+
+    filter_2d<first_is_max>(src, src_stride, stage, stage_stride, stage_width, stage_height, element);
+    filter_2d<!first_is_max>(stage, stage_stride, dst, dst_stride, width, height, element);
+}
+} // namespace
+
+NEMorphologyKernel::NEMorphologyKernel()
+    : _input(nullptr), _output(nullptr), _operation(MorphologyOperation::ERODE), _structuring_element(), _border_size(0)
+{
+}
+
+BorderSize NEMorphologyKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEMorphologyKernel::configure(const ITensor *input, ITensor *output, MorphologyOperation operation, const Size2D &structuring_element, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON((structuring_element.width % 2) == 0 || (structuring_element.height % 2) == 0);
+
+    const bool         is_chain  = (MorphologyOperation::OPEN == operation) || (MorphologyOperation::CLOSE == operation);
+    const unsigned int num_steps = is_chain ? 2 : 1;
+
+    _input               = input;
+    _output              = output;
+    _operation           = operation;
+    _structuring_element = structuring_element;
+    _border_size         = BorderSize(num_steps * (structuring_element.height / 2), num_steps * (structuring_element.width / 2));
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = num_elems_per_vector;
+    const unsigned int     num_elems_read_per_iteration      = num_elems_processed_per_iteration + _border_size.left + _border_size.right;
+    const unsigned int     num_rows_read_per_iteration       = 1 + _border_size.top + _border_size.bottom;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -_border_size.left, -_border_size.top, num_elems_read_per_iteration, num_rows_read_per_iteration),
+                              output_access);
+
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NEMorphologyKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.y().step() != 1);
+
+    // The sub-window is processed as a single band of rows
+    const int      width      = window.x().end() - window.x().start();
+    const int      height     = window.y().end() - window.y().start();
+    const size_t   in_stride  = _input->info()->strides_in_bytes()[Window::DimY];
+    const size_t   out_stride = _output->info()->strides_in_bytes()[Window::DimY];
+    const uint8_t *in_ptr     = _input->ptr_to_element(Coordinates(window.x().start() - static_cast<int>(_border_size.left), window.y().start() - static_cast<int>(_border_size.top)));
+    uint8_t       *out_ptr    = _output->ptr_to_element(Coordinates(window.x().start(), window.y().start()));
+
+    switch(_operation)
+    {
+        case MorphologyOperation::ERODE:
+            filter_2d<false>(in_ptr, in_stride, out_ptr, out_stride, width, height, _structuring_element);
+            break;
+        case MorphologyOperation::DILATE:
+            filter_2d<true>(in_ptr, in_stride, out_ptr, out_stride, width, height, _structuring_element);
+            break;
+        case MorphologyOperation::OPEN:
+            filter_2d_chain<false>(in_ptr, in_stride, out_ptr, out_stride, width, height, _structuring_element);
+            break;
+        case MorphologyOperation::CLOSE:
+            filter_2d_chain<true>(in_ptr, in_stride, out_ptr, out_stride, width, height, _structuring_element);
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Morphological operation not supported");
+            break;
+    }
+}
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NENonLinearFilterHistogramKernel.h"
+
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/IAccessWindow.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <array>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_bins        = 256;
+constexpr unsigned int num_coarse_bins = 16;
+constexpr unsigned int coarse_shift    = 4;
+
+/** Add the histogram @p add to the histogram @p hist (Both having @p size bins, a multiple of 8) */
+template <unsigned int size>
+inline void add_histogram(uint16_t *__restrict hist, const uint16_t *__restrict add)
+{
+    for(unsigned int i = 0; i < size; i += 8)
+    {
+        vst1q_u16(hist + i, vaddq_u16(vld1q_u16(hist + i), vld1q_u16(add + i)));
+    }
+}
+
+/** Add the histogram @p add to and subtract the histogram @p sub from the histogram @p hist (All having @p size bins, a multiple of 8) */
+template <unsigned int size>
+inline void slide_histogram(uint16_t *__restrict hist, const uint16_t *__restrict add, const uint16_t *__restrict sub)
+{
+    for(unsigned int i = 0; i < size; i += 8)
+    {
+        vst1q_u16(hist + i, vsubq_u16(vaddq_u16(vld1q_u16(hist + i), vld1q_u16(add + i)), vld1q_u16(sub + i)));
+    }
+}
+
+/** Find the value of the given rank (0 being the minimum) in a histogram and its coarse version */
+inline uint8_t find_rank(const uint16_t *coarse, const uint16_t *fine, unsigned int rank)
+{
+    unsigned int sum = 0;
+    unsigned int cb  = 0;
+
+    // Find the coarse bin which contains the value
+    for(; cb < num_coarse_bins - 1 && sum + coarse[cb] <= rank; ++cb)
+    {
+        sum += coarse[cb];
+    }
+
+    // Find the value within the 16 fine bins of the coarse bin
+    unsigned int       b     = cb << coarse_shift;
+    const unsigned int b_end = b + (1 << coarse_shift) - 1;
+
+    for(; b < b_end && sum + fine[b] <= rank; ++b)
+    {
+        sum += fine[b];
+    }
+
+    return static_cast<uint8_t>(b);
+}
+} // namespace
+
+NENonLinearFilterHistogramKernel::NENonLinearFilterHistogramKernel()
+    : _input(nullptr), _output(nullptr), _mask_size(0), _rank(0), _border_size(0)
+{
+}
+
+BorderSize NENonLinearFilterHistogramKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NENonLinearFilterHistogramKernel::configure(const ITensor *input, ITensor *output, NonLinearFilterFunction function, unsigned int mask_size, bool border_undefined)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(mask_size < 3 || mask_size > 31 || (mask_size % 2) == 0);
+
+    const unsigned int num_elems = mask_size * mask_size;
+
+    _input       = input;
+    _output      = output;
+    _mask_size   = mask_size;
+    _border_size = BorderSize(mask_size / 2);
+
+    switch(function)
+    {
+        case NonLinearFilterFunction::MIN:
+            _rank = 0;
+            break;
+        case NonLinearFilterFunction::MAX:
+            _rank = num_elems - 1;
+            break;
+        case NonLinearFilterFunction::MEDIAN:
+            _rank = num_elems / 2;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Non linear function not supported");
+            break;
+    }
+
+    // Configure kernel window
+    constexpr unsigned int num_elems_processed_per_iteration = 1;
+
+    Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration), border_undefined, border_size());
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    update_window_and_padding(win,
+                              AccessWindowRectangle(input->info(), -border_size().left, -border_size().top, mask_size, mask_size),
+                              output_access);
+    output_access.set_valid_region(win, input->info()->valid_region(), border_undefined, border_size());
+
+    INEKernel::configure(win);
+}
+
+void NENonLinearFilterHistogramKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(window.x().step() != 1 || window.y().step() != 1);
+
+    const int    radius   = _border_size.left;
+    const int    x_start  = window.x().start();
+    const int    width    = window.x().end() - x_start;
+    const int    num_cols = width + 2 * radius;
+    const size_t stride   = _input->info()->strides_in_bytes()[Window::DimY];
+
+    // Histograms of the mask_size rows around the current row, for each column read by the band
+    uint16_t *const col_fine   = thread_scratch<uint16_t>(num_cols * num_bins, 0);
+    uint16_t *const col_coarse = thread_scratch<uint16_t>(num_cols * num_coarse_bins, 1);
+    std::fill_n(col_fine, num_cols * num_bins, 0);
+    std::fill_n(col_coarse, num_cols * num_coarse_bins, 0);
+
+    // Histograms of the whole mask around the current pixel
+    std::array<uint16_t, num_bins>        fine{ {} };
+    std::array<uint16_t, num_coarse_bins> coarse{ {} };
+
+    // Start with the column histograms of the top rows of the mask, the bottom row is added by the first row of the band
+    const uint8_t *band_ptr = _input->ptr_to_element(Coordinates(x_start - radius, window.y().start() - radius));
+
+    for(int yc = 0; yc < 2 * radius; ++yc)
+    {
+        const uint8_t *row_ptr = band_ptr + yc * stride;
+
+        for(int c = 0; c < num_cols; ++c)
+        {
+            ++col_fine[c * num_bins + row_ptr[c]];
+            ++col_coarse[c * num_coarse_bins + (row_ptr[c] >> coarse_shift)];
+        }
+    }
+
+    for(int y = window.y().start(); y < window.y().end(); ++y)
+    {
+        const uint8_t *bottom_ptr = _input->ptr_to_element(Coordinates(x_start - radius, y + radius));
+        const uint8_t *top_ptr    = bottom_ptr - _mask_size * stride;
+        uint8_t       *out_ptr    = _output->ptr_to_element(Coordinates(x_start, y));
+
+        // Move the column histograms down: add the bottom row of the mask and remove the row above the mask
+        for(int c = 0; c < num_cols; ++c)
+        {
+            ++col_fine[c * num_bins + bottom_ptr[c]];
+            ++col_coarse[c * num_coarse_bins + (bottom_ptr[c] >> coarse_shift)];
+        }
+
+        if(y != window.y().start())
+        {
+            for(int c = 0; c < num_cols; ++c)
+            {
+                --col_fine[c * num_bins + top_ptr[c]];
+                --col_coarse[c * num_coarse_bins + (top_ptr[c] >> coarse_shift)];
+            }
+        }
+
+        // Histogram of the mask around the first pixel of the row
+        std::fill(fine.begin(), fine.end(), 0);
+        std::fill(coarse.begin(), coarse.end(), 0);
+
+        for(unsigned int c = 0; c < _mask_size; ++c)
+        {
+            add_histogram<num_bins>(fine.data(), col_fine + c * num_bins);
+            add_histogram<num_coarse_bins>(coarse.data(), col_coarse + c * num_coarse_bins);
+        }
+
+        for(int x = 0; x < width; ++x)
+        {
+            out_ptr[x] = find_rank(coarse.data(), fine.data(), _rank);
+
+            // Slide the mask to the right: add the column entering the mask and remove the column leaving it
+            if(x + 1 < width)
+            {
+                const int add_col = x + _mask_size;
+
+                slide_histogram<num_bins>(fine.data(), col_fine + add_col * num_bins, col_fine + x * num_bins);
+                slide_histogram<num_coarse_bins>(coarse.data(), col_coarse + add_col * num_coarse_bins, col_coarse + x * num_coarse_bins);
+            }
+        }
+    }
+}
@@ -44,10 +44,18 @@ BorderSize NENormalizationLayerKernel::border_size() const
 
 void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *input_squared, ITensor *output, NormalizationLayerInfo norm_info)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON_MSG(!(norm_info.norm_size() % 2), "Normalization size should be odd");
+    ARM_COMPUTE_ERROR_ON_MSG(input_squared == nullptr && norm_info.type() != NormType::CROSS_MAP, "The squared input is required by the in map normalization");
+    if(input_squared != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, input_squared);
+    }
+
+    // Without the squared input, the cross map normalization slides its window across all the feature maps in a single iteration
+    const bool is_sliding = (input_squared == nullptr);
 
     const unsigned int border_width = (norm_info.type() == NormType::IN_MAP) ? 3 : 0;
 
@@ -55,22 +63,70 @@ void NENormalizationLayerKernel::configure(const ITensor *input, const ITensor *
     _input_squared = input_squared;
     _output        = output;
     _norm_info     = norm_info;
-    _func          = (norm_info.type() == NormType::IN_MAP) ? &NENormalizationLayerKernel::normalize<0> : &NENormalizationLayerKernel::normalize<2>;
     _border_size   = BorderSize(0, border_width);
 
-    constexpr unsigned int num_elems_processed_per_iteration = 4;
-    const unsigned int     num_elems_read_per_iteration      = num_elems_processed_per_iteration + 2 * (norm_info.norm_size() / 2);
+    unsigned int num_elems_processed_per_iteration = 4;
+
+    switch(input->info()->data_type())
+    {
+        case DataType::F32:
+        {
+            if(is_sliding)
+            {
+                _func = &NENormalizationLayerKernel::normalize_cross_map_sliding;
+            }
+            else
+            {
+                _func = (norm_info.type() == NormType::IN_MAP) ? &NENormalizationLayerKernel::normalize<0> : &NENormalizationLayerKernel::normalize<2>;
+            }
+            break;
+        }
+        case DataType::F16:
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+        {
+            num_elems_processed_per_iteration = 8;
+            if(is_sliding)
+            {
+                _func = &NENormalizationLayerKernel::normalize_cross_map_sliding_f16;
+            }
+            else
+            {
+                _func = (norm_info.type() == NormType::IN_MAP) ? &NENormalizationLayerKernel::normalize_f16<0> : &NENormalizationLayerKernel::normalize_f16<2>;
+            }
+            break;
+        }
+#endif
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+    }
 
     // Configure window
     Window win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
 
-    AccessWindowHorizontal input_access(input->info(), -_border_size.left, num_elems_read_per_iteration);
-    AccessWindowHorizontal input_squared_access(input_squared->info(), -_border_size.left, num_elems_read_per_iteration);
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    if(is_sliding)
+    {
+        // All the feature maps are processed by the same iteration
+        win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+        AccessWindowHorizontal input_access(input->info(), 0, num_elems_processed_per_iteration);
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+        update_window_and_padding(win, input_access, output_access);
+
+        output->info()->set_valid_region(input->info()->valid_region());
+    }
+    else
+    {
+        const unsigned int num_elems_read_per_iteration = num_elems_processed_per_iteration + 2 * (norm_info.norm_size() / 2);
+
+        AccessWindowHorizontal input_access(input->info(), -_border_size.left, num_elems_read_per_iteration);
+        AccessWindowHorizontal input_squared_access(input_squared->info(), -_border_size.left, num_elems_read_per_iteration);
+        AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
 
-    update_window_and_padding(win, input_access, input_squared_access, output_access);
+        update_window_and_padding(win, input_access, input_squared_access, output_access);
 
-    output_access.set_valid_region(win, input->info()->valid_region());
+        output_access.set_valid_region(win, input->info()->valid_region());
+    }
 
     INEKernel::configure(win);
 }
@@ -115,6 +171,167 @@ void NENormalizationLayerKernel::normalize(const Window &window)
     input, input_squared, output);
 }
 
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+template <unsigned int dim>
+void NENormalizationLayerKernel::normalize_f16(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator input_squared(_input_squared, window);
+    Iterator output(_output, window);
+
+    const int radius               = _norm_info.norm_size() / 2;
+    const int total_size           = _input->info()->dimension(dim) - 1;
+    const int input_squared_stride = _input_squared->info()->strides_in_bytes()[dim];
+    // We account padding when we normalize across X
+    const int min_left  = (dim == 0) ? -static_cast<int>(border_size().left) : 0;
+    const int max_right = (dim == 0) ? total_size + border_size().left : total_size;
+
+    const float32x4_t coeff_vec = vdupq_n_f32(_norm_info.scale_coeff());
+    const float32x4_t beta_vec  = vdupq_n_f32(_norm_info.beta());
+    const float32x4_t kappa_vec = vdupq_n_f32(_norm_info.kappa());
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Get range to normalize
+        const int current_slice = id[dim];
+        const int first_slice   = std::max(current_slice - radius, min_left);
+        const int last_slice    = std::min(current_slice + radius, max_right);
+
+        // Accumulate cross map values in single precision, as the sum of the squares easily exceeds the range of F16
+        float32x4_t accu_low  = vdupq_n_f32(0.f);
+        float32x4_t accu_high = vdupq_n_f32(0.f);
+        for(int i = first_slice; i <= last_slice; ++i)
+        {
+            const float16x8_t squared = vld1q_f16(reinterpret_cast<const float16_t *>(input_squared.ptr() + (i - current_slice) * input_squared_stride));
+            accu_low                  = vaddq_f32(accu_low, vcvt_f32_f16(vget_low_f16(squared)));
+            accu_high                 = vaddq_f32(accu_high, vcvt_f32_f16(vget_high_f16(squared)));
+        }
+
+        // Normalize
+        const float16x8_t pixel     = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr()));
+        const float32x4_t norm_low  = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, accu_low), beta_vec);
+        const float32x4_t norm_high = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, accu_high), beta_vec);
+        const float32x4_t res_low   = vmulq_f32(vcvt_f32_f16(vget_low_f16(pixel)), vinvq_f32(norm_low));
+        const float32x4_t res_high  = vmulq_f32(vcvt_f32_f16(vget_high_f16(pixel)), vinvq_f32(norm_high));
+        vst1q_f16(reinterpret_cast<float16_t *>(output.ptr()), vcombine_f16(vcvt_f16_f32(res_low), vcvt_f16_f32(res_high)));
+    },
+    input, input_squared, output);
+}
+#endif
+
+void NENormalizationLayerKernel::normalize_cross_map_sliding(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const int    radius     = _norm_info.norm_size() / 2;
+    const int    num_maps   = _input->info()->dimension(2);
+    const size_t in_stride  = _input->info()->strides_in_bytes()[2];
+    const size_t out_stride = _output->info()->strides_in_bytes()[2];
+
+    const float32x4_t coeff_vec = vdupq_n_f32(_norm_info.scale_coeff());
+    const float32x4_t beta_vec  = vdupq_n_f32(_norm_info.beta());
+    const float32x4_t kappa_vec = vdupq_n_f32(_norm_info.kappa());
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto load_map = [&](int map)
+        {
+            return vld1q_f32(reinterpret_cast<const float *>(input.ptr() + map * in_stride));
+        };
+
+        // Sum of the squares of the feature maps [map - radius, map + radius] inside the tensor
+        float32x4_t accu = vdupq_n_f32(0.f);
+        for(int map = 0; map < std::min(radius, num_maps); ++map)
+        {
+            const float32x4_t value = load_map(map);
+            accu                    = vmlaq_f32(accu, value, value);
+        }
+
+        for(int map = 0; map < num_maps; ++map)
+        {
+            // Slide the window: add the feature map entering it and subtract the one leaving it
+            if(map + radius < num_maps)
+            {
+                const float32x4_t entering = load_map(map + radius);
+                accu                       = vmlaq_f32(accu, entering, entering);
+            }
+            if(map - radius - 1 >= 0)
+            {
+                const float32x4_t leaving = load_map(map - radius - 1);
+                accu                      = vmlsq_f32(accu, leaving, leaving);
+            }
+
+            // Normalize: the rounding errors of the subtractions must not make the sum negative
+            const float32x4_t normalized = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, vmaxq_f32(accu, vdupq_n_f32(0.f))), beta_vec);
+            vst1q_f32(reinterpret_cast<float *>(output.ptr() + map * out_stride), vmulq_f32(load_map(map), vinvq_f32(normalized)));
+        }
+    },
+    input, output);
+}
+
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+void NENormalizationLayerKernel::normalize_cross_map_sliding_f16(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const int    radius     = _norm_info.norm_size() / 2;
+    const int    num_maps   = _input->info()->dimension(2);
+    const size_t in_stride  = _input->info()->strides_in_bytes()[2];
+    const size_t out_stride = _output->info()->strides_in_bytes()[2];
+
+    const float32x4_t coeff_vec = vdupq_n_f32(_norm_info.scale_coeff());
+    const float32x4_t beta_vec  = vdupq_n_f32(_norm_info.beta());
+    const float32x4_t kappa_vec = vdupq_n_f32(_norm_info.kappa());
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto load_map = [&](int map)
+        {
+            const float16x8_t value = vld1q_f16(reinterpret_cast<const float16_t *>(input.ptr() + map * in_stride));
+            return float32x4x2_t{ { vcvt_f32_f16(vget_low_f16(value)), vcvt_f32_f16(vget_high_f16(value)) } };
+        };
+
+        // Sum of the squares of the feature maps [map - radius, map + radius] inside the tensor, accumulated in single precision
+        float32x4_t accu_low  = vdupq_n_f32(0.f);
+        float32x4_t accu_high = vdupq_n_f32(0.f);
+        for(int map = 0; map < std::min(radius, num_maps); ++map)
+        {
+            const float32x4x2_t value = load_map(map);
+            accu_low                  = vmlaq_f32(accu_low, value.val[0], value.val[0]);
+            accu_high                 = vmlaq_f32(accu_high, value.val[1], value.val[1]);
+        }
+
+        for(int map = 0; map < num_maps; ++map)
+        {
+            // Slide the window: add the feature map entering it and subtract the one leaving it
+            if(map + radius < num_maps)
+            {
+                const float32x4x2_t entering = load_map(map + radius);
+                accu_low                     = vmlaq_f32(accu_low, entering.val[0], entering.val[0]);
+                accu_high                    = vmlaq_f32(accu_high, entering.val[1], entering.val[1]);
+            }
+            if(map - radius - 1 >= 0)
+            {
+                const float32x4x2_t leaving = load_map(map - radius - 1);
+                accu_low                    = vmlsq_f32(accu_low, leaving.val[0], leaving.val[0]);
+                accu_high                   = vmlsq_f32(accu_high, leaving.val[1], leaving.val[1]);
+            }
+
+            // Normalize: the rounding errors of the subtractions must not make the sum negative
+            const float32x4x2_t pixel     = load_map(map);
+            const float32x4_t   norm_low  = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, vmaxq_f32(accu_low, vdupq_n_f32(0.f))), beta_vec);
+            const float32x4_t   norm_high = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, vmaxq_f32(accu_high, vdupq_n_f32(0.f))), beta_vec);
+            const float32x4_t   res_low   = vmulq_f32(pixel.val[0], vinvq_f32(norm_low));
+            const float32x4_t   res_high  = vmulq_f32(pixel.val[1], vinvq_f32(norm_high));
+            vst1q_f16(reinterpret_cast<float16_t *>(output.ptr() + map * out_stride), vcombine_f16(vcvt_f16_f32(res_low), vcvt_f16_f32(res_high)));
+        }
+    },
+    input, output);
+}
+#endif
+
 void NENormalizationLayerKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -124,3 +341,8 @@ void NENormalizationLayerKernel::run(const Window &window)
     // Run function
     (this->*_func)(window);
 }
+
+SchedulingPolicy NENormalizationLayerKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
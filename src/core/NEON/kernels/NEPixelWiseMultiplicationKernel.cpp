@@ -27,6 +27,7 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IAccessWindow.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEFP16Storage.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/functions/NEPixelWiseMultiplication.h"
@@ -218,6 +219,41 @@ void mul_F32_F32_F32_n(const void *__restrict input1_ptr, const void *__restrict
     vst4q_f32(output, result);
 }
 
+template <bool is_scale255, bool is_sat>
+void mul_F16_F16_F16_n(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, float scale)
+{
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    const auto input1 = static_cast<const float16_t *__restrict>(input1_ptr);
+    const auto input2 = static_cast<const float16_t *__restrict>(input2_ptr);
+    const auto output = static_cast<float16_t *__restrict>(output_ptr);
+
+    const float16x8x2_t ta1       = vld2q_f16(input1);
+    const float16x8x2_t ta2       = vld2q_f16(input2);
+    const float16x8_t   scale_vec = vdupq_n_f16(scale);
+    const float16x8x2_t result =
+    {
+        {
+            vmulq_f16(vmulq_f16(ta1.val[0], ta2.val[0]), scale_vec),
+            vmulq_f16(vmulq_f16(ta1.val[1], ta2.val[1]), scale_vec)
+        }
+    };
+    vst2q_f16(output, result);
+#elif defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+    const auto input1 = static_cast<const float16_t *__restrict>(input1_ptr);
+    const auto input2 = static_cast<const float16_t *__restrict>(input2_ptr);
+    const auto output = static_cast<float16_t *__restrict>(output_ptr);
+
+    // Without the half precision arithmetic the products are computed in single precision
+    const float32x4_t scale_vec = vdupq_n_f32(scale);
+    for(int i = 0; i < 16; i += 4)
+    {
+        vstore_f32(output + i, vmulq_f32(vmulq_f32(vload_f32(input1 + i), vload_f32(input2 + i)), scale_vec));
+    }
+#else
+    ARM_COMPUTE_ERROR("Not implemented");
+#endif
+}
+
 template <bool is_scale255, bool is_sat>
 void mul_U8_U8_S16_n(const void *__restrict input1_ptr, const void *__restrict input2_ptr, void *__restrict output_ptr, int n)
 {
@@ -303,9 +339,9 @@ NEPixelWiseMultiplicationKernel::NEPixelWiseMultiplicationKernel()
 
 void NEPixelWiseMultiplicationKernel::configure(const ITensor *input1, const ITensor *input2, ITensor *output, float scale, ConvertPolicy overflow_policy, RoundingPolicy rounding_policy)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8, DataType::S16, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input2, 1, DataType::U8, DataType::S16, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input1, 1, DataType::U8, DataType::S16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input2, 1, DataType::U8, DataType::S16, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MSG(output->info()->data_type() == DataType::U8 && (input1->info()->data_type() != DataType::U8 || input2->info()->data_type() != DataType::U8),
                              "Output can only be U8 if both inputs are U8");
 
@@ -414,20 +450,23 @@ void NEPixelWiseMultiplicationKernel::configure(const ITensor *input1, const ITe
         _func_float = &mul_F32_F32_F32_n<false, false>;
         _func_int   = nullptr;
     }
+    else if(DataType::F16 == dt_input1 && DataType::F16 == dt_input2 && DataType::F16 == dt_output)
+    {
+        _func_float = &mul_F16_F16_F16_n<false, false>;
+        _func_int   = nullptr;
+    }
     else
     {
         ARM_COMPUTE_ERROR("You called with the wrong img formats");
     }
 
-    constexpr unsigned int num_elems_processed_per_iteration = 16;
-
-    // Configure kernel window
-    Window                 win = calculate_max_window(*input1->info(), Steps(num_elems_processed_per_iteration));
-    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    // Configure kernel window: the end of the rows is handled by execute_elementwise_loop() so no padding is needed
+    Window                 win = calculate_max_window(*input1->info(), Steps());
+    AccessWindowHorizontal output_access(output->info(), 0, 1);
 
     update_window_and_padding(win,
-                              AccessWindowHorizontal(input1->info(), 0, num_elems_processed_per_iteration),
-                              AccessWindowHorizontal(input2->info(), 0, num_elems_processed_per_iteration),
+                              AccessWindowHorizontal(input1->info(), 0, 1),
+                              AccessWindowHorizontal(input2->info(), 0, 1),
                               output_access);
 
     ValidRegion valid_region = intersect_valid_regions(input1->info()->valid_region(),
@@ -443,25 +482,24 @@ void NEPixelWiseMultiplicationKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
-    Iterator input1(_input1, window);
-    Iterator input2(_input2, window);
-    Iterator output(_output, window);
+    // Elementwise: run a single loop over the rows of the window if the tensors have no padding between them
+    const Window win = collapse_window(window, *_input1->info(), *_input2->info(), *_output->info());
 
     if(_func_int != nullptr)
     {
-        execute_window_loop(window, [&](const Coordinates & id)
+        execute_elementwise_loop<16>(win, [&](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
         {
-            (*_func_int)(input1.ptr(), input2.ptr(), output.ptr(), _scale_exponent);
+            (*_func_int)(input1_ptr, input2_ptr, output_ptr, _scale_exponent);
         },
-        input1, input2, output);
+        _input1, _input2, _output);
     }
     else
     {
         ARM_COMPUTE_ERROR_ON(_func_float == nullptr);
-        execute_window_loop(window, [&](const Coordinates & id)
+        execute_elementwise_loop<16>(win, [&](const uint8_t *input1_ptr, const uint8_t *input2_ptr, uint8_t *output_ptr)
         {
-            (*_func_float)(input1.ptr(), input2.ptr(), output.ptr(), _scale);
+            (*_func_float)(input1_ptr, input2_ptr, output_ptr, _scale);
         },
-        input1, input2, output);
+        _input1, _input2, _output);
     }
 }
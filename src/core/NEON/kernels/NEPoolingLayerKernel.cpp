@@ -27,6 +27,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEFP16Storage.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
@@ -51,6 +52,63 @@ inline float calculate_avg_scale(const Coordinates &id, const int pool_size, con
     int end_y   = std::min(start_y + pool_size, upper_bound_h);
     return 1.f / ((end_y - start_y) * (end_x - start_x));
 }
+
+/** Reduce two vectors of partial results of a pooling operation.
+ *
+ * @param[in] a First vector.
+ * @param[in] b Second vector.
+ *
+ * @return The element-wise maximum of @p a and @p b for max pooling, their sum for average pooling.
+ */
+template <PoolingType pooling_type>
+inline float32x4_t vpoolq_f32(const float32x4_t &a, const float32x4_t &b)
+{
+    return (pooling_type == PoolingType::AVG) ? vaddq_f32(a, b) : vmaxq_f32(a, b);
+}
+
+/** Reduce two partial results of a pooling operation.
+ *
+ * @param[in] a First value.
+ * @param[in] b Second value.
+ *
+ * @return The maximum of @p a and @p b for max pooling, their sum for average pooling.
+ */
+template <PoolingType pooling_type>
+inline float pool_f32(float a, float b)
+{
+    return (pooling_type == PoolingType::AVG) ? a + b : std::max(a, b);
+}
+
+/** Reduce the 4 lanes of a vector of partial results of a pooling operation.
+ *
+ * @param[in] a Vector to reduce.
+ *
+ * @return The maximum of the lanes of @p a for max pooling, their sum for average pooling.
+ */
+template <PoolingType pooling_type>
+inline float vreduceq_f32(const float32x4_t &a)
+{
+    float32x2_t res = vget_low_f32(a);
+    if(pooling_type == PoolingType::AVG)
+    {
+        res = vpadd_f32(vadd_f32(res, vget_high_f32(a)), res);
+    }
+    else
+    {
+        res = vpmax_f32(vmax_f32(res, vget_high_f32(a)), res);
+    }
+    return vget_lane_f32(res, 0);
+}
+
+/** Identity value of the reduction of a pooling operation.
+ *
+ * @return The lowest float for max pooling, 0 for average pooling.
+ */
+template <PoolingType pooling_type>
+inline float pool_init_f32()
+{
+    return (pooling_type == PoolingType::AVG) ? 0.f : std::numeric_limits<float>::lowest();
+}
 } // namespace
 
 NEPoolingLayerKernel::NEPoolingLayerKernel()
@@ -78,10 +136,89 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     std::tie(pool_pad_x, pool_pad_y)       = pad_stride_info.pad();
     std::tie(pool_stride_x, pool_stride_y) = pad_stride_info.stride();
 
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
-    ARM_COMPUTE_ERROR_ON(2 != pool_size && 3 != pool_size);
+
+    const DataLayout data_layout = input->info()->data_layout();
+    if(data_layout != DataLayout::NCHW)
+    {
+        // NCHW4 tensors hold 4 values per element along X
+        const bool         is_nhwc       = (data_layout == DataLayout::NHWC);
+        const unsigned int elem_size     = is_nhwc ? 1 : 4;
+        const size_t       idx_w         = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+        const size_t       idx_h         = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+        const size_t       idx_c         = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+        const unsigned int output_width  = output->info()->dimension(idx_w) / elem_size;
+        const unsigned int output_height = output->info()->dimension(idx_h);
+
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON(output->info()->data_layout() != data_layout);
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(idx_c) != input->info()->dimension(idx_c));
+        ARM_COMPUTE_UNUSED(idx_c);
+
+        if(pool_info.is_global_pooling())
+        {
+            ARM_COMPUTE_ERROR_ON((output_width != 1) || (output_height != 1));
+        }
+        else
+        {
+            ARM_COMPUTE_ERROR_ON(pool_pad_x >= pool_size || pool_pad_y >= pool_size);
+            std::tie(pooled_w, pooled_h) = scaled_dimensions(input->info()->dimension(idx_w) / elem_size, input->info()->dimension(idx_h),
+                                                             pool_size, pool_stride_x, pool_stride_y,
+                                                             pool_pad_x, pool_pad_y, pool_round);
+            ARM_COMPUTE_ERROR_ON((output_width != pooled_w) || (output_height != pooled_h));
+        }
+        ARM_COMPUTE_UNUSED(output_width);
+        ARM_COMPUTE_UNUSED(output_height);
+
+        _input       = input;
+        _output      = output;
+        _pool_info   = pool_info;
+        _border_size = BorderSize(0);
+        if(is_nhwc)
+        {
+            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling_nhwc<PoolingType::AVG> : &NEPoolingLayerKernel::pooling_nhwc<PoolingType::MAX>;
+        }
+        else
+        {
+            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling_nchw4<PoolingType::AVG> : &NEPoolingLayerKernel::pooling_nchw4<PoolingType::MAX>;
+        }
+
+        // Each iteration computes all the feature maps of an output element (NHWC) or a block of 4 of them (NCHW4) and only reads the valid part of the pooling region:
+        // neither the input nor the output need any padding.
+        Window win = calculate_max_window(*output->info(), Steps(elem_size));
+        if(is_nhwc)
+        {
+            win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        }
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
+    if(pool_info.is_global_pooling())
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != 1) || (output->info()->dimension(1) != 1));
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2));
+
+        _input       = input;
+        _output      = output;
+        _pool_info   = pool_info;
+        _border_size = BorderSize(0);
+        _func        = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling_global<PoolingType::AVG> : &NEPoolingLayerKernel::pooling_global<PoolingType::MAX>;
+
+        // Each iteration reduces a whole feature map: the rows are read with a scalar tail so the input doesn't need any padding.
+        // The window has a single iteration in X and Y, the scheduler therefore splits the work across the feature maps.
+        Window win = calculate_max_window(*output->info(), Steps());
+        output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+        INEKernel::configure(win);
+        return;
+    }
+
+    // Only single precision supports pooling sizes other than 2 and 3
+    ARM_COMPUTE_ERROR_ON(input->info()->data_type() != DataType::F32 && 2 != pool_size && 3 != pool_size);
     ARM_COMPUTE_ERROR_ON(pool_pad_x >= pool_size || pool_pad_y >= pool_size);
 
     // Check output dimensions
@@ -92,11 +229,35 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     ARM_COMPUTE_UNUSED(pooled_h);
     ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != pooled_w) || (output->info()->dimension(1) != pooled_h));
 
-    const int num_elems_read_per_iteration = (pool_size == 2) ? 2 : 4; // We use vload4 for pooling3
-    const int input_width                  = input->info()->dimension(0);
-    const int input_height                 = input->info()->dimension(1);
-    const int upper_bound_w                = ((pooled_w - 1) * pool_stride_x - pool_pad_x + num_elems_read_per_iteration) - input_width;
-    const int upper_bound_h                = ((pooled_h - 1) * pool_stride_y - pool_pad_y + pool_size) - input_height;
+    // The max of the quantized values is the quantized max: the quantized pooling reads the values one by one and doesn't need to dequantize them
+    const bool is_quantized = (input->info()->data_type() == DataType::U8);
+    ARM_COMPUTE_ERROR_ON(is_quantized && (PoolingType::MAX != pool_type));
+    ARM_COMPUTE_ERROR_ON(is_quantized && ((input->info()->quantization_info().scale != output->info()->quantization_info().scale)
+                                          || (input->info()->quantization_info().offset != output->info()->quantization_info().offset)));
+
+    // We use vload4 for pooling3, and for both pool sizes in half precision
+    int num_elems_read_per_iteration = (pool_size == 2) ? 2 : 4;
+    switch(input->info()->data_type())
+    {
+        case DataType::U8:
+            num_elems_read_per_iteration = pool_size;
+            break;
+        case DataType::F16:
+            num_elems_read_per_iteration = 4;
+            break;
+        default:
+            // The generic pooling reads the rows of the pooling region by vectors of 4 elements
+            if(pool_size != 2 && pool_size != 3)
+            {
+                num_elems_read_per_iteration = ceil_to_multiple(pool_size, 4);
+            }
+            break;
+    }
+
+    const int input_width   = input->info()->dimension(0);
+    const int input_height  = input->info()->dimension(1);
+    const int upper_bound_w = ((pooled_w - 1) * pool_stride_x - pool_pad_x + num_elems_read_per_iteration) - input_width;
+    const int upper_bound_h = ((pooled_h - 1) * pool_stride_y - pool_pad_y + pool_size) - input_height;
 
     // Set instance variables
     _input              = input;
@@ -107,17 +268,42 @@ void NEPoolingLayerKernel::configure(const ITensor *input, ITensor *output, cons
     _border_size.bottom = std::max(upper_bound_h, pool_pad_y);
 
     // Select appropriate function
-    switch(pool_size)
+    if(is_quantized)
     {
-        case 2:
-            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling2<PoolingType::AVG> : &NEPoolingLayerKernel::pooling2<PoolingType::MAX>;
-            break;
-        case 3:
-            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling3<PoolingType::AVG> : &NEPoolingLayerKernel::pooling3<PoolingType::MAX>;
-            break;
-        default:
-            ARM_COMPUTE_ERROR("Unsupported pooling size");
-            break;
+        _func = (pool_size == 2) ? &NEPoolingLayerKernel::pooling_max_u8<2> : &NEPoolingLayerKernel::pooling_max_u8<3>;
+    }
+    else if(input->info()->data_type() == DataType::F16)
+    {
+#if defined(ARM_COMPUTE_ENABLE_FP16)
+        if(pool_size == 2)
+        {
+            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling2_f16<PoolingType::AVG> : &NEPoolingLayerKernel::pooling2_f16<PoolingType::MAX>;
+        }
+        else
+        {
+            _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling3_f16<PoolingType::AVG> : &NEPoolingLayerKernel::pooling3_f16<PoolingType::MAX>;
+        }
+#elif defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
+        // Without the half precision arithmetic the values are pooled in single precision: the generic pooling reads 4 elements per row like the F16 functions
+        _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::poolingN<PoolingType::AVG, float16_t> : &NEPoolingLayerKernel::poolingN<PoolingType::MAX, float16_t>;
+#else
+        ARM_COMPUTE_ERROR("Not implemented");
+#endif
+    }
+    else
+    {
+        switch(pool_size)
+        {
+            case 2:
+                _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling2<PoolingType::AVG> : &NEPoolingLayerKernel::pooling2<PoolingType::MAX>;
+                break;
+            case 3:
+                _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::pooling3<PoolingType::AVG> : &NEPoolingLayerKernel::pooling3<PoolingType::MAX>;
+                break;
+            default:
+                _func = (PoolingType::AVG == pool_type) ? &NEPoolingLayerKernel::poolingN<PoolingType::AVG, float> : &NEPoolingLayerKernel::poolingN<PoolingType::MAX, float>;
+                break;
+        }
     }
 
     // Configure kernel window
@@ -217,6 +403,355 @@ void NEPoolingLayerKernel::pooling3(const Window &window_input, const Window &wi
     input, output);
 }
 
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling2_f16(const Window &window_input, const Window &window)
+{
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    constexpr int pool_size = 2;
+    int           pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    const unsigned char *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+    const unsigned char *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float16x4_t top_data    = vld1_f16(reinterpret_cast<const float16_t *>(input_top_ptr + input.offset()));
+        const float16x4_t bottom_data = vld1_f16(reinterpret_cast<const float16_t *>(input_bottom_ptr + input.offset()));
+        float16x4_t       res         = {};
+        if(pooling_type == PoolingType::AVG)
+        {
+            // Calculate scale
+            const float       scale   = calculate_avg_scale(id, pool_size, upper_bound_w, upper_bound_h, pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y);
+            const float16x4_t scale_v = vdup_n_f16(scale);
+
+            // Perform pooling
+            const float16x4_t sum_data = vadd_f16(top_data, bottom_data);
+            res                        = vmul_f16(vpadd_f16(sum_data, sum_data), scale_v);
+        }
+        else
+        {
+            const float16x4_t max_data = vmax_f16(top_data, bottom_data);
+            res                        = vpmax_f16(max_data, max_data);
+        }
+        *(reinterpret_cast<float16_t *>(output.ptr())) = vget_lane_f16(res, 0);
+    },
+    input, output);
+#else
+    ARM_COMPUTE_ERROR("Not implemented");
+#endif
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling3_f16(const Window &window_input, const Window &window)
+{
+#ifdef ARM_COMPUTE_ENABLE_FP16
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    constexpr const int pool_size = 3;
+    int                 pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int upper_bound_w = _input->info()->dimension(0) + pool_pad_x;
+    const int upper_bound_h = _input->info()->dimension(1) + pool_pad_y;
+
+    const unsigned char *const input_top_ptr    = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+    const unsigned char *const input_middle_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 1));
+    const unsigned char *const input_bottom_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y) + 2));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float16x4_t top_data    = vld1_f16(reinterpret_cast<const float16_t *>(input_top_ptr + input.offset()));
+        const float16x4_t middle_data = vld1_f16(reinterpret_cast<const float16_t *>(input_middle_ptr + input.offset()));
+        const float16x4_t bottom_data = vld1_f16(reinterpret_cast<const float16_t *>(input_bottom_ptr + input.offset()));
+        float16x4_t       res         = {};
+        if(pooling_type == PoolingType::AVG)
+        {
+            // Calculate scale
+            const float       scale   = calculate_avg_scale(id, pool_size, upper_bound_w, upper_bound_h, pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y);
+            const float16x4_t scale_v = vdup_n_f16(scale);
+
+            // Perform pooling: the 4th lane is outside the pooling region
+            const float16x4_t sum_data = vset_lane_f16(0.f, vadd_f16(vadd_f16(top_data, bottom_data), middle_data), 3);
+            res                        = vpadd_f16(sum_data, sum_data);
+            res                        = vmul_f16(vpadd_f16(res, res), scale_v);
+        }
+        else
+        {
+            // The 4th lane is outside the pooling region: replace it with the 1st one, which doesn't change the maximum
+            float16x4_t max_data = vmax_f16(vmax_f16(top_data, bottom_data), middle_data);
+            max_data             = vset_lane_f16(vget_lane_f16(max_data, 0), max_data, 3);
+            res                  = vpmax_f16(max_data, max_data);
+            res                  = vpmax_f16(res, res);
+        }
+        *(reinterpret_cast<float16_t *>(output.ptr())) = vget_lane_f16(res, 0);
+    },
+    input, output);
+#else
+    ARM_COMPUTE_ERROR("Not implemented");
+#endif
+}
+
+template <PoolingType pooling_type, typename T>
+void NEPoolingLayerKernel::poolingN(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    const int pool_size = _pool_info.pool_size();
+    int       pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+    const int    upper_bound_w  = _input->info()->dimension(0) + pool_pad_x;
+    const int    upper_bound_h  = _input->info()->dimension(1) + pool_pad_y;
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+
+    // The pooling region is read by columns of 4 elements: the last one is partial if the pooling size isn't a multiple of 4
+    const int num_full_columns = pool_size / 4;
+    const int num_tail_elems   = pool_size % 4;
+
+    const unsigned char *const input_top_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const unsigned char *const input_ptr = input_top_ptr + input.offset();
+
+        // Column pass: reduce the rows of the pooling region 4 elements at a time
+        const auto pool_column = [&](int x)
+        {
+            float32x4_t res = vload_f32(reinterpret_cast<const T *>(input_ptr) + x);
+            for(int y = 1; y < pool_size; ++y)
+            {
+                res = vpoolq_f32<pooling_type>(res, vload_f32(reinterpret_cast<const T *>(input_ptr + y * input_stride_y) + x));
+            }
+            return res;
+        };
+
+        // Row pass: reduce the results of the columns
+        float32x4_t vres = vdupq_n_f32(pool_init_f32<pooling_type>());
+        for(int c = 0; c < num_full_columns; ++c)
+        {
+            vres = vpoolq_f32<pooling_type>(vres, pool_column(4 * c));
+        }
+        float res = vreduceq_f32<pooling_type>(vres);
+
+        if(num_tail_elems != 0)
+        {
+            // The lanes of the partial column past the pooling region are ignored
+            float tail[4];
+            vst1q_f32(tail, pool_column(4 * num_full_columns));
+            for(int x = 0; x < num_tail_elems; ++x)
+            {
+                res = pool_f32<pooling_type>(res, tail[x]);
+            }
+        }
+
+        if(pooling_type == PoolingType::AVG)
+        {
+            res *= calculate_avg_scale(id, pool_size, upper_bound_w, upper_bound_h, pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y);
+        }
+        *(reinterpret_cast<T *>(output.ptr())) = static_cast<T>(res);
+    },
+    input, output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_global(const Window &window_input, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(window_input);
+
+    Iterator output(_output, window);
+
+    const int    input_width    = _input->info()->dimension(0);
+    const int    input_height   = _input->info()->dimension(1);
+    const size_t input_stride_y = _input->info()->strides_in_bytes().y();
+    const float  scale          = 1.f / (input_width * input_height);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // The feature map which is reduced has the same coordinates as the output element, X and Y excepted
+        Coordinates input_id(id);
+        input_id.set(0, 0);
+        input_id.set(1, 0);
+        const unsigned char *const input_ptr = _input->ptr_to_element(input_id);
+
+        float32x4_t vres = vdupq_n_f32(pool_init_f32<pooling_type>());
+        float       res  = pool_init_f32<pooling_type>();
+        for(int y = 0; y < input_height; ++y)
+        {
+            const float *const row_ptr = reinterpret_cast<const float *>(input_ptr + y * input_stride_y);
+
+            int x = 0;
+            for(; x <= input_width - 4; x += 4)
+            {
+                vres = vpoolq_f32<pooling_type>(vres, vld1q_f32(row_ptr + x));
+            }
+            for(; x < input_width; ++x)
+            {
+                res = pool_f32<pooling_type>(res, row_ptr[x]);
+            }
+        }
+        res = pool_f32<pooling_type>(res, vreduceq_f32<pooling_type>(vres));
+
+        *(reinterpret_cast<float *>(output.ptr())) = (pooling_type == PoolingType::AVG) ? res * scale : res;
+    },
+    output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_nhwc(const Window &window_input, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(window_input);
+
+    Iterator output(_output, window);
+
+    int pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+
+    const int    num_channels   = _input->info()->dimension(0);
+    const int    input_width    = _input->info()->dimension(1);
+    const int    input_height   = _input->info()->dimension(2);
+    const int    pool_size_x    = _pool_info.is_global_pooling() ? input_width : _pool_info.pool_size();
+    const int    pool_size_y    = _pool_info.is_global_pooling() ? input_height : _pool_info.pool_size();
+    const size_t input_stride_w = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_h = _input->info()->strides_in_bytes()[2];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int start_x = id[1] * pool_stride_x - pool_pad_x;
+        const int start_y = id[2] * pool_stride_y - pool_pad_y;
+        const int valid_x = std::max(start_x, 0);
+        const int valid_y = std::max(start_y, 0);
+        const int end_x   = std::min(start_x + pool_size_x, input_width);
+        const int end_y   = std::min(start_y + pool_size_y, input_height);
+
+        // Same scale as calculate_avg_scale(): the padding on the left and the top is part of the pooling region
+        const float scale = 1.f / ((std::min(start_y + pool_size_y, input_height + pool_pad_y) - start_y) * (std::min(start_x + pool_size_x, input_width + pool_pad_x) - start_x));
+
+        Coordinates input_id(id);
+        input_id.set(0, 0);
+        input_id.set(1, valid_x);
+        input_id.set(2, valid_y);
+        const unsigned char *const input_ptr  = _input->ptr_to_element(input_id);
+        float *const               output_ptr = reinterpret_cast<float *>(output.ptr());
+
+        int c = 0;
+        for(; c <= num_channels - 4; c += 4)
+        {
+            float32x4_t vres = vdupq_n_f32(pool_init_f32<pooling_type>());
+            for(int y = 0; y < end_y - valid_y; ++y)
+            {
+                for(int x = 0; x < end_x - valid_x; ++x)
+                {
+                    const float *const in_ptr = reinterpret_cast<const float *>(input_ptr + y * input_stride_h + x * input_stride_w) + c;
+                    vres                      = vpoolq_f32<pooling_type>(vres, vld1q_f32(in_ptr));
+                }
+            }
+            vst1q_f32(output_ptr + c, (pooling_type == PoolingType::AVG) ? vmulq_n_f32(vres, scale) : vres);
+        }
+        for(; c < num_channels; ++c)
+        {
+            float res = pool_init_f32<pooling_type>();
+            for(int y = 0; y < end_y - valid_y; ++y)
+            {
+                for(int x = 0; x < end_x - valid_x; ++x)
+                {
+                    res = pool_f32<pooling_type>(res, reinterpret_cast<const float *>(input_ptr + y * input_stride_h + x * input_stride_w)[c]);
+                }
+            }
+            output_ptr[c] = (pooling_type == PoolingType::AVG) ? res * scale : res;
+        }
+    },
+    output);
+}
+
+template <PoolingType pooling_type>
+void NEPoolingLayerKernel::pooling_nchw4(const Window &window_input, const Window &window)
+{
+    ARM_COMPUTE_UNUSED(window_input);
+
+    Iterator output(_output, window);
+
+    int pool_pad_x, pool_pad_y, pool_stride_x, pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y)       = _pool_info.pad_stride_info().pad();
+    std::tie(pool_stride_x, pool_stride_y) = _pool_info.pad_stride_info().stride();
+
+    const int    input_width    = _input->info()->dimension(0) / 4;
+    const int    input_height   = _input->info()->dimension(1);
+    const int    pool_size_x    = _pool_info.is_global_pooling() ? input_width : _pool_info.pool_size();
+    const int    pool_size_y    = _pool_info.is_global_pooling() ? input_height : _pool_info.pool_size();
+    const size_t input_stride_y = _input->info()->strides_in_bytes()[1];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int start_x = (id.x() / 4) * pool_stride_x - pool_pad_x;
+        const int start_y = id.y() * pool_stride_y - pool_pad_y;
+        const int valid_x = std::max(start_x, 0);
+        const int valid_y = std::max(start_y, 0);
+        const int end_x   = std::min(start_x + pool_size_x, input_width);
+        const int end_y   = std::min(start_y + pool_size_y, input_height);
+
+        // Same scale as calculate_avg_scale(): the padding on the left and the top is part of the pooling region
+        const float scale = 1.f / ((std::min(start_y + pool_size_y, input_height + pool_pad_y) - start_y) * (std::min(start_x + pool_size_x, input_width + pool_pad_x) - start_x));
+
+        Coordinates input_id(id);
+        input_id.set(0, 4 * valid_x);
+        input_id.set(1, valid_y);
+        const unsigned char *const input_ptr = _input->ptr_to_element(input_id);
+
+        // The missing feature maps of the last block are zeros, and so are their results
+        float32x4_t vres = vdupq_n_f32(pool_init_f32<pooling_type>());
+        for(int y = 0; y < end_y - valid_y; ++y)
+        {
+            const float *const row_ptr = reinterpret_cast<const float *>(input_ptr + y * input_stride_y);
+            for(int x = 0; x < end_x - valid_x; ++x)
+            {
+                vres = vpoolq_f32<pooling_type>(vres, vld1q_f32(row_ptr + 4 * x));
+            }
+        }
+
+        vst1q_f32(reinterpret_cast<float *>(output.ptr()), (pooling_type == PoolingType::AVG) ? vmulq_n_f32(vres, scale) : vres);
+    },
+    output);
+}
+
+template <int pool_size>
+void NEPoolingLayerKernel::pooling_max_u8(const Window &window_input, const Window &window)
+{
+    Iterator input(_input, window_input);
+    Iterator output(_output, window);
+
+    int pool_pad_x, pool_pad_y = 0;
+    std::tie(pool_pad_x, pool_pad_y) = _pool_info.pad_stride_info().pad();
+    const size_t input_stride_y      = _input->info()->strides_in_bytes().y();
+
+    const unsigned char *const input_top_ptr = _input->ptr_to_element(Coordinates(-static_cast<int>(pool_pad_x), -static_cast<int>(pool_pad_y)));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *const input_ptr = input_top_ptr + input.offset();
+
+        uint8_t res = 0;
+        for(int y = 0; y < pool_size; ++y)
+        {
+            for(int x = 0; x < pool_size; ++x)
+            {
+                res = std::max(res, input_ptr[y * input_stride_y + x]);
+            }
+        }
+        *output.ptr() = res;
+    },
+    input, output);
+}
+
 void NEPoolingLayerKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
@@ -234,3 +769,8 @@ void NEPoolingLayerKernel::run(const Window &window)
     // Run function
     (this->*_func)(window_input, window);
 }
+
+SchedulingPolicy NEPoolingLayerKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
@@ -0,0 +1,258 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEPoolingNormalizationLayerKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_elems_processed_per_iteration = 4;
+
+/** Number of elements of an input row read to pool 4 consecutive output elements
+ *
+ * @param[in] pool_size     Size of the pooling region.
+ * @param[in] pool_stride_x Horizontal stride of the pooling region.
+ *
+ * @return The number of elements read
+ */
+inline int num_elems_read_per_row(int pool_size, int pool_stride_x)
+{
+    return (pool_stride_x == 1) ? static_cast<int>(num_elems_processed_per_iteration) + pool_size - 1 : 2 * num_elems_processed_per_iteration + pool_size - 2;
+}
+
+/** Compute the maximum of the pooling regions of 4 consecutive output elements along a row of the input
+ *
+ * @param[in] ptr Pointer to the first element of the first pooling region.
+ *
+ * @return The maximum of each pooling region
+ */
+template <int pool_size, int pool_stride_x>
+inline float32x4_t max_row(const float *ptr)
+{
+    static_assert(pool_size == 2 || pool_size == 3, "Unsupported pooling size");
+    static_assert(pool_stride_x == 1 || pool_stride_x == 2, "Unsupported pooling stride");
+
+    float32x4_t res{};
+    if(pool_stride_x == 1)
+    {
+        res = vmaxq_f32(vld1q_f32(ptr), vld1q_f32(ptr + 1));
+        if(pool_size == 3)
+        {
+            res = vmaxq_f32(res, vld1q_f32(ptr + 2));
+        }
+    }
+    else
+    {
+        // Deinterleave the row: val[0] holds the first element of each pooling region, val[1] the second one
+        const float32x4x2_t data = vld2q_f32(ptr);
+        res                      = vmaxq_f32(data.val[0], data.val[1]);
+        if(pool_size == 3)
+        {
+            res = vmaxq_f32(res, vextq_f32(data.val[0], vld1q_dup_f32(ptr + 8), 1));
+        }
+    }
+    return res;
+}
+} // namespace
+
+NEPoolingNormalizationLayerKernel::NEPoolingNormalizationLayerKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _pool_info(), _norm_info(NormType::CROSS_MAP), _border_size(0)
+{
+}
+
+BorderSize NEPoolingNormalizationLayerKernel::border_size() const
+{
+    return _border_size;
+}
+
+void NEPoolingNormalizationLayerKernel::configure(const ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const NormalizationLayerInfo &norm_info)
+{
+    int                 pool_pad_x      = 0;
+    int                 pool_pad_y      = 0;
+    int                 pool_stride_x   = 0;
+    int                 pool_stride_y   = 0;
+    unsigned int        pooled_w        = 0;
+    unsigned int        pooled_h        = 0;
+    const int           pool_size       = pool_info.pool_size();
+    const PadStrideInfo pad_stride_info = pool_info.pad_stride_info();
+    std::tie(pool_pad_x, pool_pad_y)       = pad_stride_info.pad();
+    std::tie(pool_stride_x, pool_stride_y) = pad_stride_info.stride();
+
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(pool_info.pool_type() != PoolingType::MAX);
+    ARM_COMPUTE_ERROR_ON(2 != pool_size && 3 != pool_size);
+    ARM_COMPUTE_ERROR_ON(1 != pool_stride_x && 2 != pool_stride_x);
+    ARM_COMPUTE_ERROR_ON(pool_pad_x >= pool_size || pool_pad_y >= pool_size);
+    ARM_COMPUTE_ERROR_ON(norm_info.type() != NormType::CROSS_MAP);
+    ARM_COMPUTE_ERROR_ON_MSG(!(norm_info.norm_size() % 2), "Normalization size should be odd");
+
+    // Check output dimensions
+    std::tie(pooled_w, pooled_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1),
+                                                     pool_size, pool_stride_x, pool_stride_y,
+                                                     pool_pad_x, pool_pad_y, pad_stride_info.round());
+    ARM_COMPUTE_ERROR_ON((output->info()->dimension(0) != pooled_w) || (output->info()->dimension(1) != pooled_h));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(3) != input->info()->dimension(3));
+
+    // The last iteration of a row pools 4 elements, some of which can be beyond the output: their pooling regions are read from the border
+    const int input_width   = input->info()->dimension(0);
+    const int input_height  = input->info()->dimension(1);
+    const int last_x        = ceil_to_multiple(pooled_w, num_elems_processed_per_iteration) - num_elems_processed_per_iteration;
+    const int upper_bound_w = (last_x * pool_stride_x - pool_pad_x + num_elems_read_per_row(pool_size, pool_stride_x)) - input_width;
+    const int upper_bound_h = ((pooled_h - 1) * pool_stride_y - pool_pad_y + pool_size) - input_height;
+
+    _input              = input;
+    _output             = output;
+    _pool_info          = pool_info;
+    _norm_info          = norm_info;
+    _border_size        = BorderSize(pool_pad_y, pool_pad_x);
+    _border_size.right  = std::max(upper_bound_w, pool_pad_x);
+    _border_size.bottom = std::max(upper_bound_h, pool_pad_y);
+
+    if(pool_size == 2)
+    {
+        _func = (pool_stride_x == 1) ? &NEPoolingNormalizationLayerKernel::pool_normalize<2, 1> : &NEPoolingNormalizationLayerKernel::pool_normalize<2, 2>;
+    }
+    else
+    {
+        _func = (pool_stride_x == 1) ? &NEPoolingNormalizationLayerKernel::pool_normalize<3, 1> : &NEPoolingNormalizationLayerKernel::pool_normalize<3, 2>;
+    }
+
+    // Configure kernel window: the feature maps are all processed by the same iteration
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+    win.set(Window::DimZ, Window::Dimension(0, 1, 1));
+
+    AccessWindowStatic     input_access(input->info(), -pool_pad_x, -pool_pad_y, input_width + _border_size.right, input_height + _border_size.bottom);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+    update_window_and_padding(win, input_access, output_access);
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+template <int pool_size, int pool_stride_x>
+void NEPoolingNormalizationLayerKernel::pool_normalize(const Window &window)
+{
+    int pool_pad_x    = 0;
+    int pool_pad_y    = 0;
+    int pool_stride_y = 0;
+    std::tie(pool_pad_x, pool_pad_y) = _pool_info.pad_stride_info().pad();
+    pool_stride_y                    = _pool_info.pad_stride_info().stride().second;
+
+    const int    num_maps      = _output->info()->dimension(2);
+    const int    radius        = _norm_info.norm_size() / 2;
+    const int    norm_size     = _norm_info.norm_size();
+    const size_t in_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t in_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t out_stride_z  = _output->info()->strides_in_bytes()[2];
+    const int    num_elems_row = num_elems_processed_per_iteration;
+
+    const float32x4_t coeff_vec = vdupq_n_f32(_norm_info.scale_coeff());
+    const float32x4_t beta_vec  = vdupq_n_f32(_norm_info.beta());
+    const float32x4_t kappa_vec = vdupq_n_f32(_norm_info.kappa());
+
+    // Pooled values of the feature maps inside the normalization window, indexed by feature map modulo the normalization size
+    float *const pooled = thread_scratch<float>(norm_size * num_elems_row);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8_t *in_ptr  = _input->ptr_to_element(Coordinates(id.x() * pool_stride_x - pool_pad_x, id.y() * pool_stride_y - pool_pad_y, 0, id[3]));
+        uint8_t       *out_ptr = _output->ptr_to_element(Coordinates(id.x(), id.y(), 0, id[3]));
+
+        // Pool a feature map, store its pooled values and return their squares
+        const auto pool_map = [&](int map)
+        {
+            const uint8_t *map_ptr = in_ptr + map * in_stride_z;
+
+            float32x4_t res = max_row<pool_size, pool_stride_x>(reinterpret_cast<const float *>(map_ptr));
+            for(int i = 1; i < pool_size; ++i)
+            {
+                res = vmaxq_f32(res, max_row<pool_size, pool_stride_x>(reinterpret_cast<const float *>(map_ptr + i * in_stride_y)));
+            }
+
+            vst1q_f32(pooled + (map % norm_size) * num_elems_row, res);
+            return vmulq_f32(res, res);
+        };
+
+        // Sum of the squares of the feature maps [map - radius, map + radius] inside the tensor
+        float32x4_t accu = vdupq_n_f32(0.f);
+        for(int map = 0; map < std::min(radius, num_maps); ++map)
+        {
+            accu = vaddq_f32(accu, pool_map(map));
+        }
+
+        for(int map = 0; map < num_maps; ++map)
+        {
+            // Slide the normalization window: the feature map leaving the window is overwritten by the one entering it
+            const int leaving  = map - radius - 1;
+            const int entering = map + radius;
+            if(leaving >= 0)
+            {
+                const float32x4_t value = vld1q_f32(pooled + (leaving % norm_size) * num_elems_row);
+                accu                    = vmlsq_f32(accu, value, value);
+            }
+            if(entering < num_maps)
+            {
+                accu = vaddq_f32(accu, pool_map(entering));
+            }
+
+            // Normalize
+            const float32x4_t pixel      = vld1q_f32(pooled + (map % norm_size) * num_elems_row);
+            const float32x4_t normalized = vpowq_f32(vmlaq_f32(kappa_vec, coeff_vec, vmaxq_f32(accu, vdupq_n_f32(0.f))), beta_vec);
+            vst1q_f32(reinterpret_cast<float *>(out_ptr + map * out_stride_z), vmulq_f32(pixel, vinvq_f32(normalized)));
+        }
+    });
+}
+
+void NEPoolingNormalizationLayerKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
+
+SchedulingPolicy NEPoolingNormalizationLayerKernel::scheduling_policy() const
+{
+    return SchedulingPolicy::DYNAMIC;
+}
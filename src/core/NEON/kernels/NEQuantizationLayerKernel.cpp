@@ -0,0 +1,161 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEQuantizationLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include <arm_neon.h>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Round to the nearest integer, half away from zero, and convert to int32 */
+inline int32x4_t vround_s32_f32(float32x4_t val)
+{
+    const float32x4_t half = vbslq_f32(vcltq_f32(val, vdupq_n_f32(0.f)), vdupq_n_f32(-0.5f), vdupq_n_f32(0.5f));
+    return vcvtq_s32_f32(vaddq_f32(val, half));
+}
+} // namespace
+
+NEQuantizationLayerKernel::NEQuantizationLayerKernel()
+    : _func(nullptr), _scale(0.f), _offset(0)
+{
+}
+
+void NEQuantizationLayerKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S32, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::U8 && output->info()->data_type() != DataType::F32, "Only data_types supported [in] U8 -> [out] F32");
+    ARM_COMPUTE_ERROR_ON_MSG(input->info()->data_type() == DataType::F32 && output->info()->data_type() == DataType::F32, "Only data_types supported [in] F32 -> [out] U8, S32");
+
+    const bool             is_dequantization = input->info()->data_type() == DataType::U8;
+    const QuantizationInfo qinfo             = is_dequantization ? input->info()->quantization_info() : output->info()->quantization_info();
+    ARM_COMPUTE_ERROR_ON_MSG(qinfo.empty(), "The quantization info of the quantized tensor must be set");
+
+    _scale  = qinfo.scale;
+    _offset = qinfo.offset;
+
+    switch(output->info()->data_type())
+    {
+        case DataType::U8:
+            _func = &NEQuantizationLayerKernel::quantize_u8;
+            break;
+        case DataType::S32:
+            _func = &NEQuantizationLayerKernel::quantize_s32;
+            break;
+        case DataType::F32:
+            _func = &NEQuantizationLayerKernel::dequantize_u8;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported data type");
+    }
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+    INESimpleKernel::configure(input, output, num_elems_processed_per_iteration);
+}
+
+void NEQuantizationLayerKernel::quantize_u8(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const float32x4_t inv_scale = vdupq_n_f32(1.f / _scale);
+    const int32x4_t   offset    = vdupq_n_s32(_offset);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto in_ptr = reinterpret_cast<const float *>(input.ptr());
+
+        const int32x4_t q0 = vaddq_s32(vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr), inv_scale)), offset);
+        const int32x4_t q1 = vaddq_s32(vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 4), inv_scale)), offset);
+        const int32x4_t q2 = vaddq_s32(vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 8), inv_scale)), offset);
+        const int32x4_t q3 = vaddq_s32(vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 12), inv_scale)), offset);
+
+        const uint8x8_t low  = vqmovun_s16(vcombine_s16(vqmovn_s32(q0), vqmovn_s32(q1)));
+        const uint8x8_t high = vqmovun_s16(vcombine_s16(vqmovn_s32(q2), vqmovn_s32(q3)));
+
+        vst1q_u8(output.ptr(), vcombine_u8(low, high));
+    },
+    input, output);
+}
+
+void NEQuantizationLayerKernel::quantize_s32(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const float32x4_t inv_scale = vdupq_n_f32(1.f / _scale);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto out_ptr = reinterpret_cast<int32_t *>(output.ptr());
+
+        vst1q_s32(out_ptr, vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr), inv_scale)));
+        vst1q_s32(out_ptr + 4, vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 4), inv_scale)));
+        vst1q_s32(out_ptr + 8, vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 8), inv_scale)));
+        vst1q_s32(out_ptr + 12, vround_s32_f32(vmulq_f32(vld1q_f32(in_ptr + 12), inv_scale)));
+    },
+    input, output);
+}
+
+void NEQuantizationLayerKernel::dequantize_u8(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const float32x4_t scale  = vdupq_n_f32(_scale);
+    const int32x4_t   offset = vdupq_n_s32(_offset);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const uint8x16_t in      = vld1q_u8(input.ptr());
+        const uint16x8_t in_low  = vmovl_u8(vget_low_u8(in));
+        const uint16x8_t in_high = vmovl_u8(vget_high_u8(in));
+        const auto       out_ptr = reinterpret_cast<float *>(output.ptr());
+
+        vst1q_f32(out_ptr, vmulq_f32(vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(in_low))), offset)), scale));
+        vst1q_f32(out_ptr + 4, vmulq_f32(vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(in_low))), offset)), scale));
+        vst1q_f32(out_ptr + 8, vmulq_f32(vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_low_u16(in_high))), offset)), scale));
+        vst1q_f32(out_ptr + 12, vmulq_f32(vcvtq_f32_s32(vsubq_s32(vreinterpretq_s32_u32(vmovl_u16(vget_high_u16(in_high))), offset)), scale));
+    },
+    input, output);
+}
+
+void NEQuantizationLayerKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INESimpleKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
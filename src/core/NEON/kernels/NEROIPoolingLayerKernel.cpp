@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEROIPoolingLayerKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Maximum of a bin of a feature map
+ *
+ * @param[in] ptr      Pointer to the top-left element of the bin.
+ * @param[in] stride_y Stride of the feature map in bytes along Y.
+ * @param[in] width    Width of the bin. Must not be 0.
+ * @param[in] height   Height of the bin. Must not be 0.
+ *
+ * @return The maximum value of the bin
+ */
+inline float max_of_bin(const uint8_t *ptr, size_t stride_y, int width, int height)
+{
+    float32x4_t vmax = vdupq_n_f32(std::numeric_limits<float>::lowest());
+    float       smax = std::numeric_limits<float>::lowest();
+
+    for(int y = 0; y < height; ++y)
+    {
+        const auto row = reinterpret_cast<const float *>(ptr + y * stride_y);
+        int        x   = 0;
+
+        for(; x <= width - 4; x += 4)
+        {
+            vmax = vmaxq_f32(vmax, vld1q_f32(row + x));
+        }
+
+        for(; x < width; ++x)
+        {
+            smax = std::max(smax, row[x]);
+        }
+    }
+
+    float32x2_t res = vpmax_f32(vget_high_f32(vmax), vget_low_f32(vmax));
+    res             = vpmax_f32(res, res);
+
+    const float vec_max = vget_lane_f32(res, 0);
+
+    return std::max(smax, vec_max);
+}
+} // namespace
+
+NEROIPoolingLayerKernel::NEROIPoolingLayerKernel()
+    : _input(nullptr), _rois(nullptr), _output(nullptr), _pool_info(0, 0, 0.f)
+{
+}
+
+void NEROIPoolingLayerKernel::configure(const ITensor *input, const IROIArray *rois, ITensor *output, const ROIPoolingLayerInfo &pool_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(rois == nullptr || rois->max_num_values() == 0);
+    ARM_COMPUTE_ERROR_ON(input->info()->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_ERROR_ON(pool_info.pooled_width() == 0 || pool_info.pooled_height() == 0 || pool_info.spatial_scale() <= 0.f);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != pool_info.pooled_width() || output->info()->dimension(1) != pool_info.pooled_height());
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2) || output->info()->dimension(3) != rois->max_num_values());
+
+    _input     = input;
+    _rois      = rois;
+    _output    = output;
+    _pool_info = pool_info;
+
+    // The bins of a region depend on the region: the kernel runs over whole regions and splits the channels among the threads
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win.set(Window::DimY, Window::Dimension(0, input->info()->dimension(2), 1));
+    win.set(Window::DimZ, Window::Dimension(0, rois->max_num_values(), 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEROIPoolingLayerKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int    width         = _input->info()->dimension(0);
+    const int    height        = _input->info()->dimension(1);
+    const size_t in_stride_y   = _input->info()->strides_in_bytes()[1];
+    const size_t in_stride_z   = _input->info()->strides_in_bytes()[2];
+    const size_t in_stride_w   = _input->info()->strides_in_bytes()[3];
+    const size_t out_stride_z  = _output->info()->strides_in_bytes()[2];
+    const size_t out_stride_w  = _output->info()->strides_in_bytes()[3];
+    const int    pooled_width  = _pool_info.pooled_width();
+    const int    pooled_height = _pool_info.pooled_height();
+    const float  spatial_scale = _pool_info.spatial_scale();
+
+    const uint8_t *const in_base  = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t *const       out_base = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    const int roi_end = std::min<int>(window.z().end(), _rois->num_values());
+
+    for(int r = window.z().start(); r < roi_end; ++r)
+    {
+        const ROI &roi = _rois->at(r);
+        ARM_COMPUTE_ERROR_ON(roi.batch_idx >= _input->info()->dimension(3));
+
+        // Region in the feature maps, at least one element wide and high
+        const int   roi_x      = std::round(roi.x * spatial_scale);
+        const int   roi_y      = std::round(roi.y * spatial_scale);
+        const int   roi_width  = std::max<int>(std::round((roi.x + roi.width) * spatial_scale) - roi_x, 1);
+        const int   roi_height = std::max<int>(std::round((roi.y + roi.height) * spatial_scale) - roi_y, 1);
+        const float bin_width  = static_cast<float>(roi_width) / pooled_width;
+        const float bin_height = static_cast<float>(roi_height) / pooled_height;
+
+        for(int c = window.y().start(); c < window.y().end(); ++c)
+        {
+            const uint8_t *const in_ptr  = in_base + roi.batch_idx * in_stride_w + c * in_stride_z;
+            auto                 out_ptr = reinterpret_cast<float *>(out_base + r * out_stride_w + c * out_stride_z);
+
+            for(int py = 0; py < pooled_height; ++py)
+            {
+                const int y_start = std::min(std::max(roi_y + static_cast<int>(std::floor(py * bin_height)), 0), height);
+                const int y_end   = std::min(std::max(roi_y + static_cast<int>(std::ceil((py + 1) * bin_height)), 0), height);
+
+                for(int px = 0; px < pooled_width; ++px)
+                {
+                    const int x_start = std::min(std::max(roi_x + static_cast<int>(std::floor(px * bin_width)), 0), width);
+                    const int x_end   = std::min(std::max(roi_x + static_cast<int>(std::ceil((px + 1) * bin_width)), 0), width);
+
+                    // The bins out of the feature maps are 0
+                    const bool is_empty = (y_end <= y_start) || (x_end <= x_start);
+
+                    out_ptr[px] = is_empty ? 0.f : max_of_bin(in_ptr + y_start * in_stride_y + x_start * sizeof(float), in_stride_y, x_end - x_start, y_end - y_start);
+                }
+
+                out_ptr = reinterpret_cast<float *>(reinterpret_cast<uint8_t *>(out_ptr) + _output->info()->strides_in_bytes()[1]);
+            }
+        }
+    }
+}
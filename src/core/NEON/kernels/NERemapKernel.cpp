@@ -61,10 +61,15 @@ inline int32x4_t offset_nearest_interpolation(const float *mapx_ptr, const float
     return vmlaq_s32(x_s32, y_s32, stride);
 }
 
+inline uint8_t table_pixel(const uint8_t *in_ptr, int32_t offset, uint8_t constant_border_value)
+{
+    return offset < 0 ? constant_border_value : in_ptr[offset];
+}
+
 } // namespace
 
 NERemapKernel::NERemapKernel()
-    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr)
+    : _func(nullptr), _input(nullptr), _output(nullptr), _map_x(nullptr), _map_y(nullptr), _offsets(nullptr), _fractions(nullptr), _constant_border_value(0)
 {
 }
 
@@ -115,6 +120,45 @@ void NERemapKernel::configure(const ITensor *input, const ITensor *map_x, const
     INEKernel::configure(win);
 }
 
+void NERemapKernel::configure(const ITensor *input, const ITensor *offsets, const ITensor *fractions, ITensor *output, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON(fractions != nullptr && fractions->info()->data_type() != DataType::U16);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(offsets, output);
+
+    _input                 = input;
+    _output                = output;
+    _offsets               = offsets;
+    _fractions             = fractions;
+    _constant_border_value = constant_border_value;
+    _func                  = (fractions != nullptr) ? &NERemapKernel::remap_table_bilinear : &NERemapKernel::remap_table_nearest;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    const ValidRegion &input_valid_region = input->info()->valid_region();
+
+    // Reads can occur within the valid region of the input, plus one column and one row for the bilinear neighbours
+    const int          border = (fractions != nullptr) ? 1 : 0;
+    AccessWindowStatic input_access(input->info(),
+                                    input_valid_region.anchor[0], input_valid_region.anchor[1],
+                                    input_valid_region.anchor[0] + input_valid_region.shape[0] + border,
+                                    input_valid_region.anchor[1] + input_valid_region.shape[1] + border);
+    AccessWindowHorizontal offsets_access(offsets->info(), 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal fractions_access(fractions != nullptr ? fractions->info() : nullptr, 0, num_elems_processed_per_iteration);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, offsets_access, fractions_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
 void NERemapKernel::remap_nearest(const Window &window)
 {
     // Don't increment in X and Y direction for the input tensor
@@ -216,6 +260,102 @@ void NERemapKernel::remap_bilinear(const Window &window)
     in, out, mapx, mapy);
 }
 
+void NERemapKernel::remap_table_nearest(const Window &window)
+{
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+    Iterator offsets(_offsets, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto     offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
+        const uint8_t *in_ptr      = in.ptr();
+        uint8_t       *out_ptr     = out.ptr();
+
+        for(unsigned int i = 0; i < 16; ++i)
+        {
+            out_ptr[i] = table_pixel(in_ptr, offsets_ptr[i], _constant_border_value);
+        }
+    },
+    in, out, offsets);
+}
+
+void NERemapKernel::remap_table_bilinear(const Window &window)
+{
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+    Iterator offsets(_offsets, window);
+    Iterator fractions(_fractions, window);
+
+    const size_t     in_stride = _input->info()->strides_in_bytes()[1];
+    const uint16x8_t one       = vdupq_n_u16(256);
+    const uint16x8_t mask      = vdupq_n_u16(0xFF);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto     offsets_ptr   = reinterpret_cast<const int32_t *>(offsets.ptr());
+        const auto     fractions_ptr = reinterpret_cast<const uint16_t *>(fractions.ptr());
+        const uint8_t *in_ptr        = in.ptr();
+
+        for(unsigned int i = 0; i < 16; i += 8)
+        {
+            // Gather the 4 neighbours of 8 output pixels
+            uint8_t a00[8];
+            uint8_t a01[8];
+            uint8_t a10[8];
+            uint8_t a11[8];
+
+            for(unsigned int j = 0; j < 8; ++j)
+            {
+                const int32_t offset = offsets_ptr[i + j];
+
+                if(offset < 0)
+                {
+                    a00[j] = a01[j] = a10[j] = a11[j] = _constant_border_value;
+                }
+                else
+                {
+                    const uint8_t *pixel_ptr = in_ptr + offset;
+
+                    a00[j] = pixel_ptr[0];
+                    a01[j] = pixel_ptr[1];
+                    a10[j] = pixel_ptr[in_stride];
+                    a11[j] = pixel_ptr[in_stride + 1];
+                }
+            }
+
+            const uint16x8_t fraction = vld1q_u16(fractions_ptr + i);
+            const uint16x8_t dx       = vandq_u16(fraction, mask);
+            const uint16x8_t dy       = vshrq_n_u16(fraction, 8);
+            const uint16x8_t dx1      = vsubq_u16(one, dx);
+            const uint16x8_t dy1      = vsubq_u16(one, dy);
+
+            // Horizontal interpolation in 8.8 fixed point: at most 255 * 256
+            const uint16x8_t top    = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a00)), dx1), vmovl_u8(vld1_u8(a01)), dx);
+            const uint16x8_t bottom = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a10)), dx1), vmovl_u8(vld1_u8(a11)), dx);
+
+            // Vertical interpolation in 16.16 fixed point, truncated as delta_bilinear_c1u8() does
+            const uint32x4_t res_low  = vmlal_u16(vmull_u16(vget_low_u16(top), vget_low_u16(dy1)), vget_low_u16(bottom), vget_low_u16(dy));
+            const uint32x4_t res_high = vmlal_u16(vmull_u16(vget_high_u16(top), vget_high_u16(dy1)), vget_high_u16(bottom), vget_high_u16(dy));
+
+            vst1_u8(out.ptr() + i, vmovn_u16(vcombine_u16(vshrn_n_u32(res_low, 16), vshrn_n_u32(res_high, 16))));
+        }
+    },
+    in, out, offsets, fractions);
+}
+
 void NERemapKernel::run(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
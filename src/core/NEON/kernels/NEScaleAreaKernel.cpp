@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEScaleAreaKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/CPP/ThreadScratch.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+NEScaleAreaKernel::NEScaleAreaKernel()
+    : _func(nullptr), _input(nullptr), _output(nullptr), _x_start(), _y_start(), _x_weights(), _y_weights(), _x_span(0), _y_span(0)
+{
+}
+
+void NEScaleAreaKernel::compute_weights(size_t in_size, size_t out_size, size_t num, std::vector<int> &start, std::vector<uint16_t> &weights, unsigned int &span)
+{
+    const double ratio = static_cast<double>(in_size) / static_cast<double>(out_size);
+
+    span = std::min<size_t>(in_size, static_cast<size_t>(std::ceil(ratio)) + 1);
+
+    start.resize(num);
+    weights.assign(num * span, 0);
+
+    for(size_t o = 0; o < num; ++o)
+    {
+        const size_t oc = std::min(o, out_size - 1);
+        const double x0 = oc * ratio;
+        const double x1 = std::min((oc + 1) * ratio, static_cast<double>(in_size));
+
+        // Keep the span inside of the input: the pixels it covers on the left get a null weight
+        const int first = std::min<int>(std::floor(x0), in_size - span);
+        start[o]        = first;
+
+        // Round the cumulated coverage so that the weights always add up to 256
+        double   coverage = 0.0;
+        uint16_t previous = 0;
+
+        for(unsigned int k = 0; k < span; ++k)
+        {
+            const double i = first + static_cast<int>(k);
+
+            coverage += std::max(0.0, std::min(i + 1.0, x1) - std::max(i, x0));
+
+            const auto current    = static_cast<uint16_t>(std::lround(256.0 * coverage / (x1 - x0)));
+            weights[o * span + k] = current - previous;
+            previous              = current;
+        }
+    }
+}
+
+void NEScaleAreaKernel::configure(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) == 0);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) == 0);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) > input->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) > input->info()->dimension(1));
+
+    for(size_t i = 2; i < Coordinates::num_max_dimensions; ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(i) != output->info()->dimension(i));
+    }
+
+    _input  = input;
+    _output = output;
+
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // The input columns are accumulated 8 at a time, from any column
+    constexpr unsigned int num_elems_read_per_iteration = 8;
+
+    const size_t in_width   = input->info()->dimension(0);
+    const size_t in_height  = input->info()->dimension(1);
+    const size_t out_width  = output->info()->dimension(0);
+    const size_t out_height = output->info()->dimension(1);
+
+    // Configure kernel window
+    Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
+
+    AccessWindowStatic     input_access(input->info(), 0, 0, in_width + num_elems_read_per_iteration - 1, in_height);
+    AccessWindowHorizontal output_access(output->info(), 0, num_elems_processed_per_iteration);
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+
+    // The last iteration of each row can write past the end of the output, into its padding
+    const size_t num_columns = win.x().end();
+
+    const bool integer_ratio = (in_width % out_width == 0) && (in_height % out_height == 0);
+
+    if(integer_ratio && (in_width / out_width) * (in_height / out_height) <= 257)
+    {
+        _x_span = in_width / out_width;
+        _y_span = in_height / out_height;
+
+        _x_start.resize(num_columns);
+        _y_start.resize(out_height);
+
+        for(size_t x = 0; x < num_columns; ++x)
+        {
+            _x_start[x] = std::min(x, out_width - 1) * _x_span;
+        }
+
+        for(size_t y = 0; y < out_height; ++y)
+        {
+            _y_start[y] = y * _y_span;
+        }
+
+        _func = &NEScaleAreaKernel::scale_integer;
+    }
+    else
+    {
+        compute_weights(in_width, out_width, num_columns, _x_start, _x_weights, _x_span);
+        compute_weights(in_height, out_height, out_height, _y_start, _y_weights, _y_span);
+
+        _func = &NEScaleAreaKernel::scale_fractional;
+    }
+}
+
+void NEScaleAreaKernel::scale_integer(const Window &window)
+{
+    // Iterate over the planes only, the rows and columns are addressed from the tables
+    Window win_planes(window);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+
+    const size_t in_stride  = _input->info()->strides_in_bytes()[1];
+    const size_t out_stride = _output->info()->strides_in_bytes()[1];
+    const int    start_x    = window.x().start();
+    const int    end_x      = window.x().end();
+    const int    first_col  = _x_start[start_x];
+    const int    num_cols   = ceil_to_multiple(_x_start[end_x - 1] + _x_span - first_col, 8);
+    const int    area       = _x_span * _y_span;
+
+    // Sums of the input rows under the current output row, column by column
+    uint16_t *const columns = thread_scratch<uint16_t>(num_cols);
+
+    execute_window_loop(win_planes, [&](const Coordinates & id)
+    {
+        for(int y = window.y().start(); y < window.y().end(); ++y)
+        {
+            const uint8_t *in_ptr  = in.ptr() + _y_start[y] * in_stride + first_col;
+            uint8_t       *out_ptr = out.ptr() + y * out_stride;
+
+            for(int c = 0; c < num_cols; c += 8)
+            {
+                uint16x8_t sum = vmovl_u8(vld1_u8(in_ptr + c));
+
+                for(unsigned int r = 1; r < _y_span; ++r)
+                {
+                    sum = vaddw_u8(sum, vld1_u8(in_ptr + r * in_stride + c));
+                }
+
+                vst1q_u16(columns + c, sum);
+            }
+
+            for(int x = start_x; x < end_x; ++x)
+            {
+                const uint16_t *col_ptr = columns + _x_start[x] - first_col;
+
+                unsigned int sum = 0;
+                for(unsigned int k = 0; k < _x_span; ++k)
+                {
+                    sum += col_ptr[k];
+                }
+
+                out_ptr[x] = (sum + area / 2) / area;
+            }
+        }
+    },
+    in, out);
+}
+
+void NEScaleAreaKernel::scale_fractional(const Window &window)
+{
+    // Iterate over the planes only, the rows and columns are addressed from the tables
+    Window win_planes(window);
+    win_planes.set(Window::DimX, Window::Dimension(0, 1, 1));
+    win_planes.set(Window::DimY, Window::Dimension(0, 1, 1));
+
+    Iterator in(_input, win_planes);
+    Iterator out(_output, win_planes);
+
+    const size_t in_stride  = _input->info()->strides_in_bytes()[1];
+    const size_t out_stride = _output->info()->strides_in_bytes()[1];
+    const int    start_x    = window.x().start();
+    const int    end_x      = window.x().end();
+    const int    first_col  = _x_start[start_x];
+    const int    num_cols   = ceil_to_multiple(_x_start[end_x - 1] + _x_span - first_col, 8);
+
+    // Weighted sums of the input rows under the current output row, column by column: at most 255 * 256
+    uint16_t *const columns = thread_scratch<uint16_t>(num_cols);
+
+    execute_window_loop(win_planes, [&](const Coordinates & id)
+    {
+        for(int y = window.y().start(); y < window.y().end(); ++y)
+        {
+            const uint8_t  *in_ptr    = in.ptr() + _y_start[y] * in_stride + first_col;
+            const uint16_t *y_weights = _y_weights.data() + y * _y_span;
+            uint8_t        *out_ptr   = out.ptr() + y * out_stride;
+
+            for(int c = 0; c < num_cols; c += 8)
+            {
+                uint16x8_t sum = vmulq_n_u16(vmovl_u8(vld1_u8(in_ptr + c)), y_weights[0]);
+
+                for(unsigned int r = 1; r < _y_span; ++r)
+                {
+                    sum = vmlaq_n_u16(sum, vmovl_u8(vld1_u8(in_ptr + r * in_stride + c)), y_weights[r]);
+                }
+
+                vst1q_u16(columns + c, sum);
+            }
+
+            for(int x = start_x; x < end_x; ++x)
+            {
+                const uint16_t *col_ptr   = columns + _x_start[x] - first_col;
+                const uint16_t *x_weights = _x_weights.data() + x * _x_span;
+
+                uint32_t sum = 0;
+                for(unsigned int k = 0; k < _x_span; ++k)
+                {
+                    sum += col_ptr[k] * x_weights[k];
+                }
+
+                // Both sets of weights add up to 256
+                out_ptr[x] = (sum + (1 << 15)) >> 16;
+            }
+        }
+    },
+    in, out);
+}
+
+void NEScaleAreaKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    (this->*_func)(window);
+}
@@ -35,9 +35,52 @@
 #include <arm_neon.h>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Load the (up to 4) interleaved U8 channels of a pixel as floats
+ *
+ * @note 4 bytes are read whatever the number of channels.
+ */
+inline float32x4_t load_pixel_f32(const uint8_t *pixel_ptr)
+{
+    uint32_t packed = 0;
+    std::memcpy(&packed, pixel_ptr, sizeof(packed));
+
+    return vcvtq_f32_u32(vmovl_u16(vget_low_u16(vmovl_u8(vreinterpret_u8_u32(vdup_n_u32(packed))))));
+}
+
+/** Bilinear interpolation of all the channels of a pixel of an image with N interleaved U8 channels, as @ref delta_bilinear_c1u8 does for one channel
+ *
+ * @param[in]  pixel_ptr Pointer to the top-left pixel
+ * @param[in]  stride    Stride of the image
+ * @param[in]  dx        Pixel's distance between the X real coordinate and the top-left pixel
+ * @param[in]  dy        Pixel's distance between the Y real coordinate and the top-left pixel
+ * @param[out] out_ptr   Pointer to the output pixel
+ */
+template <size_t N>
+inline void delta_bilinear_interleaved_u8(const uint8_t *pixel_ptr, size_t stride, float dx, float dy, uint8_t *out_ptr)
+{
+    static_assert(N <= 4, "At most 4 channels are supported");
+
+    const float dx1 = 1.0f - dx;
+    const float dy1 = 1.0f - dy;
+
+    float32x4_t res = vmulq_n_f32(load_pixel_f32(pixel_ptr), dx1 * dy1);
+    res             = vmlaq_n_f32(res, load_pixel_f32(pixel_ptr + N), dx * dy1);
+    res             = vmlaq_n_f32(res, load_pixel_f32(pixel_ptr + stride), dx1 * dy);
+    res             = vmlaq_n_f32(res, load_pixel_f32(pixel_ptr + stride + N), dx * dy);
+
+    const uint16x4_t res_u16 = vmovn_u32(vcvtq_u32_f32(res));
+    const uint32_t   packed  = vget_lane_u32(vreinterpret_u32_u8(vmovn_u16(vcombine_u16(res_u16, res_u16))), 0);
+
+    std::memcpy(out_ptr, &packed, N);
+}
+} // namespace
+
 NEScaleKernel::NEScaleKernel()
     : _func(nullptr), _offsets(nullptr), _dx(nullptr), _dy(nullptr), _input(nullptr), _output(nullptr)
 {
@@ -50,8 +93,19 @@ BorderSize NEScaleKernel::border_size() const
 
 void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITensor *dy, const ITensor *offsets, ITensor *output, InterpolationPolicy policy, bool border_undefined)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    const size_t num_channels = input->info()->num_channels();
+
+    if(num_channels != 1)
+    {
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(input, Format::RGB888, Format::RGBA8888);
+        ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(output, input->info()->format());
+        ARM_COMPUTE_ERROR_ON(policy == InterpolationPolicy::AREA);
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
+    }
 
     if(policy == InterpolationPolicy::NEAREST_NEIGHBOR)
     {
@@ -83,7 +137,18 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            _func = &NEScaleKernel::scale_nearest;
+            switch(num_channels)
+            {
+                case 3:
+                    _func = &NEScaleKernel::scale_nearest_interleaved<3>;
+                    break;
+                case 4:
+                    _func = &NEScaleKernel::scale_nearest_interleaved<4>;
+                    break;
+                default:
+                    _func = &NEScaleKernel::scale_nearest;
+                    break;
+            }
             break;
         }
         case InterpolationPolicy::BILINEAR:
@@ -91,7 +156,18 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
             ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_dx, 1, DataType::F32);
             ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_dy, 1, DataType::F32);
 
-            _func = &NEScaleKernel::scale_bilinear;
+            switch(num_channels)
+            {
+                case 3:
+                    _func = &NEScaleKernel::scale_bilinear_interleaved<3>;
+                    break;
+                case 4:
+                    _func = &NEScaleKernel::scale_bilinear_interleaved<4>;
+                    break;
+                default:
+                    _func = &NEScaleKernel::scale_bilinear;
+                    break;
+            }
             break;
         }
         case InterpolationPolicy::AREA:
@@ -106,10 +182,13 @@ void NEScaleKernel::configure(const ITensor *input, const ITensor *dx, const ITe
     constexpr unsigned int num_elems_processed_per_iteration = 16;
     const int              border_offset                     = (border_undefined) ? 0 : border_size().left;
 
+    // The bilinear interpolation of RGB888 pixels reads 4 bytes per pixel, one past the last channel of the last pixel
+    const int extra_read = (num_channels == 3 && policy == InterpolationPolicy::BILINEAR) ? 1 : 0;
+
     // Configure kernel window
     Window win = calculate_max_window(*output->info(), Steps(num_elems_processed_per_iteration));
 
-    AccessWindowStatic     input_access(input->info(), -border_offset, -border_offset, input->info()->dimension(0) + border_offset, input->info()->dimension(1) + border_offset);
+    AccessWindowStatic     input_access(input->info(), -border_offset, -border_offset, input->info()->dimension(0) + border_offset + extra_read, input->info()->dimension(1) + border_offset);
     AccessWindowHorizontal offsets_access(offsets->info(), 0, num_elems_processed_per_iteration);
     AccessWindowHorizontal dx_access(dx == nullptr ? nullptr : dx->info(), 0, num_elems_processed_per_iteration);
     AccessWindowHorizontal dy_access(dy == nullptr ? nullptr : dy->info(), 0, num_elems_processed_per_iteration);
@@ -301,6 +380,102 @@ void NEScaleKernel::scale_bilinear(const Window &window)
     in, offsets, dx, dy, out);
 }
 
+template <size_t N>
+void NEScaleKernel::scale_nearest_interleaved(const Window &window)
+{
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    const size_t input_stride = _input->info()->strides_in_bytes()[1];
+
+    // Compute the ratio between source height and destination height
+    const auto hr = static_cast<float>(_input->info()->dimension(1)) / static_cast<float>(_output->info()->dimension(1));
+
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Window win_off;
+    win_off.set(Window::DimX, window[Window::DimX]);
+    win_off.set(Window::DimY, window[Window::DimY]);
+
+    for(size_t d = Window::DimZ; d < _offsets->info()->num_dimensions(); ++d)
+    {
+        win_off.set(d, Window::Dimension(0, 0, 0));
+    }
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+    Iterator offsets(_offsets, win_off);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
+        const auto out_ptr     = out.ptr();
+
+        const size_t         in_yi  = (id.y() + 0.5f) * hr;
+        const uint8_t *const in_ptr = in.ptr() + in_yi * input_stride;
+
+        // The offsets point to the first channel of the pixels: copy all their channels at once
+        for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i)
+        {
+            std::memcpy(out_ptr + i * N, in_ptr + offsets_ptr[i], N);
+        }
+    },
+    in, offsets, out);
+}
+
+template <size_t N>
+void NEScaleKernel::scale_bilinear_interleaved(const Window &window)
+{
+    constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+    // Compute the ratio between source height and destination height
+    const auto hr = static_cast<float>(_input->info()->dimension(1)) / static_cast<float>(_output->info()->dimension(1));
+
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    Window win_off;
+    win_off.set(Window::DimX, window.x());
+    win_off.set(Window::DimY, window.y());
+
+    for(size_t d = Window::DimZ; d < _offsets->info()->num_dimensions(); ++d)
+    {
+        win_off.set(d, Window::Dimension(0, 0, 0));
+    }
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, window);
+    Iterator offsets(_offsets, win_off);
+    Iterator dx(_dx, win_off);
+    Iterator dy(_dy, win_off);
+
+    /* Input image stride */
+    const size_t in_stride = _input->info()->strides_in_bytes()[1];
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto offsets_ptr = reinterpret_cast<const int32_t *>(offsets.ptr());
+        const auto dx_ptr      = reinterpret_cast<const float *>(dx.ptr());
+        const auto dy_ptr      = reinterpret_cast<const float *>(dy.ptr());
+        const auto out_ptr     = out.ptr();
+
+        const size_t   in_yi  = std::floor((id.y() + 0.5f) * hr - 0.5f);
+        const uint8_t *in_ptr = in.ptr() + in_yi * in_stride;
+
+        for(unsigned int i = 0; i < num_elems_processed_per_iteration; ++i)
+        {
+            delta_bilinear_interleaved_u8<N>(in_ptr + offsets_ptr[i], in_stride, dx_ptr[i], dy_ptr[i], out_ptr + i * N);
+        }
+    },
+    in, offsets, dx, dy, out);
+}
+
 void NEScaleKernel::scale_area(const Window &window)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(_input, 1, DataType::U8);
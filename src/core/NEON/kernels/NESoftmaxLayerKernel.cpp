@@ -37,9 +37,20 @@
 #include <algorithm>
 #include <arm_neon.h>
 #include <cfloat>
+#include <cmath>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Exponential of 4 values with the requested accuracy */
+template <MathPrecision P>
+inline float32x4_t vexpq_precision_f32(const float32x4_t &x)
+{
+    return P == MathPrecision::FAST ? vexpq_fast_f32(x) : vexpq_f32(x);
+}
+} // namespace
+
 NELogits1DMaxKernel::NELogits1DMaxKernel()
     : _border_size()
 {
@@ -112,7 +123,7 @@ void NELogits1DMaxKernel::run(const Window &window)
 }
 
 NELogits1DShiftExpSumKernel::NELogits1DShiftExpSumKernel()
-    : _input(nullptr), _max(nullptr), _output(nullptr), _sum(nullptr), _border_size(0)
+    : _input(nullptr), _max(nullptr), _output(nullptr), _sum(nullptr), _border_size(0), _precision(MathPrecision::ACCURATE)
 {
 }
 
@@ -120,7 +131,7 @@ BorderSize NELogits1DShiftExpSumKernel::border_size() const
 {
     return _border_size;
 }
-void NELogits1DShiftExpSumKernel::configure(const ITensor *input, const ITensor *max, ITensor *output, ITensor *sum)
+void NELogits1DShiftExpSumKernel::configure(const ITensor *input, const ITensor *max, ITensor *output, ITensor *sum, MathPrecision precision)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(max, 1, DataType::F32);
@@ -135,6 +146,7 @@ void NELogits1DShiftExpSumKernel::configure(const ITensor *input, const ITensor
     _output      = output;
     _sum         = sum;
     _border_size = BorderSize(0, input_width % num_elems_processed_per_iteration, 0, 0);
+    _precision   = precision;
 
     // Configure kernel window
     Window                 win = calculate_max_window(*input->info(), Steps(num_elems_processed_per_iteration));
@@ -156,6 +168,19 @@ void NELogits1DShiftExpSumKernel::run(const Window &window)
     ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
     ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
 
+    if(_precision == MathPrecision::FAST)
+    {
+        shift_exp_sum<MathPrecision::FAST>(window);
+    }
+    else
+    {
+        shift_exp_sum<MathPrecision::ACCURATE>(window);
+    }
+}
+
+template <MathPrecision P>
+void NELogits1DShiftExpSumKernel::shift_exp_sum(const Window &window)
+{
     Window window_max(window);
     window_max.set(Window::DimX, Window::Dimension(0, 0, 0));
 
@@ -181,7 +206,7 @@ void NELogits1DShiftExpSumKernel::run(const Window &window)
 
             float32x4_t vec_elements = vld1q_f32(in_ptr);
             vec_elements             = vsubq_f32(vec_elements, vec_max);
-            vec_elements             = vexpq_f32(vec_elements);
+            vec_elements             = vexpq_precision_f32<P>(vec_elements);
 
             vst1q_f32(exp_ptr, vec_elements);
 
@@ -261,3 +286,104 @@ void NELogits1DNormKernel::run(const Window &window)
     }
     while(window.slide_window_slice_1D(in_slice) && window.slide_window_slice_1D(sum_slice));
 }
+
+NELogits1DSoftmaxKernel::NELogits1DSoftmaxKernel()
+    : _precision(MathPrecision::ACCURATE)
+{
+}
+
+void NELogits1DSoftmaxKernel::configure(const ITensor *input, ITensor *output, MathPrecision precision)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input     = input;
+    _output    = output;
+    _precision = precision;
+
+    // Configure kernel window: each iteration processes a whole row, whose tail is processed element by element so no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    output->info()->set_valid_region(input->info()->valid_region());
+
+    INEKernel::configure(win);
+}
+
+void NELogits1DSoftmaxKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    if(_precision == MathPrecision::FAST)
+    {
+        softmax<MathPrecision::FAST>(window);
+    }
+    else
+    {
+        softmax<MathPrecision::ACCURATE>(window);
+    }
+}
+
+template <MathPrecision P>
+void NELogits1DSoftmaxKernel::softmax(const Window &window)
+{
+    Iterator input(_input, window);
+    Iterator output(_output, window);
+
+    const int row_width = _input->info()->valid_region().shape.x();
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr  = reinterpret_cast<const float *>(input.ptr());
+        const auto out_ptr = reinterpret_cast<float *>(output.ptr());
+
+        // Max of the row
+        float32x4_t vec_max = vdupq_n_f32(-FLT_MAX);
+        int         x       = 0;
+        for(; x <= row_width - 4; x += 4)
+        {
+            vec_max = vmaxq_f32(vec_max, vld1q_f32(in_ptr + x));
+        }
+        float32x2_t carry_max = vpmax_f32(vget_high_f32(vec_max), vget_low_f32(vec_max));
+        carry_max             = vpmax_f32(carry_max, carry_max);
+        float max             = vget_lane_f32(carry_max, 0);
+        for(; x < row_width; ++x)
+        {
+            max = std::max(max, in_ptr[x]);
+        }
+
+        // Shift the row, exponentiate it into the output and accumulate the sum
+        const float32x4_t vec_max_value = vdupq_n_f32(max);
+        float32x4_t       vec_sum       = vdupq_n_f32(0.f);
+        for(x = 0; x <= row_width - 4; x += 4)
+        {
+            const float32x4_t vec_elements = vexpq_precision_f32<P>(vsubq_f32(vld1q_f32(in_ptr + x), vec_max_value));
+            vst1q_f32(out_ptr + x, vec_elements);
+            vec_sum = vaddq_f32(vec_sum, vec_elements);
+        }
+        float32x2_t carry_sum = vadd_f32(vget_high_f32(vec_sum), vget_low_f32(vec_sum));
+        carry_sum             = vpadd_f32(carry_sum, carry_sum);
+        float sum             = vget_lane_f32(carry_sum, 0);
+        for(; x < row_width; ++x)
+        {
+            out_ptr[x] = std::exp(in_ptr[x] - max);
+            sum += out_ptr[x];
+        }
+
+        // Normalize the row
+        const float       inv_sum     = 1.f / sum;
+        const float32x4_t vec_inv_sum = vdupq_n_f32(inv_sum);
+        for(x = 0; x <= row_width - 4; x += 4)
+        {
+            vst1q_f32(out_ptr + x, vmulq_f32(vld1q_f32(out_ptr + x), vec_inv_sum));
+        }
+        for(; x < row_width; ++x)
+        {
+            out_ptr[x] *= inv_sum;
+        }
+    },
+    input, output);
+}
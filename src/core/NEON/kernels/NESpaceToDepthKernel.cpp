@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NESpaceToDepthKernel.h"
+
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Offset in bytes of the first element of the batch pointed to by the dimensions above 2 of @p id */
+inline size_t batch_offset(const ITensor *tensor, const Coordinates &id)
+{
+    size_t offset = tensor->info()->offset_first_element_in_bytes();
+
+    for(size_t d = 3; d < Coordinates::num_max_dimensions; ++d)
+    {
+        offset += id[d] * tensor->info()->strides_in_bytes()[d];
+    }
+
+    return offset;
+}
+
+/** Gather the beginning of a row with a stride of 2 or 4 elements with NEON deinterleaving loads
+ *
+ * @param[in]  in       Pointer to the first element to gather.
+ * @param[out] out      Pointer to the output row.
+ * @param[in]  n        Number of elements to gather.
+ * @param[in]  n_avail  Number of elements which can be read from @p in.
+ * @param[in]  stride   Stride of the gather in elements.
+ *
+ * @return The number of elements gathered, the rest of the row is left to the caller.
+ */
+template <typename T>
+inline int gather_neon(const T *in, T *out, int n, int n_avail, int stride)
+{
+    ARM_COMPUTE_UNUSED(in);
+    ARM_COMPUTE_UNUSED(out);
+    ARM_COMPUTE_UNUSED(n);
+    ARM_COMPUTE_UNUSED(n_avail);
+    ARM_COMPUTE_UNUSED(stride);
+    return 0;
+}
+
+template <>
+inline int gather_neon<float>(const float *in, float *out, int n, int n_avail, int stride)
+{
+    // The deinterleaving loads read stride full vectors: stop before they read past the input row
+    int x = 0;
+
+    if(stride == 2)
+    {
+        for(; x <= n - 4 && (x + 4) * 2 <= n_avail; x += 4)
+        {
+            vst1q_f32(out + x, vld2q_f32(in + 2 * x).val[0]);
+        }
+    }
+    else if(stride == 4)
+    {
+        for(; x <= n - 4 && (x + 4) * 4 <= n_avail; x += 4)
+        {
+            vst1q_f32(out + x, vld4q_f32(in + 4 * x).val[0]);
+        }
+    }
+
+    return x;
+}
+} // namespace
+
+NESpaceToDepthKernel::NESpaceToDepthKernel()
+    : _input(nullptr), _output(nullptr), _block_size(1), _pad_x(0), _pad_y(0)
+{
+}
+
+void NESpaceToDepthKernel::configure(const ITensor *input, ITensor *output, unsigned int block_size, unsigned int pad_x, unsigned int pad_y)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(block_size == 0);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != input->info()->dimension(2) * block_size * block_size);
+
+    _input      = input;
+    _output     = output;
+    _block_size = block_size;
+    _pad_x      = pad_x;
+    _pad_y      = pad_y;
+
+    // Each iteration writes a full row of an output channel
+    Window win;
+    win.set(Window::DimY, Window::Dimension(0, output->info()->dimension(1), 1));
+    win.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), 1));
+
+    for(size_t d = 3; d < Coordinates::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(d) != output->info()->dimension(d));
+        win.set(d, Window::Dimension(0, output->info()->dimension(d), 1));
+    }
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+template <typename T>
+void NESpaceToDepthKernel::rearrange(const Window &window)
+{
+    const int    input_w         = _input->info()->dimension(0);
+    const int    input_h         = _input->info()->dimension(1);
+    const int    output_w        = _output->info()->dimension(0);
+    const size_t input_stride_y  = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z  = _input->info()->strides_in_bytes()[2];
+    const size_t output_stride_y = _output->info()->strides_in_bytes()[1];
+    const size_t output_stride_z = _output->info()->strides_in_bytes()[2];
+    const int    s               = _block_size;
+
+    // The padding holds the value 0: the offset of the quantized tensors represents the real value 0
+    const T pad_value = static_cast<T>(_input->info()->quantization_info().offset);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int c  = id.z() / (s * s);
+        const int dy = (id.z() / s) % s;
+        const int dx = id.z() % s;
+        const int y  = id.y() * s + dy - _pad_y;
+
+        const auto out_row = reinterpret_cast<T *>(_output->buffer() + batch_offset(_output, id) + id.y() * output_stride_y + id.z() * output_stride_z);
+
+        if(y < 0 || y >= input_h)
+        {
+            std::fill_n(out_row, output_w, pad_value);
+            return;
+        }
+
+        const auto in_row = reinterpret_cast<const T *>(_input->buffer() + batch_offset(_input, id) + y * input_stride_y + c * input_stride_z);
+
+        // Output columns reading inside the input: 0 <= x * s + dx - pad_x < input_w
+        const int first = std::min(std::max((_pad_x - dx + s - 1) / s, 0), output_w);
+        const int last  = std::max(std::min((input_w + _pad_x - dx + s - 1) / s, output_w), first);
+
+        std::fill_n(out_row, first, pad_value);
+
+        const T  *in_ptr = in_row + first * s + dx - _pad_x;
+        const int n      = last - first;
+
+        for(int x = gather_neon(in_ptr, out_row + first, n, input_w - (first * s + dx - _pad_x), s); x < n; ++x)
+        {
+            out_row[first + x] = in_ptr[x * s];
+        }
+
+        std::fill_n(out_row + last, output_w - last, pad_value);
+    });
+}
+
+void NESpaceToDepthKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    switch(_input->info()->data_type())
+    {
+        case DataType::U8:
+            rearrange<uint8_t>(window);
+            break;
+        case DataType::F32:
+            rearrange<float>(window);
+            break;
+        case DataType::F16:
+#ifdef ARM_COMPUTE_ENABLE_FP16
+            rearrange<float16_t>(window);
+            break;
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
+        default:
+            ARM_COMPUTE_ERROR("Data type not supported");
+            break;
+    }
+}
@@ -27,10 +27,13 @@
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ILut.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEMath.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 
+#include <arm_neon.h>
+#include <array>
 #include <cstddef>
 #include <cstdint>
 
@@ -49,7 +52,7 @@ NETableLookupKernel::NETableLookupKernel()
 }
 
 template <class T>
-void NETableLookupKernel::tableLookup(const Window &window)
+void NETableLookupKernel::tableLookup_checked(const Window &window)
 {
     uint32_t     offset = _lut->index_offset();
     size_t       count  = _lut->num_elements();
@@ -92,6 +95,22 @@ void NETableLookupKernel::tableLookup<uint8_t>(const Window &window)
     Iterator input  = Iterator(_input, window);
     Iterator output = Iterator(_output, window);
 
+#ifdef __aarch64__
+    // A full table fits in 16 NEON registers: look up 16 pixels at a time with TBL/TBX
+    if(_lut->num_elements() >= 256)
+    {
+        const std::array<uint8x16x4_t, 4> tables = vld_lut256_u8(lut);
+
+        execute_window_loop(window, [&](const Coordinates & id)
+        {
+            vst1q_u8(output.ptr(), vlut256q_u8(tables, vld1q_u8(input.ptr())));
+        },
+        input, output);
+
+        return;
+    }
+#endif /* __aarch64__ */
+
     execute_window_loop(window, [&](const Coordinates & id)
     {
         const uint8_t *input_ptr  = input.ptr();
@@ -104,6 +123,53 @@ void NETableLookupKernel::tableLookup<uint8_t>(const Window &window)
     },
     input, output);
 }
+
+template <>
+void NETableLookupKernel::tableLookup<int16_t>(const Window &window)
+{
+    const uint32_t       offset = _lut->index_offset();
+    const size_t         count  = _lut->num_elements();
+    const int16_t *const lut    = reinterpret_cast<const int16_t *>(_lut->buffer());
+
+    ARM_COMPUTE_ERROR_ON(lut == nullptr);
+
+    // A table covering the whole S16 range needs no bounds check: split the
+    // loads, the lookups and the stores so that the lookups don't depend on each other
+    if(offset != 32768 || count != 65536)
+    {
+        tableLookup_checked<int16_t>(window);
+        return;
+    }
+
+    const int16_t *const lut_centre = lut + offset;
+
+    Iterator input  = Iterator(_input, window);
+    Iterator output = Iterator(_output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto input_ptr  = reinterpret_cast<const int16_t *>(input.ptr());
+        const auto output_ptr = reinterpret_cast<int16_t *>(output.ptr());
+
+        for(unsigned int i = 0; i < num_num_elems_processed_per_iteration; i += 8)
+        {
+            const int16x8_t values = vld1q_s16(input_ptr + i);
+
+            int16x8_t result = vdupq_n_s16(0);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 0)], result, 0);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 1)], result, 1);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 2)], result, 2);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 3)], result, 3);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 4)], result, 4);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 5)], result, 5);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 6)], result, 6);
+            result           = vsetq_lane_s16(lut_centre[vgetq_lane_s16(values, 7)], result, 7);
+
+            vst1q_s16(output_ptr + i, result);
+        }
+    },
+    input, output);
+}
 } // namespace arm_compute
 
 void NETableLookupKernel::configure(const ITensor *input, const ILut *lut, ITensor *output)
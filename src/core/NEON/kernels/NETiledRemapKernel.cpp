@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NETiledRemapKernel.h"
+
+#include "arm_compute/core/AccessWindowStatic.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <arm_neon.h>
+#include <climits>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of fractional bits of the compiled coordinates */
+constexpr int fraction_bits = 5;
+/** Mask of the fractional bits of the compiled coordinates */
+constexpr uint16_t fraction_mask = (1 << fraction_bits) - 1;
+/** Number of output pixels processed per iteration */
+constexpr unsigned int num_elems_processed_per_iteration = 16;
+
+/** Source coordinate of an output pixel in fixed point, clamped as NERemapKernel does */
+inline int fixed_point_coordinate(float coordinate, size_t size, InterpolationPolicy policy)
+{
+    coordinate = std::max(-1.f, std::min(coordinate, static_cast<float>(size)));
+
+    // Nearest neighbour truncates like the float to integer conversion of NERemapKernel
+    return (policy == InterpolationPolicy::NEAREST_NEIGHBOR) ? (static_cast<int>(coordinate) << fraction_bits) : static_cast<int>(std::floor(coordinate * (1 << fraction_bits)));
+}
+
+/** Offsets in bytes from the origin of the footprint of the integer part of 8 compiled coordinates */
+inline void footprint_offsets(const uint16x8x2_t &coords, const uint32x4_t &stride, uint32_t *offsets)
+{
+    const uint16x8_t x = vshrq_n_u16(coords.val[0], fraction_bits);
+    const uint16x8_t y = vshrq_n_u16(coords.val[1], fraction_bits);
+
+    vst1q_u32(offsets, vmlaq_u32(vmovl_u16(vget_low_u16(x)), vmovl_u16(vget_low_u16(y)), stride));
+    vst1q_u32(offsets + 4, vmlaq_u32(vmovl_u16(vget_high_u16(x)), vmovl_u16(vget_high_u16(y)), stride));
+}
+} // namespace
+
+constexpr unsigned int NETiledRemapKernel::tile_width;
+constexpr unsigned int NETiledRemapKernel::tile_height;
+
+NETiledRemapKernel::NETiledRemapKernel()
+    : _func(nullptr), _input(nullptr), _map(nullptr), _tile_origins(nullptr), _output(nullptr)
+{
+}
+
+TensorShape NETiledRemapKernel::map_shape(const TensorShape &output_shape)
+{
+    TensorShape shape(output_shape);
+    shape.set(0, 2 * ceil_to_multiple(output_shape[0], tile_width));
+    return shape;
+}
+
+TensorShape NETiledRemapKernel::tile_origins_shape(const TensorShape &output_shape)
+{
+    TensorShape shape(output_shape);
+    shape.set(0, 2 * ceil_to_multiple(output_shape[0], tile_width) / tile_width);
+    shape.set(1, ceil_to_multiple(output_shape[1], tile_height) / tile_height);
+    return shape;
+}
+
+void NETiledRemapKernel::compile_map(const ITensor *map_x, const ITensor *map_y, size_t input_width, size_t input_height, InterpolationPolicy policy, ITensor *map, ITensor *tile_origins)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_x, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_y, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map, 1, DataType::U16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tile_origins, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(map_x, map_y);
+    ARM_COMPUTE_ERROR_ON(map->info()->tensor_shape() != map_shape(map_x->info()->tensor_shape()));
+    ARM_COMPUTE_ERROR_ON(tile_origins->info()->tensor_shape() != tile_origins_shape(map_x->info()->tensor_shape()));
+    ARM_COMPUTE_ERROR_ON(policy != InterpolationPolicy::NEAREST_NEIGHBOR && policy != InterpolationPolicy::BILINEAR);
+
+    const int width      = map_x->info()->dimension(0);
+    const int height     = map_x->info()->dimension(1);
+    const int num_tiles  = map->info()->dimension(0) / (2 * tile_width);
+    const int num_rows_y = tile_origins->info()->dimension(1);
+
+    // The columns padding the last tile of each row repeat the last column of the output: they don't extend the footprint
+    const auto source_coordinates = [&](int x, int y, int &fx, int &fy)
+    {
+        const Coordinates id(std::min(x, width - 1), y);
+        fx = fixed_point_coordinate(*reinterpret_cast<const float *>(map_x->ptr_to_element(id)), input_width, policy);
+        fy = fixed_point_coordinate(*reinterpret_cast<const float *>(map_y->ptr_to_element(id)), input_height, policy);
+    };
+
+    for(int tile_y = 0; tile_y < num_rows_y; ++tile_y)
+    {
+        const int y_start = tile_y * tile_height;
+        const int y_end   = std::min<int>(y_start + tile_height, height);
+
+        for(int tile_x = 0; tile_x < num_tiles; ++tile_x)
+        {
+            const int x_start = tile_x * tile_width;
+
+            // Top-left corner of the source footprint of the tile, in pixels
+            int origin_x = INT_MAX;
+            int origin_y = INT_MAX;
+            for(int y = y_start; y < y_end; ++y)
+            {
+                for(int x = x_start; x < x_start + static_cast<int>(tile_width); ++x)
+                {
+                    int fx = 0;
+                    int fy = 0;
+                    source_coordinates(x, y, fx, fy);
+                    origin_x = std::min(origin_x, fx >> fraction_bits);
+                    origin_y = std::min(origin_y, fy >> fraction_bits);
+                }
+            }
+
+            auto origin_ptr = reinterpret_cast<int32_t *>(tile_origins->ptr_to_element(Coordinates(2 * tile_x, tile_y)));
+            origin_ptr[0]   = origin_x;
+            origin_ptr[1]   = origin_y;
+
+            for(int y = y_start; y < y_end; ++y)
+            {
+                auto map_ptr = reinterpret_cast<uint16_t *>(map->ptr_to_element(Coordinates(2 * x_start, y)));
+
+                for(int x = 0; x < static_cast<int>(tile_width); ++x)
+                {
+                    int fx = 0;
+                    int fy = 0;
+                    source_coordinates(x_start + x, y, fx, fy);
+
+                    const int local_x = fx - (origin_x << fraction_bits);
+                    const int local_y = fy - (origin_y << fraction_bits);
+                    ARM_COMPUTE_ERROR_ON_MSG(local_x > UINT16_MAX || local_y > UINT16_MAX, "The source footprint of the tile is too large");
+
+                    map_ptr[2 * x]     = local_x;
+                    map_ptr[2 * x + 1] = local_y;
+                }
+            }
+        }
+    }
+}
+
+void NETiledRemapKernel::configure(const ITensor *input, const ITensor *map, const ITensor *tile_origins, ITensor *output, InterpolationPolicy policy)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map, 1, DataType::U16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(tile_origins, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON(map->info()->tensor_shape() != map_shape(output->info()->tensor_shape()));
+    ARM_COMPUTE_ERROR_ON(tile_origins->info()->tensor_shape() != tile_origins_shape(output->info()->tensor_shape()));
+
+    _input        = input;
+    _map          = map;
+    _tile_origins = tile_origins;
+    _output       = output;
+
+    switch(policy)
+    {
+        case InterpolationPolicy::NEAREST_NEIGHBOR:
+            _func = &NETiledRemapKernel::remap_tile_nearest;
+            break;
+        case InterpolationPolicy::BILINEAR:
+            _func = &NETiledRemapKernel::remap_tile_bilinear;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unsupported interpolation mode");
+            break;
+    }
+
+    // One iteration per tile: the last row of tiles is cut to the height of the output
+    const unsigned int num_tiles_x = map->info()->dimension(0) / (2 * tile_width);
+    const unsigned int num_tiles_y = tile_origins->info()->dimension(1);
+
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x * tile_width, tile_width));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y * tile_height, tile_height));
+
+    // The clamped coordinates read the border of the input: one pixel around it, plus the bilinear neighbours on the right and bottom sides
+    const BorderSize   border = border_size();
+    AccessWindowStatic input_access(input->info(), -border.left, -border.top, input->info()->dimension(0) + border.right, input->info()->dimension(1) + border.bottom);
+    AccessWindowStatic output_access(output->info(), 0, 0, num_tiles_x * tile_width, output->info()->dimension(1));
+
+    update_window_and_padding(win, input_access, output_access);
+
+    output_access.set_valid_region(win, ValidRegion(Coordinates(0, 0), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+BorderSize NETiledRemapKernel::border_size() const
+{
+    return (_func == &NETiledRemapKernel::remap_tile_bilinear) ? BorderSize(1, 2, 2, 1) : BorderSize(1);
+}
+
+void NETiledRemapKernel::remap_tile_nearest(const uint8_t *src_ptr, int x, int y_start, int y_end)
+{
+    const uint32x4_t stride = vdupq_n_u32(_input->info()->strides_in_bytes()[1]);
+
+    for(int y = y_start; y < y_end; ++y)
+    {
+        const auto map_ptr = reinterpret_cast<const uint16_t *>(_map->ptr_to_element(Coordinates(2 * x, y)));
+        uint8_t   *out_ptr = _output->ptr_to_element(Coordinates(x, y));
+
+        for(unsigned int i = 0; i < tile_width; i += 8)
+        {
+            uint32_t offsets[8];
+            footprint_offsets(vld2q_u16(map_ptr + 2 * i), stride, offsets);
+
+            for(unsigned int j = 0; j < 8; ++j)
+            {
+                out_ptr[i + j] = src_ptr[offsets[j]];
+            }
+        }
+    }
+}
+
+void NETiledRemapKernel::remap_tile_bilinear(const uint8_t *src_ptr, int x, int y_start, int y_end)
+{
+    const size_t     in_stride = _input->info()->strides_in_bytes()[1];
+    const uint32x4_t stride    = vdupq_n_u32(in_stride);
+    const uint16x8_t one       = vdupq_n_u16(1 << fraction_bits);
+    const uint16x8_t mask      = vdupq_n_u16(fraction_mask);
+
+    for(int y = y_start; y < y_end; ++y)
+    {
+        const auto map_ptr = reinterpret_cast<const uint16_t *>(_map->ptr_to_element(Coordinates(2 * x, y)));
+        uint8_t   *out_ptr = _output->ptr_to_element(Coordinates(x, y));
+
+        for(unsigned int i = 0; i < tile_width; i += num_elems_processed_per_iteration)
+        {
+            uint8_t result[num_elems_processed_per_iteration];
+
+            for(unsigned int k = 0; k < num_elems_processed_per_iteration; k += 8)
+            {
+                const uint16x8x2_t coords = vld2q_u16(map_ptr + 2 * (i + k));
+
+                // Gather the 4 neighbours of 8 output pixels from the footprint of the tile
+                uint32_t offsets[8];
+                footprint_offsets(coords, stride, offsets);
+
+                uint8_t a00[8];
+                uint8_t a01[8];
+                uint8_t a10[8];
+                uint8_t a11[8];
+                for(unsigned int j = 0; j < 8; ++j)
+                {
+                    const uint8_t *pixel_ptr = src_ptr + offsets[j];
+
+                    a00[j] = pixel_ptr[0];
+                    a01[j] = pixel_ptr[1];
+                    a10[j] = pixel_ptr[in_stride];
+                    a11[j] = pixel_ptr[in_stride + 1];
+                }
+
+                const uint16x8_t dx  = vandq_u16(coords.val[0], mask);
+                const uint16x8_t dy  = vandq_u16(coords.val[1], mask);
+                const uint16x8_t dx1 = vsubq_u16(one, dx);
+                const uint16x8_t dy1 = vsubq_u16(one, dy);
+
+                // Horizontal interpolation with weights in 1/32: at most 255 * 32
+                const uint16x8_t top    = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a00)), dx1), vmovl_u8(vld1_u8(a01)), dx);
+                const uint16x8_t bottom = vmlaq_u16(vmulq_u16(vmovl_u8(vld1_u8(a10)), dx1), vmovl_u8(vld1_u8(a11)), dx);
+
+                // Vertical interpolation: the sum of the weights is 1024, rounded to the nearest
+                const uint32x4_t res_low  = vmlal_u16(vmull_u16(vget_low_u16(top), vget_low_u16(dy1)), vget_low_u16(bottom), vget_low_u16(dy));
+                const uint32x4_t res_high = vmlal_u16(vmull_u16(vget_high_u16(top), vget_high_u16(dy1)), vget_high_u16(bottom), vget_high_u16(dy));
+
+                vst1_u8(result + k, vmovn_u16(vcombine_u16(vrshrn_n_u32(res_low, 2 * fraction_bits), vrshrn_n_u32(res_high, 2 * fraction_bits))));
+            }
+
+            vst1q_u8(out_ptr + i, vld1q_u8(result));
+        }
+    }
+}
+
+void NETiledRemapKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+    ARM_COMPUTE_ERROR_ON(_func == nullptr);
+
+    const int height = _output->info()->dimension(1);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto origin_ptr = reinterpret_cast<const int32_t *>(_tile_origins->ptr_to_element(Coordinates(2 * (id.x() / static_cast<int>(tile_width)), id.y() / static_cast<int>(tile_height))));
+
+        // The source pixels of the tile are addressed from the origin of its footprint, which may be in the border of the input
+        const uint8_t *src_ptr = _input->buffer() + _input->info()->offset_first_element_in_bytes() + origin_ptr[0] * static_cast<int>(_input->info()->strides_in_bytes()[0])
+                                 + origin_ptr[1] * static_cast<int>(_input->info()->strides_in_bytes()[1]);
+
+        (this->*_func)(src_ptr, id.x(), id.y(), std::min<int>(id.y() + tile_height, height));
+    });
+}
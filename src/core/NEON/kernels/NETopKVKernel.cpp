@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NETopKVKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Insert a value in the sorted list of the highest values found so far.
+ *
+ * @param[in]      value     Value to insert. Must be greater than the last value of the list if the list is full.
+ * @param[in]      index     Index of the value in the row.
+ * @param[in, out] scores    Highest values found so far, in descending order.
+ * @param[in, out] indices   Indices of the highest values found so far.
+ * @param[in, out] num_found Number of values in the list. Incremented if the list isn't full.
+ * @param[in]      k         Capacity of the list.
+ */
+inline void insert_top_k(float value, uint32_t index, float *scores, uint32_t *indices, unsigned int &num_found, unsigned int k)
+{
+    // The last value falls out of the list if it is full
+    unsigned int pos = (num_found < k) ? num_found++ : k - 1;
+
+    // Values from earlier indices stay first in case of a tie
+    for(; pos > 0 && scores[pos - 1] < value; --pos)
+    {
+        scores[pos]  = scores[pos - 1];
+        indices[pos] = indices[pos - 1];
+    }
+    scores[pos]  = value;
+    indices[pos] = index;
+}
+} // namespace
+
+NETopKVKernel::NETopKVKernel()
+    : _input(nullptr), _indices(nullptr), _scores(nullptr), _k(0)
+{
+}
+
+void NETopKVKernel::configure(const ITensor *input, ITensor *indices, ITensor *scores, unsigned int k)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(indices, 1, DataType::U32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, scores);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(indices, scores);
+    ARM_COMPUTE_ERROR_ON(k == 0 || k > input->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(indices->info()->dimension(0) != k);
+    for(size_t d = 1; d < TensorShape::num_max_dimensions; ++d)
+    {
+        ARM_COMPUTE_ERROR_ON(indices->info()->dimension(d) != input->info()->dimension(d));
+    }
+
+    _input   = input;
+    _indices = indices;
+    _scores  = scores;
+    _k       = k;
+
+    // Configure kernel window: each iteration processes a whole row, whose tail is processed element by element so no padding is needed
+    Window win = calculate_max_window(*input->info(), Steps());
+    win.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    indices->info()->set_valid_region(ValidRegion(Coordinates(), indices->info()->tensor_shape()));
+    scores->info()->set_valid_region(ValidRegion(Coordinates(), scores->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NETopKVKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    Iterator input(_input, window);
+    Iterator indices(_indices, window);
+    Iterator scores(_scores, window);
+
+    const int row_width = _input->info()->valid_region().shape.x();
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        const auto in_ptr      = reinterpret_cast<const float *>(input.ptr());
+        const auto indices_ptr = reinterpret_cast<uint32_t *>(indices.ptr());
+        const auto scores_ptr  = reinterpret_cast<float *>(scores.ptr());
+
+        // Fill the list with the first k values
+        unsigned int num_found = 0;
+        int          x         = 0;
+        for(; x < static_cast<int>(_k); ++x)
+        {
+            insert_top_k(in_ptr[x], x, scores_ptr, indices_ptr, num_found, _k);
+        }
+
+        // Once the list is full, most of the values are lower than its last value: skip the vectors which don't have any higher value
+        for(; x <= row_width - 4; x += 4)
+        {
+            const float32x4_t values = vld1q_f32(in_ptr + x);
+            const uint32x4_t  mask   = vcgtq_f32(values, vdupq_n_f32(scores_ptr[_k - 1]));
+            const uint32x2_t  any    = vpmax_u32(vget_low_u32(mask), vget_high_u32(mask));
+            if(vget_lane_u32(vpmax_u32(any, any), 0) != 0)
+            {
+                for(int i = 0; i < 4; ++i)
+                {
+                    if(in_ptr[x + i] > scores_ptr[_k - 1])
+                    {
+                        insert_top_k(in_ptr[x + i], x + i, scores_ptr, indices_ptr, num_found, _k);
+                    }
+                }
+            }
+        }
+        for(; x < row_width; ++x)
+        {
+            if(in_ptr[x] > scores_ptr[_k - 1])
+            {
+                insert_top_k(in_ptr[x], x, scores_ptr, indices_ptr, num_found, _k);
+            }
+        }
+    },
+    input, indices, scores);
+}
@@ -32,7 +32,11 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/core/Window.h"
 
+#include <algorithm>
+#include <arm_neon.h>
+#include <cmath>
 #include <cstddef>
+#include <cstdint>
 
 using namespace arm_compute;
 
@@ -42,6 +46,35 @@ inline uint8_t nearest_interpolation(const uint8_t *in_ptr, int x, int y, size_t
 {
     return in_ptr[x + y * stride];
 }
+
+/** Length of the segments of a row of the output on which the perspective mapping is linearly interpolated within a maximum error
+ *
+ * Along the row, xn(x) = (ax + M00 * x) / z(x) with z(x) = c + M20 * x, whose second derivative is -2 * M20 * (M00 * c - ax * M20) / z(x)^3,
+ * and likewise for yn: the linear interpolation between the ends of a segment of length L is at most L^2 / 8 * max|(xn'', yn'')| away from the mapping.
+ */
+int segment_length(float M00, float M10, float M20, float ax, float ay, float c, int x_start, int x_end, float max_error)
+{
+    const float z_start = c + M20 * x_start;
+    const float z_end   = c + M20 * x_end;
+
+    // The row crosses the vanishing line: the mapping is not continuous along it
+    if(z_start * z_end <= 0.f)
+    {
+        return 1;
+    }
+
+    const float z_min     = std::min(std::abs(z_start), std::abs(z_end));
+    const float dx        = M00 * c - ax * M20;
+    const float dy        = M10 * c - ay * M20;
+    const float curvature = 2.f * std::abs(M20) * std::sqrt(dx * dx + dy * dy) / (z_min * z_min * z_min);
+    const float width     = x_end - x_start;
+
+    if(curvature * width * width <= 8.f * max_error)
+    {
+        return x_end - x_start;
+    }
+    return std::max(1, static_cast<int>(std::sqrt(8.f * max_error / curvature)));
+}
 } // namespace
 
 INEWarpKernel::INEWarpKernel()
@@ -105,6 +138,136 @@ void INEWarpKernel::configure(const ITensor *input, ITensor *output, const float
     INEKernel::configure(win);
 }
 
+void INEWarpKernel::build_remap_table(ITensor *offsets, ITensor *fractions, BorderMode border_mode) const
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(offsets, 1, DataType::S32);
+    ARM_COMPUTE_ERROR_ON(fractions != nullptr && fractions->info()->data_type() != DataType::U16);
+    ARM_COMPUTE_ERROR_ON(offsets->info()->dimension(0) != _output->info()->dimension(0));
+    ARM_COMPUTE_ERROR_ON(offsets->info()->dimension(1) != _output->info()->dimension(1));
+
+    const int    min_x  = _input->info()->valid_region().anchor[0];
+    const int    max_x  = min_x + _input->info()->valid_region().shape[0];
+    const int    min_y  = _input->info()->valid_region().anchor[1];
+    const int    max_y  = min_y + _input->info()->valid_region().shape[1];
+    const size_t stride = _input->info()->strides_in_bytes()[1];
+
+    const int width  = offsets->info()->dimension(0);
+    const int height = offsets->info()->dimension(1);
+
+    // Entries read past the end of the rows (Table kernels process several output pixels per iteration) use the border value
+    const int padded_width = width + offsets->info()->padding().right;
+
+    for(int y = 0; y < height; ++y)
+    {
+        auto offsets_ptr   = reinterpret_cast<int32_t *>(offsets->ptr_to_element(Coordinates(0, y)));
+        auto fractions_ptr = fractions != nullptr ? reinterpret_cast<uint16_t *>(fractions->ptr_to_element(Coordinates(0, y))) : nullptr;
+
+        for(int x = 0; x < width; ++x)
+        {
+            int32_t  offset   = -1;
+            uint16_t fraction = 0;
+
+            float x0 = 0.f;
+            float y0 = 0.f;
+            map_coordinates(x, y, x0, y0);
+
+            if((min_y <= y0) && (y0 < max_y) && (min_x <= x0) && (x0 < max_x))
+            {
+                const int xi = x0;
+                const int yi = y0;
+
+                offset = xi + yi * stride;
+
+                // The weights are truncated to 1/256 of pixel
+                const uint16_t dx = (x0 - xi) * 256.f;
+                const uint16_t dy = (y0 - yi) * 256.f;
+                fraction          = dx | (dy << 8);
+            }
+            else if(border_mode == BorderMode::REPLICATE)
+            {
+                // Clamp coordinates
+                const auto xi = clamp<int>(x0, min_x, max_x - 1);
+                const auto yi = clamp<int>(y0, min_y, max_y - 1);
+
+                offset = xi + yi * stride;
+            }
+
+            offsets_ptr[x] = offset;
+
+            if(fractions_ptr != nullptr)
+            {
+                fractions_ptr[x] = fraction;
+            }
+        }
+
+        std::fill(offsets_ptr + width, offsets_ptr + padded_width, -1);
+
+        if(fractions_ptr != nullptr)
+        {
+            std::fill(fractions_ptr + width, fractions_ptr + padded_width, 0);
+        }
+    }
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpAffineKernel<interpolation>::map_coordinates(int x, int y, float &x0, float &y0) const
+{
+    // x0 = M00 * x + M01 * y + M02
+    // y0 = M10 * x + M11 * y + M12
+    x0 = _matrix[0] * x + _matrix[0 + 1 * 2] * y + _matrix[0 + 2 * 2];
+    y0 = _matrix[1] * x + _matrix[1 + 1 * 2] * y + _matrix[1 + 2 * 2];
+}
+
+template <InterpolationPolicy interpolation>
+NEWarpPerspectiveKernel<interpolation>::NEWarpPerspectiveKernel()
+    : _max_error(0.f), _border_mode(BorderMode::UNDEFINED)
+{
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::set_max_error(float max_error)
+{
+    ARM_COMPUTE_ERROR_ON(max_error < 0.f);
+
+    _max_error = max_error;
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::configure(const ITensor *input, ITensor *output, const float *matrix, BorderMode border_mode, uint8_t constant_border_value)
+{
+    _border_mode = border_mode;
+
+    INEWarpKernel::configure(input, output, matrix, border_mode, constant_border_value);
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::run(const Window &window)
+{
+    if(_max_error > 0.f)
+    {
+        ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+        ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+        warp_approximate(window);
+    }
+    else
+    {
+        INEWarpKernel::run(window);
+    }
+}
+
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::map_coordinates(int x, int y, float &x0, float &y0) const
+{
+    // xn = (M00 * x + M01 * y + M02) / (M20 * x + M21 * y + M22)
+    // yn = (M10 * x + M11 * y + M12) / (M20 * x + M21 * y + M22)
+    const float z0 = _matrix[2] * x + _matrix[2 + 1 * 3] * y + _matrix[2 + 2 * 3];
+
+    x0 = (_matrix[0] * x + _matrix[0 + 1 * 3] * y + _matrix[0 + 2 * 3]) / z0;
+    y0 = (_matrix[1] * x + _matrix[1 + 1 * 3] * y + _matrix[1 + 2 * 3]) / z0;
+}
+
 template <InterpolationPolicy interpolation>
 void NEWarpAffineKernel<interpolation>::warp_undefined(const Window &window)
 {
@@ -645,6 +808,143 @@ void NEWarpPerspectiveKernel<interpolation>::warp_replicate(const Window &window
     in, out);
 }
 
+template <InterpolationPolicy interpolation>
+void NEWarpPerspectiveKernel<interpolation>::warp_approximate(const Window &window)
+{
+    // Don't increment in X and Y direction for the input tensor
+    // A pointer to the start of this plane is needed as base for the precomputed offsets
+    Window win_in(window);
+    win_in.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_in.set(Window::DimY, Window::Dimension(0, 0, 0));
+
+    // Each iteration processes a whole row of the window
+    const int x_start = window.x().start();
+    const int x_end   = window.x().end();
+    Window    win_rows(window);
+    win_rows.set(Window::DimX, Window::Dimension(x_start, x_start + 1, 1));
+
+    Iterator in(_input, win_in);
+    Iterator out(_output, win_rows);
+
+    const int    min_x  = _input->info()->valid_region().anchor[0];
+    const int    max_x  = min_x + _input->info()->valid_region().shape[0];
+    const int    min_y  = _input->info()->valid_region().anchor[1];
+    const int    max_y  = min_y + _input->info()->valid_region().shape[1];
+    const size_t stride = _input->info()->strides_in_bytes()[1];
+
+    const float M00 = _matrix[0];
+    const float M10 = _matrix[1];
+    const float M20 = _matrix[2];
+    const float M01 = _matrix[0 + 1 * 3];
+    const float M11 = _matrix[1 + 1 * 3];
+    const float M21 = _matrix[2 + 1 * 3];
+    const float M02 = _matrix[0 + 2 * 3];
+    const float M12 = _matrix[1 + 2 * 3];
+    const float M22 = _matrix[2 + 2 * 3];
+
+    static const float ramp_values[] = { 0.f, 1.f, 2.f, 3.f };
+
+    const float32x4_t vmin_x = vdupq_n_f32(min_x);
+    const float32x4_t vmax_x = vdupq_n_f32(max_x);
+    const float32x4_t vmin_y = vdupq_n_f32(min_y);
+    const float32x4_t vmax_y = vdupq_n_f32(max_y);
+    const float32x4_t ramp   = vld1q_f32(ramp_values);
+
+    const auto interpolate = [&](const uint8_t *in_ptr, float xn, float yn)
+    {
+        return (interpolation == InterpolationPolicy::NEAREST_NEIGHBOR) ? nearest_interpolation(in_ptr, xn, yn, stride) : pixel_bilinear_c1u8(in_ptr, stride, xn, yn);
+    };
+
+    // Same handling of the source pixels outside of the valid region as the exact warps
+    const auto sample = [&](const uint8_t *in_ptr, float xn, float yn, uint8_t *out_ptr)
+    {
+        if((min_y <= yn) && (yn < max_y) && (min_x <= xn) && (xn < max_x))
+        {
+            *out_ptr = interpolate(in_ptr, xn, yn);
+        }
+        else if(_border_mode == BorderMode::CONSTANT)
+        {
+            *out_ptr = _constant_border_value;
+        }
+        else if(_border_mode == BorderMode::REPLICATE)
+        {
+            const auto xi = clamp<int>(xn, min_x, max_x - 1);
+            const auto yi = clamp<int>(yn, min_y, max_y - 1);
+
+            *out_ptr = *(in_ptr + xi + yi * stride);
+        }
+    };
+
+    execute_window_loop(win_rows, [&](const Coordinates & id)
+    {
+        // Numerators and denominator of the mapping at x = 0 for this row
+        const float ax = M01 * id.y() + M02;
+        const float ay = M11 * id.y() + M12;
+        const float c  = M21 * id.y() + M22;
+
+        const int      length  = segment_length(M00, M10, M20, ax, ay, c, x_start, x_end, _max_error);
+        const uint8_t *in_ptr  = in.ptr();
+        uint8_t       *out_ptr = out.ptr();
+
+        // Exact coordinates at the start of the first segment, then at the end of each segment
+        float z  = c + M20 * x_start;
+        float xn = (ax + M00 * x_start) / z;
+        float yn = (ay + M10 * x_start) / z;
+
+        for(int x = x_start; x < x_end; x += length)
+        {
+            const int num_pixels = std::min(length, x_end - x);
+
+            z                = c + M20 * (x + num_pixels);
+            const float xn_1 = (ax + M00 * (x + num_pixels)) / z;
+            const float yn_1 = (ay + M10 * (x + num_pixels)) / z;
+            const float dx   = (xn_1 - xn) / num_pixels;
+            const float dy   = (yn_1 - yn) / num_pixels;
+
+            int i = 0;
+            for(; i <= num_pixels - 4; i += 4)
+            {
+                const float32x4_t t  = vaddq_f32(ramp, vdupq_n_f32(i));
+                const float32x4_t vx = vmlaq_n_f32(vdupq_n_f32(xn), t, dx);
+                const float32x4_t vy = vmlaq_n_f32(vdupq_n_f32(yn), t, dy);
+
+                float xs[4];
+                float ys[4];
+                vst1q_f32(xs, vx);
+                vst1q_f32(ys, vy);
+
+                // Most of the pixels map inside of the input: check the 4 of them at once
+                const uint32x4_t inside = vandq_u32(vandq_u32(vcgeq_f32(vx, vmin_x), vcltq_f32(vx, vmax_x)), vandq_u32(vcgeq_f32(vy, vmin_y), vcltq_f32(vy, vmax_y)));
+                const uint32x2_t all    = vpmin_u32(vget_low_u32(inside), vget_high_u32(inside));
+
+                uint8_t *dst = out_ptr + (x - x_start) + i;
+                if(vget_lane_u32(vpmin_u32(all, all), 0) != 0)
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        dst[j] = interpolate(in_ptr, xs[j], ys[j]);
+                    }
+                }
+                else
+                {
+                    for(int j = 0; j < 4; ++j)
+                    {
+                        sample(in_ptr, xs[j], ys[j], dst + j);
+                    }
+                }
+            }
+            for(; i < num_pixels; ++i)
+            {
+                sample(in_ptr, xn + i * dx, yn + i * dy, out_ptr + (x - x_start) + i);
+            }
+
+            xn = xn_1;
+            yn = yn_1;
+        }
+    },
+    in, out);
+}
+
 template class arm_compute::NEWarpAffineKernel<InterpolationPolicy::NEAREST_NEIGHBOR>;
 template class arm_compute::NEWarpAffineKernel<InterpolationPolicy::BILINEAR>;
 template class arm_compute::NEWarpPerspectiveKernel<InterpolationPolicy::NEAREST_NEIGHBOR>;
@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEWinogradFilterTransformKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+NEWinogradFilterTransformKernel::NEWinogradFilterTransformKernel()
+    : _weights(nullptr), _output(nullptr)
+{
+}
+
+void NEWinogradFilterTransformKernel::configure(const ITensor *weights, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(weights, output);
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(0) != 3) || (weights->info()->dimension(1) != 3));
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != weights->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _weights = weights;
+    _output  = output;
+
+    // Configure kernel window: each iteration transforms one 3x3 kernel
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, weights->info()->dimension(2), 1));
+    win.set(Window::DimY, Window::Dimension(0, weights->info()->dimension(3), 1));
+
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradFilterTransformKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const size_t weights_stride_y = _weights->info()->strides_in_bytes()[1];
+    const size_t weights_stride_z = _weights->info()->strides_in_bytes()[2];
+    const size_t weights_stride_w = _weights->info()->strides_in_bytes()[3];
+    const size_t output_stride_y  = _output->info()->strides_in_bytes()[1];
+    const size_t output_stride_z  = _output->info()->strides_in_bytes()[2];
+
+    const uint8_t *const weights_ptr = _weights->buffer() + _weights->info()->offset_first_element_in_bytes();
+    uint8_t *const       output_ptr  = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int ifm = id.x();
+        const int ofm = id.y();
+
+        const uint8_t *const kernel = weights_ptr + ifm * weights_stride_z + ofm * weights_stride_w;
+
+        float g[3][3];
+        for(int i = 0; i < 3; ++i)
+        {
+            const auto row = reinterpret_cast<const float *>(kernel + i * weights_stride_y);
+            g[i][0]        = row[0];
+            g[i][1]        = row[1];
+            g[i][2]        = row[2];
+        }
+
+        // T = G * g
+        float t[4][3];
+        for(int j = 0; j < 3; ++j)
+        {
+            t[0][j] = g[0][j];
+            t[1][j] = 0.5f * (g[0][j] + g[1][j] + g[2][j]);
+            t[2][j] = 0.5f * (g[0][j] - g[1][j] + g[2][j]);
+            t[3][j] = g[2][j];
+        }
+
+        // U = T * G'
+        uint8_t *const out = output_ptr + ofm * sizeof(float) + ifm * output_stride_y;
+        for(int i = 0; i < 4; ++i)
+        {
+            const float u[4] =
+            {
+                t[i][0],
+                0.5f * (t[i][0] + t[i][1] + t[i][2]),
+                0.5f * (t[i][0] - t[i][1] + t[i][2]),
+                t[i][2]
+            };
+
+            for(int j = 0; j < 4; ++j)
+            {
+                *reinterpret_cast<float *>(out + (i * 4 + j) * output_stride_z) = u[j];
+            }
+        }
+    });
+}
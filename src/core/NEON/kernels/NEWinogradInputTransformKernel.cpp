@@ -0,0 +1,168 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEWinogradInputTransformKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+
+using namespace arm_compute;
+
+NEWinogradInputTransformKernel::NEWinogradInputTransformKernel()
+    : _input(nullptr), _output(nullptr), _pad_x(0), _pad_y(0), _num_tiles_x(0), _num_tiles_y(0)
+{
+}
+
+void NEWinogradInputTransformKernel::configure(const ITensor *input, ITensor *output, const PadStrideInfo &conv_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(conv_info.stride().first != 1 || conv_info.stride().second != 1);
+    ARM_COMPUTE_ERROR_ON(conv_info.pad().first > 2 || conv_info.pad().second > 2);
+
+    unsigned int conv_w = 0;
+    unsigned int conv_h = 0;
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), 3,
+                                                 1, 1, conv_info.pad().first, conv_info.pad().second, conv_info.round());
+
+    const unsigned int num_tiles_x = (conv_w + 1) / 2;
+    const unsigned int num_tiles_y = (conv_h + 1) / 2;
+    const unsigned int num_batches = input->info()->dimension(3);
+
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != num_tiles_x * num_tiles_y * num_batches);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(2) != 16);
+
+    _input       = input;
+    _output      = output;
+    _pad_x       = conv_info.pad().first;
+    _pad_y       = conv_info.pad().second;
+    _num_tiles_x = num_tiles_x;
+    _num_tiles_y = num_tiles_y;
+
+    // Configure kernel window: each iteration transforms one tile of one input feature map
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, input->info()->dimension(2), 1));
+    win.set(3, Window::Dimension(0, num_batches, 1));
+
+    // The kernel only reads the valid region of the input so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradInputTransformKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int input_width  = _input->info()->dimension(0);
+    const int input_height = _input->info()->dimension(1);
+
+    const size_t input_stride_y  = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z  = _input->info()->strides_in_bytes()[2];
+    const size_t input_stride_w  = _input->info()->strides_in_bytes()[3];
+    const size_t output_stride_y = _output->info()->strides_in_bytes()[1];
+    const size_t output_stride_z = _output->info()->strides_in_bytes()[2];
+
+    const uint8_t *const input_ptr  = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t *const       output_ptr = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int x0 = id.x() * 2 - _pad_x;
+        const int y0 = id.y() * 2 - _pad_y;
+
+        const uint8_t *const plane = input_ptr + id.z() * input_stride_z + id[3] * input_stride_w;
+
+        // Load the tile, the values outside the input are zero
+        float d[4][4];
+        if((x0 >= 0) && (y0 >= 0) && (x0 + 4 <= input_width) && (y0 + 4 <= input_height))
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                const auto row = reinterpret_cast<const float *>(plane + (y0 + i) * input_stride_y) + x0;
+                for(int j = 0; j < 4; ++j)
+                {
+                    d[i][j] = row[j];
+                }
+            }
+        }
+        else
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                const int  y       = y0 + i;
+                const bool is_y_in = (y >= 0) && (y < input_height);
+                const auto row     = reinterpret_cast<const float *>(plane + (is_y_in ? y : 0) * input_stride_y);
+                for(int j = 0; j < 4; ++j)
+                {
+                    const int x = x0 + j;
+                    d[i][j]     = (is_y_in && (x >= 0) && (x < input_width)) ? row[x] : 0.f;
+                }
+            }
+        }
+
+        // T = B' * d
+        float t[4][4];
+        for(int j = 0; j < 4; ++j)
+        {
+            t[0][j] = d[0][j] - d[2][j];
+            t[1][j] = d[1][j] + d[2][j];
+            t[2][j] = d[2][j] - d[1][j];
+            t[3][j] = d[1][j] - d[3][j];
+        }
+
+        // V = T * B
+        const int      tile = (id[3] * _num_tiles_y + id.y()) * _num_tiles_x + id.x();
+        uint8_t *const out  = output_ptr + id.z() * sizeof(float) + tile * output_stride_y;
+        for(int i = 0; i < 4; ++i)
+        {
+            const float v[4] =
+            {
+                t[i][0] - t[i][2],
+                t[i][1] + t[i][2],
+                t[i][2] - t[i][1],
+                t[i][1] - t[i][3]
+            };
+
+            for(int j = 0; j < 4; ++j)
+            {
+                *reinterpret_cast<float *>(out + (i * 4 + j) * output_stride_z) = v[j];
+            }
+        }
+    });
+}
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/NEWinogradOutputTransformKernel.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEActivationFunction.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+
+using namespace arm_compute;
+
+NEWinogradOutputTransformKernel::NEWinogradOutputTransformKernel()
+    : _act_func(nullptr), _input(nullptr), _biases(nullptr), _output(nullptr), _act_info(), _num_tiles_x(0), _num_tiles_y(0)
+{
+}
+
+void NEWinogradOutputTransformKernel::configure(const ITensor *input, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(output->info()->num_dimensions() > 4);
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != output->info()->dimension(2));
+        ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
+    }
+
+    const unsigned int num_tiles_x = (output->info()->dimension(0) + 1) / 2;
+    const unsigned int num_tiles_y = (output->info()->dimension(1) + 1) / 2;
+    const unsigned int num_batches = output->info()->dimension(3);
+
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != output->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != num_tiles_x * num_tiles_y * num_batches);
+    ARM_COMPUTE_ERROR_ON(input->info()->dimension(2) != 16);
+
+    using ActivationFunction = ActivationLayerInfo::ActivationFunction;
+
+    static std::map<ActivationFunction, ActivationFunctionPtr> act_map =
+    {
+        { ActivationFunction::ABS, &activate<ActivationFunction::ABS> },
+        { ActivationFunction::LINEAR, &activate<ActivationFunction::LINEAR> },
+        { ActivationFunction::LOGISTIC, &activate<ActivationFunction::LOGISTIC> },
+        { ActivationFunction::RELU, &activate<ActivationFunction::RELU> },
+        { ActivationFunction::BOUNDED_RELU, &activate<ActivationFunction::BOUNDED_RELU> },
+        { ActivationFunction::SOFT_RELU, &activate<ActivationFunction::SOFT_RELU> },
+        { ActivationFunction::SQRT, &activate<ActivationFunction::SQRT> },
+        { ActivationFunction::SQUARE, &activate<ActivationFunction::SQUARE> },
+        { ActivationFunction::TANH, &activate<ActivationFunction::TANH> },
+    };
+
+    _input       = input;
+    _biases      = biases;
+    _output      = output;
+    _act_info    = act_info;
+    _act_func    = act_info.enabled() ? act_map[act_info.activation()] : nullptr;
+    _num_tiles_x = num_tiles_x;
+    _num_tiles_y = num_tiles_y;
+
+    // Configure kernel window: each iteration computes one tile of one output feature map
+    Window win;
+    win.set(Window::DimX, Window::Dimension(0, num_tiles_x, 1));
+    win.set(Window::DimY, Window::Dimension(0, num_tiles_y, 1));
+    win.set(Window::DimZ, Window::Dimension(0, output->info()->dimension(2), 1));
+    win.set(3, Window::Dimension(0, num_batches, 1));
+
+    // The kernel only writes the valid region of the output so update_window_and_padding() can be skipped
+    output->info()->set_valid_region(ValidRegion(Coordinates(), output->info()->tensor_shape()));
+
+    INEKernel::configure(win);
+}
+
+void NEWinogradOutputTransformKernel::run(const Window &window)
+{
+    ARM_COMPUTE_ERROR_ON_UNCONFIGURED_KERNEL(this);
+    ARM_COMPUTE_ERROR_ON_INVALID_SUBWINDOW(INEKernel::window(), window);
+
+    const int output_width  = _output->info()->dimension(0);
+    const int output_height = _output->info()->dimension(1);
+
+    const size_t input_stride_y  = _input->info()->strides_in_bytes()[1];
+    const size_t input_stride_z  = _input->info()->strides_in_bytes()[2];
+    const size_t output_stride_y = _output->info()->strides_in_bytes()[1];
+    const size_t output_stride_z = _output->info()->strides_in_bytes()[2];
+    const size_t output_stride_w = _output->info()->strides_in_bytes()[3];
+
+    const uint8_t *const input_ptr  = _input->buffer() + _input->info()->offset_first_element_in_bytes();
+    uint8_t *const       output_ptr = _output->buffer() + _output->info()->offset_first_element_in_bytes();
+
+    const float a = _act_info.a();
+    const float b = _act_info.b();
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const int ofm  = id.z();
+        const int tile = (id[3] * _num_tiles_y + id.y()) * _num_tiles_x + id.x();
+
+        const uint8_t *const in = input_ptr + ofm * sizeof(float) + tile * input_stride_y;
+
+        float m[4][4];
+        for(int i = 0; i < 4; ++i)
+        {
+            for(int j = 0; j < 4; ++j)
+            {
+                m[i][j] = *reinterpret_cast<const float *>(in + (i * 4 + j) * input_stride_z);
+            }
+        }
+
+        // T = A' * M
+        float t[2][4];
+        for(int j = 0; j < 4; ++j)
+        {
+            t[0][j] = m[0][j] + m[1][j] + m[2][j];
+            t[1][j] = m[1][j] - m[2][j] - m[3][j];
+        }
+
+        // Y = T * A
+        const float bias = (_biases != nullptr) ? *reinterpret_cast<const float *>(_biases->ptr_to_element(Coordinates(ofm))) : 0.f;
+        float       y[2][2];
+        for(int i = 0; i < 2; ++i)
+        {
+            y[i][0] = t[i][0] + t[i][1] + t[i][2] + bias;
+            y[i][1] = t[i][1] - t[i][2] - t[i][3] + bias;
+        }
+
+        // Store the part of the tile inside the output
+        const int x0 = id.x() * 2;
+        const int y0 = id.y() * 2;
+
+        uint8_t *const plane = output_ptr + ofm * output_stride_z + id[3] * output_stride_w;
+        for(int i = 0; (i < 2) && (y0 + i < output_height); ++i)
+        {
+            const auto row = reinterpret_cast<float *>(plane + (y0 + i) * output_stride_y) + x0;
+            for(int j = 0; (j < 2) && (x0 + j < output_width); ++j)
+            {
+                row[j] = (_act_func != nullptr) ? _act_func(y[i][j], a, b) : y[i][j];
+            }
+        }
+    });
+}
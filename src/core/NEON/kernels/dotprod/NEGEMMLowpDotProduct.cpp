@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/dotprod/NEGEMMLowpDotProduct.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+using namespace arm_compute;
+
+#ifdef ARM_COMPUTE_ENABLE_DOTPROD
+namespace
+{
+/** Indices of the table lookup transposing a 4x4 block of bytes: the element k of the row r moves from 4 * k + r to 4 * r + k */
+const uint8_t transpose_indices[16] = { 0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15 };
+
+/** Requantize 4 accumulators: multiply them by the integer multiplier, shift them right, rounding to the nearest integer, then add the result offset.
+ *
+ * The product is computed in 64 bits so that the multiplier can use up to 31 bits without overflowing.
+ */
+inline int32x4_t vrequantizeq_s32(const int32x4_t &x, const int32x2_t &multiplier, const int64x2_t &shift_right, const int32x4_t &result_offset)
+{
+    const int64x2_t low  = vrshlq_s64(vmull_s32(vget_low_s32(x), multiplier), shift_right);
+    const int64x2_t high = vrshlq_s64(vmull_s32(vget_high_s32(x), multiplier), shift_right);
+    return vqaddq_s32(vcombine_s32(vqmovn_s64(low), vqmovn_s64(high)), result_offset);
+}
+
+/** Saturate 8 requantized values to uint8 and clamp them to the range of the fused activation function */
+inline uint8x8_t vclamp_u8(const int32x4_t &low, const int32x4_t &high, const uint8x8_t &min_bound, const uint8x8_t &max_bound)
+{
+    return vmin_u8(vmax_u8(vqmovun_s16(vcombine_s16(vqmovn_s32(low), vqmovn_s32(high))), min_bound), max_bound);
+}
+
+/** Load 4 elements of the dot product for 4 rows and transpose them so that the elements of each row are contiguous
+ *
+ * @param[in] ptr       Pointer to the block, holding the 4 rows of each element contiguously
+ * @param[in] num_elems Number of elements of the dot product left in the row: the elements past the end are zero
+ * @param[in] transpose Indices of the table lookup transposing the block
+ *
+ * @return The transposed block
+ */
+inline uint8x16_t vload_block_u8(const uint8_t *ptr, int num_elems, const uint8x16_t &transpose)
+{
+    if(num_elems >= 4)
+    {
+        return vqtbl1q_u8(vld1q_u8(ptr), transpose);
+    }
+
+    uint8_t block[16] = { 0 };
+    std::memcpy(block, ptr, 4 * num_elems);
+    return vqtbl1q_u8(vld1q_u8(block), transpose);
+}
+} // namespace
+
+void dotprod::matrix_multiply(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, const QuantizationParameters &params)
+{
+    const size_t in_b_stride = input1->info()->strides_in_bytes()[1];
+    const size_t out_stride  = output->info()->strides_in_bytes()[1];
+    const int    depth       = input1->info()->dimension(0) / 4;
+
+    // Set step_x and step_y for matrix A. Scale by a factor of 4 the Y range as the input interleaved matrix A has 4 times less the rows of the output matrix
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() >> 2, window.y().end() >> 2, 1));
+
+    // Set step_x and step_y for matrix B. The input transposed matrix B has one row for each 4 columns of the output matrix: start on the row of the first column of the window
+    Window win_b(window);
+    win_b.set(Window::DimX, Window::Dimension(0, 1, in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
+
+    Iterator ina(input0, win_a);
+    Iterator inb(input1, win_b);
+    Iterator out(output, window);
+
+    const uint8x16_t transpose       = vld1q_u8(transpose_indices);
+    const uint8x16_t ones            = vdupq_n_u8(1);
+    const int32x4_t  voffset_out     = vdupq_n_s32(params.output_offset);
+    const int32x2_t  vmult           = vdup_n_s32(params.output_mult_int);
+    const int64x2_t  vshiftr         = vdupq_n_s64(-params.shift);
+    const int32x4_t  vresult_offset  = vdupq_n_s32(params.result_offset);
+    const uint8x8_t  vmin_bound      = vdup_n_u8(params.min_bound);
+    const uint8x8_t  vmax_bound      = vdup_n_u8(params.max_bound);
+    const int32_t    offsets_product = depth * params.a_offset * params.b_offset;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto mtx_a0 = reinterpret_cast<const uint8_t *>(ina.ptr());
+        const auto mtx_b0 = reinterpret_cast<const uint8_t *>(inb.ptr());
+
+        // acc[i] holds the row i of the block, sum_a and sum_b the sums of the rows of A and of the columns of B
+        uint32x4_t acc[4] = { vdupq_n_u32(0), vdupq_n_u32(0), vdupq_n_u32(0), vdupq_n_u32(0) };
+        uint32x4_t sum_a  = vdupq_n_u32(0);
+        uint32x4_t sum_b  = vdupq_n_u32(0);
+
+        for(int k = 0; k < depth; k += 4)
+        {
+            const uint8x16_t a = vload_block_u8(mtx_a0 + 4 * k, depth - k, transpose);
+            const uint8x16_t b = vload_block_u8(mtx_b0 + 4 * k, depth - k, transpose);
+
+            acc[0] = vdotq_laneq_u32(acc[0], b, a, 0);
+            acc[1] = vdotq_laneq_u32(acc[1], b, a, 1);
+            acc[2] = vdotq_laneq_u32(acc[2], b, a, 2);
+            acc[3] = vdotq_laneq_u32(acc[3], b, a, 3);
+            sum_a  = vdotq_u32(sum_a, a, ones);
+            sum_b  = vdotq_u32(sum_b, b, ones);
+        }
+
+        // sum((a + a_offset) * (b + b_offset)) = sum(a * b) + a_offset * sum(b) + b_offset * sum(a) + depth * a_offset * b_offset
+        // The biases are the same for the 4 rows of the block
+        const int32x4_t voffset     = (biases != nullptr) ? vaddq_s32(voffset_out, vld1q_s32(reinterpret_cast<const int32_t *>(biases->ptr_to_element(Coordinates(id.x()))))) : voffset_out;
+        const int32x4_t col_offsets = vmlaq_n_s32(voffset, vreinterpretq_s32_u32(sum_b), params.a_offset);
+
+        int32_t row_sums[4];
+        vst1q_s32(row_sums, vreinterpretq_s32_u32(sum_a));
+
+        int32x4_t c[4];
+        for(int i = 0; i < 4; ++i)
+        {
+            const int32x4_t row_offset = vdupq_n_s32(params.b_offset * row_sums[i] + offsets_product);
+            c[i]                       = vrequantizeq_s32(vaddq_s32(vaddq_s32(vreinterpretq_s32_u32(acc[i]), col_offsets), row_offset), vmult, vshiftr, vresult_offset);
+        }
+
+        uint8_t values[16];
+        vst1_u8(values, vclamp_u8(c[0], c[1], vmin_bound, vmax_bound));
+        vst1_u8(values + 8, vclamp_u8(c[2], c[3], vmin_bound, vmax_bound));
+
+        const auto mtx_out = reinterpret_cast<uint8_t *>(out.ptr());
+        for(int i = 0; i < 4; ++i)
+        {
+            std::memcpy(mtx_out + i * out_stride, values + 4 * i, 4);
+        }
+    },
+    ina, inb, out);
+}
+
+void dotprod::matrix_multiply_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, const QuantizationParameters &params)
+{
+    const size_t in_b_stride       = input1->info()->strides_in_bytes()[1];
+    const int    depth             = input1->info()->dimension(0) / 4;
+    const int    output_width      = output->info()->dimension(0);
+    const int    num_output_elems  = output_width * output->info()->dimension(1);
+    const int    num_ofm_per_group = output->info()->dimension(2) / input0->info()->dimension(2);
+    const size_t out_stride_y      = output->info()->strides_in_bytes()[1];
+    const size_t out_stride_z      = output->info()->strides_in_bytes()[2];
+    const size_t out_stride_w      = output->info()->strides_in_bytes()[3];
+
+    uint8_t *const output_ptr = output->buffer() + output->info()->offset_first_element_in_bytes();
+
+    // Matrix A holds the weights: it is the same for all the batches, and has one plane per group of convolution like matrix B
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 4, window.y().end() / 4, 1));
+    win_a.set(3, Window::Dimension(0, 0, 0));
+
+    // The step along the x direction is 4 times the in_b_stride because for each iteration we compute 4 blocks of size 4x4,
+    // and the window starts on the row of matrix B holding the first column of the window (One row for each 4 columns)
+    Window win_b(window);
+    win_b.set(Window::DimX, Window::Dimension(0, 1, 4 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
+
+    Iterator ina(input0, win_a);
+    Iterator inb(input1, win_b);
+
+    const uint8x16_t transpose       = vld1q_u8(transpose_indices);
+    const uint8x16_t ones            = vdupq_n_u8(1);
+    const int32x2_t  vmult           = vdup_n_s32(params.output_mult_int);
+    const int64x2_t  vshiftr         = vdupq_n_s64(-params.shift);
+    const int32x4_t  vresult_offset  = vdupq_n_s32(params.result_offset);
+    const uint8x8_t  vmin_bound      = vdup_n_u8(params.min_bound);
+    const uint8x8_t  vmax_bound      = vdup_n_u8(params.max_bound);
+    const int32_t    offsets_product = depth * params.a_offset * params.b_offset;
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto mtx_a0 = reinterpret_cast<const uint8_t *>(ina.ptr());
+        const auto mtx_b0 = reinterpret_cast<const uint8_t *>(inb.ptr());
+
+        // acc[i][j] holds the output feature map id.y() + i for the output elements [id.x() + 4 * j, id.x() + 4 * j + 4)
+        uint32x4_t acc[4][4];
+        uint32x4_t sum_b[4];
+        uint32x4_t sum_a = vdupq_n_u32(0);
+        for(int j = 0; j < 4; ++j)
+        {
+            for(int i = 0; i < 4; ++i)
+            {
+                acc[i][j] = vdupq_n_u32(0);
+            }
+            sum_b[j] = vdupq_n_u32(0);
+        }
+
+        for(int k = 0; k < depth; k += 4)
+        {
+            const uint8x16_t a = vload_block_u8(mtx_a0 + 4 * k, depth - k, transpose);
+            sum_a              = vdotq_u32(sum_a, a, ones);
+
+            for(int j = 0; j < 4; ++j)
+            {
+                const uint8x16_t b = vload_block_u8(mtx_b0 + j * in_b_stride + 4 * k, depth - k, transpose);
+
+                acc[0][j] = vdotq_laneq_u32(acc[0][j], b, a, 0);
+                acc[1][j] = vdotq_laneq_u32(acc[1][j], b, a, 1);
+                acc[2][j] = vdotq_laneq_u32(acc[2][j], b, a, 2);
+                acc[3][j] = vdotq_laneq_u32(acc[3][j], b, a, 3);
+                sum_b[j]  = vdotq_u32(sum_b[j], b, ones);
+            }
+        }
+
+        // sum((a + a_offset) * (b + b_offset)) = sum(a * b) + a_offset * sum(b) + b_offset * sum(a) + depth * a_offset * b_offset
+        int32_t row_sums[4];
+        vst1q_s32(row_sums, vreinterpretq_s32_u32(sum_a));
+
+        // Store the blocks, skipping the rows and columns beyond the output
+        for(int i = 0; (i < 4) && (id.y() + i < num_ofm_per_group); ++i)
+        {
+            const int       ofm    = id.z() * num_ofm_per_group + id.y() + i;
+            const int32_t   bias   = (biases != nullptr) ? *reinterpret_cast<const int32_t *>(biases->ptr_to_element(Coordinates(ofm))) : 0;
+            const int32x4_t offset = vdupq_n_s32(bias + params.output_offset + params.b_offset * row_sums[i] + offsets_product);
+            uint8_t *const  plane  = output_ptr + ofm * out_stride_z + id[3] * out_stride_w;
+
+            for(int j = 0; (j < 4) && (id.x() + 4 * j < num_output_elems); ++j)
+            {
+                const int       elem = id.x() + 4 * j;
+                const int32x4_t sum  = vmlaq_n_s32(vreinterpretq_s32_u32(acc[i][j]), vreinterpretq_s32_u32(sum_b[j]), params.a_offset);
+                const int32x4_t res  = vrequantizeq_s32(vaddq_s32(sum, offset), vmult, vshiftr, vresult_offset);
+
+                uint8_t values[8];
+                vst1_u8(values, vclamp_u8(res, res, vmin_bound, vmax_bound));
+                for(int e = 0; (e < 4) && (elem + e < num_output_elems); ++e)
+                {
+                    *(plane + ((elem + e) / output_width) * out_stride_y + (elem + e) % output_width) = values[e];
+                }
+            }
+        }
+    },
+    ina, inb);
+}
+#endif /* ARM_COMPUTE_ENABLE_DOTPROD */
@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/NEON/kernels/fp16/NEGEMMFP16.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Window.h"
+
+#include <arm_neon.h>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace arm_compute
+{
+class Coordinates;
+} // namespace arm_compute
+
+#ifdef ARM_COMPUTE_ENABLE_FP16
+namespace
+{
+
+/** Multiply the weights of a convolution layer by its im2col reshaped input and store the result in the output of the layer, in half precision
+ *
+ * Each iteration computes 8 output feature maps (a row of the 8 wide transposed matrix A) for 16 output elements (columns of matrix B).
+ * The biases are added and the activation function is applied in single precision while the output is stored.
+ */
+template <typename F>
+void matrix_matrix_multiply_f16_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, F &&activation)
+{
+    const size_t in_b_stride          = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
+    const int    num_elems_matrix_b_x = input1->info()->dimension(0);
+    const int    output_width         = output->info()->dimension(0);
+    const int    num_output_elems     = output_width * output->info()->dimension(1);
+    const int    num_ofm_per_group    = output->info()->dimension(2) / input0->info()->dimension(2);
+    const size_t out_stride_y         = output->info()->strides_in_bytes()[1];
+    const size_t out_stride_z         = output->info()->strides_in_bytes()[2];
+    const size_t out_stride_w         = output->info()->strides_in_bytes()[3];
+
+    uint8_t *const output_ptr = output->buffer() + output->info()->offset_first_element_in_bytes();
+
+    // Matrix A holds the weights: it is the same for all the batches, and has one plane per group of convolution like matrix B
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 8, window.y().end() / 8, 1));
+    win_a.set(3, Window::Dimension(0, 0, 0));
+
+    // The step along the x direction is 4 times the in_b_stride because for each iteration we compute 4 blocks of 4 output elements,
+    // and the window starts on the row of matrix B holding the first column of the window (One row for each 4 columns)
+    Window win_b(window);
+    win_b.set(Window::DimX, Window::Dimension(0, 1, 4 * in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 4, window.x().start() / 4 + 1, 0));
+
+    Iterator ina(input0, win_a);
+    Iterator inb(input1, win_b);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        auto mtx_a0 = reinterpret_cast<const float16_t *>(ina.ptr());
+        auto mtx_b0 = reinterpret_cast<const float16_t *>(inb.ptr());
+
+        // acc[i][j] holds the output feature map id.y() + i for the output elements [id.x() + 8 * j, id.x() + 8 * j + 8)
+        float16x8_t acc[8][2];
+        for(int i = 0; i < 8; ++i)
+        {
+            acc[i][0] = vdupq_n_f16(0.f);
+            acc[i][1] = vdupq_n_f16(0.f);
+        }
+
+        for(int k = 0; k < num_elems_matrix_b_x; k += 4)
+        {
+            const float16x8_t a  = vld1q_f16(mtx_a0);
+            const float16x8_t b0 = vcombine_f16(vld1_f16(mtx_b0), vld1_f16(mtx_b0 + in_b_stride));
+            const float16x8_t b1 = vcombine_f16(vld1_f16(mtx_b0 + 2 * in_b_stride), vld1_f16(mtx_b0 + 3 * in_b_stride));
+
+            acc[0][0] = vfmaq_laneq_f16(acc[0][0], b0, a, 0);
+            acc[1][0] = vfmaq_laneq_f16(acc[1][0], b0, a, 1);
+            acc[2][0] = vfmaq_laneq_f16(acc[2][0], b0, a, 2);
+            acc[3][0] = vfmaq_laneq_f16(acc[3][0], b0, a, 3);
+            acc[4][0] = vfmaq_laneq_f16(acc[4][0], b0, a, 4);
+            acc[5][0] = vfmaq_laneq_f16(acc[5][0], b0, a, 5);
+            acc[6][0] = vfmaq_laneq_f16(acc[6][0], b0, a, 6);
+            acc[7][0] = vfmaq_laneq_f16(acc[7][0], b0, a, 7);
+
+            acc[0][1] = vfmaq_laneq_f16(acc[0][1], b1, a, 0);
+            acc[1][1] = vfmaq_laneq_f16(acc[1][1], b1, a, 1);
+            acc[2][1] = vfmaq_laneq_f16(acc[2][1], b1, a, 2);
+            acc[3][1] = vfmaq_laneq_f16(acc[3][1], b1, a, 3);
+            acc[4][1] = vfmaq_laneq_f16(acc[4][1], b1, a, 4);
+            acc[5][1] = vfmaq_laneq_f16(acc[5][1], b1, a, 5);
+            acc[6][1] = vfmaq_laneq_f16(acc[6][1], b1, a, 6);
+            acc[7][1] = vfmaq_laneq_f16(acc[7][1], b1, a, 7);
+
+            mtx_a0 += 8;
+            mtx_b0 += 4;
+        }
+
+        // Store the blocks, skipping the rows and columns beyond the output
+        for(int i = 0; (i < 8) && (id.y() + i < num_ofm_per_group); ++i)
+        {
+            const int         ofm   = id.z() * num_ofm_per_group + id.y() + i;
+            const float32x4_t bias  = vdupq_n_f32((biases != nullptr) ? static_cast<float>(*reinterpret_cast<const float16_t *>(biases->ptr_to_element(Coordinates(ofm)))) : 0.f);
+            uint8_t *const    plane = output_ptr + ofm * out_stride_z + id[3] * out_stride_w;
+
+            for(int j = 0; (j < 2) && (id.x() + 8 * j < num_output_elems); ++j)
+            {
+                const int         elem     = id.x() + 8 * j;
+                const int         x        = elem % output_width;
+                const float32x4_t res_low  = activation(vaddq_f32(vcvt_f32_f16(vget_low_f16(acc[i][j])), bias));
+                const float32x4_t res_high = activation(vaddq_f32(vcvt_f32_f16(vget_high_f16(acc[i][j])), bias));
+                const float16x8_t res      = vcombine_f16(vcvt_f16_f32(res_low), vcvt_f16_f32(res_high));
+
+                if(x + 8 <= output_width)
+                {
+                    vst1q_f16(reinterpret_cast<float16_t *>(plane + (elem / output_width) * out_stride_y) + x, res);
+                }
+                else
+                {
+                    float16_t values[8];
+                    vst1q_f16(values, res);
+                    for(int e = 0; (e < 8) && (elem + e < num_output_elems); ++e)
+                    {
+                        *(reinterpret_cast<float16_t *>(plane + ((elem + e) / output_width) * out_stride_y) + (elem + e) % output_width) = values[e];
+                    }
+                }
+            }
+        }
+    },
+    ina, inb);
+}
+
+/** Multiply the interleaved matrix A by the transposed matrix B in half precision
+ *
+ * Each iteration computes a 4x8 block of the output. If @p has_epilogue is true, the optional biases, weighted by @p beta, are added
+ * and the activation function is applied in single precision while the block is still in registers.
+ * The biases are either a row vector, broadcast to all the rows of the output, or a matrix of the output's size.
+ */
+template <bool multiply_alpha, typename F>
+void matrix_matrix_multiply_f16(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, float alpha, float beta, bool has_epilogue,
+                                F &&activation)
+{
+    const size_t in_b_stride = input1->info()->strides_in_bytes()[1] / data_size_from_type(input1->info()->data_type());
+    const size_t out_stride  = output->info()->strides_in_bytes()[1] / data_size_from_type(output->info()->data_type());
+
+    // A row vector of biases is read again for each row of the block
+    const bool   is_biases_matrix = (biases != nullptr) && (biases->info()->dimension(1) > 1);
+    const size_t biases_stride    = is_biases_matrix ? biases->info()->strides_in_bytes()[1] / sizeof(float16_t) : 0;
+
+    // Set step_x and step_y for matrix A. Scale by a factor of 4 the Y range as the input interleaved matrix A has 4 times less the rows of the output matrix
+    Window win_a(window);
+    win_a.set(Window::DimX, Window::Dimension(0, 0, 0));
+    win_a.set(Window::DimY, Window::Dimension(window.y().start() / 4, std::max(window.y().end() / 4, 1), 1));
+
+    Window win_b;
+    // Don't slice matrix B along the z dimension if matrix B has just 2 dimensions and matrix A more than 2
+    // This scenario can happen when the the matrix multiplication is used to perform a convolution operation
+    if(input1->info()->num_dimensions() >= 3)
+    {
+        win_b = window;
+    }
+    // Set step_x and step_y for matrix B. The input transposed matrix B has one row for each 8 columns of the output matrix: start on the row of the first column of the window
+    win_b.set(Window::DimX, Window::Dimension(0, 1, in_b_stride));
+    win_b.set(Window::DimY, Window::Dimension(window.x().start() / 8, window.x().start() / 8 + 1, 0));
+
+    Iterator ina(input0, win_a);
+    Iterator inb(input1, win_b);
+    Iterator out(output, window);
+
+    // Number of iterations of inner loop. Since 8 is the number of accumulations per loop, num_it = (width_mtx_b / 4) / 8
+    const size_t num_it       = ((input1->info()->dimension(0)) >> 2) >> 3;
+    const size_t num_leftover = ((input1->info()->dimension(0)) >> 3) & 3;
+
+    const float16x8_t alpha_f16 = vdupq_n_f16(alpha);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto   *mtx_a0  = reinterpret_cast<const float16_t *>(ina.ptr());
+        const auto   *mtx_b0  = reinterpret_cast<const float16_t *>(inb.ptr());
+        auto         *mtx_out = reinterpret_cast<float16_t *>(out.ptr());
+        float16x8x4_t c =
+        {
+            {
+                vdupq_n_f16(0.f),
+                vdupq_n_f16(0.f),
+                vdupq_n_f16(0.f),
+                vdupq_n_f16(0.f)
+            }
+        };
+
+        /*
+        This kernel puts the values in a 4x4 block of Matrix A on the same row (Interleaved values)
+             |a00 a01 a02 a03 | a04 a05 a06 a07|
+             |a10 a11 a12 a13 | a14 a15 a16 a17|
+             |a20 a21 a22 a23 | a24 a25 a26 a27| = | a00 a10 a20 a30 || a01 a11 a21 a31 || a02 a12 a22 a32 || a03 a13 a23 a33 | a40 a50 a60 a70 | ...
+             |a30 a31 a32 a33 | a34 a35 a36 a37|   | a04 a14 a24 a34 || a05 a15 a25 a35 || a06 a15 a26 a36 || a07 a17 a27 a37 | a44 a54 a64 a74 | ...
+             |a40 a41 a42 a43 | a44 a45 a46 a47|
+             |a50 a51 a52 a53 | a54 a55 a56 a57|
+             |a60 a61 a62 a63 | a64 a65 a66 a67|
+             |a70 a71 a72 a73 | a74 a75 a76 a77|
+
+             After this operation, the output matrix will have the following shape: [ height * 4, width / 4 ]
+
+        B Matrix has been transposed as shown below
+
+           |b00 b01 b02 b03 b04 b05 b06 b07|
+           |b10 b11 b12 b13 b14 b15 b16 b17|
+           |b20 b21 b22 b23 b24 b25 b26 b27|
+           |b30 b31 b32 b33 b34 b35 b36 b37|
+          ------------------->
+
+           |b00 b01 b02 b03 b04 b05 b06 b07||b10 b11 b12 b13 b14 b15 b16 b17||b20 b21 b22 b23 b24 b25 b26 b27||b30 b31 b32 b33 b34 b35 b36 b37|
+
+            c.val[0][0] = a00*b00 + a01*b10 + a02*b20 + a03*b30
+            c.val[0][1] = a00*b01 + a01*b11 + a02*b21 + a03*b31
+
+        The size of the output tensor's XY-plane must be the following shape [ width * 8, height / 8 ]. All other dimensions must have the same size.
+        */
+        for(size_t k = num_it; k > 0; mtx_a0 += 16, mtx_b0 += 32, --k)
+        {
+            const float16x8_t p00 = vld1q_f16(mtx_a0);
+            const float16x8_t p02 = vld1q_f16(mtx_a0 + 8);
+            const float16x8_t q00 = vld1q_f16(mtx_b0);
+            const float16x8_t q02 = vld1q_f16(mtx_b0 + 8);
+            const float16x8_t q04 = vld1q_f16(mtx_b0 + 16);
+            const float16x8_t q06 = vld1q_f16(mtx_b0 + 24);
+
+            c.val[0] = vfmaq_laneq_f16(c.val[0], q00, p00, 0);
+            c.val[1] = vfmaq_laneq_f16(c.val[1], q00, p00, 1);
+            c.val[2] = vfmaq_laneq_f16(c.val[2], q00, p00, 2);
+            c.val[3] = vfmaq_laneq_f16(c.val[3], q00, p00, 3);
+
+            c.val[0] = vfmaq_laneq_f16(c.val[0], q02, p00, 4);
+            c.val[1] = vfmaq_laneq_f16(c.val[1], q02, p00, 5);
+            c.val[2] = vfmaq_laneq_f16(c.val[2], q02, p00, 6);
+            c.val[3] = vfmaq_laneq_f16(c.val[3], q02, p00, 7);
+
+            c.val[0] = vfmaq_laneq_f16(c.val[0], q04, p02, 0);
+            c.val[1] = vfmaq_laneq_f16(c.val[1], q04, p02, 1);
+            c.val[2] = vfmaq_laneq_f16(c.val[2], q04, p02, 2);
+            c.val[3] = vfmaq_laneq_f16(c.val[3], q04, p02, 3);
+
+            c.val[0] = vfmaq_laneq_f16(c.val[0], q06, p02, 4);
+            c.val[1] = vfmaq_laneq_f16(c.val[1], q06, p02, 5);
+            c.val[2] = vfmaq_laneq_f16(c.val[2], q06, p02, 6);
+            c.val[3] = vfmaq_laneq_f16(c.val[3], q06, p02, 7);
+        }
+
+        // Accumulate the leftover columns of matrix A one at a time
+        for(size_t k = num_leftover; k > 0; mtx_a0 += 4, mtx_b0 += 8, --k)
+        {
+            const float16x8_t q00 = vld1q_f16(mtx_b0);
+
+            c.val[0] = vfmaq_n_f16(c.val[0], q00, mtx_a0[0]);
+            c.val[1] = vfmaq_n_f16(c.val[1], q00, mtx_a0[1]);
+            c.val[2] = vfmaq_n_f16(c.val[2], q00, mtx_a0[2]);
+            c.val[3] = vfmaq_n_f16(c.val[3], q00, mtx_a0[3]);
+        }
+
+        if(multiply_alpha)
+        {
+            c.val[0] = vmulq_f16(c.val[0], alpha_f16);
+            c.val[1] = vmulq_f16(c.val[1], alpha_f16);
+            c.val[2] = vmulq_f16(c.val[2], alpha_f16);
+            c.val[3] = vmulq_f16(c.val[3], alpha_f16);
+        }
+
+        if(has_epilogue)
+        {
+            const float32x4_t beta_f32 = vdupq_n_f32(beta);
+            const auto        bias_ptr = (biases != nullptr) ? reinterpret_cast<const float16_t *>(biases->ptr_to_element(Coordinates(id.x(), is_biases_matrix ? id.y() : 0))) : nullptr;
+
+            for(int i = 0; i < 4; ++i)
+            {
+                float32x4_t res_low  = vcvt_f32_f16(vget_low_f16(c.val[i]));
+                float32x4_t res_high = vcvt_f32_f16(vget_high_f16(c.val[i]));
+
+                if(bias_ptr != nullptr)
+                {
+                    const float16x8_t bias = vld1q_f16(bias_ptr + i * biases_stride);
+                    res_low                = vmlaq_f32(res_low, vcvt_f32_f16(vget_low_f16(bias)), beta_f32);
+                    res_high               = vmlaq_f32(res_high, vcvt_f32_f16(vget_high_f16(bias)), beta_f32);
+                }
+
+                c.val[i] = vcombine_f16(vcvt_f16_f32(activation(res_low)), vcvt_f16_f32(activation(res_high)));
+            }
+        }
+
+        vst1q_f16(mtx_out + 0 * out_stride, c.val[0]);
+        vst1q_f16(mtx_out + 1 * out_stride, c.val[1]);
+        vst1q_f16(mtx_out + 2 * out_stride, c.val[2]);
+        vst1q_f16(mtx_out + 3 * out_stride, c.val[3]);
+    },
+    ina, inb, out);
+}
+} // namespace
+
+void fp16::matrix_matrix_multiply(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window, float alpha, float beta,
+                                  fp16::ActivationFunctionPtr act_func, const ActivationLayerInfo &act_info)
+{
+    const float32x4_t a = vdupq_n_f32(act_info.a());
+    const float32x4_t b = vdupq_n_f32(act_info.b());
+
+    const auto activation = [&](const float32x4_t &x)
+    {
+        return act_func(x, a, b);
+    };
+    const auto identity = [](const float32x4_t &x)
+    {
+        return x;
+    };
+
+    const bool multiply_alpha = std::abs(1.0f - alpha) > 0.00001f;
+
+    // The output is only converted to single precision if there are biases to add or an activation function to apply
+    const bool has_epilogue = (biases != nullptr) || (act_func != nullptr);
+
+    if(act_func != nullptr)
+    {
+        if(multiply_alpha)
+        {
+            matrix_matrix_multiply_f16<true>(input0, input1, biases, output, window, alpha, beta, has_epilogue, activation);
+        }
+        else
+        {
+            matrix_matrix_multiply_f16<false>(input0, input1, biases, output, window, alpha, beta, has_epilogue, activation);
+        }
+    }
+    else
+    {
+        if(multiply_alpha)
+        {
+            matrix_matrix_multiply_f16<true>(input0, input1, biases, output, window, alpha, beta, has_epilogue, identity);
+        }
+        else
+        {
+            matrix_matrix_multiply_f16<false>(input0, input1, biases, output, window, alpha, beta, has_epilogue, identity);
+        }
+    }
+}
+
+void fp16::matrix_matrix_multiply_convolution(const ITensor *input0, const ITensor *input1, const ITensor *biases, ITensor *output, const Window &window,
+                                              fp16::ActivationFunctionPtr act_func, const ActivationLayerInfo &act_info)
+{
+    const float32x4_t a = vdupq_n_f32(act_info.a());
+    const float32x4_t b = vdupq_n_f32(act_info.b());
+
+    const auto activation = [&](const float32x4_t &x)
+    {
+        return act_func(x, a, b);
+    };
+    const auto identity = [](const float32x4_t &x)
+    {
+        return x;
+    };
+
+    if(act_func != nullptr)
+    {
+        matrix_matrix_multiply_f16_convolution(input0, input1, biases, output, window, activation);
+    }
+    else
+    {
+        matrix_matrix_multiply_f16_convolution(input0, input1, biases, output, window, identity);
+    }
+}
+
+void fp16::matrix_addition(const ITensor *input, ITensor *output, const Window &window, float beta)
+{
+    const float16x8_t beta_f16 = vdupq_n_f16(beta);
+
+    Iterator in(input, window);
+    Iterator out(output, window);
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const auto in_ptr  = reinterpret_cast<const float16_t *>(in.ptr());
+        const auto out_ptr = reinterpret_cast<float16_t *>(out.ptr());
+
+        float16x8x2_t alpha_ab =
+        {
+            {
+                vld1q_f16(out_ptr + 0),
+                vld1q_f16(out_ptr + 8)
+            }
+        };
+
+        float16x8x2_t c =
+        {
+            {
+                vld1q_f16(in_ptr + 0),
+                vld1q_f16(in_ptr + 8)
+            }
+        };
+
+        /* Multiply matrix C by its weight and accumulate */
+        alpha_ab.val[0] = vaddq_f16(alpha_ab.val[0], vmulq_f16(c.val[0], beta_f16));
+        alpha_ab.val[1] = vaddq_f16(alpha_ab.val[1], vmulq_f16(c.val[1], beta_f16));
+
+        vst1q_f16(out_ptr + 0, alpha_ab.val[0]);
+        vst1q_f16(out_ptr + 8, alpha_ab.val[1]);
+    },
+    in, out);
+}
+#endif /* ARM_COMPUTE_ENABLE_FP16 */
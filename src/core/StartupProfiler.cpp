@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/core/StartupProfiler.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Function the startup work of the thread belongs to */
+thread_local std::string thread_function;
+
+constexpr size_t num_stages = 5;
+
+/** Time spent in each stage by one function */
+struct FunctionStats
+{
+    std::string                    function;
+    std::array<double, num_stages> time;
+    size_t                         allocated;
+    int                            compiled;
+    int                            cached;
+};
+} // namespace
+
+StartupProfiler::StartupProfiler()
+    : _enabled(false), _origin(std::chrono::steady_clock::now()), _duration(0.), _entries(), _mtx()
+{
+}
+
+StartupProfiler &StartupProfiler::get()
+{
+    static StartupProfiler profiler;
+    return profiler;
+}
+
+void StartupProfiler::start()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _entries.clear();
+    _origin   = std::chrono::steady_clock::now();
+    _duration = 0.;
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void StartupProfiler::stop()
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _duration = now();
+    _enabled.store(false, std::memory_order_relaxed);
+}
+
+double StartupProfiler::now() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _origin).count();
+}
+
+const std::string &StartupProfiler::current_function()
+{
+    return thread_function;
+}
+
+void StartupProfiler::add(StartupStage stage, std::string detail, double start, double end, size_t bytes, ProgramSource source)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _entries.push_back(StartupEntry{ stage, thread_function, std::move(detail), start, end - start, bytes, source });
+}
+
+void StartupProfiler::print_report(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Group the records by function, in the order of their first record
+    std::vector<FunctionStats> functions;
+
+    for(const auto &entry : _entries)
+    {
+        auto stats = std::find_if(functions.begin(), functions.end(), [&](const FunctionStats & s)
+        {
+            return s.function == entry.function;
+        });
+        if(stats == functions.end())
+        {
+            functions.push_back(FunctionStats{ entry.function, {}, 0, 0, 0 });
+            stats = functions.end() - 1;
+        }
+
+        stats->time[static_cast<size_t>(entry.stage)] += entry.duration;
+        if(entry.stage == StartupStage::ALLOCATE)
+        {
+            stats->allocated += entry.bytes;
+        }
+        stats->compiled += (entry.source == ProgramSource::COMPILED) ? 1 : 0;
+        stats->cached += (entry.source == ProgramSource::BINARY_CACHE) ? 1 : 0;
+    }
+
+    const std::ios_base::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(2);
+    os << std::left << std::setw(32) << "Function" << std::right << std::setw(14) << "Config (ms)" << std::setw(14) << "Alloc (ms)" << std::setw(14) << "Build (ms)" << std::setw(14)
+       << "Weights (ms)" << std::setw(14) << "1st run (ms)" << std::setw(12) << "Alloc (MB)" << std::setw(10) << "Compiled" << std::setw(8) << "Cached" << std::endl;
+
+    for(const auto &s : functions)
+    {
+        os << std::left << std::setw(32) << (s.function.empty() ? "no function" : s.function) << std::right;
+        for(double t : s.time)
+        {
+            os << std::setw(14) << t / 1000.;
+        }
+        os << std::setw(12) << s.allocated / (1024. * 1024.) << std::setw(10) << s.compiled << std::setw(8) << s.cached << std::endl;
+    }
+
+    // The stages nest, so the wall-clock time of the session is the total rather than the sum of the columns
+    const double session = is_enabled() ? now() : _duration;
+    os << "Session: " << session / 1000. << " ms" << std::endl;
+
+    // The slowest program builds are the first candidates for the binary cache or a background precompilation
+    std::vector<const StartupEntry *> builds;
+    for(const auto &entry : _entries)
+    {
+        if(entry.stage == StartupStage::PROGRAM_BUILD)
+        {
+            builds.push_back(&entry);
+        }
+    }
+    std::sort(builds.begin(), builds.end(), [](const StartupEntry * a, const StartupEntry * b)
+    {
+        return a->duration > b->duration;
+    });
+
+    const size_t num_builds = std::min<size_t>(builds.size(), 10);
+    if(num_builds > 0)
+    {
+        os << "Slowest program builds:" << std::endl;
+    }
+    for(size_t i = 0; i < num_builds; ++i)
+    {
+        const char *source = (builds[i]->source == ProgramSource::COMPILED) ? "compiled" : ((builds[i]->source == ProgramSource::BINARY_CACHE) ? "binary cache" : "background");
+        os << "  " << std::left << std::setw(40) << builds[i]->detail << std::right << std::setw(12) << builds[i]->duration / 1000. << " ms  " << source << std::endl;
+    }
+
+    os.flags(flags);
+}
+
+StartupFunctionScope::StartupFunctionScope(std::string function)
+    : _previous(std::move(thread_function))
+{
+    thread_function = std::move(function);
+}
+
+StartupFunctionScope::~StartupFunctionScope()
+{
+    thread_function = std::move(_previous);
+}
+
+StartupScope::StartupScope(StartupStage stage, std::string detail, size_t bytes)
+    : _enabled(StartupProfiler::get().is_enabled()), _stage(stage), _detail(), _bytes(bytes), _source(ProgramSource::NONE), _start(0.)
+{
+    if(_enabled)
+    {
+        _detail = std::move(detail);
+        _start  = StartupProfiler::get().now();
+    }
+}
+
+StartupScope::~StartupScope()
+{
+    if(_enabled)
+    {
+        StartupProfiler &profiler = StartupProfiler::get();
+        profiler.add(_stage, std::move(_detail), _start, profiler.now(), _bytes, _source);
+    }
+}
@@ -32,7 +32,7 @@ using namespace arm_compute;
 
 TensorInfo::TensorInfo()
     : _total_size(0), _fixed_point_pos(0), _offset_first_element_in_bytes(0), _strides_in_bytes(), _num_channels(0), _tensor_shape(), _data_type(DataType::UNKNOWN), _format(Format::UNKNOWN), _is_resizable{ true },
-      _valid_region{ Coordinates(), _tensor_shape }, _padding{ 0 }
+      _valid_region{ Coordinates(), _tensor_shape }, _padding{ 0 }, _quantization_info(), _data_layout(DataLayout::NCHW)
 {
 }
 
@@ -261,6 +261,12 @@ bool TensorInfo::extend_padding(const PaddingSize &padding)
     return updated;
 }
 
+void TensorInfo::set_fixed_padding(const PaddingSize &padding)
+{
+    _padding      = padding;
+    _is_resizable = false;
+}
+
 void TensorInfo::set_format(Format format)
 {
     ARM_COMPUTE_ERROR_ON(num_channels_from_format(format) != _num_channels);
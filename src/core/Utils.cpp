@@ -26,12 +26,89 @@
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <map>
 #include <string>
 
 using namespace arm_compute;
 
+uint16_t arm_compute::float_to_half(float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+
+    const uint32_t sign           = (bits >> 16) & 0x8000;
+    const uint32_t float_exponent = (bits >> 23) & 0xFF;
+    const int      exponent       = static_cast<int>(float_exponent) - 127 + 15;
+    uint32_t       mantissa       = bits & 0x7FFFFF;
+
+    if(float_exponent == 0xFF)
+    {
+        // Infinity or NaN: keep a quiet NaN a NaN
+        return sign | 0x7C00 | ((mantissa != 0) ? 0x200 : 0);
+    }
+    if(exponent >= 31)
+    {
+        return sign | 0x7C00;
+    }
+    if(exponent <= 0)
+    {
+        // Subnormal half precision value, or zero if it is below half of the smallest one
+        if(exponent < -10)
+        {
+            return sign;
+        }
+        mantissa |= 0x800000;
+
+        const uint32_t shift         = 14 - exponent;
+        uint32_t       half_mantissa = mantissa >> shift;
+        const uint32_t remainder     = mantissa & ((1u << shift) - 1);
+        const uint32_t halfway       = 1u << (shift - 1);
+        if(remainder > halfway || (remainder == halfway && (half_mantissa & 1) != 0))
+        {
+            ++half_mantissa;
+        }
+        return sign | half_mantissa;
+    }
+
+    // A carry of the rounding into the exponent gives the next power of two, or the infinity
+    uint32_t       half      = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+    const uint32_t remainder = mantissa & 0x1FFF;
+    if(remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0))
+    {
+        ++half;
+    }
+    return half;
+}
+
+float arm_compute::half_to_float(uint16_t bits)
+{
+    const uint32_t sign     = static_cast<uint32_t>(bits & 0x8000) << 16;
+    const uint32_t exponent = (bits >> 10) & 0x1F;
+    const uint32_t mantissa = bits & 0x3FF;
+
+    uint32_t float_bits = 0;
+    if(exponent == 0x1F)
+    {
+        float_bits = sign | 0x7F800000 | (mantissa << 13);
+    }
+    else if(exponent == 0)
+    {
+        // Zero or subnormal value: mantissa * 2^-24
+        const float value = std::ldexp(static_cast<float>(mantissa), -24);
+        return (sign != 0) ? -value : value;
+    }
+    else
+    {
+        float_bits = sign | ((exponent + 127 - 15) << 23) | (mantissa << 13);
+    }
+
+    float value = 0.f;
+    std::memcpy(&value, &float_bits, sizeof(value));
+    return value;
+}
+
 std::string arm_compute::build_information()
 {
     static const std::string information =
@@ -252,6 +329,46 @@ const std::pair<unsigned int, unsigned int> arm_compute::scaled_dimensions(unsig
     return std::make_pair(w, h);
 }
 
+const std::pair<int32_t, int32_t> arm_compute::quantize_multiplier(float multiplier)
+{
+    ARM_COMPUTE_ERROR_ON(multiplier <= 0.f);
+
+    // multiplier = fraction * 2^exponent with fraction in [0.5, 1)
+    int          exponent = 0;
+    const double fraction = std::frexp(static_cast<double>(multiplier), &exponent);
+
+    int64_t multiplier_int = std::llround(fraction * (1ll << 31));
+    if(multiplier_int == (1ll << 31))
+    {
+        multiplier_int /= 2;
+        ++exponent;
+    }
+
+    // A multiplier of 2^31 or more gives a negative shift, i.e. a left shift
+    return std::make_pair(static_cast<int32_t>(multiplier_int), 31 - exponent);
+}
+
+const std::pair<uint8_t, uint8_t> arm_compute::quantized_activation_bounds(const ActivationLayerInfo &act_info, const QuantizationInfo &quantization_info)
+{
+    if(!act_info.enabled())
+    {
+        return std::make_pair(0, 255);
+    }
+
+    // The real value 0 is represented exactly by the offset
+    const uint8_t zero = quantization_info.quantize(0.f);
+
+    switch(act_info.activation())
+    {
+        case ActivationLayerInfo::ActivationFunction::RELU:
+            return std::make_pair(zero, 255);
+        case ActivationLayerInfo::ActivationFunction::BOUNDED_RELU:
+            return std::make_pair(zero, quantization_info.quantize(act_info.a()));
+        default:
+            ARM_COMPUTE_ERROR("Activation function not supported for quantized values");
+    }
+}
+
 void arm_compute::print_consecutive_elements(std::ostream &s, DataType dt, const uint8_t *ptr, unsigned int n, int stream_width, const std::string &element_delim)
 {
     switch(dt)
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/AllocationTracer.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Maximum number of nested scopes whose names are kept */
+constexpr int max_scope_depth = 16;
+
+/** Counters of the tracer, constant initialised so that they can be used by the allocations made before main() */
+std::atomic<size_t>                       num_allocations{ 0 };
+std::atomic<size_t>                       num_bytes{ 0 };
+std::atomic<const char *>                 first_scope{ nullptr };
+std::atomic<AllocationTracer::Callback *> callback{ nullptr };
+
+/** Scopes active on the calling thread: the allocations made by the other threads are not counted */
+thread_local int         num_active_scopes = 0;
+thread_local const char *innermost_scope   = nullptr;
+
+/** Names of the enclosing scopes of the calling thread, restored when the innermost one ends */
+thread_local const char *scope_names[max_scope_depth];
+
+/** Set while the callback runs on the calling thread, so that its own allocations are ignored */
+thread_local bool is_in_callback = false;
+} // namespace
+
+bool AllocationTracer::is_enabled()
+{
+#ifdef ARM_COMPUTE_TRACE_ALLOCATIONS
+    return true;
+#else  /* ARM_COMPUTE_TRACE_ALLOCATIONS */
+    return false;
+#endif /* ARM_COMPUTE_TRACE_ALLOCATIONS */
+}
+
+void AllocationTracer::set_callback(Callback *func)
+{
+    callback.store(func);
+}
+
+AllocationTracer::Report AllocationTracer::report()
+{
+    return Report{ num_allocations.load(), num_bytes.load(), first_scope.load() };
+}
+
+void AllocationTracer::reset()
+{
+    num_allocations.store(0);
+    num_bytes.store(0);
+    first_scope.store(nullptr);
+}
+
+void AllocationTracer::begin_scope(const char *name)
+{
+    const int depth = num_active_scopes;
+    if(depth < max_scope_depth)
+    {
+        scope_names[depth] = innermost_scope;
+    }
+    innermost_scope   = name;
+    num_active_scopes = depth + 1;
+}
+
+void AllocationTracer::end_scope()
+{
+    const int depth = num_active_scopes - 1;
+    ARM_COMPUTE_ERROR_ON_MSG(depth < 0, "end_scope() called without a matching begin_scope() on this thread");
+
+    innermost_scope   = depth < max_scope_depth ? scope_names[depth] : innermost_scope;
+    num_active_scopes = depth;
+}
+
+const char *AllocationTracer::current_scope()
+{
+    return num_active_scopes > 0 ? innermost_scope : nullptr;
+}
+
+void AllocationTracer::record_allocation(size_t size)
+{
+    // A single thread local load when no scope is active on the calling thread
+    if(num_active_scopes == 0 || is_in_callback)
+    {
+        return;
+    }
+
+    const char *scope = innermost_scope;
+
+    num_allocations.fetch_add(1);
+    num_bytes.fetch_add(size);
+
+    const char *no_scope = nullptr;
+    first_scope.compare_exchange_strong(no_scope, scope);
+
+    Callback *func = callback.load();
+    if(func != nullptr)
+    {
+        is_in_callback = true;
+        func(size, scope);
+        is_in_callback = false;
+    }
+}
+
+#ifdef ARM_COMPUTE_TRACE_ALLOCATIONS
+void *operator new(size_t size)
+{
+    AllocationTracer::record_allocation(size);
+
+    void *ptr = std::malloc(size == 0 ? 1 : size);
+    if(ptr == nullptr)
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    AllocationTracer::record_allocation(size);
+    return std::malloc(size == 0 ? 1 : size);
+}
+
+void *operator new[](size_t size, const std::nothrow_t &tag) noexcept
+{
+    return operator new(size, tag);
+}
+
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+    std::free(ptr);
+}
+#endif /* ARM_COMPUTE_TRACE_ALLOCATIONS */
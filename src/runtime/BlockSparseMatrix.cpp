@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/BlockSparseMatrix.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+using namespace arm_compute;
+
+constexpr unsigned int BlockSparseMatrix::block_width;
+
+BlockSparseMatrix::BlockSparseMatrix()
+    : _num_inputs(0), _num_outputs(0), _num_blocks(0), _values(), _indices(), _offsets()
+{
+}
+
+void BlockSparseMatrix::compress(const ITensor &weights, bool transpose_weights, float threshold)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&weights, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(weights.info()->num_dimensions() > 2);
+    ARM_COMPUTE_ERROR_ON(weights.buffer() == nullptr);
+
+    // Coordinates of the weight of an input for an output
+    const unsigned int input_dim  = transpose_weights ? 0 : 1;
+    const unsigned int output_dim = transpose_weights ? 1 : 0;
+
+    _num_inputs  = weights.info()->dimension(input_dim);
+    _num_outputs = weights.info()->dimension(output_dim);
+
+    const size_t num_rows = ceil_to_multiple(_num_outputs, block_width) / block_width;
+
+    auto weight = [&](size_t input, size_t output)
+    {
+        if(output >= _num_outputs)
+        {
+            return 0.f;
+        }
+
+        Coordinates id;
+        id.set(input_dim, input);
+        id.set(output_dim, output);
+        return *reinterpret_cast<const float *>(weights.ptr_to_element(id));
+    };
+
+    auto is_stored = [&](size_t input, size_t row)
+    {
+        for(size_t i = 0; i < block_width; ++i)
+        {
+            if(std::abs(weight(input, row * block_width + i)) > threshold)
+            {
+                return true;
+            }
+        }
+        return false;
+    };
+
+    // First pass: count the blocks to store so that the tensors are allocated to their exact size
+    _num_blocks = 0;
+    for(size_t row = 0; row < num_rows; ++row)
+    {
+        for(size_t input = 0; input < _num_inputs; ++input)
+        {
+            _num_blocks += is_stored(input, row) ? 1 : 0;
+        }
+    }
+
+    // A fully pruned matrix still allocates one block, which is never read
+    const size_t num_allocated_blocks = std::max<size_t>(_num_blocks, 1);
+
+    _values.allocator()->init(TensorInfo(TensorShape(block_width, num_allocated_blocks), 1, DataType::F32));
+    _indices.allocator()->init(TensorInfo(TensorShape(num_allocated_blocks), 1, DataType::S32));
+    _offsets.allocator()->init(TensorInfo(TensorShape(num_rows + 1), 1, DataType::S32));
+    _values.allocator()->allocate();
+    _indices.allocator()->allocate();
+    _offsets.allocator()->allocate();
+
+    auto values  = reinterpret_cast<float *>(_values.buffer() + _values.info()->offset_first_element_in_bytes());
+    auto indices = reinterpret_cast<int32_t *>(_indices.buffer() + _indices.info()->offset_first_element_in_bytes());
+    auto offsets = reinterpret_cast<int32_t *>(_offsets.buffer() + _offsets.info()->offset_first_element_in_bytes());
+
+    // Second pass: store the blocks, row after row
+    size_t block = 0;
+    for(size_t row = 0; row < num_rows; ++row)
+    {
+        offsets[row] = block;
+        for(size_t input = 0; input < _num_inputs; ++input)
+        {
+            if(is_stored(input, row))
+            {
+                for(size_t i = 0; i < block_width; ++i)
+                {
+                    values[block * block_width + i] = weight(input, row * block_width + i);
+                }
+                indices[block] = input;
+                ++block;
+            }
+        }
+    }
+    offsets[num_rows] = block;
+}
+
+size_t BlockSparseMatrix::num_inputs() const
+{
+    return _num_inputs;
+}
+
+size_t BlockSparseMatrix::num_outputs() const
+{
+    return _num_outputs;
+}
+
+float BlockSparseMatrix::density() const
+{
+    const size_t num_weights = _num_inputs * _num_outputs;
+    return (num_weights == 0) ? 0.f : static_cast<float>(_num_blocks * block_width) / num_weights;
+}
+
+const ITensor *BlockSparseMatrix::values() const
+{
+    return &_values;
+}
+
+const ITensor *BlockSparseMatrix::indices() const
+{
+    return &_indices;
+}
+
+const ITensor *BlockSparseMatrix::offsets() const
+{
+    return &_offsets;
+}
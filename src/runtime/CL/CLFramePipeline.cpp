@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLFramePipeline.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/IFunction.h"
+
+using namespace arm_compute;
+
+namespace
+{
+/** Create allocated host tensors with the same layout (including the padding) as the given tensor */
+std::vector<std::unique_ptr<Tensor>> create_staging_tensors(const ITensor *tensor, unsigned int num_buffers)
+{
+    std::vector<std::unique_ptr<Tensor>> staging;
+
+    for(unsigned int i = 0; i < num_buffers; ++i)
+    {
+        staging.emplace_back(arm_compute::cpp14::make_unique<Tensor>());
+        staging.back()->allocator()->init(*tensor->info());
+        staging.back()->allocator()->allocate();
+    }
+
+    return staging;
+}
+} // namespace
+
+CLFramePipeline::CLFramePipeline()
+    : _network(nullptr), _input(nullptr), _output(nullptr), _staging_inputs(), _staging_outputs(), _upload_events(), _readback_events()
+{
+}
+
+void CLFramePipeline::configure(IFunction *network, ICLTensor *input, ICLTensor *output, unsigned int num_buffers)
+{
+    ARM_COMPUTE_ERROR_ON(network == nullptr || input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON(num_buffers == 0);
+
+    _network         = network;
+    _input           = input;
+    _output          = output;
+    _staging_inputs  = create_staging_tensors(input, num_buffers);
+    _staging_outputs = create_staging_tensors(output, num_buffers);
+    _upload_events   = std::vector<cl::Event>(num_buffers);
+    _readback_events = std::vector<cl::Event>(num_buffers);
+}
+
+void CLFramePipeline::run(unsigned int num_frames, const std::function<void(unsigned int, ITensor &)> &fill_input, const std::function<void(unsigned int, ITensor &)> &read_output)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_network == nullptr, "The pipeline has not been configured");
+
+    cl::CommandQueue  &queue       = CLScheduler::get().queue();
+    const unsigned int num_buffers = _staging_inputs.size();
+    const size_t       input_size  = _input->info()->total_size();
+    const size_t       output_size = _output->info()->total_size();
+
+    // The result of a frame is read num_buffers - 1 frames later, once the device has moved on to the next frames
+    const auto read_frame = [&](unsigned int frame)
+    {
+        const unsigned int b = frame % num_buffers;
+        _readback_events[b].wait();
+        read_output(frame, *_staging_outputs[b]);
+    };
+
+    for(unsigned int frame = 0; frame < num_frames; ++frame)
+    {
+        const unsigned int b = frame % num_buffers;
+
+        // The staging input can only be refilled once its previous upload has completed
+        if(frame >= num_buffers)
+        {
+            _upload_events[b].wait();
+        }
+        fill_input(frame, *_staging_inputs[b]);
+
+        // The queue is in order: the upload waits for the previous frame to be done with the input, the readback for the network to complete
+        queue.enqueueWriteBuffer(_input->cl_buffer(), CL_FALSE, 0, input_size, _staging_inputs[b]->buffer(), nullptr, &_upload_events[b]);
+        {
+            CLScopedBatch batch;
+            _network->run();
+        }
+        queue.enqueueReadBuffer(_output->cl_buffer(), CL_FALSE, 0, output_size, _staging_outputs[b]->buffer(), nullptr, &_readback_events[b]);
+        queue.flush();
+
+        if(frame + 1 >= num_buffers)
+        {
+            read_frame(frame + 1 - num_buffers);
+        }
+    }
+
+    // Drain the frames still in flight
+    for(unsigned int frame = (num_frames >= num_buffers) ? num_frames + 1 - num_buffers : 0; frame < num_frames; ++frame)
+    {
+        read_frame(frame);
+    }
+}
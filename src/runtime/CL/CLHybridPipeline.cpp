@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLHybridPipeline.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+CLHybridPipeline::CLHybridPipeline()
+    : _segments()
+{
+}
+
+void CLHybridPipeline::add_cl_stage(IFunction *function, ICLTensor *input, ICLTensor *output)
+{
+    add_stage(function, input, output, input, output);
+}
+
+void CLHybridPipeline::add_cpu_stage(IFunction *function, ITensor *input, ITensor *output)
+{
+    add_stage(function, input, output, nullptr, nullptr);
+}
+
+void CLHybridPipeline::add_stage(IFunction *function, ITensor *input, ITensor *output, ICLTensor *cl_input, ICLTensor *cl_output)
+{
+    ARM_COMPUTE_ERROR_ON(function == nullptr);
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+
+    const bool is_cl = (cl_input != nullptr);
+
+    if(!_segments.empty() && (_segments.back().cl_output != nullptr) == is_cl)
+    {
+        // Same backend as the previous stage: the data stays in place
+        ARM_COMPUTE_ERROR_ON_MSG(input != _segments.back().output, "The input of a stage must be the output of the previous stage running on the same backend");
+
+        _segments.back().functions.push_back(function);
+        _segments.back().output    = output;
+        _segments.back().cl_output = cl_output;
+        return;
+    }
+
+    // The backend changes: the output of the previous stage will be copied into the input of this one
+    ARM_COMPUTE_ERROR_ON(!_segments.empty() && _segments.back().output->info()->tensor_shape().total_size() != input->info()->tensor_shape().total_size());
+
+    _segments.push_back(Segment{ { function }, input, output, cl_input, cl_output });
+}
+
+void CLHybridPipeline::with_mapped(ICLTensor *cl_tensor, const std::function<void()> &func)
+{
+    if(cl_tensor != nullptr)
+    {
+        cl_tensor->map(CLScheduler::get().queue(), true);
+    }
+
+    func();
+
+    if(cl_tensor != nullptr)
+    {
+        cl_tensor->unmap(CLScheduler::get().queue());
+    }
+}
+
+void CLHybridPipeline::transfer(const Segment &src, const Segment &dst)
+{
+    // Exactly one of the two tensors is an OpenCL tensor
+    with_mapped(src.cl_output, [&]()
+    {
+        with_mapped(dst.cl_input, [&]()
+        {
+            dst.input->copy_from(*src.output);
+        });
+    });
+}
+
+void CLHybridPipeline::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_segments.empty(), "The pipeline doesn't have any stage");
+
+    for(size_t k = 0; k < _segments.size(); ++k)
+    {
+        if(k != 0)
+        {
+            // Mapping the output of an OpenCL segment waits for its completion
+            transfer(_segments[k - 1], _segments[k]);
+        }
+
+        for(IFunction *function : _segments[k].functions)
+        {
+            function->run();
+        }
+    }
+
+    if(_segments.back().cl_output != nullptr)
+    {
+        CLScheduler::get().sync();
+    }
+}
+
+void CLHybridPipeline::run_pipelined(unsigned int num_frames, const std::function<void(unsigned int)> &fill_input, const std::function<void(unsigned int)> &read_output)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_segments.empty(), "The pipeline doesn't have any stage");
+
+    const int  num_segments = static_cast<int>(_segments.size());
+    const int  frames       = static_cast<int>(num_frames);
+    const bool has_cl       = std::any_of(_segments.begin(), _segments.end(), [](const Segment & segment)
+    {
+        return segment.cl_input != nullptr;
+    });
+    const auto is_valid = [&](int frame)
+    {
+        return frame >= 0 && frame < frames;
+    };
+
+    // At step t, segment k processes frame t - k: each segment hands its frame over to the next one between two steps
+    for(int t = 0; t < frames + num_segments; ++t)
+    {
+        // Wait for the OpenCL segments of the previous step: every segment is idle while the frames are moved along the pipeline
+        if(has_cl)
+        {
+            CLScheduler::get().sync();
+        }
+
+        if(is_valid(t - num_segments))
+        {
+            with_mapped(_segments.back().cl_output, [&]()
+            {
+                read_output(t - num_segments);
+            });
+        }
+
+        for(int k = num_segments - 1; k > 0; --k)
+        {
+            if(is_valid(t - k))
+            {
+                transfer(_segments[k - 1], _segments[k]);
+            }
+        }
+
+        if(is_valid(t))
+        {
+            with_mapped(_segments.front().cl_input, [&]()
+            {
+                fill_input(t);
+            });
+        }
+
+        // Enqueue the OpenCL segments first so that the device works while the CPU segments run on this thread
+        if(has_cl)
+        {
+            CLScopedBatch batch;
+
+            for(int k = 0; k < num_segments; ++k)
+            {
+                if(_segments[k].cl_input != nullptr && is_valid(t - k))
+                {
+                    for(IFunction *function : _segments[k].functions)
+                    {
+                        function->run();
+                    }
+                }
+            }
+        }
+
+        for(int k = 0; k < num_segments; ++k)
+        {
+            if(_segments[k].cl_input == nullptr && is_valid(t - k))
+            {
+                for(IFunction *function : _segments[k].functions)
+                {
+                    function->run();
+                }
+            }
+        }
+    }
+}
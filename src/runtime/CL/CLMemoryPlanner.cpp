@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLMemoryPlanner.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/StartupProfiler.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr size_t lifetime_not_ended = std::numeric_limits<size_t>::max();
+
+/** Alignment in bytes required for the origin of a sub-buffer on the device of the scheduler's context */
+size_t sub_buffer_alignment()
+{
+    const cl::Device device = CLScheduler::get().context().getInfo<CL_CONTEXT_DEVICES>()[0];
+
+    // CL_DEVICE_MEM_BASE_ADDR_ALIGN is expressed in bits
+    return std::max<size_t>(device.getInfo<CL_DEVICE_MEM_BASE_ADDR_ALIGN>() / 8, 1);
+}
+} // namespace
+
+CLMemoryPlanner::CLMemoryPlanner()
+    : _lifetimes(), _clock(0), _arena_size(0), _arena()
+{
+}
+
+void CLMemoryPlanner::manage(CLTensor *tensor)
+{
+    ARM_COMPUTE_ERROR_ON(tensor == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_arena.get() != nullptr, "The memory planner has already been allocated");
+    ARM_COMPUTE_ERROR_ON_MSG(tensor->cl_buffer().get() != nullptr, "A managed tensor must not be allocated");
+
+    CLTensorAllocator *allocator = tensor->allocator();
+    allocator->_associated_memory_planner = this;
+
+    _lifetimes.push_back(Lifetime{ allocator, 0, _clock++, lifetime_not_ended, 0 });
+}
+
+void CLMemoryPlanner::finalize(CLTensorAllocator *allocator)
+{
+    const auto it = std::find_if(_lifetimes.rbegin(), _lifetimes.rend(), [&](const Lifetime & l)
+    {
+        return l.allocator == allocator;
+    });
+
+    ARM_COMPUTE_ERROR_ON_MSG(it == _lifetimes.rend(), "The tensor is not managed by this memory planner");
+    ARM_COMPUTE_ERROR_ON_MSG(it->end != lifetime_not_ended, "The lifetime of the tensor has already ended");
+
+    it->end  = _clock++;
+    it->size = allocator->info().total_size();
+}
+
+void CLMemoryPlanner::allocate()
+{
+    StartupScope startup_scope(StartupStage::ALLOCATE, "memory planner");
+
+    ARM_COMPUTE_ERROR_ON_MSG(_arena.get() != nullptr, "The memory planner has already been allocated");
+
+    if(_lifetimes.empty())
+    {
+        return;
+    }
+
+    const size_t alignment = sub_buffer_alignment();
+
+    // Same greedy placement as MemoryPlanner: biggest tensors first, each one in the first gap big enough among the tensors alive at the same time
+    std::vector<size_t> order(_lifetimes.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b)
+    {
+        return _lifetimes[a].size > _lifetimes[b].size;
+    });
+
+    std::vector<const Lifetime *>          placed;
+    std::vector<std::pair<size_t, size_t>> busy;
+
+    _arena_size = 0;
+
+    for(size_t idx : order)
+    {
+        Lifetime &lifetime = _lifetimes[idx];
+        ARM_COMPUTE_ERROR_ON_MSG(lifetime.end == lifetime_not_ended, "The lifetime of a managed tensor has not ended");
+
+        busy.clear();
+        for(const Lifetime *other : placed)
+        {
+            if(other->start < lifetime.end && lifetime.start < other->end)
+            {
+                busy.emplace_back(other->offset, other->offset + other->size);
+            }
+        }
+        std::sort(busy.begin(), busy.end());
+
+        size_t offset = 0;
+        for(const auto &range : busy)
+        {
+            if(offset + lifetime.size <= range.first)
+            {
+                break;
+            }
+            offset = std::max(offset, ceil_to_multiple(range.second, alignment));
+        }
+
+        lifetime.offset = offset;
+        _arena_size     = std::max(_arena_size, offset + lifetime.size);
+        placed.push_back(&lifetime);
+    }
+
+    startup_scope.set_bytes(_arena_size);
+
+    _arena = cl::Buffer(CLScheduler::get().context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, _arena_size);
+
+    // The sub-buffers retain the shared buffer: it is released when the last of them is freed
+    for(const Lifetime &lifetime : _lifetimes)
+    {
+        cl_buffer_region region = { lifetime.offset, lifetime.size };
+        lifetime.allocator->_buffer = _arena.createSubBuffer(CL_MEM_READ_WRITE, CL_BUFFER_CREATE_TYPE_REGION, &region);
+    }
+}
+
+size_t CLMemoryPlanner::arena_size() const
+{
+    return _arena_size;
+}
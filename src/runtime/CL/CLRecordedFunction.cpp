@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLRecordedFunction.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/Profiler.h"
+
+using namespace arm_compute;
+
+CLRecordedFunction::CLRecordedFunction()
+    : _function(nullptr), _recording(), _is_recorded(false)
+{
+}
+
+void CLRecordedFunction::configure(IFunction *function)
+{
+    ARM_COMPUTE_ERROR_ON(function == nullptr);
+
+    _function    = function;
+    _is_recorded = false;
+}
+
+void CLRecordedFunction::reset()
+{
+    _is_recorded = false;
+}
+
+void CLRecordedFunction::prepare()
+{
+    ARM_COMPUTE_ERROR_ON(_function == nullptr);
+
+    // The one-time transformations must not be part of the recording
+    _function->prepare();
+}
+
+void CLRecordedFunction::run()
+{
+    prepare();
+
+    if(Profiler::get().is_enabled())
+    {
+        _function->run();
+        return;
+    }
+
+    if(!_is_recorded)
+    {
+        // The kernels are enqueued as usual while they are recorded
+        _recording.begin();
+        _function->run();
+        _recording.end();
+
+        _is_recorded = true;
+        return;
+    }
+
+    CLScheduler::get().enqueue_recording(_recording);
+}
@@ -23,12 +23,18 @@
  */
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include "arm_compute/core/CL/CLCommandRecording.h"
 #include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/CL/CLTuner.h"
+#include "arm_compute/runtime/IFunction.h"
+#include "arm_compute/runtime/Profiler.h"
+#include "arm_compute/runtime/Tracer.h"
 
 using namespace arm_compute;
 
 CLScheduler::CLScheduler()
-    : _context(), _queue()
+    : _context(), _queues(1), _active_queue(0), _cl_tuner(nullptr), _batch_depth(0), _flush_interval(0), _num_pending_kernels(0)
 {
 }
 
@@ -40,10 +46,172 @@ CLScheduler &CLScheduler::get()
 
 void CLScheduler::enqueue(ICLKernel &kernel, bool flush)
 {
-    kernel.run(kernel.window(), _queue);
+    // Only the host side of the kernel (tuning, setting the arguments, enqueuing) is traced
+    ARM_COMPUTE_TRACE_KERNEL(kernel);
 
-    if(flush)
+    cl::CommandQueue &queue = _queues[_active_queue];
+
+    if(_cl_tuner != nullptr)
+    {
+        _cl_tuner->tune_kernel(kernel, queue);
+    }
+
+    if(Profiler::get().is_enabled())
+    {
+        enqueue_profiled(kernel);
+        return;
+    }
+
+    kernel.run(kernel.window(), queue);
+
+    if(_batch_depth > 0)
+    {
+        ++_num_pending_kernels;
+        if(_flush_interval != 0 && _num_pending_kernels >= _flush_interval)
+        {
+            queue.flush();
+            _num_pending_kernels = 0;
+        }
+    }
+    else if(flush)
+    {
+        queue.flush();
+    }
+}
+
+void CLScheduler::enqueue_recording(CLCommandRecording &recording, bool flush)
+{
+    cl::CommandQueue &queue = _queues[_active_queue];
+
+    recording.replay(queue);
+
+    if(_batch_depth > 0)
+    {
+        _num_pending_kernels += recording.size();
+        if(_flush_interval != 0 && _num_pending_kernels >= _flush_interval)
+        {
+            queue.flush();
+            _num_pending_kernels = 0;
+        }
+    }
+    else if(flush)
     {
-        _queue.flush();
+        queue.flush();
     }
 }
+
+unsigned int CLScheduler::add_queue(cl::CommandQueue queue)
+{
+    if(queue() == nullptr)
+    {
+        // Same device and properties (e.g. profiling) as the main queue
+        const cl::CommandQueue &main_queue = _queues[0];
+        queue = cl::CommandQueue(_context, main_queue.getInfo<CL_QUEUE_DEVICE>(), main_queue.getInfo<CL_QUEUE_PROPERTIES>());
+    }
+
+    ARM_COMPUTE_ERROR_ON_MSG((queue.getInfo<CL_QUEUE_PROPERTIES>() & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE) != 0, "The kernels must be executed in order");
+
+    _queues.push_back(std::move(queue));
+    return _queues.size() - 1;
+}
+
+void CLScheduler::set_active_queue(unsigned int index)
+{
+    ARM_COMPUTE_ERROR_ON(index >= _queues.size());
+
+    if(index == _active_queue)
+    {
+        return;
+    }
+
+    // The batch flushes its kernels when it ends or every flush interval: don't leave any behind in the previous queue
+    if(_num_pending_kernels != 0)
+    {
+        _queues[_active_queue].flush();
+        _num_pending_kernels = 0;
+    }
+
+    _active_queue = index;
+}
+
+void CLScheduler::enqueue_wait(const std::vector<cl::Event> &events)
+{
+    if(!events.empty())
+    {
+        _queues[_active_queue].enqueueWaitForEvents(events);
+    }
+}
+
+void CLScheduler::sync()
+{
+    for(auto &queue : _queues)
+    {
+        queue.finish();
+    }
+    _num_pending_kernels = 0;
+}
+
+void CLScheduler::begin_batch(unsigned int flush_interval)
+{
+    if(_batch_depth == 0)
+    {
+        _flush_interval      = flush_interval;
+        _num_pending_kernels = 0;
+    }
+    ++_batch_depth;
+}
+
+void CLScheduler::end_batch()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_batch_depth == 0, "No batch to end");
+
+    --_batch_depth;
+    if(_batch_depth == 0 && _num_pending_kernels != 0)
+    {
+        _queues[_active_queue].flush();
+        _num_pending_kernels = 0;
+    }
+}
+
+cl::Event CLScheduler::enqueue_function(IFunction &function, unsigned int flush_interval)
+{
+    begin_batch(flush_interval);
+    function.run();
+
+    // The marker is enqueued before the end of the batch so that the final flush submits it with the kernels
+    cl::Event event = enqueue_sync_event();
+    end_batch();
+
+    // The batch doesn't flush if the function only enqueued commands which aren't kernels (e.g. copies)
+    queue().flush();
+
+    return event;
+}
+
+void CLScheduler::enqueue_profiled(ICLKernel &kernel)
+{
+    // A kernel might enqueue several NDRanges: time them all with a marker on each side
+    cl::CommandQueue &queue = _queues[_active_queue];
+    const double      start = Profiler::get().now();
+    cl::Event    start_event;
+    cl::Event    end_event;
+
+    queue.enqueueMarker(&start_event);
+    kernel.run(kernel.window(), queue);
+    queue.enqueueMarker(&end_event);
+    end_event.wait();
+
+    double device_time = -1.0;
+    try
+    {
+        const cl_ulong device_start = start_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        const cl_ulong device_end   = end_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+        device_time                 = static_cast<double>(device_end - device_start) / 1000.0;
+    }
+    catch(const cl::Error &)
+    {
+        // The queue was not created with CL_QUEUE_PROFILING_ENABLE: only the host time is available
+    }
+
+    Profiler::get().add(kernel, ProfilerInterval{ start, Profiler::get().now() }, {}, device_time);
+}
@@ -23,10 +23,41 @@
  */
 #include "arm_compute/runtime/CL/CLTensor.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <memory>
+#include <utility>
+
 using namespace arm_compute;
 
+namespace
+{
+/** Tensor and function passed to the completion callback of a non-blocking map */
+struct MapCallback
+{
+    CLTensor *tensor;                         /**< Mapped tensor */
+    std::function<void(CLTensor &)> function; /**< Function to call with the mapped tensor */
+};
+
+/** Completion callback of the event of a non-blocking map
+ *
+ * @param[in] event     Event of the map.
+ * @param[in] status    Execution status of the event: CL_COMPLETE or an error code.
+ * @param[in] user_data MapCallback to call, owned by the callback.
+ */
+void CL_CALLBACK map_completed(cl_event event, cl_int status, void *user_data)
+{
+    ARM_COMPUTE_UNUSED(event);
+
+    std::unique_ptr<MapCallback> callback(static_cast<MapCallback *>(user_data));
+    if(status == CL_COMPLETE)
+    {
+        callback->function(*callback->tensor);
+    }
+}
+} // namespace
+
 CLTensor::CLTensor()
     : _allocator()
 {
@@ -47,7 +78,7 @@ const cl::Buffer &CLTensor::cl_buffer() const
     return _allocator.cl_data();
 }
 
-ITensorAllocator *CLTensor::allocator()
+CLTensorAllocator *CLTensor::allocator()
 {
     return &_allocator;
 }
@@ -57,6 +88,27 @@ void CLTensor::map(bool blocking)
     ICLTensor::map(CLScheduler::get().queue(), blocking);
 }
 
+cl::Event CLTensor::map_async(std::function<void(CLTensor &)> callback)
+{
+    cl::CommandQueue &queue = CLScheduler::get().queue();
+
+    ICLTensor::map(queue, false);
+
+    // The queue is in order: the marker completes once the mapping is ready
+    cl::Event event = CLScheduler::get().enqueue_sync_event();
+
+    if(callback != nullptr)
+    {
+        std::unique_ptr<MapCallback> user_data(new MapCallback{ this, std::move(callback) });
+        event.setCallback(CL_COMPLETE, &map_completed, user_data.get());
+        user_data.release();
+    }
+
+    queue.flush();
+
+    return event;
+}
+
 void CLTensor::unmap()
 {
     ICLTensor::unmap(CLScheduler::get().queue());
@@ -23,17 +23,67 @@
  */
 #include "arm_compute/runtime/CL/CLTensorAllocator.h"
 
+#include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/StartupProfiler.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/CL/CLMemoryPlanner.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <string>
+#include <utility>
+
 using namespace arm_compute;
 
+namespace
+{
+/* Definitions of the cl_arm_import_memory extension, which are not part of the Khronos headers */
+using cl_import_properties_arm = intptr_t;
+using clImportMemoryARM_func   = cl_mem (*)(cl_context, cl_mem_flags, const cl_import_properties_arm *, void *, size_t, cl_int *);
+
+constexpr cl_import_properties_arm CL_IMPORT_TYPE_ARM         = 0x40B2;
+constexpr cl_import_properties_arm CL_IMPORT_TYPE_DMA_BUF_ARM = 0x40B4;
+
+cl::Device context_device()
+{
+    return CLScheduler::get().context().getInfo<CL_CONTEXT_DEVICES>()[0];
+}
+
+clImportMemoryARM_func import_memory_arm()
+{
+    const cl::Device  device     = context_device();
+    const std::string extensions = device.getInfo<CL_DEVICE_EXTENSIONS>();
+
+    if(extensions.find("cl_arm_import_memory") == std::string::npos)
+    {
+        return nullptr;
+    }
+
+    return reinterpret_cast<clImportMemoryARM_func>(clGetExtensionFunctionAddressForPlatform(device.getInfo<CL_DEVICE_PLATFORM>(), "clImportMemoryARM"));
+}
+} // namespace
+
 CLTensorAllocator::CLTensorAllocator()
-    : _buffer(), _mapping(nullptr)
+    : _buffer(), _parent(nullptr), _mapping(nullptr), _associated_memory_planner(nullptr)
 {
 }
 
+void CLTensorAllocator::init(const CLTensorAllocator &allocator, const Coordinates &coords, TensorInfo sub_info)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+
+    // The buffer of the parent is looked up when the kernels are enqueued: the parent doesn't need to be allocated yet
+    _parent = (allocator._parent != nullptr) ? allocator._parent : &allocator;
+
+    init_sub_tensor(allocator.info(), coords, std::move(sub_info));
+}
+
+bool CLTensorAllocator::is_sub_tensor() const
+{
+    return _parent != nullptr;
+}
+
 uint8_t *CLTensorAllocator::data()
 {
     return _mapping;
@@ -41,19 +91,95 @@ uint8_t *CLTensorAllocator::data()
 
 const cl::Buffer &CLTensorAllocator::cl_data() const
 {
-    return _buffer;
+    return (_parent != nullptr) ? _parent->cl_data() : _buffer;
 }
 
 void CLTensorAllocator::allocate()
 {
     ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
 
-    _buffer = cl::Buffer(CLScheduler::get().context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, info().total_size());
+    const StartupScope startup_scope(StartupStage::ALLOCATE, "tensor", (_parent == nullptr && _associated_memory_planner == nullptr) ? info().total_size() : 0);
+
+    if(_parent != nullptr)
+    {
+        // The buffer belongs to the parent
+    }
+    else if(_associated_memory_planner == nullptr)
+    {
+        _buffer = cl::Buffer(CLScheduler::get().context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, info().total_size());
+    }
+    else
+    {
+        _associated_memory_planner->finalize(this);
+    }
     info().set_is_resizable(false);
 }
 
+void CLTensorAllocator::import_memory(cl::Buffer buffer)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_parent != nullptr, "The memory of a sub-tensor belongs to its parent");
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+    ARM_COMPUTE_ERROR_ON(buffer.get() == nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer.getInfo<CL_MEM_SIZE>() < info().total_size());
+
+    _buffer = std::move(buffer);
+    info().set_is_resizable(false);
+}
+
+void CLTensorAllocator::import_host_ptr(void *ptr, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_parent != nullptr, "The memory of a sub-tensor belongs to its parent");
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+    ARM_COMPUTE_ERROR_ON(ptr == nullptr);
+    ARM_COMPUTE_ERROR_ON(size < info().total_size());
+
+    _buffer = cl::Buffer(CLScheduler::get().context(), CL_MEM_USE_HOST_PTR | CL_MEM_READ_WRITE, size, ptr);
+    info().set_is_resizable(false);
+}
+
+void CLTensorAllocator::import_dma_buf(int fd, size_t size)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer.get() != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_parent != nullptr, "The memory of a sub-tensor belongs to its parent");
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+    ARM_COMPUTE_ERROR_ON(fd < 0);
+    ARM_COMPUTE_ERROR_ON(size < info().total_size());
+
+    const clImportMemoryARM_func import_func = import_memory_arm();
+    if(import_func == nullptr)
+    {
+        ARM_COMPUTE_ERROR("cl_arm_import_memory is not supported by the device");
+    }
+
+    const cl_import_properties_arm properties[] = { CL_IMPORT_TYPE_ARM, CL_IMPORT_TYPE_DMA_BUF_ARM, 0 };
+
+    cl_int err = CL_SUCCESS;
+    cl_mem mem = import_func(CLScheduler::get().context().get(), CL_MEM_READ_WRITE, properties, &fd, size, &err);
+    if(err != CL_SUCCESS || mem == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Failed to import the dma_buf (error %d)", err);
+    }
+
+    // The buffer takes ownership of the reference returned by clImportMemoryARM
+    _buffer = cl::Buffer(mem);
+    info().set_is_resizable(false);
+}
+
+bool CLTensorAllocator::dma_buf_import_supported()
+{
+    return import_memory_arm() != nullptr;
+}
+
 void CLTensorAllocator::free()
 {
+    if(_parent != nullptr)
+    {
+        // The buffer belongs to the parent and the layout of a sub-tensor is fixed
+        return;
+    }
+
     ARM_COMPUTE_ERROR_ON(_buffer.get() == nullptr);
 
     _buffer = cl::Buffer();
@@ -76,12 +202,13 @@ void CLTensorAllocator::unlock()
 
 uint8_t *CLTensorAllocator::map(cl::CommandQueue &q, bool blocking)
 {
-    ARM_COMPUTE_ERROR_ON(_buffer.get() == nullptr);
-    return static_cast<uint8_t *>(q.enqueueMapBuffer(_buffer, blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, 0, info().total_size()));
+    // The info of a sub-tensor holds the offset of its first element in the buffer of the parent, so the mapping starts at the beginning of that buffer
+    ARM_COMPUTE_ERROR_ON(cl_data().get() == nullptr);
+    return static_cast<uint8_t *>(q.enqueueMapBuffer(cl_data(), blocking ? CL_TRUE : CL_FALSE, CL_MAP_READ | CL_MAP_WRITE, 0, info().total_size()));
 }
 
 void CLTensorAllocator::unmap(cl::CommandQueue &q, uint8_t *mapping)
 {
-    ARM_COMPUTE_ERROR_ON(_buffer.get() == nullptr);
-    q.enqueueUnmapMemObject(_buffer, mapping);
+    ARM_COMPUTE_ERROR_ON(cl_data().get() == nullptr);
+    q.enqueueUnmapMemObject(cl_data(), mapping);
 }
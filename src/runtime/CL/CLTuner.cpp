@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLTuner.h"
+
+#include "arm_compute/core/CL/ICLKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+
+#include <limits>
+#include <sstream>
+#include <vector>
+
+using namespace arm_compute;
+
+namespace
+{
+constexpr unsigned int num_timed_runs = 2;
+
+/** Global workgroup size of the full window of a kernel, computed the same way as @ref enqueue */
+cl::NDRange global_size(const ICLKernel &kernel)
+{
+    const Window &window = kernel.window();
+
+    return cl::NDRange((window.x().end() - window.x().start()) / window.x().step(),
+                       (window.y().end() - window.y().start()) / window.y().step(),
+                       (window.z().end() - window.z().start()) / window.z().step());
+}
+
+/** Identifier of a configuration: OpenCL kernel name, build options and global workgroup size */
+std::string config_id(ICLKernel &kernel, const cl::Device &device)
+{
+    const cl::Program program = kernel.kernel().getInfo<CL_KERNEL_PROGRAM>();
+    const cl::NDRange gws     = global_size(kernel);
+
+    std::stringstream id;
+    id << kernel.kernel().getInfo<CL_KERNEL_FUNCTION_NAME>() << '\t' << program.getBuildInfo<CL_PROGRAM_BUILD_OPTIONS>(device) << '\t' << gws[0] << ' ' << gws[1] << ' ' << gws[2];
+    return id.str();
+}
+
+/** Candidate local workgroup sizes: powers of two dividing the global workgroup size and accepted by the device */
+std::vector<cl::NDRange> candidate_lws(const cl::NDRange &gws, size_t max_wg_size)
+{
+    std::vector<cl::NDRange> candidates{ cl::NullRange };
+
+    for(size_t z = 1; z <= 8; z *= 2)
+    {
+        for(size_t y = 1; y <= 32; y *= 2)
+        {
+            for(size_t x = 1; x <= 256; x *= 2)
+            {
+                if(x * y * z > max_wg_size || (gws[0] % x) != 0 || (gws[1] % y) != 0 || (gws[2] % z) != 0)
+                {
+                    continue;
+                }
+                candidates.emplace_back(x, y, z);
+            }
+        }
+    }
+
+    return candidates;
+}
+} // namespace
+
+CLTuner::CLTuner()
+    : _lws_table(), _tune_new_kernels(true)
+{
+}
+
+void CLTuner::set_tune_new_kernels(bool tune_new_kernels)
+{
+    _tune_new_kernels = tune_new_kernels;
+}
+
+bool CLTuner::tune_new_kernels() const
+{
+    return _tune_new_kernels;
+}
+
+void CLTuner::tune_kernel(ICLKernel &kernel, cl::CommandQueue &queue)
+{
+    if(kernel.kernel()() == nullptr)
+    {
+        return;
+    }
+
+    const std::string id = config_id(kernel, queue.getInfo<CL_QUEUE_DEVICE>());
+
+    auto it = _lws_table.find(id);
+    if(it == _lws_table.end())
+    {
+        // A kernel which isn't idempotent would corrupt its outputs if it was run once per candidate
+        if(!_tune_new_kernels || !kernel.is_idempotent())
+        {
+            return;
+        }
+        it = _lws_table.emplace(id, find_optimal_lws(kernel, queue)).first;
+    }
+
+    kernel.set_lws_hint(it->second);
+}
+
+cl::NDRange CLTuner::find_optimal_lws(ICLKernel &kernel, cl::CommandQueue &queue)
+{
+    // The kernel's inputs might still be being produced
+    queue.finish();
+
+    const cl::Context context = queue.getInfo<CL_QUEUE_CONTEXT>();
+    const cl::Device  device  = queue.getInfo<CL_QUEUE_DEVICE>();
+    cl::CommandQueue  tuning_queue(context, device, CL_QUEUE_PROFILING_ENABLE);
+
+    const size_t max_wg_size = kernel.kernel().getWorkGroupInfo<CL_KERNEL_WORK_GROUP_SIZE>(device);
+
+    cl::NDRange best_lws  = kernel.lws_hint();
+    cl_ulong    best_time = std::numeric_limits<cl_ulong>::max();
+
+    // Untimed run to exclude the first execution overheads from the measurements
+    kernel.run(kernel.window(), tuning_queue);
+    tuning_queue.finish();
+
+    for(const auto &lws : candidate_lws(global_size(kernel), max_wg_size))
+    {
+        kernel.set_lws_hint(lws);
+
+        try
+        {
+            for(unsigned int i = 0; i < num_timed_runs; ++i)
+            {
+                cl::Event start_event;
+                cl::Event end_event;
+
+                tuning_queue.enqueueMarker(&start_event);
+                kernel.run(kernel.window(), tuning_queue);
+                tuning_queue.enqueueMarker(&end_event);
+                end_event.wait();
+
+                const cl_ulong time = end_event.getProfilingInfo<CL_PROFILING_COMMAND_END>() - start_event.getProfilingInfo<CL_PROFILING_COMMAND_END>();
+                if(time < best_time)
+                {
+                    best_time = time;
+                    best_lws  = lws;
+                }
+            }
+        }
+        catch(const cl::Error &)
+        {
+            // The kernel doesn't accept this local workgroup size (e.g. because of its resources usage)
+            tuning_queue.finish();
+        }
+    }
+
+    return best_lws;
+}
+
+const std::map<std::string, cl::NDRange> &CLTuner::lws_table() const
+{
+    return _lws_table;
+}
+
+void CLTuner::save(std::ostream &stream) const
+{
+    for(const auto &config : _lws_table)
+    {
+        const cl::NDRange &lws = config.second;
+        stream << config.first << '\t' << lws[0] << ' ' << lws[1] << ' ' << lws[2] << '\n';
+    }
+}
+
+void CLTuner::load(std::istream &stream)
+{
+    std::string line;
+    while(std::getline(stream, line))
+    {
+        const size_t pos = line.rfind('\t');
+        if(line.empty() || pos == std::string::npos)
+        {
+            continue;
+        }
+
+        std::stringstream lws_fields(line.substr(pos + 1));
+        size_t            lws[3] = { 0, 0, 0 };
+        lws_fields >> lws[0] >> lws[1] >> lws[2];
+
+        // A null range is saved with zero sizes
+        _lws_table[line.substr(0, pos)] = (lws[0] == 0) ? cl::NullRange : cl::NDRange(lws[0], lws[1], lws[2]);
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/CLUnifiedTensor.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+
+using namespace arm_compute;
+
+CLUnifiedTensor::CLUnifiedTensor()
+    : _owner(TensorOwner::DEVICE)
+{
+}
+
+void CLUnifiedTensor::acquire_for_cpu(bool blocking)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(info()->is_resizable(), "The tensor must be allocated before being handed over");
+
+    if(_owner == TensorOwner::CPU)
+    {
+        return;
+    }
+
+    map(blocking);
+    _owner = TensorOwner::CPU;
+}
+
+void CLUnifiedTensor::release_to_device()
+{
+    if(_owner == TensorOwner::DEVICE)
+    {
+        return;
+    }
+
+    unmap();
+    _owner = TensorOwner::DEVICE;
+}
+
+TensorOwner CLUnifiedTensor::owner() const
+{
+    return _owner;
+}
@@ -28,18 +28,165 @@
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
+#include <sstream>
+#include <string>
 #include <tuple>
 
 using namespace arm_compute;
 
-CLConvolutionLayer::CLConvolutionLayer()
-    : _input_im2col_kernel(), _weights_reshape_kernel(), _input_interleave_kernel(), _weights_transposed_kernel(), _mm_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(),
-      _input_interleaved_reshaped(), _weights_reshaped(), _weights_transposed(), _gemm_output(), _is_first_run(false), _has_bias(false), _is_fc(false)
+namespace
+{
+/** Check if the transposed weights can be stored in a CL_RGBA / CL_FLOAT image
+ *
+ * @param[in] info Info of the transposed weights.
+ *
+ * @return True if the device supports images big enough for the weights
+ */
+bool image_supported(const TensorInfo &info)
+{
+    const cl::Device device = CLScheduler::get().context().getInfo<CL_CONTEXT_DEVICES>()[0];
+
+    return (info.data_type() == DataType::F32) && (device.getInfo<CL_DEVICE_IMAGE_SUPPORT>() == CL_TRUE) && ((info.dimension(0) / 4) <= device.getInfo<CL_DEVICE_IMAGE2D_MAX_WIDTH>())
+           && (info.dimension(1) <= device.getInfo<CL_DEVICE_IMAGE2D_MAX_HEIGHT>());
+}
+
+/** Number of timed runs of each algorithm while tuning a layer: the fastest one is kept */
+constexpr unsigned int num_timed_runs = 3;
+
+/** Signature of a convolution layer on the device of the scheduler: device, driver, data type, shapes, padding and stride and fused operations */
+std::string layer_signature(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info, bool image)
+{
+    const cl::Device device = CLScheduler::get().context().getInfo<CL_CONTEXT_DEVICES>()[0];
+
+    std::stringstream id;
+    id << device.getInfo<CL_DEVICE_NAME>() << ' ' << device.getInfo<CL_DRIVER_VERSION>() << "\tconv " << string_from_data_type(input->info()->data_type()) << " input";
+    for(size_t d = 0; d < 4; ++d)
+    {
+        id << ' ' << input->info()->dimension(d);
+    }
+    id << " weights";
+    for(size_t d = 0; d < 4; ++d)
+    {
+        id << ' ' << weights->info()->dimension(d);
+    }
+    id << " stride " << conv_info.stride().first << ' ' << conv_info.stride().second << " pad " << conv_info.pad().first << ' ' << conv_info.pad().second;
+    id << " round " << static_cast<int>(conv_info.round()) << " biases " << (biases != nullptr) << " act " << act_info.enabled() << " image " << image;
+    return id.str();
+}
+
+/** Initialise a benchmarking tensor with the shape and data type of another tensor
+ *
+ * @param[out] tensor    Tensor to initialise.
+ * @param[in]  reference Tensor whose settings are copied.
+ */
+void init_like(CLTensor &tensor, const ICLTensor *reference)
+{
+    tensor.allocator()->init(TensorInfo(reference->info()->tensor_shape(), 1, reference->info()->data_type()));
+}
+} // namespace
+
+CLConvolutionLayer::CLConvolutionLayer(std::shared_ptr<CLMemoryPlanner> memory_planner, ConvolutionMethodTuner *tuner)
+    : _memory_group(std::move(memory_planner)), _input_im2col_kernel(), _weights_reshape_kernel(), _input_interleave_kernel(), _weights_transposed_kernel(), _mm_kernel(), _output_col2im_kernel(),
+      _input_space_to_depth_kernel(), _weights_space_to_depth_kernel(), _implicit_gemm_kernel(), _direct_kernel(), _winograd_filter_transform_kernel(),
+      _winograd_input_transform_kernel(), _winograd_output_transform_kernel(), _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(), _weights_transposed(), _gemm_output(),
+      _input_space_to_depth(), _weights_space_to_depth(), _weights_image(), _tuner(tuner), _is_first_run(false), _has_bias(false), _is_fc(false), _is_1x1(false), _use_space_to_depth(false),
+      _use_implicit_gemm(false), _use_direct(false), _use_winograd(false)
 {
 }
 
-void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info)
+void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info, bool image,
+                                   bool space_to_depth)
+{
+    ConvolutionMethod method = space_to_depth ? ConvolutionMethod::SPACE_TO_DEPTH : ConvolutionMethod::DEFAULT;
+
+    if(_tuner != nullptr)
+    {
+        const std::string id    = layer_signature(input, weights, biases, conv_info, act_info, image);
+        ConvolutionMethod tuned = _tuner->find(id);
+        if(tuned == ConvolutionMethod::DEFAULT && _tuner->tune_new_layers())
+        {
+            tuned = find_fastest_method(input, weights, biases, output, conv_info, act_info, image);
+            _tuner->add(id, tuned);
+        }
+        if(tuned != ConvolutionMethod::DEFAULT)
+        {
+            method = tuned;
+        }
+    }
+
+    configure_method(input, weights, biases, output, conv_info, act_info, image, method);
+}
+
+ConvolutionMethod CLConvolutionLayer::find_fastest_method(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, const ICLTensor *output, const PadStrideInfo &conv_info,
+                                                          const ActivationLayerInfo &act_info, bool image)
+{
+    static const std::array<ConvolutionMethod, 5> candidates{ { ConvolutionMethod::GEMM, ConvolutionMethod::DIRECT, ConvolutionMethod::WINOGRAD, ConvolutionMethod::SPACE_TO_DEPTH, ConvolutionMethod::IMPLICIT_GEMM } };
+
+    ConvolutionMethod                   best_method = ConvolutionMethod::GEMM;
+    std::chrono::steady_clock::duration best_time   = std::chrono::steady_clock::duration::max();
+
+    for(const auto method : candidates)
+    {
+        // Each algorithm needs tensors of its own: the kernels extend the padding of their tensors when they are configured
+        CLTensor bench_input;
+        CLTensor bench_weights;
+        CLTensor bench_biases;
+        CLTensor bench_output;
+        init_like(bench_input, input);
+        init_like(bench_weights, weights);
+        init_like(bench_output, output);
+        if(biases != nullptr)
+        {
+            init_like(bench_biases, biases);
+        }
+
+        CLConvolutionLayer candidate;
+        candidate.configure_method(&bench_input, &bench_weights, (biases != nullptr) ? &bench_biases : nullptr, &bench_output, conv_info, act_info, image, method);
+        if(candidate.selected_method() != method)
+        {
+            // The algorithm doesn't support the layer
+            continue;
+        }
+
+        // Zeros rather than uninitialised memory, which might hold denormals
+        for(CLTensor *tensor : { &bench_input, &bench_weights, &bench_biases, &bench_output })
+        {
+            if(tensor->info()->total_size() != 0)
+            {
+                tensor->allocator()->allocate();
+                tensor->map();
+                std::fill_n(tensor->buffer(), tensor->info()->total_size(), 0);
+                tensor->unmap();
+            }
+        }
+
+        // The first run reshapes the weights
+        candidate.run();
+        CLScheduler::get().sync();
+
+        for(unsigned int i = 0; i < num_timed_runs; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            candidate.run();
+            CLScheduler::get().sync();
+            const auto time = std::chrono::steady_clock::now() - start;
+            if(time < best_time)
+            {
+                best_time   = time;
+                best_method = method;
+            }
+        }
+    }
+
+    return best_method;
+}
+
+void CLConvolutionLayer::configure_method(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info,
+                                          const ActivationLayerInfo &act_info, bool image, ConvolutionMethod method)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F16, DataType::F32);
@@ -56,8 +203,12 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
         ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
     }
 
-    _has_bias     = (biases != nullptr);
-    _is_first_run = true;
+    _has_bias           = (biases != nullptr);
+    _is_first_run       = true;
+    _use_space_to_depth = false;
+    _use_implicit_gemm  = false;
+    _use_direct         = false;
+    _use_winograd       = false;
 
     // Get parameters for conv_info
     unsigned int stride_x, stride_y, pad_x, pad_y = 0;
@@ -74,6 +225,9 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
     // Run the fully connected path if is_same_dimension is true and conv_stride_x/conv_stride_y are 1, and conv_pad_x/conv_pad_y are 0 and skip col2im
     _is_fc = (is_same_dimension) && ((stride_x & stride_y) == 1) && ((pad_x | pad_y) == 0);
 
+    // The im2col step of a 1x1 convolution with no stride nor padding only transposes the input, so skip it and interleave the feature maps of the input straight away
+    _is_1x1 = !_is_fc && (weights->info()->dimension(0) == 1) && (weights->info()->dimension(1) == 1) && ((stride_x & stride_y) == 1) && ((pad_x | pad_y) == 0);
+
     // Get convolved dimensions
     unsigned int conv_w = 0;
     unsigned int conv_h = 0;
@@ -81,12 +235,78 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
                                                  stride_x, stride_y, pad_x, pad_y, conv_info.round());
     ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
 
+    // Only the convolutions whose kernel overlaps several blocks of stride x stride pixels gain from the rearrangement
+    if((method == ConvolutionMethod::SPACE_TO_DEPTH) && !_is_fc && (stride_x == stride_y) && (stride_x > 1) && (weights->info()->dimension(0) == weights->info()->dimension(1)) && (weights->info()->dimension(0) > stride_x))
+    {
+        // The kernel is padded with zeros to a multiple of the stride, so each of its blocks of stride x stride pixels becomes a single pixel.
+        // The rearranged input holds the padding of the convolution and exactly the pixels read by the convolution with a stride of 1 and no padding.
+        const unsigned int block_kernel = (weights->info()->dimension(0) + stride_x - 1) / stride_x;
+        const unsigned int num_channels = input->info()->dimension(2) * stride_x * stride_x;
+
+        TensorShape shape_input = input->info()->tensor_shape();
+        shape_input.set(0, conv_w + block_kernel - 1);
+        shape_input.set(1, conv_h + block_kernel - 1);
+        shape_input.set(2, num_channels);
+        _input_space_to_depth.allocator()->init(TensorInfo(shape_input, 1, input->info()->data_type()));
+
+        TensorShape shape_weights = weights->info()->tensor_shape();
+        shape_weights.set(0, block_kernel);
+        shape_weights.set(1, block_kernel);
+        shape_weights.set(2, num_channels);
+        _weights_space_to_depth.allocator()->init(TensorInfo(shape_weights, 1, weights->info()->data_type()));
+
+        // The rearranged weights are only needed the first time the function is run to compute the reshaped weights
+        _memory_group.manage(&_input_space_to_depth);
+        _memory_group.manage(&_weights_space_to_depth);
+        _input_space_to_depth_kernel.configure(input, &_input_space_to_depth, stride_x, pad_x, pad_y);
+        _weights_space_to_depth_kernel.configure(weights, &_weights_space_to_depth, stride_x, 0, 0);
+
+        configure_method(&_input_space_to_depth, &_weights_space_to_depth, biases, output, PadStrideInfo(1, 1, 0, 0), act_info, image, ConvolutionMethod::GEMM);
+        _use_space_to_depth = true;
+
+        _input_space_to_depth.allocator()->allocate();
+        _weights_space_to_depth.allocator()->allocate();
+        return;
+    }
+
+    // Select Winograd for the 3x3 convolutions with a stride of 1: the matrix multiplication needs at least two tiles to run as a matrix-matrix multiplication.
+    // The direct convolution takes the other 3x3 convolutions with a stride of 1 or 2.
+    const bool         use_heuristics = (method == ConvolutionMethod::DEFAULT);
+    const bool         is_3x3         = !_is_fc && (weights->info()->dimension(0) == 3) && (weights->info()->dimension(1) == 3);
+    const unsigned int num_tiles      = ((conv_w + 1) / 2) * ((conv_h + 1) / 2) * input->info()->dimension(3);
+
+    if(is_3x3 && (stride_x == 1) && (stride_y == 1) && (pad_x <= 2) && (pad_y <= 2) && (num_tiles > 1) && (input->info()->data_type() == DataType::F32)
+       && (use_heuristics || method == ConvolutionMethod::WINOGRAD))
+    {
+        configure_winograd(input, weights, biases, output, conv_info, act_info, num_tiles);
+        _use_winograd = true;
+        return;
+    }
+
+    if(is_3x3 && (stride_x == stride_y) && ((stride_x == 1) || (stride_x == 2)) && (use_heuristics || method == ConvolutionMethod::DIRECT))
+    {
+        _direct_kernel.configure(input, weights, biases, output, conv_info, act_info);
+        _use_direct   = true;
+        _is_first_run = false;
+        return;
+    }
+
     // Create tensor to store the reshaped weights
     const size_t      mat_weights_cols = weights->info()->dimension(3);
     const size_t      mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2) + ((_has_bias) ? 1 : 0);
     const TensorShape shape_wr(mat_weights_cols, mat_weights_rows);
     _weights_reshaped.allocator()->init(TensorInfo(shape_wr, 1, weights->info()->data_type()));
 
+    // The implicit matrix multiplication reads the reshaped weights at every run and the input straight away: none of the other intermediate tensors is needed
+    if((method == ConvolutionMethod::IMPLICIT_GEMM) && !_is_fc)
+    {
+        _weights_reshape_kernel.configure(weights, biases, &_weights_reshaped);
+        _implicit_gemm_kernel.configure(input, &_weights_reshaped, output, weights->info()->dimension(0), weights->info()->dimension(1), conv_info, _has_bias, act_info);
+        _weights_reshaped.allocator()->allocate();
+        _use_implicit_gemm = true;
+        return;
+    }
+
     // Create tensor to store transposed weights
     TensorShape shape_wt(mat_weights_rows * 4, static_cast<size_t>(std::ceil(mat_weights_cols / 4.f)));
     TensorInfo  info_wt(shape_wt, 1, weights->info()->data_type());
@@ -117,41 +337,197 @@ void CLConvolutionLayer::configure(const ICLTensor *input, const ICLTensor *weig
     shape_gemm.set(1, mat_input_rows);
     _gemm_output.allocator()->init(TensorInfo(shape_gemm, 1, input->info()->data_type()));
 
+    // The vector-matrix multiplication doesn't use the transposed weights
+    const bool is_gemv = (_is_fc ? output->info()->dimension(1) : mat_input_rows) == 1;
+    image              = image && !is_gemv && image_supported(info_wt);
+    if(image)
+    {
+        _weights_image = cl::Image2D(CLScheduler::get().context(), CL_MEM_READ_ONLY, cl::ImageFormat(CL_RGBA, CL_FLOAT), shape_wt.x() / 4, shape_wt.y());
+    }
+
     // Configure kernels
-    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, std::make_pair(conv_w, conv_h), conv_info, _has_bias);
-    _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
+    // The reshaped weights are only needed the first time the function is run to compute the transposed weights, and so are the transposed weights when they are copied to the image
+    _memory_group.manage(&_weights_reshaped);
+    if(image)
+    {
+        _memory_group.manage(&_weights_transposed);
+    }
     _weights_reshape_kernel.configure(weights, biases, &_weights_reshaped);
     _weights_transposed_kernel.configure(&_weights_reshaped, &_weights_transposed);
+    _weights_reshaped.allocator()->allocate();
+    if(image)
+    {
+        _weights_transposed.allocator()->allocate();
+    }
+
+    // Allocate each intermediate tensor as soon as its last consumer has been configured so that its lifetime is as short as possible
+    if(_is_1x1)
+    {
+        _memory_group.manage(&_input_interleaved_reshaped);
+        _input_interleave_kernel.configure_convolution_1x1(input, &_input_interleaved_reshaped, _has_bias);
+    }
+    else
+    {
+        _memory_group.manage(&_input_im2col_reshaped);
+        _input_im2col_kernel.configure(input, &_input_im2col_reshaped, std::make_pair(conv_w, conv_h), conv_info, _has_bias);
+        _memory_group.manage(&_input_interleaved_reshaped);
+        _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
+        _input_im2col_reshaped.allocator()->allocate();
+    }
+
     if(_is_fc)
     {
-        _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, output, 1.0f);
+        _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, output, 1.0f, act_info, image ? &_weights_image : nullptr);
+        _input_interleaved_reshaped.allocator()->allocate();
     }
     else
     {
-        _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, &_gemm_output, 1.0f);
-        _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h));
+        _memory_group.manage(&_gemm_output);
+        _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, &_gemm_output, 1.0f, ActivationLayerInfo(), image ? &_weights_image : nullptr);
+        _input_interleaved_reshaped.allocator()->allocate();
+        _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h), act_info);
+        _gemm_output.allocator()->allocate();
+    }
+
+    if(!image)
+    {
+        _weights_transposed.allocator()->allocate();
     }
+}
+
+void CLConvolutionLayer::configure_winograd(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const PadStrideInfo &conv_info,
+                                            const ActivationLayerInfo &act_info, unsigned int num_tiles)
+{
+    // The GEMM tensors hold the 16 matrices of the Winograd domain, one for each element of a 4x4 tile:
+    // the transformed weights and input take the place of the reshaped weights and of the im2col output.
+    const unsigned int num_ifm = weights->info()->dimension(2);
+    const unsigned int num_ofm = weights->info()->dimension(3);
+
+    // Create tensor to store the transformed weights
+    _weights_reshaped.allocator()->init(TensorInfo(TensorShape(num_ofm, num_ifm, 16U), 1, weights->info()->data_type()));
 
-    // Allocate intermediate tensors
+    // Create tensor to store transposed weights
+    const TensorShape shape_wt(num_ifm * 4, static_cast<unsigned int>(std::ceil(num_ofm / 4.f)), 16U);
+    _weights_transposed.allocator()->init(TensorInfo(shape_wt, 1, weights->info()->data_type()));
+
+    // Create tensor to store the transformed input
+    _input_im2col_reshaped.allocator()->init(TensorInfo(TensorShape(num_ifm, num_tiles, 16U), 1, input->info()->data_type()));
+
+    // Create tensor to prepare input tensor for GEMM
+    const TensorShape shape_interleaved(num_ifm * 4, static_cast<unsigned int>(std::ceil(num_tiles / 4.f)), 16U);
+    _input_interleaved_reshaped.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
+
+    // Create GEMM output tensor
+    _gemm_output.allocator()->init(TensorInfo(TensorShape(num_ofm, num_tiles, 16U), 1, input->info()->data_type()));
+
+    // Configure kernels
+    // The transformed weights are only needed the first time the function is run to compute the transposed weights
+    _memory_group.manage(&_weights_reshaped);
+    _winograd_filter_transform_kernel.configure(weights, &_weights_reshaped);
+    _weights_transposed_kernel.configure(&_weights_reshaped, &_weights_transposed);
     _weights_reshaped.allocator()->allocate();
-    _weights_transposed.allocator()->allocate();
+
+    _memory_group.manage(&_input_im2col_reshaped);
+    _winograd_input_transform_kernel.configure(input, &_input_im2col_reshaped, conv_info);
+    _memory_group.manage(&_input_interleaved_reshaped);
+    _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
     _input_im2col_reshaped.allocator()->allocate();
+
+    _memory_group.manage(&_gemm_output);
+    _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, &_gemm_output, 1.0f);
     _input_interleaved_reshaped.allocator()->allocate();
+
+    _winograd_output_transform_kernel.configure(&_gemm_output, biases, output, act_info);
     _gemm_output.allocator()->allocate();
+
+    _weights_transposed.allocator()->allocate();
 }
 
-void CLConvolutionLayer::run()
+ConvolutionMethod CLConvolutionLayer::selected_method() const
+{
+    if(_use_space_to_depth)
+    {
+        return ConvolutionMethod::SPACE_TO_DEPTH;
+    }
+    if(_use_implicit_gemm)
+    {
+        return ConvolutionMethod::IMPLICIT_GEMM;
+    }
+    if(_use_winograd)
+    {
+        return ConvolutionMethod::WINOGRAD;
+    }
+    return _use_direct ? ConvolutionMethod::DIRECT : ConvolutionMethod::GEMM;
+}
+
+void CLConvolutionLayer::prepare()
 {
-    // Run weights reshaping (Runs once for every configure)
     if(_is_first_run)
     {
         _is_first_run = false;
+        if(_use_space_to_depth)
+        {
+            CLScheduler::get().enqueue(_weights_space_to_depth_kernel);
+        }
+        if(_use_winograd)
+        {
+            CLScheduler::get().enqueue(_winograd_filter_transform_kernel);
+            CLScheduler::get().enqueue(_weights_transposed_kernel);
+            return;
+        }
         CLScheduler::get().enqueue(_weights_reshape_kernel);
+        if(_use_implicit_gemm)
+        {
+            return;
+        }
         CLScheduler::get().enqueue(_weights_transposed_kernel);
+
+        // Copy the transposed weights to the image one row at a time as the rows of the tensor might be padded
+        if(_weights_image() != nullptr)
+        {
+            const TensorInfo *info  = _weights_transposed.info();
+            cl::CommandQueue &queue = CLScheduler::get().queue();
+            for(size_t y = 0; y < info->dimension(1); ++y)
+            {
+                const size_t offset = info->offset_first_element_in_bytes() + y * info->strides_in_bytes()[1];
+                queue.enqueueCopyBufferToImage(_weights_transposed.cl_buffer(), _weights_image, offset, { { 0, y, 0 } }, { { info->dimension(0) / 4, 1, 1 } });
+            }
+        }
     }
+}
+
+void CLConvolutionLayer::run()
+{
+    // Run weights reshaping (Runs once for every configure, unless prepare() has been called)
+    prepare();
 
     // Run input reshaping
-    CLScheduler::get().enqueue(_input_im2col_kernel);
+    if(_use_space_to_depth)
+    {
+        CLScheduler::get().enqueue(_input_space_to_depth_kernel);
+    }
+    if(_use_implicit_gemm)
+    {
+        CLScheduler::get().enqueue(_implicit_gemm_kernel);
+        return;
+    }
+    if(_use_direct)
+    {
+        CLScheduler::get().enqueue(_direct_kernel);
+        return;
+    }
+    if(_use_winograd)
+    {
+        CLScheduler::get().enqueue(_winograd_input_transform_kernel);
+        CLScheduler::get().enqueue(_input_interleave_kernel);
+        CLScheduler::get().enqueue(_mm_kernel);
+        CLScheduler::get().enqueue(_winograd_output_transform_kernel, false);
+        return;
+    }
+    if(!_is_1x1)
+    {
+        CLScheduler::get().enqueue(_input_im2col_kernel);
+    }
     CLScheduler::get().enqueue(_input_interleave_kernel);
 
     // Runs matrix multiply on reshaped matrices
@@ -164,3 +540,23 @@ void CLConvolutionLayer::run()
         CLScheduler::get().enqueue(_output_col2im_kernel, false);
     }
 }
+
+MemoryFootprint CLConvolutionLayer::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::WEIGHTS, _weights_reshaped);
+    footprint.add(MemoryCategory::WEIGHTS, _weights_transposed);
+    footprint.add(MemoryCategory::WEIGHTS, _weights_space_to_depth);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_space_to_depth);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_im2col_reshaped);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_interleaved_reshaped);
+    footprint.add(MemoryCategory::ACTIVATIONS, _gemm_output);
+
+    // The image holding the weights has no tensor info: its size comes from the device
+    if(_weights_image() != nullptr)
+    {
+        footprint.weights += _weights_image.getImageInfo<CL_IMAGE_ROW_PITCH>() * _weights_image.getImageInfo<CL_IMAGE_HEIGHT>();
+    }
+
+    return footprint;
+}
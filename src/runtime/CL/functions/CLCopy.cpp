@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/functions/CLCopy.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+
+#include <cstddef>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Layout of a 3D block of a tensor, as expected by the rectangular copies of OpenCL */
+struct RectLayout
+{
+    cl::array<cl::size_type, 3> origin;      /**< Origin of the block: byte in the row, row, slice */
+    size_t                      row_pitch;   /**< Distance in bytes between two rows */
+    size_t                      slice_pitch; /**< Distance in bytes between two slices */
+};
+
+/** Compute the layout of the 3D block of a tensor starting at an offset
+ *
+ * @param[in] info   Info of the tensor.
+ * @param[in] offset Offset in bytes of the first element of the block.
+ *
+ * @return The layout of the block
+ */
+RectLayout rect_layout(const TensorInfo &info, size_t offset)
+{
+    const size_t row_size    = info.dimension(0) * info.element_size();
+    const size_t row_pitch   = info.num_dimensions() > 1 ? info.strides_in_bytes()[1] : row_size;
+    const size_t slice_pitch = info.num_dimensions() > 2 ? info.strides_in_bytes()[2] : row_pitch * info.dimension(1);
+
+    // The offset is split between the coordinates of the origin to keep it inside a row
+    return RectLayout{ { { offset % row_pitch, offset / row_pitch, 0 } }, row_pitch, slice_pitch };
+}
+
+/** Call a function on each 3D block of two tensors of the same shape (One per coordinate along the dimensions above Z)
+ *
+ * @param[in] src  Info of the source tensor.
+ * @param[in] dst  Info of the destination tensor.
+ * @param[in] func Function to call: void func(const RectLayout &src_layout, const RectLayout &dst_layout, const cl::array<cl::size_type, 3> &region).
+ */
+template <typename F>
+void for_each_block(const TensorInfo &src, const TensorInfo &dst, F &&func)
+{
+    const cl::array<cl::size_type, 3> region = { { src.dimension(0) * src.element_size(), src.dimension(1), src.dimension(2) } };
+
+    Window blocks;
+    blocks.use_tensor_dimensions(&src, 3);
+
+    execute_window_loop(blocks, [&](const Coordinates & id)
+    {
+        func(rect_layout(src, src.offset_element_in_bytes(id)), rect_layout(dst, dst.offset_element_in_bytes(id)), region);
+    });
+}
+} // namespace
+
+CLCopy::CLCopy()
+    : _input(nullptr), _output(nullptr), _cl_input(nullptr), _cl_output(nullptr), _direction(Direction::DEVICE_TO_DEVICE), _convert_kernel(), _is_conversion(false)
+{
+}
+
+void CLCopy::configure(const ICLTensor *input, ICLTensor *output, ConvertPolicy policy)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input         = input;
+    _output        = output;
+    _cl_input      = input;
+    _cl_output     = output;
+    _direction     = Direction::DEVICE_TO_DEVICE;
+    _is_conversion = input->info()->data_type() != output->info()->data_type();
+
+    if(!_is_conversion)
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->num_channels() != output->info()->num_channels());
+        output->info()->set_valid_region(input->info()->valid_region());
+    }
+    else if(is_data_type_float(input->info()->data_type()) || is_data_type_float(output->info()->data_type()))
+    {
+        _convert_kernel.configure(input, output);
+    }
+    else
+    {
+        _convert_kernel.configure(input, output, policy, 0);
+    }
+}
+
+void CLCopy::configure(const ITensor *input, ICLTensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_channels() != output->info()->num_channels());
+
+    _input         = input;
+    _output        = output;
+    _cl_input      = nullptr;
+    _cl_output     = output;
+    _direction     = Direction::HOST_TO_DEVICE;
+    _is_conversion = false;
+
+    output->info()->set_valid_region(input->info()->valid_region());
+}
+
+void CLCopy::configure(const ICLTensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_channels() != output->info()->num_channels());
+
+    _input         = input;
+    _output        = output;
+    _cl_input      = input;
+    _cl_output     = nullptr;
+    _direction     = Direction::DEVICE_TO_HOST;
+    _is_conversion = false;
+
+    output->info()->set_valid_region(input->info()->valid_region());
+}
+
+void CLCopy::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_input == nullptr, "The function has not been configured");
+
+    if(_is_conversion)
+    {
+        CLScheduler::get().enqueue(_convert_kernel);
+        return;
+    }
+
+    cl::CommandQueue &queue    = CLScheduler::get().queue();
+    const TensorInfo &src_info = *_input->info();
+    const TensorInfo &dst_info = *_output->info();
+
+    switch(_direction)
+    {
+        case Direction::DEVICE_TO_DEVICE:
+            if(has_contiguous_layout(src_info) && has_contiguous_layout(dst_info))
+            {
+                queue.enqueueCopyBuffer(_cl_input->cl_buffer(), _cl_output->cl_buffer(), 0, 0, src_info.tensor_shape().total_size() * src_info.element_size());
+            }
+            else
+            {
+                for_each_block(src_info, dst_info, [&](const RectLayout & src, const RectLayout & dst, const cl::array<cl::size_type, 3> &region)
+                {
+                    queue.enqueueCopyBufferRect(_cl_input->cl_buffer(), _cl_output->cl_buffer(), src.origin, dst.origin, region, src.row_pitch, src.slice_pitch, dst.row_pitch, dst.slice_pitch);
+                });
+            }
+            break;
+        case Direction::HOST_TO_DEVICE:
+            for_each_block(src_info, dst_info, [&](const RectLayout & src, const RectLayout & dst, const cl::array<cl::size_type, 3> &region)
+            {
+                queue.enqueueWriteBufferRect(_cl_output->cl_buffer(), CL_TRUE, dst.origin, src.origin, region, dst.row_pitch, dst.slice_pitch, src.row_pitch, src.slice_pitch, _input->buffer());
+            });
+            break;
+        case Direction::DEVICE_TO_HOST:
+            for_each_block(src_info, dst_info, [&](const RectLayout & src, const RectLayout & dst, const cl::array<cl::size_type, 3> &region)
+            {
+                queue.enqueueReadBufferRect(_cl_input->cl_buffer(), CL_TRUE, src.origin, dst.origin, region, src.row_pitch, src.slice_pitch, dst.row_pitch, dst.slice_pitch, _output->buffer());
+            });
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Unknown direction");
+            break;
+    }
+}
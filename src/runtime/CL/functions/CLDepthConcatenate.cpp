@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CL/functions/CLDepthConcatenate.h"
+
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/Coordinates.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/CL/CLScheduler.h"
+#include "arm_compute/runtime/CL/CLTensor.h"
+#include "arm_compute/runtime/CL/CLTensorAllocator.h"
+
+#include <cstddef>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Check whether a tensor can use a part of a tensor with the given padding as its own padding */
+bool padding_fits(const PaddingSize &padding, const PaddingSize &available)
+{
+    return padding.top <= available.top && padding.right <= available.right && padding.bottom <= available.bottom && padding.left <= available.left;
+}
+} // namespace
+
+CLDepthConcatenate::CLDepthConcatenate()
+    : _copy_kernels(), _num_copies(0), _sub_tensors(), _output(nullptr)
+{
+}
+
+void CLDepthConcatenate::configure(const std::vector<CLTensor *> &inputs, CLTensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(inputs.empty());
+    ARM_COMPUTE_ERROR_ON(output == nullptr);
+
+    _output = output;
+    _sub_tensors.clear();
+
+    // Decide which inputs can share the memory of the output: the padding of the output must cover theirs,
+    // it is extended as much as needed as long as the output is not allocated
+    std::vector<bool> is_sub_tensor(inputs.size(), false);
+    unsigned int      depth = 0;
+
+    for(size_t i = 0; i < inputs.size(); ++i)
+    {
+        TensorInfo *info = inputs[i]->info();
+
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(inputs[i], output);
+        ARM_COMPUTE_ERROR_ON(info->dimension(0) != output->info()->dimension(0));
+        ARM_COMPUTE_ERROR_ON(info->dimension(1) != output->info()->dimension(1));
+        ARM_COMPUTE_ERROR_ON(info->dimension(3) != output->info()->dimension(3));
+
+        if(info->is_resizable() && !inputs[i]->allocator()->is_sub_tensor())
+        {
+            if(output->info()->is_resizable())
+            {
+                output->info()->extend_padding(info->padding());
+                is_sub_tensor[i] = true;
+            }
+            else
+            {
+                is_sub_tensor[i] = padding_fits(info->padding(), output->info()->padding());
+            }
+        }
+
+        depth += info->dimension(2);
+    }
+
+    ARM_COMPUTE_ERROR_ON(depth != output->info()->dimension(2));
+    ARM_COMPUTE_UNUSED(depth);
+
+    // The copy kernels might extend the padding of the output too: configure them before the sub-tensors take the layout of the output
+    _num_copies   = 0;
+    _copy_kernels = arm_compute::cpp14::make_unique<CLDepthConcatenateKernel[]>(inputs.size());
+
+    unsigned int depth_offset = 0;
+    for(size_t i = 0; i < inputs.size(); ++i)
+    {
+        if(!is_sub_tensor[i])
+        {
+            _copy_kernels[_num_copies++].configure(inputs[i], depth_offset, output);
+        }
+        depth_offset += inputs[i]->info()->dimension(2);
+    }
+
+    depth_offset = 0;
+    for(size_t i = 0; i < inputs.size(); ++i)
+    {
+        if(is_sub_tensor[i])
+        {
+            // Keep the region computed by the producer of the input
+            const ValidRegion valid_region = inputs[i]->info()->valid_region();
+
+            inputs[i]->allocator()->init(*output->allocator(), Coordinates(0, 0, static_cast<int>(depth_offset)), *inputs[i]->info());
+            inputs[i]->info()->set_valid_region(valid_region);
+
+            _sub_tensors.push_back(inputs[i]);
+        }
+        depth_offset += inputs[i]->info()->dimension(2);
+    }
+}
+
+unsigned int CLDepthConcatenate::num_copies() const
+{
+    return _num_copies;
+}
+
+void CLDepthConcatenate::run()
+{
+    for(const ICLTensor *sub_tensor : _sub_tensors)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(sub_tensor->info()->strides_in_bytes()[1] != _output->info()->strides_in_bytes()[1], "The padding of the output changed after the configuration");
+        ARM_COMPUTE_UNUSED(sub_tensor);
+    }
+
+    for(unsigned int i = 0; i < _num_copies; ++i)
+    {
+        CLScheduler::get().enqueue(_copy_kernels[i]);
+    }
+}
@@ -36,3 +36,10 @@ void CLDepthConvert::configure(const ICLTensor *input, ICLTensor *output, Conver
     k->configure(input, output, policy, shift);
     _kernel = std::move(k);
 }
+
+void CLDepthConvert::configure(const ICLTensor *input, ICLTensor *output, float scale, float offset)
+{
+    auto k = arm_compute::cpp14::make_unique<CLDepthConvertKernel>();
+    k->configure(input, output, scale, offset);
+    _kernel = std::move(k);
+}
@@ -32,7 +32,6 @@
 #include "arm_compute/runtime/ITensorAllocator.h"
 
 #include <algorithm>
-#include <cstring>
 
 using namespace arm_compute;
 
@@ -47,7 +46,11 @@ CLFastCorners::CLFastCorners()
       _num_corners(nullptr),
       _num_buffer(),
       _corners(nullptr),
-      _constant_border_value(0)
+      _constant_border_value(0),
+      _blocking(true),
+      _num_corners_read(0),
+      _num_corners_event(),
+      _zeros()
 {
 }
 
@@ -68,28 +71,61 @@ void CLFastCorners::configure(const ICLImage *input, float threshold, bool nonma
     _num_buffer            = cl::Buffer(CLScheduler::get().context(), CL_MEM_ALLOC_HOST_PTR | CL_MEM_READ_WRITE, sizeof(unsigned int));
     _constant_border_value = constant_border_value;
 
-    const bool update_number = (nullptr != _num_corners);
-
     _fast_corners_kernel.configure(input, &_output, threshold, nonmax_suppression, border_mode);
 
     if(!_non_max)
     {
-        _copy_array_kernel.configure(&_output, update_number, corners, &_num_buffer);
+        _copy_array_kernel.configure(&_output, corners, &_num_buffer);
     }
     else
     {
         _suppr.allocator()->init(tensor_info);
 
         _suppr_func.configure(&_output, &_suppr, border_mode);
-        _copy_array_kernel.configure(&_suppr, update_number, corners, &_num_buffer);
+        _copy_array_kernel.configure(&_suppr, corners, &_num_buffer);
 
         _suppr.allocator()->allocate();
+
+        _zeros.assign(_output.info()->total_size(), 0);
     }
 
     // Allocate intermediate tensors
     _output.allocator()->allocate();
 }
 
+void CLFastCorners::set_blocking(bool blocking)
+{
+    _blocking = blocking;
+}
+
+void CLFastCorners::sync_corners()
+{
+    if(_num_corners_event() != nullptr)
+    {
+        _num_corners_event.wait();
+        _num_corners_event = cl::Event();
+
+        update_num_corners();
+    }
+}
+
+const cl::Buffer &CLFastCorners::num_corners_buffer() const
+{
+    return _num_buffer;
+}
+
+void CLFastCorners::update_num_corners()
+{
+    const size_t corner_size = std::min(static_cast<size_t>(_num_corners_read), _corners->max_num_values());
+
+    _corners->resize(corner_size);
+
+    if(_num_corners != nullptr)
+    {
+        *_num_corners = _num_corners_read;
+    }
+}
+
 void CLFastCorners::run()
 {
     cl::CommandQueue q = CLScheduler::get().queue();
@@ -97,9 +133,9 @@ void CLFastCorners::run()
     if(_non_max)
     {
         ARM_COMPUTE_ERROR_ON_MSG(_output.cl_buffer().get() == nullptr, "Unconfigured function");
-        const auto out_buffer = static_cast<unsigned char *>(q.enqueueMapBuffer(_output.cl_buffer(), CL_TRUE, CL_MAP_WRITE, 0, _output.info()->total_size()));
-        memset(out_buffer, 0, _output.info()->total_size());
-        q.enqueueUnmapMemObject(_output.cl_buffer(), out_buffer);
+
+        // The zeros are never modified so the write doesn't need to block
+        q.enqueueWriteBuffer(_output.cl_buffer(), CL_FALSE, 0, _zeros.size(), _zeros.data());
     }
 
     CLScheduler::get().enqueue(_fast_corners_kernel, false);
@@ -111,16 +147,16 @@ void CLFastCorners::run()
 
     CLScheduler::get().enqueue(_copy_array_kernel, false);
 
-    unsigned int get_num_corners = 0;
-    q.enqueueReadBuffer(_num_buffer, CL_TRUE, 0, sizeof(unsigned int), &get_num_corners);
-
-    size_t corner_size = std::min(static_cast<size_t>(get_num_corners), _corners->max_num_values());
-
-    _corners->resize(corner_size);
-
-    if(_num_corners != nullptr)
+    if(_blocking)
+    {
+        q.enqueueReadBuffer(_num_buffer, CL_TRUE, 0, sizeof(unsigned int), &_num_corners_read);
+        update_num_corners();
+    }
+    else
     {
-        *_num_corners = get_num_corners;
+        // Read back when the caller asks for the number of corners
+        _num_corners_event = cl::Event();
+        q.enqueueReadBuffer(_num_buffer, CL_FALSE, 0, sizeof(unsigned int), &_num_corners_read, nullptr, &_num_corners_event);
     }
 
     q.flush();
@@ -32,20 +32,43 @@
 using namespace arm_compute;
 
 CLFullyConnectedLayer::CLFullyConnectedLayer()
-    : _im2col_kernel(), _transpose_kernel(), _transpose1xW_kernel(), _interleave4x4_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _im2col_output(), _interleave4x4_output(), _transpose_output(),
-      _transpose1xW_output(), _is_first_run(true), _transpose_weights(true), _fc_after_conv(true), _batched_fc_layer(false), _accumulate_biases(false)
+    : _im2col_kernel(), _transpose1xW_kernel(), _interleave_weights_kernel(), _interleave4x4_kernel(), _mm_kernel(), _mv_kernel(), _accumulate_biases_kernel(), _im2col_output(),
+      _interleave4x4_output(), _transpose1xW_output(), _original_weights(nullptr), _is_first_run(true), _transpose_weights(true), _fc_after_conv(true), _batched_fc_layer(false),
+      _accumulate_biases(false), _run_matrix_vector(false)
 {
 }
 
+void CLFullyConnectedLayer::configure_reshape_weights(const ICLTensor *weights)
+{
+    // Initialize output tensor for transpose 1xW: [num_inputs * 4, ceil(num_outputs / 4)]
+    const size_t num_inputs  = _transpose_weights ? weights->info()->dimension(0) : weights->info()->dimension(1);
+    const size_t num_outputs = _transpose_weights ? weights->info()->dimension(1) : weights->info()->dimension(0);
+    TensorShape  shape_transposed1xW(num_inputs * 4, static_cast<size_t>(std::ceil(num_outputs / 4.f)));
+    _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
+
+    if(_transpose_weights)
+    {
+        // Interleaving the rows of weights which haven't been transposed yet gives the same layout as transposing them and then running
+        // the transpose 1xW kernel: the weights are reshaped in a single pass, without an intermediate transposed copy
+        _interleave_weights_kernel.configure(weights, &_transpose1xW_output);
+    }
+    else
+    {
+        // Configure transpose 1xW kernel
+        _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
+    }
+}
+
 void CLFullyConnectedLayer::configure_conv_fc_wb(const ICLTensor *input, const ICLTensor *weights, ICLTensor *output)
 {
-    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(1) != (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+    const size_t num_inputs = _transpose_weights ? weights->info()->dimension(0) : weights->info()->dimension(1);
+    ARM_COMPUTE_ERROR_ON(num_inputs != (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
 
     // If the fully connected layer is called after a convolution layer, the input tensor must be linearized
 
     // Initialize output tensor for im2col
     TensorShape shape_im2col;
-    shape_im2col.set(0, weights->info()->dimension(1));
+    shape_im2col.set(0, num_inputs);
     shape_im2col.set(1, input->info()->dimension(3));
     shape_im2col.set(2, input->info()->dimension(4));
     shape_im2col.set(3, input->info()->dimension(5));
@@ -57,9 +80,8 @@ void CLFullyConnectedLayer::configure_conv_fc_wb(const ICLTensor *input, const I
     shape_interleaved.set(1, std::ceil(static_cast<float>(shape_interleaved.y()) / 4));
     _interleave4x4_output.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
 
-    // Initialize output tensor for transpose 1xW
-    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
-    _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
+    // Configure the reshape of the weights
+    configure_reshape_weights(weights);
 
     // Configure im2col kernel
     _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
@@ -67,9 +89,6 @@ void CLFullyConnectedLayer::configure_conv_fc_wb(const ICLTensor *input, const I
     // Configure interleave4x4 kernel
     _interleave4x4_kernel.configure(&_im2col_output, &_interleave4x4_output);
 
-    // Configure transpose 1xW kernel
-    _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
-
     // Configure matrix multiply kernel
     _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f);
 
@@ -87,16 +106,12 @@ void CLFullyConnectedLayer::configure_fc_fc_wb(const ICLTensor *input, const ICL
     shape_interleaved.set(1, std::ceil(static_cast<float>(shape_interleaved.y()) / 4));
     _interleave4x4_output.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
 
-    // Initialize output tensor for transpose 1xW
-    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
-    _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
+    // Configure the reshape of the weights
+    configure_reshape_weights(weights);
 
     // Configure interleave4x4 kernel
     _interleave4x4_kernel.configure(input, &_interleave4x4_output);
 
-    // Configure transpose 1xW kernel
-    _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
-
     // Configure matrix multiply kernel
     _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f);
 
@@ -135,20 +150,72 @@ void CLFullyConnectedLayer::configure_fc_fc_nb(const ICLTensor *input, const ICL
     _mm_kernel.configure(input, weights, output, 1.0f);
 }
 
-void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, bool transpose_weights)
+void CLFullyConnectedLayer::configure_mv(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, const ICLTensor *weights_scales)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
-    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() != 2);
+    _fc_after_conv = (weights->info()->dimension(0) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+
+    const ICLTensor *input_to_use = input;
 
-    const ICLTensor *weights_to_use = weights;
+    if(_fc_after_conv)
+    {
+        // If the fully connected layer is called after a convolution layer, the input tensor must be linearized
+        TensorShape shape_im2col;
+        shape_im2col.set(0, weights->info()->dimension(0));
+        shape_im2col.set(1, 1);
+        _im2col_output.allocator()->init(TensorInfo(shape_im2col, 1, input->info()->data_type()));
+
+        // Configure im2col kernel
+        _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
+
+        input_to_use = &_im2col_output;
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != weights->info()->dimension(0));
+    }
+
+    // Configure matrix vector multiply kernel: each row of the weights holds the weights of one output, dequantized as they are loaded
+    _mv_kernel.configure(input_to_use, weights, biases, output, weights_scales);
+
+    // Allocate the output tensor for im2col once all the configure methods have been called
+    if(_fc_after_conv)
+    {
+        _im2col_output.allocator()->allocate();
+    }
+}
+
+void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *weights, const ICLTensor *biases, ICLTensor *output, bool transpose_weights, const ICLTensor *weights_scales)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() != 2);
 
     _is_first_run      = true;
     _transpose_weights = transpose_weights;
     _fc_after_conv     = true;
     _batched_fc_layer  = false;
     _accumulate_biases = false;
+    _run_matrix_vector = false;
+
+    // Without batches, the weights which haven't been transposed yet are read as they are by the matrix vector multiplication, which also adds the biases
+    if((output->info()->dimension(1) == 1) && _transpose_weights)
+    {
+        if(biases != nullptr)
+        {
+            ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        }
+
+        _run_matrix_vector = true;
+        _transpose_weights = false;
+
+        configure_mv(input, weights, biases, output, weights_scales);
+        return;
+    }
+
+    // Only the matrix vector multiplication dequantizes the weights
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    ARM_COMPUTE_ERROR_ON(weights_scales != nullptr);
 
     if(biases != nullptr)
     {
@@ -160,16 +227,7 @@ void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *w
         _accumulate_biases_kernel.configure(output, biases);
     }
 
-    // Check if we need to transpose the weights
-    if(_transpose_weights)
-    {
-        // Initialize the output tensor for transpose
-        TensorShape shape_transposed(weights->info()->dimension(1), weights->info()->dimension(0));
-        _transpose_output.allocator()->init(TensorInfo(shape_transposed, 1, weights->info()->data_type()));
-        _transpose_kernel.configure(weights, &_transpose_output);
-
-        weights_to_use = &_transpose_output;
-    }
+    _original_weights = weights;
 
     // With the Fully Connected layer we can have 4 different cases:
     //  1) Convolution layer -> Fully Connected layer without batches
@@ -189,54 +247,51 @@ void CLFullyConnectedLayer::configure(const ICLTensor *input, const ICLTensor *w
         if(_fc_after_conv)
         {
             // Fully Connected layer after a Convolution Layer with batches
-            configure_conv_fc_wb(input, weights_to_use, output);
+            configure_conv_fc_wb(input, weights, output);
         }
         else
         {
             // Fully Connected layer after a Fully Connected Layer with batches
-            configure_fc_fc_wb(input, weights_to_use, output);
+            configure_fc_fc_wb(input, weights, output);
         }
     }
     else
     {
-        _fc_after_conv = (weights_to_use->info()->dimension(1) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+        _fc_after_conv = (weights->info()->dimension(1) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
 
         if(_fc_after_conv)
         {
             // Fully Connected layer after a Convolution Layer without batches
-            configure_conv_fc_nb(input, weights_to_use, output);
+            configure_conv_fc_nb(input, weights, output);
         }
         else
         {
             // Fully Connected layer after a Fully Connected Layer without batches
-            configure_fc_fc_nb(input, weights_to_use, output);
+            configure_fc_fc_nb(input, weights, output);
         }
     }
-
-    // Allocate the transpose tensor if the transpose_weights flag is true and once all the configure methods have been called
-    if(_transpose_weights)
-    {
-        _transpose_output.allocator()->allocate();
-    }
 }
 
-void CLFullyConnectedLayer::run()
+void CLFullyConnectedLayer::prepare()
 {
-    // The reshape of the weights happens only once
     if(_is_first_run)
     {
         _is_first_run = false;
 
-        if(_transpose_weights)
-        {
-            CLScheduler::get().enqueue(_transpose_kernel);
-        }
-
         if(_batched_fc_layer)
         {
-            CLScheduler::get().enqueue(_transpose1xW_kernel);
+            CLScheduler::get().enqueue(_transpose_weights ? static_cast<ICLKernel &>(_interleave_weights_kernel) : static_cast<ICLKernel &>(_transpose1xW_kernel));
+
+            // Only the reshaped weights are read from now on
+            _original_weights->mark_as_unused();
         }
     }
+}
+
+void CLFullyConnectedLayer::run()
+{
+    // The reshape of the weights happens only once, unless prepare() has been called
+    prepare();
 
     // Linearize input if it comes from a convolutional layer
     if(_fc_after_conv)
@@ -251,7 +306,14 @@ void CLFullyConnectedLayer::run()
     }
 
     // Run matrix multiply
-    CLScheduler::get().enqueue(_mm_kernel, !_accumulate_biases);
+    if(_run_matrix_vector)
+    {
+        CLScheduler::get().enqueue(_mv_kernel);
+    }
+    else
+    {
+        CLScheduler::get().enqueue(_mm_kernel, !_accumulate_biases);
+    }
 
     // Accumulate biases if provided
     if(_accumulate_biases)
@@ -259,3 +321,13 @@ void CLFullyConnectedLayer::run()
         CLScheduler::get().enqueue(_accumulate_biases_kernel);
     }
 }
+
+MemoryFootprint CLFullyConnectedLayer::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::WEIGHTS, _transpose1xW_output);
+    footprint.add(MemoryCategory::ACTIVATIONS, _im2col_output);
+    footprint.add(MemoryCategory::ACTIVATIONS, _interleave4x4_output);
+
+    return footprint;
+}
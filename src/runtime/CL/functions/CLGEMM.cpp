@@ -143,3 +143,12 @@ void CLGEMM::run()
         CLScheduler::get().enqueue(_ma_kernel);
     }
 }
+
+MemoryFootprint CLGEMM::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::ACTIVATIONS, _tmp_a);
+    footprint.add(MemoryCategory::ACTIVATIONS, _tmp_b);
+
+    return footprint;
+}
@@ -43,6 +43,34 @@
 
 using namespace arm_compute;
 
+namespace
+{
+/** Enqueue the copy of the content of an image to an image of the same shape in the active queue, without blocking the host.
+ *
+ * Unlike ITensor::copy_from(), neither image is mapped: the paddings of the two images can differ, the rows are copied by the device.
+ *
+ * @param[in]  src Source image.
+ * @param[out] dst Destination image, of the same shape and data type as @p src.
+ */
+void enqueue_copy(const ICLImage *src, ICLImage *dst)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(src);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(src, dst);
+
+    const size_t src_row_pitch = src->info()->strides_in_bytes()[1];
+    const size_t dst_row_pitch = dst->info()->strides_in_bytes()[1];
+    const size_t src_offset    = src->info()->offset_first_element_in_bytes();
+    const size_t dst_offset    = dst->info()->offset_first_element_in_bytes();
+
+    // The offset of the first element is split between the coordinates of the origin to keep it inside a row
+    const cl::array<cl::size_type, 3> src_origin = { { src_offset % src_row_pitch, src_offset / src_row_pitch, 0 } };
+    const cl::array<cl::size_type, 3> dst_origin = { { dst_offset % dst_row_pitch, dst_offset / dst_row_pitch, 0 } };
+    const cl::array<cl::size_type, 3> region     = { { src->info()->dimension(0) * src->info()->element_size(), src->info()->dimension(1), 1 } };
+
+    CLScheduler::get().queue().enqueueCopyBufferRect(src->cl_buffer(), dst->cl_buffer(), src_origin, dst_origin, region, src_row_pitch, 0, dst_row_pitch, 0);
+}
+} // namespace
+
 CLGaussianPyramid::CLGaussianPyramid()
     : _input(nullptr), _pyramid(nullptr), _tmp()
 {
@@ -104,12 +132,8 @@ void CLGaussianPyramidHalf::run()
     /* Get number of pyramid levels */
     const size_t num_levels = _pyramid->info()->num_levels();
 
-    /* The first level of the pyramid has the input image */
-    _pyramid->get_pyramid_level(0)->map(CLScheduler::get().queue(), true /* blocking */);
-    _input->map(CLScheduler::get().queue(), true /* blocking */);
-    _pyramid->get_pyramid_level(0)->copy_from(*_input);
-    _input->unmap(CLScheduler::get().queue());
-    _pyramid->get_pyramid_level(0)->unmap(CLScheduler::get().queue());
+    /* The first level of the pyramid has the input image: copied by the device so that the host never waits */
+    enqueue_copy(_input, _pyramid->get_pyramid_level(0));
 
     for(unsigned int i = 0; i < num_levels - 1; ++i)
     {
@@ -168,12 +192,8 @@ void CLGaussianPyramidOrb::run()
     /* Get number of pyramid levels */
     const size_t num_levels = _pyramid->info()->num_levels();
 
-    /* The first level of the pyramid has the input image */
-    _pyramid->get_pyramid_level(0)->map(CLScheduler::get().queue(), true /* blocking */);
-    _input->map(CLScheduler::get().queue(), true /* blocking */);
-    _pyramid->get_pyramid_level(0)->copy_from(*_input);
-    _input->unmap(CLScheduler::get().queue());
-    _pyramid->get_pyramid_level(0)->unmap(CLScheduler::get().queue());
+    /* The first level of the pyramid has the input image: copied by the device so that the host never waits */
+    enqueue_copy(_input, _pyramid->get_pyramid_level(0));
 
     for(unsigned int i = 0; i < num_levels - 1; ++i)
     {
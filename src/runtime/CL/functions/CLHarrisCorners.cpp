@@ -34,8 +34,8 @@
 #include "arm_compute/runtime/CL/functions/CLSobel3x3.h"
 #include "arm_compute/runtime/CL/functions/CLSobel5x5.h"
 #include "arm_compute/runtime/CL/functions/CLSobel7x7.h"
-#include "arm_compute/runtime/CPP/CPPScheduler.h"
 #include "arm_compute/runtime/ITensorAllocator.h"
+#include "arm_compute/runtime/Scheduler.h"
 
 #include <cmath>
 #include <utility>
@@ -44,7 +44,7 @@ using namespace arm_compute;
 
 CLHarrisCorners::CLHarrisCorners()
     : _sobel(), _harris_score(), _non_max_suppr(), _candidates(), _sort_euclidean(), _border_gx(), _border_gy(), _gx(), _gy(), _score(), _nonmax(), _corners_list(), _num_corner_candidates(0),
-      _corners(nullptr)
+      _corners(nullptr), _blocking(true), _pending_host_stages(false)
 {
 }
 
@@ -126,13 +126,15 @@ void CLHarrisCorners::configure(ICLImage *input, float threshold, float min_dist
     _nonmax.allocator()->allocate();
 }
 
+void CLHarrisCorners::set_blocking(bool blocking)
+{
+    _blocking = blocking;
+}
+
 void CLHarrisCorners::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr, "Unconfigured function");
 
-    // Init to 0 number of corner candidates
-    _num_corner_candidates = 0;
-
     // Run Sobel kernel
     _sobel->run();
 
@@ -146,9 +148,29 @@ void CLHarrisCorners::run()
     // Run non-maxima suppression
     CLScheduler::get().enqueue(_non_max_suppr);
 
+    _pending_host_stages = true;
+
+    if(_blocking)
+    {
+        sync_corners();
+    }
+}
+
+void CLHarrisCorners::sync_corners()
+{
+    if(!_pending_host_stages)
+    {
+        return;
+    }
+
+    _pending_host_stages = false;
+
+    // Init to 0 number of corner candidates
+    _num_corner_candidates = 0;
+
     // Run corner candidate kernel
     _nonmax.map(true);
-    CPPScheduler::get().multithread(&_candidates);
+    Scheduler::get().multithread(&_candidates);
     _nonmax.unmap();
 
     _corners->map(CLScheduler::get().queue(), true);
@@ -25,7 +25,6 @@
 #include "arm_compute/runtime/CL/functions/CLNormalizationLayer.h"
 
 #include "arm_compute/core/Error.h"
-#include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/CL/CLScheduler.h"
@@ -33,7 +32,7 @@
 using namespace arm_compute;
 
 CLNormalizationLayer::CLNormalizationLayer()
-    : _squared_input(), _norm_kernel(), _multiply_kernel(), _border_handler()
+    : _norm_kernel()
 {
 }
 
@@ -41,20 +40,11 @@ void CLNormalizationLayer::configure(const ICLTensor *input, ICLTensor *output,
 {
     ARM_COMPUTE_ERROR_ON(input == nullptr);
 
-    _squared_input.allocator()->init(TensorInfo(input->info()->tensor_shape(), 1, input->info()->data_type()));
-
-    _norm_kernel.configure(input, &_squared_input, output, norm_info);
-    _multiply_kernel.configure(input, input, &_squared_input, 1.0f, ConvertPolicy::SATURATE, RoundingPolicy::TO_NEAREST_EVEN);
-    // Fill the border by 3 elements since we need vload4 in the IN_MAP normalization kernel
-    _border_handler.configure(&_squared_input, _norm_kernel.border_size(), BorderMode::CONSTANT, PixelValue(0));
-
-    // Allocate intermediate buffers
-    _squared_input.allocator()->allocate();
+    // The kernel squares the input on the fly and handles the borders of the rows itself
+    _norm_kernel.configure(input, nullptr, output, norm_info);
 }
 
 void CLNormalizationLayer::run()
 {
-    CLScheduler::get().enqueue(_multiply_kernel, false);
-    CLScheduler::get().enqueue(_border_handler, false);
     CLScheduler::get().enqueue(_norm_kernel, false);
 }
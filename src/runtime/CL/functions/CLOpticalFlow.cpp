@@ -46,7 +46,7 @@ CLOpticalFlow::CLOpticalFlow()
 void CLOpticalFlow::configure(const CLPyramid *old_pyramid, const CLPyramid *new_pyramid,
                               const ICLKeyPointArray *old_points, const ICLKeyPointArray *new_points_estimates, ICLKeyPointArray *new_points,
                               Termination termination, float epsilon, size_t num_iterations, size_t window_dimension, bool use_initial_estimate,
-                              BorderMode border_mode, uint8_t constant_border_value)
+                              BorderMode border_mode, uint8_t constant_border_value, const cl::Buffer *num_points)
 {
     ARM_COMPUTE_ERROR_ON(nullptr == old_pyramid);
     ARM_COMPUTE_ERROR_ON(nullptr == new_pyramid);
@@ -57,7 +57,9 @@ void CLOpticalFlow::configure(const CLPyramid *old_pyramid, const CLPyramid *new
     ARM_COMPUTE_ERROR_ON(0 == old_pyramid->info()->num_levels());
     ARM_COMPUTE_ERROR_ON(old_pyramid->info()->width() != new_pyramid->info()->width());
     ARM_COMPUTE_ERROR_ON(old_pyramid->info()->height() != new_pyramid->info()->height());
-    ARM_COMPUTE_ERROR_ON(use_initial_estimate && old_points->num_values() != new_points_estimates->num_values());
+    ARM_COMPUTE_ERROR_ON(num_points == nullptr && use_initial_estimate && old_points->num_values() != new_points_estimates->num_values());
+    ARM_COMPUTE_ERROR_ON(num_points != nullptr && use_initial_estimate && old_points->max_num_values() > new_points_estimates->max_num_values());
+    ARM_COMPUTE_ERROR_ON(num_points != nullptr && old_points->max_num_values() > new_points->max_num_values());
 
     // Set member variables
     _old_points           = old_points;
@@ -66,7 +68,7 @@ void CLOpticalFlow::configure(const CLPyramid *old_pyramid, const CLPyramid *new
     _num_levels           = old_pyramid->info()->num_levels();
 
     const float pyr_scale              = old_pyramid->info()->scale();
-    const int   list_length            = old_points->num_values();
+    const int   list_length            = (num_points != nullptr) ? old_points->max_num_values() : old_points->num_values();
     const int   old_values_list_length = list_length * window_dimension * window_dimension;
 
     // Create kernels and tensors
@@ -107,16 +109,16 @@ void CLOpticalFlow::configure(const CLPyramid *old_pyramid, const CLPyramid *new
         _func_scharr[i].configure(old_ith_input, &_scharr_gx[i], &_scharr_gy[i], border_mode, constant_border_value);
 
         // Init Lucas-Kanade init kernel
-        _tracker_init_kernel[i].configure(old_points, new_points_estimates, _old_points_internal.get(), _new_points_internal.get(), use_initial_estimate, i, _num_levels, pyr_scale);
+        _tracker_init_kernel[i].configure(old_points, new_points_estimates, _old_points_internal.get(), _new_points_internal.get(), use_initial_estimate, i, _num_levels, pyr_scale, num_points);
 
         // Init Lucas-Kanade stage0 kernel
         _tracker_stage0_kernel[i].configure(old_ith_input, &_scharr_gx[i], &_scharr_gy[i],
                                             _old_points_internal.get(), _new_points_internal.get(), _coefficient_table.get(), _old_values.get(),
-                                            window_dimension, i);
+                                            window_dimension, i, num_points);
 
         // Init Lucas-Kanade stage1 kernel
         _tracker_stage1_kernel[i].configure(new_ith_input, _new_points_internal.get(), _coefficient_table.get(), _old_values.get(),
-                                            termination, epsilon, num_iterations, window_dimension, i);
+                                            termination, epsilon, num_iterations, window_dimension, i, num_points);
 
         // Allocate intermediate buffers
         _scharr_gx[i].allocator()->allocate();
@@ -124,7 +126,7 @@ void CLOpticalFlow::configure(const CLPyramid *old_pyramid, const CLPyramid *new
     }
 
     // Finalize Lucas-Kanade
-    _tracker_finalize_kernel.configure(_new_points_internal.get(), new_points);
+    _tracker_finalize_kernel.configure(_new_points_internal.get(), new_points, num_points);
 }
 
 void CLOpticalFlow::run()
@@ -24,6 +24,7 @@
 #include "arm_compute/runtime/CL/functions/CLRemap.h"
 
 #include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
 #include "arm_compute/core/CL/kernels/CLRemapKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
@@ -43,8 +44,11 @@ void CLRemap::configure(ICLTensor *input, const ICLTensor *map_x, const ICLTenso
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(map_y, 1, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MSG(policy == InterpolationPolicy::AREA, "Area interpolation is not supported");
 
+    // Let the texture sampler interpolate if the device supports U8 images
+    const bool use_image = (policy == InterpolationPolicy::BILINEAR) && CLCopyToImageKernel::is_supported(*input->info(), BorderSize(1));
+
     auto k = arm_compute::cpp14::make_unique<CLRemapKernel>();
-    k->configure(input, map_x, map_y, output, policy, border_mode == BorderMode::UNDEFINED);
+    k->configure(input, map_x, map_y, output, policy, border_mode == BorderMode::UNDEFINED, use_image);
     _kernel = std::move(k);
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
@@ -24,22 +24,49 @@
 #include "arm_compute/runtime/CL/functions/CLScale.h"
 
 #include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
+#include "arm_compute/core/CL/kernels/CLScaleAreaKernel.h"
 #include "arm_compute/core/CL/kernels/CLScaleKernel.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Validate.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 
 void CLScale::configure(ICLTensor *input, ICLTensor *output, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value)
 {
     ARM_COMPUTE_ERROR_ON(output == input);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::S16);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::S16);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
 
-    auto k = arm_compute::cpp14::make_unique<CLScaleKernel>();
-    k->configure(input, output, policy, border_mode == BorderMode::UNDEFINED);
-    _kernel = std::move(k);
-    _border_handler.configure(input, _kernel->border_size(), border_mode, constant_border_value);
+    const bool multi_channel = input->info()->num_channels() != 1;
+    const bool downscale = (input->info()->dimension(0) >= output->info()->dimension(0)) && (input->info()->dimension(1) >= output->info()->dimension(1));
+
+    // Area down-sampling anti-aliases and downscales in a single pass, from the input pixels only
+    if(policy == InterpolationPolicy::AREA && downscale && input->info()->data_type() == DataType::U8 && !multi_channel)
+    {
+        auto k = arm_compute::cpp14::make_unique<CLScaleAreaKernel>();
+        k->configure(input, output);
+        _kernel = std::move(k);
+    }
+    else
+    {
+        // Let the texture sampler interpolate if the device supports U8 images
+        const bool use_image = (policy == InterpolationPolicy::BILINEAR) && CLCopyToImageKernel::is_supported(*input->info(), BorderSize(1));
+
+        auto k = arm_compute::cpp14::make_unique<CLScaleKernel>();
+        k->configure(input, output, policy, border_mode == BorderMode::UNDEFINED, use_image);
+        _kernel = std::move(k);
+    }
+
+    // The constant border value is used for all the channels of multi-channel images
+    PixelValue border_value(constant_border_value);
+    if(multi_channel)
+    {
+        std::fill_n(border_value.value.rgbx, 4, constant_border_value);
+    }
+
+    _border_handler.configure(input, _kernel->border_size(), border_mode, border_value);
 }
@@ -23,6 +23,8 @@
  */
 #include "arm_compute/runtime/CL/functions/CLWarpAffine.h"
 
+#include "arm_compute/core/CL/ICLTensor.h"
+#include "arm_compute/core/CL/kernels/CLCopyToImageKernel.h"
 #include "arm_compute/core/CL/kernels/CLWarpAffineKernel.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/PixelValue.h"
@@ -33,8 +35,11 @@ using namespace arm_compute;
 
 void CLWarpAffine::configure(ICLTensor *input, ICLTensor *output, const float *matrix, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value)
 {
+    // Let the texture sampler interpolate if the device supports U8 images
+    const bool use_image = (policy == InterpolationPolicy::BILINEAR) && CLCopyToImageKernel::is_supported(*input->info(), BorderSize(1));
+
     auto k = arm_compute::cpp14::make_unique<CLWarpAffineKernel>();
-    k->configure(input, output, matrix, policy);
+    k->configure(input, output, matrix, policy, use_image);
     _kernel = std::move(k);
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
@@ -27,22 +27,703 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/AllocationTracer.h"
+#include "arm_compute/runtime/CPUTopology.h"
+#include "arm_compute/runtime/Profiler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tracer.h"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <fstream>
+#include <future>
 #include <iostream>
+#include <mutex>
+#include <sched.h>
 #include <semaphore.h>
+#include <string>
 #include <system_error>
 #include <thread>
+#include <typeindex>
+#include <typeinfo>
+#include <unordered_map>
+#include <vector>
 
 using namespace arm_compute;
 
+namespace
+{
+/** Number of inferences over which the latency is averaged before the adaptive mode updates the number of threads */
+constexpr int adaptation_period = 8;
+
+/** Fraction of the target latency the estimated latency with one thread fewer must stay under to remove a thread, when the device is not hot */
+constexpr double shed_margin = 0.9;
+
+/** Read the temperature of the hottest thermal zone of the device
+ *
+ * @return The temperature in degrees Celsius, 0 if no thermal zone could be read.
+ */
+float max_thermal_zone_temperature()
+{
+    float max_temperature = 0.f;
+
+    for(unsigned int zone = 0;; ++zone)
+    {
+        std::ifstream file("/sys/class/thermal/thermal_zone" + std::to_string(zone) + "/temp");
+        if(!file)
+        {
+            break;
+        }
+
+        // The temperatures are in millidegrees Celsius
+        int temperature = 0;
+        if(file >> temperature)
+        {
+            max_temperature = std::max(max_temperature, temperature / 1000.f);
+        }
+    }
+
+    return max_temperature;
+}
+
+/** Number of sub-windows per thread the window of a @ref SchedulingPolicy::DYNAMIC kernel is split in */
+constexpr int num_chunks_per_thread = 4;
+
+/** Minimum number of iterations per thread along the split dimension under which it gets collapsed with an outer dimension */
+constexpr int min_iterations_per_thread = 4;
+
+/** Number of kernels whose splits are recorded above which the records are cleared (See @ref CPPScheduler::set_record_splits()) */
+constexpr size_t max_split_records = 1024;
+
+/** Select the dimension to collapse with the split dimension when the latter doesn't have enough iterations to keep all the threads busy
+ *
+ * @param[in] window          Window to split.
+ * @param[in] split_dimension Dimension along which the window is split.
+ * @param[in] num_threads     Number of threads available.
+ *
+ * @return The outer dimension with the largest number of iterations, or @p split_dimension if there is no need to (or nothing to) collapse.
+ */
+size_t select_outer_dimension(const Window &window, size_t split_dimension, int num_threads)
+{
+    size_t outer_dimension = split_dimension;
+
+    if(window.num_iterations(split_dimension) < static_cast<size_t>(num_threads * min_iterations_per_thread))
+    {
+        size_t max_iterations = 1;
+
+        for(size_t d = split_dimension + 1; d < Coordinates::num_max_dimensions; ++d)
+        {
+            if(window.num_iterations(d) > max_iterations)
+            {
+                max_iterations  = window.num_iterations(d);
+                outer_dimension = d;
+            }
+        }
+    }
+
+    return outer_dimension;
+}
+
+/** Split of a window among the threads, as computed by @ref plan_split() */
+struct SplitPlan
+{
+    int    parts_x;         /**< Number of parts along X of the grid the window is split in, 1 if the window is only split along the split dimension */
+    size_t outer_dimension; /**< Dimension collapsed with the split dimension into a single iteration space, equal to the split dimension if none */
+    int    num_threads;     /**< Number of threads to run the kernel on */
+    int    num_chunks;      /**< Number of sub-windows the window is split in, 0 for @ref SchedulingPolicy::STATIC */
+};
+
+/** Compute how to split the window of a kernel among the threads
+ *
+ * @param[in] kernel          Kernel to run.
+ * @param[in] window          Window to split.
+ * @param[in] split_dimension Dimension along which to split the window.
+ * @param[in] max_threads     Maximum number of threads the kernel can run on.
+ * @param[in] pool_size       Number of threads of the pool.
+ *
+ * @return The split of the window.
+ */
+SplitPlan plan_split(const ICPPKernel &kernel, const Window &window, size_t split_dimension, int max_threads, int pool_size)
+{
+    const bool is_dynamic = kernel.scheduling_policy() == SchedulingPolicy::DYNAMIC;
+
+    // The kernel can ask for its window to be split in a 2D grid, or to only be split along the split dimension, in which case the split dimension is never collapsed
+    const int  max_parts      = is_dynamic ? max_threads * num_chunks_per_thread : max_threads;
+    const int  parts_x        = (split_dimension != Window::DimX) ? std::min<int>(kernel.split_parts_x(max_parts), window.num_iterations(Window::DimX)) : 1;
+    const bool is_collapsible = parts_x == 1 && kernel.is_split_dimension_collapsible();
+
+    const size_t outer_dimension = is_collapsible ? select_outer_dimension(window, split_dimension, pool_size) : split_dimension;
+    int          num_iterations  = window.num_iterations(split_dimension);
+
+    // Collapse the split dimension with the outer one if there are not enough iterations to keep all the threads busy
+    if(outer_dimension != split_dimension)
+    {
+        num_iterations *= window.num_iterations(outer_dimension);
+    }
+
+    // Number of cells of the grid along X and along the split dimension
+    const int parts_y     = (parts_x > 1) ? std::min(num_iterations, max_parts / parts_x) : num_iterations;
+    const int num_threads = std::min(parts_x * parts_y, max_threads);
+    const int num_chunks  = is_dynamic ? ((parts_x > 1) ? parts_x * parts_y : std::min(num_iterations, num_threads * num_chunks_per_thread)) : 0;
+
+    return SplitPlan{ parts_x, outer_dimension, num_threads, num_chunks };
+}
+
+/** Number of threads which runs a kernel the fastest according to its cost (See @ref CPPScheduler::set_cost_model())
+ *
+ * @param[in] cost        Estimated work of the kernel, all zeros if unknown.
+ * @param[in] cost_model  Costs of the device.
+ * @param[in] max_threads Maximum number of threads the kernel can run on.
+ *
+ * @return The number of threads between 1 and @p max_threads
+ */
+int threads_for_cost(const KernelCost &cost, const CPPScheduler::CostModel &cost_model, int max_threads)
+{
+    if((cost.bytes == 0 && cost.ops == 0) || cost_model.ns_per_thread <= 0.f)
+    {
+        return max_threads;
+    }
+
+    // Minimum of work / t + (t - 1) * ns_per_thread
+    const double work        = cost.bytes * static_cast<double>(cost_model.ns_per_byte) + cost.ops * static_cast<double>(cost_model.ns_per_op);
+    const int    num_threads = static_cast<int>(std::lround(std::sqrt(work / cost_model.ns_per_thread)));
+
+    return std::max(1, std::min(num_threads, max_threads));
+}
+
+/** Kernel which does nothing, run by @ref CPPScheduler::calibrate_cost_model() to time the start and join of the threads */
+class EmptyKernel : public ICPPKernel
+{
+public:
+    /** Constructor
+     *
+     * @param[in] num_iterations Number of iterations of the window along Y, one per thread.
+     */
+    explicit EmptyKernel(int num_iterations)
+    {
+        Window window;
+        window.set(Window::DimY, Window::Dimension(0, num_iterations, 1));
+        ICPPKernel::configure(window);
+    }
+
+    // Inherited methods overridden:
+    void run(const Window &window) override
+    {
+        ARM_COMPUTE_UNUSED(window);
+    }
+};
+} // namespace
+
 #ifdef NO_MULTI_THREADING
 namespace
 {
 void delete_threads(Thread *t)
 {
 }
+void delete_sync(JobSync *s)
+{
+}
+void delete_split_records(SplitRecords *r)
+{
+}
+void delete_async_queue(AsyncQueue *q)
+{
+}
 }
 #else  /* NO_MULTI_THREADING */
+namespace
+{
+/** Hint to the CPU that the thread is busy-waiting */
+inline void cpu_relax()
+{
+#if defined(__arm__) || defined(__aarch64__)
+    __asm__ __volatile__("yield");
+#endif /* defined(__arm__) || defined(__aarch64__) */
+}
+
+/** Wait until a condition becomes true: poll it @p spin_count times then sleep on a semaphore.
+ *
+ * The thread which makes the condition true must call @ref notify() with the same flag and semaphore.
+ *
+ * @param[in]     done        Condition to wait for.
+ * @param[in,out] is_sleeping Flag set while the waiting thread might be blocked on @p wakeup.
+ * @param[in,out] wakeup      Semaphore the waiting thread sleeps on.
+ * @param[in]     spin_count  Number of times to poll the condition before going to sleep.
+ */
+template <typename Condition>
+void spin_then_wait(Condition &&done, std::atomic<bool> &is_sleeping, sem_t &wakeup, unsigned int spin_count)
+{
+    unsigned int spins = 0;
+
+    while(!done())
+    {
+        if(spins < spin_count)
+        {
+            ++spins;
+            cpu_relax();
+            continue;
+        }
+
+        is_sleeping.store(true);
+
+        // Store-load handshake with notify(): the fence orders the store of the flag before the load of the condition,
+        // so that either this thread sees the condition or the notifier sees the flag (Otherwise the wakeup could be lost)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Check the condition again in case it became true before the notifier could see the flag
+        if(done())
+        {
+            // If the notifier has already cleared the flag a post is in flight: consume it to keep the semaphore balanced
+            if(!is_sleeping.exchange(false))
+            {
+                sem_wait(&wakeup);
+            }
+            return;
+        }
+
+        sem_wait(&wakeup);
+    }
+}
+
+/** Pin the calling thread to a core
+ *
+ * @note Failures (e.g. the core is not allowed by the cpuset of the process) are silently ignored: the thread keeps its current affinity.
+ *
+ * @param[in] core Id of the core to pin the thread to, or -1 to allow the thread to run on any core.
+ */
+void set_thread_affinity(int core)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+
+    if(core < 0)
+    {
+        for(int i = 0; i < CPU_SETSIZE; ++i)
+        {
+            CPU_SET(i, &set);
+        }
+    }
+    else
+    {
+        CPU_SET(core, &set);
+    }
+
+    sched_setaffinity(0, sizeof(set), &set);
+}
+
+/** Wake up a thread blocked in @ref spin_then_wait(), if any.
+ *
+ * @param[in,out] is_sleeping Flag set while the waiting thread might be blocked on @p wakeup.
+ * @param[in,out] wakeup      Semaphore the waiting thread sleeps on.
+ */
+void notify(std::atomic<bool> &is_sleeping, sem_t &wakeup)
+{
+    // Pairs with the fence of spin_then_wait(): orders the store making the condition true before the load of the flag
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    if(is_sleeping.exchange(false))
+    {
+        int ret = sem_post(&wakeup);
+        ARM_COMPUTE_UNUSED(ret);
+        ARM_COMPUTE_ERROR_ON(ret < 0);
+    }
+}
+} // namespace
+
+/** Completion state of the kernel currently executed by the worker threads */
+struct arm_compute::JobSync
+{
+    /** Constructor */
+    JobSync();
+    JobSync(const JobSync &) = delete;
+    JobSync &operator=(const JobSync &) = delete;
+    /** Destructor */
+    ~JobSync();
+
+    std::atomic<int>  num_pending;      /**< Number of workers which haven't completed their part of the kernel yet */
+    std::atomic<bool> is_sleeping;      /**< True while the caller might be blocked on @ref wakeup */
+    sem_t             wakeup;           /**< Semaphore the caller sleeps on while waiting for the workers */
+    std::atomic<int>  next_chunk;       /**< Index of the next sub-window to run (@ref SchedulingPolicy::DYNAMIC only) */
+    int               num_chunks;       /**< Number of sub-windows the window is split in, 0 for @ref SchedulingPolicy::STATIC */
+    size_t            split_dimension;  /**< Dimension along which the window is split */
+    size_t            outer_dimension;  /**< Dimension collapsed with @ref split_dimension into a single iteration space, equal to @ref split_dimension if none */
+    int               parts_x;          /**< Number of parts along X of the grid the window is split in, 1 if the window is only split along @ref split_dimension */
+    ProfilerInterval *thread_times;     /**< Where each thread stores the time it spent running the kernel when profiling, nullptr otherwise */
+    ProfilerCounters *thread_counters;  /**< Where each thread stores its hardware counters when the profiler reads them, nullptr otherwise */
+    const Window     *part_windows;     /**< Recorded sub-windows run by the threads (@ref SchedulingPolicy::STATIC only), nullptr if the threads split their window themselves */
+    const int        *part_offsets;     /**< Index in @ref part_windows of the first sub-window of each thread, followed by the number of sub-windows */
+    const char       *allocation_scope; /**< Allocation scope active on the calling thread, begun by the workers while they run the kernel (See @ref AllocationTracer) */
+};
+
+JobSync::JobSync()
+    : num_pending(0), is_sleeping(false), wakeup(), next_chunk(0), num_chunks(0), split_dimension(Window::DimY), outer_dimension(Window::DimY), parts_x(1), thread_times(nullptr), thread_counters(nullptr),
+      part_windows(nullptr), part_offsets(nullptr), allocation_scope(nullptr)
+{
+    int ret = sem_init(&wakeup, 0, 0);
+    ARM_COMPUTE_ERROR_ON(ret < 0);
+    ARM_COMPUTE_UNUSED(ret);
+}
+
+JobSync::~JobSync()
+{
+    int ret = sem_destroy(&wakeup);
+    ARM_COMPUTE_ERROR_ON(ret < 0);
+    ARM_COMPUTE_UNUSED(ret);
+}
+
+namespace
+{
+/** Compute the sub-windows making the part of the iteration space of a window assigned to one thread
+ *
+ * If the window is split in a 2D grid, the part is the cell @p id of the grid, the cells being numbered along X first.
+ * If the split dimension is collapsed with an outer dimension, the part is made of at most three sub-windows: the end of a row,
+ * a block of full rows and the beginning of a row, where a row is the range of the split dimension for one index of the outer dimension.
+ *
+ * @param[in] max_window      Window to split. Its thread id and number of threads are forwarded to the sub-windows.
+ * @param[in] split_dimension Dimension along which the window is split.
+ * @param[in] outer_dimension Dimension collapsed with @p split_dimension, equal to @p split_dimension if none.
+ * @param[in] parts_x         Number of parts along X of the grid the window is split in, 1 if the window is only split along @p split_dimension.
+ * @param[in] id              Id of the part.
+ * @param[in] total           Total number of parts the window is split in.
+ * @param[in] func            Function called on each sub-window of the part.
+ */
+template <typename Func>
+void for_each_part_window(const Window &max_window, size_t split_dimension, size_t outer_dimension, int parts_x, int id, int total, Func &&func)
+{
+    if(outer_dimension == split_dimension)
+    {
+        Window win = (parts_x > 1) ? max_window.split_window(Window::DimX, id % parts_x, parts_x).split_window(split_dimension, id / parts_x, total / parts_x) :
+                     max_window.split_window(split_dimension, id, total);
+        win.set_thread_id(max_window.thread_id());
+        win.set_num_threads(max_window.num_threads());
+
+        func(win);
+        return;
+    }
+
+    const Window::Dimension &inner     = max_window[split_dimension];
+    const Window::Dimension &outer     = max_window[outer_dimension];
+    const int                num_inner = max_window.num_iterations(split_dimension);
+    const int                num_total = num_inner * max_window.num_iterations(outer_dimension);
+    int                      first     = id * num_total / total;
+    const int                last      = (id + 1) * num_total / total;
+
+    while(first < last)
+    {
+        const int o = first / num_inner;
+        const int i = first % num_inner;
+
+        Window win = max_window;
+
+        if(i != 0 || (last - first) < num_inner)
+        {
+            // Part of a single row
+            const int end = std::min(num_inner, i + last - first);
+            win.set(split_dimension, Window::Dimension(inner.start() + i * inner.step(), inner.start() + end * inner.step(), inner.step()));
+            win.set(outer_dimension, Window::Dimension(outer.start() + o * outer.step(), outer.start() + (o + 1) * outer.step(), outer.step()));
+            first += end - i;
+        }
+        else
+        {
+            // Block of full rows
+            const int num_rows = (last - first) / num_inner;
+            win.set(outer_dimension, Window::Dimension(outer.start() + o * outer.step(), outer.start() + (o + num_rows) * outer.step(), outer.step()));
+            first += num_rows * num_inner;
+        }
+
+        func(win);
+    }
+}
+
+/** Run the part of the iteration space of a window assigned to one thread (See @ref for_each_part_window())
+ *
+ * @param[in] kernel     Kernel to run.
+ * @param[in] max_window Window to split. Its thread id and number of threads are forwarded to the sub-windows.
+ * @param[in] sync       State of the job, used to retrieve the split and outer dimensions and the shape of the grid.
+ * @param[in] id         Id of the part to run.
+ * @param[in] total      Total number of parts the window is split in.
+ */
+void run_part(ICPPKernel *kernel, const Window &max_window, const JobSync &sync, int id, int total)
+{
+    for_each_part_window(max_window, sync.split_dimension, sync.outer_dimension, sync.parts_x, id, total, [&](const Window & win)
+    {
+        win.validate_on_run();
+        kernel->run(win);
+    });
+}
+
+/** Run the part of a kernel assigned to one thread
+ *
+ * @param[in]     kernel Kernel to run.
+ * @param[in]     window Window of the thread: a sub-window if the window could be split beforehand, the whole window of the kernel otherwise.
+ * @param[in,out] sync   State of the job: for @ref SchedulingPolicy::DYNAMIC kernels the index of the next sub-window is incremented.
+ */
+void run_job(ICPPKernel *kernel, const Window &window, JobSync &sync)
+{
+    const double           start          = sync.thread_times != nullptr ? Profiler::get().now() : 0.0;
+    const ProfilerCounters start_counters = sync.thread_counters != nullptr ? Profiler::thread_counters() : ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+
+    // The allocations made on behalf of the caller are counted in its scope whichever thread makes them
+    const AllocationScope allocation_scope(sync.allocation_scope, sync.allocation_scope != nullptr && AllocationTracer::current_scope() != sync.allocation_scope);
+
+    if(sync.num_chunks > 0)
+    {
+        // Run sub-windows until there is none left
+        for(int chunk = sync.next_chunk.fetch_add(1, std::memory_order_relaxed); chunk < sync.num_chunks; chunk = sync.next_chunk.fetch_add(1, std::memory_order_relaxed))
+        {
+            run_part(kernel, window, sync, chunk, sync.num_chunks);
+        }
+    }
+    else if(sync.part_windows != nullptr)
+    {
+        // Replay the sub-windows recorded for this thread, which were validated when recorded
+        for(int part = sync.part_offsets[window.thread_id()]; part < sync.part_offsets[window.thread_id() + 1]; ++part)
+        {
+            kernel->run(sync.part_windows[part]);
+        }
+    }
+    else if(sync.outer_dimension != sync.split_dimension || sync.parts_x > 1)
+    {
+        run_part(kernel, window, sync, window.thread_id(), window.num_threads());
+    }
+    else
+    {
+        window.validate_on_run();
+        kernel->run(window);
+    }
+
+    if(sync.thread_times != nullptr)
+    {
+        sync.thread_times[window.thread_id()] = ProfilerInterval{ start, Profiler::get().now() };
+    }
+    if(sync.thread_counters != nullptr)
+    {
+        sync.thread_counters[window.thread_id()] = Profiler::thread_counters() - start_counters;
+    }
+}
+
+/** Wait until all the workers are done with the job they were started on
+ *
+ * @param[in,out] sync       State of the job.
+ * @param[in]     spin_count Number of times to poll the countdown before going to sleep.
+ */
+void wait_for_workers(JobSync &sync, unsigned int spin_count)
+{
+    spin_then_wait([&]()
+    {
+        return sync.num_pending.load(std::memory_order_acquire) == 0;
+    },
+    sync.is_sleeping, sync.wakeup, spin_count);
+}
+
+/** Run the share of the calling thread once the workers have been started
+ *
+ * If the share throws, the workers are waited for before the exception is propagated: they refer to the job,
+ * their windows and the profiling buffers, which the caller might release while unwinding.
+ *
+ * @param[in]     kernel     Kernel to run.
+ * @param[in]     window     Window of the calling thread.
+ * @param[in,out] sync       State of the job.
+ * @param[in]     spin_count Number of times to poll the countdown of the workers before going to sleep.
+ */
+void run_caller_job(ICPPKernel *kernel, const Window &window, JobSync &sync, unsigned int spin_count)
+{
+    try
+    {
+        run_job(kernel, window, sync);
+    }
+    catch(...)
+    {
+        wait_for_workers(sync, spin_count);
+        throw;
+    }
+}
+
+/** Check whether two windows have the same dimensions
+ *
+ * @param[in] a First window.
+ * @param[in] b Second window.
+ *
+ * @return True if the start, end and step of every dimension are the same.
+ */
+bool is_same_window(const Window &a, const Window &b)
+{
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if(a[d].start() != b[d].start() || a[d].end() != b[d].end() || a[d].step() != b[d].step())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** Split of the window of a kernel among the threads, kept to be replayed by the next runs of the kernel */
+struct SplitRecord
+{
+    /** Default constructor: nothing is recorded */
+    SplitRecord()
+        : configuration_id(0), window(), split_dimension(Window::DimY), max_threads(0), scheduling_policy(SchedulingPolicy::STATIC), split_parts_x(1), plan{ 1, Window::DimY, 1, 0 }, thread_windows(),
+          part_windows(), part_offsets()
+    {
+    }
+
+    uint64_t            configuration_id;  /**< Configuration of the kernel whose window was split (See @ref IKernel::configuration_id()) */
+    Window              window;            /**< Window which was split */
+    size_t              split_dimension;   /**< Dimension along which the window was split */
+    int                 max_threads;       /**< Maximum number of threads the kernel could run on, 0 if nothing is recorded */
+    SchedulingPolicy    scheduling_policy; /**< Scheduling policy of the kernel when its window was split */
+    unsigned int        split_parts_x;     /**< Number of parts along X the kernel asked for when its window was split */
+    SplitPlan           plan;              /**< How the window is split */
+    std::vector<Window> thread_windows;    /**< Window passed to each thread */
+    std::vector<Window> part_windows;      /**< Sub-windows run by each thread, empty if the threads split their window themselves */
+    std::vector<int>    part_offsets;      /**< Index in @ref part_windows of the first sub-window of each thread, followed by the number of sub-windows */
+};
+
+/** Compute the window of each thread and, if requested, the sub-windows each thread runs
+ *
+ * @param[in,out] record          Record holding the split of the window. Its windows are overwritten.
+ * @param[in]     window          Window to split.
+ * @param[in]     split_dimension Dimension along which to split the window.
+ * @param[in]     is_dynamic      True if the kernel uses @ref SchedulingPolicy::DYNAMIC, in which case the threads pull their sub-windows at run time.
+ * @param[in]     record_parts    True to compute and validate the sub-windows of each thread once for all.
+ */
+void split_threads(SplitRecord &record, const Window &window, size_t split_dimension, bool is_dynamic, bool record_parts)
+{
+    const SplitPlan &plan = record.plan;
+
+    // With the dynamic policy every thread gets the whole window and pulls its sub-windows from the shared queue.
+    // The same goes for collapsed dimensions and 2D grids: each thread computes its own part of the iteration space.
+    const bool is_split = !is_dynamic && plan.outer_dimension == split_dimension && plan.parts_x == 1;
+
+    record.thread_windows.resize(plan.num_threads);
+    record.part_windows.clear();
+    record.part_offsets.clear();
+
+    for(int t = 0; t < plan.num_threads; ++t)
+    {
+        Window &win = record.thread_windows[t];
+        win         = is_split ? window.split_window(split_dimension, t, plan.num_threads) : window;
+        win.set_thread_id(t);
+        win.set_num_threads(plan.num_threads);
+
+        if(record_parts && !is_dynamic)
+        {
+            record.part_offsets.push_back(record.part_windows.size());
+
+            const auto add_part = [&](const Window & part)
+            {
+                part.validate_on_run();
+                record.part_windows.push_back(part);
+            };
+
+            if(is_split)
+            {
+                add_part(win);
+            }
+            else
+            {
+                for_each_part_window(win, split_dimension, plan.outer_dimension, plan.parts_x, t, plan.num_threads, add_part);
+            }
+        }
+    }
+
+    if(!record.part_offsets.empty())
+    {
+        record.part_offsets.push_back(record.part_windows.size());
+    }
+}
+} // namespace
+
+/** Splits of the windows of the kernels run by a @ref CPPScheduler */
+struct arm_compute::SplitRecords
+{
+    /** Default constructor */
+    SplitRecords()
+        : records(), current(), independent_windows()
+    {
+    }
+
+    std::unordered_map<const ICPPKernel *, SplitRecord> records;             /**< Split recorded for each kernel (See @ref CPPScheduler::set_record_splits()) */
+    SplitRecord                                         current;             /**< Split of the kernel being run when the splits are not recorded */
+    std::vector<Window>                                 independent_windows; /**< Windows of the threads running independent kernels, kept to not allocate them on every call */
+};
+
+namespace
+{
+/** Number of parts the window of an independent kernel is split in
+ *
+ * @param[in] k           Kernel and its split dimension.
+ * @param[in] num_threads Number of threads running the kernels.
+ *
+ * @return The number of parts, 0 if the kernel runs whole on a single thread.
+ */
+int num_independent_parts(const IScheduler::IndependentKernel &k, int num_threads)
+{
+    if(k.split_dimension == IScheduler::no_split || !k.kernel->is_parallelisable())
+    {
+        return 0;
+    }
+    return std::max(1, std::min<int>(num_threads, k.kernel->window().num_iterations(k.split_dimension)));
+}
+
+/** Kernel running the parts of several independent kernels assigned to a thread, so that the threads only join once for all of them
+ *
+ * The thread t runs the part t of each kernel whose window is split in more than t parts. The kernels which run whole are distributed
+ * round robin, starting from the last thread which is the caller.
+ */
+class IndependentKernelsJob final : public ICPPKernel
+{
+public:
+    /** Constructor
+     *
+     * @param[in] kernels     Kernels to run. They must outlive the job.
+     * @param[in] num_threads Number of threads running the job.
+     */
+    IndependentKernelsJob(const std::vector<IScheduler::IndependentKernel> &kernels, int num_threads)
+        : _kernels(kernels), _num_threads(num_threads)
+    {
+    }
+
+    void run(const Window &window) override
+    {
+        const int thread_id  = window.thread_id();
+        int       num_wholes = 0;
+
+        for(const auto &k : _kernels)
+        {
+            const int num_parts = num_independent_parts(k, _num_threads);
+
+            if(num_parts == 0)
+            {
+                if(_num_threads - 1 - (num_wholes++ % _num_threads) == thread_id)
+                {
+                    k.kernel->run(k.kernel->window());
+                }
+            }
+            else if(thread_id < num_parts)
+            {
+                Window win = k.kernel->window().split_window(k.split_dimension, thread_id, num_parts);
+                win.set_thread_id(thread_id);
+                win.set_num_threads(num_parts);
+                win.validate_on_run();
+
+                k.kernel->run(win);
+            }
+        }
+    }
+
+private:
+    const std::vector<IScheduler::IndependentKernel> &_kernels;
+    const int                                         _num_threads;
+};
+} // namespace
+
 class arm_compute::Thread
 {
 public:
@@ -56,184 +737,849 @@ public:
     /** Make the thread join
      */
     ~Thread();
+    /** Set the number of times the worker polls for new work before going to sleep
+     */
+    void set_spin_count(unsigned int spin_count);
+    /** Set the core the worker is pinned to. The worker applies it before running its next kernel
+     */
+    void set_affinity(int core);
     /** Request the worker thread to start executing the given kernel
      * This function will return as soon as the kernel has been sent to the worker thread.
-     * wait() needs to be called to ensure the execution is complete.
+     * The worker decrements the pending count of @p sync once the execution is complete.
      */
-    void start(ICPPKernel *kernel, const Window &window);
-    /** Wait for the current kernel execution to complete
+    void start(ICPPKernel *kernel, const Window *window, JobSync *sync);
+    /** Rethrow the exception raised by the last kernel execution, if any
      */
-    void wait();
+    void rethrow_exception() const;
     /** Function ran by the worker thread
      */
     void worker_thread();
 
-private:
-    std::thread        _thread;
-    ICPPKernel        *_kernel{ nullptr };
-    Window             _window;
-    sem_t              _wait_for_work;
-    sem_t              _job_complete;
-    std::exception_ptr _current_exception;
-};
+private:
+    std::thread               _thread;
+    ICPPKernel               *_kernel{ nullptr };
+    const Window             *_window{ nullptr };
+    JobSync                  *_sync{ nullptr };
+    std::atomic<unsigned int> _epoch;
+    std::atomic<unsigned int> _spin_count;
+    std::atomic<int>          _affinity;
+    std::atomic<bool>         _is_sleeping;
+    sem_t                     _wait_for_work;
+    std::exception_ptr        _current_exception;
+};
+
+Thread::Thread()
+    : _thread(), _epoch(0), _spin_count(0), _affinity(-1), _is_sleeping(false), _wait_for_work(), _current_exception(nullptr)
+{
+    int ret = sem_init(&_wait_for_work, 0, 0);
+    ARM_COMPUTE_ERROR_ON(ret < 0);
+    ARM_COMPUTE_UNUSED(ret);
+
+    _thread = std::thread(&Thread::worker_thread, this);
+}
+
+Thread::~Thread()
+{
+    ARM_COMPUTE_ERROR_ON(!_thread.joinable());
+
+    start(nullptr, nullptr, nullptr);
+    _thread.join();
+
+    int ret = sem_destroy(&_wait_for_work);
+    ARM_COMPUTE_ERROR_ON(ret < 0);
+    ARM_COMPUTE_UNUSED(ret);
+}
+
+void Thread::set_spin_count(unsigned int spin_count)
+{
+    _spin_count.store(spin_count, std::memory_order_relaxed);
+}
+
+void Thread::set_affinity(int core)
+{
+    _affinity.store(core, std::memory_order_relaxed);
+}
+
+void Thread::start(ICPPKernel *kernel, const Window *window, JobSync *sync)
+{
+    _kernel = kernel;
+    _window = window;
+    _sync   = sync;
+
+    // Publish the job: the worker either sees the new epoch while spinning or is woken up
+    _epoch.fetch_add(1);
+    notify(_is_sleeping, _wait_for_work);
+}
+
+void Thread::rethrow_exception() const
+{
+    if(_current_exception)
+    {
+        std::rethrow_exception(_current_exception);
+    }
+}
+
+void Thread::worker_thread()
+{
+    unsigned int last_epoch       = 0;
+    int          current_affinity = -1;
+
+    while(true)
+    {
+        spin_then_wait([&]()
+        {
+            return _epoch.load(std::memory_order_acquire) != last_epoch;
+        },
+        _is_sleeping, _wait_for_work, _spin_count.load(std::memory_order_relaxed));
+
+        ++last_epoch;
+
+        const int affinity = _affinity.load(std::memory_order_relaxed);
+        if(affinity != current_affinity)
+        {
+            set_thread_affinity(affinity);
+            current_affinity = affinity;
+        }
+
+        _current_exception = nullptr;
+        // Time to exit
+        if(_kernel == nullptr)
+        {
+            return;
+        }
+
+        try
+        {
+            ARM_COMPUTE_TRACE_KERNEL(*_kernel);
+            run_job(_kernel, *_window, *_sync);
+        }
+        catch(...)
+        {
+            _current_exception = std::current_exception();
+        }
+
+        // The last worker to complete wakes up the caller
+        JobSync *sync = _sync;
+        if(sync->num_pending.fetch_sub(1, std::memory_order_acq_rel) == 1)
+        {
+            notify(sync->is_sleeping, sync->wakeup);
+        }
+    }
+}
+
+/** Thread running the works submitted with @ref CPPScheduler::run_async(), one after the other */
+class arm_compute::AsyncQueue
+{
+public:
+    /** Start the thread
+     */
+    explicit AsyncQueue(IScheduler *scheduler);
+    AsyncQueue(const AsyncQueue &) = delete;
+    AsyncQueue &operator=(const AsyncQueue &) = delete;
+    /** Run the pending works then make the thread join
+     */
+    ~AsyncQueue();
+    /** Set the core the thread is pinned to. The thread applies it before running its next work
+     */
+    void set_affinity(int core);
+    /** Queue a work and return as soon as it is queued
+     */
+    RunHandle push(std::function<void()> work);
+    /** Function ran by the thread
+     */
+    void worker_thread();
+
+private:
+    IScheduler                            *_scheduler;
+    std::deque<std::packaged_task<void()>> _works;
+    std::mutex                             _mutex;
+    std::condition_variable                _work_available;
+    std::atomic<int>                       _affinity;
+    bool                                   _is_stopping;
+    std::thread                            _thread;
+};
+
+AsyncQueue::AsyncQueue(IScheduler *scheduler)
+    : _scheduler(scheduler), _works(), _mutex(), _work_available(), _affinity(-1), _is_stopping(false), _thread()
+{
+    _thread = std::thread(&AsyncQueue::worker_thread, this);
+}
+
+AsyncQueue::~AsyncQueue()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_stopping = true;
+    }
+    _work_available.notify_one();
+    _thread.join();
+}
+
+void AsyncQueue::set_affinity(int core)
+{
+    _affinity.store(core, std::memory_order_relaxed);
+}
+
+RunHandle AsyncQueue::push(std::function<void()> work)
+{
+    std::packaged_task<void()> task(std::move(work));
+    RunHandle                  handle(task.get_future().share());
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _works.push_back(std::move(task));
+    }
+    _work_available.notify_one();
+
+    return handle;
+}
+
+void AsyncQueue::worker_thread()
+{
+    // The kernels scheduled by the works run on the scheduler owning the queue, this thread running the share of the caller
+    Scheduler::set_thread_scheduler(_scheduler);
+
+    int current_affinity = -1;
+
+    while(true)
+    {
+        std::packaged_task<void()> task;
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _work_available.wait(lock, [this]()
+            {
+                return _is_stopping || !_works.empty();
+            });
+
+            // The pending works are still run before the thread exits
+            if(_works.empty())
+            {
+                return;
+            }
+
+            task = std::move(_works.front());
+            _works.pop_front();
+        }
+
+        const int affinity = _affinity.load(std::memory_order_relaxed);
+        if(affinity != current_affinity)
+        {
+            set_thread_affinity(affinity);
+            current_affinity = affinity;
+        }
+
+        // The exception raised by the work, if any, is stored in its future
+        task();
+    }
+}
+
+namespace
+{
+void delete_threads(Thread *t)
+{
+    delete[] t;
+}
+void delete_sync(JobSync *s)
+{
+    delete s;
+}
+void delete_split_records(SplitRecords *r)
+{
+    delete r;
+}
+void delete_async_queue(AsyncQueue *q)
+{
+    delete q;
+}
+} // namespace
+#endif /* NO_MULTI_THREADING */
+
+CPPScheduler &CPPScheduler::get()
+{
+    static CPPScheduler scheduler;
+    return scheduler;
+}
+
+CPPScheduler::CPPScheduler()
+    : _num_threads(0), _spin_count(0), _num_big_threads(0), _affinity(), _target_latency(0.f), _max_temperature(0.f), _num_active_threads(0), _is_inference_running(false), _inference_start(),
+      _latency_sum(0.0), _num_inferences(0), _threads(nullptr, delete_threads), _sync(nullptr, delete_sync), _record_splits(false),
+      _split_records(nullptr, delete_split_records), _cost_model(CostModel{ 0.1f, 0.25f, 1000.f }), _kernel_max_threads(), _kernel_max_threads_by_type(), _mutex(), _async_queue_created(), _async_queue(nullptr, delete_async_queue)
+{
+#ifndef NO_MULTI_THREADING
+    _sync          = std::unique_ptr<JobSync, void (*)(JobSync *)>(new JobSync(), delete_sync);
+    _split_records = std::unique_ptr<SplitRecords, void (*)(SplitRecords *)>(new SplitRecords(), delete_split_records);
+#endif /* NO_MULTI_THREADING */
+    force_number_of_threads(0);
+}
+
+void CPPScheduler::force_number_of_threads(int num_threads)
+{
+#ifndef NO_MULTI_THREADING
+    // The calling thread was pinned along with the previous pool: like the new threads it runs on any core again
+    if(!_affinity.empty())
+    {
+        set_thread_affinity(-1);
+    }
+#endif /* NO_MULTI_THREADING */
 
-Thread::Thread()
-    : _thread(), _window(), _wait_for_work(), _job_complete(), _current_exception(nullptr)
+    _affinity.clear();
+    _num_big_threads = 0;
+
+    create_threads(num_threads);
+}
+
+void CPPScheduler::set_affinity(const std::vector<unsigned int> &cores)
 {
-    int ret = sem_init(&_wait_for_work, 0, 0);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
-    ARM_COMPUTE_UNUSED(ret);
+#ifdef NO_MULTI_THREADING
+    ARM_COMPUTE_ERROR_ON(cores.size() > 1);
+    ARM_COMPUTE_UNUSED(cores);
+#else  /* NO_MULTI_THREADING */
+    const bool was_pinned = !_affinity.empty();
 
-    ret = sem_init(&_job_complete, 0, 0);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
-    ARM_COMPUTE_UNUSED(ret);
+    CPUTopology topology;
 
-    _thread = std::thread(&Thread::worker_thread, this);
+    // Sort the cores from the most powerful to the least: the first threads of the pool are the ones used for compute bound kernels
+    _affinity = cores;
+    std::stable_sort(_affinity.begin(), _affinity.end(), [&](unsigned int a, unsigned int b)
+    {
+        return topology.capacity(a) > topology.capacity(b);
+    });
+
+    create_threads(_affinity.size());
+
+    _num_big_threads = 0;
+
+    if(_affinity.empty())
+    {
+        if(was_pinned)
+        {
+            set_thread_affinity(-1);
+        }
+        return;
+    }
+
+    // The calling thread runs the last sub-window of each kernel and gets the most powerful core
+    set_thread_affinity(_affinity[0]);
+    for(int t = 0; t < _num_threads - 1; ++t)
+    {
+        _threads[t].set_affinity(_affinity[t + 1]);
+    }
+
+    const unsigned int max_capacity = topology.capacity(_affinity[0]);
+    _num_big_threads                = std::count_if(_affinity.begin(), _affinity.end(), [&](unsigned int core)
+    {
+        return topology.capacity(core) == max_capacity;
+    });
+#endif /* NO_MULTI_THREADING */
 }
 
-Thread::~Thread()
+void CPPScheduler::create_threads(int num_threads)
 {
-    ARM_COMPUTE_ERROR_ON(!_thread.joinable());
+#ifdef NO_MULTI_THREADING
+    ARM_COMPUTE_ERROR_ON(num_threads > 1);
+    _num_threads        = 1;
+    _num_active_threads = 1;
+#else  /* NO_MULTI_THREADING */
+    _num_threads = num_threads > 0 ? num_threads : std::thread::hardware_concurrency();
+    ARM_COMPUTE_ERROR_ON(_num_threads < 1);
 
-    start(nullptr, Window());
-    _thread.join();
+    // The adaptive mode starts again from the whole pool
+    _num_active_threads = _num_threads;
 
-    int ret = sem_destroy(&_wait_for_work);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
-    ARM_COMPUTE_UNUSED(ret);
+    // The splits depend on the size of the pool
+    _split_records->records.clear();
 
-    ret = sem_destroy(&_job_complete);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
-    ARM_COMPUTE_UNUSED(ret);
+    if(_num_threads > 1)
+    {
+        _threads = std::unique_ptr<Thread[], void (*)(Thread *)>(new Thread[_num_threads - 1], delete_threads);
+        set_spin_count(_spin_count);
+    }
+    else
+    {
+        _threads = nullptr;
+    }
+
+    // The thread running the asynchronous works takes the place of the caller, on the most powerful core
+    if(_async_queue != nullptr)
+    {
+        _async_queue->set_affinity(_affinity.empty() ? -1 : static_cast<int>(_affinity[0]));
+    }
+#endif /* NO_MULTI_THREADING */
 }
 
-void Thread::start(ICPPKernel *kernel, const Window &window)
+void CPPScheduler::set_cost_model(const CostModel &cost_model)
 {
-    _kernel = kernel;
-    _window = window;
-    int ret = sem_post(&_wait_for_work);
-    ARM_COMPUTE_UNUSED(ret);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
+    std::lock_guard<std::mutex> lock(_mutex);
+    _cost_model = cost_model;
 }
 
-void Thread::wait()
+CPPScheduler::CostModel CPPScheduler::calibrate_cost_model()
 {
-    int ret = sem_wait(&_job_complete);
-    ARM_COMPUTE_UNUSED(ret);
-    ARM_COMPUTE_ERROR_ON(ret < 0);
-    if(_current_exception)
+    using clock = std::chrono::steady_clock;
+
+    const auto elapsed_ns = [](clock::time_point start)
     {
-        std::rethrow_exception(_current_exception);
+        return std::chrono::duration<double, std::nano>(clock::now() - start).count();
+    };
+
+    CostModel cost_model = _cost_model;
+
+    // Memory bound work: copy a buffer larger than the caches, the best of a few copies
+    {
+        constexpr size_t     size = 8 * 1024 * 1024;
+        std::vector<uint8_t> src(size, 1);
+        std::vector<uint8_t> dst(size, 0);
+
+        double best = 0.0;
+        for(int i = 0; i < 4; ++i)
+        {
+            const clock::time_point start = clock::now();
+            std::memcpy(dst.data(), src.data(), size);
+            const double ns = elapsed_ns(start);
+            best            = (i == 0) ? ns : std::min(best, ns);
+        }
+        cost_model.ns_per_byte = static_cast<float>(best / (2 * size));
     }
-}
 
-void Thread::worker_thread()
-{
-    while(sem_wait(&_wait_for_work) >= 0)
+    // Compute bound work: multiply-accumulate on data which stays in the L1 cache
     {
-        _current_exception = nullptr;
-        // Time to exit
-        if(_kernel == nullptr)
+        constexpr size_t   size = 1024;
+        constexpr int      reps = 256;
+        std::vector<float> acc(size, 0.f);
+        std::vector<float> b(size, 0.999f);
+
+        const clock::time_point start = clock::now();
+        for(int r = 0; r < reps; ++r)
         {
-            return;
+            for(size_t i = 0; i < size; ++i)
+            {
+                acc[i] = acc[i] * b[i] + 1.f;
+            }
         }
+        const double ns = elapsed_ns(start);
 
-        try
+        // Keep the results alive
+        volatile float sink = acc[size / 2];
+        ARM_COMPUTE_UNUSED(sink);
+
+        cost_model.ns_per_op = static_cast<float>(ns / (2.0 * size * reps));
+    }
+
+    // Start and join of the threads: an empty kernel on all the threads, compared to the calling thread alone
+    if(_num_active_threads > 1)
+    {
+        constexpr int num_runs = 64;
+        EmptyKernel   kernel(_num_active_threads);
+
+        // The empty kernel doesn't estimate its cost: it runs on all the threads
+        multithread(&kernel);
+
+        const clock::time_point start = clock::now();
+        for(int i = 0; i < num_runs; ++i)
         {
-            _window.validate();
-            _kernel->run(_window);
+            multithread(&kernel);
         }
-        catch(...)
+        const double all_threads_ns = elapsed_ns(start) / num_runs;
+
+        const clock::time_point single_start = clock::now();
+        for(int i = 0; i < num_runs; ++i)
         {
-            _current_exception = std::current_exception();
+            kernel.run(kernel.window());
         }
-        int ret = sem_post(&_job_complete);
-        ARM_COMPUTE_UNUSED(ret);
-        ARM_COMPUTE_ERROR_ON(ret < 0);
+        const double single_thread_ns = elapsed_ns(single_start) / num_runs;
+
+        cost_model.ns_per_thread = static_cast<float>(std::max(0.0, all_threads_ns - single_thread_ns) / (_num_active_threads - 1));
     }
 
-    ARM_COMPUTE_ERROR("Wait failed");
+    set_cost_model(cost_model);
+    return cost_model;
 }
 
-namespace
+void CPPScheduler::set_kernel_max_threads(const std::string &kernel_name, int max_threads)
 {
-void delete_threads(Thread *t)
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if(max_threads > 0)
+    {
+        _kernel_max_threads[kernel_name] = max_threads;
+    }
+    else
+    {
+        _kernel_max_threads.erase(kernel_name);
+    }
+    _kernel_max_threads_by_type.clear();
+}
+
+void CPPScheduler::set_spin_count(unsigned int spin_count)
 {
-    delete[] t;
+    _spin_count = spin_count;
+
+#ifndef NO_MULTI_THREADING
+    if(_threads != nullptr)
+    {
+        for(int t = 0; t < _num_threads - 1; ++t)
+        {
+            _threads[t].set_spin_count(spin_count);
+        }
+    }
+#endif /* NO_MULTI_THREADING */
 }
-} // namespace
+
+void CPPScheduler::set_record_splits(bool record_splits)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _record_splits = record_splits;
+
+#ifndef NO_MULTI_THREADING
+    if(!record_splits)
+    {
+        _split_records->records.clear();
+    }
 #endif /* NO_MULTI_THREADING */
+}
 
-CPPScheduler &CPPScheduler::get()
+void CPPScheduler::set_target_latency(float target_latency, float max_temperature)
 {
-    static CPPScheduler scheduler;
-    return scheduler;
+    ARM_COMPUTE_ERROR_ON(target_latency < 0.f);
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    _target_latency       = target_latency;
+    _max_temperature      = max_temperature;
+    _num_active_threads   = _num_threads;
+    _is_inference_running = false;
+    _latency_sum          = 0.0;
+    _num_inferences       = 0;
 }
 
-CPPScheduler::CPPScheduler()
-    : _num_threads(0), _threads(nullptr, delete_threads)
+void CPPScheduler::end_inference()
 {
-    force_number_of_threads(0);
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    if(_target_latency <= 0.f || !_is_inference_running)
+    {
+        return;
+    }
+
+    _is_inference_running = false;
+    _latency_sum += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - _inference_start).count();
+
+    if(++_num_inferences < adaptation_period)
+    {
+        return;
+    }
+
+    const double latency = _latency_sum / _num_inferences;
+    _latency_sum         = 0.0;
+    _num_inferences      = 0;
+
+    // Once hot, the device only gets slower: stop adding threads and shed them as long as the target is met
+    const bool   is_hot = (_max_temperature > 0.f) && (max_thermal_zone_temperature() > _max_temperature);
+    const double margin = is_hot ? 1.0 : shed_margin;
+
+    // Assume the latency scales linearly with the number of threads to estimate it with one thread fewer
+    const double latency_one_fewer = (_num_active_threads > 1) ? latency * _num_active_threads / (_num_active_threads - 1) : latency;
+
+    if(latency > _target_latency && !is_hot && _num_active_threads < _num_threads)
+    {
+        ++_num_active_threads;
+    }
+    else if(_num_active_threads > 1 && latency_one_fewer < margin * _target_latency)
+    {
+        --_num_active_threads;
+    }
 }
 
-void CPPScheduler::force_number_of_threads(int num_threads)
+RunHandle CPPScheduler::run_async(std::function<void()> work)
 {
 #ifdef NO_MULTI_THREADING
-    ARM_COMPUTE_ERROR_ON(num_threads > 1);
-    _num_threads = 1;
+    return IScheduler::run_async(std::move(work));
 #else  /* NO_MULTI_THREADING */
-    _num_threads = num_threads > 0 ? num_threads : std::thread::hardware_concurrency();
-    ARM_COMPUTE_ERROR_ON(_num_threads < 1);
+    // The thread running the works is only started on the first submission
+    std::call_once(_async_queue_created, [this]()
+    {
+        _async_queue = std::unique_ptr<AsyncQueue, void (*)(AsyncQueue *)>(new AsyncQueue(this), delete_async_queue);
+        _async_queue->set_affinity(_affinity.empty() ? -1 : static_cast<int>(_affinity[0]));
+    });
 
-    if(_num_threads > 1)
+    return _async_queue->push(std::move(work));
+#endif /* NO_MULTI_THREADING */
+}
+
+void CPPScheduler::multithread_independent(const std::vector<IndependentKernel> &kernels)
+{
+#ifdef NO_MULTI_THREADING
+    IScheduler::multithread_independent(kernels);
+#else  /* NO_MULTI_THREADING */
+    // The profiler times the kernels one by one
+    if(kernels.size() < 2 || Profiler::get().is_enabled())
     {
-        _threads = std::unique_ptr<Thread[], void (*)(Thread *)>(new Thread[_num_threads - 1], delete_threads);
+        IScheduler::multithread_independent(kernels);
+        return;
     }
-    else
+
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    // The first kernel of an inference starts measuring its latency
+    if(_target_latency > 0.f && !_is_inference_running)
     {
-        _threads = nullptr;
+        _inference_start      = std::chrono::steady_clock::now();
+        _is_inference_running = true;
+    }
+
+    // Use as many threads as the kernel with the most parts needs, or one per kernel running whole
+    int max_parts  = 0;
+    int num_wholes = 0;
+    for(const auto &k : kernels)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(!k.kernel, "The child class didn't set the kernel");
+
+        const int num_parts = num_independent_parts(k, _num_active_threads);
+        max_parts           = std::max(max_parts, num_parts);
+        num_wholes += (num_parts == 0) ? 1 : 0;
+    }
+    const int num_threads = std::min(_num_active_threads, std::max(max_parts, num_wholes));
+
+    for(const auto &k : kernels)
+    {
+        k.kernel->begin_reduction(std::max(1, num_independent_parts(k, num_threads)));
+    }
+
+    IndependentKernelsJob job(kernels, num_threads);
+
+    _sync->num_pending.store(num_threads - 1, std::memory_order_relaxed);
+    _sync->next_chunk.store(0, std::memory_order_relaxed);
+    _sync->num_chunks       = 0;
+    _sync->split_dimension  = Window::DimY;
+    _sync->outer_dimension  = Window::DimY;
+    _sync->parts_x          = 1;
+    _sync->thread_times     = nullptr;
+    _sync->thread_counters  = nullptr;
+    _sync->part_windows     = nullptr;
+    _sync->part_offsets     = nullptr;
+    _sync->allocation_scope = AllocationTracer::current_scope();
+
+    // The workers refer to their window until the join
+    std::vector<Window> &windows = _split_records->independent_windows;
+    windows.resize(std::max(windows.size(), static_cast<size_t>(num_threads)));
+
+    for(int t = 0; t < num_threads; ++t)
+    {
+        windows[t].set_thread_id(t);
+        windows[t].set_num_threads(num_threads);
+
+        if(t != num_threads - 1)
+        {
+            _threads[t].start(&job, &windows[t], _sync.get());
+        }
+        else
+        {
+            run_caller_job(&job, windows[t], *_sync, _spin_count);
+        }
+    }
+
+    try
+    {
+        // Wait for all the workers with a single countdown
+        wait_for_workers(*_sync, _spin_count);
+
+        for(int t = 1; t < num_threads; ++t)
+        {
+            _threads[t - 1].rethrow_exception();
+        }
+
+        for(const auto &k : kernels)
+        {
+            k.kernel->end_reduction();
+        }
+    }
+    catch(const std::system_error &e)
+    {
+        std::cout << "Caught system_error with code " << e.code() << " meaning " << e.what() << '\n';
     }
 #endif /* NO_MULTI_THREADING */
 }
 
 void CPPScheduler::multithread(ICPPKernel *kernel, const size_t split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    multithread(kernel, kernel->window(), split_dimension);
+}
+
+void CPPScheduler::multithread(ICPPKernel *kernel, const Window &window, const size_t split_dimension)
 {
     ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
 
+    // The workers and their job are shared by all the callers of this instance
+    std::lock_guard<std::mutex> lock(_mutex);
+    ARM_COMPUTE_TRACE_KERNEL(*kernel);
+
+    // Profiling costs a single check when disabled
+    const bool                    is_profiling  = Profiler::get().is_enabled();
+    const bool                    read_counters = is_profiling && Profiler::get().reads_counters();
+    const double                  start         = is_profiling ? Profiler::get().now() : 0.0;
+    std::vector<ProfilerInterval> thread_times;
+    std::vector<ProfilerCounters> thread_counters;
+
     /** [Scheduler example] */
-    const Window &max_window     = kernel->window();
-    const int     num_iterations = max_window.num_iterations(split_dimension);
-    int           num_threads    = std::min(num_iterations, _num_threads);
+    const bool    is_dynamic = kernel->scheduling_policy() == SchedulingPolicy::DYNAMIC;
+
+    // The first kernel of an inference starts measuring its latency
+    if(_target_latency > 0.f && !_is_inference_running)
+    {
+        _inference_start      = std::chrono::steady_clock::now();
+        _is_inference_running = true;
+    }
+
+    // Compute bound kernels only run on the most powerful cores
+    int max_threads = _num_active_threads;
+    if(kernel->is_compute_bound() && _num_big_threads > 0)
+    {
+        max_threads = std::min(max_threads, _num_big_threads);
+    }
+
+    // Small kernels run on fewer threads than waking them all up would cost, unless the user picked their number of threads
+    // The overrides are looked up by name once per kernel class, the demangled name being built on the heap
+    int max_threads_override = 0;
+    if(!_kernel_max_threads.empty())
+    {
+        const std::type_index type(typeid(*kernel));
+        auto                  it = _kernel_max_threads_by_type.find(type);
+        if(it == _kernel_max_threads_by_type.end())
+        {
+            const auto override_it = _kernel_max_threads.find(Profiler::kernel_name(*kernel));
+            it                     = _kernel_max_threads_by_type.emplace(type, override_it != _kernel_max_threads.cend() ? override_it->second : 0).first;
+        }
+        max_threads_override = it->second;
+    }
+
+    if(max_threads_override > 0)
+    {
+        max_threads = std::min(max_threads, max_threads_override);
+    }
+    else if(max_threads > 1)
+    {
+        max_threads = threads_for_cost(kernel->cost(window), _cost_model, max_threads);
+    }
+
+#ifdef NO_MULTI_THREADING
+    ARM_COMPUTE_UNUSED(is_dynamic);
+    const SplitPlan plan = plan_split(*kernel, window, split_dimension, max_threads, _num_threads);
+#else  /* NO_MULTI_THREADING */
+    // Replay the split recorded by a previous run of the kernel if nothing it depends on changed
+    SplitRecord *record      = &_split_records->current;
+    bool         is_recorded = false;
+
+    if(_record_splits)
+    {
+        // The records of destroyed kernels are never replayed (A kernel allocated at the same address has another configuration id):
+        // drop them all once there are too many rather than let the records grow without bound
+        if(_split_records->records.size() >= max_split_records && _split_records->records.count(kernel) == 0)
+        {
+            _split_records->records.clear();
+        }
+
+        const SchedulingPolicy policy        = kernel->scheduling_policy();
+        const unsigned int     split_parts_x = kernel->split_parts_x(is_dynamic ? max_threads * num_chunks_per_thread : max_threads);
+
+        record      = &_split_records->records[kernel];
+        is_recorded = record->configuration_id == kernel->configuration_id() && record->max_threads == max_threads && record->split_dimension == split_dimension && record->scheduling_policy == policy
+                      && record->split_parts_x == split_parts_x && is_same_window(record->window, window);
+
+        if(!is_recorded)
+        {
+            record->configuration_id  = kernel->configuration_id();
+            record->window            = window;
+            record->split_dimension   = split_dimension;
+            record->max_threads       = max_threads;
+            record->scheduling_policy = policy;
+            record->split_parts_x     = split_parts_x;
+        }
+    }
+
+    if(!is_recorded)
+    {
+        record->plan = plan_split(*kernel, window, split_dimension, max_threads, _num_threads);
+    }
+
+    const SplitPlan &plan = record->plan;
+#endif /* NO_MULTI_THREADING */
+    const int num_threads = plan.num_threads;
 
     if(!kernel->is_parallelisable() || 1 == num_threads)
     {
-        kernel->run(max_window);
+        const ProfilerCounters start_counters = read_counters ? Profiler::thread_counters() : ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+
+        kernel->begin_reduction(1);
+        kernel->run(window);
+        kernel->end_reduction();
+
+        if(is_profiling)
+        {
+            thread_times.push_back(ProfilerInterval{ start, Profiler::get().now() });
+        }
+        if(read_counters)
+        {
+            thread_counters.push_back(Profiler::thread_counters() - start_counters);
+        }
     }
 #ifndef NO_MULTI_THREADING
     else
     {
-        for(int t = 0; t < num_threads; ++t)
+        _sync->num_pending.store(num_threads - 1, std::memory_order_relaxed);
+        _sync->next_chunk.store(0, std::memory_order_relaxed);
+        _sync->num_chunks       = plan.num_chunks;
+        _sync->split_dimension  = split_dimension;
+        _sync->outer_dimension  = plan.outer_dimension;
+        _sync->parts_x          = plan.parts_x;
+
+        if(!is_recorded || static_cast<int>(record->thread_windows.size()) != num_threads)
         {
-            Window win = max_window.split_window(split_dimension, t, num_threads);
-            win.set_thread_id(t);
-            win.set_num_threads(num_threads);
+            split_threads(*record, window, split_dimension, is_dynamic, _record_splits);
+        }
+        _sync->part_windows = record->part_offsets.empty() ? nullptr : record->part_windows.data();
+        _sync->part_offsets = record->part_offsets.empty() ? nullptr : record->part_offsets.data();
+
+        _sync->allocation_scope = AllocationTracer::current_scope();
+
+        if(is_profiling)
+        {
+            thread_times.resize(num_threads);
+        }
+        _sync->thread_times = is_profiling ? thread_times.data() : nullptr;
+
+        if(read_counters)
+        {
+            thread_counters.resize(num_threads);
+        }
+        _sync->thread_counters  = read_counters ? thread_counters.data() : nullptr;
 
+        kernel->begin_reduction(num_threads);
+
+        for(int t = 0; t < num_threads; ++t)
+        {
             if(t != num_threads - 1)
             {
-                _threads[t].start(kernel, win);
+                _threads[t].start(kernel, &record->thread_windows[t], _sync.get());
             }
             else
             {
-                kernel->run(win);
+                run_caller_job(kernel, record->thread_windows[t], *_sync, _spin_count);
             }
         }
 
         try
         {
+            // Wait for all the workers with a single countdown
+            wait_for_workers(*_sync, _spin_count);
+
             for(int t = 1; t < num_threads; ++t)
             {
-                _threads[t - 1].wait();
+                _threads[t - 1].rethrow_exception();
             }
+
+            // All the partial results are visible once the countdown reached zero
+            kernel->end_reduction();
         }
         catch(const std::system_error &e)
         {
@@ -242,4 +1588,9 @@ void CPPScheduler::multithread(ICPPKernel *kernel, const size_t split_dimension)
     }
 #endif /* NO_MULTI_THREADING */
     /** [Scheduler example] */
+
+    if(is_profiling)
+    {
+        Profiler::get().add(*kernel, ProfilerInterval{ start, Profiler::get().now() }, std::move(thread_times), -1.0, std::move(thread_counters));
+    }
 }
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPP/SingleThreadScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/Profiler.h"
+
+#include <utility>
+#include <vector>
+
+using namespace arm_compute;
+
+SingleThreadScheduler &SingleThreadScheduler::get()
+{
+    static SingleThreadScheduler scheduler;
+    return scheduler;
+}
+
+void SingleThreadScheduler::force_number_of_threads(int num_threads)
+{
+    ARM_COMPUTE_UNUSED(num_threads);
+}
+
+int SingleThreadScheduler::num_threads() const
+{
+    return 1;
+}
+
+void SingleThreadScheduler::multithread(ICPPKernel *kernel, size_t split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    multithread(kernel, kernel->window(), split_dimension);
+}
+
+void SingleThreadScheduler::multithread(ICPPKernel *kernel, const Window &window, size_t split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    ARM_COMPUTE_UNUSED(split_dimension);
+
+    kernel->begin_reduction(1);
+
+    if(Profiler::get().is_enabled())
+    {
+        const bool             read_counters  = Profiler::get().reads_counters();
+        const ProfilerCounters start_counters = read_counters ? Profiler::thread_counters() : ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+        const double           start          = Profiler::get().now();
+        kernel->run(window);
+        const ProfilerInterval wall_time{ start, Profiler::get().now() };
+
+        std::vector<ProfilerCounters> counters;
+        if(read_counters)
+        {
+            counters.push_back(Profiler::thread_counters() - start_counters);
+        }
+        Profiler::get().add(*kernel, wall_time, { wall_time }, -1.0, std::move(counters));
+    }
+    else
+    {
+        kernel->run(window);
+    }
+
+    kernel->end_reduction();
+}
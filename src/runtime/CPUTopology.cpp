@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CPUTopology.h"
+
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+using namespace arm_compute;
+
+namespace
+{
+const std::string cpu_sysfs_path = "/sys/devices/system/cpu/";
+
+/** Read the first unsigned integer of a file
+ *
+ * @param[in]  path  Path of the file to read.
+ * @param[out] value Value read from the file.
+ *
+ * @return True if a value could be read.
+ */
+bool read_value(const std::string &path, unsigned int &value)
+{
+    std::ifstream file(path);
+    return static_cast<bool>(file >> value);
+}
+
+/** Parse a list of cores in the sysfs format, e.g. "0-3,5,7-8"
+ *
+ * @param[in] list List to parse.
+ *
+ * @return The ids of the cores in the list.
+ */
+std::vector<unsigned int> parse_core_list(const std::string &list)
+{
+    std::vector<unsigned int> ids;
+    std::stringstream         stream(list);
+    std::string               range;
+
+    while(std::getline(stream, range, ','))
+    {
+        const size_t dash = range.find('-');
+
+        try
+        {
+            const unsigned int first = std::stoul(range.substr(0, dash));
+            const unsigned int last  = (dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1));
+
+            for(unsigned int id = first; id <= last; ++id)
+            {
+                ids.push_back(id);
+            }
+        }
+        catch(const std::exception &)
+        {
+            // Ignore malformed entries
+        }
+    }
+
+    return ids;
+}
+} // namespace
+
+CPUTopology::CPUTopology()
+    : _cores()
+{
+    std::ifstream present_file(cpu_sysfs_path + "present");
+    std::string   present;
+    std::getline(present_file, present);
+
+    std::vector<unsigned int> ids = parse_core_list(present);
+
+    if(ids.empty())
+    {
+        const unsigned int num_cores = std::max(1u, std::thread::hardware_concurrency());
+        for(unsigned int id = 0; id < num_cores; ++id)
+        {
+            ids.push_back(id);
+        }
+    }
+
+    for(unsigned int id : ids)
+    {
+        const std::string core_path = cpu_sysfs_path + "cpu" + std::to_string(id) + "/";
+        unsigned int      capacity  = 1;
+
+        if(!read_value(core_path + "cpu_capacity", capacity) && !read_value(core_path + "cpufreq/cpuinfo_max_freq", capacity))
+        {
+            capacity = 1;
+        }
+
+        _cores.push_back(CPUCoreInfo{ id, capacity });
+    }
+}
+
+const std::vector<CPUCoreInfo> &CPUTopology::cores() const
+{
+    return _cores;
+}
+
+std::vector<unsigned int> CPUTopology::cores_by_capacity() const
+{
+    std::vector<CPUCoreInfo> sorted_cores(_cores);
+    std::stable_sort(sorted_cores.begin(), sorted_cores.end(), [](const CPUCoreInfo & a, const CPUCoreInfo & b)
+    {
+        return a.capacity > b.capacity;
+    });
+
+    std::vector<unsigned int> ids;
+    for(const auto &core : sorted_cores)
+    {
+        ids.push_back(core.id);
+    }
+
+    return ids;
+}
+
+std::vector<unsigned int> CPUTopology::big_cores() const
+{
+    unsigned int max_capacity = 0;
+    for(const auto &core : _cores)
+    {
+        max_capacity = std::max(max_capacity, core.capacity);
+    }
+
+    std::vector<unsigned int> ids;
+    for(const auto &core : _cores)
+    {
+        if(core.capacity == max_capacity)
+        {
+            ids.push_back(core.id);
+        }
+    }
+
+    return ids;
+}
+
+bool CPUTopology::is_heterogeneous() const
+{
+    return std::any_of(_cores.begin(), _cores.end(), [&](const CPUCoreInfo & core)
+    {
+        return core.capacity != _cores.front().capacity;
+    });
+}
+
+unsigned int CPUTopology::capacity(unsigned int id) const
+{
+    const auto it = std::find_if(_cores.begin(), _cores.end(), [&](const CPUCoreInfo & core)
+    {
+        return core.id == id;
+    });
+
+    return (it != _cores.end()) ? it->capacity : 0;
+}
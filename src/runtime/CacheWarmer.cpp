@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/CacheWarmer.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Size of the cache lines: one byte of each line is read */
+constexpr size_t cache_line_size = 64;
+/** Number of bytes read between two checks for a new request */
+constexpr size_t check_interval = 4096;
+} // namespace
+
+CacheWarmer::CacheWarmer()
+    : _ranges(), _thread_ranges(), _request(0), _is_busy(false), _is_stopping(false), _mutex(), _request_changed()
+#ifndef NO_MULTI_THREADING
+      ,
+      _thread()
+#endif /* NO_MULTI_THREADING */
+{
+}
+
+CacheWarmer::~CacheWarmer()
+{
+#ifndef NO_MULTI_THREADING
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _is_stopping = true;
+        ++_request;
+    }
+    _request_changed.notify_all();
+
+    if(_thread.joinable())
+    {
+        _thread.join();
+    }
+#endif /* NO_MULTI_THREADING */
+}
+
+void CacheWarmer::warm(const std::vector<Range> &ranges)
+{
+#ifndef NO_MULTI_THREADING
+    {
+        // Assigning keeps the memory of the previous requests
+        std::lock_guard<std::mutex> lock(_mutex);
+        _ranges.assign(ranges.cbegin(), ranges.cend());
+        ++_request;
+    }
+    _request_changed.notify_all();
+
+    if(!_thread.joinable())
+    {
+        _thread = std::thread(&CacheWarmer::warm_ranges, this);
+    }
+#else  /* NO_MULTI_THREADING */
+    static_cast<void>(ranges);
+#endif /* NO_MULTI_THREADING */
+}
+
+void CacheWarmer::reserve(size_t num_ranges)
+{
+#ifndef NO_MULTI_THREADING
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    // The thread only reads its copy of the ranges while it is busy
+    _request_changed.wait(lock, [this]
+    {
+        return !_is_busy;
+    });
+    _ranges.reserve(num_ranges);
+    _thread_ranges.reserve(num_ranges);
+
+    if(!_thread.joinable())
+    {
+        _thread = std::thread(&CacheWarmer::warm_ranges, this);
+    }
+#else  /* NO_MULTI_THREADING */
+    static_cast<void>(num_ranges);
+#endif /* NO_MULTI_THREADING */
+}
+
+void CacheWarmer::cancel()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    _ranges.clear();
+    ++_request;
+    _request_changed.notify_all();
+
+    // The thread checks for a new request every check_interval bytes
+    _request_changed.wait(lock, [this]
+    {
+        return !_is_busy;
+    });
+}
+
+void CacheWarmer::warm_ranges()
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+    unsigned int                 done_request = 0;
+
+    while(true)
+    {
+        _request_changed.wait(lock, [&]
+        {
+            return _is_stopping || _request != done_request;
+        });
+        if(_is_stopping)
+        {
+            return;
+        }
+
+        const unsigned int request = _request;
+        _thread_ranges.assign(_ranges.cbegin(), _ranges.cend());
+        _is_busy = true;
+        lock.unlock();
+
+        // The loads are accumulated so that they can't be optimised out
+        uint8_t checksum  = 0;
+        bool    abandoned = false;
+
+        for(auto range = _thread_ranges.cbegin(); range != _thread_ranges.cend() && !abandoned; ++range)
+        {
+            for(size_t offset = 0; offset < range->second && !abandoned; offset += check_interval)
+            {
+                const size_t end = std::min(offset + check_interval, range->second);
+                for(size_t byte = offset; byte < end; byte += cache_line_size)
+                {
+                    checksum ^= *static_cast<const volatile uint8_t *>(range->first + byte);
+                }
+
+                std::lock_guard<std::mutex> check_lock(_mutex);
+                abandoned = _request != request;
+            }
+        }
+        static_cast<void>(checksum);
+
+        lock.lock();
+        _is_busy     = false;
+        done_request = request;
+        _request_changed.notify_all();
+    }
+}
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ConvolutionMethodTuner.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <array>
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Names of the algorithms in the saved tables */
+const std::array<std::pair<ConvolutionMethod, const char *>, 6> method_names{ { { ConvolutionMethod::GEMM, "GEMM" },
+        { ConvolutionMethod::DIRECT, "DIRECT" },
+        { ConvolutionMethod::POINTWISE, "POINTWISE" },
+        { ConvolutionMethod::WINOGRAD, "WINOGRAD" },
+        { ConvolutionMethod::SPACE_TO_DEPTH, "SPACE_TO_DEPTH" },
+        { ConvolutionMethod::IMPLICIT_GEMM, "IMPLICIT_GEMM" }
+    }
+};
+} // namespace
+
+ConvolutionMethodTuner::ConvolutionMethodTuner()
+    : _method_table(), _tune_new_layers(true)
+{
+}
+
+void ConvolutionMethodTuner::set_tune_new_layers(bool tune_new_layers)
+{
+    _tune_new_layers = tune_new_layers;
+}
+
+bool ConvolutionMethodTuner::tune_new_layers() const
+{
+    return _tune_new_layers;
+}
+
+ConvolutionMethod ConvolutionMethodTuner::find(const std::string &id) const
+{
+    const auto it = _method_table.find(id);
+
+    return (it != _method_table.end()) ? it->second : ConvolutionMethod::DEFAULT;
+}
+
+void ConvolutionMethodTuner::add(const std::string &id, ConvolutionMethod method)
+{
+    ARM_COMPUTE_ERROR_ON(method == ConvolutionMethod::DEFAULT);
+    ARM_COMPUTE_ERROR_ON(id.find('\n') != std::string::npos);
+
+    _method_table[id] = method;
+}
+
+const std::map<std::string, ConvolutionMethod> &ConvolutionMethodTuner::method_table() const
+{
+    return _method_table;
+}
+
+void ConvolutionMethodTuner::save(std::ostream &stream) const
+{
+    for(const auto &layer : _method_table)
+    {
+        for(const auto &name : method_names)
+        {
+            if(name.first == layer.second)
+            {
+                stream << layer.first << '\t' << name.second << '\n';
+                break;
+            }
+        }
+    }
+}
+
+void ConvolutionMethodTuner::load(std::istream &stream)
+{
+    std::string line;
+    while(std::getline(stream, line))
+    {
+        const size_t pos = line.rfind('\t');
+        if(line.empty() || pos == std::string::npos)
+        {
+            continue;
+        }
+
+        const std::string method = line.substr(pos + 1);
+        for(const auto &name : method_names)
+        {
+            if(method == name.second)
+            {
+                _method_table[line.substr(0, pos)] = name.first;
+                break;
+            }
+        }
+    }
+}
@@ -0,0 +1,166 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/HugePageAllocator.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/PoolAllocator.h"
+#include "arm_compute/runtime/Scheduler.h"
+
+#include <cstdint>
+#include <sys/mman.h>
+#include <unistd.h>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Size in bytes of a huge page (Size of a PMD block with 4KB pages) */
+constexpr size_t huge_page_size = 2 * 1024 * 1024;
+
+size_t round_up(size_t value, size_t multiple)
+{
+    return ((value + multiple - 1) / multiple) * multiple;
+}
+
+/** Kernel writing the first byte of every page of a block, so that the page faults are taken in parallel */
+class PrefaultKernel : public ICPPKernel
+{
+public:
+    PrefaultKernel(uint8_t *ptr, size_t size, size_t page_size)
+        : _ptr(ptr), _page_size(page_size)
+    {
+        Window win;
+        win.set(Window::DimX, Window::Dimension(0, 1, 1));
+        win.set(Window::DimY, Window::Dimension(0, (size + page_size - 1) / page_size, 1));
+        ICPPKernel::configure(win);
+    }
+    PrefaultKernel(const PrefaultKernel &) = delete;
+    PrefaultKernel &operator=(const PrefaultKernel &) = delete;
+
+    void run(const Window &window) override
+    {
+        for(int page = window.y().start(); page < window.y().end(); ++page)
+        {
+            // The block is fresh from the system: writing zero doesn't change its content
+            *static_cast<volatile uint8_t *>(_ptr + page * _page_size) = 0;
+        }
+    }
+
+private:
+    uint8_t *_ptr;
+    size_t   _page_size;
+};
+} // namespace
+
+HugePageAllocator::HugePageAllocator(size_t threshold, bool prefault, bool use_hugetlb, IAllocator *fallback)
+    : _fallback(fallback != nullptr ? fallback : &PoolAllocator::get()), _threshold(threshold), _prefault(prefault), _use_hugetlb(use_hugetlb), _mtx(), _mappings(), _mapped_size(0)
+{
+}
+
+size_t HugePageAllocator::mapped_size() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _mapped_size;
+}
+
+void *HugePageAllocator::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON_MSG((alignment & (alignment - 1)) != 0, "The alignment must be a power of 2");
+    ARM_COMPUTE_ERROR_ON_MSG(alignment > huge_page_size, "The alignment must not exceed the size of a huge page");
+
+    if(size < _threshold)
+    {
+        return _fallback->allocate(size, alignment);
+    }
+
+    const size_t block_size = round_up(size, huge_page_size);
+    Mapping      mapping{ MAP_FAILED, 0 };
+    void        *ptr = nullptr;
+
+#ifdef MAP_HUGETLB
+    if(_use_hugetlb)
+    {
+        // The reserved huge pages are naturally aligned
+        mapping.base = mmap(nullptr, block_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        mapping.size = block_size;
+        ptr          = mapping.base;
+    }
+#endif /* MAP_HUGETLB */
+
+    if(mapping.base == MAP_FAILED)
+    {
+        // Over-map by a huge page to be able to align the start of the block on a huge page boundary, which transparent huge pages require
+        mapping.base = mmap(nullptr, block_size + huge_page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        if(mapping.base == MAP_FAILED)
+        {
+            ARM_COMPUTE_ERROR("Failed to map %zu bytes", block_size);
+        }
+        mapping.size = block_size + huge_page_size;
+        ptr          = reinterpret_cast<void *>(round_up(reinterpret_cast<uintptr_t>(mapping.base), huge_page_size));
+
+#ifdef MADV_HUGEPAGE
+        // Not an error if transparent huge pages are disabled: the block is then backed by normal pages
+        madvise(ptr, block_size, MADV_HUGEPAGE);
+#endif /* MADV_HUGEPAGE */
+    }
+
+    if(_prefault)
+    {
+        PrefaultKernel kernel(static_cast<uint8_t *>(ptr), block_size, static_cast<size_t>(sysconf(_SC_PAGESIZE)));
+        Scheduler::get().multithread(&kernel, Window::DimY);
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+    _mappings.emplace(ptr, mapping);
+    _mapped_size += mapping.size;
+    return ptr;
+}
+
+void HugePageAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    Mapping mapping{ nullptr, 0 };
+    {
+        std::lock_guard<std::mutex> lock(_mtx);
+
+        const auto it = _mappings.find(ptr);
+        if(it == _mappings.end())
+        {
+            // Small block
+            _fallback->free(ptr);
+            return;
+        }
+        mapping = it->second;
+        _mapped_size -= mapping.size;
+        _mappings.erase(it);
+    }
+
+    munmap(mapping.base, mapping.size);
+}
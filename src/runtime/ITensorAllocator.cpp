@@ -30,6 +30,38 @@
 
 using namespace arm_compute;
 
+namespace
+{
+bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &child_info, const Coordinates &coords)
+{
+    bool               is_valid     = true;
+    const TensorShape &parent_shape = parent_info.tensor_shape();
+    const TensorShape &child_shape  = child_info.tensor_shape();
+    const size_t       parent_dims  = parent_info.num_dimensions();
+    const size_t       child_dims   = child_info.num_dimensions();
+
+    if(child_dims <= parent_dims)
+    {
+        for(size_t num_dimensions = child_dims; num_dimensions > 0; --num_dimensions)
+        {
+            const size_t child_dim_size = coords[num_dimensions - 1] + child_shape[num_dimensions - 1];
+
+            if((coords[num_dimensions - 1] < 0) || (child_dim_size > parent_shape[num_dimensions - 1]))
+            {
+                is_valid = false;
+                break;
+            }
+        }
+    }
+    else
+    {
+        is_valid = false;
+    }
+
+    return is_valid;
+}
+} // namespace
+
 ITensorAllocator::ITensorAllocator()
     : _info()
 {
@@ -49,3 +81,39 @@ const TensorInfo &ITensorAllocator::info() const
 {
     return _info;
 }
+
+void ITensorAllocator::init_sub_tensor(const TensorInfo &parent_info, const Coordinates &coords, TensorInfo sub_info)
+{
+    // Check if coordinates and new shape are within the parent tensor
+    ARM_COMPUTE_ERROR_ON(!validate_subtensor_shape(parent_info, sub_info, coords));
+    ARM_COMPUTE_UNUSED(validate_subtensor_shape);
+
+    // Init tensor info with new dimensions
+    const size_t offset     = parent_info.offset_element_in_bytes(coords);
+    const size_t total_size = offset + sub_info.total_size() - sub_info.offset_first_element_in_bytes();
+
+    if(sub_info.format() != Format::UNKNOWN)
+    {
+        sub_info.init(sub_info.tensor_shape(), sub_info.format(), parent_info.strides_in_bytes(), offset, total_size);
+    }
+    else
+    {
+        sub_info.init(sub_info.tensor_shape(), sub_info.num_channels(), sub_info.data_type(), parent_info.strides_in_bytes(), offset, total_size, sub_info.fixed_point_pos());
+    }
+
+    // Set TensorInfo
+    init(sub_info);
+
+    // Only the padding of the parent can be exposed: the elements of the parent around the sub-tensor are valid data,
+    // which the kernels filling the borders of the sub-tensor would overwrite. The sides inside the parent have no padding.
+    const PaddingSize parent_padding = parent_info.padding();
+    const bool        is_top         = coords[1] == 0;
+    const bool        is_left        = coords[0] == 0;
+    const bool        is_bottom      = coords[1] + sub_info.dimension(1) == parent_info.dimension(1);
+    const bool        is_right       = coords[0] + sub_info.dimension(0) == parent_info.dimension(0);
+
+    info().set_fixed_padding(PaddingSize(is_top ? parent_padding.top : 0,
+                                         is_right ? parent_padding.right : 0,
+                                         is_bottom ? parent_padding.bottom : 0,
+                                         is_left ? parent_padding.left : 0));
+}
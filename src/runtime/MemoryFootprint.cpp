@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/MemoryFootprint.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+
+using namespace arm_compute;
+
+void MemoryFootprint::add(MemoryCategory category, const ITensor &tensor)
+{
+    const TensorInfo *info = tensor.info();
+
+    // The allocators make the info non resizable when they allocate the memory, and resizable again when they free it
+    if(info->is_resizable())
+    {
+        return;
+    }
+
+    const size_t size     = info->total_size();
+    const size_t elements = info->tensor_shape().total_size() * info->element_size();
+
+    switch(category)
+    {
+        case MemoryCategory::WEIGHTS:
+            weights += size;
+            break;
+        case MemoryCategory::ACTIVATIONS:
+            activations += size;
+            break;
+        case MemoryCategory::SCRATCH:
+            scratch += size;
+            break;
+        default:
+            ARM_COMPUTE_ERROR("Memory category not supported");
+            break;
+    }
+    padding += (size > elements) ? size - elements : 0;
+}
@@ -0,0 +1,504 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/ModelFile.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/StartupProfiler.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fcntl.h>
+#include <fstream>
+#include <limits>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Tag identifying a model file, followed by the version of its layout
+ *
+ * Version 2 adds the storage data type, scale and offset of each tensor to the index.
+ */
+constexpr uint32_t model_magic   = 0x4d4c4341; // "ACLM"
+constexpr uint32_t model_version = 2;
+
+/** Alignment in bytes of the content of each tensor in the file (Size of a cache line) */
+constexpr size_t model_alignment = 64;
+
+template <typename T>
+void write_value(std::ostream &stream, T value)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+/** Sequential reader of the index of a mapped model file */
+class IndexReader
+{
+public:
+    IndexReader(const uint8_t *data, size_t size)
+        : _data(data), _size(size), _pos(0)
+    {
+    }
+
+    template <typename T>
+    T read()
+    {
+        if(_pos + sizeof(T) > _size)
+        {
+            ARM_COMPUTE_ERROR("Truncated model file");
+        }
+
+        T value;
+        std::memcpy(&value, _data + _pos, sizeof(T));
+        _pos += sizeof(T);
+        return value;
+    }
+
+    std::string read_string(size_t length)
+    {
+        if(_pos + length > _size)
+        {
+            ARM_COMPUTE_ERROR("Truncated model file");
+        }
+
+        std::string value(reinterpret_cast<const char *>(_data + _pos), length);
+        _pos += length;
+        return value;
+    }
+
+private:
+    const uint8_t *_data;
+    size_t         _size;
+    size_t         _pos;
+};
+
+/** Window iterating over the rows of a tensor */
+Window rows_window(const TensorInfo &info)
+{
+    Window window;
+    window.use_tensor_dimensions(&info);
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+    return window;
+}
+
+/** Check if a tensor has no padding, i.e. its memory layout is the one of the content stored in a model file */
+bool is_dense(const TensorInfo &info)
+{
+    const TensorInfo dense_info(info.tensor_shape(), info.num_channels(), info.data_type());
+
+    bool is_dense = (info.offset_first_element_in_bytes() == 0) && (info.total_size() == dense_info.total_size());
+    for(size_t d = 0; d < info.num_dimensions(); ++d)
+    {
+        is_dense = is_dense && (info.strides_in_bytes()[d] == dense_info.strides_in_bytes()[d]);
+    }
+    return is_dense;
+}
+
+/** Size in bytes of the content of a tensor stored in a data type */
+size_t stored_size(const TensorShape &shape, size_t num_channels, DataType storage_type)
+{
+    return shape.total_size() * num_channels * element_size_from_data_type(storage_type);
+}
+
+/** Convert a row of F32 values to the data type they are stored in: out = (in - offset) / scale */
+void compress_row(const float *in, uint8_t *out, size_t num_elements, DataType storage_type, float scale, float offset)
+{
+    if(storage_type == DataType::F16)
+    {
+        for(size_t x = 0; x < num_elements; ++x)
+        {
+            const uint16_t half = float_to_half(in[x]);
+            std::memcpy(out + x * sizeof(half), &half, sizeof(half));
+        }
+    }
+    else
+    {
+        const float inv_scale = (scale != 0.f) ? 1.f / scale : 0.f;
+        for(size_t x = 0; x < num_elements; ++x)
+        {
+            out[x] = static_cast<uint8_t>(std::min(std::max(std::round((in[x] - offset) * inv_scale), 0.f), 255.f));
+        }
+    }
+}
+
+/** Expand a row of stored values to F32: out = in * scale + offset */
+void expand_row(const uint8_t *in, float *out, size_t num_elements, DataType storage_type, float scale, float offset)
+{
+    if(storage_type == DataType::F16)
+    {
+        for(size_t x = 0; x < num_elements; ++x)
+        {
+            uint16_t half = 0;
+            std::memcpy(&half, in + x * sizeof(half), sizeof(half));
+            out[x] = half_to_float(half) * scale + offset;
+        }
+    }
+    else
+    {
+        for(size_t x = 0; x < num_elements; ++x)
+        {
+            out[x] = in[x] * scale + offset;
+        }
+    }
+}
+} // namespace
+
+ModelFile::ModelFile()
+    : _mapping(nullptr), _size(0), _entries()
+{
+}
+
+void ModelFile::map(const std::string &path)
+{
+    const StartupScope startup_scope(StartupStage::WEIGHTS_LOAD, path);
+
+    const int fd = open(path.c_str(), O_RDONLY);
+    if(fd < 0)
+    {
+        ARM_COMPUTE_ERROR("Can't open the model file %s", path.c_str());
+    }
+
+    struct stat file_stat;
+    if(fstat(fd, &file_stat) != 0)
+    {
+        close(fd);
+        ARM_COMPUTE_ERROR("Can't read the size of the model file %s", path.c_str());
+    }
+
+    // A private mapping lets the imported tensors be written to without modifying the file: only the written pages are copied
+    const size_t size = file_stat.st_size;
+    void        *ptr  = (size > 0) ? mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0) : MAP_FAILED;
+    close(fd);
+    if(ptr == MAP_FAILED)
+    {
+        ARM_COMPUTE_ERROR("Can't map the model file %s", path.c_str());
+    }
+
+    _mapping = std::shared_ptr<uint8_t>(static_cast<uint8_t *>(ptr), [size](uint8_t *p)
+    {
+        munmap(p, size);
+    });
+    _size = size;
+    _entries.clear();
+
+    IndexReader reader(_mapping.get(), _size);
+    if(reader.read<uint32_t>() != model_magic)
+    {
+        ARM_COMPUTE_ERROR("%s is not a model file", path.c_str());
+    }
+    const uint32_t version = reader.read<uint32_t>();
+    if(version != 1 && version != model_version)
+    {
+        ARM_COMPUTE_ERROR("Unsupported version of the model file %s", path.c_str());
+    }
+
+    const uint32_t num_tensors = reader.read<uint32_t>();
+    for(uint32_t i = 0; i < num_tensors; ++i)
+    {
+        const uint32_t    name_length = reader.read<uint32_t>();
+        const std::string name        = reader.read_string(name_length);
+
+        Entry entry{ static_cast<DataType>(reader.read<uint32_t>()), reader.read<uint32_t>(), TensorShape(), 0, DataType::UNKNOWN, 1.f, 0.f };
+
+        const uint32_t num_dimensions = reader.read<uint32_t>();
+        if(num_dimensions > TensorShape::num_max_dimensions)
+        {
+            ARM_COMPUTE_ERROR("Invalid tensor %s in the model file", name.c_str());
+        }
+        for(uint32_t d = 0; d < num_dimensions; ++d)
+        {
+            entry.shape.set(d, reader.read<uint32_t>());
+        }
+        entry.offset       = reader.read<uint64_t>();
+        entry.storage_type = entry.data_type;
+        if(version >= 2)
+        {
+            entry.storage_type = static_cast<DataType>(reader.read<uint32_t>());
+            entry.scale        = reader.read<float>();
+            entry.value_offset = reader.read<float>();
+        }
+
+        if(entry.storage_type != entry.data_type && (entry.data_type != DataType::F32 || (entry.storage_type != DataType::F16 && entry.storage_type != DataType::U8)))
+        {
+            ARM_COMPUTE_ERROR("Invalid storage of the tensor %s in the model file", name.c_str());
+        }
+
+        const size_t tensor_size = stored_size(entry.shape, entry.num_channels, entry.storage_type);
+        if(entry.offset + tensor_size > _size)
+        {
+            ARM_COMPUTE_ERROR("The content of the tensor %s is beyond the end of the model file", name.c_str());
+        }
+
+        _entries.emplace(name, entry);
+    }
+}
+
+bool ModelFile::has_tensor(const std::string &name) const
+{
+    return _entries.find(name) != _entries.end();
+}
+
+TensorInfo ModelFile::tensor_info(const std::string &name) const
+{
+    const auto it = _entries.find(name);
+    if(it == _entries.end())
+    {
+        return TensorInfo();
+    }
+
+    return TensorInfo(it->second.shape, it->second.num_channels, it->second.data_type);
+}
+
+bool ModelFile::import_tensor(const std::string &name, Tensor &tensor) const
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() != nullptr);
+
+    const auto it = _entries.find(name);
+    if(it == _entries.end())
+    {
+        return false;
+    }
+
+    const Entry      &entry = it->second;
+    const TensorInfo &info  = *tensor.info();
+    if((entry.data_type != info.data_type()) || (entry.num_channels != info.num_channels()) || (entry.shape.num_dimensions() != info.num_dimensions())
+       || !std::equal(entry.shape.cbegin(), entry.shape.cbegin() + entry.shape.num_dimensions(), info.tensor_shape().cbegin()))
+    {
+        return false;
+    }
+
+    uint8_t *const content = _mapping.get() + entry.offset;
+
+    // The pages of the mapping are read when the tensor is first accessed if it is imported, here if it is copied
+    StartupScope startup_scope(StartupStage::WEIGHTS_LOAD, name);
+
+    if(entry.storage_type != entry.data_type)
+    {
+        // The content is expanded while it is copied: the pages of the mapping are read here
+        tensor.allocator()->allocate();
+        startup_scope.set_bytes(info.total_size());
+
+        const size_t row_elements = info.dimension(0) * info.num_channels();
+        const size_t row_size     = row_elements * element_size_from_data_type(entry.storage_type);
+        const Window window       = rows_window(info);
+        Iterator     out(&tensor, window);
+        const uint8_t *in = content;
+
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            expand_row(in, reinterpret_cast<float *>(out.ptr()), row_elements, entry.storage_type, entry.scale, entry.value_offset);
+            in += row_size;
+        },
+        out);
+    }
+    else if(is_dense(info))
+    {
+        // The tensor shares the ownership of the mapping
+        tensor.allocator()->import_memory(std::shared_ptr<uint8_t>(_mapping, content));
+    }
+    else
+    {
+        tensor.allocator()->allocate();
+        startup_scope.set_bytes(info.total_size());
+
+        const size_t row_size = info.dimension(0) * info.element_size();
+        const Window window   = rows_window(info);
+        Iterator     out(&tensor, window);
+        const uint8_t *in = content;
+
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            std::memcpy(out.ptr(), in, row_size);
+            in += row_size;
+        },
+        out);
+    }
+
+    return true;
+}
+
+bool ModelFile::import_stored_tensor(const std::string &name, Tensor &stored, float &scale, float &offset) const
+{
+    const auto it = _entries.find(name);
+    if(it == _entries.end())
+    {
+        return false;
+    }
+
+    const Entry &entry = it->second;
+    stored.allocator()->init(TensorInfo(entry.shape, entry.num_channels, entry.storage_type));
+    stored.allocator()->import_memory(std::shared_ptr<uint8_t>(_mapping, _mapping.get() + entry.offset));
+    scale  = entry.scale;
+    offset = entry.value_offset;
+
+    return true;
+}
+
+void ModelFile::save(const std::string &path, const std::vector<std::pair<std::string, const ITensor *>> &tensors, DataType storage_type)
+{
+    ARM_COMPUTE_ERROR_ON(storage_type != DataType::F32 && storage_type != DataType::F16 && storage_type != DataType::U8);
+
+    std::ofstream file(path, std::ios::binary);
+    if(!file.is_open())
+    {
+        ARM_COMPUTE_ERROR("Can't create the model file %s", path.c_str());
+    }
+
+    // Storage of each tensor: only the F32 weights are compressed, the U8 ones cover the range of the values of the tensor
+    struct Storage
+    {
+        DataType data_type;
+        float    scale;
+        float    offset;
+    };
+    std::vector<Storage> storages;
+    storages.reserve(tensors.size());
+
+    for(const auto &t : tensors)
+    {
+        const TensorInfo &info = *t.second->info();
+        Storage           storage{ info.data_type(), 1.f, 0.f };
+
+        if(info.data_type() == DataType::F32 && info.num_dimensions() > 1 && storage_type != DataType::F32)
+        {
+            storage.data_type = storage_type;
+        }
+
+        if(storage.data_type == DataType::U8 && info.data_type() == DataType::F32)
+        {
+            ARM_COMPUTE_ERROR_ON(t.second->buffer() == nullptr);
+
+            float        min_value    = std::numeric_limits<float>::max();
+            float        max_value    = std::numeric_limits<float>::lowest();
+            const size_t row_elements = info.dimension(0) * info.num_channels();
+            const Window window       = rows_window(info);
+            Iterator     in(t.second, window);
+
+            execute_window_loop(window, [&](const Coordinates &)
+            {
+                const auto row = reinterpret_cast<const float *>(in.ptr());
+                for(size_t x = 0; x < row_elements; ++x)
+                {
+                    min_value = std::min(min_value, row[x]);
+                    max_value = std::max(max_value, row[x]);
+                }
+            },
+            in);
+
+            storage.scale  = (max_value - min_value) / 255.f;
+            storage.offset = min_value;
+        }
+
+        storages.push_back(storage);
+    }
+
+    // Size of the index: the content of the first tensor starts after it
+    size_t index_size = 3 * sizeof(uint32_t);
+    for(const auto &t : tensors)
+    {
+        index_size += (5 + t.second->info()->num_dimensions()) * sizeof(uint32_t) + t.first.size() + sizeof(uint64_t) + 2 * sizeof(float);
+    }
+
+    write_value(file, model_magic);
+    write_value(file, model_version);
+    write_value(file, static_cast<uint32_t>(tensors.size()));
+
+    size_t offset = ceil_to_multiple(index_size, model_alignment);
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        const TensorInfo &info = *tensors[i].second->info();
+
+        write_value(file, static_cast<uint32_t>(tensors[i].first.size()));
+        file.write(tensors[i].first.data(), tensors[i].first.size());
+        write_value(file, static_cast<uint32_t>(info.data_type()));
+        write_value(file, static_cast<uint32_t>(info.num_channels()));
+        write_value(file, static_cast<uint32_t>(info.num_dimensions()));
+        for(size_t d = 0; d < info.num_dimensions(); ++d)
+        {
+            write_value(file, static_cast<uint32_t>(info.dimension(d)));
+        }
+        write_value(file, static_cast<uint64_t>(offset));
+        write_value(file, static_cast<uint32_t>(storages[i].data_type));
+        write_value(file, storages[i].scale);
+        write_value(file, storages[i].offset);
+
+        offset = ceil_to_multiple(offset + stored_size(info.tensor_shape(), info.num_channels(), storages[i].data_type), model_alignment);
+    }
+
+    // Write the content of the tensors without their padding
+    size_t               pos = index_size;
+    std::vector<uint8_t> compressed_row;
+    for(size_t i = 0; i < tensors.size(); ++i)
+    {
+        const ITensor *tensor = tensors[i].second;
+        ARM_COMPUTE_ERROR_ON(tensor->buffer() == nullptr);
+
+        const size_t aligned_pos = ceil_to_multiple(pos, model_alignment);
+        for(; pos < aligned_pos; ++pos)
+        {
+            file.put(0);
+        }
+
+        const TensorInfo &info          = *tensor->info();
+        const Storage    &storage       = storages[i];
+        const bool        is_compressed = storage.data_type != info.data_type();
+        const size_t      row_elements  = info.dimension(0) * info.num_channels();
+        const size_t      row_size      = row_elements * element_size_from_data_type(storage.data_type);
+        const Window      window        = rows_window(info);
+        Iterator          in(tensor, window);
+
+        compressed_row.resize(is_compressed ? row_size : 0);
+
+        execute_window_loop(window, [&](const Coordinates &)
+        {
+            if(is_compressed)
+            {
+                compress_row(reinterpret_cast<const float *>(in.ptr()), compressed_row.data(), row_elements, storage.data_type, storage.scale, storage.offset);
+                file.write(reinterpret_cast<const char *>(compressed_row.data()), row_size);
+            }
+            else
+            {
+                file.write(reinterpret_cast<const char *>(in.ptr()), row_size);
+            }
+        },
+        in);
+
+        pos += stored_size(info.tensor_shape(), info.num_channels(), storage.data_type);
+    }
+
+    if(!file)
+    {
+        ARM_COMPUTE_ERROR("Can't write the model file %s", path.c_str());
+    }
+}
@@ -23,10 +23,14 @@
  */
 #include "arm_compute/runtime/MultiImage.h"
 
+#include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
+#include <utility>
+#include <vector>
+
 using namespace arm_compute;
 
 MultiImage::MultiImage()
@@ -125,6 +129,9 @@ void MultiImage::internal_init(unsigned int width, unsigned int height, Format f
 
 void MultiImage::allocate()
 {
+    // All the planes share a single allocation
+    std::vector<TensorAllocator *> planes;
+
     switch(_info.format())
     {
         case Format::U8:
@@ -138,23 +145,50 @@ void MultiImage::allocate()
         case Format::RGBA8888:
         case Format::YUYV422:
         case Format::UYVY422:
-            std::get<0>(_plane).allocator()->allocate();
+            planes = { std::get<0>(_plane).allocator() };
             break;
         case Format::NV12:
         case Format::NV21:
-            std::get<0>(_plane).allocator()->allocate();
-            std::get<1>(_plane).allocator()->allocate();
+            planes = { std::get<0>(_plane).allocator(), std::get<1>(_plane).allocator() };
             break;
         case Format::IYUV:
         case Format::YUV444:
-            std::get<0>(_plane).allocator()->allocate();
-            std::get<1>(_plane).allocator()->allocate();
-            std::get<2>(_plane).allocator()->allocate();
+            planes = { std::get<0>(_plane).allocator(), std::get<1>(_plane).allocator(), std::get<2>(_plane).allocator() };
             break;
         default:
             ARM_COMPUTE_ERROR("Not supported");
             break;
     }
+
+    TensorAllocator::allocate_contiguous(planes);
+}
+
+void MultiImage::import_frame(unsigned int width, unsigned int height, Format format, std::shared_ptr<uint8_t> buffer, size_t stride, size_t uv_offset)
+{
+    ARM_COMPUTE_ERROR_ON(format != Format::NV12 && format != Format::NV21);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+    ARM_COMPUTE_ERROR_ON((width % 2) != 0 || (height % 2) != 0);
+    ARM_COMPUTE_ERROR_ON(stride < width);
+    ARM_COMPUTE_ERROR_ON(uv_offset < stride * height);
+
+    // Both planes have the rows of the frame: the end of the rows is their padding
+    TensorInfo info_y;
+    info_y.init(TensorShape(width, height), Format::U8, Strides(sizeof(uint8_t), stride), 0, stride * height);
+    info_y.set_fixed_padding(PaddingSize(0, stride - width, 0, 0));
+
+    TensorInfo info_uv88;
+    info_uv88.init(TensorShape(width / 2, height / 2), Format::UV88, Strides(2 * sizeof(uint8_t), stride), 0, stride * (height / 2));
+    info_uv88.set_fixed_padding(PaddingSize(0, (stride - width) / 2, 0, 0));
+
+    std::get<0>(_plane).allocator()->init(info_y);
+    std::get<1>(_plane).allocator()->init(info_uv88);
+
+    // The chroma plane shares the ownership of the frame
+    std::shared_ptr<uint8_t> uv_buffer(buffer, buffer.get() + uv_offset);
+    std::get<0>(_plane).allocator()->import_memory(std::move(buffer));
+    std::get<1>(_plane).allocator()->import_memory(std::move(uv_buffer));
+
+    _info.init(width, height, format);
 }
 
 void MultiImage::create_subimage(MultiImage *image, const Coordinates &coords, unsigned int width, unsigned int height)
@@ -162,6 +196,9 @@ void MultiImage::create_subimage(MultiImage *image, const Coordinates &coords, u
     arm_compute::Format format = image->info()->format();
     const TensorInfo    info(width, height, Format::U8);
 
+    // Coordinates of the sub-image in the planes subsampled by 2 in both directions
+    const Coordinates coords_sub2(coords.x() / 2, coords.y() / 2);
+
     switch(format)
     {
         case Format::U8:
@@ -185,21 +222,21 @@ void MultiImage::create_subimage(MultiImage *image, const Coordinates &coords, u
         {
             const TensorInfo info_uv88(width / 2, height / 2, Format::UV88);
             std::get<0>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(0))->allocator(), coords, info);
-            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(1))->allocator(), coords, info_uv88);
+            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(1))->allocator(), coords_sub2, info_uv88);
             break;
         }
         case Format::IYUV:
         {
             const TensorInfo info_sub2(width / 2, height / 2, Format::U8);
             std::get<0>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(0))->allocator(), coords, info);
-            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(1))->allocator(), coords, info_sub2);
-            std::get<2>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(2))->allocator(), coords, info_sub2);
+            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(1))->allocator(), coords_sub2, info_sub2);
+            std::get<2>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(2))->allocator(), coords_sub2, info_sub2);
             break;
         }
         case Format::YUV444:
             std::get<0>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(0))->allocator(), coords, info);
-            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(0))->allocator(), coords, info);
-            std::get<2>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(0))->allocator(), coords, info);
+            std::get<1>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(1))->allocator(), coords, info);
+            std::get<2>(_plane).allocator()->init(*dynamic_cast<Image *>(image->plane(2))->allocator(), coords, info);
             break;
         default:
             ARM_COMPUTE_ERROR("Not supported");
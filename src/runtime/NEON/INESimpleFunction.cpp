@@ -23,8 +23,11 @@
  */
 #include "arm_compute/runtime/NEON/INESimpleFunction.h"
 
+#include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 
 INESimpleFunction::INESimpleFunction()
@@ -37,3 +40,39 @@ void INESimpleFunction::run()
     _border_handler.run(_border_handler.window());
     NEScheduler::get().multithread(_kernel.get());
 }
+
+Window::Dimension INESimpleFunction::band_rows() const
+{
+    return _kernel->window().y();
+}
+
+BorderSize INESimpleFunction::band_border() const
+{
+    return _kernel->border_size();
+}
+
+void INESimpleFunction::run_band(unsigned int first_row, unsigned int last_row)
+{
+    const Window::Dimension rows   = _kernel->window().y();
+    const BorderSize        border = _kernel->border_size();
+    ARM_COMPUTE_UNUSED(rows);
+    ARM_COMPUTE_ERROR_ON(first_row >= last_row);
+    ARM_COMPUTE_ERROR_ON(static_cast<int>(first_row) < rows.start() || static_cast<int>(last_row) > rows.end());
+    ARM_COMPUTE_ERROR_ON((first_row - rows.start()) % rows.step() != 0);
+
+    // Only the rows of the input read by the band get their borders filled
+    _border_handler.run_rows(first_row - std::min(first_row, border.top), last_row + border.bottom);
+
+    Window band(_kernel->window());
+    band.set(Window::DimY, Window::Dimension(first_row, last_row, band.y().step()));
+    NEScheduler::get().multithread(_kernel.get(), band);
+}
+
+void INESimpleFunction::run_rows(unsigned int first_row, unsigned int last_row)
+{
+    Window band(_kernel->window());
+    ARM_COMPUTE_ERROR_ON(band.y().start() != 0 || band.y().step() != 1);
+
+    band.set(Window::DimY, Window::Dimension(first_row, std::min<int>(last_row, band.y().end()), 1));
+    NEScheduler::get().multithread(_kernel.get(), band);
+}
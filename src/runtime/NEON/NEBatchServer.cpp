@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEBatchServer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#include <algorithm>
+#include <cstring>
+#include <utility>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Copy a single input or output between the tensor of a caller and one slot of a batch
+ *
+ * The batch is the dimension just above the dimensions of the single tensor.
+ *
+ * @param[in,out] sample   Tensor of the caller.
+ * @param[in,out] batch    Input or output of a network.
+ * @param[in]     slot     Index of the sample in the batch.
+ * @param[in]     to_batch True to copy @p sample into the batch, false to copy the slot of the batch into @p sample.
+ */
+void copy_sample(const ITensor &sample, const ITensor &batch, size_t slot, bool to_batch)
+{
+    const TensorShape &shape     = sample.info()->tensor_shape();
+    const size_t       batch_dim = shape.num_dimensions();
+    const size_t       row_size  = shape[0] * sample.info()->element_size();
+
+    ARM_COMPUTE_ERROR_ON(sample.info()->data_type() != batch.info()->data_type());
+    ARM_COMPUTE_ERROR_ON(slot >= batch.info()->dimension(batch_dim));
+    ARM_COMPUTE_ERROR_ON(!std::equal(shape.cbegin(), shape.cbegin() + batch_dim, batch.info()->tensor_shape().cbegin()));
+
+    // One row along X at a time: the tensors may have different paddings
+    Window window;
+    window.use_tensor_dimensions(sample.info());
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        Coordinates batch_id = id;
+        batch_id.set(batch_dim, slot);
+
+        uint8_t *sample_ptr = sample.ptr_to_element(id);
+        uint8_t *batch_ptr  = batch.ptr_to_element(batch_id);
+
+        if(to_batch)
+        {
+            std::memcpy(batch_ptr, sample_ptr, row_size);
+        }
+        else
+        {
+            std::memcpy(sample_ptr, batch_ptr, row_size);
+        }
+    });
+}
+} // namespace
+
+NEBatchServer::NEBatchServer()
+    : _networks(), _queue(), _mutex(), _condition(), _max_delay(0), _is_running(false), _stop(false)
+#ifndef NO_MULTI_THREADING
+      ,
+      _thread()
+#endif /* NO_MULTI_THREADING */
+{
+}
+
+NEBatchServer::~NEBatchServer()
+{
+    stop();
+}
+
+void NEBatchServer::add_network(IFunction *network, ITensor *input, ITensor *output, size_t batch_size)
+{
+    ARM_COMPUTE_ERROR_ON(network == nullptr || input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON(batch_size == 0);
+    ARM_COMPUTE_ERROR_ON_MSG(_is_running, "Networks can't be added to a running server");
+
+    _networks.push_back(Network{ network, input, output, batch_size });
+
+    // Sorted by increasing batch size, so that the smallest batch holding the pending inputs is the first one found
+    std::stable_sort(_networks.begin(), _networks.end(), [](const Network & a, const Network & b)
+    {
+        return a.batch_size < b.batch_size;
+    });
+}
+
+void NEBatchServer::start(std::chrono::microseconds max_delay)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_networks.empty(), "No network has been added to the server");
+    ARM_COMPUTE_ERROR_ON_MSG(_is_running, "The server is already running");
+
+    _max_delay  = max_delay;
+    _stop       = false;
+    _is_running = true;
+
+#ifndef NO_MULTI_THREADING
+    _thread = std::thread(&NEBatchServer::serve, this);
+#endif /* NO_MULTI_THREADING */
+}
+
+void NEBatchServer::stop()
+{
+    if(!_is_running)
+    {
+        return;
+    }
+
+#ifndef NO_MULTI_THREADING
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _condition.notify_one();
+    _thread.join();
+#endif /* NO_MULTI_THREADING */
+
+    _is_running = false;
+}
+
+std::future<void> NEBatchServer::submit(const ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_running, "The server has not been started");
+
+    Request request{ input, output, std::promise<void>(), std::chrono::steady_clock::now() };
+    std::future<void> result = request.done.get_future();
+
+#ifndef NO_MULTI_THREADING
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _queue.push_back(std::move(request));
+    }
+    _condition.notify_one();
+#else  /* NO_MULTI_THREADING */
+    std::vector<Request> requests;
+    requests.push_back(std::move(request));
+    run_batch(requests);
+#endif /* NO_MULTI_THREADING */
+
+    return result;
+}
+
+void NEBatchServer::run_batch(std::vector<Request> &requests)
+{
+    auto network = std::find_if(_networks.begin(), _networks.end(), [&](const Network & n)
+    {
+        return n.batch_size >= requests.size();
+    });
+    if(network == _networks.end())
+    {
+        network = _networks.end() - 1;
+    }
+    ARM_COMPUTE_ERROR_ON(requests.size() > network->batch_size);
+
+    for(size_t slot = 0; slot < requests.size(); ++slot)
+    {
+        copy_sample(*requests[slot].input, *network->input, slot, true);
+    }
+
+    network->function->run();
+
+    for(size_t slot = 0; slot < requests.size(); ++slot)
+    {
+        copy_sample(*requests[slot].output, *network->output, slot, false);
+        requests[slot].done.set_value();
+    }
+}
+
+void NEBatchServer::serve()
+{
+    const size_t max_batch_size = _networks.back().batch_size;
+
+    std::unique_lock<std::mutex> lock(_mutex);
+    for(;;)
+    {
+        _condition.wait(lock, [&]()
+        {
+            return _stop || !_queue.empty();
+        });
+
+        if(_queue.empty())
+        {
+            // Stopped and nothing left to process
+            return;
+        }
+
+        // Wait for the batch to fill up, at most until the oldest input has waited for the maximum delay
+        const std::chrono::steady_clock::time_point deadline = _queue.front().arrival + _max_delay;
+        _condition.wait_until(lock, deadline, [&]()
+        {
+            return _stop || _queue.size() >= max_batch_size;
+        });
+
+        std::vector<Request> requests;
+        const size_t         batch_size = std::min(_queue.size(), max_batch_size);
+        for(size_t i = 0; i < batch_size; ++i)
+        {
+            requests.push_back(std::move(_queue.front()));
+            _queue.pop_front();
+        }
+
+        // New inputs can be submitted while the batch runs
+        lock.unlock();
+        run_batch(requests);
+        lock.lock();
+    }
+}
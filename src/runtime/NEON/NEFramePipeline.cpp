@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEFramePipeline.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/runtime/IFunction.h"
+
+#ifndef NO_MULTI_THREADING
+#include <future>
+#endif /* NO_MULTI_THREADING */
+
+using namespace arm_compute;
+
+NEFramePipeline::NEFramePipeline()
+    : _network(nullptr), _input(nullptr), _output(nullptr), _staging_input(), _staging_output()
+{
+}
+
+void NEFramePipeline::configure(IFunction *network, ITensor *input, ITensor *output)
+{
+    ARM_COMPUTE_ERROR_ON(network == nullptr || input == nullptr || output == nullptr);
+
+    _network = network;
+    _input   = input;
+    _output  = output;
+
+    _staging_input.allocator()->init(*input->info());
+    _staging_input.allocator()->allocate();
+    _staging_output.allocator()->init(*output->info());
+    _staging_output.allocator()->allocate();
+}
+
+void NEFramePipeline::run(unsigned int num_frames, const std::function<void(unsigned int, ITensor &)> &fill_input, const std::function<void(unsigned int, ITensor &)> &read_output)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_network == nullptr, "The pipeline has not been configured");
+
+    if(num_frames == 0)
+    {
+        return;
+    }
+
+    fill_input(0, _staging_input);
+
+    for(unsigned int frame = 0; frame < num_frames; ++frame)
+    {
+        _input->copy_from(_staging_input);
+
+        // While the network runs, the staging tensors are free: prefetch the next frame and read the result of the previous one
+        const auto prepare = [&]()
+        {
+            if(frame + 1 < num_frames)
+            {
+                fill_input(frame + 1, _staging_input);
+            }
+            if(frame > 0)
+            {
+                read_output(frame - 1, _staging_output);
+            }
+        };
+
+#ifndef NO_MULTI_THREADING
+        std::future<void> prepared = std::async(std::launch::async, prepare);
+        _network->run();
+        prepared.get();
+#else  /* NO_MULTI_THREADING */
+        _network->run();
+        prepare();
+#endif /* NO_MULTI_THREADING */
+
+        _staging_output.copy_from(*_output);
+    }
+
+    read_output(num_frames - 1, _staging_output);
+}
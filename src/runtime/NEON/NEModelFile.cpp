@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEModelFile.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/NEON/kernels/NEExpandWeightsKernel.h"
+#include "arm_compute/core/StartupProfiler.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+bool arm_compute::import_tensor_neon(const ModelFile &model, const std::string &name, Tensor &tensor)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() != nullptr);
+
+    const TensorInfo  model_info = model.tensor_info(name);
+    const TensorInfo &info       = *tensor.info();
+
+    Tensor stored;
+    float  scale  = 1.f;
+    float  offset = 0.f;
+    if(!model.import_stored_tensor(name, stored, scale, offset) || stored.info()->data_type() == model_info.data_type() || info.num_channels() != 1)
+    {
+        // Not in the model, or stored in its own data type: imported without any copy if possible
+        return model.import_tensor(name, tensor);
+    }
+
+    if((model_info.data_type() != info.data_type()) || (model_info.num_channels() != info.num_channels()) || (model_info.num_dimensions() != info.num_dimensions())
+       || !std::equal(model_info.tensor_shape().cbegin(), model_info.tensor_shape().cbegin() + model_info.num_dimensions(), info.tensor_shape().cbegin()))
+    {
+        return false;
+    }
+
+    const StartupScope startup_scope(StartupStage::WEIGHTS_LOAD, name, info.total_size());
+
+    tensor.allocator()->allocate();
+
+    NEExpandWeightsKernel kernel;
+    kernel.configure(&stored, &tensor, scale, offset);
+
+    // The rows are split along the largest dimension, e.g. the output feature maps of the weights of a convolution
+    size_t split_dimension = Window::DimY;
+    for(size_t d = Window::DimZ; d < info.num_dimensions(); ++d)
+    {
+        if(info.dimension(d) > info.dimension(split_dimension))
+        {
+            split_dimension = d;
+        }
+    }
+    NEScheduler::get().multithread(&kernel, split_dimension);
+
+    return true;
+}
@@ -0,0 +1,1475 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NENetwork.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/StartupProfiler.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/AllocationTracer.h"
+#include "arm_compute/runtime/ITiledFunction.h"
+#include "arm_compute/runtime/MemoryGroup.h"
+#include "arm_compute/runtime/NEON/NEModelFile.h"
+#include "arm_compute/runtime/NEON/functions/NEActivationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEConvolutionLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
+#include "arm_compute/runtime/NEON/functions/NENormalizationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
+#include "arm_compute/runtime/NEON/functions/NEPoolingNormalizationLayer.h"
+#include "arm_compute/runtime/NEON/functions/NESoftmaxLayer.h"
+#include "arm_compute/runtime/Profiler.h"
+#include "arm_compute/runtime/Scheduler.h"
+#include "arm_compute/runtime/Tracer.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <tuple>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Name of a layer used in the profiling reports, e.g. "3:convolution" */
+std::string layer_name(size_t index, LayerType type)
+{
+    static const char *const names[] = { "convolution", "activation", "pooling", "normalization", "fully_connected", "softmax" };
+
+    return std::to_string(index) + ":" + names[static_cast<int>(type)];
+}
+
+/** Name of the weights or biases of a layer in a model file, e.g. "3.weights" */
+std::string parameter_name(size_t index, bool is_weights)
+{
+    return std::to_string(index) + (is_weights ? ".weights" : ".biases");
+}
+
+/** Name of the reshaped weights of a layer in a plan, e.g. "3.reshaped": the function appends the name of their layout */
+std::string reshaped_weights_name(size_t index)
+{
+    return std::to_string(index) + ".reshaped";
+}
+
+/** Name of the description of the network in a plan */
+const std::string plan_network_name = "network";
+
+/** Version of the layout of the description of the network in a plan */
+constexpr uint32_t plan_version = 1;
+
+uint32_t float_to_bits(float value)
+{
+    uint32_t bits = 0;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+float bits_to_float(uint32_t bits)
+{
+    float value = 0.f;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+/** Sequential reader of the description of a network stored in a plan */
+class PlanReader
+{
+public:
+    PlanReader(const uint32_t *data, size_t size)
+        : _data(data), _size(size), _pos(0)
+    {
+    }
+
+    uint32_t read()
+    {
+        if(_pos >= _size)
+        {
+            ARM_COMPUTE_ERROR("Truncated network plan");
+        }
+        return _data[_pos++];
+    }
+
+    float read_float()
+    {
+        return bits_to_float(read());
+    }
+
+private:
+    const uint32_t *_data;
+    size_t          _size;
+    size_t          _pos;
+};
+
+void write_pad_stride_info(const PadStrideInfo &info, std::vector<uint32_t> &words)
+{
+    words.insert(words.end(), { info.stride().first, info.stride().second, info.pad().first, info.pad().second, static_cast<uint32_t>(info.round()) });
+}
+
+PadStrideInfo read_pad_stride_info(PlanReader &reader)
+{
+    const unsigned int stride_x = reader.read();
+    const unsigned int stride_y = reader.read();
+    const unsigned int pad_x    = reader.read();
+    const unsigned int pad_y    = reader.read();
+    return PadStrideInfo(stride_x, stride_y, pad_x, pad_y, static_cast<DimensionRoundingType>(reader.read()));
+}
+
+/** Append all the hyper-parameters of a layer to the description of a network, whatever its type */
+void write_layer_descriptor(const LayerDescriptor &desc, std::vector<uint32_t> &words)
+{
+    words.insert(words.end(), { static_cast<uint32_t>(desc.type), desc.kernel_size, desc.num_outputs, desc.num_groups, static_cast<uint32_t>(desc.has_bias) });
+    write_pad_stride_info(desc.conv_info, words);
+
+    words.insert(words.end(), { static_cast<uint32_t>(desc.act_info.enabled()), static_cast<uint32_t>(desc.act_info.activation()), float_to_bits(desc.act_info.a()),
+                                float_to_bits(desc.act_info.b()), static_cast<uint32_t>(desc.act_info.precision())
+                              });
+
+    words.insert(words.end(), { static_cast<uint32_t>(desc.pool_info.pool_type()), desc.pool_info.pool_size(), static_cast<uint32_t>(desc.pool_info.is_global_pooling()) });
+    write_pad_stride_info(desc.pool_info.pad_stride_info(), words);
+
+    words.insert(words.end(), { static_cast<uint32_t>(desc.norm_info.type()), desc.norm_info.norm_size(), float_to_bits(desc.norm_info.alpha()), float_to_bits(desc.norm_info.beta()),
+                                float_to_bits(desc.norm_info.kappa())
+                              });
+}
+
+/** Read a layer written by write_layer_descriptor() */
+LayerDescriptor read_layer_descriptor(PlanReader &reader)
+{
+    // The constructor of the descriptors is private: all the fields are overwritten
+    LayerDescriptor desc = LayerDescriptor::softmax();
+    desc.type            = static_cast<LayerType>(reader.read());
+    desc.kernel_size     = reader.read();
+    desc.num_outputs     = reader.read();
+    desc.num_groups      = reader.read();
+    desc.has_bias        = reader.read() != 0;
+    desc.conv_info       = read_pad_stride_info(reader);
+
+    const bool  act_enabled  = reader.read() != 0;
+    const auto  act_function = static_cast<ActivationLayerInfo::ActivationFunction>(reader.read());
+    const float act_a        = reader.read_float();
+    const float act_b        = reader.read_float();
+    const auto  precision    = static_cast<MathPrecision>(reader.read());
+    desc.act_info            = act_enabled ? ActivationLayerInfo(act_function, act_a, act_b, precision) : ActivationLayerInfo();
+
+    const auto          pool_type = static_cast<PoolingType>(reader.read());
+    const unsigned int  pool_size = reader.read();
+    const bool          is_global = reader.read() != 0;
+    const PadStrideInfo pool_conv = read_pad_stride_info(reader);
+    desc.pool_info                = is_global ? PoolingLayerInfo(pool_type) : PoolingLayerInfo(pool_type, pool_size, pool_conv);
+
+    const auto     norm_type = static_cast<NormType>(reader.read());
+    const uint32_t norm_size = reader.read();
+    const float    alpha     = reader.read_float();
+    const float    beta      = reader.read_float();
+    desc.norm_info           = NormalizationLayerInfo(norm_type, norm_size, alpha, beta, reader.read_float());
+
+    return desc;
+}
+} // namespace
+
+LayerDescriptor::LayerDescriptor(LayerType layer_type)
+    : type(layer_type), kernel_size(0), num_outputs(0), num_groups(1), has_bias(false), conv_info(), act_info(), pool_info(),
+      norm_info(NormType::CROSS_MAP)
+{
+}
+
+LayerDescriptor LayerDescriptor::convolution(unsigned int kernel_size, unsigned int num_outputs, const PadStrideInfo &conv_info, bool has_bias, unsigned int num_groups)
+{
+    LayerDescriptor desc(LayerType::CONVOLUTION);
+    desc.kernel_size = kernel_size;
+    desc.num_outputs = num_outputs;
+    desc.num_groups  = num_groups;
+    desc.has_bias    = has_bias;
+    desc.conv_info   = conv_info;
+    return desc;
+}
+
+LayerDescriptor LayerDescriptor::activation(const ActivationLayerInfo &act_info)
+{
+    LayerDescriptor desc(LayerType::ACTIVATION);
+    desc.act_info = act_info;
+    return desc;
+}
+
+LayerDescriptor LayerDescriptor::pooling(const PoolingLayerInfo &pool_info)
+{
+    LayerDescriptor desc(LayerType::POOLING);
+    desc.pool_info = pool_info;
+    return desc;
+}
+
+LayerDescriptor LayerDescriptor::normalization(const NormalizationLayerInfo &norm_info)
+{
+    LayerDescriptor desc(LayerType::NORMALIZATION);
+    desc.norm_info = norm_info;
+    return desc;
+}
+
+LayerDescriptor LayerDescriptor::fully_connected(unsigned int num_outputs, bool has_bias)
+{
+    LayerDescriptor desc(LayerType::FULLY_CONNECTED);
+    desc.num_outputs = num_outputs;
+    desc.has_bias    = has_bias;
+    return desc;
+}
+
+LayerDescriptor LayerDescriptor::softmax()
+{
+    return LayerDescriptor(LayerType::SOFTMAX);
+}
+
+NENetwork::NENetwork()
+    : _memory_planner(std::make_shared<MemoryPlanner>()), _input(), _layers(), _is_configured(false), _is_prepared(false), _has_run(false), _release_weights(false), _tile_working_set(0), _tiled_sequences(),
+      _tile_rows_done(), _tile_rows_needed(), _layer_observer(), _weights_prefetch_size(0), _prefetched_weights(), _prefetched_layer(0), _cache_warmer(), _is_incremental(false),
+      _previous_input(), _streamed_model(nullptr), _num_streamed_layers(0), _streaming_error(nullptr), _streaming_mutex(), _layer_streamed()
+#ifndef NO_MULTI_THREADING
+      ,
+      _loader()
+#endif /* NO_MULTI_THREADING */
+{
+}
+
+NENetwork::~NENetwork()
+{
+#ifndef NO_MULTI_THREADING
+    // The layers must not be destroyed while the loading thread imports their weights
+    if(_loader.joinable())
+    {
+        _loader.join();
+    }
+#endif /* NO_MULTI_THREADING */
+}
+
+void NENetwork::init(const TensorInfo &input_info)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured, "The network has already been configured");
+    ARM_COMPUTE_ERROR_ON(input_info.data_type() != DataType::F32);
+
+    _input.allocator()->init(input_info);
+}
+
+void NENetwork::set_tile_working_set(size_t working_set_size)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured, "The tiling must be set before the network is configured");
+
+    _tile_working_set = working_set_size;
+}
+
+void NENetwork::set_incremental(bool incremental)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured, "The incremental mode must be set before the network is configured");
+
+    _is_incremental = incremental;
+}
+
+void NENetwork::set_weights_prefetch(size_t prefetch_size)
+{
+    _weights_prefetch_size = prefetch_size;
+    _prefetched_weights.clear();
+}
+
+unsigned int NENetwork::add_layer(const LayerDescriptor &layer)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured, "Layers can't be added once the network has been configured");
+
+    Layer l{ layer, nullptr, nullptr, nullptr, nullptr, false, ActivationLayerInfo(), false, false, NormalizationLayerInfo(NormType::CROSS_MAP), false };
+    _layers.push_back(std::move(l));
+
+    return _layers.size() - 1;
+}
+
+void NENetwork::configure_layer(Tensor *input, bool input_is_flat, bool output_is_transient, Layer &layer)
+{
+    const LayerDescriptor &desc         = layer.descriptor;
+    const TensorInfo      *input_info   = input->info();
+    const DataType         data_type    = input_info->data_type();
+    TensorShape            output_shape = input_info->tensor_shape();
+
+    layer.output  = arm_compute::cpp14::make_unique<Tensor>();
+    layer.is_flat = input_is_flat;
+
+    // The output of an intermediate layer is only alive until the next layer has been configured
+    MemoryGroup memory_group(output_is_transient ? _memory_planner : nullptr);
+    memory_group.manage(layer.output.get());
+
+    switch(desc.type)
+    {
+        case LayerType::CONVOLUTION:
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(input_is_flat, "A convolution layer can't follow a fully connected layer");
+
+            unsigned int stride_x = 0;
+            unsigned int stride_y = 0;
+            unsigned int pad_x    = 0;
+            unsigned int pad_y    = 0;
+            std::tie(stride_x, stride_y) = desc.conv_info.stride();
+            std::tie(pad_x, pad_y)       = desc.conv_info.pad();
+
+            unsigned int conv_w = 0;
+            unsigned int conv_h = 0;
+            std::tie(conv_w, conv_h) = scaled_dimensions(input_info->dimension(0), input_info->dimension(1), desc.kernel_size,
+                                                         stride_x, stride_y, pad_x, pad_y, desc.conv_info.round());
+
+            layer.weights = arm_compute::cpp14::make_unique<Tensor>();
+            layer.weights->allocator()->init(TensorInfo(TensorShape(desc.kernel_size, desc.kernel_size, input_info->dimension(2) / desc.num_groups, desc.num_outputs), 1, data_type));
+
+            if(desc.has_bias)
+            {
+                layer.biases = arm_compute::cpp14::make_unique<Tensor>();
+                layer.biases->allocator()->init(TensorInfo(TensorShape(desc.num_outputs), 1, data_type));
+            }
+
+            output_shape.set(0, conv_w);
+            output_shape.set(1, conv_h);
+            output_shape.set(2, desc.num_outputs);
+            layer.output->allocator()->init(TensorInfo(output_shape, 1, data_type));
+
+            // The im2col output of a convolution run in bands is alive while the following layers run
+            auto f = arm_compute::cpp14::make_unique<NEConvolutionLayer>(layer.may_be_tiled ? nullptr : _memory_planner);
+            f->configure(input, layer.weights.get(), layer.biases.get(), layer.output.get(), desc.conv_info, layer.fused_act_info, desc.num_groups);
+            layer.function = std::move(f);
+            break;
+        }
+        case LayerType::ACTIVATION:
+        {
+            layer.output->allocator()->init(TensorInfo(output_shape, 1, data_type));
+
+            auto f = arm_compute::cpp14::make_unique<NEActivationLayer>();
+            f->configure(input, layer.output.get(), desc.act_info);
+            layer.function = std::move(f);
+            break;
+        }
+        case LayerType::POOLING:
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(input_is_flat, "A pooling layer can't follow a fully connected layer");
+
+            const PadStrideInfo pad_stride_info = desc.pool_info.pad_stride_info();
+            unsigned int        stride_x        = 0;
+            unsigned int        stride_y        = 0;
+            unsigned int        pad_x           = 0;
+            unsigned int        pad_y           = 0;
+            std::tie(stride_x, stride_y) = pad_stride_info.stride();
+            std::tie(pad_x, pad_y)       = pad_stride_info.pad();
+
+            // Global pooling reduces each feature map to a single value
+            unsigned int pooled_w = 1;
+            unsigned int pooled_h = 1;
+            if(!desc.pool_info.is_global_pooling())
+            {
+                std::tie(pooled_w, pooled_h) = scaled_dimensions(input_info->dimension(0), input_info->dimension(1), desc.pool_info.pool_size(),
+                                                                 stride_x, stride_y, pad_x, pad_y, pad_stride_info.round());
+            }
+
+            output_shape.set(0, pooled_w);
+            output_shape.set(1, pooled_h);
+            layer.output->allocator()->init(TensorInfo(output_shape, 1, data_type));
+
+            if(layer.has_fused_norm)
+            {
+                auto f = arm_compute::cpp14::make_unique<NEPoolingNormalizationLayer>();
+                f->configure(input, layer.output.get(), desc.pool_info, layer.fused_norm_info);
+                layer.function = std::move(f);
+            }
+            else
+            {
+                auto f = arm_compute::cpp14::make_unique<NEPoolingLayer>();
+                f->configure(input, layer.output.get(), desc.pool_info);
+                layer.function = std::move(f);
+            }
+            break;
+        }
+        case LayerType::NORMALIZATION:
+        {
+            layer.output->allocator()->init(TensorInfo(output_shape, 1, data_type));
+
+            auto f = arm_compute::cpp14::make_unique<NENormalizationLayer>(_memory_planner);
+            f->configure(input, layer.output.get(), desc.norm_info);
+            layer.function = std::move(f);
+            break;
+        }
+        case LayerType::FULLY_CONNECTED:
+        {
+            // The input of a fully connected layer following a convolution is linearized: [width, height, IFM, batches] -> [width * height * IFM, batches]
+            const size_t num_batch_dims = input_is_flat ? 1 : 3;
+            size_t       num_inputs     = input_info->dimension(0);
+            if(!input_is_flat)
+            {
+                num_inputs *= input_info->dimension(1) * input_info->dimension(2);
+            }
+
+            TensorShape fc_output_shape(desc.num_outputs);
+            for(size_t d = num_batch_dims; d < input_info->num_dimensions(); ++d)
+            {
+                fc_output_shape.set(d - num_batch_dims + 1, input_info->dimension(d));
+            }
+
+            layer.weights = arm_compute::cpp14::make_unique<Tensor>();
+            layer.weights->allocator()->init(TensorInfo(TensorShape(num_inputs, desc.num_outputs), 1, data_type));
+
+            if(desc.has_bias)
+            {
+                layer.biases = arm_compute::cpp14::make_unique<Tensor>();
+                layer.biases->allocator()->init(TensorInfo(TensorShape(desc.num_outputs), 1, data_type));
+            }
+
+            layer.output->allocator()->init(TensorInfo(fc_output_shape, 1, data_type));
+            layer.is_flat = true;
+
+            auto f = arm_compute::cpp14::make_unique<NEFullyConnectedLayer>(_memory_planner);
+            f->configure(input, layer.weights.get(), layer.biases.get(), layer.output.get(), true, layer.fused_act_info);
+            layer.function = std::move(f);
+            break;
+        }
+        case LayerType::SOFTMAX:
+        {
+            layer.output->allocator()->init(TensorInfo(output_shape, 1, data_type));
+
+            auto f = arm_compute::cpp14::make_unique<NESoftmaxLayer>(_memory_planner);
+            f->configure(input, layer.output.get());
+            layer.function = std::move(f);
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Layer type not supported");
+    }
+}
+
+void NENetwork::configure(const ModelFile *model, bool release_weights, bool stream_weights)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured, "The network has already been configured");
+    ARM_COMPUTE_ERROR_ON_MSG(stream_weights && model == nullptr, "Only the weights of a model file can be streamed");
+    ARM_COMPUTE_ERROR_ON_MSG(_layers.empty(), "The network doesn't have any layer");
+    ARM_COMPUTE_ERROR_ON_MSG(_input.info()->total_size() == 0, "The input of the network has not been initialised");
+
+    // Fuse the activation layers into the convolution or fully connected layer they follow
+    for(size_t i = 1; i < _layers.size(); ++i)
+    {
+        const LayerType previous_type = _layers[i - 1].descriptor.type;
+
+        if(_layers[i].descriptor.type == LayerType::ACTIVATION && (previous_type == LayerType::CONVOLUTION || previous_type == LayerType::FULLY_CONNECTED))
+        {
+            _layers[i - 1].fused_act_info = _layers[i].descriptor.act_info;
+            _layers[i].is_fused           = true;
+        }
+    }
+
+    // Fuse the cross map normalization layers into the max pooling layer they follow, if the fused kernel supports the pooling
+    for(size_t i = 1; i < _layers.size(); ++i)
+    {
+        const LayerDescriptor &previous = _layers[i - 1].descriptor;
+        const LayerDescriptor &current  = _layers[i].descriptor;
+
+        const bool is_supported_pooling = (previous.type == LayerType::POOLING) && !_layers[i - 1].is_fused && (previous.pool_info.pool_type() == PoolingType::MAX)
+                                          && (previous.pool_info.pool_size() == 2 || previous.pool_info.pool_size() == 3)
+                                          && (previous.pool_info.pad_stride_info().stride().first == 1 || previous.pool_info.pad_stride_info().stride().first == 2);
+
+        if(is_supported_pooling && current.type == LayerType::NORMALIZATION && current.norm_info.type() == NormType::CROSS_MAP)
+        {
+            _layers[i - 1].has_fused_norm  = true;
+            _layers[i - 1].fused_norm_info = current.norm_info;
+            _layers[i].is_fused            = true;
+        }
+    }
+
+    // The convolution and pooling layers next to each other might run band by band: they are only known to support it once configured,
+    // so all of them keep their tensors alive for the whole run of the network
+    if(_tile_working_set > 0 || _is_incremental)
+    {
+        const auto is_candidate = [](const Layer & l)
+        {
+            return !l.is_fused && (l.descriptor.type == LayerType::CONVOLUTION || l.descriptor.type == LayerType::POOLING);
+        };
+
+        int previous = -1;
+        for(size_t i = 0; i < _layers.size(); ++i)
+        {
+            if(_layers[i].is_fused)
+            {
+                continue;
+            }
+            if(previous >= 0 && is_candidate(_layers[previous]) && is_candidate(_layers[i]))
+            {
+                _layers[previous].may_be_tiled = true;
+                _layers[i].may_be_tiled        = true;
+            }
+            previous = i;
+        }
+    }
+
+    // The output of the last layer which is not fused is the output of the network
+    const Layer *last_layer = &*std::find_if(_layers.rbegin(), _layers.rend(), [](const Layer & l)
+    {
+        return !l.is_fused;
+    });
+
+    Tensor *input         = &_input;
+    bool    input_is_flat = false;
+
+    for(auto &layer : _layers)
+    {
+        if(layer.is_fused)
+        {
+            continue;
+        }
+
+        {
+            const StartupFunctionScope function_scope(layer_name(&layer - _layers.data(), layer.descriptor.type));
+            const StartupScope         configure_scope(StartupStage::CONFIGURE);
+
+            // In incremental mode, the rows which are not recomputed are read from the output of the previous run
+            configure_layer(input, input_is_flat, &layer != last_layer && !layer.may_be_tiled && !_is_incremental, layer);
+        }
+
+        // The output of the previous layer is not used by any other layer: end its lifetime
+        if(input != &_input)
+        {
+            input->allocator()->allocate();
+        }
+
+        input         = layer.output.get();
+        input_is_flat = layer.is_flat;
+    }
+
+    // Allocate the tensors once all the functions have been configured: their padding requirements are now known
+    _input.allocator()->allocate();
+    input->allocator()->allocate();
+
+    if(_is_incremental)
+    {
+        // Same padding as the input: both are compared row by row
+        _previous_input.allocator()->init(*_input.info());
+        _previous_input.allocator()->allocate();
+    }
+
+    if(!stream_weights)
+    {
+        for(size_t i = 0; i < _layers.size(); ++i)
+        {
+            import_parameters(i, model);
+        }
+    }
+
+    // Bind the intermediate tensors of all the layers to the shared arena
+    _memory_planner->allocate();
+
+    plan_tiled_sequences();
+
+    _is_configured   = true;
+    _release_weights = release_weights;
+
+    if(stream_weights)
+    {
+        _streamed_model      = model;
+        _num_streamed_layers = 0;
+        _streaming_error     = nullptr;
+#ifndef NO_MULTI_THREADING
+        _loader = std::thread(&NENetwork::stream_parameters, this);
+#endif /* NO_MULTI_THREADING */
+    }
+}
+
+void NENetwork::import_parameters(size_t index, const ModelFile *model)
+{
+    const StartupFunctionScope function_scope(layer_name(index, _layers[index].descriptor.type));
+
+    for(Tensor *tensor : { _layers[index].weights.get(), _layers[index].biases.get() })
+    {
+        if(tensor == nullptr)
+        {
+            continue;
+        }
+
+        // The weights of the model are used without any copy when they don't need padding
+        const std::string name = parameter_name(index, tensor == _layers[index].weights.get());
+        if(model == nullptr || !import_tensor_neon(*model, name, *tensor))
+        {
+            tensor->allocator()->allocate();
+        }
+    }
+}
+
+void NENetwork::stream_layer(size_t index)
+{
+    Layer &layer = _layers[index];
+
+    import_parameters(index, _streamed_model);
+
+    // The reshape of the weights is part of the loading: the first run of the layer then only computes its output
+    if(!layer.is_fused)
+    {
+        const StartupFunctionScope function_scope(layer_name(index, layer.descriptor.type));
+        const StartupScope         first_run_scope(StartupStage::FIRST_RUN, "prepare");
+
+        layer.function->prepare();
+    }
+}
+
+void NENetwork::stream_parameters()
+{
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        try
+        {
+            stream_layer(i);
+        }
+        catch(...)
+        {
+            // The layers waiting for their weights fail with the same error
+            std::lock_guard<std::mutex> lock(_streaming_mutex);
+            _streaming_error     = std::current_exception();
+            _num_streamed_layers = _layers.size();
+            _layer_streamed.notify_all();
+            return;
+        }
+
+        std::lock_guard<std::mutex> lock(_streaming_mutex);
+        ++_num_streamed_layers;
+        _layer_streamed.notify_all();
+    }
+}
+
+void NENetwork::wait_for_layer(size_t index)
+{
+    if(_streamed_model == nullptr)
+    {
+        return;
+    }
+
+#ifndef NO_MULTI_THREADING
+    std::unique_lock<std::mutex> lock(_streaming_mutex);
+    _layer_streamed.wait(lock, [&]()
+    {
+        return _num_streamed_layers > index;
+    });
+
+    if(_streaming_error != nullptr)
+    {
+        std::rethrow_exception(_streaming_error);
+    }
+#else  /* NO_MULTI_THREADING */
+    // The layers are loaded by the thread running the network, just before they run for the first time
+    for(; _num_streamed_layers <= index; ++_num_streamed_layers)
+    {
+        stream_layer(_num_streamed_layers);
+    }
+#endif /* NO_MULTI_THREADING */
+}
+
+void NENetwork::finish_streaming()
+{
+    if(_streamed_model == nullptr)
+    {
+        return;
+    }
+
+    wait_for_layer(_layers.size() - 1);
+
+#ifndef NO_MULTI_THREADING
+    _loader.join();
+#endif /* NO_MULTI_THREADING */
+    _streamed_model = nullptr;
+}
+
+unsigned int NENetwork::num_layers() const
+{
+    return _layers.size();
+}
+
+Tensor *NENetwork::input()
+{
+    return &_input;
+}
+
+Tensor *NENetwork::output()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    const auto it = std::find_if(_layers.rbegin(), _layers.rend(), [](const Layer & l)
+    {
+        return !l.is_fused;
+    });
+
+    return it->output.get();
+}
+
+Tensor *NENetwork::weights(unsigned int layer)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+    ARM_COMPUTE_ERROR_ON(layer >= _layers.size());
+
+    // The weights may be written through the returned tensor: the next run computes all the rows again
+    _has_run = false;
+
+    return _layers[layer].weights.get();
+}
+
+Tensor *NENetwork::biases(unsigned int layer)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+    ARM_COMPUTE_ERROR_ON(layer >= _layers.size());
+
+    // The biases may be written through the returned tensor: the next run computes all the rows again
+    _has_run = false;
+
+    return _layers[layer].biases.get();
+}
+
+std::vector<std::pair<std::string, const ITensor *>> NENetwork::parameters() const
+{
+    std::vector<std::pair<std::string, const ITensor *>> tensors;
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        if(_layers[i].weights != nullptr)
+        {
+            tensors.emplace_back(parameter_name(i, true), _layers[i].weights.get());
+        }
+        if(_layers[i].biases != nullptr)
+        {
+            tensors.emplace_back(parameter_name(i, false), _layers[i].biases.get());
+        }
+    }
+    return tensors;
+}
+
+void NENetwork::save_weights(const std::string &path, DataType storage_type) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+    ARM_COMPUTE_ERROR_ON_MSG(_streamed_model != nullptr, "The weights are being streamed");
+
+    ModelFile::save(path, parameters(), storage_type);
+}
+
+void NENetwork::save_plan(const std::string &path, DataType storage_type)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    finish_streaming();
+
+    // Description of the network: everything configure() needs to create the same tensors and functions
+    const TensorShape    &input_shape = _input.info()->tensor_shape();
+    std::vector<uint32_t> words{ plan_version, static_cast<uint32_t>(input_shape.num_dimensions()) };
+    words.insert(words.end(), input_shape.cbegin(), input_shape.cbegin() + input_shape.num_dimensions());
+    words.insert(words.end(), { static_cast<uint32_t>(static_cast<uint64_t>(_tile_working_set) & 0xFFFFFFFF), static_cast<uint32_t>(static_cast<uint64_t>(_tile_working_set) >> 32),
+                                static_cast<uint32_t>(_layers.size())
+                              });
+    for(const auto &layer : _layers)
+    {
+        write_layer_descriptor(layer.descriptor, words);
+    }
+
+    Tensor network;
+    network.allocator()->init(TensorInfo(TensorShape(words.size()), 1, DataType::U32));
+    network.allocator()->allocate();
+    std::memcpy(network.buffer(), words.data(), words.size() * sizeof(uint32_t));
+
+    std::vector<std::pair<std::string, const ITensor *>> tensors = parameters();
+    tensors.emplace_back(plan_network_name, &network);
+
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        if(_layers[i].descriptor.type == LayerType::CONVOLUTION)
+        {
+            static_cast<NEConvolutionLayer *>(_layers[i].function.get())->export_reshaped_weights(reshaped_weights_name(i), tensors);
+        }
+        else if(_layers[i].descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            static_cast<NEFullyConnectedLayer *>(_layers[i].function.get())->export_reshaped_weights(reshaped_weights_name(i), tensors);
+        }
+    }
+
+    ModelFile::save(path, tensors, storage_type);
+}
+
+bool NENetwork::load_plan(const ModelFile &plan, bool release_weights)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_configured || !_layers.empty(), "The network is not empty");
+
+    const TensorInfo network_info = plan.tensor_info(plan_network_name);
+    if(network_info.data_type() != DataType::U32 || network_info.num_dimensions() != 1)
+    {
+        ARM_COMPUTE_ERROR("The model file is not a network plan");
+    }
+
+    // The description is read straight from the mapping
+    Tensor network;
+    network.allocator()->init(network_info);
+    plan.import_tensor(plan_network_name, network);
+
+    PlanReader reader(reinterpret_cast<const uint32_t *>(network.buffer()), network_info.dimension(0));
+    if(reader.read() != plan_version)
+    {
+        ARM_COMPUTE_ERROR("Unsupported version of the network plan");
+    }
+
+    const uint32_t num_dimensions = reader.read();
+    if(num_dimensions > TensorShape::num_max_dimensions)
+    {
+        ARM_COMPUTE_ERROR("Invalid input in the network plan");
+    }
+    TensorShape input_shape;
+    for(uint32_t d = 0; d < num_dimensions; ++d)
+    {
+        input_shape.set(d, reader.read());
+    }
+    init(TensorInfo(input_shape, 1, DataType::F32));
+
+    const uint64_t working_set_low  = reader.read();
+    const uint64_t working_set_high = reader.read();
+    set_tile_working_set(static_cast<size_t>(working_set_low | (working_set_high << 32)));
+
+    const uint32_t num_layers = reader.read();
+    for(uint32_t i = 0; i < num_layers; ++i)
+    {
+        add_layer(read_layer_descriptor(reader));
+    }
+
+    configure(&plan, release_weights);
+
+    // A layer configured with another algorithm than the one which reshaped the stored weights doesn't find them: it reshapes its weights on the first run
+    bool is_imported = true;
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        if(_layers[i].descriptor.type == LayerType::CONVOLUTION)
+        {
+            is_imported = static_cast<NEConvolutionLayer *>(_layers[i].function.get())->import_reshaped_weights(plan, reshaped_weights_name(i)) && is_imported;
+        }
+        else if(_layers[i].descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            is_imported = static_cast<NEFullyConnectedLayer *>(_layers[i].function.get())->import_reshaped_weights(plan, reshaped_weights_name(i)) && is_imported;
+        }
+    }
+
+    return is_imported;
+}
+
+void NENetwork::export_reshaped_weights(std::ostream &stream)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    finish_streaming();
+
+    for(auto &layer : _layers)
+    {
+        if(layer.descriptor.type == LayerType::CONVOLUTION)
+        {
+            static_cast<NEConvolutionLayer *>(layer.function.get())->export_reshaped_weights(stream);
+        }
+        else if(layer.descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            static_cast<NEFullyConnectedLayer *>(layer.function.get())->export_reshaped_weights(stream);
+        }
+    }
+}
+
+bool NENetwork::import_reshaped_weights(std::istream &stream)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    finish_streaming();
+    _prefetched_weights.clear();
+
+    // The outputs of the previous run were computed with other weights
+    _has_run = false;
+
+    // The blobs are read in the order they were written: stop at the first one which doesn't match, the following layers reshape their weights on the first run
+    for(auto &layer : _layers)
+    {
+        bool is_loaded = true;
+        if(layer.descriptor.type == LayerType::CONVOLUTION)
+        {
+            is_loaded = static_cast<NEConvolutionLayer *>(layer.function.get())->import_reshaped_weights(stream);
+        }
+        else if(layer.descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            is_loaded = static_cast<NEFullyConnectedLayer *>(layer.function.get())->import_reshaped_weights(stream);
+        }
+
+        if(!is_loaded)
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+bool NENetwork::share_reshaped_weights(NENetwork &source)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured || !source._is_configured, "The networks have not been configured");
+    ARM_COMPUTE_ERROR_ON(_layers.size() != source._layers.size());
+
+    finish_streaming();
+    source.finish_streaming();
+    _prefetched_weights.clear();
+
+    // The outputs of the previous run were computed with other weights
+    _has_run = false;
+
+    bool is_shared = true;
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        ARM_COMPUTE_ERROR_ON(_layers[i].descriptor.type != source._layers[i].descriptor.type);
+
+        if(_layers[i].descriptor.type == LayerType::CONVOLUTION)
+        {
+            auto conv        = static_cast<NEConvolutionLayer *>(_layers[i].function.get());
+            auto source_conv = static_cast<NEConvolutionLayer *>(source._layers[i].function.get());
+            is_shared        = conv->share_reshaped_weights(*source_conv) && is_shared;
+        }
+        else if(_layers[i].descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            auto fc        = static_cast<NEFullyConnectedLayer *>(_layers[i].function.get());
+            auto source_fc = static_cast<NEFullyConnectedLayer *>(source._layers[i].function.get());
+            is_shared      = fc->use_shared_weights(source_fc->shared_weights()) && is_shared;
+        }
+    }
+
+    return is_shared;
+}
+
+void NENetwork::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+    ARM_COMPUTE_TRACE_SCOPE("NENetwork::run");
+
+    // Only the first run allocates (See AllocationTracer): the steady state ones are checked when the library counts the allocations
+    const AllocationScope allocation_scope("NENetwork::run", _has_run && AllocationTracer::is_enabled());
+
+    const bool is_profiling = Profiler::get().is_enabled();
+
+    // Only the outputs of a previous run can be updated: prepare() reshapes the weights without computing any output
+    if(_is_incremental && _has_run)
+    {
+        const std::pair<unsigned int, unsigned int> changed_rows = update_previous_input();
+        run_changed_rows(changed_rows.first, changed_rows.second);
+        _has_run = true;
+
+        Scheduler::get().end_inference();
+        return;
+    }
+
+    // The weights are reshaped, and the unused ones released, by the first run
+    const bool is_prefetching = _is_prepared && _weights_prefetch_size != 0;
+
+    auto sequence = _tiled_sequences.cbegin();
+
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        if(sequence != _tiled_sequences.cend() && sequence->layers.front() == i)
+        {
+            if(is_prefetching)
+            {
+                prefetch_next_weights(sequence->layers.back());
+            }
+
+            // The bands interleave the layers of the sequence: all of them need their weights
+            wait_for_layer(sequence->layers.back());
+            run_tiled_sequence(*sequence);
+            if(_layer_observer != nullptr)
+            {
+                for(size_t index : sequence->layers)
+                {
+                    _layer_observer(static_cast<unsigned int>(index), *_layers[index].output);
+                }
+            }
+            i = sequence->layers.back();
+            ++sequence;
+            continue;
+        }
+
+        if(!_layers[i].is_fused)
+        {
+            if(is_profiling)
+            {
+                Profiler::get().set_layer(layer_name(i, _layers[i].descriptor.type));
+            }
+            ARM_COMPUTE_TRACE_SCOPE(layer_name(i, _layers[i].descriptor.type));
+
+            if(is_prefetching)
+            {
+                prefetch_next_weights(i);
+            }
+
+            wait_for_layer(i);
+
+            if(!_is_prepared)
+            {
+                // The first run absorbs the one-time work of the functions which have not been prepared
+                const StartupFunctionScope function_scope(layer_name(i, _layers[i].descriptor.type));
+                const StartupScope         first_run_scope(StartupStage::FIRST_RUN);
+
+                _layers[i].function->run();
+            }
+            else
+            {
+                _layers[i].function->run();
+            }
+            release_unused_weights(_layers[i]);
+
+            if(_layer_observer != nullptr)
+            {
+                _layer_observer(static_cast<unsigned int>(i), *_layers[i].output);
+            }
+        }
+    }
+
+    if(is_profiling)
+    {
+        Profiler::get().set_layer("");
+    }
+
+    if(is_prefetching)
+    {
+        // The weights must not be read once the run has returned: the user may modify or destroy them
+        _cache_warmer.cancel();
+        _prefetched_layer = 0;
+    }
+
+    finish_streaming();
+
+    // Listing the weights to read ahead allocates: it is done once, by the first run
+    if(_weights_prefetch_size != 0 && _prefetched_weights.empty())
+    {
+        plan_weights_prefetch();
+    }
+
+    _is_prepared = true;
+    _has_run     = true;
+
+    if(_is_incremental)
+    {
+        // The next run only recomputes the rows which differ from this input
+        _previous_input.copy_from(_input);
+    }
+
+    Scheduler::get().end_inference();
+}
+
+void NENetwork::prepare()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    finish_streaming();
+
+    for(auto &layer : _layers)
+    {
+        if(!layer.is_fused)
+        {
+            const StartupFunctionScope function_scope(layer_name(&layer - _layers.data(), layer.descriptor.type));
+            const StartupScope         first_run_scope(StartupStage::FIRST_RUN, "prepare");
+
+            layer.function->prepare();
+            release_unused_weights(layer);
+        }
+    }
+
+    _is_prepared = true;
+}
+
+void NENetwork::release_unused_weights(Layer &layer)
+{
+    // The weights are not read again once the layer has reshaped them
+    Tensor *weights = layer.weights.get();
+    if(_release_weights && weights != nullptr && !weights->is_used() && weights->buffer() != nullptr)
+    {
+        weights->allocator()->free();
+    }
+}
+
+void NENetwork::plan_weights_prefetch()
+{
+    _prefetched_weights.resize(_layers.size());
+
+    size_t max_num_ranges = 0;
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        const Layer &layer = _layers[i];
+        if(layer.is_fused)
+        {
+            continue;
+        }
+
+        // The original weights are still read by the layers which don't reshape them, the others read their reshaped weights
+        std::vector<std::pair<std::string, const ITensor *>> tensors;
+        if(layer.weights != nullptr && layer.weights->is_used())
+        {
+            tensors.emplace_back(parameter_name(i, true), layer.weights.get());
+        }
+        if(layer.descriptor.type == LayerType::CONVOLUTION)
+        {
+            static_cast<NEConvolutionLayer *>(layer.function.get())->export_reshaped_weights(reshaped_weights_name(i), tensors);
+        }
+        else if(layer.descriptor.type == LayerType::FULLY_CONNECTED)
+        {
+            static_cast<NEFullyConnectedLayer *>(layer.function.get())->export_reshaped_weights(reshaped_weights_name(i), tensors);
+        }
+
+        size_t remaining = _weights_prefetch_size;
+        for(const auto &tensor : tensors)
+        {
+            const size_t size = std::min(remaining, tensor.second->info()->total_size());
+            if(tensor.second->buffer() != nullptr && size != 0)
+            {
+                _prefetched_weights[i].emplace_back(tensor.second->buffer(), size);
+                remaining -= size;
+            }
+        }
+        max_num_ranges = std::max(max_num_ranges, _prefetched_weights[i].size());
+    }
+
+    // The warmer doesn't allocate anymore once it has the memory of the largest request
+    _cache_warmer.reserve(max_num_ranges);
+}
+
+void NENetwork::prefetch_next_weights(size_t index)
+{
+    if(_prefetched_weights.empty())
+    {
+        plan_weights_prefetch();
+    }
+
+    size_t next = index + 1;
+    while(next < _layers.size() && _prefetched_weights[next].empty())
+    {
+        ++next;
+    }
+
+    // The weights of the next layer keep being read while the layers without weights run
+    if(next < _layers.size() && next != _prefetched_layer)
+    {
+        _prefetched_layer = next;
+        _cache_warmer.warm(_prefetched_weights[next]);
+    }
+}
+
+std::pair<unsigned int, unsigned int> NENetwork::update_previous_input()
+{
+    const TensorInfo *info      = _input.info();
+    const size_t      row_size  = info->dimension(0) * info->element_size();
+    unsigned int      first_row = info->dimension(1);
+    unsigned int      last_row  = 0;
+
+    Window window;
+    window.use_tensor_dimensions(info);
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+
+    Iterator input(&_input, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        // Both tensors have the same strides
+        uint8_t *previous = _previous_input.buffer() + (input.ptr() - _input.buffer());
+
+        if(std::memcmp(input.ptr(), previous, row_size) != 0)
+        {
+            std::memcpy(previous, input.ptr(), row_size);
+            first_row = std::min(first_row, static_cast<unsigned int>(id.y()));
+            last_row  = std::max(last_row, static_cast<unsigned int>(id.y()) + 1);
+        }
+    },
+    input);
+
+    return std::make_pair(std::min(first_row, last_row), last_row);
+}
+
+void NENetwork::run_changed_rows(unsigned int first_row, unsigned int last_row)
+{
+    const bool is_profiling = Profiler::get().is_enabled();
+
+    // Rows of the input of the current layer which changed: all of them once a layer has run in full
+    bool all_rows_changed = false;
+
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        Layer &layer = _layers[i];
+        if(layer.is_fused)
+        {
+            continue;
+        }
+
+        if(all_rows_changed || first_row < last_row)
+        {
+            if(is_profiling)
+            {
+                Profiler::get().set_layer(layer_name(i, layer.descriptor.type));
+            }
+            ARM_COMPUTE_TRACE_SCOPE(layer_name(i, layer.descriptor.type));
+
+            auto *tiled = dynamic_cast<ITiledFunction *>(layer.function.get());
+            if(!all_rows_changed && !layer.is_flat && tiled != nullptr && tiled->is_tileable())
+            {
+                // The rows of the output are in the order of the rows of the input they read
+                const unsigned int height    = layer.output->info()->dimension(1);
+                unsigned int       first_out = 0;
+                while(first_out < height && tiled->input_rows(first_out, first_out + 1).second <= first_row)
+                {
+                    ++first_out;
+                }
+                unsigned int last_out = first_out;
+                while(last_out < height && tiled->input_rows(last_out, last_out + 1).first < last_row)
+                {
+                    ++last_out;
+                }
+
+                if(first_out < last_out)
+                {
+                    tiled->prepare_tiles();
+                    tiled->run_tile(first_out, last_out);
+                }
+                first_row = first_out;
+                last_row  = last_out;
+            }
+            else
+            {
+                layer.function->run();
+                all_rows_changed = true;
+            }
+        }
+
+        if(_layer_observer != nullptr)
+        {
+            _layer_observer(static_cast<unsigned int>(i), *layer.output);
+        }
+    }
+
+    if(is_profiling)
+    {
+        Profiler::get().set_layer("");
+    }
+}
+
+void NENetwork::plan_tiled_sequences()
+{
+    _tiled_sequences.clear();
+    _tile_rows_done.clear();
+    _tile_rows_needed.clear();
+
+    if(_tile_working_set == 0)
+    {
+        return;
+    }
+
+    Tensor       *input = &_input;
+    TiledSequence sequence{ {}, {}, nullptr, 0 };
+
+    const auto close_sequence = [&]()
+    {
+        // Running a single layer in bands doesn't save any memory traffic
+        if(sequence.layers.size() > 1)
+        {
+            const unsigned int height = _layers[sequence.layers.back()].output->info()->dimension(1);
+
+            // The largest bands whose working set fits, at least one row
+            sequence.num_rows = 1;
+            while(sequence.num_rows < height && tiled_sequence_working_set(sequence, sequence.num_rows + 1) <= _tile_working_set)
+            {
+                ++sequence.num_rows;
+            }
+
+            // A single band is the same as running the layers one after the other
+            if(sequence.num_rows < height)
+            {
+                _tiled_sequences.push_back(sequence);
+            }
+        }
+        sequence = TiledSequence{ {}, {}, nullptr, 0 };
+    };
+
+    for(size_t i = 0; i < _layers.size(); ++i)
+    {
+        Layer &layer = _layers[i];
+        if(layer.is_fused)
+        {
+            continue;
+        }
+
+        auto *tiled = dynamic_cast<ITiledFunction *>(layer.function.get());
+        if(layer.may_be_tiled && !layer.is_flat && tiled != nullptr && tiled->is_tileable())
+        {
+            if(sequence.layers.empty())
+            {
+                sequence.input = input;
+            }
+            sequence.layers.push_back(i);
+            sequence.functions.push_back(tiled);
+        }
+        else
+        {
+            close_sequence();
+        }
+
+        input = layer.output.get();
+    }
+    close_sequence();
+
+    // The progress of the bands is tracked in members so that the runs don't allocate anything
+    size_t max_num_layers = 0;
+    for(const TiledSequence &tiled_sequence : _tiled_sequences)
+    {
+        max_num_layers = std::max(max_num_layers, tiled_sequence.layers.size());
+    }
+    _tile_rows_done.resize(max_num_layers);
+    _tile_rows_needed.resize(max_num_layers);
+}
+
+size_t NENetwork::tiled_sequence_working_set(const TiledSequence &sequence, unsigned int num_rows) const
+{
+    const auto row_size = [](const Tensor & tensor)
+    {
+        return tensor.info()->total_size() / tensor.info()->dimension(1);
+    };
+
+    size_t working_set = 0;
+
+    // Walk the sequence backwards: each layer needs the rows of its input read by the rows of its output
+    for(auto it = sequence.layers.crbegin(); it != sequence.layers.crend(); ++it)
+    {
+        const Layer &layer = _layers[*it];
+        const auto  *tiled = dynamic_cast<const ITiledFunction *>(layer.function.get());
+
+        working_set += num_rows * row_size(*layer.output) + tiled->tile_working_set(num_rows);
+
+        const std::pair<unsigned int, unsigned int> rows = tiled->input_rows(0, num_rows);
+        num_rows                                         = rows.second - rows.first;
+    }
+
+    return working_set + num_rows * row_size(*sequence.input);
+}
+
+void NENetwork::run_tiled_sequence(const TiledSequence &sequence)
+{
+    const bool         is_profiling = Profiler::get().is_enabled();
+    const size_t       num_layers   = sequence.layers.size();
+    const unsigned int height       = _layers[sequence.layers.back()].output->info()->dimension(1);
+
+    const std::vector<ITiledFunction *> &functions = sequence.functions;
+    for(size_t k = 0; k < num_layers; ++k)
+    {
+        if(!_is_prepared)
+        {
+            // The one-time work of the tiled functions is done before their first band
+            const StartupFunctionScope function_scope(layer_name(sequence.layers[k], _layers[sequence.layers[k]].descriptor.type));
+            const StartupScope         first_run_scope(StartupStage::FIRST_RUN, "prepare_tiles");
+
+            functions[k]->prepare_tiles();
+        }
+        else
+        {
+            functions[k]->prepare_tiles();
+        }
+    }
+
+    // Rows of the output of each layer computed so far, and needed by the current band
+    std::vector<unsigned int> &num_done   = _tile_rows_done;
+    std::vector<unsigned int> &num_needed = _tile_rows_needed;
+    std::fill_n(num_done.begin(), num_layers, 0);
+    std::fill_n(num_needed.begin(), num_layers, 0);
+
+    for(unsigned int row = 0; row < height; row += sequence.num_rows)
+    {
+        num_needed[num_layers - 1] = std::min(row + sequence.num_rows, height);
+
+        // The rows shared with the previous band have already been computed
+        for(size_t k = num_layers - 1; k > 0; --k)
+        {
+            num_needed[k - 1] = std::max(num_done[k - 1], functions[k]->input_rows(num_done[k], num_needed[k]).second);
+        }
+
+        for(size_t k = 0; k < num_layers; ++k)
+        {
+            if(num_needed[k] <= num_done[k])
+            {
+                continue;
+            }
+
+            if(is_profiling)
+            {
+                Profiler::get().set_layer(layer_name(sequence.layers[k], _layers[sequence.layers[k]].descriptor.type));
+            }
+            ARM_COMPUTE_TRACE_SCOPE(layer_name(sequence.layers[k], _layers[sequence.layers[k]].descriptor.type));
+
+            functions[k]->run_tile(num_done[k], num_needed[k]);
+            num_done[k] = num_needed[k];
+        }
+    }
+
+    for(size_t index : sequence.layers)
+    {
+        release_unused_weights(_layers[index]);
+    }
+}
+
+MemoryFootprint NENetwork::memory_footprint(unsigned int layer) const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+    ARM_COMPUTE_ERROR_ON(layer >= _layers.size());
+
+    const Layer    &l = _layers[layer];
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+
+    if(l.weights != nullptr)
+    {
+        footprint.add(MemoryCategory::WEIGHTS, *l.weights);
+    }
+    if(l.biases != nullptr)
+    {
+        footprint.add(MemoryCategory::WEIGHTS, *l.biases);
+    }
+    if(l.output != nullptr)
+    {
+        footprint.add(MemoryCategory::ACTIVATIONS, *l.output);
+    }
+    if(l.function != nullptr)
+    {
+        footprint += l.function->memory_footprint();
+    }
+
+    return footprint;
+}
+
+size_t NENetwork::transient_memory_size() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    return _memory_planner->arena_size();
+}
+
+void NENetwork::set_layer_observer(LayerObserver observer)
+{
+    _layer_observer = std::move(observer);
+}
+
+MemoryFootprint NENetwork::memory_footprint() const
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "The network has not been configured");
+
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::ACTIVATIONS, _input);
+
+    for(unsigned int i = 0; i < _layers.size(); ++i)
+    {
+        footprint += memory_footprint(i);
+    }
+
+    return footprint;
+}
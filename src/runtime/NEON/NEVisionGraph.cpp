@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/NEVisionGraph.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/NEON/INESimpleFunction.h"
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Producer of a virtual image not written by any function yet */
+constexpr size_t no_producer = std::numeric_limits<size_t>::max();
+} // namespace
+
+NEVisionGraph::VirtualImage::VirtualImage(unsigned int width, unsigned int height, Format format)
+    : _info(width, height, format), _storage(), _num_rows(0), _first_row(0)
+{
+}
+
+void NEVisionGraph::VirtualImage::allocate(unsigned int num_rows)
+{
+    ARM_COMPUTE_ERROR_ON(_storage != nullptr);
+
+    // The functions are configured: the padding must not grow anymore
+    _info.set_is_resizable(false);
+
+    _num_rows  = std::max(num_rows, 1u);
+    _first_row = 0;
+    _storage   = arm_compute::cpp14::make_unique<uint8_t[]>(buffer_size());
+}
+
+void NEVisionGraph::VirtualImage::slide(unsigned int keep_row, unsigned int written_row, unsigned int last_row)
+{
+    ARM_COMPUTE_ERROR_ON(keep_row < _first_row || keep_row > written_row);
+
+    if(last_row - _first_row <= _num_rows)
+    {
+        return;
+    }
+
+    ARM_COMPUTE_ERROR_ON_MSG(last_row - keep_row > _num_rows, "The band doesn't fit in the line buffer");
+
+    // Move the rows still to be read, with their left and right padding, to the beginning of the line buffer
+    const size_t   stride     = _info.strides_in_bytes()[1];
+    uint8_t *const first_line = _storage.get() + _info.padding().top * stride;
+
+    std::memmove(first_line, first_line + (keep_row - _first_row) * stride, (written_row - keep_row) * stride);
+
+    _first_row = keep_row;
+}
+
+void NEVisionGraph::VirtualImage::rewind()
+{
+    _first_row = 0;
+}
+
+size_t NEVisionGraph::VirtualImage::buffer_size() const
+{
+    const PaddingSize padding = _info.padding();
+
+    return (padding.top + _num_rows + padding.bottom) * _info.strides_in_bytes()[1];
+}
+
+TensorInfo *NEVisionGraph::VirtualImage::info() const
+{
+    return &_info;
+}
+
+TensorInfo *NEVisionGraph::VirtualImage::info()
+{
+    return &_info;
+}
+
+uint8_t *NEVisionGraph::VirtualImage::buffer() const
+{
+    // Shift the line buffer so that row y of the image is at its usual offset from the buffer
+    return _storage.get() - _first_row * _info.strides_in_bytes()[1];
+}
+
+NEVisionGraph::NEVisionGraph()
+    : _images(), _nodes(), _band_height(0), _num_rows(0), _is_finalized(false)
+{
+}
+
+IImage *NEVisionGraph::create_virtual_image(unsigned int width, unsigned int height, Format format)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_finalized, "The graph is already finalized");
+    ARM_COMPUTE_ERROR_ON_MSG(num_planes_from_format(format) != 1, "Multi-planar virtual images are not supported");
+
+    _images.push_back(VirtualImageNode{ arm_compute::cpp14::make_unique<VirtualImage>(width, height, format), no_producer, {}, 0 });
+
+    return _images.back().image.get();
+}
+
+size_t NEVisionGraph::find_virtual_image(const ITensor *tensor) const
+{
+    const auto it = std::find_if(_images.begin(), _images.end(), [tensor](const VirtualImageNode & image)
+    {
+        return image.image.get() == tensor;
+    });
+
+    return it - _images.begin();
+}
+
+void NEVisionGraph::add_node(INESimpleFunction *function, std::initializer_list<const ITensor *> inputs, std::initializer_list<const ITensor *> outputs)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_finalized, "The graph is already finalized");
+    ARM_COMPUTE_ERROR_ON(function == nullptr);
+
+    const size_t index = _nodes.size();
+
+    Node node{ function, {}, {}, function->band_rows(), function->band_border(), 0, 0 };
+
+    ARM_COMPUTE_ERROR_ON_MSG(node.rows.start() < 0 || node.rows.step() <= 0, "The function can't run in bands of rows");
+
+    for(const ITensor *input : inputs)
+    {
+        const size_t image = find_virtual_image(input);
+
+        if(image < _images.size())
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(_images[image].producer == no_producer, "A virtual input must be written by a function added before");
+            node.inputs.push_back(image);
+            _images[image].consumers.push_back(index);
+        }
+    }
+
+    for(const ITensor *output : outputs)
+    {
+        const size_t image = find_virtual_image(output);
+
+        if(image < _images.size())
+        {
+            ARM_COMPUTE_ERROR_ON_MSG(_images[image].producer != no_producer, "A virtual image must be written by a single function");
+            node.outputs.push_back(image);
+            _images[image].producer = index;
+        }
+    }
+
+    _nodes.push_back(node);
+}
+
+void NEVisionGraph::finalize(unsigned int band_height)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_finalized, "The graph is already finalized");
+    ARM_COMPUTE_ERROR_ON(band_height == 0);
+
+    _band_height = band_height;
+    _num_rows    = 0;
+
+    // A function must have computed the rows the functions reading its outputs need for their own band, and as the last
+    // iteration of their window may start at the last row of the band, the rows of that whole iteration
+    for(auto node = _nodes.rbegin(); node != _nodes.rend(); ++node)
+    {
+        for(size_t image : node->outputs)
+        {
+            for(size_t consumer : _images[image].consumers)
+            {
+                const Node &next = _nodes[consumer];
+                node->lookahead  = std::max(node->lookahead, next.lookahead + next.border.bottom + next.rows.step() - 1);
+            }
+        }
+
+        _num_rows = std::max<unsigned int>(_num_rows, node->rows.end());
+    }
+
+    // Measure the largest band of each virtual image, then allocate the line buffers
+    run_bands(true);
+
+    for(VirtualImageNode &image : _images)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(image.producer == no_producer, "A virtual image is not written by any function");
+        image.image->allocate(image.num_rows);
+    }
+
+    _is_finalized = true;
+}
+
+unsigned int NEVisionGraph::first_row_to_keep(size_t image) const
+{
+    // The rows not computed yet by the producer are not in memory
+    unsigned int keep_row = _nodes[_images[image].producer].next_row;
+
+    for(size_t consumer : _images[image].consumers)
+    {
+        const Node &node = _nodes[consumer];
+        keep_row         = std::min(keep_row, node.next_row - std::min(node.next_row, node.border.top));
+    }
+
+    return keep_row;
+}
+
+void NEVisionGraph::run_bands(bool dry_run)
+{
+    for(Node &node : _nodes)
+    {
+        node.next_row = node.rows.start();
+    }
+
+    for(VirtualImageNode &image : _images)
+    {
+        image.image->rewind();
+    }
+
+    for(unsigned int band_end = std::min(_band_height, _num_rows);; band_end = std::min(band_end + _band_height, _num_rows))
+    {
+        for(Node &node : _nodes)
+        {
+            const unsigned int start = node.rows.start();
+            const unsigned int end   = node.rows.end();
+            const unsigned int step  = node.rows.step();
+
+            // Rows of the band and the rows needed by the following functions, rounded up to whole iterations of the window
+            unsigned int last_row = std::min(band_end + node.lookahead, end);
+
+            if(last_row <= node.next_row)
+            {
+                continue;
+            }
+
+            last_row = std::min(start + ceil_to_multiple(last_row - start, step), end);
+
+            for(size_t image : node.outputs)
+            {
+                const unsigned int keep_row = first_row_to_keep(image);
+
+                if(dry_run)
+                {
+                    _images[image].num_rows = std::max(_images[image].num_rows, last_row - keep_row);
+                }
+                else
+                {
+                    _images[image].image->slide(keep_row, node.next_row, last_row);
+                }
+            }
+
+            if(!dry_run)
+            {
+                node.function->run_band(node.next_row, last_row);
+            }
+
+            node.next_row = last_row;
+        }
+
+        if(band_end == _num_rows)
+        {
+            break;
+        }
+    }
+}
+
+void NEVisionGraph::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_finalized, "The graph must be finalized before it is run");
+
+    run_bands(false);
+}
+
+MemoryFootprint NEVisionGraph::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+
+    // Only the line buffers are owned by the graph, the memory of the functions is their own
+    for(const VirtualImageNode &image : _images)
+    {
+        footprint.activations += image.image->buffer_size();
+    }
+
+    return footprint;
+}
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/NEON/kernels/NEAccumulateKernel.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include <utility>
 
@@ -59,3 +60,18 @@ void NEAccumulateSquared::configure(const ITensor *input, uint32_t shift, ITenso
     k->configure(input, shift, output);
     _kernel = std::move(k);
 }
+
+NEAccumulateCombined::NEAccumulateCombined()
+    : _kernel()
+{
+}
+
+void NEAccumulateCombined::configure(const std::vector<const ITensor *> &inputs, ITensor *accum, float alpha, ITensor *accum_weighted, uint32_t shift, ITensor *accum_squared)
+{
+    _kernel.configure(inputs, accum, alpha, accum_weighted, shift, accum_squared);
+}
+
+void NEAccumulateCombined::run()
+{
+    NEScheduler::get().multithread(&_kernel);
+}
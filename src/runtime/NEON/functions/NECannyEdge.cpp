@@ -28,21 +28,17 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/NEON/kernels/NECannyEdgeKernel.h"
 #include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/NEON/functions/NESobel3x3.h"
-#include "arm_compute/runtime/NEON/functions/NESobel5x5.h"
-#include "arm_compute/runtime/NEON/functions/NESobel7x7.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
-#include <cstring>
-#include <utility>
-
 using namespace arm_compute;
 
 NECannyEdge::NECannyEdge()
-    : _sobel(), _gradient(), _non_max_suppr(), _edge_trace(), _border_mag_gradient(), _border_edge_trace(), _gx(), _gy(), _magnitude(), _phase(), _nonmax(), _output(nullptr)
+    : _gradient_non_max(), _gradient(), _non_max(), _border_mag_gradient(), _magnitude(), _phase(), _edge_label(), _edge_merge(), _edge_trace(), _border_input(), _border_edge_trace(), _nonmax(),
+      _edge_labels(), _output(nullptr), _uses_gradients(false)
 {
 }
 
@@ -56,114 +52,113 @@ void NECannyEdge::configure(ITensor *input, ITensor *output, int32_t upper_thr,
     ARM_COMPUTE_ERROR_ON(lower_thr > upper_thr);
     ARM_COMPUTE_ERROR_ON((1 != norm_type) && (2 != norm_type));
 
-    _output = output;
+    _output         = output;
+    _uses_gradients = false;
 
     const TensorShape &shape = input->info()->tensor_shape();
-    TensorInfo         gradient_info;
-    TensorInfo         magnitude_info;
 
-    // Initialize images
-    if(gradient_size < 7)
-    {
-        gradient_info.init(shape, Format::S16);
-        magnitude_info.init(shape, Format::U16);
-    }
-    else
-    {
-        gradient_info.init(shape, Format::S32);
-        magnitude_info.init(shape, Format::U32);
-    }
+    _nonmax.allocator()->init(TensorInfo(shape, Format::U8));
 
-    _gx.allocator()->init(gradient_info);
-    _gy.allocator()->init(gradient_info);
-    _magnitude.allocator()->init(magnitude_info);
+    // One label per pixel, plus the one of the set of the edges
+    _edge_labels.allocator()->init(TensorInfo(TensorShape(shape.x() * shape.y() + 1), Format::U32));
 
-    TensorInfo info(shape, Format::U8);
-    _phase.allocator()->init(info);
-    _nonmax.allocator()->init(info);
+    // Configure Sobel, magnitude, phase and non-maxima suppression in one pass
+    _gradient_non_max.configure(input, &_nonmax, upper_thr, lower_thr, gradient_size, norm_type, border_mode, constant_border_value, use_fp16);
 
-    // Configure/Init sobelNxN
-    if(gradient_size == 3)
-    {
-        auto k = arm_compute::cpp14::make_unique<NESobel3x3>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else if(gradient_size == 5)
-    {
-        auto k = arm_compute::cpp14::make_unique<NESobel5x5>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else if(gradient_size == 7)
-    {
-        auto k = arm_compute::cpp14::make_unique<NESobel7x7>();
-        k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
-        _sobel = std::move(k);
-    }
-    else
-    {
-        ARM_COMPUTE_ERROR("Gradient size not supported\n");
-    }
+    // Fill border around the input for the Sobel filter. If border mode is undefined filling the border is a nop.
+    _border_input.configure(input, _gradient_non_max.border_size(), border_mode, PixelValue(constant_border_value));
+
+    configure_edge_trace(output);
+}
+
+void NECannyEdge::configure(const ITensor *gx, const ITensor *gy, ITensor *output, int32_t upper_thr, int32_t lower_thr, int32_t norm_type, BorderMode border_mode, bool use_fp16)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, DataType::S16, DataType::S32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(gx, gy);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(gx, gy);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
+    ARM_COMPUTE_ERROR_ON(lower_thr > upper_thr);
+    ARM_COMPUTE_ERROR_ON((1 != norm_type) && (2 != norm_type));
+
+    _output         = output;
+    _uses_gradients = true;
+
+    const TensorShape &shape = gx->info()->tensor_shape();
+
+    _magnitude.allocator()->init(TensorInfo(shape, (DataType::S16 == gx->info()->data_type()) ? Format::U16 : Format::U32));
+    _phase.allocator()->init(TensorInfo(shape, Format::U8));
+    _nonmax.allocator()->init(TensorInfo(shape, Format::U8));
 
-    // Configure gradient
+    // One label per pixel, plus the one of the set of the edges
+    _edge_labels.allocator()->init(TensorInfo(TensorShape(shape.x() * shape.y() + 1), Format::U32));
+
+    // Configure magnitude and phase of the shared gradients
     if(use_fp16)
     {
-        auto k = arm_compute::cpp14::make_unique<NEGradientFP16Kernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
-        _gradient = std::move(k);
+        _gradient = arm_compute::cpp14::make_unique<NEGradientFP16Kernel>();
     }
     else
     {
-        auto k = arm_compute::cpp14::make_unique<NEGradientKernel>();
-        k->configure(&_gx, &_gy, &_magnitude, &_phase, norm_type);
-        _gradient = std::move(k);
+        _gradient = arm_compute::cpp14::make_unique<NEGradientKernel>();
     }
+    _gradient->configure(gx, gy, &_magnitude, &_phase, norm_type);
 
     // Configure non-maxima suppression
-    _non_max_suppr.configure(&_magnitude, &_phase, &_nonmax, upper_thr, lower_thr, border_mode == BorderMode::UNDEFINED);
+    _non_max.configure(&_magnitude, &_phase, &_nonmax, upper_thr, lower_thr, border_mode == BorderMode::UNDEFINED);
+
+    // Fill border around the magnitude for the non-maxima suppression. If border mode is undefined filling the border is a nop.
+    _border_mag_gradient.configure(&_magnitude, _non_max.border_size(), border_mode, 0);
+
+    configure_edge_trace(output);
 
-    // Fill border around magnitude image as non-maxima suppression will access
-    // it. If border mode is undefined filling the border is a nop.
-    _border_mag_gradient.configure(&_magnitude, _non_max_suppr.border_size(), border_mode, constant_border_value);
+    _magnitude.allocator()->allocate();
+    _phase.allocator()->allocate();
+}
 
+void NECannyEdge::configure_edge_trace(ITensor *output)
+{
     // Configure edge tracing
-    _edge_trace.configure(&_nonmax, output);
+    _edge_label.configure(&_nonmax, &_edge_labels);
+    _edge_merge.configure(&_nonmax, &_edge_labels);
+    _edge_trace.configure(&_nonmax, &_edge_labels, output);
 
-    // Fill border with "No edge" to stop recursion in edge trace
-    _border_edge_trace.configure(&_nonmax, _edge_trace.border_size(), BorderMode::CONSTANT, 0);
+    // Fill border with "No edge" so that the pixels outside the image are never merged
+    _border_edge_trace.configure(&_nonmax, _edge_merge.border_size(), BorderMode::CONSTANT, 0);
 
     // Allocate intermediate tensors
-    _gx.allocator()->allocate();
-    _gy.allocator()->allocate();
-    _phase.allocator()->allocate();
-    _magnitude.allocator()->allocate();
     _nonmax.allocator()->allocate();
+    _edge_labels.allocator()->allocate();
 }
 
 void NECannyEdge::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr, "Unconfigured function");
-    ARM_COMPUTE_ERROR_ON(_output == nullptr);
-
-    // Run sobelNxN
-    _sobel->run();
+    ARM_COMPUTE_ERROR_ON_MSG(_output == nullptr, "Unconfigured function");
 
-    // Fill border before non-maxima suppression. Nop for border mode undefined.
-    _border_mag_gradient.run(_border_mag_gradient.window());
+    if(_uses_gradients)
+    {
+        // Run magnitude and phase of the shared gradients
+        NEScheduler::get().multithread(_gradient.get());
 
-    // Run gradient
-    NEScheduler::get().multithread(_gradient.get());
+        // Fill border before non-maxima suppression. Nop for border mode undefined.
+        _border_mag_gradient.run(_border_mag_gradient.window());
 
-    // Run non-maxima suppression
-    NEScheduler::get().multithread(&_non_max_suppr);
+        // Run non-maxima suppression
+        NEScheduler::get().multithread(&_non_max);
+    }
+    else
+    {
+        // Fill border before the Sobel filter. Nop for border mode undefined.
+        _border_input.run(_border_input.window());
 
-    ARM_COMPUTE_ERROR_ON(_output->buffer() == nullptr);
-    memset(_output->buffer(), 0, _output->info()->total_size());
+        // Run Sobel, magnitude, phase and non-maxima suppression: each thread streams its rows
+        NEScheduler::get().multithread(&_gradient_non_max);
+    }
 
     // Fill border before edge trace
     _border_edge_trace.run(_border_edge_trace.window());
 
-    // Run edge tracing
-    _edge_trace.run(_edge_trace.window());
+    // Run edge tracing: each step needs the previous one to be complete on the whole image
+    NEScheduler::get().multithread(&_edge_label);
+    NEScheduler::get().multithread(&_edge_merge);
+    NEScheduler::get().multithread(&_edge_trace);
 }
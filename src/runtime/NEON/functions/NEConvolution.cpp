@@ -32,9 +32,11 @@
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/TensorAllocator.h"
 
+#include <algorithm>
 #include <array>
+#include <cstdlib>
+#include <numeric>
 #include <utility>
 
 using namespace arm_compute;
@@ -42,14 +44,15 @@ using namespace arm_compute;
 void NEConvolution3x3::configure(ITensor *input, ITensor *output, const int16_t *conv, uint32_t scale, BorderMode border_mode, uint8_t constant_border_value)
 {
     auto k = arm_compute::cpp14::make_unique<NEConvolution3x3Kernel>();
-    k->configure(input, output, conv, scale, border_mode == BorderMode::UNDEFINED);
+    k->configure(input, output, conv, scale, border_mode, constant_border_value);
     _kernel = std::move(k);
+    // The kernel handles the borders itself: its border size is empty and the border handler does nothing
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
 
 template <unsigned int matrix_size>
 NEConvolutionSquare<matrix_size>::NEConvolutionSquare()
-    : _tmp(), _is_separable(false), _kernel_hor(), _kernel_vert(), _kernel(), _border_handler()
+    : _is_separable(false), _kernel_separable(), _kernel(), _border_handler()
 {
 }
 
@@ -67,26 +70,17 @@ void NEConvolutionSquare<matrix_size>::configure(ITensor *input, ITensor *output
 
     if(_is_separable)
     {
-        DataType intermediate_type = DataType::UNKNOWN;
-        std::tie(std::ignore, intermediate_type) = data_type_for_convolution(conv_col.data(), conv_row.data(), matrix_size);
-
-        _tmp.allocator()->init(TensorInfo(input->info()->tensor_shape(), 1, intermediate_type));
-
         if(scale == 0)
         {
             scale = calculate_matrix_scale(conv, matrix_size);
         }
 
-        _kernel_hor.configure(input, &_tmp, conv_row.data(), border_mode == BorderMode::UNDEFINED);
-        _kernel_vert.configure(&_tmp, output, conv_col.data(), scale, border_mode == BorderMode::UNDEFINED);
-
-        _tmp.allocator()->allocate();
-
-        _border_handler.configure(input, _kernel_hor.border_size(), border_mode, PixelValue(constant_border_value));
+        _kernel_separable.configure(input, output, conv_row.data(), conv_col.data(), scale, border_mode == BorderMode::UNDEFINED);
+        _border_handler.configure(input, _kernel_separable.border_size(), border_mode, PixelValue(constant_border_value));
     }
     else
     {
-        _kernel.configure(input, output, conv, scale, border_mode == BorderMode::UNDEFINED);
+        _kernel.configure(input, output, conv, scale, border_mode, constant_border_value);
         _border_handler.configure(input, _kernel.border_size(), border_mode, PixelValue(constant_border_value));
     }
 }
@@ -98,8 +92,7 @@ void                   NEConvolutionSquare<matrix_size>::run()
 
     if(_is_separable)
     {
-        NEScheduler::get().multithread(&_kernel_hor);
-        NEScheduler::get().multithread(&_kernel_vert);
+        NEScheduler::get().multithread(&_kernel_separable);
     }
     else
     {
@@ -113,8 +106,32 @@ template class arm_compute::NEConvolutionSquare<9>;
 
 void NEConvolutionRectangle::configure(ITensor *input, ITensor *output, const int16_t *conv, uint32_t rows, uint32_t cols, uint32_t scale, BorderMode border_mode, uint8_t constant_border_value)
 {
-    auto k = arm_compute::cpp14::make_unique<NEConvolutionRectangleKernel>();
-    k->configure(input, output, conv, rows, cols, scale, border_mode == BorderMode::UNDEFINED);
-    _kernel = std::move(k);
+    ARM_COMPUTE_ERROR_ON(conv == nullptr);
+
+    if(scale == 0)
+    {
+        scale = std::max(1, std::abs(std::accumulate(conv, conv + rows * cols, 0)));
+    }
+
+    std::array<int16_t, 9> conv_col{ { 0 } };
+    std::array<int16_t, 9> conv_row{ { 0 } };
+
+    // Like NEConvolutionRectangleKernel, the matrix has rows columns and cols rows
+    const uint32_t width  = rows;
+    const uint32_t height = cols;
+
+    // A rank 1 matrix takes width + height multiplications per pixel instead of width * height
+    if(width <= conv_row.size() && height <= conv_col.size() && separate_matrix(conv, conv_col.data(), conv_row.data(), height, width))
+    {
+        auto k = arm_compute::cpp14::make_unique<NESeparableConvolutionRectangleKernel>();
+        k->configure(input, output, conv_row.data(), width, conv_col.data(), height, scale, border_mode == BorderMode::UNDEFINED);
+        _kernel = std::move(k);
+    }
+    else
+    {
+        auto k = arm_compute::cpp14::make_unique<NEConvolutionRectangleKernel>();
+        k->configure(input, output, conv, rows, cols, scale, border_mode == BorderMode::UNDEFINED);
+        _kernel = std::move(k);
+    }
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
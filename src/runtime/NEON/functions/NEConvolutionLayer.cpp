@@ -26,38 +26,180 @@
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEModelFile.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/TensorBlob.h"
 
+#include <algorithm>
+#include <array>
+#include <chrono>
 #include <cmath>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
 #include <tuple>
 
 using namespace arm_compute;
 
-NEConvolutionLayer::NEConvolutionLayer()
-    : _input_im2col_kernel(), _input_interleave_kernel(), _weights_reshape_kernel(), _weights_transposed_kernel(), _mm_kernel(), _output_col2im_kernel(), _input_im2col_reshaped(),
-      _input_interleaved_reshaped(), _weights_reshaped(), _weights_transposed(), _gemm_output(), _is_first_run(false), _has_bias(false)
+namespace
 {
+/** Maximum number of elements in an output feature map for the convolution to run as a direct convolution
+ *
+ * Above this size the matrix multiplication amortises the cost of im2col.
+ */
+constexpr unsigned int max_direct_convolution_output_size = 32 * 32;
+
+/** Number of timed runs of each algorithm while tuning a layer: the fastest one is kept */
+constexpr unsigned int num_timed_runs = 3;
+
+/** Signature of the CPU the layers are tuned on: the distinct core types reported by the kernel and the number of threads of the scheduler */
+std::string cpu_signature()
+{
+    std::set<std::string> parts;
+    std::ifstream         cpuinfo("/proc/cpuinfo");
+    std::string           line;
+    while(std::getline(cpuinfo, line))
+    {
+        if(line.compare(0, 8, "CPU part") == 0 || line.compare(0, 10, "model name") == 0)
+        {
+            const size_t pos = line.find(':');
+            if(pos != std::string::npos && pos + 2 < line.size())
+            {
+                parts.insert(line.substr(pos + 2));
+            }
+        }
+    }
+
+    std::stringstream id;
+    id << "cpu";
+    for(const auto &part : parts)
+    {
+        id << ' ' << part;
+    }
+    id << " threads " << NEScheduler::get().num_threads();
+    return id.str();
 }
 
-void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info)
+/** Signature of a convolution layer: data type, shapes, padding and stride, groups and fused operations */
+std::string layer_signature(const ITensor *input, const ITensor *weights, const ITensor *biases, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info, unsigned int num_groups)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::F32);
+    std::stringstream id;
+    id << "conv " << string_from_data_type(input->info()->data_type()) << " input";
+    for(size_t d = 0; d < 4; ++d)
+    {
+        id << ' ' << input->info()->dimension(d);
+    }
+    id << " weights";
+    for(size_t d = 0; d < 4; ++d)
+    {
+        id << ' ' << weights->info()->dimension(d);
+    }
+    id << " stride " << conv_info.stride().first << ' ' << conv_info.stride().second << " pad " << conv_info.pad().first << ' ' << conv_info.pad().second;
+    id << " round " << static_cast<int>(conv_info.round()) << " groups " << num_groups << " biases " << (biases != nullptr) << " act " << act_info.enabled();
+    return id.str();
+}
+
+/** Initialise a benchmarking tensor with the shape, data type and quantization settings of another tensor
+ *
+ * @param[out] tensor    Tensor to initialise.
+ * @param[in]  reference Tensor whose settings are copied.
+ */
+void init_like(Tensor &tensor, const ITensor *reference)
+{
+    TensorInfo info(reference->info()->tensor_shape(), 1, reference->info()->data_type());
+    info.set_quantization_info(reference->info()->quantization_info());
+    info.set_data_layout(reference->info()->data_layout());
+    tensor.allocator()->init(info);
+}
+} // namespace
+
+NEConvolutionLayer::NEConvolutionLayer(std::shared_ptr<MemoryPlanner> memory_planner, ConvolutionMethodTuner *tuner)
+    : _memory_group(std::move(memory_planner)), _bn_fold_kernel(), _bn_fold_biases_kernel(), _direct_conv_kernel(), _blocked_conv_kernel(), _weights_blocking_kernel(), _pointwise_kernel(), _input_im2col_kernel(), _input_interleave_kernel(),
+      _weights_reshape_kernel(), _weights_transposed_kernel(), _mm_kernel(), _mm_lowp_kernel(), _winograd_filter_transform_kernel(), _winograd_input_transform_kernel(),
+      _winograd_output_transform_kernel(), _input_space_to_depth_kernel(), _weights_space_to_depth_kernel(), _input_im2col_reshaped(), _input_interleaved_reshaped(), _weights_reshaped(),
+      _weights_transposed(), _gemm_output(), _folded_weights(), _folded_biases(), _input_space_to_depth(), _weights_space_to_depth(), _weights_blocked(), _original_weights(nullptr), _tuner(tuner), _conv_info(), _kernel_height(0),
+      _input_height(0), _output_width(0), _is_first_run(false), _use_direct_convolution(false), _use_pointwise_convolution(false), _use_winograd(false), _is_quantized(false),
+      _fold_batch_norm(false), _use_space_to_depth(false), _is_nhwc(false), _is_blocked(false)
+{
+}
+
+void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                                   unsigned int num_groups, bool space_to_depth)
+{
+    ConvolutionMethod method = space_to_depth ? ConvolutionMethod::SPACE_TO_DEPTH : ConvolutionMethod::DEFAULT;
+
+    // NHWC convolutions only have one algorithm
+    if(_tuner != nullptr && input->info()->data_layout() == DataLayout::NCHW)
+    {
+        const std::string id    = cpu_signature() + '\t' + layer_signature(input, weights, biases, conv_info, act_info, num_groups);
+        ConvolutionMethod tuned = _tuner->find(id);
+        if(tuned == ConvolutionMethod::DEFAULT && _tuner->tune_new_layers())
+        {
+            tuned = find_fastest_method(input, weights, biases, output, conv_info, act_info, num_groups);
+            _tuner->add(id, tuned);
+        }
+        if(tuned != ConvolutionMethod::DEFAULT)
+        {
+            method = tuned;
+        }
+    }
+
+    configure_method(input, weights, biases, output, conv_info, act_info, num_groups, method);
+}
+
+void NEConvolutionLayer::configure_method(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info, const ActivationLayerInfo &act_info,
+                                          unsigned int num_groups, ConvolutionMethod method)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8, DataType::F16, DataType::F32);
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
-    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(2) != input->info()->dimension(2));
+    ARM_COMPUTE_ERROR_ON(num_groups == 0);
+
+    if(input->info()->data_layout() == DataLayout::NCHW4)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(num_groups != 1, "NCHW4 convolutions can't be grouped");
+        configure_blocked(input, weights, biases, output, conv_info, act_info);
+        return;
+    }
+
+    // The im2col of NHWC inputs copies whole rows of channels, the weights must have the same layout so that their rows match
+    const DataLayout   data_layout = input->info()->data_layout();
+    const unsigned int idx_w       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::WIDTH);
+    const unsigned int idx_h       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::HEIGHT);
+    const unsigned int idx_c       = get_data_layout_dimension_index(data_layout, DataLayoutDimension::CHANNEL);
+    _is_nhwc                       = (data_layout == DataLayout::NHWC);
+    ARM_COMPUTE_UNUSED(idx_c);
+
+    ARM_COMPUTE_ERROR_ON((weights->info()->data_layout() != data_layout) || (output->info()->data_layout() != data_layout));
+    ARM_COMPUTE_ERROR_ON_MSG(_is_nhwc && (input->info()->data_type() != DataType::F32), "NHWC convolutions are only supported in single precision");
+    ARM_COMPUTE_ERROR_ON_MSG(_is_nhwc && (num_groups != 1), "NHWC convolutions can't be grouped");
+    ARM_COMPUTE_ERROR_ON(weights->info()->dimension(idx_c) * num_groups != input->info()->dimension(idx_c));
+    ARM_COMPUTE_ERROR_ON((weights->info()->dimension(3) % num_groups) != 0);
     ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(input->info()->num_dimensions() > 4);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(idx_c) != weights->info()->dimension(3));
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(3) != input->info()->dimension(3));
+
+    _is_quantized = (input->info()->data_type() == DataType::U8);
+
+    // The Winograd transforms and the direct convolution are only implemented in single precision, for NCHW tensors
+    const bool is_fp32 = (input->info()->data_type() == DataType::F32) && !_is_nhwc;
 
     if(biases != nullptr)
     {
-        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::F32);
-        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
+        // The biases of a quantized convolution are added to the 32-bit accumulators: their scale is the product of the input and weights scales
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, _is_quantized ? DataType::S32 : input->info()->data_type());
         ARM_COMPUTE_ERROR_ON(biases->info()->dimension(0) != weights->info()->dimension(3));
         ARM_COMPUTE_ERROR_ON(biases->info()->num_dimensions() > 1);
     }
 
-    _has_bias     = (biases != nullptr);
-    _is_first_run = true;
+    _is_first_run       = true;
+    _original_weights   = weights;
+    _fold_batch_norm    = false;
+    _use_space_to_depth = false;
+    _is_blocked         = false;
 
     // Get parameters for conv_info
     unsigned int stride_x = 0;
@@ -70,81 +212,711 @@ void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights,
     // Get convolved dimensions
     unsigned int conv_w = 0;
     unsigned int conv_h = 0;
-    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), weights->info()->dimension(0),
+    std::tie(conv_w, conv_h) = scaled_dimensions(input->info()->dimension(idx_w), input->info()->dimension(idx_h), weights->info()->dimension(idx_w),
                                                  stride_x, stride_y, pad_x, pad_y, conv_info.round());
-    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(0) != conv_w) || (output->info()->dimension(1) != conv_h), "Output shape does not match the expected one");
+    ARM_COMPUTE_ERROR_ON_MSG((output->info()->dimension(idx_w) != conv_w) || (output->info()->dimension(idx_h) != conv_h), "Output shape does not match the expected one");
+
+    // Only the convolutions whose kernel overlaps several blocks of stride x stride pixels gain from the rearrangement
+    if((method == ConvolutionMethod::SPACE_TO_DEPTH) && !_is_nhwc && (stride_x == stride_y) && (stride_x > 1) && (num_groups == 1) && (weights->info()->dimension(0) == weights->info()->dimension(1))
+       && (weights->info()->dimension(0) > stride_x))
+    {
+        configure_space_to_depth(input, weights, biases, output, conv_info, act_info);
+        return;
+    }
+
+    _conv_info     = conv_info;
+    _kernel_height = weights->info()->dimension(idx_h);
+    _input_height  = input->info()->dimension(idx_h);
+    _output_width  = conv_w;
+
+    // An algorithm which doesn't support the layer falls back to the heuristics
+    const bool use_heuristics = (method != ConvolutionMethod::GEMM) && (method != ConvolutionMethod::DIRECT) && (method != ConvolutionMethod::POINTWISE) && (method != ConvolutionMethod::WINOGRAD);
+
+    // The input feature maps of a 1x1 convolution with a stride of 1 and no padding are already the matrix that im2col would produce
+    const unsigned int kernel_size = weights->info()->dimension(idx_w);
+    _use_pointwise_convolution     = (kernel_size == 1) && (weights->info()->dimension(idx_h) == 1) && (stride_x == 1) && (stride_y == 1) && (pad_x == 0) && (pad_y == 0)
+                                     && (num_groups == 1) && is_fp32 && (use_heuristics || method == ConvolutionMethod::POINTWISE);
+    _use_direct_convolution        = false;
+    _use_winograd                  = false;
+
+    if(_use_pointwise_convolution)
+    {
+        _pointwise_kernel.configure_convolution(weights, input, biases, output, act_info);
+        return;
+    }
+
+    // Select Winograd for the 3x3 convolutions with a stride of 1: the matrix multiplication needs at least two tiles to run as a matrix-matrix multiplication.
+    // The tiles of all the images of the batch are transformed together so that a single matrix multiplication processes the whole batch.
+    const unsigned int num_tiles = ((conv_w + 1) / 2) * ((conv_h + 1) / 2) * input->info()->dimension(3);
+    _use_winograd                = (kernel_size == 3) && (weights->info()->dimension(idx_h) == 3) && (stride_x == 1) && (stride_y == 1) && (pad_x <= 2) && (pad_y <= 2) && (num_tiles > 1)
+                                   && (num_groups == 1) && is_fp32 && (use_heuristics || method == ConvolutionMethod::WINOGRAD);
+
+    if(_use_winograd)
+    {
+        configure_winograd(input, weights, biases, output, conv_info, act_info, num_tiles);
+        return;
+    }
+
+    // Select the direct convolution for the small output planes
+    _use_direct_convolution = (kernel_size == weights->info()->dimension(idx_h)) && NEDirectConvolutionLayerKernel::is_supported(kernel_size, conv_info) && (num_groups == 1) && is_fp32
+                              && (use_heuristics ? (conv_w * conv_h <= max_direct_convolution_output_size) : (method == ConvolutionMethod::DIRECT));
+
+    if(_use_direct_convolution)
+    {
+        _direct_conv_kernel.configure(input, weights, biases, output, conv_info, act_info);
+        return;
+    }
 
-    // Create tensor to store the reshaped weights
-    const unsigned int mat_weights_cols = weights->info()->dimension(3);
-    const unsigned int mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2) + (_has_bias ? 1 : 0);
-    TensorShape        shape_wr(mat_weights_cols, mat_weights_rows);
-    TensorInfo         info_wr(shape_wr, 1, weights->info()->data_type());
+    // Create tensor to store the reshaped weights, directly in the 1xW transposed layout required by the matrix multiplication kernel:
+    // each row holds the weights of transpose_w output feature maps, in the order of the rows of im2col for both layouts. The biases are added by the matrix multiplication when it stores the output.
+    // Each group of a grouped convolution is a matrix multiplication of its own, stored in its own plane of the GEMM tensors.
+    const unsigned int mat_weights_cols = weights->info()->dimension(3) / num_groups;
+    const unsigned int mat_weights_rows = weights->info()->dimension(0) * weights->info()->dimension(1) * weights->info()->dimension(2);
+    const unsigned int transpose_w      = _is_quantized ? NEGEMMLowpMatrixMultiplyKernel::convolution_weights_transpose_width() :
+                                          NEGEMMMatrixMultiplyKernel::convolution_weights_transpose_width(weights->info()->data_type());
+    TensorShape shape_wt(mat_weights_rows * transpose_w, static_cast<unsigned int>(std::ceil(mat_weights_cols / static_cast<float>(transpose_w))), num_groups);
+    TensorInfo  info_wt(shape_wt, 1, weights->info()->data_type());
+    _weights_transposed.allocator()->init(info_wt);
+
+    // Create tensor to store the im2col reshaped inputs, directly in the interleaved layout expected by GEMM
+    const unsigned int mat_input_cols    = mat_weights_rows;
+    const unsigned int mat_input_rows    = conv_w * conv_h;
+    TensorShape        shape_interleaved = input->info()->tensor_shape();
+    shape_interleaved.set(0, mat_input_cols * 4);
+    shape_interleaved.set(1, std::ceil(mat_input_rows / 4.f));
+    shape_interleaved.set(2, num_groups);
+    TensorInfo info_interleaved(shape_interleaved, 1, input->info()->data_type());
+    _input_interleaved_reshaped.allocator()->init(info_interleaved);
+
+    // Configure kernels
+    _weights_reshape_kernel.configure(weights, nullptr, &_weights_transposed, transpose_w);
+
+    // Allocate each intermediate tensor as soon as its last consumer has been configured so that its lifetime is as short as possible
+    _memory_group.manage(&_input_interleaved_reshaped);
+    _input_im2col_kernel.configure(input, &_input_interleaved_reshaped, std::make_pair(conv_w, conv_h), conv_info, false, true);
+
+    // The transposed weights have the layout of an interleaved matrix with one row per output feature map
+    // and the interleaved im2col output the layout of a transposed matrix with one column per output element:
+    // their product is stored directly in the output feature maps
+    if(_is_quantized)
+    {
+        configure_quantized_mm(input, weights, biases, output, act_info);
+    }
+    else
+    {
+        _mm_kernel.configure_convolution(&_weights_transposed, &_input_interleaved_reshaped, biases, output, act_info);
+    }
+    _input_interleaved_reshaped.allocator()->allocate();
+
+    _weights_transposed.allocator()->allocate();
+}
+
+void NEConvolutionLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                   const ITensor *bn_mean, const ITensor *bn_var, const ITensor *bn_beta, const ITensor *bn_gamma, float bn_epsilon,
+                                   const ActivationLayerInfo &act_info, unsigned int num_groups, bool space_to_depth)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
+
+    // The convolution runs on the folded weights and biases, computed from the original ones the first time the function is run
+    TensorInfo info_folded_weights(weights->info()->tensor_shape(), 1, weights->info()->data_type());
+    info_folded_weights.set_data_layout(weights->info()->data_layout());
+    _folded_weights.allocator()->init(info_folded_weights);
+    _folded_biases.allocator()->init(TensorInfo(TensorShape(weights->info()->dimension(3)), 1, weights->info()->data_type()));
+
+    _bn_fold_kernel.configure(weights, biases, bn_mean, bn_var, bn_beta, bn_gamma, bn_epsilon, &_folded_weights, &_folded_biases);
+
+    // The folded biases are still needed if the reshaped weights are imported, which skips the folding of the weights
+    _bn_fold_biases_kernel.configure(nullptr, biases, bn_mean, bn_var, bn_beta, bn_gamma, bn_epsilon, nullptr, &_folded_biases);
+
+    configure(input, &_folded_weights, &_folded_biases, output, conv_info, act_info, num_groups, space_to_depth);
+
+    _original_weights = weights;
+    _fold_batch_norm  = true;
+
+    _folded_weights.allocator()->allocate();
+    _folded_biases.allocator()->allocate();
+}
+
+ConvolutionMethod NEConvolutionLayer::selected_method() const
+{
+    if(_use_space_to_depth)
+    {
+        return ConvolutionMethod::SPACE_TO_DEPTH;
+    }
+    if(_use_pointwise_convolution)
+    {
+        return ConvolutionMethod::POINTWISE;
+    }
+    if(_use_winograd)
+    {
+        return ConvolutionMethod::WINOGRAD;
+    }
+    return _use_direct_convolution ? ConvolutionMethod::DIRECT : ConvolutionMethod::GEMM;
+}
+
+ConvolutionMethod NEConvolutionLayer::find_fastest_method(const ITensor *input, const ITensor *weights, const ITensor *biases, const ITensor *output, const PadStrideInfo &conv_info,
+                                                          const ActivationLayerInfo &act_info, unsigned int num_groups)
+{
+    static const std::array<ConvolutionMethod, 5> candidates{ { ConvolutionMethod::GEMM, ConvolutionMethod::DIRECT, ConvolutionMethod::POINTWISE, ConvolutionMethod::WINOGRAD, ConvolutionMethod::SPACE_TO_DEPTH } };
+
+    ConvolutionMethod                   best_method = ConvolutionMethod::GEMM;
+    std::chrono::steady_clock::duration best_time   = std::chrono::steady_clock::duration::max();
+
+    for(const auto method : candidates)
+    {
+        // Each algorithm needs tensors of its own: the kernels extend the padding of their tensors when they are configured
+        Tensor bench_input;
+        Tensor bench_weights;
+        Tensor bench_biases;
+        Tensor bench_output;
+        init_like(bench_input, input);
+        init_like(bench_weights, weights);
+        init_like(bench_output, output);
+        if(biases != nullptr)
+        {
+            init_like(bench_biases, biases);
+        }
+
+        NEConvolutionLayer candidate;
+        candidate.configure_method(&bench_input, &bench_weights, (biases != nullptr) ? &bench_biases : nullptr, &bench_output, conv_info, act_info, num_groups, method);
+        if(candidate.selected_method() != method)
+        {
+            // The algorithm doesn't support the layer
+            continue;
+        }
+
+        // Zeros rather than uninitialised memory, which might hold denormals
+        for(Tensor *tensor : { &bench_input, &bench_weights, &bench_biases, &bench_output })
+        {
+            if(tensor->info()->total_size() != 0)
+            {
+                tensor->allocator()->allocate();
+                std::fill_n(tensor->buffer(), tensor->info()->total_size(), 0);
+            }
+        }
+
+        // The first run reshapes the weights
+        candidate.run();
+
+        for(unsigned int i = 0; i < num_timed_runs; ++i)
+        {
+            const auto start = std::chrono::steady_clock::now();
+            candidate.run();
+            const auto time = std::chrono::steady_clock::now() - start;
+            if(time < best_time)
+            {
+                best_time   = time;
+                best_method = method;
+            }
+        }
+    }
+
+    return best_method;
+}
+
+void NEConvolutionLayer::configure_space_to_depth(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                                  const ActivationLayerInfo &act_info)
+{
+    const unsigned int stride = conv_info.stride().first;
+    const unsigned int kernel = weights->info()->dimension(0);
+    unsigned int       conv_w = 0;
+    unsigned int       conv_h = 0;
+    std::tie(conv_w, conv_h)  = scaled_dimensions(input->info()->dimension(0), input->info()->dimension(1), kernel, stride, stride, conv_info.pad().first, conv_info.pad().second,
+                                                  conv_info.round());
+
+    // The kernel is padded with zeros to a multiple of the stride, so each of its blocks of stride x stride pixels becomes a single pixel.
+    // The rearranged input holds the padding of the convolution and exactly the pixels read by the convolution with a stride of 1 and no padding.
+    const unsigned int block_kernel = (kernel + stride - 1) / stride;
+    const unsigned int num_channels = input->info()->dimension(2) * stride * stride;
+
+    TensorShape shape_input = input->info()->tensor_shape();
+    shape_input.set(0, conv_w + block_kernel - 1);
+    shape_input.set(1, conv_h + block_kernel - 1);
+    shape_input.set(2, num_channels);
+    TensorInfo info_input(shape_input, 1, input->info()->data_type());
+    info_input.set_quantization_info(input->info()->quantization_info());
+    _input_space_to_depth.allocator()->init(info_input);
+
+    TensorShape shape_weights = weights->info()->tensor_shape();
+    shape_weights.set(0, block_kernel);
+    shape_weights.set(1, block_kernel);
+    shape_weights.set(2, num_channels);
+    TensorInfo info_weights(shape_weights, 1, weights->info()->data_type());
+    info_weights.set_quantization_info(weights->info()->quantization_info());
+    _weights_space_to_depth.allocator()->init(info_weights);
+
+    _memory_group.manage(&_input_space_to_depth);
+    _input_space_to_depth_kernel.configure(input, &_input_space_to_depth, stride, conv_info.pad().first, conv_info.pad().second);
+    _weights_space_to_depth_kernel.configure(weights, &_weights_space_to_depth, stride, 0, 0);
+
+    configure_method(&_input_space_to_depth, &_weights_space_to_depth, biases, output, PadStrideInfo(1, 1, 0, 0), act_info, 1, ConvolutionMethod::DEFAULT);
+
+    // The rearranged weights are computed from the original ones the first time the function is run
+    _original_weights   = weights;
+    _use_space_to_depth = true;
+
+    _input_space_to_depth.allocator()->allocate();
+    _weights_space_to_depth.allocator()->allocate();
+}
+
+void NEConvolutionLayer::configure_blocked(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                           const ActivationLayerInfo &act_info)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(weights->info()->data_layout() != DataLayout::NCHW);
+    ARM_COMPUTE_ERROR_ON(output->info()->data_layout() != DataLayout::NCHW4);
+    ARM_COMPUTE_ERROR_ON(NEBlockedLayoutKernel::blocked_weights_shape(weights->info()->tensor_shape())[2] != input->info()->dimension(2));
+
+    // The blocked convolution reads the blocked weights as they are, like the direct convolution
+    _is_first_run              = true;
+    _original_weights          = weights;
+    _is_quantized              = false;
+    _is_nhwc                   = false;
+    _is_blocked                = true;
+    _fold_batch_norm           = false;
+    _use_space_to_depth        = false;
+    _use_pointwise_convolution = false;
+    _use_winograd              = false;
+    _use_direct_convolution    = true;
+
+    TensorInfo info_blocked(NEBlockedLayoutKernel::blocked_weights_shape(weights->info()->tensor_shape()), 1, weights->info()->data_type());
+    _weights_blocked.allocator()->init(info_blocked);
+
+    _weights_blocking_kernel.configure_weights(weights, &_weights_blocked);
+    _blocked_conv_kernel.configure(input, &_weights_blocked, biases, output, conv_info, act_info);
+
+    _weights_blocked.allocator()->allocate();
+}
+
+void NEConvolutionLayer::configure_quantized_mm(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
+{
+    const QuantizationInfo input_quantization   = input->info()->quantization_info();
+    const QuantizationInfo weights_quantization = weights->info()->quantization_info();
+    const QuantizationInfo output_quantization  = output->info()->quantization_info();
+    ARM_COMPUTE_ERROR_ON(input_quantization.empty() || weights_quantization.empty() || output_quantization.empty());
+
+    // The accumulators hold the products in the scale input_scale * weights_scale: rescale them to the output scale
+    // then add the output offset to the rescaled values
+    const float multiplier      = input_quantization.scale * weights_quantization.scale / output_quantization.scale;
+    int32_t     output_mult_int = 0;
+    int32_t     output_shift    = 0;
+    std::tie(output_mult_int, output_shift) = quantize_multiplier(multiplier);
+
+    _mm_lowp_kernel.configure_convolution(&_weights_transposed, &_input_interleaved_reshaped, biases, output, -weights_quantization.offset, -input_quantization.offset,
+                                          0, output_mult_int, output_shift, act_info, output_quantization.offset);
+}
+
+void NEConvolutionLayer::configure_winograd(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const PadStrideInfo &conv_info,
+                                            const ActivationLayerInfo &act_info, unsigned int num_tiles)
+{
+    // The GEMM tensors hold the 16 matrices of the Winograd domain, one for each element of a 4x4 tile:
+    // the transformed weights and input take the place of the reshaped weights and of the im2col output.
+    const unsigned int num_ifm = weights->info()->dimension(2);
+    const unsigned int num_ofm = weights->info()->dimension(3);
+
+    // Create tensor to store the transformed weights
+    TensorInfo info_wr(TensorShape(num_ofm, num_ifm, 16U), 1, weights->info()->data_type());
     _weights_reshaped.allocator()->init(info_wr);
 
     // Create tensor to store transposed weights
-    TensorShape shape_wt(mat_weights_rows * 4, static_cast<unsigned int>(std::ceil(mat_weights_cols / 4.f)));
+    TensorShape shape_wt(num_ifm * 4, static_cast<unsigned int>(std::ceil(num_ofm / 4.f)), 16U);
     TensorInfo  info_wt(shape_wt, 1, weights->info()->data_type());
     _weights_transposed.allocator()->init(info_wt);
 
-    // Create tensor to store im2col reshaped inputs
-    const unsigned int mat_input_cols = mat_weights_rows;
-    const unsigned int mat_input_rows = conv_w * conv_h;
-    TensorShape        shape_im2col   = input->info()->tensor_shape();
-    shape_im2col.set(0, mat_input_cols);
-    shape_im2col.set(1, mat_input_rows);
-    shape_im2col.set(2, 1);
-    TensorInfo info_im2col(shape_im2col, 1, input->info()->data_type());
-    _input_im2col_reshaped.allocator()->init(info_im2col);
+    // Create tensor to store the transformed input
+    TensorInfo info_transformed(TensorShape(num_ifm, num_tiles, 16U), 1, input->info()->data_type());
+    _input_im2col_reshaped.allocator()->init(info_transformed);
 
     // Create tensor to prepare input tensor for GEMM
-    TensorShape shape_interleaved = shape_im2col;
-    shape_interleaved.set(0, shape_interleaved.x() * 4);
-    shape_interleaved.set(1, std::ceil(shape_interleaved.y() / 4.f));
-    TensorInfo info_interleaved(shape_interleaved, 1, input->info()->data_type());
+    TensorShape shape_interleaved(num_ifm * 4, static_cast<unsigned int>(std::ceil(num_tiles / 4.f)), 16U);
+    TensorInfo  info_interleaved(shape_interleaved, 1, input->info()->data_type());
     _input_interleaved_reshaped.allocator()->init(info_interleaved);
 
     // Create GEMM output tensor
-    TensorShape shape_gemm = _input_im2col_reshaped.info()->tensor_shape();
-    shape_gemm.set(0, mat_weights_cols);
-    shape_gemm.set(1, mat_input_rows);
-    TensorInfo info_gemm(shape_gemm, 1, input->info()->data_type());
+    TensorInfo info_gemm(TensorShape(num_ofm, num_tiles, 16U), 1, input->info()->data_type());
     _gemm_output.allocator()->init(info_gemm);
 
     // Configure kernels
-    _input_im2col_kernel.configure(input, &_input_im2col_reshaped, std::make_pair(conv_w, conv_h), conv_info, _has_bias);
-    _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
-    _weights_reshape_kernel.configure(weights, biases, &_weights_reshaped);
+    // The transformed weights are only needed the first time the function is run to compute the transposed weights
+    _memory_group.manage(&_weights_reshaped);
+    _winograd_filter_transform_kernel.configure(weights, &_weights_reshaped);
     _weights_transposed_kernel.configure(&_weights_reshaped, &_weights_transposed);
-    _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, &_gemm_output, 1.0f);
-    _output_col2im_kernel.configure(&_gemm_output, output, std::make_pair(conv_w, conv_h));
-
-    // Allocate the tensors once the all configure methods have been called
     _weights_reshaped.allocator()->allocate();
-    _weights_transposed.allocator()->allocate();
+
+    _memory_group.manage(&_input_im2col_reshaped);
+    _winograd_input_transform_kernel.configure(input, &_input_im2col_reshaped, conv_info);
+    _memory_group.manage(&_input_interleaved_reshaped);
+    _input_interleave_kernel.configure(&_input_im2col_reshaped, &_input_interleaved_reshaped);
     _input_im2col_reshaped.allocator()->allocate();
+
+    _memory_group.manage(&_gemm_output);
+    _mm_kernel.configure(&_input_interleaved_reshaped, &_weights_transposed, &_gemm_output, 1.0f);
     _input_interleaved_reshaped.allocator()->allocate();
+
+    _winograd_output_transform_kernel.configure(&_gemm_output, biases, output, act_info);
     _gemm_output.allocator()->allocate();
+
+    _weights_transposed.allocator()->allocate();
 }
 
-void NEConvolutionLayer::run()
+void NEConvolutionLayer::reshape_weights()
 {
-    // Run weights reshaping (Runs once for every configure)
+    _is_first_run = false;
+    if(_fold_batch_norm)
+    {
+        NEScheduler::get().multithread(&_bn_fold_kernel);
+    }
+    if(_use_space_to_depth)
+    {
+        NEScheduler::get().multithread(&_weights_space_to_depth_kernel);
+    }
+    if(_use_winograd)
+    {
+        NEScheduler::get().multithread(&_winograd_filter_transform_kernel);
+        NEScheduler::get().multithread(&_weights_transposed_kernel);
+    }
+    else
+    {
+        // The weights are reshaped directly in the layout read by the matrix multiplication
+        NEScheduler::get().multithread(&_weights_reshape_kernel, 3);
+    }
+
+    release_weights();
+}
+
+void NEConvolutionLayer::release_weights()
+{
+    // Only the transposed weights are read by the matrix multiplication
+    if(_use_winograd)
+    {
+        _weights_reshaped.allocator()->free();
+    }
+    if(_fold_batch_norm)
+    {
+        _folded_weights.allocator()->free();
+    }
+    if(_use_space_to_depth)
+    {
+        _weights_space_to_depth.allocator()->free();
+    }
+    _original_weights->mark_as_unused();
+}
+
+void NEConvolutionLayer::export_reshaped_weights(std::ostream &stream)
+{
+    // The direct and pointwise convolutions read the weights as they are
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return;
+    }
+
+    if(_is_first_run)
+    {
+        reshape_weights();
+    }
+
+    save_tensor_blob(_weights_transposed, stream);
+}
+
+bool NEConvolutionLayer::import_reshaped_weights(std::istream &stream)
+{
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return true;
+    }
+
+    if(!load_tensor_blob(_weights_transposed, stream))
+    {
+        return false;
+    }
+
+    // The imported weights are already folded, but not the biases
+    if(_fold_batch_norm)
+    {
+        NEScheduler::get().multithread(&_bn_fold_biases_kernel);
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+void NEConvolutionLayer::export_reshaped_weights(const std::string &name, std::vector<std::pair<std::string, const ITensor *>> &tensors)
+{
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return;
+    }
+
+    if(_is_first_run)
+    {
+        reshape_weights();
+    }
+
+    tensors.emplace_back(name + ":" + weights_layout(), &_weights_transposed);
+}
+
+bool NEConvolutionLayer::import_reshaped_weights(const ModelFile &model, const std::string &name)
+{
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return true;
+    }
+
+    const std::string stored_name = name + ":" + weights_layout();
+    if(!model.has_tensor(stored_name))
+    {
+        return false;
+    }
+
+    // The memory allocated by configure() is replaced by the mapped weights: it is only allocated again if they don't match
+    _weights_transposed.allocator()->free();
+    if(!import_tensor_neon(model, stored_name, _weights_transposed))
+    {
+        _weights_transposed.allocator()->allocate();
+        return false;
+    }
+
+    // The imported weights are already folded, but not the biases
+    if(_fold_batch_norm)
+    {
+        NEScheduler::get().multithread(&_bn_fold_biases_kernel);
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+std::string NEConvolutionLayer::weights_layout() const
+{
+    std::string layout = _use_winograd ? "NEConvolutionLayer/winograd" : "NEConvolutionLayer/gemm";
+    if(_is_nhwc)
+    {
+        layout += "/nhwc";
+    }
+    if(_fold_batch_norm)
+    {
+        layout += "/batch_norm";
+    }
+    if(_use_space_to_depth)
+    {
+        layout += "/space_to_depth";
+    }
+    return layout;
+}
+
+SharedWeights NEConvolutionLayer::shared_weights()
+{
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return SharedWeights();
+    }
+
     if(_is_first_run)
     {
+        reshape_weights();
+    }
+
+    return SharedWeights(_weights_transposed, weights_layout());
+}
+
+bool NEConvolutionLayer::use_shared_weights(const SharedWeights &weights)
+{
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        return true;
+    }
+
+    // The memory of the reshaped weights is shared: it is released when the last layer or handle reading it is destroyed
+    if(!weights.import_to(_weights_transposed, weights_layout()))
+    {
+        return false;
+    }
+
+    // The shared weights are already folded, but not the biases of this layer
+    if(_fold_batch_norm)
+    {
+        NEScheduler::get().multithread(&_bn_fold_biases_kernel);
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+bool NEConvolutionLayer::share_reshaped_weights(NEConvolutionLayer &source)
+{
+    return use_shared_weights(source.shared_weights());
+}
+
+void NEConvolutionLayer::prepare()
+{
+    if(!_is_first_run)
+    {
+        return;
+    }
+
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        // The direct and pointwise convolutions read the folded, rearranged and blocked weights as they are
         _is_first_run = false;
-        NEScheduler::get().multithread(&_weights_reshape_kernel, 3);
-        NEScheduler::get().multithread(&_weights_transposed_kernel);
+        if(_fold_batch_norm)
+        {
+            NEScheduler::get().multithread(&_bn_fold_kernel);
+        }
+        if(_use_space_to_depth)
+        {
+            NEScheduler::get().multithread(&_weights_space_to_depth_kernel);
+        }
+        if(_is_blocked)
+        {
+            NEScheduler::get().multithread(&_weights_blocking_kernel);
+        }
+        if(_fold_batch_norm || _use_space_to_depth || _is_blocked)
+        {
+            _original_weights->mark_as_unused();
+        }
     }
+    else
+    {
+        reshape_weights();
+    }
+}
 
-    // Run input reshaping
-    NEScheduler::get().multithread(&_input_im2col_kernel);
+void NEConvolutionLayer::run()
+{
+    // Transform the weights (Runs once for every configure, unless prepare() has been called or the reshaped weights have been imported)
+    prepare();
 
-    // Run interleave
-    NEScheduler::get().multithread(&_input_interleave_kernel);
+    if(_use_space_to_depth)
+    {
+        NEScheduler::get().multithread(&_input_space_to_depth_kernel);
+    }
+
+    if(_use_direct_convolution || _use_pointwise_convolution)
+    {
+        if(_use_pointwise_convolution)
+        {
+            NEScheduler::get().multithread(&_pointwise_kernel);
+        }
+        else if(_is_blocked)
+        {
+            NEScheduler::get().multithread(&_blocked_conv_kernel);
+        }
+        else
+        {
+            NEScheduler::get().multithread(&_direct_conv_kernel);
+        }
+        return;
+    }
+
+    // Run input reshaping and interleave
+    if(_use_winograd)
+    {
+        NEScheduler::get().multithread(&_winograd_input_transform_kernel);
+        NEScheduler::get().multithread(&_input_interleave_kernel);
+    }
+    else
+    {
+        NEScheduler::get().multithread(&_input_im2col_kernel);
+    }
 
     // Runs GEMM on reshaped matrices
-    NEScheduler::get().multithread(&_mm_kernel);
+    if(_is_quantized)
+    {
+        NEScheduler::get().multithread(&_mm_lowp_kernel);
+    }
+    else
+    {
+        NEScheduler::get().multithread(&_mm_kernel);
+    }
+
+    // Transform the element-wise products back to the output
+    if(_use_winograd)
+    {
+        NEScheduler::get().multithread(&_winograd_output_transform_kernel);
+    }
+}
+
+bool NEConvolutionLayer::is_tileable() const
+{
+    return !_use_direct_convolution && !_use_pointwise_convolution && !_use_winograd && !_use_space_to_depth && !_is_nhwc;
+}
+
+std::pair<unsigned int, unsigned int> NEConvolutionLayer::input_rows(unsigned int first_row, unsigned int last_row) const
+{
+    ARM_COMPUTE_ERROR_ON(first_row >= last_row);
+
+    const int stride_y = _conv_info.stride().second;
+    const int pad_y    = _conv_info.pad().second;
+    const int first    = static_cast<int>(first_row) * stride_y - pad_y;
+    const int last     = static_cast<int>(last_row - 1) * stride_y - pad_y + static_cast<int>(_kernel_height);
+
+    return std::make_pair(static_cast<unsigned int>(std::max(first, 0)), std::min(static_cast<unsigned int>(std::max(last, 0)), _input_height));
+}
+
+size_t NEConvolutionLayer::tile_working_set(unsigned int num_rows) const
+{
+    // Each row of the im2col output holds the patches of 4 output elements, in every group and batch, and is multiplied by the whole reshaped weights
+    const TensorInfo  &info         = *_input_interleaved_reshaped.info();
+    const unsigned int num_planes   = info.tensor_shape().total_size() / (info.dimension(0) * info.dimension(1));
+    const size_t       im2col_size  = static_cast<size_t>(num_rows) * _output_width * (info.dimension(0) / 4) * info.element_size() * num_planes;
+    const size_t       weights_size = _weights_transposed.info()->total_size();
+
+    return im2col_size + weights_size;
+}
+
+void NEConvolutionLayer::prepare_tiles()
+{
+    ARM_COMPUTE_ERROR_ON(!is_tileable());
+
+    prepare();
+}
+
+void NEConvolutionLayer::run_tile(unsigned int first_row, unsigned int last_row)
+{
+    ARM_COMPUTE_ERROR_ON(!is_tileable());
+    ARM_COMPUTE_ERROR_ON(first_row >= last_row);
+
+    // The matrix multiplication computes blocks of 16 output elements of a feature map: the band is extended to whole blocks,
+    // which recomputes the elements of the previous band sharing its first block
+    const Window      &mm_window  = _is_quantized ? _mm_lowp_kernel.window() : _mm_kernel.window();
+    const unsigned int first_elem = floor_to_multiple(first_row * _output_width, 16);
+    const unsigned int last_elem  = std::min<unsigned int>(ceil_to_multiple(last_row * _output_width, 16), mm_window.x().end());
+
+    // Each row of the im2col output interleaves 4 output elements
+    Window im2col_window(_input_im2col_kernel.window());
+    im2col_window.set(Window::DimY, Window::Dimension(first_elem / 4, std::min<int>(last_elem / 4, im2col_window.y().end()), 1));
+    NEScheduler::get().multithread(&_input_im2col_kernel, im2col_window);
+
+    Window mm_band(mm_window);
+    mm_band.set(Window::DimX, Window::Dimension(first_elem, last_elem, mm_window.x().step()));
+
+    if(_is_quantized)
+    {
+        NEScheduler::get().multithread(&_mm_lowp_kernel, mm_band);
+    }
+    else
+    {
+        NEScheduler::get().multithread(&_mm_kernel, mm_band);
+    }
+}
+
+MemoryFootprint NEConvolutionLayer::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    // The reshaped, transposed and folded weights are kept from one run to the next
+    footprint.add(MemoryCategory::WEIGHTS, _weights_reshaped);
+    footprint.add(MemoryCategory::WEIGHTS, _weights_transposed);
+    footprint.add(MemoryCategory::WEIGHTS, _folded_weights);
+    footprint.add(MemoryCategory::WEIGHTS, _folded_biases);
+    footprint.add(MemoryCategory::WEIGHTS, _weights_space_to_depth);
+    footprint.add(MemoryCategory::WEIGHTS, _weights_blocked);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_space_to_depth);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_im2col_reshaped);
+    footprint.add(MemoryCategory::ACTIVATIONS, _input_interleaved_reshaped);
+    footprint.add(MemoryCategory::ACTIVATIONS, _gemm_output);
 
-    // Reshape output matrix
-    NEScheduler::get().multithread(&_output_col2im_kernel);
+    return footprint;
 }
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NECopy.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
+
+#include <cstring>
+
+using namespace arm_compute;
+
+NECopy::NECopy()
+    : _input(nullptr), _output(nullptr), _copy_kernel(), _convert_kernel(), _is_conversion(false)
+{
+}
+
+void NECopy::configure(const ITensor *input, ITensor *output, ConvertPolicy policy)
+{
+    ARM_COMPUTE_ERROR_ON(input == nullptr || output == nullptr);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(input, output);
+
+    _input         = input;
+    _output        = output;
+    _is_conversion = input->info()->data_type() != output->info()->data_type();
+
+    if(!_is_conversion)
+    {
+        _copy_kernel.configure(input, output);
+    }
+    else if(is_data_type_float(input->info()->data_type()) || is_data_type_float(output->info()->data_type()))
+    {
+        _convert_kernel.configure(input, output);
+    }
+    else
+    {
+        _convert_kernel.configure(input, output, policy, 0);
+    }
+}
+
+void NECopy::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_input == nullptr, "The function has not been configured");
+
+    if(_is_conversion)
+    {
+        NEScheduler::get().multithread(&_convert_kernel);
+    }
+    else if(has_contiguous_layout(*_input->info()) && has_contiguous_layout(*_output->info()))
+    {
+        // Same data type and no gap in either tensor: the two buffers have the same layout
+        const TensorInfo *info = _input->info();
+        std::memcpy(_output->buffer(), _input->buffer(), info->tensor_shape().total_size() * info->element_size());
+    }
+    else
+    {
+        NEScheduler::get().multithread(&_copy_kernel);
+    }
+}
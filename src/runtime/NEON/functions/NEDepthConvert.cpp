@@ -42,3 +42,10 @@ void NEDepthConvert::configure(const ITensor *input, ITensor *output, ConvertPol
     k->configure(input, output, policy, shift);
     _kernel = std::move(k);
 }
+
+void NEDepthConvert::configure(const ITensor *input, ITensor *output, float scale, float offset)
+{
+    auto k = arm_compute::cpp14::make_unique<NEDepthConvertKernel>();
+    k->configure(input, output, scale, offset);
+    _kernel = std::move(k);
+}
@@ -32,7 +32,7 @@
 using namespace arm_compute;
 
 NEEqualizeHistogram::NEEqualizeHistogram()
-    : _histogram_kernel(), _cd_histogram_kernel(), _map_histogram_kernel(), _hist(nr_bins, 0, max_range), _cum_dist(nr_bins, 0, max_range), _cd_lut(nr_bins, DataType::U8)
+    : _equalize_kernel()
 {
 }
 
@@ -43,20 +43,11 @@ void NEEqualizeHistogram::configure(const IImage *input, IImage *output)
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
 
-    // Configure kernels
-    _histogram_kernel.configure(input, &_hist);
-    _cd_histogram_kernel.configure(input, &_hist, &_cum_dist, &_cd_lut);
-    _map_histogram_kernel.configure(input, &_cd_lut, output);
+    _equalize_kernel.configure(input, output);
 }
 
 void NEEqualizeHistogram::run()
 {
-    // Calculate histogram of input.
-    NEScheduler::get().multithread(&_histogram_kernel);
-
-    // Calculate cumulative distribution of histogram and create LUT.
-    _cd_histogram_kernel.run(_cd_histogram_kernel.window());
-
-    // Map input to output using created LUT.
-    NEScheduler::get().multithread(&_map_histogram_kernel);
+    // The threads compute their histograms, wait for each other, then map their part of the image with the merged cumulative distribution
+    NEScheduler::get().multithread(&_equalize_kernel);
 }
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/NEON/kernels/NEErodeKernel.h"
+#include "arm_compute/core/NEON/kernels/NEMorphologyKernel.h"
 #include "arm_compute/core/PixelValue.h"
 
 #include <utility>
@@ -38,3 +39,17 @@ void NEErode::configure(ITensor *input, ITensor *output, BorderMode border_mode,
     _kernel = std::move(k);
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
+
+void NEErode::configure(ITensor *input, ITensor *output, const Size2D &structuring_element, BorderMode border_mode, uint8_t constant_border_value)
+{
+    if(3 == structuring_element.width && 3 == structuring_element.height)
+    {
+        configure(input, output, border_mode, constant_border_value);
+        return;
+    }
+
+    auto k = arm_compute::cpp14::make_unique<NEMorphologyKernel>();
+    k->configure(input, output, MorphologyOperation::ERODE, structuring_element, border_mode == BorderMode::UNDEFINED);
+    _kernel = std::move(k);
+    _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
+}
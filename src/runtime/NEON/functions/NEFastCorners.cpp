@@ -25,24 +25,14 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/ITensor.h"
-#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
-#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
-#include "arm_compute/runtime/Array.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/TensorAllocator.h"
 
 using namespace arm_compute;
 
 NEFastCorners::NEFastCorners()
-    : _fast_corners_kernel(),
-      _border_handler(),
-      _nonmax_kernel(),
-      _fill_kernel(),
-      _output(),
-      _suppressed(),
-      _non_max(false)
+    : _fast_corners_kernel()
 {
 }
 
@@ -54,48 +44,14 @@ void NEFastCorners::configure(IImage *input, float threshold, bool nonmax_suppre
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == corners);
     ARM_COMPUTE_ERROR_ON(threshold < 1 && threshold > 255);
+    ARM_COMPUTE_UNUSED(constant_border_value);
 
-    _non_max = nonmax_suppression;
-
-    TensorInfo tensor_info(input->info()->tensor_shape(), Format::U8);
-    _output.allocator()->init(tensor_info);
-
-    // If border is UNDEFINED _fast_corners_kernel will operate in xwindow (3,
-    // width - 3) and ywindow (3, height -3) so the output image will leave the
-    // pixels on the borders unchanged. This is reflected in the valid region
-    // of the output. The non maxima suppression is only run on the valid
-    // pixels.
-    _fast_corners_kernel.configure(input, &_output, threshold, nonmax_suppression, BorderMode::UNDEFINED == border_mode);
-    _border_handler.configure(input, _fast_corners_kernel.border_size(), border_mode, constant_border_value);
-
-    if(!_non_max)
-    {
-        _fill_kernel.configure(&_output, 1 /* we keep all texels >0 */, corners);
-    }
-    else
-    {
-        _suppressed.allocator()->init(tensor_info);
-        _nonmax_kernel.configure(&_output, &_suppressed, BorderMode::UNDEFINED == border_mode);
-        _fill_kernel.configure(&_suppressed, 1 /* we keep all texels >0 */, corners);
-
-        // Allocate intermediate tensors
-        _suppressed.allocator()->allocate();
-    }
-
-    // Allocate intermediate tensors
-    _output.allocator()->allocate();
+    // The border is UNDEFINED: the kernel only looks for corners 3 pixels away from the edges
+    // (4 with the non-maxima suppression) and appends them straight to the array, without any score image.
+    _fast_corners_kernel.configure(input, threshold, nonmax_suppression, corners);
 }
 
 void NEFastCorners::run()
 {
-    _border_handler.run(_border_handler.window());
-
     NEScheduler::get().multithread(&_fast_corners_kernel);
-
-    if(_non_max)
-    {
-        NEScheduler::get().multithread(&_nonmax_kernel);
-    }
-
-    NEScheduler::get().multithread(&_fill_kernel);
 }
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEFrameGradients.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/functions/NEDerivative.h"
+#include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
+#include "arm_compute/runtime/NEON/functions/NESobel3x3.h"
+#include "arm_compute/runtime/NEON/functions/NESobel5x5.h"
+#include "arm_compute/runtime/NEON/functions/NESobel7x7.h"
+#include "arm_compute/runtime/TensorAllocator.h"
+
+#include <utility>
+
+using namespace arm_compute;
+
+NEFrameGradients::NEFrameGradients()
+    : _filter(), _gx(), _gy()
+{
+}
+
+void NEFrameGradients::configure(ITensor *input, GradientType type, BorderMode border_mode, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(input);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
+
+    const TensorInfo info(input->info()->tensor_shape(), (GradientType::SOBEL_7x7 == type) ? Format::S32 : Format::S16);
+    _gx.allocator()->init(info);
+    _gy.allocator()->init(info);
+
+    switch(type)
+    {
+        case GradientType::DERIVATIVE:
+        {
+            auto k = arm_compute::cpp14::make_unique<NEDerivative>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _filter = std::move(k);
+            break;
+        }
+        case GradientType::SOBEL_3x3:
+        {
+            auto k = arm_compute::cpp14::make_unique<NESobel3x3>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _filter = std::move(k);
+            break;
+        }
+        case GradientType::SOBEL_5x5:
+        {
+            auto k = arm_compute::cpp14::make_unique<NESobel5x5>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _filter = std::move(k);
+            break;
+        }
+        case GradientType::SOBEL_7x7:
+        {
+            auto k = arm_compute::cpp14::make_unique<NESobel7x7>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _filter = std::move(k);
+            break;
+        }
+        case GradientType::SCHARR_3x3:
+        {
+            auto k = arm_compute::cpp14::make_unique<NEScharr3x3>();
+            k->configure(input, &_gx, &_gy, border_mode, constant_border_value);
+            _filter = std::move(k);
+            break;
+        }
+        default:
+            ARM_COMPUTE_ERROR("Gradient type not supported");
+    }
+}
+
+void NEFrameGradients::allocate()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_filter == nullptr, "The function has not been configured");
+
+    _gx.allocator()->allocate();
+    _gy.allocator()->allocate();
+}
+
+Tensor *NEFrameGradients::gx()
+{
+    return &_gx;
+}
+
+Tensor *NEFrameGradients::gy()
+{
+    return &_gy;
+}
+
+void NEFrameGradients::run()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_filter == nullptr, "The function has not been configured");
+    ARM_COMPUTE_ERROR_ON_MSG(_gx.buffer() == nullptr, "The gradients have not been allocated");
+
+    _filter->run();
+}
@@ -23,21 +23,34 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEFullyConnectedLayer.h"
 
+#include "arm_compute/core/NEON/NEFP16Storage.h"
+#include "arm_compute/core/Utils.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEModelFile.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
+#include "arm_compute/runtime/TensorBlob.h"
 
 #include <algorithm>
 #include <cmath>
+#include <string>
+#include <tuple>
 
 using namespace arm_compute;
 
-NEFullyConnectedLayer::NEFullyConnectedLayer()
-    : _im2col_kernel(), _transpose_kernel(), _transpose1xW_kernel(), _interleave4x4_kernel(), _mm_kernel(), _accumulate_biases_kernel(), _im2col_output(), _interleave4x4_output(), _transpose_output(),
-      _transpose1xW_output(), _is_first_run(true), _transpose_weights(true), _fc_after_conv(false), _batched_fc_layer(false), _accumulate_biases(false)
+namespace
+{
+/** All the matrix multiplications read the output of the 1xW transpose: the batched and non batched layers can share it */
+const std::string weights_layout = "NEFullyConnectedLayer/1xW";
+} // namespace
+
+NEFullyConnectedLayer::NEFullyConnectedLayer(std::shared_ptr<MemoryPlanner> memory_planner)
+    : _memory_group(std::move(memory_planner)), _im2col_kernel(), _transpose_kernel(), _transpose1xW_kernel(), _interleave4x4_kernel(), _mm_kernel(), _mv_kernel(), _sparse_mv_kernel(), _mm_lowp_kernel(), _im2col_output(), _interleave4x4_output(),
+      _transpose_output(), _transpose1xW_output(), _original_weights(nullptr), _is_first_run(true), _transpose_weights(true), _fc_after_conv(false), _batched_fc_layer(false), _is_quantized(false),
+      _is_sparse(false)
 {
 }
 
-void NEFullyConnectedLayer::configure_conv_fc_wb(const ITensor *input, const ITensor *weights, ITensor *output)
+void NEFullyConnectedLayer::configure_conv_fc_wb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
 {
     ARM_COMPUTE_ERROR_ON(weights->info()->dimension(1) != (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
 
@@ -57,29 +70,32 @@ void NEFullyConnectedLayer::configure_conv_fc_wb(const ITensor *input, const ITe
     shape_interleaved.set(1, std::ceil(static_cast<float>(shape_interleaved.y()) / 4));
     _interleave4x4_output.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
 
-    // Initialize output tensor for transpose 1xW
-    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
+    // Initialize output tensor for transpose 1xW: the blocks are 8 elements wide in half precision, unless it is computed in single precision
+    const unsigned int transpose_w = ((weights->info()->data_type() == DataType::F16) && !is_fp16_storage_only()) ? 8 : 4;
+    TensorShape        shape_transposed1xW(weights->info()->dimension(1) * transpose_w, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / static_cast<float>(transpose_w))));
     _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
 
     // Configure im2col kernel
+    _memory_group.manage(&_im2col_output);
     _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
 
     // Configure interleave4x4 kernel
+    _memory_group.manage(&_interleave4x4_output);
     _interleave4x4_kernel.configure(&_im2col_output, &_interleave4x4_output);
+    _im2col_output.allocator()->allocate();
 
     // Configure transpose 1xW kernel
     _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
 
-    // Configure matrix multiply kernel
-    _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f);
+    // Configure matrix multiply kernel: the biases are added and the activation function is applied while the output is stored
+    _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f, biases, act_info);
 
     // Allocate the tensors once all the configure methods have been called
-    _im2col_output.allocator()->allocate();
     _interleave4x4_output.allocator()->allocate();
     _transpose1xW_output.allocator()->allocate();
 }
 
-void NEFullyConnectedLayer::configure_fc_fc_wb(const ITensor *input, const ITensor *weights, ITensor *output)
+void NEFullyConnectedLayer::configure_fc_fc_wb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
 {
     // Initialize output tensor for interleave 4x4
     TensorShape shape_interleaved = input->info()->tensor_shape();
@@ -87,25 +103,28 @@ void NEFullyConnectedLayer::configure_fc_fc_wb(const ITensor *input, const ITens
     shape_interleaved.set(1, std::ceil(static_cast<float>(shape_interleaved.y()) / 4));
     _interleave4x4_output.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
 
-    // Initialize output tensor for transpose 1xW
-    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
+    // Initialize output tensor for transpose 1xW: the blocks are 8 elements wide in half precision, unless it is computed in single precision
+    const unsigned int transpose_w = ((weights->info()->data_type() == DataType::F16) && !is_fp16_storage_only()) ? 8 : 4;
+    TensorShape        shape_transposed1xW(weights->info()->dimension(1) * transpose_w, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / static_cast<float>(transpose_w))));
     _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
 
     // Configure interleave4x4 kernel
+    _memory_group.manage(&_interleave4x4_output);
     _interleave4x4_kernel.configure(input, &_interleave4x4_output);
 
     // Configure transpose 1xW kernel
     _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
 
-    // Configure matrix multiply kernel
-    _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f);
+    // Configure matrix multiply kernel: the biases are added and the activation function is applied while the output is stored
+    _mm_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, 1.0f, biases, act_info);
 
     // Allocate the tensors once all the configure methods have been called
     _interleave4x4_output.allocator()->allocate();
     _transpose1xW_output.allocator()->allocate();
 }
 
-void NEFullyConnectedLayer::configure_conv_fc_nb(const ITensor *input, const ITensor *weights, ITensor *output)
+void NEFullyConnectedLayer::configure_conv_fc_nb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                                                 const ITensor *weights_scales)
 {
     ARM_COMPUTE_ERROR_ON((weights->info()->dimension(1) != (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2))));
 
@@ -118,46 +137,144 @@ void NEFullyConnectedLayer::configure_conv_fc_nb(const ITensor *input, const ITe
     _im2col_output.allocator()->init(TensorInfo(shape_im2col, 1, input->info()->data_type()));
 
     // Configure im2col kernel
+    _memory_group.manage(&_im2col_output);
     _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
 
-    // Configure matrix multiply kernel
-    _mm_kernel.configure(&_im2col_output, weights, output, 1.0f);
+    // Configure matrix-vector multiply kernel
+    configure_matrix_vector(&_im2col_output, weights, biases, output, act_info, weights_scales);
 
     // Allocate the output tensor for im2col once all the configure methods have been called
     _im2col_output.allocator()->allocate();
 }
 
-void NEFullyConnectedLayer::configure_fc_fc_nb(const ITensor *input, const ITensor *weights, ITensor *output)
+void NEFullyConnectedLayer::configure_fc_fc_nb(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                                               const ITensor *weights_scales)
 {
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != weights->info()->dimension(1));
 
-    // Configure matrix multiply kernel
-    _mm_kernel.configure(input, weights, output, 1.0f);
+    // Configure matrix-vector multiply kernel
+    configure_matrix_vector(input, weights, biases, output, act_info, weights_scales);
 }
 
-void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights)
+void NEFullyConnectedLayer::configure_matrix_vector(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info,
+                                                    const ITensor *weights_scales)
 {
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::F32);
-    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights, output);
+    // Initialize output tensor for transpose 1xW: the weights of 4 consecutive outputs are read from consecutive memory positions
+    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
+    _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
+
+    // Configure transpose 1xW kernel
+    _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
+
+    // Configure matrix-vector multiply kernel: the weights are dequantized, the biases are added and the activation function is applied while the output is stored
+    _mv_kernel.configure(input, &_transpose1xW_output, biases, output, act_info, weights_scales);
+
+    // Allocate the tensor once all the configure methods have been called
+    _transpose1xW_output.allocator()->allocate();
+}
+
+void NEFullyConnectedLayer::configure_quantized(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
+{
+    const QuantizationInfo input_quantization   = input->info()->quantization_info();
+    const QuantizationInfo weights_quantization = _original_weights->info()->quantization_info();
+    const QuantizationInfo output_quantization  = output->info()->quantization_info();
+    ARM_COMPUTE_ERROR_ON(input_quantization.empty() || weights_quantization.empty() || output_quantization.empty());
+
+    if(biases != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(biases, 1, DataType::S32);
+    }
+
+    // The quantized matrix multiplication only reads reshaped matrices, even without batches
+    _batched_fc_layer = true;
+    _fc_after_conv    = (input->info()->dimension(0) != weights->info()->dimension(1));
+
+    const ITensor *input_to_use = input;
+
+    if(_fc_after_conv)
+    {
+        // Linearize the input: one row per batch
+        TensorShape shape_im2col;
+        shape_im2col.set(0, weights->info()->dimension(1));
+        shape_im2col.set(1, input->info()->dimension(3));
+        shape_im2col.set(2, input->info()->dimension(4));
+        shape_im2col.set(3, input->info()->dimension(5));
+        _im2col_output.allocator()->init(TensorInfo(shape_im2col, 1, input->info()->data_type()));
+
+        _memory_group.manage(&_im2col_output);
+        _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
+
+        input_to_use = &_im2col_output;
+    }
+
+    // Initialize output tensor for interleave 4x4
+    TensorShape shape_interleaved = input_to_use->info()->tensor_shape();
+    shape_interleaved.set(0, shape_interleaved.x() * 4);
+    shape_interleaved.set(1, std::ceil(static_cast<float>(shape_interleaved.y()) / 4));
+    _interleave4x4_output.allocator()->init(TensorInfo(shape_interleaved, 1, input->info()->data_type()));
+
+    // Initialize output tensor for transpose 1xW
+    TensorShape shape_transposed1xW(weights->info()->dimension(1) * 4, static_cast<size_t>(std::ceil(weights->info()->dimension(0) / 4.f)));
+    _transpose1xW_output.allocator()->init(TensorInfo(shape_transposed1xW, 1, weights->info()->data_type()));
+
+    _memory_group.manage(&_interleave4x4_output);
+    _interleave4x4_kernel.configure(input_to_use, &_interleave4x4_output);
+    if(_fc_after_conv)
+    {
+        _im2col_output.allocator()->allocate();
+    }
+
+    _transpose1xW_kernel.configure(weights, &_transpose1xW_output);
+
+    // Rescale the accumulators, which hold the products in the scale input_scale * weights_scale, to the output scale,
+    // then add the output offset to the rescaled values
+    const float multiplier      = input_quantization.scale * weights_quantization.scale / output_quantization.scale;
+    int32_t     output_mult_int = 0;
+    int32_t     output_shift    = 0;
+    std::tie(output_mult_int, output_shift) = quantize_multiplier(multiplier);
+
+    // The biases and the activation function are applied while the output is stored
+    _mm_lowp_kernel.configure(&_interleave4x4_output, &_transpose1xW_output, output, -input_quantization.offset, -weights_quantization.offset, 0, output_mult_int, output_shift,
+                              biases, act_info, output_quantization.offset);
+
+    // Allocate the tensors once all the configure methods have been called
+    _interleave4x4_output.allocator()->allocate();
+    _transpose1xW_output.allocator()->allocate();
+}
+
+void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weights, const ITensor *biases, ITensor *output, bool transpose_weights, const ActivationLayerInfo &act_info,
+                                      const ITensor *weights_scales)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8, DataType::F16, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
     ARM_COMPUTE_ERROR_ON(weights->info()->num_dimensions() != 2);
 
+    // Only the matrix-vector multiplication dequantizes the weights of an F32 input
+    if(weights_scales != nullptr)
+    {
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(weights, 1, DataType::U8);
+        ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) > 1);
+    }
+    else
+    {
+        ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, weights);
+    }
+
+    _original_weights  = weights;
     _is_first_run      = true;
     _transpose_weights = transpose_weights;
     _fc_after_conv     = true;
     _batched_fc_layer  = false;
-    _accumulate_biases = false;
+    _is_quantized      = (input->info()->data_type() == DataType::U8);
+    _is_sparse         = false;
 
     const ITensor *weights_to_use = weights;
 
-    if(biases != nullptr)
+    if(biases != nullptr && !_is_quantized)
     {
         ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, biases);
-
-        _accumulate_biases = true;
-
-        // Configure accumulate biases kernel
-        _accumulate_biases_kernel.configure(output, biases);
     }
 
     // Check if we need to transpose the weights
@@ -171,45 +288,60 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
         weights_to_use = &_transpose_output;
     }
 
-    // With the Fully Connected layer we can have 4 different cases:
-    //  1) Convolution layer -> Fully Connected layer without batches
-    //  2) Fully Connected layer -> Fully Connected layer without batches
-    //  3) Convolution layer -> Fully Connected layer with batches
-    //  4) Fully Connected layer -> Fully Connected layer with batches
-
-    // Check if we have a fully connected layer with batches
-    _batched_fc_layer = (output->info()->dimension(1) > 1);
-
-    if(_batched_fc_layer)
+    if(_is_quantized)
     {
-        _fc_after_conv = (TensorShape::num_max_dimensions >= 4) && (std::equal(input->info()->tensor_shape().cbegin() + 3,
-                                                                               input->info()->tensor_shape().cend(),
-                                                                               output->info()->tensor_shape().cbegin() + 1));
-
-        if(_fc_after_conv)
-        {
-            // Fully Connected layer after a Convolution Layer with batches
-            configure_conv_fc_wb(input, weights_to_use, output);
-        }
-        else
-        {
-            // Fully Connected layer after a Fully Connected Layer with batches
-            configure_fc_fc_wb(input, weights_to_use, output);
-        }
+        configure_quantized(input, weights_to_use, biases, output, act_info);
     }
     else
     {
-        _fc_after_conv = (weights_to_use->info()->dimension(1) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+        // With the Fully Connected layer we can have 4 different cases:
+        //  1) Convolution layer -> Fully Connected layer without batches
+        //  2) Fully Connected layer -> Fully Connected layer without batches
+        //  3) Convolution layer -> Fully Connected layer with batches
+        //  4) Fully Connected layer -> Fully Connected layer with batches
+
+        // Check if we have a fully connected layer with batches.
+        // The matrix-vector multiplication is only implemented in single precision: half precision layers always use the matrix multiplication
+        _batched_fc_layer = (output->info()->dimension(1) > 1) || (input->info()->data_type() == DataType::F16);
 
-        if(_fc_after_conv)
+        if(_batched_fc_layer)
         {
-            // Fully Connected layer after a Convolution Layer without batches
-            configure_conv_fc_nb(input, weights_to_use, output);
+            if(output->info()->dimension(1) > 1)
+            {
+                _fc_after_conv = (TensorShape::num_max_dimensions >= 4) && (std::equal(input->info()->tensor_shape().cbegin() + 3,
+                                                                                       input->info()->tensor_shape().cend(),
+                                                                                       output->info()->tensor_shape().cbegin() + 1));
+            }
+            else
+            {
+                _fc_after_conv = (input->info()->dimension(0) != weights_to_use->info()->dimension(1));
+            }
+
+            if(_fc_after_conv)
+            {
+                // Fully Connected layer after a Convolution Layer with batches
+                configure_conv_fc_wb(input, weights_to_use, biases, output, act_info);
+            }
+            else
+            {
+                // Fully Connected layer after a Fully Connected Layer with batches
+                configure_fc_fc_wb(input, weights_to_use, biases, output, act_info);
+            }
         }
         else
         {
-            // Fully Connected layer after a Fully Connected Layer without batches
-            configure_fc_fc_nb(input, weights_to_use, output);
+            _fc_after_conv = (weights_to_use->info()->dimension(1) == (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+
+            if(_fc_after_conv)
+            {
+                // Fully Connected layer after a Convolution Layer without batches
+                configure_conv_fc_nb(input, weights_to_use, biases, output, act_info, weights_scales);
+            }
+            else
+            {
+                // Fully Connected layer after a Fully Connected Layer without batches
+                configure_fc_fc_nb(input, weights_to_use, biases, output, act_info, weights_scales);
+            }
         }
     }
 
@@ -220,22 +352,174 @@ void NEFullyConnectedLayer::configure(const ITensor *input, const ITensor *weigh
     }
 }
 
-void NEFullyConnectedLayer::run()
+void NEFullyConnectedLayer::configure(const ITensor *input, const BlockSparseMatrix *weights, const ITensor *biases, ITensor *output, const ActivationLayerInfo &act_info)
 {
-    // Reshape of the weights (happens only once)
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(input, output);
+    ARM_COMPUTE_ERROR_ON(weights == nullptr);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) > 1);
+    ARM_COMPUTE_ERROR_ON(output->info()->dimension(0) != weights->num_outputs());
+
+    // The sparse weights are read as they are: there are no weights to reshape
+    _original_weights  = nullptr;
+    _is_first_run      = false;
+    _transpose_weights = false;
+    _batched_fc_layer  = false;
+    _is_quantized      = false;
+    _is_sparse         = true;
+    _fc_after_conv     = (input->info()->dimension(0) != weights->num_inputs());
+
+    const ITensor *input_to_use = input;
+
+    if(_fc_after_conv)
+    {
+        ARM_COMPUTE_ERROR_ON(weights->num_inputs() != (input->info()->dimension(0) * input->info()->dimension(1) * input->info()->dimension(2)));
+
+        // If the fully connected layer is called after a convolution layer, the input tensor must be linearized
+        TensorShape shape_im2col;
+        shape_im2col.set(0, weights->num_inputs());
+        shape_im2col.set(1, 1);
+        _im2col_output.allocator()->init(TensorInfo(shape_im2col, 1, input->info()->data_type()));
+
+        _memory_group.manage(&_im2col_output);
+        _im2col_kernel.configure(input, &_im2col_output, std::make_pair(1, 1), PadStrideInfo(1, 1, 0, 0), false);
+
+        input_to_use = &_im2col_output;
+    }
+
+    // Configure sparse matrix-vector multiply kernel: the biases are added and the activation function is applied while the output is stored
+    _sparse_mv_kernel.configure(input_to_use, weights->values(), weights->indices(), weights->offsets(), biases, output, act_info);
+
+    if(_fc_after_conv)
+    {
+        _im2col_output.allocator()->allocate();
+    }
+}
+
+void NEFullyConnectedLayer::reshape_weights()
+{
+    _is_first_run = false;
+    if(_transpose_weights)
+    {
+        NEScheduler::get().multithread(&_transpose_kernel);
+    }
+    NEScheduler::get().multithread(&_transpose1xW_kernel);
+
+    release_weights();
+}
+
+void NEFullyConnectedLayer::release_weights()
+{
+    // The transposed weights are only needed to compute the output of the 1xW transpose
+    if(_transpose_weights)
+    {
+        _transpose_output.allocator()->free();
+    }
+    _original_weights->mark_as_unused();
+}
+
+void NEFullyConnectedLayer::export_reshaped_weights(std::ostream &stream)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
     if(_is_first_run)
     {
-        _is_first_run = false;
-        if(_transpose_weights)
-        {
-            NEScheduler::get().multithread(&_transpose_kernel);
-        }
-        if(_batched_fc_layer)
-        {
-            NEScheduler::get().multithread(&_transpose1xW_kernel);
-        }
+        reshape_weights();
+    }
+
+    // The matrix multiplications read the output of the 1xW transpose, which is computed from the transposed weights
+    save_tensor_blob(_transpose1xW_output, stream);
+}
+
+bool NEFullyConnectedLayer::import_reshaped_weights(std::istream &stream)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
+    if(!load_tensor_blob(_transpose1xW_output, stream))
+    {
+        return false;
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+void NEFullyConnectedLayer::export_reshaped_weights(const std::string &name, std::vector<std::pair<std::string, const ITensor *>> &tensors)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
+    if(_is_first_run)
+    {
+        reshape_weights();
     }
 
+    tensors.emplace_back(name + ":" + weights_layout, &_transpose1xW_output);
+}
+
+bool NEFullyConnectedLayer::import_reshaped_weights(const ModelFile &model, const std::string &name)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
+    const std::string stored_name = name + ":" + weights_layout;
+    if(!model.has_tensor(stored_name))
+    {
+        return false;
+    }
+
+    // The memory allocated by configure() is replaced by the mapped weights: it is only allocated again if they don't match
+    _transpose1xW_output.allocator()->free();
+    if(!import_tensor_neon(model, stored_name, _transpose1xW_output))
+    {
+        _transpose1xW_output.allocator()->allocate();
+        return false;
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+SharedWeights NEFullyConnectedLayer::shared_weights()
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
+    if(_is_first_run)
+    {
+        reshape_weights();
+    }
+
+    return SharedWeights(_transpose1xW_output, weights_layout);
+}
+
+bool NEFullyConnectedLayer::use_shared_weights(const SharedWeights &weights)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(_is_sparse, "Sparse weights are not reshaped");
+
+    // The memory of the reshaped weights is shared: it is released when the last layer or handle reading it is destroyed
+    if(!weights.import_to(_transpose1xW_output, weights_layout))
+    {
+        return false;
+    }
+
+    _is_first_run = false;
+    release_weights();
+    return true;
+}
+
+void NEFullyConnectedLayer::prepare()
+{
+    if(_is_first_run)
+    {
+        reshape_weights();
+    }
+}
+
+void NEFullyConnectedLayer::run()
+{
+    // Reshape of the weights (happens only once, unless prepare() has been called or the reshaped weights have been imported)
+    prepare();
+
     // Linearize input if comes from a convolutional layer
     if(_fc_after_conv)
     {
@@ -248,12 +532,33 @@ void NEFullyConnectedLayer::run()
         NEScheduler::get().multithread(&_interleave4x4_kernel);
     }
 
-    // Run matrix multiply
-    NEScheduler::get().multithread(&_mm_kernel);
-
-    // Accumulate biases if provided
-    if(_accumulate_biases)
+    // Run matrix multiply: the matrix-vector multiplication is split along the columns of the output
+    if(_is_quantized)
+    {
+        NEScheduler::get().multithread(&_mm_lowp_kernel, Window::DimY);
+    }
+    else if(_batched_fc_layer)
     {
-        NEScheduler::get().multithread(&_accumulate_biases_kernel);
+        NEScheduler::get().multithread(&_mm_kernel, Window::DimY);
     }
+    else if(_is_sparse)
+    {
+        NEScheduler::get().multithread(&_sparse_mv_kernel, Window::DimX);
+    }
+    else
+    {
+        NEScheduler::get().multithread(&_mv_kernel, Window::DimX);
+    }
+
+}
+
+MemoryFootprint NEFullyConnectedLayer::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::WEIGHTS, _transpose_output);
+    footprint.add(MemoryCategory::WEIGHTS, _transpose1xW_output);
+    footprint.add(MemoryCategory::ACTIVATIONS, _im2col_output);
+    footprint.add(MemoryCategory::ACTIVATIONS, _interleave4x4_output);
+
+    return footprint;
 }
@@ -26,6 +26,7 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/NEFP16Storage.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Types.h"
 #include "arm_compute/core/Validate.h"
@@ -37,11 +38,12 @@
 using namespace arm_compute;
 
 NEGEMM::NEGEMM()
-    : _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _ma_kernel(), _tmp_a(), _tmp_b(), _run_vector_matrix_multiplication(false), _run_addition(false)
+    : _interleave_kernel(), _transpose_kernel(), _mm_kernel(), _blocked_mm_kernel(), _small_mm_kernel(), _ma_kernel(), _tmp_a(), _tmp_b(), _original_b(nullptr), _is_b_constant(false),
+      _is_first_run(false), _run_vector_matrix_multiplication(false), _run_blocked_multiplication(false), _run_small_multiplication(false), _run_addition(false)
 {
 }
 
-void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta)
+void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITensor *d, float alpha, float beta, GEMMBackend backend, bool constant_b, const GEMMSmallThresholds &thresholds)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(a, 1, DataType::F32, DataType::F16);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(b, 1, DataType::F32, DataType::F16);
@@ -51,15 +53,22 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
     {
         ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(c, 1, DataType::F32, DataType::F16);
         ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, c);
-        ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(1) != c->info()->dimension(1), "The C matrix must have the same number of rows as the matrix A");
-        ARM_COMPUTE_ERROR_ON_MSG(b->info()->dimension(0) != c->info()->dimension(0), "The C matrix must have the same number of columns as the matrix C");
-        ARM_COMPUTE_ERROR_ON_MSG(c->info()->dimension(0) != d->info()->dimension(0), "The C matrix must have the same number of rows as the output matrix");
-        ARM_COMPUTE_ERROR_ON_MSG(c->info()->dimension(1) != d->info()->dimension(1), "The C matrix must have the same number of columns as the output matrix");
+        ARM_COMPUTE_ERROR_ON_MSG(b->info()->dimension(0) != c->info()->dimension(0), "The C matrix must have the same number of columns as the matrix B");
+        ARM_COMPUTE_ERROR_ON_MSG(c->info()->dimension(0) != d->info()->dimension(0), "The C matrix must have the same number of columns as the output matrix");
+        ARM_COMPUTE_ERROR_ON_MSG((c->info()->dimension(1) != 1) && (c->info()->dimension(1) != d->info()->dimension(1)), "The C matrix must be a row vector or have the same number of rows as the output matrix");
     }
 
     ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(a, b, d);
     ARM_COMPUTE_ERROR_ON_MSG(a->info()->dimension(0) != b->info()->dimension(1), "The product AB is defined only if the number of columns in A is equal to the number of rows in B");
 
+    _run_vector_matrix_multiplication = false;
+    _run_blocked_multiplication       = false;
+    _run_small_multiplication         = false;
+    _run_addition                     = (beta != 0) && (c != nullptr);
+    _original_b                       = b;
+    _is_b_constant                    = false;
+    _is_first_run                     = true;
+
     // Check if the first input tensor is a vector and the data type is F32. If so, all the kernels for reshaping the tensors can be skipped
     if((a->info()->dimension(1) == 1) && (a->info()->data_type() == DataType::F32))
     {
@@ -68,10 +77,24 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
         // Configure the matrix multiply kernel
         _mm_kernel.configure(a, b, d, alpha);
     }
-    else
+    else if((backend == GEMMBackend::SMALL || (backend == GEMMBackend::AUTO && thresholds.is_small(d->info()->dimension(1), d->info()->dimension(0), a->info()->dimension(0))))
+            && (a->info()->data_type() == DataType::F32) && (d->info()->num_dimensions() <= 2))
+    {
+        _run_small_multiplication = true;
+
+        // The small kernel reads the matrices without reshaping them and adds beta * C itself
+        _small_mm_kernel.configure(a, b, d, alpha, _run_addition ? c : nullptr, beta);
+        _run_addition = false;
+    }
+    else if((backend == GEMMBackend::BLOCKED) && (a->info()->data_type() == DataType::F32) && (d->info()->num_dimensions() <= 2))
     {
-        _run_vector_matrix_multiplication = false;
+        _run_blocked_multiplication = true;
 
+        // The blocked kernel packs the matrices itself
+        _blocked_mm_kernel.configure(a, b, d, alpha);
+    }
+    else
+    {
         TensorShape shape_tmp_a = a->info()->tensor_shape();
         TensorShape shape_tmp_b = b->info()->tensor_shape();
 
@@ -87,10 +110,12 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
                 break;
             }
             case DataType::F16:
-#ifdef ARM_COMPUTE_ENABLE_FP16
+#if defined(ARM_COMPUTE_ENABLE_FP16) || defined(ARM_COMPUTE_MULTI_ISA) || defined(ARM_COMPUTE_ENABLE_FP16_STORAGE)
                 {
-                    shape_tmp_b.set(0, b->info()->dimension(1) * 8);
-                    shape_tmp_b.set(1, std::ceil(b->info()->dimension(0) / 8.0f));
+                    // The blocks are 4 elements wide like in single precision if the product is computed in single precision
+                    const unsigned int transpose_w = is_fp16_storage_only() ? 4 : 8;
+                    shape_tmp_b.set(0, b->info()->dimension(1) * transpose_w);
+                    shape_tmp_b.set(1, std::ceil(b->info()->dimension(0) / static_cast<float>(transpose_w)));
                     break;
                 }
 #endif
@@ -109,38 +134,70 @@ void NEGEMM::configure(const ITensor *a, const ITensor *b, const ITensor *c, ITe
         // Configure interleave kernel
         _interleave_kernel.configure(a, &_tmp_a);
 
-        // Configure transpose kernel
+        // Configure transpose kernel: a constant matrix B only needs to be transposed once, and _tmp_b then keeps it for the following runs
         _transpose_kernel.configure(b, &_tmp_b);
+        _is_b_constant = constant_b;
 
-        // Configure matrix multiplication kernel
-        _mm_kernel.configure(&_tmp_a, &_tmp_b, d, alpha);
+        // Configure matrix multiplication kernel: beta * C is added while the output block is still in registers, so the output is only written once
+        _mm_kernel.configure(&_tmp_a, &_tmp_b, d, alpha, _run_addition ? c : nullptr, ActivationLayerInfo(), beta);
+        _run_addition = false;
 
         // Allocate once the all configure methods have been called
         _tmp_a.allocator()->allocate();
         _tmp_b.allocator()->allocate();
     }
 
-    // Configure matrix addition kernel
-    if(beta != 0 && c != nullptr)
+    // Configure matrix addition kernel if C could not be added by the matrix multiply kernel
+    if(_run_addition)
     {
+        ARM_COMPUTE_ERROR_ON_MSG(c->info()->dimension(1) != d->info()->dimension(1), "Broadcasting a row vector C is only supported by the interleaved and the small matrix multiplications");
         _ma_kernel.configure(c, d, beta);
-        _run_addition = true;
     }
 }
 
-void NEGEMM::run()
+void NEGEMM::prepare()
 {
-    if(!_run_vector_matrix_multiplication)
+    if(_is_first_run && _is_b_constant)
     {
-        // Run interleave kernel
-        NEScheduler::get().multithread(&_interleave_kernel);
-
-        // Run transpose kernel
         NEScheduler::get().multithread(&_transpose_kernel);
+        _original_b->mark_as_unused();
+    }
+    _is_first_run = false;
+}
+
+void NEGEMM::run()
+{
+    // Transpose a constant matrix B (Runs once for every configure, unless prepare() has been called)
+    prepare();
+
+    if(_run_blocked_multiplication)
+    {
+        // Distribute the blocks of columns first: each thread packs its own blocks of matrix B
+        NEScheduler::get().multithread(&_blocked_mm_kernel, 0);
+    }
+    else if(_run_small_multiplication)
+    {
+        // One of the dimensions of the output is small: split the window along the other one
+        const Window &win = _small_mm_kernel.window();
+        NEScheduler::get().multithread(&_small_mm_kernel, (win.num_iterations(Window::DimX) > win.num_iterations(Window::DimY)) ? Window::DimX : Window::DimY);
     }
+    else
+    {
+        if(!_run_vector_matrix_multiplication)
+        {
+            // Run interleave kernel
+            NEScheduler::get().multithread(&_interleave_kernel);
+
+            // Run transpose kernel (A constant matrix B is only transposed by prepare())
+            if(!_is_b_constant)
+            {
+                NEScheduler::get().multithread(&_transpose_kernel);
+            }
+        }
 
-    // Run matrix multiply kernel
-    NEScheduler::get().multithread(&_mm_kernel, _run_vector_matrix_multiplication ? 0 : 1);
+        // Run matrix multiply kernel
+        NEScheduler::get().multithread(&_mm_kernel, _run_vector_matrix_multiplication ? 0 : 1);
+    }
 
     // Run matrix addition kernel
     if(_run_addition)
@@ -148,3 +205,13 @@ void NEGEMM::run()
         NEScheduler::get().multithread(&_ma_kernel);
     }
 }
+
+MemoryFootprint NEGEMM::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    // A constant matrix B is only reshaped on the first run: it is kept like the reshaped weights of a layer
+    footprint.add(MemoryCategory::ACTIVATIONS, _tmp_a);
+    footprint.add(_is_b_constant ? MemoryCategory::WEIGHTS : MemoryCategory::ACTIVATIONS, _tmp_b);
+
+    return footprint;
+}
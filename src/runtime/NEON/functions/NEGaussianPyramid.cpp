@@ -47,7 +47,7 @@ NEGaussianPyramid::NEGaussianPyramid()
 }
 
 NEGaussianPyramidHalf::NEGaussianPyramidHalf()
-    : _border_handler(), _horizontal_reduction(), _vertical_reduction()
+    : _border_handler(), _reduction()
 {
 }
 
@@ -68,30 +68,17 @@ void NEGaussianPyramidHalf::configure(const ITensor *input, IPyramid *pyramid, B
 
     if(num_levels > 1)
     {
-        _border_handler       = arm_compute::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
-        _horizontal_reduction = arm_compute::cpp14::make_unique<NEGaussianPyramidHorKernel[]>(num_levels - 1);
-        _vertical_reduction   = arm_compute::cpp14::make_unique<NEGaussianPyramidVertKernel[]>(num_levels - 1);
-
-        // Apply half scale to the X dimension of the tensor shape
-        TensorShape tensor_shape = pyramid->info()->tensor_shape();
-        tensor_shape.set(0, (pyramid->info()->width() + 1) * SCALE_PYRAMID_HALF);
-
-        PyramidInfo pyramid_info(num_levels - 1, SCALE_PYRAMID_HALF, tensor_shape, Format::S16);
-        _tmp.init(pyramid_info);
+        _border_handler = arm_compute::cpp14::make_unique<NEFillBorderKernel[]>(num_levels - 1);
+        _reduction      = arm_compute::cpp14::make_unique<NEGaussianPyramidHalfKernel[]>(num_levels - 1);
 
         for(unsigned int i = 0; i < num_levels - 1; ++i)
         {
-            /* Configure horizontal kernel */
-            _horizontal_reduction[i].configure(_pyramid->get_pyramid_level(i), _tmp.get_pyramid_level(i), border_mode == BorderMode::UNDEFINED);
-
-            /* Configure vertical kernel */
-            _vertical_reduction[i].configure(_tmp.get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1), border_mode == BorderMode::UNDEFINED);
+            /* Configure fused horizontal and vertical kernel */
+            _reduction[i].configure(_pyramid->get_pyramid_level(i), _pyramid->get_pyramid_level(i + 1), border_mode == BorderMode::UNDEFINED);
 
             /* Configure border */
-            _border_handler[i].configure(_pyramid->get_pyramid_level(i), _horizontal_reduction[i].border_size(), border_mode, PixelValue(constant_border_value));
+            _border_handler[i].configure(_pyramid->get_pyramid_level(i), _reduction[i].border_size(), border_mode, PixelValue(constant_border_value));
         }
-
-        _tmp.allocate();
     }
 }
 
@@ -108,8 +95,7 @@ void NEGaussianPyramidHalf::run()
     for(unsigned int i = 0; i < num_levels - 1; ++i)
     {
         _border_handler[i].run(_border_handler[i].window());
-        NEScheduler::get().multithread(_horizontal_reduction.get() + i);
-        NEScheduler::get().multithread(_vertical_reduction.get() + i);
+        NEScheduler::get().multithread(_reduction.get() + i);
     }
 }
 
@@ -25,6 +25,7 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/HOGInfo.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/Size2D.h"
 #include "arm_compute/core/Validate.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
@@ -32,7 +33,7 @@
 using namespace arm_compute;
 
 NEHOGDescriptor::NEHOGDescriptor()
-    : _gradient(), _orient_bin(), _block_norm(), _mag(), _phase(), _hog_space()
+    : _border_handler(), _orient_bin(), _block_norm(), _hog_space()
 {
 }
 
@@ -53,45 +54,32 @@ void NEHOGDescriptor::configure(ITensor *input, ITensor *output, const IHOG *hog
     const size_t num_cells_x = width / cell_size.width;
     const size_t num_cells_y = height / cell_size.height;
 
-    // TensorShape of the input image
-    const TensorShape &shape_img = input->info()->tensor_shape();
-
     // TensorShape of the hog space
     TensorShape shape_hog_space = input->info()->tensor_shape();
     shape_hog_space.set(Window::DimX, num_cells_x);
     shape_hog_space.set(Window::DimY, num_cells_y);
 
-    // Allocate memory for magnitude, phase and hog space
-    TensorInfo info_mag(shape_img, Format::S16);
-    _mag.allocator()->init(info_mag);
-
-    TensorInfo info_phase(shape_img, Format::U8);
-    _phase.allocator()->init(info_phase);
-
+    // Allocate memory for hog space
     TensorInfo info_space(shape_hog_space, num_bins, DataType::F32);
     _hog_space.allocator()->init(info_space);
 
-    // Initialise gradient kernel
-    _gradient.configure(input, &_mag, &_phase, hog_info->phase_type(), border_mode, constant_border_value);
-
-    // Initialise orientation binning kernel
-    _orient_bin.configure(&_mag, &_phase, &_hog_space, hog->info());
+    // Initialise gradient and orientation binning kernel
+    _orient_bin.configure(input, &_hog_space, hog->info());
+    _border_handler.configure(input, _orient_bin.border_size(), border_mode, PixelValue(constant_border_value));
 
     // Initialize HOG norm kernel
     _block_norm.configure(&_hog_space, output, hog->info());
 
     // Allocate intermediate tensors
-    _mag.allocator()->allocate();
-    _phase.allocator()->allocate();
     _hog_space.allocator()->allocate();
 }
 
 void NEHOGDescriptor::run()
 {
-    // Run gradient
-    _gradient.run();
+    // Fill border
+    _border_handler.run(_border_handler.window());
 
-    // Run orientation binning kernel
+    // Run gradient and orientation binning kernel
     NEScheduler::get().multithread(&_orient_bin);
 
     // Run block normalization kernel
@@ -36,3 +36,13 @@ void NEHOGDetector::configure(const ITensor *input, const IHOG *hog, IDetectionW
 
     _kernel = std::move(k);
 }
+
+void NEHOGDetector::configure(const ITensor *input, const IMultiHOG *multi_hog, size_t first_model, size_t num_models, IDetectionWindowArray *detection_windows, const Size2D &detection_window_stride,
+                              float threshold)
+{
+    auto k = arm_compute::cpp14::make_unique<NEHOGDetectorKernel>();
+
+    k->configure(input, multi_hog, first_model, num_models, detection_windows, detection_window_stride, threshold);
+
+    _kernel = std::move(k);
+}
@@ -31,12 +31,14 @@
 using namespace arm_compute;
 
 NEHOGGradient::NEHOGGradient()
-    : _derivative(), _mag_phase(nullptr), _gx(), _gy()
+    : _derivative(), _mag_phase(nullptr), _gx(), _gy(), _computes_derivatives(false)
 {
 }
 
-void NEHOGGradient::configure(ITensor *input, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type, BorderMode border_mode, uint8_t constant_border_value)
+void NEHOGGradient::configure(ITensor *input, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type, BorderMode border_mode, uint8_t constant_border_value,
+                              MagnitudePhaseApproximation approximation)
 {
+    ARM_COMPUTE_ERROR_ON(MagnitudePhaseApproximation::BINS == approximation);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_magnitude, 1, DataType::S16);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_phase, 1, DataType::U8);
@@ -52,28 +54,45 @@ void NEHOGGradient::configure(ITensor *input, ITensor *output_magnitude, ITensor
     _derivative.configure(input, &_gx, &_gy, border_mode, constant_border_value);
 
     // Initialise magnitude/phase kernel
+    configure(&_gx, &_gy, output_magnitude, output_phase, phase_type, approximation);
+    _computes_derivatives = true;
+
+    // Allocate intermediate tensors
+    _gx.allocator()->allocate();
+    _gy.allocator()->allocate();
+}
+
+void NEHOGGradient::configure(const ITensor *gx, const ITensor *gy, ITensor *output_magnitude, ITensor *output_phase, PhaseType phase_type, MagnitudePhaseApproximation approximation)
+{
+    ARM_COMPUTE_ERROR_ON(MagnitudePhaseApproximation::BINS == approximation);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gy, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_magnitude, 1, DataType::S16);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output_phase, 1, DataType::U8);
+
+    _computes_derivatives = false;
+
     if(PhaseType::UNSIGNED == phase_type)
     {
         auto k = arm_compute::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::UNSIGNED>>();
-        k->configure(&_gx, &_gy, output_magnitude, output_phase);
+        k->configure(gx, gy, output_magnitude, output_phase, approximation);
         _mag_phase = std::move(k);
     }
     else
     {
         auto k = arm_compute::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
-        k->configure(&_gx, &_gy, output_magnitude, output_phase);
+        k->configure(gx, gy, output_magnitude, output_phase, approximation);
         _mag_phase = std::move(k);
     }
-
-    // Allocate intermediate tensors
-    _gx.allocator()->allocate();
-    _gy.allocator()->allocate();
 }
 
 void NEHOGGradient::run()
 {
-    // Run derivative
-    _derivative.run();
+    // Run derivative, unless the gradients are shared with other functions
+    if(_computes_derivatives)
+    {
+        _derivative.run();
+    }
 
     // Run magnitude/phase kernel
     NEScheduler::get().multithread(_mag_phase.get());
@@ -25,40 +25,45 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/Tensor.h"
 
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
 using namespace arm_compute;
 
 NEHOGMultiDetection::NEHOGMultiDetection()
-    : _gradient_kernel(), _orient_bin_kernel(), _block_norm_kernel(), _hog_detect_kernel(), _non_maxima_kernel(), _hog_space(), _hog_norm_space(), _detection_windows(), _mag(), _phase(),
+    : _border_handler(), _orient_bin_kernel(), _hog_space_scale_kernel(), _block_norm_kernel(), _hog_detect_kernel(), _non_maxima_kernel(), _hog_space(), _hog_norm_space(), _scales(), _detection_windows(),
       _non_maxima_suppression(false), _num_orient_bin_kernel(0), _num_block_norm_kernel(0), _num_hog_detect_kernel(0)
 {
 }
 
 void NEHOGMultiDetection::configure(ITensor *input, const IMultiHOG *multi_hog, IDetectionWindowArray *detection_windows, const ISize2DArray *detection_window_strides, BorderMode border_mode,
-                                    uint8_t constant_border_value, float threshold, bool non_maxima_suppression, float min_distance)
+                                    uint8_t constant_border_value, float threshold, bool non_maxima_suppression, float min_distance, size_t num_scales, float scale_factor)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_INVALID_MULTI_HOG(multi_hog);
     ARM_COMPUTE_ERROR_ON(nullptr == detection_windows);
     ARM_COMPUTE_ERROR_ON(detection_window_strides->num_values() != multi_hog->num_models());
+    ARM_COMPUTE_ERROR_ON(num_scales == 0);
+    ARM_COMPUTE_ERROR_ON(num_scales > 1 && scale_factor <= 1.f);
 
     const size_t       width      = input->info()->dimension(Window::DimX);
     const size_t       height     = input->info()->dimension(Window::DimY);
-    const TensorShape &shape_img  = input->info()->tensor_shape();
     const size_t       num_models = multi_hog->num_models();
-    PhaseType          phase_type = multi_hog->model(0)->info()->phase_type();
 
     size_t prev_num_bins     = multi_hog->model(0)->info()->num_bins();
     Size2D prev_cell_size    = multi_hog->model(0)->info()->cell_size();
     Size2D prev_block_size   = multi_hog->model(0)->info()->block_size();
     Size2D prev_block_stride = multi_hog->model(0)->info()->block_stride();
 
-    /* Check if NEHOGOrientationBinningKernel and NEHOGBlockNormalizationKernel kernels can be skipped for a specific HOG data-object
+    /* Check if NEHOGGradientOrientationBinningKernel and NEHOGBlockNormalizationKernel kernels can be skipped for a specific HOG data-object
      *
-     * 1) NEHOGOrientationBinningKernel and NEHOGBlockNormalizationKernel are skipped if the cell size and the number of bins don't change.
+     * 1) NEHOGGradientOrientationBinningKernel and NEHOGBlockNormalizationKernel are skipped if the cell size and the number of bins don't change.
      *        Since "multi_hog" is sorted,it is enough to check the HOG descriptors at level "ith" and level "(i-1)th
      * 2) NEHOGBlockNormalizationKernel is skipped if the cell size, the number of bins and block size do not change.
      *         Since "multi_hog" is sorted,it is enough to check the HOG descriptors at level "ith" and level "(i-1)th
@@ -106,30 +111,81 @@ void NEHOGMultiDetection::configure(ITensor *input, const IMultiHOG *multi_hog,
         input_hog_detect.push_back(input_block_norm.size() - 1);
     }
 
-    _detection_windows      = detection_windows;
-    _non_maxima_suppression = non_maxima_suppression;
-    _num_orient_bin_kernel  = input_orient_bin.size(); // Number of NEHOGOrientationBinningKernel kernels to compute
-    _num_block_norm_kernel  = input_block_norm.size(); // Number of NEHOGBlockNormalizationKernel kernels to compute
-    _num_hog_detect_kernel  = input_hog_detect.size(); // Number of NEHOGDetector functions to compute
+    /* Group the consecutive models which read the same normalized HOG space with the same detection window size and stride
+     *
+     * Each group is evaluated by a single NEHOGDetector which reads every block once for all its models.
+     */
+    std::vector<std::pair<size_t, size_t>> hog_detect_groups; // First model and number of models of each group
+
+    for(size_t i = 0; i < num_models; ++i)
+    {
+        if(!hog_detect_groups.empty())
+        {
+            auto        &group  = hog_detect_groups.back();
+            const size_t first  = group.first;
+            const Size2D cur_dw = multi_hog->model(i)->info()->detection_window_size();
+            const Size2D fst_dw = multi_hog->model(first)->info()->detection_window_size();
+
+            const bool same_input  = input_hog_detect[i] == input_hog_detect[first];
+            const bool same_window = (cur_dw.width == fst_dw.width) && (cur_dw.height == fst_dw.height);
+            const bool same_stride = (detection_window_strides->at(i).width == detection_window_strides->at(first).width)
+                                     && (detection_window_strides->at(i).height == detection_window_strides->at(first).height);
+
+            if(same_input && same_window && same_stride && group.second < NEHOGDetectorKernel::max_models)
+            {
+                ++group.second;
+                continue;
+            }
+        }
+
+        hog_detect_groups.emplace_back(i, 1);
+    }
+
+    // Keep the scales at which the downscaled image still fits the detection windows of all the models
+    Size2D max_detection_window(0, 0);
+    for(size_t i = 0; i < num_models; ++i)
+    {
+        const Size2D &dw            = multi_hog->model(i)->info()->detection_window_size();
+        max_detection_window.width  = std::max(max_detection_window.width, dw.width);
+        max_detection_window.height = std::max(max_detection_window.height, dw.height);
+    }
 
-    _orient_bin_kernel = arm_compute::cpp14::make_unique<NEHOGOrientationBinningKernel[]>(_num_orient_bin_kernel);
-    _block_norm_kernel = arm_compute::cpp14::make_unique<NEHOGBlockNormalizationKernel[]>(_num_block_norm_kernel);
-    _hog_detect_kernel = arm_compute::cpp14::make_unique<NEHOGDetector[]>(_num_hog_detect_kernel);
-    _non_maxima_kernel = arm_compute::cpp14::make_unique<NEHOGNonMaximaSuppressionKernel>();
-    _hog_space         = arm_compute::cpp14::make_unique<Tensor[]>(_num_orient_bin_kernel);
-    _hog_norm_space    = arm_compute::cpp14::make_unique<Tensor[]>(_num_block_norm_kernel);
+    _scales.clear();
+    _scales.push_back(1.f);
 
-    // Allocate tensors for magnitude and phase
-    TensorInfo info_mag(shape_img, Format::S16);
-    _mag.allocator()->init(info_mag);
+    for(size_t l = 1; l < num_scales; ++l)
+    {
+        const float scale = std::pow(scale_factor, static_cast<float>(l));
 
-    TensorInfo info_phase(shape_img, Format::U8);
-    _phase.allocator()->init(info_phase);
+        if((width / scale < max_detection_window.width) || (height / scale < max_detection_window.height))
+        {
+            break;
+        }
 
-    // Initialise gradient kernel
-    _gradient_kernel.configure(input, &_mag, &_phase, phase_type, border_mode, constant_border_value);
+        _scales.push_back(scale);
+    }
+
+    const size_t num_levels = _scales.size();
 
-    // Configure NETensor for the HOG space and orientation binning kernel
+    _detection_windows      = detection_windows;
+    _non_maxima_suppression = non_maxima_suppression;
+    _num_orient_bin_kernel  = input_orient_bin.size();  // Number of NEHOGGradientOrientationBinningKernel kernels to compute
+    _num_block_norm_kernel  = input_block_norm.size();  // Number of NEHOGBlockNormalizationKernel kernels to compute
+    _num_hog_detect_kernel  = hog_detect_groups.size(); // Number of NEHOGDetector functions to compute
+
+    _orient_bin_kernel      = arm_compute::cpp14::make_unique<NEHOGGradientOrientationBinningKernel[]>(_num_orient_bin_kernel);
+    _hog_space_scale_kernel = arm_compute::cpp14::make_unique<NEHOGSpaceScaleKernel[]>((num_levels - 1) * _num_orient_bin_kernel);
+    _block_norm_kernel      = arm_compute::cpp14::make_unique<NEHOGBlockNormalizationKernel[]>(num_levels * _num_block_norm_kernel);
+    _hog_detect_kernel      = arm_compute::cpp14::make_unique<NEHOGDetector[]>(num_levels * _num_hog_detect_kernel);
+    _non_maxima_kernel      = arm_compute::cpp14::make_unique<NEHOGNonMaximaSuppressionKernel>();
+    _hog_space              = arm_compute::cpp14::make_unique<Tensor[]>(num_levels * _num_orient_bin_kernel);
+    _hog_norm_space         = arm_compute::cpp14::make_unique<Tensor[]>(num_levels * _num_block_norm_kernel);
+
+    /* Configure NETensor for the HOG space and the gradient and orientation binning kernel
+     *
+     * Each kernel computes the gradient of the cells it bins straight from the input image, which costs less than writing
+     * a full size magnitude and phase tensor and reading it back once per kernel.
+     */
     for(size_t i = 0; i < _num_orient_bin_kernel; ++i)
     {
         const size_t idx_multi_hog = input_orient_bin[i];
@@ -151,45 +207,77 @@ void NEHOGMultiDetection::configure(ITensor *input, const IMultiHOG *multi_hog,
         TensorInfo info_space(shape_hog_space, num_bins, DataType::F32);
         _hog_space[i].allocator()->init(info_space);
 
-        // Initialise orientation binning kernel
-        _orient_bin_kernel[i].configure(&_mag, &_phase, _hog_space.get() + i, multi_hog->model(idx_multi_hog)->info());
+        // Initialise gradient and orientation binning kernel
+        _orient_bin_kernel[i].configure(input, _hog_space.get() + i, multi_hog->model(idx_multi_hog)->info());
     }
 
-    // Configure NETensor for the normalized HOG space and block normalization kernel
-    for(size_t i = 0; i < _num_block_norm_kernel; ++i)
+    // All the gradient and orientation binning kernels have the same border size
+    _border_handler.configure(input, _orient_bin_kernel[0].border_size(), border_mode, PixelValue(constant_border_value));
+
+    // Configure the HOG spaces of the coarser scales, approximated from the ones of the full resolution image
+    for(size_t l = 1; l < num_levels; ++l)
     {
-        const size_t idx_multi_hog  = input_block_norm[i].first;
-        const size_t idx_orient_bin = input_block_norm[i].second;
+        const size_t width_level  = static_cast<size_t>(width / _scales[l]);
+        const size_t height_level = static_cast<size_t>(height / _scales[l]);
+
+        for(size_t i = 0; i < _num_orient_bin_kernel; ++i)
+        {
+            const Size2D &cell = multi_hog->model(input_orient_bin[i])->info()->cell_size();
 
-        // Allocate normalized HOG space
-        TensorInfo tensor_info(*(multi_hog->model(idx_multi_hog)->info()), width, height);
-        _hog_norm_space[i].allocator()->init(tensor_info);
+            TensorShape shape_hog_space = _hog_space[i].info()->tensor_shape();
+            shape_hog_space.set(Window::DimX, width_level / cell.width);
+            shape_hog_space.set(Window::DimY, height_level / cell.height);
 
-        // Initialize block normalization kernel
-        _block_norm_kernel[i].configure(_hog_space.get() + idx_orient_bin, _hog_norm_space.get() + i, multi_hog->model(idx_multi_hog)->info());
+            Tensor *hog_space = _hog_space.get() + l * _num_orient_bin_kernel + i;
+
+            TensorInfo info_space(shape_hog_space, _hog_space[i].info()->num_channels(), DataType::F32);
+            hog_space->allocator()->init(info_space);
+
+            _hog_space_scale_kernel[(l - 1) * _num_orient_bin_kernel + i].configure(_hog_space.get() + i, hog_space, _scales[l]);
+        }
     }
 
-    // Configure HOG detector kernel
-    for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
+    for(size_t l = 0; l < num_levels; ++l)
     {
-        const size_t idx_block_norm = input_hog_detect[i];
+        const size_t width_level  = static_cast<size_t>(width / _scales[l]);
+        const size_t height_level = static_cast<size_t>(height / _scales[l]);
 
-        _hog_detect_kernel[i].configure(_hog_norm_space.get() + idx_block_norm, multi_hog->model(i), detection_windows, detection_window_strides->at(i), threshold, i);
+        // Configure NETensor for the normalized HOG space and block normalization kernel
+        for(size_t i = 0; i < _num_block_norm_kernel; ++i)
+        {
+            const size_t idx_multi_hog  = input_block_norm[i].first;
+            const size_t idx_orient_bin = l * _num_orient_bin_kernel + input_block_norm[i].second;
+            const size_t idx_block_norm = l * _num_block_norm_kernel + i;
+
+            // Allocate normalized HOG space
+            TensorInfo tensor_info(*(multi_hog->model(idx_multi_hog)->info()), width_level, height_level);
+            _hog_norm_space[idx_block_norm].allocator()->init(tensor_info);
+
+            // Initialize block normalization kernel
+            _block_norm_kernel[idx_block_norm].configure(_hog_space.get() + idx_orient_bin, _hog_norm_space.get() + idx_block_norm, multi_hog->model(idx_multi_hog)->info());
+        }
+
+        // Configure HOG detector kernel
+        for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
+        {
+            const size_t first_model    = hog_detect_groups[i].first;
+            const size_t idx_block_norm = l * _num_block_norm_kernel + input_hog_detect[first_model];
+
+            _hog_detect_kernel[l * _num_hog_detect_kernel + i].configure(_hog_norm_space.get() + idx_block_norm, multi_hog, first_model, hog_detect_groups[i].second, detection_windows,
+                                                                         detection_window_strides->at(first_model), threshold);
+        }
     }
 
     // Configure non maxima suppression kernel
     _non_maxima_kernel->configure(_detection_windows, min_distance);
 
     // Allocate intermediate tensors
-    _mag.allocator()->allocate();
-    _phase.allocator()->allocate();
-
-    for(size_t i = 0; i < _num_orient_bin_kernel; ++i)
+    for(size_t i = 0; i < num_levels * _num_orient_bin_kernel; ++i)
     {
         _hog_space[i].allocator()->allocate();
     }
 
-    for(size_t i = 0; i < _num_block_norm_kernel; ++i)
+    for(size_t i = 0; i < num_levels * _num_block_norm_kernel; ++i)
     {
         _hog_norm_space[i].allocator()->allocate();
     }
@@ -202,30 +290,67 @@ void NEHOGMultiDetection::run()
     // Reset detection window
     _detection_windows->clear();
 
-    // Run gradient
-    _gradient_kernel.run();
+    // Fill border
+    _border_handler.run(_border_handler.window());
 
-    // Run orientation binning kernel
+    // Run gradient and orientation binning kernel: the HOG spaces of the different cell sizes are independent, the threads only join once for all of them
+    std::vector<IScheduler::IndependentKernel> orient_bin_kernels;
     for(size_t i = 0; i < _num_orient_bin_kernel; ++i)
     {
-        NEScheduler::get().multithread(_orient_bin_kernel.get() + i);
+        orient_bin_kernels.push_back({ _orient_bin_kernel.get() + i, Window::DimY });
     }
+    NEScheduler::get().multithread_independent(orient_bin_kernels);
 
-    // Run block normalization kernel
-    for(size_t i = 0; i < _num_block_norm_kernel; ++i)
+    const size_t num_levels = _scales.size();
+
+    // Approximate the HOG spaces of the coarser scales: they all read the full resolution HOG spaces
+    if(num_levels > 1)
+    {
+        std::vector<IScheduler::IndependentKernel> hog_space_scale_kernels;
+        for(size_t i = 0; i < (num_levels - 1) * _num_orient_bin_kernel; ++i)
+        {
+            hog_space_scale_kernels.push_back({ _hog_space_scale_kernel.get() + i, Window::DimY });
+        }
+        NEScheduler::get().multithread_independent(hog_space_scale_kernels);
+    }
+
+    // Run block normalization kernel: each one writes its own normalized HOG space
+    std::vector<IScheduler::IndependentKernel> block_norm_kernels;
+    for(size_t i = 0; i < num_levels * _num_block_norm_kernel; ++i)
     {
-        NEScheduler::get().multithread(_block_norm_kernel.get() + i);
+        block_norm_kernels.push_back({ _block_norm_kernel.get() + i, Window::DimY });
     }
+    NEScheduler::get().multithread_independent(block_norm_kernels);
 
-    // Run HOG detector kernel
-    for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
+    for(size_t l = 0; l < num_levels; ++l)
     {
-        _hog_detect_kernel[i].run();
+        const size_t first_detection = _detection_windows->num_values();
+
+        // Run HOG detector kernel
+        for(size_t i = 0; i < _num_hog_detect_kernel; ++i)
+        {
+            _hog_detect_kernel[l * _num_hog_detect_kernel + i].run();
+        }
+
+        // Scale the detection windows of the coarser scales back to the coordinates of the input image
+        if(l != 0)
+        {
+            const float scale = _scales[l];
+
+            for(size_t i = first_detection; i < _detection_windows->num_values(); ++i)
+            {
+                DetectionWindow &win = _detection_windows->at(i);
+                win.x                = static_cast<uint16_t>(win.x * scale);
+                win.y                = static_cast<uint16_t>(win.y * scale);
+                win.width            = static_cast<uint16_t>(win.width * scale);
+                win.height           = static_cast<uint16_t>(win.height * scale);
+            }
+        }
     }
 
     // Run non-maxima suppression kernel if enabled
     if(_non_maxima_suppression)
     {
-        _non_maxima_kernel->run(_non_maxima_kernel->window());
+        NEScheduler::get().multithread(_non_maxima_kernel.get());
     }
 }
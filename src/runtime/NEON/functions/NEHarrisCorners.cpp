@@ -42,7 +42,7 @@
 using namespace arm_compute;
 
 NEHarrisCorners::NEHarrisCorners()
-    : _sobel(), _harris_score(), _non_max_suppr(), _candidates(), _sort_euclidean(), _border_gx(), _border_gy(), _gx(), _gy(), _score(), _nonmax(), _corners_list(), _num_corner_candidates(0)
+    : _sobel(), _candidates(), _grid_suppression(), _border_gx(), _border_gy(), _gx(), _gy(), _corners_list(), _is_configured(false)
 {
 }
 
@@ -69,12 +69,6 @@ void NEHarrisCorners::configure(IImage *input, float threshold, float min_dist,
     _gx.allocator()->init(tensor_info_gxgy);
     _gy.allocator()->init(tensor_info_gxgy);
 
-    TensorInfo tensor_info_score(shape, Format::F32);
-    _score.allocator()->init(tensor_info_score);
-    _nonmax.allocator()->init(tensor_info_score);
-
-    _corners_list = arm_compute::cpp14::make_unique<InternalKeypoint[]>(shape.x() * shape.y());
-
     // Set/init Sobel kernel accordingly with gradient_size
     switch(gradient_size)
     {
@@ -103,110 +97,68 @@ void NEHarrisCorners::configure(IImage *input, float threshold, float min_dist,
             ARM_COMPUTE_ERROR("Gradient size not implemented");
     }
 
+    // Init the Harris score on the gradients
+    configure_score(&_gx, &_gy, threshold, min_dist, sensitivity, gradient_size, block_size, corners, border_mode, constant_border_value, use_fp16);
+
+    // Allocate once all the configure methods have been called
+    _gx.allocator()->allocate();
+    _gy.allocator()->allocate();
+}
+
+void NEHarrisCorners::configure(IImage *gx, IImage *gy, float threshold, float min_dist,
+                                float sensitivity, int32_t gradient_size, int32_t block_size, KeyPointArray *corners,
+                                BorderMode border_mode, uint8_t constant_border_value, bool use_fp16)
+{
+    ARM_COMPUTE_ERROR_ON_TENSOR_NOT_2D(gx);
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(gx, 1, (gradient_size < 7) ? DataType::S16 : DataType::S32);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_DATA_TYPES(gx, gy);
+    ARM_COMPUTE_ERROR_ON_MISMATCHING_SHAPES(gx, gy);
+    ARM_COMPUTE_ERROR_ON(!(gradient_size == 3 || gradient_size == 5 || gradient_size == 7));
+    ARM_COMPUTE_ERROR_ON(!(block_size == 3 || block_size == 5 || block_size == 7));
+
+    _sobel = nullptr;
+
+    configure_score(gx, gy, threshold, min_dist, sensitivity, gradient_size, block_size, corners, border_mode, constant_border_value, use_fp16);
+}
+
+void NEHarrisCorners::configure_score(IImage *gx, IImage *gy, float threshold, float min_dist,
+                                      float sensitivity, int32_t gradient_size, int32_t block_size, KeyPointArray *corners,
+                                      BorderMode border_mode, uint8_t constant_border_value, bool use_fp16)
+{
+    const TensorShape &shape = gx->info()->tensor_shape();
+
     // Normalization factor
     const float norm_factor = 1.0f / (255.0f * pow(4.0f, gradient_size / 2) * block_size);
 
-    if(use_fp16)
-    {
-        switch(block_size)
-        {
-            case 3:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreFP16Kernel<3>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            break;
-            case 5:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreFP16Kernel<5>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            break;
-            case 7:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreFP16Kernel<7>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            default:
-                break;
-        }
-    }
-    else
-    {
-        // Set/init Harris Score kernel accordingly with block_size
-        switch(block_size)
-        {
-            case 3:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreKernel<3>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            break;
-            case 5:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreKernel<5>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            break;
-            case 7:
-            {
-                auto k = arm_compute::cpp14::make_unique<NEHarrisScoreKernel<7>>();
-                k->configure(&_gx, &_gy, &_score, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED);
-                _harris_score = std::move(k);
-            }
-            default:
-                break;
-        }
-    }
+    // Init Harris score, non-maxima suppression and corner candidates kernel
+    _candidates.configure(gx, gy, &_corners_list, block_size, norm_factor, threshold, sensitivity, border_mode == BorderMode::UNDEFINED, use_fp16);
 
     // Configure border filling before harris score
-    _border_gx.configure(&_gx, _harris_score->border_size(), border_mode, constant_border_value);
-    _border_gy.configure(&_gy, _harris_score->border_size(), border_mode, constant_border_value);
-
-    // Init non-maxima suppression function
-    _non_max_suppr.configure(&_score, &_nonmax, border_mode);
-
-    // Init corner candidates kernel
-    _candidates.configure(&_nonmax, _corners_list.get(), &_num_corner_candidates);
+    _border_gx.configure(gx, _candidates.border_size(), border_mode, constant_border_value);
+    _border_gy.configure(gy, _candidates.border_size(), border_mode, constant_border_value);
 
     // Init euclidean distance
-    _sort_euclidean.configure(_corners_list.get(), corners, &_num_corner_candidates, min_dist);
+    _grid_suppression.configure(&_corners_list, corners, min_dist, shape.x(), shape.y());
 
-    // Allocate once all the configure methods have been called
-    _gx.allocator()->allocate();
-    _gy.allocator()->allocate();
-    _score.allocator()->allocate();
-    _nonmax.allocator()->allocate();
+    _is_configured = true;
 }
 
 void NEHarrisCorners::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_sobel == nullptr, "Unconfigured function");
+    ARM_COMPUTE_ERROR_ON_MSG(!_is_configured, "Unconfigured function");
 
-    // Init to 0 number of corner candidates
-    _num_corner_candidates = 0;
-
-    // Run Sobel kernel
-    _sobel->run();
-
-    // Fill border before harris score kernel
-    _border_gx.run(_border_gx.window());
-    _border_gy.run(_border_gy.window());
-
-    // Run harris score kernel
-    NEScheduler::get().multithread(_harris_score.get());
+    // Run Sobel kernel, unless the gradients are shared with other functions
+    if(_sobel != nullptr)
+    {
+        _sobel->run();
+    }
 
-    // Run non-maxima suppression
-    _non_max_suppr.run();
+    // Fill border before harris score kernel: the two borders are filled at the same time
+    NEScheduler::get().multithread_independent({ { &_border_gx, IScheduler::no_split }, { &_border_gy, IScheduler::no_split } });
 
-    // Run corner candidate kernel
+    // Run harris score, non-maxima suppression and corner candidate kernel
     NEScheduler::get().multithread(&_candidates);
 
-    // Run sort & euclidean distance
-    _sort_euclidean.run(_sort_euclidean.window());
+    // Run euclidean distance
+    NEScheduler::get().multithread(&_grid_suppression);
 }
@@ -23,18 +23,28 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEIntegralImage.h"
 
-#include "arm_compute/core/Helpers.h"
-#include "arm_compute/core/NEON/kernels/NEIntegralImageKernel.h"
 #include "arm_compute/core/Types.h"
-
-#include <utility>
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 using namespace arm_compute;
 
+NEIntegralImage::NEIntegralImage()
+    : _kernel_hor(), _kernel_vert(), _border_handler()
+{
+}
+
 void NEIntegralImage::configure(const ITensor *input, ITensor *output)
 {
-    auto k = arm_compute::cpp14::make_unique<NEIntegralImageKernel>();
-    k->configure(input, output);
-    _kernel = std::move(k);
-    _border_handler.configure(output, _kernel->border_size(), BorderMode::CONSTANT, 0);
+    _kernel_hor.configure(input, output);
+    _kernel_vert.configure(output);
+
+    const BorderSize border_size(_kernel_vert.border_size().top, 0, 0, _kernel_hor.border_size().left);
+    _border_handler.configure(output, border_size, BorderMode::CONSTANT, 0);
+}
+
+void NEIntegralImage::run()
+{
+    _border_handler.run(_border_handler.window());
+    NEScheduler::get().multithread(&_kernel_hor);
+    NEScheduler::get().multithread(&_kernel_vert, Window::DimX);
 }
@@ -26,18 +26,17 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/IPyramid.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
-#include "arm_compute/runtime/NEON/functions/NEArithmeticSubtraction.h"
-#include "arm_compute/runtime/NEON/functions/NEDepthConvert.h"
-#include "arm_compute/runtime/NEON/functions/NEGaussian5x5.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 #include "arm_compute/runtime/NEON/functions/NEGaussianPyramid.h"
 #include "arm_compute/runtime/Tensor.h"
 
 using namespace arm_compute;
 
 NELaplacianPyramid::NELaplacianPyramid()
-    : _num_levels(0), _gaussian_pyr_function(), _convf(), _subf(), _gauss_pyr(), _conv_pyr(), _depth_function()
+    : _num_levels(0), _gaussian_pyr_function(), _border_handler(), _laplacian_kernel(), _gauss_pyr()
 {
 }
 
@@ -50,17 +49,10 @@ void NELaplacianPyramid::run()
 
     for(unsigned int i = 0; i < _num_levels; ++i)
     {
-        // Apply Gaussian filter to gaussian pyramid image
-        _convf[i].run();
+        // Blur gaussian pyramid image and compute laplacian image
+        _border_handler[i].run(_border_handler[i].window());
+        NEScheduler::get().multithread(_laplacian_kernel.get() + i);
     }
-
-    for(unsigned int i = 0; i < _num_levels; ++i)
-    {
-        // Compute laplacian image
-        _subf[i].run();
-    }
-
-    _depth_function.run();
 }
 
 void NELaplacianPyramid::configure(const ITensor *input, IPyramid *pyramid, ITensor *output, BorderMode border_mode, uint8_t constant_border_value)
@@ -76,27 +68,26 @@ void NELaplacianPyramid::configure(const ITensor *input, IPyramid *pyramid, ITen
 
     _num_levels = pyramid->info()->num_levels();
 
-    // Create and initialize the gaussian pyramid and the convoluted pyramid
+    // Create and initialize the gaussian pyramid
     PyramidInfo pyramid_info;
     pyramid_info.init(_num_levels, 0.5f, pyramid->info()->tensor_shape(), arm_compute::Format::U8);
 
     _gauss_pyr.init(pyramid_info);
-    _conv_pyr.init(pyramid_info);
 
     // Create Gaussian Pyramid function
     _gaussian_pyr_function.configure(input, &_gauss_pyr, border_mode, constant_border_value);
 
-    _convf = arm_compute::cpp14::make_unique<NEGaussian5x5[]>(_num_levels);
-    _subf  = arm_compute::cpp14::make_unique<NEArithmeticSubtraction[]>(_num_levels);
+    _border_handler   = arm_compute::cpp14::make_unique<NEFillBorderKernel[]>(_num_levels);
+    _laplacian_kernel = arm_compute::cpp14::make_unique<NELaplacianPyramidKernel[]>(_num_levels);
 
     for(unsigned int i = 0; i < _num_levels; ++i)
     {
-        _convf[i].configure(_gauss_pyr.get_pyramid_level(i), _conv_pyr.get_pyramid_level(i), border_mode, constant_border_value);
-        _subf[i].configure(_gauss_pyr.get_pyramid_level(i), _conv_pyr.get_pyramid_level(i), pyramid->get_pyramid_level(i), ConvertPolicy::WRAP);
-    }
+        // The blurred image is only needed for the last level, which is the output of the function
+        ITensor *blurred = (i == _num_levels - 1) ? output : nullptr;
 
-    _depth_function.configure(_conv_pyr.get_pyramid_level(_num_levels - 1), output, ConvertPolicy::WRAP, 0);
+        _laplacian_kernel[i].configure(_gauss_pyr.get_pyramid_level(i), pyramid->get_pyramid_level(i), blurred, border_mode == BorderMode::UNDEFINED);
+        _border_handler[i].configure(_gauss_pyr.get_pyramid_level(i), _laplacian_kernel[i].border_size(), border_mode, PixelValue(constant_border_value));
+    }
 
     _gauss_pyr.allocate();
-    _conv_pyr.allocate();
 }
@@ -29,13 +29,14 @@
 #include "arm_compute/core/ITensor.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/NEScheduler.h"
 
 #include <cstddef>
 
 using namespace arm_compute;
 
 NELaplacianReconstruct::NELaplacianReconstruct()
-    : _tmp_pyr(), _addf(), _scalef(), _depthf()
+    : _tmp_pyr(), _reconstruct_kernel()
 {
 }
 
@@ -51,50 +52,40 @@ void NELaplacianReconstruct::configure(const IPyramid *pyramid, const ITensor *i
     ARM_COMPUTE_ERROR_ON(output->info()->dimension(1) != pyramid->get_pyramid_level(0)->info()->dimension(1));
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(0) != pyramid->get_pyramid_level(pyramid->info()->num_levels() - 1)->info()->dimension(0));
     ARM_COMPUTE_ERROR_ON(input->info()->dimension(1) != pyramid->get_pyramid_level(pyramid->info()->num_levels() - 1)->info()->dimension(1));
+    ARM_COMPUTE_UNUSED(border_mode);
+    ARM_COMPUTE_UNUSED(constant_border_value);
 
     const size_t num_levels = pyramid->info()->num_levels();
 
-    // Create and initialize the tmp pyramid: I(n-2) = upsample( input + Laplace(n-1) )
+    // Create and initialize the tmp pyramid: I(i) = upsample(I(i+1)) + L(i). Level 0 is written straight to the output.
     PyramidInfo pyramid_info;
     pyramid_info.init(num_levels, 0.5f, output->info()->tensor_shape(), arm_compute::Format::S16);
 
     _tmp_pyr.init(pyramid_info);
 
-    // Allocate add and scale functions. Level 0 does not need to be scaled.
-    _addf   = arm_compute::cpp14::make_unique<NEArithmeticAddition[]>(num_levels);
-    _scalef = arm_compute::cpp14::make_unique<NEScale[]>(num_levels - 1);
-
     const size_t last_level = num_levels - 1;
 
-    _addf[last_level].configure(input, pyramid->get_pyramid_level(last_level), _tmp_pyr.get_pyramid_level(last_level), ConvertPolicy::SATURATE);
+    _reconstruct_kernel = arm_compute::cpp14::make_unique<NELaplacianReconstructKernel[]>(num_levels);
 
-    // Scale levels n-1 to 1, and add levels n-2 to 0
-    for(size_t l = 0; l < last_level; ++l)
+    // The input has the size of the last level so it is added without upsampling, then levels n-1 to 1 are upsampled and added to levels n-2 to 0 in a single pass
+    for(size_t l = 0; l < num_levels; ++l)
     {
-        _scalef[l].configure(_tmp_pyr.get_pyramid_level(l + 1), _tmp_pyr.get_pyramid_level(l), arm_compute::InterpolationPolicy::NEAREST_NEIGHBOR, border_mode, constant_border_value);
-        _addf[l].configure(_tmp_pyr.get_pyramid_level(l), pyramid->get_pyramid_level(l), _tmp_pyr.get_pyramid_level(l), ConvertPolicy::SATURATE);
-    }
+        const ITensor *low_res      = (l == last_level) ? input : _tmp_pyr.get_pyramid_level(l + 1);
+        ITensor       *level_output = (l == 0) ? output : _tmp_pyr.get_pyramid_level(l);
 
-    // Convert level 0 from S16 to U8
-    _depthf.configure(_tmp_pyr.get_pyramid_level(0), output, ConvertPolicy::SATURATE, 0);
+        _reconstruct_kernel[l].configure(low_res, pyramid->get_pyramid_level(l), level_output);
+    }
 
     _tmp_pyr.allocate();
 }
 
 void NELaplacianReconstruct::run()
 {
-    ARM_COMPUTE_ERROR_ON_MSG(_addf == nullptr, "Unconfigured function");
+    ARM_COMPUTE_ERROR_ON_MSG(_reconstruct_kernel == nullptr, "Unconfigured function");
 
-    const size_t last_level = _tmp_pyr.info()->num_levels() - 1;
-
-    _addf[last_level].run();
-
-    // Run l = [last_level - 1, 0]
-    for(size_t l = last_level; l-- > 0;)
+    // Run l = [last_level, 0]
+    for(size_t l = _tmp_pyr.info()->num_levels(); l-- > 0;)
     {
-        _scalef[l].run();
-        _addf[l].run();
+        NEScheduler::get().multithread(_reconstruct_kernel.get() + l);
     }
-
-    _depthf.run();
 }
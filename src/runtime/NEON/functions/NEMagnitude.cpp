@@ -31,8 +31,10 @@
 
 using namespace arm_compute;
 
-void NEMagnitude::configure(const ITensor *input1, const ITensor *input2, ITensor *output, bool use_fp16)
+void NEMagnitude::configure(const ITensor *input1, const ITensor *input2, ITensor *output, bool use_fp16, MagnitudePhaseApproximation approximation)
 {
+    ARM_COMPUTE_ERROR_ON(MagnitudePhaseApproximation::BINS == approximation);
+
     if(use_fp16)
     {
         auto k = arm_compute::cpp14::make_unique<NEMagnitudePhaseFP16Kernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
@@ -42,7 +44,7 @@ void NEMagnitude::configure(const ITensor *input1, const ITensor *input2, ITenso
     else
     {
         auto k = arm_compute::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
-        k->configure(input1, input2, output, nullptr);
+        k->configure(input1, input2, output, nullptr, approximation);
         _kernel = std::move(k);
     }
 }
@@ -45,3 +45,29 @@ void NEMeanStdDev::run()
 
     NEScheduler::get().multithread(&_mean_stddev_kernel);
 }
+
+NEMeanStdDevROI::NEMeanStdDevROI()
+    : _mean_stddev_kernel(), _rois(nullptr), _mean(nullptr), _stddev(nullptr)
+{
+}
+
+void NEMeanStdDevROI::configure(const IImage *input, const IRectangleArray *rois, IFloatArray *mean, IFloatArray *stddev)
+{
+    _rois   = rois;
+    _mean   = mean;
+    _stddev = stddev;
+
+    _mean_stddev_kernel.configure(input, rois, mean, stddev);
+}
+
+void NEMeanStdDevROI::run()
+{
+    _mean->resize(_rois->num_values());
+
+    if(_stddev != nullptr)
+    {
+        _stddev->resize(_rois->num_values());
+    }
+
+    NEScheduler::get().multithread(&_mean_stddev_kernel);
+}
@@ -28,14 +28,24 @@
 using namespace arm_compute;
 
 NEMinMaxLocation::NEMinMaxLocation()
-    : _min_max(), _min_max_loc()
+    : _min_max(), _min_max_loc(), _run_loc(false)
 {
 }
 
 void NEMinMaxLocation::configure(const IImage *input, int32_t *min, int32_t *max, ICoordinates2DArray *min_loc, ICoordinates2DArray *max_loc, uint32_t *min_count, uint32_t *max_count)
 {
-    _min_max.configure(input, min, max);
-    _min_max_loc.configure(input, min, max, min_loc, max_loc, min_count, max_count);
+    _run_loc = (nullptr != min_loc) || (nullptr != max_loc);
+
+    if(_run_loc)
+    {
+        _min_max.configure(input, min, max);
+        _min_max_loc.configure(input, min, max, min_loc, max_loc, min_count, max_count);
+    }
+    else
+    {
+        // Count the extrema while searching for them: a single pass over the input
+        _min_max.configure(input, min, max, min_count, max_count);
+    }
 }
 
 void NEMinMaxLocation::run()
@@ -46,5 +56,8 @@ void NEMinMaxLocation::run()
     NEScheduler::get().multithread(&_min_max);
 
     /* Run min max location */
-    NEScheduler::get().multithread(&_min_max_loc);
+    if(_run_loc)
+    {
+        NEScheduler::get().multithread(&_min_max_loc);
+    }
 }
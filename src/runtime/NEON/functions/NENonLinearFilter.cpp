@@ -23,7 +23,9 @@
  */
 #include "arm_compute/runtime/NEON/functions/NENonLinearFilter.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NENonLinearFilterHistogramKernel.h"
 #include "arm_compute/core/NEON/kernels/NENonLinearFilterKernel.h"
 #include "arm_compute/core/PixelValue.h"
 
@@ -35,8 +37,20 @@ void NENonLinearFilter::configure(ITensor *input, ITensor *output, NonLinearFilt
                                   BorderMode border_mode,
                                   uint8_t    constant_border_value)
 {
-    auto k = arm_compute::cpp14::make_unique<NENonLinearFilterKernel>();
-    k->configure(input, output, function, mask_size, pattern, mask, border_mode == BorderMode::UNDEFINED);
-    _kernel = std::move(k);
+    if(mask_size > 5)
+    {
+        ARM_COMPUTE_ERROR_ON_MSG(MatrixPattern::BOX != pattern, "Masks larger than 5x5 only support the box pattern");
+
+        // The cost of the histogram based kernel does not depend on the mask size
+        auto k = arm_compute::cpp14::make_unique<NENonLinearFilterHistogramKernel>();
+        k->configure(input, output, function, mask_size, border_mode == BorderMode::UNDEFINED);
+        _kernel = std::move(k);
+    }
+    else
+    {
+        auto k = arm_compute::cpp14::make_unique<NENonLinearFilterKernel>();
+        k->configure(input, output, function, mask_size, pattern, mask, border_mode == BorderMode::UNDEFINED);
+        _kernel = std::move(k);
+    }
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
 }
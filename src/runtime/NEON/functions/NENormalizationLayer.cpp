@@ -32,8 +32,8 @@
 
 using namespace arm_compute;
 
-NENormalizationLayer::NENormalizationLayer()
-    : _norm_kernel(), _multiply_kernel(), _border_handler(), _input_squared()
+NENormalizationLayer::NENormalizationLayer(std::shared_ptr<MemoryPlanner> memory_planner)
+    : _memory_group(std::move(memory_planner)), _norm_kernel(), _multiply_kernel(), _border_handler(), _input_squared(), _is_cross_map(false)
 {
 }
 
@@ -41,8 +41,18 @@ void NENormalizationLayer::configure(const ITensor *input, ITensor *output, Norm
 {
     ARM_COMPUTE_ERROR_ON(input == nullptr);
 
+    _is_cross_map = (norm_info.type() == NormType::CROSS_MAP);
+
+    if(_is_cross_map)
+    {
+        // The kernel slides its window across the feature maps: no squared input is needed
+        _norm_kernel.configure(input, nullptr, output, norm_info);
+        return;
+    }
+
     TensorInfo tensor_info(input->info()->tensor_shape(), 1, input->info()->data_type());
     _input_squared.allocator()->init(tensor_info);
+    _memory_group.manage(&_input_squared);
 
     // Configure kernels
     _norm_kernel.configure(input, &_input_squared, output, norm_info);
@@ -55,7 +65,21 @@ void NENormalizationLayer::configure(const ITensor *input, ITensor *output, Norm
 
 void NENormalizationLayer::run()
 {
+    if(_is_cross_map)
+    {
+        NEScheduler::get().multithread(&_norm_kernel);
+        return;
+    }
+
     NEScheduler::get().multithread(&_multiply_kernel);
     NEScheduler::get().multithread(&_border_handler);
     NEScheduler::get().multithread(&_norm_kernel);
 }
+
+MemoryFootprint NENormalizationLayer::memory_footprint() const
+{
+    MemoryFootprint footprint{ 0, 0, 0, 0 };
+    footprint.add(MemoryCategory::SCRATCH, _input_squared);
+
+    return footprint;
+}
@@ -26,20 +26,19 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/NEFillBorderKernel.h"
 #include "arm_compute/core/NEON/kernels/NELKTrackerKernel.h"
+#include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/NEON/NEScheduler.h"
-#include "arm_compute/runtime/NEON/functions/NEScharr3x3.h"
 #include "arm_compute/runtime/Pyramid.h"
-#include "arm_compute/runtime/Tensor.h"
-#include "arm_compute/runtime/TensorAllocator.h"
 
 using namespace arm_compute;
 
 NEOpticalFlow::NEOpticalFlow()
-    : _func_scharr(), _kernel_tracker(), _scharr_gx(), _scharr_gy(), _new_points(nullptr), _new_points_estimates(nullptr), _old_points(nullptr), _new_points_internal(), _old_points_internal(),
-      _num_levels(0)
+    : _border_handler(), _kernel_tracker(), _kernel_pyramid_tracker(), _pyramid_function(), _pyramid(), _new_points(nullptr), _new_points_estimates(nullptr), _old_points(nullptr), _new_points_internal(),
+      _old_points_internal(), _num_levels(0), _use_initial_estimate(false), _owns_pyramids(false), _new_index(0), _has_old_frame(false)
 {
 }
 
@@ -62,58 +61,143 @@ void NEOpticalFlow::configure(const Pyramid *old_pyramid, const Pyramid *new_pyr
     _old_points           = old_points;
     _new_points           = new_points;
     _new_points_estimates = new_points_estimates;
+    _use_initial_estimate = use_initial_estimate;
+    _owns_pyramids        = false;
 
-    const float pyr_scale = old_pyramid->info()->scale();
-
-    _func_scharr    = arm_compute::cpp14::make_unique<NEScharr3x3[]>(_num_levels);
+    _border_handler = arm_compute::cpp14::make_unique<NEFillBorderKernel[]>(_num_levels);
     _kernel_tracker = arm_compute::cpp14::make_unique<NELKTrackerKernel[]>(_num_levels);
-    _scharr_gx      = arm_compute::cpp14::make_unique<Tensor[]>(_num_levels);
-    _scharr_gy      = arm_compute::cpp14::make_unique<Tensor[]>(_num_levels);
 
     _old_points_internal = LKInternalKeypointArray(old_points->num_values());
     _new_points_internal = LKInternalKeypointArray(old_points->num_values());
     _new_points->resize(old_points->num_values());
 
+    configure_levels(old_pyramid, new_pyramid, 0, termination, epsilon, num_iterations, window_dimension, use_initial_estimate, border_mode, constant_border_value);
+}
+
+void NEOpticalFlow::configure(const IImage *input, size_t num_levels, const IKeyPointArray *old_points, const IKeyPointArray *new_points_estimates,
+                              IKeyPointArray *new_points, Termination termination, float epsilon, unsigned int num_iterations, size_t window_dimension,
+                              bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value)
+{
+    ARM_COMPUTE_ERROR_ON(nullptr == input);
+    ARM_COMPUTE_ERROR_ON(nullptr == old_points);
+    ARM_COMPUTE_ERROR_ON(nullptr == new_points_estimates);
+    ARM_COMPUTE_ERROR_ON(nullptr == new_points);
+    ARM_COMPUTE_ERROR_ON(0 == num_levels);
+    ARM_COMPUTE_ERROR_ON(use_initial_estimate && old_points->num_values() != new_points_estimates->num_values());
+
+    _num_levels           = num_levels;
+    _old_points           = old_points;
+    _new_points           = new_points;
+    _new_points_estimates = new_points_estimates;
+    _use_initial_estimate = use_initial_estimate;
+    _owns_pyramids        = true;
+    _new_index            = 0;
+    _has_old_frame        = false;
+
+    PyramidInfo pyramid_info(num_levels, SCALE_PYRAMID_HALF, input->info()->tensor_shape(), Format::U8);
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        _pyramid[i].init(pyramid_info);
+        _pyramid_function[i].configure(input, &_pyramid[i], border_mode, constant_border_value);
+    }
+
+    // Set i tracks the keypoints from pyramid i to the other pyramid of the ring
+    _border_handler = arm_compute::cpp14::make_unique<NEFillBorderKernel[]>(2 * _num_levels);
+    _kernel_tracker = arm_compute::cpp14::make_unique<NELKTrackerKernel[]>(2 * _num_levels);
+
+    _old_points_internal = LKInternalKeypointArray(old_points->num_values());
+    _new_points_internal = LKInternalKeypointArray(old_points->num_values());
+    _new_points->resize(old_points->num_values());
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        configure_levels(&_pyramid[i], &_pyramid[1 - i], i, termination, epsilon, num_iterations, window_dimension, use_initial_estimate, border_mode, constant_border_value);
+    }
+
+    for(unsigned int i = 0; i < 2; ++i)
+    {
+        _pyramid[i].allocate();
+    }
+}
+
+void NEOpticalFlow::configure_levels(const Pyramid *old_pyramid, const Pyramid *new_pyramid, unsigned int index, Termination termination, float epsilon, unsigned int num_iterations,
+                                     size_t window_dimension, bool use_initial_estimate, BorderMode border_mode, uint8_t constant_border_value)
+{
+    const float pyr_scale = old_pyramid->info()->scale();
+
+    NEFillBorderKernel *border_handler = _border_handler.get() + index * _num_levels;
+    NELKTrackerKernel  *kernel_tracker = _kernel_tracker.get() + index * _num_levels;
+
     for(unsigned int i = 0; i < _num_levels; ++i)
     {
         // Get images from the ith level of old and right pyramid
         IImage *old_ith_input = old_pyramid->get_pyramid_level(i);
         IImage *new_ith_input = new_pyramid->get_pyramid_level(i);
 
-        // Get width and height of images
-        const unsigned int width_ith  = old_ith_input->info()->dimension(0);
-        const unsigned int height_ith = new_ith_input->info()->dimension(1);
+        // Init Lucas-Kanade kernel: the scharr gradients are only computed around the keypoints
+        kernel_tracker[i].configure(old_ith_input, new_ith_input,
+                                    _old_points, _new_points_estimates, _new_points,
+                                    &_old_points_internal, &_new_points_internal,
+                                    termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
+                                    i, _num_levels, pyr_scale, border_mode == BorderMode::UNDEFINED);
 
-        TensorInfo tensor_info(TensorShape(width_ith, height_ith), Format::S16);
-
-        _scharr_gx[i].allocator()->init(tensor_info);
-        _scharr_gy[i].allocator()->init(tensor_info);
+        // Fill the border read by the scharr gradients
+        border_handler[i].configure(old_ith_input, BorderSize(1), border_mode, PixelValue(constant_border_value));
+    }
 
-        // Init Scharr kernel
-        _func_scharr[i].configure(old_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i, border_mode, constant_border_value);
+    _kernel_pyramid_tracker[index].configure(kernel_tracker, _num_levels);
+}
 
-        // Init Lucas-Kanade kernel
-        _kernel_tracker[i].configure(old_ith_input, new_ith_input, _scharr_gx.get() + i, _scharr_gy.get() + i,
-                                     old_points, new_points_estimates, new_points,
-                                     &_old_points_internal, &_new_points_internal,
-                                     termination, use_initial_estimate, epsilon, num_iterations, window_dimension,
-                                     i, _num_levels, pyr_scale);
+void NEOpticalFlow::run_levels(unsigned int index)
+{
+    NEFillBorderKernel *border_handler = _border_handler.get() + index * _num_levels;
 
-        _scharr_gx[i].allocator()->allocate();
-        _scharr_gy[i].allocator()->allocate();
+    for(unsigned int level = 0; level < _num_levels; ++level)
+    {
+        border_handler[level].run(border_handler[level].window());
     }
+
+    // Run Lucas-Kanade kernel: each thread tracks its keypoints through all the levels
+    NEScheduler::get().multithread(&_kernel_pyramid_tracker[index], Window::DimX);
+}
+
+void NEOpticalFlow::reset()
+{
+    _has_old_frame = false;
 }
 
 void NEOpticalFlow::run()
 {
     ARM_COMPUTE_ERROR_ON_MSG(_num_levels == 0, "Unconfigured function");
 
-    for(unsigned int level = _num_levels; level > 0; --level)
+    if(!_owns_pyramids)
     {
-        // Run Scharr kernel
-        _func_scharr[level - 1].run();
+        run_levels(0);
+        return;
+    }
+
+    // Only the pyramid of the new frame is built, the pyramid of the previous frame is still in the other slot of the ring
+    _pyramid_function[_new_index].run();
 
-        /* Run Lucas-Kanade kernel */
-        NEScheduler::get().multithread(_kernel_tracker.get() + level - 1, Window::DimX);
+    if(_has_old_frame)
+    {
+        run_levels(1 - _new_index);
     }
+    else
+    {
+        // Nothing to track from: the keypoints don't move
+        const IKeyPointArray *points = _use_initial_estimate ? _new_points_estimates : _old_points;
+
+        _new_points->resize(points->num_values());
+
+        for(size_t i = 0; i < points->num_values(); ++i)
+        {
+            _new_points->at(i) = points->at(i);
+        }
+
+        _has_old_frame = true;
+    }
+
+    _new_index = 1 - _new_index;
 }
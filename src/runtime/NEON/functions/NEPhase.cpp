@@ -30,9 +30,11 @@
 
 using namespace arm_compute;
 
-void NEPhase::configure(const ITensor *input1, const ITensor *input2, ITensor *output)
+void NEPhase::configure(const ITensor *input1, const ITensor *input2, ITensor *output, MagnitudePhaseApproximation approximation)
 {
+    ARM_COMPUTE_ERROR_ON(MagnitudePhaseApproximation::BINS == approximation);
+
     auto k = arm_compute::cpp14::make_unique<NEMagnitudePhaseKernel<MagnitudeType::L2NORM, PhaseType::SIGNED>>();
-    k->configure(input1, input2, nullptr, output);
+    k->configure(input1, input2, nullptr, output, approximation);
     _kernel = std::move(k);
 }
@@ -23,11 +23,19 @@
  */
 #include "arm_compute/runtime/NEON/functions/NEPoolingLayer.h"
 
+#include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/NEON/kernels/NEPoolingLayerKernel.h"
 
+#include <algorithm>
+
 using namespace arm_compute;
 
+NEPoolingLayer::NEPoolingLayer()
+    : _pool_info(), _input_height(0), _is_tileable(false)
+{
+}
+
 void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info)
 {
     // Configure pooling kernel
@@ -38,4 +46,47 @@ void NEPoolingLayer::configure(ITensor *input, ITensor *output, const PoolingLay
     // Configure border depending on operation required
     BorderMode border_mode = (pool_info.pool_type() == PoolingType::MAX) ? BorderMode::REPLICATE : BorderMode::CONSTANT;
     _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(0));
+
+    // Bands of rows can only be computed if the pooling doesn't read the borders of the input, which are filled once the whole input is available.
+    // Only the rows of NCHW tensors are split: the other layouts are always pooled in one go.
+    const bool           is_planar       = (input->info()->data_layout() == DataLayout::NCHW);
+    const PadStrideInfo &pad_stride_info = pool_info.pad_stride_info();
+    const bool           has_padding     = (pad_stride_info.pad().first != 0) || (pad_stride_info.pad().second != 0);
+    const unsigned int   last_x          = (output->info()->dimension(0) - 1) * pad_stride_info.stride().first + pool_info.pool_size();
+    const unsigned int   last_y          = (output->info()->dimension(1) - 1) * pad_stride_info.stride().second + pool_info.pool_size();
+
+    _pool_info    = pool_info;
+    _input_height = input->info()->dimension(1);
+    _is_tileable  = is_planar && !pool_info.is_global_pooling() && !has_padding && (last_x <= input->info()->dimension(0)) && (last_y <= _input_height);
+}
+
+bool NEPoolingLayer::is_tileable() const
+{
+    return _is_tileable;
+}
+
+std::pair<unsigned int, unsigned int> NEPoolingLayer::input_rows(unsigned int first_row, unsigned int last_row) const
+{
+    ARM_COMPUTE_ERROR_ON(first_row >= last_row);
+
+    const unsigned int stride_y = _pool_info.pad_stride_info().stride().second;
+
+    return std::make_pair(first_row * stride_y, std::min((last_row - 1) * stride_y + _pool_info.pool_size(), _input_height));
+}
+
+size_t NEPoolingLayer::tile_working_set(unsigned int num_rows) const
+{
+    ARM_COMPUTE_UNUSED(num_rows);
+    return 0;
+}
+
+void NEPoolingLayer::prepare_tiles()
+{
+    ARM_COMPUTE_ERROR_ON(!_is_tileable);
+}
+
+void NEPoolingLayer::run_tile(unsigned int first_row, unsigned int last_row)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_tileable);
+    run_rows(first_row, last_row);
 }
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/NEON/functions/NEPoolingNormalizationLayer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NEPoolingNormalizationLayerKernel.h"
+
+#include <algorithm>
+
+using namespace arm_compute;
+
+NEPoolingNormalizationLayer::NEPoolingNormalizationLayer()
+    : _pool_info(), _input_height(0), _is_tileable(false)
+{
+}
+
+void NEPoolingNormalizationLayer::configure(ITensor *input, ITensor *output, const PoolingLayerInfo &pool_info, const NormalizationLayerInfo &norm_info)
+{
+    // Configure fused pooling and normalization kernel
+    auto k = arm_compute::cpp14::make_unique<NEPoolingNormalizationLayerKernel>();
+    k->configure(input, output, pool_info, norm_info);
+    _kernel = std::move(k);
+
+    // The padding of a max pooling replicates the edges of the input
+    _border_handler.configure(input, _kernel->border_size(), BorderMode::REPLICATE, PixelValue(0));
+
+    // Bands of rows can only be computed if the pooling doesn't read the borders of the input, which are filled once the whole input is available
+    const PadStrideInfo &pad_stride_info = pool_info.pad_stride_info();
+    const bool           has_padding     = (pad_stride_info.pad().first != 0) || (pad_stride_info.pad().second != 0);
+    const unsigned int   last_x          = (output->info()->dimension(0) - 1) * pad_stride_info.stride().first + pool_info.pool_size();
+    const unsigned int   last_y          = (output->info()->dimension(1) - 1) * pad_stride_info.stride().second + pool_info.pool_size();
+
+    _pool_info    = pool_info;
+    _input_height = input->info()->dimension(1);
+    _is_tileable  = !pool_info.is_global_pooling() && !has_padding && (last_x <= input->info()->dimension(0)) && (last_y <= _input_height);
+}
+
+bool NEPoolingNormalizationLayer::is_tileable() const
+{
+    return _is_tileable;
+}
+
+std::pair<unsigned int, unsigned int> NEPoolingNormalizationLayer::input_rows(unsigned int first_row, unsigned int last_row) const
+{
+    ARM_COMPUTE_ERROR_ON(first_row >= last_row);
+
+    const unsigned int stride_y = _pool_info.pad_stride_info().stride().second;
+
+    return std::make_pair(first_row * stride_y, std::min((last_row - 1) * stride_y + _pool_info.pool_size(), _input_height));
+}
+
+size_t NEPoolingNormalizationLayer::tile_working_set(unsigned int num_rows) const
+{
+    ARM_COMPUTE_UNUSED(num_rows);
+    return 0;
+}
+
+void NEPoolingNormalizationLayer::prepare_tiles()
+{
+    ARM_COMPUTE_ERROR_ON(!_is_tileable);
+}
+
+void NEPoolingNormalizationLayer::run_tile(unsigned int first_row, unsigned int last_row)
+{
+    ARM_COMPUTE_ERROR_ON(!_is_tileable);
+    run_rows(first_row, last_row);
+}
@@ -27,12 +27,14 @@
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
 #include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/NEON/kernels/NEScaleAreaKernel.h"
 #include "arm_compute/core/NEON/kernels/NEScaleKernel.h"
 #include "arm_compute/core/PixelValue.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/Window.h"
 #include "arm_compute/runtime/TensorAllocator.h"
 
+#include <algorithm>
 #include <cmath>
 #include <cstddef>
 #include <utility>
@@ -83,6 +85,19 @@ void precompute_dx_dy_offsets(ITensor *dx, ITensor *dy, ITensor *offsets, float
         offsets_it);
     }
 }
+
+/** Border value of the input: all the channels of multi-channel images are set to the constant */
+PixelValue border_value(const ITensor *input, uint8_t constant_border_value)
+{
+    PixelValue value(constant_border_value);
+
+    if(input->info()->num_channels() != 1)
+    {
+        std::fill_n(value.value.rgbx, 4, constant_border_value);
+    }
+
+    return value;
+}
 } // namespace
 
 NEScale::NEScale()
@@ -116,11 +131,21 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
         policy = InterpolationPolicy::NEAREST_NEIGHBOR;
     }
 
-    auto k = arm_compute::cpp14::make_unique<NEScaleKernel>();
-
     // Check if the border mode is UNDEFINED
     const bool border_undefined = border_mode == BorderMode::UNDEFINED;
 
+    // Area down-sampling anti-aliases and downscales in a single pass, from the input pixels only
+    if(policy == InterpolationPolicy::AREA && wr >= 1.f && hr >= 1.f)
+    {
+        auto k = arm_compute::cpp14::make_unique<NEScaleAreaKernel>();
+        k->configure(input, output);
+        _kernel = std::move(k);
+        _border_handler.configure(input, _kernel->border_size(), border_mode, border_value(input, constant_border_value));
+        return;
+    }
+
+    auto k = arm_compute::cpp14::make_unique<NEScaleKernel>();
+
     switch(policy)
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
@@ -167,5 +192,5 @@ void NEScale::configure(ITensor *input, ITensor *output, InterpolationPolicy pol
     }
 
     _kernel = std::move(k);
-    _border_handler.configure(input, _kernel->border_size(), border_mode, PixelValue(constant_border_value));
+    _border_handler.configure(input, _kernel->border_size(), border_mode, border_value(input, constant_border_value));
 }
@@ -25,32 +25,44 @@
 
 #include "arm_compute/core/Error.h"
 #include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NERemapKernel.h"
 #include "arm_compute/core/NEON/kernels/NEWarpKernel.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/TensorAllocator.h"
 
+#include <memory>
 #include <utility>
 
 using namespace arm_compute;
 
-void NEWarpPerspective::configure(ITensor *input, ITensor *output, const float *matrix, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value)
+NEWarpPerspective::NEWarpPerspective()
+    : _offsets(), _fractions()
+{
+}
+
+void NEWarpPerspective::configure(ITensor *input, ITensor *output, const float *matrix, InterpolationPolicy policy, BorderMode border_mode, uint8_t constant_border_value, bool use_remap_table, float max_error)
 {
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(input, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(output, 1, DataType::U8);
     ARM_COMPUTE_ERROR_ON(nullptr == matrix);
+    ARM_COMPUTE_ERROR_ON(max_error < 0.f);
+
+    std::unique_ptr<INEWarpKernel> k;
 
     switch(policy)
     {
         case InterpolationPolicy::NEAREST_NEIGHBOR:
         {
-            auto k = arm_compute::cpp14::make_unique<NEWarpPerspectiveKernel<InterpolationPolicy::NEAREST_NEIGHBOR>>();
-            k->configure(input, output, matrix, border_mode, constant_border_value);
-            _kernel = std::move(k);
+            auto kernel = arm_compute::cpp14::make_unique<NEWarpPerspectiveKernel<InterpolationPolicy::NEAREST_NEIGHBOR>>();
+            kernel->set_max_error(max_error);
+            k = std::move(kernel);
             break;
         }
         case InterpolationPolicy::BILINEAR:
         {
-            auto k = arm_compute::cpp14::make_unique<NEWarpPerspectiveKernel<InterpolationPolicy::BILINEAR>>();
-            k->configure(input, output, matrix, border_mode, constant_border_value);
-            _kernel = std::move(k);
+            auto kernel = arm_compute::cpp14::make_unique<NEWarpPerspectiveKernel<InterpolationPolicy::BILINEAR>>();
+            kernel->set_max_error(max_error);
+            k = std::move(kernel);
             break;
         }
         case InterpolationPolicy::AREA:
@@ -58,5 +70,39 @@ void NEWarpPerspective::configure(ITensor *input, ITensor *output, const float *
             ARM_COMPUTE_ERROR("Interpolation type not supported");
     }
 
+    k->configure(input, output, matrix, border_mode, constant_border_value);
+
+    if(use_remap_table)
+    {
+        const TensorShape &shape     = output->info()->tensor_shape();
+        ITensor           *fractions = nullptr;
+
+        _offsets.allocator()->init(TensorInfo(shape, Format::S32));
+
+        if(policy == InterpolationPolicy::BILINEAR)
+        {
+            _fractions.allocator()->init(TensorInfo(shape, Format::U16));
+            fractions = &_fractions;
+        }
+
+        auto remap = arm_compute::cpp14::make_unique<NERemapKernel>();
+        remap->configure(input, &_offsets, fractions, output, (border_mode == BorderMode::CONSTANT) ? constant_border_value : 0);
+
+        _offsets.allocator()->allocate();
+
+        if(fractions != nullptr)
+        {
+            _fractions.allocator()->allocate();
+        }
+
+        k->build_remap_table(&_offsets, fractions, border_mode);
+
+        _kernel = std::move(remap);
+    }
+    else
+    {
+        _kernel = std::move(k);
+    }
+
     _border_handler.configure(input, _kernel->border_size(), border_mode, constant_border_value);
 }
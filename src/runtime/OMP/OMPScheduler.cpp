@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/OMP/OMPScheduler.h"
+
+#include "arm_compute/core/CPP/ICPPKernel.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Window.h"
+#include "arm_compute/runtime/Profiler.h"
+
+#include <algorithm>
+#include <exception>
+#include <omp.h>
+#include <vector>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of sub-windows per thread the window of a @ref SchedulingPolicy::DYNAMIC kernel is split in */
+constexpr int num_chunks_per_thread = 4;
+
+/** Return a part of a window split in a 2D grid of @p parts_x parts along X by total / @p parts_x parts along the split dimension
+ *
+ * @param[in] window          Window to split.
+ * @param[in] split_dimension Dimension along which the window is split.
+ * @param[in] id              Id of the part, the parts being numbered along X first.
+ * @param[in] total           Total number of parts.
+ * @param[in] parts_x         Number of parts along X, 1 to split the window along the split dimension only.
+ *
+ * @return The sub-window of the part.
+ */
+Window split_window_grid(const Window &window, size_t split_dimension, int id, int total, int parts_x)
+{
+    if(parts_x > 1)
+    {
+        return window.split_window(Window::DimX, id % parts_x, parts_x).split_window(split_dimension, id / parts_x, total / parts_x);
+    }
+
+    return window.split_window(split_dimension, id, total);
+}
+} // namespace
+
+OMPScheduler &OMPScheduler::get()
+{
+    static OMPScheduler scheduler;
+    return scheduler;
+}
+
+OMPScheduler::OMPScheduler()
+    : _num_threads(omp_get_max_threads())
+{
+}
+
+void OMPScheduler::force_number_of_threads(int num_threads)
+{
+    _num_threads = num_threads > 0 ? num_threads : omp_get_max_threads();
+}
+
+int OMPScheduler::num_threads() const
+{
+    return _num_threads;
+}
+
+void OMPScheduler::multithread(ICPPKernel *kernel, const size_t split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+    multithread(kernel, kernel->window(), split_dimension);
+}
+
+void OMPScheduler::multithread(ICPPKernel *kernel, const Window &window, const size_t split_dimension)
+{
+    ARM_COMPUTE_ERROR_ON_MSG(!kernel, "The child class didn't set the kernel");
+
+    const int  num_iterations = window.num_iterations(split_dimension);
+    const bool is_dynamic     = kernel->scheduling_policy() == SchedulingPolicy::DYNAMIC;
+
+    // The kernel can ask for its window to be split in a 2D grid of parts along X and along the split dimension
+    const int max_parts   = is_dynamic ? _num_threads * num_chunks_per_thread : _num_threads;
+    const int parts_x     = (split_dimension != Window::DimX) ? std::min<int>(kernel->split_parts_x(max_parts), window.num_iterations(Window::DimX)) : 1;
+    const int parts_y     = (parts_x > 1) ? std::min(num_iterations, max_parts / parts_x) : num_iterations;
+    const int num_threads = std::min(parts_x * parts_y, _num_threads);
+
+    // Profiling costs a single check when disabled
+    const bool                    is_profiling  = Profiler::get().is_enabled();
+    const bool                    read_counters = is_profiling && Profiler::get().reads_counters();
+    const double                  start         = is_profiling ? Profiler::get().now() : 0.0;
+    std::vector<ProfilerInterval> thread_times;
+    std::vector<ProfilerCounters> thread_counters;
+
+    if(!kernel->is_parallelisable() || 1 == num_threads)
+    {
+        const ProfilerCounters start_counters = read_counters ? Profiler::thread_counters() : ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+
+        kernel->begin_reduction(1);
+        kernel->run(window);
+        kernel->end_reduction();
+
+        if(is_profiling)
+        {
+            const ProfilerInterval wall_time{ start, Profiler::get().now() };
+            if(read_counters)
+            {
+                thread_counters.push_back(Profiler::thread_counters() - start_counters);
+            }
+            Profiler::get().add(*kernel, wall_time, { wall_time }, -1.0, std::move(thread_counters));
+        }
+        return;
+    }
+
+    if(is_profiling)
+    {
+        thread_times.resize(num_threads);
+    }
+    if(read_counters)
+    {
+        thread_counters.resize(num_threads);
+    }
+
+    // Static kernels get exactly one sub-window per thread, dynamic ones several sub-windows pulled on demand
+    const int num_chunks = is_dynamic ? ((parts_x > 1) ? parts_x * parts_y : std::min(num_iterations, num_threads * num_chunks_per_thread)) : num_threads;
+
+    // Exceptions must not escape the parallel region: the first one caught is rethrown in the calling thread
+    std::exception_ptr exception = nullptr;
+
+    kernel->begin_reduction(num_threads);
+
+    #pragma omp parallel num_threads(num_threads)
+    {
+        const int              t              = omp_get_thread_num();
+        const double           thread_start   = is_profiling ? Profiler::get().now() : 0.0;
+        const ProfilerCounters start_counters = read_counters ? Profiler::thread_counters() : ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+
+        if(is_dynamic)
+        {
+            #pragma omp for schedule(dynamic, 1) nowait
+            for(int chunk = 0; chunk < num_chunks; ++chunk)
+            {
+                try
+                {
+                    Window win = split_window_grid(window, split_dimension, chunk, num_chunks, parts_x);
+                    win.set_thread_id(t);
+                    win.set_num_threads(num_threads);
+                    win.validate_on_run();
+
+                    kernel->run(win);
+                }
+                catch(...)
+                {
+                    #pragma omp critical
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+        else
+        {
+            // The runtime can give a smaller team than requested (e.g. OMP_DYNAMIC, nested regions or thread limits): the parts are
+            // shared out among the threads of the team, and each part keeps its own id so that per-thread resources aren't shared
+            #pragma omp for schedule(static, 1) nowait
+            for(int part = 0; part < num_threads; ++part)
+            {
+                try
+                {
+                    Window win = split_window_grid(window, split_dimension, part, num_threads, parts_x);
+                    win.set_thread_id(part);
+                    win.set_num_threads(num_threads);
+                    win.validate_on_run();
+
+                    kernel->run(win);
+                }
+                catch(...)
+                {
+                    #pragma omp critical
+                    if(exception == nullptr)
+                    {
+                        exception = std::current_exception();
+                    }
+                }
+            }
+        }
+
+        if(is_profiling)
+        {
+            thread_times[t] = ProfilerInterval{ thread_start, Profiler::get().now() };
+        }
+        if(read_counters)
+        {
+            thread_counters[t] = Profiler::thread_counters() - start_counters;
+        }
+    }
+
+    if(exception != nullptr)
+    {
+        std::rethrow_exception(exception);
+    }
+
+    kernel->end_reduction();
+
+    if(is_profiling)
+    {
+        Profiler::get().add(*kernel, ProfilerInterval{ start, Profiler::get().now() }, std::move(thread_times), -1.0, std::move(thread_counters));
+    }
+}
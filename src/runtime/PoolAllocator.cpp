@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/PoolAllocator.h"
+
+#include "arm_compute/core/Error.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
+#include <limits>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Smallest block requested to the system, in bytes */
+constexpr size_t min_block_size = 64;
+
+/** Number of size classes between two consecutive powers of 2 */
+constexpr size_t num_classes_per_power_of_two = 8;
+
+/** Round a size up to its size class
+ *
+ * @param[in] value Size in bytes.
+ *
+ * @return The smallest size class greater than or equal to @p value
+ */
+size_t size_class(size_t value)
+{
+    if(value <= min_block_size)
+    {
+        return min_block_size;
+    }
+
+    // Largest power of 2 below the size: the classes between it and the next one are num_classes_per_power_of_two steps apart
+    size_t power = min_block_size;
+    while((power << 1) < value)
+    {
+        power <<= 1;
+    }
+    const size_t step = power / num_classes_per_power_of_two;
+    return ((value + step - 1) / step) * step;
+}
+
+void *align_pointer(void *ptr, size_t alignment)
+{
+    const uintptr_t address = reinterpret_cast<uintptr_t>(ptr);
+    return reinterpret_cast<void *>((address + alignment - 1) & ~(static_cast<uintptr_t>(alignment) - 1));
+}
+} // namespace
+
+PoolAllocator::PoolAllocator()
+    : _mtx(), _free_blocks(), _used_blocks(), _pooled_size(0), _max_pooled_size(std::numeric_limits<size_t>::max())
+{
+}
+
+PoolAllocator::~PoolAllocator()
+{
+    clear();
+}
+
+PoolAllocator &PoolAllocator::get()
+{
+    static PoolAllocator allocator;
+    return allocator;
+}
+
+void PoolAllocator::clear()
+{
+    trim(0);
+}
+
+void PoolAllocator::trim(size_t max_pooled_size)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    trim_locked(max_pooled_size);
+}
+
+void PoolAllocator::set_max_pooled_size(size_t max_pooled_size)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    _max_pooled_size = max_pooled_size;
+    trim_locked(max_pooled_size);
+}
+
+void PoolAllocator::trim_locked(size_t max_pooled_size)
+{
+    // The largest blocks are released first: they are the least likely to be reused
+    while(_pooled_size > max_pooled_size)
+    {
+        const auto it = std::prev(_free_blocks.end());
+        std::free(it->second.base);
+        _pooled_size -= it->second.size;
+        _free_blocks.erase(it);
+    }
+}
+
+size_t PoolAllocator::pooled_size() const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+    return _pooled_size;
+}
+
+void *PoolAllocator::allocate(size_t size, size_t alignment)
+{
+    ARM_COMPUTE_ERROR_ON_MSG((alignment & (alignment - 1)) != 0, "The alignment must be a power of 2");
+
+    const size_t block_size = size_class(size);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // Reuse a pooled block of the same size class if there is one with a compatible alignment
+    const auto range = _free_blocks.equal_range(block_size);
+    for(auto it = range.first; it != range.second; ++it)
+    {
+        if(it->second.alignment >= alignment)
+        {
+            const Block block = it->second;
+            void       *ptr   = align_pointer(block.base, block.alignment);
+            _free_blocks.erase(it);
+            _pooled_size -= block.size;
+            _used_blocks.emplace(ptr, block);
+            return ptr;
+        }
+    }
+
+    // Otherwise get a new block from the system: over-allocate to be able to align the start of the block
+    void *base = std::malloc(block_size + alignment - 1);
+    if(base == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Failed to allocate %zu bytes", block_size);
+    }
+
+    void *ptr = align_pointer(base, alignment);
+    _used_blocks.emplace(ptr, Block{ base, block_size, alignment });
+    return ptr;
+}
+
+void PoolAllocator::free(void *ptr)
+{
+    if(ptr == nullptr)
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    const auto it = _used_blocks.find(ptr);
+    ARM_COMPUTE_ERROR_ON_MSG(it == _used_blocks.end(), "The block was not allocated by this allocator");
+
+    _pooled_size += it->second.size;
+    _free_blocks.emplace(it->second.size, it->second);
+    _used_blocks.erase(it);
+
+    trim_locked(_max_pooled_size);
+}
@@ -0,0 +1,419 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Profiler.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/IKernel.h"
+
+#include <algorithm>
+#include <array>
+#include <iomanip>
+#include <sstream>
+#include <typeinfo>
+#include <utility>
+
+#if defined(__GNUG__)
+#include <cstdlib>
+#include <cxxabi.h>
+#endif /* defined(__GNUG__) */
+
+#ifdef __linux__
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif /* __linux__ */
+
+using namespace arm_compute;
+
+namespace
+{
+/** Number of iterations of a window along each dimension, rounded up, e.g. "4x55x96" for 55x55x96 elements processed 16 at a time along X.
+ *  Trailing dimensions of a single iteration are omitted.
+ */
+std::string window_to_string(const Window &window)
+{
+    const auto num_iterations = [&](size_t d)
+    {
+        const int step = std::max(window[d].step(), 1);
+        return (window[d].end() - window[d].start() + step - 1) / step;
+    };
+
+    size_t num_dimensions = 1;
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        if(num_iterations(d) > 1)
+        {
+            num_dimensions = d + 1;
+        }
+    }
+
+    std::stringstream ss;
+    for(size_t d = 0; d < num_dimensions; ++d)
+    {
+        ss << (d == 0 ? "" : "x") << num_iterations(d);
+    }
+    return ss.str();
+}
+
+#ifdef __linux__
+/** Configuration of a read miss event of a cache for PERF_TYPE_HW_CACHE */
+constexpr uint64_t cache_read_miss(uint64_t cache)
+{
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+/** Open a hardware counter of the calling thread, on whichever CPU it runs
+ *
+ * @param[in] type   Type of the event (PERF_TYPE_*).
+ * @param[in] config Event of the type.
+ *
+ * @return The file descriptor of the counter, -1 if the event is not supported
+ */
+int open_counter(uint32_t type, uint64_t config)
+{
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type           = type;
+    attr.size           = sizeof(attr);
+    attr.config         = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv     = 1;
+
+    return static_cast<int>(syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+/** Hardware counters of one thread, opened on construction and closed when the thread exits */
+class ThreadCounters
+{
+public:
+    /** Open the counters of the calling thread */
+    ThreadCounters()
+        : _fds()
+    {
+        _fds[0] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+        _fds[1] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS);
+        _fds[2] = open_counter(PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_L1D));
+        _fds[3] = open_counter(PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_LL));
+        _fds[4] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_FRONTEND);
+        _fds[5] = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_STALLED_CYCLES_BACKEND);
+    }
+    ThreadCounters(const ThreadCounters &) = delete;
+    ThreadCounters &operator=(const ThreadCounters &) = delete;
+    /** Close the counters */
+    ~ThreadCounters()
+    {
+        for(int fd : _fds)
+        {
+            if(fd >= 0)
+            {
+                close(fd);
+            }
+        }
+    }
+    /** Read the counters
+     *
+     * @return The values of the counters since they were opened
+     */
+    ProfilerCounters read() const
+    {
+        return ProfilerCounters{ value(0), value(1), value(2), value(3), value(4), value(5) };
+    }
+
+private:
+    /** Read one counter, 0 if it is not supported */
+    uint64_t value(size_t i) const
+    {
+        uint64_t count = 0;
+        if(_fds[i] < 0 || ::read(_fds[i], &count, sizeof(count)) != sizeof(count))
+        {
+            count = 0;
+        }
+        return count;
+    }
+
+    std::array<int, 6> _fds;
+};
+#endif /* __linux__ */
+
+/** Escape a string to be used in a JSON document */
+std::string json_escape(const std::string &str)
+{
+    std::string out;
+    for(char c : str)
+    {
+        if(c == '"' || c == '\\')
+        {
+            out += '\\';
+        }
+        out += c;
+    }
+    return out;
+}
+} // namespace
+
+Profiler::Profiler()
+    : _enabled(false), _read_counters(false), _origin(std::chrono::steady_clock::now()), _layer(), _entries(), _mtx()
+{
+}
+
+Profiler &Profiler::get()
+{
+    static Profiler profiler;
+    return profiler;
+}
+
+void Profiler::start(bool read_counters)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _entries.clear();
+    _layer.clear();
+    _origin = std::chrono::steady_clock::now();
+    _read_counters.store(read_counters && counters_available(), std::memory_order_relaxed);
+    _enabled.store(true, std::memory_order_relaxed);
+}
+
+void Profiler::stop()
+{
+    _enabled.store(false, std::memory_order_relaxed);
+    _read_counters.store(false, std::memory_order_relaxed);
+}
+
+bool Profiler::counters_available()
+{
+#ifdef __linux__
+    const int fd = open_counter(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES);
+    if(fd < 0)
+    {
+        return false;
+    }
+    close(fd);
+    return true;
+#else  /* __linux__ */
+    return false;
+#endif /* __linux__ */
+}
+
+ProfilerCounters Profiler::thread_counters()
+{
+#ifdef __linux__
+    static thread_local ThreadCounters counters;
+    return counters.read();
+#else  /* __linux__ */
+    return ProfilerCounters{ 0, 0, 0, 0, 0, 0 };
+#endif /* __linux__ */
+}
+
+void Profiler::set_layer(std::string name)
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _layer = std::move(name);
+}
+
+std::string Profiler::kernel_name(const IKernel &kernel)
+{
+    std::string name = typeid(kernel).name();
+
+#if defined(__GNUG__)
+    int   status    = 0;
+    char *demangled = abi::__cxa_demangle(name.c_str(), nullptr, nullptr, &status);
+    if(status == 0 && demangled != nullptr)
+    {
+        name = demangled;
+    }
+    std::free(demangled);
+#endif /* defined(__GNUG__) */
+
+    const size_t pos = name.rfind("::");
+    return pos == std::string::npos ? name : name.substr(pos + 2);
+}
+
+double Profiler::now() const
+{
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - _origin).count();
+}
+
+void Profiler::add(const IKernel &kernel, const ProfilerInterval &wall_time, std::vector<ProfilerInterval> threads, double device_time, std::vector<ProfilerCounters> counters)
+{
+    ARM_COMPUTE_ERROR_ON(!counters.empty() && counters.size() != threads.size());
+
+    std::string name = kernel_name(kernel);
+
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    _entries.push_back(ProfilerEntry{ std::move(name), _layer, kernel.window(), wall_time, std::move(threads), device_time, std::move(counters) });
+}
+
+void Profiler::print_report(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    /** Accumulated times of a kernel within a layer */
+    struct Stats
+    {
+        std::string      kernel;
+        std::string      window;
+        int              count;
+        double           total;
+        double           device_total;
+        ProfilerCounters counters;
+    };
+
+    // Group the records by layer then by kernel and window, in the order of their first execution
+    std::vector<std::pair<std::string, std::vector<Stats>>> layers;
+    double total        = 0.0;
+    bool   has_counters = false;
+
+    for(const auto &entry : _entries)
+    {
+        auto layer = std::find_if(layers.begin(), layers.end(), [&](const std::pair<std::string, std::vector<Stats>> &l)
+        {
+            return l.first == entry.layer;
+        });
+        if(layer == layers.end())
+        {
+            layers.emplace_back(entry.layer, std::vector<Stats>());
+            layer = layers.end() - 1;
+        }
+
+        const std::string window = window_to_string(entry.window);
+        auto              stats  = std::find_if(layer->second.begin(), layer->second.end(), [&](const Stats & s)
+        {
+            return s.kernel == entry.kernel && s.window == window;
+        });
+        if(stats == layer->second.end())
+        {
+            layer->second.push_back(Stats{ entry.kernel, window, 0, 0.0, 0.0, ProfilerCounters{ 0, 0, 0, 0, 0, 0 } });
+            stats = layer->second.end() - 1;
+        }
+
+        const double time = entry.wall_time.end - entry.wall_time.start;
+        stats->count++;
+        stats->total += time;
+        stats->device_total += std::max(entry.device_time, 0.);
+        total += time;
+
+        // The counters of all the threads add up
+        for(const auto &c : entry.counters)
+        {
+            stats->counters.cycles += c.cycles;
+            stats->counters.instructions += c.instructions;
+            stats->counters.l1d_misses += c.l1d_misses;
+            stats->counters.l2_misses += c.l2_misses;
+            stats->counters.stalled_cycles_frontend += c.stalled_cycles_frontend;
+            stats->counters.stalled_cycles_backend += c.stalled_cycles_backend;
+            has_counters = true;
+        }
+    }
+
+    const std::ios_base::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(1);
+    os << std::left << std::setw(36) << "Kernel" << std::setw(16) << "Iterations" << std::right << std::setw(8) << "Calls" << std::setw(14) << "Total (us)" << std::setw(14)
+       << "Avg (us)" << std::setw(14) << "Device (us)" << std::setw(8) << "%";
+    if(has_counters)
+    {
+        os << std::setw(8) << "IPC" << std::setw(12) << "L1D MPKI" << std::setw(12) << "L2 MPKI" << std::setw(10) << "Stall %";
+    }
+    os << std::endl;
+
+    for(const auto &layer : layers)
+    {
+        double layer_total = 0.0;
+        for(const auto &stats : layer.second)
+        {
+            layer_total += stats.total;
+        }
+
+        os << "[" << (layer.first.empty() ? "no layer" : layer.first) << "] " << layer_total << " us" << std::endl;
+
+        for(const auto &stats : layer.second)
+        {
+            os << "  " << std::left << std::setw(34) << stats.kernel << std::setw(16) << stats.window << std::right << std::setw(8) << stats.count << std::setw(14) << stats.total << std::setw(14)
+               << stats.total / stats.count << std::setw(14) << stats.device_total << std::setw(8) << (total > 0.0 ? 100.0 * stats.total / total : 0.0);
+            if(has_counters)
+            {
+                // Misses per thousand instructions and share of the cycles stalled in the frontend or the backend
+                const ProfilerCounters &c            = stats.counters;
+                const double            cycles       = std::max<double>(c.cycles, 1.);
+                const double            instructions = std::max<double>(c.instructions, 1.);
+                os << std::setprecision(2) << std::setw(8) << c.instructions / cycles << std::setw(12) << 1000. * c.l1d_misses / instructions << std::setw(12) << 1000. * c.l2_misses / instructions
+                   << std::setprecision(1) << std::setw(10) << 100. * (c.stalled_cycles_frontend + c.stalled_cycles_backend) / cycles;
+            }
+            os << std::endl;
+        }
+    }
+
+    os << "Total: " << total << " us" << std::endl;
+    os.flags(flags);
+}
+
+void Profiler::print_chrome_trace(std::ostream &os) const
+{
+    std::lock_guard<std::mutex> lock(_mtx);
+
+    // The kernels are run on the caller track, their parts on one track per thread and the OpenCL device times on a separate process
+    constexpr int cpu_pid    = 0;
+    constexpr int device_pid = 1;
+
+    const auto print_event = [&](const ProfilerEntry & entry, int pid, int tid, double start, double duration, const ProfilerCounters * counters, bool &is_first)
+    {
+        os << (is_first ? "\n" : ",\n");
+        os << "{\"name\":\"" << json_escape(entry.kernel) << "\",\"cat\":\"" << json_escape(entry.layer) << "\",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << tid << ",\"ts\":" << start
+           << ",\"dur\":" << duration << ",\"args\":{\"window\":\"" << window_to_string(entry.window) << "\"";
+        if(counters != nullptr)
+        {
+            os << ",\"cycles\":" << counters->cycles << ",\"instructions\":" << counters->instructions << ",\"l1d_misses\":" << counters->l1d_misses << ",\"l2_misses\":" << counters->l2_misses
+               << ",\"stalled_cycles_frontend\":" << counters->stalled_cycles_frontend << ",\"stalled_cycles_backend\":" << counters->stalled_cycles_backend;
+        }
+        os << "}}";
+        is_first = false;
+    };
+
+    const std::ios_base::fmtflags flags = os.flags();
+    os << std::fixed << std::setprecision(3);
+    os << "{\"traceEvents\":[";
+
+    bool is_first = true;
+    for(const auto &entry : _entries)
+    {
+        print_event(entry, cpu_pid, 0, entry.wall_time.start, entry.wall_time.end - entry.wall_time.start, nullptr, is_first);
+
+        for(size_t t = 0; t < entry.threads.size(); ++t)
+        {
+            const ProfilerCounters *counters = entry.counters.empty() ? nullptr : &entry.counters[t];
+            print_event(entry, cpu_pid, t + 1, entry.threads[t].start, entry.threads[t].end - entry.threads[t].start, counters, is_first);
+        }
+
+        if(entry.device_time >= 0.)
+        {
+            // The device time is only a duration: align it on the end of the kernel as seen by the host
+            print_event(entry, device_pid, 0, entry.wall_time.end - entry.device_time, entry.device_time, nullptr, is_first);
+        }
+    }
+
+    os << "\n]}" << std::endl;
+    os.flags(flags);
+}
@@ -28,8 +28,10 @@
 #include "arm_compute/core/PyramidInfo.h"
 #include "arm_compute/core/TensorInfo.h"
 #include "arm_compute/core/TensorShape.h"
+#include "arm_compute/runtime/TensorAllocator.h"
 
 #include <cmath>
+#include <vector>
 
 using namespace arm_compute;
 
@@ -101,10 +103,16 @@ void Pyramid::allocate()
 {
     ARM_COMPUTE_ERROR_ON(_pyramid == nullptr);
 
+    // All the levels share a single allocation
+    std::vector<TensorAllocator *> levels;
+    levels.reserve(_info.num_levels());
+
     for(size_t i = 0; i < _info.num_levels(); ++i)
     {
-        (_pyramid.get() + i)->allocator()->allocate();
+        levels.push_back((_pyramid.get() + i)->allocator());
     }
+
+    TensorAllocator::allocate_contiguous(levels);
 }
 
 const PyramidInfo *Pyramid::info() const
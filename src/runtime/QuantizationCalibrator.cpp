@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/QuantizationCalibrator.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/core/Window.h"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace arm_compute;
+
+QuantizationCalibrator::QuantizationCalibrator()
+    : _min(0.f), _max(0.f), _has_values(false)
+{
+}
+
+void QuantizationCalibrator::observe(const ITensor &tensor)
+{
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32);
+
+    const ValidRegion valid_region = tensor.info()->valid_region();
+
+    Window window;
+    for(size_t d = 0; d < Coordinates::num_max_dimensions; ++d)
+    {
+        window.set(d, Window::Dimension(valid_region.start(d), valid_region.end(d)));
+    }
+
+    // Always start from 0 so that it is included in the range
+    float min_value = _min;
+    float max_value = _max;
+
+    Iterator it(&tensor, window);
+    execute_window_loop(window, [&](const Coordinates & id)
+    {
+        const float value = *reinterpret_cast<const float *>(it.ptr());
+        min_value         = std::min(min_value, value);
+        max_value         = std::max(max_value, value);
+    },
+    it);
+
+    _min        = min_value;
+    _max        = max_value;
+    _has_values = true;
+}
+
+QuantizationInfo QuantizationCalibrator::quantization_info() const
+{
+    if(!_has_values || _max == _min)
+    {
+        return QuantizationInfo();
+    }
+
+    const float scale  = (_max - _min) / 255.f;
+    const int   offset = std::min(255, std::max(0, static_cast<int>(std::lround(-_min / scale))));
+
+    return QuantizationInfo(scale, offset);
+}
+
+void QuantizationCalibrator::reset()
+{
+    _min        = 0.f;
+    _max        = 0.f;
+    _has_values = false;
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/SharedWeights.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <utility>
+
+using namespace arm_compute;
+
+SharedWeights::SharedWeights()
+    : _tensor(nullptr), _layout()
+{
+}
+
+SharedWeights::SharedWeights(Tensor &tensor, std::string layout)
+    : _tensor(std::make_shared<Tensor>()), _layout(std::move(layout))
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(tensor.allocator()->is_sub_tensor(), "The memory of a sub-tensor belongs to its parent");
+
+    // The tensor of the handle shares the ownership of the memory of the reshaped weights
+    _tensor->allocator()->init(*tensor.info());
+    _tensor->allocator()->import_memory(tensor.allocator()->_buffer);
+}
+
+bool SharedWeights::empty() const
+{
+    return _tensor == nullptr;
+}
+
+const std::string &SharedWeights::layout() const
+{
+    return _layout;
+}
+
+bool SharedWeights::import_to(Tensor &tensor, const std::string &layout) const
+{
+    if(empty() || layout != _layout)
+    {
+        return false;
+    }
+
+    const TensorInfo &info        = *tensor.info();
+    const TensorInfo &shared_info = *_tensor->info();
+    if(info.data_type() != shared_info.data_type() || info.total_size() != shared_info.total_size()
+       || !std::equal(info.tensor_shape().cbegin(), info.tensor_shape().cend(), shared_info.tensor_shape().cbegin())
+       || !std::equal(info.strides_in_bytes().cbegin(), info.strides_in_bytes().cend(), shared_info.strides_in_bytes().cbegin()))
+    {
+        return false;
+    }
+
+    if(tensor.buffer() != nullptr)
+    {
+        tensor.allocator()->free();
+    }
+    // The reader shares the ownership of the memory too, so that it outlives the handle
+    tensor.allocator()->init(shared_info);
+    tensor.allocator()->import_memory(_tensor->allocator()->_buffer);
+
+    return true;
+}
@@ -25,84 +25,149 @@
 
 #include "arm_compute/core/Coordinates.h"
 #include "arm_compute/core/Error.h"
+#include "arm_compute/core/StartupProfiler.h"
 #include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Utils.h"
+#include "arm_compute/runtime/MemoryPlanner.h"
+#include "arm_compute/runtime/PoolAllocator.h"
 
 #include <cstddef>
+#include <utility>
 
 using namespace arm_compute;
 
 namespace
 {
-bool validate_subtensor_shape(const TensorInfo &parent_info, const TensorInfo &child_info, const Coordinates &coords)
-{
-    bool               is_valid     = true;
-    const TensorShape &parent_shape = parent_info.tensor_shape();
-    const TensorShape &child_shape  = child_info.tensor_shape();
-    const size_t       parent_dims  = parent_info.num_dimensions();
-    const size_t       child_dims   = child_info.num_dimensions();
-
-    if(child_dims <= parent_dims)
-    {
-        for(size_t num_dimensions = child_dims; num_dimensions > 0; --num_dimensions)
-        {
-            const size_t child_dim_size = coords[num_dimensions - 1] + child_shape[num_dimensions - 1];
-
-            if((coords[num_dimensions - 1] < 0) || (child_dim_size > parent_shape[num_dimensions - 1]))
-            {
-                is_valid = false;
-                break;
-            }
-        }
-    }
-    else
-    {
-        is_valid = false;
-    }
+/** Alignment in bytes of the CPU memory allocations (Size of a cache line) */
+constexpr size_t tensor_alignment = 64;
 
-    return is_valid;
-}
+/** Allocator set by TensorAllocator::set_default_allocator() */
+IAllocator *default_allocator_override = nullptr;
 } // namespace
 
 TensorAllocator::TensorAllocator()
-    : _buffer(nullptr)
+    : _buffer(nullptr), _parent(nullptr), _allocator(default_allocator()), _associated_memory_planner(nullptr)
 {
 }
 
 void TensorAllocator::init(const TensorAllocator &allocator, const Coordinates &coords, TensorInfo sub_info)
 {
-    // Get parent info
-    const TensorInfo parent_info = allocator.info();
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+
+    // The memory of the parent is looked up when the data is accessed: the parent doesn't need to be allocated yet
+    _parent = (allocator._parent != nullptr) ? allocator._parent : &allocator;
+
+    init_sub_tensor(allocator.info(), coords, std::move(sub_info));
+}
+
+uint8_t *TensorAllocator::data() const
+{
+    return (_parent != nullptr) ? _parent->data() : _buffer.get();
+}
 
-    // Check if coordinates and new shape are within the parent tensor
-    ARM_COMPUTE_ERROR_ON(!validate_subtensor_shape(parent_info, sub_info, coords));
-    ARM_COMPUTE_UNUSED(validate_subtensor_shape);
+bool TensorAllocator::is_sub_tensor() const
+{
+    return _parent != nullptr;
+}
 
-    // Copy pointer to buffer
-    _buffer = allocator._buffer;
+void TensorAllocator::set_allocator(IAllocator *allocator)
+{
+    ARM_COMPUTE_ERROR_ON(allocator == nullptr);
 
-    // Init tensor info with new dimensions
-    size_t total_size = parent_info.offset_element_in_bytes(coords) + sub_info.total_size() - sub_info.offset_first_element_in_bytes();
-    sub_info.init(sub_info.tensor_shape(), sub_info.format(), parent_info.strides_in_bytes(), parent_info.offset_element_in_bytes(coords), total_size);
+    _allocator = allocator;
+}
 
-    // Set TensorInfo
-    init(sub_info);
+void TensorAllocator::set_default_allocator(IAllocator *allocator)
+{
+    default_allocator_override = allocator;
 }
 
-uint8_t *TensorAllocator::data() const
+IAllocator *TensorAllocator::default_allocator()
 {
-    return (_buffer != nullptr) ? _buffer.get()->data() : nullptr;
+    return (default_allocator_override != nullptr) ? default_allocator_override : &PoolAllocator::get();
 }
 
 void TensorAllocator::allocate()
 {
     ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
 
-    _buffer = std::make_shared<std::vector<uint8_t>>(info().total_size());
+    const StartupScope startup_scope(StartupStage::ALLOCATE, "tensor", (_parent == nullptr && _associated_memory_planner == nullptr) ? info().total_size() : 0);
+
+    if(_parent != nullptr)
+    {
+        // The memory belongs to the parent
+    }
+    else if(_associated_memory_planner == nullptr)
+    {
+        IAllocator *allocator = _allocator;
+        uint8_t    *ptr       = static_cast<uint8_t *>(allocator->allocate(info().total_size(), tensor_alignment));
+
+        // The block is returned to the allocator when the last tensor sharing it is freed
+        _buffer = std::shared_ptr<uint8_t>(ptr, [allocator](uint8_t *p)
+        {
+            allocator->free(p);
+        });
+    }
+    else
+    {
+        _associated_memory_planner->finalize(this);
+    }
+    info().set_is_resizable(false);
+}
+
+void TensorAllocator::import_memory(std::shared_ptr<uint8_t> buffer)
+{
+    ARM_COMPUTE_ERROR_ON(_buffer != nullptr);
+    ARM_COMPUTE_ERROR_ON(buffer == nullptr);
+    ARM_COMPUTE_ERROR_ON_MSG(_parent != nullptr, "The memory of a sub-tensor belongs to its parent");
+    ARM_COMPUTE_ERROR_ON_MSG(_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+
+    _buffer = std::move(buffer);
     info().set_is_resizable(false);
 }
 
+void TensorAllocator::allocate_contiguous(const std::vector<TensorAllocator *> &allocators)
+{
+    ARM_COMPUTE_ERROR_ON(allocators.empty());
+
+    // Offset of each tensor in the block: every part starts on a cache line
+    std::vector<size_t> offsets;
+    offsets.reserve(allocators.size());
+
+    size_t block_size = 0;
+    for(const TensorAllocator *tensor : allocators)
+    {
+        ARM_COMPUTE_ERROR_ON(tensor->_buffer != nullptr);
+        ARM_COMPUTE_ERROR_ON_MSG(tensor->_associated_memory_planner != nullptr, "The memory of a managed tensor is bound by its memory planner");
+
+        offsets.push_back(block_size);
+        block_size += ceil_to_multiple(tensor->info().total_size(), tensor_alignment);
+    }
+
+    IAllocator *allocator = allocators.front()->_allocator;
+    uint8_t    *ptr       = static_cast<uint8_t *>(allocator->allocate(block_size, tensor_alignment));
+
+    const std::shared_ptr<uint8_t> block(ptr, [allocator](uint8_t *p)
+    {
+        allocator->free(p);
+    });
+
+    // Each tensor shares the ownership of the whole block but points to its own part of it
+    for(size_t i = 0; i < allocators.size(); ++i)
+    {
+        allocators[i]->import_memory(std::shared_ptr<uint8_t>(block, ptr + offsets[i]));
+    }
+}
+
 void TensorAllocator::free()
 {
+    if(_parent != nullptr)
+    {
+        // The memory belongs to the parent and the layout of a sub-tensor is fixed
+        return;
+    }
+
     ARM_COMPUTE_ERROR_ON(_buffer == nullptr);
 
     _buffer.reset();
@@ -111,7 +176,7 @@ void TensorAllocator::free()
 
 uint8_t *TensorAllocator::lock()
 {
-    return (_buffer != nullptr) ? _buffer.get()->data() : nullptr;
+    return data();
 }
 
 void TensorAllocator::unlock()
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/TensorBlob.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/ITensor.h"
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/core/Window.h"
+
+#include <cstdint>
+
+using namespace arm_compute;
+
+namespace
+{
+/** Tag identifying a tensor blob, followed by the version of its layout */
+constexpr uint32_t blob_magic   = 0x424c5441; // "ATLB"
+constexpr uint32_t blob_version = 1;
+
+template <typename T>
+void write_value(std::ostream &stream, T value)
+{
+    stream.write(reinterpret_cast<const char *>(&value), sizeof(T));
+}
+
+template <typename T>
+bool read_value(std::istream &stream, T &value)
+{
+    return static_cast<bool>(stream.read(reinterpret_cast<char *>(&value), sizeof(T)));
+}
+
+/** Window iterating over the rows of a tensor */
+Window rows_window(const TensorInfo &info)
+{
+    Window window;
+    window.use_tensor_dimensions(&info);
+    window.set(Window::DimX, Window::Dimension(0, 1, 1));
+    return window;
+}
+} // namespace
+
+void arm_compute::save_tensor_blob(const ITensor &tensor, std::ostream &stream)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+
+    const TensorInfo  &info  = *tensor.info();
+    const TensorShape &shape = info.tensor_shape();
+
+    write_value(stream, blob_magic);
+    write_value(stream, blob_version);
+    write_value(stream, static_cast<uint32_t>(info.data_type()));
+    write_value(stream, static_cast<uint32_t>(info.num_channels()));
+    write_value(stream, static_cast<uint32_t>(shape.num_dimensions()));
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        write_value(stream, static_cast<uint32_t>(shape[d]));
+    }
+
+    // The rows are written one after the other, without the padding
+    const size_t row_size = shape[0] * info.element_size();
+    const Window window   = rows_window(info);
+    Iterator     it(&tensor, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        stream.write(reinterpret_cast<const char *>(it.ptr()), row_size);
+    },
+    it);
+}
+
+bool arm_compute::load_tensor_blob(ITensor &tensor, std::istream &stream)
+{
+    ARM_COMPUTE_ERROR_ON(tensor.buffer() == nullptr);
+
+    const TensorInfo  &info  = *tensor.info();
+    const TensorShape &shape = info.tensor_shape();
+
+    // Check the key of the blob before touching the tensor
+    uint32_t magic        = 0;
+    uint32_t version      = 0;
+    uint32_t data_type    = 0;
+    uint32_t num_channels = 0;
+    uint32_t num_dims     = 0;
+    if(!read_value(stream, magic) || !read_value(stream, version) || !read_value(stream, data_type) || !read_value(stream, num_channels) || !read_value(stream, num_dims))
+    {
+        return false;
+    }
+
+    if((magic != blob_magic) || (version != blob_version) || (data_type != static_cast<uint32_t>(info.data_type())) || (num_channels != info.num_channels())
+       || (num_dims != shape.num_dimensions()))
+    {
+        return false;
+    }
+
+    for(size_t d = 0; d < shape.num_dimensions(); ++d)
+    {
+        uint32_t dim = 0;
+        if(!read_value(stream, dim) || (dim != shape[d]))
+        {
+            return false;
+        }
+    }
+
+    const size_t row_size = shape[0] * info.element_size();
+    const Window window   = rows_window(info);
+    Iterator     it(&tensor, window);
+
+    execute_window_loop(window, [&](const Coordinates &)
+    {
+        stream.read(reinterpret_cast<char *>(it.ptr()), row_size);
+    },
+    it);
+
+    return static_cast<bool>(stream);
+}
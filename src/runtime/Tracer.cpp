@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "arm_compute/runtime/Tracer.h"
+
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/IKernel.h"
+#include "arm_compute/runtime/Profiler.h"
+
+#include <algorithm>
+#include <cstdio>
+
+#ifdef __ANDROID__
+#include <dlfcn.h>
+#endif /* __ANDROID__ */
+
+#ifdef __linux__
+#include <fcntl.h>
+#include <unistd.h>
+#endif /* __linux__ */
+
+using namespace arm_compute;
+
+namespace
+{
+/** Sink of the markers, opened the first time a marker is emitted */
+class TraceBackend
+{
+public:
+    /** Resolve ATrace on Android, open the trace_marker file otherwise */
+    TraceBackend()
+        : _library(nullptr), _atrace_begin(nullptr), _atrace_end(nullptr), _atrace_is_enabled(nullptr), _marker_fd(-1)
+    {
+#ifdef __ANDROID__
+        _library = dlopen("libandroid.so", RTLD_NOW | RTLD_LOCAL);
+        if(_library != nullptr)
+        {
+            _atrace_begin      = reinterpret_cast<BeginSectionFunc *>(dlsym(_library, "ATrace_beginSection"));
+            _atrace_end        = reinterpret_cast<EndSectionFunc *>(dlsym(_library, "ATrace_endSection"));
+            _atrace_is_enabled = reinterpret_cast<IsEnabledFunc *>(dlsym(_library, "ATrace_isEnabled"));
+        }
+        if(_atrace_begin == nullptr || _atrace_end == nullptr || _atrace_is_enabled == nullptr)
+        {
+            // Older than API level 23: fall back to the trace_marker file
+            _atrace_begin      = nullptr;
+            _atrace_end        = nullptr;
+            _atrace_is_enabled = nullptr;
+        }
+#endif /* __ANDROID__ */
+
+#ifdef __linux__
+        if(_atrace_begin == nullptr)
+        {
+            _marker_fd = open("/sys/kernel/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+            if(_marker_fd < 0)
+            {
+                _marker_fd = open("/sys/kernel/debug/tracing/trace_marker", O_WRONLY | O_CLOEXEC);
+            }
+        }
+#endif /* __linux__ */
+    }
+    /** Prevent instances of this class from being copied (As this class contains a file descriptor) */
+    TraceBackend(const TraceBackend &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a file descriptor) */
+    TraceBackend &operator=(const TraceBackend &) = delete;
+    /** Close the trace_marker file and the library */
+    ~TraceBackend()
+    {
+#ifdef __linux__
+        if(_marker_fd >= 0)
+        {
+            close(_marker_fd);
+        }
+#endif /* __linux__ */
+#ifdef __ANDROID__
+        if(_library != nullptr)
+        {
+            dlclose(_library);
+        }
+#endif /* __ANDROID__ */
+    }
+
+    bool is_enabled() const
+    {
+        if(_atrace_is_enabled != nullptr)
+        {
+            return _atrace_is_enabled();
+        }
+        return _marker_fd >= 0;
+    }
+
+    void begin_section(const char *name) const
+    {
+        if(_atrace_begin != nullptr)
+        {
+            _atrace_begin(name);
+            return;
+        }
+        write_marker('B', name);
+    }
+
+    void end_section() const
+    {
+        if(_atrace_end != nullptr)
+        {
+            _atrace_end();
+            return;
+        }
+        write_marker('E', nullptr);
+    }
+
+private:
+    using BeginSectionFunc = void(const char *);
+    using EndSectionFunc   = void();
+    using IsEnabledFunc    = bool();
+
+    /** Write a marker in the format of atrace: "B|pid|name" to begin a section, "E|pid" to end it
+     *
+     * @param[in] type Type of the marker: 'B' or 'E'.
+     * @param[in] name Name of the section, nullptr for the end markers.
+     */
+    void write_marker(char type, const char *name) const
+    {
+#ifdef __linux__
+        if(_marker_fd < 0)
+        {
+            return;
+        }
+
+        // A marker is a single write so that the markers of different threads don't interleave
+        char      buffer[256];
+        const int length = (name != nullptr) ? std::snprintf(buffer, sizeof(buffer), "%c|%d|%s", type, static_cast<int>(getpid()), name) :
+                           std::snprintf(buffer, sizeof(buffer), "%c|%d", type, static_cast<int>(getpid()));
+        if(length > 0)
+        {
+            const ssize_t ret = write(_marker_fd, buffer, std::min<size_t>(length, sizeof(buffer) - 1));
+            ARM_COMPUTE_UNUSED(ret);
+        }
+#else  /* __linux__ */
+        ARM_COMPUTE_UNUSED(type);
+        ARM_COMPUTE_UNUSED(name);
+#endif /* __linux__ */
+    }
+
+    void             *_library;
+    BeginSectionFunc *_atrace_begin;
+    EndSectionFunc   *_atrace_end;
+    IsEnabledFunc    *_atrace_is_enabled;
+    int               _marker_fd;
+};
+
+TraceBackend &backend()
+{
+    static TraceBackend trace_backend;
+    return trace_backend;
+}
+} // namespace
+
+bool Tracer::is_enabled()
+{
+    return backend().is_enabled();
+}
+
+void Tracer::begin_section(const char *name)
+{
+    backend().begin_section(name);
+}
+
+void Tracer::end_section()
+{
+    backend().end_section();
+}
+
+TraceSection::TraceSection(const IKernel &kernel)
+    : _is_active(Tracer::is_enabled())
+{
+    if(_is_active)
+    {
+        Tracer::begin_section(Profiler::kernel_name(kernel).c_str());
+    }
+}
+
+TraceSection::TraceSection(const std::string &name)
+    : _is_active(!name.empty() && Tracer::is_enabled())
+{
+    if(_is_active)
+    {
+        Tracer::begin_section(name.c_str());
+    }
+}
+
+TraceSection::~TraceSection()
+{
+    if(_is_active)
+    {
+        Tracer::end_section();
+    }
+}
@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "DatasetLoader.h"
+
+#include "Utils.h"
+#ifdef ARM_COMPUTE_JPEG
+#include "JPEGLoader.h"
+#endif /* ARM_COMPUTE_JPEG */
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/NEON/kernels/NECropResizeKernel.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/runtime/Array.h"
+
+#include <fstream>
+#include <utility>
+
+using namespace arm_compute;
+
+std::vector<test_helpers::DatasetEntry> test_helpers::load_dataset_list(const std::string &list_filename)
+{
+    std::ifstream fs(list_filename);
+
+    if(!fs.is_open())
+    {
+        ARM_COMPUTE_ERROR("Cannot open dataset list %s", list_filename.c_str());
+    }
+
+    std::vector<DatasetEntry> dataset;
+    std::string               path;
+    unsigned int              label = 0;
+
+    while(fs >> path >> label)
+    {
+        dataset.push_back(DatasetEntry{ path, label });
+    }
+
+    return dataset;
+}
+
+test_helpers::PrefetchingLoader::PrefetchingLoader(std::vector<DatasetEntry> dataset, const TensorInfo &input_info, unsigned int num_slots, unsigned int num_workers, float mean, float scale)
+    : _dataset(std::move(dataset)), _mean(mean), _scale(scale), _slots(arm_compute::cpp14::make_unique<Slot[]>(num_slots)), _num_slots(num_slots), _next_to_load(0), _next_to_acquire(0),
+      _stop(false), _error(), _mutex(), _cv(), _workers()
+{
+    ARM_COMPUTE_ERROR_ON(num_slots == 0 || num_workers == 0);
+    ARM_COMPUTE_ERROR_ON(input_info.data_type() != DataType::F32 || input_info.dimension(2) != 3);
+
+    for(size_t i = 0; i < _num_slots; ++i)
+    {
+        _slots[i].tensor.allocator()->init(input_info);
+        _slots[i].tensor.allocator()->allocate();
+        _slots[i].sequence = i;
+        _slots[i].ready    = false;
+    }
+
+    for(unsigned int i = 0; i < num_workers; ++i)
+    {
+        _workers.emplace_back(&PrefetchingLoader::worker, this);
+    }
+}
+
+test_helpers::PrefetchingLoader::~PrefetchingLoader()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stop = true;
+    }
+    _cv.notify_all();
+
+    for(auto &worker : _workers)
+    {
+        worker.join();
+    }
+}
+
+const Tensor *test_helpers::PrefetchingLoader::acquire(unsigned int &label)
+{
+    std::unique_lock<std::mutex> lock(_mutex);
+
+    if(_next_to_acquire >= _dataset.size())
+    {
+        return nullptr;
+    }
+
+    Slot &slot = _slots[_next_to_acquire % _num_slots];
+
+    _cv.wait(lock, [&]
+    {
+        return slot.ready || _error != nullptr;
+    });
+
+    if(_error != nullptr)
+    {
+        std::rethrow_exception(_error);
+    }
+
+    label = _dataset[_next_to_acquire].label;
+
+    return &slot.tensor;
+}
+
+void test_helpers::PrefetchingLoader::release()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+
+        Slot &slot = _slots[_next_to_acquire % _num_slots];
+        ARM_COMPUTE_ERROR_ON(!slot.ready);
+
+        // The slot can now receive the image num_slots images further in the dataset
+        slot.ready = false;
+        slot.sequence += _num_slots;
+        ++_next_to_acquire;
+    }
+    _cv.notify_all();
+}
+
+void test_helpers::PrefetchingLoader::worker()
+{
+    DetectionWindowArray whole_image(1);
+    NECropResizeKernel   crop_resize;
+
+    try
+    {
+        while(true)
+        {
+            size_t index = 0;
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+
+                if(_stop || _error != nullptr || _next_to_load >= _dataset.size())
+                {
+                    return;
+                }
+
+                index = _next_to_load++;
+            }
+
+            // Decode the image before waiting for its slot: the slot might still hold an image the network has not run on yet
+            Slot &slot = _slots[index % _num_slots];
+            Image image;
+#ifdef ARM_COMPUTE_JPEG
+            if(is_jpeg_file(_dataset[index].path))
+            {
+                // Only decode the image at the smallest scale which is still larger than the input of the network
+                JPEGLoader jpeg;
+                jpeg.open(_dataset[index].path);
+                jpeg.init_image(image, slot.tensor.info()->dimension(0), slot.tensor.info()->dimension(1));
+                image.allocator()->allocate();
+                jpeg.fill_image(image);
+            }
+            else
+#endif /* ARM_COMPUTE_JPEG */
+            {
+                PPMLoader ppm;
+                ppm.open(_dataset[index].path);
+                ppm.init_image(image, Format::RGB888);
+                image.allocator()->allocate();
+                ppm.fill_image(image);
+            }
+
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+
+                _cv.wait(lock, [&]
+                {
+                    return _stop || (slot.sequence == index && !slot.ready);
+                });
+
+                if(_stop)
+                {
+                    return;
+                }
+            }
+
+            // Resize the whole image to the input of the network
+            DetectionWindow window;
+            window.width  = image.info()->dimension(0);
+            window.height = image.info()->dimension(1);
+
+            whole_image.clear();
+            whole_image.push_back(window);
+
+            crop_resize.configure(&image, &whole_image, &slot.tensor, _mean, _scale);
+            crop_resize.run(crop_resize.window());
+
+            {
+                std::lock_guard<std::mutex> lock(_mutex);
+                slot.ready = true;
+            }
+            _cv.notify_all();
+        }
+    }
+    catch(...)
+    {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _error = std::current_exception();
+        }
+        _cv.notify_all();
+    }
+}
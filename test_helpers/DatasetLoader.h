@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __TESTHELPERS_DATASETLOADER_H__
+#define __TESTHELPERS_DATASETLOADER_H__
+
+#include "arm_compute/core/TensorInfo.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace test_helpers
+{
+/** Image of a dataset and its ground truth label */
+struct DatasetEntry
+{
+    std::string  path;  /**< Path of the PPM file (or JPEG file if the examples are built with jpeg=1) */
+    unsigned int label; /**< Index of the expected class */
+};
+
+/** Read the list of the images of a dataset
+ *
+ * Each line of the file holds the path of a PPM file and its ground truth label separated by a space, e.g. "images/0001.ppm 42"
+ * If the examples are built with jpeg=1, the files with a .jpg or .jpeg extension are decoded as JPEG files.
+ *
+ * @param[in] list_filename File listing the images of the dataset
+ *
+ * @return The entries of the dataset, in the order of the file
+ */
+std::vector<DatasetEntry> load_dataset_list(const std::string &list_filename);
+
+/** Loader decoding and preprocessing the images of a dataset in background threads
+ *
+ * The images are written to a ring of @p num_slots input tensors: while the network runs on one image, the workers decode the
+ * next PPM files and resize them to the input of the network (See @ref arm_compute::NECropResizeKernel). The images are returned in
+ * the order of the dataset.
+ *
+ * JPEG files are decoded at 1/2, 1/4 or 1/8 of their size when it is still larger than the input of the network (See @ref JPEGLoader),
+ * so only the remaining ratio is left to the resize.
+ *
+ * @note The workers run the kernels directly on their thread, they don't use the scheduler of the network.
+ */
+class PrefetchingLoader
+{
+public:
+    /** Start the workers
+     *
+     * @param[in] dataset     Images to load
+     * @param[in] input_info  Info of the input tensor of the network [width, height, 3]. Data type supported: F32
+     * @param[in] num_slots   Number of images which can be loaded in advance
+     * @param[in] num_workers Number of threads decoding the images
+     * @param[in] mean        Value subtracted from each channel
+     * @param[in] scale       Factor applied to each channel once the mean is subtracted
+     */
+    PrefetchingLoader(std::vector<DatasetEntry> dataset, const arm_compute::TensorInfo &input_info, unsigned int num_slots, unsigned int num_workers, float mean, float scale);
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PrefetchingLoader(const PrefetchingLoader &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains threads) */
+    PrefetchingLoader &operator=(const PrefetchingLoader &) = delete;
+    /** Stop and join the workers */
+    ~PrefetchingLoader();
+
+    /** Wait for the next image of the dataset
+     *
+     * @note The tensor stays valid until @ref release() is called.
+     *
+     * @param[out] label Ground truth label of the image
+     *
+     * @return The preprocessed image, or nullptr once all the images have been returned. Rethrows the errors of the workers.
+     */
+    const arm_compute::Tensor *acquire(unsigned int &label);
+    /** Give the slot of the image returned by the last call to @ref acquire() back to the workers */
+    void release();
+
+private:
+    /** Slot of the ring of preprocessed images */
+    struct Slot
+    {
+        /** Default constructor */
+        Slot()
+            : tensor(), sequence(0), ready(false)
+        {
+        }
+        arm_compute::Tensor tensor;   /**< Preprocessed image */
+        size_t              sequence; /**< Index in the dataset of the next image to write in the slot */
+        bool                ready;    /**< True once the image of index sequence has been written */
+    };
+
+    /** Body of the worker threads */
+    void worker();
+
+    std::vector<DatasetEntry> _dataset;
+    float                     _mean;
+    float                     _scale;
+    std::unique_ptr<Slot[]>   _slots;
+    size_t                    _num_slots;
+    size_t                    _next_to_load;    /**< Index of the next image to claim by a worker */
+    size_t                    _next_to_acquire; /**< Index of the next image to return by acquire() */
+    bool                      _stop;
+    std::exception_ptr        _error; /**< First error raised by a worker, rethrown by acquire() */
+    std::mutex                _mutex;
+    std::condition_variable   _cv;
+    std::vector<std::thread>  _workers;
+};
+}
+#endif /* __TESTHELPERS_DATASETLOADER_H__ */
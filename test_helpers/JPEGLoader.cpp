@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#include "JPEGLoader.h"
+
+#include "Utils.h"
+#include "arm_compute/core/Error.h"
+#include "arm_compute/core/Helpers.h"
+#include "arm_compute/core/Types.h"
+#include "arm_compute/core/Validate.h"
+#include "arm_compute/runtime/NEON/functions/NEScale.h"
+#include "arm_compute/runtime/Tensor.h"
+
+#include <algorithm>
+#include <cctype>
+#include <csetjmp>
+#include <cstdio>
+
+extern "C" {
+#include <jpeglib.h>
+}
+
+using namespace arm_compute;
+
+namespace
+{
+/** libjpeg error manager jumping back to the caller instead of exiting */
+struct ErrorManager
+{
+    jpeg_error_mgr pub;                      /**< libjpeg's error manager */
+    jmp_buf        jump;                     /**< Where to jump on error */
+    char           message[JMSG_LENGTH_MAX]; /**< Message of the last error */
+};
+
+void error_exit(j_common_ptr cinfo)
+{
+    ErrorManager *error = reinterpret_cast<ErrorManager *>(cinfo->err);
+    (*cinfo->err->format_message)(cinfo, error->message);
+    longjmp(error->jump, 1);
+}
+} // namespace
+
+/** libjpeg state of a file */
+struct test_helpers::JPEGLoader::Decoder
+{
+    jpeg_decompress_struct cinfo;
+    ErrorManager           error;
+    FILE                  *file;
+};
+
+bool test_helpers::is_jpeg_file(const std::string &filename)
+{
+    const size_t dot = filename.find_last_of('.');
+
+    if(dot == std::string::npos)
+    {
+        return false;
+    }
+
+    std::string extension = filename.substr(dot + 1);
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c)
+    {
+        return std::tolower(c);
+    });
+
+    return extension == "jpg" || extension == "jpeg";
+}
+
+test_helpers::JPEGLoader::JPEGLoader()
+    : _decoder(), _filename()
+{
+}
+
+test_helpers::JPEGLoader::~JPEGLoader()
+{
+    close();
+}
+
+void test_helpers::JPEGLoader::open(const std::string &jpeg_filename)
+{
+    ARM_COMPUTE_ERROR_ON(is_open());
+
+    FILE *file = std::fopen(jpeg_filename.c_str(), "rb");
+
+    if(file == nullptr)
+    {
+        ARM_COMPUTE_ERROR("Cannot open %s", jpeg_filename.c_str());
+    }
+
+    _decoder       = arm_compute::cpp14::make_unique<Decoder>();
+    _decoder->file = file;
+    _filename      = jpeg_filename;
+
+    jpeg_decompress_struct &cinfo = _decoder->cinfo;
+
+    cinfo.err                      = jpeg_std_error(&_decoder->error.pub);
+    _decoder->error.pub.error_exit = error_exit;
+
+    // Nothing with a destructor lives between setjmp() and the libjpeg calls, so jumping back here is safe
+    if(setjmp(_decoder->error.jump))
+    {
+        const std::string message = _decoder->error.message;
+        close();
+        ARM_COMPUTE_ERROR("Decoding %s: %s", jpeg_filename.c_str(), message.c_str());
+    }
+
+    jpeg_create_decompress(&cinfo);
+    jpeg_stdio_src(&cinfo, file);
+    jpeg_read_header(&cinfo, TRUE);
+}
+
+bool test_helpers::JPEGLoader::is_open() const
+{
+    return _decoder != nullptr;
+}
+
+TensorInfo test_helpers::JPEGLoader::decoded_info(unsigned int min_width, unsigned int min_height)
+{
+    ARM_COMPUTE_ERROR_ON(!is_open());
+
+    jpeg_decompress_struct &cinfo = _decoder->cinfo;
+
+    // Pick the largest supported reduction which keeps the image at least as large as requested
+    unsigned int denom = 8;
+    while(denom > 1 && ((cinfo.image_width + denom - 1) / denom < min_width || (cinfo.image_height + denom - 1) / denom < min_height))
+    {
+        denom /= 2;
+    }
+
+    if(setjmp(_decoder->error.jump))
+    {
+        const std::string message = _decoder->error.message;
+        close();
+        ARM_COMPUTE_ERROR("Decoding %s: %s", _filename.c_str(), message.c_str());
+    }
+
+    cinfo.scale_num       = 1;
+    cinfo.scale_denom     = denom;
+    cinfo.out_color_space = JCS_RGB;
+    cinfo.dct_method      = JDCT_ISLOW;
+    jpeg_calc_output_dimensions(&cinfo);
+
+    return TensorInfo(cinfo.output_width, cinfo.output_height, Format::RGB888);
+}
+
+void test_helpers::JPEGLoader::fill_image(ITensor &image)
+{
+    ARM_COMPUTE_ERROR_ON(!is_open());
+    ARM_COMPUTE_ERROR_ON_FORMAT_NOT_IN(&image, Format::RGB888);
+
+    jpeg_decompress_struct &cinfo = _decoder->cinfo;
+
+    if(setjmp(_decoder->error.jump))
+    {
+        const std::string message = _decoder->error.message;
+        close();
+        ARM_COMPUTE_ERROR("Decoding %s: %s", _filename.c_str(), message.c_str());
+    }
+
+    jpeg_start_decompress(&cinfo);
+
+    ARM_COMPUTE_ERROR_ON(image.info()->dimension(0) != cinfo.output_width || image.info()->dimension(1) != cinfo.output_height);
+
+    // Decode the rows straight into the image
+    while(cinfo.output_scanline < cinfo.output_height)
+    {
+        JSAMPROW row = image.buffer() + image.info()->offset_element_in_bytes(Coordinates(0, static_cast<int>(cinfo.output_scanline)));
+        jpeg_read_scanlines(&cinfo, &row, 1);
+    }
+
+    jpeg_finish_decompress(&cinfo);
+    close();
+}
+
+void test_helpers::JPEGLoader::fill_planar_tensor(ITensor &tensor, const std::array<float, 3> &mean, float scale)
+{
+    ARM_COMPUTE_ERROR_ON(!is_open());
+    ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, DataType::F32);
+    ARM_COMPUTE_ERROR_ON(tensor.info()->dimension(2) != 3);
+
+    const unsigned int width  = tensor.info()->dimension(0);
+    const unsigned int height = tensor.info()->dimension(1);
+
+    Image decoded;
+    Image resized;
+    init_image(decoded, width, height);
+
+    const bool needs_resize = decoded.info()->dimension(0) != width || decoded.info()->dimension(1) != height;
+
+    NEScale resize;
+    if(needs_resize)
+    {
+        resized.allocator()->init(TensorInfo(width, height, Format::RGB888));
+        resize.configure(&decoded, &resized, InterpolationPolicy::BILINEAR, BorderMode::REPLICATE);
+        resized.allocator()->allocate();
+    }
+
+    decoded.allocator()->allocate();
+    fill_image(decoded);
+
+    if(needs_resize)
+    {
+        resize.run();
+    }
+
+    const Image &rgb          = needs_resize ? resized : decoded;
+    const size_t plane_stride = tensor.info()->strides_in_bytes()[2];
+
+    for(unsigned int y = 0; y < height; ++y)
+    {
+        const uint8_t *src = rgb.buffer() + rgb.info()->offset_element_in_bytes(Coordinates(0, static_cast<int>(y)));
+        uint8_t *const row = tensor.buffer() + tensor.info()->offset_element_in_bytes(Coordinates(0, static_cast<int>(y), 0));
+
+        rgb888_to_planar_f32(src, reinterpret_cast<float *>(row), reinterpret_cast<float *>(row + plane_stride), reinterpret_cast<float *>(row + 2 * plane_stride), width, mean, scale);
+    }
+}
+
+void test_helpers::JPEGLoader::close()
+{
+    if(_decoder != nullptr)
+    {
+        jpeg_destroy_decompress(&_decoder->cinfo);
+        std::fclose(_decoder->file);
+        _decoder.reset();
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2017 ARM Limited.
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to
+ * deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+ * sell copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#ifndef __TESTHELPERS_JPEGLOADER_H__
+#define __TESTHELPERS_JPEGLOADER_H__
+
+#include "arm_compute/core/ITensor.h"
+
+#include <array>
+#include <memory>
+#include <string>
+
+namespace test_helpers
+{
+/** Return true if the extension of a file is the one of a JPEG file (.jpg or .jpeg, case insensitive)
+ *
+ * @param[in] filename Name of the file
+ *
+ * @return True if the file is a JPEG file
+ */
+bool is_jpeg_file(const std::string &filename);
+
+/** Class to load the content of a JPEG file into an Image
+ *
+ * The file can be decoded at 1/2, 1/4 or 1/8 of its size: the scaling is done in the DCT domain by libjpeg, which is much
+ * cheaper than decoding the full size image and resizing it.
+ *
+ * @note Only available if the examples are built with jpeg=1
+ */
+class JPEGLoader
+{
+public:
+    /** Default constructor */
+    JPEGLoader();
+    /** Prevent instances of this class from being copied (As this class contains a file) */
+    JPEGLoader(const JPEGLoader &) = delete;
+    /** Prevent instances of this class from being copied (As this class contains a file) */
+    JPEGLoader &operator=(const JPEGLoader &) = delete;
+    /** Close the file currently open */
+    ~JPEGLoader();
+
+    /** Open a JPEG file and reads its metadata (Width, height)
+     *
+     * @param[in] jpeg_filename File to open
+     */
+    void open(const std::string &jpeg_filename);
+    /** Return true if a JPEG file is currently open */
+    bool is_open() const;
+
+    /** Initialise an image's metadata with the dimensions the JPEG file currently open will be decoded to
+     *
+     * The file is decoded at the smallest scale out of 1/8, 1/4, 1/2 and 1 which is at least @p min_width x @p min_height.
+     *
+     * @param[out] image      Image to initialise
+     * @param[in]  min_width  (Optional) Minimum width of the decoded image (0 to decode the image at its full size)
+     * @param[in]  min_height (Optional) Minimum height of the decoded image (0 to decode the image at its full size)
+     */
+    template <typename T>
+    void init_image(T &image, unsigned int min_width = 0, unsigned int min_height = 0)
+    {
+        image.allocator()->init(decoded_info(min_width, min_height));
+    }
+    /** Decode the JPEG file currently open into an image and close the file
+     *
+     * @param[in,out] image Image to fill (Must be allocated, and initialised with @ref init_image()). Format supported: RGB888
+     */
+    void fill_image(arm_compute::ITensor &image);
+    /** Fill a 3D tensor with the planar red, green and blue channels of the JPEG file currently open, normalized to (pixel - mean) * scale, and close the file
+     *
+     * The file is decoded at the smallest scale which is at least as large as the tensor, then resized with @ref arm_compute::NEScale if the dimensions don't match.
+     *
+     * @param[in,out] tensor Tensor to fill (Must be allocated, of shape [width, height, 3]). Data types supported: F32
+     * @param[in]     mean   (Optional) Value subtracted from the red, green and blue channels
+     * @param[in]     scale  (Optional) Factor applied to each channel once the mean is subtracted
+     */
+    void fill_planar_tensor(arm_compute::ITensor &tensor, const std::array<float, 3> &mean = { { 0.f, 0.f, 0.f } }, float scale = 1.f);
+
+private:
+    /** Select the scale at which the file will be decoded
+     *
+     * @param[in] min_width  Minimum width of the decoded image
+     * @param[in] min_height Minimum height of the decoded image
+     *
+     * @return The info of the decoded image. Format: RGB888
+     */
+    arm_compute::TensorInfo decoded_info(unsigned int min_width, unsigned int min_height);
+    /** Release the decoder and close the file */
+    void close();
+
+    struct Decoder;
+    std::unique_ptr<Decoder> _decoder; /**< libjpeg state of the file currently open */
+    std::string              _filename;
+};
+}
+#endif /* __TESTHELPERS_JPEGLOADER_H__ */
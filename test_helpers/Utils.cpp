@@ -26,8 +26,13 @@
 #include <cctype>
 #include <cerrno>
 #include <iomanip>
+#include <limits>
 #include <string>
 
+#ifdef __ARM_NEON
+#include <arm_neon.h>
+#endif /* __ARM_NEON */
+
 using namespace arm_compute;
 
 namespace
@@ -165,3 +170,46 @@ std::tuple<unsigned int, unsigned int, int> test_helpers::parse_ppm_header(std::
 
     return std::make_tuple(width, height, max_val);
 }
+
+void test_helpers::rgb888_to_planar_f32(const uint8_t *src, float *dst_r, float *dst_g, float *dst_b, size_t width, const std::array<float, 3> &mean, float scale)
+{
+    float *const dst[3] = { dst_r, dst_g, dst_b };
+
+    size_t x = 0;
+
+#ifdef __ARM_NEON
+    // (pixel - mean) * scale = pixel * scale - mean * scale
+    const float32x4_t vscale = vdupq_n_f32(scale);
+    const float32x4_t voffset[3] =
+    {
+        vdupq_n_f32(-mean[0] * scale),
+        vdupq_n_f32(-mean[1] * scale),
+        vdupq_n_f32(-mean[2] * scale)
+    };
+
+    for(; x + 16 <= width; x += 16, src += 48)
+    {
+        const uint8x16x3_t pixels = vld3q_u8(src);
+
+        for(size_t c = 0; c < 3; ++c)
+        {
+            const uint16x8_t low  = vmovl_u8(vget_low_u8(pixels.val[c]));
+            const uint16x8_t high = vmovl_u8(vget_high_u8(pixels.val[c]));
+
+            vst1q_f32(dst[c] + x, vmlaq_f32(voffset[c], vcvtq_f32_u32(vmovl_u16(vget_low_u16(low))), vscale));
+            vst1q_f32(dst[c] + x + 4, vmlaq_f32(voffset[c], vcvtq_f32_u32(vmovl_u16(vget_high_u16(low))), vscale));
+            vst1q_f32(dst[c] + x + 8, vmlaq_f32(voffset[c], vcvtq_f32_u32(vmovl_u16(vget_low_u16(high))), vscale));
+            vst1q_f32(dst[c] + x + 12, vmlaq_f32(voffset[c], vcvtq_f32_u32(vmovl_u16(vget_high_u16(high))), vscale));
+        }
+    }
+#endif /* __ARM_NEON */
+
+    // Compute left over pixels, or all of them when NEON isn't available
+    for(; x < width; ++x, src += 3)
+    {
+        for(size_t c = 0; c < 3; ++c)
+        {
+            dst[c][x] = (src[c] - mean[c]) * scale;
+        }
+    }
+}
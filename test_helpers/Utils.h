@@ -35,10 +35,12 @@
 #include "arm_compute/runtime/CL/CLTensor.h"
 #endif /* ARM_COMPUTE_CL */
 
+#include <array>
 #include <cstdlib>
 #include <cstring>
 #include <fstream>
 #include <iostream>
+#include <vector>
 
 namespace test_helpers
 {
@@ -76,13 +78,25 @@ void draw_detection_rectangle(arm_compute::ITensor *tensor, const arm_compute::D
  */
 std::tuple<unsigned int, unsigned int, int> parse_ppm_header(std::ifstream &fs);
 
+/** Deinterleave a row of RGB888 pixels into 3 planes of floats: (pixel - mean) * scale
+ *
+ * @param[in]  src   Row of interleaved RGB888 pixels
+ * @param[out] dst_r Row of the red plane
+ * @param[out] dst_g Row of the green plane
+ * @param[out] dst_b Row of the blue plane
+ * @param[in]  width Number of pixels of the row
+ * @param[in]  mean  Value subtracted from the red, green and blue channels
+ * @param[in]  scale Factor applied to each channel once the mean is subtracted
+ */
+void rgb888_to_planar_f32(const uint8_t *src, float *dst_r, float *dst_g, float *dst_b, size_t width, const std::array<float, 3> &mean, float scale);
+
 /** Class to load the content of a PPM file into an Image
  */
 class PPMLoader
 {
 public:
     PPMLoader()
-        : _fs(), _width(0), _height(0)
+        : _fs(), _width(0), _height(0), _pixels()
     {
     }
     /** Open a PPM file and reads its metadata (Width, height)
@@ -151,39 +165,30 @@ public:
                 image.map();
             }
 #endif
-            // Check if the file is large enough to fill the image
-            const size_t current_position = _fs.tellg();
-            _fs.seekg(0, std::ios_base::end);
-            const size_t end_position = _fs.tellg();
-            _fs.seekg(current_position, std::ios_base::beg);
+            // Read all the pixels at once, the rows are then converted from memory
+            read_pixels();
 
-            ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) < image.info()->tensor_shape().total_size() * image.info()->element_size(),
-                                     "Not enough data in file");
-            ARM_COMPUTE_UNUSED(end_position);
+            const size_t row_size = _width * 3;
 
             switch(image.info()->format())
             {
                 case arm_compute::Format::U8:
                 {
                     // We need to convert the data from RGB to grayscale:
-                    // Iterate through every pixel of the image
+                    // Iterate through every row of the image
                     arm_compute::Window window;
-                    window.set(arm_compute::Window::DimX, arm_compute::Window::Dimension(0, _width, 1));
                     window.set(arm_compute::Window::DimY, arm_compute::Window::Dimension(0, _height, 1));
 
                     arm_compute::Iterator out(&image, window);
 
-                    unsigned char red   = 0;
-                    unsigned char green = 0;
-                    unsigned char blue  = 0;
-
                     arm_compute::execute_window_loop(window, [&](const arm_compute::Coordinates & id)
                     {
-                        red   = _fs.get();
-                        green = _fs.get();
-                        blue  = _fs.get();
+                        const uint8_t *in = _pixels.data() + id.y() * row_size;
 
-                        *out.ptr() = 0.2126f * red + 0.7152f * green + 0.0722f * blue;
+                        for(unsigned int x = 0; x < _width; ++x, in += 3)
+                        {
+                            out.ptr()[x] = 0.2126f * in[0] + 0.7152f * in[1] + 0.0722f * in[2];
+                        }
                     },
                     out);
 
@@ -201,7 +206,7 @@ public:
                     arm_compute::execute_window_loop(window, [&](const arm_compute::Coordinates & id)
                     {
                         // Copy one row from the input file to the current row of the image:
-                        _fs.read(reinterpret_cast<std::fstream::char_type *>(out.ptr()), _width * image.info()->element_size());
+                        std::memcpy(out.ptr(), _pixels.data() + id.y() * row_size, row_size);
                     },
                     out);
 
@@ -225,9 +230,78 @@ public:
         }
     }
 
+    /** Fill a 3D tensor with the planar red, green and blue channels of the currently open PPM file, normalized to (pixel - mean) * scale.
+     *
+     * @note If the tensor is a CLTensor, the function maps and unmaps the tensor
+     *
+     * @param[in,out] tensor Tensor to fill (Must be allocated, of shape [width, height, 3] matching the opened PPM). Data types supported: F32
+     * @param[in]     mean   (Optional) Value subtracted from the red, green and blue channels
+     * @param[in]     scale  (Optional) Factor applied to each channel once the mean is subtracted
+     */
+    template <typename T>
+    void fill_planar_tensor(T &tensor, const std::array<float, 3> &mean = { { 0.f, 0.f, 0.f } }, float scale = 1.f)
+    {
+        ARM_COMPUTE_ERROR_ON(!is_open());
+        ARM_COMPUTE_ERROR_ON_DATA_TYPE_CHANNEL_NOT_IN(&tensor, 1, arm_compute::DataType::F32);
+        ARM_COMPUTE_ERROR_ON(tensor.info()->dimension(0) != _width || tensor.info()->dimension(1) != _height || tensor.info()->dimension(2) != 3);
+        try
+        {
+#ifdef ARM_COMPUTE_CL
+            // Map buffer if creating a CLTensor
+            if(std::is_same<typename std::decay<T>::type, arm_compute::CLTensor>::value)
+            {
+                tensor.map();
+            }
+#endif
+            // Read all the pixels at once, the rows are then deinterleaved from memory
+            read_pixels();
+
+            const size_t plane_stride = tensor.info()->strides_in_bytes()[2];
+
+            for(unsigned int y = 0; y < _height; ++y)
+            {
+                uint8_t *const row = tensor.buffer() + tensor.info()->offset_element_in_bytes(arm_compute::Coordinates(0, y, 0));
+
+                rgb888_to_planar_f32(_pixels.data() + y * _width * 3, reinterpret_cast<float *>(row), reinterpret_cast<float *>(row + plane_stride),
+                                     reinterpret_cast<float *>(row + 2 * plane_stride), _width, mean, scale);
+            }
+
+#ifdef ARM_COMPUTE_CL
+            // Unmap buffer if creating a CLTensor
+            if(std::is_same<typename std::decay<T>::type, arm_compute::CLTensor>::value)
+            {
+                tensor.unmap();
+            }
+#endif
+        }
+        catch(const std::ifstream::failure &e)
+        {
+            ARM_COMPUTE_ERROR("Loading PPM file: %s", e.what());
+        }
+    }
+
 private:
-    std::ifstream _fs;
-    unsigned int  _width, _height;
+    /** Read all the pixels of the currently open PPM file with a single read, from the current position of the file */
+    void read_pixels()
+    {
+        // Check if the file is large enough to fill the image
+        const size_t current_position = _fs.tellg();
+        _fs.seekg(0, std::ios_base::end);
+        const size_t end_position = _fs.tellg();
+        _fs.seekg(current_position, std::ios_base::beg);
+
+        const size_t num_bytes = static_cast<size_t>(_width) * _height * 3;
+
+        ARM_COMPUTE_ERROR_ON_MSG((end_position - current_position) < num_bytes, "Not enough data in file");
+        ARM_COMPUTE_UNUSED(end_position);
+
+        _pixels.resize(num_bytes);
+        _fs.read(reinterpret_cast<std::fstream::char_type *>(_pixels.data()), num_bytes);
+    }
+
+    std::ifstream        _fs;
+    unsigned int         _width, _height;
+    std::vector<uint8_t> _pixels; /**< Pixels of the file, kept to avoid reallocating them for every image filled */
 };
 
 /** Template helper function to save a tensor image to a PPM file.